@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 59
-#define YY_END_OF_BUFFER 60
+#define YY_NUM_RULES 65
+#define YY_END_OF_BUFFER 66
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,44 +700,50 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[326] =
+static const flex_int16_t yy_accept[382] =
     {   0,
-       52,   52,    0,    0,    0,    0,    0,    0,    0,    0,
-       60,   58,   10,   11,   58,    1,   52,   49,   52,   52,
-       58,   51,   50,   58,   58,   58,   58,   58,   45,   46,
-       58,   58,   58,   47,   48,    5,    5,    5,   58,   58,
-       58,   10,   11,    0,    0,   41,    0,    0,    0,    0,
+       58,   58,    0,    0,    0,    0,    0,    0,    0,    0,
+       66,   64,   10,   11,   64,    1,   58,   55,   58,   58,
+       64,   57,   56,   64,   64,   64,   64,   64,   51,   52,
+       64,   64,   64,   53,   54,    5,    5,    5,   64,   64,
+       64,   10,   11,    0,    0,   47,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    1,   52,   52,    0,   51,   52,    3,    2,    6,
-        0,   52,    0,    0,    0,    0,    0,    0,    4,    0,
-        0,    9,    0,   42,    0,    0,    0,    0,    0,   44,
+        0,    0,    0,    1,   58,   58,    0,   57,    3,    2,
+        6,    0,   58,    0,    0,    0,    0,    0,    0,    4,
+        0,    0,    9,   48,    0,    0,    0,    0,    0,   50,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
-        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
-        0,    0,   43,    0,    0,    0,   20,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   57,   55,    0,   54,   53,    0,
+        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
+        0,    0,   49,    0,    0,    0,    0,   20,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   63,   61,    0,   60,
+       59,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   62,   59,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   56,   53,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   29,    0,    0,    0,
 
-        0,    0,   23,    0,    0,    0,    0,   38,   39,    0,
-        0,    0,    0,    0,   18,   19,   32,    0,    0,    0,
+        0,   29,    0,    0,    0,    0,    0,    0,   23,    0,
+        0,    0,    0,   44,   45,    0,    0,   36,    0,    0,
+        0,    0,   18,   19,   32,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    7,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        7,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   34,   31,    0,    0,    0,    0,    0,
-        0,    0,    0,   27,   16,    0,    0,    0,    0,    0,
-       25,   28,   33,    0,    0,   35,    0,    0,    0,    0,
-        0,   40,    0,    0,    0,    0,    0,    0,    0,   37,
-        0,    0,    0,    0,    0,    0,    0,   13,   14,    0,
-        0,    0,    0,    0,    0,    0,   36,    0,    0,   26,
+        0,    0,    0,    0,   34,   31,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   27,    0,    0,   16,    0,
+        0,    0,    0,    0,   25,   28,   33,    0,    0,   35,
+        0,    0,    0,    0,    0,    0,   46,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   43,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,   13,   14,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   39,
+        0,    0,   26,   41,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,   21,   22,    0,
-        0,    0,    0,    0,   15,   12,    0,    0,    0,    0,
-        0,   30,   17,   24,    0
+        0,    0,    0,    0,    0,    0,    0,    0,   15,   12,
+        0,    0,    0,    0,    0,    0,    0,   38,    0,    0,
+        0,   30,    0,    0,    0,   17,   24,    0,    0,   37,
+        0,    0,    0,    0,    0,    0,   42,    0,    0,   40,
+        0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -754,8 +760,8 @@ static const YY_CHAR yy_ec[256] =
        34,   35,   36,    5,   37,    5,   38,   39,   40,   41,
 
        42,   43,   44,   45,   46,    5,   47,   48,   49,   50,
-       51,   52,    5,   53,   54,   55,   56,   57,    5,   58,
-       59,   60,   61,    5,   62,    5,    5,    5,    5,    5,
+       51,   52,   53,   54,   55,   56,   57,   58,   59,   60,
+       61,   62,   63,    5,   64,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -772,595 +778,373 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[63] =
+static const YY_CHAR yy_meta[65] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    3,    3,    3,
-        3,    5,    5,    5,    5,    5,    5,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    5,    5,    5,
-        5,    5,    5,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[338] =
+static const flex_int16_t yy_base[382] =
     {   0,
-        0,    0,   61,   64,   67,    0,   65,   69,   49,   66,
-      277, 2165,   86,  269,  129,    0,  124, 2165,  172,  129,
-       84,  178, 2165,  250,   91,   76,   71,   89, 2165, 2165,
-       96,   91,   95, 2165, 2165, 2165,   87,  250,  196,    0,
-      222,  119,  236,  114,  199, 2165,  205,  215,  222,  209,
-      235,  252,  273,  279,  287,  297,  304,  310,  317,  323,
-      345,    0,  345,  367,  361,  374,  387, 2165,    0, 2165,
-      144,  215,  128,  134,  119,  171,  185,  135, 2165,  172,
-      204, 2165,  161, 2165,  392,  405,  416,  422,  203,  435,
-      457,  457,  484,  502,  508,  514,  520,  526,  533,  544,
-
-      550,  556,  563,  572,  581,  591,  598,  608,    0,  172,
-      199,  209,  212,  221,  219,  149, 2165,    0,  618,  633,
-      639,  167, 2165,  672,  655,  645, 2165,  700,  715,  722,
-      728,  735,  742,  758,  777,  783,  795,  802,  808,  814,
-      820,  826,  851,  242, 2165, 2165,  275, 2165, 2165,  109,
-        0,  863,  871,  877,  910,  912,  937,  954,  960,  967,
-      978,  985,  991,  998, 1004, 1013, 1021, 1035, 1041, 1051,
-     1057, 1063, 1071, 1077, 2165, 2165,  122,    0, 1093, 1101,
-     1112, 1118, 1128, 1165, 1136, 1148, 1163, 1194, 1211, 1217,
-     1224, 1230, 1236, 1242, 1248, 1261, 2165, 1255, 1267, 1278,
-
-     1291, 1285, 2165, 1298,  109,    0, 1315, 2165, 2165, 1321,
-     1333, 1340, 1346, 1356, 2165, 2165, 2165, 1364, 1381, 1387,
-     1399, 1405, 1412, 1418, 1425, 1440, 1449, 1462, 1468, 1475,
-     2165, 1485, 1499, 1505, 1512, 1521, 1527, 1535, 1542, 1548,
-     1557, 1563, 1570, 2165, 2165, 1584, 1601, 1607, 1614, 1620,
-     1626, 1644, 1650, 2165, 2165, 1656, 1662, 1686, 1692, 1699,
-     2165, 2165, 2165, 1705, 1711, 2165, 1717, 1727, 1735, 1742,
-     1757, 2165, 1765, 1772, 1778, 1784, 1802, 1808, 1820, 2165,
-     1826, 1832, 1838, 1844, 1850, 1856, 1863, 2165, 2165, 1875,
-     1891, 1901, 1910, 1916, 1922, 1928, 2165, 1936, 1947, 2165,
-
-     1953, 1959, 1967, 1975, 1984, 1990, 1998, 2165, 2165, 2005,
-     2011, 2026, 2036, 2048, 2165, 2165, 2054, 2061, 2071, 2084,
-     2091, 2165, 2165, 2165, 2165, 2126, 2131, 2136, 2141, 2146,
-     2151, 2156, 2159,  132,  128,  121,  111
+       65,    1,  129,    1,  188,    1,  190,    1,  202,    1,
+      209,    1,  208,  208,  252,  316,  369,    1,  211,  225,
+      205,    1,    1,  195,  382,  197,  188,  352,    1,    1,
+      191,  175,  179,    1,    1,    1,    1,  230,  196,  408,
+      227,    1,    1,  472,  513,    1,  197,  204,  199,  570,
+      264,  336,  524,  340,  338,  354,  352,  354,  344,  364,
+      365,  498,  492,    1,    1,    1,    1,    1,    1,  634,
+        1,  534,    1,  671,  672,  668,  356,  359,  351,    1,
+      374,  538,    1,    1,  696,  496,  508,  506,  705,    1,
+      762,  491,  510,  549,  518,  597,  646,  653,  649,  671,
+
+      668,  653,  665,  659,  667,  660,  659,  682,  678,  684,
+      696,  701,  712,  673,  682,  690,  685,    1,  792,  678,
+      684,  693,    1,  822,  691,  693,  687,    1,  688,  695,
+      701,  710,  706,  706,  722,  712,  727,  719,  734,  717,
+      732,  733,  733,  721,  728,  757,    1,    1,  748,    1,
+        1,  734,  852,  738,  795,  747,  882,  754,  753,  742,
+      753,  805,  753,  755,  802,  785,  782,  779,  784,  821,
+      771,  780,  798,  830,  788,  801,  844,  840,    1,    1,
+      811,  912,  802,  848,  849,  874,  806,  942,  875,  807,
+      807,  822,  853,  865,  866,  871,  858,  829,  830,  857,
+
+      831,    1,  831,  846,  835,  852,  855,  846,    1,  872,
+      871,  972,  866,    1,    1,  866,  873,    1,  879,  862,
+      883,  891,    1,    1,    1,  892,  890,  891,  909,  888,
+      902,  939,  940,  891,  898,  903,  905,  951,  912,    1,
+      960,  917,  967,  968,  918,  970,  967,  921,  944,  936,
+      938,  987,  994,  995,    1,    1,  951,  961,  998,  999,
+      945,  966,  957,  970, 1003,    1,  975,  976,    1,  964,
+      979,  985,  967,  969,    1,    1,    1,  976,  975,    1,
+      984, 1025,  995,  973,  979,  992,    1,  983,  981,  988,
+      992,  987, 1036, 1037,  988,  990,  990,    1,  998,  997,
+
+     1008, 1009, 1010, 1012, 1015, 1050, 1020,    1,    1, 1013,
+     1054, 1055, 1020, 1021, 1022, 1015, 1019, 1057, 1058,    1,
+     1016, 1020,    1,    1, 1026, 1032, 1068, 1069, 1020, 1021,
+     1028, 1025, 1039, 1037, 1034, 1035, 1075,    1,    1, 1081,
+     1082, 1083, 1044, 1035, 1050, 1038, 1038, 1046,    1,    1,
+     1090, 1092, 1044, 1045, 1095, 1060, 1061,    1, 1062, 1100,
+     1101,    1, 1054, 1054, 1104,    1,    1, 1105, 1057,    1,
+     1075, 1076, 1067, 1072, 1111, 1076,    1, 1064, 1115,    1,
+        1
     } ;
 
-static const flex_int16_t yy_def[338] =
+static const flex_int16_t yy_def[382] =
     {   0,
-      325,    1,  326,  326,    1,    5,    5,    5,    5,    5,
-      325,  325,  325,  325,  327,  328,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  329,
-      325,  325,  325,  330,  327,  325,  327,  327,  327,  331,
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      327,  328,  325,  325,  325,  325,  325,  325,  332,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      329,  325,  330,  325,  325,  327,  327,  327,  333,  327,
-      331,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-
-      327,  327,  327,  327,  327,  327,  327,  327,  332,  325,
-      325,  325,  325,  325,  325,  325,  325,  334,  327,  327,
-      327,  333,  325,  331,  327,  327,  325,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      327,  327,  327,  325,  325,  325,  325,  325,  325,  325,
-      335,  327,  327,  327,  331,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  325,  325,  325,  336,  327,  327,
-      327,  327,  327,  331,  327,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  325,  327,  327,  327,
-
-      327,  327,  325,  327,  325,  337,  327,  325,  325,  327,
-      327,  327,  327,  327,  325,  325,  325,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      325,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      327,  327,  327,  325,  325,  327,  327,  327,  327,  327,
-      327,  327,  327,  325,  325,  327,  327,  327,  327,  327,
-      325,  325,  325,  327,  327,  325,  327,  327,  327,  327,
-      327,  325,  327,  327,  327,  327,  327,  327,  327,  325,
-      327,  327,  327,  327,  327,  327,  327,  325,  325,  327,
-      327,  327,  327,  327,  327,  327,  325,  327,  327,  325,
-
-      327,  327,  327,  327,  327,  327,  327,  325,  325,  327,
-      327,  327,  327,  327,  325,  325,  327,  327,  327,  327,
-      327,  325,  325,  325,    0,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325
+      381,    1,  381,    3,    2,    5,    6,    7,    8,    9,
+      381,  381,  381,  381,  381,  381,  381,  381,   17,   19,
+      381,   19,  381,  381,  381,  381,  381,  381,  381,  381,
+       26,   27,   28,  381,  381,  381,   13,  381,  381,  381,
+      381,   37,   14,  381,   15,  381,   45,   45,   47,  381,
+       45,   49,   48,   45,   52,   52,   45,   57,   45,   58,
+       60,   52,   51,   16,   20,   17,   25,   22,  381,  381,
+      381,   67,   72,  381,  381,  381,   74,   75,   76,  381,
+      381,   40,  381,  381,  381,   45,   45,   45,   50,   45,
+       89,   90,   90,   90,   90,   90,   90,   90,   90,   95,
+
+       90,   90,   90,   99,  104,  104,   90,   96,   90,   90,
+      381,  381,  381,  111,  112,  113,  381,  381,  381,  106,
+       90,  101,  381,   91,   90,  103,  120,  381,   97,  121,
+       90,   90,  130,   90,  122,  131,  110,  133,   90,  127,
+      137,  141,  132,  102,  134,  381,  381,  381,  146,  381,
+      381,  381,  381,  145,   90,  109,  124,  108,  142,  154,
+      135,   90,   90,  131,   90,  139,  159,  156,  167,   94,
+      129,  126,  169,  165,  160,  173,  170,  174,  381,  381,
+      381,  381,   98,  177,  184,  185,  125,  157,  185,  187,
+      183,  191,  185,  193,  194,  178,  163,  175,  198,  199,
+
+      199,  381,  140,  176,  201,  192,  168,  203,  381,  158,
+      381,  381,  206,  381,  381,  190,  161,  381,  191,  208,
+      213,  204,  381,  381,  381,  221,  191,  227,  228,  164,
+      222,  195,  232,  220,  216,  207,  234,  196,  228,  381,
+      238,  230,  232,  243,  171,  243,  241,  244,  236,  242,
+      205,  246,  252,  253,  381,  381,  239,  231,  254,  259,
+      229,  237,  235,  263,  259,  381,  258,  267,  381,  250,
+      268,  271,  237,  273,  381,  381,  381,  274,  251,  381,
+      249,  265,  264,  261,  274,  217,  381,  279,  245,  257,
+      226,  288,  282,  293,  285,  270,  295,  381,  260,  278,
+
+      271,  301,  302,  302,  304,  294,  283,  381,  381,  281,
+      306,  311,  304,  313,  314,  263,  291,  247,  318,  381,
+      292,  290,  381,  381,  310,  325,  311,  327,  297,  329,
+      322,  296,  314,  325,  316,  335,  318,  381,  381,  328,
+      340,  341,  334,  330,  333,  332,  344,  299,  381,  381,
+      341,  351,  346,  353,  351,  345,  356,  381,  357,  355,
+      360,  381,  321,  354,  361,  381,  381,  365,  364,  381,
+      307,  371,  317,  373,  365,  359,  381,  369,  375,  381,
+        0
     } ;
 
-static const flex_int16_t yy_nxt[2228] =
+static const flex_int16_t yy_nxt[1180] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   12,   12,   25,   26,   12,   27,   12,
-       12,   28,   12,   29,   12,   30,   12,   12,   12,   12,
-       12,   25,   31,   12,   12,   12,   12,   12,   12,   32,
-       12,   12,   12,   12,   33,   12,   12,   12,   12,   12,
-       34,   35,   37,   14,   37,   37,   14,   37,   38,   41,
-       40,   38,   12,   12,   40,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   41,   42,   42,   42,
-       42,   68,   12,   12,   12,   12,   69,   73,   12,   71,
-
-       12,   71,   12,   74,   72,   72,   72,   72,   12,   12,
-       12,   12,   39,   73,   12,   83,   12,   73,   75,   84,
-       42,   12,   42,   74,   75,  206,   74,   12,   12,   44,
-       44,   44,  178,   76,   46,   63,  151,   64,   64,   64,
-       64,   75,   67,   67,   67,   67,   77,   78,   85,   65,
-      231,  112,   47,   48,   65,  110,   49,   72,   72,   72,
-       72,  111,  205,   50,  177,   65,   84,  112,   51,   52,
-       65,   53,  123,   54,  112,  110,   55,   56,   57,   58,
-       59,  111,   60,   63,   61,   66,   66,   66,   66,   63,
-      115,   66,   66,   66,   66,   85,  150,   65,  110,   44,
-
-       44,   44,  144,   65,   46,   44,   44,   44,  123,  117,
-       46,  116,  111,   65,   90,   44,   44,   44,  113,   65,
-       46,   45,   44,   44,   44,  144,  145,   46,   72,   72,
-       72,   72,  114,   50,  146,   44,   44,   44,   43,   50,
-       46,   82,  144,   45,  146,   80,  145,   45,  145,   50,
-      146,   45,   44,   44,   44,   86,   50,   46,   45,   87,
-      149,   45,   79,   45,   91,  147,   93,  175,  148,   50,
-       70,   43,   88,   44,   44,   44,  325,  325,   46,   44,
-       44,   44,  325,  175,   46,   92,   50,   44,   44,   44,
-      325,  325,   46,   94,  325,  325,   95,   44,   44,   44,
-
-      175,  325,   46,  325,   44,   44,   44,   50,  325,   46,
-       44,   44,   44,   50,  325,   46,  176,   44,   44,   44,
-       96,   50,   46,   44,   44,   44,  325,  325,   46,   97,
-      325,   50,   99,   98,  101,  325,  325,  100,   50,  325,
-      325,  102,  325,  325,   50,   44,   44,   44,  325,  325,
-       46,   50,  325,  325,  104,  325,  325,   50,   67,   67,
-       67,   67,  325,  325,  105,  103,  325,  325,  325,   71,
-       65,   71,  325,  106,   72,   72,   72,   72,   63,   50,
-       64,   64,   64,   64,  325,   63,   65,   66,   66,   66,
-       66,  325,   65,  325,  107,  325,  325,   83,  108,   65,
-
-       67,   67,   67,   67,   83,   44,   44,   44,   65,  325,
-       46,  325,   65,  325,  325,   65,   44,   44,   44,  325,
-      325,   46,   44,   44,   44,  325,   83,   46,   65,  325,
-       83,  325,  325,  325,   83,   44,   44,   44,  325,   50,
-       46,   83,  325,  325,   83,  325,   83,  118,  325,  325,
-       50,  325,  325,  325,  119,  120,   50,   44,   44,   44,
-      325,  325,   46,  325,  325,  121,  325,  325,  325,   50,
-      124,  124,  124,  124,  325,  325,  325,  325,  124,  124,
-      124,  124,  124,  124,   44,   44,   44,  325,  325,  127,
-      325,   50,  325,  325,  124,  124,  124,  124,  124,  124,
-
-      325,  325,   44,   44,   44,  125,  126,   46,   44,   44,
-       44,  325,  325,   46,   44,   44,   44,  325,   50,   46,
-       44,   44,   44,  325,  325,   46,   44,   44,   44,  325,
-      325,   46,  325,   44,   44,   44,   50,  325,   46,  325,
-      128,  325,   50,  325,   44,   44,   44,  129,   50,   46,
-       44,   44,   44,  325,   50,   46,   44,   44,   44,  325,
-       50,   46,  325,   44,   44,   44,  325,   50,   46,  130,
-      131,  133,   44,   44,   44,  325,  325,   46,   50,  325,
-      132,   44,   44,   44,   50,  325,   46,  134,  325,  325,
-       50,   44,   44,   44,  325,  325,   46,   50,   44,   44,
-
-       44,  325,  325,   46,  136,  325,   50,  135,   44,   44,
-       44,  325,  325,   46,  325,   50,  325,  137,   44,   44,
-       44,  325,  325,   46,  138,   50,  139,  325,  325,  325,
-      141,  325,   50,   44,   44,   44,  325,  140,   46,   44,
-       44,   44,   50,  142,   46,   44,   44,   44,  325,  143,
-       46,  325,   50,  325,  325,   44,   44,   44,  325,  325,
-       46,  325,  325,  325,  325,  325,  325,   50,  325,  325,
-      325,  325,  152,   50,  325,  325,  325,  325,  325,   50,
-      325,  325,  154,  325,  153,  155,  155,  155,  155,   50,
-      325,  325,  325,  155,  155,  155,  155,  155,  155,  157,
-
-       44,   44,   44,  156,  325,   46,  325,  325,  325,  155,
-      155,  155,  155,  155,  155,   44,   44,   44,  325,  325,
-       46,  325,   44,   44,   44,  325,  325,   46,   44,   44,
-       44,  325,  325,   46,   50,   44,   44,   44,  325,  325,
-       46,  325,   44,   44,   44,  325,  325,   46,  325,   50,
-      325,  325,  325,  325,  325,  158,   50,  325,   44,   44,
-       44,  325,   50,   46,  325,  325,  159,  325,  325,   50,
-      325,  325,  325,  325,  161,  160,   50,   44,   44,   44,
-      325,  325,   46,   44,   44,   44,  162,  325,   46,  325,
-      325,  325,   50,  325,  163,   44,   44,   44,  325,  325,
-
-       46,  164,   44,   44,   44,  325,  325,   46,   44,   44,
-       44,   50,  325,   46,   44,   44,   44,   50,  325,   46,
-       44,   44,   44,  325,  167,   46,   44,   44,   44,   50,
-      165,   46,  325,  166,  325,  325,   50,  325,  325,  169,
-      325,  325,   50,  325,  325,  325,  168,  325,   50,  325,
-      325,   44,   44,   44,   50,  171,   46,  325,  325,  325,
-       50,  325,  170,   44,   44,   44,  172,  325,   46,  325,
-      325,   44,   44,   44,  325,  325,   46,   44,   44,   44,
-      325,  325,   46,  173,  325,   50,  180,  181,  325,  325,
-      325,  325,  325,  325,  325,  182,  325,   50,  325,  325,
-
-      325,  325,  325,  174,  325,   50,  325,  325,  325,  325,
-      325,   50,   44,   44,   44,  179,  325,   46,  325,  325,
-      325,  325,  183,  184,  184,  184,  184,  325,  325,  325,
-      325,  184,  184,  184,  184,  184,  184,   44,   44,   44,
-      325,  325,   46,  325,  325,  325,   50,  184,  184,  184,
-      184,  184,  184,  185,   44,   44,   44,  325,  325,   46,
-       44,   44,   44,  325,  325,   46,  325,   44,   44,   44,
-      325,   50,   46,  325,  325,  188,  189,  325,   44,   44,
-       44,  325,  325,   46,  325,   44,   44,   44,   50,  186,
-       46,   44,   44,   44,   50,  192,   46,  187,   44,   44,
-
-       44,   50,  325,   46,   44,   44,   44,  325,  325,   46,
-      325,  190,   50,   44,   44,   44,  325,  325,   46,   50,
-      325,   44,   44,   44,  325,   50,  197,  325,  193,  325,
-      325,  191,   50,  325,  325,   44,   44,   44,   50,  194,
-       46,   44,   44,   44,  325,  325,   46,   50,  325,  195,
-      325,   44,   44,   44,  196,   50,   46,   44,   44,   44,
-      325,  325,   46,   44,   44,   44,  325,  325,   46,   50,
-      325,   44,   44,   44,  325,   50,  203,   44,   44,   44,
-      325,  325,   46,  325,  325,   50,  325,  204,  325,  199,
-      198,   50,  200,   44,   44,   44,  325,   50,   46,  325,
-
-      325,   44,   44,   44,  202,   50,  208,  325,  325,  201,
-      325,   50,   44,   44,   44,  325,  325,  209,   44,   44,
-       44,  325,  325,   46,  325,  325,  325,   50,   44,   44,
-       44,  325,  325,   46,  325,   50,   44,   44,   44,  325,
-      325,   46,  325,  207,  325,  325,   50,  325,   44,   44,
-       44,  325,   50,   46,  325,  325,  325,  325,  210,  325,
-      325,  325,   50,   44,   44,   44,  325,  325,   46,  325,
-       50,  325,  325,  325,  325,  325,  325,  211,   45,   45,
-       45,   45,   50,  325,  325,  212,   45,   45,   45,   45,
-       45,   45,  325,  325,   44,   44,   44,   50,  213,  215,
-
-      325,  325,   45,   45,   45,   45,   45,   45,  325,  325,
-      214,   44,   44,   44,  325,  325,  216,   44,   44,   44,
-      325,  325,  217,  325,   44,   44,   44,  325,   50,   46,
-       44,   44,   44,  325,  218,   46,   44,   44,   44,  325,
-      325,   46,   44,   44,   44,   50,  325,   46,   44,   44,
-       44,   50,  325,   46,  325,   44,   44,   44,   50,  325,
-       46,   44,   44,   44,   50,  325,   46,   44,   44,   44,
-       50,  325,   46,  325,  219,  325,   50,  325,   44,   44,
-       44,  220,   50,   46,  325,   44,   44,   44,  221,   50,
-       46,   44,   44,   44,  222,   50,   46,  325,   44,   44,
-
-       44,   50,  325,   46,  325,  325,  325,  223,  226,  225,
-      325,  325,   50,  224,  325,   44,   44,   44,  325,   50,
-       46,   44,   44,   44,  325,   50,   46,  325,  325,  325,
-      227,  325,   50,   44,   44,   44,  228,  230,   46,  229,
-       44,   44,   44,  325,  325,   46,   44,   44,   44,   50,
-      325,   46,  325,  325,  325,   50,   44,   44,   44,  325,
-      325,   46,  232,  325,   44,   44,   44,   50,  325,   46,
-      233,  325,  325,  325,   50,  325,  234,  325,  325,  325,
-       50,   44,   44,   44,  325,  325,   46,   44,   44,   44,
-       50,  325,   46,  236,  235,  325,  325,  237,   50,   44,
-
-       44,   44,  325,  325,   46,   44,   44,   44,  325,  325,
-       46,  238,   44,   44,   44,   50,  325,   46,   44,   44,
-       44,   50,  325,  244,  325,   44,   44,   44,  325,  325,
-      245,  239,  325,   50,  325,  325,  325,  240,  325,   50,
-       44,   44,   44,  325,  325,   46,   50,  325,  325,   44,
-       44,   44,   50,  243,   46,  325,  325,  241,  242,   50,
-      325,  246,   44,   44,   44,  325,  325,   46,   44,   44,
-       44,  325,  325,   46,   50,   44,   44,   44,  250,  325,
-       46,  325,  325,   50,  325,   44,   44,   44,  325,  325,
-       46,  325,  325,  325,  247,  252,   50,  325,  248,   44,
-
-       44,   44,   50,  325,   46,   44,   44,   44,  325,   50,
-      254,  325,   44,   44,   44,  325,  249,  255,  325,   50,
-      325,   44,   44,   44,  325,  251,   46,   44,   44,   44,
-      325,  256,   46,   50,  325,   44,   44,   44,  325,   50,
-       46,  325,   44,   44,   44,  325,   50,   46,   44,   44,
-       44,  325,  253,   46,  325,   50,  325,   44,   44,   44,
-      325,   50,  261,   44,   44,   44,  325,  325,  262,   50,
-       44,   44,   44,  325,  325,  263,   50,  325,  325,  325,
-      258,  325,   50,  257,   44,   44,   44,  325,  325,   46,
-      325,   50,  325,  325,  325,  259,  325,   50,  325,  325,
-
-      260,   44,   44,   44,   50,  325,   46,   44,   44,   44,
-      325,  325,  266,  325,   44,   44,   44,  325,   50,   46,
-       44,   44,   44,  325,  325,   46,   44,   44,   44,  325,
-      325,   46,  325,  325,  264,   50,  325,  325,  325,  325,
-      325,   50,  265,  325,   44,   44,   44,  325,   50,   46,
-       44,   44,   44,  325,   50,  272,   44,   44,   44,  325,
-       50,   46,   44,   44,   44,  325,  325,   46,  325,  268,
-      325,  325,  267,  325,  269,  270,  325,  325,   50,  325,
-      325,  271,  325,  325,   50,  325,   44,   44,   44,  325,
-       50,   46,   44,   44,   44,  325,   50,   46,  325,   44,
-
-       44,   44,  325,  274,   46,   44,   44,   44,  325,  273,
-       46,   44,   44,   44,  325,  325,   46,   44,   44,   44,
-       50,  325,  280,  325,  275,  325,   50,   44,   44,   44,
-      325,  325,   46,   50,  325,   44,   44,   44,  325,   50,
-       46,  325,   44,   44,   44,   50,  276,   46,  325,  325,
-      325,   50,  325,  277,  325,  325,  278,   44,   44,   44,
-      325,   50,   46,  279,  281,   44,   44,   44,  325,   50,
-       46,  325,   44,   44,   44,  325,   50,   46,   44,   44,
-       44,  325,  325,   46,   44,   44,   44,  325,  325,  288,
-      325,   50,  325,  282,  325,  325,  283,  325,  325,   50,
-
-      284,  325,   44,   44,   44,  325,   50,  289,   44,   44,
-       44,  325,   50,   46,  325,  285,  325,  325,   50,  286,
-       44,   44,   44,  325,  325,   46,   44,   44,   44,  325,
-      287,   46,   44,   44,   44,  325,   50,   46,   44,   44,
-       44,  325,   50,   46,   44,   44,   44,  325,  325,   46,
-       44,   44,   44,  325,   50,   46,   44,   44,   44,  325,
-       50,  297,  290,   44,   44,   44,   50,  325,   46,  325,
-      325,  325,   50,  291,  292,   44,   44,   44,   50,  294,
-       46,  325,  325,  293,   50,  295,  325,  325,  325,  296,
-       50,   44,   44,   44,  325,  325,  300,   50,  325,  325,
-
-      298,   44,   44,   44,  325,  325,   46,  325,  325,   50,
-       44,   44,   44,  325,  325,   46,   44,   44,   44,  325,
-      299,   46,   44,   44,   44,   50,  325,   46,   44,   44,
-       44,  325,  325,   46,  325,   50,   44,   44,   44,  325,
-      325,   46,  301,  325,   50,  325,  325,   44,   44,   44,
-       50,  302,   46,   44,   44,   44,   50,  325,  308,   44,
-       44,   44,   50,  325,  309,  325,  325,   44,   44,   44,
-       50,  304,   46,  303,  305,   44,   44,   44,  325,  325,
-       46,   50,  325,  325,   44,   44,   44,   50,  306,   46,
-       44,   44,   44,   50,  325,   46,  325,  307,   44,   44,
-
-       44,   50,  325,   46,  325,   44,   44,   44,  325,   50,
-      315,   44,   44,   44,  325,  325,  316,  325,   50,  325,
-      325,  310,  325,  325,   50,  312,   44,   44,   44,  311,
-      325,   46,   50,  325,  325,  313,   44,   44,   44,   50,
-      325,   46,  325,  325,  325,   50,  325,  314,   44,   44,
-       44,  325,  325,   46,   44,   44,   44,  325,  325,   46,
-       50,   44,   44,   44,  325,  325,   46,  325,  325,  325,
-       50,   44,   44,   44,  325,  325,  322,  318,  325,  325,
-      317,  325,   50,  325,   44,   44,   44,  325,   50,  323,
-      325,   44,   44,   44,  325,   50,  324,  325,  325,  325,
-
-      325,  319,  325,  325,  325,   50,  325,  320,  325,  325,
-      325,  325,  325,  325,  321,  325,  325,  325,   50,  325,
-      325,  325,  325,  325,  325,   50,   36,   36,   36,   36,
-       36,   45,   45,   45,   45,   45,   62,  325,   62,   62,
-       62,   81,  325,   81,  325,   81,   83,   83,   83,   83,
-       83,   89,   89,   89,   89,   89,  109,  325,  109,  109,
-      109,  122,  122,  122,   11,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325
+       11,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,   12,   13,   14,   13,   12,
+       15,   16,   12,   17,   18,   19,   20,   21,   22,   22,
+       22,   22,   23,   24,   12,   12,   12,   12,   12,   12,
+       25,   26,   12,   27,   12,   12,   28,   12,   29,   12,
+
+       30,   12,   12,   12,   12,   12,   25,   31,   12,   12,
+       12,   12,   12,   12,   32,   12,   12,   12,   12,   12,
+       33,   12,   12,   12,   12,   12,   12,   34,   35,   36,
+       37,   14,   37,   36,   36,   36,   38,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   12,   12,   40,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,  381,   42,
+       43,   42,   69,   12,   12,   71,   12,   70,   74,   12,
+       75,   12,   41,   12,   68,   68,   68,   68,   77,   12,
+       12,   78,   79,   39,   74,   12,  381,   12,   65,   65,
+       65,   65,   80,   12,   75,   81,   83,   86,   87,   88,
+       12,   12,   44,   44,   44,   45,   45,   46,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   47,   48,   45,   45,   49,
+       45,   45,   45,   45,   45,   45,   50,   45,   45,   51,
+       45,   52,   53,   45,   54,   45,   55,   45,   45,   56,
+
+       57,   58,   59,   60,   45,   61,   62,   45,   63,   45,
+       45,   45,   45,   45,   45,   45,   64,   64,   92,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       65,   76,   66,   66,   66,   66,   93,   97,   98,  102,
+       72,  103,   72,   99,   67,   73,   73,   73,   73,  100,
+
+      104,  105,  106,  114,  101,   76,  115,  116,   82,   82,
+       67,   82,   82,  117,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   44,   44,   44,   44,   44,   84,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   85,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   45,   45,   94,  107,
+       45,  109,  381,  118,  381,  120,  110,  121,  108,  122,
+       45,  125,   45,   45,  128,   45,  129,   45,  126,  127,
+       45,   45,   45,   45,   45,   95,   45,   45,   96,   45,
+       89,   89,   89,   89,   89,   90,   89,   89,   89,   89,
+       89,   89,   45,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   45,   89,   89,   89,   45,   89,
+       89,   89,   45,   89,   89,   89,   89,   89,   89,   45,
+       89,   89,   89,   45,   89,   45,   91,   89,   89,   89,
+       89,   89,   89,   89,   70,   70,  130,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,  111,  112,
+
+      113,   44,  131,  132,  133,  381,  381,  381,   44,  134,
+      123,  135,  136,  137,  138,  141,  142,   89,  111,  112,
+      139,  143,  140,  144,  113,  145,  146,  149,  147,  150,
+       44,  151,  152,  154,   44,  155,  156,  148,   44,   89,
+      158,  159,  160,   89,  161,   44,  162,   89,  147,   44,
+      146,   44,  119,  148,   89,  163,  164,  165,   89,  166,
+       89,   89,   89,   89,   89,  167,  168,   89,  170,  169,
+      171,  172,  173,  174,  175,  124,  124,  124,  124,  176,
+      177,  178,  179,  124,  124,  124,  124,  124,  124,  180,
+      181,  183,  187,  189,  190,  191,  192,  195,  179,  124,
+
+      124,  124,  124,  124,  124,  153,  153,  153,  153,  196,
+      184,  185,  197,  153,  153,  153,  153,  153,  153,  186,
+      193,  194,  198,  199,  200,  201,  202,  203,  204,  153,
+      153,  153,  153,  153,  153,  157,  157,  157,  157,  205,
+      206,  207,  208,  157,  157,  157,  157,  157,  157,  209,
+      210,  211,  213,  214,  215,  217,  220,  221,  223,  157,
+      157,  157,  157,  157,  157,  182,  182,  182,  182,  222,
+      224,  225,   45,  182,  182,  182,  182,  182,  182,   46,
+      218,  226,  229,  230,  232,  219,  233,  234,  235,  182,
+      182,  182,  182,  182,  182,  188,  188,  188,  188,  236,
+
+      237,  238,  227,  188,  188,  188,  188,  188,  188,  228,
+       45,  239,  240,  241,  216,  242,  243,  246,  231,  188,
+      188,  188,  188,  188,  188,  212,  212,  212,  212,  244,
+      247,  245,  248,  212,  212,  212,  212,  212,  212,  249,
+      250,  251,  253,  254,  255,  256,  258,  259,  260,  212,
+      212,  212,  212,  212,  212,   45,   45,   45,   45,   45,
+      261,  262,  263,   45,   45,   45,   45,   45,   45,  252,
+      264,  265,  266,   46,  268,  269,  257,  270,  271,   45,
+       45,   45,   45,   45,   45,   44,   44,   44,   44,  272,
+      273,  274,  275,   44,   44,   44,   44,   44,   44,  276,
+
+      277,  278,  279,  280,   46,  282,  285,  286,  287,   44,
+       44,   44,   44,   44,   44,  283,  288,  289,  290,   45,
+      291,  284,  293,  292,  294,  267,   45,  295,  296,  297,
+      298,   45,  299,  300,  301,  302,  303,  304,  305,  306,
+      307,  308,  309,  310,  311,  312,  313,  281,  314,  315,
+      316,   45,  317,  318,  319,  320,   45,  321,  322,  323,
+      324,  327,  328,   45,  330,  325,  331,  332,   45,  334,
+      335,  336,  337,  338,  339,  340,  341,   45,  342,  343,
+      344,  329,  345,  346,  347,  348,  349,  350,   46,  352,
+      353,  354,  355,  356,  357,  358,  326,   46,  360,  361,
+
+      362,  363,  364,  365,  333,  366,  367,  368,  369,  370,
+       46,  372,  373,  374,  375,  376,  377,  378,  379,   45,
+      380,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  351,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  359,  381,  381,  381,  381,  381,  381,
+      381,  381,  371,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381
     } ;
 
-static const flex_int16_t yy_chk[2228] =
+static const flex_int16_t yy_chk[1180] =
     {   0,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    4,    4,    4,    3,    9,
-        7,    4,    5,    5,    8,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,   10,   13,   37,   13,
-       37,   21,    5,    5,    9,    5,   21,   26,    5,   25,
-
-        5,   25,    5,   27,   25,   25,   25,   25,    5,    5,
-        7,   10,    5,   26,    8,  337,    5,   31,   28,   44,
-       42,    5,   42,   32,   33,  336,   27,    5,    5,   15,
-       15,   15,  335,   31,   15,   17,  334,   17,   17,   17,
-       17,   28,   20,   20,   20,   20,   32,   33,   44,   17,
-      205,   75,   15,   15,   20,   73,   15,   71,   71,   71,
-       71,   74,  177,   15,  150,   17,   83,   78,   15,   15,
-       20,   15,  122,   15,   75,   73,   15,   15,   15,   15,
-       15,   74,   15,   19,   15,   19,   19,   19,   19,   22,
-       78,   22,   22,   22,   22,   83,  116,   19,   76,   45,
-
-       45,   45,  110,   22,   45,   47,   47,   47,   89,   81,
-       47,   80,   77,   19,   50,   48,   48,   48,   76,   22,
-       48,   50,   49,   49,   49,  110,  111,   49,   72,   72,
-       72,   72,   77,   45,  112,   51,   51,   51,   43,   47,
-       51,   41,  113,   50,  115,   39,  111,   50,  114,   48,
-      112,   50,   52,   52,   52,   47,   49,   52,   50,   48,
-      115,   50,   38,   50,   50,  113,   52,  144,  114,   51,
-       24,   14,   49,   53,   53,   53,   11,    0,   53,   54,
-       54,   54,    0,  144,   54,   51,   52,   55,   55,   55,
-        0,    0,   55,   52,    0,    0,   52,   56,   56,   56,
-
-      147,    0,   56,    0,   57,   57,   57,   53,    0,   57,
-       58,   58,   58,   54,    0,   58,  147,   59,   59,   59,
-       53,   55,   59,   60,   60,   60,    0,    0,   60,   54,
-        0,   56,   55,   54,   56,    0,    0,   55,   57,    0,
-        0,   57,    0,    0,   58,   61,   61,   61,    0,    0,
-       61,   59,    0,    0,   59,    0,    0,   60,   63,   63,
-       63,   63,    0,    0,   60,   58,    0,    0,    0,   65,
-       63,   65,    0,   60,   65,   65,   65,   65,   64,   61,
-       64,   64,   64,   64,    0,   66,   63,   66,   66,   66,
-       66,    0,   64,    0,   61,    0,    0,   85,   61,   66,
-
-       67,   67,   67,   67,   85,   86,   86,   86,   64,    0,
-       86,    0,   67,    0,    0,   66,   87,   87,   87,    0,
-        0,   87,   88,   88,   88,    0,   85,   88,   67,    0,
-       85,    0,    0,    0,   85,   90,   90,   90,    0,   86,
-       90,   85,    0,    0,   85,    0,   85,   85,    0,    0,
-       87,    0,    0,    0,   86,   87,   88,   92,   92,   92,
-        0,    0,   92,    0,    0,   88,    0,    0,    0,   90,
-       91,   91,   91,   91,    0,    0,    0,    0,   91,   91,
-       91,   91,   91,   91,   93,   93,   93,    0,    0,   93,
-        0,   92,    0,    0,   91,   91,   91,   91,   91,   91,
-
-        0,    0,   94,   94,   94,   92,   92,   94,   95,   95,
-       95,    0,    0,   95,   96,   96,   96,    0,   93,   96,
-       97,   97,   97,    0,    0,   97,   98,   98,   98,    0,
-        0,   98,    0,   99,   99,   99,   94,    0,   99,    0,
-       94,    0,   95,    0,  100,  100,  100,   95,   96,  100,
-      101,  101,  101,    0,   97,  101,  102,  102,  102,    0,
-       98,  102,    0,  103,  103,  103,    0,   99,  103,   96,
-       97,   99,  104,  104,  104,    0,    0,  104,  100,    0,
-       98,  105,  105,  105,  101,    0,  105,  100,    0,    0,
-      102,  106,  106,  106,    0,    0,  106,  103,  107,  107,
-
-      107,    0,    0,  107,  102,    0,  104,  101,  108,  108,
-      108,    0,    0,  108,    0,  105,    0,  103,  119,  119,
-      119,    0,    0,  119,  104,  106,  104,    0,    0,    0,
-      106,    0,  107,  120,  120,  120,    0,  105,  120,  121,
-      121,  121,  108,  107,  121,  126,  126,  126,    0,  108,
-      126,    0,  119,    0,    0,  125,  125,  125,    0,    0,
-      125,    0,    0,    0,    0,    0,    0,  120,    0,    0,
-        0,    0,  119,  121,    0,    0,    0,    0,    0,  126,
-        0,    0,  121,    0,  120,  124,  124,  124,  124,  125,
-        0,    0,    0,  124,  124,  124,  124,  124,  124,  126,
-
-      128,  128,  128,  125,    0,  128,    0,    0,    0,  124,
-      124,  124,  124,  124,  124,  129,  129,  129,    0,    0,
-      129,    0,  130,  130,  130,    0,    0,  130,  131,  131,
-      131,    0,    0,  131,  128,  132,  132,  132,    0,    0,
-      132,    0,  133,  133,  133,    0,    0,  133,    0,  129,
-        0,    0,    0,    0,    0,  128,  130,    0,  134,  134,
-      134,    0,  131,  134,    0,    0,  129,    0,    0,  132,
-        0,    0,    0,    0,  131,  130,  133,  135,  135,  135,
-        0,    0,  135,  136,  136,  136,  132,    0,  136,    0,
-        0,    0,  134,    0,  133,  137,  137,  137,    0,    0,
-
-      137,  134,  138,  138,  138,    0,    0,  138,  139,  139,
-      139,  135,    0,  139,  140,  140,  140,  136,    0,  140,
-      141,  141,  141,    0,  136,  141,  142,  142,  142,  137,
-      135,  142,    0,  135,    0,    0,  138,    0,    0,  138,
-        0,    0,  139,    0,    0,    0,  137,    0,  140,    0,
-        0,  143,  143,  143,  141,  140,  143,    0,    0,    0,
-      142,    0,  139,  152,  152,  152,  141,    0,  152,    0,
-        0,  153,  153,  153,    0,    0,  153,  154,  154,  154,
-        0,    0,  154,  142,    0,  143,  153,  153,    0,    0,
-        0,    0,    0,    0,    0,  153,    0,  152,    0,    0,
-
-        0,    0,    0,  143,    0,  153,    0,    0,    0,    0,
-        0,  154,  156,  156,  156,  152,    0,  156,    0,    0,
-        0,    0,  154,  155,  155,  155,  155,    0,    0,    0,
-        0,  155,  155,  155,  155,  155,  155,  157,  157,  157,
-        0,    0,  157,    0,    0,    0,  156,  155,  155,  155,
-      155,  155,  155,  156,  158,  158,  158,    0,    0,  158,
-      159,  159,  159,    0,    0,  159,    0,  160,  160,  160,
-        0,  157,  160,    0,    0,  159,  159,    0,  161,  161,
-      161,    0,    0,  161,    0,  162,  162,  162,  158,  157,
-      162,  163,  163,  163,  159,  162,  163,  158,  164,  164,
-
-      164,  160,    0,  164,  165,  165,  165,    0,    0,  165,
-        0,  160,  161,  166,  166,  166,    0,    0,  166,  162,
-        0,  167,  167,  167,    0,  163,  167,    0,  163,    0,
-        0,  161,  164,    0,    0,  168,  168,  168,  165,  164,
-      168,  169,  169,  169,    0,    0,  169,  166,    0,  165,
-        0,  170,  170,  170,  166,  167,  170,  171,  171,  171,
-        0,    0,  171,  172,  172,  172,    0,    0,  172,  168,
-        0,  173,  173,  173,    0,  169,  173,  174,  174,  174,
-        0,    0,  174,    0,    0,  170,    0,  174,    0,  169,
-      168,  171,  170,  179,  179,  179,    0,  172,  179,    0,
-
-        0,  180,  180,  180,  172,  173,  180,    0,    0,  171,
-        0,  174,  181,  181,  181,    0,    0,  181,  182,  182,
-      182,    0,    0,  182,    0,    0,    0,  179,  183,  183,
-      183,    0,    0,  183,    0,  180,  185,  185,  185,    0,
-        0,  185,    0,  179,    0,    0,  181,    0,  186,  186,
-      186,    0,  182,  186,    0,    0,    0,    0,  182,    0,
-        0,    0,  183,  187,  187,  187,    0,    0,  187,    0,
-      185,    0,    0,    0,    0,    0,    0,  183,  184,  184,
-      184,  184,  186,    0,    0,  185,  184,  184,  184,  184,
-      184,  184,    0,    0,  188,  188,  188,  187,  186,  188,
-
-        0,    0,  184,  184,  184,  184,  184,  184,    0,    0,
-      187,  189,  189,  189,    0,    0,  189,  190,  190,  190,
-        0,    0,  190,    0,  191,  191,  191,    0,  188,  191,
-      192,  192,  192,    0,  191,  192,  193,  193,  193,    0,
-        0,  193,  194,  194,  194,  189,    0,  194,  195,  195,
-      195,  190,    0,  195,    0,  198,  198,  198,  191,    0,
-      198,  196,  196,  196,  192,    0,  196,  199,  199,  199,
-      193,    0,  199,    0,  192,    0,  194,    0,  200,  200,
-      200,  192,  195,  200,    0,  202,  202,  202,  193,  198,
-      202,  201,  201,  201,  194,  196,  201,    0,  204,  204,
-
-      204,  199,    0,  204,    0,    0,    0,  195,  199,  198,
-        0,    0,  200,  196,    0,  207,  207,  207,    0,  202,
-      207,  210,  210,  210,    0,  201,  210,    0,    0,    0,
-      200,    0,  204,  211,  211,  211,  201,  204,  211,  202,
-      212,  212,  212,    0,    0,  212,  213,  213,  213,  207,
-        0,  213,    0,    0,    0,  210,  214,  214,  214,    0,
-        0,  214,  207,    0,  218,  218,  218,  211,    0,  218,
-      210,    0,    0,    0,  212,    0,  211,    0,    0,    0,
-      213,  219,  219,  219,    0,    0,  219,  220,  220,  220,
-      214,    0,  220,  213,  212,    0,    0,  214,  218,  221,
-
-      221,  221,    0,    0,  221,  222,  222,  222,    0,    0,
-      222,  218,  223,  223,  223,  219,    0,  223,  224,  224,
-      224,  220,    0,  224,    0,  225,  225,  225,    0,    0,
-      225,  219,    0,  221,    0,    0,    0,  220,    0,  222,
-      226,  226,  226,    0,    0,  226,  223,    0,    0,  227,
-      227,  227,  224,  223,  227,    0,    0,  221,  222,  225,
-        0,  225,  228,  228,  228,    0,    0,  228,  229,  229,
-      229,    0,    0,  229,  226,  230,  230,  230,  229,    0,
-      230,    0,    0,  227,    0,  232,  232,  232,    0,    0,
-      232,    0,    0,    0,  226,  232,  228,    0,  227,  233,
-
-      233,  233,  229,    0,  233,  234,  234,  234,    0,  230,
-      234,    0,  235,  235,  235,    0,  228,  235,    0,  232,
-        0,  236,  236,  236,    0,  230,  236,  237,  237,  237,
-        0,  236,  237,  233,    0,  238,  238,  238,    0,  234,
-      238,    0,  239,  239,  239,    0,  235,  239,  240,  240,
-      240,    0,  233,  240,    0,  236,    0,  241,  241,  241,
-        0,  237,  241,  242,  242,  242,    0,    0,  242,  238,
-      243,  243,  243,    0,    0,  243,  239,    0,    0,    0,
-      238,    0,  240,  237,  246,  246,  246,    0,    0,  246,
-        0,  241,    0,    0,    0,  239,    0,  242,    0,    0,
-
-      240,  247,  247,  247,  243,    0,  247,  248,  248,  248,
-        0,    0,  248,    0,  249,  249,  249,    0,  246,  249,
-      250,  250,  250,    0,    0,  250,  251,  251,  251,    0,
-        0,  251,    0,    0,  246,  247,    0,    0,    0,    0,
-        0,  248,  247,    0,  252,  252,  252,    0,  249,  252,
-      253,  253,  253,    0,  250,  253,  256,  256,  256,    0,
-      251,  256,  257,  257,  257,    0,    0,  257,    0,  250,
-        0,    0,  249,    0,  250,  251,    0,    0,  252,    0,
-        0,  252,    0,    0,  253,    0,  258,  258,  258,    0,
-      256,  258,  259,  259,  259,    0,  257,  259,    0,  260,
-
-      260,  260,    0,  257,  260,  264,  264,  264,    0,  256,
-      264,  265,  265,  265,    0,    0,  265,  267,  267,  267,
-      258,    0,  267,    0,  258,    0,  259,  268,  268,  268,
-        0,    0,  268,  260,    0,  269,  269,  269,    0,  264,
-      269,    0,  270,  270,  270,  265,  259,  270,    0,    0,
-        0,  267,    0,  260,    0,    0,  264,  271,  271,  271,
-        0,  268,  271,  265,  268,  273,  273,  273,    0,  269,
-      273,    0,  274,  274,  274,    0,  270,  274,  275,  275,
-      275,    0,    0,  275,  276,  276,  276,    0,    0,  276,
-        0,  271,    0,  269,    0,    0,  270,    0,    0,  273,
-
-      271,    0,  277,  277,  277,    0,  274,  277,  278,  278,
-      278,    0,  275,  278,    0,  273,    0,    0,  276,  274,
-      279,  279,  279,    0,    0,  279,  281,  281,  281,    0,
-      275,  281,  282,  282,  282,    0,  277,  282,  283,  283,
-      283,    0,  278,  283,  284,  284,  284,    0,    0,  284,
-      285,  285,  285,    0,  279,  285,  286,  286,  286,    0,
-      281,  286,  278,  287,  287,  287,  282,    0,  287,    0,
-        0,    0,  283,  279,  281,  290,  290,  290,  284,  283,
-      290,    0,    0,  282,  285,  284,    0,    0,    0,  285,
-      286,  291,  291,  291,    0,    0,  291,  287,    0,    0,
-
-      287,  292,  292,  292,    0,    0,  292,    0,    0,  290,
-      293,  293,  293,    0,    0,  293,  294,  294,  294,    0,
-      290,  294,  295,  295,  295,  291,    0,  295,  296,  296,
-      296,    0,    0,  296,    0,  292,  298,  298,  298,    0,
-        0,  298,  292,    0,  293,    0,    0,  299,  299,  299,
-      294,  293,  299,  301,  301,  301,  295,    0,  301,  302,
-      302,  302,  296,    0,  302,    0,    0,  303,  303,  303,
-      298,  295,  303,  294,  296,  304,  304,  304,    0,    0,
-      304,  299,    0,    0,  305,  305,  305,  301,  298,  305,
-      306,  306,  306,  302,    0,  306,    0,  299,  307,  307,
-
-      307,  303,    0,  307,    0,  310,  310,  310,    0,  304,
-      310,  311,  311,  311,    0,    0,  311,    0,  305,    0,
-        0,  303,    0,    0,  306,  305,  312,  312,  312,  304,
-        0,  312,  307,    0,    0,  306,  313,  313,  313,  310,
-        0,  313,    0,    0,    0,  311,    0,  307,  314,  314,
-      314,    0,    0,  314,  317,  317,  317,    0,    0,  317,
-      312,  318,  318,  318,    0,    0,  318,    0,    0,    0,
-      313,  319,  319,  319,    0,    0,  319,  313,    0,    0,
-      312,    0,  314,    0,  320,  320,  320,    0,  317,  320,
-        0,  321,  321,  321,    0,  318,  321,    0,    0,    0,
-
-        0,  314,    0,    0,    0,  319,    0,  317,    0,    0,
-        0,    0,    0,    0,  318,    0,    0,    0,  320,    0,
-        0,    0,    0,    0,    0,  321,  326,  326,  326,  326,
-      326,  327,  327,  327,  327,  327,  328,    0,  328,  328,
-      328,  329,    0,  329,    0,  329,  330,  330,  330,  330,
-      330,  331,  331,  331,  331,  331,  332,    0,  332,  332,
-      332,  333,  333,  333,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    5,    5,    7,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    9,   11,   13,
+       14,   13,   21,    5,    5,   24,    5,   21,   26,    5,
+       27,    5,    9,    5,   19,   19,   19,   19,   31,    5,
+        5,   32,   33,    5,   26,    7,   20,    5,   20,   20,
+       20,   20,   38,    5,   27,   39,   41,   47,   48,   49,
+        5,    5,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   16,   16,   51,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       17,   28,   17,   17,   17,   17,   52,   54,   55,   57,
+       25,   58,   25,   55,   17,   25,   25,   25,   25,   56,
+
+       59,   60,   61,   77,   56,   28,   78,   79,   40,   40,
+       17,   40,   40,   81,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   45,   45,   53,   62,
+       45,   63,   72,   82,   72,   86,   63,   87,   62,   88,
+       45,   92,   45,   45,   94,   45,   95,   45,   93,   93,
+       45,   45,   45,   45,   45,   53,   45,   45,   53,   45,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   70,   70,   96,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   74,   75,
+
+       76,   85,   97,   98,   99,   89,   89,   89,   85,  100,
+       89,  101,  102,  103,  104,  106,  107,   89,   74,   75,
+      105,  108,  105,  109,   76,  110,  111,  114,  112,  115,
+       85,  116,  117,  120,   85,  121,  122,  113,   85,   89,
+      125,  126,  127,   89,  129,   85,  130,   89,  112,   85,
+      111,   85,   85,  113,   89,  131,  132,  133,   89,  134,
+       89,   89,   91,   91,   91,  135,  136,   91,  137,  136,
+      138,  139,  140,  141,  142,   91,   91,   91,   91,  143,
+      144,  145,  146,   91,   91,   91,   91,   91,   91,  149,
+      152,  154,  156,  158,  159,  160,  161,  163,  146,   91,
+
+       91,   91,   91,   91,   91,  119,  119,  119,  119,  164,
+      155,  155,  165,  119,  119,  119,  119,  119,  119,  155,
+      162,  162,  166,  167,  168,  169,  170,  171,  172,  119,
+      119,  119,  119,  119,  119,  124,  124,  124,  124,  173,
+      174,  175,  176,  124,  124,  124,  124,  124,  124,  177,
+      178,  181,  183,  184,  185,  187,  190,  191,  193,  124,
+      124,  124,  124,  124,  124,  153,  153,  153,  153,  192,
+      194,  195,  192,  153,  153,  153,  153,  153,  153,  186,
+      189,  196,  198,  199,  201,  189,  203,  204,  205,  153,
+      153,  153,  153,  153,  153,  157,  157,  157,  157,  206,
+
+      207,  208,  197,  157,  157,  157,  157,  157,  157,  197,
+      200,  210,  211,  213,  186,  216,  217,  220,  200,  157,
+      157,  157,  157,  157,  157,  182,  182,  182,  182,  219,
+      221,  219,  222,  182,  182,  182,  182,  182,  182,  226,
+      227,  228,  230,  231,  232,  233,  234,  235,  236,  182,
+      182,  182,  182,  182,  182,  188,  188,  188,  188,  229,
+      237,  238,  239,  188,  188,  188,  188,  188,  188,  229,
+      241,  242,  243,  244,  245,  246,  233,  247,  248,  188,
+      188,  188,  188,  188,  188,  212,  212,  212,  212,  249,
+      250,  251,  252,  212,  212,  212,  212,  212,  212,  253,
+
+      254,  257,  258,  259,  260,  261,  263,  264,  265,  212,
+      212,  212,  212,  212,  212,  262,  267,  268,  270,  264,
+      271,  262,  273,  272,  274,  244,  272,  278,  279,  281,
+      282,  278,  283,  284,  285,  286,  288,  289,  290,  291,
+      292,  293,  294,  295,  296,  297,  299,  260,  300,  301,
+      302,  303,  303,  304,  305,  306,  305,  307,  310,  311,
+      312,  313,  314,  315,  316,  312,  317,  318,  319,  321,
+      322,  325,  326,  327,  328,  329,  330,  326,  331,  332,
+      333,  315,  334,  335,  336,  337,  340,  341,  342,  343,
+      344,  345,  346,  347,  348,  351,  312,  352,  353,  354,
+
+      355,  356,  357,  359,  319,  360,  361,  363,  364,  365,
+      368,  369,  371,  372,  373,  374,  375,  376,  378,  374,
+      379,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  342,  381,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  352,  381,  381,  381,  381,  381,  381,
+      381,  381,  368,  381,  381,  381,  381,  381,  381,  381,
+      381,  381,  381,  381,  381,  381,  381,  381,  381
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1369,14 +1153,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[59] =
+static const flex_int16_t yy_rule_linenum[65] =
     {   0,
-      133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
-      170,  177,  186,  195,  204,  215,  226,  235,  244,  253,
-      262,  271,  280,  289,  298,  307,  316,  325,  335,  344,
-      353,  362,  371,  380,  389,  398,  407,  416,  425,  434,
-      443,  542,  547,  552,  557,  558,  559,  560,  561,  562,
-      564,  582,  595,  600,  604,  606,  608,  610
+      132,  134,  136,  141,  142,  147,  148,  149,  161,  164,
+      169,  176,  185,  194,  203,  214,  225,  234,  243,  252,
+      261,  270,  279,  288,  297,  306,  315,  324,  334,  343,
+      352,  361,  370,  379,  388,  397,  406,  415,  424,  433,
+      442,  451,  460,  469,  478,  487,  496,  595,  600,  605,
+      610,  611,  612,  613,  614,  615,  617,  635,  648,  653,
+      657,  659,  661,  663
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1431,7 +1216,7 @@ using isc::agent::AgentParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::agent::ParserContext::fatal(msg)
-#line 1434 "agent_lexer.cc"
+#line 1219 "agent_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1457,8 +1242,8 @@ using isc::agent::AgentParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1460 "agent_lexer.cc"
-#line 1461 "agent_lexer.cc"
+#line 1245 "agent_lexer.cc"
+#line 1246 "agent_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1772,7 +1557,7 @@ YY_DECL
     }
 
 
-#line 1775 "agent_lexer.cc"
+#line 1560 "agent_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1801,13 +1586,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 326 )
+				if ( yy_current_state >= 382 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 325 );
+		while ( yy_current_state != 381 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1826,13 +1611,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 59 )
+			else if ( yy_act < 65 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 59 )
+			else if ( yy_act == 65 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 60 )
+			else if ( yy_act == 66 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2232,6 +2017,42 @@ YY_RULE_SETUP
 case 36:
 YY_RULE_SETUP
 #line 398 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 407 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+#line 416 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC_OVERFLOW(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async-overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+#line 425 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2241,9 +2062,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 40:
 YY_RULE_SETUP
-#line 407 "agent_lexer.ll"
+#line 434 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return AgentParser::make_RATE_LIMITED_MESSAGES(driver.loc_);
+    default:
+        return AgentParser::make_STRING("rate-limited-messages", driver.loc_);
+    }
+}
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+#line 443 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return AgentParser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return AgentParser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+#line 452 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return AgentParser::make_RATE_LIMIT_INTERVAL(driver.loc_);
+    default:
+        return AgentParser::make_STRING("rate-limit-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 461 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2253,9 +2110,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 44:
 YY_RULE_SETUP
-#line 416 "agent_lexer.ll"
+#line 470 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2265,9 +2122,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 45:
 YY_RULE_SETUP
-#line 425 "agent_lexer.ll"
+#line 479 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2277,9 +2134,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 46:
 YY_RULE_SETUP
-#line 434 "agent_lexer.ll"
+#line 488 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2289,9 +2146,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 47:
 YY_RULE_SETUP
-#line 443 "agent_lexer.ll"
+#line 497 "agent_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2391,65 +2248,65 @@ YY_RULE_SETUP
     return AgentParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 42:
-/* rule 42 can match eol */
+case 48:
+/* rule 48 can match eol */
 YY_RULE_SETUP
-#line 542 "agent_lexer.ll"
+#line 596 "agent_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 43:
-/* rule 43 can match eol */
+case 49:
+/* rule 49 can match eol */
 YY_RULE_SETUP
-#line 547 "agent_lexer.ll"
+#line 601 "agent_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 44:
+case 50:
 YY_RULE_SETUP
-#line 552 "agent_lexer.ll"
+#line 606 "agent_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 45:
+case 51:
 YY_RULE_SETUP
-#line 557 "agent_lexer.ll"
+#line 611 "agent_lexer.ll"
 { return AgentParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 46:
+case 52:
 YY_RULE_SETUP
-#line 558 "agent_lexer.ll"
+#line 612 "agent_lexer.ll"
 { return AgentParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 47:
+case 53:
 YY_RULE_SETUP
-#line 559 "agent_lexer.ll"
+#line 613 "agent_lexer.ll"
 { return AgentParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 48:
+case 54:
 YY_RULE_SETUP
-#line 560 "agent_lexer.ll"
+#line 614 "agent_lexer.ll"
 { return AgentParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 49:
+case 55:
 YY_RULE_SETUP
-#line 561 "agent_lexer.ll"
+#line 615 "agent_lexer.ll"
 { return AgentParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 50:
+case 56:
 YY_RULE_SETUP
-#line 562 "agent_lexer.ll"
+#line 616 "agent_lexer.ll"
 { return AgentParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 51:
+case 57:
 YY_RULE_SETUP
-#line 564 "agent_lexer.ll"
+#line 618 "agent_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2468,9 +2325,9 @@ YY_RULE_SETUP
     return AgentParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 52:
+case 58:
 YY_RULE_SETUP
-#line 582 "agent_lexer.ll"
+#line 636 "agent_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2484,43 +2341,43 @@ YY_RULE_SETUP
     return AgentParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 53:
+case 59:
 YY_RULE_SETUP
-#line 595 "agent_lexer.ll"
+#line 649 "agent_lexer.ll"
 {
     string tmp(yytext);
     return AgentParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 54:
+case 60:
 YY_RULE_SETUP
-#line 600 "agent_lexer.ll"
+#line 654 "agent_lexer.ll"
 {
    return AgentParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 55:
+case 61:
 YY_RULE_SETUP
-#line 604 "agent_lexer.ll"
+#line 658 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 56:
+case 62:
 YY_RULE_SETUP
-#line 606 "agent_lexer.ll"
+#line 660 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 57:
+case 63:
 YY_RULE_SETUP
-#line 608 "agent_lexer.ll"
+#line 662 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 58:
+case 64:
 YY_RULE_SETUP
-#line 610 "agent_lexer.ll"
+#line 664 "agent_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 612 "agent_lexer.ll"
+#line 666 "agent_lexer.ll"
 {
     if (driver.states_.empty()) {
         return AgentParser::make_END(driver.loc_);
@@ -2544,12 +2401,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 59:
+case 65:
 YY_RULE_SETUP
-#line 635 "agent_lexer.ll"
+#line 689 "agent_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2552 "agent_lexer.cc"
+#line 2409 "agent_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2868,7 +2725,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 326 )
+			if ( yy_current_state >= 382 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2901,11 +2758,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 326 )
+		if ( yy_current_state >= 382 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 325);
+	yy_is_jam = (yy_current_state == 381);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3654,8 +3511,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 635 "agent_lexer.ll"
-
+#line 689 "agent_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -3757,4 +3613,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
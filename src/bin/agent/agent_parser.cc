@@ -248,25 +248,25 @@ namespace isc { namespace agent {
   {
     switch (that.type_get ())
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,25 +285,25 @@ namespace isc { namespace agent {
   {
     switch (that.type_get ())
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -322,25 +322,25 @@ namespace isc { namespace agent {
     state = that.state;
     switch (that.type_get ())
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -383,44 +383,44 @@ namespace isc { namespace agent {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 42: // "constant string"
-#line 104 "agent_parser.yy"
+      case 48: // "constant string"
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < std::string > (); }
 #line 390 "agent_parser.cc"
         break;
 
-      case 43: // "integer"
-#line 104 "agent_parser.yy"
+      case 49: // "integer"
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < int64_t > (); }
 #line 396 "agent_parser.cc"
         break;
 
-      case 44: // "floating point"
-#line 104 "agent_parser.yy"
+      case 50: // "floating point"
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < double > (); }
 #line 402 "agent_parser.cc"
         break;
 
-      case 45: // "boolean"
-#line 104 "agent_parser.yy"
+      case 51: // "boolean"
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < bool > (); }
 #line 408 "agent_parser.cc"
         break;
 
-      case 54: // value
-#line 104 "agent_parser.yy"
+      case 60: // value
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 414 "agent_parser.cc"
         break;
 
-      case 57: // map_value
-#line 104 "agent_parser.yy"
+      case 63: // map_value
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 420 "agent_parser.cc"
         break;
 
-      case 108: // socket_type_value
-#line 104 "agent_parser.yy"
+      case 114: // socket_type_value
+#line 110 "agent_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 426 "agent_parser.cc"
         break;
@@ -639,25 +639,25 @@ namespace isc { namespace agent {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -682,25 +682,25 @@ namespace isc { namespace agent {
           switch (yyn)
             {
   case 2:
-#line 115 "agent_parser.yy"
+#line 121 "agent_parser.yy"
     { ctx.ctx_ = ctx.NO_KEYWORDS; }
 #line 688 "agent_parser.cc"
     break;
 
   case 4:
-#line 116 "agent_parser.yy"
+#line 122 "agent_parser.yy"
     { ctx.ctx_ = ctx.CONFIG; }
 #line 694 "agent_parser.cc"
     break;
 
   case 6:
-#line 117 "agent_parser.yy"
+#line 123 "agent_parser.yy"
     { ctx.ctx_ = ctx.AGENT; }
 #line 700 "agent_parser.cc"
     break;
 
   case 8:
-#line 125 "agent_parser.yy"
+#line 131 "agent_parser.yy"
     {
     // Parse the Control-agent map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -710,7 +710,7 @@ namespace isc { namespace agent {
     break;
 
   case 9:
-#line 129 "agent_parser.yy"
+#line 135 "agent_parser.yy"
     {
     // parsing completed
 }
@@ -718,7 +718,7 @@ namespace isc { namespace agent {
     break;
 
   case 10:
-#line 136 "agent_parser.yy"
+#line 142 "agent_parser.yy"
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -727,49 +727,49 @@ namespace isc { namespace agent {
     break;
 
   case 11:
-#line 142 "agent_parser.yy"
+#line 148 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 733 "agent_parser.cc"
     break;
 
   case 12:
-#line 143 "agent_parser.yy"
+#line 149 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 739 "agent_parser.cc"
     break;
 
   case 13:
-#line 144 "agent_parser.yy"
+#line 150 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 745 "agent_parser.cc"
     break;
 
   case 14:
-#line 145 "agent_parser.yy"
+#line 151 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 751 "agent_parser.cc"
     break;
 
   case 15:
-#line 146 "agent_parser.yy"
+#line 152 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 757 "agent_parser.cc"
     break;
 
   case 16:
-#line 147 "agent_parser.yy"
+#line 153 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 763 "agent_parser.cc"
     break;
 
   case 17:
-#line 148 "agent_parser.yy"
+#line 154 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 769 "agent_parser.cc"
     break;
 
   case 18:
-#line 152 "agent_parser.yy"
+#line 158 "agent_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -780,7 +780,7 @@ namespace isc { namespace agent {
     break;
 
   case 19:
-#line 157 "agent_parser.yy"
+#line 163 "agent_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -790,13 +790,13 @@ namespace isc { namespace agent {
     break;
 
   case 20:
-#line 163 "agent_parser.yy"
+#line 169 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 796 "agent_parser.cc"
     break;
 
   case 23:
-#line 177 "agent_parser.yy"
+#line 183 "agent_parser.yy"
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -805,7 +805,7 @@ namespace isc { namespace agent {
     break;
 
   case 24:
-#line 181 "agent_parser.yy"
+#line 187 "agent_parser.yy"
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -815,7 +815,7 @@ namespace isc { namespace agent {
     break;
 
   case 25:
-#line 188 "agent_parser.yy"
+#line 194 "agent_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -824,14 +824,14 @@ namespace isc { namespace agent {
     break;
 
   case 26:
-#line 191 "agent_parser.yy"
+#line 197 "agent_parser.yy"
     {
 }
 #line 831 "agent_parser.cc"
     break;
 
   case 29:
-#line 198 "agent_parser.yy"
+#line 204 "agent_parser.yy"
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -840,7 +840,7 @@ namespace isc { namespace agent {
     break;
 
   case 30:
-#line 202 "agent_parser.yy"
+#line 208 "agent_parser.yy"
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -849,7 +849,7 @@ namespace isc { namespace agent {
     break;
 
   case 31:
-#line 215 "agent_parser.yy"
+#line 221 "agent_parser.yy"
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -860,7 +860,7 @@ namespace isc { namespace agent {
     break;
 
   case 32:
-#line 224 "agent_parser.yy"
+#line 230 "agent_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -871,7 +871,7 @@ namespace isc { namespace agent {
     break;
 
   case 33:
-#line 229 "agent_parser.yy"
+#line 235 "agent_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -881,7 +881,7 @@ namespace isc { namespace agent {
     break;
 
   case 42:
-#line 250 "agent_parser.yy"
+#line 256 "agent_parser.yy"
     {
 
     // Let's create a MapElement that will represent it, add it to the
@@ -897,7 +897,7 @@ namespace isc { namespace agent {
     break;
 
   case 43:
-#line 260 "agent_parser.yy"
+#line 266 "agent_parser.yy"
     {
     // Ok, we're done with parsing control-agent. Let's take the map
     // off the stack.
@@ -908,7 +908,7 @@ namespace isc { namespace agent {
     break;
 
   case 54:
-#line 283 "agent_parser.yy"
+#line 289 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -916,7 +916,7 @@ namespace isc { namespace agent {
     break;
 
   case 55:
-#line 285 "agent_parser.yy"
+#line 291 "agent_parser.yy"
     {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-host", host);
@@ -926,7 +926,7 @@ namespace isc { namespace agent {
     break;
 
   case 56:
-#line 291 "agent_parser.yy"
+#line 297 "agent_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-port", prf);
@@ -935,7 +935,7 @@ namespace isc { namespace agent {
     break;
 
   case 57:
-#line 296 "agent_parser.yy"
+#line 302 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -943,7 +943,7 @@ namespace isc { namespace agent {
     break;
 
   case 58:
-#line 298 "agent_parser.yy"
+#line 304 "agent_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -970,7 +970,7 @@ namespace isc { namespace agent {
     break;
 
   case 59:
-#line 321 "agent_parser.yy"
+#line 327 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -978,7 +978,7 @@ namespace isc { namespace agent {
     break;
 
   case 60:
-#line 323 "agent_parser.yy"
+#line 329 "agent_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -1007,7 +1007,7 @@ namespace isc { namespace agent {
     break;
 
   case 61:
-#line 349 "agent_parser.yy"
+#line 355 "agent_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
@@ -1018,7 +1018,7 @@ namespace isc { namespace agent {
     break;
 
   case 62:
-#line 354 "agent_parser.yy"
+#line 360 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1027,7 +1027,7 @@ namespace isc { namespace agent {
     break;
 
   case 67:
-#line 367 "agent_parser.yy"
+#line 373 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1037,7 +1037,7 @@ namespace isc { namespace agent {
     break;
 
   case 68:
-#line 371 "agent_parser.yy"
+#line 377 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
 }
@@ -1045,7 +1045,7 @@ namespace isc { namespace agent {
     break;
 
   case 74:
-#line 384 "agent_parser.yy"
+#line 390 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1053,7 +1053,7 @@ namespace isc { namespace agent {
     break;
 
   case 75:
-#line 386 "agent_parser.yy"
+#line 392 "agent_parser.yy"
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
@@ -1063,7 +1063,7 @@ namespace isc { namespace agent {
     break;
 
   case 76:
-#line 392 "agent_parser.yy"
+#line 398 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1071,7 +1071,7 @@ namespace isc { namespace agent {
     break;
 
   case 77:
-#line 394 "agent_parser.yy"
+#line 400 "agent_parser.yy"
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1080,7 +1080,7 @@ namespace isc { namespace agent {
     break;
 
   case 78:
-#line 402 "agent_parser.yy"
+#line 408 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("control-sockets", m);
@@ -1091,7 +1091,7 @@ namespace isc { namespace agent {
     break;
 
   case 79:
-#line 407 "agent_parser.yy"
+#line 413 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1100,7 +1100,7 @@ namespace isc { namespace agent {
     break;
 
   case 86:
-#line 428 "agent_parser.yy"
+#line 434 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
@@ -1111,7 +1111,7 @@ namespace isc { namespace agent {
     break;
 
   case 87:
-#line 433 "agent_parser.yy"
+#line 439 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1120,7 +1120,7 @@ namespace isc { namespace agent {
     break;
 
   case 88:
-#line 439 "agent_parser.yy"
+#line 445 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
@@ -1131,7 +1131,7 @@ namespace isc { namespace agent {
     break;
 
   case 89:
-#line 444 "agent_parser.yy"
+#line 450 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1140,7 +1140,7 @@ namespace isc { namespace agent {
     break;
 
   case 90:
-#line 450 "agent_parser.yy"
+#line 456 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
@@ -1151,7 +1151,7 @@ namespace isc { namespace agent {
     break;
 
   case 91:
-#line 455 "agent_parser.yy"
+#line 461 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1160,7 +1160,7 @@ namespace isc { namespace agent {
     break;
 
   case 99:
-#line 474 "agent_parser.yy"
+#line 480 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1168,7 +1168,7 @@ namespace isc { namespace agent {
     break;
 
   case 100:
-#line 476 "agent_parser.yy"
+#line 482 "agent_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
@@ -1178,7 +1178,7 @@ namespace isc { namespace agent {
     break;
 
   case 101:
-#line 483 "agent_parser.yy"
+#line 489 "agent_parser.yy"
     {
     ctx.enter(ctx.SOCKET_TYPE);
 }
@@ -1186,7 +1186,7 @@ namespace isc { namespace agent {
     break;
 
   case 102:
-#line 485 "agent_parser.yy"
+#line 491 "agent_parser.yy"
     {
     ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1195,13 +1195,13 @@ namespace isc { namespace agent {
     break;
 
   case 103:
-#line 491 "agent_parser.yy"
+#line 497 "agent_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
 #line 1201 "agent_parser.cc"
     break;
 
   case 104:
-#line 497 "agent_parser.yy"
+#line 503 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1209,7 +1209,7 @@ namespace isc { namespace agent {
     break;
 
   case 105:
-#line 499 "agent_parser.yy"
+#line 505 "agent_parser.yy"
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1218,7 +1218,7 @@ namespace isc { namespace agent {
     break;
 
   case 106:
-#line 504 "agent_parser.yy"
+#line 510 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1226,7 +1226,7 @@ namespace isc { namespace agent {
     break;
 
   case 107:
-#line 506 "agent_parser.yy"
+#line 512 "agent_parser.yy"
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1235,7 +1235,7 @@ namespace isc { namespace agent {
     break;
 
   case 108:
-#line 511 "agent_parser.yy"
+#line 517 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1243,7 +1243,7 @@ namespace isc { namespace agent {
     break;
 
   case 109:
-#line 513 "agent_parser.yy"
+#line 519 "agent_parser.yy"
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1252,7 +1252,7 @@ namespace isc { namespace agent {
     break;
 
   case 110:
-#line 523 "agent_parser.yy"
+#line 529 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
@@ -1263,7 +1263,7 @@ namespace isc { namespace agent {
     break;
 
   case 111:
-#line 528 "agent_parser.yy"
+#line 534 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1272,7 +1272,7 @@ namespace isc { namespace agent {
     break;
 
   case 115:
-#line 545 "agent_parser.yy"
+#line 551 "agent_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
@@ -1283,7 +1283,7 @@ namespace isc { namespace agent {
     break;
 
   case 116:
-#line 550 "agent_parser.yy"
+#line 556 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1292,7 +1292,7 @@ namespace isc { namespace agent {
     break;
 
   case 119:
-#line 562 "agent_parser.yy"
+#line 568 "agent_parser.yy"
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
@@ -1302,23 +1302,23 @@ namespace isc { namespace agent {
     break;
 
   case 120:
-#line 566 "agent_parser.yy"
+#line 572 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
 }
 #line 1310 "agent_parser.cc"
     break;
 
-  case 130:
-#line 583 "agent_parser.yy"
+  case 133:
+#line 592 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
 #line 1318 "agent_parser.cc"
     break;
 
-  case 131:
-#line 585 "agent_parser.yy"
+  case 134:
+#line 594 "agent_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1327,8 +1327,8 @@ namespace isc { namespace agent {
 #line 1328 "agent_parser.cc"
     break;
 
-  case 132:
-#line 591 "agent_parser.yy"
+  case 135:
+#line 600 "agent_parser.yy"
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
@@ -1336,16 +1336,16 @@ namespace isc { namespace agent {
 #line 1337 "agent_parser.cc"
     break;
 
-  case 133:
-#line 596 "agent_parser.yy"
+  case 136:
+#line 605 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
 #line 1345 "agent_parser.cc"
     break;
 
-  case 134:
-#line 598 "agent_parser.yy"
+  case 137:
+#line 607 "agent_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
@@ -1354,109 +1354,182 @@ namespace isc { namespace agent {
 #line 1355 "agent_parser.cc"
     break;
 
-  case 135:
-#line 604 "agent_parser.yy"
+  case 138:
+#line 613 "agent_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1363 "agent_parser.cc"
+    break;
+
+  case 139:
+#line 615 "agent_parser.yy"
+    {
+    ElementPtr l = ctx.stack_.back();
+    ctx.stack_.pop_back();
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.leave();
+}
+#line 1374 "agent_parser.cc"
+    break;
+
+  case 140:
+#line 622 "agent_parser.yy"
+    {
+    ElementPtr limit(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", limit);
+}
+#line 1383 "agent_parser.cc"
+    break;
+
+  case 141:
+#line 627 "agent_parser.yy"
+    {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+}
+#line 1392 "agent_parser.cc"
+    break;
+
+  case 142:
+#line 632 "agent_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1366 "agent_parser.cc"
+#line 1403 "agent_parser.cc"
     break;
 
-  case 136:
-#line 609 "agent_parser.yy"
+  case 143:
+#line 637 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1375 "agent_parser.cc"
+#line 1412 "agent_parser.cc"
     break;
 
-  case 139:
-#line 618 "agent_parser.yy"
+  case 146:
+#line 646 "agent_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1385 "agent_parser.cc"
+#line 1422 "agent_parser.cc"
     break;
 
-  case 140:
-#line 622 "agent_parser.yy"
+  case 147:
+#line 650 "agent_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 1393 "agent_parser.cc"
+#line 1430 "agent_parser.cc"
     break;
 
-  case 148:
-#line 637 "agent_parser.yy"
+  case 158:
+#line 668 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1401 "agent_parser.cc"
+#line 1438 "agent_parser.cc"
     break;
 
-  case 149:
-#line 639 "agent_parser.yy"
+  case 159:
+#line 670 "agent_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1411 "agent_parser.cc"
+#line 1448 "agent_parser.cc"
     break;
 
-  case 150:
-#line 645 "agent_parser.yy"
+  case 160:
+#line 676 "agent_parser.yy"
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1420 "agent_parser.cc"
+#line 1457 "agent_parser.cc"
     break;
 
-  case 151:
-#line 650 "agent_parser.yy"
+  case 161:
+#line 681 "agent_parser.yy"
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1429 "agent_parser.cc"
+#line 1466 "agent_parser.cc"
     break;
 
-  case 152:
-#line 655 "agent_parser.yy"
+  case 162:
+#line 686 "agent_parser.yy"
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1438 "agent_parser.cc"
+#line 1475 "agent_parser.cc"
     break;
 
-  case 153:
-#line 660 "agent_parser.yy"
+  case 163:
+#line 691 "agent_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1446 "agent_parser.cc"
+#line 1483 "agent_parser.cc"
     break;
 
-  case 154:
-#line 662 "agent_parser.yy"
+  case 164:
+#line 693 "agent_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 1456 "agent_parser.cc"
+#line 1493 "agent_parser.cc"
+    break;
+
+  case 165:
+#line 699 "agent_parser.yy"
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1502 "agent_parser.cc"
+    break;
+
+  case 166:
+#line 704 "agent_parser.yy"
+    {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 1511 "agent_parser.cc"
+    break;
+
+  case 167:
+#line 709 "agent_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1519 "agent_parser.cc"
+    break;
+
+  case 168:
+#line 711 "agent_parser.yy"
+    {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+}
+#line 1529 "agent_parser.cc"
     break;
 
 
-#line 1460 "agent_parser.cc"
+#line 1533 "agent_parser.cc"
 
             default:
               break;
@@ -1727,40 +1800,42 @@ namespace isc { namespace agent {
   }
 
 
-  const signed char AgentParser::yypact_ninf_ = -115;
+  const short AgentParser::yypact_ninf_ = -158;
 
   const signed char AgentParser::yytable_ninf_ = -1;
 
   const short
   AgentParser::yypact_[] =
   {
-      71,  -115,  -115,  -115,     8,     2,    -5,     3,  -115,  -115,
-    -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,
-    -115,  -115,  -115,  -115,     2,   -19,    12,    13,  -115,    15,
-      35,    48,    51,    74,  -115,  -115,  -115,  -115,  -115,    75,
-    -115,    28,  -115,  -115,  -115,  -115,  -115,  -115,  -115,    83,
-    -115,  -115,    84,  -115,  -115,  -115,    53,  -115,  -115,  -115,
-    -115,  -115,  -115,  -115,  -115,  -115,     2,     2,  -115,    65,
-     104,   109,   110,   111,   112,  -115,    12,  -115,   113,    76,
-     114,   116,   115,   120,   121,    13,  -115,  -115,  -115,   125,
-     123,   124,     2,     2,     2,  -115,    90,  -115,   126,    92,
-    -115,   130,   131,  -115,     2,    13,   117,  -115,  -115,  -115,
-    -115,  -115,  -115,  -115,    -2,   132,   133,  -115,    57,    70,
-    -115,  -115,  -115,  -115,  -115,  -115,    73,  -115,  -115,  -115,
-    -115,  -115,   135,   134,  -115,  -115,    14,  -115,  -115,   117,
-    -115,   138,   140,   141,    -2,  -115,     9,  -115,   132,    44,
-     133,  -115,  -115,   139,   142,   143,  -115,  -115,  -115,  -115,
-      82,  -115,  -115,  -115,  -115,  -115,  -115,   144,  -115,  -115,
-    -115,  -115,    93,  -115,  -115,  -115,  -115,  -115,  -115,    -1,
-      -1,    -1,   147,   148,     6,  -115,   149,   150,   118,   151,
-      44,  -115,  -115,  -115,  -115,  -115,  -115,    94,  -115,  -115,
-    -115,    95,    96,   105,     2,  -115,   122,   152,  -115,   128,
-    -115,   154,   155,    -1,  -115,  -115,  -115,  -115,  -115,  -115,
-     153,  -115,   129,   145,  -115,  -115,   103,  -115,  -115,  -115,
-    -115,    60,   153,  -115,  -115,   158,   159,   161,  -115,    97,
-    -115,  -115,  -115,  -115,  -115,  -115,  -115,   168,   136,   146,
-     156,   169,    60,  -115,   137,  -115,  -115,  -115,   160,  -115,
-    -115,  -115
+     -37,  -158,  -158,  -158,    20,     6,     7,    37,  -158,  -158,
+    -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,
+    -158,  -158,  -158,  -158,     6,     0,    -9,    10,  -158,    44,
+      49,    61,    71,    68,  -158,  -158,  -158,  -158,  -158,    86,
+    -158,    -1,  -158,  -158,  -158,  -158,  -158,  -158,  -158,   111,
+    -158,  -158,   112,  -158,  -158,  -158,    58,  -158,  -158,  -158,
+    -158,  -158,  -158,  -158,  -158,  -158,     6,     6,  -158,    41,
+     115,   116,   118,   120,   121,  -158,    -9,  -158,   125,    65,
+     126,   127,   128,   129,   130,    10,  -158,  -158,  -158,   132,
+     131,   133,     6,     6,     6,  -158,    84,  -158,   134,    89,
+    -158,   137,   138,  -158,     6,    10,   113,  -158,  -158,  -158,
+    -158,  -158,  -158,  -158,     1,   139,   140,  -158,    64,    85,
+    -158,  -158,  -158,  -158,  -158,  -158,    99,  -158,  -158,  -158,
+    -158,  -158,   142,   141,  -158,  -158,    25,  -158,  -158,   113,
+    -158,   145,   146,   147,     1,  -158,     3,  -158,   139,    46,
+     140,  -158,  -158,   148,   149,   150,  -158,  -158,  -158,  -158,
+     100,  -158,  -158,  -158,  -158,  -158,  -158,   154,  -158,  -158,
+     155,   156,  -158,  -158,  -158,   101,  -158,  -158,  -158,  -158,
+    -158,  -158,  -158,  -158,  -158,    27,    27,    27,   157,   158,
+      14,  -158,   159,   160,    96,   161,   162,   104,   105,    46,
+    -158,  -158,  -158,  -158,  -158,  -158,   102,  -158,  -158,  -158,
+     103,   109,   119,     6,  -158,   122,   163,  -158,   123,   164,
+    -158,  -158,  -158,   168,   169,    27,  -158,  -158,  -158,  -158,
+    -158,  -158,   167,  -158,  -158,   135,   165,  -158,  -158,    75,
+    -158,  -158,  -158,  -158,    63,   167,  -158,  -158,   171,   175,
+     176,  -158,   177,   178,  -158,   110,  -158,  -158,  -158,  -158,
+    -158,  -158,  -158,  -158,  -158,  -158,   180,   136,   143,   144,
+     181,   151,   152,   184,    63,  -158,   166,  -158,  -158,  -158,
+     170,  -158,  -158,   172,  -158,  -158,  -158,  -158
   };
 
   const unsigned char
@@ -1782,152 +1857,163 @@ namespace isc { namespace agent {
       84,    67,     0,    64,    65,   119,     0,   117,    43,     0,
      111,     0,     0,     0,     0,    79,     0,    62,     0,     0,
        0,   116,   113,     0,     0,     0,    81,    74,    76,    71,
-       0,    69,    72,    73,    66,   130,   135,     0,   133,   129,
-     127,   128,     0,   121,   123,   125,   126,   124,   118,     0,
-       0,     0,     0,     0,     0,    68,     0,     0,     0,     0,
-       0,   120,    99,   101,    98,    96,    97,     0,    92,    94,
-      95,     0,     0,     0,     0,    70,     0,     0,   132,     0,
-     122,     0,     0,     0,    87,    89,    91,    75,    77,   131,
-       0,   134,     0,     0,    93,   139,     0,   137,   100,   103,
-     102,     0,     0,   136,   148,     0,     0,     0,   153,     0,
-     141,   143,   144,   145,   146,   147,   138,     0,     0,     0,
-       0,     0,     0,   140,     0,   150,   151,   152,     0,   142,
-     149,   154
+       0,    69,    72,    73,    66,   133,   142,     0,   136,   138,
+       0,     0,   132,   130,   131,     0,   121,   123,   125,   126,
+     127,   128,   129,   124,   118,     0,     0,     0,     0,     0,
+       0,    68,     0,     0,     0,     0,     0,     0,     0,     0,
+     120,    99,   101,    98,    96,    97,     0,    92,    94,    95,
+       0,     0,     0,     0,    70,     0,     0,   135,     0,     0,
+     140,   141,   122,     0,     0,     0,    87,    89,    91,    75,
+      77,   134,     0,   137,   139,     0,     0,    93,   146,     0,
+     144,   100,   103,   102,     0,     0,   143,   158,     0,     0,
+       0,   163,     0,     0,   167,     0,   148,   150,   151,   152,
+     153,   154,   155,   156,   157,   145,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   147,     0,   160,   161,   162,
+       0,   165,   166,     0,   149,   159,   164,   168
   };
 
-  const signed char
+  const short
   AgentParser::yypgoto_[] =
   {
-    -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,   -24,    40,
-    -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,   -23,  -115,
-    -115,  -115,    80,  -115,  -115,    69,    91,  -115,  -115,  -115,
-     -22,  -115,   -21,  -115,  -115,  -115,  -115,  -115,    27,  -115,
-    -115,    -7,  -115,  -115,  -115,  -115,  -115,  -115,  -115,    34,
-    -115,  -115,  -115,  -115,  -115,  -115,  -114,   -31,  -115,  -115,
-    -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,
-    -115,  -115,    45,  -105,  -115,  -115,    33,  -115,  -115,    -4,
-    -115,  -115,  -115,  -115,  -115,  -115,  -115,  -115,   -47,  -115,
-    -115,   -65,  -115,  -115,  -115,  -115,  -115,  -115,  -115
+    -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,   -24,    54,
+    -158,  -158,  -158,  -158,   -29,  -158,  -158,  -158,   -23,  -158,
+    -158,  -158,   124,  -158,  -158,    90,   106,  -158,  -158,  -158,
+     -22,  -158,   -21,  -158,  -158,  -158,  -158,  -158,    48,  -158,
+    -158,     4,  -158,  -158,  -158,  -158,  -158,  -158,  -158,    53,
+    -158,  -158,  -158,  -158,  -158,  -158,  -157,   -27,  -158,  -158,
+    -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,
+    -158,  -158,    60,   -94,  -158,  -158,    55,  -158,  -158,     5,
+    -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,  -158,
+    -158,  -158,   -42,  -158,  -158,   -68,  -158,  -158,  -158,  -158,
+    -158,  -158,  -158,  -158,  -158,  -158,  -158
   };
 
   const short
   AgentParser::yydefgoto_[] =
   {
       -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
-      25,   112,    32,    33,    19,    24,    29,    30,   194,    21,
+      25,   112,    32,    33,    19,    24,    29,    30,   203,    21,
       26,    41,    42,    43,    70,    56,    57,    58,    78,    59,
-     195,    80,   196,    81,    62,    83,   132,   133,   134,   146,
-     160,   161,   162,   182,   163,   183,    63,   114,   126,   127,
-     128,   141,   129,   142,   130,   143,   197,   198,   199,   211,
-     200,   212,   230,    44,    72,    45,    73,    46,    74,    47,
-      71,   119,   120,    64,    84,   136,   137,   149,   172,   173,
-     174,   186,   175,   176,   189,   177,   187,   226,   227,   231,
-     239,   240,   241,   247,   242,   243,   244,   245,   251
+     204,    80,   205,    81,    62,    83,   132,   133,   134,   146,
+     160,   161,   162,   188,   163,   189,    63,   114,   126,   127,
+     128,   141,   129,   142,   130,   143,   206,   207,   208,   223,
+     209,   224,   243,    44,    72,    45,    73,    46,    74,    47,
+      71,   119,   120,    64,    84,   136,   137,   149,   175,   176,
+     177,   192,   178,   179,   195,   180,   196,   181,   182,   183,
+     193,   239,   240,   244,   255,   256,   257,   266,   258,   259,
+     260,   261,   270,   262,   263,   264,   273
   };
 
   const unsigned short
   AgentParser::yytable_[] =
   {
-      28,   121,    20,    40,    55,    60,    61,     9,     8,    10,
-      22,    11,    50,    51,   122,   123,   124,   150,   192,   193,
-     151,    65,    34,    31,    48,    49,    50,    51,    52,   157,
-     158,    76,   157,   158,   121,    53,    77,    35,    66,    54,
-      39,    39,    87,    88,    12,    13,    14,    15,    36,    37,
-      38,    39,    67,    40,    39,    39,    85,    50,    51,    68,
-      85,    86,    55,    60,    61,   138,   201,   202,   107,   108,
-     109,   165,   166,   139,   167,   168,   144,    69,   140,    75,
-     117,   145,    55,    60,    61,   184,    39,    79,    82,   234,
-     185,   125,   235,   236,   237,   238,   190,   213,   213,   213,
-     252,   191,   214,   215,   216,   253,   232,    89,    90,   233,
-       1,     2,     3,    91,    92,    93,    94,    96,    98,    97,
-      99,   125,   100,   159,   101,   102,   169,   170,   171,   104,
-     105,   106,   110,    10,   113,   115,   116,   148,   111,   131,
-     135,   147,   153,    54,   154,   155,   179,   217,   188,   180,
-     181,   203,   204,   206,   207,   209,    95,   220,   222,   223,
-     225,   208,   248,   249,   219,   250,   229,   169,   170,   171,
-     221,   228,   254,   258,   118,   164,   103,   205,   156,   260,
-     218,   255,   224,   178,   152,   246,   210,   259,     0,   256,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   257,
-       0,     0,   261
+      28,    34,    76,    40,    55,    60,    61,    77,     1,     2,
+       3,     9,   121,    10,    20,    11,    35,   122,   123,   124,
+       8,    48,    49,    50,    51,    52,   157,   158,   150,   210,
+     211,   151,    53,    36,    37,    38,    54,   157,   158,    39,
+      50,    51,    87,    88,    22,   121,   201,   202,    31,    39,
+      65,    39,    66,    40,    12,    13,    14,    15,    39,    50,
+      51,    85,    55,    60,    61,    67,    86,    85,   107,   108,
+     109,    69,   138,   165,   166,    39,   167,   168,   245,    68,
+     117,   246,    55,    60,    61,   169,   170,   171,   139,    89,
+      75,   125,   247,   140,    39,   248,   249,   250,   251,   252,
+     253,   254,   144,   190,   199,   225,   225,   145,   191,   200,
+     226,   227,   225,   274,    97,    79,    82,   228,   275,    90,
+      91,   125,    92,   159,    93,    94,   172,   173,   174,    96,
+      98,    99,   110,   101,   102,   100,   104,   113,   105,    54,
+     106,    10,   115,   116,   148,   217,   131,   135,   147,   153,
+     154,   155,   111,   220,   221,   185,   186,   187,   194,   197,
+     198,   212,   213,   215,   216,   218,   219,   229,   232,     9,
+     231,   233,   235,   236,   238,   267,   172,   173,   174,   268,
+     269,   271,   272,   241,   276,   280,   242,   277,   283,   230,
+     234,   103,   278,   279,   214,   118,   164,   156,   237,   152,
+      95,   282,   281,   265,   222,   184,   284,     0,     0,     0,
+       0,     0,     0,     0,   285,     0,     0,     0,   286,     0,
+     287
   };
 
   const short
   AgentParser::yycheck_[] =
   {
-      24,   106,     7,    26,    27,    27,    27,     5,     0,     7,
-       7,     9,    13,    14,    16,    17,    18,     3,    19,    20,
-       6,     6,    10,    42,    11,    12,    13,    14,    15,    23,
-      24,     3,    23,    24,   139,    22,     8,    25,     3,    26,
-      42,    42,    66,    67,    42,    43,    44,    45,    36,    37,
-      38,    42,     4,    76,    42,    42,     3,    13,    14,     8,
-       3,     8,    85,    85,    85,     8,   180,   181,    92,    93,
-      94,    27,    28,     3,    30,    31,     3,     3,     8,     4,
-     104,     8,   105,   105,   105,     3,    42,     4,     4,    29,
-       8,   114,    32,    33,    34,    35,     3,     3,     3,     3,
-       3,     8,     8,     8,     8,     8,     3,    42,     4,     6,
-      39,    40,    41,     4,     4,     4,     4,     4,     4,    43,
-       4,   144,     7,   146,     4,     4,   149,   149,   149,     4,
-       7,     7,    42,     7,    42,     5,     5,     3,    98,     7,
-       7,     6,     4,    26,     4,     4,     7,    42,     4,     7,
-       7,     4,     4,     4,     4,     4,    76,     5,     4,     4,
-       7,    43,     4,     4,    42,     4,    21,   190,   190,   190,
-      42,    42,     4,     4,   105,   148,    85,   184,   144,    42,
-     204,    45,   213,   150,   139,   232,   190,   252,    -1,    43,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,
-      -1,    -1,    42
+      24,    10,     3,    26,    27,    27,    27,     8,    45,    46,
+      47,     5,   106,     7,     7,     9,    25,    16,    17,    18,
+       0,    11,    12,    13,    14,    15,    23,    24,     3,   186,
+     187,     6,    22,    42,    43,    44,    26,    23,    24,    48,
+      13,    14,    66,    67,     7,   139,    19,    20,    48,    48,
+       6,    48,     3,    76,    48,    49,    50,    51,    48,    13,
+      14,     3,    85,    85,    85,     4,     8,     3,    92,    93,
+      94,     3,     8,    27,    28,    48,    30,    31,     3,     8,
+     104,     6,   105,   105,   105,    39,    40,    41,     3,    48,
+       4,   114,    29,     8,    48,    32,    33,    34,    35,    36,
+      37,    38,     3,     3,     3,     3,     3,     8,     8,     8,
+       8,     8,     3,     3,    49,     4,     4,     8,     8,     4,
+       4,   144,     4,   146,     4,     4,   149,   149,   149,     4,
+       4,     4,    48,     4,     4,     7,     4,    48,     7,    26,
+       7,     7,     5,     5,     3,    49,     7,     7,     6,     4,
+       4,     4,    98,    49,    49,     7,     7,     7,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,    48,     5,     5,
+      48,    48,     4,     4,     7,     4,   199,   199,   199,     4,
+       4,     4,     4,    48,     4,     4,    21,    51,     4,   213,
+     219,    85,    49,    49,   190,   105,   148,   144,   225,   139,
+      76,    49,    51,   245,   199,   150,   274,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    48,    -1,    -1,    -1,    48,    -1,
+      48
   };
 
   const unsigned char
   AgentParser::yystos_[] =
   {
-       0,    39,    40,    41,    47,    48,    49,    50,     0,     5,
-       7,     9,    42,    43,    44,    45,    53,    54,    55,    60,
-       7,    65,     7,    51,    61,    56,    66,    52,    54,    62,
-      63,    42,    58,    59,    10,    25,    36,    37,    38,    42,
-      64,    67,    68,    69,   109,   111,   113,   115,    11,    12,
-      13,    14,    15,    22,    26,    64,    71,    72,    73,    75,
-      76,    78,    80,    92,   119,     6,     3,     4,     8,     3,
-      70,   116,   110,   112,   114,     4,     3,     8,    74,     4,
-      77,    79,     4,    81,   120,     3,     8,    54,    54,    42,
-       4,     4,     4,     4,     4,    68,     4,    43,     4,     4,
-       7,     4,     4,    72,     4,     7,     7,    54,    54,    54,
-      42,    55,    57,    42,    93,     5,     5,    54,    71,   117,
-     118,   119,    16,    17,    18,    64,    94,    95,    96,    98,
-     100,     7,    82,    83,    84,     7,   121,   122,     8,     3,
-       8,    97,    99,   101,     3,     8,    85,     6,     3,   123,
-       3,     6,   118,     4,     4,     4,    95,    23,    24,    64,
-      86,    87,    88,    90,    84,    27,    28,    30,    31,    64,
-      76,    78,   124,   125,   126,   128,   129,   131,   122,     7,
-       7,     7,    89,    91,     3,     8,   127,   132,     4,   130,
-       3,     8,    19,    20,    64,    76,    78,   102,   103,   104,
-     106,   102,   102,     4,     4,    87,     4,     4,    43,     4,
-     125,   105,   107,     3,     8,     8,     8,    42,    54,    42,
-       5,    42,     4,     4,   103,     7,   133,   134,    42,    21,
-     108,   135,     3,     6,    29,    32,    33,    34,    35,   136,
-     137,   138,   140,   141,   142,   143,   134,   139,     4,     4,
-       4,   144,     3,     8,     4,    45,    43,    43,     4,   137,
-      42,    42
+       0,    45,    46,    47,    53,    54,    55,    56,     0,     5,
+       7,     9,    48,    49,    50,    51,    59,    60,    61,    66,
+       7,    71,     7,    57,    67,    62,    72,    58,    60,    68,
+      69,    48,    64,    65,    10,    25,    42,    43,    44,    48,
+      70,    73,    74,    75,   115,   117,   119,   121,    11,    12,
+      13,    14,    15,    22,    26,    70,    77,    78,    79,    81,
+      82,    84,    86,    98,   125,     6,     3,     4,     8,     3,
+      76,   122,   116,   118,   120,     4,     3,     8,    80,     4,
+      83,    85,     4,    87,   126,     3,     8,    60,    60,    48,
+       4,     4,     4,     4,     4,    74,     4,    49,     4,     4,
+       7,     4,     4,    78,     4,     7,     7,    60,    60,    60,
+      48,    61,    63,    48,    99,     5,     5,    60,    77,   123,
+     124,   125,    16,    17,    18,    70,   100,   101,   102,   104,
+     106,     7,    88,    89,    90,     7,   127,   128,     8,     3,
+       8,   103,   105,   107,     3,     8,    91,     6,     3,   129,
+       3,     6,   124,     4,     4,     4,   101,    23,    24,    70,
+      92,    93,    94,    96,    90,    27,    28,    30,    31,    39,
+      40,    41,    70,    82,    84,   130,   131,   132,   134,   135,
+     137,   139,   140,   141,   128,     7,     7,     7,    95,    97,
+       3,     8,   133,   142,     4,   136,   138,     4,     4,     3,
+       8,    19,    20,    70,    82,    84,   108,   109,   110,   112,
+     108,   108,     4,     4,    93,     4,     4,    49,     4,     4,
+      49,    49,   131,   111,   113,     3,     8,     8,     8,    48,
+      60,    48,     5,    48,    66,     4,     4,   109,     7,   143,
+     144,    48,    21,   114,   145,     3,     6,    29,    32,    33,
+      34,    35,    36,    37,    38,   146,   147,   148,   150,   151,
+     152,   153,   155,   156,   157,   144,   149,     4,     4,     4,
+     154,     4,     4,   158,     3,     8,     4,    51,    49,    49,
+       4,    51,    49,     4,   147,    48,    48,    48
   };
 
   const unsigned char
   AgentParser::yyr1_[] =
   {
-       0,    46,    48,    47,    49,    47,    50,    47,    52,    51,
-      53,    54,    54,    54,    54,    54,    54,    54,    56,    55,
-      57,    58,    58,    59,    59,    61,    60,    62,    62,    63,
-      63,    64,    66,    65,    67,    67,    68,    68,    68,    68,
-      68,    68,    70,    69,    71,    71,    72,    72,    72,    72,
-      72,    72,    72,    72,    74,    73,    75,    77,    76,    79,
-      78,    81,    80,    82,    82,    83,    83,    85,    84,    86,
-      86,    86,    87,    87,    89,    88,    91,    90,    93,    92,
-      94,    94,    95,    95,    95,    95,    97,    96,    99,    98,
-     101,   100,   102,   102,   103,   103,   103,   103,   103,   105,
-     104,   107,   106,   108,   110,   109,   112,   111,   114,   113,
-     116,   115,   117,   117,   118,   120,   119,   121,   121,   123,
-     122,   124,   124,   125,   125,   125,   125,   125,   125,   125,
-     127,   126,   128,   130,   129,   132,   131,   133,   133,   135,
-     134,   136,   136,   137,   137,   137,   137,   137,   139,   138,
-     140,   141,   142,   144,   143
+       0,    52,    54,    53,    55,    53,    56,    53,    58,    57,
+      59,    60,    60,    60,    60,    60,    60,    60,    62,    61,
+      63,    64,    64,    65,    65,    67,    66,    68,    68,    69,
+      69,    70,    72,    71,    73,    73,    74,    74,    74,    74,
+      74,    74,    76,    75,    77,    77,    78,    78,    78,    78,
+      78,    78,    78,    78,    80,    79,    81,    83,    82,    85,
+      84,    87,    86,    88,    88,    89,    89,    91,    90,    92,
+      92,    92,    93,    93,    95,    94,    97,    96,    99,    98,
+     100,   100,   101,   101,   101,   101,   103,   102,   105,   104,
+     107,   106,   108,   108,   109,   109,   109,   109,   109,   111,
+     110,   113,   112,   114,   116,   115,   118,   117,   120,   119,
+     122,   121,   123,   123,   124,   126,   125,   127,   127,   129,
+     128,   130,   130,   131,   131,   131,   131,   131,   131,   131,
+     131,   131,   131,   133,   132,   134,   136,   135,   138,   137,
+     139,   140,   142,   141,   143,   143,   145,   144,   146,   146,
+     147,   147,   147,   147,   147,   147,   147,   147,   149,   148,
+     150,   151,   152,   154,   153,   155,   156,   158,   157
   };
 
   const unsigned char
@@ -1946,9 +2032,10 @@ namespace isc { namespace agent {
        4,     0,     4,     1,     0,     4,     0,     4,     0,     4,
        0,     6,     1,     3,     1,     0,     6,     1,     3,     0,
        4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     3,     0,     4,     0,     6,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     0,     4,
-       3,     3,     3,     0,     4
+       1,     1,     1,     0,     4,     3,     0,     4,     0,     4,
+       3,     3,     0,     6,     1,     3,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       3,     3,     3,     0,     4,     3,     3,     0,     4
   };
 
 
@@ -1966,6 +2053,8 @@ namespace isc { namespace agent {
   "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
   "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
   "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"pattern\"",
+  "\"async\"", "\"async-queue-size\"", "\"async-overflow\"",
+  "\"rate-limited-messages\"", "\"rate-limit\"", "\"rate-limit-interval\"",
   "\"Dhcp4\"", "\"Dhcp6\"", "\"DhcpDdns\"", "START_JSON", "START_AGENT",
   "START_SUB_AGENT", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
@@ -1986,31 +2075,34 @@ namespace isc { namespace agent {
   "logging_object", "$@25", "logging_params", "logging_param", "loggers",
   "$@26", "loggers_entries", "logger_entry", "$@27", "logger_params",
   "logger_param", "name", "$@28", "debuglevel", "severity", "$@29",
-  "output_options_list", "$@30", "output_options_list_content",
-  "output_entry", "$@31", "output_params_list", "output_params", "output",
-  "$@32", "flush", "maxsize", "maxver", "pattern", "$@33", YY_NULLPTR
+  "rate_limited_messages", "$@30", "rate_limit", "rate_limit_interval",
+  "output_options_list", "$@31", "output_options_list_content",
+  "output_entry", "$@32", "output_params_list", "output_params", "output",
+  "$@33", "flush", "maxsize", "maxver", "pattern", "$@34", "async",
+  "async_queue_size", "async_overflow", "$@35", YY_NULLPTR
   };
 
 #if AGENT_DEBUG
   const unsigned short
   AgentParser::yyrline_[] =
   {
-       0,   115,   115,   115,   116,   116,   117,   117,   125,   125,
-     136,   142,   143,   144,   145,   146,   147,   148,   152,   152,
-     163,   168,   169,   177,   181,   188,   188,   194,   195,   198,
-     202,   215,   224,   224,   236,   237,   241,   242,   243,   244,
-     245,   246,   250,   250,   267,   268,   273,   274,   275,   276,
-     277,   278,   279,   280,   283,   283,   291,   296,   296,   321,
-     321,   349,   349,   359,   360,   363,   364,   367,   367,   375,
-     376,   377,   380,   381,   384,   384,   392,   392,   402,   402,
-     415,   416,   421,   422,   423,   424,   428,   428,   439,   439,
-     450,   450,   461,   462,   466,   467,   468,   469,   470,   474,
-     474,   483,   483,   491,   497,   497,   504,   504,   511,   511,
-     523,   523,   536,   537,   541,   545,   545,   557,   558,   562,
-     562,   570,   571,   574,   575,   576,   577,   578,   579,   580,
-     583,   583,   591,   596,   596,   604,   604,   614,   615,   618,
-     618,   626,   627,   630,   631,   632,   633,   634,   637,   637,
-     645,   650,   655,   660,   660
+       0,   121,   121,   121,   122,   122,   123,   123,   131,   131,
+     142,   148,   149,   150,   151,   152,   153,   154,   158,   158,
+     169,   174,   175,   183,   187,   194,   194,   200,   201,   204,
+     208,   221,   230,   230,   242,   243,   247,   248,   249,   250,
+     251,   252,   256,   256,   273,   274,   279,   280,   281,   282,
+     283,   284,   285,   286,   289,   289,   297,   302,   302,   327,
+     327,   355,   355,   365,   366,   369,   370,   373,   373,   381,
+     382,   383,   386,   387,   390,   390,   398,   398,   408,   408,
+     421,   422,   427,   428,   429,   430,   434,   434,   445,   445,
+     456,   456,   467,   468,   472,   473,   474,   475,   476,   480,
+     480,   489,   489,   497,   503,   503,   510,   510,   517,   517,
+     529,   529,   542,   543,   547,   551,   551,   563,   564,   568,
+     568,   576,   577,   580,   581,   582,   583,   584,   585,   586,
+     587,   588,   589,   592,   592,   600,   605,   605,   613,   613,
+     622,   627,   632,   632,   642,   643,   646,   646,   654,   655,
+     658,   659,   660,   661,   662,   663,   664,   665,   668,   668,
+     676,   681,   686,   691,   691,   699,   704,   709,   709
   };
 
   // Print the state stack on the debug stream.
@@ -2045,7 +2137,7 @@ namespace isc { namespace agent {
 
 #line 14 "agent_parser.yy"
 } } // isc::agent
-#line 2049 "agent_parser.cc"
+#line 2141 "agent_parser.cc"
 
 #line 668 "agent_parser.yy"
 
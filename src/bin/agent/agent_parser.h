@@ -480,16 +480,22 @@ namespace isc { namespace agent {
         TOKEN_MAXSIZE = 288,
         TOKEN_MAXVER = 289,
         TOKEN_PATTERN = 290,
-        TOKEN_DHCP4 = 291,
-        TOKEN_DHCP6 = 292,
-        TOKEN_DHCPDDNS = 293,
-        TOKEN_START_JSON = 294,
-        TOKEN_START_AGENT = 295,
-        TOKEN_START_SUB_AGENT = 296,
-        TOKEN_STRING = 297,
-        TOKEN_INTEGER = 298,
-        TOKEN_FLOAT = 299,
-        TOKEN_BOOLEAN = 300
+        TOKEN_ASYNC = 291,
+        TOKEN_ASYNC_QUEUE_SIZE = 292,
+        TOKEN_ASYNC_OVERFLOW = 293,
+        TOKEN_RATE_LIMITED_MESSAGES = 294,
+        TOKEN_RATE_LIMIT = 295,
+        TOKEN_RATE_LIMIT_INTERVAL = 296,
+        TOKEN_DHCP4 = 297,
+        TOKEN_DHCP6 = 298,
+        TOKEN_DHCPDDNS = 299,
+        TOKEN_START_JSON = 300,
+        TOKEN_START_AGENT = 301,
+        TOKEN_START_SUB_AGENT = 302,
+        TOKEN_STRING = 303,
+        TOKEN_INTEGER = 304,
+        TOKEN_FLOAT = 305,
+        TOKEN_BOOLEAN = 306
       };
     };
 
@@ -631,25 +637,25 @@ namespace isc { namespace agent {
         // Type destructor.
 switch (yytype)
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -732,13 +738,13 @@ switch (yytype)
       symbol_type (int tok, location_type l)
         : super_type(token_type (tok), std::move (l))
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_HTTP_HOST || tok == token::TOKEN_HTTP_PORT || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_CONTROL_SOCKETS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_AGENT || tok == token::TOKEN_START_SUB_AGENT);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_HTTP_HOST || tok == token::TOKEN_HTTP_PORT || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_CONTROL_SOCKETS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_AGENT || tok == token::TOKEN_START_SUB_AGENT);
       }
 #else
       symbol_type (int tok, const location_type& l)
         : super_type(token_type (tok), l)
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_HTTP_HOST || tok == token::TOKEN_HTTP_PORT || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_CONTROL_SOCKETS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_AGENT || tok == token::TOKEN_START_SUB_AGENT);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_HTTP_HOST || tok == token::TOKEN_HTTP_PORT || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_CONTROL_SOCKETS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_AGENT || tok == token::TOKEN_START_SUB_AGENT);
       }
 #endif
 #if 201103L <= YY_CPLUSPLUS
@@ -1340,6 +1346,96 @@ switch (yytype)
         return symbol_type (token::TOKEN_PATTERN, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1519,7 +1615,7 @@ switch (yytype)
     /// \param yyvalue   the value to check
     static bool yy_table_value_is_error_ (int yyvalue);
 
-    static const signed char yypact_ninf_;
+    static const short yypact_ninf_;
     static const signed char yytable_ninf_;
 
     /// Convert a scanner token number \a t to a symbol number.
@@ -1536,7 +1632,7 @@ switch (yytype)
   static const unsigned char yydefact_[];
 
   // YYPGOTO[NTERM-NUM].
-  static const signed char yypgoto_[];
+  static const short yypgoto_[];
 
   // YYDEFGOTO[NTERM-NUM].
   static const short yydefgoto_[];
@@ -1796,12 +1892,12 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 202,     ///< Last index in yytable_.
-      yynnts_ = 99,  ///< Number of nonterminal symbols.
+      yylast_ = 220,     ///< Last index in yytable_.
+      yynnts_ = 107,  ///< Number of nonterminal symbols.
       yyfinal_ = 8, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 46  ///< Number of tokens.
+      yyntokens_ = 52  ///< Number of tokens.
     };
 
 
@@ -1849,9 +1945,9 @@ switch (yytype)
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45
+      45,    46,    47,    48,    49,    50,    51
     };
-    const unsigned user_token_number_max_ = 300;
+    const unsigned user_token_number_max_ = 306;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int> (t) <= yyeof_)
@@ -1872,25 +1968,25 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -1909,25 +2005,25 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -1953,25 +2049,25 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 54: // value
-      case 57: // map_value
-      case 108: // socket_type_value
+      case 60: // value
+      case 63: // map_value
+      case 114: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 45: // "boolean"
+      case 51: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 44: // "floating point"
+      case 50: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 43: // "integer"
+      case 49: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 42: // "constant string"
+      case 48: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -2043,14 +2139,15 @@ switch (yytype)
      265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306
     };
     return token_type (yytoken_number_[type]);
   }
 
 #line 14 "agent_parser.yy"
 } } // isc::agent
-#line 2054 "agent_parser.h"
+#line 2151 "agent_parser.h"
 
 
 
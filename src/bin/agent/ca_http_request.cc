@@ -0,0 +1,71 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <agent/ca_http_request.h>
+#include <boost/algorithm/string/predicate.hpp>
+
+using namespace isc::http;
+
+namespace isc {
+namespace agent {
+
+const char* CtrlAgentHttpRequest::METRICS_URI = "/metrics";
+
+CtrlAgentHttpRequest::CtrlAgentHttpRequest()
+    : PostHttpRequestJson() {
+}
+
+void
+CtrlAgentHttpRequest::create() {
+    // The request parser doesn't validate the method name so it is
+    // compared without case as methodFromString does.
+    if (boost::iequals(context_->method_, "GET") &&
+        (context_->uri_ == METRICS_URI)) {
+        required_methods_.clear();
+        requireHttpMethod(Method::HTTP_GET);
+        required_headers_.clear();
+    }
+    PostHttpRequestJson::create();
+}
+
+void
+CtrlAgentHttpRequest::finalize() {
+    if (!created_) {
+        create();
+    }
+
+    // There is no body to parse in a GET request.
+    if (getMethod() == Method::HTTP_GET) {
+        finalized_ = true;
+        return;
+    }
+    PostHttpRequestJson::finalize();
+}
+
+void
+CtrlAgentHttpRequest::reset() {
+    PostHttpRequestJson::reset();
+    requirePost();
+}
+
+bool
+CtrlAgentHttpRequest::isMetricsRequest() const {
+    return (created_ && (method_ == Method::HTTP_GET) &&
+            (context_->uri_ == METRICS_URI));
+}
+
+void
+CtrlAgentHttpRequest::requirePost() {
+    required_methods_.clear();
+    requireHttpMethod(Method::HTTP_POST);
+    requireHeader("Content-Length");
+    requireHeaderValue("Content-Type", "application/json");
+}
+
+} // end of namespace isc::agent
+} // end of namespace isc
@@ -0,0 +1,72 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CTRL_AGENT_HTTP_REQUEST_H
+#define CTRL_AGENT_HTTP_REQUEST_H
+
+#include <http/post_request_json.h>
+#include <boost/shared_ptr.hpp>
+
+namespace isc {
+namespace agent {
+
+class CtrlAgentHttpRequest;
+
+/// @brief Pointer to the @ref CtrlAgentHttpRequest.
+typedef boost::shared_ptr<CtrlAgentHttpRequest> CtrlAgentHttpRequestPtr;
+
+/// @brief Pointer to the const @ref CtrlAgentHttpRequest.
+typedef boost::shared_ptr<const CtrlAgentHttpRequest> ConstCtrlAgentHttpRequestPtr;
+
+/// @brief HTTP request received by the Control Agent.
+///
+/// The commands are sent in POST requests with a JSON body, as described
+/// for the @ref isc::http::PostHttpRequestJson. In addition, a GET request
+/// without a body is accepted for the @ref METRICS_URI so the statistics
+/// of the servers can be scraped by Prometheus.
+class CtrlAgentHttpRequest : public http::PostHttpRequestJson {
+public:
+
+    /// @brief URI of the statistics in the Prometheus text format.
+    static const char* METRICS_URI;
+
+    /// @brief Constructor for inbound HTTP request.
+    CtrlAgentHttpRequest();
+
+    /// @brief Commits information held in the context into the request.
+    ///
+    /// The requirements of the POST requests are dropped for a GET
+    /// of the @ref METRICS_URI.
+    ///
+    /// @throw HttpRequestError if the parsed request doesn't meet the
+    /// requirements for it.
+    virtual void create();
+
+    /// @brief Completes parsing of the HTTP request.
+    ///
+    /// The body of a POST request is parsed as JSON.
+    virtual void finalize();
+
+    /// @brief Reset the state of the object.
+    ///
+    /// Restores the requirements of the POST requests.
+    virtual void reset();
+
+    /// @brief Checks if this is a request for the metrics.
+    ///
+    /// @return true if this is a GET of the @ref METRICS_URI.
+    bool isMetricsRequest() const;
+
+private:
+
+    /// @brief Sets the requirements of the POST requests.
+    void requirePost();
+};
+
+} // end of namespace isc::agent
+} // end of namespace isc
+
+#endif // CTRL_AGENT_HTTP_REQUEST_H
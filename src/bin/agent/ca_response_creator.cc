@@ -7,13 +7,17 @@
 #include <config.h>
 
 #include <agent/ca_command_mgr.h>
+#include <agent/ca_http_request.h>
 #include <agent/ca_response_creator.h>
+#include <cc/command_interpreter.h>
 #include <cc/data.h>
 #include <http/post_request_json.h>
 #include <http/response_json.h>
 #include <boost/pointer_cast.hpp>
 #include <iostream>
+#include <sstream>
 
+using namespace isc::config;
 using namespace isc::data;
 using namespace isc::http;
 
@@ -22,7 +26,7 @@ namespace agent {
 
 HttpRequestPtr
 CtrlAgentResponseCreator::createNewHttpRequest() const {
-    return (HttpRequestPtr(new PostHttpRequestJson()));
+    return (HttpRequestPtr(new CtrlAgentHttpRequest()));
 }
 
 HttpResponsePtr
@@ -38,6 +42,14 @@ HttpResponsePtr
 CtrlAgentResponseCreator::
 createStockHttpResponseInternal(const ConstHttpRequestPtr& request,
                                 const HttpStatusCode& status_code) const {
+    // This will generate the response holding JSON content.
+    HttpResponsePtr response(new HttpResponseJson(getHttpVersion(request),
+                                                  status_code));
+    return (response);
+}
+
+HttpVersion
+CtrlAgentResponseCreator::getHttpVersion(const ConstHttpRequestPtr& request) {
     // The request hasn't been finalized so the request object
     // doesn't contain any information about the HTTP version number
     // used. But, the context should have this data (assuming the
@@ -50,9 +62,7 @@ createStockHttpResponseInternal(const ConstHttpRequestPtr& request,
         http_version.major_ = 1;
         http_version.minor_ = 0;
     }
-    // This will generate the response holding JSON content.
-    HttpResponsePtr response(new HttpResponseJson(http_version, status_code));
-    return (response);
+    return (http_version);
 }
 
 HttpResponsePtr
@@ -71,6 +81,13 @@ createDynamicHttpResponse(const ConstHttpRequestPtr& request) {
         return (createStockHttpResponse(request, HttpStatusCode::INTERNAL_SERVER_ERROR));
     }
 
+    // The statistics are scraped with a GET of the metrics URI.
+    ConstCtrlAgentHttpRequestPtr request_ca = boost::dynamic_pointer_cast<
+        const CtrlAgentHttpRequest>(request);
+    if (request_ca && request_ca->isMetricsRequest()) {
+        return (createMetricsHttpResponse(request));
+    }
+
     // We have already checked that the request is finalized so the call
     // to getBodyAsJson must not trigger an exception.
     ConstElementPtr command = request_json->getBodyAsJson();
@@ -92,7 +109,59 @@ createDynamicHttpResponse(const ConstHttpRequestPtr& request) {
     return (http_response);
 }
 
+HttpResponsePtr
+CtrlAgentResponseCreator::
+createMetricsHttpResponse(const ConstHttpRequestPtr& request) {
+    // Each server is asked for its statistics with its own prefix as
+    // the DHCPv4 and DHCPv6 servers have statistics of the same names.
+    static const char* services[] = { "dhcp4", "dhcp6" };
+    std::ostringstream text;
+    bool found = false;
+    for (auto service : services) {
+        ElementPtr command = Element::createMap();
+        command->set(CONTROL_COMMAND,
+                     Element::create("statistic-get-all-prometheus"));
+        ElementPtr service_list = Element::createList();
+        service_list->add(Element::create(service));
+        command->set("service", service_list);
+        ElementPtr arguments = Element::createMap();
+        arguments->set("prefix",
+                       Element::create("kea_" + std::string(service) + "_"));
+        command->set(CONTROL_ARGUMENTS, arguments);
+
+        // A server which is not configured or not running is skipped.
+        ConstElementPtr answer =
+            CtrlAgentCommandMgr::instance().processCommand(command);
+        if (!answer || (answer->getType() != Element::list) ||
+            answer->empty()) {
+            continue;
+        }
+        try {
+            int rcode = CONTROL_RESULT_ERROR;
+            ConstElementPtr metrics = parseAnswer(rcode, answer->get(0));
+            if ((rcode == CONTROL_RESULT_SUCCESS) && metrics &&
+                (metrics->getType() == Element::string)) {
+                text << metrics->stringValue();
+                found = true;
+            }
+        } catch (const std::exception&) {
+            // Malformed answer: skip this server.
+        }
+    }
+
+    if (!found) {
+        return (createStockHttpResponse(request,
+                                        HttpStatusCode::SERVICE_UNAVAILABLE));
+    }
 
+    HttpResponsePtr response(new HttpResponse(getHttpVersion(request),
+                                              HttpStatusCode::OK));
+    response->context()->headers_.push_back(
+        HttpHeaderContext("Content-Type", "text/plain; version=0.0.4"));
+    response->context()->body_ = text.str();
+    response->finalize();
+    return (response);
+}
 
 } // end of namespace isc::agent
 } // end of namespace isc
@@ -27,22 +27,26 @@ typedef boost::shared_ptr<CtrlAgentResponseCreator> CtrlAgentResponseCreatorPtr;
 /// the libkea-http library to generate HTTP responses.
 ///
 /// This creator expects that received requests are encapsulated in the
-/// @ref isc::http::PostHttpRequestJson objects. The generated responses
+/// @ref CtrlAgentHttpRequest objects. The generated responses
 /// are encapsulated in the HttpResponseJson objects.
 ///
 /// This class uses @ref CtrlAgentCommandMgr singleton to process commands
 /// conveyed in the HTTP body. The JSON responses returned by the manager
 /// are placed in the body of the generated HTTP responses.
+///
+/// A GET request of the metrics URI is answered with the statistics of
+/// the DHCPv4 and DHCPv6 servers in the Prometheus text format, collected
+/// with the statistic-get-all-prometheus command.
 class CtrlAgentResponseCreator : public http::HttpResponseCreator {
 public:
 
     /// @brief Create a new request.
     ///
     /// This method creates a bare instance of the @ref
-    /// isc::http::PostHttpRequestJson.
+    /// CtrlAgentHttpRequest.
     ///
     /// @return Pointer to the new instance of the @ref
-    /// isc::http::PostHttpRequestJson.
+    /// CtrlAgentHttpRequest.
     virtual http::HttpRequestPtr createNewHttpRequest() const;
 
     /// @brief Creates stock HTTP response.
@@ -77,6 +81,25 @@ private:
     /// @return Pointer to an object representing HTTP response.
     virtual http::HttpResponsePtr
     createDynamicHttpResponse(const http::ConstHttpRequestPtr& request);
+
+    /// @brief Creates the HTTP response to a GET of the metrics.
+    ///
+    /// The statistics of each server are prefixed by "kea_dhcp4_" or
+    /// "kea_dhcp6_". The servers which are not available are skipped.
+    ///
+    /// @param request Pointer to an object representing HTTP request.
+    /// @return Pointer to a text/plain response, or to a stock Service
+    /// Unavailable response when no server answered.
+    http::HttpResponsePtr
+    createMetricsHttpResponse(const http::ConstHttpRequestPtr& request);
+
+    /// @brief Returns the HTTP version of the response to a request.
+    ///
+    /// @param request Pointer to an object representing HTTP request.
+    /// @return The version of the request if it is 1.0 or 1.1, 1.0
+    /// otherwise.
+    static http::HttpVersion
+    getHttpVersion(const http::ConstHttpRequestPtr& request);
 };
 
 } // end of namespace isc::agent
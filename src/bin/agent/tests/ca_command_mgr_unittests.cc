@@ -9,6 +9,7 @@
 #include <agent/ca_command_mgr.h>
 #include <agent/ca_controller.h>
 #include <agent/ca_process.h>
+#include <agent/ca_response_creator.h>
 #include <asiolink/asio_wrapper.h>
 #include <asiolink/interval_timer.h>
 #include <asiolink/io_service.h>
@@ -27,6 +28,7 @@
 using namespace isc::agent;
 using namespace isc::asiolink;
 using namespace isc::data;
+using namespace isc::http;
 using namespace isc::process;
 
 namespace {
@@ -413,4 +415,39 @@ TEST_F(CtrlAgentCommandMgrTest, forwardListCommands) {
     checkAnswer(answer, 3);
 }
 
+// Check that a GET of the metrics returns the statistics of the servers
+// in the Prometheus text format.
+TEST_F(CtrlAgentCommandMgrTest, metrics) {
+    // Only the DHCPv4 server is configured: the DHCPv6 one is skipped.
+    configureControlSocket("dhcp4");
+    bindServerSocket("{ \"result\": 0, \"text\": "
+                     "\"# TYPE kea_dhcp4_pkt4_received untyped\\n"
+                     "kea_dhcp4_pkt4_received 12\\n\" }", true);
+    std::thread th(boost::bind(&IOService::run, getIOService().get()));
+    server_socket_->waitForRunning();
+
+    CtrlAgentResponseCreator creator;
+    HttpRequestPtr request = creator.createNewHttpRequest();
+    request->context()->method_ = "GET";
+    request->context()->http_version_major_ = 1;
+    request->context()->http_version_minor_ = 1;
+    request->context()->uri_ = "/metrics";
+    ASSERT_NO_THROW(request->finalize());
+    HttpResponsePtr response = creator.createHttpResponse(request);
+
+    getIOService()->stop();
+    th.join();
+    server_socket_->stopServer();
+    getIOService()->get_io_service().reset();
+    getIOService()->poll();
+
+    ASSERT_TRUE(response);
+    std::string text = response->toString();
+    EXPECT_NE(std::string::npos, text.find("HTTP/1.1 200 OK")) << text;
+    EXPECT_NE(std::string::npos, text.find("Content-Type: text/plain")) << text;
+    EXPECT_NE(std::string::npos,
+              text.find("\r\n\r\n# TYPE kea_dhcp4_pkt4_received untyped\n"
+                        "kea_dhcp4_pkt4_received 12\n")) << text;
+}
+
 }
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <agent/ca_command_mgr.h>
+#include <agent/ca_http_request.h>
 #include <agent/ca_response_creator.h>
 #include <cc/command_interpreter.h>
 #include <http/post_request.h>
@@ -130,6 +131,48 @@ TEST_F(CtrlAgentResponseCreatorTest, createNewHttpRequest) {
     ASSERT_TRUE(request_json);
 }
 
+// This test verifies that a GET request is accepted for the metrics only.
+TEST_F(CtrlAgentResponseCreatorTest, metricsRequest) {
+    request_->context()->method_ = "GET";
+    request_->context()->http_version_major_ = 1;
+    request_->context()->http_version_minor_ = 1;
+    request_->context()->uri_ = "/metrics";
+    ASSERT_NO_THROW(request_->finalize());
+    CtrlAgentHttpRequestPtr request_ca = boost::dynamic_pointer_cast<
+        CtrlAgentHttpRequest>(request_);
+    ASSERT_TRUE(request_ca);
+    EXPECT_TRUE(request_ca->isMetricsRequest());
+
+    // No server is configured so there are no metrics to return.
+    HttpResponsePtr response;
+    ASSERT_NO_THROW(response = response_creator_.createHttpResponse(request_));
+    ASSERT_TRUE(response);
+    EXPECT_TRUE(response->toString().find("HTTP/1.1 503 Service Unavailable") !=
+                std::string::npos);
+
+    // A GET of another URI is rejected.
+    HttpRequestPtr request = response_creator_.createNewHttpRequest();
+    request->context()->method_ = "GET";
+    request->context()->http_version_major_ = 1;
+    request->context()->http_version_minor_ = 1;
+    request->context()->uri_ = "/foo";
+    EXPECT_THROW(request->finalize(), HttpRequestError);
+
+    // A POST of the metrics URI is still a command.
+    request = response_creator_.createNewHttpRequest();
+    setBasicContext(request);
+    request->context()->uri_ = "/metrics";
+    request->context()->body_ = "{ \"command\": \"foo\" }";
+    ASSERT_NO_THROW(request->finalize());
+    request_ca = boost::dynamic_pointer_cast<CtrlAgentHttpRequest>(request);
+    ASSERT_TRUE(request_ca);
+    EXPECT_FALSE(request_ca->isMetricsRequest());
+    ASSERT_NO_THROW(response = response_creator_.createHttpResponse(request));
+    ASSERT_TRUE(response);
+    EXPECT_TRUE(response->toString().find("\"result\": 0") !=
+                std::string::npos);
+}
+
 // Test that HTTP version of stock response is set to 1.0 if the request
 // context doesn't specify any version.
 TEST_F(CtrlAgentResponseCreatorTest, createStockHttpResponseNoVersion) {
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 68
-#define YY_END_OF_BUFFER 69
+#define YY_NUM_RULES 74
+#define YY_END_OF_BUFFER 75
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,55 +700,60 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[424] =
+static const flex_int16_t yy_accept[478] =
     {   0,
-       61,   61,    0,    0,    0,    0,    0,    0,    0,    0,
-       69,   67,   10,   11,   67,    1,   61,   58,   61,   61,
-       67,   60,   59,   67,   67,   67,   67,   67,   54,   55,
-       67,   67,   67,   56,   57,    5,    5,    5,   67,   67,
-       67,   10,   11,    0,    0,   50,    0,    0,    0,    0,
+       67,   67,    0,    0,    0,    0,    0,    0,    0,    0,
+       75,   73,   10,   11,   73,    1,   67,   64,   67,   67,
+       73,   66,   65,   73,   73,   73,   73,   73,   60,   61,
+       73,   73,   73,   62,   63,    5,    5,    5,   73,   73,
+       73,   10,   11,    0,    0,   56,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-       61,   61,    0,   60,   61,    3,    2,    6,    0,   61,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
-        0,   51,    0,    0,    0,    0,    0,    0,    0,    0,
+       67,   67,    0,   66,    3,    2,    6,    0,   67,    0,
+        0,    0,    0,    0,    0,    4,    0,    0,    9,   57,
+        0,    0,    0,    0,    0,    0,    0,    0,   59,    0,
 
-       53,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    2,    0,    0,    0,    0,
-        0,    0,    0,    8,    0,    0,    0,    0,    0,    0,
-        0,    0,   52,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       66,   64,    0,   63,   62,    0,    0,    0,    0,    0,
+        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
+       58,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       72,   70,    0,   69,   68,    0,    0,    0,    0,    0,
         0,   19,   18,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       65,   62,    0,    0,    0,    0,    0,    0,   20,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   44,    0,    0,    0,
-        0,   14,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   47,   48,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   40,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   71,   68,    0,    0,    0,    0,    0,    0,
+       20,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   47,
+        0,    0,    0,    0,   14,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   53,   54,    0,    0,    0,
+       44,    0,    0,    0,    0,    0,    0,    0,   40,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        7,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   42,    0,    0,
-
-       39,    0,    0,    0,   32,    0,    0,    0,    0,    0,
-        0,   36,    0,   22,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   37,   41,    0,    0,    0,   43,    0,
-        0,    0,    0,    0,    0,    0,   12,    0,    0,    0,
-        0,    0,    0,    0,   28,    0,   26,    0,    0,    0,
-        0,   46,    0,    0,    0,    0,    0,   30,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   29,    0,    0,    0,    0,   45,    0,    0,    0,
-        0,   13,   17,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   31,    0,   27,    0,    0,    0,    0,   35,
 
-       34,    0,    0,    0,   25,    0,   23,   16,    0,   24,
-       21,   49,    0,    0,    0,   33,    0,   38,    0,    0,
-        0,   15,    0
+        0,    0,    0,    0,    0,    0,   42,    0,    0,   39,
+        0,    0,    0,    0,   32,    0,    0,    0,    0,    0,
+        0,   36,    0,    0,    0,   22,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   37,   41,    0,    0,    0,
+       43,    0,    0,    0,    0,    0,    0,    0,    0,   12,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   28,
+        0,   26,    0,    0,    0,    0,    0,   52,    0,    0,
+        0,    0,    0,   30,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       29,    0,    0,    0,    0,    0,    0,   48,    0,    0,
+
+        0,    0,   13,   17,    0,    0,   50,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   31,    0,
+       27,    0,    0,    0,    0,    0,    0,   35,   34,    0,
+        0,    0,    0,    0,   25,    0,   23,   16,    0,    0,
+        0,   24,   21,   55,    0,    0,    0,    0,    0,    0,
+        0,   46,    0,   33,    0,   38,    0,    0,    0,    0,
+        0,    0,   45,    0,    0,    0,    0,    0,    0,   15,
+        0,    0,   51,    0,    0,   49,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -765,8 +770,8 @@ static const YY_CHAR yy_ec[256] =
        36,   37,   38,    5,   39,    5,   40,   41,   42,   43,
 
        44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,    5,   56,   57,   58,   59,   60,   61,   62,
-       63,   64,   65,    5,   66,    5,    5,    5,    5,    5,
+       54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
+       64,   65,   66,    5,   67,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -783,305 +788,423 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[67] =
+static const YY_CHAR yy_meta[68] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
-        5,    5,    5,    5,    5,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[435] =
+static const flex_int16_t yy_base[478] =
     {   0,
-        0,    0,   65,   68,   71,    0,   69,   73,   54,   70,
-      742,  743,   89,  738,  137,    0,  192,  743,  197,  200,
-       86,  212,  743,  720,   97,   74,   63,   69,  743,  743,
-       83,   68,   78,  743,  743,  743,  124,  726,  685,    0,
-      718,  128,  733,  212,  234,  743,  681,  687,  172,  679,
-      196,  196,  257,  681,  677,  187,  191,  676,  674,  684,
-      673,  686,   91,  666,  192,  680,  179,  255,  210,    0,
-      289,  305,  313,  320,  293,  743,    0,  743,  236,  250,
-      220,  244,  240,  245,  272,  266,  743,  681,  716,  743,
-      274,  743,  325,  668,  678,  296,  673,  308,  310,  712,
-
-        0,  371,  671,  202,  663,  674,  668,  656,  653,  655,
-      653,  698,  645,  661,  644,  653,  648,  645,  644,  645,
-      640,  298,  657,  650,  653,    0,  310,  318,  317,  311,
-      320,  328,  645,  743,    0,  637,  639,  322,  647,  686,
-      685,  684,  743,  403,  635,  636,  629,  629,  626,  640,
-      672,  625,  620,  622,  639,  667,  631,  295,  632,  664,
-      619,  615,  614,  627,  614,  625,  618,  621,  610,  329,
-      743,  743,  332,  743,  743,  606,    0,  608,  364,  657,
-      614,  743,  743,  435,  605,  616,  603,  647,  611,  599,
-      598,  607,  613,  599,  608,  597,  605,  600,  603,  640,
-
-      344,  586,  600,  637,  586,  597,  584,  595,  627,  626,
-      743,  743,  593,    0,  581,  628,  627,  589,  743,  578,
-      467,  582,  576,  574,  584,  575,  567,  580,  617,  566,
-      581,  577,  579,  562,  553,  560,  743,  561,  558,  555,
-      556,  743,  554,  552,  561,  550,  557,  564,  561,    0,
-      553,  743,  743,  550,  556,  543,  542,  548,  544,  553,
-      585,  539,  743,  551,  541,  536,  539,  533,  545,  582,
-      531,  532,  204,  532,  540,  577,  524,  570,  536,  525,
-      743,  567,  520,  570,  528,  568,  562,  520,  511,  529,
-      509,  557,  523,  522,  521,  558,  557,  743,  510,  503,
-
-      743,  506,  553,  547,  743,  494,  324,  493,  502,  514,
-      547,  743,  500,  743,  494,  510,  505,  500,  503,  503,
-      533,  469,  518,  743,  743,  479,  452,  450,  743,  461,
-      497,  462,  438,  443,  441,  452,  743,  491,  442,  447,
-      443,  429,  430,  442,  743,  427,  743,  416,  431,  414,
-      428,  743,  418,  414,  462,  423,  422,  743,  423,  411,
-      457,  405,  249,  402,  448,  447,  398,  394,  388,  396,
-      395,  743,  376,  384,  386,  378,  743,  428,  375,  426,
-      374,  743,  743,  379,  369,  365,  415,  414,  352,  351,
-      364,  401,  743,  358,  743,  399,  398,  350,  396,  743,
-
-      743,  395,  394,  340,  743,  339,  743,  743,  333,  743,
-      743,  743,  368,  316,  353,  743,  302,  743,  288,  201,
-      241,  743,  743,  512,  517,  522,  527,  532,  537,  540,
-      216,  130,  115,   87
+       68,    1,  135,    1,  197,    1,  199,    1,  210,    1,
+      217,    1,  216,  216,  264,  331,  213,    1,  237,  246,
+      224,    1,    1,  201,  390,  203,  199,  368,    1,    1,
+      196,  179,  183,    1,    1,    1,    1,  231,  193,  419,
+      229,    1,    1,  486,  531,    1,  195,  207,  529,  201,
+      380,  532,  591,  351,  280,  364,  359,  357,  359,  371,
+      362,  378,  521,  359,  619,  520,  513,  510,  511,    1,
+        1,    1,    1,    1,    1,  670,    1,  561,    1,  710,
+      711,  705,  526,  609,  601,    1,  620,  657,    1,    1,
+      735,  611,  623,  712,  620,  712,  713,  744,    1,  804,
+
+      621,  604,  617,  696,  710,  706,  695,  694,  698,  698,
+      747,  695,  714,  700,  712,  712,  711,  712,  716,  715,
+      714,  735,  736,  731,  738,  750,  758,  768,  726,  736,
+      746,  740,    1,  817,  739,  744,  771,  756,  805,  807,
+        1,  849,  760,  762,  764,  758,  763,  762,  779,  823,
+      777,  774,  778,  810,  840,  806,  795,  810,  844,  811,
+      808,  809,  825,  832,  820,  834,  829,  834,  824,  857,
+        1,    1,  839,    1,    1,  824,  881,  828,  884,  880,
+      839,    1,    1,  913,  831,  856,  865,  853,  900,  866,
+      855,  856,  872,  875,  863,  888,  864,  874,  872,  888,
+
+      927,  895,  882,  899,  938,  934,  889,  903,  891,  905,
+      940,  941,    1,    1,  916,  946,  909,  958,  959,  923,
+        1,  920,  978,  926,  969,  923,  923,  935,  954,  920,
+      937,  976,  926,  944,  942,  955,  939,  941,  950,    1,
+      954,  952,  951,  954,    1,  961,  955,  955,  967,  957,
+      967,  982,  981, 1013,  979,    1,    1,  978,  986,  974,
+        1,  986,  982,  992,  990, 1001, 1035,  990,    1, 1005,
+     1007,  992,  999,  994, 1016, 1055, 1005, 1009, 1058, 1012,
+     1018, 1023, 1062, 1010, 1059, 1027, 1018,    1, 1062, 1016,
+     1069, 1070, 1030, 1018, 1074, 1070, 1030, 1022, 1043, 1024,
+
+     1075, 1043, 1044, 1045, 1084, 1086,    1, 1041, 1035,    1,
+     1041, 1090, 1046, 1088,    1, 1089, 1048, 1038, 1050, 1065,
+     1100,    1, 1056, 1065, 1066,    1, 1053, 1072, 1069, 1066,
+     1071, 1073, 1113, 1062, 1115,    1,    1, 1082, 1069, 1070,
+        1, 1078, 1084, 1122, 1089, 1066, 1073, 1073, 1087,    1,
+     1128, 1129, 1076, 1083, 1090, 1091, 1081, 1084, 1100,    1,
+     1086,    1, 1086, 1105, 1089, 1090, 1107,    1, 1099, 1097,
+     1148, 1111, 1112,    1, 1113, 1115, 1118, 1108, 1156, 1105,
+     1154, 1113, 1161, 1162, 1115, 1122, 1165, 1119, 1129, 1130,
+        1, 1131, 1124, 1127, 1168, 1170, 1122,    1, 1176, 1124,
+
+     1178, 1127,    1,    1, 1136, 1134,    1, 1141, 1147, 1133,
+     1186, 1187, 1136, 1137, 1143, 1140, 1155, 1194,    1, 1153,
+        1, 1196, 1197, 1151, 1152, 1195, 1201,    1,    1, 1202,
+     1204, 1205, 1165, 1155,    1, 1163,    1,    1, 1158, 1158,
+     1166,    1,    1,    1, 1215, 1216, 1217, 1180, 1219, 1182,
+     1183,    1, 1184,    1, 1175,    1, 1176, 1173, 1226, 1228,
+     1175, 1179,    1, 1179, 1199, 1200, 1235, 1191, 1197,    1,
+     1238, 1201,    1, 1188, 1241,    1,    1
     } ;
 
-static const flex_int16_t yy_def[435] =
+static const flex_int16_t yy_def[478] =
     {   0,
-      423,    1,  424,  424,    1,    5,    5,    5,    5,    5,
-      423,  423,  423,  423,  423,  425,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  426,
-      423,  423,  423,  427,   15,  423,   45,   45,   45,   45,
-       45,   45,  428,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  425,
-      423,  423,  423,  423,  423,  423,  429,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  426,  423,
-      427,  423,  423,   45,   45,   45,   45,   45,   45,  430,
-
-       45,  428,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  429,  423,  423,  423,  423,
-      423,  423,  423,  423,  431,   45,   45,   45,   45,   45,
-       45,  430,  423,  428,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  423,
-      423,  423,  423,  423,  423,  423,  432,   45,   45,   45,
-       45,  423,  423,  428,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      423,  423,  423,  433,   45,   45,   45,   45,  423,   45,
-      428,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,  423,   45,   45,   45,
-       45,  423,   45,   45,   45,   45,   45,   45,  423,  434,
-       45,  423,  423,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,  423,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      423,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  423,   45,   45,
-
-      423,   45,   45,   45,  423,   45,   45,   45,   45,   45,
-       45,  423,   45,  423,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,  423,  423,   45,   45,   45,  423,   45,
-       45,   45,   45,   45,   45,   45,  423,   45,   45,   45,
-       45,   45,   45,   45,  423,   45,  423,   45,   45,   45,
-       45,  423,   45,   45,   45,   45,   45,  423,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,  423,   45,   45,   45,   45,  423,   45,   45,   45,
-       45,  423,  423,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,  423,   45,  423,   45,   45,   45,   45,  423,
-
-      423,   45,   45,   45,  423,   45,  423,  423,   45,  423,
-      423,  423,   45,   45,   45,  423,   45,  423,   45,   45,
-       45,  423,    0,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423
+      477,    1,  477,    3,    2,    5,    6,    7,    8,    9,
+      477,  477,  477,  477,  477,  477,  477,  477,   17,   19,
+      477,   19,  477,  477,  477,  477,  477,  477,  477,  477,
+       26,   27,   28,  477,  477,  477,   13,  477,  477,  477,
+      477,   37,   14,  477,   15,  477,   45,   45,   45,   47,
+       45,   45,  477,   45,   50,   45,   55,   55,   45,   45,
+       58,   45,   62,   45,   62,   62,   61,   51,   52,   16,
+       20,   17,   25,   22,  477,  477,  477,   73,   78,  477,
+      477,  477,   80,   81,   82,  477,  477,   40,  477,  477,
+      477,   45,   45,   61,   45,   59,   96,   53,   45,   98,
+
+       99,   99,   99,   99,   99,  101,   99,   99,   99,  107,
+       99,  102,  106,   99,   99,  109,   99,  117,  116,  118,
+       99,  121,   99,   99,   99,  477,  477,  477,  126,  127,
+      128,  477,  477,  477,  120,   99,  104,  113,   99,  139,
+      477,  100,   99,  104,  115,  135,  110,  108,  125,  111,
+      147,   99,  146,   99,  150,  138,  151,  149,  155,  136,
+      153,  161,  158,  163,  119,  164,   99,  156,  165,  477,
+      477,  477,  170,  477,  477,  477,  477,  169,   99,  140,
+      124,  477,  477,  142,  178,  123,  166,  185,  159,  168,
+      151,  191,  192,  154,  144,  195,  195,  187,  181,  198,
+
+      180,  160,  148,  200,  201,  189,  188,  204,  207,  208,
+      206,  211,  477,  477,  477,  477,  143,  205,  218,  196,
+      477,  197,  184,  199,  219,  222,  217,  220,  228,  162,
+      210,  219,  209,  194,  228,  234,  233,  237,  237,  477,
+      227,  239,  230,  242,  477,  229,  192,  243,  224,  248,
+      250,  186,  477,  477,  246,  477,  477,  226,  190,  250,
+      477,  241,  260,  255,  241,  231,  212,  244,  477,  235,
+      270,  268,  271,  247,  266,  232,  272,  265,  276,  258,
+      249,  275,  276,  263,  267,  282,  278,  477,  285,  274,
+      283,  291,  292,  293,  291,  289,  273,  293,  298,  298,
+
+      296,  286,  302,  303,  295,  305,  477,  297,  284,  477,
+      287,  306,  308,  301,  477,  314,  309,  316,  280,  319,
+      312,  477,  313,  304,  324,  477,  290,  320,  325,  281,
+      329,  270,  321,  327,  333,  477,  477,  328,  311,  339,
+      477,  330,  332,  335,  338,  318,  334,  309,  348,  477,
+      344,  351,  294,  339,  342,  355,  348,  352,  343,  477,
+      347,  477,  357,  363,  363,  365,  359,  477,  323,  340,
+      351,  331,  372,  477,  373,  373,  364,  319,  371,  361,
+      380,  378,  379,  383,  354,  355,  384,  382,  376,  389,
+      477,  390,  388,  356,  394,  395,  380,  477,  384,  366,
+
+      399,  397,  477,  477,  394,  385,  477,  386,  367,  402,
+      401,  411,  400,  413,  406,  410,  390,  412,  477,  408,
+      477,  418,  422,  393,  424,  395,  423,  477,  477,  427,
+      430,  431,  420,  414,  477,  369,  477,  477,  416,  434,
+      436,  477,  477,  477,  431,  445,  445,  417,  447,  448,
+      450,  477,  451,  477,  415,  477,  455,  439,  449,  459,
+      460,  458,  477,  440,  464,  465,  459,  405,  468,  477,
+      467,  453,  477,  462,  471,  477,    0
     } ;
 
-static const flex_int16_t yy_nxt[810] =
+static const flex_int16_t yy_nxt[1309] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
-       12,   12,   12,   12,   25,   26,   12,   12,   27,   12,
-       12,   12,   12,   28,   12,   29,   12,   30,   12,   12,
-       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
-       12,   12,   32,   12,   12,   12,   12,   33,   12,   12,
-       12,   12,   12,   12,   34,   35,   37,   14,   37,   37,
-       14,   37,   38,   41,   40,   38,   12,   12,   40,   12,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   41,
-       42,   91,   42,   76,   81,   12,   12,   82,   77,   12,
-
-       83,   12,   82,   81,   12,   79,   12,   79,   12,   83,
-       80,   80,   80,   81,   12,   12,   12,   12,   39,  250,
-       12,   82,   84,   12,   83,   42,   85,   42,   12,   42,
-      116,   42,  117,   86,  214,   12,   12,   44,   44,   44,
-       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
-       48,   45,   45,   49,   50,   45,   45,   45,   45,   45,
-       51,   52,   45,   53,   45,   45,   54,   45,   55,   56,
-       45,   57,   45,   58,   59,   49,   60,   61,   62,   63,
-       64,   65,   66,   67,   68,   69,   45,   45,   45,   45,
-
-       45,   45,   45,   71,   96,   72,   72,   72,   71,  301,
-       74,   74,   74,   75,   75,   75,   73,   92,   98,   99,
-      177,   73,  122,   71,   73,   74,   74,   74,   96,  105,
-      106,  119,  123,   99,  107,   73,   73,   98,   99,  108,
-       73,  109,  302,   73,  110,  120,  422,  127,   93,   80,
-       80,   80,   99,  146,  147,   73,   45,   45,  421,  379,
-       45,   45,  101,   80,   80,   80,  125,   45,   45,   45,
-      127,  128,  127,   45,  129,   45,   45,   98,   45,   92,
+       11,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,   12,   13,
+       14,   13,   12,   15,   16,   12,   17,   18,   19,   20,
+       21,   22,   22,   22,   23,   24,   12,   12,   12,   12,
+       12,   12,   25,   26,   12,   12,   27,   12,   12,   12,
+
+       12,   28,   12,   29,   12,   30,   12,   12,   12,   12,
+       12,   25,   31,   12,   12,   12,   12,   12,   12,   12,
+       32,   12,   12,   12,   12,   12,   33,   12,   12,   12,
+       12,   12,   12,   34,   35,   36,   37,   14,   37,   36,
+       36,   36,   38,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   12,   12,   40,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,  477,   42,   43,   42,
+       77,   12,   12,   80,   71,   12,   72,   72,   72,   41,
+       12,   75,   12,   81,   12,   83,   76,   73,   84,   85,
+       12,   12,   80,   86,   39,   87,   12,   89,   92,   12,
+       74,   74,   74,   93,   95,   12,   73,  477,   81,   71,
+       71,   71,   12,   12,   44,   44,   44,   45,   45,   46,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  128,  130,   98,   45,  129,  128,
-
-      129,   45,   75,   75,   75,  380,   75,   75,   75,   45,
-       93,  124,   45,   73,   45,  102,   71,   73,   72,   72,
-       72,   79,  131,   79,  132,  138,   80,   80,   80,   73,
-       91,   71,   73,   74,   74,   74,   73,   91,  140,  165,
-      141,  172,  170,  170,   73,  171,  420,  171,   73,  138,
-      180,  198,  172,  211,  199,  419,  211,  166,  418,  417,
-      172,   91,  140,   73,  141,   91,  170,  173,  171,   91,
-      174,  175,  211,  416,  180,  212,  332,   91,  216,  217,
-       91,  333,   91,  135,  144,  144,  144,  218,  238,  415,
-      414,  144,  144,  144,  144,  144,  144,  413,  239,  412,
-
-      411,  410,  409,  408,  407,  406,  405,  404,  403,  402,
-      144,  144,  144,  144,  144,  144,  184,  184,  184,  401,
-      400,  399,  398,  184,  184,  184,  184,  184,  184,  397,
-      396,  395,  394,  393,  392,  391,  390,  389,  388,  387,
-      386,  385,  184,  184,  184,  184,  184,  184,  221,  221,
-      221,  384,  383,  382,  381,  221,  221,  221,  221,  221,
-      221,  378,  377,  376,  375,  374,  373,  372,  371,  370,
-      369,  368,  367,  366,  221,  221,  221,  221,  221,  221,
-       45,   45,   45,  365,  364,  363,  362,   45,   45,   45,
-       45,   45,   45,  361,  360,  359,  358,  357,  356,  355,
-
-      354,  353,  352,  351,  350,  349,   45,   45,   45,   45,
-       45,   45,   36,   36,   36,   36,   36,   70,  348,   70,
-       70,   70,   89,  347,   89,  346,   89,   91,   91,   91,
-       91,   91,  100,  100,  100,  100,  100,  126,  345,  126,
-      126,  126,  142,  142,  142,  344,  343,  342,  341,  340,
-      339,  338,  337,  336,  335,  334,  331,  330,  329,  328,
-      327,  326,  325,  324,  323,  322,  321,  320,  319,  318,
-      317,  316,  315,  314,  313,  312,  311,  310,  309,  308,
-      307,  306,  305,  304,  303,  300,  299,  298,  297,  296,
-      295,  294,  293,  292,  291,  290,  289,  288,  287,  286,
-
-      285,  284,  283,  282,  281,  280,  279,  278,  277,  276,
-      275,  274,  273,  272,  271,  270,  269,  268,  267,  266,
-      265,  264,  263,  262,  261,  260,  259,  258,  257,  256,
-      255,  254,  253,  252,  251,  249,  248,  247,  246,  245,
-      244,  243,  242,  241,  240,  237,  236,  235,  234,  233,
-      232,  231,  230,  229,  228,  227,  226,  225,  224,  223,
-      222,  220,  219,  215,  213,  210,  209,  208,  207,  206,
-      205,  204,  203,  202,  201,  200,  197,  196,  195,  194,
-      193,  192,  191,  190,  189,  188,  187,  186,  185,  143,
-      183,  182,  181,  179,  178,  176,  169,  168,  167,  164,
-
-      163,  162,  161,  160,  159,  158,  157,  156,  155,  154,
-      153,  152,  151,  150,  149,  148,  145,  143,  139,  137,
-      136,  134,  133,  121,  118,  115,  114,  113,  112,  111,
-      104,  103,   97,   95,   94,   43,   90,   88,   87,   78,
-       43,  423,   11,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-
-      423,  423,  423,  423,  423,  423,  423,  423,  423
+       45,   45,   45,   45,   45,   45,   47,   48,   45,   45,
+       49,   50,   45,   45,   45,   45,   45,   51,   52,   45,
+
+       53,   45,   45,   54,   45,   55,   56,   45,   57,   45,
+       58,   59,   49,   60,   61,   62,   63,   64,   65,   45,
+       66,   67,   68,   69,   45,   45,   45,   45,   45,   45,
+       45,   70,   70,  103,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   78,   82,
+
+       78,  101,   96,   79,   79,   79,  104,  105,  102,  108,
+      110,  106,  109,  111,  112,  113,  107,  114,  117,   88,
+       88,   96,   88,   88,   82,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   44,   44,   44,   44,
+       44,   90,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   91,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,   45,   97,  122,   45,   45,  120,
+      115,   94,  116,  121,   45,   45,  123,  124,  125,  477,
+       45,  477,   45,   45,   97,   45,  129,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   94,   45,   45,   45,
+       45,   98,   98,   98,   98,   98,   99,   98,   98,   98,
+
+       98,   98,   98,   45,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   45,   98,   98,
+       98,   45,   98,   98,   98,   45,   98,   98,   98,   98,
+       98,   98,   98,   45,   98,   98,   98,   45,   98,   45,
+      100,   98,   98,   98,   98,   98,   98,   98,  118,  130,
+      131,  132,  133,  135,  136,  138,  143,  144,  145,  146,
+       76,   76,  119,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,  126,  127,  128,
+       44,  137,  139,  140,  477,  477,  477,   44,  147,  141,
+      148,  149,  150,  151,  152,  153,   98,  154,  155,  156,
+      126,  127,  157,  158,  128,  137,  139,  140,  159,  160,
+      161,   44,  162,  163,  164,   44,  165,  167,  168,   44,
+       98,  169,  170,  173,   98,  171,  174,   44,   98,  175,
+      176,   44,  172,   44,  134,  166,   98,  178,  179,  180,
+
+       98,  181,   98,   98,   98,   98,   98,  170,  171,   98,
+      182,  172,  183,  185,  186,  187,  188,  142,  142,  142,
+      189,  190,  191,  180,  142,  142,  142,  142,  142,  142,
+      177,  177,  177,  192,  193,  194,  195,  177,  177,  177,
+      177,  177,  177,  142,  142,  142,  142,  142,  142,  196,
+      197,  198,  199,  201,  202,  200,  177,  177,  177,  177,
+      177,  177,  184,  184,  184,  203,  204,  205,  206,  184,
+      184,  184,  184,  184,  184,  207,  208,  209,  210,  211,
+      212,  213,  214,  215,  217,  221,  222,  224,  184,  184,
+      184,  184,  184,  184,  216,  216,  216,  225,  218,  219,
+
+      213,  216,  216,  216,  216,  216,  216,  220,  226,  227,
+      228,  229,  230,  231,  233,  234,  236,  237,  232,  238,
+      216,  216,  216,  216,  216,  216,  223,  223,  223,   45,
+      235,  239,  240,  223,  223,  223,  223,  223,  223,  241,
+       45,  243,  244,  245,  246,  247,  248,  249,  250,  242,
+      251,  252,  223,  223,  223,  223,  223,  223,  253,  254,
+      254,  254,  255,  256,  257,  258,  254,  254,  254,  254,
+      254,  254,  259,  260,  261,  263,  264,  265,  267,  262,
+      268,  269,  270,  271,  272,  254,  254,  254,  254,  254,
+      254,   45,   45,   45,  273,  274,   45,   45,   45,   45,
+
+       45,   45,   45,   45,  266,  275,  276,  277,  278,  279,
+      280,  281,  282,  283,  284,  285,  286,   45,   45,   45,
+       45,   45,   45,  287,  288,   45,   44,   44,   44,  289,
+      290,  291,  292,   44,   44,   44,   44,   44,   44,  293,
+      295,  294,  296,  297,  298,  299,  300,  301,  303,   45,
+      304,  305,   44,   44,   44,   44,   44,   44,  302,  306,
+      307,  308,  309,  310,  312,  313,  314,  315,  316,  317,
+      318,  319,  320,  321,  322,   46,   45,  325,   45,  326,
+      327,  328,  329,  330,  331,  332,  333,  334,  335,  336,
+      324,  337,  338,  339,  340,  341,  311,  342,  343,   45,
+
+      345,  347,  348,   45,  349,  350,  346,  351,  352,  353,
+      354,  355,  356,  357,  358,  359,  323,   45,  360,  361,
+      362,  363,  364,   45,  365,  366,  367,  368,  369,  370,
+      371,  372,  373,  374,   46,  376,  377,  378,   45,  380,
+      381,  379,  382,  383,  384,   45,  385,  386,  387,  388,
+      389,  390,  344,  391,  392,  393,   45,  394,  395,  396,
+      397,  398,  399,   45,  400,  402,  403,  404,  405,  406,
+      407,  410,  411,  412,   45,  408,  414,  415,  416,  418,
+       45,  419,  420,  421,  422,  375,  423,  424,  425,  426,
+      427,  428,  429,  413,  430,  431,  432,  433,  434,  435,
+
+      436,  437,  438,  439,  440,  441,  442,  443,  409,  444,
+       46,  401,  446,  447,  448,  449,  450,  451,   45,  417,
+      452,   46,  454,  455,  456,  457,  458,  459,  460,   45,
+      462,  463,  461,   46,   45,  465,  466,  467,  468,  469,
+      470,  471,  472,  473,  474,  475,  476,   45,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,   45,  477,  477,
+      477,  477,  477,  477,  477,  477,  445,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      453,  477,  477,  477,  477,  477,  477,  464,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+
+      477,  477,  477,  477,  477,  477,  477,  477
     } ;
 
-static const flex_int16_t yy_chk[810] =
+static const flex_int16_t yy_chk[1309] =
     {   0,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    3,    3,    3,    4,
-        4,    4,    3,    9,    7,    4,    5,    5,    8,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,   10,
-       13,  434,   13,   21,   26,    5,    5,   27,   21,    5,
-
-       28,    9,   32,   31,    5,   25,    5,   25,    5,   33,
-       25,   25,   25,   26,    5,    5,    7,   10,    5,  433,
-        8,   27,   31,    5,   28,   37,   32,   37,    5,   42,
-       63,   42,   63,   33,  432,    5,    5,   15,   15,   15,
+        1,    1,    1,    1,    1,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    5,    5,    7,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    9,   11,   13,   14,   13,
+       24,    5,    5,   26,   17,    5,   17,   17,   17,    9,
+        5,   21,    5,   27,    5,   31,   21,   17,   32,   33,
+        5,    5,   26,   38,    5,   39,    7,   41,   47,    5,
+       19,   19,   19,   48,   50,    5,   17,   20,   27,   20,
+       20,   20,    5,    5,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   17,   49,   17,   17,   17,   19,  273,
-       19,   19,   19,   20,   20,   20,   17,   44,   51,   52,
-      431,   19,   67,   22,   20,   22,   22,   22,   49,   56,
-       56,   65,   67,   69,   56,   17,   22,   51,   52,   56,
-       19,   57,  273,   20,   57,   65,  421,   81,   44,   79,
-       79,   79,   69,  104,  104,   22,   45,   45,  420,  363,
-       45,   45,   53,   80,   80,   80,   69,   45,   45,   53,
-       81,   82,   84,   45,   83,   45,   45,   68,   45,   91,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   53,   82,   84,   68,   53,   83,   85,
-
-       86,   53,   71,   71,   71,  363,   75,   75,   75,   53,
-       91,   68,   53,   71,   53,   53,   72,   75,   72,   72,
-       72,   73,   85,   73,   86,   96,   73,   73,   73,   72,
-       93,   74,   71,   74,   74,   74,   75,   93,   98,  122,
-       99,  129,  127,  130,   74,  128,  419,  131,   72,   96,
-      138,  158,  132,  170,  158,  417,  173,  122,  415,  414,
-      129,   93,   98,   74,   99,   93,  127,  130,  128,   93,
-      131,  132,  170,  413,  138,  173,  307,   93,  179,  179,
-       93,  307,   93,   93,  102,  102,  102,  179,  201,  409,
-      406,  102,  102,  102,  102,  102,  102,  404,  201,  403,
-
-      402,  399,  398,  397,  396,  394,  392,  391,  390,  389,
-      102,  102,  102,  102,  102,  102,  144,  144,  144,  388,
-      387,  386,  385,  144,  144,  144,  144,  144,  144,  384,
-      381,  380,  379,  378,  376,  375,  374,  373,  371,  370,
-      369,  368,  144,  144,  144,  144,  144,  144,  184,  184,
-      184,  367,  366,  365,  364,  184,  184,  184,  184,  184,
-      184,  362,  361,  360,  359,  357,  356,  355,  354,  353,
-      351,  350,  349,  348,  184,  184,  184,  184,  184,  184,
-      221,  221,  221,  346,  344,  343,  342,  221,  221,  221,
-      221,  221,  221,  341,  340,  339,  338,  336,  335,  334,
-
-      333,  332,  331,  330,  328,  327,  221,  221,  221,  221,
-      221,  221,  424,  424,  424,  424,  424,  425,  326,  425,
-      425,  425,  426,  323,  426,  322,  426,  427,  427,  427,
-      427,  427,  428,  428,  428,  428,  428,  429,  321,  429,
-      429,  429,  430,  430,  430,  320,  319,  318,  317,  316,
-      315,  313,  311,  310,  309,  308,  306,  304,  303,  302,
-      300,  299,  297,  296,  295,  294,  293,  292,  291,  290,
-      289,  288,  287,  286,  285,  284,  283,  282,  280,  279,
-      278,  277,  276,  275,  274,  272,  271,  270,  269,  268,
-      267,  266,  265,  264,  262,  261,  260,  259,  258,  257,
-
-      256,  255,  254,  251,  249,  248,  247,  246,  245,  244,
-      243,  241,  240,  239,  238,  236,  235,  234,  233,  232,
-      231,  230,  229,  228,  227,  226,  225,  224,  223,  222,
-      220,  218,  217,  216,  215,  213,  210,  209,  208,  207,
-      206,  205,  204,  203,  202,  200,  199,  198,  197,  196,
-      195,  194,  193,  192,  191,  190,  189,  188,  187,  186,
-      185,  181,  180,  178,  176,  169,  168,  167,  166,  165,
-      164,  163,  162,  161,  160,  159,  157,  156,  155,  154,
-      153,  152,  151,  150,  149,  148,  147,  146,  145,  142,
-      141,  140,  139,  137,  136,  133,  125,  124,  123,  121,
-
-      120,  119,  118,  117,  116,  115,  114,  113,  112,  111,
-      110,  109,  108,  107,  106,  105,  103,  100,   97,   95,
-       94,   89,   88,   66,   64,   62,   61,   60,   59,   58,
-       55,   54,   50,   48,   47,   43,   41,   39,   38,   24,
-       14,   11,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-      423,  423,  423,  423,  423,  423,  423,  423,  423,  423,
-
-      423,  423,  423,  423,  423,  423,  423,  423,  423
+       15,   16,   16,   55,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   25,   28,
+
+       25,   54,   51,   25,   25,   25,   56,   56,   54,   57,
+       58,   56,   57,   59,   60,   61,   56,   62,   64,   40,
+       40,   51,   40,   40,   28,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,   45,   52,   67,   45,   45,   66,
+       63,   49,   63,   66,   45,   45,   67,   68,   69,   78,
+       45,   78,   45,   45,   52,   45,   83,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   49,   45,   45,   45,
+       45,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   65,   84,
+       85,   87,   88,   92,   93,   95,  101,  102,  103,  103,
+       76,   76,   65,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   80,   81,   82,
+       91,   94,   96,   97,   98,   98,   98,   91,  104,   98,
+      105,  106,  107,  108,  109,  110,   98,  111,  112,  113,
+       80,   81,  114,  115,   82,   94,   96,   97,  116,  117,
+      118,   91,  119,  120,  121,   91,  122,  123,  124,   91,
+       98,  125,  126,  129,   98,  127,  130,   91,   98,  131,
+      132,   91,  128,   91,   91,  122,   98,  135,  136,  137,
+
+       98,  138,   98,   98,  100,  100,  100,  126,  127,  100,
+      139,  128,  140,  143,  144,  145,  146,  100,  100,  100,
+      147,  148,  149,  137,  100,  100,  100,  100,  100,  100,
+      134,  134,  134,  150,  151,  152,  153,  134,  134,  134,
+      134,  134,  134,  100,  100,  100,  100,  100,  100,  154,
+      155,  156,  157,  158,  159,  157,  134,  134,  134,  134,
+      134,  134,  142,  142,  142,  160,  161,  162,  163,  142,
+      142,  142,  142,  142,  142,  164,  165,  166,  167,  168,
+      169,  170,  173,  176,  178,  180,  181,  185,  142,  142,
+      142,  142,  142,  142,  177,  177,  177,  186,  179,  179,
+
+      170,  177,  177,  177,  177,  177,  177,  179,  187,  188,
+      189,  190,  191,  192,  194,  195,  197,  198,  193,  199,
+      177,  177,  177,  177,  177,  177,  184,  184,  184,  193,
+      196,  200,  201,  184,  184,  184,  184,  184,  184,  202,
+      196,  203,  204,  205,  206,  207,  208,  209,  210,  202,
+      211,  212,  184,  184,  184,  184,  184,  184,  215,  216,
+      216,  216,  217,  218,  219,  220,  216,  216,  216,  216,
+      216,  216,  222,  224,  225,  226,  227,  228,  230,  225,
+      231,  232,  233,  234,  235,  216,  216,  216,  216,  216,
+      216,  223,  223,  223,  236,  237,  229,  238,  223,  223,
+
+      223,  223,  223,  223,  229,  238,  239,  241,  242,  243,
+      244,  246,  247,  248,  249,  250,  251,  223,  223,  223,
+      223,  223,  223,  252,  253,  251,  254,  254,  254,  255,
+      258,  259,  260,  254,  254,  254,  254,  254,  254,  262,
+      263,  262,  264,  265,  266,  267,  268,  270,  272,  271,
+      273,  274,  254,  254,  254,  254,  254,  254,  271,  275,
+      276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
+      286,  287,  289,  290,  291,  292,  293,  294,  294,  295,
+      296,  297,  298,  299,  300,  301,  302,  303,  304,  305,
+      293,  306,  308,  309,  311,  312,  279,  313,  314,  316,
+
+      317,  318,  319,  299,  320,  321,  317,  323,  324,  325,
+      327,  328,  329,  330,  331,  332,  292,  320,  333,  334,
+      335,  338,  339,  340,  340,  342,  343,  344,  345,  346,
+      347,  348,  349,  351,  352,  353,  354,  355,  356,  357,
+      358,  356,  359,  361,  363,  349,  364,  365,  366,  367,
+      369,  370,  316,  371,  372,  373,  375,  375,  376,  377,
+      378,  379,  380,  364,  381,  382,  383,  384,  385,  386,
+      387,  388,  389,  390,  392,  387,  393,  394,  395,  397,
+      396,  399,  400,  401,  402,  352,  405,  406,  408,  409,
+      410,  411,  412,  392,  413,  414,  415,  416,  417,  418,
+
+      420,  422,  423,  424,  425,  426,  427,  430,  387,  431,
+      432,  381,  433,  434,  436,  439,  440,  441,  395,  396,
+      445,  446,  447,  448,  449,  450,  451,  453,  455,  457,
+      458,  459,  457,  460,  461,  461,  462,  464,  465,  466,
+      467,  468,  469,  471,  472,  474,  475,  469,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  465,  477,  477,
+      477,  477,  477,  477,  477,  477,  432,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      446,  477,  477,  477,  477,  477,  477,  460,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+
+      477,  477,  477,  477,  477,  477,  477,  477
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1090,15 +1213,16 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[68] =
+static const flex_int16_t yy_rule_linenum[74] =
     {   0,
-      133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
-      170,  176,  185,  196,  207,  216,  225,  234,  244,  254,
-      264,  281,  298,  307,  316,  326,  336,  346,  357,  366,
-      376,  386,  396,  405,  414,  424,  433,  443,  452,  461,
-      470,  479,  488,  497,  510,  519,  528,  537,  546,  556,
-      655,  660,  665,  670,  671,  672,  673,  674,  675,  677,
-      695,  708,  713,  717,  719,  721,  723
+      132,  134,  136,  141,  142,  147,  148,  149,  161,  164,
+      169,  175,  184,  195,  206,  215,  224,  233,  243,  253,
+      263,  280,  297,  306,  315,  325,  335,  345,  356,  365,
+      375,  385,  395,  404,  413,  423,  432,  442,  451,  460,
+      469,  478,  487,  496,  505,  514,  523,  536,  545,  554,
+      563,  572,  581,  590,  599,  609,  708,  713,  718,  723,
+      724,  725,  726,  727,  728,  730,  748,  761,  766,  770,
+      772,  774,  776
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1149,7 +1273,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::d2::D2ParserContext::fatal(msg)
-#line 1152 "d2_lexer.cc"
+#line 1276 "d2_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1175,8 +1299,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1178 "d2_lexer.cc"
-#line 1179 "d2_lexer.cc"
+#line 1302 "d2_lexer.cc"
+#line 1303 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1494,7 +1618,7 @@ YY_DECL
     }
 
 
-#line 1497 "d2_lexer.cc"
+#line 1621 "d2_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1523,13 +1647,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 424 )
+				if ( yy_current_state >= 478 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 423 );
+		while ( yy_current_state != 477 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1548,13 +1672,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 68 )
+			else if ( yy_act < 74 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 68 )
+			else if ( yy_act == 74 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 69 )
+			else if ( yy_act == 75 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2076,6 +2200,42 @@ YY_RULE_SETUP
 case 44:
 YY_RULE_SETUP
 #line 497 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 506 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 515 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC_OVERFLOW(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async-overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+#line 524 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2089,9 +2249,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 48:
 YY_RULE_SETUP
-#line 510 "d2_lexer.ll"
+#line 537 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2101,9 +2261,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 49:
 YY_RULE_SETUP
-#line 519 "d2_lexer.ll"
+#line 546 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::LOGGERS:
+        return isc::d2::D2Parser::make_RATE_LIMITED_MESSAGES(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("rate-limited-messages", driver.loc_);
+    }
+}
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+#line 555 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::LOGGERS:
+        return isc::d2::D2Parser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+#line 564 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::LOGGERS:
+        return isc::d2::D2Parser::make_RATE_LIMIT_INTERVAL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("rate-limit-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+#line 573 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2113,9 +2309,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 53:
 YY_RULE_SETUP
-#line 528 "d2_lexer.ll"
+#line 582 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2125,9 +2321,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 54:
 YY_RULE_SETUP
-#line 537 "d2_lexer.ll"
+#line 591 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2137,9 +2333,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 55:
 YY_RULE_SETUP
-#line 546 "d2_lexer.ll"
+#line 600 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2149,9 +2345,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 56:
 YY_RULE_SETUP
-#line 556 "d2_lexer.ll"
+#line 610 "d2_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2251,65 +2447,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 51:
-/* rule 51 can match eol */
+case 57:
+/* rule 57 can match eol */
 YY_RULE_SETUP
-#line 655 "d2_lexer.ll"
+#line 709 "d2_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 52:
-/* rule 52 can match eol */
+case 58:
+/* rule 58 can match eol */
 YY_RULE_SETUP
-#line 660 "d2_lexer.ll"
+#line 714 "d2_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 53:
+case 59:
 YY_RULE_SETUP
-#line 665 "d2_lexer.ll"
+#line 719 "d2_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 54:
+case 60:
 YY_RULE_SETUP
-#line 670 "d2_lexer.ll"
+#line 724 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 55:
+case 61:
 YY_RULE_SETUP
-#line 671 "d2_lexer.ll"
+#line 725 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 56:
+case 62:
 YY_RULE_SETUP
-#line 672 "d2_lexer.ll"
+#line 726 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 57:
+case 63:
 YY_RULE_SETUP
-#line 673 "d2_lexer.ll"
+#line 727 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 58:
+case 64:
 YY_RULE_SETUP
-#line 674 "d2_lexer.ll"
+#line 728 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 59:
+case 65:
 YY_RULE_SETUP
-#line 675 "d2_lexer.ll"
+#line 729 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 60:
+case 66:
 YY_RULE_SETUP
-#line 677 "d2_lexer.ll"
+#line 731 "d2_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2328,9 +2524,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 61:
+case 67:
 YY_RULE_SETUP
-#line 695 "d2_lexer.ll"
+#line 749 "d2_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2344,43 +2540,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 62:
+case 68:
 YY_RULE_SETUP
-#line 708 "d2_lexer.ll"
+#line 762 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 63:
+case 69:
 YY_RULE_SETUP
-#line 713 "d2_lexer.ll"
+#line 767 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 64:
+case 70:
 YY_RULE_SETUP
-#line 717 "d2_lexer.ll"
+#line 771 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 65:
+case 71:
 YY_RULE_SETUP
-#line 719 "d2_lexer.ll"
+#line 773 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 66:
+case 72:
 YY_RULE_SETUP
-#line 721 "d2_lexer.ll"
+#line 775 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 67:
+case 73:
 YY_RULE_SETUP
-#line 723 "d2_lexer.ll"
+#line 777 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 725 "d2_lexer.ll"
+#line 779 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2404,12 +2600,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 68:
+case 74:
 YY_RULE_SETUP
-#line 748 "d2_lexer.ll"
+#line 802 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2412 "d2_lexer.cc"
+#line 2608 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2728,7 +2924,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 424 )
+			if ( yy_current_state >= 478 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2761,11 +2957,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 424 )
+		if ( yy_current_state >= 478 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 423);
+	yy_is_jam = (yy_current_state == 477);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3514,8 +3710,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 748 "d2_lexer.ll"
-
+#line 802 "d2_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -3617,4 +3812,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -248,25 +248,25 @@ namespace isc { namespace d2 {
   {
     switch (that.type_get ())
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,25 +285,25 @@ namespace isc { namespace d2 {
   {
     switch (that.type_get ())
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -322,25 +322,25 @@ namespace isc { namespace d2 {
     state = that.state;
     switch (that.type_get ())
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -383,44 +383,44 @@ namespace isc { namespace d2 {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 57: // "constant string"
-#line 116 "d2_parser.yy"
+      case 63: // "constant string"
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < std::string > (); }
 #line 390 "d2_parser.cc"
         break;
 
-      case 58: // "integer"
-#line 116 "d2_parser.yy"
+      case 64: // "integer"
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < int64_t > (); }
 #line 396 "d2_parser.cc"
         break;
 
-      case 59: // "floating point"
-#line 116 "d2_parser.yy"
+      case 65: // "floating point"
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < double > (); }
 #line 402 "d2_parser.cc"
         break;
 
-      case 60: // "boolean"
-#line 116 "d2_parser.yy"
+      case 66: // "boolean"
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < bool > (); }
 #line 408 "d2_parser.cc"
         break;
 
-      case 72: // value
-#line 116 "d2_parser.yy"
+      case 78: // value
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 414 "d2_parser.cc"
         break;
 
-      case 76: // map_value
-#line 116 "d2_parser.yy"
+      case 82: // map_value
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 420 "d2_parser.cc"
         break;
 
-      case 100: // ncr_protocol_value
-#line 116 "d2_parser.yy"
+      case 106: // ncr_protocol_value
+#line 122 "d2_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 426 "d2_parser.cc"
         break;
@@ -639,25 +639,25 @@ namespace isc { namespace d2 {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -682,103 +682,103 @@ namespace isc { namespace d2 {
           switch (yyn)
             {
   case 2:
-#line 125 "d2_parser.yy"
+#line 131 "d2_parser.yy"
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 688 "d2_parser.cc"
     break;
 
   case 4:
-#line 126 "d2_parser.yy"
+#line 132 "d2_parser.yy"
     { ctx.ctx_ = ctx.CONFIG; }
 #line 694 "d2_parser.cc"
     break;
 
   case 6:
-#line 127 "d2_parser.yy"
+#line 133 "d2_parser.yy"
     { ctx.ctx_ = ctx.DHCPDDNS; }
 #line 700 "d2_parser.cc"
     break;
 
   case 8:
-#line 128 "d2_parser.yy"
+#line 134 "d2_parser.yy"
     { ctx.ctx_ = ctx.TSIG_KEY; }
 #line 706 "d2_parser.cc"
     break;
 
   case 10:
-#line 129 "d2_parser.yy"
+#line 135 "d2_parser.yy"
     { ctx.ctx_ = ctx.TSIG_KEYS; }
 #line 712 "d2_parser.cc"
     break;
 
   case 12:
-#line 130 "d2_parser.yy"
+#line 136 "d2_parser.yy"
     { ctx.ctx_ = ctx.DDNS_DOMAIN; }
 #line 718 "d2_parser.cc"
     break;
 
   case 14:
-#line 131 "d2_parser.yy"
+#line 137 "d2_parser.yy"
     { ctx.ctx_ = ctx.DDNS_DOMAINS; }
 #line 724 "d2_parser.cc"
     break;
 
   case 16:
-#line 132 "d2_parser.yy"
+#line 138 "d2_parser.yy"
     { ctx.ctx_ = ctx.DNS_SERVERS; }
 #line 730 "d2_parser.cc"
     break;
 
   case 18:
-#line 133 "d2_parser.yy"
+#line 139 "d2_parser.yy"
     { ctx.ctx_ = ctx.DNS_SERVERS; }
 #line 736 "d2_parser.cc"
     break;
 
   case 20:
-#line 141 "d2_parser.yy"
+#line 147 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 742 "d2_parser.cc"
     break;
 
   case 21:
-#line 142 "d2_parser.yy"
+#line 148 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 748 "d2_parser.cc"
     break;
 
   case 22:
-#line 143 "d2_parser.yy"
+#line 149 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 754 "d2_parser.cc"
     break;
 
   case 23:
-#line 144 "d2_parser.yy"
+#line 150 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 760 "d2_parser.cc"
     break;
 
   case 24:
-#line 145 "d2_parser.yy"
+#line 151 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 766 "d2_parser.cc"
     break;
 
   case 25:
-#line 146 "d2_parser.yy"
+#line 152 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 772 "d2_parser.cc"
     break;
 
   case 26:
-#line 147 "d2_parser.yy"
+#line 153 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 778 "d2_parser.cc"
     break;
 
   case 27:
-#line 150 "d2_parser.yy"
+#line 156 "d2_parser.yy"
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -787,7 +787,7 @@ namespace isc { namespace d2 {
     break;
 
   case 28:
-#line 155 "d2_parser.yy"
+#line 161 "d2_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -798,7 +798,7 @@ namespace isc { namespace d2 {
     break;
 
   case 29:
-#line 160 "d2_parser.yy"
+#line 166 "d2_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -808,13 +808,13 @@ namespace isc { namespace d2 {
     break;
 
   case 30:
-#line 166 "d2_parser.yy"
+#line 172 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 814 "d2_parser.cc"
     break;
 
   case 33:
-#line 173 "d2_parser.yy"
+#line 179 "d2_parser.yy"
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -823,7 +823,7 @@ namespace isc { namespace d2 {
     break;
 
   case 34:
-#line 177 "d2_parser.yy"
+#line 183 "d2_parser.yy"
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -833,7 +833,7 @@ namespace isc { namespace d2 {
     break;
 
   case 35:
-#line 184 "d2_parser.yy"
+#line 190 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -842,7 +842,7 @@ namespace isc { namespace d2 {
     break;
 
   case 36:
-#line 187 "d2_parser.yy"
+#line 193 "d2_parser.yy"
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -850,7 +850,7 @@ namespace isc { namespace d2 {
     break;
 
   case 39:
-#line 195 "d2_parser.yy"
+#line 201 "d2_parser.yy"
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -859,7 +859,7 @@ namespace isc { namespace d2 {
     break;
 
   case 40:
-#line 199 "d2_parser.yy"
+#line 205 "d2_parser.yy"
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -868,7 +868,7 @@ namespace isc { namespace d2 {
     break;
 
   case 41:
-#line 210 "d2_parser.yy"
+#line 216 "d2_parser.yy"
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -879,7 +879,7 @@ namespace isc { namespace d2 {
     break;
 
   case 42:
-#line 220 "d2_parser.yy"
+#line 226 "d2_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -890,7 +890,7 @@ namespace isc { namespace d2 {
     break;
 
   case 43:
-#line 225 "d2_parser.yy"
+#line 231 "d2_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -900,7 +900,7 @@ namespace isc { namespace d2 {
     break;
 
   case 52:
-#line 247 "d2_parser.yy"
+#line 253 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
@@ -911,7 +911,7 @@ namespace isc { namespace d2 {
     break;
 
   case 53:
-#line 252 "d2_parser.yy"
+#line 258 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -920,7 +920,7 @@ namespace isc { namespace d2 {
     break;
 
   case 54:
-#line 257 "d2_parser.yy"
+#line 263 "d2_parser.yy"
     {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -930,7 +930,7 @@ namespace isc { namespace d2 {
     break;
 
   case 55:
-#line 261 "d2_parser.yy"
+#line 267 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -938,7 +938,7 @@ namespace isc { namespace d2 {
     break;
 
   case 71:
-#line 285 "d2_parser.yy"
+#line 291 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -946,7 +946,7 @@ namespace isc { namespace d2 {
     break;
 
   case 72:
-#line 287 "d2_parser.yy"
+#line 293 "d2_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
@@ -956,7 +956,7 @@ namespace isc { namespace d2 {
     break;
 
   case 73:
-#line 293 "d2_parser.yy"
+#line 299 "d2_parser.yy"
     {
     if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
@@ -968,7 +968,7 @@ namespace isc { namespace d2 {
     break;
 
   case 74:
-#line 301 "d2_parser.yy"
+#line 307 "d2_parser.yy"
     {
     if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
@@ -981,7 +981,7 @@ namespace isc { namespace d2 {
     break;
 
   case 75:
-#line 310 "d2_parser.yy"
+#line 316 "d2_parser.yy"
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
@@ -989,7 +989,7 @@ namespace isc { namespace d2 {
     break;
 
   case 76:
-#line 312 "d2_parser.yy"
+#line 318 "d2_parser.yy"
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -998,19 +998,19 @@ namespace isc { namespace d2 {
     break;
 
   case 77:
-#line 318 "d2_parser.yy"
+#line 324 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
 #line 1004 "d2_parser.cc"
     break;
 
   case 78:
-#line 319 "d2_parser.yy"
+#line 325 "d2_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
 #line 1010 "d2_parser.cc"
     break;
 
   case 79:
-#line 322 "d2_parser.yy"
+#line 328 "d2_parser.yy"
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
@@ -1018,7 +1018,7 @@ namespace isc { namespace d2 {
     break;
 
   case 80:
-#line 324 "d2_parser.yy"
+#line 330 "d2_parser.yy"
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
@@ -1028,7 +1028,7 @@ namespace isc { namespace d2 {
     break;
 
   case 81:
-#line 330 "d2_parser.yy"
+#line 336 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1036,7 +1036,7 @@ namespace isc { namespace d2 {
     break;
 
   case 82:
-#line 332 "d2_parser.yy"
+#line 338 "d2_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -1063,7 +1063,7 @@ namespace isc { namespace d2 {
     break;
 
   case 83:
-#line 355 "d2_parser.yy"
+#line 361 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1071,7 +1071,7 @@ namespace isc { namespace d2 {
     break;
 
   case 84:
-#line 357 "d2_parser.yy"
+#line 363 "d2_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -1100,7 +1100,7 @@ namespace isc { namespace d2 {
     break;
 
   case 85:
-#line 382 "d2_parser.yy"
+#line 388 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
@@ -1111,7 +1111,7 @@ namespace isc { namespace d2 {
     break;
 
   case 86:
-#line 387 "d2_parser.yy"
+#line 393 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1120,7 +1120,7 @@ namespace isc { namespace d2 {
     break;
 
   case 87:
-#line 392 "d2_parser.yy"
+#line 398 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
@@ -1131,7 +1131,7 @@ namespace isc { namespace d2 {
     break;
 
   case 88:
-#line 397 "d2_parser.yy"
+#line 403 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1140,7 +1140,7 @@ namespace isc { namespace d2 {
     break;
 
   case 95:
-#line 416 "d2_parser.yy"
+#line 422 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
@@ -1151,7 +1151,7 @@ namespace isc { namespace d2 {
     break;
 
   case 96:
-#line 421 "d2_parser.yy"
+#line 427 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1160,7 +1160,7 @@ namespace isc { namespace d2 {
     break;
 
   case 97:
-#line 426 "d2_parser.yy"
+#line 432 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -1169,7 +1169,7 @@ namespace isc { namespace d2 {
     break;
 
   case 98:
-#line 429 "d2_parser.yy"
+#line 435 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -1177,7 +1177,7 @@ namespace isc { namespace d2 {
     break;
 
   case 103:
-#line 441 "d2_parser.yy"
+#line 447 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1187,7 +1187,7 @@ namespace isc { namespace d2 {
     break;
 
   case 104:
-#line 445 "d2_parser.yy"
+#line 451 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
 }
@@ -1195,7 +1195,7 @@ namespace isc { namespace d2 {
     break;
 
   case 105:
-#line 449 "d2_parser.yy"
+#line 455 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
@@ -1204,7 +1204,7 @@ namespace isc { namespace d2 {
     break;
 
   case 106:
-#line 452 "d2_parser.yy"
+#line 458 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -1212,7 +1212,7 @@ namespace isc { namespace d2 {
     break;
 
   case 115:
-#line 469 "d2_parser.yy"
+#line 475 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1220,7 +1220,7 @@ namespace isc { namespace d2 {
     break;
 
   case 116:
-#line 471 "d2_parser.yy"
+#line 477 "d2_parser.yy"
     {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
@@ -1234,7 +1234,7 @@ namespace isc { namespace d2 {
     break;
 
   case 117:
-#line 481 "d2_parser.yy"
+#line 487 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1242,7 +1242,7 @@ namespace isc { namespace d2 {
     break;
 
   case 118:
-#line 483 "d2_parser.yy"
+#line 489 "d2_parser.yy"
     {
     ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1253,7 +1253,7 @@ namespace isc { namespace d2 {
     break;
 
   case 119:
-#line 493 "d2_parser.yy"
+#line 499 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
@@ -1264,7 +1264,7 @@ namespace isc { namespace d2 {
     break;
 
   case 120:
-#line 498 "d2_parser.yy"
+#line 504 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1273,7 +1273,7 @@ namespace isc { namespace d2 {
     break;
 
   case 121:
-#line 503 "d2_parser.yy"
+#line 509 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -1282,7 +1282,7 @@ namespace isc { namespace d2 {
     break;
 
   case 122:
-#line 506 "d2_parser.yy"
+#line 512 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -1290,7 +1290,7 @@ namespace isc { namespace d2 {
     break;
 
   case 125:
-#line 514 "d2_parser.yy"
+#line 520 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1300,7 +1300,7 @@ namespace isc { namespace d2 {
     break;
 
   case 126:
-#line 518 "d2_parser.yy"
+#line 524 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
 }
@@ -1308,7 +1308,7 @@ namespace isc { namespace d2 {
     break;
 
   case 127:
-#line 522 "d2_parser.yy"
+#line 528 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
@@ -1317,7 +1317,7 @@ namespace isc { namespace d2 {
     break;
 
   case 128:
-#line 525 "d2_parser.yy"
+#line 531 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -1325,7 +1325,7 @@ namespace isc { namespace d2 {
     break;
 
   case 137:
-#line 541 "d2_parser.yy"
+#line 547 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1333,7 +1333,7 @@ namespace isc { namespace d2 {
     break;
 
   case 138:
-#line 543 "d2_parser.yy"
+#line 549 "d2_parser.yy"
     {
     if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
@@ -1347,7 +1347,7 @@ namespace isc { namespace d2 {
     break;
 
   case 139:
-#line 553 "d2_parser.yy"
+#line 559 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1355,7 +1355,7 @@ namespace isc { namespace d2 {
     break;
 
   case 140:
-#line 555 "d2_parser.yy"
+#line 561 "d2_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
@@ -1365,7 +1365,7 @@ namespace isc { namespace d2 {
     break;
 
   case 141:
-#line 561 "d2_parser.yy"
+#line 567 "d2_parser.yy"
     {
     if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
@@ -1377,7 +1377,7 @@ namespace isc { namespace d2 {
     break;
 
   case 142:
-#line 575 "d2_parser.yy"
+#line 581 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
@@ -1388,7 +1388,7 @@ namespace isc { namespace d2 {
     break;
 
   case 143:
-#line 580 "d2_parser.yy"
+#line 586 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1397,7 +1397,7 @@ namespace isc { namespace d2 {
     break;
 
   case 144:
-#line 585 "d2_parser.yy"
+#line 591 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -1406,7 +1406,7 @@ namespace isc { namespace d2 {
     break;
 
   case 145:
-#line 588 "d2_parser.yy"
+#line 594 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -1414,7 +1414,7 @@ namespace isc { namespace d2 {
     break;
 
   case 150:
-#line 600 "d2_parser.yy"
+#line 606 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1424,7 +1424,7 @@ namespace isc { namespace d2 {
     break;
 
   case 151:
-#line 604 "d2_parser.yy"
+#line 610 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
 }
@@ -1432,7 +1432,7 @@ namespace isc { namespace d2 {
     break;
 
   case 152:
-#line 608 "d2_parser.yy"
+#line 614 "d2_parser.yy"
     {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1442,7 +1442,7 @@ namespace isc { namespace d2 {
     break;
 
   case 153:
-#line 612 "d2_parser.yy"
+#line 618 "d2_parser.yy"
     {
     // parsing completed
 }
@@ -1450,7 +1450,7 @@ namespace isc { namespace d2 {
     break;
 
   case 163:
-#line 630 "d2_parser.yy"
+#line 636 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1458,7 +1458,7 @@ namespace isc { namespace d2 {
     break;
 
   case 164:
-#line 632 "d2_parser.yy"
+#line 638 "d2_parser.yy"
     {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
@@ -1472,7 +1472,7 @@ namespace isc { namespace d2 {
     break;
 
   case 165:
-#line 642 "d2_parser.yy"
+#line 648 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1480,7 +1480,7 @@ namespace isc { namespace d2 {
     break;
 
   case 166:
-#line 644 "d2_parser.yy"
+#line 650 "d2_parser.yy"
     {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
@@ -1493,7 +1493,7 @@ namespace isc { namespace d2 {
     break;
 
   case 167:
-#line 653 "d2_parser.yy"
+#line 659 "d2_parser.yy"
     {
     if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
@@ -1505,7 +1505,7 @@ namespace isc { namespace d2 {
     break;
 
   case 168:
-#line 661 "d2_parser.yy"
+#line 667 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1513,7 +1513,7 @@ namespace isc { namespace d2 {
     break;
 
   case 169:
-#line 663 "d2_parser.yy"
+#line 669 "d2_parser.yy"
     {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
@@ -1526,7 +1526,7 @@ namespace isc { namespace d2 {
     break;
 
   case 170:
-#line 677 "d2_parser.yy"
+#line 683 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
@@ -1537,7 +1537,7 @@ namespace isc { namespace d2 {
     break;
 
   case 171:
-#line 682 "d2_parser.yy"
+#line 688 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1546,7 +1546,7 @@ namespace isc { namespace d2 {
     break;
 
   case 179:
-#line 698 "d2_parser.yy"
+#line 704 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1554,7 +1554,7 @@ namespace isc { namespace d2 {
     break;
 
   case 180:
-#line 700 "d2_parser.yy"
+#line 706 "d2_parser.yy"
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
@@ -1564,7 +1564,7 @@ namespace isc { namespace d2 {
     break;
 
   case 181:
-#line 706 "d2_parser.yy"
+#line 712 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1572,7 +1572,7 @@ namespace isc { namespace d2 {
     break;
 
   case 182:
-#line 708 "d2_parser.yy"
+#line 714 "d2_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
@@ -1582,7 +1582,7 @@ namespace isc { namespace d2 {
     break;
 
   case 183:
-#line 716 "d2_parser.yy"
+#line 722 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1590,7 +1590,7 @@ namespace isc { namespace d2 {
     break;
 
   case 184:
-#line 718 "d2_parser.yy"
+#line 724 "d2_parser.yy"
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1599,7 +1599,7 @@ namespace isc { namespace d2 {
     break;
 
   case 185:
-#line 723 "d2_parser.yy"
+#line 729 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1607,7 +1607,7 @@ namespace isc { namespace d2 {
     break;
 
   case 186:
-#line 725 "d2_parser.yy"
+#line 731 "d2_parser.yy"
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1616,7 +1616,7 @@ namespace isc { namespace d2 {
     break;
 
   case 187:
-#line 730 "d2_parser.yy"
+#line 736 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1624,7 +1624,7 @@ namespace isc { namespace d2 {
     break;
 
   case 188:
-#line 732 "d2_parser.yy"
+#line 738 "d2_parser.yy"
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1633,7 +1633,7 @@ namespace isc { namespace d2 {
     break;
 
   case 189:
-#line 742 "d2_parser.yy"
+#line 748 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
@@ -1644,7 +1644,7 @@ namespace isc { namespace d2 {
     break;
 
   case 190:
-#line 747 "d2_parser.yy"
+#line 753 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1653,7 +1653,7 @@ namespace isc { namespace d2 {
     break;
 
   case 194:
-#line 764 "d2_parser.yy"
+#line 770 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
@@ -1664,7 +1664,7 @@ namespace isc { namespace d2 {
     break;
 
   case 195:
-#line 769 "d2_parser.yy"
+#line 775 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1673,7 +1673,7 @@ namespace isc { namespace d2 {
     break;
 
   case 198:
-#line 781 "d2_parser.yy"
+#line 787 "d2_parser.yy"
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
@@ -1683,23 +1683,23 @@ namespace isc { namespace d2 {
     break;
 
   case 199:
-#line 785 "d2_parser.yy"
+#line 791 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
 }
 #line 1691 "d2_parser.cc"
     break;
 
-  case 209:
-#line 802 "d2_parser.yy"
+  case 212:
+#line 811 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1699 "d2_parser.cc"
     break;
 
-  case 210:
-#line 804 "d2_parser.yy"
+  case 213:
+#line 813 "d2_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1708,8 +1708,8 @@ namespace isc { namespace d2 {
 #line 1709 "d2_parser.cc"
     break;
 
-  case 211:
-#line 810 "d2_parser.yy"
+  case 214:
+#line 819 "d2_parser.yy"
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
@@ -1717,16 +1717,16 @@ namespace isc { namespace d2 {
 #line 1718 "d2_parser.cc"
     break;
 
-  case 212:
-#line 814 "d2_parser.yy"
+  case 215:
+#line 823 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1726 "d2_parser.cc"
     break;
 
-  case 213:
-#line 816 "d2_parser.yy"
+  case 216:
+#line 825 "d2_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
@@ -1735,109 +1735,182 @@ namespace isc { namespace d2 {
 #line 1736 "d2_parser.cc"
     break;
 
-  case 214:
-#line 822 "d2_parser.yy"
+  case 217:
+#line 831 "d2_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1744 "d2_parser.cc"
+    break;
+
+  case 218:
+#line 833 "d2_parser.yy"
+    {
+    ElementPtr l = ctx.stack_.back();
+    ctx.stack_.pop_back();
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.leave();
+}
+#line 1755 "d2_parser.cc"
+    break;
+
+  case 219:
+#line 840 "d2_parser.yy"
+    {
+    ElementPtr limit(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", limit);
+}
+#line 1764 "d2_parser.cc"
+    break;
+
+  case 220:
+#line 845 "d2_parser.yy"
+    {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+}
+#line 1773 "d2_parser.cc"
+    break;
+
+  case 221:
+#line 850 "d2_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1747 "d2_parser.cc"
+#line 1784 "d2_parser.cc"
     break;
 
-  case 215:
-#line 827 "d2_parser.yy"
+  case 222:
+#line 855 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1756 "d2_parser.cc"
+#line 1793 "d2_parser.cc"
     break;
 
-  case 218:
-#line 836 "d2_parser.yy"
+  case 225:
+#line 864 "d2_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1766 "d2_parser.cc"
+#line 1803 "d2_parser.cc"
     break;
 
-  case 219:
-#line 840 "d2_parser.yy"
+  case 226:
+#line 868 "d2_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 1774 "d2_parser.cc"
+#line 1811 "d2_parser.cc"
     break;
 
-  case 227:
-#line 855 "d2_parser.yy"
+  case 237:
+#line 886 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1782 "d2_parser.cc"
+#line 1819 "d2_parser.cc"
     break;
 
-  case 228:
-#line 857 "d2_parser.yy"
+  case 238:
+#line 888 "d2_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1792 "d2_parser.cc"
+#line 1829 "d2_parser.cc"
     break;
 
-  case 229:
-#line 863 "d2_parser.yy"
+  case 239:
+#line 894 "d2_parser.yy"
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1801 "d2_parser.cc"
+#line 1838 "d2_parser.cc"
     break;
 
-  case 230:
-#line 868 "d2_parser.yy"
+  case 240:
+#line 899 "d2_parser.yy"
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1810 "d2_parser.cc"
+#line 1847 "d2_parser.cc"
     break;
 
-  case 231:
-#line 873 "d2_parser.yy"
+  case 241:
+#line 904 "d2_parser.yy"
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1819 "d2_parser.cc"
+#line 1856 "d2_parser.cc"
     break;
 
-  case 232:
-#line 878 "d2_parser.yy"
+  case 242:
+#line 909 "d2_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1827 "d2_parser.cc"
+#line 1864 "d2_parser.cc"
     break;
 
-  case 233:
-#line 880 "d2_parser.yy"
+  case 243:
+#line 911 "d2_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 1837 "d2_parser.cc"
+#line 1874 "d2_parser.cc"
+    break;
+
+  case 244:
+#line 917 "d2_parser.yy"
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1883 "d2_parser.cc"
+    break;
+
+  case 245:
+#line 922 "d2_parser.yy"
+    {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 1892 "d2_parser.cc"
+    break;
+
+  case 246:
+#line 927 "d2_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1900 "d2_parser.cc"
+    break;
+
+  case 247:
+#line 929 "d2_parser.yy"
+    {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+}
+#line 1910 "d2_parser.cc"
     break;
 
 
-#line 1841 "d2_parser.cc"
+#line 1914 "d2_parser.cc"
 
             default:
               break;
@@ -2108,52 +2181,55 @@ namespace isc { namespace d2 {
   }
 
 
-  const short D2Parser::yypact_ninf_ = -238;
+  const short D2Parser::yypact_ninf_ = -242;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
   const short
   D2Parser::yypact_[] =
   {
-      69,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-      14,     2,     1,    23,    37,    11,    39,    43,    47,    51,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,     2,    22,
-       8,     9,    18,    85,    50,   104,    13,   120,  -238,    84,
-     125,   132,   129,   135,  -238,  -238,  -238,  -238,  -238,   140,
-    -238,    55,  -238,  -238,  -238,  -238,  -238,  -238,  -238,   142,
-     150,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,    66,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,   160,  -238,  -238,  -238,
-    -238,  -238,    68,  -238,  -238,  -238,  -238,  -238,  -238,   167,
-     153,  -238,  -238,  -238,  -238,  -238,  -238,  -238,    83,  -238,
-    -238,  -238,  -238,  -238,   168,   162,  -238,  -238,   171,  -238,
-    -238,  -238,  -238,    97,  -238,  -238,  -238,  -238,  -238,    49,
-    -238,  -238,     2,     2,  -238,   119,   174,   175,   176,   177,
-     178,  -238,     8,  -238,   179,   126,   128,   181,   183,   184,
-     185,   186,   187,   188,   189,   190,     9,  -238,   191,   138,
-     193,   194,    18,  -238,    18,  -238,    85,   195,   196,   197,
-      50,  -238,    50,  -238,   104,   198,   145,   200,    13,  -238,
-      13,   120,  -238,  -238,  -238,   201,     2,     2,     2,   205,
-     206,  -238,   157,  -238,  -238,    19,   199,   208,   161,   209,
-     210,   202,   212,   216,  -238,   166,  -238,   170,   172,  -238,
-      98,  -238,   173,   219,   180,  -238,   100,  -238,   182,  -238,
-     192,  -238,   101,  -238,     2,  -238,  -238,  -238,     9,   203,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,    -4,    -4,
-      85,    59,   218,  -238,  -238,  -238,  -238,  -238,   120,  -238,
-    -238,  -238,  -238,  -238,  -238,   127,   149,  -238,  -238,  -238,
-    -238,   152,  -238,  -238,  -238,   155,   220,  -238,  -238,  -238,
-    -238,  -238,   159,  -238,  -238,  -238,  -238,    77,  -238,   107,
-    -238,   203,  -238,   224,    -4,  -238,  -238,  -238,   227,   228,
-      59,  -238,    45,   218,  -238,  -238,  -238,   229,  -238,   207,
-     211,  -238,  -238,  -238,   231,  -238,  -238,  -238,  -238,   163,
-    -238,  -238,  -238,  -238,  -238,  -238,   104,  -238,  -238,   232,
-     234,   214,   236,    45,  -238,   237,   213,   239,  -238,   217,
-    -238,  -238,  -238,   226,  -238,  -238,   123,  -238,    52,   226,
-    -238,  -238,   238,   241,   242,  -238,   169,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,   243,   215,   221,   222,   244,    52,
-    -238,   225,  -238,  -238,  -238,   230,  -238,  -238,  -238
+     117,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+      14,     2,    15,    23,    31,    11,    37,    43,    76,    94,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,     2,     1,
+       8,     9,    30,   102,    57,   110,    13,   120,  -242,   123,
+     125,   131,   128,   134,  -242,  -242,  -242,  -242,  -242,   140,
+    -242,    38,  -242,  -242,  -242,  -242,  -242,  -242,  -242,   142,
+     150,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,    47,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242,   160,  -242,  -242,  -242,
+    -242,  -242,    48,  -242,  -242,  -242,  -242,  -242,  -242,   132,
+     153,  -242,  -242,  -242,  -242,  -242,  -242,  -242,    51,  -242,
+    -242,  -242,  -242,  -242,   175,   162,  -242,  -242,   178,  -242,
+    -242,  -242,  -242,   105,  -242,  -242,  -242,  -242,  -242,    34,
+    -242,  -242,     2,     2,  -242,   103,   179,   180,   182,   183,
+     184,  -242,     8,  -242,   185,   126,   127,   188,   189,   190,
+     191,   192,   193,   194,   195,   196,     9,  -242,   197,   138,
+     199,   200,    30,  -242,    30,  -242,   102,   201,   203,   208,
+      57,  -242,    57,  -242,   110,   209,   151,   210,    13,  -242,
+      13,   120,  -242,  -242,  -242,   212,     2,     2,     2,   211,
+     213,  -242,   154,  -242,  -242,    72,   198,   214,   161,   216,
+     218,   221,   220,   223,  -242,   166,  -242,   167,   168,  -242,
+     108,  -242,   169,   228,   171,  -242,   115,  -242,   172,  -242,
+     173,  -242,   116,  -242,     2,  -242,  -242,  -242,     9,   202,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,   -14,   -14,
+     102,    59,   230,  -242,  -242,  -242,  -242,  -242,   120,  -242,
+    -242,  -242,  -242,  -242,  -242,   118,   122,  -242,  -242,  -242,
+    -242,   149,  -242,  -242,  -242,   152,   232,  -242,  -242,  -242,
+    -242,  -242,   155,  -242,  -242,  -242,  -242,    67,  -242,    86,
+    -242,   202,  -242,   235,   -14,  -242,  -242,  -242,   237,   238,
+      59,  -242,    35,   230,  -242,  -242,  -242,   239,  -242,   186,
+     187,  -242,  -242,  -242,   241,  -242,  -242,   242,   243,  -242,
+    -242,  -242,   159,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,   110,  -242,  -242,   244,   247,   204,   248,   249,
+     205,   206,    35,  -242,   250,   215,   252,  -242,   217,   253,
+    -242,  -242,  -242,  -242,  -242,   236,  -242,  -242,  -242,   104,
+    -242,    56,   236,  -242,  -242,   251,   259,   260,  -242,   261,
+     262,  -242,   177,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,  -242,   263,   219,   222,   224,   268,   225,   226,
+     270,    56,  -242,   229,  -242,  -242,  -242,   231,  -242,  -242,
+     233,  -242,  -242,  -242,  -242
   };
 
   const unsigned char
@@ -2191,33 +2267,37 @@ namespace isc { namespace d2 {
      176,   177,     0,   172,   174,   175,   198,     0,   196,     0,
       53,     0,   190,     0,     0,    86,    88,   143,     0,     0,
        0,   171,     0,     0,   195,   120,   192,     0,    92,     0,
-       0,   173,   209,   214,     0,   212,   208,   206,   207,     0,
-     200,   202,   204,   205,   203,   197,    99,   180,   182,     0,
-       0,     0,     0,     0,   199,     0,     0,     0,   211,     0,
-     201,    96,   210,     0,   213,   218,     0,   216,     0,     0,
-     215,   227,     0,     0,     0,   232,     0,   220,   222,   223,
-     224,   225,   226,   217,     0,     0,     0,     0,     0,     0,
-     219,     0,   229,   230,   231,     0,   221,   228,   233
+       0,   173,   212,   221,     0,   215,   217,     0,     0,   211,
+     209,   210,     0,   200,   202,   204,   205,   206,   207,   208,
+     203,   197,    99,   180,   182,     0,     0,     0,     0,     0,
+       0,     0,     0,   199,     0,     0,     0,   214,     0,     0,
+     219,   220,   201,    96,   213,     0,   216,   218,   225,     0,
+     223,     0,     0,   222,   237,     0,     0,     0,   242,     0,
+       0,   246,     0,   227,   229,   230,   231,   232,   233,   234,
+     235,   236,   224,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   226,     0,   239,   240,   241,     0,   244,   245,
+       0,   228,   238,   243,   247
   };
 
   const short
   D2Parser::yypgoto_[] =
   {
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,   -38,  -238,    33,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,   -50,  -238,  -238,  -238,    89,  -238,  -238,  -238,
-    -238,     4,    79,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,   -51,  -238,   -39,  -238,  -238,  -238,  -238,  -238,
-      -6,  -238,   -48,  -238,  -238,  -238,  -238,   -79,  -238,    64,
-    -238,  -238,  -238,    71,    75,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,    -2,    76,  -238,  -238,  -238,    67,    78,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,    21,
-    -238,    92,  -238,  -238,  -238,    99,    87,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,   -26,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,   -16,  -237,  -238,  -238,   -27,  -238,  -238,   -55,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,   -70,  -238,  -238,
-     -89,  -238,  -238,  -238,  -238,  -238,  -238,  -238
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,   -38,  -242,    58,  -242,  -242,  -242,  -242,   -83,  -242,
+    -242,  -242,   -50,  -242,  -242,  -242,   119,  -242,  -242,  -242,
+    -242,    29,   106,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,   -51,  -242,   -39,  -242,  -242,  -242,  -242,  -242,
+      20,  -242,   -21,  -242,  -242,  -242,  -242,   -58,  -242,    93,
+    -242,  -242,  -242,    97,   107,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,  -242,    25,    98,  -242,  -242,  -242,    95,   100,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,    40,
+    -242,   121,  -242,  -242,  -242,   124,   129,  -242,  -242,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,    -7,  -242,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,     3,  -241,  -242,  -242,    -8,  -242,  -242,   -46,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+    -242,   -63,  -242,  -242,   -91,  -242,  -242,  -242,  -242,  -242,
+    -242,  -242,  -242,  -242,  -242,  -242
   };
 
   const short
@@ -2235,154 +2315,161 @@ namespace isc { namespace d2 {
      120,   121,   184,    37,    52,   112,   113,   114,   181,   115,
      178,   116,   117,   180,   103,   174,   292,   293,   294,   308,
      295,   309,    74,   156,    75,   157,    76,   158,    77,   160,
-     276,   277,   104,   175,   297,   298,   312,   329,   330,   331,
-     339,   332,   333,   342,   334,   340,   356,   357,   358,   366,
-     367,   368,   374,   369,   370,   371,   372,   378
+     276,   277,   104,   175,   297,   298,   312,   332,   333,   334,
+     345,   335,   336,   348,   337,   349,   338,   339,   340,   346,
+     369,   370,   371,   382,   383,   384,   393,   385,   386,   387,
+     388,   397,   389,   390,   391,   400
   };
 
   const unsigned short
   D2Parser::yytable_[] =
   {
-      70,   110,   109,   126,   125,   141,   140,    21,    32,    22,
-      58,    23,   278,   111,    20,   127,    38,   142,    64,    65,
-      66,    67,   279,    78,    79,    80,    81,   137,   138,    82,
-      34,    83,    84,    85,    86,    83,    84,   251,   252,    87,
-      83,    84,   139,    88,    36,    68,    40,    89,    42,   105,
-     106,   107,   201,    69,    44,   202,    46,   108,   162,    24,
-      25,    26,    27,   163,   278,    69,    69,    83,    84,   176,
-      69,   182,    83,    84,   177,    69,   183,   122,   123,    61,
-     313,    83,    84,   314,   322,   323,   190,   324,   325,   124,
-     151,   191,   118,   361,   287,   288,   362,   363,   364,   365,
-     198,   182,    69,   190,   198,   199,   266,    69,   270,   273,
-     201,   133,    70,   315,   203,   204,    69,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,   359,   148,   152,   360,
-     176,   110,   109,   110,   109,   300,   153,   154,   155,   126,
+      70,   110,   109,   126,   125,   141,   140,    21,   278,    22,
+      58,    23,   279,   111,    20,   127,    38,   142,    64,    65,
+      66,    67,    32,    78,    79,    80,    81,   137,   138,    82,
+      34,    83,    84,    85,    86,    83,    84,   201,    36,    87,
+     202,   162,   139,    88,    40,    68,   163,    89,    42,    69,
+     176,   182,    83,    84,   190,   177,   183,    83,    84,   191,
+     278,   105,   106,   107,    61,    24,    25,    26,    27,   108,
+     313,    69,    69,   314,   322,   323,    69,   324,   325,    83,
+      84,    83,    84,    44,   122,   123,   326,   327,   328,   201,
+     251,   252,   315,    69,   287,   288,   124,   374,    69,    46,
+     375,   376,   377,   378,   379,   380,   381,   372,   198,   118,
+     373,   182,    70,   199,   203,   204,   266,   133,   190,   198,
+      69,   176,    69,   270,   273,   301,   300,   148,   152,   151,
+     302,   110,   109,   110,   109,   153,   154,   155,   185,   126,
      125,   126,   125,   111,   161,   111,   165,   141,   140,   141,
-     140,   127,   301,   127,   166,   304,   186,   302,   304,   142,
-     305,   142,   310,   306,   179,   194,   343,   311,   245,   246,
-     247,   344,   379,   185,   193,   196,   205,   380,   206,   207,
-     208,   209,   210,   212,   213,   215,   214,   216,   217,   218,
-     219,   220,   221,   222,   223,   225,   226,   227,   228,   232,
-     233,   234,   238,   239,   240,   244,   274,   260,   280,   280,
-     290,   289,   248,   249,   250,    22,   258,   259,   257,   261,
-     254,   262,   291,   263,   268,   296,   307,   264,   317,   265,
-     267,   319,   320,   355,   336,   341,   346,   269,   347,   271,
-     349,    89,   375,   351,   353,   376,   377,   381,   385,   272,
-     255,   211,   275,   285,   280,   224,   318,   345,   237,   290,
-     289,   327,   326,   236,   337,   235,   299,   242,   338,   229,
-     352,   291,   348,   328,   354,   382,   241,   243,   231,   383,
-     384,   286,   387,   230,   321,   316,   335,   388,   350,   373,
-     386,     0,   327,   326,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   328
+     140,   127,   304,   127,   166,   304,   186,   305,   310,   142,
+     306,   142,   352,   311,   179,   194,   205,   353,   245,   246,
+     247,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+     401,   193,   196,   206,   207,   402,   208,   209,   210,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   225,   226,   227,   228,   232,   274,   233,   280,   280,
+     290,   289,   234,   238,   240,   239,   244,   250,   248,   254,
+     249,    22,   291,   258,   257,   259,   260,   261,   262,   263,
+     264,   265,   267,   268,   269,   271,   272,   296,   307,   317,
+      89,   319,   320,   368,   342,   347,   350,   351,   355,   343,
+     344,   356,   358,   359,   280,   394,   363,   365,    21,   290,
+     289,   330,   329,   395,   396,   398,   399,   403,   357,   360,
+     361,   291,   407,   331,   410,   255,   367,   275,   364,   285,
+     366,   211,   224,   318,   354,   404,   405,   237,   406,   236,
+     409,   408,   412,   299,   413,   242,   414,   235,   241,   243,
+     286,   330,   329,   321,   316,   341,   362,   231,   230,   392,
+     411,   229,     0,   331
   };
 
   const short
   D2Parser::yycheck_[] =
   {
-      50,    52,    52,    54,    54,    56,    56,     5,     7,     7,
-      48,     9,   249,    52,     0,    54,     5,    56,    10,    11,
-      12,    13,    26,    14,    15,    16,    17,    14,    15,    20,
-       7,    22,    23,    24,    25,    22,    23,    18,    19,    30,
-      22,    23,    29,    34,     7,    37,     7,    38,     5,    31,
-      32,    33,     3,    57,     7,     6,     5,    39,     3,    57,
-      58,    59,    60,     8,   301,    57,    57,    22,    23,     3,
-      57,     3,    22,    23,     8,    57,     8,    27,    28,    57,
-       3,    22,    23,     6,    39,    40,     3,    42,    43,    39,
-       6,     8,     7,    41,    35,    36,    44,    45,    46,    47,
-       3,     3,    57,     3,     3,     8,     8,    57,     8,     8,
-       3,     7,   162,     6,   152,   153,    57,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,     3,     7,     3,     6,
-       3,   182,   182,   184,   184,     8,     4,     8,     3,   190,
+      50,    52,    52,    54,    54,    56,    56,     5,   249,     7,
+      48,     9,    26,    52,     0,    54,     5,    56,    10,    11,
+      12,    13,     7,    14,    15,    16,    17,    14,    15,    20,
+       7,    22,    23,    24,    25,    22,    23,     3,     7,    30,
+       6,     3,    29,    34,     7,    37,     8,    38,     5,    63,
+       3,     3,    22,    23,     3,     8,     8,    22,    23,     8,
+     301,    31,    32,    33,    63,    63,    64,    65,    66,    39,
+       3,    63,    63,     6,    39,    40,    63,    42,    43,    22,
+      23,    22,    23,     7,    27,    28,    51,    52,    53,     3,
+      18,    19,     6,    63,    35,    36,    39,    41,    63,     5,
+      44,    45,    46,    47,    48,    49,    50,     3,     3,     7,
+       6,     3,   162,     8,   152,   153,     8,     7,     3,     3,
+      63,     3,    63,     8,     8,     3,     8,     7,     3,     6,
+       8,   182,   182,   184,   184,     4,     8,     3,     6,   190,
      190,   192,   192,   182,     4,   184,     4,   198,   198,   200,
      200,   190,     3,   192,     4,     3,     3,     8,     3,   198,
-       8,   200,     3,     8,     4,     3,     3,     8,   206,   207,
-     208,     8,     3,     6,     6,     4,    57,     8,     4,     4,
-       4,     4,     4,     4,    58,     4,    58,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,    58,     4,     4,     4,
-       4,     4,     4,    58,     4,     4,   244,     5,   258,   259,
-     261,   261,     7,     7,    57,     7,     7,     7,    57,     7,
-      21,     5,   261,    57,     5,     7,     6,    57,     4,    57,
-      57,     4,     4,     7,     5,     4,     4,    57,     4,    57,
-       4,    38,     4,     6,     5,     4,     4,     4,     4,    57,
-     217,   162,   248,   259,   304,   176,   304,   336,   194,   310,
-     310,   312,   312,   192,    57,   190,   268,   200,    57,   182,
-      57,   310,    58,   312,    57,    60,   198,   201,   186,    58,
-      58,   260,    57,   184,   310,   301,   313,    57,   343,   359,
-     379,    -1,   343,   343,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   343
+       8,   200,     3,     8,     4,     3,    63,     8,   206,   207,
+     208,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+       3,     6,     4,     4,     4,     8,     4,     4,     4,     4,
+      64,    64,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,    64,     4,     4,     4,   244,     4,   258,   259,
+     261,   261,     4,     4,     4,    64,     4,    63,     7,    21,
+       7,     7,   261,     7,    63,     7,     5,     7,     5,    63,
+      63,    63,    63,     5,    63,    63,    63,     7,     6,     4,
+      38,     4,     4,     7,     5,     4,     4,     4,     4,    63,
+      63,     4,     4,     4,   304,     4,     6,     5,     5,   310,
+     310,   312,   312,     4,     4,     4,     4,     4,    64,    64,
+      64,   310,     4,   312,     4,   217,   359,   248,    63,   259,
+      63,   162,   176,   304,   342,    66,    64,   194,    64,   192,
+      64,    66,    63,   268,    63,   200,    63,   190,   198,   201,
+     260,   352,   352,   310,   301,   313,   352,   186,   184,   372,
+     401,   182,    -1,   352
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-       0,     5,     7,     9,    57,    58,    59,    60,    72,    73,
-      74,    79,     7,    84,     7,    90,     7,   154,     5,   148,
-       7,   122,     5,   116,     7,   137,     5,   132,    80,    75,
-      85,    91,   155,   149,   123,   117,   138,   133,    72,    81,
-      82,    57,    77,    78,    10,    11,    12,    13,    37,    57,
-      83,    86,    87,    88,   173,   175,   177,   179,    14,    15,
+       0,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+       0,     5,     7,     9,    63,    64,    65,    66,    78,    79,
+      80,    85,     7,    90,     7,    96,     7,   160,     5,   154,
+       7,   128,     5,   122,     7,   143,     5,   138,    86,    81,
+      91,    97,   161,   155,   129,   123,   144,   139,    78,    87,
+      88,    63,    83,    84,    10,    11,    12,    13,    37,    63,
+      89,    92,    93,    94,   179,   181,   183,   185,    14,    15,
       16,    17,    20,    22,    23,    24,    25,    30,    34,    38,
-      83,    92,    93,    94,    96,    97,    98,   101,   103,   105,
-     107,   109,   146,   165,   183,    31,    32,    33,    39,    83,
-     103,   105,   156,   157,   158,   160,   162,   163,     7,   150,
-     151,   152,    27,    28,    39,    83,   103,   105,   124,   125,
-     126,   128,   130,     7,   118,   119,   120,    14,    15,    29,
-      83,   103,   105,   139,   140,   141,   143,   145,     7,   134,
-     135,     6,     3,     4,     8,     3,   174,   176,   178,    89,
-     180,     4,     3,     8,    95,     4,     4,    99,   102,   104,
-     106,   108,   110,   147,   166,   184,     3,     8,   161,     4,
-     164,   159,     3,     8,   153,     6,     3,   129,   131,   127,
-       3,     8,   121,     6,     3,   144,     4,   142,     3,     8,
-     136,     3,     6,    72,    72,    57,     4,     4,     4,     4,
-       4,    87,     4,    58,    58,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,    93,     4,    58,     4,     4,   157,
-     156,   152,     4,     4,     4,   125,   124,   120,     4,    58,
-       4,   140,   139,   135,     4,    72,    72,    72,     7,     7,
-      57,    18,    19,   100,    21,    74,    76,    57,     7,     7,
-       5,     7,     5,    57,    57,    57,     8,    57,     5,    57,
-       8,    57,    57,     8,    72,    92,   181,   182,   183,    26,
-      83,   111,   112,   113,   114,   111,   150,    35,    36,    83,
-     103,   105,   167,   168,   169,   171,     7,   185,   186,   134,
-       8,     3,     8,   115,     3,     8,     8,     6,   170,   172,
-       3,     8,   187,     3,     6,     6,   182,     4,   113,     4,
-       4,   168,    39,    40,    42,    43,    83,   103,   105,   188,
-     189,   190,   192,   193,   195,   186,     5,    57,    57,   191,
-     196,     4,   194,     3,     8,   118,     4,     4,    58,     4,
-     189,     6,    57,     5,    57,     7,   197,   198,   199,     3,
-       6,    41,    44,    45,    46,    47,   200,   201,   202,   204,
-     205,   206,   207,   198,   203,     4,     4,     4,   208,     3,
-       8,     4,    60,    58,    58,     4,   201,    57,    57
+      89,    98,    99,   100,   102,   103,   104,   107,   109,   111,
+     113,   115,   152,   171,   189,    31,    32,    33,    39,    89,
+     109,   111,   162,   163,   164,   166,   168,   169,     7,   156,
+     157,   158,    27,    28,    39,    89,   109,   111,   130,   131,
+     132,   134,   136,     7,   124,   125,   126,    14,    15,    29,
+      89,   109,   111,   145,   146,   147,   149,   151,     7,   140,
+     141,     6,     3,     4,     8,     3,   180,   182,   184,    95,
+     186,     4,     3,     8,   101,     4,     4,   105,   108,   110,
+     112,   114,   116,   153,   172,   190,     3,     8,   167,     4,
+     170,   165,     3,     8,   159,     6,     3,   135,   137,   133,
+       3,     8,   127,     6,     3,   150,     4,   148,     3,     8,
+     142,     3,     6,    78,    78,    63,     4,     4,     4,     4,
+       4,    93,     4,    64,    64,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,    99,     4,    64,     4,     4,   163,
+     162,   158,     4,     4,     4,   131,   130,   126,     4,    64,
+       4,   146,   145,   141,     4,    78,    78,    78,     7,     7,
+      63,    18,    19,   106,    21,    80,    82,    63,     7,     7,
+       5,     7,     5,    63,    63,    63,     8,    63,     5,    63,
+       8,    63,    63,     8,    78,    98,   187,   188,   189,    26,
+      89,   117,   118,   119,   120,   117,   156,    35,    36,    89,
+     109,   111,   173,   174,   175,   177,     7,   191,   192,   140,
+       8,     3,     8,   121,     3,     8,     8,     6,   176,   178,
+       3,     8,   193,     3,     6,     6,   188,     4,   119,     4,
+       4,   174,    39,    40,    42,    43,    51,    52,    53,    89,
+     109,   111,   194,   195,   196,   198,   199,   201,   203,   204,
+     205,   192,     5,    63,    63,   197,   206,     4,   200,   202,
+       4,     4,     3,     8,   124,     4,     4,    64,     4,     4,
+      64,    64,   195,     6,    63,     5,    63,    85,     7,   207,
+     208,   209,     3,     6,    41,    44,    45,    46,    47,    48,
+      49,    50,   210,   211,   212,   214,   215,   216,   217,   219,
+     220,   221,   208,   213,     4,     4,     4,   218,     4,     4,
+     222,     3,     8,     4,    66,    64,    64,     4,    66,    64,
+       4,   211,    63,    63,    63
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    61,    63,    62,    64,    62,    65,    62,    66,    62,
-      67,    62,    68,    62,    69,    62,    70,    62,    71,    62,
-      72,    72,    72,    72,    72,    72,    72,    73,    75,    74,
-      76,    77,    77,    78,    78,    80,    79,    81,    81,    82,
-      82,    83,    85,    84,    86,    86,    87,    87,    87,    87,
-      87,    87,    89,    88,    91,    90,    92,    92,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-      93,    95,    94,    96,    97,    99,    98,   100,   100,   102,
-     101,   104,   103,   106,   105,   108,   107,   110,   109,   111,
-     111,   112,   112,   113,   113,   115,   114,   117,   116,   118,
-     118,   119,   119,   121,   120,   123,   122,   124,   124,   125,
-     125,   125,   125,   125,   125,   127,   126,   129,   128,   131,
-     130,   133,   132,   134,   134,   136,   135,   138,   137,   139,
-     139,   140,   140,   140,   140,   140,   140,   142,   141,   144,
-     143,   145,   147,   146,   149,   148,   150,   150,   151,   151,
-     153,   152,   155,   154,   156,   156,   157,   157,   157,   157,
-     157,   157,   157,   159,   158,   161,   160,   162,   164,   163,
-     166,   165,   167,   167,   168,   168,   168,   168,   168,   170,
-     169,   172,   171,   174,   173,   176,   175,   178,   177,   180,
-     179,   181,   181,   182,   184,   183,   185,   185,   187,   186,
-     188,   188,   189,   189,   189,   189,   189,   189,   189,   191,
-     190,   192,   194,   193,   196,   195,   197,   197,   199,   198,
-     200,   200,   201,   201,   201,   201,   201,   203,   202,   204,
-     205,   206,   208,   207
+       0,    67,    69,    68,    70,    68,    71,    68,    72,    68,
+      73,    68,    74,    68,    75,    68,    76,    68,    77,    68,
+      78,    78,    78,    78,    78,    78,    78,    79,    81,    80,
+      82,    83,    83,    84,    84,    86,    85,    87,    87,    88,
+      88,    89,    91,    90,    92,    92,    93,    93,    93,    93,
+      93,    93,    95,    94,    97,    96,    98,    98,    99,    99,
+      99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
+      99,   101,   100,   102,   103,   105,   104,   106,   106,   108,
+     107,   110,   109,   112,   111,   114,   113,   116,   115,   117,
+     117,   118,   118,   119,   119,   121,   120,   123,   122,   124,
+     124,   125,   125,   127,   126,   129,   128,   130,   130,   131,
+     131,   131,   131,   131,   131,   133,   132,   135,   134,   137,
+     136,   139,   138,   140,   140,   142,   141,   144,   143,   145,
+     145,   146,   146,   146,   146,   146,   146,   148,   147,   150,
+     149,   151,   153,   152,   155,   154,   156,   156,   157,   157,
+     159,   158,   161,   160,   162,   162,   163,   163,   163,   163,
+     163,   163,   163,   165,   164,   167,   166,   168,   170,   169,
+     172,   171,   173,   173,   174,   174,   174,   174,   174,   176,
+     175,   178,   177,   180,   179,   182,   181,   184,   183,   186,
+     185,   187,   187,   188,   190,   189,   191,   191,   193,   192,
+     194,   194,   195,   195,   195,   195,   195,   195,   195,   195,
+     195,   195,   197,   196,   198,   200,   199,   202,   201,   203,
+     204,   206,   205,   207,   207,   209,   208,   210,   210,   211,
+     211,   211,   211,   211,   211,   211,   211,   213,   212,   214,
+     215,   216,   218,   217,   219,   220,   222,   221
   };
 
   const unsigned char
@@ -2408,10 +2495,11 @@ namespace isc { namespace d2 {
        0,     6,     1,     3,     1,     1,     1,     1,     1,     0,
        4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
        6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     0,     4,     3,
-       3,     3,     0,     4
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     3,     0,     4,     0,     4,     3,
+       3,     0,     6,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
+       3,     3,     0,     4,     3,     3,     0,     4
   };
 
 
@@ -2432,6 +2520,8 @@ namespace isc { namespace d2 {
   "\"socket-type\"", "\"socket-name\"", "\"Logging\"", "\"loggers\"",
   "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
   "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"pattern\"",
+  "\"async\"", "\"async-queue-size\"", "\"async-overflow\"",
+  "\"rate-limited-messages\"", "\"rate-limit\"", "\"rate-limit-interval\"",
   "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS", "SUB_TSIG_KEY",
   "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER",
   "SUB_DNS_SERVERS", "\"constant string\"", "\"integer\"",
@@ -2464,40 +2554,43 @@ namespace isc { namespace d2 {
   "control_agent_json_object", "$@46", "logging_object", "$@47",
   "logging_params", "logging_param", "loggers", "$@48", "loggers_entries",
   "logger_entry", "$@49", "logger_params", "logger_param", "name", "$@50",
-  "debuglevel", "severity", "$@51", "output_options_list", "$@52",
-  "output_options_list_content", "output_entry", "$@53",
-  "output_params_list", "output_params", "output", "$@54", "flush",
-  "maxsize", "maxver", "pattern", "$@55", YY_NULLPTR
+  "debuglevel", "severity", "$@51", "rate_limited_messages", "$@52",
+  "rate_limit", "rate_limit_interval", "output_options_list", "$@53",
+  "output_options_list_content", "output_entry", "$@54",
+  "output_params_list", "output_params", "output", "$@55", "flush",
+  "maxsize", "maxver", "pattern", "$@56", "async", "async_queue_size",
+  "async_overflow", "$@57", YY_NULLPTR
   };
 
 #if D2_PARSER_DEBUG
   const unsigned short
   D2Parser::yyrline_[] =
   {
-       0,   125,   125,   125,   126,   126,   127,   127,   128,   128,
-     129,   129,   130,   130,   131,   131,   132,   132,   133,   133,
-     141,   142,   143,   144,   145,   146,   147,   150,   155,   155,
-     166,   169,   170,   173,   177,   184,   184,   191,   192,   195,
-     199,   210,   220,   220,   232,   233,   237,   238,   239,   240,
-     241,   242,   247,   247,   257,   257,   265,   266,   270,   271,
-     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
-     282,   285,   285,   293,   301,   310,   310,   318,   319,   322,
-     322,   330,   330,   355,   355,   382,   382,   392,   392,   402,
-     403,   406,   407,   410,   411,   416,   416,   426,   426,   433,
-     434,   437,   438,   441,   441,   449,   449,   456,   457,   460,
-     461,   462,   463,   464,   465,   469,   469,   481,   481,   493,
-     493,   503,   503,   510,   511,   514,   514,   522,   522,   529,
-     530,   533,   534,   535,   536,   537,   538,   541,   541,   553,
-     553,   561,   575,   575,   585,   585,   592,   593,   596,   597,
-     600,   600,   608,   608,   617,   618,   621,   622,   623,   624,
-     625,   626,   627,   630,   630,   642,   642,   653,   661,   661,
-     677,   677,   687,   688,   691,   692,   693,   694,   695,   698,
-     698,   706,   706,   716,   716,   723,   723,   730,   730,   742,
-     742,   755,   756,   760,   764,   764,   776,   777,   781,   781,
-     789,   790,   793,   794,   795,   796,   797,   798,   799,   802,
-     802,   810,   814,   814,   822,   822,   832,   833,   836,   836,
-     844,   845,   848,   849,   850,   851,   852,   855,   855,   863,
-     868,   873,   878,   878
+       0,   131,   131,   131,   132,   132,   133,   133,   134,   134,
+     135,   135,   136,   136,   137,   137,   138,   138,   139,   139,
+     147,   148,   149,   150,   151,   152,   153,   156,   161,   161,
+     172,   175,   176,   179,   183,   190,   190,   197,   198,   201,
+     205,   216,   226,   226,   238,   239,   243,   244,   245,   246,
+     247,   248,   253,   253,   263,   263,   271,   272,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   291,   291,   299,   307,   316,   316,   324,   325,   328,
+     328,   336,   336,   361,   361,   388,   388,   398,   398,   408,
+     409,   412,   413,   416,   417,   422,   422,   432,   432,   439,
+     440,   443,   444,   447,   447,   455,   455,   462,   463,   466,
+     467,   468,   469,   470,   471,   475,   475,   487,   487,   499,
+     499,   509,   509,   516,   517,   520,   520,   528,   528,   535,
+     536,   539,   540,   541,   542,   543,   544,   547,   547,   559,
+     559,   567,   581,   581,   591,   591,   598,   599,   602,   603,
+     606,   606,   614,   614,   623,   624,   627,   628,   629,   630,
+     631,   632,   633,   636,   636,   648,   648,   659,   667,   667,
+     683,   683,   693,   694,   697,   698,   699,   700,   701,   704,
+     704,   712,   712,   722,   722,   729,   729,   736,   736,   748,
+     748,   761,   762,   766,   770,   770,   782,   783,   787,   787,
+     795,   796,   799,   800,   801,   802,   803,   804,   805,   806,
+     807,   808,   811,   811,   819,   823,   823,   831,   831,   840,
+     845,   850,   850,   860,   861,   864,   864,   872,   873,   876,
+     877,   878,   879,   880,   881,   882,   883,   886,   886,   894,
+     899,   904,   909,   909,   917,   922,   927,   927
   };
 
   // Print the state stack on the debug stream.
@@ -2532,7 +2625,7 @@ namespace isc { namespace d2 {
 
 #line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2536 "d2_parser.cc"
+#line 2629 "d2_parser.cc"
 
 #line 886 "d2_parser.yy"
 
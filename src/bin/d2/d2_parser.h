@@ -493,19 +493,25 @@ namespace isc { namespace d2 {
         TOKEN_MAXSIZE = 300,
         TOKEN_MAXVER = 301,
         TOKEN_PATTERN = 302,
-        TOKEN_TOPLEVEL_JSON = 303,
-        TOKEN_TOPLEVEL_DHCPDDNS = 304,
-        TOKEN_SUB_DHCPDDNS = 305,
-        TOKEN_SUB_TSIG_KEY = 306,
-        TOKEN_SUB_TSIG_KEYS = 307,
-        TOKEN_SUB_DDNS_DOMAIN = 308,
-        TOKEN_SUB_DDNS_DOMAINS = 309,
-        TOKEN_SUB_DNS_SERVER = 310,
-        TOKEN_SUB_DNS_SERVERS = 311,
-        TOKEN_STRING = 312,
-        TOKEN_INTEGER = 313,
-        TOKEN_FLOAT = 314,
-        TOKEN_BOOLEAN = 315
+        TOKEN_ASYNC = 303,
+        TOKEN_ASYNC_QUEUE_SIZE = 304,
+        TOKEN_ASYNC_OVERFLOW = 305,
+        TOKEN_RATE_LIMITED_MESSAGES = 306,
+        TOKEN_RATE_LIMIT = 307,
+        TOKEN_RATE_LIMIT_INTERVAL = 308,
+        TOKEN_TOPLEVEL_JSON = 309,
+        TOKEN_TOPLEVEL_DHCPDDNS = 310,
+        TOKEN_SUB_DHCPDDNS = 311,
+        TOKEN_SUB_TSIG_KEY = 312,
+        TOKEN_SUB_TSIG_KEYS = 313,
+        TOKEN_SUB_DDNS_DOMAIN = 314,
+        TOKEN_SUB_DDNS_DOMAINS = 315,
+        TOKEN_SUB_DNS_SERVER = 316,
+        TOKEN_SUB_DNS_SERVERS = 317,
+        TOKEN_STRING = 318,
+        TOKEN_INTEGER = 319,
+        TOKEN_FLOAT = 320,
+        TOKEN_BOOLEAN = 321
       };
     };
 
@@ -647,25 +653,25 @@ namespace isc { namespace d2 {
         // Type destructor.
 switch (yytype)
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -748,13 +754,13 @@ switch (yytype)
       symbol_type (int tok, location_type l)
         : super_type(token_type (tok), std::move (l))
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_PORT || tok == token::TOKEN_DNS_SERVER_TIMEOUT || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_JSON || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_FORWARD_DDNS || tok == token::TOKEN_REVERSE_DDNS || tok == token::TOKEN_DDNS_DOMAINS || tok == token::TOKEN_KEY_NAME || tok == token::TOKEN_DNS_SERVERS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_TSIG_KEYS || tok == token::TOKEN_ALGORITHM || tok == token::TOKEN_DIGEST_BITS || tok == token::TOKEN_SECRET || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCPDDNS || tok == token::TOKEN_SUB_DHCPDDNS || tok == token::TOKEN_SUB_TSIG_KEY || tok == token::TOKEN_SUB_TSIG_KEYS || tok == token::TOKEN_SUB_DDNS_DOMAIN || tok == token::TOKEN_SUB_DDNS_DOMAINS || tok == token::TOKEN_SUB_DNS_SERVER || tok == token::TOKEN_SUB_DNS_SERVERS);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_PORT || tok == token::TOKEN_DNS_SERVER_TIMEOUT || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_JSON || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_FORWARD_DDNS || tok == token::TOKEN_REVERSE_DDNS || tok == token::TOKEN_DDNS_DOMAINS || tok == token::TOKEN_KEY_NAME || tok == token::TOKEN_DNS_SERVERS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_TSIG_KEYS || tok == token::TOKEN_ALGORITHM || tok == token::TOKEN_DIGEST_BITS || tok == token::TOKEN_SECRET || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCPDDNS || tok == token::TOKEN_SUB_DHCPDDNS || tok == token::TOKEN_SUB_TSIG_KEY || tok == token::TOKEN_SUB_TSIG_KEYS || tok == token::TOKEN_SUB_DDNS_DOMAIN || tok == token::TOKEN_SUB_DDNS_DOMAINS || tok == token::TOKEN_SUB_DNS_SERVER || tok == token::TOKEN_SUB_DNS_SERVERS);
       }
 #else
       symbol_type (int tok, const location_type& l)
         : super_type(token_type (tok), l)
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_PORT || tok == token::TOKEN_DNS_SERVER_TIMEOUT || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_JSON || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_FORWARD_DDNS || tok == token::TOKEN_REVERSE_DDNS || tok == token::TOKEN_DDNS_DOMAINS || tok == token::TOKEN_KEY_NAME || tok == token::TOKEN_DNS_SERVERS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_TSIG_KEYS || tok == token::TOKEN_ALGORITHM || tok == token::TOKEN_DIGEST_BITS || tok == token::TOKEN_SECRET || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCPDDNS || tok == token::TOKEN_SUB_DHCPDDNS || tok == token::TOKEN_SUB_TSIG_KEY || tok == token::TOKEN_SUB_TSIG_KEYS || tok == token::TOKEN_SUB_DDNS_DOMAIN || tok == token::TOKEN_SUB_DDNS_DOMAINS || tok == token::TOKEN_SUB_DNS_SERVER || tok == token::TOKEN_SUB_DNS_SERVERS);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_PORT || tok == token::TOKEN_DNS_SERVER_TIMEOUT || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_JSON || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_FORWARD_DDNS || tok == token::TOKEN_REVERSE_DDNS || tok == token::TOKEN_DDNS_DOMAINS || tok == token::TOKEN_KEY_NAME || tok == token::TOKEN_DNS_SERVERS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_TSIG_KEYS || tok == token::TOKEN_ALGORITHM || tok == token::TOKEN_DIGEST_BITS || tok == token::TOKEN_SECRET || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCPDDNS || tok == token::TOKEN_SUB_DHCPDDNS || tok == token::TOKEN_SUB_TSIG_KEY || tok == token::TOKEN_SUB_TSIG_KEYS || tok == token::TOKEN_SUB_DDNS_DOMAIN || tok == token::TOKEN_SUB_DDNS_DOMAINS || tok == token::TOKEN_SUB_DNS_SERVER || tok == token::TOKEN_SUB_DNS_SERVERS);
       }
 #endif
 #if 201103L <= YY_CPLUSPLUS
@@ -1536,6 +1542,96 @@ switch (yytype)
         return symbol_type (token::TOKEN_PATTERN, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -2037,12 +2133,12 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 304,     ///< Last index in yytable_.
-      yynnts_ = 148,  ///< Number of nonterminal symbols.
+      yylast_ = 313,     ///< Last index in yytable_.
+      yynnts_ = 156,  ///< Number of nonterminal symbols.
       yyfinal_ = 20, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 61  ///< Number of tokens.
+      yyntokens_ = 67  ///< Number of tokens.
     };
 
 
@@ -2091,9 +2187,10 @@ switch (yytype)
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66
     };
-    const unsigned user_token_number_max_ = 315;
+    const unsigned user_token_number_max_ = 321;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int> (t) <= yyeof_)
@@ -2114,25 +2211,25 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -2151,25 +2248,25 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -2195,25 +2292,25 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 72: // value
-      case 76: // map_value
-      case 100: // ncr_protocol_value
+      case 78: // value
+      case 82: // map_value
+      case 106: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 60: // "boolean"
+      case 66: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 59: // "floating point"
+      case 65: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 58: // "integer"
+      case 64: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 57: // "constant string"
+      case 63: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -2287,14 +2384,14 @@ switch (yytype)
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
      305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315
+     315,   316,   317,   318,   319,   320,   321
     };
     return token_type (yytoken_number_[type]);
   }
 
 #line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2298 "d2_parser.h"
+#line 2395 "d2_parser.h"
 
 
 
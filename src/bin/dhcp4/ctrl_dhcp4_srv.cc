@@ -19,6 +19,8 @@
 #include <hooks/hooks.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+#include <util/trace_mgr.h>
 #include <cfgrpt/config_report.h>
 #include <signal.h>
 #include <sstream>
@@ -29,6 +31,7 @@ using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::stats;
+using namespace isc::util;
 using namespace std;
 
 namespace {
@@ -547,6 +550,29 @@ ControlledDhcpv4Srv::commandServerTagGetHandler(const std::string&,
     return (createAnswer(CONTROL_RESULT_SUCCESS, response));
 }
 
+ConstElementPtr
+ControlledDhcpv4Srv::commandTraceStartHandler(const std::string&,
+                                            ConstElementPtr) {
+    isc::util::TraceMgr::instance().clear();
+    isc::util::TraceMgr::instance().setEnabled(true);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, "Tracing started."));
+}
+
+ConstElementPtr
+ControlledDhcpv4Srv::commandTraceStopHandler(const std::string&,
+                                           ConstElementPtr) {
+    isc::util::TraceMgr::instance().setEnabled(false);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, "Tracing stopped."));
+}
+
+ConstElementPtr
+ControlledDhcpv4Srv::commandTraceGetHandler(const std::string&,
+                                          ConstElementPtr) {
+    std::ostringstream s;
+    isc::util::TraceMgr::instance().toChromeTrace(s);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, Element::fromJSON(s.str())));
+}
+
 ConstElementPtr
 ControlledDhcpv4Srv::commandConfigBackendPullHandler(const std::string&,
                                                       ConstElementPtr) {
@@ -711,7 +737,13 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
             boost::bind(&ControlledDhcpv4Srv::dbLostCallback, srv, _1);
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
         cfg_db->setAppendedParameters("universe=4");
-        cfg_db->createManagers();
+
+        // The background reclamation must not use the lease manager being
+        // replaced.
+        if (srv->alloc_engine_) {
+            srv->alloc_engine_->stopBackgroundReclamation();
+        }
+        srv->openDatabases(CfgMgr::instance().getStagingCfg());
     } catch (const std::exception& ex) {
         err << "Unable to open database: " << ex.what();
         return (isc::config::createAnswer(1, err.str()));
@@ -852,7 +884,8 @@ ControlledDhcpv4Srv::checkConfig(isc::data::ConstElementPtr config) {
 ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_PORT*/,
                                          uint16_t client_port /*= 0*/)
     : Dhcpv4Srv(server_port, client_port), io_service_(),
-      timer_mgr_(TimerMgr::instance()) {
+      timer_mgr_(TimerMgr::instance()),
+      main_thread_id_(std::this_thread::get_id()), db_lost_posted_(false) {
     if (getInstance()) {
         isc_throw(InvalidOperation,
                   "There is another Dhcpv4Srv instance already.");
@@ -894,6 +927,9 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("dhcp-disable",
         boost::bind(&ControlledDhcpv4Srv::commandDhcpDisableHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("hooks-stats-get",
+        boost::bind(&HooksManager::hooksStatsGetHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("libreload",
         boost::bind(&ControlledDhcpv4Srv::commandLibReloadHandler, this, _1, _2));
 
@@ -909,6 +945,15 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("status-get",
         boost::bind(&ControlledDhcpv4Srv::commandStatusGetHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("trace-get",
+        boost::bind(&ControlledDhcpv4Srv::commandTraceGetHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("trace-start",
+        boost::bind(&ControlledDhcpv4Srv::commandTraceStartHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("trace-stop",
+        boost::bind(&ControlledDhcpv4Srv::commandTraceStopHandler, this, _1, _2));
+
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv4Srv::commandVersionGetHandler, this, _1, _2));
 
@@ -925,6 +970,9 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("statistic-get-all",
         boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-get-all-prometheus",
+        boost::bind(&StatsMgr::statisticGetAllPrometheusHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("statistic-reset-all",
         boost::bind(&StatsMgr::statisticResetAllHandler, _1, _2));
 
@@ -951,6 +999,13 @@ void ControlledDhcpv4Srv::shutdown() {
 
 ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
     try {
+        // Wait for the background reclamation and the asynchronous lease
+        // queries before the lease manager is destroyed.
+        if (alloc_engine_) {
+            alloc_engine_->stopBackgroundReclamation();
+        }
+        stopAsyncLeaseQueries();
+
         cleanup();
 
         // The closure captures either a shared pointer (memory leak)
@@ -972,12 +1027,14 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("config-write");
         CommandMgr::instance().deregisterCommand("dhcp-disable");
         CommandMgr::instance().deregisterCommand("dhcp-enable");
+        CommandMgr::instance().deregisterCommand("hooks-stats-get");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("server-tag-get");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
+        CommandMgr::instance().deregisterCommand("statistic-get-all-prometheus");
         CommandMgr::instance().deregisterCommand("statistic-remove");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
         CommandMgr::instance().deregisterCommand("statistic-reset");
@@ -987,6 +1044,9 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set-all");
         CommandMgr::instance().deregisterCommand("status-get");
+        CommandMgr::instance().deregisterCommand("trace-get");
+        CommandMgr::instance().deregisterCommand("trace-start");
+        CommandMgr::instance().deregisterCommand("trace-stop");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
@@ -1012,6 +1072,17 @@ ControlledDhcpv4Srv::reclaimExpiredLeases(const size_t max_leases,
                                           const uint16_t timeout,
                                           const bool remove_lease,
                                           const uint16_t max_unwarned_cycles) {
+    if (CfgMgr::instance().getCurrentCfg()->getCfgExpiration()->
+        getBackgroundReclamation()) {
+        // The timer is re-scheduled when the pass is complete.
+        server_->alloc_engine_->reclaimExpiredLeases4InBackground(
+            max_leases, timeout, remove_lease, max_unwarned_cycles,
+            server_->getIOService(), [] () {
+                TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+            });
+        return;
+    }
+
     server_->alloc_engine_->reclaimExpiredLeases4(max_leases, timeout,
                                                   remove_lease,
                                                   max_unwarned_cycles);
@@ -1026,14 +1097,44 @@ ControlledDhcpv4Srv::deleteExpiredReclaimedLeases(const uint32_t secs) {
     TimerMgr::instance()->setup(CfgExpiration::FLUSH_RECLAIMED_TIMER_NAME);
 }
 
+void
+ControlledDhcpv4Srv::openDatabases(const SrvConfigPtr& cfg) {
+    // The lease manager is used from several threads when the background
+    // reclamation or the asynchronous lease queries are enabled, so the
+    // mode must be set before the managers are created.
+    const size_t lease_query_threads = getAsyncLeaseQueryThreads(cfg);
+    MultiThreadingMgr::instance().setMode((lease_query_threads > 0) ||
+        cfg->getCfgExpiration()->getBackgroundReclamation());
+
+    cfg->getCfgDbAccess()->createManagers();
+
+    // The worker threads of the asynchronous lease queries were stopped
+    // with the previous lease manager.
+    startAsyncLeaseQueries(lease_query_threads);
+}
+
 void
 ControlledDhcpv4Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
     bool reopened = false;
 
     // Re-open lease and host database with new parameters.
     try {
-        CfgDbAccessPtr cfg_db = CfgMgr::instance().getCurrentCfg()->getCfgDbAccess();
-        cfg_db->createManagers();
+        // The background reclamation pass in progress is cancelled so the
+        // reclamation timer has to be re-scheduled.
+        if (alloc_engine_ && CfgMgr::instance().getCurrentCfg()->
+            getCfgExpiration()->getBackgroundReclamation()) {
+            alloc_engine_->stopBackgroundReclamation();
+            if (TimerMgr::instance()->
+                isTimerRegistered(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME)) {
+                TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+            }
+        }
+
+        // The asynchronous lease queries must not use the lease manager
+        // being replaced. The packets waiting for them are dropped.
+        stopAsyncLeaseQueries();
+
+        openDatabases(CfgMgr::instance().getCurrentCfg());
         reopened = true;
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_DB_RECONNECT_ATTEMPT_FAILED).arg(ex.what());
@@ -1077,6 +1178,19 @@ ControlledDhcpv4Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
 
 bool
 ControlledDhcpv4Srv::dbLostCallback(ReconnectCtlPtr db_reconnect_ctl) {
+    // The recovery stops the threads using the lease manager, so it must
+    // not run in one of them.
+    if (std::this_thread::get_id() != main_thread_id_) {
+        if (!db_lost_posted_.exchange(true)) {
+            getIOService()->post([this, db_reconnect_ctl]() {
+                db_lost_posted_ = false;
+                dbLostCallback(db_reconnect_ctl);
+            });
+        }
+        return (db_reconnect_ctl && db_reconnect_ctl->retriesLeft() &&
+                db_reconnect_ctl->retryInterval());
+    }
+
     // Disable service until we recover
     network_state_->disableService();
 
@@ -15,6 +15,9 @@
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp4/dhcp4_srv.h>
 
+#include <atomic>
+#include <thread>
+
 namespace isc {
 namespace dhcp {
 
@@ -329,6 +332,41 @@ private:
     commandStatusGetHandler(const std::string& command,
                             isc::data::ConstElementPtr args);
 
+    /// @brief handler for processing 'trace-start' command
+    ///
+    /// This handler clears the trace rings and enables the tracing of
+    /// the packet processing.
+    ///
+    /// @param command (ignored)
+    /// @param args (ignored)
+    /// @return status of the command
+    isc::data::ConstElementPtr
+    commandTraceStartHandler(const std::string& command,
+                             isc::data::ConstElementPtr args);
+
+    /// @brief handler for processing 'trace-stop' command
+    ///
+    /// This handler disables the tracing, the recorded events are kept.
+    ///
+    /// @param command (ignored)
+    /// @param args (ignored)
+    /// @return status of the command
+    isc::data::ConstElementPtr
+    commandTraceStopHandler(const std::string& command,
+                            isc::data::ConstElementPtr args);
+
+    /// @brief handler for processing 'trace-get' command
+    ///
+    /// This handler returns the recorded events in the Chrome trace
+    /// event format.
+    ///
+    /// @param command (ignored)
+    /// @param args (ignored)
+    /// @return the trace wrapped in a response
+    isc::data::ConstElementPtr
+    commandTraceGetHandler(const std::string& command,
+                           isc::data::ConstElementPtr args);
+
     /// @brief Reclaims expired IPv4 leases and reschedules timer.
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases4.
@@ -359,6 +397,18 @@ private:
     /// deleted.
     void deleteExpiredReclaimedLeases(const uint32_t secs);
 
+    /// @brief Opens the lease and host databases of a configuration
+    ///
+    /// Sets the multi-threading mode required by the asynchronous lease
+    /// queries and the background reclamation, creates the lease and host
+    /// managers and starts the worker threads of the asynchronous lease
+    /// queries, all from the given configuration. It is used when a new
+    /// configuration is applied and when the databases are reconnected.
+    ///
+    /// @param cfg Configuration holding the database access and the
+    /// threading parameters.
+    void openDatabases(const SrvConfigPtr& cfg);
+
     /// @brief Attempts to reconnect the server to the DB backend managers
     ///
     /// This is a self-rescheduling function that attempts to reconnect to the
@@ -393,6 +443,10 @@ private:
     /// Otherwise, the function saves db_reconnect_ctl and invokes
     /// dbReconnect to initiate the reconnect process.
     ///
+    /// When the loss is detected by another thread than the main thread,
+    /// e.g. by a worker of the asynchronous lease queries, the recovery is
+    /// posted to the IO service as it stops these threads.
+    ///
     /// @param db_reconnect_ctl pointer to the ReconnectCtl containing the
     /// configured reconnect parameters
     ///
@@ -427,6 +481,13 @@ private:
     /// Shared pointer to the instance of timer @c TimerMgr is held here to
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Identifier of the thread running the server.
+    std::thread::id main_thread_id_;
+
+    /// @brief Indicates that the recovery of a connection lost by another
+    /// thread has been posted to the IO service.
+    std::atomic<bool> db_lost_posted_;
 };
 
 }; // namespace isc::dhcp
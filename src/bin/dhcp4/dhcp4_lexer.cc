@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 194
-#define YY_END_OF_BUFFER 195
+#define YY_NUM_RULES 209
+#define YY_END_OF_BUFFER 210
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,198 +700,217 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1724] =
+static const flex_int16_t yy_accept[1899] =
     {   0,
-      187,  187,    0,    0,    0,    0,    0,    0,    0,    0,
-      195,  193,   10,   11,  193,    1,  187,  184,  187,  187,
-      193,  186,  185,  193,  193,  193,  193,  193,  180,  181,
-      193,  193,  193,  182,  183,    5,    5,    5,  193,  193,
-      193,   10,   11,    0,    0,  176,    0,    0,    0,    0,
+      202,  202,    0,    0,    0,    0,    0,    0,    0,    0,
+      210,  208,   10,   11,  208,    1,  202,  199,  202,  202,
+      208,  201,  200,  208,  208,  208,  208,  208,  195,  196,
+      208,  208,  208,  197,  198,    5,    5,    5,  208,  208,
+      208,   10,   11,    0,    0,  191,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      187,  187,    0,  186,  187,    3,    2,    6,    0,  187,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        1,  202,  202,    0,  201,    3,    2,    6,    0,  202,
         0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
 
-        0,  177,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  179,    0,    0,    0,
+      192,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  194,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    2,    0,    0,    0,    0,    0,    0,
-        0,    8,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,  178,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  193,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   79,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   84,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-      192,  190,    0,  189,  188,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  156,    0,  155,    0,    0,
-       85,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   35,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  207,  205,    0,  204,  203,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      171,    0,  170,    0,    0,   90,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   40,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   82,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   17,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   87,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   17,
 
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,   18,    0,    0,    0,    0,
-      191,  188,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  157,    0,    0,  159,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   86,    0,    0,    0,
-        0,    0,    0,    0,   71,    0,    0,    0,    0,    0,
-        0,  107,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   38,    0,    0,    0,    0,    0,    0,    0,
+        0,  206,  203,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  172,    0,    0,  174,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   91,    0,    0,    0,    0,    0,    0,    0,   76,
+        0,    0,    0,    0,    0,    0,  120,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   43,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   70,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   74,    0,   39,
+        0,    0,    0,    0,    0,    0,    0,    0,   75,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   79,    0,   44,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  104,
-       31,    0,    0,   36,    0,    0,    0,    0,    0,    0,
-        0,    0,   12,  164,    0,  161,    0,  160,    0,    0,
-        0,  117,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  117,   36,    0,    0,
+       41,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       12,  179,    0,  176,    0,  175,    0,    0,    0,    0,
+      130,  110,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   96,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   33,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   73,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  118,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  113,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    7,    0,    0,  162,
+        0,    0,    0,    0,    0,  106,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   38,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   78,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  131,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  126,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    7,    0,    0,  177,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,   84,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   98,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   94,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   77,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   91,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   76,    0,    0,    0,    0,    0,    0,
+        0,   89,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  108,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  101,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,   82,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   98,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  111,
+        0,    0,    0,    0,    0,    0,    0,   81,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  123,   92,    0,    0,    0,    0,
-        0,    0,   97,   32,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   99,   40,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  124,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  136,
+       99,    0,    0,    0,    0,    0,    0,  107,   37,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   66,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  165,    0,    0,
 
-        0,    0,    0,    0,  138,    0,    0,    0,    0,    0,
+        0,  109,   45,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   81,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  112,    0,
-        0,    0,    0,    0,   43,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   37,    0,    0,    0,
-        0,   30,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   71,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  180,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      153,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      100,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   86,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  125,    0,    0,    0,    0,    0,
 
+       48,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   42,    0,    0,    0,    0,    0,    0,
+       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  113,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  109,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  139,
+        0,  122,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  154,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   78,    0,    0,    0,
+        0,    0,    0,    0,   83,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,   23,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  144,    0,    0,    0,
-      142,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  159,    0,    0,
+        0,  157,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  184,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  123,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,  169,    0,    0,    0,    0,
-        0,    0,    0,  110,    0,    0,    0,    0,    0,    0,
-        0,    0,  114,    0,    0,    0,    0,    0,   95,    0,
+        0,    0,  127,    0,    0,    0,    0,    0,  102,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  108,   22,    0,  119,    0,
+        0,    0,    0,    0,    0,  121,   22,    0,  132,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      148,    0,    0,    0,    0,   68,    0,    0,    0,    0,
-        0,  122,   34,    0,  137,    0,    0,    0,    0,    0,
+        0,  163,    0,    0,    0,    0,   73,    0,    0,    0,
+        0,    0,  135,   39,    0,  152,  104,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       59,    0,    0,    0,   89,   90,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   64,    0,    0,    0,   94,
+       95,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   77,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,   72,    0,    0,    0,
-        0,    0,    0,    0,    0,   44,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   49,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  129,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  188,    0,   74,
+       88,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   61,    0,    0,    0,    0,    0,    0,
+        0,  160,    0,    0,  158,    0,  149,  148,    0,   54,
+        0,   21,    0,    0,    0,    0,    0,    0,    0,  173,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
       116,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  145,    0,  151,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  133,
+       15,    0,    0,   46,    0,    0,    0,    0,    0,    0,
+        0,    0,  162,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   62,    0,    0,  128,    0,    0,    0,    0,
+      119,    0,    0,    0,    0,    0,    0,    0,   80,    0,
+        0,    0,  182,    0,  181,    0,    0,    0,    0,  187,
+        0,    0,   33,   97,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  173,    0,   69,   83,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   56,    0,    0,    0,    0,
-        0,    0,    0,  145,    0,    0,  143,    0,  134,  133,
-        0,   49,    0,   21,    0,    0,    0,    0,    0,  158,
-        0,    0,    0,  103,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  131,
-        0,  136,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  120,   15,    0,   41,    0,    0,    0,    0,
-        0,    0,    0,    0,  147,    0,    0,    0,    0,    0,
-        0,   57,    0,    0,  115,    0,    0,    0,    0,  106,
-        0,    0,    0,    0,    0,    0,    0,   75,    0,  167,
-        0,  166,    0,  172,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       34,    0,    0,    0,    0,    0,    0,    0,   14,    0,
+        0,    0,   53,    0,    0,    0,    0,    0,    0,    0,
+      112,    0,    0,  190,    0,    0,  114,   27,    0,    0,
+        0,   55,  147,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  185,  155,    0,    0,    0,    0,    0,    0,
+        0,    0,   25,    0,    0,   24,    0,    0,  161,    0,
+        0,    0,   57,    0,    0,    0,    0,  100,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   14,    0,    0,    0,   48,    0,
-        0,    0,    0,  175,    0,  101,   27,    0,    0,    0,
-       50,  132,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  170,  140,    0,    0,    0,    0,    0,    0,    0,
-        0,   25,    0,    0,   24,    0,  146,    0,    0,    0,
-       52,    0,    0,    0,    0,   93,    0,    0,    0,    0,
+        0,    0,    0,    0,   58,    0,    0,    0,    0,    0,
+        0,    0,   96,    0,    0,    0,   47,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       53,    0,    0,    0,    0,    0,   42,    0,    0,    0,
+      134,    0,    0,    0,   26,    0,    0,  186,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-      121,    0,    0,    0,   26,    0,  171,    0,    0,    0,
+        0,    0,    0,   52,    0,    0,   20,    0,  189,   72,
+        0,    0,    0,  183,  178,    0,  111,    0,    0,   28,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   16,
+        0,    0,  167,    0,    0,    0,    0,    0,    0,    0,
+
+      142,    0,    0,    0,  118,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   85,    0,    0,    0,    0,
+       35,    0,    0,    0,    0,    0,    0,    0,    0,   65,
+        0,    0,    0,    0,    0,    0,    0,  168,   13,    0,
+        0,    0,    0,    0,    0,    0,    0,  156,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       47,    0,    0,   20,    0,  174,   67,    0,  168,  163,
-        0,   28,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   16,    0,    0,  152,    0,    0,    0,    0,    0,
-        0,  129,    0,    0,    0,  105,    0,    0,    0,    0,
-        0,    0,    0,    0,   80,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   60,    0,    0,    0,    0,    0,
-        0,    0,  153,   13,    0,    0,    0,    0,    0,    0,
-        0,  141,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  135,    0,    0,    0,
-        0,    0,  128,    0,   55,   54,   19,    0,  149,    0,
-        0,    0,    0,   45,    0,   88,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  127,    0,    0,   51,    0,
-        0,   46,  151,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  150,    0,    0,
+        0,    0,    0,    0,  141,    0,   60,   59,   19,    0,
+      164,    0,    0,    0,    0,    0,    0,   50,    0,   32,
+       31,    0,   93,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,  140,    0,    0,  146,   56,    0,  105,    0,
+        0,   51,  166,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   64,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   29,    0,    0,   65,    0,
-        0,    0,    0,    0,    0,  150,    0,  102,    0,    0,
-       61,    0,    0,    0,    0,    0,    0,  125,  130,    0,
-
-       63,   58,    0,    0,    0,    0,    0,  124,    0,    0,
-      154,    0,    0,    0,   62,    0,    0,    0,   87,    0,
-        0,  126,    0
+        0,    0,    0,    0,   69,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  103,    0,    0,    0,  144,
+       29,    0,    0,   70,    0,    0,    0,    0,    0,    0,
+      165,    0,  115,    0,    0,   66,    0,    0,    0,    0,
+        0,    0,  138,  143,    0,   68,   63,    0,    0,    0,
+        0,    0,  137,    0,    0,  169,    0,    0,    0,   67,
+        0,    0,    0,   92,    0,    0,  139,    0
+
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -928,896 +947,1100 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1736] =
+static const flex_int16_t yy_base[1899] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2124, 2125,   34, 2120,  145,    0,  207, 2125,  214,  221,
-       13,  228, 2125, 2100,  118,   25,    2,    6, 2125, 2125,
-       73,   11,   17, 2125, 2125, 2125,  104, 2108, 2061,    0,
-     2098,  108, 2115,   24,  262, 2125, 2057,   67, 2056, 2062,
-       84,   75, 2054,   88,  226,   91,   89,  290,  196, 2053,
-      206,  285,  206,  210,  219,   60,  223, 2062,  247,  290,
-      315,  303,  231, 2045,  297,  321,  343,  324, 2064,    0,
-      380,  387,  401,  408,  424, 2125,    0, 2125,  429,  438,
-      216,  249,  220,  315,  335,  266, 2125, 2061, 2102, 2125,
-
-      342, 2125,  421, 2089,  312, 2047, 2057,  400,   10, 2052,
-      361,  323,  370,  387,  359, 2097,    0,  474,  392, 2039,
-     2036, 2040,  318, 2036, 2044,  412, 2040, 2029, 2030, 2035,
-       78, 2045, 2028, 2037, 2037,   95, 2028,  400, 2029, 2027,
-      405, 2075, 2079, 2019, 2072, 2012, 2035, 2032, 2032, 2026,
-      364, 2019, 2017, 2011, 2016, 2010,  436, 2021, 2014, 2005,
-     2004, 2018,  413, 2004,  419,  413, 1998,  470,  191,  445,
-     2019, 2016, 2017, 2015, 2050, 2049,  433, 1995, 1997,  472,
-     1989, 2006, 1998,    0,  449,  462,  446,  471,  479,  487,
-     1997, 2125,    0, 2042,  492, 1987, 1990,  475,  494, 1998,
-
-      501, 2043,  513, 2042,  498, 2041, 2125,  550, 2040,  523,
-     1999, 1991, 1978, 1994, 1995, 1992, 1989, 1988, 1979,  490,
-     2030, 2024, 1988, 1969, 1966, 1974, 1969, 1983, 1979, 1967,
-     1979, 1979, 1970, 1954, 1958, 1971, 1973, 1970, 1962, 1952,
-     1970, 2125, 1965, 1968, 1949, 1948, 2000, 1947, 1957, 1960,
-      539, 1956, 1995, 1943, 1954, 1992, 1937, 1995, 1930, 1945,
-      498, 1935, 1951, 1932, 1930, 1930, 1936, 1927, 1926, 1933,
-     1923, 1982, 1938, 1937, 1931,  487, 1938, 1933, 1925, 1915,
-     1930, 1929, 1924, 1928,  322, 1926, 1912, 1918, 1925, 1913,
-     1910, 1909,  537, 1904, 1918, 1961, 1920,  531, 1911,  529,
-
-     2125, 2125,  531, 2125, 2125, 1898,    0,  241,  519, 1900,
-      544,  545, 1956, 1907,  517, 2125, 1954, 2125, 1948,  593,
-     2125,  542, 1888, 1897, 1945, 1889, 1906, 1887, 1893, 1945,
-     1900, 1895, 1898, 1893,  525, 2125, 1895, 1939, 1933, 1891,
-     1888,  573, 1894, 1934, 1928, 1881, 1876, 1873, 1924, 1881,
-     1870, 1886, 1920, 1866,  616, 1880, 1865, 1878, 1865, 1875,
-     1870, 1877, 1872, 1868,  524, 1866, 1869, 1864, 1850, 1859,
-     1909,  531, 1903, 2125, 1902, 1852, 1851, 1850, 1843, 1845,
-     1849, 1838, 1855, 1850,  587, 1897, 1850, 1847, 1850, 2125,
-     1849, 1838, 1838, 1850,  565, 1825, 1826, 1847,  575, 1829,
-
-     1880, 1825, 1839, 1842, 1837, 1823, 1835, 1834, 1833, 1832,
-     1831, 1830,  546, 1873, 1872, 2125, 1814, 1813,  620, 1826,
-     2125, 2125, 1825,    0, 1814, 1806,  549, 1811, 1864, 1863,
-     1819, 1861, 2125, 1807, 1859, 2125,  598,  667,  597, 1858,
-     1800, 1811, 1804, 1806, 1805, 1793, 2125, 1798, 1804, 1807,
-     1790, 1805, 1792, 1791, 2125,  585, 1793, 1790,  574, 1788,
-     1790, 2125, 1798, 1795, 1780, 1793, 1788,  644, 1795, 1783,
-     1776, 1827, 2125, 1774, 1790, 1824, 1785, 1782, 1783, 1785,
-     1819, 1770, 1765, 1764, 1815, 1759,  554, 1778, 1752, 1759,
-     1764, 1774, 1813, 2125, 1758, 1754, 1752, 1761, 1755, 1762,
-
-     1746, 1746, 1756, 1759, 1748, 1744, 1742, 2125, 1799, 2125,
-     1741, 1752, 1791, 1736, 1741, 1750, 1744, 1738, 1747, 1789,
-     1783, 1745, 1728, 1728, 1723, 1743, 1718, 1724, 1729, 1722,
-     1730, 1734, 1717, 1775, 1715, 1716, 1715, 1727, 1716, 2125,
-     2125, 1716, 1714, 2125, 1725, 1761, 1721,    0, 1705, 1722,
-     1762, 1710, 2125, 2125, 1707, 2125, 1713, 2125,  602,  611,
-      647, 2125, 1710, 1709, 1716, 1696, 1695, 1748, 1693, 1746,
-     1691, 1690, 1689, 1696, 1689, 1701, 1683, 1683, 1698, 1697,
-     1696, 1695, 1695, 1677, 1682, 1723, 1690, 1682, 1727, 1671,
-     1687, 1686, 2125, 1671, 1668, 1726, 1681, 1673, 1679, 1670,
-
-     1678, 1663, 1679, 1661, 1675,  615, 1657, 1651, 1656, 1671,
-     1668, 1669, 1648, 1658, 1664, 1707, 1662, 1654, 2125, 1647,
-     1649, 1658, 1656, 1695, 1694, 1645,   16, 1654, 1637, 1638,
-     1641, 1634, 2125, 1648, 1627, 1631, 1645, 1637, 1682, 1634,
-     1641, 1679, 2125, 1624, 1638, 1622, 1636, 1639, 1620, 1672,
-     1671, 1670, 1669, 1614, 1667, 1666, 2125,  648, 1628, 1627,
-     1624, 1624, 1622, 1605, 1610, 1612, 2125, 1618, 1608, 2125,
-     1655, 1601, 1658,  623,  629, 1599, 1597, 1604, 1595, 1589,
-     1647,  618, 1651,  619, 1645, 1605, 1643, 1642, 1594, 1592,
-     1600, 1603, 1587, 1588, 1579, 1634, 1585, 1593, 1594, 1630,
-
-     1591, 1585,  607, 1581, 1626, 1630, 1585, 1584, 2125, 1585,
-     1578, 1567, 1580, 1583, 1578, 1579, 1576,  170,  230,  299,
-      327,  384,  405,  438,  549,  629,  623,  598,  665, 2125,
-      670,  623,  620,  622,  633,  686,  649,  638,  651, 2125,
-      641,  652,  653,  655,  699,  700,  643,  654,  639,  662,
-      641,  647,  708,  672,  656,  668,  712,  713,  714,  661,
-      716,  680,  675,  682,  678,  663,  675,  676, 2125,  731,
-      688,  690,  681,  694,  696,  681,  688,  694,  686,  700,
-      705,  746, 2125,  742,  718,  705,  710,  707,  708,  753,
-      706,  704,  713, 2125,  703,  718,  715,  701,  708,  707,
-
-      705,  724,  721,  709,  716,  717,  726,  726,  716,  714,
-      713,  724,  720,  777,  734,  719,  725,  741,  731, 2125,
-      741,  741,  734,  745,  743,  788,  730,  732,  747,  734,
-      794,  751,  737,  740, 2125, 2125,  750,  755,  760,  748,
-      758,  760, 2125, 2125,  761,  765,  752,  746,  751,  769,
-      756,  806,  757,  809,  758,  816, 2125, 2125,  761,  765,
-      764,  761,  821,  774,  764,  765,  761,  774,  785,  769,
-      787,  782,  783,  785,  778,  780,  781,  782,  782,  784,
-      799,  840,  797,  802,  779, 2125,  791,  792,  806,  796,
-      843,  801,  791,  806,  807,  794,  808, 2125,  827,  835,
-
-      804,  799,  854,  855, 2125,  818,  822,  863,  811,  806,
-      807,  819,  826,  815,  816,  812,  815,  816,  826,  835,
-      871,  826,  821,  880,  837,  839,  830, 2125,  832,  842,
-      844,  829,  845,  839,  886,  852,  836,  837, 2125,  853,
-      856,  839,  898,  841, 2125,  858,  861,  841,  859,  899,
-      857,  853,  850,  903,  904,  851,  869,  868,  869,  855,
-      870,  862,  869,  859,  877,  862, 2125,  870,  876,  879,
-      924, 2125,  873,  878,  922,  873,  885,  880,  884,  882,
-      880,  882,  892,  937,  881,  886,  882,  941,  885,  897,
-     2125,  885,  893,  891,  888,  889,  898,  910,  894,  899,
-
-      909,  910,  915,  957,  914,  930,  935,  917,  914,  910,
-      905,  965,  908, 2125,  908,  928,  927,  918,  907,  924,
-      931,  974,  935,  928,  932,  936,  919,  980,  927, 2125,
-      977,  924,  927,  926,  926,  949,  946,  951,  952,  938,
-      946,  955,  935,  950,  957,  999, 2125, 1000, 1001,  952,
-      962,  964,  953,  949,  956,  965,  953,  960,  961, 1013,
-      960,  958,  960,  977, 1018,  968,  967,  973,  971,  969,
-     1024, 1025, 1021, 1027, 2125,  984,  977,  968,  987,  975,
-      985,  982,  987,  983,  996,  996, 2125,  980,  982,  982,
-     2125,  983, 1043,  982, 1002, 1003, 1048, 1049, 1002,  987,
-
-     1008, 1007,  991,  996, 1014, 2125, 1004, 1037, 1028, 1060,
-     1000, 1022, 1019, 2125, 1006, 1008, 1025, 1020, 1024, 1069,
-     1017, 1021, 2125, 1013, 1030, 1010, 1031, 1021, 2125, 1036,
-     1036, 1074, 1021, 1077, 1039, 1025, 1085, 1028, 1040, 1032,
-     1038, 1034, 1052, 1053, 1054, 2125, 2125, 1053, 2125, 1038,
-     1039, 1058, 1048, 1041, 1053, 1097, 1061, 1050, 1057, 1058,
-     2125, 1056, 1108, 1049, 1110, 2125, 1111, 1053, 1059, 1066,
-     1110, 2125, 2125, 1058, 2125, 1060, 1074, 1079, 1062, 1121,
-     1078, 1079, 1080, 1120, 1072, 1077, 1128, 1081, 1077, 1131,
-     2125, 1078, 1133, 1134, 2125, 2125, 1074, 1136, 1095, 1138,
-
-     1080, 1092, 1097, 1083, 1113, 1144, 2125, 1101, 1094, 1103,
-     1148, 1095, 1110, 1146, 1098, 2125, 1094, 1110, 1111, 1112,
-     1109, 1153, 1116, 1120, 1107, 1103, 1163, 1116, 1165, 1122,
-     2125, 1123, 1116, 1125, 1126, 1124, 1114, 1117, 1117, 1122,
-     1177, 1179, 1122, 1181, 1177, 1118, 1134, 1125, 1129, 1142,
-     1143, 1189, 2125, 1142, 2125, 2125, 1147, 1141, 1151, 1136,
-     1137, 1198, 1142, 1152, 1201, 2125, 1149, 1149, 1151, 1153,
-     1206, 1147, 1150, 2125, 1151, 1170, 2125, 1154, 2125, 2125,
-     1168, 2125, 1162, 2125, 1214, 1163, 1216, 1217, 1197, 2125,
-     1219, 1176, 1217, 2125, 1165, 1173, 1167, 1164, 1167, 1170,
-
-     1170, 1187, 1226, 1179, 1191, 1194, 1176, 1183, 1173, 2125,
-     1195, 2125, 1181, 1182, 1198, 1198, 1201, 1201, 1198, 1242,
-     1204, 1196, 2125, 2125, 1206, 2125, 1203, 1208, 1209, 1206,
-     1250, 1198, 1213, 1214, 2125, 1202, 1203, 1203, 1209, 1208,
-     1219, 2125, 1260, 1207, 2125, 1208, 1208, 1210, 1216, 2125,
-     1218, 1272, 1214, 1222, 1225, 1276, 1237, 2125, 1234, 2125,
-     1231, 2125, 1254, 2125, 1281, 1223, 1283, 1284, 1241, 1246,
-     1228, 1288, 1289, 1285, 1249, 1246, 1242, 1235, 1247, 1237,
-     1242, 1298, 1299, 1295, 1258, 1255, 1299, 1247, 1252, 1251,
-     1310, 1266, 1312, 1270, 1314, 1275, 1264, 1258, 1318, 1260,
-
-     1261, 1277, 1277, 1323, 1265, 1282, 1281, 1265, 1323, 1324,
-     1271, 1326, 1289, 1290, 2125, 1290, 1291, 1278, 2125, 1289,
-     1338, 1296, 1310, 2125, 1292, 2125, 2125, 1284, 1295, 1344,
-     2125, 2125, 1290, 1295, 1293, 1343, 1301, 1306, 1297, 1295,
-     1309, 2125, 2125, 1299, 1350, 1293, 1298, 1358, 1306, 1316,
-     1317, 2125, 1362, 1315, 2125, 1364, 2125, 1307, 1322, 1310,
-     2125, 1322, 1323, 1329, 1333, 2125, 1369, 1335, 1328, 1337,
-     1319, 1326, 1380, 1339, 1338, 1383, 1331, 1385, 1386, 1335,
-     2125, 1388, 1389, 1338, 1391, 1333, 2125, 1336, 1346, 1390,
-     1338, 1353, 1340, 1346, 1346, 1401, 1345, 1344, 1404, 1357,
-
-     2125, 1401, 1352, 1349, 2125, 1363, 2125, 1366, 1411, 1364,
-     1361, 1362, 1415, 1374, 1357, 1359, 1356, 1372, 1373, 1382,
-     2125, 1372, 1424, 2125, 1383, 2125, 2125, 1421, 2125, 2125,
-     1383, 2125, 1423, 1385, 1386, 1371, 1372, 1380, 1434, 1430,
-     1385, 2125, 1383, 1390, 2125, 1387, 1392, 1390, 1442, 1443,
-     1386, 2125, 1401, 1402, 1403, 2125, 1404, 1394, 1406, 1451,
-     1393, 1401, 1402, 1415, 2125, 1392, 1415, 1400, 1400, 1415,
-     1408, 1407, 1418, 1405, 2125, 1410, 1466, 1425, 1416, 1425,
-     1427, 1431, 2125, 2125, 1472, 1415, 1474, 1475, 1476, 1434,
-     1478, 2125, 1474, 1436, 1437, 1424, 1483, 1420, 1485, 1438,
-
-     1439, 1429, 1446, 1445, 1486, 1448, 2125, 1449, 1450, 1495,
-     1452, 1455, 2125, 1498, 2125, 2125, 2125, 1459, 2125, 1441,
-     1501, 1502, 1445, 2125, 1462, 2125, 1453, 1443, 1502, 1468,
-     1461, 1457, 1454, 1454, 1456, 2125, 1461, 1471, 2125, 1457,
-     1469, 2125, 2125, 1474, 1468, 1476, 1521, 1462, 1464, 1461,
-     1485, 1478, 1469, 1523, 1470, 1478, 1487, 1480, 1475, 1490,
-     1535, 2125, 1481, 1493, 1538, 1487, 1486, 1493, 1480, 1495,
-     1500, 1545, 1502, 1547, 1490, 2125, 1506, 1550, 2125, 1507,
-     1509, 1500, 1514, 1510, 1503, 2125, 1557, 2125, 1558, 1519,
-     2125, 1560, 1561, 1516, 1515, 1516, 1506, 2125, 2125, 1507,
-
-     2125, 2125, 1567, 1509, 1525, 1570, 1527, 2125, 1567, 1516,
-     2125, 1574, 1516, 1518, 2125, 1529, 1578, 1527, 2125, 1536,
-     1581, 2125, 2125, 1587, 1592, 1597, 1602, 1607, 1612, 1617,
-     1620, 1594, 1599, 1601, 1614
+       74,    1,  147,    1,  215,    1,  217,    1,  231,    1,
+      236,    1,  236,  236,  288,  361,  423,    1,  246,  261,
+      233,    1,    1,  222,  437,  222,  216,  220,    1,    1,
+      202,  183,  187,    1,    1,    1,    1,  238,  197,  467,
+      237,    1,    1,  540,  597,    1,  207,  405,  210,  219,
+      419,  602,  221,  416,  642,  418,  586,  705,  567,  399,
+      622,  733,  401,  227,  406,  558,  622,  235,  637,  624,
+      571,  634,  734,  220,  411,  735,  774,  640,  318,  384,
+        1,    1,    1,    1,    1,    1,  841,    1,  631,    1,
+      641,  760,  603,  401,  407,  550,    1,  584,  630,    1,
+
+        1,  909,  655,  635,  621,  644,  761,  760,  644,  758,
+      766,  760,  768,  778,  918,    1,  984,  746,  639,  734,
+      741,  759,  748,  762,  746,  757,  772,  755,  746,  750,
+      757,  785,  786,  771,  782,  784,  792,  778,  866,  782,
+      857,  866,  907,  919,  862,  917,  859,  887,  886,  888,
+      884,  872,  880,  880,  876,  884,  880,  875,  894,  889,
+      882,  883,  899,  890,  887,  899,  920,  899,  980,  899,
+      929,  905,  923,  927,  929,  967,  968,  955,  916,  921,
+      959,  936,  944,  938,  949,  979,  983,  979,  941,  956,
+      967,  961,    1, 1031, 1008, 1015,  956,  961,  987,  993,
+
+      972, 1023, 1030, 1026, 1054, 1030,    1, 1069, 1061, 1017,
+     1018, 1006, 1013, 1015, 1004, 1017, 1026, 1029, 1040, 1040,
+     1041, 1040, 1048, 1094, 1090, 1056, 1039, 1040, 1048, 1047,
+     1063, 1065, 1073, 1063, 1077, 1070, 1071, 1062, 1077, 1081,
+     1080, 1074, 1066, 1086,    1, 1084, 1089, 1072, 1073, 1127,
+     1128, 1089, 1094, 1132, 1096, 1134, 1135, 1098, 1138, 1085,
+     1145, 1146, 1099, 1143, 1092, 1110, 1093, 1093, 1095, 1103,
+     1096, 1097, 1106, 1098, 1115, 1160, 1118, 1119, 1115, 1113,
+     1125, 1122, 1117, 1109, 1126, 1127, 1124, 1130, 1126, 1131,
+     1119, 1127, 1136, 1139, 1124, 1125, 1183, 1123, 1142, 1189,
+
+     1154, 1190, 1148, 1138, 1178,    1,    1, 1156,    1,    1,
+     1141, 1194, 1159, 1184, 1151, 1209, 1188, 1218, 1175, 1195,
+        1, 1225,    1, 1221, 1250,    1, 1185, 1164, 1166, 1189,
+     1191, 1195, 1235, 1198, 1183, 1202, 1186, 1197, 1251, 1209,
+     1206, 1211, 1208, 1217,    1, 1228, 1263, 1259, 1219, 1227,
+     1272, 1237, 1279, 1275, 1230, 1227, 1227, 1281, 1282, 1231,
+     1249, 1291, 1292, 1298, 1256, 1243, 1258, 1247, 1260, 1257,
+     1266, 1263, 1261, 1253, 1263, 1268, 1265, 1267, 1265, 1317,
+     1275, 1313,    1, 1314, 1267, 1268, 1269, 1264, 1268, 1274,
+     1275, 1288, 1285, 1334, 1335, 1290, 1290, 1295, 1335,    1,
+
+     1297, 1337, 1290, 1304, 1292, 1306, 1285, 1308, 1309, 1295,
+     1349, 1350, 1314, 1319, 1316, 1304, 1318, 1319, 1320, 1321,
+     1322, 1323, 1318, 1369, 1372,    1, 1316, 1317, 1375, 1333,
+     1333,    1,    1, 1335, 1376, 1326, 1321, 1352, 1329, 1389,
+     1390, 1356, 1400,    1, 1348, 1402,    1, 1377, 1416, 1364,
+     1348, 1407, 1408, 1354, 1357, 1384, 1410, 1417, 1375, 1383,
+     1380,    1, 1387, 1396, 1401, 1404, 1402, 1391, 1394,    1,
+     1409, 1398, 1397, 1421, 1397, 1401,    1, 1411, 1410, 1411,
+     1426, 1423, 1473, 1432, 1423, 1418, 1471,    1, 1423, 1441,
+     1477, 1440, 1439, 1442, 1446, 1482, 1435, 1432, 1433, 1486,
+
+     1432, 1449, 1454, 1455, 1439, 1446, 1458, 1499,    1, 1446,
+     1444, 1444, 1456, 1452, 1461, 1447, 1449, 1461, 1466, 1457,
+     1455, 1455,    1, 1514,    1, 1458, 1471, 1512, 1467, 1460,
+     1464, 1469, 1480, 1476, 1472, 1483, 1527, 1523, 1487, 1472,
+     1474, 1475, 1493, 1494, 1478, 1486, 1481, 1491, 1497, 1482,
+     1542, 1484, 1487, 1488, 1502, 1493,    1,    1, 1495, 1495,
+        1, 1508, 1546, 1547, 1509, 1551, 1495, 1515, 1555, 1506,
+        1,    1, 1511,    1, 1529,    1, 1549, 1548, 1506, 1561,
+        1,    1, 1524, 1519, 1525, 1533, 1538, 1543, 1525, 1526,
+     1581, 1529, 1584, 1539, 1540, 1541, 1550, 1545, 1560, 1545,
+
+     1547, 1565, 1566, 1567, 1568, 1570, 1554, 1561, 1604, 1573,
+     1567, 1614, 1560, 1578, 1579,    1, 1566, 1565, 1625, 1582,
+     1576, 1584, 1585, 1587, 1574, 1592, 1576, 1592, 1593, 1579,
+     1580, 1582, 1599, 1598, 1601, 1603, 1596, 1604, 1650, 1607,
+     1601,    1, 1596, 1600, 1611, 1612, 1654, 1655, 1656, 1662,
+     1620, 1605, 1609, 1614, 1609,    1, 1625, 1606, 1612, 1624,
+     1629, 1630, 1624, 1671, 1625, 1634, 1674,    1, 1621, 1637,
+     1623, 1640, 1645, 1628, 1682, 1683, 1684, 1685, 1632, 1687,
+     1688,    1, 1694, 1653, 1654, 1653, 1655, 1655, 1656, 1648,
+     1652, 1663,    1, 1662, 1654,    1, 1703, 1652, 1711, 1681,
+
+     1692, 1671, 1659, 1660, 1659, 1661, 1662, 1672, 1670, 1685,
+     1686, 1668, 1664, 1724, 1689, 1730, 1696, 1727, 1690, 1730,
+     1737, 1691, 1691, 1701, 1706, 1707, 1695, 1688, 1745, 1698,
+     1708, 1711, 1749, 1712, 1713, 1703, 1706, 1753, 1760, 1720,
+     1721,    1, 1724, 1719, 1710, 1725, 1730, 1727, 1730, 1729,
+     1730, 1728, 1736, 1717, 1734, 1779, 1780, 1730, 1722, 1732,
+     1779, 1737, 1787,    1, 1788, 1741, 1738, 1732, 1735, 1788,
+     1752, 1741, 1754,    1, 1744, 1755, 1756, 1758, 1802, 1803,
+     1746, 1757, 1758, 1755, 1766, 1754, 1746, 1752, 1807, 1771,
+     1755, 1767, 1811, 1812, 1813, 1760, 1815, 1779, 1775, 1782,
+
+     1778, 1763, 1775, 1776,    1, 1831, 1788, 1790, 1781, 1794,
+     1797, 1782, 1789, 1795, 1804, 1788, 1802, 1807, 1849,    1,
+     1845, 1821, 1847, 1809, 1810, 1811, 1816, 1804, 1814, 1815,
+     1800, 1804, 1818, 1864, 1817, 1818, 1824,    1, 1814, 1830,
+     1827, 1813, 1820, 1819, 1818, 1837, 1834, 1823, 1830, 1831,
+     1840, 1840, 1830, 1828, 1827, 1838, 1834, 1890, 1847, 1832,
+     1838, 1854, 1844,    1, 1854, 1854, 1848, 1859, 1857, 1902,
+     1844, 1846, 1861, 1848, 1908, 1865, 1852, 1868, 1856,    1,
+        1, 1866, 1871, 1876, 1864, 1874, 1876,    1,    1, 1877,
+     1881, 1868, 1869, 1867, 1885, 1872, 1922, 1873, 1926, 1875,
+
+     1933,    1,    1, 1934, 1882, 1881, 1889, 1879, 1888, 1940,
+     1893, 1883, 1884, 1885, 1893, 1904, 1888, 1906, 1902, 1903,
+     1905, 1899, 1901, 1902, 1904, 1904, 1906, 1921, 1962, 1919,
+     1924, 1901,    1, 1913, 1914, 1928, 1918, 1965, 1923, 1913,
+     1928, 1932, 1928, 1932, 1919, 1933,    1, 1952, 1960, 1928,
+     1930, 1927, 1928, 1927, 1946, 1986, 1936, 1989, 1951, 1991,
+        1, 1954, 1958, 1999, 1947, 1942, 1943, 1955, 1963, 1952,
+     1954, 1950, 1953, 1954, 1964, 1973, 2009, 1964, 1959, 2017,
+     1974, 1975, 1966,    1, 1968, 1978, 1980, 1965, 1981, 1975,
+     2022, 1988, 1972, 1973,    1, 1989, 1992, 1993, 2034, 1977,
+
+        1, 1994, 1997, 1981, 1982, 1996, 2036, 1994, 1991, 1988,
+     2041, 2042, 1989, 2007, 2006, 2008, 1994, 2009, 2001, 2008,
+     1998, 2016, 2001,    1, 2009, 2015, 2018, 2004, 2064, 2017,
+        1, 2019, 2022, 2067, 2068, 2030, 2024, 2028, 2026, 2024,
+     2026, 2036, 2081, 2025, 2030, 2026, 2085, 2029, 2041,    1,
+     2029, 2037, 2035, 2032, 2034, 2043, 2055, 2039, 2044, 2054,
+     2055, 2056, 2053, 2062, 2103, 2060, 2076, 2081, 2051, 2067,
+     2064, 2067, 2064, 2108, 2061, 2062, 2076, 2059, 2059, 2119,
+     2062,    1, 2062, 2082, 2085, 2074, 2076, 2081, 2088, 2131,
+     2092, 2087, 2091, 2095, 2096, 2139, 2087,    1, 2137, 2084,
+
+     2087, 2086, 2086, 2107, 2104, 2109, 2110, 2096, 2104, 2113,
+     2114, 2108, 2116, 2158,    1, 2159, 2160, 2111, 2121, 2101,
+     2126, 2114, 2110, 2118, 2127, 2115, 2122, 2123, 2176, 2123,
+     2121, 2124, 2142, 2183, 2133, 2132, 2138, 2136, 2134, 2189,
+     2190, 2186, 2192, 2193,    1, 2152, 2151, 2144, 2145, 2155,
+     2143, 2153, 2150, 2155, 2152, 2165, 2166,    1, 2150, 2152,
+     2152,    1, 2153, 2213, 2152, 2171, 2172, 2217, 2218, 2171,
+     2156, 2177, 2178, 2177, 2166, 2221, 2174, 2186,    1, 2176,
+     2209, 2200, 2227, 2233, 2183, 2230, 2231, 2181, 2199, 2201,
+     2196, 2197, 2201,    1, 2188, 2190, 2207, 2202, 2206, 2251,
+
+     2199, 2204,    1, 2196, 2213, 2194, 2216, 2218,    1, 2220,
+     2221, 2259, 2206, 2261, 2223, 2209, 2269, 2212, 2223, 2217,
+     2223, 2219, 2237, 2238, 2239,    1,    1, 2238,    1, 2223,
+     2224, 2243, 2279, 2234, 2227, 2239, 2283, 2247, 2248, 2243,
+     2245,    1, 2243, 2295, 2296, 2297,    1, 2298, 2240, 2246,
+     2253, 2298,    1,    1, 2246,    1,    1, 2257, 2263, 2267,
+     2251, 2265, 2270, 2253, 2312, 2269, 2270, 2271, 2311, 2263,
+     2268, 2319, 2272, 2268, 2322,    1, 2269, 2324, 2325,    1,
+        1, 2326, 2327, 2286, 2329, 2271, 2283, 2281, 2290, 2290,
+     2276, 2306, 2337, 2281,    1, 2285, 2282, 2297, 2298, 2299,
+
+     2293, 2301, 2292, 2303, 2348, 2295, 2310, 2347, 2299,    1,
+     2295, 2311, 2313, 2314, 2311, 2355, 2318, 2322, 2309, 2306,
+     2366, 2319, 2368, 2326,    1, 2327, 2320, 2329, 2330, 2327,
+     2317, 2320, 2320, 2325, 2380, 2381, 2324, 2324, 2384, 2380,
+     2381, 2337, 2330, 2333, 2346, 2348, 2394,    1, 2347,    1,
+        1, 2353, 2354, 2355, 2356, 2341, 2349, 2399, 2347, 2406,
+     2351, 2361, 2410,    1, 2358, 2358, 2360, 2362, 2415, 2357,
+     2360,    1, 2361, 2380,    1, 2364,    1,    1, 2378,    1,
+     2379,    1, 2424, 2373, 2386, 2422, 2428, 2429, 2410,    1,
+     2388, 2390, 2387, 2436, 2437, 2394, 2439, 2440, 2390, 2437,
+
+        1, 2385, 2393, 2387, 2385, 2388, 2391, 2391, 2408, 2448,
+     2402, 2414, 2417, 2399, 2406, 2407,    1, 2418,    1, 2404,
+     2405, 2420, 2420, 2423, 2424, 2421, 2465, 2428, 2420,    1,
+        1, 2430, 2431,    1, 2428, 2433, 2436, 2433, 2477, 2425,
+     2440, 2441,    1, 2429, 2430, 2430, 2436, 2437, 2446, 2434,
+     2442, 2495,    1, 2491, 2438,    1, 2439, 2439, 2441, 2447,
+        1, 2449, 2503, 2445, 2453, 2457, 2508, 2470,    1, 2467,
+     2453, 2471,    1, 2466,    1, 2489, 2463, 2517, 2518,    1,
+     2468, 2520,    1,    1, 2478, 2463, 2523, 2524, 2481, 2486,
+     2468, 2528, 2529, 2525, 2490, 2526, 2483, 2476, 2488, 2478,
+
+     2483, 2539, 2540, 2536, 2501, 2497, 2541, 2489, 2494, 2492,
+     2551, 2507, 2553, 2497, 2512, 2556, 2517, 2506, 2500, 2560,
+     2502, 2503, 2519, 2519, 2565, 2507, 2524, 2523, 2525, 2526,
+        1, 2527, 2568, 2569, 2516, 2571, 2534, 2535,    1, 2535,
+     2536, 2523,    1, 2534, 2584, 2541, 2546, 2544, 2557, 2546,
+        1, 2547, 2552,    1, 2593, 2546,    1,    1, 2537, 2548,
+     2597,    1,    1, 2543, 2548, 2546, 2596, 2554, 2559, 2550,
+     2548, 2562,    1,    1, 2552, 2603, 2605, 2552, 2612, 2613,
+     2570, 2571,    1, 2617, 2570,    1, 2575, 2620,    1, 2563,
+     2578, 2566,    1, 2576, 2577, 2583, 2587,    1, 2623, 2589,
+
+     2582, 2574, 2574, 2593, 2575, 2582, 2636, 2637, 2594, 2639,
+     2587, 2641, 2642, 2643,    1, 2591, 2603, 2646, 2647, 2648,
+     2649, 2598,    1, 2599, 2652, 2594,    1, 2597, 2607, 2651,
+     2599, 2614, 2601, 2607, 2607, 2662, 2606, 2605, 2665, 2619,
+        1, 2664, 2615, 2612,    1, 2626, 2633,    1, 2630, 2675,
+     2628, 2625, 2626, 2680, 2639, 2640, 2624, 2625, 2626, 2628,
+     2642, 2643, 2652,    1, 2653, 2694,    1, 2654,    1,    1,
+     2692, 2656, 2659,    1,    1, 2699,    1, 2662, 2659,    1,
+     2700, 2663, 2664, 2649, 2651, 2659, 2713, 2709, 2664,    1,
+     2662, 2669,    1, 2666, 2671, 2669, 2721, 2722, 2723, 2666,
+
+        1, 2681, 2682, 2683,    1, 2684, 2674, 2686, 2731, 2692,
+     2693, 2675, 2683, 2684, 2697,    1, 2698, 2697, 2676, 2697,
+        1, 2683, 2685, 2685, 2700, 2693, 2692, 2703, 2690,    1,
+     2695, 2751, 2710, 2701, 2710, 2712, 2716,    1,    1, 2699,
+     2758, 2702, 2761, 2763, 2764, 2722, 2767,    1, 2717, 2723,
+     2765, 2727, 2728, 2715, 2775, 2712, 2777, 2778, 2731, 2780,
+     2733, 2734, 2724, 2741, 2740, 2781, 2743,    1, 2744, 2745,
+     2790, 2747, 2750, 2793,    1, 2794,    1,    1,    1, 2755,
+        1, 2796, 2753, 2739, 2799, 2800, 2743,    1, 2760,    1,
+        1, 2761,    1, 2752, 2753, 2801, 2767, 2760, 2756, 2757,
+
+     2753, 2755,    1, 2760, 2773,    1,    1, 2759,    1, 2761,
+     2772,    1,    1, 2777, 2771, 2770, 2780, 2825, 2826, 2768,
+     2765, 2789, 2782, 2773, 2827, 2774, 2782, 2791, 2836, 2785,
+     2780, 2795, 2840, 2841,    1, 2842, 2799, 2844, 2793, 2792,
+     2799, 2800, 2801, 2806, 2851,    1, 2808, 2853, 2796,    1,
+        1, 2812, 2856,    1, 2813, 2815, 2806, 2820, 2821, 2810,
+        1, 2864,    1, 2865, 2827,    1, 2868, 2869, 2871, 2824,
+     2825, 2815,    1,    1, 2816,    1,    1, 2876, 2818, 2834,
+     2879, 2836,    1, 2876, 2825,    1, 2883, 2825, 2827,    1,
+     2839, 2888, 2837,    1, 2846, 2891,    1,    1
+
     } ;
 
-static const flex_int16_t yy_def[1736] =
+static const flex_int16_t yy_def[1899] =
     {   0,
-     1724, 1724, 1725, 1725, 1724, 1724, 1724, 1724, 1724, 1724,
-     1723, 1723, 1723, 1723, 1723, 1726, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1727,
-     1723, 1723, 1723, 1728,   15, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1729,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1726,
-     1723, 1723, 1723, 1723, 1723, 1723, 1730, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1727, 1723,
-
-     1728, 1723, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1731,   45, 1729,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1730, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1732,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1731, 1723, 1729,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-
-     1723, 1723, 1723, 1723, 1723, 1723, 1733,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45, 1723,   45, 1729,
-     1723,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1723,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-     1723, 1723, 1723, 1734,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45, 1723,   45, 1729,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1723,   45,   45,   45,   45,   45,   45,
+     1898,    1, 1898,    3,    2,    5,    6,    7,    8,    9,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,   17,   19,
+     1898,   19, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+       26,   27,   28, 1898, 1898, 1898,   13, 1898, 1898, 1898,
+     1898,   37,   14, 1898,   15, 1898,   45,   45,   47,   45,
+       45,   45,   49,   45,   45,   45,   50, 1898,   48,   53,
+       60,   50,   45,   51,   45,   53,   45,   45,   68,   68,
+       54,   45,   68,   45,   68,   75,   55,   56,   45,   57,
+       16,   20,   17,   25,   22, 1898, 1898, 1898,   84,   89,
+     1898, 1898, 1898,   91,   92,   93, 1898, 1898,   40, 1898,
+
+     1898, 1898,   45,   45,   45,   45,   48,   53,   45,   45,
+       45,   74,  111,   68,   58,   45,  115,  104,  116,  116,
+      116,  116,  116,  122,  119,  116,  116,  116,  116,  121,
+      116,  122,  122,  116,  126,  116,  133,  116,  116,  131,
+      123,  141,  116,  116,  130,  143,  120,  116,  133,  116,
+      116,  145,  116,  140,  134,  153,  125,  110,  116,  128,
+      145,  161,  116,  162,  157,  165,  163,  162,  160,  156,
+      165,  148,  149,  172,  150,  146,  176,  138,  155,  138,
+      180,  180,  163,  160,  135, 1898, 1898, 1898,  186,  187,
+      188, 1898, 1898, 1898,  177,  174,  162,  180,  179,  154,
+
+      151,  183,  144,  202,  203,  200, 1898,  117,  205,  196,
+      174,  154,  212,  213,  197,  213,  173,  211,  217,  183,
+      220,  156,  215,  205,  195,  218,  179,  227,  184,  198,
+      226,  231,  232,  175,  231,  185,  236,  227,  221,  234,
+      232,  214,  215,  235, 1898,  239,  244,  238,  248,  225,
+      250,  201,  219,  250,  253,  250,  256,  246,  256,  243,
+      224,  261,  236,  259,  251,  247,  249,  260,  267,  229,
+      268,  271,  270,  228,  258,  261,  241,  277,  263,  273,
+      266,  275,  273,  274,  282,  285,  279,  278,  287,  286,
+      265,  242,  253,  293,  230,  295,  276,  272,  290,  276,
+
+      281,  291,  287,  298, 1898, 1898, 1898,  305, 1898, 1898,
+     1898, 1898,  303,  262,  291,  315,  299,  300,  303,  315,
+     1898,  318, 1898,  259,  208, 1898,  293,  314,  262,  327,
+      330,  331,  324,  299,  284,  330,  335,  294,  322,  334,
+      319,  340,  341,  315, 1898,  343,  339,  333,  332,  343,
+      348,  350,  347,  348,  283,  296,  315,  354,  358,  357,
+      301,  358,  362,  363,  288,  360,  365,  356,  342,  350,
+      361,  369,  359,  366,  370,  372,  375,  377,  355,  353,
+      368,  362, 1898,  382,  331,  385,  386,  337,  366,  389,
+      390,  376,  377,  380,  380,  349,  393,  392,  384, 1898,
+
+      398,  399,  338,  371,  403,  404,  391,  404,  401,  389,
+      399,  411,  401,  408,  413,  410,  415,  417,  418,  419,
+      420,  421,  403,  395,  424, 1898,  416,  427,  425,  367,
+      422, 1898, 1898, 1898, 1898,  403,  388,  437,  387,  425,
+      440,  430,  441, 1898,  436,  443, 1898,  445,  325,  414,
+      438,  446,  452,  428,  454,  455,  411,  457,  397,  459,
+      412, 1898,  445,  396,  464,  465,  465,  439,  468, 1898,
+      469,  458,  463,  466,  469,  472, 1898,  467,  431,  466,
+      479,  460,  457,  450,  476,  455,  457, 1898,  486,  484,
+      487,  442,  456,  492,  490,  491,  473,  489,  498,  496,
+
+      437,  481,  495,  503,  499,  485,  503,  452, 1898,  475,
+      505,  480,  482,  497,  493,  501,  461,  513,  481,  510,
+      511,  512, 1898,  508, 1898,  521,  515,  500,  506,  517,
+      526,  514,  494,  518,  532,  533,  524,  528,  478,  522,
+      531,  541,  507,  543,  541,  529,  545,  534,  536,  530,
+      537,  550,  547,  553,  519,  520, 1898, 1898,  535,  556,
+     1898,  539,  538,  563, 1898, 1898,  552,  567,  551,  546,
+     1898, 1898,  559, 1898,  573, 1898,  560,  554,  567,  569,
+     1898, 1898,  560,  548,  560,  584,  579,  543,  579,  589,
+      564,  590,  591,  592,  594,  595,  570,  554,  555,  542,
+
+      600,  599,  602,  603,  604,  549,  601,  585,  608,  605,
+      597,  593,  607,  606,  614, 1898,  598,  596,  569,  610,
+      611,  620,  622,  615,  617,  588,  625,  562,  628,  618,
+      630,  631,  628,  622,  633,  635,  621,  634,  619,  638,
+      637, 1898,  627,  608,  640,  645,  612,  647,  648,  639,
+      624,  630,  643,  649,  652, 1898,  645,  631,  655,  659,
+      657,  661,  641,  648,  623,  662,  664, 1898,  659,  666,
+      669,  670,  626,  632,  667,  675,  676,  677,  671,  678,
+      680, 1898,  639,  635,  684,  672,  651,  686,  688,  644,
+      663,  691, 1898,  688,  654, 1898,  681,  674,  639,  679,
+
+      694,  694,  698,  703,  689,  679,  705,  691,  690,  673,
+      710,  706,  658,  697,  685,  699,  687,  714,  702,  718,
+      720,  665,  695,  719,  710,  725,  723,  704,  721,  727,
+      724,  685,  729,  687,  734,  707,  708,  733,  716,  731,
+      740, 1898,  732,  735,  703,  741,  725,  746,  743,  748,
+      750,  711,  747,  707,  751,  739,  756,  737,  754,  758,
+      738,  744,  757, 1898,  763,  762,  722,  712,  768,  761,
+      734,  726,  771, 1898,  709,  755,  776,  773,  765,  779,
+      745,  766,  782,  767,  749,  772,  783,  768,  770,  785,
+      788,  782,  789,  793,  794,  791,  795,  790,  792,  798,
+
+      799,  787,  802,  803, 1898,  780,  777,  807,  786,  808,
+      778,  796,  803,  792,  810,  769,  810,  753,  806, 1898,
+      797,  781,  821,  817,  824,  825,  818,  813,  826,  829,
+      830,  816,  829,  819,  814,  835,  811, 1898,  775,  827,
+      833,  812,  828,  809,  781,  840,  841,  832,  836,  849,
+      837,  847,  844,  845,  830,  855,  853,  834,  852,  855,
+      857,  846,  850, 1898,  800,  851,  863,  867,  859,  858,
+      842,  854,  869,  872,  858,  873,  871,  876,  848, 1898,
+     1898,  835,  878,  862,  843,  883,  866, 1898, 1898,  887,
+      884,  839,  892,  879,  891,  892,  896,  861,  897,  894,
+
+      875, 1898, 1898,  901,  885,  898,  882,  877,  867,  901,
+      907,  908,  912,  913,  914,  865,  913,  916,  911,  919,
+      920,  906,  896,  923,  924,  922,  925,  891,  910,  886,
+      928,  914, 1898,  905,  934,  931,  909,  899,  920,  917,
+      940,  918,  921,  941,  940,  945, 1898,  926,  930,  927,
+      935,  900,  952,  945,  890,  938,  952,  956,  930,  958,
+     1898,  955,  936,  929,  951,  954,  966,  939,  942,  950,
+      970,  967,  957,  973,  968,  963,  960,  937,  974,  964,
+      959,  981,  971, 1898,  965,  982,  962,  972,  986,  978,
+      977,  976,  979,  993, 1898,  969,  992,  997,  998,  998,
+
+     1898,  996,  997,  994, 1004,  989,  991,  975,  985, 1004,
+     1007, 1011,  988, 1002, 1006, 1015, 1013, 1017,  983, 1008,
+     1017, 1014, 1000, 1898,  990, 1025, 1016, 1021,  980, 1020,
+     1898, 1030, 1030, 1012, 1034, 1027, 1025, 1033, 1037, 1019,
+     1009, 1036, 1029, 1010, 1041, 1023, 1043, 1044, 1026, 1898,
+     1028, 1032, 1035, 1051, 1054, 1039, 1003, 1048, 1045, 1042,
+     1060, 1061, 1038, 1057, 1047, 1061, 1058, 1059, 1058, 1069,
+     1018, 1066, 1063, 1034, 1059, 1075, 1064, 1046, 1055, 1065,
+     1078, 1898, 1079, 1077, 1084, 1052, 1086, 1073, 1085, 1080,
+     1084, 1088, 1071, 1089, 1094, 1090, 1040, 1898, 1074, 1083,
+
+     1069, 1100, 1095, 1091, 1072, 1104, 1106, 1053, 1092, 1107,
+     1110, 1111, 1112, 1096, 1898, 1114, 1114, 1062, 1113, 1087,
+     1110, 1076, 1081, 1086, 1105, 1101, 1126, 1127, 1114, 1097,
+     1126, 1131, 1121, 1129, 1128, 1122, 1109, 1135, 1130, 1134,
+     1140, 1099, 1141, 1143, 1898, 1094, 1125, 1124, 1148, 1147,
+     1131, 1137, 1148, 1152, 1136, 1119, 1146, 1898, 1102, 1123,
+     1159, 1898, 1161, 1143, 1149, 1150, 1166, 1164, 1168, 1154,
+     1120, 1167, 1172, 1173, 1163, 1142, 1155, 1157, 1898, 1177,
+     1172, 1175, 1176, 1169, 1138, 1183, 1186, 1151, 1133, 1189,
+     1173, 1191, 1172, 1898, 1160, 1188, 1156, 1192, 1193, 1184,
+
+     1180, 1201, 1898, 1175, 1204, 1171, 1199, 1207, 1898, 1197,
+     1178, 1186, 1204, 1212, 1207, 1213, 1200, 1195, 1170, 1196,
+     1153, 1220, 1190, 1223, 1224, 1898, 1898, 1211, 1898, 1218,
+     1230, 1225, 1214, 1185, 1216, 1219, 1233, 1228, 1238, 1236,
+     1240, 1898, 1234, 1217, 1244, 1244, 1898, 1246, 1235, 1239,
+     1241, 1237, 1898, 1898, 1231, 1898, 1898, 1251, 1205, 1232,
+     1222, 1215, 1260, 1255, 1248, 1262, 1266, 1267, 1264, 1250,
+     1202, 1265, 1258, 1201, 1272, 1898, 1270, 1275, 1278, 1898,
+     1898, 1279, 1279, 1238, 1283, 1249, 1273, 1243, 1259, 1268,
+     1286, 1264, 1285, 1261, 1898, 1277, 1264, 1290, 1298, 1299,
+
+     1288, 1299, 1296, 1302, 1304, 1303, 1263, 1252, 1306, 1898,
+     1291, 1304, 1312, 1313, 1287, 1308, 1289, 1307, 1309, 1311,
+     1293, 1315, 1321, 1314, 1898, 1324, 1300, 1326, 1328, 1322,
+     1320, 1294, 1297, 1319, 1323, 1335, 1333, 1331, 1336, 1316,
+     1340, 1338, 1338, 1332, 1344, 1345, 1339, 1898, 1330, 1898,
+     1898, 1329, 1352, 1352, 1354, 1355, 1353, 1340, 1337, 1347,
+     1344, 1349, 1360, 1898, 1357, 1334, 1365, 1327, 1363, 1356,
+     1359, 1898, 1371, 1318, 1898, 1361, 1898, 1898, 1354, 1898,
+     1379, 1898, 1369, 1368, 1374, 1358, 1386, 1383, 1379, 1898,
+     1379, 1391, 1362, 1388, 1394, 1391, 1394, 1397, 1381, 1386,
+
+     1898, 1373, 1399, 1402, 1392, 1370, 1404, 1343, 1408, 1400,
+     1367, 1395, 1385, 1408, 1411, 1415, 1898, 1409, 1898, 1407,
+     1420, 1396, 1346, 1418, 1422, 1393, 1410, 1425, 1415, 1898,
+     1898, 1428, 1432, 1898, 1426, 1432, 1436, 1435, 1427, 1421,
+     1437, 1441, 1898, 1376, 1444, 1440, 1429, 1447, 1423, 1414,
+     1384, 1398, 1898, 1439, 1450, 1898, 1455, 1406, 1457, 1459,
+     1898, 1447, 1452, 1459, 1451, 1465, 1463, 1413, 1898, 1442,
+     1464, 1412, 1898, 1438, 1898, 1462, 1462, 1467, 1478, 1898,
+     1479, 1478, 1898, 1898, 1424, 1471, 1482, 1487, 1470, 1468,
+     1486, 1488, 1492, 1454, 1477, 1494, 1481, 1491, 1474, 1498,
+
+     1448, 1493, 1502, 1494, 1485, 1499, 1504, 1446, 1460, 1508,
+     1508, 1449, 1503, 1445, 1505, 1513, 1490, 1465, 1500, 1516,
+     1519, 1521, 1489, 1512, 1520, 1522, 1515, 1524, 1523, 1529,
+     1898, 1530, 1507, 1533, 1526, 1534, 1527, 1537, 1898, 1530,
+     1540, 1508, 1898, 1506, 1525, 1541, 1517, 1538, 1535, 1546,
+     1898, 1550, 1547, 1898, 1545, 1544, 1898, 1898, 1542, 1556,
+     1555, 1898, 1898, 1501, 1497, 1509, 1536, 1560, 1552, 1566,
+     1514, 1569, 1898, 1898, 1564, 1567, 1576, 1535, 1561, 1579,
+     1572, 1581, 1898, 1579, 1568, 1898, 1582, 1584, 1898, 1559,
+     1587, 1571, 1898, 1585, 1594, 1548, 1553, 1898, 1576, 1597,
+
+     1595, 1592, 1590, 1600, 1578, 1580, 1588, 1607, 1591, 1607,
+     1606, 1610, 1612, 1613, 1898, 1611, 1608, 1613, 1618, 1619,
+     1619, 1614, 1898, 1622, 1621, 1605, 1898, 1602, 1601, 1599,
+     1603, 1609, 1631, 1616, 1570, 1625, 1628, 1626, 1636, 1629,
+     1898, 1630, 1575, 1638, 1898, 1644, 1604, 1898, 1632, 1639,
+     1640, 1624, 1652, 1650, 1617, 1655, 1644, 1657, 1658, 1633,
+     1651, 1661, 1647, 1898, 1663, 1654, 1898, 1655, 1898, 1898,
+     1642, 1668, 1672, 1898, 1898, 1666, 1898, 1663, 1649, 1898,
+     1671, 1679, 1682, 1656, 1684, 1634, 1676, 1681, 1665, 1898,
+     1635, 1662, 1898, 1653, 1692, 1689, 1687, 1697, 1698, 1660,
+
+     1898, 1683, 1702, 1703, 1898, 1704, 1643, 1706, 1698, 1678,
+     1710, 1657, 1694, 1713, 1711, 1898, 1715, 1672, 1717, 1708,
+     1898, 1712, 1700, 1722, 1724, 1686, 1707, 1725, 1724, 1898,
+     1727, 1709, 1718, 1714, 1720, 1699, 1715, 1898, 1898, 1723,
+     1732, 1740, 1741, 1743, 1744, 1736, 1745, 1898, 1696, 1749,
+     1688, 1735, 1752, 1742, 1747, 1719, 1755, 1757, 1695, 1758,
+     1759, 1761, 1729, 1746, 1728, 1751, 1753, 1898, 1767, 1769,
+     1760, 1770, 1733, 1771, 1898, 1774, 1898, 1898, 1898, 1737,
+     1898, 1776, 1772, 1763, 1782, 1785, 1754, 1898, 1773, 1898,
+     1898, 1789, 1898, 1734, 1794, 1766, 1780, 1762, 1726, 1799,
+
+     1787, 1800, 1898, 1799, 1783, 1898, 1898, 1784, 1898, 1801,
+     1798, 1898, 1898, 1805, 1749, 1804, 1814, 1786, 1818, 1808,
+     1795, 1797, 1811, 1810, 1796, 1820, 1794, 1817, 1818, 1827,
+     1824, 1828, 1829, 1833, 1898, 1834, 1832, 1834, 1830, 1792,
+     1823, 1841, 1841, 1837, 1838, 1898, 1844, 1845, 1831, 1898,
+     1898, 1849, 1848, 1898, 1847, 1852, 1816, 1822, 1858, 1857,
+     1898, 1853, 1898, 1862, 1858, 1898, 1864, 1867, 1868, 1843,
+     1870, 1826, 1898, 1898, 1872, 1898, 1898, 1868, 1875, 1855,
+     1878, 1880, 1898, 1825, 1802, 1898, 1881, 1879, 1849, 1898,
+     1871, 1887, 1839, 1898, 1882, 1892, 1898,    0
 
-       45,   45,   45,   45,   45,   45,   45, 1723,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-     1723,   45,   45, 1723,   45,   45, 1723, 1735,   45,   45,
-       45,   45, 1723, 1723,   45, 1723,   45, 1723,   45,   45,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1723,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45, 1723,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1723,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1723,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1723, 1723,   45,   45,   45,   45,
-       45,   45, 1723, 1723,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723, 1723,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1723,   45,   45,
-
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1723,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1723,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1723,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1723,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-     1723,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45, 1723,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45,   45,   45,   45,   45, 1723,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723, 1723,   45, 1723,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1723,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45, 1723, 1723,   45, 1723,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1723,   45,   45,   45, 1723, 1723,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1723,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723,   45, 1723, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45, 1723,   45,   45, 1723,   45, 1723, 1723,
-       45, 1723,   45, 1723,   45,   45,   45,   45,   45, 1723,
-       45,   45,   45, 1723,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1723,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1723, 1723,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45, 1723,   45,   45,   45,   45, 1723,
-       45,   45,   45,   45,   45,   45,   45, 1723,   45, 1723,
-       45, 1723,   45, 1723,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45, 1723,   45,
-       45,   45,   45, 1723,   45, 1723, 1723,   45,   45,   45,
-     1723, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1723, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45, 1723,   45, 1723,   45,   45,   45,
-     1723,   45,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1723,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1723,   45,   45,   45, 1723,   45, 1723,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1723,   45,   45, 1723,   45, 1723, 1723,   45, 1723, 1723,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1723,   45,   45,   45,   45,   45,
-       45,   45, 1723, 1723,   45,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1723,   45,   45,   45,
-       45,   45, 1723,   45, 1723, 1723, 1723,   45, 1723,   45,
-       45,   45,   45, 1723,   45, 1723,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45, 1723,   45,
-       45, 1723, 1723,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1723,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1723,   45,   45, 1723,   45,
-       45,   45,   45,   45,   45, 1723,   45, 1723,   45,   45,
-     1723,   45,   45,   45,   45,   45,   45, 1723, 1723,   45,
-
-     1723, 1723,   45,   45,   45,   45,   45, 1723,   45,   45,
-     1723,   45,   45,   45, 1723,   45,   45,   45, 1723,   45,
-       45, 1723,    0, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723
     } ;
 
-static const flex_int16_t yy_nxt[2199] =
+static const flex_int16_t yy_nxt[2965] =
     {   0,
-     1723,   13,   14,   13, 1723,   15,   16, 1723,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       86,  740,   37,   14,   37,   87,   25,   26,   38,  102,
-     1723,   27,   37,   14,   37,   42,   28,   42,   38,   92,
-       93,   29,  199,   30,   13,   14,   13,   91,   92,   25,
-       31,   93,   13,   14,   13,   13,   14,   13,   32,   40,
-      741,   13,   14,   13,   33,   40,  103,   92,   93,  199,
-       91,   34,   35,   13,   14,   13,   95,   15,   16,   96,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   91,   39,  105,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  108,   42,   28,   42,
-      109,   42,   41,   29,  111,   30,  114,  115,   94,  141,
-       41,   25,   31,  105,  225,  226,   89,  142,   89,  108,
-       32,   90,   90,   90,   90,   90,   33,  111,  109,  114,
-      231,  115,  232,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   45,   45,   45,   45,   48,   45,   49,
-       50,   45,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   60,   61,   62,   63,   64,   65,   66,   67,   52,
-
-       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
-       78,   79,   57,   45,   45,   45,   45,   45,   81,  831,
-       82,   82,   82,   82,   82,   81,  105,   84,   84,   84,
-       84,   84,  108,   83,   85,   85,   85,   85,   85,   81,
-       83,   84,   84,   84,   84,   84,  185,   83,  282,  283,
-      112,  123,  119,  135,   83,  108,   83,  187,  120,  124,
-      113,  121,  125,   83,  136,  126,  138,  127,  139,  128,
-       83,  143,  185,  112,  137,  140,  163,   83,   45,  186,
-      164,  144,  832,  145,   45,  187,   45,   45,  113,   45,
-      165,   45,   45,   45,  425,  117,  147,  148,   45,   45,
-
-      149,   45,   45,  187,  426,  186,  150,   45,   45,   45,
+       11, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898,   12,   13,   14,   13,   12,   15,
+       16,   12,   17,   18,   19,   20,   21,   22,   22,   22,
+       22,   22,   23,   24,   12,   12,   12,   12,   12,   12,
+
+       25,   26,   12,   12,   12,   27,   12,   12,   12,   12,
+       28,   12,   12,   12,   12,   29,   12,   30,   12,   12,
+       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
+       12,   12,   32,   12,   12,   12,   12,   12,   33,   12,
+       12,   12,   12,   12,   12,   34,   35,   36,   37,   14,
+       37,   36,   36,   36,   38,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12, 1898,   12,   42,   43,   42,
+       86,   12,   12,   88,   91,   87,   12,   94,   95,   96,
+       97,   12,   41,   92,   93,   98,   12,  100,   12,   85,
+       85,   85,   85,   85,   12,   12,  103,   91,   39,  105,
+       12,  106, 1898,   12,   82,   82,   82,   82,   82,   12,
+      109,   92,   93,  139,  147,  167,   12,   12,   44,   44,
+       44,   45,   45,   46,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   47,   45,   45,   45,   45,   45,
+       48,   45,   49,   50,   45,   51,   45,   52,   53,   54,
+       45,   45,   45,   45,   55,   56,   45,   57,   45,   45,
+       58,   45,   45,   59,   60,   61,   62,   63,   64,   65,
+       66,   67,   52,   68,   69,   70,   71,   72,   73,   74,
+       75,   76,   77,   78,   79,   80,   45,   45,   45,   45,
+       45,   81,   81,  184,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   82,  104,   83,   83,   83,   83,
+       83,  107,  110,  113,  122,   89,  185,   89,  136,   84,
+       90,   90,   90,   90,   90,  140,  168,  189,  123,  137,
+      169,  104,  141,  190,  107,  110,  113,   99,   99,  138,
+       99,   99,   84,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       44,   44,   44,   44,   44,  101,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,  102,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,  114,  191,  156,  142,  157,   45,
+      158,   45,   45,  118,   45,  143,   45,   45,   45,  119,
+      120,  192,  121,   45,   45,  193,   45,  108,  114, 1898,
+      188, 1898,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      129,  190,   45,  130,  131,  151,   45,  132,  133,  152,
-       45,  111,  167,  153,  833,  185,  168,  102,   45,  114,
-      134,  195,   45,  158,   45,  118,  202,  175,  176,  154,
-      155,  159,  156,  160,  157,  186,  169,  112,  161,  162,
-      170,  188,  180,  171,  214,  404,  834,  113,  215,  195,
-      172,  173,  181,  202,  103,  205,  174,  182,  405,  835,
-      177,  189,  178,   85,   85,   85,   85,   85,   81,  201,
-
-       82,   82,   82,   82,   82,  113,   83,  203,  205,   89,
-      836,   89,  179,   83,   90,   90,   90,   90,   90,   81,
-      204,   84,   84,   84,   84,   84,  101,  201,  250,   83,
-      198,  195,  251,  101,   83,  203,   83,   85,   85,   85,
-       85,   85,   90,   90,   90,   90,   90,  204,  209,  234,
-       83,   90,   90,   90,   90,   90,  198,   83,  270,  210,
-      218,  238,  271,  101,  239,  235,  202,  101,  240,  219,
-      220,  101,  302,   83,  201,  263,  264,  265,  267,  101,
-      273,  268,  269,  101,  300,  101,  193,  208,  208,  208,
-      208,  208,  301,  293,  837,  302,  208,  208,  208,  208,
-
-      208,  208,  201,  284,  257,  204,  300,  285,  377,  301,
-      312,  286,  300,  302,  309,  274,  275,  276,  301,  208,
-      208,  208,  208,  208,  208,  313,  277,  315,  278,  319,
-      279,  280,  296,  281,  303,  304,  305,  309,  312,  317,
-      332,  418,  316,  394,  378,  309,  395,  413,  333,  365,
-      315,  435,  313,  334,  335,  421,  319,  421,  379,  427,
-      429,  430,  317,  320,  320,  320,  320,  320,  322,  431,
-      452,  432,  320,  320,  320,  320,  320,  320,  421,  435,
-      422,  495,  427,  459,  551,  486,  487,  453,  427,  460,
-      488,  496,  508,  419,  432,  320,  320,  320,  320,  320,
-
-      320,  538,  366,  612,  539,  367,  438,  438,  438,  438,
-      438,  439,  551,  613,  838,  438,  438,  438,  438,  438,
-      438,  473,  583,  518,  523,  544,  474,  519,  524,  559,
-      545,  560,  551,  841,  674,  584,  576,  585,  438,  438,
-      438,  438,  438,  438,  577,  675,  578,  579,  580,  593,
-      509,  842,  670,  769,  594,  785,  559,  676,  560,  784,
-      561,  674,  719,  720,  770,  792,  795,  796,  816,  797,
-      843,  793,  817,  675,  475,  844,  845,  846,  785,  476,
-       45,   45,   45,   45,   45,  839,  847,  784,  840,   45,
-       45,   45,   45,   45,   45,  848,  849,  850,  851,  852,
-
-      853,  854,  855,  856,  857,  858,  859,  860,  861,  862,
-      863,  864,   45,   45,   45,   45,   45,   45,  865,  866,
-      867,  868,  869,  870,  871,  872,  873,  874,  875,  877,
-      878,  879,  882,  883,  884,  876,  886,  887,  880,  888,
-      885,  889,  881,  890,  891,  892,  893,  894,  895,  896,
-      897,  898,  899,  900,  901,  902,  903,  904,  905,  906,
-      907,  908,  909,  910,  911,  912,  913,  914,  915,  916,
-      917,  918,  919,  920,  921,  922,  923,  924,  925,  926,
-      927,  900,  928,  929,  930,  931,  932,  933,  934,  935,
-      936,  937,  938,  939,  941,  942,  943,  944,  940,  945,
-
-      946,  947,  948,  949,  950,  951,  952,  953,  954,  955,
-      956,  957,  958,  959,  960,  962,  963,  964,  961,  965,
-      966,  967,  968,  969,  970,  971,  972,  973,  974,  975,
-      976,  977,  978,  979,  980,  981,  982,  983,  984,  985,
-      986,  987,  988,  989,  990,  991,  992,  993,  994,  995,
-      996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
-     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
-     1026, 1027, 1028, 1029, 1007, 1030, 1031, 1006, 1032, 1033,
-     1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
-
-     1044, 1045, 1046, 1047, 1049, 1050, 1051, 1052, 1053, 1054,
-     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1071, 1072, 1073, 1074, 1075,
-     1076, 1077, 1078, 1079, 1080, 1070, 1081, 1082, 1083, 1084,
-     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
-     1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
-     1105, 1048, 1106, 1107, 1108, 1110, 1109, 1111, 1112, 1113,
-     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
-     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
-     1134, 1135, 1108, 1109, 1136, 1137, 1138, 1139, 1140, 1141,
-
-     1142, 1143, 1144, 1145, 1146, 1147, 1149, 1151, 1152, 1153,
-     1148, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162,
-     1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
-     1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
-     1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
-     1150, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
-     1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
-     1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
-     1222, 1223, 1224, 1225, 1226, 1227, 1205, 1228, 1229, 1230,
-     1231, 1232, 1206, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
-
-     1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249,
-     1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259,
-     1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269,
-     1270, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280,
-     1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
-     1291, 1292, 1293, 1294, 1296, 1297, 1298, 1299, 1300, 1301,
-     1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
-     1312, 1313, 1314, 1315, 1316, 1317, 1289, 1318, 1319, 1320,
-     1321, 1322, 1323, 1271, 1324, 1325, 1326, 1327, 1328, 1331,
-     1329, 1332, 1333, 1334, 1335, 1336, 1337, 1295, 1330, 1338,
-
-     1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
-     1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
-     1359, 1360, 1362, 1363, 1364, 1365, 1361, 1366, 1367, 1368,
-     1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
-     1379, 1380, 1381, 1382, 1383, 1384, 1363, 1385, 1386, 1387,
-     1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
-     1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
-     1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
-     1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
-     1428, 1429, 1430, 1431, 1432, 1433, 1434, 1436, 1437, 1438,
-
-     1439, 1440, 1441, 1442, 1443, 1444, 1445, 1435, 1446, 1447,
-     1448, 1449, 1423, 1450, 1451, 1452, 1454, 1455, 1456, 1457,
-     1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467,
-     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
-     1478, 1479, 1480, 1481, 1482, 1484, 1483, 1485, 1486, 1487,
-     1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
-     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
-     1508, 1509, 1510, 1453, 1483, 1511, 1512, 1513, 1514, 1515,
-     1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525,
-     1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
-
-     1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545,
-     1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555,
-     1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565,
-     1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
-     1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
-     1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,
-     1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
-     1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
-     1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625,
-     1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
-
-     1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645,
-     1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
-     1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665,
-     1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675,
-     1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
-     1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
-     1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705,
-     1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715,
-     1716, 1717, 1718, 1719, 1720, 1721, 1722,   12,   12,   12,
-       12,   12,   36,   36,   36,   36,   36,   80,  307,   80,
-
-       80,   80,   99,  424,   99,  548,   99,  101,  101,  101,
-      101,  101,  116,  116,  116,  116,  116,  184,  101,  184,
-      184,  184,  206,  206,  206,  830,  829,  828,  827,  826,
-      825,  824,  823,  822,  821,  820,  819,  818,  815,  814,
-      813,  812,  811,  810,  809,  808,  807,  806,  805,  804,
-      803,  802,  801,  800,  799,  798,  794,  791,  790,  789,
-      788,  787,  786,  783,  782,  781,  780,  779,  778,  777,
-      776,  775,  774,  773,  772,  771,  768,  767,  766,  765,
-      764,  763,  762,  761,  760,  759,  758,  757,  756,  755,
-      754,  753,  752,  751,  750,  749,  748,  747,  746,  745,
-
-      744,  743,  742,  739,  738,  737,  736,  735,  734,  733,
-      732,  731,  730,  729,  728,  727,  726,  725,  724,  723,
-      722,  721,  718,  717,  716,  715,  714,  713,  712,  711,
-      710,  709,  708,  707,  706,  705,  704,  703,  702,  701,
-      700,  699,  698,  697,  696,  695,  694,  693,  692,  691,
-      690,  689,  688,  687,  686,  685,  684,  683,  682,  681,
-      680,  679,  678,  677,  673,  672,  671,  670,  669,  668,
-      667,  666,  665,  664,  663,  662,  661,  660,  659,  658,
-      657,  656,  655,  654,  653,  652,  651,  650,  649,  648,
-      647,  646,  645,  644,  643,  642,  641,  640,  639,  638,
-
-      637,  636,  635,  634,  633,  632,  631,  630,  629,  628,
-      627,  626,  625,  624,  623,  622,  621,  620,  619,  618,
-      617,  616,  615,  614,  611,  610,  609,  608,  607,  606,
-      605,  604,  603,  602,  601,  600,  599,  598,  597,  596,
-      595,  592,  591,  590,  589,  588,  587,  586,  582,  581,
-      575,  574,  573,  572,  571,  570,  569,  568,  567,  566,
-      565,  564,  563,  562,  558,  557,  556,  555,  554,  553,
-      552,  550,  549,  547,  546,  543,  542,  541,  540,  537,
-      536,  535,  534,  533,  532,  531,  530,  529,  528,  527,
-      526,  525,  522,  521,  520,  517,  516,  515,  514,  513,
-
-      512,  511,  510,  507,  506,  505,  504,  503,  502,  501,
-      500,  499,  498,  497,  494,  493,  492,  491,  490,  489,
-      485,  484,  483,  482,  481,  480,  479,  478,  477,  472,
-      471,  470,  469,  468,  467,  466,  465,  464,  463,  462,
-      461,  458,  457,  456,  455,  454,  451,  450,  449,  448,
-      447,  446,  445,  444,  443,  442,  441,  440,  437,  436,
-      434,  433,  428,  423,  420,  417,  416,  415,  414,  412,
-      411,  410,  409,  408,  407,  406,  403,  402,  401,  400,
-      399,  398,  397,  396,  393,  392,  391,  390,  389,  388,
-      387,  386,  385,  384,  383,  382,  381,  380,  376,  375,
-
-      374,  373,  372,  371,  370,  369,  368,  364,  363,  362,
-      361,  360,  359,  358,  357,  356,  355,  354,  353,  352,
-      351,  350,  349,  348,  347,  346,  345,  344,  343,  342,
-      341,  340,  339,  338,  337,  336,  331,  330,  329,  328,
-      327,  326,  325,  324,  323,  321,  207,  318,  316,  314,
-      311,  310,  308,  306,  299,  298,  297,  295,  294,  292,
-      291,  290,  289,  288,  287,  272,  266,  262,  261,  260,
-      259,  258,  256,  255,  254,  253,  252,  249,  248,  247,
-      246,  245,  244,  243,  242,  241,  237,  236,  233,  230,
-      229,  228,  227,  224,  223,  222,  221,  217,  216,  213,
-
-      212,  211,  207,  200,  197,  196,  194,  192,  191,  183,
-      166,  146,  122,  110,  107,  106,  104,   43,  100,   98,
-       97,   88,   43, 1723,   11, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723
-
+       45,   45,   45,   45,   45,  108,  111,  124,  188,  152,
+      144,  186,  195,  153,  196,  125,  112,  154,  126,  197,
+      145,  127,  146,  128,  159,  129,  148,  149,  181,  111,
+      150,  198,  160,  155,  161,  201,  151,  186,  182,  162,
+
+      163,  211,  196,  183,  112,  115,  115,  115,  115,  115,
+      116,  115,  115,  115,  115,  115,  115,   45,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,   45,  115,  115,
+      115,   45,  115,  115,  115,   45,  115,  115,  115,  115,
+      115,  115,  115,   45,  115,  115,  115,   45,  115,   45,
+      117,  115,  115,  115,  115,  115,  115,  115,  130,  164,
+      170,  131,  132,  165,  171,  133,  134,  172,  176,  177,
+      187,  199,  200,  166,  173,  174,  202,  204,  135,  203,
+
+      175,  205,  209,  212,  206,  213,  214,  215,  219,  216,
+      220,  224,  225,  210,  226,  227,  187,  199,  217,  200,
+      221,  178,  218,  179,  202,  204,  203,  206,  205,  222,
+      223,  228,  229,  230,  231,  232,  233,  234,  236,  235,
+      239,   87,   87,  180,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   44,  237,  240,  244, 1898, 1898,
+     1898,   44,  241,  207,  245,  242,  246,  247,  248,  243,
+      115,  238,  249,  250,  251,  252,  253,  255,  256,  257,
+      254,  258,  259,  260,  261,  262,  263,  264,  265,  269,
+      291,   44,  266,  267,  268,   44,  286,  287,  270,   44,
+      115,  271,  272,  275,  115,  273,  276,   44,  115,  274,
+      292,   44,  293,   44,  194,  294,  115,  295,  296,  298,
+      115,  299,  115,  115,  115,  115,  115,  288,  203,  115,
+      277,  289,  205,  302,  303,  290,   45,  208,  208,  208,
+
+      208,  208,  304,  301,  308,  307,  208,  208,  208,  208,
+      208,  208,  309,  306,  305,  297,  310,  311,  313,  300,
+      315,  316,  317,  319,  318,  278,  279,  280,  307,  208,
+      208,  208,  208,  208,  208,  321,  281,  314,  282,  306,
+      283,  284,  305,  285,  312,  312,  312,  312,  312,  320,
+      317,  318,  322,  312,  312,  312,  312,  312,  312,  323,
+      314,  324,  328,  329,  330,  331,  326,   45,  333,  334,
+      332,   45,  320,  335,  336,  322,  312,  312,  312,  312,
+      312,  312,  325,  325,  325,  325,  325,  337,  324,  338,
+      339,  325,  325,  325,  325,  325,  325,  340,  341,  345,
+
+      346,  347,  348,   45,  350,  349,  342,  351,  352,  355,
+       45,  343,  344,  353,  325,  325,  325,  325,  325,  325,
+      327,   45,  356,  357,   45,  359,  360,  361,  362,  363,
+      364,  365,  354,  366,  367,  368,  369,  370,   45,  358,
+      372,  373,  374,   45,  378,   45,  377,  380,  381,  382,
+      383,   46,  385,  386,  389,  390,  391,  392,  393,  394,
+      395,  396,  397,  398,  399,  400,  401,  402,  403,  404,
+      406,  407,  405,  408,  409,  410,  411,  412,  413,  414,
+      416,  417,  418,  419,  421,  422,   45,  424,  321,  387,
+      371,  425,  415,  423,  426,  375,  379,  420,  376,  427,
+
+      428,  430,  431,  388,  432,  433,  434,  435,  435,  435,
+      435,  435,  436,  439,  443,  384,  435,  435,  435,  435,
+      435,  435,  437,  444,  438,  440,  441,  432,  445,  446,
+      447,  448,  450,  451,  442,  452,  453,  443,   45,  435,
+      435,  435,  435,  435,  435,  456,  455,  457,  458,  459,
+      454,  460,  429,  438,   45,  461,  462,  446,  463,  464,
+      465,  466,  467,  449,  449,  449,  449,  449,  470,  471,
+      472,   45,  449,  449,  449,  449,  449,  449,  469,  468,
+      473,   45,  474,  476,  477,  478,  479,  480,  475,  481,
+       45,  482,   45,  484,  485,  449,  449,  449,  449,  449,
+
+      449,  486,   45,  488,  492,  493,  494,  495,  489,  496,
+      497,  498,  499,  500,  501,  502,  504,  505,  506,  503,
+       45,  508,  509,  512,  513,  510,  514,  515,  516,  517,
+      518,  519,   45,  507,  483,  511,   45,  521,  522,  523,
+      525,  526,  520,  527,  528,  529,  530,  531,  533,  534,
+      535,   45,  538,  539,  536,  487,  490,  542,  540,  543,
+       45,  491,  541,  545,  546,  547,  548,  549,  550,  551,
+      552,  553,  554,  555,  557,  537,  556,  558,  559,  560,
+      561,  563,  564,  565,  567,  562,  568,  569,  570,  566,
+      566,  566,  566,  566,  571,  572,  532,  524,  566,  566,
+
+      566,  566,  566,  566,  573,  574,  575,  576,  577,  579,
+      578,  580,  581,  582,  544,  569,  584,   45,  583,  585,
+      587,  566,  566,  566,  566,  566,  566,   45,  589,   45,
+       45,   45,   45,   45,  586,  577,  590,  578,   45,   45,
+       45,   45,   45,   45,  591,  592,   45,  593,  594,  596,
+      597,   45,   45,  598,  604,  605,  609,  610,  611,  612,
+      599,   45,   45,   45,   45,   45,   45,  595,  600,  606,
+      601,  602,  603,  588,  613,  614,  615,  618,  616,  619,
+      620,  621,  607,  617,  608,  622,  623,  624,  625,  626,
+      627,  628,  629,  630,  631,  632,  633,  634,  635,  637,
+
+       45,  639,  640,  641,  642,  643,  644,  645,  636,  646,
+      647,  648,  649,  650,  651,  652,  653,  654,  655,  656,
+      657,  658,  659,  660,  661,  638,  662,  663,  664,  665,
+      666,  667,  668,  669,  670,  671,  672,   45,  674,   45,
+      676,  673,  677,  678,  679,  680,  681,  682,  683,  684,
+      685,  686,  687,  688,  689,  690,  691,  692,  693,  694,
+      696,  695,  697,  675,   44,   44,   44,   44,   44,  698,
+      702,  703,  706,   44,   44,   44,   44,   44,   44,   45,
+      699,  700,  701,  704,  707,  705,  708,   45,  712,  713,
+      714,  715,  709,  716,  717,  710,   44,   44,   44,   44,
+
+       44,   44,  711,  718,  719,  720,  721,  722,  700,  723,
+      701,  724,  725,   45,  726,  727,  728,  729,  730,  731,
+      732,  733,  734,  735,  736,  737,  738,  739,  740,  741,
+      742,  743,  744,  745,   45,  747,  748,  749,  750,  751,
+      752,  753,  746,  755,   45,  757,  758,  759,  760,  756,
+       45,   45,  762,  763,  754,  764,  765,  766,  767,  768,
+      769,   45,  770,   45,  771,  772,   45,  774,  776,  777,
+      761,  778,  779,  780,  781,  782,  783,  784,  785,  786,
+      787,  788,  789,  790,  791,  792,  793,  794,   45,  795,
+      796,  797,  798,  799,  800,  801,  802,  803,  804,  805,
+
+      807,  808,  809,  810,  811,   45,  775,  813,  814,  815,
+      806,  816,  817,  818,  773,  819,  820,  821,  822,   45,
+      823,  812,  824,   45,  826,  827,  825,  828,  829,  830,
+      831,   45,  833,  834,  835,  838,  836,  842,  832,  843,
+      844,  822,  837,  839,  840,  821,  841,  845,  846,  847,
+      848,  849,   45,  851,  852,  853,  854,  855,  856,  857,
+      858,   45,  862,  863,  860,  864,  859,  850,  861,  865,
+      866,  867,  868,  869,  870,  871,  872,  873,  874,  875,
+      876,  877,  878,  879,  880,  881,  882,  883,  884,  886,
+      887,  885,  888,  889,  890,  891,  892,  893,  894,   45,
+
+      895,  896,  897,  898,  899,  900,  901,  902,  903,  904,
+      905,   45,  907,  908,  909,  910,  911,  912,  913,  914,
+      915,  916,  917,  918,  919,  920,  921,  906,  922,  924,
+      925,  926,  929,  930,  931,  923,  933,  934,  927,  935,
+      932,  936,  928,  937,   45,  938,  939,  940,  941,  942,
+      944,  945,  946,  943,  947,  948,  949,  950,  951,  952,
+      953,  954,  955,  956,   45,   45,  959,  960,  958,  961,
+      962,   45,  964,  965,  963,  966,  967,  968,  969,  970,
+      957,  971,  972,  973,  949,  974,  975,  976,  977,  978,
+      979,  980,  981,  982,  983,  984,  985,  986,  987,  988,
+
+      989,  990,  991,   45,  992,  993,  994,  995,  997,  998,
+      999, 1000,  996, 1001, 1002,   45, 1003, 1004, 1005, 1006,
+     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014,   45, 1016,
+     1017, 1019, 1020, 1021, 1018, 1015, 1022, 1023, 1024,   46,
+     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,   45,
+     1036, 1037, 1038, 1039, 1035, 1040, 1041, 1042,   45, 1043,
+     1044, 1045,   45, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+     1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
+     1063,   45, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+       45, 1073,   45, 1072, 1074, 1025, 1075,   45, 1076, 1077,
+
+     1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1068,
+     1087, 1088, 1067, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+     1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,   45, 1115,
+     1117, 1118, 1119, 1120,   45, 1122, 1123, 1124, 1121, 1125,
+     1126, 1127, 1128, 1129, 1130, 1131, 1114, 1132, 1133, 1134,
+     1135, 1136, 1137, 1138, 1140, 1141, 1142, 1143, 1144, 1145,
+     1146,   45,   45,   45, 1139, 1148, 1147, 1149,   45, 1151,
+     1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161,
+     1162, 1163, 1164, 1165, 1166, 1167, 1168, 1116, 1169, 1170,
+
+     1171, 1172, 1173, 1174, 1175,   45, 1177, 1178, 1179, 1180,
+     1181, 1176, 1182, 1183, 1185, 1184, 1186, 1187, 1188, 1189,
+     1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1150,   45,
+       45, 1199, 1198,   45, 1201, 1202, 1203, 1204, 1181, 1182,
+     1205, 1206, 1207,   45, 1209, 1200, 1210, 1211, 1212, 1213,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222,   45,
+     1224, 1208, 1225, 1226, 1227, 1229, 1231, 1232,   45, 1228,
+     1233, 1234, 1235, 1236,   45, 1237, 1238, 1239, 1240, 1241,
+     1223, 1242, 1243, 1244,   45, 1245,   45, 1246, 1247, 1248,
+     1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1260,
+
+     1261, 1262,   45, 1258, 1264, 1265, 1266, 1267, 1268, 1230,
+     1269, 1270, 1263, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+     1278, 1279, 1280, 1281, 1282, 1283, 1284,   45,   45, 1285,
+     1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296,
+     1297,   45, 1259, 1299, 1300, 1286, 1301, 1302,   45, 1303,
+     1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1292, 1312,
+     1313, 1314,   45, 1315, 1293, 1316, 1318,   45, 1319, 1320,
+     1321, 1322, 1323, 1324, 1325, 1326, 1327,   45, 1317, 1328,
+     1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
+     1339, 1340, 1341, 1342, 1343,   45, 1345, 1298, 1346, 1347,
+
+     1348,   46, 1350, 1351, 1352, 1353, 1354, 1344, 1355, 1356,
+     1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366,
+     1367, 1368, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377,
+     1378,   46, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+     1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,   45, 1397,
+     1398, 1399, 1400, 1401, 1403, 1404, 1396, 1405, 1406, 1407,
+     1408, 1349, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1389,
+     1416, 1417, 1418, 1419, 1369, 1420, 1421, 1422, 1423, 1424,
+     1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+     1435,   45, 1379, 1437, 1439, 1440, 1441, 1402, 1442, 1443,
+
+     1444, 1438, 1445,   45, 1447,   45, 1449, 1450,   45, 1451,
+     1452, 1453, 1446, 1454, 1455, 1456, 1457, 1458, 1459, 1460,
+     1461, 1448, 1462, 1463, 1464, 1465, 1466, 1467,   45, 1469,
+     1470, 1471, 1472, 1473, 1475, 1468, 1476, 1477, 1474,   45,
+     1479, 1480,   46, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+     1489, 1436, 1490, 1491, 1492, 1493, 1494, 1478, 1495, 1476,
+     1496, 1497, 1498, 1499, 1500,   45, 1502, 1503, 1504, 1505,
+     1506, 1507,   45, 1508, 1509, 1510, 1501, 1511, 1512, 1513,
+       45, 1515, 1516, 1514, 1481, 1517, 1518, 1519, 1520, 1521,
+     1522, 1523, 1524, 1525, 1526,   45, 1528, 1527, 1529, 1530,
+
+     1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540,
+     1541,   45, 1542, 1543,   45, 1544, 1545, 1546, 1547, 1548,
+     1549, 1550, 1551,   46, 1553, 1554, 1555, 1556, 1557, 1558,
+     1559, 1560, 1561, 1562, 1563, 1564,   45, 1565,   45, 1568,
+     1569, 1570, 1571, 1572, 1573, 1574, 1575, 1549, 1566, 1576,
+     1577, 1578, 1579, 1580, 1581, 1582, 1583, 1585, 1586, 1587,
+     1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597,
+     1598, 1599, 1600, 1601, 1602, 1603,   45, 1567, 1605, 1606,
+     1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1552, 1615,
+     1616, 1617, 1618, 1619, 1604, 1620, 1621, 1622, 1623, 1624,
+
+     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
+     1635, 1636, 1637, 1638, 1584,   45, 1640, 1641,   46, 1643,
+     1644, 1619, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652,
+     1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662,
+     1663, 1664,   46, 1666, 1667, 1668, 1669, 1670,   46, 1672,
+     1673, 1674, 1675,   46, 1677, 1678, 1679, 1680, 1681, 1682,
+     1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692,
+     1693, 1642, 1694, 1639, 1695, 1696, 1697, 1698, 1699, 1700,
+     1701, 1702, 1703, 1704, 1665, 1705, 1706,   45, 1708,   45,
+       45, 1711, 1710, 1709,   45, 1712, 1713, 1714,   45, 1716,
+
+     1671, 1717, 1718, 1719, 1721, 1707,   45, 1722, 1723, 1715,
+     1724, 1720, 1725, 1726, 1727, 1676, 1728, 1729, 1730, 1731,
+     1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739,   46, 1741,
+     1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751,
+     1752, 1753, 1754,   45, 1756, 1757, 1758, 1759, 1760, 1761,
+     1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771,
+     1772, 1773, 1774, 1775,   45, 1776, 1777, 1755, 1778, 1779,
+     1780, 1740, 1781, 1782, 1783, 1784, 1785, 1786, 1787,   45,
+     1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+     1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+
+     1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815,   45, 1817,
+       45, 1819, 1820, 1821, 1822,   45, 1824, 1825, 1826, 1823,
+     1816, 1818, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
+     1835,   46, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844,
+     1845, 1846, 1847, 1848, 1849, 1850, 1851,   46, 1853, 1854,
+     1855, 1856, 1857,   45, 1859, 1860, 1861, 1862, 1863, 1864,
+     1865, 1866, 1867, 1868, 1869, 1870,   45, 1858, 1872, 1873,
+     1874, 1871, 1875, 1876, 1877,   45,   46, 1879, 1880, 1881,
+     1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891,
+     1892, 1836, 1893, 1894, 1895, 1896, 1897, 1898, 1898, 1898,
+
+     1898, 1898, 1852, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1878, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898
     } ;
 
-static const flex_int16_t yy_chk[2199] =
+static const flex_int16_t yy_chk[2965] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  627,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  109,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      627,    8,    8,    8,    1,    8,   44,   27,   28,  109,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   48,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   66,
-       10,    2,    2,   48,  131,  131,   25,   66,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      136,   57,  136,    2,    2,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    7,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,   11,    9,   13,   14,   13,
+       21,    5,    5,   24,   26,   21,    5,   31,   32,   33,
+       38,    5,    9,   27,   28,   39,    5,   41,    5,   19,
+       19,   19,   19,   19,    5,    5,   47,   26,    5,   49,
+        7,   50,   20,    5,   20,   20,   20,   20,   20,    5,
+       53,   27,   28,   64,   68,   74,    5,    5,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,  718,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   64,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   91,   20,  169,  169,
-       55,   61,   59,   63,   22,   64,   17,   93,   59,   61,
-       55,   59,   61,   19,   63,   61,   64,   61,   65,   61,
-       20,   67,   91,   55,   63,   65,   73,   22,   45,   92,
-       73,   67,  719,   67,   45,   93,   45,   45,   55,   45,
-       73,   45,   45,   45,  308,   58,   69,   69,   45,   45,
-
-       69,   45,   58,   96,  308,   92,   69,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   16,   16,   79,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   17,   48,   17,   17,   17,   17,
+       17,   51,   54,   56,   60,   25,   80,   25,   63,   17,
+       25,   25,   25,   25,   25,   65,   75,   94,   60,   63,
+       75,   48,   65,   95,   51,   54,   56,   40,   40,   63,
+       40,   40,   17,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,   57,   96,   71,   66,   71,   45,
+       71,   45,   45,   59,   45,   66,   45,   45,   45,   59,
+       59,   98,   59,   45,   45,   99,   45,   52,   57,   89,
+       93,   89,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       62,   96,   58,   62,   62,   70,   58,   62,   62,   70,
-       58,   71,   75,   70,  720,   94,   75,  101,   58,   78,
-       62,  105,   58,   72,   58,   58,  112,   77,   77,   70,
-       71,   72,   71,   72,   71,   95,   76,   77,   72,   72,
-       76,   94,   78,   76,  123,  285,  721,   77,  123,  105,
-       76,   76,   78,  112,  101,  115,   76,   78,  285,  722,
-       77,   95,   77,   81,   81,   81,   81,   81,   82,  111,
-
-       82,   82,   82,   82,   82,   77,   81,  113,  115,   83,
-      723,   83,   77,   82,   83,   83,   83,   83,   83,   84,
-      114,   84,   84,   84,   84,   84,  103,  111,  151,   81,
-      108,  119,  151,  103,   84,  113,   82,   85,   85,   85,
-       85,   85,   89,   89,   89,   89,   89,  114,  119,  138,
-       85,   90,   90,   90,   90,   90,  108,   84,  166,  119,
-      126,  141,  166,  103,  141,  138,  177,  103,  141,  126,
-      126,  103,  187,   85,  157,  163,  163,  163,  165,  103,
-      168,  165,  165,  103,  185,  103,  103,  118,  118,  118,
-      118,  118,  186,  177,  724,  187,  118,  118,  118,  118,
-
-      118,  118,  157,  170,  157,  180,  188,  170,  261,  189,
-      198,  170,  185,  190,  195,  168,  168,  168,  186,  118,
-      118,  118,  118,  118,  118,  199,  168,  201,  168,  205,
-      168,  168,  180,  168,  188,  189,  190,  195,  198,  203,
-      220,  298,  293,  276,  261,  210,  276,  293,  220,  251,
-      201,  315,  199,  220,  220,  300,  205,  303,  261,  309,
-      311,  311,  203,  208,  208,  208,  208,  208,  210,  311,
-      335,  312,  208,  208,  208,  208,  208,  208,  300,  315,
-      303,  372,  322,  342,  427,  365,  365,  335,  309,  342,
-      365,  372,  385,  298,  312,  208,  208,  208,  208,  208,
-
-      208,  413,  251,  487,  413,  251,  320,  320,  320,  320,
-      320,  322,  427,  487,  725,  320,  320,  320,  320,  320,
-      320,  355,  459,  395,  399,  419,  355,  395,  399,  437,
-      419,  437,  439,  727,  559,  459,  456,  459,  320,  320,
-      320,  320,  320,  320,  456,  560,  456,  456,  456,  468,
-      385,  728,  561,  658,  468,  675,  437,  561,  437,  674,
-      439,  559,  606,  606,  658,  682,  684,  684,  703,  684,
-      729,  682,  703,  560,  355,  731,  732,  733,  675,  355,
-      438,  438,  438,  438,  438,  726,  734,  674,  726,  438,
-      438,  438,  438,  438,  438,  735,  736,  737,  738,  739,
-
-      741,  742,  743,  744,  745,  746,  747,  748,  749,  750,
-      751,  752,  438,  438,  438,  438,  438,  438,  753,  754,
-      755,  756,  757,  758,  759,  760,  761,  762,  763,  764,
-      765,  765,  766,  767,  768,  763,  770,  771,  765,  772,
-      768,  773,  765,  774,  775,  776,  777,  778,  779,  780,
-      781,  782,  784,  785,  786,  787,  788,  789,  790,  791,
-      792,  793,  795,  796,  797,  798,  799,  800,  801,  802,
-      803,  804,  805,  806,  807,  808,  809,  810,  811,  812,
-      813,  785,  814,  815,  816,  817,  818,  819,  821,  822,
-      823,  824,  825,  826,  827,  828,  829,  830,  826,  831,
-
-      832,  833,  834,  837,  838,  839,  840,  841,  842,  845,
-      846,  847,  848,  849,  850,  851,  852,  853,  850,  854,
-      855,  856,  859,  860,  861,  862,  863,  864,  865,  866,
-      867,  868,  869,  870,  871,  872,  873,  874,  875,  876,
-      877,  878,  879,  880,  881,  882,  883,  884,  885,  887,
-      888,  889,  890,  891,  892,  893,  894,  895,  896,  897,
-      899,  900,  901,  902,  903,  904,  906,  907,  908,  909,
-      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
-      920,  921,  922,  923,  900,  924,  925,  899,  926,  927,
-      929,  930,  931,  932,  933,  934,  935,  936,  937,  938,
-
-      940,  941,  942,  943,  944,  946,  947,  948,  949,  950,
-      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
-      961,  962,  963,  964,  965,  966,  968,  969,  970,  971,
-      973,  974,  975,  976,  977,  965,  978,  979,  980,  981,
-      982,  983,  984,  985,  986,  987,  988,  989,  990,  992,
-      993,  994,  995,  996,  997,  998,  999, 1000, 1001, 1002,
-     1003,  943, 1004, 1005, 1006, 1008, 1007, 1009, 1010, 1011,
-     1012, 1013, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
-     1023, 1024, 1025, 1026, 1027, 1028, 1029, 1031, 1032, 1033,
-     1034, 1035, 1006, 1007, 1036, 1037, 1038, 1039, 1040, 1041,
-
-     1042, 1043, 1044, 1045, 1046, 1048, 1049, 1050, 1051, 1052,
-     1048, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061,
-     1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
-     1072, 1073, 1074, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1088, 1089, 1090, 1092, 1093, 1094,
-     1049, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
-     1104, 1105, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1115,
-     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1124, 1125, 1126,
-     1127, 1128, 1130, 1131, 1132, 1133, 1108, 1134, 1135, 1136,
-     1137, 1138, 1109, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
-
-     1148, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158,
-     1159, 1160, 1162, 1163, 1164, 1165, 1167, 1168, 1169, 1170,
-     1171, 1174, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
-     1184, 1185, 1186, 1187, 1188, 1189, 1190, 1192, 1193, 1194,
-     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
-     1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1217, 1218,
-     1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
-     1229, 1230, 1232, 1233, 1234, 1235, 1205, 1236, 1237, 1238,
-     1239, 1240, 1241, 1184, 1242, 1243, 1244, 1245, 1246, 1248,
-     1247, 1249, 1250, 1251, 1252, 1254, 1257, 1211, 1247, 1258,
-
-     1259, 1260, 1261, 1262, 1263, 1264, 1265, 1267, 1268, 1269,
-     1270, 1271, 1272, 1273, 1275, 1276, 1278, 1281, 1283, 1285,
-     1286, 1287, 1288, 1289, 1291, 1292, 1287, 1293, 1295, 1296,
-     1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306,
-     1307, 1308, 1309, 1311, 1313, 1314, 1289, 1315, 1316, 1317,
-     1318, 1319, 1320, 1321, 1322, 1325, 1327, 1328, 1329, 1330,
-     1331, 1332, 1333, 1334, 1336, 1337, 1338, 1339, 1340, 1341,
-     1343, 1344, 1346, 1347, 1348, 1349, 1351, 1352, 1353, 1354,
-     1355, 1356, 1357, 1359, 1361, 1363, 1365, 1366, 1367, 1368,
-     1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
-
-     1379, 1380, 1381, 1382, 1383, 1384, 1385, 1375, 1386, 1387,
-     1388, 1389, 1363, 1390, 1390, 1391, 1392, 1393, 1394, 1395,
-     1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
-     1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1416,
-     1417, 1418, 1420, 1421, 1422, 1425, 1423, 1428, 1429, 1430,
-     1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1444,
-     1445, 1446, 1447, 1448, 1449, 1450, 1451, 1453, 1454, 1456,
-     1458, 1459, 1460, 1391, 1423, 1462, 1463, 1464, 1465, 1467,
-     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
-     1478, 1479, 1480, 1482, 1483, 1484, 1485, 1486, 1488, 1489,
-
-     1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499,
-     1500, 1502, 1503, 1504, 1506, 1508, 1509, 1510, 1511, 1512,
-     1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1522, 1523,
-     1525, 1528, 1531, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
-     1540, 1541, 1543, 1544, 1546, 1547, 1548, 1549, 1550, 1551,
-     1553, 1554, 1555, 1557, 1558, 1559, 1560, 1561, 1562, 1563,
-     1564, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574,
-     1576, 1577, 1578, 1579, 1580, 1581, 1582, 1585, 1586, 1587,
-     1588, 1589, 1590, 1591, 1593, 1594, 1595, 1596, 1597, 1598,
-     1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1608, 1609,
-
-     1610, 1611, 1612, 1614, 1618, 1620, 1621, 1622, 1623, 1625,
-     1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1637,
-     1638, 1640, 1641, 1644, 1645, 1646, 1647, 1648, 1649, 1650,
-     1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660,
-     1661, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
-     1672, 1673, 1674, 1675, 1677, 1678, 1680, 1681, 1682, 1683,
-     1684, 1685, 1687, 1689, 1690, 1692, 1693, 1694, 1695, 1696,
-     1697, 1700, 1703, 1704, 1705, 1706, 1707, 1709, 1710, 1712,
-     1713, 1714, 1716, 1717, 1718, 1720, 1721, 1724, 1724, 1724,
-     1724, 1724, 1725, 1725, 1725, 1725, 1725, 1726, 1732, 1726,
-
-     1726, 1726, 1727, 1733, 1727, 1734, 1727, 1728, 1728, 1728,
-     1728, 1728, 1729, 1729, 1729, 1729, 1729, 1730, 1735, 1730,
-     1730, 1730, 1731, 1731, 1731,  717,  716,  715,  714,  713,
-      712,  711,  710,  708,  707,  706,  705,  704,  702,  701,
-      700,  699,  698,  697,  696,  695,  694,  693,  692,  691,
-      690,  689,  688,  687,  686,  685,  683,  681,  680,  679,
-      678,  677,  676,  673,  672,  671,  669,  668,  666,  665,
-      664,  663,  662,  661,  660,  659,  656,  655,  654,  653,
-      652,  651,  650,  649,  648,  647,  646,  645,  644,  642,
-      641,  640,  639,  638,  637,  636,  635,  634,  632,  631,
-
-      630,  629,  628,  626,  625,  624,  623,  622,  621,  620,
-      618,  617,  616,  615,  614,  613,  612,  611,  610,  609,
-      608,  607,  605,  604,  603,  602,  601,  600,  599,  598,
-      597,  596,  595,  594,  592,  591,  590,  589,  588,  587,
-      586,  585,  584,  583,  582,  581,  580,  579,  578,  577,
-      576,  575,  574,  573,  572,  571,  570,  569,  568,  567,
-      566,  565,  564,  563,  557,  555,  552,  551,  550,  549,
-      547,  546,  545,  543,  542,  539,  538,  537,  536,  535,
-      534,  533,  532,  531,  530,  529,  528,  527,  526,  525,
-      524,  523,  522,  521,  520,  519,  518,  517,  516,  515,
-
-      514,  513,  512,  511,  509,  507,  506,  505,  504,  503,
-      502,  501,  500,  499,  498,  497,  496,  495,  493,  492,
-      491,  490,  489,  488,  486,  485,  484,  483,  482,  481,
-      480,  479,  478,  477,  476,  475,  474,  472,  471,  470,
-      469,  467,  466,  465,  464,  463,  461,  460,  458,  457,
-      454,  453,  452,  451,  450,  449,  448,  446,  445,  444,
-      443,  442,  441,  440,  435,  434,  432,  431,  430,  429,
-      428,  426,  425,  423,  420,  418,  417,  415,  414,  412,
-      411,  410,  409,  408,  407,  406,  405,  404,  403,  402,
-      401,  400,  398,  397,  396,  394,  393,  392,  391,  389,
-
-      388,  387,  386,  384,  383,  382,  381,  380,  379,  378,
-      377,  376,  375,  373,  371,  370,  369,  368,  367,  366,
-      364,  363,  362,  361,  360,  359,  358,  357,  356,  354,
-      353,  352,  351,  350,  349,  348,  347,  346,  345,  344,
-      343,  341,  340,  339,  338,  337,  334,  333,  332,  331,
-      330,  329,  328,  327,  326,  325,  324,  323,  319,  317,
-      314,  313,  310,  306,  299,  297,  296,  295,  294,  292,
-      291,  290,  289,  288,  287,  286,  284,  283,  282,  281,
-      280,  279,  278,  277,  275,  274,  273,  272,  271,  270,
-      269,  268,  267,  266,  265,  264,  263,  262,  260,  259,
-
-      258,  257,  256,  255,  254,  253,  252,  250,  249,  248,
-      247,  246,  245,  244,  243,  241,  240,  239,  238,  237,
-      236,  235,  234,  233,  232,  231,  230,  229,  228,  227,
-      226,  225,  224,  223,  222,  221,  219,  218,  217,  216,
-      215,  214,  213,  212,  211,  209,  206,  204,  202,  200,
-      197,  196,  194,  191,  183,  182,  181,  179,  178,  176,
-      175,  174,  173,  172,  171,  167,  164,  162,  161,  160,
-      159,  158,  156,  155,  154,  153,  152,  150,  149,  148,
-      147,  146,  145,  144,  143,  142,  140,  139,  137,  135,
-      134,  133,  132,  130,  129,  128,  127,  125,  124,  122,
-
-      121,  120,  116,  110,  107,  106,  104,   99,   98,   79,
-       74,   68,   60,   53,   50,   49,   47,   43,   41,   39,
-       38,   24,   14,   11, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723,
-     1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723
+       45,   45,   45,   45,   45,   52,   55,   61,   93,   70,
+       67,   91,  103,   70,  104,   61,   55,   70,   61,  105,
+       67,   61,   67,   61,   72,   61,   69,   69,   78,   55,
+       69,  106,   72,   70,   72,  109,   69,   91,   78,   72,
+
+       72,  119,  104,   78,   55,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   62,   73,
+       76,   62,   62,   73,   76,   62,   62,   76,   77,   77,
+       92,  107,  108,   73,   76,   76,  110,  112,   62,  111,
+
+       76,  113,  118,  120,  114,  121,  122,  123,  125,  124,
+      126,  128,  129,  118,  130,  131,   92,  107,  124,  108,
+      127,   77,  124,   77,  110,  112,  111,  114,  113,  127,
+      127,  132,  132,  133,  134,  135,  136,  137,  138,  137,
+      140,   87,   87,   77,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,  102,  139,  141,  143,  115,  115,
+      115,  102,  142,  115,  144,  142,  145,  146,  147,  142,
+      115,  139,  148,  149,  150,  151,  152,  153,  154,  155,
+      152,  156,  157,  158,  159,  160,  161,  162,  163,  165,
+      172,  102,  164,  164,  164,  102,  170,  170,  166,  102,
+      115,  166,  166,  168,  115,  167,  168,  102,  115,  167,
+      173,  102,  174,  102,  102,  175,  115,  176,  177,  179,
+      115,  180,  115,  115,  117,  117,  117,  171,  178,  117,
+      169,  171,  181,  183,  184,  171,  182,  117,  117,  117,
+
+      117,  117,  185,  182,  189,  188,  117,  117,  117,  117,
+      117,  117,  190,  187,  186,  178,  191,  192,  195,  181,
+      197,  198,  199,  201,  200,  169,  169,  169,  188,  117,
+      117,  117,  117,  117,  117,  203,  169,  196,  169,  187,
+      169,  169,  186,  169,  194,  194,  194,  194,  194,  202,
+      199,  200,  204,  194,  194,  194,  194,  194,  194,  205,
+      196,  206,  210,  211,  212,  213,  209,  214,  215,  216,
+      214,  213,  202,  217,  218,  204,  194,  194,  194,  194,
+      194,  194,  208,  208,  208,  208,  208,  219,  206,  220,
+      221,  208,  208,  208,  208,  208,  208,  222,  223,  224,
+
+      225,  226,  227,  228,  229,  228,  223,  230,  231,  234,
+      232,  223,  223,  232,  208,  208,  208,  208,  208,  208,
+      209,  233,  235,  236,  237,  238,  239,  240,  241,  242,
+      243,  244,  233,  246,  247,  248,  249,  250,  251,  237,
+      252,  253,  254,  255,  256,  257,  255,  258,  259,  260,
+      261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+      271,  272,  273,  274,  275,  276,  277,  278,  279,  280,
+      281,  282,  280,  283,  284,  285,  286,  287,  288,  289,
+      290,  291,  292,  293,  295,  296,  294,  298,  297,  264,
+      251,  299,  289,  297,  300,  254,  257,  294,  254,  301,
+
+      302,  303,  304,  264,  305,  308,  311,  312,  312,  312,
+      312,  312,  313,  315,  317,  262,  312,  312,  312,  312,
+      312,  312,  313,  318,  314,  316,  316,  305,  319,  320,
+      322,  324,  327,  328,  316,  329,  330,  317,  331,  312,
+      312,  312,  312,  312,  312,  333,  332,  334,  335,  336,
+      331,  337,  302,  314,  332,  338,  339,  320,  340,  341,
+      342,  343,  344,  325,  325,  325,  325,  325,  347,  348,
+      349,  316,  325,  325,  325,  325,  325,  325,  346,  344,
+      350,  346,  351,  352,  353,  354,  355,  356,  351,  357,
+      352,  358,  359,  360,  361,  325,  325,  325,  325,  325,
+
+      325,  362,  363,  364,  365,  366,  367,  368,  364,  369,
+      370,  371,  372,  373,  374,  374,  375,  376,  377,  374,
+      378,  379,  380,  382,  384,  381,  385,  386,  387,  388,
+      389,  390,  391,  378,  359,  381,  390,  392,  393,  394,
+      395,  396,  391,  397,  398,  399,  401,  402,  403,  404,
+      405,  406,  407,  408,  405,  363,  364,  410,  409,  411,
+      412,  364,  409,  413,  414,  415,  416,  417,  418,  419,
+      420,  421,  422,  423,  424,  406,  423,  425,  427,  428,
+      429,  430,  431,  434,  436,  429,  437,  438,  439,  435,
+      435,  435,  435,  435,  440,  441,  402,  394,  435,  435,
+
+      435,  435,  435,  435,  442,  443,  445,  446,  448,  450,
+      448,  451,  452,  453,  412,  438,  454,  438,  453,  455,
+      457,  435,  435,  435,  435,  435,  435,  458,  459,  449,
+      449,  449,  449,  449,  456,  448,  460,  448,  449,  449,
+      449,  449,  449,  449,  461,  463,  456,  464,  465,  467,
+      468,  466,  465,  469,  472,  473,  475,  476,  478,  479,
+      471,  449,  449,  449,  449,  449,  449,  466,  471,  474,
+      471,  471,  471,  458,  480,  481,  482,  484,  483,  485,
+      486,  487,  474,  483,  474,  489,  490,  491,  492,  493,
+      494,  495,  496,  497,  498,  499,  500,  501,  502,  503,
+
+      504,  505,  506,  507,  508,  510,  511,  512,  502,  513,
+      514,  515,  516,  517,  518,  519,  520,  521,  522,  524,
+      526,  527,  528,  529,  530,  504,  531,  532,  533,  534,
+      535,  536,  537,  538,  539,  540,  541,  542,  543,  544,
+      545,  542,  546,  547,  548,  549,  550,  551,  552,  553,
+      554,  555,  556,  559,  560,  562,  563,  564,  565,  567,
+      569,  568,  570,  544,  566,  566,  566,  566,  566,  573,
+      579,  580,  584,  566,  566,  566,  566,  566,  566,  568,
+      575,  577,  578,  583,  585,  583,  586,  575,  588,  589,
+      590,  591,  587,  592,  593,  587,  566,  566,  566,  566,
+
+      566,  566,  587,  594,  595,  596,  597,  598,  577,  599,
+      578,  600,  601,  601,  602,  603,  604,  605,  606,  607,
+      608,  609,  610,  611,  612,  613,  614,  615,  617,  618,
+      619,  620,  621,  622,  623,  624,  625,  626,  627,  628,
+      629,  629,  623,  630,  631,  632,  633,  634,  635,  631,
+      636,  632,  637,  638,  629,  639,  640,  641,  643,  644,
+      645,  646,  646,  609,  647,  648,  649,  650,  651,  652,
+      636,  653,  654,  655,  657,  658,  659,  660,  661,  662,
+      663,  664,  665,  666,  667,  669,  670,  671,  660,  672,
+      673,  674,  675,  676,  677,  678,  679,  680,  681,  683,
+
+      684,  685,  686,  687,  688,  689,  650,  690,  691,  692,
+      683,  694,  695,  697,  649,  698,  699,  700,  701,  692,
+      702,  689,  703,  704,  705,  706,  704,  707,  708,  709,
+      710,  711,  712,  713,  714,  716,  715,  718,  711,  719,
+      720,  701,  715,  717,  717,  700,  717,  721,  722,  723,
+      724,  725,  726,  727,  728,  729,  730,  731,  732,  733,
+      734,  735,  737,  738,  736,  739,  735,  726,  736,  740,
+      741,  743,  744,  745,  746,  747,  748,  749,  750,  751,
+      752,  753,  754,  755,  756,  757,  758,  759,  760,  761,
+      762,  760,  763,  765,  766,  767,  768,  769,  770,  769,
+
+      771,  772,  773,  775,  776,  777,  778,  779,  780,  781,
+      782,  783,  784,  785,  786,  787,  788,  789,  790,  791,
+      792,  793,  794,  795,  796,  797,  798,  783,  799,  800,
+      801,  801,  802,  803,  804,  799,  806,  807,  801,  808,
+      804,  809,  801,  810,  803,  811,  812,  813,  814,  815,
+      816,  817,  818,  815,  819,  821,  822,  823,  824,  825,
+      826,  827,  828,  829,  830,  831,  832,  833,  831,  834,
+      835,  836,  837,  839,  836,  840,  841,  842,  843,  844,
+      830,  845,  846,  847,  822,  848,  849,  850,  851,  852,
+      853,  854,  855,  856,  857,  858,  859,  860,  861,  862,
 
+      863,  865,  866,  856,  867,  868,  869,  870,  871,  872,
+      873,  874,  870,  875,  876,  868,  877,  878,  879,  882,
+      883,  884,  885,  886,  887,  890,  891,  892,  893,  894,
+      895,  896,  897,  898,  895,  893,  899,  900,  901,  904,
+      905,  906,  907,  908,  909,  910,  911,  912,  913,  914,
+      915,  916,  917,  918,  914,  919,  920,  921,  921,  922,
+      923,  924,  915,  925,  926,  927,  928,  929,  930,  931,
+      932,  934,  935,  936,  937,  938,  939,  940,  941,  942,
+      943,  897,  944,  945,  946,  948,  949,  950,  951,  952,
+      953,  954,  941,  953,  955,  904,  956,  946,  957,  958,
+
+      959,  960,  962,  963,  964,  965,  966,  967,  968,  949,
+      969,  970,  948,  971,  972,  973,  974,  975,  976,  977,
+      978,  979,  980,  981,  982,  983,  985,  986,  987,  988,
+      989,  990,  991,  992,  993,  994,  996,  997,  998,  999,
+     1000, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1005, 1009,
+     1010, 1011, 1012, 1013, 1014, 1015,  998, 1016, 1017, 1018,
+     1019, 1020, 1021, 1022, 1023, 1025, 1026, 1027, 1028, 1029,
+     1030, 1026, 1032, 1018, 1022, 1033, 1032, 1034, 1035, 1036,
+     1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046,
+     1047, 1048, 1049, 1051, 1052, 1053, 1054,  999, 1055, 1056,
+
+     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
+     1067, 1062, 1068, 1069, 1071, 1070, 1072, 1073, 1074, 1075,
+     1076, 1077, 1078, 1079, 1080, 1081, 1083, 1084, 1035, 1070,
+     1085, 1086, 1085, 1087, 1088, 1089, 1090, 1091, 1067, 1068,
+     1092, 1093, 1094, 1095, 1096, 1087, 1097, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+     1112, 1095, 1113, 1114, 1116, 1117, 1118, 1119, 1113, 1116,
+     1120, 1121, 1122, 1123, 1112, 1124, 1125, 1126, 1127, 1128,
+     1111, 1129, 1130, 1131, 1127, 1132, 1132, 1133, 1134, 1135,
+     1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1146,
+
+     1147, 1148, 1149, 1144, 1150, 1151, 1152, 1153, 1154, 1117,
+     1155, 1156, 1149, 1157, 1159, 1160, 1161, 1163, 1164, 1165,
+     1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1173,
+     1175, 1176, 1177, 1178, 1180, 1181, 1182, 1183, 1184, 1185,
+     1186, 1187, 1144, 1188, 1189, 1174, 1190, 1191, 1192, 1192,
+     1193, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1181, 1202,
+     1204, 1205, 1202, 1206, 1182, 1207, 1210, 1208, 1211, 1212,
+     1213, 1214, 1215, 1216, 1217, 1218, 1219, 1205, 1208, 1220,
+     1221, 1222, 1223, 1224, 1225, 1228, 1230, 1231, 1232, 1233,
+     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1187, 1241, 1243,
+
+     1244, 1245, 1246, 1248, 1249, 1250, 1251, 1239, 1252, 1255,
+     1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1277, 1278,
+     1279, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
+     1291, 1292, 1293, 1294, 1296, 1297, 1298, 1299, 1300, 1301,
+     1302, 1303, 1304, 1305, 1306, 1307, 1300, 1308, 1309, 1311,
+     1312, 1245, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1292,
+     1320, 1321, 1322, 1323, 1269, 1324, 1326, 1327, 1328, 1329,
+     1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+     1340, 1341, 1282, 1342, 1343, 1344, 1345, 1305, 1346, 1347,
+
+     1349, 1342, 1352, 1353, 1354, 1355, 1356, 1357, 1345, 1358,
+     1359, 1360, 1353, 1361, 1362, 1363, 1365, 1366, 1367, 1368,
+     1369, 1355, 1370, 1371, 1373, 1374, 1376, 1379, 1381, 1383,
+     1384, 1385, 1386, 1387, 1388, 1381, 1389, 1391, 1387, 1392,
+     1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1402, 1403,
+     1404, 1341, 1405, 1406, 1407, 1408, 1409, 1392, 1410, 1389,
+     1411, 1412, 1413, 1414, 1415, 1416, 1418, 1420, 1421, 1422,
+     1423, 1424, 1409, 1425, 1426, 1427, 1416, 1428, 1429, 1432,
+     1433, 1435, 1436, 1433, 1395, 1437, 1438, 1439, 1440, 1441,
+     1442, 1444, 1445, 1446, 1447, 1448, 1449, 1448, 1450, 1451,
+
+     1452, 1454, 1455, 1457, 1458, 1459, 1460, 1462, 1463, 1464,
+     1465, 1460, 1466, 1467, 1466, 1468, 1470, 1471, 1472, 1474,
+     1476, 1477, 1478, 1479, 1481, 1482, 1485, 1486, 1487, 1488,
+     1489, 1490, 1491, 1492, 1493, 1494, 1496, 1495, 1481, 1497,
+     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1476, 1495, 1505,
+     1506, 1507, 1508, 1509, 1510, 1510, 1511, 1512, 1513, 1514,
+     1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524,
+     1525, 1526, 1527, 1528, 1529, 1530, 1532, 1496, 1533, 1534,
+     1535, 1536, 1537, 1538, 1540, 1541, 1542, 1544, 1479, 1545,
+     1546, 1547, 1548, 1549, 1532, 1550, 1552, 1553, 1555, 1556,
+
+     1559, 1560, 1561, 1564, 1565, 1566, 1567, 1568, 1569, 1570,
+     1571, 1572, 1575, 1576, 1511, 1577, 1578, 1579, 1580, 1581,
+     1582, 1549, 1584, 1585, 1587, 1588, 1590, 1591, 1592, 1594,
+     1595, 1596, 1597, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
+     1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1616,
+     1617, 1618, 1619, 1620, 1621, 1622, 1624, 1625, 1626, 1628,
+     1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638,
+     1639, 1580, 1640, 1577, 1642, 1643, 1644, 1646, 1647, 1649,
+     1650, 1651, 1652, 1653, 1608, 1654, 1655, 1656, 1657, 1658,
+     1646, 1660, 1659, 1658, 1659, 1661, 1662, 1663, 1665, 1666,
+
+     1614, 1668, 1671, 1672, 1676, 1656, 1673, 1678, 1679, 1665,
+     1681, 1673, 1682, 1683, 1684, 1620, 1685, 1686, 1687, 1688,
+     1689, 1691, 1692, 1694, 1695, 1696, 1697, 1698, 1699, 1700,
+     1702, 1703, 1704, 1706, 1707, 1708, 1709, 1710, 1711, 1712,
+     1713, 1714, 1715, 1717, 1718, 1719, 1720, 1722, 1723, 1724,
+     1725, 1726, 1727, 1728, 1729, 1731, 1732, 1733, 1734, 1735,
+     1736, 1737, 1740, 1741, 1725, 1742, 1743, 1717, 1744, 1745,
+     1746, 1699, 1747, 1749, 1750, 1751, 1752, 1753, 1754, 1750,
+     1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764,
+     1765, 1766, 1767, 1769, 1770, 1771, 1772, 1773, 1774, 1776,
+
+     1780, 1782, 1783, 1784, 1785, 1786, 1787, 1789, 1792, 1794,
+     1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1804, 1800,
+     1792, 1795, 1805, 1808, 1810, 1811, 1814, 1815, 1816, 1817,
+     1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827,
+     1828, 1829, 1830, 1831, 1832, 1833, 1834, 1836, 1837, 1838,
+     1839, 1840, 1841, 1842, 1843, 1844, 1845, 1847, 1848, 1849,
+     1852, 1853, 1855, 1856, 1857, 1858, 1859, 1842, 1860, 1862,
+     1864, 1859, 1865, 1867, 1868, 1852, 1869, 1870, 1871, 1872,
+     1875, 1878, 1879, 1880, 1881, 1882, 1884, 1885, 1887, 1888,
+     1889, 1819, 1891, 1892, 1893, 1895, 1896, 1898, 1898, 1898,
+
+     1898, 1898, 1836, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1869, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898,
+     1898, 1898, 1898, 1898
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1826,30 +2049,31 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[194] =
+static const flex_int16_t yy_rule_linenum[209] =
     {   0,
-      147,  149,  151,  156,  157,  162,  163,  164,  176,  179,
-      184,  191,  200,  209,  218,  227,  236,  245,  255,  264,
-      273,  282,  291,  300,  309,  318,  327,  336,  345,  354,
-      363,  375,  384,  393,  402,  411,  422,  433,  444,  455,
-      465,  475,  486,  497,  508,  519,  530,  541,  552,  563,
-      574,  585,  594,  605,  616,  627,  638,  649,  658,  667,
-      678,  689,  700,  711,  722,  733,  743,  752,  762,  776,
-      792,  801,  810,  819,  828,  849,  870,  879,  889,  898,
-      909,  918,  927,  936,  945,  954,  964,  973,  984,  995,
-     1007, 1016, 1026, 1035, 1044, 1053, 1062, 1071, 1080, 1089,
-
-     1098, 1108, 1119, 1131, 1140, 1149, 1159, 1169, 1179, 1189,
-     1199, 1209, 1218, 1228, 1237, 1246, 1255, 1264, 1274, 1284,
-     1293, 1303, 1312, 1321, 1330, 1339, 1348, 1357, 1366, 1375,
-     1384, 1393, 1402, 1411, 1420, 1429, 1438, 1447, 1456, 1465,
-     1474, 1483, 1492, 1501, 1510, 1519, 1528, 1537, 1546, 1555,
-     1564, 1573, 1582, 1594, 1606, 1616, 1626, 1636, 1646, 1656,
-     1666, 1676, 1686, 1696, 1705, 1714, 1723, 1732, 1741, 1750,
-     1759, 1770, 1781, 1794, 1807, 1822, 1921, 1926, 1931, 1936,
-     1937, 1938, 1939, 1940, 1941, 1943, 1961, 1974, 1979, 1983,
-     1985, 1987, 1989
-
+      146,  148,  150,  155,  156,  161,  162,  163,  175,  178,
+      183,  190,  199,  208,  217,  226,  235,  244,  254,  263,
+      272,  281,  290,  299,  308,  317,  326,  335,  344,  353,
+      362,  371,  380,  389,  399,  408,  420,  429,  438,  447,
+      456,  467,  478,  489,  500,  510,  520,  531,  542,  553,
+      564,  575,  586,  597,  608,  619,  630,  639,  650,  661,
+      672,  683,  694,  703,  712,  723,  734,  745,  756,  767,
+      778,  788,  797,  807,  821,  837,  846,  855,  864,  873,
+      894,  915,  924,  934,  943,  954,  963,  972,  981,  990,
+      999, 1009, 1018, 1029, 1040, 1051, 1062, 1074, 1083, 1093,
+
+     1102, 1111, 1120, 1129, 1138, 1147, 1156, 1165, 1174, 1183,
+     1192, 1201, 1210, 1219, 1229, 1240, 1252, 1261, 1270, 1280,
+     1290, 1300, 1310, 1320, 1330, 1339, 1349, 1358, 1367, 1376,
+     1385, 1395, 1405, 1414, 1424, 1433, 1442, 1451, 1460, 1469,
+     1478, 1487, 1496, 1505, 1514, 1523, 1532, 1541, 1550, 1559,
+     1568, 1577, 1586, 1595, 1604, 1613, 1622, 1631, 1640, 1649,
+     1658, 1667, 1676, 1685, 1694, 1703, 1712, 1721, 1733, 1745,
+     1755, 1765, 1775, 1785, 1795, 1805, 1815, 1825, 1835, 1844,
+     1853, 1862, 1871, 1880, 1889, 1898, 1909, 1920, 1933, 1946,
+     1961, 2060, 2065, 2070, 2075, 2076, 2077, 2078, 2079, 2080,
+
+     2082, 2100, 2113, 2118, 2122, 2124, 2126, 2128
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1861,7 +2085,7 @@ static const flex_int16_t yy_rule_linenum[194] =
 #define YY_RESTORE_YY_MORE_OFFSET
 char *yytext;
 #line 1 "dhcp4_lexer.ll"
-/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -1902,7 +2126,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1905 "dhcp4_lexer.cc"
+#line 2129 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1928,8 +2152,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1931 "dhcp4_lexer.cc"
-#line 1932 "dhcp4_lexer.cc"
+#line 2155 "dhcp4_lexer.cc"
+#line 2156 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2259,7 +2483,7 @@ YY_DECL
     }
 
 
-#line 2262 "dhcp4_lexer.cc"
+#line 2486 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2288,13 +2512,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1724 )
+				if ( yy_current_state >= 1899 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1723 );
+		while ( yy_current_state != 1898 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2313,13 +2537,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 194 )
+			else if ( yy_act < 209 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 194 )
+			else if ( yy_act == 209 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 195 )
+			else if ( yy_act == 210 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2655,6 +2879,67 @@ YY_RULE_SETUP
 case 31:
 YY_RULE_SETUP
 #line 363 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_WRITE_BEHIND_CACHE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("write-behind-cache", driver.loc_);
+    }
+}
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+#line 372 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_WRITE_BACK_LATENCY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("write-back-latency", driver.loc_);
+    }
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+#line 381 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_JOURNAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-journal", driver.loc_);
+    }
+}
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+#line 390 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_READ_REPLICAS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("read-replicas", driver.loc_);
+    }
+}
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+#line 400 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_ALLOCATE_OR_RENEW(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("allocate-or-renew", driver.loc_);
+    }
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+#line 409 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2667,9 +2952,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 37:
 YY_RULE_SETUP
-#line 375 "dhcp4_lexer.ll"
+#line 421 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2679,9 +2964,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 38:
 YY_RULE_SETUP
-#line 384 "dhcp4_lexer.ll"
+#line 430 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2691,9 +2976,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 39:
 YY_RULE_SETUP
-#line 393 "dhcp4_lexer.ll"
+#line 439 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2703,9 +2988,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 40:
 YY_RULE_SETUP
-#line 402 "dhcp4_lexer.ll"
+#line 448 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2715,9 +3000,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 41:
 YY_RULE_SETUP
-#line 411 "dhcp4_lexer.ll"
+#line 457 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2729,9 +3014,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 42:
 YY_RULE_SETUP
-#line 422 "dhcp4_lexer.ll"
+#line 468 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2743,9 +3028,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 43:
 YY_RULE_SETUP
-#line 433 "dhcp4_lexer.ll"
+#line 479 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2757,9 +3042,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 44:
 YY_RULE_SETUP
-#line 444 "dhcp4_lexer.ll"
+#line 490 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2771,9 +3056,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 45:
 YY_RULE_SETUP
-#line 455 "dhcp4_lexer.ll"
+#line 501 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2784,9 +3069,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 46:
 YY_RULE_SETUP
-#line 465 "dhcp4_lexer.ll"
+#line 511 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2797,9 +3082,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 47:
 YY_RULE_SETUP
-#line 475 "dhcp4_lexer.ll"
+#line 521 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2811,9 +3096,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 48:
 YY_RULE_SETUP
-#line 486 "dhcp4_lexer.ll"
+#line 532 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2825,9 +3110,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 49:
 YY_RULE_SETUP
-#line 497 "dhcp4_lexer.ll"
+#line 543 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2839,9 +3124,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 50:
 YY_RULE_SETUP
-#line 508 "dhcp4_lexer.ll"
+#line 554 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2853,9 +3138,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 51:
 YY_RULE_SETUP
-#line 519 "dhcp4_lexer.ll"
+#line 565 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2867,9 +3152,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 52:
 YY_RULE_SETUP
-#line 530 "dhcp4_lexer.ll"
+#line 576 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2881,9 +3166,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 53:
 YY_RULE_SETUP
-#line 541 "dhcp4_lexer.ll"
+#line 587 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2895,9 +3180,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 54:
 YY_RULE_SETUP
-#line 552 "dhcp4_lexer.ll"
+#line 598 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2909,9 +3194,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 55:
 YY_RULE_SETUP
-#line 563 "dhcp4_lexer.ll"
+#line 609 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2923,9 +3208,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 56:
 YY_RULE_SETUP
-#line 574 "dhcp4_lexer.ll"
+#line 620 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2937,9 +3222,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 57:
 YY_RULE_SETUP
-#line 585 "dhcp4_lexer.ll"
+#line 631 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2949,9 +3234,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 58:
 YY_RULE_SETUP
-#line 594 "dhcp4_lexer.ll"
+#line 640 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2963,9 +3248,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 59:
 YY_RULE_SETUP
-#line 605 "dhcp4_lexer.ll"
+#line 651 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2977,9 +3262,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 60:
 YY_RULE_SETUP
-#line 616 "dhcp4_lexer.ll"
+#line 662 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2991,9 +3276,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 61:
 YY_RULE_SETUP
-#line 627 "dhcp4_lexer.ll"
+#line 673 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3005,9 +3290,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 62:
 YY_RULE_SETUP
-#line 638 "dhcp4_lexer.ll"
+#line 684 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3019,9 +3304,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 63:
 YY_RULE_SETUP
-#line 649 "dhcp4_lexer.ll"
+#line 695 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3031,9 +3316,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 64:
 YY_RULE_SETUP
-#line 658 "dhcp4_lexer.ll"
+#line 704 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3043,9 +3328,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 65:
 YY_RULE_SETUP
-#line 667 "dhcp4_lexer.ll"
+#line 713 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3057,9 +3342,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 66:
 YY_RULE_SETUP
-#line 678 "dhcp4_lexer.ll"
+#line 724 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3071,9 +3356,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 67:
 YY_RULE_SETUP
-#line 689 "dhcp4_lexer.ll"
+#line 735 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3085,9 +3370,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 68:
 YY_RULE_SETUP
-#line 700 "dhcp4_lexer.ll"
+#line 746 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3099,9 +3384,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 69:
 YY_RULE_SETUP
-#line 711 "dhcp4_lexer.ll"
+#line 757 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3113,9 +3398,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 70:
 YY_RULE_SETUP
-#line 722 "dhcp4_lexer.ll"
+#line 768 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3127,9 +3412,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 71:
 YY_RULE_SETUP
-#line 733 "dhcp4_lexer.ll"
+#line 779 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3140,9 +3425,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 72:
 YY_RULE_SETUP
-#line 743 "dhcp4_lexer.ll"
+#line 789 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3152,9 +3437,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 73:
 YY_RULE_SETUP
-#line 752 "dhcp4_lexer.ll"
+#line 798 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3165,9 +3450,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 74:
 YY_RULE_SETUP
-#line 762 "dhcp4_lexer.ll"
+#line 808 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3182,9 +3467,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 75:
 YY_RULE_SETUP
-#line 776 "dhcp4_lexer.ll"
+#line 822 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -3201,9 +3486,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 76:
 YY_RULE_SETUP
-#line 792 "dhcp4_lexer.ll"
+#line 838 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3213,9 +3498,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 77:
 YY_RULE_SETUP
-#line 801 "dhcp4_lexer.ll"
+#line 847 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3225,9 +3510,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 78:
 YY_RULE_SETUP
-#line 810 "dhcp4_lexer.ll"
+#line 856 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3237,9 +3522,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 79:
 YY_RULE_SETUP
-#line 819 "dhcp4_lexer.ll"
+#line 865 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -3249,9 +3534,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 80:
 YY_RULE_SETUP
-#line 828 "dhcp4_lexer.ll"
+#line 874 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3273,9 +3558,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 81:
 YY_RULE_SETUP
-#line 849 "dhcp4_lexer.ll"
+#line 895 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3297,9 +3582,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 82:
 YY_RULE_SETUP
-#line 870 "dhcp4_lexer.ll"
+#line 916 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3309,9 +3594,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 83:
 YY_RULE_SETUP
-#line 879 "dhcp4_lexer.ll"
+#line 925 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3322,9 +3607,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 84:
 YY_RULE_SETUP
-#line 889 "dhcp4_lexer.ll"
+#line 935 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3334,9 +3619,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 85:
 YY_RULE_SETUP
-#line 898 "dhcp4_lexer.ll"
+#line 944 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3348,9 +3633,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 86:
 YY_RULE_SETUP
-#line 909 "dhcp4_lexer.ll"
+#line 955 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3360,9 +3645,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 87:
 YY_RULE_SETUP
-#line 918 "dhcp4_lexer.ll"
+#line 964 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3372,9 +3657,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 88:
 YY_RULE_SETUP
-#line 927 "dhcp4_lexer.ll"
+#line 973 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3384,9 +3669,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 89:
 YY_RULE_SETUP
-#line 936 "dhcp4_lexer.ll"
+#line 982 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3396,9 +3681,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 90:
 YY_RULE_SETUP
-#line 945 "dhcp4_lexer.ll"
+#line 991 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3408,9 +3693,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 91:
 YY_RULE_SETUP
-#line 954 "dhcp4_lexer.ll"
+#line 1000 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3421,9 +3706,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 92:
 YY_RULE_SETUP
-#line 964 "dhcp4_lexer.ll"
+#line 1010 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3433,9 +3718,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 93:
 YY_RULE_SETUP
-#line 973 "dhcp4_lexer.ll"
+#line 1019 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3447,9 +3732,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 94:
 YY_RULE_SETUP
-#line 984 "dhcp4_lexer.ll"
+#line 1030 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3461,9 +3746,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 95:
 YY_RULE_SETUP
-#line 995 "dhcp4_lexer.ll"
+#line 1041 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3471,122 +3756,222 @@ YY_RULE_SETUP
     case isc::dhcp::Parser4Context::SHARED_NETWORK:
         return isc::dhcp::Dhcp4Parser::make_T2_PERCENT(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("t2-percent", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("t2-percent", driver.loc_);
+    }
+}
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+#line 1052 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+    case isc::dhcp::Parser4Context::SUBNET4:
+    case isc::dhcp::Parser4Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_THRESHOLD(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-threshold", driver.loc_);
+    }
+}
+	YY_BREAK
+case 97:
+YY_RULE_SETUP
+#line 1063 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+    case isc::dhcp::Parser4Context::SUBNET4:
+    case isc::dhcp::Parser4Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_MAX_AGE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-max-age", driver.loc_);
+    }
+}
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+#line 1075 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::CONFIG:
+        return isc::dhcp::Dhcp4Parser::make_LOGGING(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("Logging", driver.loc_);
+    }
+}
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+#line 1084 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+    case isc::dhcp::Parser4Context::LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_LOGGERS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("loggers", driver.loc_);
+    }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 1094 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_OUTPUT_OPTIONS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("output_options", driver.loc_);
+    }
+}
+	YY_BREAK
+case 101:
+YY_RULE_SETUP
+#line 1103 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_OUTPUT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("output", driver.loc_);
+    }
+}
+	YY_BREAK
+case 102:
+YY_RULE_SETUP
+#line 1112 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_DEBUGLEVEL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("debuglevel", driver.loc_);
+    }
+}
+	YY_BREAK
+case 103:
+YY_RULE_SETUP
+#line 1121 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_RATE_LIMITED_MESSAGES(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate-limited-messages", driver.loc_);
     }
 }
 	YY_BREAK
-case 91:
+case 104:
 YY_RULE_SETUP
-#line 1007 "dhcp4_lexer.ll"
+#line 1130 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
-    case isc::dhcp::Parser4Context::CONFIG:
-        return isc::dhcp::Dhcp4Parser::make_LOGGING(driver.loc_);
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_RATE_LIMIT(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("Logging", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate-limit", driver.loc_);
     }
 }
 	YY_BREAK
-case 92:
+case 105:
 YY_RULE_SETUP
-#line 1016 "dhcp4_lexer.ll"
+#line 1139 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
-    case isc::dhcp::Parser4Context::DHCP4:
-    case isc::dhcp::Parser4Context::LOGGING:
-        return isc::dhcp::Dhcp4Parser::make_LOGGERS(driver.loc_);
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_RATE_LIMIT_INTERVAL(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("loggers", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate-limit-interval", driver.loc_);
     }
 }
 	YY_BREAK
-case 93:
+case 106:
 YY_RULE_SETUP
-#line 1026 "dhcp4_lexer.ll"
+#line 1148 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
-    case isc::dhcp::Parser4Context::LOGGERS:
-        return isc::dhcp::Dhcp4Parser::make_OUTPUT_OPTIONS(driver.loc_);
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_FLUSH(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("output_options", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("flush", driver.loc_);
     }
 }
 	YY_BREAK
-case 94:
+case 107:
 YY_RULE_SETUP
-#line 1035 "dhcp4_lexer.ll"
+#line 1157 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
-        return isc::dhcp::Dhcp4Parser::make_OUTPUT(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_MAXSIZE(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("output", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("maxsize", driver.loc_);
     }
 }
 	YY_BREAK
-case 95:
+case 108:
 YY_RULE_SETUP
-#line 1044 "dhcp4_lexer.ll"
+#line 1166 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
-    case isc::dhcp::Parser4Context::LOGGERS:
-        return isc::dhcp::Dhcp4Parser::make_DEBUGLEVEL(driver.loc_);
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_MAXVER(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("debuglevel", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("maxver", driver.loc_);
     }
 }
 	YY_BREAK
-case 96:
+case 109:
 YY_RULE_SETUP
-#line 1053 "dhcp4_lexer.ll"
+#line 1175 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
-        return isc::dhcp::Dhcp4Parser::make_FLUSH(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_PATTERN(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("flush", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("pattern", driver.loc_);
     }
 }
 	YY_BREAK
-case 97:
+case 110:
 YY_RULE_SETUP
-#line 1062 "dhcp4_lexer.ll"
+#line 1184 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
-        return isc::dhcp::Dhcp4Parser::make_MAXSIZE(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("maxsize", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
     }
 }
 	YY_BREAK
-case 98:
+case 111:
 YY_RULE_SETUP
-#line 1071 "dhcp4_lexer.ll"
+#line 1193 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
-        return isc::dhcp::Dhcp4Parser::make_MAXVER(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("maxver", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("async-queue-size", driver.loc_);
     }
 }
 	YY_BREAK
-case 99:
+case 112:
 YY_RULE_SETUP
-#line 1080 "dhcp4_lexer.ll"
+#line 1202 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
-        return isc::dhcp::Dhcp4Parser::make_PATTERN(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_ASYNC_OVERFLOW(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("pattern", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("async-overflow", driver.loc_);
     }
 }
 	YY_BREAK
-case 100:
+case 113:
 YY_RULE_SETUP
-#line 1089 "dhcp4_lexer.ll"
+#line 1211 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3596,9 +3981,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 114:
 YY_RULE_SETUP
-#line 1098 "dhcp4_lexer.ll"
+#line 1220 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3609,9 +3994,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 115:
 YY_RULE_SETUP
-#line 1108 "dhcp4_lexer.ll"
+#line 1230 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3623,9 +4008,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 116:
 YY_RULE_SETUP
-#line 1119 "dhcp4_lexer.ll"
+#line 1241 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3638,9 +4023,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 117:
 YY_RULE_SETUP
-#line 1131 "dhcp4_lexer.ll"
+#line 1253 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3650,9 +4035,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 118:
 YY_RULE_SETUP
-#line 1140 "dhcp4_lexer.ll"
+#line 1262 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3662,9 +4047,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 119:
 YY_RULE_SETUP
-#line 1149 "dhcp4_lexer.ll"
+#line 1271 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3675,9 +4060,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 120:
 YY_RULE_SETUP
-#line 1159 "dhcp4_lexer.ll"
+#line 1281 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3688,9 +4073,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 121:
 YY_RULE_SETUP
-#line 1169 "dhcp4_lexer.ll"
+#line 1291 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3701,9 +4086,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 122:
 YY_RULE_SETUP
-#line 1179 "dhcp4_lexer.ll"
+#line 1301 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3714,9 +4099,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 123:
 YY_RULE_SETUP
-#line 1189 "dhcp4_lexer.ll"
+#line 1311 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3727,9 +4112,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 124:
 YY_RULE_SETUP
-#line 1199 "dhcp4_lexer.ll"
+#line 1321 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3740,9 +4125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 125:
 YY_RULE_SETUP
-#line 1209 "dhcp4_lexer.ll"
+#line 1331 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3752,9 +4137,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 126:
 YY_RULE_SETUP
-#line 1218 "dhcp4_lexer.ll"
+#line 1340 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3765,9 +4150,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 127:
 YY_RULE_SETUP
-#line 1228 "dhcp4_lexer.ll"
+#line 1350 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3777,9 +4162,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 128:
 YY_RULE_SETUP
-#line 1237 "dhcp4_lexer.ll"
+#line 1359 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3789,9 +4174,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 129:
 YY_RULE_SETUP
-#line 1246 "dhcp4_lexer.ll"
+#line 1368 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3801,9 +4186,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 130:
 YY_RULE_SETUP
-#line 1255 "dhcp4_lexer.ll"
+#line 1377 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3813,9 +4198,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 131:
 YY_RULE_SETUP
-#line 1264 "dhcp4_lexer.ll"
+#line 1386 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3826,9 +4211,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 132:
 YY_RULE_SETUP
-#line 1274 "dhcp4_lexer.ll"
+#line 1396 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3839,9 +4224,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 133:
 YY_RULE_SETUP
-#line 1284 "dhcp4_lexer.ll"
+#line 1406 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3851,9 +4236,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 134:
 YY_RULE_SETUP
-#line 1293 "dhcp4_lexer.ll"
+#line 1415 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3863,9 +4248,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 135:
 YY_RULE_SETUP
-#line 1303 "dhcp4_lexer.ll"
+#line 1425 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3875,9 +4260,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 136:
 YY_RULE_SETUP
-#line 1312 "dhcp4_lexer.ll"
+#line 1434 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3887,9 +4272,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 137:
 YY_RULE_SETUP
-#line 1321 "dhcp4_lexer.ll"
+#line 1443 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3899,9 +4284,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 138:
 YY_RULE_SETUP
-#line 1330 "dhcp4_lexer.ll"
+#line 1452 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3911,9 +4296,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 139:
 YY_RULE_SETUP
-#line 1339 "dhcp4_lexer.ll"
+#line 1461 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3923,9 +4308,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 140:
 YY_RULE_SETUP
-#line 1348 "dhcp4_lexer.ll"
+#line 1470 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3935,9 +4320,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 141:
 YY_RULE_SETUP
-#line 1357 "dhcp4_lexer.ll"
+#line 1479 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3947,9 +4332,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 142:
 YY_RULE_SETUP
-#line 1366 "dhcp4_lexer.ll"
+#line 1488 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3959,9 +4344,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 143:
 YY_RULE_SETUP
-#line 1375 "dhcp4_lexer.ll"
+#line 1497 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3971,9 +4356,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 144:
+YY_RULE_SETUP
+#line 1506 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp4Parser::make_BACKGROUND_RECLAMATION(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("background-reclamation", driver.loc_);
+    }
+}
+	YY_BREAK
+case 145:
 YY_RULE_SETUP
-#line 1384 "dhcp4_lexer.ll"
+#line 1515 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3983,9 +4380,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 146:
+YY_RULE_SETUP
+#line 1524 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_LEASE_QUERY_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lease-query-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 147:
 YY_RULE_SETUP
-#line 1393 "dhcp4_lexer.ll"
+#line 1533 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3995,9 +4404,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 148:
 YY_RULE_SETUP
-#line 1402 "dhcp4_lexer.ll"
+#line 1542 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4007,9 +4416,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 149:
 YY_RULE_SETUP
-#line 1411 "dhcp4_lexer.ll"
+#line 1551 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4019,9 +4428,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 150:
 YY_RULE_SETUP
-#line 1420 "dhcp4_lexer.ll"
+#line 1560 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4031,9 +4440,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 151:
 YY_RULE_SETUP
-#line 1429 "dhcp4_lexer.ll"
+#line 1569 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4043,9 +4452,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 152:
 YY_RULE_SETUP
-#line 1438 "dhcp4_lexer.ll"
+#line 1578 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4055,9 +4464,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 153:
 YY_RULE_SETUP
-#line 1447 "dhcp4_lexer.ll"
+#line 1587 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4067,9 +4476,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 154:
 YY_RULE_SETUP
-#line 1456 "dhcp4_lexer.ll"
+#line 1596 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4079,9 +4488,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 155:
 YY_RULE_SETUP
-#line 1465 "dhcp4_lexer.ll"
+#line 1605 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4091,9 +4500,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 156:
 YY_RULE_SETUP
-#line 1474 "dhcp4_lexer.ll"
+#line 1614 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4103,9 +4512,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 157:
 YY_RULE_SETUP
-#line 1483 "dhcp4_lexer.ll"
+#line 1623 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4115,9 +4524,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 158:
 YY_RULE_SETUP
-#line 1492 "dhcp4_lexer.ll"
+#line 1632 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4127,9 +4536,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 159:
 YY_RULE_SETUP
-#line 1501 "dhcp4_lexer.ll"
+#line 1641 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4139,9 +4548,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 160:
 YY_RULE_SETUP
-#line 1510 "dhcp4_lexer.ll"
+#line 1650 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4151,9 +4560,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 161:
 YY_RULE_SETUP
-#line 1519 "dhcp4_lexer.ll"
+#line 1659 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4163,9 +4572,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 162:
 YY_RULE_SETUP
-#line 1528 "dhcp4_lexer.ll"
+#line 1668 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4175,9 +4584,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 163:
 YY_RULE_SETUP
-#line 1537 "dhcp4_lexer.ll"
+#line 1677 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4187,9 +4596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 164:
 YY_RULE_SETUP
-#line 1546 "dhcp4_lexer.ll"
+#line 1686 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4199,9 +4608,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 165:
 YY_RULE_SETUP
-#line 1555 "dhcp4_lexer.ll"
+#line 1695 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4211,9 +4620,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 166:
 YY_RULE_SETUP
-#line 1564 "dhcp4_lexer.ll"
+#line 1704 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4223,9 +4632,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 167:
 YY_RULE_SETUP
-#line 1573 "dhcp4_lexer.ll"
+#line 1713 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4235,9 +4644,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 168:
 YY_RULE_SETUP
-#line 1582 "dhcp4_lexer.ll"
+#line 1722 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4250,9 +4659,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 169:
 YY_RULE_SETUP
-#line 1594 "dhcp4_lexer.ll"
+#line 1734 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4265,9 +4674,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 170:
 YY_RULE_SETUP
-#line 1606 "dhcp4_lexer.ll"
+#line 1746 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4278,9 +4687,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 156:
+case 171:
 YY_RULE_SETUP
-#line 1616 "dhcp4_lexer.ll"
+#line 1756 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4291,9 +4700,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 157:
+case 172:
 YY_RULE_SETUP
-#line 1626 "dhcp4_lexer.ll"
+#line 1766 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -4304,9 +4713,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 158:
+case 173:
 YY_RULE_SETUP
-#line 1636 "dhcp4_lexer.ll"
+#line 1776 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4317,9 +4726,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 159:
+case 174:
 YY_RULE_SETUP
-#line 1646 "dhcp4_lexer.ll"
+#line 1786 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4330,9 +4739,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 160:
+case 175:
 YY_RULE_SETUP
-#line 1656 "dhcp4_lexer.ll"
+#line 1796 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4343,9 +4752,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 161:
+case 176:
 YY_RULE_SETUP
-#line 1666 "dhcp4_lexer.ll"
+#line 1806 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4356,9 +4765,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 162:
+case 177:
 YY_RULE_SETUP
-#line 1676 "dhcp4_lexer.ll"
+#line 1816 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4369,9 +4778,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 163:
+case 178:
 YY_RULE_SETUP
-#line 1686 "dhcp4_lexer.ll"
+#line 1826 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4382,9 +4791,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 164:
+case 179:
 YY_RULE_SETUP
-#line 1696 "dhcp4_lexer.ll"
+#line 1836 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4394,9 +4803,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 180:
 YY_RULE_SETUP
-#line 1705 "dhcp4_lexer.ll"
+#line 1845 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4406,9 +4815,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 166:
+case 181:
 YY_RULE_SETUP
-#line 1714 "dhcp4_lexer.ll"
+#line 1854 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4418,9 +4827,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 167:
+case 182:
 YY_RULE_SETUP
-#line 1723 "dhcp4_lexer.ll"
+#line 1863 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4430,9 +4839,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 168:
+case 183:
 YY_RULE_SETUP
-#line 1732 "dhcp4_lexer.ll"
+#line 1872 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4442,9 +4851,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 169:
+case 184:
 YY_RULE_SETUP
-#line 1741 "dhcp4_lexer.ll"
+#line 1881 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4454,9 +4863,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 170:
+case 185:
 YY_RULE_SETUP
-#line 1750 "dhcp4_lexer.ll"
+#line 1890 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4466,9 +4875,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 171:
+case 186:
 YY_RULE_SETUP
-#line 1759 "dhcp4_lexer.ll"
+#line 1899 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4480,9 +4889,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 187:
 YY_RULE_SETUP
-#line 1770 "dhcp4_lexer.ll"
+#line 1910 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4494,9 +4903,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 173:
+case 188:
 YY_RULE_SETUP
-#line 1781 "dhcp4_lexer.ll"
+#line 1921 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4510,9 +4919,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 174:
+case 189:
 YY_RULE_SETUP
-#line 1794 "dhcp4_lexer.ll"
+#line 1934 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4526,9 +4935,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 175:
+case 190:
 YY_RULE_SETUP
-#line 1807 "dhcp4_lexer.ll"
+#line 1947 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4542,9 +4951,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 176:
+case 191:
 YY_RULE_SETUP
-#line 1822 "dhcp4_lexer.ll"
+#line 1962 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4644,65 +5053,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 177:
-/* rule 177 can match eol */
+case 192:
+/* rule 192 can match eol */
 YY_RULE_SETUP
-#line 1921 "dhcp4_lexer.ll"
+#line 2061 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 178:
-/* rule 178 can match eol */
+case 193:
+/* rule 193 can match eol */
 YY_RULE_SETUP
-#line 1926 "dhcp4_lexer.ll"
+#line 2066 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 179:
+case 194:
 YY_RULE_SETUP
-#line 1931 "dhcp4_lexer.ll"
+#line 2071 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 180:
+case 195:
 YY_RULE_SETUP
-#line 1936 "dhcp4_lexer.ll"
+#line 2076 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 181:
+case 196:
 YY_RULE_SETUP
-#line 1937 "dhcp4_lexer.ll"
+#line 2077 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 182:
+case 197:
 YY_RULE_SETUP
-#line 1938 "dhcp4_lexer.ll"
+#line 2078 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 183:
+case 198:
 YY_RULE_SETUP
-#line 1939 "dhcp4_lexer.ll"
+#line 2079 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 184:
+case 199:
 YY_RULE_SETUP
-#line 1940 "dhcp4_lexer.ll"
+#line 2080 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 185:
+case 200:
 YY_RULE_SETUP
-#line 1941 "dhcp4_lexer.ll"
+#line 2081 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 186:
+case 201:
 YY_RULE_SETUP
-#line 1943 "dhcp4_lexer.ll"
+#line 2083 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4721,9 +5130,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 187:
+case 202:
 YY_RULE_SETUP
-#line 1961 "dhcp4_lexer.ll"
+#line 2101 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4737,43 +5146,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 188:
+case 203:
 YY_RULE_SETUP
-#line 1974 "dhcp4_lexer.ll"
+#line 2114 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 189:
+case 204:
 YY_RULE_SETUP
-#line 1979 "dhcp4_lexer.ll"
+#line 2119 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 190:
+case 205:
 YY_RULE_SETUP
-#line 1983 "dhcp4_lexer.ll"
+#line 2123 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 191:
+case 206:
 YY_RULE_SETUP
-#line 1985 "dhcp4_lexer.ll"
+#line 2125 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 192:
+case 207:
 YY_RULE_SETUP
-#line 1987 "dhcp4_lexer.ll"
+#line 2127 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 193:
+case 208:
 YY_RULE_SETUP
-#line 1989 "dhcp4_lexer.ll"
+#line 2129 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1991 "dhcp4_lexer.ll"
+#line 2131 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4797,12 +5206,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 194:
+case 209:
 YY_RULE_SETUP
-#line 2014 "dhcp4_lexer.ll"
+#line 2154 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4805 "dhcp4_lexer.cc"
+#line 5214 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5121,7 +5530,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1724 )
+			if ( yy_current_state >= 1899 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5154,11 +5563,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1724 )
+		if ( yy_current_state >= 1899 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1723);
+	yy_is_jam = (yy_current_state == 1898);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5907,8 +6316,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 2014 "dhcp4_lexer.ll"
-
+#line 2154 "dhcp4_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -6010,4 +6418,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
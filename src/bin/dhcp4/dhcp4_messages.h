@@ -10,6 +10,8 @@ namespace dhcp {
 
 extern const isc::log::MessageID DHCP4_ACTIVATE_INTERFACE;
 extern const isc::log::MessageID DHCP4_ALREADY_RUNNING;
+extern const isc::log::MessageID DHCP4_ASYNC_LEASE_QUERIES_STARTED;
+extern const isc::log::MessageID DHCP4_ASYNC_LEASE_QUERIES_UNSUPPORTED;
 extern const isc::log::MessageID DHCP4_BUFFER_RECEIVED;
 extern const isc::log::MessageID DHCP4_BUFFER_RECEIVE_FAIL;
 extern const isc::log::MessageID DHCP4_BUFFER_UNPACK;
@@ -90,6 +92,7 @@ extern const isc::log::MessageID DHCP4_NO_SOCKETS_OPEN;
 extern const isc::log::MessageID DHCP4_OPEN_CONFIG_DB;
 extern const isc::log::MessageID DHCP4_OPEN_SOCKET;
 extern const isc::log::MessageID DHCP4_OPEN_SOCKET_FAIL;
+extern const isc::log::MessageID DHCP4_PACKET_ASYNC_PARK;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0001;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0002;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0003;
@@ -100,6 +103,7 @@ extern const isc::log::MessageID DHCP4_PACKET_DROP_0007;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0008;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0009;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0010;
+extern const isc::log::MessageID DHCP4_PACKET_DROP_0011;
 extern const isc::log::MessageID DHCP4_PACKET_NAK_0001;
 extern const isc::log::MessageID DHCP4_PACKET_NAK_0002;
 extern const isc::log::MessageID DHCP4_PACKET_NAK_0003;
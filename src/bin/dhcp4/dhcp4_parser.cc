@@ -248,30 +248,30 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -290,30 +290,30 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -332,30 +332,30 @@ namespace isc { namespace dhcp {
     state = that.state;
     switch (that.type_get ())
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -398,74 +398,74 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 184: // "constant string"
-#line 266 "dhcp4_parser.yy"
+      case 199: // "constant string"
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < std::string > (); }
 #line 405 "dhcp4_parser.cc"
         break;
 
-      case 185: // "integer"
-#line 266 "dhcp4_parser.yy"
+      case 200: // "integer"
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < int64_t > (); }
 #line 411 "dhcp4_parser.cc"
         break;
 
-      case 186: // "floating point"
-#line 266 "dhcp4_parser.yy"
+      case 201: // "floating point"
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < double > (); }
 #line 417 "dhcp4_parser.cc"
         break;
 
-      case 187: // "boolean"
-#line 266 "dhcp4_parser.yy"
+      case 202: // "boolean"
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < bool > (); }
 #line 423 "dhcp4_parser.cc"
         break;
 
-      case 204: // value
-#line 266 "dhcp4_parser.yy"
+      case 219: // value
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 429 "dhcp4_parser.cc"
         break;
 
-      case 208: // map_value
-#line 266 "dhcp4_parser.yy"
+      case 223: // map_value
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 435 "dhcp4_parser.cc"
         break;
 
-      case 249: // ddns_replace_client_name_value
-#line 266 "dhcp4_parser.yy"
+      case 266: // ddns_replace_client_name_value
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 441 "dhcp4_parser.cc"
         break;
 
-      case 268: // socket_type
-#line 266 "dhcp4_parser.yy"
+      case 285: // socket_type
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 447 "dhcp4_parser.cc"
         break;
 
-      case 271: // outbound_interface_value
-#line 266 "dhcp4_parser.yy"
+      case 288: // outbound_interface_value
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 453 "dhcp4_parser.cc"
         break;
 
-      case 293: // db_type
-#line 266 "dhcp4_parser.yy"
+      case 310: // db_type
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 459 "dhcp4_parser.cc"
         break;
 
-      case 380: // hr_mode
-#line 266 "dhcp4_parser.yy"
+      case 405: // hr_mode
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 465 "dhcp4_parser.cc"
         break;
 
-      case 535: // ncr_protocol_value
-#line 266 "dhcp4_parser.yy"
+      case 561: // ncr_protocol_value
+#line 282 "dhcp4_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 471 "dhcp4_parser.cc"
         break;
@@ -684,30 +684,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -732,133 +732,133 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 275 "dhcp4_parser.yy"
+#line 291 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 738 "dhcp4_parser.cc"
     break;
 
   case 4:
-#line 276 "dhcp4_parser.yy"
+#line 292 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.CONFIG; }
 #line 744 "dhcp4_parser.cc"
     break;
 
   case 6:
-#line 277 "dhcp4_parser.yy"
+#line 293 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.DHCP4; }
 #line 750 "dhcp4_parser.cc"
     break;
 
   case 8:
-#line 278 "dhcp4_parser.yy"
+#line 294 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 756 "dhcp4_parser.cc"
     break;
 
   case 10:
-#line 279 "dhcp4_parser.yy"
+#line 295 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.SUBNET4; }
 #line 762 "dhcp4_parser.cc"
     break;
 
   case 12:
-#line 280 "dhcp4_parser.yy"
+#line 296 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.POOLS; }
 #line 768 "dhcp4_parser.cc"
     break;
 
   case 14:
-#line 281 "dhcp4_parser.yy"
+#line 297 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 774 "dhcp4_parser.cc"
     break;
 
   case 16:
-#line 282 "dhcp4_parser.yy"
+#line 298 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.DHCP4; }
 #line 780 "dhcp4_parser.cc"
     break;
 
   case 18:
-#line 283 "dhcp4_parser.yy"
+#line 299 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 786 "dhcp4_parser.cc"
     break;
 
   case 20:
-#line 284 "dhcp4_parser.yy"
+#line 300 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 792 "dhcp4_parser.cc"
     break;
 
   case 22:
-#line 285 "dhcp4_parser.yy"
+#line 301 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 798 "dhcp4_parser.cc"
     break;
 
   case 24:
-#line 286 "dhcp4_parser.yy"
+#line 302 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 804 "dhcp4_parser.cc"
     break;
 
   case 26:
-#line 287 "dhcp4_parser.yy"
+#line 303 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.LOGGING; }
 #line 810 "dhcp4_parser.cc"
     break;
 
   case 28:
-#line 288 "dhcp4_parser.yy"
+#line 304 "dhcp4_parser.yy"
     { ctx.ctx_ = ctx.CONFIG_CONTROL; }
 #line 816 "dhcp4_parser.cc"
     break;
 
   case 30:
-#line 296 "dhcp4_parser.yy"
+#line 312 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 822 "dhcp4_parser.cc"
     break;
 
   case 31:
-#line 297 "dhcp4_parser.yy"
+#line 313 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 828 "dhcp4_parser.cc"
     break;
 
   case 32:
-#line 298 "dhcp4_parser.yy"
+#line 314 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 834 "dhcp4_parser.cc"
     break;
 
   case 33:
-#line 299 "dhcp4_parser.yy"
+#line 315 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 840 "dhcp4_parser.cc"
     break;
 
   case 34:
-#line 300 "dhcp4_parser.yy"
+#line 316 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 846 "dhcp4_parser.cc"
     break;
 
   case 35:
-#line 301 "dhcp4_parser.yy"
+#line 317 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 852 "dhcp4_parser.cc"
     break;
 
   case 36:
-#line 302 "dhcp4_parser.yy"
+#line 318 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 858 "dhcp4_parser.cc"
     break;
 
   case 37:
-#line 305 "dhcp4_parser.yy"
+#line 321 "dhcp4_parser.yy"
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -867,7 +867,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 310 "dhcp4_parser.yy"
+#line 326 "dhcp4_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -878,7 +878,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 39:
-#line 315 "dhcp4_parser.yy"
+#line 331 "dhcp4_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -888,13 +888,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 321 "dhcp4_parser.yy"
+#line 337 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 894 "dhcp4_parser.cc"
     break;
 
   case 43:
-#line 328 "dhcp4_parser.yy"
+#line 344 "dhcp4_parser.yy"
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -903,7 +903,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 332 "dhcp4_parser.yy"
+#line 348 "dhcp4_parser.yy"
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -913,7 +913,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 45:
-#line 339 "dhcp4_parser.yy"
+#line 355 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -922,7 +922,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 342 "dhcp4_parser.yy"
+#line 358 "dhcp4_parser.yy"
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -930,7 +930,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 350 "dhcp4_parser.yy"
+#line 366 "dhcp4_parser.yy"
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -939,7 +939,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 354 "dhcp4_parser.yy"
+#line 370 "dhcp4_parser.yy"
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -948,7 +948,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 361 "dhcp4_parser.yy"
+#line 377 "dhcp4_parser.yy"
     {
     // List parsing about to start
 }
@@ -956,7 +956,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 363 "dhcp4_parser.yy"
+#line 379 "dhcp4_parser.yy"
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -965,7 +965,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 372 "dhcp4_parser.yy"
+#line 388 "dhcp4_parser.yy"
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -974,7 +974,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 376 "dhcp4_parser.yy"
+#line 392 "dhcp4_parser.yy"
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -983,7 +983,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 387 "dhcp4_parser.yy"
+#line 403 "dhcp4_parser.yy"
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -994,7 +994,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 58:
-#line 397 "dhcp4_parser.yy"
+#line 413 "dhcp4_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1005,7 +1005,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 59:
-#line 402 "dhcp4_parser.yy"
+#line 418 "dhcp4_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -1018,7 +1018,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 68:
-#line 426 "dhcp4_parser.yy"
+#line 442 "dhcp4_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1031,7 +1031,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 69:
-#line 433 "dhcp4_parser.yy"
+#line 449 "dhcp4_parser.yy"
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -1041,7 +1041,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 70:
-#line 441 "dhcp4_parser.yy"
+#line 457 "dhcp4_parser.yy"
     {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1051,7 +1051,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 71:
-#line 445 "dhcp4_parser.yy"
+#line 461 "dhcp4_parser.yy"
     {
     // No global parameter is required
     // parsing completed
@@ -1059,8 +1059,8 @@ namespace isc { namespace dhcp {
 #line 1060 "dhcp4_parser.cc"
     break;
 
-  case 122:
-#line 506 "dhcp4_parser.yy"
+  case 125:
+#line 525 "dhcp4_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1068,8 +1068,8 @@ namespace isc { namespace dhcp {
 #line 1069 "dhcp4_parser.cc"
     break;
 
-  case 123:
-#line 511 "dhcp4_parser.yy"
+  case 126:
+#line 530 "dhcp4_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
@@ -1077,8 +1077,8 @@ namespace isc { namespace dhcp {
 #line 1078 "dhcp4_parser.cc"
     break;
 
-  case 124:
-#line 516 "dhcp4_parser.yy"
+  case 127:
+#line 535 "dhcp4_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
@@ -1086,8 +1086,8 @@ namespace isc { namespace dhcp {
 #line 1087 "dhcp4_parser.cc"
     break;
 
-  case 125:
-#line 521 "dhcp4_parser.yy"
+  case 128:
+#line 540 "dhcp4_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1095,8 +1095,8 @@ namespace isc { namespace dhcp {
 #line 1096 "dhcp4_parser.cc"
     break;
 
-  case 126:
-#line 526 "dhcp4_parser.yy"
+  case 129:
+#line 545 "dhcp4_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1104,8 +1104,8 @@ namespace isc { namespace dhcp {
 #line 1105 "dhcp4_parser.cc"
     break;
 
-  case 127:
-#line 531 "dhcp4_parser.yy"
+  case 130:
+#line 550 "dhcp4_parser.yy"
     {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
@@ -1113,8 +1113,8 @@ namespace isc { namespace dhcp {
 #line 1114 "dhcp4_parser.cc"
     break;
 
-  case 128:
-#line 536 "dhcp4_parser.yy"
+  case 131:
+#line 555 "dhcp4_parser.yy"
     {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
@@ -1122,8 +1122,8 @@ namespace isc { namespace dhcp {
 #line 1123 "dhcp4_parser.cc"
     break;
 
-  case 129:
-#line 541 "dhcp4_parser.yy"
+  case 132:
+#line 560 "dhcp4_parser.yy"
     {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
@@ -1131,400 +1131,418 @@ namespace isc { namespace dhcp {
 #line 1132 "dhcp4_parser.cc"
     break;
 
-  case 130:
-#line 546 "dhcp4_parser.yy"
+  case 133:
+#line 565 "dhcp4_parser.yy"
+    {
+    ElementPtr ct(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+}
+#line 1141 "dhcp4_parser.cc"
+    break;
+
+  case 134:
+#line 570 "dhcp4_parser.yy"
+    {
+    ElementPtr cm(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-max-age", cm);
+}
+#line 1150 "dhcp4_parser.cc"
+    break;
+
+  case 135:
+#line 575 "dhcp4_parser.yy"
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1141 "dhcp4_parser.cc"
+#line 1159 "dhcp4_parser.cc"
     break;
 
-  case 131:
-#line 551 "dhcp4_parser.yy"
+  case 136:
+#line 580 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1149 "dhcp4_parser.cc"
+#line 1167 "dhcp4_parser.cc"
     break;
 
-  case 132:
-#line 553 "dhcp4_parser.yy"
+  case 137:
+#line 582 "dhcp4_parser.yy"
     {
     ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1159 "dhcp4_parser.cc"
+#line 1177 "dhcp4_parser.cc"
     break;
 
-  case 133:
-#line 559 "dhcp4_parser.yy"
+  case 138:
+#line 588 "dhcp4_parser.yy"
     {
     ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
 }
-#line 1168 "dhcp4_parser.cc"
+#line 1186 "dhcp4_parser.cc"
     break;
 
-  case 134:
-#line 564 "dhcp4_parser.yy"
+  case 139:
+#line 593 "dhcp4_parser.yy"
     {
     ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
 }
-#line 1177 "dhcp4_parser.cc"
+#line 1195 "dhcp4_parser.cc"
     break;
 
-  case 135:
-#line 569 "dhcp4_parser.yy"
+  case 140:
+#line 598 "dhcp4_parser.yy"
     {
     ElementPtr prf(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("authoritative", prf);
 }
-#line 1186 "dhcp4_parser.cc"
+#line 1204 "dhcp4_parser.cc"
     break;
 
-  case 136:
-#line 574 "dhcp4_parser.yy"
+  case 141:
+#line 603 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-send-updates", b);
 }
-#line 1195 "dhcp4_parser.cc"
+#line 1213 "dhcp4_parser.cc"
     break;
 
-  case 137:
-#line 579 "dhcp4_parser.yy"
+  case 142:
+#line 608 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-no-update", b);
 }
-#line 1204 "dhcp4_parser.cc"
+#line 1222 "dhcp4_parser.cc"
     break;
 
-  case 138:
-#line 584 "dhcp4_parser.yy"
+  case 143:
+#line 613 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-client-update", b);
 }
-#line 1213 "dhcp4_parser.cc"
+#line 1231 "dhcp4_parser.cc"
     break;
 
-  case 139:
-#line 589 "dhcp4_parser.yy"
+  case 144:
+#line 618 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 1221 "dhcp4_parser.cc"
+#line 1239 "dhcp4_parser.cc"
     break;
 
-  case 140:
-#line 591 "dhcp4_parser.yy"
+  case 145:
+#line 620 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("ddns-replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1230 "dhcp4_parser.cc"
+#line 1248 "dhcp4_parser.cc"
     break;
 
-  case 141:
-#line 597 "dhcp4_parser.yy"
+  case 146:
+#line 626 "dhcp4_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1238 "dhcp4_parser.cc"
+#line 1256 "dhcp4_parser.cc"
     break;
 
-  case 142:
-#line 600 "dhcp4_parser.yy"
+  case 147:
+#line 629 "dhcp4_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1246 "dhcp4_parser.cc"
+#line 1264 "dhcp4_parser.cc"
     break;
 
-  case 143:
-#line 603 "dhcp4_parser.yy"
+  case 148:
+#line 632 "dhcp4_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1254 "dhcp4_parser.cc"
+#line 1272 "dhcp4_parser.cc"
     break;
 
-  case 144:
-#line 606 "dhcp4_parser.yy"
+  case 149:
+#line 635 "dhcp4_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1262 "dhcp4_parser.cc"
+#line 1280 "dhcp4_parser.cc"
     break;
 
-  case 145:
-#line 609 "dhcp4_parser.yy"
+  case 150:
+#line 638 "dhcp4_parser.yy"
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 1271 "dhcp4_parser.cc"
+#line 1289 "dhcp4_parser.cc"
     break;
 
-  case 146:
-#line 615 "dhcp4_parser.yy"
+  case 151:
+#line 644 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1279 "dhcp4_parser.cc"
+#line 1297 "dhcp4_parser.cc"
     break;
 
-  case 147:
-#line 617 "dhcp4_parser.yy"
+  case 152:
+#line 646 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-generated-prefix", s);
     ctx.leave();
 }
-#line 1289 "dhcp4_parser.cc"
+#line 1307 "dhcp4_parser.cc"
     break;
 
-  case 148:
-#line 623 "dhcp4_parser.yy"
+  case 153:
+#line 652 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1297 "dhcp4_parser.cc"
+#line 1315 "dhcp4_parser.cc"
     break;
 
-  case 149:
-#line 625 "dhcp4_parser.yy"
+  case 154:
+#line 654 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-qualifying-suffix", s);
     ctx.leave();
 }
-#line 1307 "dhcp4_parser.cc"
+#line 1325 "dhcp4_parser.cc"
     break;
 
-  case 150:
-#line 631 "dhcp4_parser.yy"
+  case 155:
+#line 660 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1315 "dhcp4_parser.cc"
+#line 1333 "dhcp4_parser.cc"
     break;
 
-  case 151:
-#line 633 "dhcp4_parser.yy"
+  case 156:
+#line 662 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 1325 "dhcp4_parser.cc"
+#line 1343 "dhcp4_parser.cc"
     break;
 
-  case 152:
-#line 639 "dhcp4_parser.yy"
+  case 157:
+#line 668 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1333 "dhcp4_parser.cc"
+#line 1351 "dhcp4_parser.cc"
     break;
 
-  case 153:
-#line 641 "dhcp4_parser.yy"
+  case 158:
+#line 670 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 1343 "dhcp4_parser.cc"
+#line 1361 "dhcp4_parser.cc"
     break;
 
-  case 154:
-#line 647 "dhcp4_parser.yy"
+  case 159:
+#line 676 "dhcp4_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1354 "dhcp4_parser.cc"
+#line 1372 "dhcp4_parser.cc"
     break;
 
-  case 155:
-#line 652 "dhcp4_parser.yy"
+  case 160:
+#line 681 "dhcp4_parser.yy"
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1364 "dhcp4_parser.cc"
+#line 1382 "dhcp4_parser.cc"
     break;
 
-  case 165:
-#line 671 "dhcp4_parser.yy"
+  case 170:
+#line 700 "dhcp4_parser.yy"
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1374 "dhcp4_parser.cc"
+#line 1392 "dhcp4_parser.cc"
     break;
 
-  case 166:
-#line 675 "dhcp4_parser.yy"
+  case 171:
+#line 704 "dhcp4_parser.yy"
     {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1383 "dhcp4_parser.cc"
+#line 1401 "dhcp4_parser.cc"
     break;
 
-  case 167:
-#line 680 "dhcp4_parser.yy"
+  case 172:
+#line 709 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1394 "dhcp4_parser.cc"
+#line 1412 "dhcp4_parser.cc"
     break;
 
-  case 168:
-#line 685 "dhcp4_parser.yy"
+  case 173:
+#line 714 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1403 "dhcp4_parser.cc"
+#line 1421 "dhcp4_parser.cc"
     break;
 
-  case 169:
-#line 690 "dhcp4_parser.yy"
+  case 174:
+#line 719 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1411 "dhcp4_parser.cc"
+#line 1429 "dhcp4_parser.cc"
     break;
 
-  case 170:
-#line 692 "dhcp4_parser.yy"
+  case 175:
+#line 721 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1420 "dhcp4_parser.cc"
+#line 1438 "dhcp4_parser.cc"
     break;
 
-  case 171:
-#line 697 "dhcp4_parser.yy"
+  case 176:
+#line 726 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1426 "dhcp4_parser.cc"
+#line 1444 "dhcp4_parser.cc"
     break;
 
-  case 172:
-#line 698 "dhcp4_parser.yy"
+  case 177:
+#line 727 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1432 "dhcp4_parser.cc"
+#line 1450 "dhcp4_parser.cc"
     break;
 
-  case 173:
-#line 701 "dhcp4_parser.yy"
+  case 178:
+#line 730 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
-#line 1440 "dhcp4_parser.cc"
+#line 1458 "dhcp4_parser.cc"
     break;
 
-  case 174:
-#line 703 "dhcp4_parser.yy"
+  case 179:
+#line 732 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1449 "dhcp4_parser.cc"
+#line 1467 "dhcp4_parser.cc"
     break;
 
-  case 175:
-#line 708 "dhcp4_parser.yy"
+  case 180:
+#line 737 "dhcp4_parser.yy"
     {
     yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
-#line 1457 "dhcp4_parser.cc"
+#line 1475 "dhcp4_parser.cc"
     break;
 
-  case 176:
-#line 710 "dhcp4_parser.yy"
+  case 181:
+#line 739 "dhcp4_parser.yy"
     {
     yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
-#line 1465 "dhcp4_parser.cc"
+#line 1483 "dhcp4_parser.cc"
     break;
 
-  case 177:
-#line 714 "dhcp4_parser.yy"
+  case 182:
+#line 743 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1474 "dhcp4_parser.cc"
+#line 1492 "dhcp4_parser.cc"
     break;
 
-  case 178:
-#line 720 "dhcp4_parser.yy"
+  case 183:
+#line 749 "dhcp4_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1485 "dhcp4_parser.cc"
+#line 1503 "dhcp4_parser.cc"
     break;
 
-  case 179:
-#line 725 "dhcp4_parser.yy"
+  case 184:
+#line 754 "dhcp4_parser.yy"
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1496 "dhcp4_parser.cc"
+#line 1514 "dhcp4_parser.cc"
     break;
 
-  case 180:
-#line 732 "dhcp4_parser.yy"
+  case 185:
+#line 761 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1507 "dhcp4_parser.cc"
+#line 1525 "dhcp4_parser.cc"
     break;
 
-  case 181:
-#line 737 "dhcp4_parser.yy"
+  case 186:
+#line 766 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1516 "dhcp4_parser.cc"
+#line 1534 "dhcp4_parser.cc"
     break;
 
-  case 185:
-#line 747 "dhcp4_parser.yy"
+  case 190:
+#line 776 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1524 "dhcp4_parser.cc"
+#line 1542 "dhcp4_parser.cc"
     break;
 
-  case 186:
-#line 749 "dhcp4_parser.yy"
+  case 191:
+#line 778 "dhcp4_parser.yy"
     {
 
     if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
@@ -1540,622 +1558,694 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1544 "dhcp4_parser.cc"
+#line 1562 "dhcp4_parser.cc"
     break;
 
-  case 187:
-#line 765 "dhcp4_parser.yy"
+  case 192:
+#line 794 "dhcp4_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1555 "dhcp4_parser.cc"
+#line 1573 "dhcp4_parser.cc"
     break;
 
-  case 188:
-#line 770 "dhcp4_parser.yy"
+  case 193:
+#line 799 "dhcp4_parser.yy"
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1566 "dhcp4_parser.cc"
+#line 1584 "dhcp4_parser.cc"
     break;
 
-  case 189:
-#line 777 "dhcp4_parser.yy"
+  case 194:
+#line 806 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1577 "dhcp4_parser.cc"
+#line 1595 "dhcp4_parser.cc"
     break;
 
-  case 190:
-#line 782 "dhcp4_parser.yy"
+  case 195:
+#line 811 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1586 "dhcp4_parser.cc"
+#line 1604 "dhcp4_parser.cc"
     break;
 
-  case 195:
-#line 795 "dhcp4_parser.yy"
+  case 200:
+#line 824 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1596 "dhcp4_parser.cc"
+#line 1614 "dhcp4_parser.cc"
     break;
 
-  case 196:
-#line 799 "dhcp4_parser.yy"
+  case 201:
+#line 828 "dhcp4_parser.yy"
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1606 "dhcp4_parser.cc"
+#line 1624 "dhcp4_parser.cc"
     break;
 
-  case 220:
-#line 832 "dhcp4_parser.yy"
+  case 230:
+#line 866 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1614 "dhcp4_parser.cc"
+#line 1632 "dhcp4_parser.cc"
     break;
 
-  case 221:
-#line 834 "dhcp4_parser.yy"
+  case 231:
+#line 868 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1623 "dhcp4_parser.cc"
+#line 1641 "dhcp4_parser.cc"
     break;
 
-  case 222:
-#line 839 "dhcp4_parser.yy"
+  case 232:
+#line 873 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1629 "dhcp4_parser.cc"
+#line 1647 "dhcp4_parser.cc"
     break;
 
-  case 223:
-#line 840 "dhcp4_parser.yy"
+  case 233:
+#line 874 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1635 "dhcp4_parser.cc"
+#line 1653 "dhcp4_parser.cc"
     break;
 
-  case 224:
-#line 841 "dhcp4_parser.yy"
+  case 234:
+#line 875 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1641 "dhcp4_parser.cc"
+#line 1659 "dhcp4_parser.cc"
     break;
 
-  case 225:
-#line 842 "dhcp4_parser.yy"
+  case 235:
+#line 876 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1647 "dhcp4_parser.cc"
+#line 1665 "dhcp4_parser.cc"
     break;
 
-  case 226:
-#line 845 "dhcp4_parser.yy"
+  case 236:
+#line 879 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1655 "dhcp4_parser.cc"
+#line 1673 "dhcp4_parser.cc"
     break;
 
-  case 227:
-#line 847 "dhcp4_parser.yy"
+  case 237:
+#line 881 "dhcp4_parser.yy"
     {
     ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1665 "dhcp4_parser.cc"
+#line 1683 "dhcp4_parser.cc"
     break;
 
-  case 228:
-#line 853 "dhcp4_parser.yy"
+  case 238:
+#line 887 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1673 "dhcp4_parser.cc"
+#line 1691 "dhcp4_parser.cc"
     break;
 
-  case 229:
-#line 855 "dhcp4_parser.yy"
+  case 239:
+#line 889 "dhcp4_parser.yy"
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1683 "dhcp4_parser.cc"
+#line 1701 "dhcp4_parser.cc"
     break;
 
-  case 230:
-#line 861 "dhcp4_parser.yy"
+  case 240:
+#line 895 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1691 "dhcp4_parser.cc"
+#line 1709 "dhcp4_parser.cc"
     break;
 
-  case 231:
-#line 863 "dhcp4_parser.yy"
+  case 241:
+#line 897 "dhcp4_parser.yy"
     {
     ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1701 "dhcp4_parser.cc"
+#line 1719 "dhcp4_parser.cc"
     break;
 
-  case 232:
-#line 869 "dhcp4_parser.yy"
+  case 242:
+#line 903 "dhcp4_parser.yy"
     {
     ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1710 "dhcp4_parser.cc"
+#line 1728 "dhcp4_parser.cc"
     break;
 
-  case 233:
-#line 874 "dhcp4_parser.yy"
+  case 243:
+#line 908 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1718 "dhcp4_parser.cc"
+#line 1736 "dhcp4_parser.cc"
     break;
 
-  case 234:
-#line 876 "dhcp4_parser.yy"
+  case 244:
+#line 910 "dhcp4_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1728 "dhcp4_parser.cc"
+#line 1746 "dhcp4_parser.cc"
     break;
 
-  case 235:
-#line 882 "dhcp4_parser.yy"
+  case 245:
+#line 916 "dhcp4_parser.yy"
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1737 "dhcp4_parser.cc"
+#line 1755 "dhcp4_parser.cc"
     break;
 
-  case 236:
-#line 887 "dhcp4_parser.yy"
+  case 246:
+#line 921 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1746 "dhcp4_parser.cc"
+#line 1764 "dhcp4_parser.cc"
     break;
 
-  case 237:
-#line 892 "dhcp4_parser.yy"
+  case 247:
+#line 926 "dhcp4_parser.yy"
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1755 "dhcp4_parser.cc"
+#line 1773 "dhcp4_parser.cc"
     break;
 
-  case 238:
-#line 897 "dhcp4_parser.yy"
+  case 248:
+#line 931 "dhcp4_parser.yy"
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("write-behind-cache", n);
+}
+#line 1782 "dhcp4_parser.cc"
+    break;
+
+  case 249:
+#line 936 "dhcp4_parser.yy"
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("write-back-latency", n);
+}
+#line 1791 "dhcp4_parser.cc"
+    break;
+
+  case 250:
+#line 941 "dhcp4_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1799 "dhcp4_parser.cc"
+    break;
+
+  case 251:
+#line 943 "dhcp4_parser.yy"
+    {
+    ElementPtr journal(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-journal", journal);
+    ctx.leave();
+}
+#line 1809 "dhcp4_parser.cc"
+    break;
+
+  case 252:
+#line 949 "dhcp4_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1817 "dhcp4_parser.cc"
+    break;
+
+  case 253:
+#line 951 "dhcp4_parser.yy"
+    {
+    ElementPtr replicas(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("read-replicas", replicas);
+    ctx.leave();
+}
+#line 1827 "dhcp4_parser.cc"
+    break;
+
+  case 254:
+#line 957 "dhcp4_parser.yy"
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("allocate-or-renew", n);
+}
+#line 1836 "dhcp4_parser.cc"
+    break;
+
+  case 255:
+#line 962 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1764 "dhcp4_parser.cc"
+#line 1845 "dhcp4_parser.cc"
     break;
 
-  case 239:
-#line 902 "dhcp4_parser.yy"
+  case 256:
+#line 967 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1773 "dhcp4_parser.cc"
+#line 1854 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 907 "dhcp4_parser.yy"
+  case 257:
+#line 972 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1782 "dhcp4_parser.cc"
+#line 1863 "dhcp4_parser.cc"
     break;
 
-  case 241:
-#line 912 "dhcp4_parser.yy"
+  case 258:
+#line 977 "dhcp4_parser.yy"
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1791 "dhcp4_parser.cc"
+#line 1872 "dhcp4_parser.cc"
     break;
 
-  case 242:
-#line 917 "dhcp4_parser.yy"
+  case 259:
+#line 982 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1799 "dhcp4_parser.cc"
+#line 1880 "dhcp4_parser.cc"
     break;
 
-  case 243:
-#line 919 "dhcp4_parser.yy"
+  case 260:
+#line 984 "dhcp4_parser.yy"
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1809 "dhcp4_parser.cc"
+#line 1890 "dhcp4_parser.cc"
     break;
 
-  case 244:
-#line 925 "dhcp4_parser.yy"
+  case 261:
+#line 990 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1817 "dhcp4_parser.cc"
+#line 1898 "dhcp4_parser.cc"
     break;
 
-  case 245:
-#line 927 "dhcp4_parser.yy"
+  case 262:
+#line 992 "dhcp4_parser.yy"
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1827 "dhcp4_parser.cc"
+#line 1908 "dhcp4_parser.cc"
     break;
 
-  case 246:
-#line 933 "dhcp4_parser.yy"
+  case 263:
+#line 998 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1835 "dhcp4_parser.cc"
+#line 1916 "dhcp4_parser.cc"
     break;
 
-  case 247:
-#line 935 "dhcp4_parser.yy"
+  case 264:
+#line 1000 "dhcp4_parser.yy"
     {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1845 "dhcp4_parser.cc"
+#line 1926 "dhcp4_parser.cc"
     break;
 
-  case 248:
-#line 941 "dhcp4_parser.yy"
+  case 265:
+#line 1006 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1853 "dhcp4_parser.cc"
+#line 1934 "dhcp4_parser.cc"
     break;
 
-  case 249:
-#line 943 "dhcp4_parser.yy"
+  case 266:
+#line 1008 "dhcp4_parser.yy"
     {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1863 "dhcp4_parser.cc"
+#line 1944 "dhcp4_parser.cc"
     break;
 
-  case 250:
-#line 949 "dhcp4_parser.yy"
+  case 267:
+#line 1014 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1872 "dhcp4_parser.cc"
+#line 1953 "dhcp4_parser.cc"
     break;
 
-  case 251:
-#line 954 "dhcp4_parser.yy"
+  case 268:
+#line 1019 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1881 "dhcp4_parser.cc"
+#line 1962 "dhcp4_parser.cc"
     break;
 
-  case 252:
-#line 959 "dhcp4_parser.yy"
+  case 269:
+#line 1024 "dhcp4_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-row-errors", n);
 }
-#line 1890 "dhcp4_parser.cc"
+#line 1971 "dhcp4_parser.cc"
     break;
 
-  case 253:
-#line 965 "dhcp4_parser.yy"
+  case 270:
+#line 1030 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1901 "dhcp4_parser.cc"
+#line 1982 "dhcp4_parser.cc"
     break;
 
-  case 254:
-#line 970 "dhcp4_parser.yy"
+  case 271:
+#line 1035 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1910 "dhcp4_parser.cc"
+#line 1991 "dhcp4_parser.cc"
     break;
 
-  case 262:
-#line 986 "dhcp4_parser.yy"
+  case 279:
+#line 1051 "dhcp4_parser.yy"
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1919 "dhcp4_parser.cc"
+#line 2000 "dhcp4_parser.cc"
     break;
 
-  case 263:
-#line 991 "dhcp4_parser.yy"
+  case 280:
+#line 1056 "dhcp4_parser.yy"
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1928 "dhcp4_parser.cc"
+#line 2009 "dhcp4_parser.cc"
     break;
 
-  case 264:
-#line 996 "dhcp4_parser.yy"
+  case 281:
+#line 1061 "dhcp4_parser.yy"
     {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1937 "dhcp4_parser.cc"
+#line 2018 "dhcp4_parser.cc"
     break;
 
-  case 265:
-#line 1001 "dhcp4_parser.yy"
+  case 282:
+#line 1066 "dhcp4_parser.yy"
     {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1946 "dhcp4_parser.cc"
+#line 2027 "dhcp4_parser.cc"
     break;
 
-  case 266:
-#line 1006 "dhcp4_parser.yy"
+  case 283:
+#line 1071 "dhcp4_parser.yy"
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1955 "dhcp4_parser.cc"
+#line 2036 "dhcp4_parser.cc"
     break;
 
-  case 267:
-#line 1011 "dhcp4_parser.yy"
+  case 284:
+#line 1076 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1966 "dhcp4_parser.cc"
+#line 2047 "dhcp4_parser.cc"
     break;
 
-  case 268:
-#line 1016 "dhcp4_parser.yy"
+  case 285:
+#line 1081 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1975 "dhcp4_parser.cc"
+#line 2056 "dhcp4_parser.cc"
     break;
 
-  case 273:
-#line 1029 "dhcp4_parser.yy"
+  case 290:
+#line 1094 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1985 "dhcp4_parser.cc"
+#line 2066 "dhcp4_parser.cc"
     break;
 
-  case 274:
-#line 1033 "dhcp4_parser.yy"
+  case 291:
+#line 1098 "dhcp4_parser.yy"
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1995 "dhcp4_parser.cc"
+#line 2076 "dhcp4_parser.cc"
     break;
 
-  case 275:
-#line 1039 "dhcp4_parser.yy"
+  case 292:
+#line 1104 "dhcp4_parser.yy"
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2005 "dhcp4_parser.cc"
+#line 2086 "dhcp4_parser.cc"
     break;
 
-  case 276:
-#line 1043 "dhcp4_parser.yy"
+  case 293:
+#line 1108 "dhcp4_parser.yy"
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2015 "dhcp4_parser.cc"
+#line 2096 "dhcp4_parser.cc"
     break;
 
-  case 282:
-#line 1058 "dhcp4_parser.yy"
+  case 299:
+#line 1123 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2023 "dhcp4_parser.cc"
+#line 2104 "dhcp4_parser.cc"
     break;
 
-  case 283:
-#line 1060 "dhcp4_parser.yy"
+  case 300:
+#line 1125 "dhcp4_parser.yy"
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 2033 "dhcp4_parser.cc"
+#line 2114 "dhcp4_parser.cc"
     break;
 
-  case 284:
-#line 1066 "dhcp4_parser.yy"
+  case 301:
+#line 1131 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2041 "dhcp4_parser.cc"
+#line 2122 "dhcp4_parser.cc"
     break;
 
-  case 285:
-#line 1068 "dhcp4_parser.yy"
+  case 302:
+#line 1133 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2050 "dhcp4_parser.cc"
+#line 2131 "dhcp4_parser.cc"
     break;
 
-  case 286:
-#line 1074 "dhcp4_parser.yy"
+  case 303:
+#line 1139 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 2061 "dhcp4_parser.cc"
+#line 2142 "dhcp4_parser.cc"
     break;
 
-  case 287:
-#line 1079 "dhcp4_parser.yy"
+  case 304:
+#line 1144 "dhcp4_parser.yy"
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2071 "dhcp4_parser.cc"
+#line 2152 "dhcp4_parser.cc"
     break;
 
-  case 296:
-#line 1097 "dhcp4_parser.yy"
+  case 314:
+#line 1163 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 2080 "dhcp4_parser.cc"
+#line 2161 "dhcp4_parser.cc"
     break;
 
-  case 297:
-#line 1102 "dhcp4_parser.yy"
+  case 315:
+#line 1168 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 2089 "dhcp4_parser.cc"
+#line 2170 "dhcp4_parser.cc"
     break;
 
-  case 298:
-#line 1107 "dhcp4_parser.yy"
+  case 316:
+#line 1173 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 2098 "dhcp4_parser.cc"
+#line 2179 "dhcp4_parser.cc"
     break;
 
-  case 299:
-#line 1112 "dhcp4_parser.yy"
+  case 317:
+#line 1178 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 2107 "dhcp4_parser.cc"
+#line 2188 "dhcp4_parser.cc"
     break;
 
-  case 300:
-#line 1117 "dhcp4_parser.yy"
+  case 318:
+#line 1183 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 2116 "dhcp4_parser.cc"
+#line 2197 "dhcp4_parser.cc"
     break;
 
-  case 301:
-#line 1122 "dhcp4_parser.yy"
+  case 319:
+#line 1188 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 2125 "dhcp4_parser.cc"
+#line 2206 "dhcp4_parser.cc"
     break;
 
-  case 302:
-#line 1130 "dhcp4_parser.yy"
+  case 320:
+#line 1193 "dhcp4_parser.yy"
+    {
+    ElementPtr value(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("background-reclamation", value);
+}
+#line 2215 "dhcp4_parser.cc"
+    break;
+
+  case 321:
+#line 1201 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 2136 "dhcp4_parser.cc"
+#line 2226 "dhcp4_parser.cc"
     break;
 
-  case 303:
-#line 1135 "dhcp4_parser.yy"
+  case 322:
+#line 1206 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2145 "dhcp4_parser.cc"
+#line 2235 "dhcp4_parser.cc"
     break;
 
-  case 308:
-#line 1155 "dhcp4_parser.yy"
+  case 327:
+#line 1226 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2155 "dhcp4_parser.cc"
+#line 2245 "dhcp4_parser.cc"
     break;
 
-  case 309:
-#line 1159 "dhcp4_parser.yy"
+  case 328:
+#line 1230 "dhcp4_parser.yy"
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -2177,294 +2267,294 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2181 "dhcp4_parser.cc"
+#line 2271 "dhcp4_parser.cc"
     break;
 
-  case 310:
-#line 1181 "dhcp4_parser.yy"
+  case 329:
+#line 1252 "dhcp4_parser.yy"
     {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2191 "dhcp4_parser.cc"
+#line 2281 "dhcp4_parser.cc"
     break;
 
-  case 311:
-#line 1185 "dhcp4_parser.yy"
+  case 330:
+#line 1256 "dhcp4_parser.yy"
     {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2201 "dhcp4_parser.cc"
+#line 2291 "dhcp4_parser.cc"
     break;
 
-  case 351:
-#line 1236 "dhcp4_parser.yy"
+  case 372:
+#line 1309 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2209 "dhcp4_parser.cc"
+#line 2299 "dhcp4_parser.cc"
     break;
 
-  case 352:
-#line 1238 "dhcp4_parser.yy"
+  case 373:
+#line 1311 "dhcp4_parser.yy"
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2219 "dhcp4_parser.cc"
+#line 2309 "dhcp4_parser.cc"
     break;
 
-  case 353:
-#line 1244 "dhcp4_parser.yy"
+  case 374:
+#line 1317 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2227 "dhcp4_parser.cc"
+#line 2317 "dhcp4_parser.cc"
     break;
 
-  case 354:
-#line 1246 "dhcp4_parser.yy"
+  case 375:
+#line 1319 "dhcp4_parser.yy"
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 2237 "dhcp4_parser.cc"
+#line 2327 "dhcp4_parser.cc"
     break;
 
-  case 355:
-#line 1252 "dhcp4_parser.yy"
+  case 376:
+#line 1325 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2245 "dhcp4_parser.cc"
+#line 2335 "dhcp4_parser.cc"
     break;
 
-  case 356:
-#line 1254 "dhcp4_parser.yy"
+  case 377:
+#line 1327 "dhcp4_parser.yy"
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 2255 "dhcp4_parser.cc"
+#line 2345 "dhcp4_parser.cc"
     break;
 
-  case 357:
-#line 1260 "dhcp4_parser.yy"
+  case 378:
+#line 1333 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2263 "dhcp4_parser.cc"
+#line 2353 "dhcp4_parser.cc"
     break;
 
-  case 358:
-#line 1262 "dhcp4_parser.yy"
+  case 379:
+#line 1335 "dhcp4_parser.yy"
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 2273 "dhcp4_parser.cc"
+#line 2363 "dhcp4_parser.cc"
     break;
 
-  case 359:
-#line 1268 "dhcp4_parser.yy"
+  case 380:
+#line 1341 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2281 "dhcp4_parser.cc"
+#line 2371 "dhcp4_parser.cc"
     break;
 
-  case 360:
-#line 1270 "dhcp4_parser.yy"
+  case 381:
+#line 1343 "dhcp4_parser.yy"
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2291 "dhcp4_parser.cc"
+#line 2381 "dhcp4_parser.cc"
     break;
 
-  case 361:
-#line 1276 "dhcp4_parser.yy"
+  case 382:
+#line 1349 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2299 "dhcp4_parser.cc"
+#line 2389 "dhcp4_parser.cc"
     break;
 
-  case 362:
-#line 1278 "dhcp4_parser.yy"
+  case 383:
+#line 1351 "dhcp4_parser.yy"
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2309 "dhcp4_parser.cc"
+#line 2399 "dhcp4_parser.cc"
     break;
 
-  case 363:
-#line 1284 "dhcp4_parser.yy"
+  case 384:
+#line 1357 "dhcp4_parser.yy"
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2320 "dhcp4_parser.cc"
+#line 2410 "dhcp4_parser.cc"
     break;
 
-  case 364:
-#line 1289 "dhcp4_parser.yy"
+  case 385:
+#line 1362 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2329 "dhcp4_parser.cc"
+#line 2419 "dhcp4_parser.cc"
     break;
 
-  case 365:
-#line 1294 "dhcp4_parser.yy"
+  case 386:
+#line 1367 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2337 "dhcp4_parser.cc"
+#line 2427 "dhcp4_parser.cc"
     break;
 
-  case 366:
-#line 1296 "dhcp4_parser.yy"
+  case 387:
+#line 1369 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2346 "dhcp4_parser.cc"
+#line 2436 "dhcp4_parser.cc"
     break;
 
-  case 367:
-#line 1301 "dhcp4_parser.yy"
+  case 388:
+#line 1374 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2352 "dhcp4_parser.cc"
+#line 2442 "dhcp4_parser.cc"
     break;
 
-  case 368:
-#line 1302 "dhcp4_parser.yy"
+  case 389:
+#line 1375 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2358 "dhcp4_parser.cc"
+#line 2448 "dhcp4_parser.cc"
     break;
 
-  case 369:
-#line 1303 "dhcp4_parser.yy"
+  case 390:
+#line 1376 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2364 "dhcp4_parser.cc"
+#line 2454 "dhcp4_parser.cc"
     break;
 
-  case 370:
-#line 1304 "dhcp4_parser.yy"
+  case 391:
+#line 1377 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2370 "dhcp4_parser.cc"
+#line 2460 "dhcp4_parser.cc"
     break;
 
-  case 371:
-#line 1307 "dhcp4_parser.yy"
+  case 392:
+#line 1380 "dhcp4_parser.yy"
     {
     ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2379 "dhcp4_parser.cc"
+#line 2469 "dhcp4_parser.cc"
     break;
 
-  case 372:
-#line 1314 "dhcp4_parser.yy"
+  case 393:
+#line 1387 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2390 "dhcp4_parser.cc"
+#line 2480 "dhcp4_parser.cc"
     break;
 
-  case 373:
-#line 1319 "dhcp4_parser.yy"
+  case 394:
+#line 1392 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2399 "dhcp4_parser.cc"
+#line 2489 "dhcp4_parser.cc"
     break;
 
-  case 378:
-#line 1334 "dhcp4_parser.yy"
+  case 399:
+#line 1407 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2409 "dhcp4_parser.cc"
+#line 2499 "dhcp4_parser.cc"
     break;
 
-  case 379:
-#line 1338 "dhcp4_parser.yy"
+  case 400:
+#line 1411 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 2417 "dhcp4_parser.cc"
+#line 2507 "dhcp4_parser.cc"
     break;
 
-  case 414:
-#line 1384 "dhcp4_parser.yy"
+  case 437:
+#line 1459 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2428 "dhcp4_parser.cc"
+#line 2518 "dhcp4_parser.cc"
     break;
 
-  case 415:
-#line 1389 "dhcp4_parser.yy"
+  case 438:
+#line 1464 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2437 "dhcp4_parser.cc"
+#line 2527 "dhcp4_parser.cc"
     break;
 
-  case 416:
-#line 1397 "dhcp4_parser.yy"
+  case 439:
+#line 1472 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2446 "dhcp4_parser.cc"
+#line 2536 "dhcp4_parser.cc"
     break;
 
-  case 417:
-#line 1400 "dhcp4_parser.yy"
+  case 440:
+#line 1475 "dhcp4_parser.yy"
     {
     // parsing completed
 }
-#line 2454 "dhcp4_parser.cc"
+#line 2544 "dhcp4_parser.cc"
     break;
 
-  case 422:
-#line 1416 "dhcp4_parser.yy"
+  case 445:
+#line 1491 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2464 "dhcp4_parser.cc"
+#line 2554 "dhcp4_parser.cc"
     break;
 
-  case 423:
-#line 1420 "dhcp4_parser.yy"
+  case 446:
+#line 1495 "dhcp4_parser.yy"
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2472,21 +2562,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2476 "dhcp4_parser.cc"
+#line 2566 "dhcp4_parser.cc"
     break;
 
-  case 424:
-#line 1431 "dhcp4_parser.yy"
+  case 447:
+#line 1506 "dhcp4_parser.yy"
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2486 "dhcp4_parser.cc"
+#line 2576 "dhcp4_parser.cc"
     break;
 
-  case 425:
-#line 1435 "dhcp4_parser.yy"
+  case 448:
+#line 1510 "dhcp4_parser.yy"
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2494,281 +2584,281 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2498 "dhcp4_parser.cc"
+#line 2588 "dhcp4_parser.cc"
     break;
 
-  case 441:
-#line 1467 "dhcp4_parser.yy"
+  case 464:
+#line 1542 "dhcp4_parser.yy"
     {
     ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2507 "dhcp4_parser.cc"
+#line 2597 "dhcp4_parser.cc"
     break;
 
-  case 443:
-#line 1474 "dhcp4_parser.yy"
+  case 466:
+#line 1549 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2515 "dhcp4_parser.cc"
+#line 2605 "dhcp4_parser.cc"
     break;
 
-  case 444:
-#line 1476 "dhcp4_parser.yy"
+  case 467:
+#line 1551 "dhcp4_parser.yy"
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2525 "dhcp4_parser.cc"
+#line 2615 "dhcp4_parser.cc"
     break;
 
-  case 445:
-#line 1482 "dhcp4_parser.yy"
+  case 468:
+#line 1557 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2533 "dhcp4_parser.cc"
+#line 2623 "dhcp4_parser.cc"
     break;
 
-  case 446:
-#line 1484 "dhcp4_parser.yy"
+  case 469:
+#line 1559 "dhcp4_parser.yy"
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2543 "dhcp4_parser.cc"
+#line 2633 "dhcp4_parser.cc"
     break;
 
-  case 447:
-#line 1490 "dhcp4_parser.yy"
+  case 470:
+#line 1565 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2551 "dhcp4_parser.cc"
+#line 2641 "dhcp4_parser.cc"
     break;
 
-  case 448:
-#line 1492 "dhcp4_parser.yy"
+  case 471:
+#line 1567 "dhcp4_parser.yy"
     {
     ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2561 "dhcp4_parser.cc"
+#line 2651 "dhcp4_parser.cc"
     break;
 
-  case 450:
-#line 1500 "dhcp4_parser.yy"
+  case 473:
+#line 1575 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2569 "dhcp4_parser.cc"
+#line 2659 "dhcp4_parser.cc"
     break;
 
-  case 451:
-#line 1502 "dhcp4_parser.yy"
+  case 474:
+#line 1577 "dhcp4_parser.yy"
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2579 "dhcp4_parser.cc"
+#line 2669 "dhcp4_parser.cc"
     break;
 
-  case 452:
-#line 1508 "dhcp4_parser.yy"
+  case 475:
+#line 1583 "dhcp4_parser.yy"
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2588 "dhcp4_parser.cc"
+#line 2678 "dhcp4_parser.cc"
     break;
 
-  case 453:
-#line 1517 "dhcp4_parser.yy"
+  case 476:
+#line 1592 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2599 "dhcp4_parser.cc"
+#line 2689 "dhcp4_parser.cc"
     break;
 
-  case 454:
-#line 1522 "dhcp4_parser.yy"
+  case 477:
+#line 1597 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2608 "dhcp4_parser.cc"
+#line 2698 "dhcp4_parser.cc"
     break;
 
-  case 459:
-#line 1541 "dhcp4_parser.yy"
+  case 482:
+#line 1616 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2618 "dhcp4_parser.cc"
+#line 2708 "dhcp4_parser.cc"
     break;
 
-  case 460:
-#line 1545 "dhcp4_parser.yy"
+  case 483:
+#line 1620 "dhcp4_parser.yy"
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2627 "dhcp4_parser.cc"
+#line 2717 "dhcp4_parser.cc"
     break;
 
-  case 461:
-#line 1553 "dhcp4_parser.yy"
+  case 484:
+#line 1628 "dhcp4_parser.yy"
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2637 "dhcp4_parser.cc"
+#line 2727 "dhcp4_parser.cc"
     break;
 
-  case 462:
-#line 1557 "dhcp4_parser.yy"
+  case 485:
+#line 1632 "dhcp4_parser.yy"
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2646 "dhcp4_parser.cc"
+#line 2736 "dhcp4_parser.cc"
     break;
 
-  case 477:
-#line 1590 "dhcp4_parser.yy"
+  case 500:
+#line 1665 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2654 "dhcp4_parser.cc"
+#line 2744 "dhcp4_parser.cc"
     break;
 
-  case 478:
-#line 1592 "dhcp4_parser.yy"
+  case 501:
+#line 1667 "dhcp4_parser.yy"
     {
     ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2664 "dhcp4_parser.cc"
+#line 2754 "dhcp4_parser.cc"
     break;
 
-  case 481:
-#line 1602 "dhcp4_parser.yy"
+  case 504:
+#line 1677 "dhcp4_parser.yy"
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2673 "dhcp4_parser.cc"
+#line 2763 "dhcp4_parser.cc"
     break;
 
-  case 482:
-#line 1607 "dhcp4_parser.yy"
+  case 505:
+#line 1682 "dhcp4_parser.yy"
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2682 "dhcp4_parser.cc"
+#line 2772 "dhcp4_parser.cc"
     break;
 
-  case 483:
-#line 1615 "dhcp4_parser.yy"
+  case 506:
+#line 1690 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2693 "dhcp4_parser.cc"
+#line 2783 "dhcp4_parser.cc"
     break;
 
-  case 484:
-#line 1620 "dhcp4_parser.yy"
+  case 507:
+#line 1695 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2702 "dhcp4_parser.cc"
+#line 2792 "dhcp4_parser.cc"
     break;
 
-  case 489:
-#line 1635 "dhcp4_parser.yy"
+  case 512:
+#line 1710 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2712 "dhcp4_parser.cc"
+#line 2802 "dhcp4_parser.cc"
     break;
 
-  case 490:
-#line 1639 "dhcp4_parser.yy"
+  case 513:
+#line 1714 "dhcp4_parser.yy"
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2722 "dhcp4_parser.cc"
+#line 2812 "dhcp4_parser.cc"
     break;
 
-  case 491:
-#line 1645 "dhcp4_parser.yy"
+  case 514:
+#line 1720 "dhcp4_parser.yy"
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2732 "dhcp4_parser.cc"
+#line 2822 "dhcp4_parser.cc"
     break;
 
-  case 492:
-#line 1649 "dhcp4_parser.yy"
+  case 515:
+#line 1724 "dhcp4_parser.yy"
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2742 "dhcp4_parser.cc"
+#line 2832 "dhcp4_parser.cc"
     break;
 
-  case 502:
-#line 1668 "dhcp4_parser.yy"
+  case 525:
+#line 1743 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2750 "dhcp4_parser.cc"
+#line 2840 "dhcp4_parser.cc"
     break;
 
-  case 503:
-#line 1670 "dhcp4_parser.yy"
+  case 526:
+#line 1745 "dhcp4_parser.yy"
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2760 "dhcp4_parser.cc"
+#line 2850 "dhcp4_parser.cc"
     break;
 
-  case 504:
-#line 1676 "dhcp4_parser.yy"
+  case 527:
+#line 1751 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2768 "dhcp4_parser.cc"
+#line 2858 "dhcp4_parser.cc"
     break;
 
-  case 505:
-#line 1678 "dhcp4_parser.yy"
+  case 528:
+#line 1753 "dhcp4_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -2791,19 +2881,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2795 "dhcp4_parser.cc"
+#line 2885 "dhcp4_parser.cc"
     break;
 
-  case 506:
-#line 1701 "dhcp4_parser.yy"
+  case 529:
+#line 1776 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2803 "dhcp4_parser.cc"
+#line 2893 "dhcp4_parser.cc"
     break;
 
-  case 507:
-#line 1703 "dhcp4_parser.yy"
+  case 530:
+#line 1778 "dhcp4_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2828,1108 +2918,1191 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2832 "dhcp4_parser.cc"
+#line 2922 "dhcp4_parser.cc"
     break;
 
-  case 508:
-#line 1731 "dhcp4_parser.yy"
+  case 531:
+#line 1806 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2843 "dhcp4_parser.cc"
+#line 2933 "dhcp4_parser.cc"
     break;
 
-  case 509:
-#line 1736 "dhcp4_parser.yy"
+  case 532:
+#line 1811 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2852 "dhcp4_parser.cc"
+#line 2942 "dhcp4_parser.cc"
     break;
 
-  case 514:
-#line 1749 "dhcp4_parser.yy"
+  case 537:
+#line 1824 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2862 "dhcp4_parser.cc"
+#line 2952 "dhcp4_parser.cc"
     break;
 
-  case 515:
-#line 1753 "dhcp4_parser.yy"
+  case 538:
+#line 1828 "dhcp4_parser.yy"
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2871 "dhcp4_parser.cc"
+#line 2961 "dhcp4_parser.cc"
     break;
 
-  case 516:
-#line 1758 "dhcp4_parser.yy"
+  case 539:
+#line 1833 "dhcp4_parser.yy"
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2881 "dhcp4_parser.cc"
+#line 2971 "dhcp4_parser.cc"
     break;
 
-  case 517:
-#line 1762 "dhcp4_parser.yy"
+  case 540:
+#line 1837 "dhcp4_parser.yy"
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2890 "dhcp4_parser.cc"
+#line 2980 "dhcp4_parser.cc"
     break;
 
-  case 537:
-#line 1793 "dhcp4_parser.yy"
+  case 560:
+#line 1868 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2898 "dhcp4_parser.cc"
+#line 2988 "dhcp4_parser.cc"
     break;
 
-  case 538:
-#line 1795 "dhcp4_parser.yy"
+  case 561:
+#line 1870 "dhcp4_parser.yy"
     {
     ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2908 "dhcp4_parser.cc"
+#line 2998 "dhcp4_parser.cc"
     break;
 
-  case 539:
-#line 1801 "dhcp4_parser.yy"
+  case 562:
+#line 1876 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2916 "dhcp4_parser.cc"
+#line 3006 "dhcp4_parser.cc"
     break;
 
-  case 540:
-#line 1803 "dhcp4_parser.yy"
+  case 563:
+#line 1878 "dhcp4_parser.yy"
     {
     ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2926 "dhcp4_parser.cc"
+#line 3016 "dhcp4_parser.cc"
     break;
 
-  case 541:
-#line 1809 "dhcp4_parser.yy"
+  case 564:
+#line 1884 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2934 "dhcp4_parser.cc"
+#line 3024 "dhcp4_parser.cc"
     break;
 
-  case 542:
-#line 1811 "dhcp4_parser.yy"
+  case 565:
+#line 1886 "dhcp4_parser.yy"
     {
     ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2944 "dhcp4_parser.cc"
+#line 3034 "dhcp4_parser.cc"
     break;
 
-  case 543:
-#line 1817 "dhcp4_parser.yy"
+  case 566:
+#line 1892 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2952 "dhcp4_parser.cc"
+#line 3042 "dhcp4_parser.cc"
     break;
 
-  case 544:
-#line 1819 "dhcp4_parser.yy"
+  case 567:
+#line 1894 "dhcp4_parser.yy"
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2962 "dhcp4_parser.cc"
+#line 3052 "dhcp4_parser.cc"
     break;
 
-  case 545:
-#line 1825 "dhcp4_parser.yy"
+  case 568:
+#line 1900 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2973 "dhcp4_parser.cc"
+#line 3063 "dhcp4_parser.cc"
     break;
 
-  case 546:
-#line 1830 "dhcp4_parser.yy"
+  case 569:
+#line 1905 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2982 "dhcp4_parser.cc"
+#line 3072 "dhcp4_parser.cc"
     break;
 
-  case 547:
-#line 1835 "dhcp4_parser.yy"
+  case 570:
+#line 1910 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2990 "dhcp4_parser.cc"
+#line 3080 "dhcp4_parser.cc"
     break;
 
-  case 548:
-#line 1837 "dhcp4_parser.yy"
+  case 571:
+#line 1912 "dhcp4_parser.yy"
     {
     ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 3000 "dhcp4_parser.cc"
+#line 3090 "dhcp4_parser.cc"
     break;
 
-  case 549:
-#line 1843 "dhcp4_parser.yy"
+  case 572:
+#line 1918 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3008 "dhcp4_parser.cc"
+#line 3098 "dhcp4_parser.cc"
     break;
 
-  case 550:
-#line 1845 "dhcp4_parser.yy"
+  case 573:
+#line 1920 "dhcp4_parser.yy"
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 3018 "dhcp4_parser.cc"
+#line 3108 "dhcp4_parser.cc"
     break;
 
-  case 551:
-#line 1851 "dhcp4_parser.yy"
+  case 574:
+#line 1926 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3026 "dhcp4_parser.cc"
+#line 3116 "dhcp4_parser.cc"
     break;
 
-  case 552:
-#line 1853 "dhcp4_parser.yy"
+  case 575:
+#line 1928 "dhcp4_parser.yy"
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 3036 "dhcp4_parser.cc"
+#line 3126 "dhcp4_parser.cc"
     break;
 
-  case 553:
-#line 1859 "dhcp4_parser.yy"
+  case 576:
+#line 1934 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3044 "dhcp4_parser.cc"
+#line 3134 "dhcp4_parser.cc"
     break;
 
-  case 554:
-#line 1861 "dhcp4_parser.yy"
+  case 577:
+#line 1936 "dhcp4_parser.yy"
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 3054 "dhcp4_parser.cc"
+#line 3144 "dhcp4_parser.cc"
     break;
 
-  case 555:
-#line 1867 "dhcp4_parser.yy"
+  case 578:
+#line 1942 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3062 "dhcp4_parser.cc"
+#line 3152 "dhcp4_parser.cc"
     break;
 
-  case 556:
-#line 1869 "dhcp4_parser.yy"
+  case 579:
+#line 1944 "dhcp4_parser.yy"
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 3072 "dhcp4_parser.cc"
+#line 3162 "dhcp4_parser.cc"
     break;
 
-  case 557:
-#line 1875 "dhcp4_parser.yy"
+  case 580:
+#line 1950 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3080 "dhcp4_parser.cc"
+#line 3170 "dhcp4_parser.cc"
     break;
 
-  case 558:
-#line 1877 "dhcp4_parser.yy"
+  case 581:
+#line 1952 "dhcp4_parser.yy"
     {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 3090 "dhcp4_parser.cc"
+#line 3180 "dhcp4_parser.cc"
     break;
 
-  case 559:
-#line 1883 "dhcp4_parser.yy"
+  case 582:
+#line 1958 "dhcp4_parser.yy"
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3101 "dhcp4_parser.cc"
+#line 3191 "dhcp4_parser.cc"
     break;
 
-  case 560:
-#line 1888 "dhcp4_parser.yy"
+  case 583:
+#line 1963 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3110 "dhcp4_parser.cc"
+#line 3200 "dhcp4_parser.cc"
     break;
 
-  case 561:
-#line 1896 "dhcp4_parser.yy"
+  case 584:
+#line 1971 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 3121 "dhcp4_parser.cc"
+#line 3211 "dhcp4_parser.cc"
     break;
 
-  case 562:
-#line 1901 "dhcp4_parser.yy"
+  case 585:
+#line 1976 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3130 "dhcp4_parser.cc"
+#line 3220 "dhcp4_parser.cc"
     break;
 
-  case 565:
-#line 1913 "dhcp4_parser.yy"
+  case 588:
+#line 1988 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 3141 "dhcp4_parser.cc"
+#line 3231 "dhcp4_parser.cc"
     break;
 
-  case 566:
-#line 1918 "dhcp4_parser.yy"
+  case 589:
+#line 1993 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3150 "dhcp4_parser.cc"
+#line 3240 "dhcp4_parser.cc"
     break;
 
-  case 569:
-#line 1927 "dhcp4_parser.yy"
+  case 592:
+#line 2002 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3160 "dhcp4_parser.cc"
+#line 3250 "dhcp4_parser.cc"
     break;
 
-  case 570:
-#line 1931 "dhcp4_parser.yy"
+  case 593:
+#line 2006 "dhcp4_parser.yy"
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3170 "dhcp4_parser.cc"
+#line 3260 "dhcp4_parser.cc"
     break;
 
-  case 587:
-#line 1960 "dhcp4_parser.yy"
+  case 610:
+#line 2035 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3178 "dhcp4_parser.cc"
+#line 3268 "dhcp4_parser.cc"
     break;
 
-  case 588:
-#line 1962 "dhcp4_parser.yy"
+  case 611:
+#line 2037 "dhcp4_parser.yy"
     {
     ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3188 "dhcp4_parser.cc"
+#line 3278 "dhcp4_parser.cc"
     break;
 
-  case 589:
-#line 1968 "dhcp4_parser.yy"
+  case 612:
+#line 2043 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3197 "dhcp4_parser.cc"
+#line 3287 "dhcp4_parser.cc"
     break;
 
-  case 590:
-#line 1977 "dhcp4_parser.yy"
+  case 613:
+#line 2052 "dhcp4_parser.yy"
     {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3206 "dhcp4_parser.cc"
+#line 3296 "dhcp4_parser.cc"
+    break;
+
+  case 614:
+#line 2057 "dhcp4_parser.yy"
+    {
+    ElementPtr threads(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lease-query-threads", threads);
+}
+#line 3305 "dhcp4_parser.cc"
     break;
 
-  case 591:
-#line 1984 "dhcp4_parser.yy"
+  case 615:
+#line 2064 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3217 "dhcp4_parser.cc"
+#line 3316 "dhcp4_parser.cc"
     break;
 
-  case 592:
-#line 1989 "dhcp4_parser.yy"
+  case 616:
+#line 2069 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3226 "dhcp4_parser.cc"
+#line 3325 "dhcp4_parser.cc"
     break;
 
-  case 600:
-#line 2005 "dhcp4_parser.yy"
+  case 624:
+#line 2085 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3234 "dhcp4_parser.cc"
+#line 3333 "dhcp4_parser.cc"
     break;
 
-  case 601:
-#line 2007 "dhcp4_parser.yy"
+  case 625:
+#line 2087 "dhcp4_parser.yy"
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3244 "dhcp4_parser.cc"
+#line 3343 "dhcp4_parser.cc"
     break;
 
-  case 602:
-#line 2013 "dhcp4_parser.yy"
+  case 626:
+#line 2093 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3252 "dhcp4_parser.cc"
+#line 3351 "dhcp4_parser.cc"
     break;
 
-  case 603:
-#line 2015 "dhcp4_parser.yy"
+  case 627:
+#line 2095 "dhcp4_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3262 "dhcp4_parser.cc"
+#line 3361 "dhcp4_parser.cc"
     break;
 
-  case 604:
-#line 2024 "dhcp4_parser.yy"
+  case 628:
+#line 2104 "dhcp4_parser.yy"
     {
     ElementPtr qc(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-queue-control", qc);
     ctx.stack_.push_back(qc);
     ctx.enter(ctx.DHCP_QUEUE_CONTROL);
 }
-#line 3273 "dhcp4_parser.cc"
+#line 3372 "dhcp4_parser.cc"
     break;
 
-  case 605:
-#line 2029 "dhcp4_parser.yy"
+  case 629:
+#line 2109 "dhcp4_parser.yy"
     {
     // The enable queue parameter is required.
     ctx.require("enable-queue", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3284 "dhcp4_parser.cc"
+#line 3383 "dhcp4_parser.cc"
     break;
 
-  case 614:
-#line 2048 "dhcp4_parser.yy"
+  case 638:
+#line 2128 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-queue", b);
 }
-#line 3293 "dhcp4_parser.cc"
+#line 3392 "dhcp4_parser.cc"
     break;
 
-  case 615:
-#line 2053 "dhcp4_parser.yy"
+  case 639:
+#line 2133 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3301 "dhcp4_parser.cc"
+#line 3400 "dhcp4_parser.cc"
     break;
 
-  case 616:
-#line 2055 "dhcp4_parser.yy"
+  case 640:
+#line 2135 "dhcp4_parser.yy"
     {
     ElementPtr qt(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("queue-type", qt);
     ctx.leave();
 }
-#line 3311 "dhcp4_parser.cc"
+#line 3410 "dhcp4_parser.cc"
     break;
 
-  case 617:
-#line 2061 "dhcp4_parser.yy"
+  case 641:
+#line 2141 "dhcp4_parser.yy"
     {
     ElementPtr c(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("capacity", c);
 }
-#line 3320 "dhcp4_parser.cc"
+#line 3419 "dhcp4_parser.cc"
     break;
 
-  case 618:
-#line 2066 "dhcp4_parser.yy"
+  case 642:
+#line 2146 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3328 "dhcp4_parser.cc"
+#line 3427 "dhcp4_parser.cc"
     break;
 
-  case 619:
-#line 2068 "dhcp4_parser.yy"
+  case 643:
+#line 2148 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set(yystack_[3].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3337 "dhcp4_parser.cc"
+#line 3436 "dhcp4_parser.cc"
     break;
 
-  case 620:
-#line 2075 "dhcp4_parser.yy"
+  case 644:
+#line 2155 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3348 "dhcp4_parser.cc"
+#line 3447 "dhcp4_parser.cc"
     break;
 
-  case 621:
-#line 2080 "dhcp4_parser.yy"
+  case 645:
+#line 2160 "dhcp4_parser.yy"
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3359 "dhcp4_parser.cc"
+#line 3458 "dhcp4_parser.cc"
     break;
 
-  case 622:
-#line 2087 "dhcp4_parser.yy"
+  case 646:
+#line 2167 "dhcp4_parser.yy"
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3369 "dhcp4_parser.cc"
+#line 3468 "dhcp4_parser.cc"
     break;
 
-  case 623:
-#line 2091 "dhcp4_parser.yy"
+  case 647:
+#line 2171 "dhcp4_parser.yy"
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3379 "dhcp4_parser.cc"
+#line 3478 "dhcp4_parser.cc"
     break;
 
-  case 644:
-#line 2121 "dhcp4_parser.yy"
+  case 668:
+#line 2201 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3388 "dhcp4_parser.cc"
+#line 3487 "dhcp4_parser.cc"
     break;
 
-  case 645:
-#line 2126 "dhcp4_parser.yy"
+  case 669:
+#line 2206 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3396 "dhcp4_parser.cc"
+#line 3495 "dhcp4_parser.cc"
     break;
 
-  case 646:
-#line 2128 "dhcp4_parser.yy"
+  case 670:
+#line 2208 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3406 "dhcp4_parser.cc"
+#line 3505 "dhcp4_parser.cc"
     break;
 
-  case 647:
-#line 2134 "dhcp4_parser.yy"
+  case 671:
+#line 2214 "dhcp4_parser.yy"
     {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3415 "dhcp4_parser.cc"
+#line 3514 "dhcp4_parser.cc"
     break;
 
-  case 648:
-#line 2139 "dhcp4_parser.yy"
+  case 672:
+#line 2219 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3423 "dhcp4_parser.cc"
+#line 3522 "dhcp4_parser.cc"
     break;
 
-  case 649:
-#line 2141 "dhcp4_parser.yy"
+  case 673:
+#line 2221 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3433 "dhcp4_parser.cc"
+#line 3532 "dhcp4_parser.cc"
     break;
 
-  case 650:
-#line 2147 "dhcp4_parser.yy"
+  case 674:
+#line 2227 "dhcp4_parser.yy"
     {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3442 "dhcp4_parser.cc"
+#line 3541 "dhcp4_parser.cc"
     break;
 
-  case 651:
-#line 2152 "dhcp4_parser.yy"
+  case 675:
+#line 2232 "dhcp4_parser.yy"
     {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3451 "dhcp4_parser.cc"
+#line 3550 "dhcp4_parser.cc"
     break;
 
-  case 652:
-#line 2157 "dhcp4_parser.yy"
+  case 676:
+#line 2237 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3459 "dhcp4_parser.cc"
+#line 3558 "dhcp4_parser.cc"
     break;
 
-  case 653:
-#line 2159 "dhcp4_parser.yy"
+  case 677:
+#line 2239 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3468 "dhcp4_parser.cc"
+#line 3567 "dhcp4_parser.cc"
     break;
 
-  case 654:
-#line 2165 "dhcp4_parser.yy"
+  case 678:
+#line 2245 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3474 "dhcp4_parser.cc"
+#line 3573 "dhcp4_parser.cc"
     break;
 
-  case 655:
-#line 2166 "dhcp4_parser.yy"
+  case 679:
+#line 2246 "dhcp4_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3480 "dhcp4_parser.cc"
+#line 3579 "dhcp4_parser.cc"
     break;
 
-  case 656:
-#line 2169 "dhcp4_parser.yy"
+  case 680:
+#line 2249 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3488 "dhcp4_parser.cc"
+#line 3587 "dhcp4_parser.cc"
     break;
 
-  case 657:
-#line 2171 "dhcp4_parser.yy"
+  case 681:
+#line 2251 "dhcp4_parser.yy"
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3498 "dhcp4_parser.cc"
+#line 3597 "dhcp4_parser.cc"
     break;
 
-  case 658:
-#line 2178 "dhcp4_parser.yy"
+  case 682:
+#line 2258 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3506 "dhcp4_parser.cc"
+#line 3605 "dhcp4_parser.cc"
     break;
 
-  case 659:
-#line 2180 "dhcp4_parser.yy"
+  case 683:
+#line 2260 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3516 "dhcp4_parser.cc"
+#line 3615 "dhcp4_parser.cc"
     break;
 
-  case 660:
-#line 2187 "dhcp4_parser.yy"
+  case 684:
+#line 2267 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3525 "dhcp4_parser.cc"
+#line 3624 "dhcp4_parser.cc"
     break;
 
-  case 661:
-#line 2193 "dhcp4_parser.yy"
+  case 685:
+#line 2273 "dhcp4_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3534 "dhcp4_parser.cc"
+#line 3633 "dhcp4_parser.cc"
     break;
 
-  case 662:
-#line 2199 "dhcp4_parser.yy"
+  case 686:
+#line 2279 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3542 "dhcp4_parser.cc"
+#line 3641 "dhcp4_parser.cc"
     break;
 
-  case 663:
-#line 2201 "dhcp4_parser.yy"
+  case 687:
+#line 2281 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3551 "dhcp4_parser.cc"
+#line 3650 "dhcp4_parser.cc"
     break;
 
-  case 664:
-#line 2207 "dhcp4_parser.yy"
+  case 688:
+#line 2287 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3559 "dhcp4_parser.cc"
+#line 3658 "dhcp4_parser.cc"
     break;
 
-  case 665:
-#line 2209 "dhcp4_parser.yy"
+  case 689:
+#line 2289 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3569 "dhcp4_parser.cc"
+#line 3668 "dhcp4_parser.cc"
     break;
 
-  case 666:
-#line 2216 "dhcp4_parser.yy"
+  case 690:
+#line 2296 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3577 "dhcp4_parser.cc"
+#line 3676 "dhcp4_parser.cc"
     break;
 
-  case 667:
-#line 2218 "dhcp4_parser.yy"
+  case 691:
+#line 2298 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3587 "dhcp4_parser.cc"
+#line 3686 "dhcp4_parser.cc"
     break;
 
-  case 668:
-#line 2225 "dhcp4_parser.yy"
+  case 692:
+#line 2305 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3595 "dhcp4_parser.cc"
+#line 3694 "dhcp4_parser.cc"
     break;
 
-  case 669:
-#line 2227 "dhcp4_parser.yy"
+  case 693:
+#line 2307 "dhcp4_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3605 "dhcp4_parser.cc"
+#line 3704 "dhcp4_parser.cc"
     break;
 
-  case 670:
-#line 2236 "dhcp4_parser.yy"
+  case 694:
+#line 2316 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3613 "dhcp4_parser.cc"
+#line 3712 "dhcp4_parser.cc"
     break;
 
-  case 671:
-#line 2238 "dhcp4_parser.yy"
+  case 695:
+#line 2318 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3622 "dhcp4_parser.cc"
+#line 3721 "dhcp4_parser.cc"
     break;
 
-  case 672:
-#line 2243 "dhcp4_parser.yy"
+  case 696:
+#line 2323 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3630 "dhcp4_parser.cc"
+#line 3729 "dhcp4_parser.cc"
     break;
 
-  case 673:
-#line 2245 "dhcp4_parser.yy"
+  case 697:
+#line 2325 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3639 "dhcp4_parser.cc"
+#line 3738 "dhcp4_parser.cc"
     break;
 
-  case 674:
-#line 2250 "dhcp4_parser.yy"
+  case 698:
+#line 2330 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3647 "dhcp4_parser.cc"
+#line 3746 "dhcp4_parser.cc"
     break;
 
-  case 675:
-#line 2252 "dhcp4_parser.yy"
+  case 699:
+#line 2332 "dhcp4_parser.yy"
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3656 "dhcp4_parser.cc"
+#line 3755 "dhcp4_parser.cc"
     break;
 
-  case 676:
-#line 2257 "dhcp4_parser.yy"
+  case 700:
+#line 2337 "dhcp4_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3667 "dhcp4_parser.cc"
+#line 3766 "dhcp4_parser.cc"
     break;
 
-  case 677:
-#line 2262 "dhcp4_parser.yy"
+  case 701:
+#line 2342 "dhcp4_parser.yy"
     {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3677 "dhcp4_parser.cc"
+#line 3776 "dhcp4_parser.cc"
     break;
 
-  case 678:
-#line 2268 "dhcp4_parser.yy"
+  case 702:
+#line 2348 "dhcp4_parser.yy"
     {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3687 "dhcp4_parser.cc"
+#line 3786 "dhcp4_parser.cc"
     break;
 
-  case 679:
-#line 2272 "dhcp4_parser.yy"
+  case 703:
+#line 2352 "dhcp4_parser.yy"
     {
     // No config_control params are required
     // parsing completed
 }
-#line 3696 "dhcp4_parser.cc"
+#line 3795 "dhcp4_parser.cc"
     break;
 
-  case 684:
-#line 2287 "dhcp4_parser.yy"
+  case 708:
+#line 2367 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3707 "dhcp4_parser.cc"
+#line 3806 "dhcp4_parser.cc"
     break;
 
-  case 685:
-#line 2292 "dhcp4_parser.yy"
+  case 709:
+#line 2372 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3716 "dhcp4_parser.cc"
+#line 3815 "dhcp4_parser.cc"
     break;
 
-  case 686:
-#line 2297 "dhcp4_parser.yy"
+  case 710:
+#line 2377 "dhcp4_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3725 "dhcp4_parser.cc"
+#line 3824 "dhcp4_parser.cc"
     break;
 
-  case 687:
-#line 2307 "dhcp4_parser.yy"
+  case 711:
+#line 2387 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3736 "dhcp4_parser.cc"
+#line 3835 "dhcp4_parser.cc"
     break;
 
-  case 688:
-#line 2312 "dhcp4_parser.yy"
+  case 712:
+#line 2392 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3745 "dhcp4_parser.cc"
+#line 3844 "dhcp4_parser.cc"
     break;
 
-  case 689:
-#line 2317 "dhcp4_parser.yy"
+  case 713:
+#line 2397 "dhcp4_parser.yy"
     {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3755 "dhcp4_parser.cc"
+#line 3854 "dhcp4_parser.cc"
     break;
 
-  case 690:
-#line 2321 "dhcp4_parser.yy"
+  case 714:
+#line 2401 "dhcp4_parser.yy"
     {
     // parsing completed
 }
-#line 3763 "dhcp4_parser.cc"
+#line 3862 "dhcp4_parser.cc"
     break;
 
-  case 694:
-#line 2337 "dhcp4_parser.yy"
+  case 718:
+#line 2417 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3774 "dhcp4_parser.cc"
+#line 3873 "dhcp4_parser.cc"
     break;
 
-  case 695:
-#line 2342 "dhcp4_parser.yy"
+  case 719:
+#line 2422 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3783 "dhcp4_parser.cc"
+#line 3882 "dhcp4_parser.cc"
     break;
 
-  case 698:
-#line 2354 "dhcp4_parser.yy"
+  case 722:
+#line 2434 "dhcp4_parser.yy"
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3793 "dhcp4_parser.cc"
+#line 3892 "dhcp4_parser.cc"
     break;
 
-  case 699:
-#line 2358 "dhcp4_parser.yy"
+  case 723:
+#line 2438 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 3801 "dhcp4_parser.cc"
+#line 3900 "dhcp4_parser.cc"
     break;
 
-  case 709:
-#line 2375 "dhcp4_parser.yy"
+  case 736:
+#line 2458 "dhcp4_parser.yy"
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3810 "dhcp4_parser.cc"
+#line 3909 "dhcp4_parser.cc"
     break;
 
-  case 710:
-#line 2380 "dhcp4_parser.yy"
+  case 737:
+#line 2463 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3818 "dhcp4_parser.cc"
+#line 3917 "dhcp4_parser.cc"
     break;
 
-  case 711:
-#line 2382 "dhcp4_parser.yy"
+  case 738:
+#line 2465 "dhcp4_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3828 "dhcp4_parser.cc"
+#line 3927 "dhcp4_parser.cc"
     break;
 
-  case 712:
-#line 2388 "dhcp4_parser.yy"
+  case 739:
+#line 2471 "dhcp4_parser.yy"
+    {
+    ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3938 "dhcp4_parser.cc"
+    break;
+
+  case 740:
+#line 2476 "dhcp4_parser.yy"
+    {
+    ctx.stack_.pop_back();
+    ctx.leave();
+}
+#line 3947 "dhcp4_parser.cc"
+    break;
+
+  case 741:
+#line 2481 "dhcp4_parser.yy"
+    {
+    ElementPtr limit(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", limit);
+}
+#line 3956 "dhcp4_parser.cc"
+    break;
+
+  case 742:
+#line 2486 "dhcp4_parser.yy"
+    {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+}
+#line 3965 "dhcp4_parser.cc"
+    break;
+
+  case 743:
+#line 2491 "dhcp4_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3839 "dhcp4_parser.cc"
+#line 3976 "dhcp4_parser.cc"
     break;
 
-  case 713:
-#line 2393 "dhcp4_parser.yy"
+  case 744:
+#line 2496 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3848 "dhcp4_parser.cc"
+#line 3985 "dhcp4_parser.cc"
     break;
 
-  case 716:
-#line 2402 "dhcp4_parser.yy"
+  case 747:
+#line 2505 "dhcp4_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3858 "dhcp4_parser.cc"
+#line 3995 "dhcp4_parser.cc"
     break;
 
-  case 717:
-#line 2406 "dhcp4_parser.yy"
+  case 748:
+#line 2509 "dhcp4_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 3866 "dhcp4_parser.cc"
+#line 4003 "dhcp4_parser.cc"
     break;
 
-  case 725:
-#line 2421 "dhcp4_parser.yy"
+  case 759:
+#line 2527 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3874 "dhcp4_parser.cc"
+#line 4011 "dhcp4_parser.cc"
     break;
 
-  case 726:
-#line 2423 "dhcp4_parser.yy"
+  case 760:
+#line 2529 "dhcp4_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3884 "dhcp4_parser.cc"
+#line 4021 "dhcp4_parser.cc"
     break;
 
-  case 727:
-#line 2429 "dhcp4_parser.yy"
+  case 761:
+#line 2535 "dhcp4_parser.yy"
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3893 "dhcp4_parser.cc"
+#line 4030 "dhcp4_parser.cc"
     break;
 
-  case 728:
-#line 2434 "dhcp4_parser.yy"
+  case 762:
+#line 2540 "dhcp4_parser.yy"
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3902 "dhcp4_parser.cc"
+#line 4039 "dhcp4_parser.cc"
     break;
 
-  case 729:
-#line 2439 "dhcp4_parser.yy"
+  case 763:
+#line 2545 "dhcp4_parser.yy"
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3911 "dhcp4_parser.cc"
+#line 4048 "dhcp4_parser.cc"
     break;
 
-  case 730:
-#line 2444 "dhcp4_parser.yy"
+  case 764:
+#line 2550 "dhcp4_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3919 "dhcp4_parser.cc"
+#line 4056 "dhcp4_parser.cc"
     break;
 
-  case 731:
-#line 2446 "dhcp4_parser.yy"
+  case 765:
+#line 2552 "dhcp4_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 3929 "dhcp4_parser.cc"
+#line 4066 "dhcp4_parser.cc"
+    break;
+
+  case 766:
+#line 2558 "dhcp4_parser.yy"
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 4075 "dhcp4_parser.cc"
+    break;
+
+  case 767:
+#line 2563 "dhcp4_parser.yy"
+    {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 4084 "dhcp4_parser.cc"
+    break;
+
+  case 768:
+#line 2568 "dhcp4_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 4092 "dhcp4_parser.cc"
+    break;
+
+  case 769:
+#line 2570 "dhcp4_parser.yy"
+    {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+}
+#line 4102 "dhcp4_parser.cc"
     break;
 
 
-#line 3933 "dhcp4_parser.cc"
+#line 4106 "dhcp4_parser.cc"
 
             default:
               break;
@@ -4200,131 +4373,137 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp4Parser::yypact_ninf_ = -900;
+  const short Dhcp4Parser::yypact_ninf_ = -933;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp4Parser::yypact_[] =
   {
-     385,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,    56,    28,    27,    29,    62,
-      67,    79,    81,    83,   126,   133,   139,   194,   199,   236,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,    28,  -142,
-      20,   167,    25,   580,    -8,   237,   -27,    66,   198,   -54,
-     217,   -99,   100,  -900,    57,    77,   110,   166,   147,  -900,
-    -900,  -900,  -900,  -900,   245,  -900,    40,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,   256,   266,   269,  -900,
-    -900,  -900,  -900,  -900,  -900,   281,   299,   306,   316,   320,
-     332,   333,   340,   362,  -900,   363,   364,   367,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   374,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,    43,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   375,  -900,    68,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,   376,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,    93,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,   131,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,   254,   290,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,   264,  -900,
-    -900,   379,  -900,  -900,  -900,   380,  -900,  -900,   309,   324,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   381,   382,  -900,  -900,  -900,  -900,   326,
-     386,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   141,  -900,  -900,  -900,   384,  -900,  -900,
-     387,  -900,   388,   389,  -900,  -900,   390,   391,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,   158,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,   159,  -900,  -900,  -900,   392,   172,  -900,  -900,
-    -900,  -900,    28,    28,  -900,   206,   393,   394,   399,   400,
-     401,  -900,    20,  -900,   402,   404,   405,   223,   224,   227,
-     412,   413,   414,   415,   416,   420,   242,   246,   248,   250,
-     253,   252,   244,   257,   255,   438,   259,   260,   263,   440,
-     447,   449,   451,   452,   453,   454,   456,   460,   462,   463,
-     466,   467,   468,   470,   292,   475,   476,   478,   480,   482,
-     484,   167,  -900,   486,   487,   488,   307,    25,  -900,   492,
-     493,   497,   509,   510,   511,   317,   512,   516,   519,   580,
-    -900,   520,    -8,  -900,   521,   523,   524,   525,   526,   527,
-     529,   530,  -900,   237,  -900,   531,   532,   395,   565,   566,
-     567,   396,  -900,    66,   569,   397,   398,  -900,   198,   570,
-     571,   -13,  -900,   403,   574,   575,   406,   577,   407,   408,
-     582,   583,   409,   410,   584,   585,   590,   594,   217,  -900,
-     -99,  -900,   595,   417,   100,  -900,  -900,  -900,   597,   596,
-     598,    28,    28,    28,  -900,   604,   605,   606,  -900,  -900,
-    -900,   430,   431,   433,   612,   613,   599,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,   437,  -900,  -900,  -900,
-     -16,   439,   441,   619,   621,   622,   623,   626,   450,   243,
-     630,   631,   640,   641,   646,  -900,   650,   652,   653,   477,
-     479,   657,  -900,   659,   142,   152,  -900,  -900,   481,   500,
-     501,   665,   504,   505,  -900,   659,   506,   684,  -900,   508,
-    -900,   659,   513,   514,   515,   517,   518,   522,   533,  -900,
-     541,   542,  -900,   543,   544,   547,  -900,  -900,   548,  -900,
-    -900,  -900,   549,    28,  -900,  -900,   550,   553,  -900,   554,
-    -900,  -900,    14,   545,  -900,  -900,   -16,   555,   556,   557,
-    -900,  -900,   688,  -900,  -900,    28,   167,   -99,  -900,  -900,
-    -900,   100,    25,   672,  -900,  -900,  -900,   498,   498,   693,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,   696,
-     697,   698,   700,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,   143,   709,   737,   739,    95,    73,   -14,   217,  -900,
-    -900,   741,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   742,  -900,  -900,  -900,  -900,   107,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,   693,  -900,   183,
-     238,   239,   268,  -900,   280,  -900,  -900,  -900,  -900,  -900,
-    -900,   746,   747,   748,   749,   751,  -900,  -900,  -900,  -900,
-     752,   754,   755,   756,   757,   758,  -900,   283,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,   289,
-    -900,   760,   764,  -900,  -900,   762,   766,  -900,  -900,   765,
-     767,  -900,  -900,   768,   769,  -900,  -900,   770,   772,  -900,
-    -900,  -900,  -900,  -900,  -900,    96,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   121,  -900,  -900,   771,   775,  -900,  -900,
-     773,   777,  -900,   759,   778,   779,   780,   781,   782,   293,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,   296,  -900,  -900,  -900,   783,  -900,   784,  -900,
-    -900,  -900,   297,  -900,  -900,  -900,  -900,  -900,   303,  -900,
-     202,  -900,   589,  -900,   785,   786,  -900,  -900,  -900,  -900,
-     787,   788,  -900,  -900,  -900,  -900,   789,   672,  -900,   792,
-     793,   794,   795,   607,   603,   615,   614,   617,   799,   800,
-     801,   804,   624,   625,   627,   628,   629,   632,   498,  -900,
-    -900,   498,  -900,   693,   580,  -900,   696,    66,  -900,   697,
-     198,  -900,   698,   651,  -900,   700,   143,  -900,    64,   709,
-    -900,   237,  -900,   737,   -54,  -900,   739,   633,   634,   635,
-     636,   637,   638,    95,  -900,   807,   810,    73,  -900,   639,
-     811,   642,   820,   -14,  -900,  -900,   -30,   741,  -900,  -900,
-     819,   825,    -8,  -900,   742,   826,  -900,  -900,   645,  -900,
-     339,   647,   648,   649,  -900,  -900,  -900,  -900,  -900,   654,
-     655,   656,   658,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-     304,  -900,   310,  -900,   828,  -900,   829,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   311,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,   830,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,   833,   840,  -900,  -900,  -900,
-    -900,  -900,   837,  -900,   313,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   662,   664,  -900,  -900,   667,  -900,    28,
-    -900,  -900,   845,  -900,  -900,  -900,  -900,  -900,   323,  -900,
-    -900,  -900,  -900,  -900,  -900,   671,   327,  -900,   659,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,   651,  -900,   855,   675,
-    -900,    64,  -900,  -900,  -900,  -900,  -900,  -900,   864,   687,
-     865,   -30,  -900,  -900,  -900,  -900,  -900,   689,  -900,  -900,
-     776,  -900,   691,  -900,  -900,   875,  -900,  -900,   258,  -900,
-      19,   875,  -900,  -900,   879,   881,   883,  -900,   330,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,   884,   704,   708,   710,
-     894,    19,  -900,   717,  -900,  -900,  -900,   718,  -900,  -900,
-    -900
+     374,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,    49,    61,    46,    71,    78,
+      93,   118,   127,   129,   140,   150,   166,   191,   198,   199,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,    61,  -167,
+      34,   112,    68,   609,   144,   173,   128,    60,    31,   -29,
+     393,    64,    23,  -933,   213,   221,   230,   229,   235,  -933,
+    -933,  -933,  -933,  -933,   249,  -933,    44,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,   270,   280,   283,  -933,
+    -933,  -933,  -933,  -933,  -933,   292,   293,   314,   322,   340,
+     341,   342,   369,   370,   373,   382,  -933,   386,   387,   389,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,   391,   392,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,    47,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,   399,
+    -933,    57,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,   400,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+      85,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,    98,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,   258,   306,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,   329,  -933,  -933,   401,
+    -933,  -933,  -933,   402,  -933,  -933,   363,   394,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,   404,   405,  -933,  -933,  -933,  -933,   403,   409,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,   125,  -933,  -933,  -933,   412,  -933,  -933,   413,  -933,
+     414,   415,  -933,  -933,   416,   417,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,   161,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+     196,  -933,  -933,  -933,   418,   205,  -933,  -933,  -933,  -933,
+      61,    61,  -933,   226,   423,   424,   426,   427,   428,  -933,
+      34,  -933,   429,   431,   437,   240,   242,   245,   445,   448,
+     449,   450,   452,   453,   266,   269,   273,   284,   285,   268,
+     282,   287,   288,   294,   303,   489,   311,   312,   313,   491,
+     492,   500,   504,   507,   514,   515,   520,   521,   522,   523,
+     524,   525,   526,   527,   332,   334,   529,   531,   533,   547,
+     548,   549,   112,  -933,   550,   551,   552,   371,    68,  -933,
+     570,   572,   573,   574,   575,   576,   381,   578,   579,   580,
+     609,  -933,   581,   144,  -933,   583,   584,   585,   587,   589,
+     590,   591,   594,  -933,   173,  -933,   595,   596,   406,   597,
+     598,   599,   408,  -933,    60,   600,   411,   419,  -933,    31,
+     601,   603,   -87,  -933,   420,   604,   607,   425,   610,   433,
+     440,   611,   612,   421,   422,   613,   614,   615,   616,   393,
+    -933,    64,  -933,   622,   441,    23,  -933,  -933,  -933,   623,
+     621,   624,    61,    61,    61,  -933,   635,   636,   637,  -933,
+    -933,  -933,   430,   446,   451,   642,   644,   647,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,   454,
+    -933,  -933,  -933,   -88,   455,   456,   651,   652,   653,   654,
+     655,   461,   277,   656,   658,   659,   660,   674,  -933,  -933,
+     675,   682,   686,   467,   468,   695,  -933,   696,    59,   135,
+    -933,  -933,   503,   505,   516,   698,   517,   518,  -933,   696,
+     519,   699,  -933,   528,  -933,   696,   530,   542,   543,   553,
+     554,   557,   558,  -933,   559,   560,  -933,   561,   562,   563,
+    -933,  -933,   564,  -933,  -933,  -933,   565,    61,  -933,  -933,
+     566,   567,  -933,   577,  -933,  -933,    10,   555,  -933,  -933,
+     -88,   582,   586,   588,  -933,  -933,   708,  -933,  -933,    61,
+     112,    64,  -933,  -933,  -933,    23,    68,   697,  -933,  -933,
+    -933,   308,   308,   713,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,   717,   718,   719,   721,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,    45,   743,   744,   762,   201,
+      33,    52,   393,  -933,  -933,   764,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,   768,  -933,  -933,
+    -933,  -933,   -60,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,   713,  -933,   206,   220,   232,   247,  -933,   261,  -933,
+    -933,  -933,  -933,  -933,  -933,   773,   774,   776,   779,   780,
+     782,  -933,  -933,   784,   785,  -933,  -933,  -933,  -933,   787,
+     788,   789,   790,   791,   792,  -933,   262,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,   265,  -933,   793,   794,  -933,  -933,   795,
+     797,  -933,  -933,   796,   800,  -933,  -933,   798,   802,  -933,
+    -933,   801,   803,  -933,  -933,  -933,  -933,  -933,  -933,    83,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,   101,  -933,  -933,
+     804,   806,  -933,  -933,   805,   809,  -933,   810,   811,   812,
+     813,   814,   815,   816,   272,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,   275,  -933,
+    -933,  -933,   817,  -933,   818,  -933,  -933,  -933,   278,  -933,
+    -933,  -933,  -933,  -933,   295,  -933,   105,  -933,   625,  -933,
+     807,   820,  -933,  -933,  -933,  -933,   819,   822,  -933,  -933,
+    -933,  -933,   821,   697,  -933,   825,   826,   827,   828,   626,
+     633,   638,   634,   639,   640,   833,   835,   641,   645,   838,
+     840,   842,   843,   648,   649,   650,   657,   661,   662,   308,
+    -933,  -933,   308,  -933,   713,   609,  -933,   717,    60,  -933,
+     718,    31,  -933,   719,   669,  -933,   721,    45,  -933,   216,
+     743,  -933,   173,  -933,   744,   -29,  -933,   762,   664,   665,
+     666,   667,   670,   671,   672,   201,  -933,   847,   848,    33,
+    -933,   677,   849,   673,   850,    52,  -933,  -933,   208,   764,
+    -933,  -933,   852,   853,   144,  -933,   768,   851,  -933,  -933,
+     678,  -933,   364,   681,   683,   684,  -933,  -933,  -933,  -933,
+    -933,  -933,   687,   691,  -933,  -933,   694,   700,   702,   707,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,   296,  -933,   302,
+    -933,   861,  -933,   864,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,   305,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,   855,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,   868,   857,  -933,  -933,  -933,  -933,
+    -933,   890,  -933,   309,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,   715,   722,  -933,  -933,   750,  -933,    61,
+    -933,  -933,   916,  -933,  -933,   950,   955,  -933,  -933,  -933,
+    -933,   333,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,   799,   367,  -933,   696,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,   669,  -933,   985,   808,  -933,   216,
+    -933,  -933,  -933,  -933,  -933,  -933,   989,   823,   991,   995,
+     824,   829,   208,  -933,  -933,  -933,  -933,  -933,   831,  -933,
+    -933,   856,  -933,   832,   696,  -933,  -933,  -933,  -933,   993,
+    -933,  -933,  -933,   121,  -933,   147,   993,  -933,  -933,   997,
+     998,   999,  -933,  1000,  1001,  -933,   377,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  1002,   834,   837,
+     839,  1003,   836,   841,  1004,   147,  -933,   844,  -933,  -933,
+    -933,   845,  -933,  -933,   846,  -933,  -933,  -933,  -933
   };
 
   const unsigned short
@@ -4334,166 +4513,174 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,    28,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    45,    38,    34,    33,    30,    31,    32,    37,     3,
-      35,    36,    58,     5,    70,     7,   165,     9,   310,    11,
-     491,    13,   516,    15,   416,    17,   424,    19,   461,    21,
-     275,    23,   622,    25,   689,    27,   678,    29,    47,    41,
-       0,     0,     0,     0,     0,   518,     0,   426,   463,     0,
+      35,    36,    58,     5,    70,     7,   170,     9,   329,    11,
+     514,    13,   539,    15,   439,    17,   447,    19,   484,    21,
+     292,    23,   646,    25,   713,    27,   702,    29,    47,    41,
+       0,     0,     0,     0,     0,   541,     0,   449,   486,     0,
        0,     0,     0,    49,     0,    48,     0,     0,    42,    68,
-     687,   670,   672,   674,     0,    67,     0,    60,    62,    64,
-      65,    66,    63,   676,   154,   180,     0,     0,     0,   537,
-     539,   541,   178,   187,   189,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   131,     0,     0,     0,   139,   146,
-     148,   302,   414,   453,   372,   504,   506,   365,   253,   565,
-     508,   267,   286,     0,   591,   604,   620,   150,   152,   694,
-     121,     0,    72,    74,    75,    76,    77,    78,   109,   110,
-     111,    79,   107,    96,    97,    98,   115,   116,   117,   118,
-     119,   120,   113,   114,    82,    83,   104,    84,    85,    86,
-      90,    91,    80,   108,    81,    88,    89,   102,   103,   105,
-      99,   100,   101,    87,    92,    93,    94,    95,   106,   112,
-     167,   169,   173,     0,   164,     0,   156,   158,   159,   160,
-     161,   162,   163,   353,   355,   357,   483,   351,   359,     0,
-     363,   361,   561,   350,   314,   315,   316,   317,   318,   339,
-     340,   341,   329,   330,   342,   343,   344,   345,   346,   347,
-     348,   349,     0,   312,   321,   334,   335,   336,   322,   324,
-     325,   327,   323,   319,   320,   337,   338,   326,   331,   332,
-     333,   328,   502,   501,   497,   498,   496,     0,   493,   495,
-     499,   500,   559,   547,   549,   553,   551,   557,   555,   543,
-     536,   530,   534,   535,     0,   519,   520,   531,   532,   533,
-     527,   522,   528,   524,   525,   526,   529,   523,     0,   443,
-     233,     0,   447,   445,   450,     0,   439,   440,     0,   427,
-     428,   430,   442,   431,   432,   433,   449,   434,   435,   436,
-     437,   438,   477,     0,     0,   475,   476,   479,   480,     0,
-     464,   465,   467,   468,   469,   470,   471,   472,   473,   474,
-     282,   284,   279,     0,   277,   280,   281,     0,   658,   645,
-       0,   648,     0,     0,   652,   656,     0,     0,   662,   664,
-     666,   668,   643,   641,   642,     0,   624,   626,   627,   628,
-     629,   630,   631,   632,   633,   638,   634,   635,   636,   637,
-     639,   640,     0,   691,   693,   684,     0,     0,   680,   682,
-     683,    46,     0,     0,    39,     0,     0,     0,     0,     0,
-       0,    57,     0,    59,     0,     0,     0,     0,     0,     0,
+     711,   694,   696,   698,     0,    67,     0,    60,    62,    64,
+      65,    66,    63,   700,   159,   185,     0,     0,     0,   560,
+     562,   564,   183,   192,   194,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   136,     0,     0,     0,
+     144,   151,   153,   321,   437,   476,   393,   527,   529,   386,
+     270,   588,   531,   284,   303,     0,     0,   615,   628,   644,
+     155,   157,   718,   124,     0,    72,    74,    75,    76,    77,
+      78,   109,   110,   111,   112,   113,    79,   107,    96,    97,
+      98,   117,   118,   119,   120,   121,   122,   115,   116,    82,
+      83,   104,    84,    85,    86,    90,    91,    80,   108,    81,
+      88,    89,   102,   103,   105,    99,   100,   101,    87,    92,
+     123,    93,    94,    95,   106,   114,   172,   174,   178,     0,
+     169,     0,   161,   163,   164,   165,   166,   167,   168,   374,
+     376,   378,   506,   372,   380,     0,   384,   382,   584,   371,
+     333,   334,   335,   336,   337,   358,   359,   360,   361,   362,
+     348,   349,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,   331,   340,   353,   354,   355,   341,   343,   344,   346,
+     342,   338,   339,   356,   357,   345,   350,   351,   352,   347,
+     525,   524,   520,   521,   519,     0,   516,   518,   522,   523,
+     582,   570,   572,   576,   574,   580,   578,   566,   559,   553,
+     557,   558,     0,   542,   543,   554,   555,   556,   550,   545,
+     551,   547,   548,   549,   552,   546,     0,   466,   243,     0,
+     470,   468,   473,     0,   462,   463,     0,   450,   451,   453,
+     465,   454,   455,   456,   472,   457,   458,   459,   460,   461,
+     500,     0,     0,   498,   499,   502,   503,     0,   487,   488,
+     490,   491,   492,   493,   494,   495,   496,   497,   299,   301,
+     296,     0,   294,   297,   298,     0,   682,   669,     0,   672,
+       0,     0,   676,   680,     0,     0,   686,   688,   690,   692,
+     667,   665,   666,     0,   648,   650,   651,   652,   653,   654,
+     655,   656,   657,   662,   658,   659,   660,   661,   663,   664,
+       0,   715,   717,   708,     0,     0,   704,   706,   707,    46,
+       0,     0,    39,     0,     0,     0,     0,     0,     0,    57,
+       0,    59,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    71,     0,     0,     0,     0,     0,   166,     0,
+       0,     0,     0,    71,     0,     0,     0,     0,     0,   171,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     311,     0,     0,   492,     0,     0,     0,     0,     0,     0,
-       0,     0,   517,     0,   417,     0,     0,     0,     0,     0,
-       0,     0,   425,     0,     0,     0,     0,   462,     0,     0,
-       0,     0,   276,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   623,
-       0,   690,     0,     0,     0,   679,    50,    43,     0,     0,
-       0,     0,     0,     0,    61,     0,     0,     0,   133,   134,
-     135,     0,     0,     0,     0,     0,     0,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,     0,   136,   137,   138,
+       0,   330,     0,     0,   515,     0,     0,     0,     0,     0,
+       0,     0,     0,   540,     0,   440,     0,     0,     0,     0,
+       0,     0,     0,   448,     0,     0,     0,     0,   485,     0,
+       0,     0,     0,   293,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   590,     0,     0,     0,     0,
-       0,     0,    73,     0,     0,     0,   177,   157,     0,     0,
-       0,     0,     0,     0,   371,     0,     0,     0,   313,     0,
-     494,     0,     0,     0,     0,     0,     0,     0,     0,   521,
-       0,     0,   441,     0,     0,     0,   452,   429,     0,   481,
-     482,   466,     0,     0,   278,   644,     0,     0,   647,     0,
-     650,   651,     0,     0,   660,   661,     0,     0,     0,     0,
-     625,   692,     0,   686,   681,     0,     0,     0,   671,   673,
-     675,     0,     0,     0,   538,   540,   542,     0,     0,   191,
-     132,   141,   142,   143,   144,   145,   140,   147,   149,   304,
-     418,   455,   374,    40,   505,   507,   367,   368,   369,   370,
-     366,     0,     0,   510,   269,     0,     0,     0,     0,   151,
-     153,     0,    51,   168,   171,   172,   170,   175,   176,   174,
-     354,   356,   358,   485,   352,   360,   364,   362,     0,   503,
-     560,   548,   550,   554,   552,   558,   556,   544,   444,   234,
-     448,   446,   451,   478,   283,   285,   659,   646,   649,   654,
-     655,   653,   657,   663,   665,   667,   669,   191,    44,     0,
-       0,     0,     0,   185,     0,   182,   184,   220,   226,   228,
-     230,     0,     0,     0,     0,     0,   242,   244,   246,   248,
-       0,     0,     0,     0,     0,     0,   219,     0,   197,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   212,
-     213,   214,   209,   215,   216,   217,   210,   211,   218,     0,
-     195,     0,   192,   193,   308,     0,   305,   306,   422,     0,
-     419,   420,   459,     0,   456,   457,   378,     0,   375,   376,
-     262,   263,   264,   265,   266,     0,   255,   257,   258,   259,
-     260,   261,   569,     0,   567,   514,     0,   511,   512,   273,
-       0,   270,   271,     0,     0,     0,     0,     0,     0,     0,
-     288,   290,   291,   292,   293,   294,   295,   600,   602,   599,
-     597,   598,     0,   593,   595,   596,     0,   615,     0,   618,
-     611,   612,     0,   606,   608,   609,   610,   613,     0,   698,
-       0,   696,    53,   489,     0,   486,   487,   545,   563,   564,
-       0,     0,    69,   688,   677,   155,     0,     0,   181,     0,
+     647,     0,   714,     0,     0,     0,   703,    50,    43,     0,
+       0,     0,     0,     0,     0,    61,     0,     0,     0,   138,
+     139,   140,     0,     0,     0,     0,     0,     0,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,     0,
+     141,   142,   143,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   613,   614,
+       0,     0,     0,     0,     0,     0,    73,     0,     0,     0,
+     182,   162,     0,     0,     0,     0,     0,     0,   392,     0,
+       0,     0,   332,     0,   517,     0,     0,     0,     0,     0,
+       0,     0,     0,   544,     0,     0,   464,     0,     0,     0,
+     475,   452,     0,   504,   505,   489,     0,     0,   295,   668,
+       0,     0,   671,     0,   674,   675,     0,     0,   684,   685,
+       0,     0,     0,     0,   649,   716,     0,   710,   705,     0,
+       0,     0,   695,   697,   699,     0,     0,     0,   561,   563,
+     565,     0,     0,   196,   137,   146,   147,   148,   149,   150,
+     145,   152,   154,   323,   441,   478,   395,    40,   528,   530,
+     388,   389,   390,   391,   387,     0,     0,   533,   286,     0,
+       0,     0,     0,   156,   158,     0,    51,   173,   176,   177,
+     175,   180,   181,   179,   375,   377,   379,   508,   373,   381,
+     385,   383,     0,   526,   583,   571,   573,   577,   575,   581,
+     579,   567,   467,   244,   471,   469,   474,   501,   300,   302,
+     683,   670,   673,   678,   679,   677,   681,   687,   689,   691,
+     693,   196,    44,     0,     0,     0,     0,   190,     0,   187,
+     189,   230,   236,   238,   240,     0,     0,     0,     0,     0,
+       0,   250,   252,     0,     0,   259,   261,   263,   265,     0,
+       0,     0,     0,     0,     0,   229,     0,   202,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   222,   223,   224,   219,   225,   226,   227,
+     220,   221,   228,     0,   200,     0,   197,   198,   327,     0,
+     324,   325,   445,     0,   442,   443,   482,     0,   479,   480,
+     399,     0,   396,   397,   279,   280,   281,   282,   283,     0,
+     272,   274,   275,   276,   277,   278,   592,     0,   590,   537,
+       0,   534,   535,   290,     0,   287,   288,     0,     0,     0,
+       0,     0,     0,     0,     0,   305,   307,   308,   309,   310,
+     311,   312,   313,   624,   626,   623,   621,   622,     0,   617,
+     619,   620,     0,   639,     0,   642,   635,   636,     0,   630,
+     632,   633,   634,   637,     0,   722,     0,   720,    53,   512,
+       0,   509,   510,   568,   586,   587,     0,     0,    69,   712,
+     701,   160,     0,     0,   186,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   179,
-     188,     0,   190,     0,     0,   303,     0,   426,   415,     0,
-     463,   454,     0,     0,   373,     0,     0,   254,   571,     0,
-     566,   518,   509,     0,     0,   268,     0,     0,     0,     0,
-       0,     0,     0,     0,   287,     0,     0,     0,   592,     0,
-       0,     0,     0,     0,   605,   621,     0,     0,   695,    55,
-       0,    54,     0,   484,     0,     0,   562,   685,     0,   183,
-       0,     0,     0,     0,   232,   235,   236,   237,   238,     0,
-       0,     0,     0,   250,   251,   239,   240,   241,   252,   198,
-       0,   194,     0,   307,     0,   421,     0,   458,   413,   397,
-     398,   399,   385,   386,   402,   403,   404,   388,   389,   405,
-     406,   407,   408,   409,   410,   411,   412,   382,   383,   384,
-     395,   396,   394,     0,   380,   387,   400,   401,   390,   391,
-     392,   393,   377,   256,   587,     0,   585,   586,   578,   579,
-     583,   584,   580,   581,   582,     0,   572,   573,   575,   576,
-     577,   568,     0,   513,     0,   272,   296,   297,   298,   299,
-     300,   301,   289,     0,     0,   594,   614,     0,   617,     0,
-     607,   712,     0,   710,   708,   702,   706,   707,     0,   700,
-     704,   705,   703,   697,    52,     0,     0,   488,     0,   186,
-     222,   223,   224,   225,   221,   227,   229,   231,   243,   245,
-     247,   249,   196,   309,   423,   460,     0,   379,     0,     0,
-     570,     0,   515,   274,   601,   603,   616,   619,     0,     0,
-       0,     0,   699,    56,   490,   546,   381,     0,   589,   574,
-       0,   709,     0,   701,   588,     0,   711,   716,     0,   714,
-       0,     0,   713,   725,     0,     0,     0,   730,     0,   718,
-     720,   721,   722,   723,   724,   715,     0,     0,     0,     0,
-       0,     0,   717,     0,   727,   728,   729,     0,   719,   726,
-     731
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     184,   193,     0,   195,     0,     0,   322,     0,   449,   438,
+       0,   486,   477,     0,     0,   394,     0,     0,   271,   594,
+       0,   589,   541,   532,     0,     0,   285,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   304,     0,     0,     0,
+     616,     0,     0,     0,     0,     0,   629,   645,     0,     0,
+     719,    55,     0,    54,     0,   507,     0,     0,   585,   709,
+       0,   188,     0,     0,     0,     0,   242,   245,   246,   247,
+     248,   249,     0,     0,   254,   255,     0,     0,     0,     0,
+     267,   268,   256,   257,   258,   269,   203,     0,   199,     0,
+     326,     0,   444,     0,   481,   436,   418,   419,   420,   406,
+     407,   423,   424,   425,   426,   427,   409,   410,   428,   429,
+     430,   431,   432,   433,   434,   435,   403,   404,   405,   416,
+     417,   415,     0,   401,   408,   421,   422,   411,   412,   413,
+     414,   398,   273,   610,     0,   608,   609,   601,   602,   606,
+     607,   603,   604,   605,     0,   595,   596,   598,   599,   600,
+     591,     0,   536,     0,   289,   314,   315,   316,   317,   318,
+     319,   320,   306,     0,     0,   618,   638,     0,   641,     0,
+     631,   743,     0,   737,   739,     0,     0,   735,   726,   733,
+     734,     0,   724,   728,   729,   730,   731,   732,   727,   721,
+      52,     0,     0,   511,     0,   191,   232,   233,   234,   235,
+     231,   237,   239,   241,   251,   253,   260,   262,   264,   266,
+     201,   328,   446,   483,     0,   400,     0,     0,   593,     0,
+     538,   291,   625,   627,   640,   643,     0,     0,     0,     0,
+       0,     0,     0,   723,    56,   513,   569,   402,     0,   612,
+     597,     0,   736,     0,     0,   741,   742,   725,   611,     0,
+     738,   740,   747,     0,   745,     0,     0,   744,   759,     0,
+       0,     0,   764,     0,     0,   768,     0,   749,   751,   752,
+     753,   754,   755,   756,   757,   758,   746,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   748,     0,   761,   762,
+     763,     0,   766,   767,     0,   750,   760,   765,   769
   };
 
   const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,   -23,  -900,   337,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -576,  -900,  -900,
-    -900,   -70,  -900,  -900,  -900,   507,  -900,  -900,  -900,  -900,
-     272,   455,   -47,   -44,    -1,    16,    18,    24,    30,    31,
-    -900,  -900,  -900,  -900,    34,    35,    36,    37,    38,    42,
-    -900,   274,    48,  -900,    49,  -900,    50,  -900,    52,  -900,
-    -900,  -900,   273,   458,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-      59,  -900,  -900,  -900,  -900,  -900,  -900,   175,  -900,    55,
-    -900,  -636,    61,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,   -39,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,    44,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,    45,  -900,  -900,  -900,
-      46,   473,  -900,  -900,  -900,  -900,  -900,  -900,  -900,    39,
-    -900,  -900,  -900,  -900,  -900,  -900,  -899,  -900,  -900,  -900,
-      63,  -900,  -900,  -900,    69,   528,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -896,  -900,   -43,  -900,    54,  -900,
-      53,  -900,  -900,  -900,  -900,  -900,  -900,  -900,    60,  -900,
-    -900,  -128,   -63,  -900,  -900,  -900,  -900,  -900,    65,  -900,
-    -900,  -900,    70,  -900,   495,  -900,   -66,  -900,  -900,  -900,
-    -900,  -900,   -64,  -900,  -900,  -900,  -900,  -900,    -7,  -900,
-    -900,  -900,    71,  -900,  -900,  -900,    72,  -900,   491,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-      22,  -900,  -900,  -900,    32,   534,  -900,  -900,   -57,  -900,
-     -20,  -900,   -62,  -900,  -900,  -900,    58,  -900,  -900,  -900,
-      74,  -900,   535,     0,  -900,     6,  -900,    12,  -900,   282,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -895,  -900,  -900,
-    -900,  -900,  -900,    75,  -900,  -900,  -900,  -116,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,    51,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,    47,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,   308,   483,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,  -900,   348,   485,  -900,  -900,  -900,  -900,  -900,  -900,
-    -900,   355,   490,   -75,  -900,  -900,    76,  -900,  -900,  -118,
-    -900,  -900,  -900,  -900,  -900,  -900,  -134,  -900,  -900,  -153,
-    -900,  -900,  -900,  -900,  -900,  -900,  -900
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,   -62,  -933,   218,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -598,  -933,  -933,
+    -933,   -70,  -933,  -933,  -933,   602,  -933,  -933,  -933,  -933,
+     349,   556,   -43,   -42,   -22,   -19,   -17,   -12,    -9,    -6,
+      18,    19,  -933,  -933,  -933,  -933,    22,    25,    26,    29,
+      30,    32,  -933,   361,    36,  -933,    37,  -933,    40,  -933,
+      42,  -933,  -933,  -933,   347,   546,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,   102,  -933,  -933,  -933,  -933,  -933,  -933,   271,
+    -933,    72,  -933,  -657,    80,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,   -44,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,    63,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,    50,  -933,  -933,  -933,    56,
+     513,  -933,  -933,  -933,  -933,  -933,  -933,  -933,    51,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -932,  -933,  -933,  -933,
+      81,  -933,  -933,  -933,    82,   568,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -929,  -933,   -37,  -933,    38,  -933,
+      43,  -933,  -933,  -933,  -933,  -933,  -933,  -933,    77,  -933,
+    -933,  -120,   -63,  -933,  -933,  -933,  -933,  -933,    90,  -933,
+    -933,  -933,    87,  -933,   538,  -933,   -66,  -933,  -933,  -933,
+    -933,  -933,   -64,  -933,  -933,  -933,  -933,  -933,   -16,  -933,
+    -933,  -933,    96,  -933,  -933,  -933,    95,  -933,   541,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+      55,  -933,  -933,  -933,    58,   571,  -933,  -933,   -54,  -933,
+     -32,  -933,   -57,  -933,  -933,  -933,    89,  -933,  -933,  -933,
+      94,  -933,   569,    -4,  -933,     6,  -933,     7,  -933,   335,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -927,  -933,  -933,
+    -933,  -933,  -933,    99,  -933,  -933,  -933,  -104,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,    79,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,    75,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,   359,   535,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,   397,   532,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,   407,   534,   -52,  -933,  -933,    84,  -933,  -933,
+    -106,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,  -933,
+    -933,  -127,  -933,  -933,  -155,  -933,  -933,  -933,  -933,  -933,
+    -933,  -933,  -933,  -933,  -933,  -933
   };
 
   const short
@@ -4501,491 +4688,508 @@ namespace isc { namespace dhcp {
   {
       -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    38,    39,    40,    69,
-     674,    87,    88,    41,    68,    84,    85,   693,   872,   960,
-     961,   766,    43,    70,    96,    97,    98,   396,    45,    71,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   425,   163,   164,   165,   166,   167,   168,   169,
-     429,   666,   170,   430,   171,   431,   172,   448,   173,   449,
-     174,   405,   205,   206,    47,    72,   207,   453,   208,   454,
-     696,   209,   455,   699,   210,   175,   413,   176,   406,   744,
-     745,   746,   886,   177,   414,   178,   415,   791,   792,   793,
-     911,   767,   768,   769,   889,  1094,   770,   890,   771,   891,
-     772,   892,   773,   774,   486,   775,   776,   777,   778,   779,
-     780,   781,   782,   898,   783,   899,   784,   900,   785,   901,
-     786,   787,   788,   179,   439,   815,   816,   817,   818,   819,
-     820,   821,   180,   442,   830,   831,   832,   934,    61,    79,
-     343,   344,   345,   499,   346,   500,   181,   443,   839,   840,
-     841,   842,   843,   844,   845,   846,   182,   432,   795,   796,
-     797,   914,    49,    73,   242,   243,   244,   463,   245,   459,
-     246,   460,   247,   461,   248,   464,   249,   467,   250,   466,
-     183,   438,   680,   252,   184,   435,   807,   808,   809,   923,
-    1023,  1024,   185,   433,    55,    76,   799,   800,   801,   917,
-      57,    77,   308,   309,   310,   311,   312,   313,   314,   485,
-     315,   489,   316,   488,   317,   318,   490,   319,   186,   434,
-     803,   804,   805,   920,    59,    78,   329,   330,   331,   332,
-     333,   494,   334,   335,   336,   337,   254,   462,   874,   875,
-     876,   962,    51,    74,   267,   268,   269,   471,   187,   436,
-     188,   437,   189,   441,   826,   827,   828,   931,    53,    75,
-     284,   285,   286,   190,   410,   191,   411,   192,   412,   290,
-     481,   879,   965,   291,   475,   292,   476,   293,   478,   294,
-     477,   295,   480,   296,   479,   297,   474,   261,   468,   880,
-     193,   440,   823,   824,   928,  1045,  1046,  1047,  1048,  1049,
-    1108,  1050,   194,   195,   445,   852,   853,   854,   945,   855,
-     946,   196,   446,   862,   863,   864,   865,   950,   866,   867,
-     952,   197,   447,    63,    80,   365,   366,   367,   368,   505,
-     369,   370,   507,   371,   372,   373,   510,   731,   374,   511,
-     375,   504,   376,   377,   378,   514,   379,   515,   380,   516,
-     381,   517,    99,   398,   100,   399,   101,   400,   198,   404,
-      67,    82,   387,   388,   389,   522,   390,   102,   397,    65,
-      81,   382,   383,   199,   450,   870,   871,   956,  1078,  1079,
-    1080,  1081,  1120,  1082,  1118,  1138,  1139,  1140,  1148,  1149,
-    1150,  1156,  1151,  1152,  1153,  1154,  1160
+     688,    87,    88,    41,    68,    84,    85,   707,   898,   992,
+     993,   785,    43,    70,    96,    97,    98,   404,    45,    71,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   435,   168,   169,   170,   171,   172,
+     173,   174,   439,   680,   175,   440,   176,   441,   177,   459,
+     178,   460,   179,   413,   211,   212,    47,    72,   213,   464,
+     214,   465,   710,   215,   466,   713,   216,   180,   421,   181,
+     414,   758,   759,   760,   912,   182,   422,   183,   423,   815,
+     816,   817,   942,   786,   787,   788,   915,  1140,   789,   916,
+     790,   917,   791,   918,   792,   793,   497,   794,   795,   796,
+     797,   798,   799,   925,   800,   926,   801,   802,   803,   804,
+     805,   806,   929,   807,   930,   808,   931,   809,   932,   810,
+     811,   812,   184,   449,   839,   840,   841,   842,   843,   844,
+     845,   185,   452,   854,   855,   856,   965,    61,    79,   351,
+     352,   353,   510,   354,   511,   186,   453,   864,   865,   866,
+     867,   868,   869,   870,   871,   872,   187,   442,   819,   820,
+     821,   945,    49,    73,   250,   251,   252,   474,   253,   470,
+     254,   471,   255,   472,   256,   475,   257,   478,   258,   477,
+     188,   448,   694,   260,   189,   445,   831,   832,   833,   954,
+    1062,  1063,   190,   443,    55,    76,   823,   824,   825,   948,
+      57,    77,   316,   317,   318,   319,   320,   321,   322,   496,
+     323,   500,   324,   499,   325,   326,   501,   327,   191,   444,
+     827,   828,   829,   951,    59,    78,   337,   338,   339,   340,
+     341,   505,   342,   343,   344,   345,   262,   473,   900,   901,
+     902,   994,    51,    74,   275,   276,   277,   482,   192,   446,
+     193,   447,   194,   451,   850,   851,   852,   962,    53,    75,
+     292,   293,   294,   195,   418,   196,   419,   197,   420,   298,
+     492,   905,   997,   299,   486,   300,   487,   301,   489,   302,
+     488,   303,   491,   304,   490,   305,   485,   269,   479,   906,
+     198,   450,   847,   848,   959,  1084,  1085,  1086,  1087,  1088,
+    1156,  1089,   199,   200,   201,   456,   878,   879,   880,   977,
+     881,   978,   202,   457,   888,   889,   890,   891,   982,   892,
+     893,   984,   203,   458,    63,    80,   373,   374,   375,   376,
+     516,   377,   378,   518,   379,   380,   381,   521,   745,   382,
+     522,   383,   515,   384,   385,   386,   525,   387,   526,   388,
+     527,   389,   528,    99,   406,   100,   407,   101,   408,   204,
+     412,    67,    82,   395,   396,   397,   533,   398,   102,   405,
+      65,    81,   390,   391,   205,   461,   896,   897,   988,  1121,
+    1122,  1123,  1124,  1168,  1125,  1169,  1126,  1127,  1128,  1166,
+    1193,  1194,  1195,  1206,  1207,  1208,  1217,  1209,  1210,  1211,
+    1212,  1221,  1213,  1214,  1215,  1224
   };
 
   const unsigned short
   Dhcp4Parser::yytable_[] =
   {
-      95,   150,   204,   223,   263,   280,   384,   306,   325,   342,
-     362,   257,   327,   298,   328,   211,   255,   270,   282,   706,
-     320,   338,   789,   363,  1018,   710,   224,  1019,  1031,   225,
-      89,   264,   729,    31,    42,    32,    44,    33,   307,   326,
-     200,   201,    86,   402,   202,    83,   451,   203,   403,   300,
-     132,   452,   212,   256,   271,   283,    30,   321,   339,   149,
-     364,   135,   136,   391,   340,   341,   253,   266,   281,    46,
-     133,   457,   226,   258,    48,   287,   458,   135,   136,   259,
-     392,   288,   262,   135,   136,   260,    50,   289,    52,   227,
-      54,   228,   109,   110,   111,   220,   469,   229,   221,   926,
-     299,   470,   927,   230,   231,   340,   341,   232,   233,   234,
-     235,   236,   385,   386,   393,   237,   135,   136,   856,   857,
-     858,   238,   239,   240,   929,   241,   251,   930,   265,  1071,
-      94,  1072,  1073,    56,   472,   661,   662,   663,   664,   473,
-      58,   132,   133,   300,   501,   300,    60,   301,   302,   502,
-     395,   303,   304,   305,    94,   135,   136,   135,   136,   694,
-     695,   518,   520,   730,   135,   136,   519,   521,  1034,  1035,
-     859,   665,   697,   698,   394,   524,    94,    90,   103,  1143,
-     525,   104,  1144,  1145,  1146,  1147,   451,    91,    92,    93,
-     105,   882,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,    62,   847,   848,    94,   957,    64,  1018,   958,    94,
-    1019,  1031,    34,    35,    36,    37,   833,   834,   835,   836,
-     837,   838,   279,   877,   115,   116,   117,   118,   119,   120,
+      95,   153,   210,   229,   271,   288,    83,   314,   333,   350,
+     370,   720,   335,   306,   336,   813,   265,   724,   217,   263,
+     278,   290,  1057,   328,   346,  1058,   371,  1070,   743,   392,
+     230,   231,    86,   315,   334,   393,   394,   272,   348,   349,
+     218,   264,   279,   291,    89,   329,   347,   410,   372,    30,
+     462,   232,   411,    42,   233,   463,   234,   261,   274,   289,
+     468,   235,   287,   903,   236,   469,    31,   237,    32,   266,
+      33,   295,   675,   676,   677,   678,   708,   709,    44,   267,
+     268,   296,   297,   206,   207,    46,   957,   208,   480,   958,
+     209,   238,   239,   481,   307,   240,   348,   349,   241,   242,
+      48,   483,   243,   244,   960,   245,   484,   961,   989,   246,
+     247,   990,   273,   248,   679,   249,   259,   308,   330,   309,
+     310,   331,   332,   103,  1196,    50,   104,  1197,   512,   137,
+     138,   137,   138,   513,    52,   105,    54,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   308,    56,   309,   310,
+     137,   138,   311,   312,   313,   711,   712,    58,   137,   138,
+     834,   835,   836,   837,   529,   838,   137,   138,   744,   530,
+      94,   873,   874,    60,   115,   116,   117,   118,   119,   120,
      121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   520,   524,    66,   132,   133,   883,   884,    94,   401,
-      94,   810,   811,   812,   813,   134,   814,    94,   135,   136,
-     407,  1141,   482,   137,  1142,   109,   110,   111,   138,   139,
-     408,   457,   484,   409,   140,   990,   885,   300,   322,   301,
-     302,   323,   324,   887,   141,   416,   908,   142,   888,   135,
-     136,   909,   908,   483,   143,   144,   943,   910,   145,   947,
-     953,   944,   146,   417,   948,   954,   518,   908,   135,   136,
-     418,   955,  1102,   469,  1106,   133,   501,   492,  1103,  1107,
-     419,  1113,   147,   148,   420,   149,  1121,   493,   135,   136,
-     472,  1122,    95,  1161,   497,  1124,   421,   422,  1162,   272,
-     676,   677,   678,   679,   423,   273,   274,   275,   276,   277,
-     278,    94,   279,   347,   348,   349,   350,   351,   352,   353,
-     354,   355,   356,   357,   358,   359,   424,   426,   427,   526,
-     527,   428,   360,   361,  1090,  1091,  1092,  1093,   444,   456,
-     465,   150,    94,   487,   491,   495,   496,   204,   503,   498,
-     528,   506,   508,   509,   512,   513,   523,   529,   530,   223,
-     211,    94,   263,   531,   532,   533,   535,   257,   536,   537,
-     538,   539,   255,   280,   540,   270,   541,   542,   543,   544,
-     545,    94,   224,   306,   546,   225,   282,   547,   325,   264,
-     553,   548,   327,   549,   328,   550,   320,   212,   551,   552,
-     555,   338,   556,   554,   560,   384,   557,   558,   362,   256,
-     559,   561,   271,   562,   307,   563,   564,   565,   566,   326,
-     567,   363,   253,   283,   568,   266,   569,   570,   226,   258,
-     571,   572,   573,   321,   574,   259,   281,   575,   339,   576,
-     577,   260,   578,   287,   579,   227,   580,   228,   581,   288,
-     583,   584,   585,   229,   586,   289,   588,   589,   364,   230,
-     231,   590,   594,   232,   233,   234,   235,   236,   648,   649,
-     650,   237,  1125,   591,   592,   593,   595,   238,   239,   240,
-     596,   241,   251,   597,   599,   601,   265,   602,   603,   604,
-     605,   606,   747,   607,   608,   610,   611,   748,   749,   750,
-     751,   752,   753,   754,   755,   756,   757,   758,   759,   760,
-     761,   762,   763,   764,   765,     1,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,   613,
-     614,   615,   384,   618,   622,   623,   150,   300,   626,   627,
-     612,   629,   204,   616,   619,   620,   632,   633,   636,   637,
-     625,   628,   630,   631,   638,   211,   634,   635,   639,   642,
-     725,   645,   643,   646,   659,   647,   107,   108,   109,   110,
-     111,   651,   652,   653,   654,   655,   849,   656,   362,   657,
-     658,   660,   738,   667,   669,   668,   670,   671,   672,   850,
-     860,   363,   212,    32,   675,   681,   682,   115,   116,   117,
-     118,   119,   120,   121,   122,   683,   684,   125,   126,   127,
-     128,   129,   130,   685,   213,   214,   215,   686,   133,   687,
-     688,   689,   691,   690,   692,   700,   851,   861,   364,   216,
-     703,   135,   136,   217,   218,   219,   137,   107,   108,   109,
-     110,   111,    94,   220,   701,   702,   221,   140,   704,   705,
-     707,   708,   709,   737,   222,   732,   743,   711,   712,   713,
-     790,   714,   715,   794,   798,   802,   716,   806,   115,   116,
-     117,   118,   119,   120,   121,   122,   822,   717,   125,   126,
-     127,   128,   129,   130,   131,   718,   719,   720,   721,   133,
-     300,   722,   723,   724,   726,   147,   148,   727,   728,   734,
-     735,   736,   135,   136,   825,   218,   829,   137,   869,   873,
-     893,   894,   895,   896,   220,   897,   902,   221,   903,   904,
-     905,   906,   907,   937,    94,   222,   912,   913,   915,   916,
-     919,   918,   922,   959,   921,   925,   924,   932,   933,   935,
-     936,  1135,   938,   939,   940,   941,   942,   949,   951,   964,
-     975,   963,   974,   968,   967,   966,   970,   971,   972,   973,
-     976,   977,   978,   979,   980,   981,   147,   148,   982,   983,
-     984,  1063,   985,   986,  1064,  1067,   987,   988,  1056,  1057,
-    1058,  1059,  1060,  1061,  1069,  1084,  1066,  1068,  1085,  1089,
-    1088,  1095,  1096,  1097,  1109,    94,  1104,  1105,  1098,  1099,
-    1100,  1110,  1101,  1111,   223,  1112,  1114,   306,  1115,  1119,
-     325,  1116,   257,   998,   327,  1123,   328,   255,  1036,  1127,
-     320,   280,  1128,   338,   342,  1038,  1026,   224,  1130,  1132,
-     225,  1040,  1131,  1134,   282,  1136,   999,   849,   307,  1000,
-    1020,   326,  1137,  1157,  1017,  1158,  1074,  1159,  1163,  1037,
-     850,  1164,   263,  1165,   256,  1166,   860,   321,  1167,  1076,
-     339,  1169,  1170,  1027,   673,   270,   582,   253,  1041,   534,
-     733,   283,   881,   226,   258,   587,  1025,  1075,   739,   264,
-     259,  1039,  1001,  1028,   281,   742,   260,   851,  1042,  1029,
-     227,   287,   228,   861,  1043,  1030,  1077,   288,   229,  1002,
-    1044,  1003,   271,   289,   230,   231,   969,  1004,   232,   233,
-     234,   235,   236,  1005,  1006,   266,   237,  1007,  1008,  1009,
-    1010,  1011,   238,   239,   240,  1012,   241,   251,   991,   989,
-    1033,  1013,  1014,  1015,   624,  1016,  1022,  1021,  1126,   993,
-    1054,  1055,  1062,   992,   995,  1032,  1087,   994,   617,   621,
-     878,  1053,   996,   997,  1086,  1129,   868,   598,  1065,   741,
-    1070,   640,   740,  1133,  1051,  1052,   600,  1155,  1168,   644,
-     641,     0,     0,     0,     0,     0,   265,     0,   609,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,  1083,     0,     0,   998,     0,     0,     0,
-       0,  1036,     0,     0,     0,     0,  1117,     0,  1038,  1026,
-       0,  1074,     0,     0,  1040,     0,     0,     0,     0,   999,
-       0,     0,  1000,  1020,  1076,     0,     0,  1017,     0,     0,
-       0,     0,  1037,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,  1075,     0,     0,     0,  1027,     0,     0,     0,
-       0,  1041,     0,     0,     0,     0,     0,     0,     0,  1025,
-       0,  1077,     0,     0,  1039,  1001,  1028,     0,     0,     0,
-       0,  1042,  1029,     0,     0,     0,     0,  1043,  1030,     0,
-       0,     0,  1002,  1044,  1003,     0,     0,     0,     0,     0,
-    1004,     0,     0,     0,     0,     0,  1005,  1006,     0,     0,
-    1007,  1008,  1009,  1010,  1011,     0,     0,     0,  1012,     0,
-       0,     0,     0,     0,  1013,  1014,  1015,     0,  1016,  1022,
-    1021
+     131,   132,   133,   882,   883,   884,   134,   135,    62,   531,
+      90,   109,   110,   111,   532,    64,    66,   136,   535,   462,
+     137,   138,   134,   536,   908,   139,    91,    92,    93,   399,
+     140,   141,  1057,   531,   400,  1058,   142,  1070,   909,   135,
+      94,   152,    94,    94,   401,   535,   143,   402,   403,   144,
+     910,   270,   137,   138,   109,   110,   111,   145,   146,   147,
+     468,   885,   148,   409,   226,   911,   149,   227,   135,    94,
+      34,    35,    36,    37,   913,   939,   493,    94,   939,   914,
+     940,   137,   138,   941,   415,   975,   150,   151,   979,   152,
+     976,   985,   280,   980,   416,  1027,   986,   417,   281,   282,
+     283,   284,   285,   286,   308,   287,   424,   425,   529,   939,
+     134,   135,   308,   987,  1150,   480,   137,   138,  1154,   494,
+    1151,    94,   512,  1155,   137,   138,  1198,  1161,   426,  1199,
+    1200,  1201,  1202,  1203,  1204,  1205,   427,  1073,  1074,   857,
+     858,   859,   860,   861,   862,   863,  1172,   495,   537,   538,
+      95,  1173,   761,    94,   428,   429,   430,   762,   763,   764,
+     765,   766,   767,   768,   769,   770,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,   783,   784,
+     483,   503,    94,   431,   432,  1175,  1111,   433,  1112,  1113,
+    1225,   690,   691,   692,   693,  1226,   434,  1114,  1115,  1116,
+     436,   437,   153,   438,   308,   454,   455,   504,   210,  1136,
+    1137,  1138,  1139,   467,   476,   498,   502,    94,   506,   507,
+     229,   508,   509,   271,   217,    94,   514,   517,   519,   520,
+     523,   524,   534,   265,   288,   539,   263,   540,   541,   278,
+     542,   543,   544,   546,   314,   547,   218,   230,   231,   333,
+     290,   548,   549,   335,   550,   336,   272,   551,   264,   552,
+     328,   279,   553,   554,   555,   346,   556,   557,   232,   370,
+     315,   233,   291,   234,   261,   334,   558,   274,   235,   559,
+     563,   236,   329,   560,   237,   371,   266,   347,   289,   392,
+     662,   663,   664,   564,   561,   562,   267,   268,   565,   566,
+     295,   137,   138,   569,   567,   573,   574,   372,   238,   239,
+     296,   297,   240,   568,   575,   241,   242,    94,   576,   243,
+     244,   577,   245,   570,   571,   572,   246,   247,   578,   579,
+     248,   273,   249,   259,   580,   581,   582,   583,   584,   585,
+     586,   587,   588,   590,   589,   591,  1176,   592,   355,   356,
+     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
+     367,   593,   594,   595,   597,   598,   599,   368,   369,     1,
+       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,   600,   602,   739,   603,   604,   605,   606,
+     607,   608,   609,   610,   611,   613,  1191,   615,   616,   617,
+     153,   618,    94,   619,   620,   621,   210,   752,   622,   624,
+     625,   627,   628,   629,   632,   636,   626,   637,   640,   392,
+     630,   641,   217,   633,   643,   646,   647,   650,   651,   652,
+     653,   634,   639,   648,   649,   642,   656,   659,   660,   668,
+     875,   661,   370,   644,   218,   107,   108,   109,   110,   111,
+     645,   657,   665,   666,   667,   669,   876,   886,   371,   671,
+     670,   672,   673,   674,   681,   682,   683,   684,   685,   686,
+     689,   695,    32,   696,   697,   698,   703,   704,   877,   887,
+     372,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   699,   700,   127,   128,   129,   130,   131,   132,   701,
+     219,   220,   221,   702,   135,   107,   108,   109,   110,   111,
+     705,   706,   714,   717,   715,   222,   722,   137,   138,   223,
+     224,   225,   139,   751,   746,   716,   718,   719,   721,   226,
+     814,   757,   227,   142,   818,   822,   826,   723,   830,   725,
+     228,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   726,   727,   127,   128,   129,   130,   131,   132,   133,
+     846,   849,   728,   729,   135,   308,   730,   731,   732,   733,
+     734,   735,   736,   737,   738,   740,   741,   137,   138,   853,
+     224,   895,   139,   150,   151,   899,   742,   919,   920,   226,
+     921,   748,   227,   922,   923,   749,   924,   750,   927,   928,
+     228,   933,   934,   935,   936,   937,   938,   944,   687,   943,
+     947,   946,   949,   950,   952,   953,   956,   955,    94,   964,
+     963,   966,   967,   995,   968,   969,   970,   971,   972,   973,
+     974,   981,   983,   996,   991,  1000,  1006,   998,   999,  1002,
+    1003,  1004,  1005,   150,   151,  1007,  1009,  1012,  1008,  1013,
+    1011,  1010,  1016,  1014,  1017,  1015,  1018,  1019,  1020,  1021,
+    1022,  1103,  1104,  1107,  1109,  1134,  1131,  1023,  1130,  1157,
+    1159,  1189,  1025,  1024,  1095,  1096,  1097,  1098,    94,  1152,
+    1099,  1100,  1153,  1108,  1101,   229,  1158,  1135,   314,  1106,
+    1141,   333,  1142,  1143,  1035,   335,  1144,   336,   265,  1075,
+    1145,   263,   288,  1146,   328,   350,  1077,   346,  1160,  1147,
+    1065,  1148,   230,   231,   315,  1079,  1149,   334,   290,   875,
+    1056,  1036,  1037,   264,  1162,  1076,   329,  1059,  1117,   347,
+    1167,  1163,  1066,   232,   271,   876,   233,  1080,   234,   261,
+     291,   886,  1038,   235,  1119,  1039,   236,  1040,  1064,   237,
+     278,   266,  1041,  1078,  1118,  1042,   289,   877,  1043,  1164,
+    1067,   267,   268,   887,  1170,  1081,  1120,   272,   295,  1171,
+    1068,  1069,   279,   238,   239,  1082,  1083,   240,   296,   297,
+     241,   242,  1044,  1045,   243,   244,  1046,   245,   274,  1047,
+    1048,   246,   247,  1049,  1050,   248,  1051,   249,   259,  1178,
+    1052,  1053,  1060,  1181,  1054,  1183,  1055,  1061,  1174,  1184,
+    1192,  1218,  1219,  1220,  1222,  1223,  1227,  1231,  1234,   753,
+    1179,   747,   545,   756,   601,  1001,  1028,  1094,   596,  1026,
+    1072,  1093,   907,  1182,  1185,   638,  1102,  1029,  1030,  1186,
+    1188,  1190,   273,  1071,  1177,  1031,  1228,  1229,  1232,  1230,
+    1032,  1233,   631,  1236,  1237,  1238,  1033,  1165,   612,  1034,
+     635,  1133,  1132,  1092,   614,  1180,  1091,   904,  1105,  1090,
+    1110,   894,   755,   623,   654,   655,  1187,   658,   754,  1216,
+    1235,     0,     0,  1129,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1035,     0,     0,     0,     0,  1075,
+       0,     0,     0,     0,     0,     0,  1077,     0,     0,     0,
+    1065,     0,  1117,     0,     0,  1079,     0,     0,     0,     0,
+    1056,  1036,  1037,     0,     0,  1076,     0,  1059,  1119,     0,
+       0,     0,  1066,     0,     0,     0,     0,  1080,  1118,     0,
+       0,     0,  1038,     0,     0,  1039,     0,  1040,  1064,     0,
+    1120,     0,  1041,  1078,     0,  1042,     0,     0,  1043,     0,
+    1067,     0,     0,     0,     0,  1081,     0,     0,     0,     0,
+    1068,  1069,     0,     0,     0,  1082,  1083,     0,     0,     0,
+       0,     0,  1044,  1045,     0,     0,  1046,     0,     0,  1047,
+    1048,     0,     0,  1049,  1050,     0,  1051,     0,     0,     0,
+    1052,  1053,  1060,     0,  1054,     0,  1055,  1061
   };
 
   const short
   Dhcp4Parser::yycheck_[] =
   {
-      70,    71,    72,    73,    74,    75,    81,    77,    78,    79,
-      80,    73,    78,    76,    78,    72,    73,    74,    75,   595,
-      77,    78,   658,    80,   923,   601,    73,   923,   923,    73,
-      10,    74,    18,     5,     7,     7,     7,     9,    77,    78,
-      15,    16,   184,     3,    19,    68,     3,    22,     8,    79,
-      77,     8,    72,    73,    74,    75,     0,    77,    78,   158,
-      80,    91,    92,     6,   118,   119,    73,    74,    75,     7,
-      78,     3,    73,    73,     7,    75,     8,    91,    92,    73,
-       3,    75,    90,    91,    92,    73,     7,    75,     7,    73,
-       7,    73,    28,    29,    30,   103,     3,    73,   106,     3,
-      34,     8,     6,    73,    73,   118,   119,    73,    73,    73,
-      73,    73,    12,    13,     4,    73,    91,    92,   132,   133,
-     134,    73,    73,    73,     3,    73,    73,     6,    74,   159,
-     184,   161,   162,     7,     3,   151,   152,   153,   154,     8,
-       7,    77,    78,    79,     3,    79,     7,    81,    82,     8,
-       3,    85,    86,    87,   184,    91,    92,    91,    92,    17,
-      18,     3,     3,   149,    91,    92,     8,     8,   104,   105,
-     184,   187,    20,    21,     8,     3,   184,   157,    11,   160,
-       8,    14,   163,   164,   165,   166,     3,   167,   168,   169,
-      23,     8,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,     7,   129,   130,   184,     3,     7,  1106,     6,   184,
-    1106,  1106,   184,   185,   186,   187,   121,   122,   123,   124,
-     125,   126,   115,   116,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,     3,     3,     7,    77,    78,     8,     8,   184,     4,
-     184,   108,   109,   110,   111,    88,   113,   184,    91,    92,
-       4,     3,     8,    96,     6,    28,    29,    30,   101,   102,
-       4,     3,     8,     4,   107,   911,     8,    79,    80,    81,
-      82,    83,    84,     3,   117,     4,     3,   120,     8,    91,
-      92,     8,     3,     3,   127,   128,     3,     8,   131,     3,
-       3,     8,   135,     4,     8,     8,     3,     3,    91,    92,
-       4,     8,     8,     3,     3,    78,     3,     8,     8,     8,
-       4,     8,   155,   156,     4,   158,     3,     3,    91,    92,
-       3,     8,   402,     3,     8,     8,     4,     4,     8,   102,
-      97,    98,    99,   100,     4,   108,   109,   110,   111,   112,
-     113,   184,   115,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,     4,     4,     4,   392,
-     393,     4,   155,   156,    35,    36,    37,    38,     4,     4,
-       4,   451,   184,     4,     4,     4,     4,   457,     4,     3,
-     184,     4,     4,     4,     4,     4,     4,     4,     4,   469,
-     457,   184,   472,     4,     4,     4,     4,   469,     4,     4,
-     187,   187,   469,   483,   187,   472,     4,     4,     4,     4,
-       4,   184,   469,   493,     4,   469,   483,   185,   498,   472,
-     186,   185,   498,   185,   498,   185,   493,   457,   185,   187,
-     185,   498,     4,   186,     4,   520,   187,   187,   518,   469,
-     187,     4,   472,     4,   493,     4,     4,     4,     4,   498,
-       4,   518,   469,   483,     4,   472,     4,     4,   469,   469,
-       4,     4,     4,   493,     4,   469,   483,   185,   498,     4,
-       4,   469,     4,   483,     4,   469,     4,   469,     4,   483,
-       4,     4,     4,   469,   187,   483,     4,     4,   518,   469,
-     469,     4,   185,   469,   469,   469,   469,   469,   531,   532,
-     533,   469,  1088,     4,     4,     4,     4,   469,   469,   469,
-       4,   469,   469,     4,     4,     4,   472,     4,     4,     4,
-       4,     4,    34,     4,     4,     4,     4,    39,    40,    41,
+      70,    71,    72,    73,    74,    75,    68,    77,    78,    79,
+      80,   609,    78,    76,    78,   672,    73,   615,    72,    73,
+      74,    75,   954,    77,    78,   954,    80,   954,    18,    81,
+      73,    73,   199,    77,    78,    12,    13,    74,   125,   126,
+      72,    73,    74,    75,    10,    77,    78,     3,    80,     0,
+       3,    73,     8,     7,    73,     8,    73,    73,    74,    75,
+       3,    73,   122,   123,    73,     8,     5,    73,     7,    73,
+       9,    75,   160,   161,   162,   163,    17,    18,     7,    73,
+      73,    75,    75,    15,    16,     7,     3,    19,     3,     6,
+      22,    73,    73,     8,    34,    73,   125,   126,    73,    73,
+       7,     3,    73,    73,     3,    73,     8,     6,     3,    73,
+      73,     6,    74,    73,   202,    73,    73,    86,    87,    88,
+      89,    90,    91,    11,     3,     7,    14,     6,     3,    98,
+      99,    98,    99,     8,     7,    23,     7,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    86,     7,    88,    89,
+      98,    99,    92,    93,    94,    20,    21,     7,    98,    99,
+     115,   116,   117,   118,     3,   120,    98,    99,   158,     8,
+     199,   138,   139,     7,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,   141,   142,   143,    84,    85,     7,     3,
+     166,    28,    29,    30,     8,     7,     7,    95,     3,     3,
+      98,    99,    84,     8,     8,   103,   182,   183,   184,     6,
+     108,   109,  1154,     3,     3,  1154,   114,  1154,     8,    85,
+     199,   167,   199,   199,     4,     3,   124,     8,     3,   127,
+       8,    97,    98,    99,    28,    29,    30,   135,   136,   137,
+       3,   199,   140,     4,   110,     8,   144,   113,    85,   199,
+     199,   200,   201,   202,     3,     3,     8,   199,     3,     8,
+       8,    98,    99,     8,     4,     3,   164,   165,     3,   167,
+       8,     3,   109,     8,     4,   942,     8,     4,   115,   116,
+     117,   118,   119,   120,    86,   122,     4,     4,     3,     3,
+      84,    85,    86,     8,     8,     3,    98,    99,     3,     3,
+       8,   199,     3,     8,    98,    99,   169,     8,     4,   172,
+     173,   174,   175,   176,   177,   178,     4,   111,   112,   128,
+     129,   130,   131,   132,   133,   134,     3,     8,   400,   401,
+     410,     8,    34,   199,     4,     4,     4,    39,    40,    41,
       42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,     4,
-       4,     4,   647,     4,     4,     4,   646,    79,     4,     4,
-     185,     4,   652,   187,   187,   187,     4,     4,     4,     4,
-     187,   185,   185,   185,     4,   652,   187,   187,     4,     4,
-     623,     4,   185,     7,     5,     7,    26,    27,    28,    29,
-      30,     7,     7,     7,   184,   184,   686,   184,   688,     7,
-       7,   184,   645,   184,     5,   184,     5,     5,     5,   686,
-     687,   688,   652,     7,   184,     5,     5,    57,    58,    59,
-      60,    61,    62,    63,    64,     5,     5,    67,    68,    69,
-      70,    71,    72,     7,    74,    75,    76,     7,    78,     7,
-       7,   184,     5,   184,     5,   184,   686,   687,   688,    89,
-       5,    91,    92,    93,    94,    95,    96,    26,    27,    28,
-      29,    30,   184,   103,   184,   184,   106,   107,   184,   184,
-     184,     7,   184,     5,   114,   150,    24,   184,   184,   184,
-       7,   184,   184,     7,     7,     7,   184,     7,    57,    58,
-      59,    60,    61,    62,    63,    64,     7,   184,    67,    68,
-      69,    70,    71,    72,    73,   184,   184,   184,   184,    78,
-      79,   184,   184,   184,   184,   155,   156,   184,   184,   184,
-     184,   184,    91,    92,     7,    94,     7,    96,     7,     7,
-       4,     4,     4,     4,   103,     4,     4,   106,     4,     4,
-       4,     4,     4,     4,   184,   114,     6,     3,     6,     3,
-       3,     6,     3,   184,     6,     3,     6,     6,     3,     6,
-       3,     5,     4,     4,     4,     4,     4,     4,     4,     3,
-     187,     6,   185,     4,     6,     8,     4,     4,     4,     4,
-     185,   187,   185,     4,     4,     4,   155,   156,     4,   185,
-     185,     4,   185,   185,     4,     4,   187,   185,   185,   185,
-     185,   185,   185,   185,     4,     6,   187,   185,     3,   184,
-       4,   184,   184,   184,     4,   184,     8,     8,   184,   184,
-     184,     8,   184,     3,   914,     8,   184,   917,   184,     4,
-     920,   184,   914,   923,   920,   184,   920,   914,   928,     4,
-     917,   931,   187,   920,   934,   928,   923,   914,     4,     4,
-     914,   928,   185,   184,   931,   184,   923,   947,   917,   923,
-     923,   920,     7,     4,   923,     4,   956,     4,     4,   928,
-     947,   187,   962,   185,   914,   185,   953,   917,     4,   956,
-     920,   184,   184,   923,   567,   962,   451,   914,   928,   402,
-     636,   931,   737,   914,   914,   457,   923,   956,   646,   962,
-     914,   928,   923,   923,   931,   652,   914,   947,   928,   923,
-     914,   931,   914,   953,   928,   923,   956,   931,   914,   923,
-     928,   923,   962,   931,   914,   914,   887,   923,   914,   914,
-     914,   914,   914,   923,   923,   962,   914,   923,   923,   923,
-     923,   923,   914,   914,   914,   923,   914,   914,   913,   908,
-     926,   923,   923,   923,   501,   923,   923,   923,  1106,   916,
-     934,   936,   943,   914,   919,   925,   964,   917,   493,   498,
-     708,   933,   920,   922,   962,  1111,   688,   469,   947,   651,
-     953,   518,   647,  1121,   929,   931,   472,  1141,  1161,   524,
-     520,    -1,    -1,    -1,    -1,    -1,   962,    -1,   483,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   957,    -1,    -1,  1106,    -1,    -1,    -1,
-      -1,  1111,    -1,    -1,    -1,    -1,  1069,    -1,  1111,  1106,
-      -1,  1121,    -1,    -1,  1111,    -1,    -1,    -1,    -1,  1106,
-      -1,    -1,  1106,  1106,  1121,    -1,    -1,  1106,    -1,    -1,
-      -1,    -1,  1111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,  1121,    -1,    -1,    -1,  1106,    -1,    -1,    -1,
-      -1,  1111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1106,
-      -1,  1121,    -1,    -1,  1111,  1106,  1106,    -1,    -1,    -1,
-      -1,  1111,  1106,    -1,    -1,    -1,    -1,  1111,  1106,    -1,
-      -1,    -1,  1106,  1111,  1106,    -1,    -1,    -1,    -1,    -1,
-    1106,    -1,    -1,    -1,    -1,    -1,  1106,  1106,    -1,    -1,
-    1106,  1106,  1106,  1106,  1106,    -1,    -1,    -1,  1106,    -1,
-      -1,    -1,    -1,    -1,  1106,  1106,  1106,    -1,  1106,  1106,
-    1106
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+       3,     8,   199,     4,     4,     8,   168,     4,   170,   171,
+       3,   104,   105,   106,   107,     8,     4,   179,   180,   181,
+       4,     4,   462,     4,    86,     4,     4,     3,   468,    35,
+      36,    37,    38,     4,     4,     4,     4,   199,     4,     4,
+     480,     8,     3,   483,   468,   199,     4,     4,     4,     4,
+       4,     4,     4,   480,   494,   199,   480,     4,     4,   483,
+       4,     4,     4,     4,   504,     4,   468,   480,   480,   509,
+     494,     4,   202,   509,   202,   509,   483,   202,   480,     4,
+     504,   483,     4,     4,     4,   509,     4,     4,   480,   529,
+     504,   480,   494,   480,   480,   509,   200,   483,   480,   200,
+     202,   480,   504,   200,   480,   529,   480,   509,   494,   531,
+     542,   543,   544,   201,   200,   200,   480,   480,   201,   201,
+     494,    98,    99,     4,   200,     4,     4,   529,   480,   480,
+     494,   494,   480,   200,     4,   480,   480,   199,     4,   480,
+     480,     4,   480,   202,   202,   202,   480,   480,     4,     4,
+     480,   483,   480,   480,     4,     4,     4,     4,     4,     4,
+       4,     4,   200,     4,   200,     4,  1134,     4,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,     4,     4,     4,     4,     4,     4,   164,   165,   185,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   202,     4,   637,     4,     4,     4,     4,
+       4,   200,     4,     4,     4,     4,  1184,     4,     4,     4,
+     660,     4,   199,     4,     4,     4,   666,   659,     4,     4,
+       4,     4,     4,     4,     4,     4,   200,     4,     4,   661,
+     202,     4,   666,   202,     4,     4,     4,     4,     4,     4,
+       4,   202,   202,   202,   202,   200,     4,     4,     7,   199,
+     700,     7,   702,   200,   666,    26,    27,    28,    29,    30,
+     200,   200,     7,     7,     7,   199,   700,   701,   702,     7,
+     199,     7,     5,   199,   199,   199,     5,     5,     5,     5,
+     199,     5,     7,     5,     5,     5,   199,   199,   700,   701,
+     702,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,     7,     7,    74,    75,    76,    77,    78,    79,     7,
+      81,    82,    83,     7,    85,    26,    27,    28,    29,    30,
+       5,     5,   199,     5,   199,    96,     7,    98,    99,   100,
+     101,   102,   103,     5,   159,   199,   199,   199,   199,   110,
+       7,    24,   113,   114,     7,     7,     7,   199,     7,   199,
+     121,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,   199,   199,    74,    75,    76,    77,    78,    79,    80,
+       7,     7,   199,   199,    85,    86,   199,   199,   199,   199,
+     199,   199,   199,   199,   199,   199,   199,    98,    99,     7,
+     101,     7,   103,   164,   165,     7,   199,     4,     4,   110,
+       4,   199,   113,     4,     4,   199,     4,   199,     4,     4,
+     121,     4,     4,     4,     4,     4,     4,     3,   580,     6,
+       3,     6,     6,     3,     6,     3,     3,     6,   199,     3,
+       6,     6,     3,     6,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     3,   199,     4,   200,     8,     6,     4,
+       4,     4,     4,   164,   165,   202,   202,     4,   200,     4,
+     200,   202,     4,   202,     4,   200,     4,     4,   200,   200,
+     200,     4,     4,     4,     4,     4,     3,   200,     6,     4,
+       3,     5,   200,   202,   200,   200,   200,   200,   199,     8,
+     200,   200,     8,   200,   202,   945,     8,   199,   948,   202,
+     199,   951,   199,   199,   954,   951,   199,   951,   945,   959,
+     199,   945,   962,   199,   948,   965,   959,   951,     8,   199,
+     954,   199,   945,   945,   948,   959,   199,   951,   962,   979,
+     954,   954,   954,   945,   199,   959,   948,   954,   988,   951,
+       4,   199,   954,   945,   994,   979,   945,   959,   945,   945,
+     962,   985,   954,   945,   988,   954,   945,   954,   954,   945,
+     994,   945,   954,   959,   988,   954,   962,   979,   954,   199,
+     954,   945,   945,   985,     4,   959,   988,   994,   962,     4,
+     954,   954,   994,   945,   945,   959,   959,   945,   962,   962,
+     945,   945,   954,   954,   945,   945,   954,   945,   994,   954,
+     954,   945,   945,   954,   954,   945,   954,   945,   945,     4,
+     954,   954,   954,     4,   954,     4,   954,   954,   199,     4,
+       7,     4,     4,     4,     4,     4,     4,     4,     4,   660,
+     202,   650,   410,   666,   468,   913,   944,   967,   462,   939,
+     957,   965,   751,   200,   200,   512,   975,   945,   947,   200,
+     199,   199,   994,   956,  1154,   948,   202,   200,   202,   200,
+     950,   200,   504,   199,   199,   199,   951,  1109,   480,   953,
+     509,   996,   994,   964,   483,  1159,   962,   722,   979,   960,
+     985,   702,   665,   494,   529,   531,  1172,   535,   661,  1196,
+    1225,    -1,    -1,   989,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,  1154,    -1,    -1,    -1,    -1,  1159,
+      -1,    -1,    -1,    -1,    -1,    -1,  1159,    -1,    -1,    -1,
+    1154,    -1,  1172,    -1,    -1,  1159,    -1,    -1,    -1,    -1,
+    1154,  1154,  1154,    -1,    -1,  1159,    -1,  1154,  1172,    -1,
+      -1,    -1,  1154,    -1,    -1,    -1,    -1,  1159,  1172,    -1,
+      -1,    -1,  1154,    -1,    -1,  1154,    -1,  1154,  1154,    -1,
+    1172,    -1,  1154,  1159,    -1,  1154,    -1,    -1,  1154,    -1,
+    1154,    -1,    -1,    -1,    -1,  1159,    -1,    -1,    -1,    -1,
+    1154,  1154,    -1,    -1,    -1,  1159,  1159,    -1,    -1,    -1,
+      -1,    -1,  1154,  1154,    -1,    -1,  1154,    -1,    -1,  1154,
+    1154,    -1,    -1,  1154,  1154,    -1,  1154,    -1,    -1,    -1,
+    1154,  1154,  1154,    -1,  1154,    -1,  1154,  1154
   };
 
   const unsigned short
   Dhcp4Parser::yystos_[] =
   {
-       0,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   180,   181,   182,   183,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-       0,     5,     7,     9,   184,   185,   186,   187,   204,   205,
-     206,   211,     7,   220,     7,   226,     7,   262,     7,   360,
-       7,   440,     7,   456,     7,   392,     7,   398,     7,   422,
-       7,   336,     7,   521,     7,   567,     7,   558,   212,   207,
-     221,   227,   263,   361,   441,   457,   393,   399,   423,   337,
-     522,   568,   559,   204,   213,   214,   184,   209,   210,    10,
-     157,   167,   168,   169,   184,   219,   222,   223,   224,   550,
-     552,   554,   565,    11,    14,    23,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    77,    78,    88,    91,    92,    96,   101,   102,
-     107,   117,   120,   127,   128,   131,   135,   155,   156,   158,
-     219,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   241,   242,   243,   244,   245,   246,   247,
-     250,   252,   254,   256,   258,   273,   275,   281,   283,   321,
-     330,   344,   354,   378,   382,   390,   416,   446,   448,   450,
-     461,   463,   465,   488,   500,   501,   509,   519,   556,   571,
-      15,    16,    19,    22,   219,   260,   261,   264,   266,   269,
-     272,   446,   448,    74,    75,    76,    89,    93,    94,    95,
-     103,   106,   114,   219,   230,   231,   232,   233,   234,   235,
-     236,   237,   242,   243,   244,   245,   246,   247,   250,   252,
-     254,   256,   362,   363,   364,   366,   368,   370,   372,   374,
-     376,   378,   381,   416,   434,   446,   448,   450,   461,   463,
-     465,   485,    90,   219,   374,   376,   416,   442,   443,   444,
-     446,   448,   102,   108,   109,   110,   111,   112,   113,   115,
-     219,   416,   446,   448,   458,   459,   460,   461,   463,   465,
-     467,   471,   473,   475,   477,   479,   481,   483,   390,    34,
-      79,    81,    82,    85,    86,    87,   219,   301,   400,   401,
-     402,   403,   404,   405,   406,   408,   410,   412,   413,   415,
-     446,   448,    80,    83,    84,   219,   301,   404,   410,   424,
-     425,   426,   427,   428,   430,   431,   432,   433,   446,   448,
-     118,   119,   219,   338,   339,   340,   342,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     155,   156,   219,   446,   448,   523,   524,   525,   526,   528,
-     529,   531,   532,   533,   536,   538,   540,   541,   542,   544,
-     546,   548,   569,   570,   571,    12,    13,   560,   561,   562,
-     564,     6,     3,     4,     8,     3,   225,   566,   551,   553,
-     555,     4,     3,     8,   557,   259,   276,     4,     4,     4,
-     462,   464,   466,   274,   282,   284,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   240,     4,     4,     4,   248,
-     251,   253,   355,   391,   417,   383,   447,   449,   379,   322,
-     489,   451,   331,   345,     4,   502,   510,   520,   255,   257,
-     572,     3,     8,   265,   267,   270,     4,     3,     8,   367,
-     369,   371,   435,   365,   373,     4,   377,   375,   486,     3,
-       8,   445,     3,     8,   484,   472,   474,   478,   476,   482,
-     480,   468,     8,     3,     8,   407,   302,     4,   411,   409,
-     414,     4,     8,     3,   429,     4,     4,     8,     3,   341,
-     343,     3,     8,     4,   539,   527,     4,   530,     4,     4,
-     534,   537,     4,     4,   543,   545,   547,   549,     3,     8,
-       3,     8,   563,     4,     3,     8,   204,   204,   184,     4,
-       4,     4,     4,     4,   223,     4,     4,     4,   187,   187,
-     187,     4,     4,     4,     4,     4,     4,   185,   185,   185,
-     185,   185,   187,   186,   186,   185,     4,   187,   187,   187,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   185,     4,     4,     4,     4,
-       4,     4,   229,     4,     4,     4,   187,   261,     4,     4,
-       4,     4,     4,     4,   185,     4,     4,     4,   363,     4,
-     443,     4,     4,     4,     4,     4,     4,     4,     4,   460,
-       4,     4,   185,     4,     4,     4,   187,   402,     4,   187,
-     187,   426,     4,     4,   339,   187,     4,     4,   185,     4,
-     185,   185,     4,     4,   187,   187,     4,     4,     4,     4,
-     524,   570,     4,   185,   561,     4,     7,     7,   204,   204,
-     204,     7,     7,     7,   184,   184,   184,     7,     7,     5,
-     184,   151,   152,   153,   154,   187,   249,   184,   184,     5,
-       5,     5,     5,   206,   208,   184,    97,    98,    99,   100,
-     380,     5,     5,     5,     5,     7,     7,     7,     7,   184,
-     184,     5,     5,   215,    17,    18,   268,    20,    21,   271,
-     184,   184,   184,     5,   184,   184,   215,   184,     7,   184,
-     215,   184,   184,   184,   184,   184,   184,   184,   184,   184,
-     184,   184,   184,   184,   184,   204,   184,   184,   184,    18,
-     149,   535,   150,   249,   184,   184,   184,     5,   204,   228,
-     569,   560,   260,    24,   277,   278,   279,    34,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,   219,   289,   290,   291,
-     294,   296,   298,   300,   301,   303,   304,   305,   306,   307,
-     308,   309,   310,   312,   314,   316,   318,   319,   320,   289,
-       7,   285,   286,   287,     7,   356,   357,   358,     7,   394,
-     395,   396,     7,   418,   419,   420,     7,   384,   385,   386,
-     108,   109,   110,   111,   113,   323,   324,   325,   326,   327,
-     328,   329,     7,   490,   491,     7,   452,   453,   454,     7,
-     332,   333,   334,   121,   122,   123,   124,   125,   126,   346,
-     347,   348,   349,   350,   351,   352,   353,   129,   130,   219,
-     446,   448,   503,   504,   505,   507,   132,   133,   134,   184,
-     446,   448,   511,   512,   513,   514,   516,   517,   523,     7,
-     573,   574,   216,     7,   436,   437,   438,   116,   467,   469,
-     487,   285,     8,     8,     8,     8,   280,     3,     8,   292,
-     295,   297,   299,     4,     4,     4,     4,     4,   311,   313,
-     315,   317,     4,     4,     4,     4,     4,     4,     3,     8,
-       8,   288,     6,     3,   359,     6,     3,   397,     6,     3,
-     421,     6,     3,   387,     6,     3,     3,     6,   492,     3,
-       6,   455,     6,     3,   335,     6,     3,     4,     4,     4,
-       4,     4,     4,     3,     8,   506,   508,     3,     8,     4,
-     515,     4,   518,     3,     8,     8,   575,     3,     6,   184,
-     217,   218,   439,     6,     3,   470,     8,     6,     4,   278,
-       4,     4,     4,     4,   185,   187,   185,   187,   185,     4,
-       4,     4,     4,   185,   185,   185,   185,   187,   185,   290,
-     289,   287,   362,   358,   400,   396,   424,   420,   219,   230,
-     231,   232,   233,   234,   235,   236,   237,   242,   243,   244,
-     245,   246,   247,   250,   252,   254,   256,   301,   354,   372,
-     374,   376,   378,   388,   389,   416,   446,   448,   461,   463,
-     465,   485,   386,   324,   104,   105,   219,   301,   390,   416,
-     446,   448,   461,   463,   465,   493,   494,   495,   496,   497,
-     499,   491,   458,   454,   338,   334,   185,   185,   185,   185,
-     185,   185,   347,     4,     4,   504,   187,     4,   185,     4,
-     512,   159,   161,   162,   219,   301,   446,   448,   576,   577,
-     578,   579,   581,   574,     6,     3,   442,   438,     4,   184,
-      35,    36,    37,    38,   293,   184,   184,   184,   184,   184,
-     184,   184,     8,     8,     8,     8,     3,     8,   498,     4,
-       8,     3,     8,     8,   184,   184,   184,   204,   582,     4,
-     580,     3,     8,   184,     8,   215,   389,     4,   187,   495,
-       4,   185,     4,   577,   184,     5,   184,     7,   583,   584,
-     585,     3,     6,   160,   163,   164,   165,   166,   586,   587,
-     588,   590,   591,   592,   593,   584,   589,     4,     4,     4,
-     594,     3,     8,     4,   187,   185,   185,     4,   587,   184,
-     184
+       0,   185,   186,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+       0,     5,     7,     9,   199,   200,   201,   202,   219,   220,
+     221,   226,     7,   235,     7,   241,     7,   279,     7,   385,
+       7,   465,     7,   481,     7,   417,     7,   423,     7,   447,
+       7,   360,     7,   547,     7,   593,     7,   584,   227,   222,
+     236,   242,   280,   386,   466,   482,   418,   424,   448,   361,
+     548,   594,   585,   219,   228,   229,   199,   224,   225,    10,
+     166,   182,   183,   184,   199,   234,   237,   238,   239,   576,
+     578,   580,   591,    11,    14,    23,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    84,    85,    95,    98,    99,   103,
+     108,   109,   114,   124,   127,   135,   136,   137,   140,   144,
+     164,   165,   167,   234,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254,   255,   256,   258,   259,
+     260,   261,   262,   263,   264,   267,   269,   271,   273,   275,
+     290,   292,   298,   300,   345,   354,   368,   379,   403,   407,
+     415,   441,   471,   473,   475,   486,   488,   490,   513,   525,
+     526,   527,   535,   545,   582,   597,    15,    16,    19,    22,
+     234,   277,   278,   281,   283,   286,   289,   471,   473,    81,
+      82,    83,    96,   100,   101,   102,   110,   113,   121,   234,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     259,   260,   261,   262,   263,   264,   267,   269,   271,   273,
+     387,   388,   389,   391,   393,   395,   397,   399,   401,   403,
+     406,   441,   459,   471,   473,   475,   486,   488,   490,   510,
+      97,   234,   399,   401,   441,   467,   468,   469,   471,   473,
+     109,   115,   116,   117,   118,   119,   120,   122,   234,   441,
+     471,   473,   483,   484,   485,   486,   488,   490,   492,   496,
+     498,   500,   502,   504,   506,   508,   415,    34,    86,    88,
+      89,    92,    93,    94,   234,   318,   425,   426,   427,   428,
+     429,   430,   431,   433,   435,   437,   438,   440,   471,   473,
+      87,    90,    91,   234,   318,   429,   435,   449,   450,   451,
+     452,   453,   455,   456,   457,   458,   471,   473,   125,   126,
+     234,   362,   363,   364,   366,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   164,   165,
+     234,   471,   473,   549,   550,   551,   552,   554,   555,   557,
+     558,   559,   562,   564,   566,   567,   568,   570,   572,   574,
+     595,   596,   597,    12,    13,   586,   587,   588,   590,     6,
+       3,     4,     8,     3,   240,   592,   577,   579,   581,     4,
+       3,     8,   583,   276,   293,     4,     4,     4,   487,   489,
+     491,   291,   299,   301,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   257,     4,     4,     4,   265,
+     268,   270,   380,   416,   442,   408,   472,   474,   404,   346,
+     514,   476,   355,   369,     4,     4,   528,   536,   546,   272,
+     274,   598,     3,     8,   282,   284,   287,     4,     3,     8,
+     392,   394,   396,   460,   390,   398,     4,   402,   400,   511,
+       3,     8,   470,     3,     8,   509,   497,   499,   503,   501,
+     507,   505,   493,     8,     3,     8,   432,   319,     4,   436,
+     434,   439,     4,     8,     3,   454,     4,     4,     8,     3,
+     365,   367,     3,     8,     4,   565,   553,     4,   556,     4,
+       4,   560,   563,     4,     4,   569,   571,   573,   575,     3,
+       8,     3,     8,   589,     4,     3,     8,   219,   219,   199,
+       4,     4,     4,     4,     4,   238,     4,     4,     4,   202,
+     202,   202,     4,     4,     4,     4,     4,     4,   200,   200,
+     200,   200,   200,   202,   201,   201,   201,   200,   200,     4,
+     202,   202,   202,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,   200,   200,
+       4,     4,     4,     4,     4,     4,   244,     4,     4,     4,
+     202,   278,     4,     4,     4,     4,     4,     4,   200,     4,
+       4,     4,   388,     4,   468,     4,     4,     4,     4,     4,
+       4,     4,     4,   485,     4,     4,   200,     4,     4,     4,
+     202,   427,     4,   202,   202,   451,     4,     4,   363,   202,
+       4,     4,   200,     4,   200,   200,     4,     4,   202,   202,
+       4,     4,     4,     4,   550,   596,     4,   200,   587,     4,
+       7,     7,   219,   219,   219,     7,     7,     7,   199,   199,
+     199,     7,     7,     5,   199,   160,   161,   162,   163,   202,
+     266,   199,   199,     5,     5,     5,     5,   221,   223,   199,
+     104,   105,   106,   107,   405,     5,     5,     5,     5,     7,
+       7,     7,     7,   199,   199,     5,     5,   230,    17,    18,
+     285,    20,    21,   288,   199,   199,   199,     5,   199,   199,
+     230,   199,     7,   199,   230,   199,   199,   199,   199,   199,
+     199,   199,   199,   199,   199,   199,   199,   199,   199,   219,
+     199,   199,   199,    18,   158,   561,   159,   266,   199,   199,
+     199,     5,   219,   243,   595,   586,   277,    24,   294,   295,
+     296,    34,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,   234,   306,   307,   308,   311,
+     313,   315,   317,   318,   320,   321,   322,   323,   324,   325,
+     327,   329,   330,   331,   332,   333,   334,   336,   338,   340,
+     342,   343,   344,   306,     7,   302,   303,   304,     7,   381,
+     382,   383,     7,   419,   420,   421,     7,   443,   444,   445,
+       7,   409,   410,   411,   115,   116,   117,   118,   120,   347,
+     348,   349,   350,   351,   352,   353,     7,   515,   516,     7,
+     477,   478,   479,     7,   356,   357,   358,   128,   129,   130,
+     131,   132,   133,   134,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   138,   139,   234,   471,   473,   529,   530,
+     531,   533,   141,   142,   143,   199,   471,   473,   537,   538,
+     539,   540,   542,   543,   549,     7,   599,   600,   231,     7,
+     461,   462,   463,   123,   492,   494,   512,   302,     8,     8,
+       8,     8,   297,     3,     8,   309,   312,   314,   316,     4,
+       4,     4,     4,     4,     4,   326,   328,     4,     4,   335,
+     337,   339,   341,     4,     4,     4,     4,     4,     4,     3,
+       8,     8,   305,     6,     3,   384,     6,     3,   422,     6,
+       3,   446,     6,     3,   412,     6,     3,     3,     6,   517,
+       3,     6,   480,     6,     3,   359,     6,     3,     4,     4,
+       4,     4,     4,     4,     4,     3,     8,   532,   534,     3,
+       8,     4,   541,     4,   544,     3,     8,     8,   601,     3,
+       6,   199,   232,   233,   464,     6,     3,   495,     8,     6,
+       4,   295,     4,     4,     4,     4,   200,   202,   200,   202,
+     202,   200,     4,     4,   202,   200,     4,     4,     4,     4,
+     200,   200,   200,   200,   202,   200,   307,   306,   304,   387,
+     383,   425,   421,   449,   445,   234,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254,   259,   260,   261,   262,
+     263,   264,   267,   269,   271,   273,   318,   379,   397,   399,
+     401,   403,   413,   414,   441,   471,   473,   486,   488,   490,
+     510,   411,   348,   111,   112,   234,   318,   415,   441,   471,
+     473,   486,   488,   490,   518,   519,   520,   521,   522,   524,
+     516,   483,   479,   362,   358,   200,   200,   200,   200,   200,
+     200,   202,   371,     4,     4,   530,   202,     4,   200,     4,
+     538,   168,   170,   171,   179,   180,   181,   234,   318,   471,
+     473,   602,   603,   604,   605,   607,   609,   610,   611,   600,
+       6,     3,   467,   463,     4,   199,    35,    36,    37,    38,
+     310,   199,   199,   199,   199,   199,   199,   199,   199,   199,
+       8,     8,     8,     8,     3,     8,   523,     4,     8,     3,
+       8,     8,   199,   199,   199,   219,   612,     4,   606,   608,
+       4,     4,     3,     8,   199,     8,   230,   414,     4,   202,
+     520,     4,   200,     4,     4,   200,   200,   603,   199,     5,
+     199,   230,     7,   613,   614,   615,     3,     6,   169,   172,
+     173,   174,   175,   176,   177,   178,   616,   617,   618,   620,
+     621,   622,   623,   625,   626,   627,   614,   619,     4,     4,
+       4,   624,     4,     4,   628,     3,     8,     4,   202,   200,
+     200,     4,   202,   200,     4,   617,   199,   199,   199
   };
 
   const unsigned short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   188,   190,   189,   191,   189,   192,   189,   193,   189,
-     194,   189,   195,   189,   196,   189,   197,   189,   198,   189,
-     199,   189,   200,   189,   201,   189,   202,   189,   203,   189,
-     204,   204,   204,   204,   204,   204,   204,   205,   207,   206,
-     208,   209,   209,   210,   210,   212,   211,   213,   213,   214,
-     214,   216,   215,   217,   217,   218,   218,   219,   221,   220,
-     222,   222,   223,   223,   223,   223,   223,   223,   225,   224,
-     227,   226,   228,   228,   229,   229,   229,   229,   229,   229,
-     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
-     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
-     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
-     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
-     229,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   240,   239,   241,   242,   243,   244,   245,   246,   248,
-     247,   249,   249,   249,   249,   249,   251,   250,   253,   252,
-     255,   254,   257,   256,   259,   258,   260,   260,   261,   261,
-     261,   261,   261,   261,   261,   263,   262,   265,   264,   267,
-     266,   268,   268,   270,   269,   271,   271,   272,   274,   273,
-     276,   275,   277,   277,   278,   280,   279,   282,   281,   284,
-     283,   285,   285,   286,   286,   288,   287,   289,   289,   290,
-     290,   290,   290,   290,   290,   290,   290,   290,   290,   290,
-     290,   290,   290,   290,   290,   290,   290,   290,   290,   290,
-     292,   291,   293,   293,   293,   293,   295,   294,   297,   296,
-     299,   298,   300,   302,   301,   303,   304,   305,   306,   307,
-     308,   309,   311,   310,   313,   312,   315,   314,   317,   316,
-     318,   319,   320,   322,   321,   323,   323,   324,   324,   324,
-     324,   324,   325,   326,   327,   328,   329,   331,   330,   332,
-     332,   333,   333,   335,   334,   337,   336,   338,   338,   338,
-     339,   339,   341,   340,   343,   342,   345,   344,   346,   346,
-     347,   347,   347,   347,   347,   347,   348,   349,   350,   351,
-     352,   353,   355,   354,   356,   356,   357,   357,   359,   358,
-     361,   360,   362,   362,   363,   363,   363,   363,   363,   363,
-     363,   363,   363,   363,   363,   363,   363,   363,   363,   363,
-     363,   363,   363,   363,   363,   363,   363,   363,   363,   363,
-     363,   363,   363,   363,   363,   363,   363,   363,   363,   363,
-     363,   365,   364,   367,   366,   369,   368,   371,   370,   373,
-     372,   375,   374,   377,   376,   379,   378,   380,   380,   380,
-     380,   381,   383,   382,   384,   384,   385,   385,   387,   386,
-     388,   388,   389,   389,   389,   389,   389,   389,   389,   389,
-     389,   389,   389,   389,   389,   389,   389,   389,   389,   389,
-     389,   389,   389,   389,   389,   389,   389,   389,   389,   389,
-     389,   389,   389,   389,   391,   390,   393,   392,   394,   394,
-     395,   395,   397,   396,   399,   398,   400,   400,   401,   401,
-     402,   402,   402,   402,   402,   402,   402,   402,   402,   402,
-     403,   404,   405,   407,   406,   409,   408,   411,   410,   412,
-     414,   413,   415,   417,   416,   418,   418,   419,   419,   421,
-     420,   423,   422,   424,   424,   425,   425,   426,   426,   426,
-     426,   426,   426,   426,   426,   426,   427,   429,   428,   430,
-     431,   432,   433,   435,   434,   436,   436,   437,   437,   439,
-     438,   441,   440,   442,   442,   443,   443,   443,   443,   443,
-     443,   443,   445,   444,   447,   446,   449,   448,   451,   450,
-     452,   452,   453,   453,   455,   454,   457,   456,   458,   458,
-     459,   459,   460,   460,   460,   460,   460,   460,   460,   460,
-     460,   460,   460,   460,   460,   460,   460,   462,   461,   464,
-     463,   466,   465,   468,   467,   470,   469,   472,   471,   474,
-     473,   476,   475,   478,   477,   480,   479,   482,   481,   484,
-     483,   486,   485,   487,   487,   489,   488,   490,   490,   492,
-     491,   493,   493,   494,   494,   495,   495,   495,   495,   495,
-     495,   495,   495,   495,   495,   495,   496,   498,   497,   499,
-     500,   502,   501,   503,   503,   504,   504,   504,   504,   504,
-     506,   505,   508,   507,   510,   509,   511,   511,   512,   512,
-     512,   512,   512,   512,   513,   515,   514,   516,   518,   517,
-     520,   519,   522,   521,   523,   523,   524,   524,   524,   524,
-     524,   524,   524,   524,   524,   524,   524,   524,   524,   524,
-     524,   524,   524,   524,   525,   527,   526,   528,   530,   529,
-     531,   532,   534,   533,   535,   535,   537,   536,   539,   538,
-     540,   541,   543,   542,   545,   544,   547,   546,   549,   548,
-     551,   550,   553,   552,   555,   554,   557,   556,   559,   558,
-     560,   560,   561,   561,   563,   562,   564,   566,   565,   568,
-     567,   569,   569,   570,   572,   571,   573,   573,   575,   574,
-     576,   576,   577,   577,   577,   577,   577,   577,   577,   578,
-     580,   579,   582,   581,   583,   583,   585,   584,   586,   586,
-     587,   587,   587,   587,   587,   589,   588,   590,   591,   592,
-     594,   593
+       0,   203,   205,   204,   206,   204,   207,   204,   208,   204,
+     209,   204,   210,   204,   211,   204,   212,   204,   213,   204,
+     214,   204,   215,   204,   216,   204,   217,   204,   218,   204,
+     219,   219,   219,   219,   219,   219,   219,   220,   222,   221,
+     223,   224,   224,   225,   225,   227,   226,   228,   228,   229,
+     229,   231,   230,   232,   232,   233,   233,   234,   236,   235,
+     237,   237,   238,   238,   238,   238,   238,   238,   240,   239,
+     242,   241,   243,   243,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   257,   256,   258,   259,
+     260,   261,   262,   263,   265,   264,   266,   266,   266,   266,
+     266,   268,   267,   270,   269,   272,   271,   274,   273,   276,
+     275,   277,   277,   278,   278,   278,   278,   278,   278,   278,
+     280,   279,   282,   281,   284,   283,   285,   285,   287,   286,
+     288,   288,   289,   291,   290,   293,   292,   294,   294,   295,
+     297,   296,   299,   298,   301,   300,   302,   302,   303,   303,
+     305,   304,   306,   306,   307,   307,   307,   307,   307,   307,
+     307,   307,   307,   307,   307,   307,   307,   307,   307,   307,
+     307,   307,   307,   307,   307,   307,   307,   307,   307,   307,
+     309,   308,   310,   310,   310,   310,   312,   311,   314,   313,
+     316,   315,   317,   319,   318,   320,   321,   322,   323,   324,
+     326,   325,   328,   327,   329,   330,   331,   332,   333,   335,
+     334,   337,   336,   339,   338,   341,   340,   342,   343,   344,
+     346,   345,   347,   347,   348,   348,   348,   348,   348,   349,
+     350,   351,   352,   353,   355,   354,   356,   356,   357,   357,
+     359,   358,   361,   360,   362,   362,   362,   363,   363,   365,
+     364,   367,   366,   369,   368,   370,   370,   371,   371,   371,
+     371,   371,   371,   371,   372,   373,   374,   375,   376,   377,
+     378,   380,   379,   381,   381,   382,   382,   384,   383,   386,
+     385,   387,   387,   388,   388,   388,   388,   388,   388,   388,
+     388,   388,   388,   388,   388,   388,   388,   388,   388,   388,
+     388,   388,   388,   388,   388,   388,   388,   388,   388,   388,
+     388,   388,   388,   388,   388,   388,   388,   388,   388,   388,
+     388,   388,   390,   389,   392,   391,   394,   393,   396,   395,
+     398,   397,   400,   399,   402,   401,   404,   403,   405,   405,
+     405,   405,   406,   408,   407,   409,   409,   410,   410,   412,
+     411,   413,   413,   414,   414,   414,   414,   414,   414,   414,
+     414,   414,   414,   414,   414,   414,   414,   414,   414,   414,
+     414,   414,   414,   414,   414,   414,   414,   414,   414,   414,
+     414,   414,   414,   414,   414,   414,   414,   416,   415,   418,
+     417,   419,   419,   420,   420,   422,   421,   424,   423,   425,
+     425,   426,   426,   427,   427,   427,   427,   427,   427,   427,
+     427,   427,   427,   428,   429,   430,   432,   431,   434,   433,
+     436,   435,   437,   439,   438,   440,   442,   441,   443,   443,
+     444,   444,   446,   445,   448,   447,   449,   449,   450,   450,
+     451,   451,   451,   451,   451,   451,   451,   451,   451,   452,
+     454,   453,   455,   456,   457,   458,   460,   459,   461,   461,
+     462,   462,   464,   463,   466,   465,   467,   467,   468,   468,
+     468,   468,   468,   468,   468,   470,   469,   472,   471,   474,
+     473,   476,   475,   477,   477,   478,   478,   480,   479,   482,
+     481,   483,   483,   484,   484,   485,   485,   485,   485,   485,
+     485,   485,   485,   485,   485,   485,   485,   485,   485,   485,
+     487,   486,   489,   488,   491,   490,   493,   492,   495,   494,
+     497,   496,   499,   498,   501,   500,   503,   502,   505,   504,
+     507,   506,   509,   508,   511,   510,   512,   512,   514,   513,
+     515,   515,   517,   516,   518,   518,   519,   519,   520,   520,
+     520,   520,   520,   520,   520,   520,   520,   520,   520,   521,
+     523,   522,   524,   525,   526,   528,   527,   529,   529,   530,
+     530,   530,   530,   530,   532,   531,   534,   533,   536,   535,
+     537,   537,   538,   538,   538,   538,   538,   538,   539,   541,
+     540,   542,   544,   543,   546,   545,   548,   547,   549,   549,
+     550,   550,   550,   550,   550,   550,   550,   550,   550,   550,
+     550,   550,   550,   550,   550,   550,   550,   550,   551,   553,
+     552,   554,   556,   555,   557,   558,   560,   559,   561,   561,
+     563,   562,   565,   564,   566,   567,   569,   568,   571,   570,
+     573,   572,   575,   574,   577,   576,   579,   578,   581,   580,
+     583,   582,   585,   584,   586,   586,   587,   587,   589,   588,
+     590,   592,   591,   594,   593,   595,   595,   596,   598,   597,
+     599,   599,   601,   600,   602,   602,   603,   603,   603,   603,
+     603,   603,   603,   603,   603,   603,   604,   606,   605,   608,
+     607,   609,   610,   612,   611,   613,   613,   615,   614,   616,
+     616,   617,   617,   617,   617,   617,   617,   617,   617,   619,
+     618,   620,   621,   622,   624,   623,   625,   626,   628,   627
   };
 
   const unsigned char
@@ -5003,68 +5207,71 @@ namespace isc { namespace dhcp {
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     0,     4,     3,     3,     3,     3,     3,     3,     0,
-       4,     1,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     1,     1,     0,     4,     1,     1,     3,     0,     6,
-       0,     6,     1,     3,     1,     0,     4,     0,     6,     0,
-       6,     0,     1,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     0,     4,     3,     3,
+       3,     3,     3,     3,     0,     4,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       6,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     1,     1,     0,     4,
+       1,     1,     3,     0,     6,     0,     6,     1,     3,     1,
+       0,     4,     0,     6,     0,     6,     0,     1,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        0,     4,     1,     1,     1,     1,     0,     4,     0,     4,
        0,     4,     3,     0,     4,     3,     3,     3,     3,     3,
-       3,     3,     0,     4,     0,     4,     0,     4,     0,     4,
-       3,     3,     3,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     3,     3,     3,     3,     3,     0,
+       4,     0,     4,     0,     4,     0,     4,     3,     3,     3,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     0,
+       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     1,     1,     1,
-       1,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     1,     1,
+       1,     1,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     6,     0,     4,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     6,     0,
+       4,     0,     1,     1,     3,     0,     4,     0,     4,     0,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     0,     4,     0,     4,
+       0,     4,     1,     0,     4,     3,     0,     6,     0,     1,
        1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     1,     0,     4,     0,     4,     0,     4,     1,
-       0,     4,     3,     0,     6,     0,     1,     1,     3,     0,
-       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
-       1,     3,     3,     0,     6,     0,     1,     1,     3,     0,
-       4,     0,     4,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     6,     1,     1,     0,     6,     1,     3,     0,
+       0,     4,     1,     1,     3,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       4,     0,     6,     0,     1,     1,     3,     0,     4,     0,
        4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
-       3,     0,     6,     1,     3,     1,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
-       1,     1,     1,     1,     3,     0,     4,     3,     0,     4,
-       0,     6,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     0,     4,     3,     0,     4,
-       3,     3,     0,     4,     1,     1,     0,     4,     0,     4,
-       3,     3,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     6,     0,     4,
-       1,     3,     1,     1,     0,     6,     3,     0,     6,     0,
-       4,     1,     3,     1,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     3,
-       0,     4,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     0,     4,     3,     3,     3,
-       0,     4
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     6,     1,     1,     0,     6,
+       1,     3,     0,     4,     0,     1,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     3,     3,     3,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     0,     4,     0,     4,     0,     6,
+       1,     3,     1,     1,     1,     1,     1,     1,     3,     0,
+       4,     3,     0,     4,     0,     6,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     0,
+       4,     3,     0,     4,     3,     3,     0,     4,     1,     1,
+       0,     4,     0,     4,     3,     3,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     6,     0,     4,     1,     3,     1,     1,     0,     6,
+       3,     0,     6,     0,     4,     1,     3,     1,     0,     6,
+       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     0,     4,     0,
+       4,     3,     3,     0,     6,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     3,     3,     0,     4,     3,     3,     0,     4
   };
 
 
@@ -5086,13 +5293,16 @@ namespace isc { namespace dhcp {
   "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
   "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
   "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
-  "\"consistency\"", "\"serial-consistency\"", "\"max-reconnect-tries\"",
+  "\"write-behind-cache\"", "\"write-back-latency\"", "\"cache-journal\"",
+  "\"read-replicas\"", "\"allocate-or-renew\"", "\"connect-timeout\"",
+  "\"contact-points\"", "\"keyspace\"", "\"consistency\"",
+  "\"serial-consistency\"", "\"max-reconnect-tries\"",
   "\"reconnect-wait-time\"", "\"request-timeout\"", "\"tcp-keepalive\"",
   "\"tcp-nodelay\"", "\"max-row-errors\"", "\"valid-lifetime\"",
   "\"min-valid-lifetime\"", "\"max-valid-lifetime\"", "\"renew-timer\"",
   "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
-  "\"t2-percent\"", "\"decline-probation-period\"", "\"server-tag\"",
+  "\"t2-percent\"", "\"cache-threshold\"", "\"cache-max-age\"",
+  "\"decline-probation-period\"", "\"server-tag\"",
   "\"ddns-send-updates\"", "\"ddns-override-no-update\"",
   "\"ddns-override-client-update\"", "\"ddns-replace-client-name\"",
   "\"ddns-generated-prefix\"", "\"ddns-qualifying-suffix\"", "\"subnet4\"",
@@ -5112,7 +5322,8 @@ namespace isc { namespace dhcp {
   "\"reclaim-timer-wait-time\"", "\"flush-reclaimed-timer-wait-time\"",
   "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
   "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"",
-  "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
+  "\"background-reclamation\"", "\"dhcp4o6-port\"",
+  "\"lease-query-threads\"", "\"control-socket\"", "\"socket-type\"",
   "\"socket-name\"", "\"dhcp-queue-control\"", "\"enable-queue\"",
   "\"queue-type\"", "\"capacity\"", "\"dhcp-ddns\"", "\"enable-updates\"",
   "\"qualifying-suffix\"", "\"server-ip\"", "\"server-port\"",
@@ -5124,6 +5335,8 @@ namespace isc { namespace dhcp {
   "\"hostname-char-set\"", "\"hostname-char-replacement\"", "\"Logging\"",
   "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
   "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"pattern\"",
+  "\"async\"", "\"async-queue-size\"", "\"async-overflow\"",
+  "\"rate-limited-messages\"", "\"rate-limit\"", "\"rate-limit-interval\"",
   "\"Dhcp6\"", "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON",
   "TOPLEVEL_DHCP4", "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4",
   "SUB_POOL4", "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
@@ -5139,174 +5352,182 @@ namespace isc { namespace dhcp {
   "$@20", "global_params", "global_param", "valid_lifetime",
   "min_valid_lifetime", "max_valid_lifetime", "renew_timer",
   "rebind_timer", "calculate_tee_times", "t1_percent", "t2_percent",
-  "decline_probation_period", "server_tag", "$@21", "echo_client_id",
-  "match_client_id", "authoritative", "ddns_send_updates",
-  "ddns_override_no_update", "ddns_override_client_update",
-  "ddns_replace_client_name", "$@22", "ddns_replace_client_name_value",
-  "ddns_generated_prefix", "$@23", "ddns_qualifying_suffix", "$@24",
-  "hostname_char_set", "$@25", "hostname_char_replacement", "$@26",
-  "interfaces_config", "$@27", "interfaces_config_params",
-  "interfaces_config_param", "sub_interfaces4", "$@28", "interfaces_list",
-  "$@29", "dhcp_socket_type", "$@30", "socket_type", "outbound_interface",
-  "$@31", "outbound_interface_value", "re_detect", "lease_database",
-  "$@32", "sanity_checks", "$@33", "sanity_checks_params",
-  "sanity_checks_param", "lease_checks", "$@34", "hosts_database", "$@35",
-  "hosts_databases", "$@36", "database_list", "not_empty_database_list",
-  "database", "$@37", "database_map_params", "database_map_param",
-  "database_type", "$@38", "db_type", "user", "$@39", "password", "$@40",
-  "host", "$@41", "port", "name", "$@42", "persist", "lfc_interval",
-  "readonly", "connect_timeout", "request_timeout", "tcp_keepalive",
-  "tcp_nodelay", "contact_points", "$@43", "keyspace", "$@44",
-  "consistency", "$@45", "serial_consistency", "$@46",
-  "max_reconnect_tries", "reconnect_wait_time", "max_row_errors",
-  "host_reservation_identifiers", "$@47",
-  "host_reservation_identifiers_list", "host_reservation_identifier",
-  "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
-  "hooks_libraries", "$@48", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@49",
-  "sub_hooks_library", "$@50", "hooks_params", "hooks_param", "library",
-  "$@51", "parameters", "$@52", "expired_leases_processing", "$@53",
-  "expired_leases_params", "expired_leases_param",
-  "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
-  "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@54",
-  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@55",
-  "sub_subnet4", "$@56", "subnet4_params", "subnet4_param", "subnet",
-  "$@57", "subnet_4o6_interface", "$@58", "subnet_4o6_interface_id",
-  "$@59", "subnet_4o6_subnet", "$@60", "interface", "$@61", "client_class",
-  "$@62", "require_client_classes", "$@63", "reservation_mode", "$@64",
-  "hr_mode", "id", "shared_networks", "$@65", "shared_networks_content",
-  "shared_networks_list", "shared_network", "$@66",
+  "cache_threshold", "cache_max_age", "decline_probation_period",
+  "server_tag", "$@21", "echo_client_id", "match_client_id",
+  "authoritative", "ddns_send_updates", "ddns_override_no_update",
+  "ddns_override_client_update", "ddns_replace_client_name", "$@22",
+  "ddns_replace_client_name_value", "ddns_generated_prefix", "$@23",
+  "ddns_qualifying_suffix", "$@24", "hostname_char_set", "$@25",
+  "hostname_char_replacement", "$@26", "interfaces_config", "$@27",
+  "interfaces_config_params", "interfaces_config_param", "sub_interfaces4",
+  "$@28", "interfaces_list", "$@29", "dhcp_socket_type", "$@30",
+  "socket_type", "outbound_interface", "$@31", "outbound_interface_value",
+  "re_detect", "lease_database", "$@32", "sanity_checks", "$@33",
+  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@34",
+  "hosts_database", "$@35", "hosts_databases", "$@36", "database_list",
+  "not_empty_database_list", "database", "$@37", "database_map_params",
+  "database_map_param", "database_type", "$@38", "db_type", "user", "$@39",
+  "password", "$@40", "host", "$@41", "port", "name", "$@42", "persist",
+  "lfc_interval", "readonly", "write_behind_cache", "write_back_latency",
+  "cache_journal", "$@43", "read_replicas", "$@44", "allocate_or_renew",
+  "connect_timeout", "request_timeout", "tcp_keepalive", "tcp_nodelay",
+  "contact_points", "$@45", "keyspace", "$@46", "consistency", "$@47",
+  "serial_consistency", "$@48", "max_reconnect_tries",
+  "reconnect_wait_time", "max_row_errors", "host_reservation_identifiers",
+  "$@49", "host_reservation_identifiers_list",
+  "host_reservation_identifier", "duid_id", "hw_address_id", "circuit_id",
+  "client_id", "flex_id", "hooks_libraries", "$@50",
+  "hooks_libraries_list", "not_empty_hooks_libraries_list",
+  "hooks_library", "$@51", "sub_hooks_library", "$@52", "hooks_params",
+  "hooks_param", "library", "$@53", "parameters", "$@54",
+  "expired_leases_processing", "$@55", "expired_leases_params",
+  "expired_leases_param", "reclaim_timer_wait_time",
+  "flush_reclaimed_timer_wait_time", "hold_reclaimed_time",
+  "max_reclaim_leases", "max_reclaim_time", "unwarned_reclaim_cycles",
+  "background_reclamation", "subnet4_list", "$@56", "subnet4_list_content",
+  "not_empty_subnet4_list", "subnet4", "$@57", "sub_subnet4", "$@58",
+  "subnet4_params", "subnet4_param", "subnet", "$@59",
+  "subnet_4o6_interface", "$@60", "subnet_4o6_interface_id", "$@61",
+  "subnet_4o6_subnet", "$@62", "interface", "$@63", "client_class", "$@64",
+  "require_client_classes", "$@65", "reservation_mode", "$@66", "hr_mode",
+  "id", "shared_networks", "$@67", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@68",
   "shared_network_params", "shared_network_param", "option_def_list",
-  "$@67", "sub_option_def_list", "$@68", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@69",
-  "sub_option_def", "$@70", "option_def_params",
+  "$@69", "sub_option_def_list", "$@70", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@71",
+  "sub_option_def", "$@72", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@71",
-  "option_def_record_types", "$@72", "space", "$@73", "option_def_space",
-  "option_def_encapsulate", "$@74", "option_def_array", "option_data_list",
-  "$@75", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@76", "sub_option_data", "$@77",
+  "code", "option_def_code", "option_def_type", "$@73",
+  "option_def_record_types", "$@74", "space", "$@75", "option_def_space",
+  "option_def_encapsulate", "$@76", "option_def_array", "option_data_list",
+  "$@77", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@78", "sub_option_data", "$@79",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@78",
+  "option_data_param", "option_data_name", "option_data_data", "$@80",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@79", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@80", "sub_pool4", "$@81",
-  "pool_params", "pool_param", "pool_entry", "$@82", "user_context",
-  "$@83", "comment", "$@84", "reservations", "$@85", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@86", "sub_reservation",
-  "$@87", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@88", "server_hostname", "$@89",
-  "boot_file_name", "$@90", "ip_address", "$@91", "ip_addresses", "$@92",
-  "duid", "$@93", "hw_address", "$@94", "client_id_value", "$@95",
-  "circuit_id_value", "$@96", "flex_id_value", "$@97", "hostname", "$@98",
-  "reservation_client_classes", "$@99", "relay", "$@100", "relay_map",
-  "client_classes", "$@101", "client_classes_list", "client_class_entry",
-  "$@102", "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@103",
-  "only_if_required", "dhcp4o6_port", "control_socket", "$@104",
-  "control_socket_params", "control_socket_param", "control_socket_type",
-  "$@105", "control_socket_name", "$@106", "dhcp_queue_control", "$@107",
+  "option_data_always_send", "pools_list", "$@81", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@82", "sub_pool4", "$@83",
+  "pool_params", "pool_param", "pool_entry", "$@84", "user_context",
+  "$@85", "comment", "$@86", "reservations", "$@87", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@88", "sub_reservation",
+  "$@89", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@90", "server_hostname", "$@91",
+  "boot_file_name", "$@92", "ip_address", "$@93", "ip_addresses", "$@94",
+  "duid", "$@95", "hw_address", "$@96", "client_id_value", "$@97",
+  "circuit_id_value", "$@98", "flex_id_value", "$@99", "hostname", "$@100",
+  "reservation_client_classes", "$@101", "relay", "$@102", "relay_map",
+  "client_classes", "$@103", "client_classes_list", "client_class_entry",
+  "$@104", "client_class_params", "not_empty_client_class_params",
+  "client_class_param", "client_class_name", "client_class_test", "$@105",
+  "only_if_required", "dhcp4o6_port", "lease_query_threads",
+  "control_socket", "$@106", "control_socket_params",
+  "control_socket_param", "control_socket_type", "$@107",
+  "control_socket_name", "$@108", "dhcp_queue_control", "$@109",
   "queue_control_params", "queue_control_param", "enable_queue",
-  "queue_type", "$@108", "capacity", "arbitrary_map_entry", "$@109",
-  "dhcp_ddns", "$@110", "sub_dhcp_ddns", "$@111", "dhcp_ddns_params",
-  "dhcp_ddns_param", "enable_updates", "server_ip", "$@112", "server_port",
-  "sender_ip", "$@113", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@114", "ncr_protocol_value", "ncr_format", "$@115",
-  "dep_qualifying_suffix", "$@116", "dep_override_no_update",
-  "dep_override_client_update", "dep_replace_client_name", "$@117",
-  "dep_generated_prefix", "$@118", "dep_hostname_char_set", "$@119",
-  "dep_hostname_char_replacement", "$@120", "dhcp6_json_object", "$@121",
-  "dhcpddns_json_object", "$@122", "control_agent_json_object", "$@123",
-  "config_control", "$@124", "sub_config_control", "$@125",
+  "queue_type", "$@110", "capacity", "arbitrary_map_entry", "$@111",
+  "dhcp_ddns", "$@112", "sub_dhcp_ddns", "$@113", "dhcp_ddns_params",
+  "dhcp_ddns_param", "enable_updates", "server_ip", "$@114", "server_port",
+  "sender_ip", "$@115", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@116", "ncr_protocol_value", "ncr_format", "$@117",
+  "dep_qualifying_suffix", "$@118", "dep_override_no_update",
+  "dep_override_client_update", "dep_replace_client_name", "$@119",
+  "dep_generated_prefix", "$@120", "dep_hostname_char_set", "$@121",
+  "dep_hostname_char_replacement", "$@122", "dhcp6_json_object", "$@123",
+  "dhcpddns_json_object", "$@124", "control_agent_json_object", "$@125",
+  "config_control", "$@126", "sub_config_control", "$@127",
   "config_control_params", "config_control_param", "config_databases",
-  "$@126", "config_fetch_wait_time", "logging_object", "$@127",
-  "sub_logging", "$@128", "logging_params", "logging_param", "loggers",
-  "$@129", "loggers_entries", "logger_entry", "$@130", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@131", "output_options_list",
-  "$@132", "output_options_list_content", "output_entry", "$@133",
-  "output_params_list", "output_params", "output", "$@134", "flush",
-  "maxsize", "maxver", "pattern", "$@135", YY_NULLPTR
+  "$@128", "config_fetch_wait_time", "logging_object", "$@129",
+  "sub_logging", "$@130", "logging_params", "logging_param", "loggers",
+  "$@131", "loggers_entries", "logger_entry", "$@132", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@133",
+  "rate_limited_messages", "$@134", "rate_limit", "rate_limit_interval",
+  "output_options_list", "$@135", "output_options_list_content",
+  "output_entry", "$@136", "output_params_list", "output_params", "output",
+  "$@137", "flush", "maxsize", "maxver", "pattern", "$@138", "async",
+  "async_queue_size", "async_overflow", "$@139", YY_NULLPTR
   };
 
 #if PARSER4_DEBUG
   const unsigned short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   275,   275,   275,   276,   276,   277,   277,   278,   278,
-     279,   279,   280,   280,   281,   281,   282,   282,   283,   283,
-     284,   284,   285,   285,   286,   286,   287,   287,   288,   288,
-     296,   297,   298,   299,   300,   301,   302,   305,   310,   310,
-     321,   324,   325,   328,   332,   339,   339,   346,   347,   350,
-     354,   361,   361,   368,   369,   372,   376,   387,   397,   397,
-     413,   414,   418,   419,   420,   421,   422,   423,   426,   426,
-     441,   441,   450,   451,   456,   457,   458,   459,   460,   461,
-     462,   463,   464,   465,   466,   467,   468,   469,   470,   471,
-     472,   473,   474,   475,   476,   477,   478,   479,   480,   481,
-     482,   483,   484,   485,   486,   487,   488,   489,   490,   491,
-     492,   493,   494,   495,   496,   497,   498,   499,   500,   501,
-     502,   503,   506,   511,   516,   521,   526,   531,   536,   541,
-     546,   551,   551,   559,   564,   569,   574,   579,   584,   589,
-     589,   597,   600,   603,   606,   609,   615,   615,   623,   623,
-     631,   631,   639,   639,   647,   647,   658,   659,   662,   663,
-     664,   665,   666,   667,   668,   671,   671,   680,   680,   690,
-     690,   697,   698,   701,   701,   708,   710,   714,   720,   720,
-     732,   732,   742,   743,   745,   747,   747,   765,   765,   777,
-     777,   787,   788,   791,   792,   795,   795,   805,   806,   809,
-     810,   811,   812,   813,   814,   815,   816,   817,   818,   819,
-     820,   821,   822,   823,   824,   825,   826,   827,   828,   829,
-     832,   832,   839,   840,   841,   842,   845,   845,   853,   853,
-     861,   861,   869,   874,   874,   882,   887,   892,   897,   902,
-     907,   912,   917,   917,   925,   925,   933,   933,   941,   941,
-     949,   954,   959,   965,   965,   975,   976,   979,   980,   981,
-     982,   983,   986,   991,   996,  1001,  1006,  1011,  1011,  1021,
-    1022,  1025,  1026,  1029,  1029,  1039,  1039,  1049,  1050,  1051,
-    1054,  1055,  1058,  1058,  1066,  1066,  1074,  1074,  1085,  1086,
-    1089,  1090,  1091,  1092,  1093,  1094,  1097,  1102,  1107,  1112,
-    1117,  1122,  1130,  1130,  1143,  1144,  1147,  1148,  1155,  1155,
-    1181,  1181,  1192,  1193,  1197,  1198,  1199,  1200,  1201,  1202,
-    1203,  1204,  1205,  1206,  1207,  1208,  1209,  1210,  1211,  1212,
-    1213,  1214,  1215,  1216,  1217,  1218,  1219,  1220,  1221,  1222,
-    1223,  1224,  1225,  1226,  1227,  1228,  1229,  1230,  1231,  1232,
-    1233,  1236,  1236,  1244,  1244,  1252,  1252,  1260,  1260,  1268,
-    1268,  1276,  1276,  1284,  1284,  1294,  1294,  1301,  1302,  1303,
-    1304,  1307,  1314,  1314,  1325,  1326,  1330,  1331,  1334,  1334,
-    1342,  1343,  1346,  1347,  1348,  1349,  1350,  1351,  1352,  1353,
-    1354,  1355,  1356,  1357,  1358,  1359,  1360,  1361,  1362,  1363,
-    1364,  1365,  1366,  1367,  1368,  1369,  1370,  1371,  1372,  1373,
-    1374,  1375,  1376,  1377,  1384,  1384,  1397,  1397,  1406,  1407,
-    1410,  1411,  1416,  1416,  1431,  1431,  1445,  1446,  1449,  1450,
-    1453,  1454,  1455,  1456,  1457,  1458,  1459,  1460,  1461,  1462,
-    1465,  1467,  1472,  1474,  1474,  1482,  1482,  1490,  1490,  1498,
-    1500,  1500,  1508,  1517,  1517,  1529,  1530,  1535,  1536,  1541,
-    1541,  1553,  1553,  1565,  1566,  1571,  1572,  1577,  1578,  1579,
-    1580,  1581,  1582,  1583,  1584,  1585,  1588,  1590,  1590,  1598,
-    1600,  1602,  1607,  1615,  1615,  1627,  1628,  1631,  1632,  1635,
-    1635,  1645,  1645,  1655,  1656,  1659,  1660,  1661,  1662,  1663,
-    1664,  1665,  1668,  1668,  1676,  1676,  1701,  1701,  1731,  1731,
-    1741,  1742,  1745,  1746,  1749,  1749,  1758,  1758,  1767,  1768,
-    1771,  1772,  1776,  1777,  1778,  1779,  1780,  1781,  1782,  1783,
-    1784,  1785,  1786,  1787,  1788,  1789,  1790,  1793,  1793,  1801,
-    1801,  1809,  1809,  1817,  1817,  1825,  1825,  1835,  1835,  1843,
-    1843,  1851,  1851,  1859,  1859,  1867,  1867,  1875,  1875,  1883,
-    1883,  1896,  1896,  1906,  1907,  1913,  1913,  1923,  1924,  1927,
-    1927,  1937,  1938,  1941,  1942,  1945,  1946,  1947,  1948,  1949,
-    1950,  1951,  1952,  1953,  1954,  1955,  1958,  1960,  1960,  1968,
-    1977,  1984,  1984,  1994,  1995,  1998,  1999,  2000,  2001,  2002,
-    2005,  2005,  2013,  2013,  2024,  2024,  2036,  2037,  2040,  2041,
-    2042,  2043,  2044,  2045,  2048,  2053,  2053,  2061,  2066,  2066,
-    2075,  2075,  2087,  2087,  2097,  2098,  2101,  2102,  2103,  2104,
-    2105,  2106,  2107,  2108,  2109,  2110,  2111,  2112,  2113,  2114,
-    2115,  2116,  2117,  2118,  2121,  2126,  2126,  2134,  2139,  2139,
-    2147,  2152,  2157,  2157,  2165,  2166,  2169,  2169,  2178,  2178,
-    2187,  2193,  2199,  2199,  2207,  2207,  2216,  2216,  2225,  2225,
-    2236,  2236,  2243,  2243,  2250,  2250,  2257,  2257,  2268,  2268,
-    2278,  2279,  2283,  2284,  2287,  2287,  2297,  2307,  2307,  2317,
-    2317,  2328,  2329,  2333,  2337,  2337,  2349,  2350,  2354,  2354,
-    2362,  2363,  2366,  2367,  2368,  2369,  2370,  2371,  2372,  2375,
-    2380,  2380,  2388,  2388,  2398,  2399,  2402,  2402,  2410,  2411,
-    2414,  2415,  2416,  2417,  2418,  2421,  2421,  2429,  2434,  2439,
-    2444,  2444
+       0,   291,   291,   291,   292,   292,   293,   293,   294,   294,
+     295,   295,   296,   296,   297,   297,   298,   298,   299,   299,
+     300,   300,   301,   301,   302,   302,   303,   303,   304,   304,
+     312,   313,   314,   315,   316,   317,   318,   321,   326,   326,
+     337,   340,   341,   344,   348,   355,   355,   362,   363,   366,
+     370,   377,   377,   384,   385,   388,   392,   403,   413,   413,
+     429,   430,   434,   435,   436,   437,   438,   439,   442,   442,
+     457,   457,   466,   467,   472,   473,   474,   475,   476,   477,
+     478,   479,   480,   481,   482,   483,   484,   485,   486,   487,
+     488,   489,   490,   491,   492,   493,   494,   495,   496,   497,
+     498,   499,   500,   501,   502,   503,   504,   505,   506,   507,
+     508,   509,   510,   511,   512,   513,   514,   515,   516,   517,
+     518,   519,   520,   521,   522,   525,   530,   535,   540,   545,
+     550,   555,   560,   565,   570,   575,   580,   580,   588,   593,
+     598,   603,   608,   613,   618,   618,   626,   629,   632,   635,
+     638,   644,   644,   652,   652,   660,   660,   668,   668,   676,
+     676,   687,   688,   691,   692,   693,   694,   695,   696,   697,
+     700,   700,   709,   709,   719,   719,   726,   727,   730,   730,
+     737,   739,   743,   749,   749,   761,   761,   771,   772,   774,
+     776,   776,   794,   794,   806,   806,   816,   817,   820,   821,
+     824,   824,   834,   835,   838,   839,   840,   841,   842,   843,
+     844,   845,   846,   847,   848,   849,   850,   851,   852,   853,
+     854,   855,   856,   857,   858,   859,   860,   861,   862,   863,
+     866,   866,   873,   874,   875,   876,   879,   879,   887,   887,
+     895,   895,   903,   908,   908,   916,   921,   926,   931,   936,
+     941,   941,   949,   949,   957,   962,   967,   972,   977,   982,
+     982,   990,   990,   998,   998,  1006,  1006,  1014,  1019,  1024,
+    1030,  1030,  1040,  1041,  1044,  1045,  1046,  1047,  1048,  1051,
+    1056,  1061,  1066,  1071,  1076,  1076,  1086,  1087,  1090,  1091,
+    1094,  1094,  1104,  1104,  1114,  1115,  1116,  1119,  1120,  1123,
+    1123,  1131,  1131,  1139,  1139,  1150,  1151,  1154,  1155,  1156,
+    1157,  1158,  1159,  1160,  1163,  1168,  1173,  1178,  1183,  1188,
+    1193,  1201,  1201,  1214,  1215,  1218,  1219,  1226,  1226,  1252,
+    1252,  1263,  1264,  1268,  1269,  1270,  1271,  1272,  1273,  1274,
+    1275,  1276,  1277,  1278,  1279,  1280,  1281,  1282,  1283,  1284,
+    1285,  1286,  1287,  1288,  1289,  1290,  1291,  1292,  1293,  1294,
+    1295,  1296,  1297,  1298,  1299,  1300,  1301,  1302,  1303,  1304,
+    1305,  1306,  1309,  1309,  1317,  1317,  1325,  1325,  1333,  1333,
+    1341,  1341,  1349,  1349,  1357,  1357,  1367,  1367,  1374,  1375,
+    1376,  1377,  1380,  1387,  1387,  1398,  1399,  1403,  1404,  1407,
+    1407,  1415,  1416,  1419,  1420,  1421,  1422,  1423,  1424,  1425,
+    1426,  1427,  1428,  1429,  1430,  1431,  1432,  1433,  1434,  1435,
+    1436,  1437,  1438,  1439,  1440,  1441,  1442,  1443,  1444,  1445,
+    1446,  1447,  1448,  1449,  1450,  1451,  1452,  1459,  1459,  1472,
+    1472,  1481,  1482,  1485,  1486,  1491,  1491,  1506,  1506,  1520,
+    1521,  1524,  1525,  1528,  1529,  1530,  1531,  1532,  1533,  1534,
+    1535,  1536,  1537,  1540,  1542,  1547,  1549,  1549,  1557,  1557,
+    1565,  1565,  1573,  1575,  1575,  1583,  1592,  1592,  1604,  1605,
+    1610,  1611,  1616,  1616,  1628,  1628,  1640,  1641,  1646,  1647,
+    1652,  1653,  1654,  1655,  1656,  1657,  1658,  1659,  1660,  1663,
+    1665,  1665,  1673,  1675,  1677,  1682,  1690,  1690,  1702,  1703,
+    1706,  1707,  1710,  1710,  1720,  1720,  1730,  1731,  1734,  1735,
+    1736,  1737,  1738,  1739,  1740,  1743,  1743,  1751,  1751,  1776,
+    1776,  1806,  1806,  1816,  1817,  1820,  1821,  1824,  1824,  1833,
+    1833,  1842,  1843,  1846,  1847,  1851,  1852,  1853,  1854,  1855,
+    1856,  1857,  1858,  1859,  1860,  1861,  1862,  1863,  1864,  1865,
+    1868,  1868,  1876,  1876,  1884,  1884,  1892,  1892,  1900,  1900,
+    1910,  1910,  1918,  1918,  1926,  1926,  1934,  1934,  1942,  1942,
+    1950,  1950,  1958,  1958,  1971,  1971,  1981,  1982,  1988,  1988,
+    1998,  1999,  2002,  2002,  2012,  2013,  2016,  2017,  2020,  2021,
+    2022,  2023,  2024,  2025,  2026,  2027,  2028,  2029,  2030,  2033,
+    2035,  2035,  2043,  2052,  2057,  2064,  2064,  2074,  2075,  2078,
+    2079,  2080,  2081,  2082,  2085,  2085,  2093,  2093,  2104,  2104,
+    2116,  2117,  2120,  2121,  2122,  2123,  2124,  2125,  2128,  2133,
+    2133,  2141,  2146,  2146,  2155,  2155,  2167,  2167,  2177,  2178,
+    2181,  2182,  2183,  2184,  2185,  2186,  2187,  2188,  2189,  2190,
+    2191,  2192,  2193,  2194,  2195,  2196,  2197,  2198,  2201,  2206,
+    2206,  2214,  2219,  2219,  2227,  2232,  2237,  2237,  2245,  2246,
+    2249,  2249,  2258,  2258,  2267,  2273,  2279,  2279,  2287,  2287,
+    2296,  2296,  2305,  2305,  2316,  2316,  2323,  2323,  2330,  2330,
+    2337,  2337,  2348,  2348,  2358,  2359,  2363,  2364,  2367,  2367,
+    2377,  2387,  2387,  2397,  2397,  2408,  2409,  2413,  2417,  2417,
+    2429,  2430,  2434,  2434,  2442,  2443,  2446,  2447,  2448,  2449,
+    2450,  2451,  2452,  2453,  2454,  2455,  2458,  2463,  2463,  2471,
+    2471,  2481,  2486,  2491,  2491,  2501,  2502,  2505,  2505,  2513,
+    2514,  2517,  2518,  2519,  2520,  2521,  2522,  2523,  2524,  2527,
+    2527,  2535,  2540,  2545,  2550,  2550,  2558,  2563,  2568,  2568
   };
 
   // Print the state stack on the debug stream.
@@ -5341,7 +5562,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 5345 "dhcp4_parser.cc"
+#line 5566 "dhcp4_parser.cc"
 
 #line 2453 "dhcp4_parser.yy"
 
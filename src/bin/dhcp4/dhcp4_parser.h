@@ -496,148 +496,163 @@ namespace isc { namespace dhcp {
         TOKEN_PERSIST = 298,
         TOKEN_LFC_INTERVAL = 299,
         TOKEN_READONLY = 300,
-        TOKEN_CONNECT_TIMEOUT = 301,
-        TOKEN_CONTACT_POINTS = 302,
-        TOKEN_KEYSPACE = 303,
-        TOKEN_CONSISTENCY = 304,
-        TOKEN_SERIAL_CONSISTENCY = 305,
-        TOKEN_MAX_RECONNECT_TRIES = 306,
-        TOKEN_RECONNECT_WAIT_TIME = 307,
-        TOKEN_REQUEST_TIMEOUT = 308,
-        TOKEN_TCP_KEEPALIVE = 309,
-        TOKEN_TCP_NODELAY = 310,
-        TOKEN_MAX_ROW_ERRORS = 311,
-        TOKEN_VALID_LIFETIME = 312,
-        TOKEN_MIN_VALID_LIFETIME = 313,
-        TOKEN_MAX_VALID_LIFETIME = 314,
-        TOKEN_RENEW_TIMER = 315,
-        TOKEN_REBIND_TIMER = 316,
-        TOKEN_CALCULATE_TEE_TIMES = 317,
-        TOKEN_T1_PERCENT = 318,
-        TOKEN_T2_PERCENT = 319,
-        TOKEN_DECLINE_PROBATION_PERIOD = 320,
-        TOKEN_SERVER_TAG = 321,
-        TOKEN_DDNS_SEND_UPDATES = 322,
-        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 323,
-        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 324,
-        TOKEN_DDNS_REPLACE_CLIENT_NAME = 325,
-        TOKEN_DDNS_GENERATED_PREFIX = 326,
-        TOKEN_DDNS_QUALIFYING_SUFFIX = 327,
-        TOKEN_SUBNET4 = 328,
-        TOKEN_SUBNET_4O6_INTERFACE = 329,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 330,
-        TOKEN_SUBNET_4O6_SUBNET = 331,
-        TOKEN_OPTION_DEF = 332,
-        TOKEN_OPTION_DATA = 333,
-        TOKEN_NAME = 334,
-        TOKEN_DATA = 335,
-        TOKEN_CODE = 336,
-        TOKEN_SPACE = 337,
-        TOKEN_CSV_FORMAT = 338,
-        TOKEN_ALWAYS_SEND = 339,
-        TOKEN_RECORD_TYPES = 340,
-        TOKEN_ENCAPSULATE = 341,
-        TOKEN_ARRAY = 342,
-        TOKEN_SHARED_NETWORKS = 343,
-        TOKEN_POOLS = 344,
-        TOKEN_POOL = 345,
-        TOKEN_USER_CONTEXT = 346,
-        TOKEN_COMMENT = 347,
-        TOKEN_SUBNET = 348,
-        TOKEN_INTERFACE = 349,
-        TOKEN_ID = 350,
-        TOKEN_RESERVATION_MODE = 351,
-        TOKEN_DISABLED = 352,
-        TOKEN_OUT_OF_POOL = 353,
-        TOKEN_GLOBAL = 354,
-        TOKEN_ALL = 355,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 356,
-        TOKEN_CLIENT_CLASSES = 357,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 358,
-        TOKEN_TEST = 359,
-        TOKEN_ONLY_IF_REQUIRED = 360,
-        TOKEN_CLIENT_CLASS = 361,
-        TOKEN_RESERVATIONS = 362,
-        TOKEN_DUID = 363,
-        TOKEN_HW_ADDRESS = 364,
-        TOKEN_CIRCUIT_ID = 365,
-        TOKEN_CLIENT_ID = 366,
-        TOKEN_HOSTNAME = 367,
-        TOKEN_FLEX_ID = 368,
-        TOKEN_RELAY = 369,
-        TOKEN_IP_ADDRESS = 370,
-        TOKEN_IP_ADDRESSES = 371,
-        TOKEN_HOOKS_LIBRARIES = 372,
-        TOKEN_LIBRARY = 373,
-        TOKEN_PARAMETERS = 374,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 375,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 376,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 377,
-        TOKEN_HOLD_RECLAIMED_TIME = 378,
-        TOKEN_MAX_RECLAIM_LEASES = 379,
-        TOKEN_MAX_RECLAIM_TIME = 380,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 381,
-        TOKEN_DHCP4O6_PORT = 382,
-        TOKEN_CONTROL_SOCKET = 383,
-        TOKEN_SOCKET_TYPE = 384,
-        TOKEN_SOCKET_NAME = 385,
-        TOKEN_DHCP_QUEUE_CONTROL = 386,
-        TOKEN_ENABLE_QUEUE = 387,
-        TOKEN_QUEUE_TYPE = 388,
-        TOKEN_CAPACITY = 389,
-        TOKEN_DHCP_DDNS = 390,
-        TOKEN_ENABLE_UPDATES = 391,
-        TOKEN_QUALIFYING_SUFFIX = 392,
-        TOKEN_SERVER_IP = 393,
-        TOKEN_SERVER_PORT = 394,
-        TOKEN_SENDER_IP = 395,
-        TOKEN_SENDER_PORT = 396,
-        TOKEN_MAX_QUEUE_SIZE = 397,
-        TOKEN_NCR_PROTOCOL = 398,
-        TOKEN_NCR_FORMAT = 399,
-        TOKEN_OVERRIDE_NO_UPDATE = 400,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 401,
-        TOKEN_REPLACE_CLIENT_NAME = 402,
-        TOKEN_GENERATED_PREFIX = 403,
-        TOKEN_TCP = 404,
-        TOKEN_JSON = 405,
-        TOKEN_WHEN_PRESENT = 406,
-        TOKEN_NEVER = 407,
-        TOKEN_ALWAYS = 408,
-        TOKEN_WHEN_NOT_PRESENT = 409,
-        TOKEN_HOSTNAME_CHAR_SET = 410,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 411,
-        TOKEN_LOGGING = 412,
-        TOKEN_LOGGERS = 413,
-        TOKEN_OUTPUT_OPTIONS = 414,
-        TOKEN_OUTPUT = 415,
-        TOKEN_DEBUGLEVEL = 416,
-        TOKEN_SEVERITY = 417,
-        TOKEN_FLUSH = 418,
-        TOKEN_MAXSIZE = 419,
-        TOKEN_MAXVER = 420,
-        TOKEN_PATTERN = 421,
-        TOKEN_DHCP6 = 422,
-        TOKEN_DHCPDDNS = 423,
-        TOKEN_CONTROL_AGENT = 424,
-        TOKEN_TOPLEVEL_JSON = 425,
-        TOKEN_TOPLEVEL_DHCP4 = 426,
-        TOKEN_SUB_DHCP4 = 427,
-        TOKEN_SUB_INTERFACES4 = 428,
-        TOKEN_SUB_SUBNET4 = 429,
-        TOKEN_SUB_POOL4 = 430,
-        TOKEN_SUB_RESERVATION = 431,
-        TOKEN_SUB_OPTION_DEFS = 432,
-        TOKEN_SUB_OPTION_DEF = 433,
-        TOKEN_SUB_OPTION_DATA = 434,
-        TOKEN_SUB_HOOKS_LIBRARY = 435,
-        TOKEN_SUB_DHCP_DDNS = 436,
-        TOKEN_SUB_LOGGING = 437,
-        TOKEN_SUB_CONFIG_CONTROL = 438,
-        TOKEN_STRING = 439,
-        TOKEN_INTEGER = 440,
-        TOKEN_FLOAT = 441,
-        TOKEN_BOOLEAN = 442
+        TOKEN_WRITE_BEHIND_CACHE = 301,
+        TOKEN_WRITE_BACK_LATENCY = 302,
+        TOKEN_CACHE_JOURNAL = 303,
+        TOKEN_READ_REPLICAS = 304,
+        TOKEN_ALLOCATE_OR_RENEW = 305,
+        TOKEN_CONNECT_TIMEOUT = 306,
+        TOKEN_CONTACT_POINTS = 307,
+        TOKEN_KEYSPACE = 308,
+        TOKEN_CONSISTENCY = 309,
+        TOKEN_SERIAL_CONSISTENCY = 310,
+        TOKEN_MAX_RECONNECT_TRIES = 311,
+        TOKEN_RECONNECT_WAIT_TIME = 312,
+        TOKEN_REQUEST_TIMEOUT = 313,
+        TOKEN_TCP_KEEPALIVE = 314,
+        TOKEN_TCP_NODELAY = 315,
+        TOKEN_MAX_ROW_ERRORS = 316,
+        TOKEN_VALID_LIFETIME = 317,
+        TOKEN_MIN_VALID_LIFETIME = 318,
+        TOKEN_MAX_VALID_LIFETIME = 319,
+        TOKEN_RENEW_TIMER = 320,
+        TOKEN_REBIND_TIMER = 321,
+        TOKEN_CALCULATE_TEE_TIMES = 322,
+        TOKEN_T1_PERCENT = 323,
+        TOKEN_T2_PERCENT = 324,
+        TOKEN_CACHE_THRESHOLD = 325,
+        TOKEN_CACHE_MAX_AGE = 326,
+        TOKEN_DECLINE_PROBATION_PERIOD = 327,
+        TOKEN_SERVER_TAG = 328,
+        TOKEN_DDNS_SEND_UPDATES = 329,
+        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 330,
+        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 331,
+        TOKEN_DDNS_REPLACE_CLIENT_NAME = 332,
+        TOKEN_DDNS_GENERATED_PREFIX = 333,
+        TOKEN_DDNS_QUALIFYING_SUFFIX = 334,
+        TOKEN_SUBNET4 = 335,
+        TOKEN_SUBNET_4O6_INTERFACE = 336,
+        TOKEN_SUBNET_4O6_INTERFACE_ID = 337,
+        TOKEN_SUBNET_4O6_SUBNET = 338,
+        TOKEN_OPTION_DEF = 339,
+        TOKEN_OPTION_DATA = 340,
+        TOKEN_NAME = 341,
+        TOKEN_DATA = 342,
+        TOKEN_CODE = 343,
+        TOKEN_SPACE = 344,
+        TOKEN_CSV_FORMAT = 345,
+        TOKEN_ALWAYS_SEND = 346,
+        TOKEN_RECORD_TYPES = 347,
+        TOKEN_ENCAPSULATE = 348,
+        TOKEN_ARRAY = 349,
+        TOKEN_SHARED_NETWORKS = 350,
+        TOKEN_POOLS = 351,
+        TOKEN_POOL = 352,
+        TOKEN_USER_CONTEXT = 353,
+        TOKEN_COMMENT = 354,
+        TOKEN_SUBNET = 355,
+        TOKEN_INTERFACE = 356,
+        TOKEN_ID = 357,
+        TOKEN_RESERVATION_MODE = 358,
+        TOKEN_DISABLED = 359,
+        TOKEN_OUT_OF_POOL = 360,
+        TOKEN_GLOBAL = 361,
+        TOKEN_ALL = 362,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 363,
+        TOKEN_CLIENT_CLASSES = 364,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 365,
+        TOKEN_TEST = 366,
+        TOKEN_ONLY_IF_REQUIRED = 367,
+        TOKEN_CLIENT_CLASS = 368,
+        TOKEN_RESERVATIONS = 369,
+        TOKEN_DUID = 370,
+        TOKEN_HW_ADDRESS = 371,
+        TOKEN_CIRCUIT_ID = 372,
+        TOKEN_CLIENT_ID = 373,
+        TOKEN_HOSTNAME = 374,
+        TOKEN_FLEX_ID = 375,
+        TOKEN_RELAY = 376,
+        TOKEN_IP_ADDRESS = 377,
+        TOKEN_IP_ADDRESSES = 378,
+        TOKEN_HOOKS_LIBRARIES = 379,
+        TOKEN_LIBRARY = 380,
+        TOKEN_PARAMETERS = 381,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 382,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 383,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 384,
+        TOKEN_HOLD_RECLAIMED_TIME = 385,
+        TOKEN_MAX_RECLAIM_LEASES = 386,
+        TOKEN_MAX_RECLAIM_TIME = 387,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 388,
+        TOKEN_BACKGROUND_RECLAMATION = 389,
+        TOKEN_DHCP4O6_PORT = 390,
+        TOKEN_LEASE_QUERY_THREADS = 391,
+        TOKEN_CONTROL_SOCKET = 392,
+        TOKEN_SOCKET_TYPE = 393,
+        TOKEN_SOCKET_NAME = 394,
+        TOKEN_DHCP_QUEUE_CONTROL = 395,
+        TOKEN_ENABLE_QUEUE = 396,
+        TOKEN_QUEUE_TYPE = 397,
+        TOKEN_CAPACITY = 398,
+        TOKEN_DHCP_DDNS = 399,
+        TOKEN_ENABLE_UPDATES = 400,
+        TOKEN_QUALIFYING_SUFFIX = 401,
+        TOKEN_SERVER_IP = 402,
+        TOKEN_SERVER_PORT = 403,
+        TOKEN_SENDER_IP = 404,
+        TOKEN_SENDER_PORT = 405,
+        TOKEN_MAX_QUEUE_SIZE = 406,
+        TOKEN_NCR_PROTOCOL = 407,
+        TOKEN_NCR_FORMAT = 408,
+        TOKEN_OVERRIDE_NO_UPDATE = 409,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 410,
+        TOKEN_REPLACE_CLIENT_NAME = 411,
+        TOKEN_GENERATED_PREFIX = 412,
+        TOKEN_TCP = 413,
+        TOKEN_JSON = 414,
+        TOKEN_WHEN_PRESENT = 415,
+        TOKEN_NEVER = 416,
+        TOKEN_ALWAYS = 417,
+        TOKEN_WHEN_NOT_PRESENT = 418,
+        TOKEN_HOSTNAME_CHAR_SET = 419,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 420,
+        TOKEN_LOGGING = 421,
+        TOKEN_LOGGERS = 422,
+        TOKEN_OUTPUT_OPTIONS = 423,
+        TOKEN_OUTPUT = 424,
+        TOKEN_DEBUGLEVEL = 425,
+        TOKEN_SEVERITY = 426,
+        TOKEN_FLUSH = 427,
+        TOKEN_MAXSIZE = 428,
+        TOKEN_MAXVER = 429,
+        TOKEN_PATTERN = 430,
+        TOKEN_ASYNC = 431,
+        TOKEN_ASYNC_QUEUE_SIZE = 432,
+        TOKEN_ASYNC_OVERFLOW = 433,
+        TOKEN_RATE_LIMITED_MESSAGES = 434,
+        TOKEN_RATE_LIMIT = 435,
+        TOKEN_RATE_LIMIT_INTERVAL = 436,
+        TOKEN_DHCP6 = 437,
+        TOKEN_DHCPDDNS = 438,
+        TOKEN_CONTROL_AGENT = 439,
+        TOKEN_TOPLEVEL_JSON = 440,
+        TOKEN_TOPLEVEL_DHCP4 = 441,
+        TOKEN_SUB_DHCP4 = 442,
+        TOKEN_SUB_INTERFACES4 = 443,
+        TOKEN_SUB_SUBNET4 = 444,
+        TOKEN_SUB_POOL4 = 445,
+        TOKEN_SUB_RESERVATION = 446,
+        TOKEN_SUB_OPTION_DEFS = 447,
+        TOKEN_SUB_OPTION_DEF = 448,
+        TOKEN_SUB_OPTION_DATA = 449,
+        TOKEN_SUB_HOOKS_LIBRARY = 450,
+        TOKEN_SUB_DHCP_DDNS = 451,
+        TOKEN_SUB_LOGGING = 452,
+        TOKEN_SUB_CONFIG_CONTROL = 453,
+        TOKEN_STRING = 454,
+        TOKEN_INTEGER = 455,
+        TOKEN_FLOAT = 456,
+        TOKEN_BOOLEAN = 457
       };
     };
 
@@ -779,30 +794,30 @@ namespace isc { namespace dhcp {
         // Type destructor.
 switch (yytype)
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -885,13 +900,13 @@ switch (yytype)
       symbol_type (int tok, location_type l)
         : super_type(token_type (tok), std::move (l))
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_WRITE_BEHIND_CACHE || tok == token::TOKEN_WRITE_BACK_LATENCY || tok == token::TOKEN_CACHE_JOURNAL || tok == token::TOKEN_READ_REPLICAS || tok == token::TOKEN_ALLOCATE_OR_RENEW || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_CACHE_THRESHOLD || tok == token::TOKEN_CACHE_MAX_AGE || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_BACKGROUND_RECLAMATION || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_LEASE_QUERY_THREADS || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
       }
 #else
       symbol_type (int tok, const location_type& l)
         : super_type(token_type (tok), l)
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_WRITE_BEHIND_CACHE || tok == token::TOKEN_WRITE_BACK_LATENCY || tok == token::TOKEN_CACHE_JOURNAL || tok == token::TOKEN_READ_REPLICAS || tok == token::TOKEN_ALLOCATE_OR_RENEW || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_CACHE_THRESHOLD || tok == token::TOKEN_CACHE_MAX_AGE || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_BACKGROUND_RECLAMATION || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_LEASE_QUERY_THREADS || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
       }
 #endif
 #if 201103L <= YY_CPLUSPLUS
@@ -1643,6 +1658,81 @@ switch (yytype)
         return symbol_type (token::TOKEN_READONLY, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WRITE_BEHIND_CACHE (location_type l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BEHIND_CACHE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WRITE_BEHIND_CACHE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BEHIND_CACHE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WRITE_BACK_LATENCY (location_type l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BACK_LATENCY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WRITE_BACK_LATENCY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BACK_LATENCY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_JOURNAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_JOURNAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_JOURNAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_JOURNAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_READ_REPLICAS (location_type l)
+      {
+        return symbol_type (token::TOKEN_READ_REPLICAS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_READ_REPLICAS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_READ_REPLICAS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALLOCATE_OR_RENEW (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALLOCATE_OR_RENEW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALLOCATE_OR_RENEW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALLOCATE_OR_RENEW, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1928,6 +2018,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_T2_PERCENT, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_MAX_AGE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_MAX_AGE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_MAX_AGE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_MAX_AGE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -2858,6 +2978,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BACKGROUND_RECLAMATION (location_type l)
+      {
+        return symbol_type (token::TOKEN_BACKGROUND_RECLAMATION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BACKGROUND_RECLAMATION (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BACKGROUND_RECLAMATION, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -2873,6 +3008,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_QUERY_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_QUERY_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_QUERY_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_QUERY_THREADS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3458,6 +3608,96 @@ switch (yytype)
         return symbol_type (token::TOKEN_PATTERN, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -4079,12 +4319,12 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 1160,     ///< Last index in yytable_.
-      yynnts_ = 407,  ///< Number of nonterminal symbols.
+      yylast_ = 1197,     ///< Last index in yytable_.
+      yynnts_ = 426,  ///< Number of nonterminal symbols.
       yyfinal_ = 30, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 188  ///< Number of tokens.
+      yyntokens_ = 203  ///< Number of tokens.
     };
 
 
@@ -4146,9 +4386,10 @@ switch (yytype)
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     185,   186,   187
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202
     };
-    const unsigned user_token_number_max_ = 442;
+    const unsigned user_token_number_max_ = 457;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int> (t) <= yyeof_)
@@ -4169,30 +4410,30 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -4211,30 +4452,30 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4260,30 +4501,30 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 204: // value
-      case 208: // map_value
-      case 249: // ddns_replace_client_name_value
-      case 268: // socket_type
-      case 271: // outbound_interface_value
-      case 293: // db_type
-      case 380: // hr_mode
-      case 535: // ncr_protocol_value
+      case 219: // value
+      case 223: // map_value
+      case 266: // ddns_replace_client_name_value
+      case 285: // socket_type
+      case 288: // outbound_interface_value
+      case 310: // db_type
+      case 405: // hr_mode
+      case 561: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 187: // "boolean"
+      case 202: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 186: // "floating point"
+      case 201: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 185: // "integer"
+      case 200: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 184: // "constant string"
+      case 199: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4369,14 +4610,16 @@ switch (yytype)
      405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
      415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
      425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457
     };
     return token_type (yytoken_number_[type]);
   }
 
 #line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4380 "dhcp4_parser.h"
+#line 4623 "dhcp4_parser.h"
 
 
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -90,6 +90,11 @@ using namespace std;
   PERSIST "persist"
   LFC_INTERVAL "lfc-interval"
   READONLY "readonly"
+  WRITE_BEHIND_CACHE "write-behind-cache"
+  WRITE_BACK_LATENCY "write-back-latency"
+  CACHE_JOURNAL "cache-journal"
+  READ_REPLICAS "read-replicas"
+  ALLOCATE_OR_RENEW "allocate-or-renew"
   CONNECT_TIMEOUT "connect-timeout"
   CONTACT_POINTS "contact-points"
   KEYSPACE "keyspace"
@@ -110,6 +115,8 @@ using namespace std;
   CALCULATE_TEE_TIMES "calculate-tee-times"
   T1_PERCENT "t1-percent"
   T2_PERCENT "t2-percent"
+  CACHE_THRESHOLD "cache-threshold"
+  CACHE_MAX_AGE "cache-max-age"
   DECLINE_PROBATION_PERIOD "decline-probation-period"
   SERVER_TAG "server-tag"
   DDNS_SEND_UPDATES "ddns-send-updates"
@@ -181,9 +188,12 @@ using namespace std;
   MAX_RECLAIM_LEASES "max-reclaim-leases"
   MAX_RECLAIM_TIME "max-reclaim-time"
   UNWARNED_RECLAIM_CYCLES "unwarned-reclaim-cycles"
+  BACKGROUND_RECLAMATION "background-reclamation"
 
   DHCP4O6_PORT "dhcp4o6-port"
 
+  LEASE_QUERY_THREADS "lease-query-threads"
+
   CONTROL_SOCKET "control-socket"
   SOCKET_TYPE "socket-type"
   SOCKET_NAME "socket-name"
@@ -226,6 +236,12 @@ using namespace std;
   MAXSIZE "maxsize"
   MAXVER "maxver"
   PATTERN "pattern"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
+  ASYNC_OVERFLOW "async-overflow"
+  RATE_LIMITED_MESSAGES "rate-limited-messages"
+  RATE_LIMIT "rate-limit"
+  RATE_LIMIT_INTERVAL "rate-limit-interval"
 
   DHCP6 "Dhcp6"
   DHCPDDNS "DhcpDdns"
@@ -491,6 +507,8 @@ global_param: valid_lifetime
             | calculate_tee_times
             | t1_percent
             | t2_percent
+            | cache_threshold
+            | cache_max_age
             | loggers
             | hostname_char_set
             | hostname_char_replacement
@@ -500,6 +518,7 @@ global_param: valid_lifetime
             | ddns_replace_client_name
             | ddns_generated_prefix
             | ddns_qualifying_suffix
+            | lease_query_threads
             | unknown_map_entry
             ;
 
@@ -543,6 +562,16 @@ t2_percent: T2_PERCENT COLON FLOAT {
     ctx.stack_.back()->set("t2-percent", t2);
 };
 
+cache_threshold: CACHE_THRESHOLD COLON FLOAT {
+    ElementPtr ct(new DoubleElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+};
+
+cache_max_age: CACHE_MAX_AGE COLON INTEGER {
+    ElementPtr cm(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-max-age", cm);
+};
+
 decline_probation_period: DECLINE_PROBATION_PERIOD COLON INTEGER {
     ElementPtr dpp(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -815,6 +844,11 @@ database_map_param: database_type
                   | persist
                   | lfc_interval
                   | readonly
+                  | write_behind_cache
+                  | write_back_latency
+                  | cache_journal
+                  | read_replicas
+                  | allocate_or_renew
                   | connect_timeout
                   | contact_points
                   | max_reconnect_tries
@@ -894,6 +928,37 @@ readonly: READONLY COLON BOOLEAN {
     ctx.stack_.back()->set("readonly", n);
 };
 
+write_behind_cache: WRITE_BEHIND_CACHE COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("write-behind-cache", n);
+};
+
+write_back_latency: WRITE_BACK_LATENCY COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("write-back-latency", n);
+};
+
+cache_journal: CACHE_JOURNAL {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr journal(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("cache-journal", journal);
+    ctx.leave();
+};
+
+read_replicas: READ_REPLICAS {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr replicas(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("read-replicas", replicas);
+    ctx.leave();
+};
+
+allocate_or_renew: ALLOCATE_OR_RENEW COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("allocate-or-renew", n);
+};
+
 connect_timeout: CONNECT_TIMEOUT COLON INTEGER {
     ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1092,6 +1157,7 @@ expired_leases_param: reclaim_timer_wait_time
                     | max_reclaim_leases
                     | max_reclaim_time
                     | unwarned_reclaim_cycles
+                    | background_reclamation
                     ;
 
 reclaim_timer_wait_time: RECLAIM_TIMER_WAIT_TIME COLON INTEGER {
@@ -1124,6 +1190,11 @@ unwarned_reclaim_cycles: UNWARNED_RECLAIM_CYCLES COLON INTEGER {
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 };
 
+background_reclamation: BACKGROUND_RECLAMATION COLON BOOLEAN {
+    ElementPtr value(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("background-reclamation", value);
+};
+
 // --- subnet4 ------------------------------------------
 // This defines subnet4 as a list of maps.
 // "subnet4": [ ... ]
@@ -1222,6 +1293,8 @@ subnet4_param: valid_lifetime
              | calculate_tee_times
              | t1_percent
              | t2_percent
+             | cache_threshold
+             | cache_max_age
              | ddns_send_updates
              | ddns_override_no_update
              | ddns_override_client_update
@@ -1366,6 +1439,8 @@ shared_network_param: name
                     | calculate_tee_times
                     | t1_percent
                     | t2_percent
+                    | cache_threshold
+                    | cache_max_age
                     | ddns_send_updates
                     | ddns_override_no_update
                     | ddns_override_client_update
@@ -1979,6 +2054,11 @@ dhcp4o6_port: DHCP4O6_PORT COLON INTEGER {
     ctx.stack_.back()->set("dhcp4o6-port", time);
 };
 
+lease_query_threads: LEASE_QUERY_THREADS COLON INTEGER {
+    ElementPtr threads(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lease-query-threads", threads);
+};
+
 // --- control socket ----------------------------------------
 
 control_socket: CONTROL_SOCKET {
@@ -2367,6 +2447,9 @@ logger_param: name
             | output_options_list
             | debuglevel
             | severity
+            | rate_limited_messages
+            | rate_limit
+            | rate_limit_interval
             | user_context
             | comment
             | unknown_map_entry
@@ -2385,6 +2468,26 @@ severity: SEVERITY {
     ctx.leave();
 };
 
+rate_limited_messages: RATE_LIMITED_MESSAGES {
+    ElementPtr l(new ListElement(ctx.loc2pos(@1)));
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON list_strings {
+    ctx.stack_.pop_back();
+    ctx.leave();
+};
+
+rate_limit: RATE_LIMIT COLON INTEGER {
+    ElementPtr limit(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate-limit", limit);
+};
+
+rate_limit_interval: RATE_LIMIT_INTERVAL COLON INTEGER {
+    ElementPtr interval(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+};
+
 output_options_list: OUTPUT_OPTIONS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("output_options", l);
@@ -2416,6 +2519,9 @@ output_params: output
              | maxsize
              | maxver
              | pattern
+             | async
+             | async_queue_size
+             | async_overflow
              ;
 
 output: OUTPUT {
@@ -2449,6 +2555,24 @@ pattern: PATTERN {
     ctx.leave();
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
+async_overflow: ASYNC_OVERFLOW {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr overflow(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+};
+
 
 %%
 
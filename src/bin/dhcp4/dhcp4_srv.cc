@@ -45,8 +45,10 @@
 #include <hooks/callout_handle.h>
 #include <hooks/hooks_log.h>
 #include <hooks/hooks_manager.h>
+#include <hooks/server_hooks.h>
 #include <stats/stats_mgr.h>
 #include <util/strutil.h>
+#include <util/trace_mgr.h>
 #include <stats/stats_mgr.h>
 #include <log/logger.h>
 #include <cryptolink/cryptolink.h>
@@ -131,6 +133,90 @@ std::set<std::string> dhcp4_statistics = {
     "pkt4-receive-drop"
 };
 
+/// Handles of the statistics updated for each packet. They are registered
+/// during the DHCPv4 server startup, so the packet processing does not
+/// look the statistics up by name nor take the Statistics Manager lock.
+struct Dhcp4PacketCounters {
+    StatCounterPtr received_;           ///< pkt4-received
+    StatCounterPtr discover_received_;  ///< pkt4-discover-received
+    StatCounterPtr offer_received_;     ///< pkt4-offer-received
+    StatCounterPtr request_received_;   ///< pkt4-request-received
+    StatCounterPtr ack_received_;       ///< pkt4-ack-received
+    StatCounterPtr nak_received_;       ///< pkt4-nak-received
+    StatCounterPtr release_received_;   ///< pkt4-release-received
+    StatCounterPtr decline_received_;   ///< pkt4-decline-received
+    StatCounterPtr inform_received_;    ///< pkt4-inform-received
+    StatCounterPtr unknown_received_;   ///< pkt4-unknown-received
+    StatCounterPtr sent_;               ///< pkt4-sent
+    StatCounterPtr offer_sent_;         ///< pkt4-offer-sent
+    StatCounterPtr ack_sent_;           ///< pkt4-ack-sent
+    StatCounterPtr nak_sent_;           ///< pkt4-nak-sent
+    StatCounterPtr parse_failed_;       ///< pkt4-parse-failed
+    StatCounterPtr receive_drop_;       ///< pkt4-receive-drop
+
+    /// Registers the counters.
+    void registerCounters() {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        received_ = stats_mgr.registerCounter("pkt4-received");
+        discover_received_ = stats_mgr.registerCounter("pkt4-discover-received");
+        offer_received_ = stats_mgr.registerCounter("pkt4-offer-received");
+        request_received_ = stats_mgr.registerCounter("pkt4-request-received");
+        ack_received_ = stats_mgr.registerCounter("pkt4-ack-received");
+        nak_received_ = stats_mgr.registerCounter("pkt4-nak-received");
+        release_received_ = stats_mgr.registerCounter("pkt4-release-received");
+        decline_received_ = stats_mgr.registerCounter("pkt4-decline-received");
+        inform_received_ = stats_mgr.registerCounter("pkt4-inform-received");
+        unknown_received_ = stats_mgr.registerCounter("pkt4-unknown-received");
+        sent_ = stats_mgr.registerCounter("pkt4-sent");
+        offer_sent_ = stats_mgr.registerCounter("pkt4-offer-sent");
+        ack_sent_ = stats_mgr.registerCounter("pkt4-ack-sent");
+        nak_sent_ = stats_mgr.registerCounter("pkt4-nak-sent");
+        parse_failed_ = stats_mgr.registerCounter("pkt4-parse-failed");
+        receive_drop_ = stats_mgr.registerCounter("pkt4-receive-drop");
+    }
+};
+
+/// Handles of the packet statistics.
+Dhcp4PacketCounters PacketCounters;
+
+/// Histograms of the packet processing times. Like the counters they are
+/// registered during the DHCPv4 server startup.
+struct Dhcp4PacketHistograms {
+    StatHistogramPtr latency_;          ///< pkt4-latency
+    StatHistogramPtr unpack_;           ///< pkt4-unpack-time
+    StatHistogramPtr classify_;         ///< pkt4-classify-time
+    StatHistogramPtr subnet_select_;    ///< pkt4-subnet-select-time
+    StatHistogramPtr allocate_;         ///< pkt4-allocate-time
+    StatHistogramPtr pack_;             ///< pkt4-pack-time
+
+    /// Registers the histograms.
+    void registerHistograms() {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        latency_ = stats_mgr.registerHistogram("pkt4-latency");
+        unpack_ = stats_mgr.registerHistogram("pkt4-unpack-time");
+        classify_ = stats_mgr.registerHistogram("pkt4-classify-time");
+        subnet_select_ = stats_mgr.registerHistogram("pkt4-subnet-select-time");
+        allocate_ = stats_mgr.registerHistogram("pkt4-allocate-time");
+        pack_ = stats_mgr.registerHistogram("pkt4-pack-time");
+    }
+
+    /// Records the time elapsed since the query was received.
+    void recordLatency(const Pkt4Ptr& query) const {
+        if (!latency_) {
+            return;
+        }
+        boost::posix_time::time_duration elapsed =
+            boost::posix_time::microsec_clock::universal_time() -
+            query->getTimestamp();
+        if (!elapsed.is_negative()) {
+            latency_->record(elapsed.total_microseconds());
+        }
+    }
+};
+
+/// Handles of the packet processing time histograms.
+Dhcp4PacketHistograms PacketHistograms;
+
 } // end of anonymous namespace
 
 // Declare a Hooks object. As this is outside any function or method, it
@@ -474,7 +560,9 @@ Dhcpv4Srv::Dhcpv4Srv(uint16_t server_port, uint16_t client_port,
       use_bcast_(use_bcast), server_port_(server_port),
       client_port_(client_port),
       network_state_(new NetworkState(NetworkState::DHCPv4)),
-      cb_control_(new CBControlDHCPv4()) {
+      cb_control_(new CBControlDHCPv4()),
+      async_lease_mgr_(new AsyncLeaseMgr()),
+      async_parking_lot_(new ParkingLot()), async_clients_() {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET)
         .arg(server_port);
@@ -520,6 +608,10 @@ void Dhcpv4Srv::setPacketStatisticsDefaults() {
         // Initialize them with default value 0
         stats_mgr.setValue((*it), static_cast<int64_t>(0));
     }
+
+    // Get the handles used in the packet processing
+    PacketCounters.registerCounters();
+    PacketHistograms.registerHistograms();
 }
 
 Dhcpv4Srv::~Dhcpv4Srv() {
@@ -559,6 +651,7 @@ Dhcpv4Srv::shutdown() {
 isc::dhcp::Subnet4Ptr
 Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
                         bool sanity_only) const {
+    ScopedHistogramTimer timer(PacketHistograms.subnet_select_);
 
     // DHCPv4-over-DHCPv6 is a special (and complex) case
     if (query->isDhcp4o6()) {
@@ -893,16 +986,21 @@ Dhcpv4Srv::run_one() {
 
     CalloutHandlePtr callout_handle = getCalloutHandle(query);
     processPacketBufferSend(callout_handle, rsp);
+    PacketHistograms.recordLatency(query);
 }
 
 void
 Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
+    // The trace events are correlated by the transaction id which is
+    // set once the query is unpacked.
+    util::ScopedTraceContext trace_context;
+    util::ScopedTrace trace("processPacket");
+
     // Log reception of the packet. We need to increase it early, as any
     // failures in unpacking will cause the packet to be dropped. We
     // will increase type specific statistic further down the road.
     // See processStatsReceived().
-    isc::stats::StatsMgr::instance().addValue("pkt4-received",
-                                              static_cast<int64_t>(1));
+    PacketCounters.received_->add();
 
     bool skip_unpack = false;
 
@@ -963,6 +1061,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            ScopedHistogramTimer timer(PacketHistograms.unpack_);
             query->unpack();
         } catch (const SkipRemainingOptionsError& e) {
             // An option failed to unpack but we are to attempt to process it
@@ -980,31 +1079,33 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
                 .arg(e.what());
 
             // Increase the statistics of parse failures and dropped packets.
-            isc::stats::StatsMgr::instance().addValue("pkt4-parse-failed",
-                                                      static_cast<int64_t>(1));
-            isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                      static_cast<int64_t>(1));
+            PacketCounters.parse_failed_->add();
+            PacketCounters.receive_drop_->add();
             return;
         }
     }
 
+    trace_context.setId(query->getTransid());
+
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
     // Assign this packet to one or more classes if needed. We need to do
     // this before calling accept(), because getSubnet4() may need client
     // class information.
-    classifyPacket(query);
+    {
+        ScopedHistogramTimer timer(PacketHistograms.classify_);
+        classifyPacket(query);
 
-    // Now it is classified the deferred unpacking can be done.
-    deferredUnpack(query);
+        // Now it is classified the deferred unpacking can be done.
+        deferredUnpack(query);
+    }
 
     // Check whether the message should be further processed or discarded.
     // There is no need to log anything here. This function logs by itself.
     if (!accept(query)) {
         // Increase the statistic of dropped packets.
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
         return;
     }
 
@@ -1060,13 +1161,24 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     if (query->inClass("DROP")) {
         LOG_DEBUG(packet4_logger, DBGLVL_TRACE_BASIC, DHCP4_PACKET_DROP_0010)
             .arg(query->toText());
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
+        return;
+    }
+
+    // The processing continues from the IO service when the query was
+    // handed over to the asynchronous lease queries.
+    if (allow_packet_park && processPacketAsync(query)) {
         return;
     }
 
     AllocEngine::ClientContext4Ptr ctx;
+    processDhcp4Query(query, rsp, ctx);
+    processPacketLeasesCommitted(query, rsp, ctx, allow_packet_park);
+}
 
+void
+Dhcpv4Srv::processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                             AllocEngine::ClientContext4Ptr& ctx) {
     try {
         switch (query->getType()) {
         case DHCPDISCOVER:
@@ -1113,10 +1225,14 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
     }
+}
 
+void
+Dhcpv4Srv::processPacketLeasesCommitted(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                                        AllocEngine::ClientContext4Ptr& ctx,
+                                        bool allow_packet_park) {
     bool packet_park = false;
 
     if (ctx && HooksManager::calloutsPresent(Hooks.hook_index_leases4_committed_)) {
@@ -1180,6 +1296,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         [this, callout_handle, query, rsp]() mutable {
             processPacketPktSend(callout_handle, query, rsp);
             processPacketBufferSend(callout_handle, rsp);
+            PacketHistograms.recordLatency(query);
         });
 
         // If we have parked the packet, let's reset the pointer to the
@@ -1192,6 +1309,133 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     }
 }
 
+bool
+Dhcpv4Srv::processPacketAsync(const Pkt4Ptr& query) {
+    if (!async_lease_mgr_->isRunning()) {
+        return (false);
+    }
+
+    // Only these messages access the lease database.
+    switch (query->getType()) {
+    case DHCPDISCOVER:
+    case DHCPREQUEST:
+    case DHCPRELEASE:
+    case DHCPDECLINE:
+        break;
+    default:
+        return (false);
+    }
+
+    // Two queries of the same client processed at the same time could
+    // allocate two leases. The second one is most likely a retransmission
+    // sent while the first one waits for the database, so it is dropped.
+    // The client is identified by its hardware address and its client
+    // identifier, as the clients behind a relay may share the former.
+    std::vector<uint8_t> client;
+    if (query->getHWAddr() && !query->getHWAddr()->hwaddr_.empty()) {
+        const std::vector<uint8_t>& hwaddr = query->getHWAddr()->hwaddr_;
+        client.push_back(static_cast<uint8_t>(hwaddr.size()));
+        client.insert(client.end(), hwaddr.begin(), hwaddr.end());
+    }
+    OptionPtr client_id = query->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    if (client_id && !client_id->getData().empty()) {
+        if (client.empty()) {
+            client.push_back(0);
+        }
+        const OptionBuffer& data = client_id->getData();
+        client.insert(client.end(), data.begin(), data.end());
+    }
+    if (!client.empty() && !async_clients_.insert(client).second) {
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_DROP_0011)
+            .arg(query->getLabel());
+        PacketCounters.receive_drop_->add();
+        return (true);
+    }
+
+    // The worker thread fills the response and the context which are then
+    // used by the continuation.
+    boost::shared_ptr<Pkt4Ptr> rsp(new Pkt4Ptr());
+    boost::shared_ptr<AllocEngine::ClientContext4Ptr>
+        ctx(new AllocEngine::ClientContext4Ptr());
+
+    LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_ASYNC_PARK)
+        .arg(query->getLabel());
+
+    async_parking_lot_->reference(query);
+    async_parking_lot_->park(query, [this, query, rsp, ctx, client]() {
+        if (!client.empty()) {
+            async_clients_.erase(client);
+        }
+        Pkt4Ptr q = query;
+        processPacketLeasesCommitted(q, *rsp, *ctx, true);
+        if (*rsp) {
+            CalloutHandlePtr callout_handle = getCalloutHandle(q);
+            processPacketBufferSend(callout_handle, *rsp);
+            PacketHistograms.recordLatency(q);
+        }
+    });
+
+    ParkingLotPtr parking_lot = async_parking_lot_;
+    async_lease_mgr_->submit([this, query, rsp, ctx]() {
+        Pkt4Ptr q = query;
+        processDhcp4Query(q, *rsp, *ctx);
+    },
+    [parking_lot, query](const std::exception_ptr&) {
+        parking_lot->unpark(query, true);
+    });
+    return (true);
+}
+
+void
+Dhcpv4Srv::startAsyncLeaseQueries(size_t thread_count) {
+    if (thread_count == 0) {
+        return;
+    }
+    async_lease_mgr_->start(thread_count, getIOService());
+    LOG_INFO(dhcp4_logger, DHCP4_ASYNC_LEASE_QUERIES_STARTED)
+        .arg(thread_count);
+}
+
+void
+Dhcpv4Srv::stopAsyncLeaseQueries() {
+    async_lease_mgr_->stop();
+
+    // The continuations of the parked queries are never invoked.
+    async_parking_lot_.reset(new ParkingLot());
+    async_clients_.clear();
+}
+
+size_t
+Dhcpv4Srv::getAsyncLeaseQueryThreads(const SrvConfigPtr& cfg) {
+    data::ConstElementPtr threads =
+        cfg->getConfiguredGlobals()->get("lease-query-threads");
+    if (!threads || (threads->intValue() <= 0)) {
+        return (0);
+    }
+
+    // These hook points are invoked by the worker threads.
+    static const char* hooks[] = {
+        "subnet4_select", "host4_identifier", "lease4_select",
+        "lease4_renew", "lease4_release", "lease4_decline", "lease4_expire"
+    };
+    for (auto name : hooks) {
+        int index = ServerHooks::getServerHooks().findIndex(name);
+        if ((index >= 0) && HooksManager::calloutsPresent(index)) {
+            LOG_WARN(dhcp4_logger, DHCP4_ASYNC_LEASE_QUERIES_UNSUPPORTED)
+                .arg(std::string("callouts installed on ") + name);
+            return (0);
+        }
+    }
+
+    if (CfgMgr::instance().getD2ClientMgr().ddnsEnabled()) {
+        LOG_WARN(dhcp4_logger, DHCP4_ASYNC_LEASE_QUERIES_UNSUPPORTED)
+            .arg("DDNS updates enabled");
+        return (0);
+    }
+
+    return (static_cast<size_t>(threads->intValue()));
+}
+
 void
 Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
                                 Pkt4Ptr& query, Pkt4Ptr& rsp) {
@@ -1249,6 +1493,7 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         try {
             LOG_DEBUG(options4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_PACK)
                 .arg(rsp->getLabel());
+            ScopedHistogramTimer timer(PacketHistograms.pack_);
             rsp->pack();
         } catch (const std::exception& e) {
             LOG_ERROR(options4_logger, DHCP4_PACKET_PACK_FAIL)
@@ -1979,6 +2224,8 @@ Dhcpv4Srv::createNameChangeRequests(const Lease4Ptr& lease,
 
 void
 Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
+    ScopedHistogramTimer timer(PacketHistograms.allocate_);
+
     // Get the pointers to the query and the response messages.
     Pkt4Ptr query = ex.getQuery();
     Pkt4Ptr resp = ex.getResponse();
@@ -2919,6 +3166,14 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
                     StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-addresses"),
                     static_cast<int64_t>(-1));
 
+                // Update the utilization hint used for the shared network
+                // allocations.
+                ConstSubnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                    getCfgSubnets4()->getBySubnetId(lease->subnet_id_);
+                if (subnet) {
+                    subnet->adjustAssignedLeasesHint(Lease::TYPE_V4, -1);
+                }
+
                 // Remove existing DNS entries for the lease, if any.
                 queueNCR(CHG_REMOVE, lease);
 
@@ -3427,6 +3682,8 @@ void Dhcpv4Srv::evaluateClasses(const Pkt4Ptr& pkt, bool depend_on_known) {
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
     const ClientClassDefListPtr& defs_ptr = dict->getClasses();
+    // Results of the subexpressions shared by classes.
+    EvalCache cache;
     for (ClientClassDefList::const_iterator it = defs_ptr->cbegin();
          it != defs_ptr->cend(); ++it) {
         // Note second cannot be null
@@ -3446,7 +3703,7 @@ void Dhcpv4Srv::evaluateClasses(const Pkt4Ptr& pkt, bool depend_on_known) {
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
-            bool status = evaluateBool(*expr_ptr, *pkt);
+            bool status = (*it)->evaluateMatchExpr(*pkt, cache);
             if (status) {
                 LOG_INFO(options4_logger, EVAL_RESULT)
                     .arg((*it)->getName())
@@ -3519,6 +3776,8 @@ void Dhcpv4Srv::requiredClassify(Dhcpv4Exchange& ex) {
     // Note getClientClassDictionary() cannot be null
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
+    // Results of the subexpressions shared by classes.
+    EvalCache cache;
     for (ClientClasses::const_iterator cclass = classes.cbegin();
          cclass != classes.cend(); ++cclass) {
         const ClientClassDefPtr class_def = dict->findClass(*cclass);
@@ -3537,7 +3796,7 @@ void Dhcpv4Srv::requiredClassify(Dhcpv4Exchange& ex) {
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
-            bool status = evaluateBool(*expr_ptr, *query);
+            bool status = class_def->evaluateMatchExpr(*query, cache);
             if (status) {
                 LOG_INFO(options4_logger, EVAL_RESULT)
                     .arg(*cclass)
@@ -3701,35 +3960,35 @@ void Dhcpv4Srv::processStatsReceived(const Pkt4Ptr& query) {
     // Note that we're not bumping pkt4-received statistic as it was
     // increased early in the packet reception code.
 
-    string stat_name = "pkt4-unknown-received";
+    StatCounterPtr counter = PacketCounters.unknown_received_;
     try {
         switch (query->getType()) {
         case DHCPDISCOVER:
-            stat_name = "pkt4-discover-received";
+            counter = PacketCounters.discover_received_;
             break;
         case DHCPOFFER:
             // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-offer-received";
+            counter = PacketCounters.offer_received_;
             break;
         case DHCPREQUEST:
-            stat_name = "pkt4-request-received";
+            counter = PacketCounters.request_received_;
             break;
         case DHCPACK:
             // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-ack-received";
+            counter = PacketCounters.ack_received_;
             break;
         case DHCPNAK:
             // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-nak-received";
+            counter = PacketCounters.nak_received_;
             break;
         case DHCPRELEASE:
-            stat_name = "pkt4-release-received";
+            counter = PacketCounters.release_received_;
         break;
         case DHCPDECLINE:
-            stat_name = "pkt4-decline-received";
+            counter = PacketCounters.decline_received_;
             break;
         case DHCPINFORM:
-            stat_name = "pkt4-inform-received";
+            counter = PacketCounters.inform_received_;
             break;
         default:
             ; // do nothing
@@ -3742,34 +4001,31 @@ void Dhcpv4Srv::processStatsReceived(const Pkt4Ptr& query) {
         // name of pkt4-unknown-received.
     }
 
-    isc::stats::StatsMgr::instance().addValue(stat_name,
-                                              static_cast<int64_t>(1));
+    counter->add();
 }
 
 void Dhcpv4Srv::processStatsSent(const Pkt4Ptr& response) {
     // Increase generic counter for sent packets.
-    isc::stats::StatsMgr::instance().addValue("pkt4-sent",
-                                              static_cast<int64_t>(1));
+    PacketCounters.sent_->add();
 
     // Increase packet type specific counter for packets sent.
-    string stat_name;
+    StatCounterPtr counter;
     switch (response->getType()) {
     case DHCPOFFER:
-        stat_name = "pkt4-offer-sent";
+        counter = PacketCounters.offer_sent_;
         break;
     case DHCPACK:
-        stat_name = "pkt4-ack-sent";
+        counter = PacketCounters.ack_sent_;
         break;
     case DHCPNAK:
-        stat_name = "pkt4-nak-sent";
+        counter = PacketCounters.nak_sent_;
         break;
     default:
         // That should never happen
         return;
     }
 
-    isc::stats::StatsMgr::instance().addValue(stat_name,
-                                              static_cast<int64_t>(1));
+    counter->add();
 }
 
 int Dhcpv4Srv::getHookIndexBuffer4Receive() {
@@ -3801,6 +4057,10 @@ int Dhcpv4Srv::getHookIndexLease4Decline() {
 }
 
 void Dhcpv4Srv::discardPackets() {
+    // Stop the asynchronous lease queries, dropping the packets waiting
+    // for the lease database.
+    stopAsyncLeaseQueries();
+
     // Clear any packets held by the callhout handle store and
     // all parked packets
     isc::dhcp::Pkt4Ptr pkt4ptr_empty;
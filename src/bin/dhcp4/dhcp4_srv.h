@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,13 +16,16 @@
 #include <dhcp/option_custom.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dhcpsrv/alloc_engine.h>
+#include <dhcpsrv/async_lease_mgr.h>
 #include <dhcpsrv/cb_ctl_dhcp4.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/callout_handle_store.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/network_state.h>
+#include <dhcpsrv/srv_config.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
+#include <hooks/parking_lots.h>
 #include <process/daemon.h>
 
 #include <boost/noncopyable.hpp>
@@ -30,6 +33,8 @@
 #include <functional>
 #include <iostream>
 #include <queue>
+#include <set>
+#include <vector>
 
 // Undefine the macro OPTIONAL which is defined in some operating
 // systems but conflicts with a member of the RequirementLevel enum in
@@ -291,6 +296,39 @@ public:
     void processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp,
                        bool allow_packet_park = true);
 
+    /// @brief Starts the asynchronous lease queries.
+    ///
+    /// The DHCPDISCOVER, DHCPREQUEST, DHCPRELEASE and DHCPDECLINE messages
+    /// are then processed by the worker threads of the asynchronous lease
+    /// manager: the packet is parked after classification and its
+    /// processing is resumed from the IO service when the lease database
+    /// work is done. The main thread receives and classifies other packets
+    /// in the meantime. The multi-threading mode must be enabled.
+    ///
+    /// @param thread_count Number of worker threads. The value of 0
+    /// leaves the asynchronous lease queries disabled.
+    void startAsyncLeaseQueries(size_t thread_count);
+
+    /// @brief Stops the asynchronous lease queries.
+    ///
+    /// Waits for the lease database work in progress. The parked packets
+    /// are dropped. It must be called before the lease manager or the
+    /// configuration used by the worker threads is replaced.
+    void stopAsyncLeaseQueries();
+
+    /// @brief Returns the number of threads for the asynchronous lease
+    /// queries.
+    ///
+    /// The callouts and the name change requests are not thread safe, so
+    /// the asynchronous lease queries are disabled when callouts are
+    /// installed on hook points invoked during the lease allocation or
+    /// when DDNS updates are enabled.
+    ///
+    /// @param cfg Server configuration holding the "lease-query-threads"
+    /// global parameter.
+    /// @return Number of worker threads, 0 when disabled.
+    static size_t getAsyncLeaseQueryThreads(const SrvConfigPtr& cfg);
+
 
     /// @brief Instructs the server to shut down.
     void shutdown();
@@ -961,6 +999,43 @@ protected:
     void processPacketBufferSend(hooks::CalloutHandlePtr& callout_handle,
                                  Pkt4Ptr& rsp);
 
+    /// @brief Processes a classified DHCPv4 query.
+    ///
+    /// Calls the per-type processXXX method. This is the part of the packet
+    /// processing which accesses the lease database and which is run by
+    /// the worker threads of the asynchronous lease queries.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response.
+    /// @param ctx Client context set by the processing of a DHCPREQUEST,
+    /// DHCPRELEASE or DHCPDECLINE.
+    void processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                           AllocEngine::ClientContext4Ptr& ctx);
+
+    /// @brief Executes leases4_committed and pkt4_send callouts.
+    ///
+    /// The response is reset when the packet is dropped or parked by the
+    /// leases4_committed callouts.
+    ///
+    /// @param query A pointer to the processed packet.
+    /// @param rsp A pointer to the response.
+    /// @param ctx Client context of the query.
+    /// @param allow_packet_park Indicates if parking a packet is allowed.
+    void processPacketLeasesCommitted(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                                      AllocEngine::ClientContext4Ptr& ctx,
+                                      bool allow_packet_park);
+
+    /// @brief Submits a classified query to the asynchronous lease queries.
+    ///
+    /// The query is parked until its lease database work is done. A query
+    /// received from a client which already has a query parked, usually a
+    /// retransmission, is dropped.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @return true if the query was parked or dropped, false if it must be
+    /// processed synchronously.
+    bool processPacketAsync(const Pkt4Ptr& query);
+
     /// @brief Allocation Engine.
     /// Pointer to the allocation engine that we are currently using
     /// It must be a pointer, because we will support changing engines
@@ -1002,6 +1077,18 @@ protected:
     /// @brief Controls access to the configuration backends.
     CBControlDHCPv4Ptr cb_control_;
 
+    /// @brief Runs the lease database work of the queries.
+    AsyncLeaseMgrPtr async_lease_mgr_;
+
+    /// @brief Holds the queries waiting for their lease database work.
+    hooks::ParkingLotPtr async_parking_lot_;
+
+    /// @brief Identifiers of the clients with a parked query.
+    ///
+    /// The length of the hardware address followed by the hardware address
+    /// and the client identifier.
+    std::set<std::vector<uint8_t> > async_clients_;
+
 public:
     /// Class methods for DHCPv4-over-DHCPv6 handler
 
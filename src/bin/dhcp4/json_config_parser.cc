@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -525,9 +525,7 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                 HostCollection hosts;
                 HostReservationsListParser<HostReservationParser4> parser;
                 parser.parse(SUBNET_ID_GLOBAL, config_pair.second, hosts);
-                for (auto h = hosts.begin(); h != hosts.end(); ++h) {
-                    srv_cfg->getCfgHosts()->add(*h);
-                }
+                srv_cfg->getCfgHosts()->add(hosts);
 
                 continue;
             }
@@ -539,6 +537,18 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                 continue;
             }
 
+            if (config_pair.first == "lease-query-threads") {
+                int64_t threads = config_pair.second->intValue();
+                if ((threads < 0) || (threads > 1024)) {
+                    isc_throw(DhcpConfigError, "lease-query-threads must be"
+                              " between 0 and 1024, got " << threads
+                              << " (" << config_pair.second->getPosition() << ")");
+                }
+                CfgMgr::instance().getStagingCfg()->addConfiguredGlobal(config_pair.first,
+                                                                        config_pair.second);
+                continue;
+            }
+
             // As of Kea 1.6.0 we have two ways of inheriting the global parameters.
             // The old method is used in JSON configuration parsers when the global
             // parameters are derived into the subnets and shared networks and are
@@ -567,6 +577,8 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                  (config_pair.first == "calculate-tee-times") ||
                  (config_pair.first == "t1-percent") ||
                  (config_pair.first == "t2-percent") ||
+                 (config_pair.first == "cache-threshold") ||
+                 (config_pair.first == "cache-max-age") ||
                  (config_pair.first == "loggers") ||
                  (config_pair.first == "hostname-char-set") ||
                  (config_pair.first == "hostname-char-replacement") ||
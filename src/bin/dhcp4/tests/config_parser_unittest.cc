@@ -1608,6 +1608,41 @@ TEST_F(Dhcp4ParserTest, echoClientId) {
     CfgMgr::instance().getStagingCfg()->setEchoClientId(true);
 }
 
+// This test checks that the lease-query-threads parameter is stored in the
+// configured globals and that the thread count is verified.
+TEST_F(Dhcp4ParserTest, leaseQueryThreads) {
+    string config = "{ " + genIfaceConfig() + "," +
+        "\"lease-query-threads\": 4,"
+        "\"subnet4\": [ { "
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\" } ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 0);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getStagingCfg();
+    ConstElementPtr threads = cfg->getConfiguredGlobals()->get("lease-query-threads");
+    ASSERT_TRUE(threads);
+    EXPECT_EQ(4, threads->intValue());
+    EXPECT_EQ(4, Dhcpv4Srv::getAsyncLeaseQueryThreads(cfg));
+
+    // The asynchronous lease queries are disabled by default.
+    CfgMgr::instance().clear();
+    EXPECT_EQ(0, Dhcpv4Srv::getAsyncLeaseQueryThreads(CfgMgr::instance().getStagingCfg()));
+
+    // A negative thread count is rejected.
+    config = "{ " + genIfaceConfig() + "," +
+        "\"lease-query-threads\": -1,"
+        "\"valid-lifetime\": 4000 }";
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+}
+
 // This test checks that the global match-client-id parameter is optional
 // and that values under the subnet are used.
 TEST_F(Dhcp4ParserTest, matchClientIdNoGlobal) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -30,12 +30,15 @@
 #include <dhcp4/tests/dhcp4_client.h>
 #include <boost/shared_ptr.hpp>
 #include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+#include <unistd.h>
 
 using namespace isc;
 using namespace isc::asiolink;
 using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::dhcp::test;
+using namespace isc::util;
 
 namespace {
 
@@ -570,6 +573,27 @@ public:
     ~DORATest() {
         // Let's wipe all existing statistics.
         isc::stats::StatsMgr::instance().removeAll();
+
+        // Some tests enable the asynchronous lease queries.
+        MultiThreadingMgr::instance().setMode(false);
+    }
+
+    /// @brief Waits for the response to a query parked by the asynchronous
+    /// lease queries.
+    ///
+    /// @param client Client which sent the query.
+    void waitResponse(Dhcp4Client& client) {
+        // Give up after 10 seconds.
+        for (unsigned int i = 0; i < 10000; ++i) {
+            client.getServer()->getIOService()->poll();
+            client.receiveResponse();
+            if (client.getContext().response_) {
+                return;
+            }
+            usleep(1000);
+        }
+        ADD_FAILURE() << "no response to the query parked by the"
+            " asynchronous lease queries";
     }
 
     /// @brief Test that server returns the same lease for the client which is
@@ -2188,6 +2212,118 @@ TEST_F(DORATest, changingCircuitId) {
     EXPECT_NE("10.0.0.9", client.config_.lease_.addr_.toText());
 }
 
+// This test verifies that the DHCPDISCOVER and DHCPREQUEST are parked
+// while their lease database work is done by the asynchronous lease
+// queries, and that the responses are sent when they are unparked.
+TEST_F(DORATest, asyncLeaseQueries) {
+    Dhcp4Client client(Dhcp4Client::SELECTING);
+    // Configure DHCP server.
+    configure(DORA_CONFIGS[0], *client.getServer());
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_THROW(client.getServer()->startAsyncLeaseQueries(2));
+
+    // The DHCPOFFER is sent when the IO service runs the continuation.
+    ASSERT_NO_THROW(client.doDiscover());
+    EXPECT_FALSE(client.getContext().response_);
+    waitResponse(client);
+    ASSERT_TRUE(client.getContext().response_);
+    ASSERT_EQ(DHCPOFFER, static_cast<int>(client.getContext().response_->getType()));
+
+    // Same for the DHCPACK.
+    ASSERT_NO_THROW(client.doRequest());
+    EXPECT_FALSE(client.getContext().response_);
+    waitResponse(client);
+    ASSERT_TRUE(client.getContext().response_);
+    ASSERT_EQ(DHCPACK, static_cast<int>(client.getContext().response_->getType()));
+
+    // The lease has been stored.
+    Lease4Ptr lease = LeaseMgrFactory::instance().getLease4(client.config_.lease_.addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*lease->hwaddr_ == *client.getHWAddress());
+}
+
+// This test verifies that a query received from a client which has a query
+// parked by the asynchronous lease queries is dropped.
+TEST_F(DORATest, asyncLeaseQueriesRetransmission) {
+    Dhcp4Client client(Dhcp4Client::SELECTING);
+    // Configure DHCP server.
+    configure(DORA_CONFIGS[0], *client.getServer());
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_THROW(client.getServer()->startAsyncLeaseQueries(2));
+
+    // Send the DHCPDISCOVER twice before the first one is unparked.
+    ASSERT_NO_THROW(client.doDiscover());
+    ASSERT_NO_THROW(client.doDiscover());
+    isc::stats::ObservationPtr drop_stat =
+        isc::stats::StatsMgr::instance().getObservation("pkt4-receive-drop");
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(1, drop_stat->getInteger().first);
+
+    // Only one DHCPOFFER is sent.
+    waitResponse(client);
+    ASSERT_TRUE(client.getContext().response_);
+    EXPECT_EQ(DHCPOFFER, static_cast<int>(client.getContext().response_->getType()));
+    client.getServer()->getIOService()->poll();
+    client.receiveResponse();
+    EXPECT_FALSE(client.getContext().response_);
+
+    // The client may send a new query once the previous one is processed.
+    ASSERT_NO_THROW(client.doDiscover());
+    waitResponse(client);
+    ASSERT_TRUE(client.getContext().response_);
+}
+
+// This test verifies that the queries of two clients sharing a hardware
+// address but using different client identifiers are both parked.
+TEST_F(DORATest, asyncLeaseQueriesSharedHWAddr) {
+    Dhcp4Client client1(Dhcp4Client::SELECTING);
+    // Configure DHCP server.
+    configure(DORA_CONFIGS[0], *client1.getServer());
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_THROW(client1.getServer()->startAsyncLeaseQueries(2));
+
+    Dhcp4Client client2(client1.getServer(), Dhcp4Client::SELECTING);
+    client1.setHWAddress("aa:bb:cc:dd:ee:ff");
+    client1.includeClientId("01:02:03:04");
+    client2.setHWAddress("aa:bb:cc:dd:ee:ff");
+    client2.includeClientId("05:06:07:08");
+
+    ASSERT_NO_THROW(client1.doDiscover());
+    ASSERT_NO_THROW(client2.doDiscover());
+    isc::stats::ObservationPtr drop_stat =
+        isc::stats::StatsMgr::instance().getObservation("pkt4-receive-drop");
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(0, drop_stat->getInteger().first);
+
+    waitResponse(client1);
+    ASSERT_TRUE(client1.getContext().response_);
+    EXPECT_EQ(DHCPOFFER, static_cast<int>(client1.getContext().response_->getType()));
+    waitResponse(client2);
+    ASSERT_TRUE(client2.getContext().response_);
+    EXPECT_EQ(DHCPOFFER, static_cast<int>(client2.getContext().response_->getType()));
+}
+
+// This test verifies that the queries parked by the asynchronous lease
+// queries are dropped when they are stopped.
+TEST_F(DORATest, asyncLeaseQueriesStop) {
+    Dhcp4Client client(Dhcp4Client::SELECTING);
+    // Configure DHCP server.
+    configure(DORA_CONFIGS[0], *client.getServer());
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_THROW(client.getServer()->startAsyncLeaseQueries(1));
+
+    ASSERT_NO_THROW(client.doDiscover());
+    client.getServer()->stopAsyncLeaseQueries();
+    client.getServer()->getIOService()->poll();
+    client.receiveResponse();
+    EXPECT_FALSE(client.getContext().response_);
+
+    // The queries are processed synchronously when stopped.
+    ASSERT_NO_THROW(client.doDiscover());
+    ASSERT_TRUE(client.getContext().response_);
+    EXPECT_EQ(DHCPOFFER, static_cast<int>(client.getContext().response_->getType()));
+}
+
 // Starting tests which require MySQL backend availability. Those tests
 // will not be executed if Kea has been compiled without the
 // --with-mysql.
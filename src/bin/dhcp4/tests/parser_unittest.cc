@@ -299,6 +299,23 @@ TEST(ParserTest, globalParameters) {
     EXPECT_NO_THROW(parser.checkKeywords(parser.GLOBAL4_PARAMETERS, json));
 }
 
+// Check that background-reclamation is accepted in expired-leases-processing.
+TEST(ParserTest, backgroundReclamation) {
+    string txt = "{ \"Dhcp4\": { \"expired-leases-processing\": {"
+        " \"background-reclamation\": true, \"max-reclaim-leases\": 100 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr tmp = json->get("Dhcp4")->get("expired-leases-processing");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("background-reclamation");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::boolean, tmp->getType());
+    EXPECT_TRUE(tmp->boolValue());
+}
+
 // Basic test that checks if it's possible to specify outbound-interface.
 TEST(ParserTest, outboundIface) {
     std::string fname = string(CFG_EXAMPLES) + "/" + "advanced.json";
@@ -607,6 +624,154 @@ TEST(ParserTest, errors) {
               "(previous at <string>:2:19)");
 }
 
+// Check that lease-query-threads is accepted as a global parameter.
+TEST(ParserTest, leaseQueryThreads) {
+    string txt = "{ \"Dhcp4\": { \"lease-query-threads\": 4,"
+        " \"lease-database\": { \"type\": \"memfile\" } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr tmp = json->get("Dhcp4")->get("lease-query-threads");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::integer, tmp->getType());
+    EXPECT_EQ(4, tmp->intValue());
+
+    // The value must be an integer.
+    testError("{ \"Dhcp4\": { \"lease-query-threads\": \"4\" } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.37-39: syntax error, unexpected constant string, "
+              "expecting integer");
+}
+
+// Check that allocate-or-renew is accepted in lease-database only.
+TEST(ParserTest, allocateOrRenew) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+        " \"type\": \"mysql\", \"name\": \"keatest\","
+        " \"allocate-or-renew\": true } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr tmp = json->get("Dhcp4")->get("lease-database");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("allocate-or-renew");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::boolean, tmp->getType());
+    EXPECT_TRUE(tmp->boolValue());
+
+    testError("{ \"Dhcp4\": { \"hosts-database\": {"
+              " \"allocate-or-renew\": true } } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.34-52: got unexpected keyword "
+              "\"allocate-or-renew\" in hosts-database map.");
+}
+
+// Check that the write-behind cache parameters are accepted in
+// lease-database.
+TEST(ParserTest, writeBehindCache) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+        " \"type\": \"mysql\", \"name\": \"keatest\","
+        " \"write-behind-cache\": true, \"write-back-latency\": 50,"
+        " \"cache-journal\": \"/tmp/kea-leases4.journal\" } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr db = json->get("Dhcp4")->get("lease-database");
+    ASSERT_TRUE(db);
+
+    ConstElementPtr tmp = db->get("write-behind-cache");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::boolean, tmp->getType());
+    EXPECT_TRUE(tmp->boolValue());
+
+    tmp = db->get("write-back-latency");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::integer, tmp->getType());
+    EXPECT_EQ(50, tmp->intValue());
+
+    tmp = db->get("cache-journal");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::string, tmp->getType());
+    EXPECT_EQ("/tmp/kea-leases4.journal", tmp->stringValue());
+
+    testError("{ \"Dhcp4\": { \"hosts-database\": {"
+              " \"write-behind-cache\": true } } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.34-53: got unexpected keyword "
+              "\"write-behind-cache\" in hosts-database map.");
+}
+
+// Check that the lease reuse parameters are accepted at the global,
+// shared network and subnet levels.
+TEST(ParserTest, leaseCaching) {
+    string txt = "{ \"Dhcp4\": { \"cache-threshold\": 0.25,"
+        " \"cache-max-age\": 1000,"
+        " \"shared-networks\": [ { \"name\": \"foo\","
+        " \"cache-threshold\": 0.5, \"cache-max-age\": 2000,"
+        " \"subnet4\": [ { \"subnet\": \"192.0.2.0/24\","
+        " \"cache-threshold\": 0.1, \"cache-max-age\": 3000 } ] } ] } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr global = json->get("Dhcp4");
+    ASSERT_TRUE(global);
+    ConstElementPtr network = global->get("shared-networks")->get(0);
+    ASSERT_TRUE(network);
+    ConstElementPtr subnet = network->get("subnet4")->get(0);
+    ASSERT_TRUE(subnet);
+
+    ConstElementPtr tmp = global->get("cache-threshold");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::real, tmp->getType());
+    EXPECT_DOUBLE_EQ(0.25, tmp->doubleValue());
+    tmp = network->get("cache-max-age");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::integer, tmp->getType());
+    EXPECT_EQ(2000, tmp->intValue());
+    tmp = subnet->get("cache-threshold");
+    ASSERT_TRUE(tmp);
+    EXPECT_DOUBLE_EQ(0.1, tmp->doubleValue());
+    tmp = subnet->get("cache-max-age");
+    ASSERT_TRUE(tmp);
+    EXPECT_EQ(3000, tmp->intValue());
+}
+
+// Check that read-replicas is accepted in lease-database and
+// hosts-database.
+TEST(ParserTest, readReplicas) {
+    string txt = "{ \"Dhcp4\": {"
+        " \"lease-database\": { \"type\": \"mysql\", \"name\": \"keatest\","
+        " \"read-replicas\": \"192.0.2.2,192.0.2.3\" },"
+        " \"hosts-database\": { \"type\": \"postgresql\","
+        " \"name\": \"keatest\","
+        " \"read-replicas\": \"192.0.2.4\" } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr tmp = json->get("Dhcp4")->get("lease-database");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("read-replicas");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::string, tmp->getType());
+    EXPECT_EQ("192.0.2.2,192.0.2.3", tmp->stringValue());
+
+    tmp = json->get("Dhcp4")->get("hosts-database");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("read-replicas");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::string, tmp->getType());
+    EXPECT_EQ("192.0.2.4", tmp->stringValue());
+}
+
 // Check unicode escapes
 TEST(ParserTest, unicodeEscapes) {
     ConstElementPtr result;
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -19,6 +19,8 @@
 #include <hooks/hooks.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+#include <util/trace_mgr.h>
 #include <cfgrpt/config_report.h>
 #include <signal.h>
 #include <sstream>
@@ -29,6 +31,7 @@ using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::stats;
+using namespace isc::util;
 using namespace std;
 
 namespace {
@@ -547,6 +550,29 @@ ControlledDhcpv6Srv::commandServerTagGetHandler(const std::string&,
     return (createAnswer(CONTROL_RESULT_SUCCESS, response));
 }
 
+ConstElementPtr
+ControlledDhcpv6Srv::commandTraceStartHandler(const std::string&,
+                                            ConstElementPtr) {
+    isc::util::TraceMgr::instance().clear();
+    isc::util::TraceMgr::instance().setEnabled(true);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, "Tracing started."));
+}
+
+ConstElementPtr
+ControlledDhcpv6Srv::commandTraceStopHandler(const std::string&,
+                                           ConstElementPtr) {
+    isc::util::TraceMgr::instance().setEnabled(false);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, "Tracing stopped."));
+}
+
+ConstElementPtr
+ControlledDhcpv6Srv::commandTraceGetHandler(const std::string&,
+                                          ConstElementPtr) {
+    std::ostringstream s;
+    isc::util::TraceMgr::instance().toChromeTrace(s);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, Element::fromJSON(s.str())));
+}
+
 ConstElementPtr
 ControlledDhcpv6Srv::commandConfigBackendPullHandler(const std::string&,
                                                      ConstElementPtr) {
@@ -710,6 +736,16 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
             boost::bind(&ControlledDhcpv6Srv::dbLostCallback, srv, _1);
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
         cfg_db->setAppendedParameters("universe=6");
+
+        // The background reclamation must not use the lease manager being
+        // replaced. The lease manager is used from two threads when it is
+        // enabled by the new configuration.
+        if (srv->alloc_engine_) {
+            srv->alloc_engine_->stopBackgroundReclamation();
+        }
+        MultiThreadingMgr::instance().setMode(CfgMgr::instance().getStagingCfg()->
+            getCfgExpiration()->getBackgroundReclamation());
+
         cfg_db->createManagers();
     } catch (const std::exception& ex) {
         return (isc::config::createAnswer(1, "Unable to open database: "
@@ -871,7 +907,8 @@ ControlledDhcpv6Srv::checkConfig(isc::data::ConstElementPtr config) {
 ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
                                          uint16_t client_port)
     : Dhcpv6Srv(server_port, client_port), io_service_(),
-      timer_mgr_(TimerMgr::instance()) {
+      timer_mgr_(TimerMgr::instance()),
+      main_thread_id_(std::this_thread::get_id()), db_lost_posted_(false) {
     if (server_) {
         isc_throw(InvalidOperation,
                   "There is another Dhcpv6Srv instance already.");
@@ -907,6 +944,9 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     CommandMgr::instance().registerCommand("dhcp-disable",
         boost::bind(&ControlledDhcpv6Srv::commandDhcpDisableHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("hooks-stats-get",
+        boost::bind(&HooksManager::hooksStatsGetHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("dhcp-enable",
         boost::bind(&ControlledDhcpv6Srv::commandDhcpEnableHandler, this, _1, _2));
 
@@ -928,6 +968,15 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     CommandMgr::instance().registerCommand("status-get",
         boost::bind(&ControlledDhcpv6Srv::commandStatusGetHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("trace-get",
+        boost::bind(&ControlledDhcpv6Srv::commandTraceGetHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("trace-start",
+        boost::bind(&ControlledDhcpv6Srv::commandTraceStartHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("trace-stop",
+        boost::bind(&ControlledDhcpv6Srv::commandTraceStopHandler, this, _1, _2));
+
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv6Srv::commandVersionGetHandler, this, _1, _2));
 
@@ -938,6 +987,9 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     CommandMgr::instance().registerCommand("statistic-get-all",
         boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-get-all-prometheus",
+        boost::bind(&StatsMgr::statisticGetAllPrometheusHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("statistic-reset",
         boost::bind(&StatsMgr::statisticResetHandler, _1, _2));
 
@@ -970,6 +1022,12 @@ void ControlledDhcpv6Srv::shutdown() {
 
 ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
     try {
+        // Wait for the background reclamation before the lease manager
+        // is destroyed.
+        if (alloc_engine_) {
+            alloc_engine_->stopBackgroundReclamation();
+        }
+
         cleanup();
 
         // The closure captures either a shared pointer (memory leak)
@@ -991,12 +1049,14 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("config-write");
         CommandMgr::instance().deregisterCommand("dhcp-disable");
         CommandMgr::instance().deregisterCommand("dhcp-enable");
+        CommandMgr::instance().deregisterCommand("hooks-stats-get");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("server-tag-get");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
+        CommandMgr::instance().deregisterCommand("statistic-get-all-prometheus");
         CommandMgr::instance().deregisterCommand("statistic-remove");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
         CommandMgr::instance().deregisterCommand("statistic-reset");
@@ -1006,6 +1066,9 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set-all");
         CommandMgr::instance().deregisterCommand("status-get");
+        CommandMgr::instance().deregisterCommand("trace-get");
+        CommandMgr::instance().deregisterCommand("trace-start");
+        CommandMgr::instance().deregisterCommand("trace-stop");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
@@ -1031,6 +1094,17 @@ ControlledDhcpv6Srv::reclaimExpiredLeases(const size_t max_leases,
                                           const uint16_t timeout,
                                           const bool remove_lease,
                                           const uint16_t max_unwarned_cycles) {
+    if (CfgMgr::instance().getCurrentCfg()->getCfgExpiration()->
+        getBackgroundReclamation()) {
+        // The timer is re-scheduled when the pass is complete.
+        server_->alloc_engine_->reclaimExpiredLeases6InBackground(
+            max_leases, timeout, remove_lease, max_unwarned_cycles,
+            server_->getIOService(), [] () {
+                TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+            });
+        return;
+    }
+
     server_->alloc_engine_->reclaimExpiredLeases6(max_leases, timeout,
                                                   remove_lease,
                                                   max_unwarned_cycles);
@@ -1051,6 +1125,17 @@ ControlledDhcpv6Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
 
     // Re-open lease and host database with new parameters.
     try {
+        // The background reclamation pass in progress is cancelled so the
+        // reclamation timer has to be re-scheduled.
+        if (alloc_engine_ && CfgMgr::instance().getCurrentCfg()->
+            getCfgExpiration()->getBackgroundReclamation()) {
+            alloc_engine_->stopBackgroundReclamation();
+            if (TimerMgr::instance()->
+                isTimerRegistered(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME)) {
+                TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+            }
+        }
+
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getCurrentCfg()->getCfgDbAccess();
         cfg_db->createManagers();
         reopened = true;
@@ -1095,6 +1180,19 @@ ControlledDhcpv6Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
 
 bool
 ControlledDhcpv6Srv::dbLostCallback(ReconnectCtlPtr db_reconnect_ctl) {
+    // The recovery stops the threads using the lease manager, so it must
+    // not run in one of them.
+    if (std::this_thread::get_id() != main_thread_id_) {
+        if (!db_lost_posted_.exchange(true)) {
+            getIOService()->post([this, db_reconnect_ctl]() {
+                db_lost_posted_ = false;
+                dbLostCallback(db_reconnect_ctl);
+            });
+        }
+        return (db_reconnect_ctl && db_reconnect_ctl->retriesLeft() &&
+                db_reconnect_ctl->retryInterval());
+    }
+
     // Disable service until we recover
     network_state_->disableService();
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,6 +15,9 @@
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp6/dhcp6_srv.h>
 
+#include <atomic>
+#include <thread>
+
 namespace isc {
 namespace dhcp {
 
@@ -328,6 +331,41 @@ private:
     commandStatusGetHandler(const std::string& command,
                             isc::data::ConstElementPtr args);
 
+    /// @brief handler for processing 'trace-start' command
+    ///
+    /// This handler clears the trace rings and enables the tracing of
+    /// the packet processing.
+    ///
+    /// @param command (ignored)
+    /// @param args (ignored)
+    /// @return status of the command
+    isc::data::ConstElementPtr
+    commandTraceStartHandler(const std::string& command,
+                             isc::data::ConstElementPtr args);
+
+    /// @brief handler for processing 'trace-stop' command
+    ///
+    /// This handler disables the tracing, the recorded events are kept.
+    ///
+    /// @param command (ignored)
+    /// @param args (ignored)
+    /// @return status of the command
+    isc::data::ConstElementPtr
+    commandTraceStopHandler(const std::string& command,
+                            isc::data::ConstElementPtr args);
+
+    /// @brief handler for processing 'trace-get' command
+    ///
+    /// This handler returns the recorded events in the Chrome trace
+    /// event format.
+    ///
+    /// @param command (ignored)
+    /// @param args (ignored)
+    /// @return the trace wrapped in a response
+    isc::data::ConstElementPtr
+    commandTraceGetHandler(const std::string& command,
+                           isc::data::ConstElementPtr args);
+
     /// @brief Reclaims expired IPv6 leases and reschedules timer.
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases6.
@@ -424,6 +462,13 @@ private:
     /// Shared pointer to the instance of timer @c TimerMgr is held here to
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Identifier of the thread running the server.
+    std::thread::id main_thread_id_;
+
+    /// @brief Indicates that the recovery of a connection lost by another
+    /// thread has been posted to the IO service.
+    std::atomic<bool> db_lost_posted_;
 };
 
 }; // namespace isc::dhcp
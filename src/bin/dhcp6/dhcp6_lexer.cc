@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 201
-#define YY_END_OF_BUFFER 202
+#define YY_NUM_RULES 214
+#define YY_END_OF_BUFFER 215
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,201 +700,218 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1758] =
+static const flex_int16_t yy_accept[1905] =
     {   0,
-      194,  194,    0,    0,    0,    0,    0,    0,    0,    0,
-      202,  200,   10,   11,  200,    1,  194,  191,  194,  194,
-      200,  193,  192,  200,  200,  200,  200,  200,  187,  188,
-      200,  200,  200,  189,  190,    5,    5,    5,  200,  200,
-      200,   10,   11,    0,    0,  183,    0,    0,    0,    0,
+      207,  207,    0,    0,    0,    0,    0,    0,    0,    0,
+      215,  213,   10,   11,  213,    1,  207,  204,  207,  207,
+      213,  206,  205,  213,  213,  213,  213,  213,  200,  201,
+      213,  213,  213,  202,  203,    5,    5,    5,  213,  213,
+      213,   10,   11,    0,    0,  196,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  194,
-      194,    0,  193,  194,    3,    2,    6,    0,  194,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        1,  207,  207,    0,  206,    3,    2,    6,    0,  207,
+        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
 
-      184,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  186,    0,    0,    0,
+      197,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  199,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    2,    0,    0,    0,    0,    0,    0,    0,
-        8,    0,    0,    0,    0,  158,    0,    0,  159,    0,
+        0,    0,    8,    0,    0,    0,    0,  170,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,  185,    0,    0,
+      171,    0,    0,    0,    0,    0,    0,    0,  198,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  109,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  113,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,  199,  197,    0,  196,  195,    0,    0,
-        0,    0,    0,    0,    0,  157,    0,    0,   28,    0,
-       27,    0,    0,  116,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   55,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  212,
+      210,    0,  209,  208,    0,    0,    0,    0,    0,    0,
+        0,  169,    0,    0,   28,    0,   27,    0,    0,  120,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   59,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  113,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  117,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  198,  195,    0,    0,    0,    0,    0,
-        0,    0,    0,   29,    0,    0,   31,    0,    0,    0,
-        0,    0,    0,    0,  117,    0,    0,    0,    0,    0,
-        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
-        0,  142,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   58,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   93,    0,
+        0,    0,    0,    0,  211,  208,    0,    0,    0,    0,
+        0,    0,    0,    0,   29,    0,    0,   31,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  121,    0,
+        0,    0,    0,    0,    0,    0,   98,    0,    0,    0,
+        0,    0,    0,    0,    0,  154,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   62,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  103,    0,   59,    0,    0,    0,    0,    0,
+        0,    0,   97,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  107,    0,   63,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  137,  162,   51,    0,
-       56,    0,    0,    0,    0,    0,    0,  180,   37,    0,
-       34,    0,   33,    0,    0,    0,  150,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  149,  174,   55,    0,   60,    0,    0,    0,
+        0,    0,    0,    0,  193,   37,    0,   34,    0,   33,
+        0,    0,    0,  162,  138,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  128,    0,    0,    0,
 
-        0,    0,    0,    0,    0,  161,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   53,    0,    0,   32,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       96,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  151,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  146,    0,    0,
-        0,    0,    0,    0,    0,    0,    7,   35,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  134,    0,    0,
+        0,    0,    0,    0,    0,    0,  173,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   57,    0,    0,
+       32,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  100,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  163,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      158,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        7,   35,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  115,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  130,    0,
-        0,    0,    0,    0,    0,    0,    0,  127,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   98,    0,    0,
+        0,    0,    0,    0,    0,  119,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  136,    0,
+        0,    0,    0,    0,    0,    0,    0,  133,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  102,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  106,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  124,    0,    0,    0,    0,    0,    0,
 
-      105,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  145,    0,
+        0,    0,    0,    0,  110,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  130,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  109,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  155,  125,    0,    0,    0,    0,
-        0,    0,    0,  129,   52,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  131,    0,   60,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  157,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   89,
+        0,    0,    0,  167,  131,    0,    0,    0,    0,    0,
+        0,    0,  135,   56,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,  181,    0,
-        0,    0,    0,  178,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  137,    0,   64,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  112,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  144,    0,    0,
-        0,    0,    0,    0,   63,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   57,   97,    0,    0,
-        0,  141,    0,    0,    0,    0,   50,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,  133,    0,    0,    0,    0,
+       93,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  194,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  191,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  116,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  156,    0,    0,    0,
+
+        0,    0,    0,   67,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  179,
+        0,    0,    0,    0,    0,   61,  101,    0,    0,    0,
+      153,    0,    0,    0,    0,    0,    0,   50,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  107,    0,    0,
+        0,    0,    0,    0,    0,    0,  145,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  192,    0,
 
-        0,   16,    0,    0,  156,   14,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  111,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   16,    0,    0,  168,   14,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  147,    0,    0,    0,    0,    0,    0,  132,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  143,  160,    0,   40,
-        0,  152,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   20,    0,    0,    0,   91,
-        0,    0,    0,    0,  154,   54,    0,   99,    0,  177,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,   82,    0,    0,    0,  122,
-      123,    0,    0,    0,    0,    0,    0,    0,    0,   95,
-        0,    0,    0,    0,    0,    0,   64,    0,    0,    0,
+      159,    0,    0,    0,    0,    0,    0,  141,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  155,  172,    0,   40,    0,
+      164,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   20,    0,    0,    0,   95,    0,
+        0,    0,    0,  166,   58,    0,  103,    0,  190,    0,
+      143,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   86,    0,
+        0,    0,  126,  127,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   99,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   68,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  149,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  118,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   92,
-      114,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   79,    0,    0,    0,    0,    0,    0,   17,
-        0,   15,    0,  174,  173,    0,   69,    0,    0,    0,
-
-        0,    0,   30,    0,  136,    0,    0,    0,    0,    0,
+        0,    0,  161,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  122,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       96,  118,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   83,    0,    0,    0,
+        0,    0,    0,   17,    0,   15,    0,  187,  186,    0,
+       73,    0,    0,    0,    0,    0,    0,    0,   30,    0,
+        0,    0,    0,    0,    0,    0,  148,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  171,  176,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  108,    0,  140,   43,    0,   61,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   19,
-        0,    0,    0,    0,    0,    0,  110,   80,    0,    0,
-      148,    0,    0,    0,    0,    0,  139,    0,    0,    0,
-        0,    0,  104,    0,  182,    0,    0,    0,    0,    0,
+        0,    0,    0,  184,  189,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  112,    0,  152,   43,
+        0,   65,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   19,    0,    0,    0,    0,    0,    0,  114,    0,
+        0,    0,   84,    0,    0,  160,    0,    0,    0,    0,
+        0,  151,    0,    0,    0,    0,    0,  108,    0,    0,
+        0,  195,    0,    0,    0,    0,   53,  129,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  102,    0,    0,  163,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  106,    0,    0,  175,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   42,    0,
-        0,   68,    0,    0,    0,    0,  134,   47,    0,    0,
-        0,   70,  172,   38,    0,    0,    0,    0,    0,    0,
-        0,    0,   12,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   45,    0,    0,   44,    0,   18,    0,    0,
-        0,   72,    0,    0,    0,    0,  126,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   54,    0,    0,    0,
+        0,    0,    0,    0,   42,    0,    0,   72,    0,    0,
+        0,    0,    0,  140,    0,    0,    0,    0,  146,   47,
+        0,    0,    0,   74,  185,   38,    0,    0,    0,    0,
+        0,    0,    0,    0,   12,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   45,    0,    0,   44,    0,   18,
+        0,    0,    0,   76,    0,    0,    0,    0,  132,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   76,    0,    0,    0,    0,   62,    0,    0,    0,
 
-        0,    0,    0,    0,    0,  100,    0,    0,    0,    0,
-        0,  153,    0,    0,    0,   46,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   80,    0,    0,    0,    0,
+        0,  128,    0,    0,    0,   66,    0,    0,    0,    0,
+        0,    0,    0,    0,  104,    0,    0,    0,    0,    0,
+      165,    0,    0,    0,   46,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   67,    0,    0,    0,   90,    0,   36,
-        0,   48,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   24,    0,    0,    0,    0,    0,
-        0,    0,  169,    0,    0,    0,    0,  138,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  111,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   83,    0,    0,
+        0,    0,    0,    0,   71,    0,    0,    0,   94,    0,
+        0,    0,   36,  139,    0,    0,   48,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   24,
+        0,    0,    0,    0,    0,    0,    0,  181,    0,    0,
+        0,    0,  150,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,  115,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   87,    0,    0,
         0,    0,    0,    0,    0,    0,   25,   39,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,   13,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  175,    0,    0,    0,    0,    0,    0,
-        0,  168,    0,   78,    0,   77,    0,   21,   73,    0,
-        0,    0,    0,    0,   65,    0,  121,    0,    0,    0,
-        0,    0,    0,    0,  101,    0,    0,  167,    0,    0,
-        0,   71,    0,    0,    0,   66,    0,   23,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  188,    0,
+        0,    0,    0,    0,    0,    0,  180,    0,   82,    0,
+       81,    0,   21,   77,    0,    0,    0,    0,    0,    0,
+        0,   69,    0,   52,   51,    0,  125,    0,    0,    0,
+        0,    0,    0,    0,  105,    0,    0,  179,    0,    0,
+
+        0,   75,    0,    0,  144,    0,    0,   70,    0,   23,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   87,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   49,    0,    0,   88,
-        0,    0,    0,    0,    0,    0,   75,   74,   22,    0,
-      119,  135,    0,    0,   84,    0,    0,    0,    0,    0,
-        0,  165,  170,    0,   86,   81,    0,    0,    0,    0,
-        0,  164,    0,    0,   26,    0,    0,    0,   85,    0,
-        0,    0,  120,    0,    0,  166,    0
+        0,    0,    0,    0,   91,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  142,    0,    0,
+        0,    0,  183,   49,    0,    0,   92,    0,    0,    0,
+        0,    0,    0,   79,   78,   22,    0,  123,  147,    0,
+        0,   88,    0,    0,    0,    0,    0,    0,  177,  182,
+        0,   90,   85,    0,    0,    0,    0,    0,  176,    0,
+        0,   26,    0,    0,    0,   89,    0,    0,    0,  124,
+
+        0,    0,  178,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -931,910 +948,1100 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1770] =
+static const flex_int16_t yy_base[1905] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2159, 2160,   34, 2155,  145,    0,  207, 2160,  214,  221,
-       13,  228, 2160, 2135,  118,   25,    2,    6, 2160, 2160,
-       73,   11,   17, 2160, 2160, 2160,  104, 2143, 2096,    0,
-     2133,  108, 2150,   24,  256, 2160,   67, 2092, 2098, 2118,
-       84,   75,  189,   88,  226,   91,   89,  284,  196,  206,
-      279,  191,  210,  197,   60,  216, 2099,  241,  284,  309,
-      297,  316, 2082,  212,  321,  345,  326, 2101,    0,  386,
-      402,  416,  423,  428, 2160,    0, 2160,  442,  447,  241,
-      242,  302,  269,  315,  303, 2160, 2098, 2139, 2160,  345,
-
-     2160,  441,  337, 2085, 2095, 2136,  352,   10,  336, 2089,
-      339,  242,  346,  360,  399, 2134,    0,  494,  411, 2076,
-      335, 2084,  417, 2080, 2069, 2070, 2075,  350, 2085, 2068,
-     2077,  421,  362,  219, 2071, 2069,  417, 2058, 2116,  422,
-     2061, 2114, 2054, 2077, 2074, 2074, 2068,  422, 2061, 2059,
-     2053, 2058, 2052,  432, 2063, 2056, 2047, 2046, 2060,  430,
-     2098, 2045,  438, 2057,  437, 2045,  502, 2046,  464, 2058,
-     2055, 2056, 2054, 2089, 2088,  419, 2034, 2039, 2035, 2027,
-     2044, 2036,    0,  460,  391,  455,  461,  458,  476, 2035,
-     2160,    0,  491, 2026, 2029, 2160,  492,  498, 2160, 2083,
-
-     2036,  489, 2081,  502, 2080,  501, 2079, 2160,  553, 2078,
-      509, 2037, 2034, 2035, 2030, 2029, 2020,  523, 2071, 2065,
-     2029, 2010, 2007, 2015, 2021, 2009, 2023, 2019, 2020, 2020,
-     2015, 2007, 2009, 1993, 1997, 2010, 2012, 2009, 2001, 1991,
-     1994, 2008, 2160, 1994, 2002, 2005, 1986, 1985, 2037, 1984,
-     1994, 2034,  525, 1993, 2032, 1980, 1991, 2029,  508, 2033,
-     1968, 1983,  328, 1973, 1989, 1970, 1968, 1971, 1967, 1973,
-     1964, 1963, 1976, 1969, 1959, 1970, 1974, 1973, 1967,  494,
-     1974, 1969, 1961, 1951, 1966, 1961, 1965,  357, 1963, 1949,
-     1955, 1962, 1950, 1947, 1946,  380, 1941, 1955, 1954, 1957,
-
-     1939, 1947,  535, 2160, 2160,  545, 2160, 2160, 1934,    0,
-      505, 1936,  579,  556, 1992, 2160, 1943,  530, 2160, 1990,
-     2160, 1984,  593, 2160,  543, 1924, 1927, 1944, 1932, 1984,
-     1939, 1934, 1937, 1932,   80, 2160, 1934,  479, 1973, 1931,
-     1928, 1929,  536, 1933, 1973, 1921, 1916, 1913, 1909, 1911,
-     1962, 1919, 1908, 1924, 1958, 1904,  616, 1917, 1917, 1900,
-     1901, 1914, 1901, 1911, 1906, 1913, 1908, 1893,  562, 1902,
-     1905, 1900,  565, 1896, 1946,  577,  551, 2160, 1940, 1890,
-     1889, 1882, 1884, 1888, 1877, 1894, 1883, 1888,  567, 1935,
-     1888,  484, 1885, 1888, 1888, 1886, 1875, 1875, 1887,  531,
-
-     1862, 1863, 1884,  580, 1866, 1863, 1877, 1880, 1875, 1861,
-     1873, 1872, 1871, 1870, 1869, 1868,  556, 1911, 1910, 1909,
-     1851,  639, 1864, 2160, 2160, 1863,    0,  597, 1851, 1904,
-     1903, 1859, 1901, 2160, 1847, 1899, 2160,  603,  667,  610,
-     1898, 1846, 1848, 1836, 2160, 1841, 1847, 1850, 1833, 1848,
-     1835, 1834, 2160, 1844,  595, 1835, 1832, 1844,  587, 1829,
-     1831, 2160, 1837, 1822, 1824, 1835, 1833, 1828,  642, 1835,
-     1823, 1816, 1867, 2160, 1814, 1830, 1864, 1868, 1824, 1818,
-     1820, 1821, 1823, 1857, 1808, 1803, 1802, 1804, 1800, 1796,
-      606, 1815, 1789, 1796, 1801, 1794, 1810, 1849, 2160, 1794,
-
-     1790, 1846, 1797, 1791, 1798, 1783, 1793, 1796, 1785, 1781,
-     1783, 1778, 2160, 1835, 2160, 1777, 1776, 1769, 1786, 1825,
-     1824, 1769, 1774, 1783, 1777, 1771, 1780,  654, 1817, 1779,
-     1762, 1762, 1757, 1753, 1759, 1764, 1757, 1765, 1769, 1752,
-     1810, 1750, 1751, 1750, 1762, 1751, 2160, 2160, 2160, 1751,
-     2160, 1761, 1797, 1757,    0, 1800, 1748, 2160, 2160, 1745,
-     2160, 1751, 2160,  618,  633,  661, 2160, 1756, 1736, 1789,
-     1734, 1787, 1732, 1731, 1730, 1737, 1730, 1738, 1741, 1723,
-     1723, 1738, 1737, 1736, 1735, 1719, 1734, 1716, 1763, 1730,
-     1768, 1712, 1714, 1726, 1726, 1725, 2160, 1710, 1707, 1765,
-
-     1720, 1712, 1718, 1709, 1717, 2160, 1702, 1713, 1717, 1699,
-     1713,  621, 1695, 1689, 1694, 1691, 1706, 1705, 1706, 1685,
-     1695, 1701, 1744, 1699, 1698, 1690, 2160, 1683, 1685, 2160,
-     1693, 1732, 1731,   16, 1692, 1675, 1676, 1679, 1680, 1671,
-     2160, 1685, 1671,  691, 1663, 1667, 1683, 1680, 1672, 1717,
-     1669, 1676, 1714, 2160, 1660, 1658, 1672, 1656, 1670, 1673,
-     1707, 1706, 1705, 1704, 1649, 1702, 1701, 2160,  670, 1663,
-     1662, 1659, 1659, 1657, 1646, 1648, 2160, 2160, 1693, 1639,
-     1696,  634,  627, 1637, 1635, 1629, 1650, 1691,  638, 1685,
-     1645, 1683, 1682, 1634, 1628, 1631, 1639, 1642, 1626, 1627,
-
-     1618, 1673, 1633, 1623, 1631, 1669, 1630,  638, 1621, 1623,
-     1627, 1664, 1668, 1623, 1622, 2160, 1623, 1616, 1605, 1618,
-     1621, 1616, 1611, 1616, 1613, 1612, 1608,   95,  230,  331,
-      338,  290,  540,  532,  641,  641,  609,  667, 2160,  673,
-      652,  651,  648,  642,  697,  660,  649, 2160,  651,  662,
-      669,  671,  715,  658,  717,  660,  675, 2160,  669,  663,
-      674,  659,  670,  683,  662,  668,  723,  687,  671,  671,
-      684,  728,  729,  731,  678,  696,  691,  698,  693,  678,
-      690,  691, 2160,  745,  703,  705,  696,  709,  711,  702,
-      708,  717,  758, 2160,  754,  730,  717,  718,  763,  713,
-
-     2160,  711,  726,  723,  709,  716,  715,  713,  732,  729,
-      730,  718,  725,  726,  735,  735,  725,  738,  724,  723,
-      729,  785,  726,  732,  749,  732,  786,  741, 2160,  751,
-      751,  744,  755,  753,  798,  740,  742,  757,  758,  746,
-      805,  762,  748,  751, 2160, 2160,  767,  766,  767,  772,
-      760,  770,  772, 2160, 2160,  772,  774,  778,  765,  763,
-      781,  768,  768,  819,  769,  827, 2160,  828, 2160,  773,
-      787,  787,  832,  780,  779,  783,  777,  837,  790,  780,
-      781,  777,  787,  791,  802,  786,  804,  799,  801,  794,
-      796,  797,  809,  799,  814,  855,  812,  817,  794, 2160,
-
-      806,  807,  821,  811,  858,  806,  821,  821, 2160,  840,
-      848,  817,  866, 2160,  832,  820,  815,  816,  828,  835,
-      824,  825,  821,  839,  825,  826,  836,  845,  881,  836,
-      831,  884,  890,  847,  839, 2160,  850,  853,  838,  854,
-      844,  856,  850,  897,  863,  847,  848, 2160,  864,  867,
-      850,  852,  910,  853, 2160,  870,  873,  853,  872,  860,
-      913,  871,  867,  864,  917,  866,  919,  866,  884,  883,
-      869,  884,  876,  872,  890,  875, 2160, 2160,  883,  930,
-      883, 2160,  891,  894,  887,  940, 2160,  889,  894,  939,
-      890,  891,  903,  897,  901,  899,  897,  908,  953,  897,
-
-      902,  956,  957,  901,  913, 2160,  901,  909,  907,  904,
-      905,  914,  926,  910,  925,  926,  927,  943,  948,  930,
-      916,  918,  918,  938,  937,  928,  917,  934,  941,  984,
-      926,  946,  939,  943,  947,  930,  991,  938,  942, 2160,
-      989,  938,  936,  957,  954,  994,  945,  963,  964,  950,
-      958,  967,  947,  962,  969, 1011, 1012, 2160,  965, 1014,
-     1015,  966,  976,  978,  962,  964,  964,  971,  980,  968,
-      975,  970,  977, 1029,  976,  975,  992, 1033,  983,  987,
-      985,  983, 1038, 1039,  989, 1041, 1037, 1043,  996, 2160,
-     1001,  994,  985, 1004,  998,  993, 1003, 1000, 1005, 1001,
-
-     1013, 2160,  997,  999, 2160, 2160,  999, 1060,  999, 1018,
-     1019, 1064, 1065, 1018, 1003, 1024, 1006, 1011, 1018, 1051,
-     1042, 1074, 1031, 1018, 1020, 1037, 1032, 1036, 1081, 1029,
-     1033, 2160, 1030, 1026, 1043, 1023, 1044, 1034, 2160, 1049,
-     1047, 1050, 1034, 1050, 1037, 1097, 1050, 1055, 1042, 1054,
-     1046, 1052, 1048, 1066, 1067, 1068, 2160, 2160, 1066, 2160,
-     1068, 2160, 1053, 1054, 1073, 1063, 1115, 1072, 1069, 1113,
-     1077, 1066, 1073, 1078, 1075, 2160, 1073, 1065, 1126, 2160,
-     1127, 1074, 1081, 1125, 2160, 2160, 1083, 2160, 1074, 2160,
-     1074, 1077, 1091, 1096, 1079, 1090, 1139, 1096, 1097, 1098,
-
-     1138, 1094, 1145, 1098, 1147, 2160, 1094, 1149, 1150, 2160,
-     2160, 1090, 1152, 1111, 1095, 1107, 1097, 1127, 1158, 2160,
-     1115, 1160, 1107, 1122, 1158, 1110, 2160, 1106, 1122, 1110,
-     1124, 1125, 1122, 1166, 1129, 1133, 1121, 1121, 1176, 1177,
-     1134, 2160, 1136, 1135, 1137, 1130, 1139, 1140, 1138, 1128,
-     1131, 1131, 1190, 1137, 1192, 1193, 1136, 1195, 2160, 1154,
-     1133, 1148, 1141, 1144, 1157, 1160, 1160, 1206, 1160, 2160,
-     2160, 1156, 1166, 1151, 1167, 1153, 1214, 1215, 1159, 1169,
-     1218, 1175, 2160, 1167, 1167, 1169, 1171, 1224, 1167, 2160,
-     1168, 2160, 1170, 2160, 2160, 1184, 2160, 1178, 1230, 1179,
-
-     1232, 1212, 2160, 1229, 2160, 1177, 1185, 1179, 1176, 1179,
-     1182, 1182, 1178, 1200, 1239, 1192, 1204, 1207, 1189, 1249,
-     1197, 2160, 2160, 1193, 1252, 1205, 1196, 1211, 1212, 1215,
-     1215, 1212, 1256, 1218, 2160, 1210, 2160, 2160, 1220, 2160,
-     1260, 1222, 1223, 1220, 1264, 1212, 1227, 1267, 1229, 2160,
-     1217, 1217, 1223, 1222, 1234, 1234, 2160, 2160, 1275, 1222,
-     2160, 1239, 1224, 1224, 1226, 1232, 2160, 1287, 1229, 1239,
-     1290, 1251, 2160, 1248, 2160, 1267, 1235, 1295, 1296, 1253,
-     1258, 1240, 1300, 1301, 1302, 1298, 1262, 1259, 1255, 1248,
-     1260, 2160, 1250, 1310, 2160, 1248, 1307, 1270, 1266, 1311,
-
-     1259, 1264, 1264, 1319, 1278, 1324, 1274, 1326, 1287, 1276,
-     1270, 1330, 1272, 1281, 1274, 1290, 1335, 1277, 1294, 1279,
-     1294, 1278, 1336, 1337, 1338, 1285, 1340, 1303, 2160, 1303,
-     1290, 2160, 1301, 1350, 1320, 1304, 2160, 2160, 1295, 1306,
-     1355, 2160, 2160, 2160, 1301, 1306, 1304, 1354, 1312, 1317,
-     1308, 1306, 2160, 1364, 1310, 1361, 1304, 1309, 1370, 1318,
-     1328, 1329, 2160, 1374, 1327, 2160, 1328, 2160, 1320, 1336,
-     1324, 2160, 1334, 1335, 1336, 1342, 2160, 1381, 1347, 1340,
-     1341, 1350, 1332, 1338, 1340, 1394, 1353, 1352, 1344, 1398,
-     1347, 2160, 1400, 1349, 1402, 1344, 2160, 1347, 1357, 1401,
-
-     1349, 1364, 1351, 1357, 1357, 2160, 1361, 1356, 1355, 1415,
-     1368, 2160, 1412, 1363, 1360, 2160, 1374, 1376, 1378, 1423,
-     1376, 1373, 1381, 1375, 1428, 1369, 1371, 1379, 1369, 1385,
-     1386, 1380, 1396, 2160, 1386, 1438, 1397, 2160, 1435, 2160,
-     1397, 2160, 1437, 1399, 1400, 1385, 1386, 1394, 1448, 1444,
-     1399, 1407, 1398, 1405, 2160, 1402, 1407, 1405, 1457, 1458,
-     1415, 1402, 2160, 1417, 1418, 1419, 1420, 2160, 1410, 1422,
-     1423, 1468, 1410, 1418, 1412, 1420, 1433, 2160, 1410, 1433,
-     1418, 1418, 1433, 1426, 1425, 1436, 1423, 2160, 1428, 1484,
-     1432, 1444, 1435, 1444, 1446, 1450, 2160, 2160, 1432, 1492,
-
-     1435, 1494, 1436, 1496, 1454, 1498, 1499, 2160, 1495, 1457,
-     1454, 1459, 1446, 1505, 1442, 1507, 1460, 1461, 1451, 1468,
-     1467, 1508, 1470, 2160, 1515, 1472, 1473, 1518, 1475, 1478,
-     1473, 2160, 1522, 2160, 1475, 2160, 1484, 2160, 2160, 1466,
-     1526, 1473, 1528, 1471, 2160, 1488, 2160, 1479, 1469, 1528,
-     1494, 1487, 1483, 1480, 2160, 1480, 1482, 2160, 1487, 1497,
-     1490, 2160, 1491, 1485, 1497, 2160, 1493, 2160, 1503, 1497,
-     1505, 1550, 1491, 1493, 1490, 1514, 1507, 1498, 1552, 1499,
-     1507, 1516, 1517, 1518, 1511, 1506, 1507, 1522, 1567, 2160,
-     1513, 1525, 1570, 1519, 1518, 1525, 1512, 1527, 1532, 1577,
-
-     1578, 1579, 1536, 1581, 1582, 1525, 2160, 1541, 1585, 2160,
-     1542, 1544, 1535, 1549, 1545, 1538, 2160, 2160, 2160, 1592,
-     2160, 2160, 1593, 1554, 2160, 1595, 1596, 1551, 1550, 1551,
-     1541, 2160, 2160, 1542, 2160, 2160, 1602, 1544, 1560, 1605,
-     1562, 2160, 1602, 1551, 2160, 1609, 1551, 1553, 2160, 1564,
-     1613, 1562, 2160, 1571, 1616, 2160, 2160, 1622, 1627, 1632,
-     1637, 1642, 1647, 1652, 1655, 1629, 1634, 1636, 1649
+       74,    1,  147,    1,  215,    1,  217,    1,  231,    1,
+      236,    1,  236,  236,  288,  361,  423,    1,  246,  261,
+      233,    1,    1,  222,  437,  222,  216,  220,    1,    1,
+      202,  183,  187,    1,    1,    1,    1,  238,  197,  467,
+      237,    1,    1,  540,  591,    1,  405,  207,  217,  240,
+      419,  596,  602,  416,  636,  418,  634,  699,  400,  235,
+      618,  619,  390,  227,  570,  621,  575,  235,  616,  727,
+      410,  723,  742,  220,  580,  733,  760,  615,  318,  382,
+        1,    1,    1,    1,    1,    1,  827,    1,  679,    1,
+      747,  749,  747,  390,  404,  404,    1,  567,  619,    1,
+
+        1,  895,  747,  576,  629,  677,  764,  763,  896,  639,
+      759,  766,  865,  871,  774,  908,    1,  962,  750,  629,
+      623,  646,  755,  641,  857,  639,  630,  633,  750,  865,
+      763,  753,  765,  871,  859,  868,  761,  762,  866,  755,
+      893,  919,  859,  916,  858,  883,  887,  890,  887,  893,
+      882,  884,  880,  887,  884,  881,  898,  893,  887,  888,
+      906,  918,  946,  903,  931,  920,  946,  932,  973,  913,
+      939,  929,  951,  954,  954,  992,  993,  944,  943,  956,
+      954,  948,  967,  961,  968,  987,  993,  998,  962,  970,
+      978,  972,    1, 1029, 1013,  966,  972,    1, 1002, 1008,
+
+        1, 1033,  989, 1015, 1043, 1031, 1054, 1029,    1, 1075,
+     1056, 1017, 1018, 1009, 1013, 1017, 1023, 1028, 1032, 1033,
+     1026, 1045, 1079, 1075, 1041, 1031, 1041, 1040, 1056, 1047,
+     1065, 1066, 1066, 1068, 1066, 1060, 1064, 1065, 1056, 1077,
+     1081, 1080, 1074, 1066, 1071, 1087,    1, 1076, 1086, 1091,
+     1074, 1075, 1129, 1130, 1090, 1132, 1133, 1134, 1135, 1136,
+     1098, 1138, 1100, 1145, 1146, 1099, 1143, 1092, 1110, 1093,
+     1093, 1098, 1096, 1104, 1097, 1098, 1113, 1108, 1100, 1113,
+     1118, 1120, 1121, 1117, 1115, 1127, 1124, 1119, 1111, 1128,
+     1125, 1131, 1127, 1132, 1120, 1128, 1139, 1127, 1127, 1128,
+
+     1185, 1125, 1142, 1149, 1155, 1139, 1149, 1140, 1179,    1,
+        1, 1157,    1,    1, 1142, 1195, 1183, 1151, 1208, 1188,
+     1211,    1, 1173, 1193,    1, 1224,    1, 1220, 1234,    1,
+     1162, 1163, 1187, 1188, 1187, 1173, 1199, 1195, 1249, 1213,
+     1210, 1215, 1212, 1223,    1, 1216, 1262, 1259, 1220, 1220,
+     1223, 1276, 1242, 1270, 1220, 1217, 1216, 1222, 1227, 1280,
+     1281, 1232, 1250, 1286, 1287, 1293, 1250, 1252, 1237, 1240,
+     1256, 1245, 1257, 1254, 1263, 1260, 1247, 1251, 1261, 1266,
+     1263, 1258, 1263, 1315, 1271, 1260,    1, 1313, 1315, 1267,
+     1262, 1266, 1272, 1273, 1283, 1276, 1283, 1332, 1333, 1288,
+
+     1292, 1289, 1294, 1296, 1336, 1298, 1338, 1300, 1307, 1295,
+     1309, 1288, 1314, 1311, 1299, 1298, 1314, 1320, 1317, 1305,
+     1319, 1320, 1321, 1322, 1323, 1324, 1321, 1370, 1372, 1375,
+     1319, 1377, 1335, 1335,    1,    1, 1337, 1376, 1351, 1329,
+     1389, 1391, 1356, 1400,    1, 1348, 1402,    1, 1377, 1416,
+     1346, 1406, 1407, 1351, 1405, 1417, 1363, 1354,    1, 1361,
+     1369, 1397, 1387, 1381, 1377, 1386,    1, 1398, 1396, 1393,
+     1393, 1407, 1406, 1394, 1400,    1, 1411, 1405, 1409, 1422,
+     1422, 1421, 1470, 1431, 1421, 1416, 1469,    1, 1419, 1437,
+     1473, 1479, 1437, 1433, 1437, 1440, 1444, 1481, 1434, 1431,
+
+     1432, 1436, 1434, 1435, 1449, 1454, 1456, 1440, 1447, 1442,
+     1460, 1501,    1, 1448, 1447, 1505, 1458, 1454, 1463, 1450,
+     1462, 1467, 1458, 1456, 1460, 1457,    1, 1516,    1, 1460,
+     1461, 1462, 1475, 1517, 1518, 1473, 1467, 1470, 1475, 1486,
+     1482, 1478, 1489, 1533, 1529, 1530, 1478, 1480, 1482, 1480,
+     1483, 1491, 1488, 1498, 1504, 1489, 1549, 1491, 1494, 1495,
+     1509, 1500,    1,    1,    1, 1502,    1, 1514, 1552, 1553,
+     1515, 1556, 1560, 1510,    1,    1, 1509,    1, 1517,    1,
+     1552, 1551, 1564,    1,    1, 1527, 1517, 1533, 1544, 1527,
+     1582, 1529, 1584, 1531, 1532, 1534, 1543, 1538, 1554, 1559,
+
+     1543, 1549, 1561, 1563, 1567, 1568, 1554, 1571, 1555, 1604,
+     1573, 1613, 1559, 1563, 1577, 1579, 1580,    1, 1567, 1566,
+     1626, 1583, 1577, 1585, 1586, 1588,    1, 1575, 1588, 1594,
+     1578, 1594, 1597, 1578, 1582, 1584, 1583, 1600, 1603, 1607,
+     1608, 1600, 1608, 1653, 1610, 1611, 1605,    1, 1600, 1604,
+        1, 1614, 1655, 1656, 1662, 1620, 1606, 1609, 1614, 1617,
+     1610,    1, 1628, 1616, 1674, 1611, 1617, 1635, 1636, 1636,
+     1637, 1631, 1678, 1633, 1642, 1682,    1, 1630, 1630, 1646,
+     1632, 1648, 1653, 1689, 1690, 1691, 1692, 1639, 1694, 1695,
+        1, 1702, 1661, 1662, 1661, 1663, 1663, 1654, 1658, 1669,
+
+        1,    1, 1706, 1654, 1713, 1684, 1695, 1659, 1661, 1663,
+     1661, 1671, 1686, 1687, 1669, 1665, 1688, 1731, 1690, 1731,
+     1693, 1733, 1735, 1689, 1685, 1691, 1701, 1706, 1707, 1695,
+     1688, 1745, 1707, 1699, 1709, 1749, 1712, 1700, 1706, 1710,
+     1716, 1758, 1764, 1721, 1722,    1, 1725, 1720, 1711, 1726,
+     1731, 1728, 1725, 1732, 1731, 1732, 1730, 1738, 1735, 1780,
+     1781, 1725, 1738, 1724, 1734, 1781, 1739, 1789,    1, 1790,
+     1746, 1744, 1741, 1735, 1791, 1754, 1743,    1, 1745, 1756,
+     1757, 1759, 1803, 1746, 1805, 1748, 1763,    1, 1757, 1751,
+     1762, 1763, 1758, 1761, 1772, 1760, 1752, 1758, 1813, 1777,
+
+     1761, 1761, 1774, 1818, 1819, 1820, 1767, 1786, 1781, 1788,
+     1783, 1768, 1780, 1781,    1, 1835, 1793, 1795, 1786, 1799,
+     1802, 1793, 1799, 1808, 1809, 1850,    1, 1846, 1823, 1810,
+     1811, 1812, 1804, 1798, 1799, 1803, 1817, 1863, 1813,    1,
+     1811, 1827, 1824, 1810, 1817, 1816, 1814, 1833, 1830, 1831,
+     1819, 1826, 1827, 1836, 1836, 1827, 1840, 1826, 1825, 1831,
+     1887, 1828, 1834, 1850, 1833, 1887, 1842,    1, 1852, 1852,
+     1845, 1856, 1854, 1899, 1841, 1843, 1858, 1859, 1847, 1906,
+     1864, 1850, 1853,    1,    1, 1869, 1868, 1869, 1874, 1862,
+     1872, 1874,    1,    1, 1874, 1876, 1880, 1867, 1865, 1883,
+
+     1870, 1870, 1921, 1871, 1929,    1, 1930,    1, 1931, 1889,
+     1889, 1934, 1882, 1881, 1885, 1890, 1880, 1890, 1943, 1896,
+     1886, 1887, 1888, 1893, 1897, 1908, 1892, 1911, 1906, 1908,
+     1902, 1904, 1905, 1917, 1907, 1922, 1963, 1920, 1925, 1902,
+        1, 1914, 1915, 1929, 1919, 1966, 1914, 1929, 1933, 1929,
+     1931,    1, 1951, 1959, 1928, 1925, 1926, 1941, 1928, 1984,
+     1946, 1986,    1, 1952, 1940, 1935, 1936, 1948, 1955, 1944,
+     1945, 1941, 1959, 1945, 1947, 1957, 1967, 2003, 1958, 1953,
+     2006, 2012, 1969, 1960,    1, 1971, 1973, 1958, 1974, 1964,
+     1976, 1970, 2017, 1983, 1967, 1968,    1, 1984, 1987, 1988,
+
+     1972, 2030, 1973,    1, 1990, 1993, 1994, 1992, 1980, 2033,
+     1991, 1987, 1984, 2037, 1986, 2039, 1986, 2005, 2004, 1990,
+     2005, 1997, 1993, 2012, 1995,    1,    1, 2005, 2052, 2005,
+        1, 2013, 2016, 2017, 2003, 2063, 2019,    1, 2016, 2022,
+     2066, 2017, 2018, 2030, 2024, 2028, 2026, 2024, 2035, 2080,
+     2024, 2029, 2083, 2084, 2028, 2040,    1, 2028, 2037, 2035,
+     2032, 2033, 2042, 2054, 2038, 2052, 2053, 2054, 2051, 2056,
+     2072, 2077, 2062, 2057, 2063, 2103, 2056, 2070, 2053, 2053,
+     2055, 2055, 2075, 2074, 2065, 2067, 2070, 2078, 2121, 2063,
+     2083, 2076, 2080, 2084, 2085, 2128, 2078, 2082,    1, 2129,
+
+     2078, 2076, 2097, 2094, 2134, 2083, 2101, 2102, 2088, 2096,
+     2106, 2107, 2101, 2108, 2150, 2151,    1, 2104, 2153, 2154,
+     2106, 2116, 2119, 2102, 2104, 2105, 2112, 2121, 2109, 2116,
+     2112, 2119, 2171, 2118, 2119, 2134, 2176, 2126, 2130, 2128,
+     2126, 2181, 2182, 2132, 2184, 2180, 2186, 2139, 2188,    1,
+     2147, 2146, 2139, 2140, 2150, 2144, 2139, 2149, 2147, 2152,
+     2153, 2161,    1, 2162, 2147,    1,    1, 2148, 2208, 2147,
+     2166, 2167, 2212, 2213, 2166, 2167, 2172, 2173, 2159, 2214,
+     2167, 2169, 2202, 2193, 2225, 2175, 2222, 2171, 2189, 2193,
+     2188, 2186, 2179, 2181, 2199, 2194, 2198, 2243, 2191, 2195,
+
+        1, 2193, 2190, 2207, 2187, 2209, 2210,    1, 2214, 2213,
+     2216, 2200, 2216, 2202, 2262, 2215, 2220, 2209, 2220, 2212,
+     2218, 2214, 2232, 2233, 2234,    1,    1, 2232,    1, 2234,
+        1, 2219, 2220, 2239, 2229, 2281, 2238, 2235, 2279, 2243,
+     2232, 2239, 2244, 2241,    1, 2239, 2240, 2292,    1, 2293,
+     2240, 2247, 2291,    1,    1, 2249,    1, 2240,    1, 2240,
+        1, 2253, 2259, 2263, 2247, 2261, 2266, 2249, 2260, 2309,
+     2266, 2267, 2268, 2308, 2264, 2315, 2268, 2317,    1, 2264,
+     2319, 2320,    1,    1, 2321, 2322, 2281, 2265, 2277, 2275,
+     2284, 2269, 2299, 2330,    1, 2277, 2274, 2289, 2283, 2291,
+
+     2282, 2293, 2339, 2284, 2300, 2336, 2288,    1, 2284, 2300,
+     2288, 2302, 2303, 2300, 2344, 2307, 2311, 2312, 2299, 2354,
+     2355, 2312,    1, 2315, 2316, 2316, 2318, 2319, 2320, 2319,
+     2309, 2312, 2313, 2372, 2319, 2374, 2375, 2318, 2377,    1,
+     2335, 2336, 2329, 2322, 2327, 2340, 2343, 2342, 2389, 2342,
+        1,    1, 2338, 2348, 2349, 2349, 2335, 2396, 2344, 2393,
+     2341, 2400, 2345, 2355, 2404, 2361,    1, 2353, 2353, 2355,
+     2358, 2411, 2354,    1, 2355,    1, 2357,    1,    1, 2371,
+        1, 2372, 2417, 2366, 2379, 2415, 2421, 2401,    1, 2424,
+     2377, 2384, 2427, 2428, 2378, 2425,    1, 2373, 2382, 2376,
+
+     2373, 2376, 2379, 2379, 2380, 2397, 2436, 2389, 2401, 2406,
+     2388, 2448, 2396,    1,    1, 2392, 2451, 2404, 2395, 2410,
+     2410, 2413, 2413, 2410, 2454, 2416,    1, 2408,    1,    1,
+     2418,    1, 2458, 2420, 2421, 2418, 2462, 2410, 2425, 2465,
+     2427,    1, 2415, 2415, 2421, 2422, 2432, 2433,    1, 2420,
+     2428, 2481,    1, 2477, 2424,    1, 2441, 2426, 2427, 2429,
+     2435,    1, 2490, 2432, 2442, 2493, 2455,    1, 2452, 2438,
+     2456,    1, 2473, 2500, 2502, 2452,    1,    1, 2461, 2446,
+     2506, 2507, 2464, 2469, 2451, 2511, 2512, 2513, 2509, 2474,
+     2510, 2466, 2459, 2471,    1, 2461, 2521,    1, 2522, 2518,
+
+     2481, 2477, 2523, 2471, 2476, 2474, 2533, 2489, 2535, 2485,
+     2537, 2498, 2487, 2481, 2541, 2483, 2492, 2485, 2501, 2546,
+     2488, 2505, 2490, 2505, 2507, 2508,    1, 2509, 2549, 2550,
+     2552, 2499, 2554, 2517,    1, 2517, 2504,    1, 2515, 2564,
+     2521, 2526, 2537,    1, 2525, 2530, 2572, 2525,    1,    1,
+     2516, 2527, 2576,    1,    1,    1, 2577, 2527, 2525, 2575,
+     2533, 2538, 2529, 2530,    1, 2588, 2531, 2584, 2527, 2533,
+     2594, 2595, 2553, 2554,    1, 2599, 2552,    1, 2553,    1,
+     2544, 2559, 2547,    1, 2557, 2558, 2559, 2565,    1, 2604,
+     2570, 2563, 2564, 2556, 2556, 2575, 2557, 2563, 2565, 2619,
+
+     2620, 2577, 2569, 2623, 2624,    1, 2572, 2584, 2627, 2628,
+     2577,    1, 2578, 2631, 2574,    1, 2577, 2587, 2631, 2579,
+     2594, 2581, 2587, 2587,    1, 2591, 2586, 2585, 2645, 2598,
+        1, 2642, 2594, 2591,    1, 2605, 2607, 2610, 2655, 2608,
+     2605, 2613, 2607, 2660, 2661, 2604, 2613, 2614, 2606, 2610,
+     2622, 2623, 2617, 2633,    1, 2623, 2675, 2636,    1, 2674,
+     2638, 2639,    1,    1, 2642, 2639,    1, 2679, 2641, 2643,
+     2628, 2629, 2637, 2691, 2687, 2642, 2650, 2641, 2648,    1,
+     2645, 2650, 2648, 2700, 2701, 2658, 2645,    1, 2660, 2661,
+     2662, 2663,    1, 2653, 2665, 2666, 2711, 2672, 2673, 2655,
+
+     2663, 2657, 2665, 2678,    1, 2679, 2678, 2658, 2679, 2665,
+     2667, 2667, 2682, 2675, 2674, 2685, 2672,    1, 2677, 2733,
+     2681, 2693, 2684, 2693, 2695, 2700,    1,    1, 2682, 2742,
+     2686, 2745, 2687, 2747, 2705, 2749, 2750,    1, 2700, 2706,
+     2748, 2710, 2707, 2712, 2700, 2759, 2696, 2761, 2762, 2715,
+     2764, 2717, 2718, 2708, 2725, 2724, 2765, 2727,    1, 2772,
+     2729, 2730, 2775, 2732, 2735, 2730,    1, 2779,    1, 2732,
+        1, 2741,    1,    1, 2782, 2739, 2725, 2785, 2786, 2787,
+     2730,    1, 2747,    1,    1, 2736,    1, 2739, 2740, 2788,
+     2754, 2747, 2743, 2744,    1, 2740, 2742,    1, 2747, 2758,
+
+     2752,    1, 2753, 2747,    1, 2749, 2760,    1, 2756,    1,
+     2766, 2760, 2759, 2769, 2814, 2815, 2757, 2754, 2778, 2771,
+     2762, 2816, 2763, 2771, 2780, 2781, 2782, 2827, 2776, 2771,
+     2772, 2787, 2832, 2833,    1, 2834, 2791, 2836, 2785, 2784,
+     2791, 2793, 2794, 2799, 2844, 2845, 2846,    1, 2803, 2848,
+     2849, 2792,    1,    1, 2808, 2852,    1, 2809, 2811, 2803,
+     2817, 2818, 2806,    1,    1,    1, 2860,    1,    1, 2861,
+     2822,    1, 2864, 2865, 2867, 2820, 2821, 2811,    1,    1,
+     2812,    1,    1, 2872, 2814, 2830, 2876, 2833,    1, 2873,
+     2874,    1, 2880, 2822, 2824,    1, 2835, 2884, 2833,    1,
+
+     2842, 2887,    1,    1
     } ;
 
-static const flex_int16_t yy_def[1770] =
+static const flex_int16_t yy_def[1905] =
     {   0,
-     1758, 1758, 1759, 1759, 1758, 1758, 1758, 1758, 1758, 1758,
-     1757, 1757, 1757, 1757, 1757, 1760, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1761,
-     1757, 1757, 1757, 1762,   15, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1763,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1760, 1757,
-     1757, 1757, 1757, 1757, 1757, 1764, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1761, 1757, 1762,
-
-     1757, 1757,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1765,   45, 1763,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1764, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1766,   45,   45,   45, 1757,   45,   45, 1757,   45,
-
-       45,   45,   45,   45,   45,   45, 1765, 1757, 1763,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1767,
-       45,   45,   45,   45,   45, 1757,   45,   45, 1757,   45,
-     1757,   45, 1763, 1757,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1757, 1757, 1757, 1768,   45,   45,   45,
-       45,   45,   45, 1757,   45,   45, 1757,   45, 1763,   45,
-       45,   45,   45,   45, 1757,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45,   45,   45,   45,   45,   45,
-       45, 1757,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1757,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1757,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45, 1757,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757, 1757, 1757,   45,
-     1757,   45,   45, 1757, 1769,   45,   45, 1757, 1757,   45,
-     1757,   45, 1757,   45,   45,   45, 1757,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757,   45,   45, 1757,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1757,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1757,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1757,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1757,   45,   45,   45,   45,   45,   45,
-
-     1757,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1757,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1757, 1757,   45,   45,   45,   45,
-       45,   45,   45, 1757, 1757,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757,   45, 1757,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
-
-       45,   45,   45,   45,   45,   45,   45,   45, 1757,   45,
-       45,   45,   45, 1757,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45, 1757,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757, 1757,   45,   45,
-       45, 1757,   45,   45,   45,   45, 1757,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45, 1757,   45,   45, 1757, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1757,   45,   45,   45,   45,   45,   45, 1757,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757, 1757,   45, 1757,
-       45, 1757,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1757,   45,   45,   45, 1757,
-       45,   45,   45,   45, 1757, 1757,   45, 1757,   45, 1757,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1757,   45,   45,   45, 1757,
-     1757,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
-       45,   45,   45,   45,   45,   45, 1757,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1757,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1757,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
-     1757,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45,   45,   45,   45,   45, 1757,
-       45, 1757,   45, 1757, 1757,   45, 1757,   45,   45,   45,
-
-       45,   45, 1757,   45, 1757,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1757, 1757,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1757,   45, 1757, 1757,   45, 1757,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
-       45,   45,   45,   45,   45,   45, 1757, 1757,   45,   45,
-     1757,   45,   45,   45,   45,   45, 1757,   45,   45,   45,
-       45,   45, 1757,   45, 1757,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1757,   45,   45, 1757,   45,   45,   45,   45,   45,
+     1904,    1, 1904,    3,    2,    5,    6,    7,    8,    9,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,   17,   19,
+     1904,   19, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+       26,   27,   28, 1904, 1904, 1904,   13, 1904, 1904, 1904,
+     1904,   37,   14, 1904,   15, 1904,   45,   45,   45,   45,
+       45,   45,   48,   45,   45,   45,   49, 1904,   47,   45,
+       60,   60,   45,   51,   45,   48,   45,   45,   68,   68,
+       54,   45,   68,   45,   68,   75,   55,   56,   60,   57,
+       16,   20,   17,   25,   22, 1904, 1904, 1904,   84,   89,
+     1904, 1904, 1904,   91,   92,   93, 1904, 1904,   40, 1904,
+
+     1904, 1904,   45,   45,   45,   45,   47,   48,  106,   45,
+       45,   45,   74,  112,   68,   58,   45,  116,  103,  117,
+      117,  117,  122,  117,  117,  117,  117,  117,  117,  126,
+      122,  117,  124,  131,  131,  117,  129,  117,  138,  121,
+      117,  117,  128,  141,  140,  117,  131,  117,  117,  147,
+      117,  137,  132,  151,  120,  111,  117,  126,  143,  159,
+      117,  160,  144,  155,  164,  161,  166,  160,  163,  152,
+      170,  146,  147,  172,  148,  163,  176,  112,  153,  154,
+      117,  117,  166,  158,  133, 1904, 1904, 1904,  186,  187,
+      188, 1904, 1904, 1904,  174,  160,  181, 1904,  179,  170,
+
+     1904,  197,  149,  183,  202,  204,  205,  200, 1904,  118,
+      207,  195,  174,  170,  214,  215,  173,  213,  183,  219,
+      180,  214,  211,  177,  218,  179,  226,  184,  220,  197,
+      225,  231,  175,  231,  229,  228,  185,  237,  226,  235,
+      233,  232,  215,  196,  230,  234, 1904,  214,  240,  246,
+      239,  251,  224,  253,  203,  253,  256,  256,  256,  259,
+      249,  259,  204,  223,  264,  237,  262,  254,  250,  252,
+      244,  245,  270,  236,  271,  275,  258,  274,  227,  266,
+      261,  242,  282,  280,  278,  269,  281,  278,  279,  287,
+      284,  283,  291,  290,  268,  243,  296,  248,  272,  299,
+
+      264,  276,  294,  303,  286,  295,  291,  302, 1904, 1904,
+     1904,  309, 1904, 1904, 1904, 1904,  265,  306,  318,  304,
+      264, 1904,  307,  318, 1904,  321, 1904,  262,  210, 1904,
+      317,  265,  297,  333,  304,  289,  333,  298,  326,  335,
+      323,  340,  341,  318, 1904,  277,  339,  328,  334,  343,
+      349,  348,  351,  339,  288,  300,  318,  336,  357,  348,
+      360,  359,  305,  360,  364,  365,  342,  292,  308,  362,
+      368,  356,  367,  350,  363,  373,  365,  372,  374,  376,
+      379,  372,  355,  354,  372,  324, 1904,  364,  388,  389,
+      358,  370,  392,  393,  380,  390,  381,  384,  384,  351,
+
+      397,  397,  395,  371,  388,  403,  405,  406,  375,  408,
+      409,  394,  409,  406,  392,  369,  406,  413,  417,  415,
+      419,  421,  422,  423,  424,  425,  408,  399,  428,  429,
+      420,  430,  404,  426, 1904, 1904, 1904, 1904,  377,  396,
+      430,  441,  433,  442, 1904,  408,  444, 1904,  446,  329,
+      439,  447,  452,  431,  405,  455,  402,  416, 1904,  446,
+      400,  461,  462,  462,  440,  465, 1904,  443,  466,  456,
+      460,  418,  468,  466,  470, 1904,  434,  463,  478,  468,
+      477,  457,  455,  472,  475,  454,  455, 1904,  486,  484,
+      487,  452,  480,  482,  494,  493,  490,  491,  471,  489,
+
+      500,  474,  501,  503,  502,  497,  506,  503,  485,  508,
+      506,  492, 1904,  502,  510,  512,  494,  499,  495,  458,
+      517,  481,  514,  515,  523,  478, 1904,  516, 1904,  524,
+      530,  531,  519,  498,  534,  509,  520,  531,  518,  496,
+      521,  539,  540,  535,  535,  545,  526,  538,  548,  549,
+      548,  536,  551,  541,  543,  537,  528,  556,  553,  559,
+      522,  525, 1904, 1904, 1904,  542, 1904,  546,  545,  569,
+     1904, 1904,  557,  552, 1904, 1904,  566, 1904,  577, 1904,
+      562,  560,  573, 1904, 1904,  562,  562,  558,  511,  558,
+      570,  590,  591,  592,  594,  595,  574,  560,  554,  561,
+
+      549,  601,  600,  603,  604,  605,  596,  555,  602,  609,
+      606,  593,  609,  598,  611,  608,  616, 1904,  614,  607,
+      573,  615,  597,  622,  624,  617, 1904,  619,  628,  589,
+      628,  568,  632,  620,  634,  635,  613,  624,  638,  632,
+      640,  623,  639,  621,  643,  645,  642, 1904,  631,  587,
+     1904,  629,  612,  653,  644,  626,  634,  649,  658,  647,
+      657, 1904,  646,  658,  663,  635,  661,  640,  668,  663,
+      670,  660,  654,  625,  671,  673, 1904,  636,  667,  675,
+      679,  680,  630,  676,  684,  685,  686,  681,  687,  689,
+     1904,  644,  668,  693,  682,  656,  695,  650,  672,  699,
+
+     1904, 1904,  690,  678,  644,  688,  697,  704,  708,  709,
+      710,  698,  683,  713,  688,  666,  694,  705,  717,  703,
+      697,  720,  722,  674,  664,  659,  721,  713,  728,  726,
+      709,  723,  727,  730,  733,  732,  696,  711,  699,  739,
+      737,  736,  718,  735,  744, 1904,  717,  740,  708,  745,
+      728,  750,  748,  747,  752,  755,  714,  751,  756,  743,
+      760,  725,  762,  711,  739,  742,  753,  761, 1904,  768,
+      763,  767,  724,  715,  766,  741,  729, 1904,  712,  759,
+      780,  776,  770,  749,  783,  784,  781, 1904,  739,  786,
+      772,  791,  779,  773,  754,  777,  792,  774,  775,  795,
+
+      798,  764,  791,  799,  804,  805,  801,  800,  803,  808,
+      809,  797,  812,  813, 1904,  785,  787,  817,  796,  818,
+      782,  813,  803,  820,  758,  816, 1904,  806,  790,  820,
+      830,  831,  822,  802,  834,  835,  832,  826,  789, 1904,
+      793,  825,  837,  807,  833,  819,  790,  842,  843,  849,
+      836,  839,  852,  821,  850,  846,  854,  847,  834,  856,
+      838,  859,  860,  848,  858,  828,  853, 1904,  810,  857,
+      867,  871,  855,  866,  844,  865,  873,  877,  876,  861,
+      878,  875,  851, 1904, 1904,  869,  881,  887,  864,  845,
+      888,  870, 1904, 1904,  891,  892,  889,  841,  883,  897,
+
+      898,  863,  866,  899,  880, 1904,  905, 1904,  907,  896,
+      895,  907,  890,  902,  914,  915,  882,  871,  912,  916,
+      917,  921,  922,  914,  915,  886,  922,  926,  920,  929,
+      924,  901,  932,  931,  933,  897,  919,  911,  936,  923,
+     1904,  913,  942,  939,  918,  903,  927,  947,  928,  930,
+      950, 1904,  931,  938,  943,  904,  956,  910,  956,  946,
+      938,  960, 1904,  944,  955,  947,  966,  929,  949,  935,
+      970,  967,  969,  959,  974,  968,  964,  962,  945,  975,
+      978,  937,  961,  971, 1904,  983,  958,  972,  986,  931,
+      989,  979,  981,  977,  980,  995, 1904,  973,  994,  999,
+
+      996, 1000, 1000, 1904,  998,  999, 1006,  991, 1001,  993,
+      976,  965, 1009, 1010, 1013, 1014,  988, 1005, 1008, 1017,
+     1020,  984, 1020, 1018, 1003, 1904, 1904,  992, 1016, 1012,
+     1904, 1030, 1019, 1033, 1023,  982, 1011, 1904, 1034, 1037,
+     1029,  990, 1042, 1033, 1028, 1040, 1045, 1022, 1044, 1036,
+     1015, 1030, 1050, 1053, 1051, 1032, 1904, 1035, 1039, 1043,
+     1058, 1061, 1047, 1006, 1055, 1049, 1066, 1067, 1046, 1067,
+     1065, 1052, 1070, 1021, 1070, 1041, 1052, 1064, 1025, 1062,
+     1079, 1080, 1078, 1018, 1059, 1085, 1069, 1084, 1054, 1082,
+     1083, 1087, 1074, 1088, 1094, 1089, 1048, 1063, 1904, 1076,
+
+     1065, 1095, 1091, 1075, 1100, 1101, 1103, 1107, 1060, 1092,
+     1108, 1111, 1112, 1113, 1096, 1115, 1904, 1110, 1116, 1116,
+     1068, 1114, 1111, 1081, 1106, 1124, 1085, 1104, 1125, 1098,
+     1129, 1130, 1116, 1097, 1134, 1123, 1133, 1132, 1118, 1138,
+     1134, 1137, 1142, 1140, 1143, 1105, 1145, 1139, 1147, 1904,
+     1094, 1128, 1127, 1153, 1152, 1144, 1131, 1148, 1153, 1158,
+     1160, 1151, 1904, 1162, 1126, 1904, 1904, 1164, 1147, 1154,
+     1155, 1171, 1169, 1173, 1160, 1175, 1172, 1177, 1168, 1146,
+     1161, 1181, 1177, 1179, 1174, 1156, 1180, 1157, 1136, 1189,
+     1190, 1177, 1165, 1188, 1194, 1191, 1192, 1185, 1182, 1199,
+
+     1904, 1141, 1179, 1203, 1176, 1197, 1206, 1904, 1195, 1206,
+     1162, 1203, 1210, 1212, 1198, 1175, 1213, 1193, 1216, 1194,
+     1159, 1220, 1189, 1223, 1224, 1904, 1904, 1204, 1904, 1211,
+     1904, 1218, 1232, 1225, 1186, 1215, 1217, 1219, 1187, 1230,
+     1202, 1238, 1237, 1242, 1904, 1235, 1246, 1236, 1904, 1248,
+     1241, 1244, 1239, 1904, 1904, 1252, 1904, 1233, 1904, 1214,
+     1904, 1256, 1228, 1234, 1222, 1243, 1264, 1258, 1262, 1250,
+     1266, 1271, 1272, 1268, 1200, 1270, 1269, 1276, 1904, 1251,
+     1278, 1281, 1904, 1904, 1282, 1282, 1240, 1260, 1277, 1246,
+     1263, 1288, 1268, 1286, 1904, 1280, 1268, 1273, 1290, 1298,
+
+     1296, 1300, 1302, 1301, 1267, 1253, 1304, 1904, 1292, 1302,
+     1265, 1310, 1312, 1289, 1306, 1291, 1305, 1317, 1307, 1294,
+     1320, 1313, 1904, 1316, 1324, 1322, 1326, 1326, 1328, 1314,
+     1309, 1311, 1297, 1321, 1319, 1334, 1336, 1333, 1337, 1904,
+     1324, 1341, 1331, 1331, 1332, 1325, 1341, 1346, 1339, 1330,
+     1904, 1904, 1318, 1329, 1354, 1348, 1355, 1349, 1353, 1315,
+     1338, 1358, 1345, 1350, 1362, 1354, 1904, 1359, 1335, 1368,
+     1327, 1365, 1361, 1904, 1373, 1904, 1363, 1904, 1904, 1366,
+     1904, 1380, 1372, 1371, 1317, 1360, 1383, 1380, 1904, 1387,
+     1364, 1391, 1387, 1393, 1382, 1386, 1904, 1375, 1395, 1398,
+
+     1390, 1357, 1400, 1344, 1404, 1347, 1396, 1370, 1392, 1385,
+     1404, 1394, 1408, 1904, 1904, 1403, 1412, 1391, 1416, 1380,
+     1356, 1406, 1420, 1418, 1407, 1423, 1904, 1413, 1904, 1904,
+     1426, 1904, 1425, 1431, 1434, 1424, 1433, 1419, 1435, 1437,
+     1439, 1904, 1377, 1438, 1428, 1445, 1441, 1421, 1904, 1411,
+     1384, 1417, 1904, 1440, 1450, 1904, 1422, 1455, 1402, 1458,
+     1460, 1904, 1452, 1460, 1464, 1463, 1410, 1904, 1447, 1464,
+     1409, 1904, 1445, 1466, 1474, 1399, 1904, 1904, 1457, 1470,
+     1474, 1481, 1469, 1467, 1480, 1482, 1486, 1487, 1454, 1471,
+     1489, 1476, 1485, 1436, 1904, 1493, 1488, 1904, 1497, 1489,
+
+     1479, 1494, 1500, 1444, 1461, 1504, 1504, 1448, 1497, 1492,
+     1509, 1484, 1451, 1496, 1511, 1514, 1510, 1516, 1483, 1515,
+     1518, 1501, 1521, 1508, 1519, 1525, 1904, 1526, 1503, 1529,
+     1530, 1523, 1531, 1522, 1904, 1526, 1504, 1904, 1502, 1520,
+     1536, 1512, 1532, 1904, 1541, 1542, 1540, 1539, 1904, 1904,
+     1537, 1548, 1547, 1904, 1904, 1904, 1553, 1517, 1505, 1533,
+     1552, 1545, 1559, 1563, 1904, 1560, 1557, 1560, 1499, 1532,
+     1553, 1571, 1562, 1573, 1904, 1571, 1561, 1904, 1577, 1904,
+     1551, 1574, 1564, 1904, 1579, 1585, 1586, 1534, 1904, 1568,
+     1546, 1587, 1592, 1583, 1581, 1591, 1570, 1563, 1572, 1576,
+
+     1600, 1582, 1599, 1600, 1604, 1904, 1603, 1601, 1604, 1609,
+     1605, 1904, 1611, 1610, 1597, 1904, 1594, 1593, 1590, 1595,
+     1602, 1620, 1607, 1598, 1904, 1558, 1617, 1615, 1614, 1618,
+     1904, 1619, 1567, 1628, 1904, 1634, 1636, 1621, 1629, 1630,
+     1613, 1637, 1641, 1639, 1644, 1634, 1643, 1647, 1648, 1622,
+     1640, 1651, 1633, 1596, 1904, 1626, 1644, 1608, 1904, 1632,
+     1658, 1661, 1904, 1904, 1654, 1638, 1904, 1660, 1666, 1669,
+     1645, 1671, 1623, 1657, 1668, 1656, 1670, 1624, 1652, 1904,
+     1647, 1679, 1676, 1674, 1684, 1677, 1650, 1904, 1686, 1689,
+     1690, 1691, 1904, 1653, 1692, 1695, 1685, 1665, 1698, 1646,
+
+     1681, 1700, 1701, 1699, 1904, 1704, 1661, 1706, 1696, 1702,
+     1687, 1710, 1642, 1673, 1694, 1713, 1712, 1904, 1715, 1697,
+     1714, 1707, 1703, 1709, 1724, 1704, 1904, 1904, 1717, 1720,
+     1711, 1730, 1729, 1732, 1725, 1734, 1736, 1904, 1683, 1739,
+     1675, 1724, 1682, 1742, 1731, 1737, 1708, 1746, 1748, 1743,
+     1749, 1750, 1752, 1733, 1735, 1716, 1741, 1744, 1904, 1751,
+     1758, 1761, 1760, 1762, 1722, 1753, 1904, 1763, 1904, 1766,
+     1904, 1726, 1904, 1904, 1768, 1764, 1754, 1775, 1778, 1778,
+     1745, 1904, 1765, 1904, 1904, 1779, 1904, 1723, 1788, 1757,
+     1772, 1770, 1721, 1793, 1904, 1781, 1794, 1904, 1793, 1776,
+
+     1788, 1904, 1801, 1777, 1904, 1796, 1792, 1904, 1799, 1904,
+     1800, 1739, 1809, 1811, 1780, 1815, 1804, 1789, 1791, 1807,
+     1806, 1790, 1817, 1803, 1814, 1825, 1826, 1815, 1824, 1821,
+     1830, 1827, 1828, 1833, 1904, 1834, 1832, 1834, 1829, 1786,
+     1820, 1841, 1841, 1837, 1838, 1845, 1846, 1904, 1844, 1847,
+     1850, 1831, 1904, 1904, 1852, 1851, 1904, 1849, 1855, 1813,
+     1819, 1861, 1860, 1904, 1904, 1904, 1856, 1904, 1904, 1867,
+     1861, 1904, 1870, 1873, 1874, 1843, 1876, 1823, 1904, 1904,
+     1878, 1904, 1904, 1874, 1881, 1858, 1884, 1886, 1904, 1822,
+     1890, 1904, 1887, 1885, 1852, 1904, 1877, 1893, 1839, 1904,
+
+     1888, 1898, 1904,    0
+    } ;
 
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1757,   45,
-       45, 1757,   45,   45,   45,   45, 1757, 1757,   45,   45,
-       45, 1757, 1757, 1757,   45,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45, 1757,   45, 1757,   45,   45,
-       45, 1757,   45,   45,   45,   45, 1757,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1757,   45,   45,   45,   45, 1757,   45,   45,   45,
+static const flex_int16_t yy_nxt[2961] =
+    {   0,
+       11, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904,   12,   13,   14,   13,   12,   15,
+       16,   12,   17,   18,   19,   20,   21,   22,   22,   22,
+       22,   22,   23,   24,   12,   12,   12,   12,   12,   12,
+
+       25,   26,   12,   12,   12,   27,   12,   12,   12,   12,
+       28,   12,   12,   12,   12,   29,   12,   30,   12,   12,
+       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
+       12,   12,   32,   12,   12,   12,   12,   12,   33,   12,
+       12,   12,   12,   12,   12,   34,   35,   36,   37,   14,
+       37,   36,   36,   36,   38,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12, 1904,   12,   42,   43,   42,
+       86,   12,   12,   88,   91,   87,   12,   94,   95,   96,
+       97,   12,   41,   92,   93,   98,   12,  100,   12,   85,
+       85,   85,   85,   85,   12,   12,  104,   91,   39,  105,
+       12,  106, 1904,   12,   82,   82,   82,   82,   82,   12,
+      122,   92,   93,  136,  145,  167,   12,   12,   44,   44,
+       44,   45,   45,   46,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45, 1757,   45,   45,   45, 1757,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1757,   45,   45,   45, 1757,   45, 1757,
-       45, 1757,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1757,   45,   45,   45,   45,   45,
-       45,   45, 1757,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45, 1757, 1757,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1757,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1757,   45,   45,   45,   45,   45,   45,
-       45, 1757,   45, 1757,   45, 1757,   45, 1757, 1757,   45,
-       45,   45,   45,   45, 1757,   45, 1757,   45,   45,   45,
-       45,   45,   45,   45, 1757,   45,   45, 1757,   45,   45,
-       45, 1757,   45,   45,   45, 1757,   45, 1757,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1757,
+       47,   45,   48,   49,   50,   51,   45,   52,   53,   54,
+       45,   45,   45,   45,   55,   56,   45,   57,   45,   45,
+       58,   45,   45,   59,   60,   61,   62,   63,   64,   65,
+       66,   67,   52,   68,   69,   70,   71,   72,   73,   74,
+       75,   76,   77,   78,   79,   80,   45,   45,   45,   45,
+       45,   81,   81,  184,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   82,  103,   83,   83,   83,   83,
+       83,  107,  111,  114,  185,   89,  189,   89,  134,   84,
+       90,   90,   90,   90,   90,  154,  119,  155,  135,  156,
+      190,  103,  120,  121,  107,  111,  114,   99,   99,  191,
+       99,   99,   84,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       44,   44,   44,   44,   44,  101,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,  102,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,  192,   45,   45,   45,   45,  137,
+       45,   45,   45,  142,  193,  168,  138,   45,   45,  169,
+       45,  108,  109,  143,  196,  144,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1757,   45,   45, 1757,
-       45,   45,   45,   45,   45,   45, 1757, 1757, 1757,   45,
-     1757, 1757,   45,   45, 1757,   45,   45,   45,   45,   45,
-       45, 1757, 1757,   45, 1757, 1757,   45,   45,   45,   45,
-       45, 1757,   45,   45, 1757,   45,   45,   45, 1757,   45,
-       45,   45, 1757,   45,   45, 1757,    0, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  108,
+      112,  110,  115,  123,  128,  146,  147,  129,  130,  148,
+      113,  131,  132,  182,  124,  149,  197,  125,  183,  126,
+      139,  127,  198,  112,  133,  140,  115, 1904,  141, 1904,
+      203,  213,  214,  215,  219,  223,  224,  225,  113,  116,
+
+      116,  116,  116,  116,  117,  116,  116,  116,  116,  116,
+      116,   45,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,   45,  116,  116,  116,   45,  116,  116,  116,   45,
+      116,  116,  116,  116,  116,  116,  116,   45,  116,  116,
+      116,   45,  116,   45,  118,  116,  116,  116,  116,  116,
+      116,  116,  150,  157,  176,  177,  151,  186,  170,  187,
+      152,  158,  171,  159,  188,  172,  195,  162,  160,  161,
+      163,  164,  173,  174,  199,  200,  153,  204,  175,  205,
+
+      208,  165,  216,  186,  166,  187,  211,  178,  226,  179,
+      230,  217,  188,  180,  195,  218,  231,  212,  232,  240,
+      199,  241,  200,  208,  245,  204,  205,   87,   87,  181,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       44,  201,  206,  246,  207,  220,  236,   44, 1904, 1904,
+     1904,  227,  228,  209,  221,  222,  233,  238,  234,  237,
+      116,  229,  242,  249,  247,  243,  250,  251,  252,  244,
+      206,  207,  202,  239,  253,  235,  254,   44,  255,  258,
+      256,   44,  259,  260,  261,   44,  262,  263,  264,  265,
+      116,  266,  267,   44,  116,  268,  272,   44,  116,   44,
+      194,  257,  116,  116,  116,  273,  116,  116,  248,  277,
+      116,  291,  116,  116,  295,  210,  210,  210,  210,  210,
+      269,  270,  271,  282,  210,  210,  210,  210,  210,  210,
+      274,  278,  280,  275,  276,  279,  281,  292,  296,  297,
+
+      298,  293,  299,  300,  301,  294,  302,  210,  210,  210,
+      210,  210,  210,  303,  304,  305,  306,  307,  283,  284,
+      285,  308,  309,  310,  311,  312,  313,  314,  315,  286,
+      318,  287,  319,  288,  289,  317,  290,  320,  322,  321,
+      323,  324,  316,  316,  316,  316,  316,  311,  325,  310,
+      309,  316,  316,  316,  316,  316,  316,  326,  317,  327,
+      328,  330,  331,  332,  324,  320,  321,  333,  334,  335,
+      336,   45,   45,  337,  316,  316,  316,  316,  316,  316,
+      326,  338,  339,  340,  345,  346,  347,  328,  329,  329,
+      329,  329,  329,   45,  348,  341,  350,  329,  329,  329,
+
+      329,  329,  329,  342,   45,  351,  349,  352,  343,  344,
+      353,   45,  355,  356,  354,  357,  358,  359,   45,  361,
+      329,  329,  329,  329,  329,  329,  362,  363,  364,  365,
+      366,  367,  368,  360,  369,  370,  371,  372,  373,  374,
+       45,  376,  377,  378,   45,  382,   45,  384,  385,  386,
+      387,   46,  389,  390,  392,  393,  394,  395,  396,  397,
+      398,  399,  400,  401,  402,  403,  404,  405,  406,  407,
+      408,  409,  411,  412,  410,  413,  414,  415,  416,  417,
+      418,  420,  421,  422,  381,  424,  423,  425,  426,  428,
+      325,  429,  375,  419,   45,  427,  379,  383,  430,  380,
+
+      431,  432,  433,  391,  434,  435,  436,  437,  438,  438,
+      438,  438,  438,  440,  444,  388,  445,  438,  438,  438,
+      438,  438,  438,  439,  441,  442,  446,  447,  435,  448,
+      449,  451,  452,  443,  453,   45,  455,  444,  456,  454,
+      438,  438,  438,  438,  438,  438,  457,  450,  450,  450,
+      450,  450,  439,  458,  459,  447,  450,  450,  450,  450,
+      450,  450,  460,  461,  462,  463,  466,  467,  464,  469,
+       45,  470,  468,  471,  472,  476,  477,  478,  479,  450,
+      450,  450,  450,  450,  450,  465,  473,  480,  475,  481,
+      482,   45,  474,   45,  484,  485,  486,   45,  488,  492,
+
+      493,  494,  495,  489,  496,  497,  498,  499,  500,  501,
+      502,  503,  504,  505,  507,  508,  509,  506,  510,  512,
+      513,  514,  516,  517,  511,   45,  519,  520,  521,  522,
+       45,  515,  524,  483,   45,  525,  526,  527,  529,  530,
+      523,  531,  533,  534,  535,  532,  536,  537,  538,   45,
+      487,  490,  541,  542,   45,  545,  491,  543,  540,  546,
+      547,  549,  550,  551,  548,  552,  553,  554,  555,  556,
+      557,  558,  559,  560,  518,  563,  561,  564,  544,  562,
+      565,  566,  567,  569,  570,  571,  573,  568,  574,  572,
+      572,  572,  572,  572,  575,  528,  576,  539,  572,  572,
+
+      572,  572,  572,  572,  577,  578,  579,  580,  581,  583,
+      582,  584,  585,  587,  573,  588,  590,  586,  591,  592,
+      593,  572,  572,  572,  572,  572,  572,   45,  596,   45,
+       45,   45,   45,   45,   45,  581,  597,  582,   45,   45,
+       45,   45,   45,   45,  594,  598,  599,  600,   45,  605,
+      595,  606,  607,  610,  608,  601,  611,  602,  603,  604,
+      612,   45,   45,   45,   45,   45,   45,  609,  613,  614,
+      615,  616,   45,  589,  617,  618,  620,  621,  622,  623,
+      619,  624,  625,  626,  627,  628,  629,  630,  631,  632,
+       45,  633,  634,  635,  636,  637,  638,   45,  640,  642,
+
+      639,   45,  644,  645,  646,  647,  648,  649,  641,  650,
+      651,  652,  653,  654,  655,  656,  657,  658,  659,  660,
+      661,  662,  663,  664,   45,  666,  643,  667,  668,  669,
+      665,  670,  671,  672,  673,  674,  675,  676,  677,  679,
+       45,  681,  682,  678,   45,  685,   45,  686,  683,  684,
+      687,  688,  689,  690,  691,  692,  693,  694,  695,  696,
+      697,  698,  699,  700,  701,  702,  703,  704,  705,   44,
+       44,   44,   44,   44,  708,   45,  711,  680,   44,   44,
+       44,   44,   44,   44,  706,  707,  709,  712,  710,  715,
+      713,  716,  717,  718,  719,  720,  721,  714,  722,  723,
+
+      724,   44,   44,   44,   44,   44,   44,  725,  726,  727,
+      729,  706,  730,  707,  728,   45,  731,  732,  733,  734,
+      735,  736,  737,  738,  739,  740,  741,  742,  743,  744,
+      745,  746,  747,  748,  749,   45,  751,  752,  753,  754,
+      755,  756,  759,  750,  757,  758,   45,  761,  762,  763,
+       45,  760,  764,   45,  765,   45,  767,  768,  769,  770,
+      771,  772,  773,  774,  775,  776,  777,  778,  780,   45,
+      781,  782,  783,  784,  785,  766,   45,  786,  787,  788,
+      791,  792,  793,   45,  789,  795,  796,  797,  798,  794,
+      799,  800,  801,  802,  803,  804,  805,  806,  807,  808,
+
+      809,  810,  811,  812,  813,  814,  779,  815,  817,  818,
+      819,  820,  821,  822,  823,  824,  825,  826,  827,  816,
+      828,  829,  830,  790,   45,   45,  833,  831,  832,   45,
+      834,  835,   45,  837,  838,  839,  840,  841,  842,  836,
+      843,  844,  845,  846,  829,  847,  848,  849,  828,  850,
+      851,  852,   45,  854,  855,  856,  857,  858,  859,  860,
+      861,  862,  864,  865,  866,  863,   45,  853,  867,  868,
+      869,  870,  871,  872,  873,  874,  875,  876,  877,  878,
+      879,  880,  881,  882,  883,  884,  885,  886,  887,  888,
+      889,  891,  892,  890,  893,  894,  895,  896,  897,  898,
+
+       45,  899,  900,  901,  902,  903,  904,  905,  906,  907,
+      908,  909,  910,  911,  912,  913,   45,  915,  916,  917,
+      918,  919,  920,  921,  922,  923,  924,  925,  926,  927,
+      928,  929,  914,  930,  931,  933,  934,  937,  938,  939,
+      941,  932,  942,  935,  943,  940,  944,  936,  945,   45,
+      946,  947,  948,  949,  951,  952,  953,  950,  954,  955,
+      956,  957,  958,  959,   45,  961,  962,  960,  963,  964,
+      965,   45,  966,  967,  968,  969,  970,  971,  972,  973,
+      974,  975,  976,  977,  978,  979,  954,  980,  981,  982,
+      983,  984,  985,  986,  987,  988,  989,  990,  991,  992,
+
+      993,  994,  995,  996,  997,  999, 1000, 1001, 1002,  998,
+     1003, 1004,   45, 1005, 1006, 1007, 1008, 1009, 1010, 1011,
+     1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1022,
+     1023, 1024, 1021, 1025, 1026, 1027,   46, 1029, 1030, 1031,
+     1032, 1033, 1034, 1035, 1036,   45, 1037,   45, 1038, 1039,
+     1040, 1041,   45, 1043, 1044, 1045, 1046, 1042, 1047, 1048,
+     1049,   45, 1050, 1051, 1052, 1053, 1055, 1056, 1057, 1058,
+     1059, 1060, 1061, 1062, 1063, 1064, 1065, 1054, 1066, 1067,
+     1068, 1069, 1070,   45, 1071, 1072, 1073, 1074,   45, 1076,
+     1077, 1075, 1028,   45, 1078, 1079, 1080, 1081, 1082, 1083,
+
+     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1072, 1092,
+     1093, 1071, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+     1112, 1113, 1114,   45, 1116, 1117, 1120, 1121, 1122,   45,
+     1118, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132,
+     1133, 1115, 1134, 1135, 1136, 1137, 1138, 1139, 1142, 1140,
+     1123, 1143, 1144, 1145, 1146, 1147,   45, 1149, 1150,   45,
+     1141,   45, 1151, 1152, 1148, 1153, 1154, 1155, 1156, 1157,
+     1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+     1168, 1169, 1170, 1119, 1171, 1172, 1173, 1174, 1175, 1176,
+
+     1177, 1178, 1179,   45, 1181, 1182, 1183, 1186, 1184, 1180,
+     1185,   45, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+     1195, 1196, 1197, 1199,   45, 1200, 1201, 1202, 1203, 1204,
+     1205, 1206,   45, 1208, 1183, 1184, 1198, 1209, 1210, 1211,
+     1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
+     1207, 1222,   45, 1224, 1225, 1226, 1227, 1228, 1229, 1231,
+       45, 1233, 1234, 1230, 1235, 1236, 1237,   45, 1238, 1239,
+     1240, 1241, 1242, 1223, 1243, 1244, 1245, 1246,   45, 1248,
+     1247, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+     1258, 1259, 1260, 1261, 1264, 1265, 1266,   45, 1262, 1268,
+
+     1269, 1270, 1271, 1232, 1272, 1273,   45, 1267, 1275,   45,
+     1277, 1274, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285,
+       45, 1287,   45, 1289, 1290, 1291, 1276, 1292, 1293, 1294,
+     1295, 1296, 1297, 1298, 1299, 1302, 1286, 1263,   45,   45,
+     1301, 1288, 1303, 1304, 1300, 1305, 1306, 1307, 1308, 1309,
+     1310, 1293, 1311,   45, 1312, 1313, 1314, 1294, 1315,   45,
+     1317,   45, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+     1316,   45, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+     1344, 1345, 1346, 1347, 1348, 1349,   45, 1351, 1352, 1353,
+
+     1354, 1355, 1356, 1357, 1358, 1350, 1359, 1360, 1361, 1362,
+     1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1373,
+     1374, 1375, 1376, 1377, 1378, 1379,   46, 1381, 1382, 1383,
+     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+     1394, 1395, 1396, 1399, 1397, 1400, 1401, 1402, 1403, 1404,
+     1405, 1406, 1407, 1408, 1409, 1410, 1411,   45, 1413, 1414,
+     1415, 1416, 1388, 1417,   45, 1419, 1418,   45, 1421, 1422,
+     1412, 1372, 1423, 1424, 1425, 1420, 1426, 1427, 1428, 1429,
+     1430, 1431, 1432, 1433,   45, 1435, 1437, 1380, 1398, 1438,
+     1439, 1440, 1441, 1436, 1442, 1443, 1444, 1445,   45, 1447,
+
+     1448, 1449, 1450, 1451, 1452, 1453, 1434, 1454, 1455, 1456,
+     1457, 1458, 1459, 1460, 1446, 1461, 1462, 1463, 1464, 1465,
+     1466,   45, 1468, 1469, 1470, 1471, 1472, 1473, 1467,   46,
+     1475, 1476, 1477, 1478, 1479, 1480, 1481,   45, 1482, 1483,
+     1484, 1485, 1486, 1487,   45, 1489, 1490, 1491, 1492, 1488,
+     1473, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+     1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511,
+     1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521,
+       45, 1523, 1522, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+     1531, 1474, 1532, 1533, 1534, 1535, 1536, 1537, 1538,   45,
+
+     1539, 1540, 1541, 1542, 1543, 1544,   45,   46, 1546, 1547,
+     1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557,
+       45, 1558, 1561, 1562, 1563, 1564, 1565,   46, 1567, 1568,
+     1569, 1543, 1559, 1570, 1571, 1572, 1573, 1574, 1575, 1577,
+     1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+     1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,   45, 1597,
+     1598, 1560, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606,
+     1607, 1608, 1545, 1609, 1610, 1611, 1596, 1612, 1613, 1614,
+     1615, 1616,   46, 1618, 1619, 1620, 1621, 1622, 1623,   45,
+     1566, 1627, 1624, 1625, 1628, 1629, 1576, 1630, 1626, 1631,
+
+       46, 1609, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+     1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650,
+     1651, 1652, 1653, 1654, 1655,   46, 1657, 1658, 1659,   46,
+     1661, 1662, 1663, 1664, 1665, 1666, 1667, 1617, 1668, 1669,
+     1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+     1680, 1681, 1682, 1632, 1683, 1684, 1685, 1686,   45, 1687,
+     1688, 1689, 1690, 1691, 1692, 1693,   46, 1656, 1695,   45,
+     1696,   45, 1698, 1699,   45, 1700, 1701, 1702, 1703, 1704,
+     1705, 1660, 1697, 1706, 1707, 1708,   45, 1710, 1711, 1712,
+     1713, 1709, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721,
+
+     1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731,
+     1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741,
+     1742, 1743, 1744, 1745,   45, 1747, 1694, 1748, 1749, 1750,
+     1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+     1761, 1762, 1763, 1764,   45, 1765, 1766, 1767, 1746, 1768,
+     1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+     1779, 1780,   45, 1781, 1782, 1783, 1784, 1785, 1786, 1787,
+     1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+     1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+     1808,   46, 1810, 1811, 1812, 1813, 1814,   45, 1816, 1817,
+
+     1818, 1819,   45, 1821, 1822, 1823, 1820, 1824, 1815, 1825,
+     1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835,
+       46, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845,
+     1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854,   46,
+     1856, 1857, 1858, 1859, 1860, 1809,   45, 1862, 1863, 1864,
+     1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
+     1861, 1875, 1876,   45, 1878, 1879, 1880, 1881, 1877, 1882,
+     1883,   45,   46, 1885, 1886, 1887, 1888, 1889, 1890, 1891,
+     1836, 1892, 1893, 1894,   45, 1896, 1897, 1898, 1899, 1900,
+     1901, 1902, 1903, 1904, 1855, 1904, 1904, 1904, 1904, 1904,
+
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1884, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1895, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904
     } ;
 
-static const flex_int16_t yy_nxt[2234] =
+static const flex_int16_t yy_chk[2961] =
     {   0,
-     1757,   13,   14,   13, 1757,   15,   16, 1757,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       85,  748,   37,   14,   37,   86,   25,   26,   38,  101,
-     1757,   27,   37,   14,   37,   42,   28,   42,   38,   91,
-       92,   29,  198,   30,   13,   14,   13,   90,   91,   25,
-       31,   92,   13,   14,   13,   13,   14,   13,   32,   40,
-      749,   13,   14,   13,   33,   40,  102,   91,   92,  198,
-       90,   34,   35,   13,   14,   13,   94,   15,   16,   95,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   90,   39,  103,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  107,   42,   28,   42,
-      108,   42,   41,   29,  111,   30,  114,  115,   93,  137,
-       41,   25,   31,  103,  138,  450,   88,  139,   88,  107,
-       32,   89,   89,   89,   89,   89,   33,  111,  108,  114,
-      843,  115,  451,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   47,   45,   48,
-       49,   50,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   45,   60,   61,   62,   63,   64,   65,   66,   52,
-
-       67,   68,   69,   70,   71,   72,   73,   74,   75,   76,
-       77,   78,   57,   45,   45,   45,   45,   45,   80,  109,
-       81,   81,   81,   81,   81,   80,  103,   83,   83,   83,
-       83,   83,  107,   82,   84,   84,   84,   84,   84,   80,
-       82,   83,   83,   83,   83,   83,  135,   82,  110,  132,
-      112,  121,  119,  136,   82,  107,   82,  166,  120,  133,
-      113,  167,  122,   82,  140,  123,  134,  124,  234,  125,
-       82,  184,  185,  112,  141,  203,  142,   82,   45,  844,
-       45,   45,   45,   45,  235,   45,   45,   45,  113,  117,
-      144,  145,   45,   45,  146,   45,   45,  184,  185,  184,
-
-      147,   45,  203,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  126,  187,   45,  127,  128,  148,
-       45,  129,  130,  149,   45,  111,  845,  150,  381,  186,
-      186,  199,   45,  846,  131,  185,   45,  155,   45,  118,
-      101,  114,  847,  151,  152,  156,  153,  157,  154,  174,
-      175,  160,  158,  159,  161,  162,  168,  186,  189,  112,
-      169,  188,  200,  170,  114,  163,  193,  202,  164,  113,
-      171,  172,  197,  204,  180,  319,  173,  102,  382,  181,
-      417,  213,  176,  205,  177,  214,  223,  224,  178,   84,
-
-       84,   84,   84,   84,  193,  202,  225,  113,  197,  232,
-      408,  204,   82,   80,  179,   81,   81,   81,   81,   81,
-      205,  304,  233,  409,   88,  206,   88,  243,   82,   89,
-       89,   89,   89,   89,   80,   82,   83,   83,   83,   83,
-       83,   84,   84,   84,   84,   84,  100,  304,  206,   82,
-      193,   82,  203,  100,   82,   89,   89,   89,   89,   89,
-       89,   89,   89,   89,   89,  216,  229,  210,  230,  252,
-      202,  244,   82,  238,  217,  218,  239,   82,  211,  296,
-      240,  305,  274,  100,  453,  231,  275,  100,  304,  454,
-      253,  100,  265,  266,  267,  303,  303,  270,  259,  100,
-
-      271,  272,  305,  100,  305,  100,  192,  209,  209,  209,
-      209,  209,  277,  311,  307,  318,  209,  209,  209,  209,
-      209,  209,  287,  303,  306,  308,  288,  314,  320,  315,
-      289,  311,  322,  517,  318,  369,  311,  518,  318,  209,
-      209,  209,  209,  209,  209,  428,  459,  278,  279,  280,
-      399,  320,  460,  400,  325,  314,  315,  377,  281,  322,
-      282,  424,  283,  284,  436,  285,  323,  323,  323,  323,
-      323,  424,  513,  332,  428,  323,  323,  323,  323,  323,
-      323,  333,  433,  428,  424,  436,  334,  335,  370,  526,
-      848,  371,  436,  527,  425,  430,  431,  849,  323,  323,
-
-      323,  323,  323,  323,  432,  433,  439,  439,  439,  439,
-      439,  545,  440,  502,  546,  439,  439,  439,  439,  439,
-      439,  474,  489,  490,  491,  496,  475,  500,  492,  531,
-      514,  497,  556,  532,  564,  587,  565,  501,  439,  439,
-      439,  439,  439,  439,  551,  556,  579,  597,  588,  552,
-      682,  852,  598,  796,  580,  619,  581,  582,  583,  654,
-      556,  564,  853,  565,  655,  620,  678,  683,  727,  728,
-      795,  684,  854,  566,  476,  783,  796,  682,  855,  477,
-       45,   45,   45,   45,   45,  802,  803,  784,  804,   45,
-       45,   45,   45,   45,   45,  683,  758,  850,  795,  823,
-
-      851,  759,  856,  824,  857,  858,  859,  860,  861,  862,
-      863,  864,   45,   45,   45,   45,   45,   45,  865,  866,
-      867,  868,  869,  870,  871,  872,  873,  874,  875,  876,
-      877,  878,  879,  880,  881,  882,  883,  884,  885,  886,
-      760,  887,  888,  889,  890,  892,  893,  896,  897,  898,
-      900,  891,  901,  894,  902,  899,  903,  895,  904,  905,
-      906,  907,  908,  909,  910,  911,  912,  913,  914,  915,
-      916,  917,  918,  919,  920,  921,  922,  923,  924,  925,
-      926,  927,  928,  929,  930,  931,  932,  933,  934,  935,
-      936,  937,  938,  911,  939,  940,  941,  942,  943,  944,
-
-      945,  946,  947,  948,  950,  951,  952,  953,  949,  954,
-      955,  956,  957,  958,  959,  960,  961,  962,  963,  964,
-      965,  966,  967,  968,  969,  970,  971,  973,  974,  975,
-      972,  976,  977,  978,  979,  980,  981,  982,  983,  984,
-      985,  986,  987,  988,  989,  990,  991,  992,  993,  994,
-      995,  996,  997,  998,  999, 1000, 1001, 1002, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1003,
-     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024,
-     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1019, 1042, 1043,
-
-     1018, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
-     1053, 1054, 1055, 1056, 1057, 1058, 1061, 1062, 1063, 1064,
-     1059, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073,
-     1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1083, 1084,
-     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1082, 1093,
-     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
-     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1116, 1060, 1117, 1118, 1119, 1120, 1122, 1121,
-     1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132,
-     1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
-
-     1143, 1144, 1145, 1146, 1147, 1120, 1121, 1148, 1149, 1150,
-     1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160,
-     1162, 1164, 1165, 1166, 1161, 1167, 1168, 1169, 1170, 1171,
-     1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
-     1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
-     1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
-     1202, 1203, 1204, 1205, 1163, 1206, 1207, 1208, 1209, 1210,
-     1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220,
-     1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230,
-     1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240,
-
-     1218, 1241, 1242, 1243, 1244, 1245, 1219, 1246, 1247, 1248,
-     1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
-     1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268,
-     1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
-     1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1289,
-     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
-     1300, 1301, 1302, 1303, 1304, 1305, 1307, 1308, 1309, 1310,
-     1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320,
-     1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330,
-     1302, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
-
-     1340, 1288, 1341, 1342, 1343, 1345, 1346, 1347, 1348, 1306,
-     1349, 1350, 1344, 1351, 1352, 1353, 1354, 1355, 1356, 1357,
-     1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367,
-     1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377,
-     1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
-     1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
-     1398, 1376, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
-     1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416,
-     1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
-     1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436,
-
-     1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446,
-     1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
-     1447, 1458, 1459, 1460, 1463, 1435, 1461, 1462, 1465, 1466,
-     1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
-     1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486,
-     1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496,
-     1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506,
-     1508, 1509, 1510, 1511, 1507, 1512, 1513, 1514, 1515, 1516,
-     1517, 1518, 1464, 1519, 1493, 1520, 1521, 1522, 1523, 1524,
-     1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
-
-     1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
-     1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
-     1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564,
-     1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574,
-     1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584,
-     1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
-     1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
-     1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614,
-     1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624,
-     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
-
-     1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
-     1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
-     1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
-     1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674,
-     1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684,
-     1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
-     1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
-     1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
-     1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
-     1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734,
-
-     1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744,
-     1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754,
-     1755, 1756,   12,   12,   12,   12,   12,   36,   36,   36,
-       36,   36,   79,  310,   79,   79,   79,   98,  427,   98,
-      555,   98,  100,  100,  100,  100,  100,  116,  116,  116,
-      116,  116,  183,  100,  183,  183,  183,  207,  207,  207,
-      842,  841,  840,  839,  838,  837,  836,  835,  834,  833,
-      832,  831,  830,  829,  828,  827,  826,  825,  822,  821,
-      820,  819,  818,  817,  816,  815,  814,  813,  812,  811,
-      810,  809,  808,  807,  806,  805,  801,  800,  799,  798,
-
-      797,  794,  793,  792,  791,  790,  789,  788,  787,  786,
-      785,  782,  781,  780,  779,  778,  777,  776,  775,  774,
-      773,  772,  771,  770,  769,  768,  767,  766,  765,  764,
-      763,  762,  761,  757,  756,  755,  754,  753,  752,  751,
-      750,  747,  746,  745,  744,  743,  742,  741,  740,  739,
-      738,  737,  736,  735,  734,  733,  732,  731,  730,  729,
-      726,  725,  724,  723,  722,  721,  720,  719,  718,  717,
-      716,  715,  714,  713,  712,  711,  710,  709,  708,  707,
-      706,  705,  704,  703,  702,  701,  700,  699,  698,  697,
-      696,  695,  694,  693,  692,  691,  690,  689,  688,  687,
-
-      686,  685,  681,  680,  679,  678,  677,  676,  675,  674,
-      673,  672,  671,  670,  669,  668,  667,  666,  665,  664,
-      663,  662,  661,  660,  659,  658,  657,  656,  653,  652,
-      651,  650,  649,  648,  647,  646,  645,  644,  643,  642,
-      641,  640,  639,  638,  637,  636,  635,  634,  633,  632,
-      631,  630,  629,  628,  627,  626,  625,  624,  623,  622,
-      621,  618,  617,  616,  615,  614,  613,  612,  611,  610,
-      609,  608,  607,  606,  605,  604,  603,  602,  601,  600,
-      599,  596,  595,  594,  593,  592,  591,  590,  589,  586,
-      585,  584,  578,  577,  576,  575,  574,  573,  572,  571,
-
-      570,  569,  568,  567,  563,  562,  561,  560,  559,  558,
-      557,  554,  553,  550,  549,  548,  547,  544,  543,  542,
-      541,  540,  539,  538,  537,  536,  535,  534,  533,  530,
-      529,  528,  525,  524,  523,  522,  521,  520,  519,  516,
-      515,  512,  511,  510,  509,  508,  507,  506,  505,  504,
-      503,  499,  498,  495,  494,  493,  488,  487,  486,  485,
-      484,  483,  482,  481,  480,  479,  478,  473,  472,  471,
-      470,  469,  468,  467,  466,  465,  464,  463,  462,  461,
-      458,  457,  456,  455,  452,  449,  448,  447,  446,  445,
-      444,  443,  442,  441,  438,  437,  435,  434,  429,  426,
-
-      423,  422,  421,  420,  419,  418,  416,  415,  414,  413,
-      412,  411,  410,  407,  406,  405,  404,  403,  402,  401,
-      398,  397,  396,  395,  394,  393,  392,  391,  390,  389,
-      388,  387,  386,  385,  384,  383,  380,  379,  378,  376,
-      375,  374,  373,  372,  368,  367,  366,  365,  364,  363,
-      362,  361,  360,  359,  358,  357,  356,  355,  354,  353,
-      352,  351,  350,  349,  348,  347,  346,  345,  344,  343,
-      342,  341,  340,  339,  338,  337,  336,  331,  330,  329,
-      328,  327,  326,  324,  208,  321,  319,  317,  316,  313,
-      312,  309,  302,  301,  300,  299,  298,  297,  295,  294,
-
-      293,  292,  291,  290,  286,  276,  273,  269,  268,  264,
-      263,  262,  261,  260,  258,  257,  256,  255,  254,  251,
-      250,  249,  248,  247,  246,  245,  242,  241,  237,  236,
-      228,  227,  226,  222,  221,  220,  219,  215,  212,  208,
-      201,  196,  195,  194,  191,  190,  182,  165,  143,  106,
-      105,  104,   43,   99,   97,   96,   87,   43, 1757,   11,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757
-    } ;
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
 
-static const flex_int16_t yy_chk[2234] =
-    {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  634,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  108,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      634,    8,    8,    8,    1,    8,   44,   27,   28,  108,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   47,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   65,
-       10,    2,    2,   47,   65,  335,   25,   65,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      728,   57,  335,    2,    2,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    7,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,   11,    9,   13,   14,   13,
+       21,    5,    5,   24,   26,   21,    5,   31,   32,   33,
+       38,    5,    9,   27,   28,   39,    5,   41,    5,   19,
+       19,   19,   19,   19,    5,    5,   48,   26,    5,   49,
+        7,   50,   20,    5,   20,   20,   20,   20,   20,    5,
+       60,   27,   28,   64,   68,   74,    5,    5,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,   53,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   63,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   64,   20,   53,   62,
-       55,   60,   59,   64,   22,   63,   17,   74,   59,   62,
-       55,   74,   60,   19,   66,   60,   63,   60,  134,   60,
-       20,   90,   91,   55,   66,  112,   66,   22,   45,  729,
-       45,   45,   45,   45,  134,   45,   45,   45,   55,   58,
-       68,   68,   45,   45,   68,   45,   58,   90,   91,   93,
-
-       68,   45,  112,   45,   45,   45,   45,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   16,   16,   79,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   17,   47,   17,   17,   17,   17,
+       17,   51,   54,   56,   80,   25,   94,   25,   63,   17,
+       25,   25,   25,   25,   25,   71,   59,   71,   63,   71,
+       95,   47,   59,   59,   51,   54,   56,   40,   40,   96,
+       40,   40,   17,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,   98,   45,   45,   45,   45,   65,
+       45,   45,   45,   67,   99,   75,   65,   45,   45,   75,
+       45,   52,   53,   67,  104,   67,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   61,   93,   58,   61,   61,   69,
-       58,   61,   61,   69,   58,   70,  730,   69,  263,   92,
-       95,  109,   58,  731,   61,   94,   58,   71,   58,   58,
-      100,   77,  732,   69,   70,   71,   70,   71,   70,   76,
-       76,   72,   71,   71,   72,   72,   75,   92,   95,   76,
-       75,   94,  109,   75,   77,   72,  103,  111,   72,   76,
-       75,   75,  107,  113,   77,  296,   75,  100,  263,   77,
-      296,  121,   76,  114,   76,  121,  128,  128,   76,   80,
-
-       80,   80,   80,   80,  103,  111,  128,   76,  107,  133,
-      288,  113,   80,   81,   76,   81,   81,   81,   81,   81,
-      114,  185,  133,  288,   82,  115,   82,  140,   81,   82,
-       82,   82,   82,   82,   83,   80,   83,   83,   83,   83,
-       83,   84,   84,   84,   84,   84,  102,  185,  115,   83,
-      119,   81,  176,  102,   84,   88,   88,   88,   88,   88,
-       89,   89,   89,   89,   89,  123,  132,  119,  132,  148,
-      154,  140,   83,  137,  123,  123,  137,   84,  119,  176,
-      137,  186,  165,  102,  338,  132,  165,  102,  188,  338,
-      148,  102,  160,  160,  160,  184,  187,  163,  154,  102,
-
-      163,  163,  189,  102,  186,  102,  102,  118,  118,  118,
-      118,  118,  167,  193,  188,  202,  118,  118,  118,  118,
-      118,  118,  169,  184,  187,  189,  169,  197,  204,  198,
-      169,  211,  206,  392,  259,  253,  193,  392,  202,  118,
-      118,  118,  118,  118,  118,  311,  343,  167,  167,  167,
-      280,  204,  343,  280,  211,  197,  198,  259,  167,  206,
-      167,  303,  167,  167,  318,  167,  209,  209,  209,  209,
-      209,  306,  389,  218,  311,  209,  209,  209,  209,  209,
-      209,  218,  314,  325,  303,  377,  218,  218,  253,  400,
-      733,  253,  318,  400,  306,  313,  313,  734,  209,  209,
-
-      209,  209,  209,  209,  313,  314,  323,  323,  323,  323,
-      323,  417,  325,  377,  417,  323,  323,  323,  323,  323,
-      323,  357,  369,  369,  369,  373,  357,  376,  369,  404,
-      389,  373,  428,  404,  438,  459,  438,  376,  323,  323,
-      323,  323,  323,  323,  422,  440,  455,  469,  459,  422,
-      564,  736,  469,  683,  455,  491,  455,  455,  455,  528,
-      428,  438,  737,  438,  528,  491,  566,  565,  612,  612,
-      682,  566,  738,  440,  357,  669,  683,  564,  740,  357,
-      439,  439,  439,  439,  439,  689,  689,  669,  689,  439,
-      439,  439,  439,  439,  439,  565,  644,  735,  682,  708,
-
-      735,  644,  741,  708,  742,  743,  744,  745,  746,  747,
-      749,  750,  439,  439,  439,  439,  439,  439,  751,  752,
-      753,  754,  755,  756,  757,  759,  760,  761,  762,  763,
-      764,  765,  766,  767,  768,  769,  770,  771,  772,  773,
-      644,  774,  775,  776,  777,  778,  779,  780,  781,  782,
-      784,  777,  785,  779,  786,  782,  787,  779,  788,  789,
-      790,  791,  792,  793,  795,  796,  797,  798,  799,  800,
-      802,  803,  804,  805,  806,  807,  808,  809,  810,  811,
-      812,  813,  814,  815,  816,  817,  818,  819,  820,  821,
-      822,  823,  824,  796,  825,  826,  827,  828,  830,  831,
-
-      832,  833,  834,  835,  836,  837,  838,  839,  835,  840,
-      841,  842,  843,  844,  847,  848,  849,  850,  851,  852,
-      853,  856,  857,  858,  859,  860,  861,  862,  863,  864,
-      861,  865,  866,  868,  870,  871,  872,  873,  874,  875,
-      876,  877,  878,  879,  880,  881,  882,  883,  884,  885,
-      886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
-      896,  897,  898,  899,  901,  902,  903,  904,  905,  893,
-      906,  907,  908,  910,  911,  912,  913,  915,  916,  917,
-      918,  919,  920,  921,  922,  923,  924,  925,  926,  927,
-      928,  929,  930,  931,  932,  933,  934,  911,  935,  937,
-
-      910,  938,  939,  940,  941,  942,  943,  944,  945,  946,
-      947,  949,  950,  951,  952,  953,  954,  956,  957,  958,
-      953,  959,  960,  961,  962,  963,  964,  965,  966,  967,
-      968,  969,  970,  971,  972,  973,  974,  975,  976,  979,
-      980,  981,  983,  984,  985,  986,  988,  989,  975,  990,
-      991,  992,  993,  994,  995,  996,  997,  998,  999, 1000,
-     1001, 1002, 1003, 1004, 1005, 1007, 1008, 1009, 1010, 1011,
-     1012, 1013, 1014,  953, 1015, 1016, 1017, 1018, 1020, 1019,
-     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
-     1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1041,
-
-     1042, 1043, 1044, 1045, 1046, 1018, 1019, 1047, 1048, 1049,
-     1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1059, 1060,
-     1061, 1062, 1063, 1064, 1060, 1065, 1066, 1067, 1068, 1069,
-     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
-     1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089,
-     1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100,
-     1101, 1103, 1104, 1107, 1061, 1108, 1109, 1110, 1111, 1112,
-     1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
-     1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1133,
-     1134, 1135, 1136, 1137, 1138, 1140, 1141, 1142, 1143, 1144,
-
-     1120, 1145, 1146, 1147, 1148, 1149, 1121, 1150, 1151, 1152,
-     1153, 1154, 1155, 1156, 1159, 1161, 1163, 1164, 1165, 1166,
-     1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1177,
-     1178, 1179, 1181, 1182, 1183, 1184, 1187, 1189, 1191, 1192,
-     1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
-     1203, 1204, 1205, 1207, 1208, 1209, 1212, 1213, 1214, 1215,
-     1216, 1217, 1218, 1219, 1221, 1222, 1223, 1224, 1225, 1226,
-     1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
-     1238, 1239, 1240, 1241, 1243, 1244, 1245, 1246, 1247, 1248,
-     1218, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
-
-     1258, 1201, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1222,
-     1267, 1268, 1262, 1269, 1272, 1273, 1274, 1275, 1276, 1277,
-     1278, 1279, 1280, 1281, 1282, 1284, 1285, 1286, 1287, 1288,
-     1289, 1291, 1293, 1296, 1298, 1299, 1300, 1301, 1302, 1304,
-     1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315,
-     1316, 1317, 1318, 1319, 1320, 1321, 1324, 1325, 1326, 1327,
-     1328, 1302, 1329, 1330, 1331, 1332, 1333, 1334, 1336, 1339,
-     1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1351,
-     1352, 1353, 1354, 1355, 1356, 1359, 1360, 1362, 1363, 1364,
-     1365, 1366, 1368, 1369, 1370, 1371, 1372, 1374, 1376, 1377,
-
-     1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
-     1388, 1389, 1390, 1391, 1393, 1394, 1396, 1397, 1398, 1399,
-     1387, 1400, 1401, 1402, 1404, 1376, 1403, 1403, 1405, 1406,
-     1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416,
-     1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
-     1427, 1428, 1430, 1431, 1433, 1434, 1435, 1436, 1439, 1440,
-     1441, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1454,
-     1455, 1456, 1457, 1458, 1454, 1459, 1460, 1461, 1462, 1464,
-     1465, 1467, 1404, 1469, 1435, 1470, 1471, 1473, 1474, 1475,
-     1476, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486,
-
-     1487, 1488, 1489, 1490, 1491, 1493, 1494, 1495, 1496, 1498,
-     1499, 1500, 1501, 1502, 1503, 1504, 1505, 1507, 1508, 1509,
-     1510, 1511, 1513, 1514, 1515, 1517, 1518, 1519, 1520, 1521,
-     1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
-     1532, 1533, 1535, 1536, 1537, 1539, 1541, 1543, 1544, 1545,
-     1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1556,
-     1557, 1558, 1559, 1560, 1561, 1562, 1564, 1565, 1566, 1567,
-     1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1579,
-     1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1589, 1590,
-     1591, 1592, 1593, 1594, 1595, 1596, 1599, 1600, 1601, 1602,
-
-     1603, 1604, 1605, 1606, 1607, 1609, 1610, 1611, 1612, 1613,
-     1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623,
-     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1633, 1635, 1637,
-     1640, 1641, 1642, 1643, 1644, 1646, 1648, 1649, 1650, 1651,
-     1652, 1653, 1654, 1656, 1657, 1659, 1660, 1661, 1663, 1664,
-     1665, 1667, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676,
-     1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
-     1687, 1688, 1689, 1691, 1692, 1693, 1694, 1695, 1696, 1697,
-     1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1708,
-     1709, 1711, 1712, 1713, 1714, 1715, 1716, 1720, 1723, 1724,
-
-     1726, 1727, 1728, 1729, 1730, 1731, 1734, 1737, 1738, 1739,
-     1740, 1741, 1743, 1744, 1746, 1747, 1748, 1750, 1751, 1752,
-     1754, 1755, 1758, 1758, 1758, 1758, 1758, 1759, 1759, 1759,
-     1759, 1759, 1760, 1766, 1760, 1760, 1760, 1761, 1767, 1761,
-     1768, 1761, 1762, 1762, 1762, 1762, 1762, 1763, 1763, 1763,
-     1763, 1763, 1764, 1769, 1764, 1764, 1764, 1765, 1765, 1765,
-      727,  726,  725,  724,  723,  722,  721,  720,  719,  718,
-      717,  715,  714,  713,  712,  711,  710,  709,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  698,  697,  696,
-      695,  694,  693,  692,  691,  690,  688,  687,  686,  685,
-
-      684,  681,  680,  679,  676,  675,  674,  673,  672,  671,
-      670,  667,  666,  665,  664,  663,  662,  661,  660,  659,
-      658,  657,  656,  655,  653,  652,  651,  650,  649,  648,
-      647,  646,  645,  643,  642,  640,  639,  638,  637,  636,
-      635,  633,  632,  631,  629,  628,  626,  625,  624,  623,
-      622,  621,  620,  619,  618,  617,  616,  615,  614,  613,
-      611,  610,  609,  608,  607,  605,  604,  603,  602,  601,
-      600,  599,  598,  596,  595,  594,  593,  592,  591,  590,
-      589,  588,  587,  586,  585,  584,  583,  582,  581,  580,
-      579,  578,  577,  576,  575,  574,  573,  572,  571,  570,
-
-      569,  568,  562,  560,  557,  556,  554,  553,  552,  550,
-      546,  545,  544,  543,  542,  541,  540,  539,  538,  537,
-      536,  535,  534,  533,  532,  531,  530,  529,  527,  526,
-      525,  524,  523,  522,  521,  520,  519,  518,  517,  516,
-      514,  512,  511,  510,  509,  508,  507,  506,  505,  504,
-      503,  502,  501,  500,  498,  497,  496,  495,  494,  493,
-      492,  490,  489,  488,  487,  486,  485,  484,  483,  482,
-      481,  480,  479,  478,  477,  476,  475,  473,  472,  471,
-      470,  468,  467,  466,  465,  464,  463,  461,  460,  458,
-      457,  456,  454,  452,  451,  450,  449,  448,  447,  446,
-
-      444,  443,  442,  441,  436,  435,  433,  432,  431,  430,
-      429,  426,  423,  421,  420,  419,  418,  416,  415,  414,
-      413,  412,  411,  410,  409,  408,  407,  406,  405,  403,
-      402,  401,  399,  398,  397,  396,  395,  394,  393,  391,
-      390,  388,  387,  386,  385,  384,  383,  382,  381,  380,
-      379,  375,  374,  372,  371,  370,  368,  367,  366,  365,
-      364,  363,  362,  361,  360,  359,  358,  356,  355,  354,
-      353,  352,  351,  350,  349,  348,  347,  346,  345,  344,
-      342,  341,  340,  339,  337,  334,  333,  332,  331,  330,
-      329,  328,  327,  326,  322,  320,  317,  315,  312,  309,
-
-      302,  301,  300,  299,  298,  297,  295,  294,  293,  292,
-      291,  290,  289,  287,  286,  285,  284,  283,  282,  281,
-      279,  278,  277,  276,  275,  274,  273,  272,  271,  270,
-      269,  268,  267,  266,  265,  264,  262,  261,  260,  258,
-      257,  256,  255,  254,  252,  251,  250,  249,  248,  247,
-      246,  245,  244,  242,  241,  240,  239,  238,  237,  236,
-      235,  234,  233,  232,  231,  230,  229,  228,  227,  226,
-      225,  224,  223,  222,  221,  220,  219,  217,  216,  215,
-      214,  213,  212,  210,  207,  205,  203,  201,  200,  195,
-      194,  190,  182,  181,  180,  179,  178,  177,  175,  174,
-
-      173,  172,  171,  170,  168,  166,  164,  162,  161,  159,
-      158,  157,  156,  155,  153,  152,  151,  150,  149,  147,
-      146,  145,  144,  143,  142,  141,  139,  138,  136,  135,
-      131,  130,  129,  127,  126,  125,  124,  122,  120,  116,
-      110,  106,  105,  104,   98,   97,   78,   73,   67,   50,
-       49,   48,   43,   41,   39,   38,   24,   14,   11, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1757
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   52,
+       55,   53,   57,   61,   62,   69,   69,   62,   62,   69,
+       55,   62,   62,   78,   61,   69,  105,   61,   78,   61,
+       66,   61,  106,   55,   62,   66,   57,   89,   66,   89,
+      110,  120,  121,  122,  124,  126,  127,  128,   55,   58,
+
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   70,   72,   77,   77,   70,   91,   76,   92,
+       70,   72,   76,   72,   93,   76,  103,   73,   72,   72,
+       73,   73,   76,   76,  107,  108,   70,  111,   76,  112,
+
+      115,   73,  123,   91,   73,   92,  119,   77,  129,   77,
+      131,  123,   93,   77,  103,  123,  132,  119,  133,  137,
+      107,  138,  108,  115,  140,  111,  112,   87,   87,   77,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+      102,  109,  113,  141,  114,  125,  135,  102,  116,  116,
+      116,  130,  130,  116,  125,  125,  134,  136,  134,  135,
+      116,  130,  139,  143,  142,  139,  144,  145,  146,  139,
+      113,  114,  109,  136,  147,  134,  148,  102,  149,  151,
+      150,  102,  152,  153,  154,  102,  155,  156,  157,  158,
+      116,  159,  160,  102,  116,  161,  163,  102,  116,  102,
+      102,  150,  118,  118,  118,  164,  116,  118,  142,  166,
+      116,  170,  116,  116,  172,  118,  118,  118,  118,  118,
+      162,  162,  162,  169,  118,  118,  118,  118,  118,  118,
+      165,  167,  168,  165,  165,  167,  168,  171,  173,  174,
+
+      175,  171,  176,  177,  178,  171,  179,  118,  118,  118,
+      118,  118,  118,  180,  181,  182,  183,  184,  169,  169,
+      169,  185,  186,  187,  188,  189,  190,  191,  192,  169,
+      196,  169,  197,  169,  169,  195,  169,  199,  202,  200,
+      203,  204,  194,  194,  194,  194,  194,  188,  205,  187,
+      186,  194,  194,  194,  194,  194,  194,  206,  195,  207,
+      208,  211,  212,  213,  204,  199,  200,  214,  215,  216,
+      217,  215,  216,  218,  194,  194,  194,  194,  194,  194,
+      206,  219,  220,  221,  223,  224,  225,  208,  210,  210,
+      210,  210,  210,  202,  226,  222,  228,  210,  210,  210,
+
+      210,  210,  210,  222,  227,  229,  227,  230,  222,  222,
+      231,  232,  233,  234,  232,  235,  236,  237,  238,  239,
+      210,  210,  210,  210,  210,  210,  240,  241,  242,  243,
+      244,  245,  246,  238,  248,  249,  250,  251,  252,  253,
+      254,  255,  256,  257,  258,  259,  260,  261,  262,  263,
+      264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
+      274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
+      284,  285,  286,  287,  285,  288,  289,  290,  291,  292,
+      293,  294,  295,  296,  258,  298,  297,  299,  300,  302,
+      301,  303,  254,  293,  297,  301,  257,  260,  304,  257,
+
+      305,  306,  307,  267,  308,  309,  312,  315,  316,  316,
+      316,  316,  316,  318,  320,  265,  321,  316,  316,  316,
+      316,  316,  316,  317,  319,  319,  323,  324,  309,  326,
+      328,  331,  332,  319,  333,  334,  335,  320,  336,  334,
+      316,  316,  316,  316,  316,  316,  337,  329,  329,  329,
+      329,  329,  317,  338,  339,  324,  329,  329,  329,  329,
+      329,  329,  340,  341,  342,  343,  346,  347,  344,  348,
+      319,  349,  347,  350,  351,  354,  355,  356,  357,  329,
+      329,  329,  329,  329,  329,  344,  352,  358,  353,  359,
+      360,  361,  352,  353,  362,  363,  364,  365,  366,  367,
+
+      368,  369,  370,  366,  371,  372,  373,  374,  375,  376,
+      377,  378,  378,  378,  379,  380,  381,  378,  382,  383,
+      384,  385,  386,  388,  382,  389,  390,  391,  392,  393,
+      394,  385,  395,  361,  393,  396,  397,  398,  399,  400,
+      394,  401,  402,  403,  404,  401,  405,  406,  407,  408,
+      365,  366,  409,  410,  411,  412,  366,  410,  408,  413,
+      414,  415,  416,  417,  414,  418,  419,  420,  421,  422,
+      423,  424,  425,  426,  389,  428,  427,  429,  411,  427,
+      430,  431,  432,  433,  434,  437,  439,  432,  440,  438,
+      438,  438,  438,  438,  441,  398,  442,  407,  438,  438,
+
+      438,  438,  438,  438,  443,  444,  446,  447,  449,  451,
+      449,  452,  453,  454,  439,  455,  457,  453,  458,  460,
+      461,  438,  438,  438,  438,  438,  438,  456,  464,  450,
+      450,  450,  450,  450,  463,  449,  465,  449,  450,  450,
+      450,  450,  450,  450,  462,  466,  468,  469,  462,  470,
+      463,  471,  472,  474,  473,  469,  475,  469,  469,  469,
+      477,  450,  450,  450,  450,  450,  450,  473,  478,  479,
+      480,  481,  479,  456,  482,  483,  484,  485,  486,  487,
+      483,  489,  490,  491,  492,  493,  494,  495,  496,  497,
+      495,  498,  499,  500,  501,  502,  503,  504,  505,  506,
+
+      504,  507,  508,  509,  510,  511,  512,  514,  505,  515,
+      516,  517,  518,  519,  520,  521,  522,  523,  524,  525,
+      526,  528,  530,  531,  532,  533,  507,  534,  535,  536,
+      532,  537,  538,  539,  540,  541,  542,  543,  544,  545,
+      546,  547,  548,  544,  549,  551,  550,  552,  549,  550,
+      553,  554,  555,  556,  557,  558,  559,  560,  561,  562,
+      566,  568,  569,  570,  571,  573,  574,  577,  579,  572,
+      572,  572,  572,  572,  583,  579,  587,  546,  572,  572,
+      572,  572,  572,  572,  581,  582,  586,  588,  586,  589,
+      588,  590,  591,  592,  593,  594,  595,  588,  596,  597,
+
+      598,  572,  572,  572,  572,  572,  572,  599,  600,  601,
+      603,  581,  604,  582,  602,  602,  605,  606,  607,  608,
+      609,  610,  611,  612,  613,  614,  615,  616,  617,  619,
+      620,  621,  622,  623,  624,  625,  626,  628,  629,  630,
+      631,  632,  634,  625,  633,  633,  635,  636,  637,  638,
+      629,  635,  639,  636,  640,  641,  642,  643,  644,  645,
+      646,  647,  649,  650,  652,  653,  654,  655,  656,  610,
+      657,  658,  659,  660,  661,  641,  659,  663,  664,  665,
+      666,  667,  668,  669,  665,  670,  671,  672,  673,  669,
+      674,  675,  676,  678,  679,  680,  681,  682,  683,  684,
+
+      685,  686,  687,  688,  689,  690,  655,  692,  693,  694,
+      695,  696,  697,  698,  699,  700,  703,  704,  705,  692,
+      706,  707,  708,  665,  709,  700,  711,  709,  710,  710,
+      712,  713,  714,  715,  716,  717,  718,  719,  719,  714,
+      719,  720,  721,  722,  707,  723,  724,  725,  706,  726,
+      727,  728,  729,  730,  731,  732,  733,  734,  735,  736,
+      737,  738,  739,  740,  741,  738,  740,  729,  742,  743,
+      744,  745,  747,  748,  749,  750,  751,  752,  753,  754,
+      755,  756,  757,  758,  759,  760,  761,  762,  763,  764,
+      765,  766,  767,  765,  768,  770,  771,  772,  773,  774,
+
+      763,  775,  776,  777,  779,  780,  781,  782,  783,  784,
+      785,  786,  787,  789,  790,  791,  792,  793,  794,  795,
+      796,  797,  798,  799,  800,  801,  802,  803,  804,  805,
+      806,  807,  792,  808,  809,  810,  811,  812,  813,  814,
+      816,  809,  817,  811,  818,  814,  819,  811,  820,  813,
+      821,  822,  823,  824,  825,  826,  828,  824,  829,  830,
+      831,  832,  833,  834,  835,  836,  837,  835,  838,  839,
+      841,  836,  842,  843,  844,  845,  846,  847,  848,  849,
+      850,  851,  852,  853,  854,  855,  829,  856,  857,  858,
+      859,  860,  861,  862,  863,  864,  865,  866,  867,  869,
+
+      870,  871,  872,  873,  874,  875,  876,  877,  878,  874,
+      879,  880,  872,  881,  882,  883,  886,  887,  888,  889,
+      890,  891,  892,  895,  896,  897,  898,  899,  900,  901,
+      902,  903,  900,  904,  905,  907,  909,  910,  911,  912,
+      913,  914,  915,  916,  917,  915,  918,  916,  919,  920,
+      921,  922,  923,  924,  925,  926,  927,  923,  928,  929,
+      930,  930,  931,  932,  933,  934,  935,  936,  937,  938,
+      939,  940,  942,  943,  944,  945,  946,  934,  947,  948,
+      949,  950,  951,  951,  953,  954,  955,  956,  957,  958,
+      959,  957,  909,  948,  960,  961,  962,  964,  965,  966,
+
+      967,  968,  969,  970,  971,  972,  973,  974,  954,  975,
+      976,  953,  977,  978,  979,  980,  981,  982,  983,  984,
+      986,  987,  988,  989,  990,  991,  992,  993,  994,  995,
+      996,  998,  999, 1000, 1001, 1002, 1003, 1005, 1006, 1007,
+     1002, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+     1017, 1000, 1018, 1019, 1020, 1021, 1022, 1023, 1025, 1024,
+     1007, 1028, 1029, 1030, 1032, 1033, 1034, 1035, 1036, 1021,
+     1024, 1032, 1037, 1039, 1034, 1040, 1041, 1042, 1043, 1044,
+     1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+     1055, 1056, 1058, 1002, 1059, 1060, 1061, 1062, 1063, 1064,
+
+     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1074, 1072, 1068,
+     1073, 1073, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
+     1083, 1084, 1085, 1087, 1086, 1088, 1089, 1090, 1091, 1092,
+     1093, 1094, 1095, 1096, 1071, 1072, 1086, 1097, 1098, 1100,
+     1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110,
+     1095, 1111, 1112, 1113, 1114, 1115, 1116, 1118, 1119, 1120,
+     1114, 1121, 1122, 1119, 1123, 1124, 1125, 1113, 1126, 1127,
+     1128, 1129, 1130, 1112, 1131, 1132, 1133, 1134, 1135, 1136,
+     1135, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
+     1146, 1147, 1148, 1149, 1151, 1152, 1153, 1154, 1149, 1155,
+
+     1156, 1157, 1158, 1120, 1159, 1160, 1161, 1154, 1162, 1164,
+     1165, 1161, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+     1176, 1177, 1178, 1179, 1180, 1181, 1164, 1182, 1183, 1184,
+     1185, 1186, 1187, 1188, 1189, 1192, 1176, 1149, 1190, 1191,
+     1191, 1178, 1193, 1194, 1190, 1195, 1196, 1197, 1198, 1199,
+     1200, 1183, 1202, 1200, 1203, 1204, 1205, 1184, 1206, 1207,
+     1209, 1195, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
+     1207, 1204, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
+     1228, 1230, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+     1240, 1241, 1242, 1243, 1244, 1246, 1247, 1248, 1250, 1251,
+
+     1252, 1253, 1256, 1258, 1260, 1247, 1262, 1263, 1264, 1265,
+     1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
+     1276, 1277, 1278, 1280, 1281, 1282, 1285, 1286, 1287, 1288,
+     1289, 1290, 1291, 1292, 1293, 1294, 1296, 1297, 1298, 1299,
+     1300, 1301, 1302, 1304, 1303, 1305, 1306, 1307, 1309, 1310,
+     1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320,
+     1321, 1322, 1293, 1324, 1325, 1326, 1325, 1327, 1328, 1329,
+     1318, 1274, 1330, 1331, 1332, 1327, 1333, 1334, 1335, 1336,
+     1337, 1338, 1339, 1341, 1342, 1343, 1344, 1285, 1303, 1345,
+     1346, 1347, 1348, 1343, 1349, 1350, 1353, 1354, 1355, 1356,
+
+     1357, 1358, 1359, 1360, 1361, 1362, 1342, 1363, 1364, 1365,
+     1366, 1368, 1369, 1370, 1355, 1371, 1372, 1373, 1375, 1377,
+     1380, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1382, 1390,
+     1391, 1392, 1393, 1394, 1395, 1396, 1398, 1392, 1399, 1400,
+     1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1405,
+     1388, 1410, 1411, 1412, 1413, 1416, 1417, 1418, 1419, 1420,
+     1421, 1422, 1423, 1424, 1425, 1426, 1428, 1431, 1433, 1434,
+     1435, 1436, 1437, 1438, 1439, 1440, 1441, 1443, 1444, 1445,
+     1446, 1447, 1446, 1448, 1450, 1451, 1452, 1454, 1455, 1457,
+     1458, 1390, 1459, 1460, 1461, 1463, 1464, 1465, 1466, 1461,
+
+     1467, 1469, 1470, 1471, 1473, 1474, 1465, 1475, 1476, 1479,
+     1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
+     1491, 1490, 1492, 1493, 1494, 1496, 1497, 1499, 1500, 1501,
+     1502, 1473, 1490, 1503, 1504, 1505, 1506, 1506, 1507, 1508,
+     1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518,
+     1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1528, 1529,
+     1530, 1491, 1531, 1532, 1533, 1534, 1536, 1537, 1539, 1540,
+     1541, 1542, 1475, 1543, 1545, 1546, 1528, 1547, 1548, 1551,
+     1552, 1553, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564,
+     1499, 1567, 1564, 1566, 1568, 1569, 1507, 1570, 1566, 1571,
+
+     1572, 1543, 1573, 1574, 1576, 1577, 1579, 1581, 1582, 1583,
+     1585, 1586, 1587, 1588, 1590, 1591, 1592, 1593, 1594, 1595,
+     1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
+     1607, 1608, 1609, 1610, 1611, 1613, 1614, 1557, 1615, 1617,
+     1618, 1619, 1620, 1621, 1622, 1623, 1624, 1626, 1627, 1628,
+     1629, 1630, 1632, 1572, 1633, 1634, 1636, 1637, 1637, 1638,
+     1639, 1640, 1641, 1642, 1643, 1644, 1645, 1601, 1646, 1636,
+     1647, 1648, 1649, 1650, 1649, 1651, 1652, 1653, 1654, 1656,
+     1657, 1605, 1648, 1658, 1660, 1661, 1662, 1665, 1666, 1668,
+     1669, 1662, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+
+     1678, 1679, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1689,
+     1690, 1691, 1692, 1694, 1695, 1696, 1697, 1698, 1699, 1700,
+     1701, 1702, 1703, 1704, 1706, 1707, 1645, 1708, 1709, 1710,
+     1711, 1712, 1713, 1714, 1715, 1716, 1717, 1719, 1720, 1721,
+     1722, 1723, 1724, 1725, 1725, 1726, 1729, 1730, 1706, 1731,
+     1732, 1733, 1734, 1735, 1736, 1737, 1739, 1740, 1741, 1742,
+     1743, 1744, 1740, 1745, 1746, 1747, 1748, 1749, 1750, 1751,
+     1752, 1753, 1754, 1755, 1756, 1757, 1758, 1760, 1761, 1762,
+     1763, 1764, 1765, 1766, 1768, 1770, 1772, 1775, 1776, 1777,
+     1778, 1779, 1780, 1781, 1783, 1786, 1788, 1789, 1790, 1791,
+
+     1792, 1793, 1794, 1796, 1797, 1799, 1794, 1800, 1789, 1801,
+     1803, 1804, 1806, 1807, 1809, 1811, 1812, 1813, 1814, 1815,
+     1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+     1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1836,
+     1837, 1838, 1839, 1840, 1841, 1779, 1842, 1843, 1844, 1845,
+     1846, 1847, 1849, 1850, 1851, 1852, 1855, 1856, 1858, 1859,
+     1842, 1860, 1861, 1862, 1863, 1867, 1870, 1871, 1862, 1873,
+     1874, 1855, 1875, 1876, 1877, 1878, 1881, 1884, 1885, 1886,
+     1816, 1887, 1888, 1890, 1891, 1893, 1894, 1895, 1897, 1898,
+     1899, 1901, 1902, 1904, 1836, 1904, 1904, 1904, 1904, 1904,
+
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1875, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1891, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+     1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1843,30 +2050,32 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[201] =
+static const flex_int16_t yy_rule_linenum[214] =
     {   0,
-      149,  151,  153,  158,  159,  164,  165,  166,  178,  181,
-      186,  193,  202,  211,  220,  229,  238,  247,  256,  265,
-      274,  283,  292,  301,  310,  322,  334,  344,  354,  364,
-      374,  384,  393,  403,  413,  423,  433,  442,  451,  460,
-      469,  478,  487,  496,  505,  514,  523,  532,  541,  550,
-      559,  572,  581,  590,  599,  608,  619,  630,  641,  652,
-      664,  675,  686,  697,  708,  719,  730,  741,  752,  763,
-      774,  785,  794,  805,  816,  827,  838,  849,  860,  871,
-      882,  891,  900,  911,  922,  933,  944,  955,  966,  976,
-      985,  994, 1009, 1025, 1034, 1043, 1052, 1061, 1070, 1079,
-
-     1088, 1097, 1106, 1115, 1138, 1161, 1170, 1180, 1190, 1199,
-     1209, 1220, 1229, 1238, 1247, 1256, 1265, 1275, 1284, 1293,
-     1302, 1313, 1324, 1335, 1344, 1354, 1363, 1372, 1381, 1390,
-     1399, 1408, 1417, 1426, 1436, 1448, 1461, 1470, 1479, 1489,
-     1499, 1508, 1519, 1529, 1538, 1548, 1558, 1567, 1576, 1585,
-     1594, 1604, 1613, 1623, 1632, 1641, 1650, 1659, 1668, 1677,
-     1686, 1695, 1704, 1713, 1722, 1731, 1740, 1749, 1758, 1767,
-     1776, 1785, 1794, 1803, 1812, 1821, 1830, 1839, 1848, 1857,
-     1866, 1875, 1885, 1984, 1989, 1994, 1999, 2000, 2001, 2002,
-     2003, 2004, 2006, 2024, 2037, 2042, 2046, 2048, 2050, 2052
-
+      148,  150,  152,  157,  158,  163,  164,  165,  177,  180,
+      185,  192,  201,  210,  219,  228,  237,  246,  255,  264,
+      273,  282,  291,  300,  309,  321,  333,  343,  353,  363,
+      373,  383,  392,  402,  412,  422,  432,  441,  450,  459,
+      468,  477,  486,  495,  504,  513,  522,  531,  540,  549,
+      558,  567,  576,  585,  595,  608,  617,  626,  635,  644,
+      655,  666,  677,  688,  700,  711,  722,  733,  744,  755,
+      766,  777,  788,  799,  810,  821,  830,  841,  852,  863,
+      874,  885,  896,  907,  918,  927,  936,  947,  958,  969,
+      980,  991, 1002, 1012, 1021, 1030, 1045, 1061, 1070, 1079,
+
+     1088, 1097, 1106, 1115, 1124, 1133, 1142, 1151, 1174, 1197,
+     1206, 1216, 1226, 1235, 1245, 1256, 1265, 1274, 1283, 1292,
+     1301, 1311, 1320, 1329, 1338, 1349, 1360, 1371, 1382, 1393,
+     1402, 1412, 1421, 1430, 1439, 1448, 1457, 1466, 1475, 1484,
+     1493, 1502, 1511, 1520, 1529, 1538, 1548, 1560, 1573, 1582,
+     1591, 1601, 1611, 1620, 1631, 1641, 1650, 1660, 1670, 1679,
+     1688, 1697, 1706, 1716, 1725, 1735, 1744, 1753, 1762, 1771,
+     1780, 1789, 1798, 1807, 1816, 1825, 1834, 1843, 1852, 1861,
+     1870, 1879, 1888, 1897, 1906, 1915, 1924, 1933, 1942, 1951,
+     1960, 1969, 1978, 1987, 1996, 2006, 2105, 2110, 2115, 2120,
+
+     2121, 2122, 2123, 2124, 2125, 2127, 2145, 2158, 2163, 2167,
+     2169, 2171, 2173
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1878,7 +2087,7 @@ static const flex_int16_t yy_rule_linenum[201] =
 #define YY_RESTORE_YY_MORE_OFFSET
 char *yytext;
 #line 1 "dhcp6_lexer.ll"
-/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -1919,7 +2128,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1922 "dhcp6_lexer.cc"
+#line 2131 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1945,8 +2154,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1948 "dhcp6_lexer.cc"
-#line 1949 "dhcp6_lexer.cc"
+#line 2157 "dhcp6_lexer.cc"
+#line 2158 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2278,7 +2487,7 @@ YY_DECL
     }
 
 
-#line 2281 "dhcp6_lexer.cc"
+#line 2490 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2307,13 +2516,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1758 )
+				if ( yy_current_state >= 1905 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1757 );
+		while ( yy_current_state != 1904 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2332,13 +2541,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 201 )
+			else if ( yy_act < 214 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 201 )
+			else if ( yy_act == 214 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 202 )
+			else if ( yy_act == 215 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2928,6 +3137,55 @@ YY_RULE_SETUP
 case 51:
 YY_RULE_SETUP
 #line 559 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_WRITE_BEHIND_CACHE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("write-behind-cache", driver.loc_);
+    }
+}
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+#line 568 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_WRITE_BACK_LATENCY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("write-back-latency", driver.loc_);
+    }
+}
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+#line 577 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_JOURNAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-journal", driver.loc_);
+    }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 586 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_READ_REPLICAS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("read-replicas", driver.loc_);
+    }
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+#line 596 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2941,9 +3199,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 572 "dhcp6_lexer.ll"
+#line 609 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2953,9 +3211,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 581 "dhcp6_lexer.ll"
+#line 618 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2965,9 +3223,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 590 "dhcp6_lexer.ll"
+#line 627 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2977,9 +3235,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 599 "dhcp6_lexer.ll"
+#line 636 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2989,9 +3247,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 608 "dhcp6_lexer.ll"
+#line 645 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3003,9 +3261,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 619 "dhcp6_lexer.ll"
+#line 656 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3017,9 +3275,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 630 "dhcp6_lexer.ll"
+#line 667 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3031,9 +3289,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 63:
 YY_RULE_SETUP
-#line 641 "dhcp6_lexer.ll"
+#line 678 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3045,9 +3303,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 64:
 YY_RULE_SETUP
-#line 652 "dhcp6_lexer.ll"
+#line 689 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3060,9 +3318,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 65:
 YY_RULE_SETUP
-#line 664 "dhcp6_lexer.ll"
+#line 701 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3074,9 +3332,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 66:
 YY_RULE_SETUP
-#line 675 "dhcp6_lexer.ll"
+#line 712 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3088,9 +3346,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 67:
 YY_RULE_SETUP
-#line 686 "dhcp6_lexer.ll"
+#line 723 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3102,9 +3360,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 68:
 YY_RULE_SETUP
-#line 697 "dhcp6_lexer.ll"
+#line 734 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3116,9 +3374,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 69:
 YY_RULE_SETUP
-#line 708 "dhcp6_lexer.ll"
+#line 745 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3130,9 +3388,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 70:
 YY_RULE_SETUP
-#line 719 "dhcp6_lexer.ll"
+#line 756 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3144,9 +3402,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 71:
 YY_RULE_SETUP
-#line 730 "dhcp6_lexer.ll"
+#line 767 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3158,9 +3416,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 72:
 YY_RULE_SETUP
-#line 741 "dhcp6_lexer.ll"
+#line 778 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3172,9 +3430,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 73:
 YY_RULE_SETUP
-#line 752 "dhcp6_lexer.ll"
+#line 789 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3186,9 +3444,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 74:
 YY_RULE_SETUP
-#line 763 "dhcp6_lexer.ll"
+#line 800 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3200,9 +3458,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 75:
 YY_RULE_SETUP
-#line 774 "dhcp6_lexer.ll"
+#line 811 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3214,9 +3472,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 76:
 YY_RULE_SETUP
-#line 785 "dhcp6_lexer.ll"
+#line 822 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3226,9 +3484,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 77:
 YY_RULE_SETUP
-#line 794 "dhcp6_lexer.ll"
+#line 831 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3240,9 +3498,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 78:
 YY_RULE_SETUP
-#line 805 "dhcp6_lexer.ll"
+#line 842 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3254,9 +3512,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 79:
 YY_RULE_SETUP
-#line 816 "dhcp6_lexer.ll"
+#line 853 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3268,9 +3526,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 80:
 YY_RULE_SETUP
-#line 827 "dhcp6_lexer.ll"
+#line 864 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3282,9 +3540,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 81:
 YY_RULE_SETUP
-#line 838 "dhcp6_lexer.ll"
+#line 875 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3296,9 +3554,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 82:
 YY_RULE_SETUP
-#line 849 "dhcp6_lexer.ll"
+#line 886 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3310,9 +3568,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 83:
 YY_RULE_SETUP
-#line 860 "dhcp6_lexer.ll"
+#line 897 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3324,9 +3582,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 84:
 YY_RULE_SETUP
-#line 871 "dhcp6_lexer.ll"
+#line 908 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3338,9 +3596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 85:
 YY_RULE_SETUP
-#line 882 "dhcp6_lexer.ll"
+#line 919 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3350,9 +3608,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 86:
 YY_RULE_SETUP
-#line 891 "dhcp6_lexer.ll"
+#line 928 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3362,9 +3620,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 87:
 YY_RULE_SETUP
-#line 900 "dhcp6_lexer.ll"
+#line 937 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3376,9 +3634,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 88:
 YY_RULE_SETUP
-#line 911 "dhcp6_lexer.ll"
+#line 948 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3390,9 +3648,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 89:
 YY_RULE_SETUP
-#line 922 "dhcp6_lexer.ll"
+#line 959 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3404,9 +3662,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 90:
 YY_RULE_SETUP
-#line 933 "dhcp6_lexer.ll"
+#line 970 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3418,9 +3676,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 91:
 YY_RULE_SETUP
-#line 944 "dhcp6_lexer.ll"
+#line 981 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3432,9 +3690,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 92:
 YY_RULE_SETUP
-#line 955 "dhcp6_lexer.ll"
+#line 992 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3446,9 +3704,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 93:
 YY_RULE_SETUP
-#line 966 "dhcp6_lexer.ll"
+#line 1003 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3459,9 +3717,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 94:
 YY_RULE_SETUP
-#line 976 "dhcp6_lexer.ll"
+#line 1013 "dhcp6_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3471,9 +3729,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 95:
 YY_RULE_SETUP
-#line 985 "dhcp6_lexer.ll"
+#line 1022 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3483,9 +3741,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 96:
 YY_RULE_SETUP
-#line 994 "dhcp6_lexer.ll"
+#line 1031 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3501,9 +3759,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 97:
 YY_RULE_SETUP
-#line 1009 "dhcp6_lexer.ll"
+#line 1046 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3520,9 +3778,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 98:
 YY_RULE_SETUP
-#line 1025 "dhcp6_lexer.ll"
+#line 1062 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3532,9 +3790,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 99:
 YY_RULE_SETUP
-#line 1034 "dhcp6_lexer.ll"
+#line 1071 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3544,9 +3802,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 100:
 YY_RULE_SETUP
-#line 1043 "dhcp6_lexer.ll"
+#line 1080 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3556,9 +3814,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 101:
 YY_RULE_SETUP
-#line 1052 "dhcp6_lexer.ll"
+#line 1089 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3568,9 +3826,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 102:
 YY_RULE_SETUP
-#line 1061 "dhcp6_lexer.ll"
+#line 1098 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3580,9 +3838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 103:
 YY_RULE_SETUP
-#line 1070 "dhcp6_lexer.ll"
+#line 1107 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3592,9 +3850,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 104:
 YY_RULE_SETUP
-#line 1079 "dhcp6_lexer.ll"
+#line 1116 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3604,9 +3862,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 105:
 YY_RULE_SETUP
-#line 1088 "dhcp6_lexer.ll"
+#line 1125 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3616,9 +3874,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 106:
 YY_RULE_SETUP
-#line 1097 "dhcp6_lexer.ll"
+#line 1134 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3628,9 +3886,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 107:
 YY_RULE_SETUP
-#line 1106 "dhcp6_lexer.ll"
+#line 1143 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -3640,9 +3898,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 108:
 YY_RULE_SETUP
-#line 1115 "dhcp6_lexer.ll"
+#line 1152 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3666,9 +3924,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 109:
 YY_RULE_SETUP
-#line 1138 "dhcp6_lexer.ll"
+#line 1175 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3692,9 +3950,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 110:
 YY_RULE_SETUP
-#line 1161 "dhcp6_lexer.ll"
+#line 1198 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3704,9 +3962,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 111:
 YY_RULE_SETUP
-#line 1170 "dhcp6_lexer.ll"
+#line 1207 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3717,9 +3975,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 112:
 YY_RULE_SETUP
-#line 1180 "dhcp6_lexer.ll"
+#line 1217 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3730,9 +3988,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 113:
 YY_RULE_SETUP
-#line 1190 "dhcp6_lexer.ll"
+#line 1227 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3742,9 +4000,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 114:
 YY_RULE_SETUP
-#line 1199 "dhcp6_lexer.ll"
+#line 1236 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3755,9 +4013,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 115:
 YY_RULE_SETUP
-#line 1209 "dhcp6_lexer.ll"
+#line 1246 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3769,9 +4027,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 116:
 YY_RULE_SETUP
-#line 1220 "dhcp6_lexer.ll"
+#line 1257 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3781,9 +4039,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 117:
 YY_RULE_SETUP
-#line 1229 "dhcp6_lexer.ll"
+#line 1266 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3793,9 +4051,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 118:
 YY_RULE_SETUP
-#line 1238 "dhcp6_lexer.ll"
+#line 1275 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3805,9 +4063,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 119:
 YY_RULE_SETUP
-#line 1247 "dhcp6_lexer.ll"
+#line 1284 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3817,9 +4075,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 120:
 YY_RULE_SETUP
-#line 1256 "dhcp6_lexer.ll"
+#line 1293 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3829,9 +4087,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 121:
 YY_RULE_SETUP
-#line 1265 "dhcp6_lexer.ll"
+#line 1302 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3842,9 +4100,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 122:
 YY_RULE_SETUP
-#line 1275 "dhcp6_lexer.ll"
+#line 1312 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3854,9 +4112,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 123:
 YY_RULE_SETUP
-#line 1284 "dhcp6_lexer.ll"
+#line 1321 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3866,9 +4124,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 124:
 YY_RULE_SETUP
-#line 1293 "dhcp6_lexer.ll"
+#line 1330 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3878,9 +4136,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 125:
 YY_RULE_SETUP
-#line 1302 "dhcp6_lexer.ll"
+#line 1339 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3892,9 +4150,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 126:
 YY_RULE_SETUP
-#line 1313 "dhcp6_lexer.ll"
+#line 1350 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3906,9 +4164,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 127:
 YY_RULE_SETUP
-#line 1324 "dhcp6_lexer.ll"
+#line 1361 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3920,9 +4178,37 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 128:
+YY_RULE_SETUP
+#line 1372 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+    case isc::dhcp::Parser6Context::SUBNET6:
+    case isc::dhcp::Parser6Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_THRESHOLD(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-threshold", driver.loc_);
+    }
+}
+	YY_BREAK
+case 129:
+YY_RULE_SETUP
+#line 1383 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+    case isc::dhcp::Parser6Context::SUBNET6:
+    case isc::dhcp::Parser6Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_MAX_AGE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-max-age", driver.loc_);
+    }
+}
+	YY_BREAK
+case 130:
 YY_RULE_SETUP
-#line 1335 "dhcp6_lexer.ll"
+#line 1394 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3932,9 +4218,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 131:
 YY_RULE_SETUP
-#line 1344 "dhcp6_lexer.ll"
+#line 1403 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3945,9 +4231,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 132:
 YY_RULE_SETUP
-#line 1354 "dhcp6_lexer.ll"
+#line 1413 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3957,9 +4243,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 133:
 YY_RULE_SETUP
-#line 1363 "dhcp6_lexer.ll"
+#line 1422 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3969,9 +4255,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 134:
 YY_RULE_SETUP
-#line 1372 "dhcp6_lexer.ll"
+#line 1431 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3981,9 +4267,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 135:
 YY_RULE_SETUP
-#line 1381 "dhcp6_lexer.ll"
+#line 1440 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3993,9 +4279,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 136:
 YY_RULE_SETUP
-#line 1390 "dhcp6_lexer.ll"
+#line 1449 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4005,9 +4291,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 137:
 YY_RULE_SETUP
-#line 1399 "dhcp6_lexer.ll"
+#line 1458 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4017,9 +4303,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 138:
 YY_RULE_SETUP
-#line 1408 "dhcp6_lexer.ll"
+#line 1467 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 139:
+YY_RULE_SETUP
+#line 1476 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 140:
+YY_RULE_SETUP
+#line 1485 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC_OVERFLOW(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async-overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 141:
+YY_RULE_SETUP
+#line 1494 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4029,9 +4351,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 142:
+YY_RULE_SETUP
+#line 1503 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGERS:
+        return isc::dhcp::Dhcp6Parser::make_RATE_LIMITED_MESSAGES(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate-limited-messages", driver.loc_);
+    }
+}
+	YY_BREAK
+case 143:
+YY_RULE_SETUP
+#line 1512 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGERS:
+        return isc::dhcp::Dhcp6Parser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 144:
+YY_RULE_SETUP
+#line 1521 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGERS:
+        return isc::dhcp::Dhcp6Parser::make_RATE_LIMIT_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate-limit-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 145:
 YY_RULE_SETUP
-#line 1417 "dhcp6_lexer.ll"
+#line 1530 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4041,9 +4399,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 146:
 YY_RULE_SETUP
-#line 1426 "dhcp6_lexer.ll"
+#line 1539 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4054,9 +4412,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 147:
 YY_RULE_SETUP
-#line 1436 "dhcp6_lexer.ll"
+#line 1549 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4069,9 +4427,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 148:
 YY_RULE_SETUP
-#line 1448 "dhcp6_lexer.ll"
+#line 1561 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4085,9 +4443,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 149:
 YY_RULE_SETUP
-#line 1461 "dhcp6_lexer.ll"
+#line 1574 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -4097,9 +4455,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 150:
 YY_RULE_SETUP
-#line 1470 "dhcp6_lexer.ll"
+#line 1583 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -4109,9 +4467,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 151:
 YY_RULE_SETUP
-#line 1479 "dhcp6_lexer.ll"
+#line 1592 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4122,9 +4480,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 152:
 YY_RULE_SETUP
-#line 1489 "dhcp6_lexer.ll"
+#line 1602 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4135,9 +4493,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 153:
 YY_RULE_SETUP
-#line 1499 "dhcp6_lexer.ll"
+#line 1612 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4147,9 +4505,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 154:
 YY_RULE_SETUP
-#line 1508 "dhcp6_lexer.ll"
+#line 1621 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -4161,9 +4519,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 155:
 YY_RULE_SETUP
-#line 1519 "dhcp6_lexer.ll"
+#line 1632 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4174,9 +4532,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 156:
 YY_RULE_SETUP
-#line 1529 "dhcp6_lexer.ll"
+#line 1642 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4186,9 +4544,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 157:
 YY_RULE_SETUP
-#line 1538 "dhcp6_lexer.ll"
+#line 1651 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4199,9 +4557,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 158:
 YY_RULE_SETUP
-#line 1548 "dhcp6_lexer.ll"
+#line 1661 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4212,9 +4570,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 159:
 YY_RULE_SETUP
-#line 1558 "dhcp6_lexer.ll"
+#line 1671 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -4224,9 +4582,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 160:
 YY_RULE_SETUP
-#line 1567 "dhcp6_lexer.ll"
+#line 1680 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4236,9 +4594,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 161:
 YY_RULE_SETUP
-#line 1576 "dhcp6_lexer.ll"
+#line 1689 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4248,9 +4606,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 162:
 YY_RULE_SETUP
-#line 1585 "dhcp6_lexer.ll"
+#line 1698 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4260,9 +4618,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 163:
 YY_RULE_SETUP
-#line 1594 "dhcp6_lexer.ll"
+#line 1707 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4273,9 +4631,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 164:
 YY_RULE_SETUP
-#line 1604 "dhcp6_lexer.ll"
+#line 1717 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -4285,9 +4643,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 165:
 YY_RULE_SETUP
-#line 1613 "dhcp6_lexer.ll"
+#line 1726 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4297,9 +4655,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 166:
 YY_RULE_SETUP
-#line 1623 "dhcp6_lexer.ll"
+#line 1736 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4309,9 +4667,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 167:
 YY_RULE_SETUP
-#line 1632 "dhcp6_lexer.ll"
+#line 1745 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4321,9 +4679,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 168:
 YY_RULE_SETUP
-#line 1641 "dhcp6_lexer.ll"
+#line 1754 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4333,9 +4691,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 169:
 YY_RULE_SETUP
-#line 1650 "dhcp6_lexer.ll"
+#line 1763 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4345,9 +4703,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 170:
 YY_RULE_SETUP
-#line 1659 "dhcp6_lexer.ll"
+#line 1772 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4357,9 +4715,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 171:
 YY_RULE_SETUP
-#line 1668 "dhcp6_lexer.ll"
+#line 1781 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4369,9 +4727,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 172:
 YY_RULE_SETUP
-#line 1677 "dhcp6_lexer.ll"
+#line 1790 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4381,9 +4739,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 173:
 YY_RULE_SETUP
-#line 1686 "dhcp6_lexer.ll"
+#line 1799 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4393,9 +4751,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 174:
 YY_RULE_SETUP
-#line 1695 "dhcp6_lexer.ll"
+#line 1808 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4405,9 +4763,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 175:
 YY_RULE_SETUP
-#line 1704 "dhcp6_lexer.ll"
+#line 1817 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4417,9 +4775,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 164:
+case 176:
 YY_RULE_SETUP
-#line 1713 "dhcp6_lexer.ll"
+#line 1826 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4429,9 +4787,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 177:
 YY_RULE_SETUP
-#line 1722 "dhcp6_lexer.ll"
+#line 1835 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4441,9 +4799,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 166:
+case 178:
 YY_RULE_SETUP
-#line 1731 "dhcp6_lexer.ll"
+#line 1844 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4453,9 +4811,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 167:
+case 179:
 YY_RULE_SETUP
-#line 1740 "dhcp6_lexer.ll"
+#line 1853 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4465,9 +4823,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 168:
+case 180:
 YY_RULE_SETUP
-#line 1749 "dhcp6_lexer.ll"
+#line 1862 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4477,9 +4835,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 169:
+case 181:
 YY_RULE_SETUP
-#line 1758 "dhcp6_lexer.ll"
+#line 1871 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4489,9 +4847,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 170:
+case 182:
 YY_RULE_SETUP
-#line 1767 "dhcp6_lexer.ll"
+#line 1880 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4501,9 +4859,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 171:
+case 183:
+YY_RULE_SETUP
+#line 1889 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp6Parser::make_BACKGROUND_RECLAMATION(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("background-reclamation", driver.loc_);
+    }
+}
+	YY_BREAK
+case 184:
 YY_RULE_SETUP
-#line 1776 "dhcp6_lexer.ll"
+#line 1898 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4513,9 +4883,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 185:
 YY_RULE_SETUP
-#line 1785 "dhcp6_lexer.ll"
+#line 1907 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4525,9 +4895,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 173:
+case 186:
 YY_RULE_SETUP
-#line 1794 "dhcp6_lexer.ll"
+#line 1916 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4537,9 +4907,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 174:
+case 187:
 YY_RULE_SETUP
-#line 1803 "dhcp6_lexer.ll"
+#line 1925 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4549,9 +4919,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 175:
+case 188:
 YY_RULE_SETUP
-#line 1812 "dhcp6_lexer.ll"
+#line 1934 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4561,9 +4931,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 176:
+case 189:
 YY_RULE_SETUP
-#line 1821 "dhcp6_lexer.ll"
+#line 1943 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4573,9 +4943,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 177:
+case 190:
 YY_RULE_SETUP
-#line 1830 "dhcp6_lexer.ll"
+#line 1952 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4585,9 +4955,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 178:
+case 191:
 YY_RULE_SETUP
-#line 1839 "dhcp6_lexer.ll"
+#line 1961 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4597,9 +4967,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 179:
+case 192:
 YY_RULE_SETUP
-#line 1848 "dhcp6_lexer.ll"
+#line 1970 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4609,9 +4979,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 180:
+case 193:
 YY_RULE_SETUP
-#line 1857 "dhcp6_lexer.ll"
+#line 1979 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4621,9 +4991,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 181:
+case 194:
 YY_RULE_SETUP
-#line 1866 "dhcp6_lexer.ll"
+#line 1988 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4633,9 +5003,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 182:
+case 195:
 YY_RULE_SETUP
-#line 1875 "dhcp6_lexer.ll"
+#line 1997 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4645,9 +5015,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 183:
+case 196:
 YY_RULE_SETUP
-#line 1885 "dhcp6_lexer.ll"
+#line 2007 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4747,65 +5117,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 184:
-/* rule 184 can match eol */
+case 197:
+/* rule 197 can match eol */
 YY_RULE_SETUP
-#line 1984 "dhcp6_lexer.ll"
+#line 2106 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 185:
-/* rule 185 can match eol */
+case 198:
+/* rule 198 can match eol */
 YY_RULE_SETUP
-#line 1989 "dhcp6_lexer.ll"
+#line 2111 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 186:
+case 199:
 YY_RULE_SETUP
-#line 1994 "dhcp6_lexer.ll"
+#line 2116 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 187:
+case 200:
 YY_RULE_SETUP
-#line 1999 "dhcp6_lexer.ll"
+#line 2121 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 188:
+case 201:
 YY_RULE_SETUP
-#line 2000 "dhcp6_lexer.ll"
+#line 2122 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 189:
+case 202:
 YY_RULE_SETUP
-#line 2001 "dhcp6_lexer.ll"
+#line 2123 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 190:
+case 203:
 YY_RULE_SETUP
-#line 2002 "dhcp6_lexer.ll"
+#line 2124 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 191:
+case 204:
 YY_RULE_SETUP
-#line 2003 "dhcp6_lexer.ll"
+#line 2125 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 192:
+case 205:
 YY_RULE_SETUP
-#line 2004 "dhcp6_lexer.ll"
+#line 2126 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 193:
+case 206:
 YY_RULE_SETUP
-#line 2006 "dhcp6_lexer.ll"
+#line 2128 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4824,9 +5194,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 194:
+case 207:
 YY_RULE_SETUP
-#line 2024 "dhcp6_lexer.ll"
+#line 2146 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4840,43 +5210,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 195:
+case 208:
 YY_RULE_SETUP
-#line 2037 "dhcp6_lexer.ll"
+#line 2159 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 196:
+case 209:
 YY_RULE_SETUP
-#line 2042 "dhcp6_lexer.ll"
+#line 2164 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 197:
+case 210:
 YY_RULE_SETUP
-#line 2046 "dhcp6_lexer.ll"
+#line 2168 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 198:
+case 211:
 YY_RULE_SETUP
-#line 2048 "dhcp6_lexer.ll"
+#line 2170 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 199:
+case 212:
 YY_RULE_SETUP
-#line 2050 "dhcp6_lexer.ll"
+#line 2172 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 200:
+case 213:
 YY_RULE_SETUP
-#line 2052 "dhcp6_lexer.ll"
+#line 2174 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 2054 "dhcp6_lexer.ll"
+#line 2176 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -4900,12 +5270,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 201:
+case 214:
 YY_RULE_SETUP
-#line 2077 "dhcp6_lexer.ll"
+#line 2199 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4908 "dhcp6_lexer.cc"
+#line 5278 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5224,7 +5594,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1758 )
+			if ( yy_current_state >= 1905 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5257,11 +5627,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1758 )
+		if ( yy_current_state >= 1905 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1757);
+	yy_is_jam = (yy_current_state == 1904);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -6010,8 +6380,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 2077 "dhcp6_lexer.ll"
-
+#line 2199 "dhcp6_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -6113,4 +6482,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -248,29 +248,29 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -289,29 +289,29 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -330,29 +330,29 @@ namespace isc { namespace dhcp {
     state = that.state;
     switch (that.type_get ())
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -395,68 +395,68 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 192: // "constant string"
-#line 271 "dhcp6_parser.yy"
+      case 205: // "constant string"
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < std::string > (); }
 #line 402 "dhcp6_parser.cc"
         break;
 
-      case 193: // "integer"
-#line 271 "dhcp6_parser.yy"
+      case 206: // "integer"
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < int64_t > (); }
 #line 408 "dhcp6_parser.cc"
         break;
 
-      case 194: // "floating point"
-#line 271 "dhcp6_parser.yy"
+      case 207: // "floating point"
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < double > (); }
 #line 414 "dhcp6_parser.cc"
         break;
 
-      case 195: // "boolean"
-#line 271 "dhcp6_parser.yy"
+      case 208: // "boolean"
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < bool > (); }
 #line 420 "dhcp6_parser.cc"
         break;
 
-      case 213: // value
-#line 271 "dhcp6_parser.yy"
+      case 226: // value
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 426 "dhcp6_parser.cc"
         break;
 
-      case 217: // map_value
-#line 271 "dhcp6_parser.yy"
+      case 230: // map_value
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 432 "dhcp6_parser.cc"
         break;
 
-      case 258: // ddns_replace_client_name_value
-#line 271 "dhcp6_parser.yy"
+      case 273: // ddns_replace_client_name_value
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 438 "dhcp6_parser.cc"
         break;
 
-      case 292: // db_type
-#line 271 "dhcp6_parser.yy"
+      case 307: // db_type
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 444 "dhcp6_parser.cc"
         break;
 
-      case 386: // hr_mode
-#line 271 "dhcp6_parser.yy"
+      case 408: // hr_mode
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 450 "dhcp6_parser.cc"
         break;
 
-      case 522: // duid_type
-#line 271 "dhcp6_parser.yy"
+      case 544: // duid_type
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 456 "dhcp6_parser.cc"
         break;
 
-      case 565: // ncr_protocol_value
-#line 271 "dhcp6_parser.yy"
+      case 587: // ncr_protocol_value
+#line 284 "dhcp6_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 462 "dhcp6_parser.cc"
         break;
@@ -675,29 +675,29 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -722,139 +722,139 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 280 "dhcp6_parser.yy"
+#line 293 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 728 "dhcp6_parser.cc"
     break;
 
   case 4:
-#line 281 "dhcp6_parser.yy"
+#line 294 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.CONFIG; }
 #line 734 "dhcp6_parser.cc"
     break;
 
   case 6:
-#line 282 "dhcp6_parser.yy"
+#line 295 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.DHCP6; }
 #line 740 "dhcp6_parser.cc"
     break;
 
   case 8:
-#line 283 "dhcp6_parser.yy"
+#line 296 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 746 "dhcp6_parser.cc"
     break;
 
   case 10:
-#line 284 "dhcp6_parser.yy"
+#line 297 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.SUBNET6; }
 #line 752 "dhcp6_parser.cc"
     break;
 
   case 12:
-#line 285 "dhcp6_parser.yy"
+#line 298 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.POOLS; }
 #line 758 "dhcp6_parser.cc"
     break;
 
   case 14:
-#line 286 "dhcp6_parser.yy"
+#line 299 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.PD_POOLS; }
 #line 764 "dhcp6_parser.cc"
     break;
 
   case 16:
-#line 287 "dhcp6_parser.yy"
+#line 300 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 770 "dhcp6_parser.cc"
     break;
 
   case 18:
-#line 288 "dhcp6_parser.yy"
+#line 301 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.DHCP6; }
 #line 776 "dhcp6_parser.cc"
     break;
 
   case 20:
-#line 289 "dhcp6_parser.yy"
+#line 302 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 782 "dhcp6_parser.cc"
     break;
 
   case 22:
-#line 290 "dhcp6_parser.yy"
+#line 303 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 788 "dhcp6_parser.cc"
     break;
 
   case 24:
-#line 291 "dhcp6_parser.yy"
+#line 304 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 794 "dhcp6_parser.cc"
     break;
 
   case 26:
-#line 292 "dhcp6_parser.yy"
+#line 305 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 800 "dhcp6_parser.cc"
     break;
 
   case 28:
-#line 293 "dhcp6_parser.yy"
+#line 306 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.LOGGING; }
 #line 806 "dhcp6_parser.cc"
     break;
 
   case 30:
-#line 294 "dhcp6_parser.yy"
+#line 307 "dhcp6_parser.yy"
     { ctx.ctx_ = ctx.CONFIG_CONTROL; }
 #line 812 "dhcp6_parser.cc"
     break;
 
   case 32:
-#line 302 "dhcp6_parser.yy"
+#line 315 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 818 "dhcp6_parser.cc"
     break;
 
   case 33:
-#line 303 "dhcp6_parser.yy"
+#line 316 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 824 "dhcp6_parser.cc"
     break;
 
   case 34:
-#line 304 "dhcp6_parser.yy"
+#line 317 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 830 "dhcp6_parser.cc"
     break;
 
   case 35:
-#line 305 "dhcp6_parser.yy"
+#line 318 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 836 "dhcp6_parser.cc"
     break;
 
   case 36:
-#line 306 "dhcp6_parser.yy"
+#line 319 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 842 "dhcp6_parser.cc"
     break;
 
   case 37:
-#line 307 "dhcp6_parser.yy"
+#line 320 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 848 "dhcp6_parser.cc"
     break;
 
   case 38:
-#line 308 "dhcp6_parser.yy"
+#line 321 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 854 "dhcp6_parser.cc"
     break;
 
   case 39:
-#line 311 "dhcp6_parser.yy"
+#line 324 "dhcp6_parser.yy"
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -863,7 +863,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 316 "dhcp6_parser.yy"
+#line 329 "dhcp6_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -874,7 +874,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 41:
-#line 321 "dhcp6_parser.yy"
+#line 334 "dhcp6_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -884,13 +884,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 327 "dhcp6_parser.yy"
+#line 340 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 890 "dhcp6_parser.cc"
     break;
 
   case 45:
-#line 334 "dhcp6_parser.yy"
+#line 347 "dhcp6_parser.yy"
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -899,7 +899,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 338 "dhcp6_parser.yy"
+#line 351 "dhcp6_parser.yy"
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -909,7 +909,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 345 "dhcp6_parser.yy"
+#line 358 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -918,7 +918,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 348 "dhcp6_parser.yy"
+#line 361 "dhcp6_parser.yy"
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -926,7 +926,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 356 "dhcp6_parser.yy"
+#line 369 "dhcp6_parser.yy"
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -935,7 +935,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 360 "dhcp6_parser.yy"
+#line 373 "dhcp6_parser.yy"
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -944,7 +944,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 367 "dhcp6_parser.yy"
+#line 380 "dhcp6_parser.yy"
     {
     // List parsing about to start
 }
@@ -952,7 +952,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 369 "dhcp6_parser.yy"
+#line 382 "dhcp6_parser.yy"
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -961,7 +961,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 378 "dhcp6_parser.yy"
+#line 391 "dhcp6_parser.yy"
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -970,7 +970,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 58:
-#line 382 "dhcp6_parser.yy"
+#line 395 "dhcp6_parser.yy"
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -979,7 +979,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 59:
-#line 393 "dhcp6_parser.yy"
+#line 406 "dhcp6_parser.yy"
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -990,7 +990,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 60:
-#line 403 "dhcp6_parser.yy"
+#line 416 "dhcp6_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1001,7 +1001,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 61:
-#line 408 "dhcp6_parser.yy"
+#line 421 "dhcp6_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -1014,7 +1014,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 70:
-#line 431 "dhcp6_parser.yy"
+#line 444 "dhcp6_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1027,7 +1027,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 71:
-#line 438 "dhcp6_parser.yy"
+#line 451 "dhcp6_parser.yy"
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -1037,7 +1037,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 72:
-#line 446 "dhcp6_parser.yy"
+#line 459 "dhcp6_parser.yy"
     {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1047,7 +1047,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 73:
-#line 450 "dhcp6_parser.yy"
+#line 463 "dhcp6_parser.yy"
     {
     // No global parameter is required
     // parsing completed
@@ -1055,16 +1055,16 @@ namespace isc { namespace dhcp {
 #line 1056 "dhcp6_parser.cc"
     break;
 
-  case 125:
-#line 512 "dhcp6_parser.yy"
+  case 127:
+#line 527 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1064 "dhcp6_parser.cc"
     break;
 
-  case 126:
-#line 514 "dhcp6_parser.yy"
+  case 128:
+#line 529 "dhcp6_parser.yy"
     {
     ElementPtr datadir(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data-directory", datadir);
@@ -1073,8 +1073,8 @@ namespace isc { namespace dhcp {
 #line 1074 "dhcp6_parser.cc"
     break;
 
-  case 127:
-#line 520 "dhcp6_parser.yy"
+  case 129:
+#line 535 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
@@ -1082,8 +1082,8 @@ namespace isc { namespace dhcp {
 #line 1083 "dhcp6_parser.cc"
     break;
 
-  case 128:
-#line 525 "dhcp6_parser.yy"
+  case 130:
+#line 540 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-preferred-lifetime", prf);
@@ -1091,8 +1091,8 @@ namespace isc { namespace dhcp {
 #line 1092 "dhcp6_parser.cc"
     break;
 
-  case 129:
-#line 530 "dhcp6_parser.yy"
+  case 131:
+#line 545 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-preferred-lifetime", prf);
@@ -1100,8 +1100,8 @@ namespace isc { namespace dhcp {
 #line 1101 "dhcp6_parser.cc"
     break;
 
-  case 130:
-#line 535 "dhcp6_parser.yy"
+  case 132:
+#line 550 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1109,8 +1109,8 @@ namespace isc { namespace dhcp {
 #line 1110 "dhcp6_parser.cc"
     break;
 
-  case 131:
-#line 540 "dhcp6_parser.yy"
+  case 133:
+#line 555 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
@@ -1118,8 +1118,8 @@ namespace isc { namespace dhcp {
 #line 1119 "dhcp6_parser.cc"
     break;
 
-  case 132:
-#line 545 "dhcp6_parser.yy"
+  case 134:
+#line 560 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
@@ -1127,8 +1127,8 @@ namespace isc { namespace dhcp {
 #line 1128 "dhcp6_parser.cc"
     break;
 
-  case 133:
-#line 550 "dhcp6_parser.yy"
+  case 135:
+#line 565 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1136,8 +1136,8 @@ namespace isc { namespace dhcp {
 #line 1137 "dhcp6_parser.cc"
     break;
 
-  case 134:
-#line 555 "dhcp6_parser.yy"
+  case 136:
+#line 570 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1145,8 +1145,8 @@ namespace isc { namespace dhcp {
 #line 1146 "dhcp6_parser.cc"
     break;
 
-  case 135:
-#line 560 "dhcp6_parser.yy"
+  case 137:
+#line 575 "dhcp6_parser.yy"
     {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
@@ -1154,8 +1154,8 @@ namespace isc { namespace dhcp {
 #line 1155 "dhcp6_parser.cc"
     break;
 
-  case 136:
-#line 565 "dhcp6_parser.yy"
+  case 138:
+#line 580 "dhcp6_parser.yy"
     {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
@@ -1163,8 +1163,8 @@ namespace isc { namespace dhcp {
 #line 1164 "dhcp6_parser.cc"
     break;
 
-  case 137:
-#line 570 "dhcp6_parser.yy"
+  case 139:
+#line 585 "dhcp6_parser.yy"
     {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
@@ -1172,657 +1172,729 @@ namespace isc { namespace dhcp {
 #line 1173 "dhcp6_parser.cc"
     break;
 
-  case 138:
-#line 575 "dhcp6_parser.yy"
+  case 140:
+#line 590 "dhcp6_parser.yy"
+    {
+    ElementPtr ct(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+}
+#line 1182 "dhcp6_parser.cc"
+    break;
+
+  case 141:
+#line 595 "dhcp6_parser.yy"
+    {
+    ElementPtr cm(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-max-age", cm);
+}
+#line 1191 "dhcp6_parser.cc"
+    break;
+
+  case 142:
+#line 600 "dhcp6_parser.yy"
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1182 "dhcp6_parser.cc"
+#line 1200 "dhcp6_parser.cc"
     break;
 
-  case 139:
-#line 580 "dhcp6_parser.yy"
+  case 143:
+#line 605 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-send-updates", b);
 }
-#line 1191 "dhcp6_parser.cc"
+#line 1209 "dhcp6_parser.cc"
     break;
 
-  case 140:
-#line 585 "dhcp6_parser.yy"
+  case 144:
+#line 610 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-no-update", b);
 }
-#line 1200 "dhcp6_parser.cc"
+#line 1218 "dhcp6_parser.cc"
     break;
 
-  case 141:
-#line 590 "dhcp6_parser.yy"
+  case 145:
+#line 615 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-client-update", b);
 }
-#line 1209 "dhcp6_parser.cc"
+#line 1227 "dhcp6_parser.cc"
     break;
 
-  case 142:
-#line 595 "dhcp6_parser.yy"
+  case 146:
+#line 620 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 1217 "dhcp6_parser.cc"
+#line 1235 "dhcp6_parser.cc"
     break;
 
-  case 143:
-#line 597 "dhcp6_parser.yy"
+  case 147:
+#line 622 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("ddns-replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1226 "dhcp6_parser.cc"
+#line 1244 "dhcp6_parser.cc"
     break;
 
-  case 144:
-#line 603 "dhcp6_parser.yy"
+  case 148:
+#line 628 "dhcp6_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1234 "dhcp6_parser.cc"
+#line 1252 "dhcp6_parser.cc"
     break;
 
-  case 145:
-#line 606 "dhcp6_parser.yy"
+  case 149:
+#line 631 "dhcp6_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1242 "dhcp6_parser.cc"
+#line 1260 "dhcp6_parser.cc"
     break;
 
-  case 146:
-#line 609 "dhcp6_parser.yy"
+  case 150:
+#line 634 "dhcp6_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1250 "dhcp6_parser.cc"
+#line 1268 "dhcp6_parser.cc"
     break;
 
-  case 147:
-#line 612 "dhcp6_parser.yy"
+  case 151:
+#line 637 "dhcp6_parser.yy"
     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 1258 "dhcp6_parser.cc"
+#line 1276 "dhcp6_parser.cc"
     break;
 
-  case 148:
-#line 615 "dhcp6_parser.yy"
+  case 152:
+#line 640 "dhcp6_parser.yy"
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 1267 "dhcp6_parser.cc"
+#line 1285 "dhcp6_parser.cc"
     break;
 
-  case 149:
-#line 621 "dhcp6_parser.yy"
+  case 153:
+#line 646 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1275 "dhcp6_parser.cc"
+#line 1293 "dhcp6_parser.cc"
     break;
 
-  case 150:
-#line 623 "dhcp6_parser.yy"
+  case 154:
+#line 648 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-generated-prefix", s);
     ctx.leave();
 }
-#line 1285 "dhcp6_parser.cc"
+#line 1303 "dhcp6_parser.cc"
     break;
 
-  case 151:
-#line 629 "dhcp6_parser.yy"
+  case 155:
+#line 654 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1293 "dhcp6_parser.cc"
+#line 1311 "dhcp6_parser.cc"
     break;
 
-  case 152:
-#line 631 "dhcp6_parser.yy"
+  case 156:
+#line 656 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-qualifying-suffix", s);
     ctx.leave();
 }
-#line 1303 "dhcp6_parser.cc"
+#line 1321 "dhcp6_parser.cc"
     break;
 
-  case 153:
-#line 637 "dhcp6_parser.yy"
+  case 157:
+#line 662 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1311 "dhcp6_parser.cc"
+#line 1329 "dhcp6_parser.cc"
     break;
 
-  case 154:
-#line 639 "dhcp6_parser.yy"
+  case 158:
+#line 664 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 1321 "dhcp6_parser.cc"
+#line 1339 "dhcp6_parser.cc"
     break;
 
-  case 155:
-#line 645 "dhcp6_parser.yy"
+  case 159:
+#line 670 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1329 "dhcp6_parser.cc"
+#line 1347 "dhcp6_parser.cc"
     break;
 
-  case 156:
-#line 647 "dhcp6_parser.yy"
+  case 160:
+#line 672 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 1339 "dhcp6_parser.cc"
+#line 1357 "dhcp6_parser.cc"
     break;
 
-  case 157:
-#line 653 "dhcp6_parser.yy"
+  case 161:
+#line 678 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1347 "dhcp6_parser.cc"
+#line 1365 "dhcp6_parser.cc"
     break;
 
-  case 158:
-#line 655 "dhcp6_parser.yy"
+  case 162:
+#line 680 "dhcp6_parser.yy"
     {
     ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1357 "dhcp6_parser.cc"
+#line 1375 "dhcp6_parser.cc"
     break;
 
-  case 159:
-#line 661 "dhcp6_parser.yy"
+  case 163:
+#line 686 "dhcp6_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1368 "dhcp6_parser.cc"
+#line 1386 "dhcp6_parser.cc"
     break;
 
-  case 160:
-#line 666 "dhcp6_parser.yy"
+  case 164:
+#line 691 "dhcp6_parser.yy"
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1378 "dhcp6_parser.cc"
+#line 1396 "dhcp6_parser.cc"
     break;
 
-  case 161:
-#line 672 "dhcp6_parser.yy"
+  case 165:
+#line 697 "dhcp6_parser.yy"
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1388 "dhcp6_parser.cc"
+#line 1406 "dhcp6_parser.cc"
     break;
 
-  case 162:
-#line 676 "dhcp6_parser.yy"
+  case 166:
+#line 701 "dhcp6_parser.yy"
     {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1397 "dhcp6_parser.cc"
+#line 1415 "dhcp6_parser.cc"
     break;
 
-  case 170:
-#line 692 "dhcp6_parser.yy"
+  case 174:
+#line 717 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1408 "dhcp6_parser.cc"
+#line 1426 "dhcp6_parser.cc"
     break;
 
-  case 171:
-#line 697 "dhcp6_parser.yy"
+  case 175:
+#line 722 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1417 "dhcp6_parser.cc"
+#line 1435 "dhcp6_parser.cc"
     break;
 
-  case 172:
-#line 702 "dhcp6_parser.yy"
+  case 176:
+#line 727 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1426 "dhcp6_parser.cc"
+#line 1444 "dhcp6_parser.cc"
     break;
 
-  case 173:
-#line 708 "dhcp6_parser.yy"
+  case 177:
+#line 733 "dhcp6_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1437 "dhcp6_parser.cc"
+#line 1455 "dhcp6_parser.cc"
     break;
 
-  case 174:
-#line 713 "dhcp6_parser.yy"
+  case 178:
+#line 738 "dhcp6_parser.yy"
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1448 "dhcp6_parser.cc"
+#line 1466 "dhcp6_parser.cc"
     break;
 
-  case 175:
-#line 720 "dhcp6_parser.yy"
+  case 179:
+#line 745 "dhcp6_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1459 "dhcp6_parser.cc"
+#line 1477 "dhcp6_parser.cc"
     break;
 
-  case 176:
-#line 725 "dhcp6_parser.yy"
+  case 180:
+#line 750 "dhcp6_parser.yy"
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1470 "dhcp6_parser.cc"
+#line 1488 "dhcp6_parser.cc"
     break;
 
-  case 177:
-#line 732 "dhcp6_parser.yy"
+  case 181:
+#line 757 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1481 "dhcp6_parser.cc"
+#line 1499 "dhcp6_parser.cc"
     break;
 
-  case 178:
-#line 737 "dhcp6_parser.yy"
+  case 182:
+#line 762 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1490 "dhcp6_parser.cc"
+#line 1508 "dhcp6_parser.cc"
     break;
 
-  case 183:
-#line 750 "dhcp6_parser.yy"
+  case 187:
+#line 775 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1500 "dhcp6_parser.cc"
+#line 1518 "dhcp6_parser.cc"
     break;
 
-  case 184:
-#line 754 "dhcp6_parser.yy"
+  case 188:
+#line 779 "dhcp6_parser.yy"
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1510 "dhcp6_parser.cc"
+#line 1528 "dhcp6_parser.cc"
     break;
 
-  case 208:
-#line 787 "dhcp6_parser.yy"
+  case 216:
+#line 816 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1518 "dhcp6_parser.cc"
+#line 1536 "dhcp6_parser.cc"
     break;
 
-  case 209:
-#line 789 "dhcp6_parser.yy"
+  case 217:
+#line 818 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1527 "dhcp6_parser.cc"
+#line 1545 "dhcp6_parser.cc"
     break;
 
-  case 210:
-#line 794 "dhcp6_parser.yy"
+  case 218:
+#line 823 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1533 "dhcp6_parser.cc"
+#line 1551 "dhcp6_parser.cc"
     break;
 
-  case 211:
-#line 795 "dhcp6_parser.yy"
+  case 219:
+#line 824 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1539 "dhcp6_parser.cc"
+#line 1557 "dhcp6_parser.cc"
     break;
 
-  case 212:
-#line 796 "dhcp6_parser.yy"
+  case 220:
+#line 825 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1545 "dhcp6_parser.cc"
+#line 1563 "dhcp6_parser.cc"
     break;
 
-  case 213:
-#line 797 "dhcp6_parser.yy"
+  case 221:
+#line 826 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1551 "dhcp6_parser.cc"
+#line 1569 "dhcp6_parser.cc"
     break;
 
-  case 214:
-#line 800 "dhcp6_parser.yy"
+  case 222:
+#line 829 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1559 "dhcp6_parser.cc"
+#line 1577 "dhcp6_parser.cc"
     break;
 
-  case 215:
-#line 802 "dhcp6_parser.yy"
+  case 223:
+#line 831 "dhcp6_parser.yy"
     {
     ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1569 "dhcp6_parser.cc"
+#line 1587 "dhcp6_parser.cc"
     break;
 
-  case 216:
-#line 808 "dhcp6_parser.yy"
+  case 224:
+#line 837 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1577 "dhcp6_parser.cc"
+#line 1595 "dhcp6_parser.cc"
     break;
 
-  case 217:
-#line 810 "dhcp6_parser.yy"
+  case 225:
+#line 839 "dhcp6_parser.yy"
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1587 "dhcp6_parser.cc"
+#line 1605 "dhcp6_parser.cc"
     break;
 
-  case 218:
-#line 816 "dhcp6_parser.yy"
+  case 226:
+#line 845 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1595 "dhcp6_parser.cc"
+#line 1613 "dhcp6_parser.cc"
     break;
 
-  case 219:
-#line 818 "dhcp6_parser.yy"
+  case 227:
+#line 847 "dhcp6_parser.yy"
     {
     ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1605 "dhcp6_parser.cc"
+#line 1623 "dhcp6_parser.cc"
     break;
 
-  case 220:
-#line 824 "dhcp6_parser.yy"
+  case 228:
+#line 853 "dhcp6_parser.yy"
     {
     ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1614 "dhcp6_parser.cc"
+#line 1632 "dhcp6_parser.cc"
     break;
 
-  case 221:
-#line 829 "dhcp6_parser.yy"
+  case 229:
+#line 858 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1622 "dhcp6_parser.cc"
+#line 1640 "dhcp6_parser.cc"
     break;
 
-  case 222:
-#line 831 "dhcp6_parser.yy"
+  case 230:
+#line 860 "dhcp6_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1632 "dhcp6_parser.cc"
+#line 1650 "dhcp6_parser.cc"
     break;
 
-  case 223:
-#line 837 "dhcp6_parser.yy"
+  case 231:
+#line 866 "dhcp6_parser.yy"
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1641 "dhcp6_parser.cc"
+#line 1659 "dhcp6_parser.cc"
     break;
 
-  case 224:
-#line 842 "dhcp6_parser.yy"
+  case 232:
+#line 871 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1650 "dhcp6_parser.cc"
+#line 1668 "dhcp6_parser.cc"
     break;
 
-  case 225:
-#line 847 "dhcp6_parser.yy"
+  case 233:
+#line 876 "dhcp6_parser.yy"
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1659 "dhcp6_parser.cc"
+#line 1677 "dhcp6_parser.cc"
     break;
 
-  case 226:
-#line 852 "dhcp6_parser.yy"
+  case 234:
+#line 881 "dhcp6_parser.yy"
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("write-behind-cache", n);
+}
+#line 1686 "dhcp6_parser.cc"
+    break;
+
+  case 235:
+#line 886 "dhcp6_parser.yy"
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("write-back-latency", n);
+}
+#line 1695 "dhcp6_parser.cc"
+    break;
+
+  case 236:
+#line 891 "dhcp6_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1703 "dhcp6_parser.cc"
+    break;
+
+  case 237:
+#line 893 "dhcp6_parser.yy"
+    {
+    ElementPtr journal(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-journal", journal);
+    ctx.leave();
+}
+#line 1713 "dhcp6_parser.cc"
+    break;
+
+  case 238:
+#line 899 "dhcp6_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1721 "dhcp6_parser.cc"
+    break;
+
+  case 239:
+#line 901 "dhcp6_parser.yy"
+    {
+    ElementPtr replicas(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("read-replicas", replicas);
+    ctx.leave();
+}
+#line 1731 "dhcp6_parser.cc"
+    break;
+
+  case 240:
+#line 907 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1668 "dhcp6_parser.cc"
+#line 1740 "dhcp6_parser.cc"
     break;
 
-  case 227:
-#line 857 "dhcp6_parser.yy"
+  case 241:
+#line 912 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1677 "dhcp6_parser.cc"
+#line 1749 "dhcp6_parser.cc"
     break;
 
-  case 228:
-#line 862 "dhcp6_parser.yy"
+  case 242:
+#line 917 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-row-errors", n);
 }
-#line 1686 "dhcp6_parser.cc"
+#line 1758 "dhcp6_parser.cc"
     break;
 
-  case 229:
-#line 867 "dhcp6_parser.yy"
+  case 243:
+#line 922 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1695 "dhcp6_parser.cc"
+#line 1767 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 872 "dhcp6_parser.yy"
+  case 244:
+#line 927 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1704 "dhcp6_parser.cc"
+#line 1776 "dhcp6_parser.cc"
     break;
 
-  case 231:
-#line 877 "dhcp6_parser.yy"
+  case 245:
+#line 932 "dhcp6_parser.yy"
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1713 "dhcp6_parser.cc"
+#line 1785 "dhcp6_parser.cc"
     break;
 
-  case 232:
-#line 882 "dhcp6_parser.yy"
+  case 246:
+#line 937 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1721 "dhcp6_parser.cc"
+#line 1793 "dhcp6_parser.cc"
     break;
 
-  case 233:
-#line 884 "dhcp6_parser.yy"
+  case 247:
+#line 939 "dhcp6_parser.yy"
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1731 "dhcp6_parser.cc"
+#line 1803 "dhcp6_parser.cc"
     break;
 
-  case 234:
-#line 890 "dhcp6_parser.yy"
+  case 248:
+#line 945 "dhcp6_parser.yy"
     {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1740 "dhcp6_parser.cc"
+#line 1812 "dhcp6_parser.cc"
     break;
 
-  case 235:
-#line 895 "dhcp6_parser.yy"
+  case 249:
+#line 950 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1748 "dhcp6_parser.cc"
+#line 1820 "dhcp6_parser.cc"
     break;
 
-  case 236:
-#line 897 "dhcp6_parser.yy"
+  case 250:
+#line 952 "dhcp6_parser.yy"
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1758 "dhcp6_parser.cc"
+#line 1830 "dhcp6_parser.cc"
     break;
 
-  case 237:
-#line 903 "dhcp6_parser.yy"
+  case 251:
+#line 958 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1766 "dhcp6_parser.cc"
+#line 1838 "dhcp6_parser.cc"
     break;
 
-  case 238:
-#line 905 "dhcp6_parser.yy"
+  case 252:
+#line 960 "dhcp6_parser.yy"
     {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1776 "dhcp6_parser.cc"
+#line 1848 "dhcp6_parser.cc"
     break;
 
-  case 239:
-#line 911 "dhcp6_parser.yy"
+  case 253:
+#line 966 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1784 "dhcp6_parser.cc"
+#line 1856 "dhcp6_parser.cc"
     break;
 
-  case 240:
-#line 913 "dhcp6_parser.yy"
+  case 254:
+#line 968 "dhcp6_parser.yy"
     {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1794 "dhcp6_parser.cc"
+#line 1866 "dhcp6_parser.cc"
     break;
 
-  case 241:
-#line 919 "dhcp6_parser.yy"
+  case 255:
+#line 974 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1805 "dhcp6_parser.cc"
+#line 1877 "dhcp6_parser.cc"
     break;
 
-  case 242:
-#line 924 "dhcp6_parser.yy"
+  case 256:
+#line 979 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1814 "dhcp6_parser.cc"
+#line 1886 "dhcp6_parser.cc"
     break;
 
-  case 246:
-#line 934 "dhcp6_parser.yy"
+  case 260:
+#line 989 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1822 "dhcp6_parser.cc"
+#line 1894 "dhcp6_parser.cc"
     break;
 
-  case 247:
-#line 936 "dhcp6_parser.yy"
+  case 261:
+#line 991 "dhcp6_parser.yy"
     {
 
     if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
@@ -1838,307 +1910,316 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1842 "dhcp6_parser.cc"
+#line 1914 "dhcp6_parser.cc"
     break;
 
-  case 248:
-#line 952 "dhcp6_parser.yy"
+  case 262:
+#line 1007 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1853 "dhcp6_parser.cc"
+#line 1925 "dhcp6_parser.cc"
     break;
 
-  case 249:
-#line 957 "dhcp6_parser.yy"
+  case 263:
+#line 1012 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1862 "dhcp6_parser.cc"
+#line 1934 "dhcp6_parser.cc"
     break;
 
-  case 254:
-#line 970 "dhcp6_parser.yy"
+  case 268:
+#line 1025 "dhcp6_parser.yy"
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1871 "dhcp6_parser.cc"
+#line 1943 "dhcp6_parser.cc"
     break;
 
-  case 255:
-#line 975 "dhcp6_parser.yy"
+  case 269:
+#line 1030 "dhcp6_parser.yy"
     {
     ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1880 "dhcp6_parser.cc"
+#line 1952 "dhcp6_parser.cc"
     break;
 
-  case 256:
-#line 980 "dhcp6_parser.yy"
+  case 270:
+#line 1035 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1891 "dhcp6_parser.cc"
+#line 1963 "dhcp6_parser.cc"
     break;
 
-  case 257:
-#line 985 "dhcp6_parser.yy"
+  case 271:
+#line 1040 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1900 "dhcp6_parser.cc"
+#line 1972 "dhcp6_parser.cc"
     break;
 
-  case 263:
-#line 999 "dhcp6_parser.yy"
+  case 277:
+#line 1054 "dhcp6_parser.yy"
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1909 "dhcp6_parser.cc"
+#line 1981 "dhcp6_parser.cc"
     break;
 
-  case 264:
-#line 1004 "dhcp6_parser.yy"
+  case 278:
+#line 1059 "dhcp6_parser.yy"
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1918 "dhcp6_parser.cc"
+#line 1990 "dhcp6_parser.cc"
     break;
 
-  case 265:
-#line 1011 "dhcp6_parser.yy"
+  case 279:
+#line 1066 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1929 "dhcp6_parser.cc"
+#line 2001 "dhcp6_parser.cc"
     break;
 
-  case 266:
-#line 1016 "dhcp6_parser.yy"
+  case 280:
+#line 1071 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1938 "dhcp6_parser.cc"
+#line 2010 "dhcp6_parser.cc"
     break;
 
-  case 267:
-#line 1021 "dhcp6_parser.yy"
+  case 281:
+#line 1076 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1949 "dhcp6_parser.cc"
+#line 2021 "dhcp6_parser.cc"
     break;
 
-  case 268:
-#line 1026 "dhcp6_parser.yy"
+  case 282:
+#line 1081 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1958 "dhcp6_parser.cc"
+#line 2030 "dhcp6_parser.cc"
     break;
 
-  case 273:
-#line 1039 "dhcp6_parser.yy"
+  case 287:
+#line 1094 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1968 "dhcp6_parser.cc"
+#line 2040 "dhcp6_parser.cc"
     break;
 
-  case 274:
-#line 1043 "dhcp6_parser.yy"
+  case 288:
+#line 1098 "dhcp6_parser.yy"
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1978 "dhcp6_parser.cc"
+#line 2050 "dhcp6_parser.cc"
     break;
 
-  case 275:
-#line 1049 "dhcp6_parser.yy"
+  case 289:
+#line 1104 "dhcp6_parser.yy"
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1988 "dhcp6_parser.cc"
+#line 2060 "dhcp6_parser.cc"
     break;
 
-  case 276:
-#line 1053 "dhcp6_parser.yy"
+  case 290:
+#line 1108 "dhcp6_parser.yy"
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1998 "dhcp6_parser.cc"
+#line 2070 "dhcp6_parser.cc"
     break;
 
-  case 282:
-#line 1068 "dhcp6_parser.yy"
+  case 296:
+#line 1123 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2006 "dhcp6_parser.cc"
+#line 2078 "dhcp6_parser.cc"
     break;
 
-  case 283:
-#line 1070 "dhcp6_parser.yy"
+  case 297:
+#line 1125 "dhcp6_parser.yy"
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 2016 "dhcp6_parser.cc"
+#line 2088 "dhcp6_parser.cc"
     break;
 
-  case 284:
-#line 1076 "dhcp6_parser.yy"
+  case 298:
+#line 1131 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2024 "dhcp6_parser.cc"
+#line 2096 "dhcp6_parser.cc"
     break;
 
-  case 285:
-#line 1078 "dhcp6_parser.yy"
+  case 299:
+#line 1133 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2033 "dhcp6_parser.cc"
+#line 2105 "dhcp6_parser.cc"
     break;
 
-  case 286:
-#line 1084 "dhcp6_parser.yy"
+  case 300:
+#line 1139 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 2044 "dhcp6_parser.cc"
+#line 2116 "dhcp6_parser.cc"
     break;
 
-  case 287:
-#line 1089 "dhcp6_parser.yy"
+  case 301:
+#line 1144 "dhcp6_parser.yy"
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2054 "dhcp6_parser.cc"
+#line 2126 "dhcp6_parser.cc"
     break;
 
-  case 296:
-#line 1107 "dhcp6_parser.yy"
+  case 311:
+#line 1163 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 2063 "dhcp6_parser.cc"
+#line 2135 "dhcp6_parser.cc"
     break;
 
-  case 297:
-#line 1112 "dhcp6_parser.yy"
+  case 312:
+#line 1168 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 2072 "dhcp6_parser.cc"
+#line 2144 "dhcp6_parser.cc"
     break;
 
-  case 298:
-#line 1117 "dhcp6_parser.yy"
+  case 313:
+#line 1173 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 2081 "dhcp6_parser.cc"
+#line 2153 "dhcp6_parser.cc"
     break;
 
-  case 299:
-#line 1122 "dhcp6_parser.yy"
+  case 314:
+#line 1178 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 2090 "dhcp6_parser.cc"
+#line 2162 "dhcp6_parser.cc"
     break;
 
-  case 300:
-#line 1127 "dhcp6_parser.yy"
+  case 315:
+#line 1183 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 2099 "dhcp6_parser.cc"
+#line 2171 "dhcp6_parser.cc"
     break;
 
-  case 301:
-#line 1132 "dhcp6_parser.yy"
+  case 316:
+#line 1188 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 2108 "dhcp6_parser.cc"
+#line 2180 "dhcp6_parser.cc"
     break;
 
-  case 302:
-#line 1140 "dhcp6_parser.yy"
+  case 317:
+#line 1193 "dhcp6_parser.yy"
+    {
+    ElementPtr value(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("background-reclamation", value);
+}
+#line 2189 "dhcp6_parser.cc"
+    break;
+
+  case 318:
+#line 1201 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 2119 "dhcp6_parser.cc"
+#line 2200 "dhcp6_parser.cc"
     break;
 
-  case 303:
-#line 1145 "dhcp6_parser.yy"
+  case 319:
+#line 1206 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2128 "dhcp6_parser.cc"
+#line 2209 "dhcp6_parser.cc"
     break;
 
-  case 308:
-#line 1165 "dhcp6_parser.yy"
+  case 324:
+#line 1226 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2138 "dhcp6_parser.cc"
+#line 2219 "dhcp6_parser.cc"
     break;
 
-  case 309:
-#line 1169 "dhcp6_parser.yy"
+  case 325:
+#line 1230 "dhcp6_parser.yy"
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -2160,267 +2241,267 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2164 "dhcp6_parser.cc"
+#line 2245 "dhcp6_parser.cc"
     break;
 
-  case 310:
-#line 1191 "dhcp6_parser.yy"
+  case 326:
+#line 1252 "dhcp6_parser.yy"
     {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2174 "dhcp6_parser.cc"
+#line 2255 "dhcp6_parser.cc"
     break;
 
-  case 311:
-#line 1195 "dhcp6_parser.yy"
+  case 327:
+#line 1256 "dhcp6_parser.yy"
     {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2184 "dhcp6_parser.cc"
+#line 2265 "dhcp6_parser.cc"
     break;
 
-  case 349:
-#line 1244 "dhcp6_parser.yy"
+  case 367:
+#line 1307 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2192 "dhcp6_parser.cc"
+#line 2273 "dhcp6_parser.cc"
     break;
 
-  case 350:
-#line 1246 "dhcp6_parser.yy"
+  case 368:
+#line 1309 "dhcp6_parser.yy"
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2202 "dhcp6_parser.cc"
+#line 2283 "dhcp6_parser.cc"
     break;
 
-  case 351:
-#line 1252 "dhcp6_parser.yy"
+  case 369:
+#line 1315 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2210 "dhcp6_parser.cc"
+#line 2291 "dhcp6_parser.cc"
     break;
 
-  case 352:
-#line 1254 "dhcp6_parser.yy"
+  case 370:
+#line 1317 "dhcp6_parser.yy"
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2220 "dhcp6_parser.cc"
+#line 2301 "dhcp6_parser.cc"
     break;
 
-  case 353:
-#line 1260 "dhcp6_parser.yy"
+  case 371:
+#line 1323 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2228 "dhcp6_parser.cc"
+#line 2309 "dhcp6_parser.cc"
     break;
 
-  case 354:
-#line 1262 "dhcp6_parser.yy"
+  case 372:
+#line 1325 "dhcp6_parser.yy"
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 2238 "dhcp6_parser.cc"
+#line 2319 "dhcp6_parser.cc"
     break;
 
-  case 355:
-#line 1268 "dhcp6_parser.yy"
+  case 373:
+#line 1331 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2246 "dhcp6_parser.cc"
+#line 2327 "dhcp6_parser.cc"
     break;
 
-  case 356:
-#line 1270 "dhcp6_parser.yy"
+  case 374:
+#line 1333 "dhcp6_parser.yy"
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2256 "dhcp6_parser.cc"
+#line 2337 "dhcp6_parser.cc"
     break;
 
-  case 357:
-#line 1276 "dhcp6_parser.yy"
+  case 375:
+#line 1339 "dhcp6_parser.yy"
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2267 "dhcp6_parser.cc"
+#line 2348 "dhcp6_parser.cc"
     break;
 
-  case 358:
-#line 1281 "dhcp6_parser.yy"
+  case 376:
+#line 1344 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2276 "dhcp6_parser.cc"
+#line 2357 "dhcp6_parser.cc"
     break;
 
-  case 359:
-#line 1286 "dhcp6_parser.yy"
+  case 377:
+#line 1349 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2284 "dhcp6_parser.cc"
+#line 2365 "dhcp6_parser.cc"
     break;
 
-  case 360:
-#line 1288 "dhcp6_parser.yy"
+  case 378:
+#line 1351 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2293 "dhcp6_parser.cc"
+#line 2374 "dhcp6_parser.cc"
     break;
 
-  case 361:
-#line 1293 "dhcp6_parser.yy"
+  case 379:
+#line 1356 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2299 "dhcp6_parser.cc"
+#line 2380 "dhcp6_parser.cc"
     break;
 
-  case 362:
-#line 1294 "dhcp6_parser.yy"
+  case 380:
+#line 1357 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2305 "dhcp6_parser.cc"
+#line 2386 "dhcp6_parser.cc"
     break;
 
-  case 363:
-#line 1295 "dhcp6_parser.yy"
+  case 381:
+#line 1358 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2311 "dhcp6_parser.cc"
+#line 2392 "dhcp6_parser.cc"
     break;
 
-  case 364:
-#line 1296 "dhcp6_parser.yy"
+  case 382:
+#line 1359 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2317 "dhcp6_parser.cc"
+#line 2398 "dhcp6_parser.cc"
     break;
 
-  case 365:
-#line 1299 "dhcp6_parser.yy"
+  case 383:
+#line 1362 "dhcp6_parser.yy"
     {
     ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2326 "dhcp6_parser.cc"
+#line 2407 "dhcp6_parser.cc"
     break;
 
-  case 366:
-#line 1304 "dhcp6_parser.yy"
+  case 384:
+#line 1367 "dhcp6_parser.yy"
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2335 "dhcp6_parser.cc"
+#line 2416 "dhcp6_parser.cc"
     break;
 
-  case 367:
-#line 1312 "dhcp6_parser.yy"
+  case 385:
+#line 1375 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2346 "dhcp6_parser.cc"
+#line 2427 "dhcp6_parser.cc"
     break;
 
-  case 368:
-#line 1317 "dhcp6_parser.yy"
+  case 386:
+#line 1380 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2355 "dhcp6_parser.cc"
+#line 2436 "dhcp6_parser.cc"
     break;
 
-  case 373:
-#line 1332 "dhcp6_parser.yy"
+  case 391:
+#line 1395 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2365 "dhcp6_parser.cc"
+#line 2446 "dhcp6_parser.cc"
     break;
 
-  case 374:
-#line 1336 "dhcp6_parser.yy"
+  case 392:
+#line 1399 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 2373 "dhcp6_parser.cc"
+#line 2454 "dhcp6_parser.cc"
     break;
 
-  case 409:
-#line 1382 "dhcp6_parser.yy"
+  case 429:
+#line 1447 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2384 "dhcp6_parser.cc"
+#line 2465 "dhcp6_parser.cc"
     break;
 
-  case 410:
-#line 1387 "dhcp6_parser.yy"
+  case 430:
+#line 1452 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2393 "dhcp6_parser.cc"
+#line 2474 "dhcp6_parser.cc"
     break;
 
-  case 411:
-#line 1395 "dhcp6_parser.yy"
+  case 431:
+#line 1460 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2402 "dhcp6_parser.cc"
+#line 2483 "dhcp6_parser.cc"
     break;
 
-  case 412:
-#line 1398 "dhcp6_parser.yy"
+  case 432:
+#line 1463 "dhcp6_parser.yy"
     {
     // parsing completed
 }
-#line 2410 "dhcp6_parser.cc"
+#line 2491 "dhcp6_parser.cc"
     break;
 
-  case 417:
-#line 1414 "dhcp6_parser.yy"
+  case 437:
+#line 1479 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2420 "dhcp6_parser.cc"
+#line 2501 "dhcp6_parser.cc"
     break;
 
-  case 418:
-#line 1418 "dhcp6_parser.yy"
+  case 438:
+#line 1483 "dhcp6_parser.yy"
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2428,21 +2509,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2432 "dhcp6_parser.cc"
+#line 2513 "dhcp6_parser.cc"
     break;
 
-  case 419:
-#line 1429 "dhcp6_parser.yy"
+  case 439:
+#line 1494 "dhcp6_parser.yy"
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2442 "dhcp6_parser.cc"
+#line 2523 "dhcp6_parser.cc"
     break;
 
-  case 420:
-#line 1433 "dhcp6_parser.yy"
+  case 440:
+#line 1498 "dhcp6_parser.yy"
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2450,280 +2531,280 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2454 "dhcp6_parser.cc"
+#line 2535 "dhcp6_parser.cc"
     break;
 
-  case 436:
-#line 1465 "dhcp6_parser.yy"
+  case 456:
+#line 1530 "dhcp6_parser.yy"
     {
     ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2463 "dhcp6_parser.cc"
+#line 2544 "dhcp6_parser.cc"
     break;
 
-  case 438:
-#line 1472 "dhcp6_parser.yy"
+  case 458:
+#line 1537 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2471 "dhcp6_parser.cc"
+#line 2552 "dhcp6_parser.cc"
     break;
 
-  case 439:
-#line 1474 "dhcp6_parser.yy"
+  case 459:
+#line 1539 "dhcp6_parser.yy"
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2481 "dhcp6_parser.cc"
+#line 2562 "dhcp6_parser.cc"
     break;
 
-  case 440:
-#line 1480 "dhcp6_parser.yy"
+  case 460:
+#line 1545 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2489 "dhcp6_parser.cc"
+#line 2570 "dhcp6_parser.cc"
     break;
 
-  case 441:
-#line 1482 "dhcp6_parser.yy"
+  case 461:
+#line 1547 "dhcp6_parser.yy"
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2499 "dhcp6_parser.cc"
+#line 2580 "dhcp6_parser.cc"
     break;
 
-  case 442:
-#line 1488 "dhcp6_parser.yy"
+  case 462:
+#line 1553 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2507 "dhcp6_parser.cc"
+#line 2588 "dhcp6_parser.cc"
     break;
 
-  case 443:
-#line 1490 "dhcp6_parser.yy"
+  case 463:
+#line 1555 "dhcp6_parser.yy"
     {
     ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2517 "dhcp6_parser.cc"
+#line 2598 "dhcp6_parser.cc"
     break;
 
-  case 445:
-#line 1498 "dhcp6_parser.yy"
+  case 465:
+#line 1563 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2525 "dhcp6_parser.cc"
+#line 2606 "dhcp6_parser.cc"
     break;
 
-  case 446:
-#line 1500 "dhcp6_parser.yy"
+  case 466:
+#line 1565 "dhcp6_parser.yy"
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2535 "dhcp6_parser.cc"
+#line 2616 "dhcp6_parser.cc"
     break;
 
-  case 447:
-#line 1506 "dhcp6_parser.yy"
+  case 467:
+#line 1571 "dhcp6_parser.yy"
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2544 "dhcp6_parser.cc"
+#line 2625 "dhcp6_parser.cc"
     break;
 
-  case 448:
-#line 1515 "dhcp6_parser.yy"
+  case 468:
+#line 1580 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2555 "dhcp6_parser.cc"
+#line 2636 "dhcp6_parser.cc"
     break;
 
-  case 449:
-#line 1520 "dhcp6_parser.yy"
+  case 469:
+#line 1585 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2564 "dhcp6_parser.cc"
+#line 2645 "dhcp6_parser.cc"
     break;
 
-  case 454:
-#line 1539 "dhcp6_parser.yy"
+  case 474:
+#line 1604 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2574 "dhcp6_parser.cc"
+#line 2655 "dhcp6_parser.cc"
     break;
 
-  case 455:
-#line 1543 "dhcp6_parser.yy"
+  case 475:
+#line 1608 "dhcp6_parser.yy"
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2583 "dhcp6_parser.cc"
+#line 2664 "dhcp6_parser.cc"
     break;
 
-  case 456:
-#line 1551 "dhcp6_parser.yy"
+  case 476:
+#line 1616 "dhcp6_parser.yy"
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2593 "dhcp6_parser.cc"
+#line 2674 "dhcp6_parser.cc"
     break;
 
-  case 457:
-#line 1555 "dhcp6_parser.yy"
+  case 477:
+#line 1620 "dhcp6_parser.yy"
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2602 "dhcp6_parser.cc"
+#line 2683 "dhcp6_parser.cc"
     break;
 
-  case 472:
-#line 1588 "dhcp6_parser.yy"
+  case 492:
+#line 1653 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2610 "dhcp6_parser.cc"
+#line 2691 "dhcp6_parser.cc"
     break;
 
-  case 473:
-#line 1590 "dhcp6_parser.yy"
+  case 493:
+#line 1655 "dhcp6_parser.yy"
     {
     ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2620 "dhcp6_parser.cc"
+#line 2701 "dhcp6_parser.cc"
     break;
 
-  case 476:
-#line 1600 "dhcp6_parser.yy"
+  case 496:
+#line 1665 "dhcp6_parser.yy"
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2629 "dhcp6_parser.cc"
+#line 2710 "dhcp6_parser.cc"
     break;
 
-  case 477:
-#line 1605 "dhcp6_parser.yy"
+  case 497:
+#line 1670 "dhcp6_parser.yy"
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2638 "dhcp6_parser.cc"
+#line 2719 "dhcp6_parser.cc"
     break;
 
-  case 478:
-#line 1613 "dhcp6_parser.yy"
+  case 498:
+#line 1678 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2649 "dhcp6_parser.cc"
+#line 2730 "dhcp6_parser.cc"
     break;
 
-  case 479:
-#line 1618 "dhcp6_parser.yy"
+  case 499:
+#line 1683 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2658 "dhcp6_parser.cc"
+#line 2739 "dhcp6_parser.cc"
     break;
 
-  case 484:
-#line 1633 "dhcp6_parser.yy"
+  case 504:
+#line 1698 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2668 "dhcp6_parser.cc"
+#line 2749 "dhcp6_parser.cc"
     break;
 
-  case 485:
-#line 1637 "dhcp6_parser.yy"
+  case 505:
+#line 1702 "dhcp6_parser.yy"
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2678 "dhcp6_parser.cc"
+#line 2759 "dhcp6_parser.cc"
     break;
 
-  case 486:
-#line 1643 "dhcp6_parser.yy"
+  case 506:
+#line 1708 "dhcp6_parser.yy"
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2688 "dhcp6_parser.cc"
+#line 2769 "dhcp6_parser.cc"
     break;
 
-  case 487:
-#line 1647 "dhcp6_parser.yy"
+  case 507:
+#line 1712 "dhcp6_parser.yy"
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 2697 "dhcp6_parser.cc"
+#line 2778 "dhcp6_parser.cc"
     break;
 
-  case 497:
-#line 1665 "dhcp6_parser.yy"
+  case 517:
+#line 1730 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2705 "dhcp6_parser.cc"
+#line 2786 "dhcp6_parser.cc"
     break;
 
-  case 498:
-#line 1667 "dhcp6_parser.yy"
+  case 518:
+#line 1732 "dhcp6_parser.yy"
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2715 "dhcp6_parser.cc"
+#line 2796 "dhcp6_parser.cc"
     break;
 
-  case 499:
-#line 1673 "dhcp6_parser.yy"
+  case 519:
+#line 1738 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2723 "dhcp6_parser.cc"
+#line 2804 "dhcp6_parser.cc"
     break;
 
-  case 500:
-#line 1675 "dhcp6_parser.yy"
+  case 520:
+#line 1740 "dhcp6_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -2746,19 +2827,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2750 "dhcp6_parser.cc"
+#line 2831 "dhcp6_parser.cc"
     break;
 
-  case 501:
-#line 1698 "dhcp6_parser.yy"
+  case 521:
+#line 1763 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2758 "dhcp6_parser.cc"
+#line 2839 "dhcp6_parser.cc"
     break;
 
-  case 502:
-#line 1700 "dhcp6_parser.yy"
+  case 522:
+#line 1765 "dhcp6_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2783,41 +2864,41 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2787 "dhcp6_parser.cc"
+#line 2868 "dhcp6_parser.cc"
     break;
 
-  case 503:
-#line 1728 "dhcp6_parser.yy"
+  case 523:
+#line 1793 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2798 "dhcp6_parser.cc"
+#line 2879 "dhcp6_parser.cc"
     break;
 
-  case 504:
-#line 1733 "dhcp6_parser.yy"
+  case 524:
+#line 1798 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2807 "dhcp6_parser.cc"
+#line 2888 "dhcp6_parser.cc"
     break;
 
-  case 509:
-#line 1748 "dhcp6_parser.yy"
+  case 529:
+#line 1813 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2817 "dhcp6_parser.cc"
+#line 2898 "dhcp6_parser.cc"
     break;
 
-  case 510:
-#line 1752 "dhcp6_parser.yy"
+  case 530:
+#line 1817 "dhcp6_parser.yy"
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2825,21 +2906,21 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2829 "dhcp6_parser.cc"
+#line 2910 "dhcp6_parser.cc"
     break;
 
-  case 511:
-#line 1760 "dhcp6_parser.yy"
+  case 531:
+#line 1825 "dhcp6_parser.yy"
     {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2839 "dhcp6_parser.cc"
+#line 2920 "dhcp6_parser.cc"
     break;
 
-  case 512:
-#line 1764 "dhcp6_parser.yy"
+  case 532:
+#line 1829 "dhcp6_parser.yy"
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2847,1203 +2928,1277 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2851 "dhcp6_parser.cc"
+#line 2932 "dhcp6_parser.cc"
     break;
 
-  case 526:
-#line 1789 "dhcp6_parser.yy"
+  case 546:
+#line 1854 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2859 "dhcp6_parser.cc"
+#line 2940 "dhcp6_parser.cc"
     break;
 
-  case 527:
-#line 1791 "dhcp6_parser.yy"
+  case 547:
+#line 1856 "dhcp6_parser.yy"
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2869 "dhcp6_parser.cc"
+#line 2950 "dhcp6_parser.cc"
     break;
 
-  case 528:
-#line 1797 "dhcp6_parser.yy"
+  case 548:
+#line 1862 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2878 "dhcp6_parser.cc"
+#line 2959 "dhcp6_parser.cc"
     break;
 
-  case 529:
-#line 1802 "dhcp6_parser.yy"
+  case 549:
+#line 1867 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2886 "dhcp6_parser.cc"
+#line 2967 "dhcp6_parser.cc"
     break;
 
-  case 530:
-#line 1804 "dhcp6_parser.yy"
+  case 550:
+#line 1869 "dhcp6_parser.yy"
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2896 "dhcp6_parser.cc"
+#line 2977 "dhcp6_parser.cc"
     break;
 
-  case 531:
-#line 1810 "dhcp6_parser.yy"
+  case 551:
+#line 1875 "dhcp6_parser.yy"
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2905 "dhcp6_parser.cc"
+#line 2986 "dhcp6_parser.cc"
     break;
 
-  case 532:
-#line 1815 "dhcp6_parser.yy"
+  case 552:
+#line 1880 "dhcp6_parser.yy"
     {
     ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2914 "dhcp6_parser.cc"
+#line 2995 "dhcp6_parser.cc"
     break;
 
-  case 533:
-#line 1823 "dhcp6_parser.yy"
+  case 553:
+#line 1888 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2925 "dhcp6_parser.cc"
+#line 3006 "dhcp6_parser.cc"
     break;
 
-  case 534:
-#line 1828 "dhcp6_parser.yy"
+  case 554:
+#line 1893 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2934 "dhcp6_parser.cc"
+#line 3015 "dhcp6_parser.cc"
     break;
 
-  case 539:
-#line 1841 "dhcp6_parser.yy"
+  case 559:
+#line 1906 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2944 "dhcp6_parser.cc"
+#line 3025 "dhcp6_parser.cc"
     break;
 
-  case 540:
-#line 1845 "dhcp6_parser.yy"
+  case 560:
+#line 1910 "dhcp6_parser.yy"
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2953 "dhcp6_parser.cc"
+#line 3034 "dhcp6_parser.cc"
     break;
 
-  case 541:
-#line 1850 "dhcp6_parser.yy"
+  case 561:
+#line 1915 "dhcp6_parser.yy"
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2963 "dhcp6_parser.cc"
+#line 3044 "dhcp6_parser.cc"
     break;
 
-  case 542:
-#line 1854 "dhcp6_parser.yy"
+  case 562:
+#line 1919 "dhcp6_parser.yy"
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2972 "dhcp6_parser.cc"
+#line 3053 "dhcp6_parser.cc"
     break;
 
-  case 558:
-#line 1881 "dhcp6_parser.yy"
+  case 578:
+#line 1946 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2983 "dhcp6_parser.cc"
+#line 3064 "dhcp6_parser.cc"
     break;
 
-  case 559:
-#line 1886 "dhcp6_parser.yy"
+  case 579:
+#line 1951 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2992 "dhcp6_parser.cc"
+#line 3073 "dhcp6_parser.cc"
     break;
 
-  case 560:
-#line 1891 "dhcp6_parser.yy"
+  case 580:
+#line 1956 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3003 "dhcp6_parser.cc"
+#line 3084 "dhcp6_parser.cc"
     break;
 
-  case 561:
-#line 1896 "dhcp6_parser.yy"
+  case 581:
+#line 1961 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3012 "dhcp6_parser.cc"
+#line 3093 "dhcp6_parser.cc"
     break;
 
-  case 562:
-#line 1901 "dhcp6_parser.yy"
+  case 582:
+#line 1966 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3020 "dhcp6_parser.cc"
+#line 3101 "dhcp6_parser.cc"
     break;
 
-  case 563:
-#line 1903 "dhcp6_parser.yy"
+  case 583:
+#line 1968 "dhcp6_parser.yy"
     {
     ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 3030 "dhcp6_parser.cc"
+#line 3111 "dhcp6_parser.cc"
     break;
 
-  case 564:
-#line 1909 "dhcp6_parser.yy"
+  case 584:
+#line 1974 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3038 "dhcp6_parser.cc"
+#line 3119 "dhcp6_parser.cc"
     break;
 
-  case 565:
-#line 1911 "dhcp6_parser.yy"
+  case 585:
+#line 1976 "dhcp6_parser.yy"
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 3048 "dhcp6_parser.cc"
+#line 3129 "dhcp6_parser.cc"
     break;
 
-  case 566:
-#line 1917 "dhcp6_parser.yy"
+  case 586:
+#line 1982 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3056 "dhcp6_parser.cc"
+#line 3137 "dhcp6_parser.cc"
     break;
 
-  case 567:
-#line 1919 "dhcp6_parser.yy"
+  case 587:
+#line 1984 "dhcp6_parser.yy"
     {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 3066 "dhcp6_parser.cc"
+#line 3147 "dhcp6_parser.cc"
     break;
 
-  case 568:
-#line 1925 "dhcp6_parser.yy"
+  case 588:
+#line 1990 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3074 "dhcp6_parser.cc"
+#line 3155 "dhcp6_parser.cc"
     break;
 
-  case 569:
-#line 1927 "dhcp6_parser.yy"
+  case 589:
+#line 1992 "dhcp6_parser.yy"
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 3084 "dhcp6_parser.cc"
+#line 3165 "dhcp6_parser.cc"
     break;
 
-  case 570:
-#line 1933 "dhcp6_parser.yy"
+  case 590:
+#line 1998 "dhcp6_parser.yy"
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3095 "dhcp6_parser.cc"
+#line 3176 "dhcp6_parser.cc"
     break;
 
-  case 571:
-#line 1938 "dhcp6_parser.yy"
+  case 591:
+#line 2003 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3104 "dhcp6_parser.cc"
+#line 3185 "dhcp6_parser.cc"
     break;
 
-  case 572:
-#line 1946 "dhcp6_parser.yy"
+  case 592:
+#line 2011 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 3115 "dhcp6_parser.cc"
+#line 3196 "dhcp6_parser.cc"
     break;
 
-  case 573:
-#line 1951 "dhcp6_parser.yy"
+  case 593:
+#line 2016 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3124 "dhcp6_parser.cc"
+#line 3205 "dhcp6_parser.cc"
     break;
 
-  case 576:
-#line 1960 "dhcp6_parser.yy"
+  case 596:
+#line 2025 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3132 "dhcp6_parser.cc"
+#line 3213 "dhcp6_parser.cc"
     break;
 
-  case 577:
-#line 1962 "dhcp6_parser.yy"
+  case 597:
+#line 2027 "dhcp6_parser.yy"
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 3142 "dhcp6_parser.cc"
+#line 3223 "dhcp6_parser.cc"
     break;
 
-  case 578:
-#line 1971 "dhcp6_parser.yy"
+  case 598:
+#line 2036 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 3153 "dhcp6_parser.cc"
+#line 3234 "dhcp6_parser.cc"
     break;
 
-  case 579:
-#line 1976 "dhcp6_parser.yy"
+  case 599:
+#line 2041 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3162 "dhcp6_parser.cc"
+#line 3243 "dhcp6_parser.cc"
     break;
 
-  case 582:
-#line 1985 "dhcp6_parser.yy"
+  case 602:
+#line 2050 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3172 "dhcp6_parser.cc"
+#line 3253 "dhcp6_parser.cc"
     break;
 
-  case 583:
-#line 1989 "dhcp6_parser.yy"
+  case 603:
+#line 2054 "dhcp6_parser.yy"
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3182 "dhcp6_parser.cc"
+#line 3263 "dhcp6_parser.cc"
     break;
 
-  case 596:
-#line 2014 "dhcp6_parser.yy"
+  case 616:
+#line 2079 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3190 "dhcp6_parser.cc"
+#line 3271 "dhcp6_parser.cc"
     break;
 
-  case 597:
-#line 2016 "dhcp6_parser.yy"
+  case 617:
+#line 2081 "dhcp6_parser.yy"
     {
     ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3200 "dhcp6_parser.cc"
+#line 3281 "dhcp6_parser.cc"
     break;
 
-  case 598:
-#line 2022 "dhcp6_parser.yy"
+  case 618:
+#line 2087 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3209 "dhcp6_parser.cc"
+#line 3290 "dhcp6_parser.cc"
     break;
 
-  case 599:
-#line 2030 "dhcp6_parser.yy"
+  case 619:
+#line 2095 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 3220 "dhcp6_parser.cc"
+#line 3301 "dhcp6_parser.cc"
     break;
 
-  case 600:
-#line 2035 "dhcp6_parser.yy"
+  case 620:
+#line 2100 "dhcp6_parser.yy"
     {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3231 "dhcp6_parser.cc"
+#line 3312 "dhcp6_parser.cc"
     break;
 
-  case 612:
-#line 2057 "dhcp6_parser.yy"
+  case 632:
+#line 2122 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 3239 "dhcp6_parser.cc"
+#line 3320 "dhcp6_parser.cc"
     break;
 
-  case 613:
-#line 2059 "dhcp6_parser.yy"
+  case 633:
+#line 2124 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3248 "dhcp6_parser.cc"
+#line 3329 "dhcp6_parser.cc"
     break;
 
-  case 614:
-#line 2064 "dhcp6_parser.yy"
+  case 634:
+#line 2129 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 3254 "dhcp6_parser.cc"
+#line 3335 "dhcp6_parser.cc"
     break;
 
-  case 615:
-#line 2065 "dhcp6_parser.yy"
+  case 635:
+#line 2130 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 3260 "dhcp6_parser.cc"
+#line 3341 "dhcp6_parser.cc"
     break;
 
-  case 616:
-#line 2066 "dhcp6_parser.yy"
+  case 636:
+#line 2131 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 3266 "dhcp6_parser.cc"
+#line 3347 "dhcp6_parser.cc"
     break;
 
-  case 617:
-#line 2069 "dhcp6_parser.yy"
+  case 637:
+#line 2134 "dhcp6_parser.yy"
     {
     ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 3275 "dhcp6_parser.cc"
+#line 3356 "dhcp6_parser.cc"
     break;
 
-  case 618:
-#line 2074 "dhcp6_parser.yy"
+  case 638:
+#line 2139 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3283 "dhcp6_parser.cc"
+#line 3364 "dhcp6_parser.cc"
     break;
 
-  case 619:
-#line 2076 "dhcp6_parser.yy"
+  case 639:
+#line 2141 "dhcp6_parser.yy"
     {
     ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 3293 "dhcp6_parser.cc"
+#line 3374 "dhcp6_parser.cc"
     break;
 
-  case 620:
-#line 2082 "dhcp6_parser.yy"
+  case 640:
+#line 2147 "dhcp6_parser.yy"
     {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 3302 "dhcp6_parser.cc"
+#line 3383 "dhcp6_parser.cc"
     break;
 
-  case 621:
-#line 2087 "dhcp6_parser.yy"
+  case 641:
+#line 2152 "dhcp6_parser.yy"
     {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 3311 "dhcp6_parser.cc"
+#line 3392 "dhcp6_parser.cc"
     break;
 
-  case 622:
-#line 2094 "dhcp6_parser.yy"
+  case 642:
+#line 2159 "dhcp6_parser.yy"
     {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3320 "dhcp6_parser.cc"
+#line 3401 "dhcp6_parser.cc"
     break;
 
-  case 623:
-#line 2101 "dhcp6_parser.yy"
+  case 643:
+#line 2166 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3331 "dhcp6_parser.cc"
+#line 3412 "dhcp6_parser.cc"
     break;
 
-  case 624:
-#line 2106 "dhcp6_parser.yy"
+  case 644:
+#line 2171 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3340 "dhcp6_parser.cc"
+#line 3421 "dhcp6_parser.cc"
     break;
 
-  case 632:
-#line 2122 "dhcp6_parser.yy"
+  case 652:
+#line 2187 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3348 "dhcp6_parser.cc"
+#line 3429 "dhcp6_parser.cc"
     break;
 
-  case 633:
-#line 2124 "dhcp6_parser.yy"
+  case 653:
+#line 2189 "dhcp6_parser.yy"
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3358 "dhcp6_parser.cc"
+#line 3439 "dhcp6_parser.cc"
     break;
 
-  case 634:
-#line 2130 "dhcp6_parser.yy"
+  case 654:
+#line 2195 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3366 "dhcp6_parser.cc"
+#line 3447 "dhcp6_parser.cc"
     break;
 
-  case 635:
-#line 2132 "dhcp6_parser.yy"
+  case 655:
+#line 2197 "dhcp6_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3376 "dhcp6_parser.cc"
+#line 3457 "dhcp6_parser.cc"
     break;
 
-  case 636:
-#line 2140 "dhcp6_parser.yy"
+  case 656:
+#line 2205 "dhcp6_parser.yy"
     {
     ElementPtr qc(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-queue-control", qc);
     ctx.stack_.push_back(qc);
     ctx.enter(ctx.DHCP_QUEUE_CONTROL);
 }
-#line 3387 "dhcp6_parser.cc"
+#line 3468 "dhcp6_parser.cc"
     break;
 
-  case 637:
-#line 2145 "dhcp6_parser.yy"
+  case 657:
+#line 2210 "dhcp6_parser.yy"
     {
     // The enable queue parameter is required.
     ctx.require("enable-queue", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3398 "dhcp6_parser.cc"
+#line 3479 "dhcp6_parser.cc"
     break;
 
-  case 646:
-#line 2164 "dhcp6_parser.yy"
+  case 666:
+#line 2229 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-queue", b);
 }
-#line 3407 "dhcp6_parser.cc"
+#line 3488 "dhcp6_parser.cc"
     break;
 
-  case 647:
-#line 2169 "dhcp6_parser.yy"
+  case 667:
+#line 2234 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3415 "dhcp6_parser.cc"
+#line 3496 "dhcp6_parser.cc"
     break;
 
-  case 648:
-#line 2171 "dhcp6_parser.yy"
+  case 668:
+#line 2236 "dhcp6_parser.yy"
     {
     ElementPtr qt(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("queue-type", qt);
     ctx.leave();
 }
-#line 3425 "dhcp6_parser.cc"
+#line 3506 "dhcp6_parser.cc"
     break;
 
-  case 649:
-#line 2177 "dhcp6_parser.yy"
+  case 669:
+#line 2242 "dhcp6_parser.yy"
     {
     ElementPtr c(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("capacity", c);
 }
-#line 3434 "dhcp6_parser.cc"
+#line 3515 "dhcp6_parser.cc"
     break;
 
-  case 650:
-#line 2182 "dhcp6_parser.yy"
+  case 670:
+#line 2247 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3442 "dhcp6_parser.cc"
+#line 3523 "dhcp6_parser.cc"
     break;
 
-  case 651:
-#line 2184 "dhcp6_parser.yy"
+  case 671:
+#line 2249 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set(yystack_[3].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3451 "dhcp6_parser.cc"
+#line 3532 "dhcp6_parser.cc"
     break;
 
-  case 652:
-#line 2191 "dhcp6_parser.yy"
+  case 672:
+#line 2256 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3462 "dhcp6_parser.cc"
+#line 3543 "dhcp6_parser.cc"
     break;
 
-  case 653:
-#line 2196 "dhcp6_parser.yy"
+  case 673:
+#line 2261 "dhcp6_parser.yy"
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3473 "dhcp6_parser.cc"
+#line 3554 "dhcp6_parser.cc"
     break;
 
-  case 654:
-#line 2203 "dhcp6_parser.yy"
+  case 674:
+#line 2268 "dhcp6_parser.yy"
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3483 "dhcp6_parser.cc"
+#line 3564 "dhcp6_parser.cc"
     break;
 
-  case 655:
-#line 2207 "dhcp6_parser.yy"
+  case 675:
+#line 2272 "dhcp6_parser.yy"
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3493 "dhcp6_parser.cc"
+#line 3574 "dhcp6_parser.cc"
     break;
 
-  case 676:
-#line 2237 "dhcp6_parser.yy"
+  case 696:
+#line 2302 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3502 "dhcp6_parser.cc"
+#line 3583 "dhcp6_parser.cc"
     break;
 
-  case 677:
-#line 2242 "dhcp6_parser.yy"
+  case 697:
+#line 2307 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3510 "dhcp6_parser.cc"
+#line 3591 "dhcp6_parser.cc"
     break;
 
-  case 678:
-#line 2244 "dhcp6_parser.yy"
+  case 698:
+#line 2309 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3520 "dhcp6_parser.cc"
+#line 3601 "dhcp6_parser.cc"
     break;
 
-  case 679:
-#line 2250 "dhcp6_parser.yy"
+  case 699:
+#line 2315 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3528 "dhcp6_parser.cc"
+#line 3609 "dhcp6_parser.cc"
     break;
 
-  case 680:
-#line 2252 "dhcp6_parser.yy"
+  case 700:
+#line 2317 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3538 "dhcp6_parser.cc"
+#line 3619 "dhcp6_parser.cc"
     break;
 
-  case 681:
-#line 2258 "dhcp6_parser.yy"
+  case 701:
+#line 2323 "dhcp6_parser.yy"
     {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3547 "dhcp6_parser.cc"
+#line 3628 "dhcp6_parser.cc"
     break;
 
-  case 682:
-#line 2263 "dhcp6_parser.yy"
+  case 702:
+#line 2328 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3555 "dhcp6_parser.cc"
+#line 3636 "dhcp6_parser.cc"
     break;
 
-  case 683:
-#line 2265 "dhcp6_parser.yy"
+  case 703:
+#line 2330 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3565 "dhcp6_parser.cc"
+#line 3646 "dhcp6_parser.cc"
     break;
 
-  case 684:
-#line 2271 "dhcp6_parser.yy"
+  case 704:
+#line 2336 "dhcp6_parser.yy"
     {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3574 "dhcp6_parser.cc"
+#line 3655 "dhcp6_parser.cc"
     break;
 
-  case 685:
-#line 2276 "dhcp6_parser.yy"
+  case 705:
+#line 2341 "dhcp6_parser.yy"
     {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3583 "dhcp6_parser.cc"
+#line 3664 "dhcp6_parser.cc"
     break;
 
-  case 686:
-#line 2281 "dhcp6_parser.yy"
+  case 706:
+#line 2346 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3591 "dhcp6_parser.cc"
+#line 3672 "dhcp6_parser.cc"
     break;
 
-  case 687:
-#line 2283 "dhcp6_parser.yy"
+  case 707:
+#line 2348 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3600 "dhcp6_parser.cc"
+#line 3681 "dhcp6_parser.cc"
     break;
 
-  case 688:
-#line 2289 "dhcp6_parser.yy"
+  case 708:
+#line 2354 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3606 "dhcp6_parser.cc"
+#line 3687 "dhcp6_parser.cc"
     break;
 
-  case 689:
-#line 2290 "dhcp6_parser.yy"
+  case 709:
+#line 2355 "dhcp6_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3612 "dhcp6_parser.cc"
+#line 3693 "dhcp6_parser.cc"
     break;
 
-  case 690:
-#line 2293 "dhcp6_parser.yy"
+  case 710:
+#line 2358 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3620 "dhcp6_parser.cc"
+#line 3701 "dhcp6_parser.cc"
     break;
 
-  case 691:
-#line 2295 "dhcp6_parser.yy"
+  case 711:
+#line 2360 "dhcp6_parser.yy"
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3630 "dhcp6_parser.cc"
+#line 3711 "dhcp6_parser.cc"
     break;
 
-  case 692:
-#line 2302 "dhcp6_parser.yy"
+  case 712:
+#line 2367 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3639 "dhcp6_parser.cc"
+#line 3720 "dhcp6_parser.cc"
     break;
 
-  case 693:
-#line 2308 "dhcp6_parser.yy"
+  case 713:
+#line 2373 "dhcp6_parser.yy"
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3648 "dhcp6_parser.cc"
+#line 3729 "dhcp6_parser.cc"
     break;
 
-  case 694:
-#line 2314 "dhcp6_parser.yy"
+  case 714:
+#line 2379 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3656 "dhcp6_parser.cc"
+#line 3737 "dhcp6_parser.cc"
     break;
 
-  case 695:
-#line 2316 "dhcp6_parser.yy"
+  case 715:
+#line 2381 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3665 "dhcp6_parser.cc"
+#line 3746 "dhcp6_parser.cc"
     break;
 
-  case 696:
-#line 2322 "dhcp6_parser.yy"
+  case 716:
+#line 2387 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3673 "dhcp6_parser.cc"
+#line 3754 "dhcp6_parser.cc"
     break;
 
-  case 697:
-#line 2324 "dhcp6_parser.yy"
+  case 717:
+#line 2389 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3683 "dhcp6_parser.cc"
+#line 3764 "dhcp6_parser.cc"
     break;
 
-  case 698:
-#line 2331 "dhcp6_parser.yy"
+  case 718:
+#line 2396 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3691 "dhcp6_parser.cc"
+#line 3772 "dhcp6_parser.cc"
     break;
 
-  case 699:
-#line 2333 "dhcp6_parser.yy"
+  case 719:
+#line 2398 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3701 "dhcp6_parser.cc"
+#line 3782 "dhcp6_parser.cc"
     break;
 
-  case 700:
-#line 2340 "dhcp6_parser.yy"
+  case 720:
+#line 2405 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3709 "dhcp6_parser.cc"
+#line 3790 "dhcp6_parser.cc"
     break;
 
-  case 701:
-#line 2342 "dhcp6_parser.yy"
+  case 721:
+#line 2407 "dhcp6_parser.yy"
     {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3719 "dhcp6_parser.cc"
+#line 3800 "dhcp6_parser.cc"
     break;
 
-  case 702:
-#line 2350 "dhcp6_parser.yy"
+  case 722:
+#line 2415 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3727 "dhcp6_parser.cc"
+#line 3808 "dhcp6_parser.cc"
     break;
 
-  case 703:
-#line 2352 "dhcp6_parser.yy"
+  case 723:
+#line 2417 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3736 "dhcp6_parser.cc"
+#line 3817 "dhcp6_parser.cc"
     break;
 
-  case 704:
-#line 2357 "dhcp6_parser.yy"
+  case 724:
+#line 2422 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3744 "dhcp6_parser.cc"
+#line 3825 "dhcp6_parser.cc"
     break;
 
-  case 705:
-#line 2359 "dhcp6_parser.yy"
+  case 725:
+#line 2424 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3753 "dhcp6_parser.cc"
+#line 3834 "dhcp6_parser.cc"
     break;
 
-  case 706:
-#line 2364 "dhcp6_parser.yy"
+  case 726:
+#line 2429 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3761 "dhcp6_parser.cc"
+#line 3842 "dhcp6_parser.cc"
     break;
 
-  case 707:
-#line 2366 "dhcp6_parser.yy"
+  case 727:
+#line 2431 "dhcp6_parser.yy"
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3770 "dhcp6_parser.cc"
+#line 3851 "dhcp6_parser.cc"
     break;
 
-  case 708:
-#line 2373 "dhcp6_parser.yy"
+  case 728:
+#line 2438 "dhcp6_parser.yy"
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3781 "dhcp6_parser.cc"
+#line 3862 "dhcp6_parser.cc"
     break;
 
-  case 709:
-#line 2378 "dhcp6_parser.yy"
+  case 729:
+#line 2443 "dhcp6_parser.yy"
     {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3791 "dhcp6_parser.cc"
+#line 3872 "dhcp6_parser.cc"
     break;
 
-  case 710:
-#line 2384 "dhcp6_parser.yy"
+  case 730:
+#line 2449 "dhcp6_parser.yy"
     {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3801 "dhcp6_parser.cc"
+#line 3882 "dhcp6_parser.cc"
     break;
 
-  case 711:
-#line 2388 "dhcp6_parser.yy"
+  case 731:
+#line 2453 "dhcp6_parser.yy"
     {
     // No config_control params are required
     // parsing completed
 }
-#line 3810 "dhcp6_parser.cc"
+#line 3891 "dhcp6_parser.cc"
     break;
 
-  case 716:
-#line 2403 "dhcp6_parser.yy"
+  case 736:
+#line 2468 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3821 "dhcp6_parser.cc"
+#line 3902 "dhcp6_parser.cc"
     break;
 
-  case 717:
-#line 2408 "dhcp6_parser.yy"
+  case 737:
+#line 2473 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3830 "dhcp6_parser.cc"
+#line 3911 "dhcp6_parser.cc"
     break;
 
-  case 718:
-#line 2413 "dhcp6_parser.yy"
+  case 738:
+#line 2478 "dhcp6_parser.yy"
     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3839 "dhcp6_parser.cc"
+#line 3920 "dhcp6_parser.cc"
     break;
 
-  case 719:
-#line 2423 "dhcp6_parser.yy"
+  case 739:
+#line 2488 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3850 "dhcp6_parser.cc"
+#line 3931 "dhcp6_parser.cc"
     break;
 
-  case 720:
-#line 2428 "dhcp6_parser.yy"
+  case 740:
+#line 2493 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3859 "dhcp6_parser.cc"
+#line 3940 "dhcp6_parser.cc"
     break;
 
-  case 721:
-#line 2433 "dhcp6_parser.yy"
+  case 741:
+#line 2498 "dhcp6_parser.yy"
     {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3869 "dhcp6_parser.cc"
+#line 3950 "dhcp6_parser.cc"
     break;
 
-  case 722:
-#line 2437 "dhcp6_parser.yy"
+  case 742:
+#line 2502 "dhcp6_parser.yy"
     {
     // parsing completed
 }
-#line 3877 "dhcp6_parser.cc"
+#line 3958 "dhcp6_parser.cc"
     break;
 
-  case 726:
-#line 2453 "dhcp6_parser.yy"
+  case 746:
+#line 2518 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3888 "dhcp6_parser.cc"
+#line 3969 "dhcp6_parser.cc"
     break;
 
-  case 727:
-#line 2458 "dhcp6_parser.yy"
+  case 747:
+#line 2523 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3897 "dhcp6_parser.cc"
+#line 3978 "dhcp6_parser.cc"
     break;
 
-  case 730:
-#line 2470 "dhcp6_parser.yy"
+  case 750:
+#line 2535 "dhcp6_parser.yy"
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3907 "dhcp6_parser.cc"
+#line 3988 "dhcp6_parser.cc"
     break;
 
-  case 731:
-#line 2474 "dhcp6_parser.yy"
+  case 751:
+#line 2539 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 3915 "dhcp6_parser.cc"
+#line 3996 "dhcp6_parser.cc"
     break;
 
-  case 741:
-#line 2491 "dhcp6_parser.yy"
+  case 764:
+#line 2559 "dhcp6_parser.yy"
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3924 "dhcp6_parser.cc"
+#line 4005 "dhcp6_parser.cc"
     break;
 
-  case 742:
-#line 2496 "dhcp6_parser.yy"
+  case 765:
+#line 2564 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3932 "dhcp6_parser.cc"
+#line 4013 "dhcp6_parser.cc"
     break;
 
-  case 743:
-#line 2498 "dhcp6_parser.yy"
+  case 766:
+#line 2566 "dhcp6_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3942 "dhcp6_parser.cc"
+#line 4023 "dhcp6_parser.cc"
+    break;
+
+  case 767:
+#line 2572 "dhcp6_parser.yy"
+    {
+    ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 4034 "dhcp6_parser.cc"
+    break;
+
+  case 768:
+#line 2577 "dhcp6_parser.yy"
+    {
+    ctx.stack_.pop_back();
+    ctx.leave();
+}
+#line 4043 "dhcp6_parser.cc"
+    break;
+
+  case 769:
+#line 2582 "dhcp6_parser.yy"
+    {
+    ElementPtr limit(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", limit);
+}
+#line 4052 "dhcp6_parser.cc"
+    break;
+
+  case 770:
+#line 2587 "dhcp6_parser.yy"
+    {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+}
+#line 4061 "dhcp6_parser.cc"
     break;
 
-  case 744:
-#line 2504 "dhcp6_parser.yy"
+  case 771:
+#line 2592 "dhcp6_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3953 "dhcp6_parser.cc"
+#line 4072 "dhcp6_parser.cc"
     break;
 
-  case 745:
-#line 2509 "dhcp6_parser.yy"
+  case 772:
+#line 2597 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3962 "dhcp6_parser.cc"
+#line 4081 "dhcp6_parser.cc"
     break;
 
-  case 748:
-#line 2518 "dhcp6_parser.yy"
+  case 775:
+#line 2606 "dhcp6_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3972 "dhcp6_parser.cc"
+#line 4091 "dhcp6_parser.cc"
     break;
 
-  case 749:
-#line 2522 "dhcp6_parser.yy"
+  case 776:
+#line 2610 "dhcp6_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 3980 "dhcp6_parser.cc"
+#line 4099 "dhcp6_parser.cc"
     break;
 
-  case 757:
-#line 2537 "dhcp6_parser.yy"
+  case 787:
+#line 2628 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3988 "dhcp6_parser.cc"
+#line 4107 "dhcp6_parser.cc"
     break;
 
-  case 758:
-#line 2539 "dhcp6_parser.yy"
+  case 788:
+#line 2630 "dhcp6_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3998 "dhcp6_parser.cc"
+#line 4117 "dhcp6_parser.cc"
     break;
 
-  case 759:
-#line 2545 "dhcp6_parser.yy"
+  case 789:
+#line 2636 "dhcp6_parser.yy"
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 4007 "dhcp6_parser.cc"
+#line 4126 "dhcp6_parser.cc"
     break;
 
-  case 760:
-#line 2550 "dhcp6_parser.yy"
+  case 790:
+#line 2641 "dhcp6_parser.yy"
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 4016 "dhcp6_parser.cc"
+#line 4135 "dhcp6_parser.cc"
     break;
 
-  case 761:
-#line 2555 "dhcp6_parser.yy"
+  case 791:
+#line 2646 "dhcp6_parser.yy"
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 4025 "dhcp6_parser.cc"
+#line 4144 "dhcp6_parser.cc"
     break;
 
-  case 762:
-#line 2560 "dhcp6_parser.yy"
+  case 792:
+#line 2651 "dhcp6_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4033 "dhcp6_parser.cc"
+#line 4152 "dhcp6_parser.cc"
     break;
 
-  case 763:
-#line 2562 "dhcp6_parser.yy"
+  case 793:
+#line 2653 "dhcp6_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 4043 "dhcp6_parser.cc"
+#line 4162 "dhcp6_parser.cc"
+    break;
+
+  case 794:
+#line 2659 "dhcp6_parser.yy"
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 4171 "dhcp6_parser.cc"
+    break;
+
+  case 795:
+#line 2664 "dhcp6_parser.yy"
+    {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 4180 "dhcp6_parser.cc"
+    break;
+
+  case 796:
+#line 2669 "dhcp6_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 4188 "dhcp6_parser.cc"
     break;
 
+  case 797:
+#line 2671 "dhcp6_parser.yy"
+    {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+}
+#line 4198 "dhcp6_parser.cc"
+    break;
 
-#line 4047 "dhcp6_parser.cc"
+
+#line 4202 "dhcp6_parser.cc"
 
             default:
               break;
@@ -4314,137 +4469,143 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp6Parser::yypact_ninf_ = -932;
+  const short Dhcp6Parser::yypact_ninf_ = -962;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp6Parser::yypact_[] =
   {
-     166,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,    52,    31,    76,    82,
-      97,   105,   113,   142,   152,   173,   175,   201,   224,   244,
-     245,   252,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,    31,  -101,    29,   524,    41,   196,   229,    95,
-      80,    42,    78,   257,   -38,   528,   103,   158,  -932,   254,
-     274,   306,   281,   301,  -932,  -932,  -932,  -932,  -932,   325,
-    -932,    38,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,   328,   329,   332,   335,   356,   371,
-     372,   383,   401,   409,   412,   413,  -932,   425,   426,   435,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   453,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,    56,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   468,  -932,
-      59,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,   469,   476,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,    87,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,    99,  -932,
-    -932,  -932,  -932,  -932,   481,  -932,   484,   491,  -932,  -932,
-    -932,  -932,  -932,  -932,   115,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,   386,   388,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,   407,  -932,  -932,   492,  -932,  -932,  -932,   493,
-    -932,  -932,   490,   496,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,   497,   498,  -932,
-    -932,  -932,  -932,   499,   507,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,   162,  -932,  -932,
-    -932,   509,  -932,  -932,   510,  -932,   512,   515,  -932,  -932,
-     516,   517,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   191,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,   193,  -932,  -932,  -932,
-     519,   199,  -932,  -932,  -932,  -932,    31,    31,  -932,   308,
-     521,   522,   523,   526,   527,  -932,    29,  -932,   529,   530,
-     533,   534,   536,   537,   318,   339,   355,   357,   358,   359,
-     360,   361,   333,   362,   363,   365,   545,   364,   366,   367,
-     551,   556,   559,   560,   561,   562,   563,   586,   587,   588,
-     589,   590,   592,   593,   595,   596,   597,   599,   600,   416,
-     601,   602,   606,   609,   611,   612,   524,  -932,   613,   431,
-      41,  -932,   620,   623,   624,   625,   627,   439,   438,   630,
-     633,   636,   196,  -932,   639,   229,  -932,   640,   452,   642,
-     454,   455,    95,  -932,   646,   651,   652,   655,   656,   658,
-     660,  -932,    80,  -932,   662,   663,   495,   665,   679,   680,
-     500,  -932,    78,   681,   501,   502,  -932,   257,   688,   689,
-     102,  -932,   503,   690,   695,   513,   696,   514,   518,   701,
-     704,   520,   531,   705,   706,   708,   709,   528,  -932,   103,
-    -932,   710,   525,   158,  -932,  -932,  -932,   713,   712,   714,
-      31,    31,    31,  -932,   532,   715,   716,   718,   720,   723,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,   538,  -932,  -932,  -932,    25,   539,   540,   724,
-     728,   729,   730,   543,    64,   731,   733,   734,   735,   736,
-     737,   739,   740,   741,   742,  -932,   743,   744,   745,   549,
-     554,   748,  -932,   749,  -932,  -932,   750,   751,   555,   565,
-     566,  -932,  -932,   749,   567,   753,  -932,   569,  -932,   570,
-    -932,   571,  -932,  -932,  -932,   749,   749,   749,   572,   573,
-     574,   575,  -932,   576,   577,  -932,   578,   579,   580,  -932,
-    -932,   581,  -932,  -932,  -932,   582,    31,  -932,  -932,   583,
-     584,  -932,   585,  -932,  -932,    83,   621,  -932,  -932,    25,
-     591,   594,   598,  -932,  -932,   774,  -932,  -932,    31,   524,
-     103,  -932,  -932,  -932,  -932,   158,    41,   100,   100,   773,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   775,
-     777,   778,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-     780,   -44,    31,   210,   691,   781,   782,   785,   143,    84,
-     -39,   -23,   528,  -932,  -932,   786,  -932,  -932,   787,   788,
-    -932,  -932,  -932,  -932,  -932,   -65,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,   773,  -932,   214,   266,   285,
-     287,  -932,  -932,  -932,  -932,   792,   793,   794,   795,   796,
-    -932,   797,   798,  -932,  -932,  -932,   799,   800,   801,   802,
-    -932,   300,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,   303,  -932,   803,   804,  -932,  -932,   805,
-     807,  -932,  -932,   806,   810,  -932,  -932,   808,   812,  -932,
-    -932,   811,   813,  -932,  -932,  -932,    60,  -932,  -932,  -932,
-     814,  -932,  -932,  -932,    70,  -932,  -932,  -932,  -932,   313,
-    -932,  -932,  -932,   116,  -932,  -932,   815,   816,  -932,  -932,
-     817,   819,  -932,   820,   821,   822,   823,   824,   825,   327,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   826,
-     827,   828,  -932,  -932,  -932,  -932,   381,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   387,  -932,
-    -932,  -932,   829,  -932,   830,  -932,  -932,  -932,   390,  -932,
-    -932,  -932,  -932,  -932,   411,  -932,   192,  -932,   616,  -932,
-     831,   832,  -932,  -932,   833,   835,  -932,  -932,  -932,   834,
-    -932,   837,  -932,  -932,  -932,  -932,   836,   840,   841,   842,
-     643,   653,   648,   654,   657,   843,   659,   661,   847,   849,
-     851,   664,   666,   667,   668,   100,  -932,  -932,   100,  -932,
-     773,   196,  -932,   775,    78,  -932,   777,   257,  -932,   778,
-     320,  -932,   780,   -44,  -932,  -932,   210,  -932,   852,   691,
-    -932,   234,   781,  -932,    80,  -932,   782,   -38,  -932,   785,
-     670,   671,   672,   673,   674,   675,   143,  -932,   854,   856,
-     676,   677,   678,    84,  -932,   868,   869,   -39,  -932,   683,
-     870,   682,   872,   -23,  -932,  -932,   231,   786,  -932,  -932,
-     873,   879,   229,  -932,   787,    95,  -932,   788,   880,  -932,
-    -932,   205,   626,   693,   698,  -932,  -932,  -932,  -932,  -932,
-     700,  -932,  -932,   703,   722,   752,  -932,  -932,  -932,  -932,
-    -932,   428,  -932,   429,  -932,   893,  -932,   898,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,   442,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,   759,  -932,  -932,   903,
-    -932,  -932,  -932,  -932,  -932,   900,   907,  -932,  -932,  -932,
-    -932,  -932,   904,  -932,   457,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,   235,   761,  -932,  -932,  -932,  -932,   784,
-     790,  -932,  -932,   809,  -932,    31,  -932,  -932,   911,  -932,
-    -932,  -932,  -932,  -932,   461,  -932,  -932,  -932,  -932,  -932,
-    -932,   818,   463,  -932,   467,  -932,   838,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,   320,  -932,  -932,   924,   747,  -932,   234,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,   925,   839,   933,   231,  -932,  -932,  -932,  -932,  -932,
-    -932,   844,  -932,  -932,   776,  -932,   845,  -932,  -932,   966,
-    -932,  -932,   272,  -932,    39,   966,  -932,  -932,   974,   975,
-     976,  -932,   473,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-     989,   846,   850,   853,   990,    39,  -932,   848,  -932,  -932,
-    -932,   857,  -932,  -932,  -932
+     181,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,    57,    53,    54,    58,
+      67,    77,    78,    84,    86,    88,    90,    92,   100,   104,
+     138,   161,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,    53,  -127,    32,   122,    60,   525,    46,   193,
+     198,    43,   126,   249,   -79,   624,   -47,   182,  -962,   125,
+     153,   245,   224,   264,  -962,  -962,  -962,  -962,  -962,   270,
+    -962,    56,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,   271,   280,   291,   292,   295,   303,
+     304,   332,   342,   343,   392,   393,   398,   411,  -962,   413,
+     414,   419,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,   421,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   102,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,   423,  -962,   106,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,   425,   426,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,   112,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,   124,  -962,  -962,  -962,  -962,  -962,
+     427,  -962,   429,   430,  -962,  -962,  -962,  -962,  -962,  -962,
+     135,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   385,   434,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   431,  -962,
+    -962,   436,  -962,  -962,  -962,   437,  -962,  -962,   435,   453,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,   454,   459,  -962,  -962,  -962,  -962,   449,
+     463,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,   136,  -962,  -962,  -962,   465,  -962,  -962,
+     477,  -962,   478,   481,  -962,  -962,   482,   484,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,   143,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,   145,  -962,  -962,  -962,   485,   155,  -962,  -962,
+    -962,  -962,    53,    53,  -962,   233,   487,   489,   490,   493,
+     497,  -962,    32,  -962,   499,   500,   501,   502,   504,   510,
+     310,   312,   314,   316,   317,   318,   320,   321,   322,   324,
+     331,   334,   328,   330,   528,   335,   338,   339,   535,   538,
+     541,   544,   545,   546,   547,   548,   549,   550,   554,   555,
+     556,   557,   558,   559,   560,   561,   563,   360,   564,   565,
+     566,   567,   568,   582,   122,  -962,   583,   386,    60,  -962,
+     591,   593,   594,   595,   596,   395,   394,   599,   600,   603,
+     525,  -962,   605,    46,  -962,   606,   405,   609,   416,   417,
+     193,  -962,   620,   621,   622,   623,   625,   626,   628,  -962,
+     198,  -962,   631,   634,   433,   636,   637,   638,   439,  -962,
+     126,   639,   441,   442,  -962,   249,   650,   651,   -77,  -962,
+     448,   653,   655,   460,   656,   461,   462,   661,   665,   464,
+     466,   666,   667,   669,   673,   624,  -962,   -47,  -962,   674,
+     473,   182,  -962,  -962,  -962,   676,   696,   699,    53,    53,
+      53,  -962,   503,   700,   708,   709,   710,   713,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,   514,  -962,  -962,  -962,   -78,   515,   516,   719,
+     722,   726,   725,   529,   220,   728,   731,   734,   735,   736,
+     737,   740,   744,   743,   746,  -962,   747,   748,   749,   552,
+     553,   754,  -962,   755,  -962,  -962,   756,   757,   581,   584,
+     585,  -962,  -962,   755,   586,   758,  -962,   587,  -962,   590,
+    -962,   592,  -962,  -962,  -962,   755,   755,   755,   601,   602,
+     604,   607,  -962,   608,   610,  -962,   611,   612,   613,  -962,
+    -962,   614,  -962,  -962,  -962,   615,    53,  -962,  -962,   616,
+     617,  -962,   618,  -962,  -962,    51,   632,  -962,  -962,   -78,
+     619,   627,   629,  -962,  -962,   759,  -962,  -962,    53,   122,
+     -47,  -962,  -962,  -962,  -962,   182,    60,   323,   323,   761,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   762,
+     763,   764,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+     765,   -76,    53,   306,   645,   780,   781,   791,   261,    71,
+     -40,   196,   624,  -962,  -962,   792,  -962,  -962,   793,   794,
+    -962,  -962,  -962,  -962,  -962,   -57,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,   761,  -962,   156,   159,   191,
+     194,  -962,  -962,  -962,  -962,   800,   801,   804,   806,   807,
+     810,  -962,  -962,   821,  -962,   822,   823,  -962,  -962,  -962,
+     824,   826,   827,   829,  -962,   214,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,   225,  -962,   760,   832,  -962,  -962,   830,   834,  -962,
+    -962,   833,   837,  -962,  -962,   835,   839,  -962,  -962,   838,
+     840,  -962,  -962,  -962,   118,  -962,  -962,  -962,   841,  -962,
+    -962,  -962,   149,  -962,  -962,  -962,  -962,   227,  -962,  -962,
+    -962,   163,  -962,  -962,   842,   843,  -962,  -962,   844,   846,
+    -962,   847,   848,   849,   850,   851,   852,   853,   228,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   854,
+     855,   856,  -962,  -962,  -962,  -962,   236,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   237,  -962,
+    -962,  -962,   857,  -962,   858,  -962,  -962,  -962,   247,  -962,
+    -962,  -962,  -962,  -962,   265,  -962,   235,  -962,   640,  -962,
+     859,   860,  -962,  -962,   861,   863,  -962,  -962,  -962,   862,
+    -962,   865,  -962,  -962,  -962,  -962,   864,   868,   869,   870,
+     658,   668,   663,   670,   671,   675,   871,   873,   677,   876,
+     678,   679,   878,   882,   883,   682,   683,   684,   685,   323,
+    -962,  -962,   323,  -962,   761,   525,  -962,   762,   126,  -962,
+     763,   249,  -962,   764,   633,  -962,   765,   -76,  -962,  -962,
+     306,  -962,   886,   645,  -962,   200,   780,  -962,   198,  -962,
+     781,   -79,  -962,   791,   687,   688,   689,   690,   691,   692,
+     694,   261,  -962,   895,   896,   697,   703,   706,    71,  -962,
+     901,   902,   -40,  -962,   711,   912,   712,   927,   196,  -962,
+    -962,   562,   792,  -962,  -962,   929,   933,    46,  -962,   793,
+     193,  -962,   794,   947,  -962,  -962,   389,   751,   767,   770,
+    -962,  -962,  -962,  -962,  -962,  -962,   771,   775,  -962,   778,
+    -962,  -962,   782,   784,   786,  -962,  -962,  -962,  -962,  -962,
+     290,  -962,   294,  -962,   944,  -962,   945,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   325,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,   790,  -962,  -962,
+     958,  -962,  -962,  -962,  -962,  -962,   959,   996,  -962,  -962,
+    -962,  -962,  -962,  1001,  -962,   326,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,   273,   811,  -962,  -962,  -962,
+    -962,   812,   815,  -962,  -962,   817,  -962,    53,  -962,  -962,
+    1021,  -962,  -962,  1022,  1025,  -962,  -962,  -962,  -962,   327,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   828,
+     329,  -962,   337,  -962,   831,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,   633,  -962,  -962,  1027,   836,  -962,   200,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  1028,   845,  1030,  1031,   866,   867,   562,  -962,  -962,
+    -962,  -962,  -962,  -962,   874,  -962,  -962,  1032,  -962,   877,
+     755,  -962,  -962,  -962,  -962,  1033,  -962,  -962,  -962,   250,
+    -962,   296,  1033,  -962,  -962,  1034,  1037,  1039,  -962,  1041,
+    1042,  -962,   391,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  1043,   875,   872,   879,  1044,   880,   881,
+    1045,   296,  -962,   884,  -962,  -962,  -962,   885,  -962,  -962,
+     887,  -962,  -962,  -962,  -962
   };
 
   const unsigned short
@@ -4454,174 +4615,182 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,    28,    30,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     1,    47,    40,    36,    35,    32,    33,    34,
-      39,     3,    37,    38,    60,     5,    72,     7,   161,     9,
-     310,    11,   486,    13,   511,    15,   541,    17,   411,    19,
-     419,    21,   456,    23,   275,    25,   654,    27,   721,    29,
-     710,    31,    49,    43,     0,     0,     0,     0,     0,     0,
-     543,     0,   421,   458,     0,     0,     0,     0,    51,     0,
-      50,     0,     0,    44,    70,   719,   702,   704,   706,     0,
-      69,     0,    62,    64,    66,    67,    68,    65,   125,   708,
-     159,   173,   175,   177,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   157,     0,     0,     0,
-     142,   149,   151,   302,   409,   448,   499,   501,   359,   367,
-     248,   265,   256,   241,   578,   533,   267,   286,   599,     0,
-     623,   636,   652,   153,   155,   726,   124,     0,    74,    76,
-      77,    78,    79,    80,    81,    82,    83,    84,   112,   113,
-     114,    85,   118,   119,   120,   121,   122,   123,   116,   117,
-     110,    88,    89,    90,    91,   107,    92,    94,    93,    98,
-      99,    86,   111,    87,    96,    97,   105,   106,   108,    95,
-     100,   101,   102,   103,   104,   109,   115,   170,     0,   169,
-       0,   163,   165,   166,   167,   168,   478,   503,   349,   351,
-     353,     0,     0,   357,   355,   572,   348,   314,   315,   316,
-     317,   318,   319,   320,   321,   337,   338,   339,   342,   343,
-     344,   345,   346,   347,   340,   341,     0,   312,   325,   326,
-     327,   330,   331,   333,   328,   329,   322,   323,   335,   336,
-     324,   332,   334,   497,   496,   492,   493,   491,     0,   488,
-     490,   494,   495,   526,     0,   529,     0,     0,   525,   519,
-     520,   518,   523,   524,     0,   513,   515,   516,   521,   522,
-     517,   570,   558,   560,   562,   564,   566,   568,   557,   554,
-     555,   556,     0,   544,   545,   549,   550,   547,   551,   552,
-     553,   548,     0,   438,   221,     0,   442,   440,   445,     0,
-     434,   435,     0,   422,   423,   425,   437,   426,   427,   428,
-     444,   429,   430,   431,   432,   433,   472,     0,     0,   470,
-     471,   474,   475,     0,   459,   460,   462,   463,   464,   465,
-     466,   467,   468,   469,   282,   284,   279,     0,   277,   280,
-     281,     0,   677,   679,     0,   682,     0,     0,   686,   690,
-       0,     0,   694,   696,   698,   700,   675,   673,   674,     0,
-     656,   658,   659,   660,   661,   662,   663,   664,   665,   666,
-     667,   668,   669,   670,   671,   672,     0,   723,   725,   716,
-       0,     0,   712,   714,   715,    48,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,    59,     0,    61,     0,     0,
+      39,     3,    37,    38,    60,     5,    72,     7,   165,     9,
+     326,    11,   506,    13,   531,    15,   561,    17,   431,    19,
+     439,    21,   476,    23,   289,    25,   674,    27,   741,    29,
+     730,    31,    49,    43,     0,     0,     0,     0,     0,     0,
+     563,     0,   441,   478,     0,     0,     0,     0,    51,     0,
+      50,     0,     0,    44,    70,   739,   722,   724,   726,     0,
+      69,     0,    62,    64,    66,    67,    68,    65,   127,   728,
+     163,   177,   179,   181,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   161,     0,
+       0,     0,   146,   153,   155,   318,   429,   468,   519,   521,
+     377,   385,   262,   279,   270,   255,   598,   553,   281,   300,
+     619,     0,   643,   656,   672,   157,   159,   746,   126,     0,
+      74,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+     112,   113,   114,   115,   116,    85,   120,   121,   122,   123,
+     124,   125,   118,   119,   110,    88,    89,    90,    91,   107,
+      92,    94,    93,    98,    99,    86,   111,    87,    96,    97,
+     105,   106,   108,    95,   100,   101,   102,   103,   104,   109,
+     117,   174,     0,   173,     0,   167,   169,   170,   171,   172,
+     498,   523,   367,   369,   371,     0,     0,   375,   373,   592,
+     366,   330,   331,   332,   333,   334,   335,   336,   337,   353,
+     354,   355,   356,   357,   360,   361,   362,   363,   364,   365,
+     358,   359,     0,   328,   341,   342,   343,   346,   347,   349,
+     344,   345,   338,   339,   351,   352,   340,   348,   350,   517,
+     516,   512,   513,   511,     0,   508,   510,   514,   515,   546,
+       0,   549,     0,     0,   545,   539,   540,   538,   543,   544,
+       0,   533,   535,   536,   541,   542,   537,   590,   578,   580,
+     582,   584,   586,   588,   577,   574,   575,   576,     0,   564,
+     565,   569,   570,   567,   571,   572,   573,   568,     0,   458,
+     229,     0,   462,   460,   465,     0,   454,   455,     0,   442,
+     443,   445,   457,   446,   447,   448,   464,   449,   450,   451,
+     452,   453,   492,     0,     0,   490,   491,   494,   495,     0,
+     479,   480,   482,   483,   484,   485,   486,   487,   488,   489,
+     296,   298,   293,     0,   291,   294,   295,     0,   697,   699,
+       0,   702,     0,     0,   706,   710,     0,     0,   714,   716,
+     718,   720,   695,   693,   694,     0,   676,   678,   679,   680,
+     681,   682,   683,   684,   685,   686,   687,   688,   689,   690,
+     691,   692,     0,   743,   745,   736,     0,     0,   732,   734,
+     735,    48,     0,     0,    41,     0,     0,     0,     0,     0,
+       0,    59,     0,    61,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    73,     0,     0,     0,   166,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   327,     0,     0,   507,     0,     0,     0,     0,     0,
+       0,   532,     0,     0,     0,     0,     0,     0,     0,   562,
+       0,   432,     0,     0,     0,     0,     0,     0,     0,   440,
+       0,     0,     0,     0,   477,     0,     0,     0,     0,   290,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   675,     0,   742,     0,
+       0,     0,   731,    52,    45,     0,     0,     0,     0,     0,
+       0,    63,     0,     0,     0,     0,     0,     0,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,     0,   143,   144,   145,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    73,     0,     0,
-       0,   162,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   311,     0,     0,   487,     0,     0,     0,
-       0,     0,     0,   512,     0,     0,     0,     0,     0,     0,
-       0,   542,     0,   412,     0,     0,     0,     0,     0,     0,
-       0,   420,     0,     0,     0,     0,   457,     0,     0,     0,
-       0,   276,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   655,     0,
-     722,     0,     0,     0,   711,    52,    45,     0,     0,     0,
-       0,     0,     0,    63,     0,     0,     0,     0,     0,     0,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,     0,   139,   140,   141,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   642,     0,     0,     0,     0,
+       0,     0,    75,     0,   176,   168,     0,     0,     0,     0,
+       0,   383,   384,     0,     0,     0,   329,     0,   509,     0,
+     548,     0,   551,   552,   534,     0,     0,     0,     0,     0,
+       0,     0,   566,     0,     0,   456,     0,     0,     0,   467,
+     444,     0,   496,   497,   481,     0,     0,   292,   696,     0,
+       0,   701,     0,   704,   705,     0,     0,   712,   713,     0,
+       0,     0,     0,   677,   744,     0,   738,   733,     0,     0,
+       0,   723,   725,   727,   128,     0,     0,     0,     0,   183,
+     162,   148,   149,   150,   151,   152,   147,   154,   156,   320,
+     433,   470,    42,   520,   522,   379,   380,   381,   382,   378,
+     387,     0,    49,     0,     0,     0,   555,   283,     0,     0,
+       0,     0,     0,   158,   160,     0,    53,   175,   500,   525,
+     368,   370,   372,   376,   374,     0,   518,   547,   550,   591,
+     579,   581,   583,   585,   587,   589,   459,   230,   463,   461,
+     466,   493,   297,   299,   698,   700,   703,   708,   709,   707,
+     711,   715,   717,   719,   721,   183,    46,     0,     0,     0,
+       0,   216,   222,   224,   226,     0,     0,     0,     0,     0,
+       0,   236,   238,     0,   246,     0,     0,   249,   251,   253,
+       0,     0,     0,     0,   215,     0,   189,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   207,   214,   208,   209,   210,   205,   206,   211,   212,
+     213,     0,   187,     0,   184,   185,   324,     0,   321,   322,
+     437,     0,   434,   435,   474,     0,   471,   472,   391,     0,
+     388,   389,   268,   269,     0,   264,   266,   267,     0,   277,
+     278,   274,     0,   272,   275,   276,   260,     0,   257,   259,
+     602,     0,   600,   559,     0,   556,   557,   287,     0,   284,
+     285,     0,     0,     0,     0,     0,     0,     0,     0,   302,
+     304,   305,   306,   307,   308,   309,   310,   632,   638,     0,
+       0,     0,   631,   628,   629,   630,     0,   621,   623,   626,
+     624,   625,   627,   652,   654,   651,   649,   650,     0,   645,
+     647,   648,     0,   667,     0,   670,   663,   664,     0,   658,
+     660,   661,   662,   665,     0,   750,     0,   748,    55,   504,
+       0,   501,   502,   529,     0,   526,   527,   596,   595,     0,
+     594,     0,    71,   740,   729,   164,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   622,     0,     0,     0,     0,
-       0,     0,    75,     0,   172,   164,     0,     0,     0,     0,
-       0,   365,   366,     0,     0,     0,   313,     0,   489,     0,
-     528,     0,   531,   532,   514,     0,     0,     0,     0,     0,
-       0,     0,   546,     0,     0,   436,     0,     0,     0,   447,
-     424,     0,   476,   477,   461,     0,     0,   278,   676,     0,
-       0,   681,     0,   684,   685,     0,     0,   692,   693,     0,
-       0,     0,     0,   657,   724,     0,   718,   713,     0,     0,
-       0,   703,   705,   707,   126,     0,     0,     0,     0,   179,
-     158,   144,   145,   146,   147,   148,   143,   150,   152,   304,
-     413,   450,    42,   500,   502,   361,   362,   363,   364,   360,
-     369,     0,    49,     0,     0,     0,   535,   269,     0,     0,
-       0,     0,     0,   154,   156,     0,    53,   171,   480,   505,
-     350,   352,   354,   358,   356,     0,   498,   527,   530,   571,
-     559,   561,   563,   565,   567,   569,   439,   222,   443,   441,
-     446,   473,   283,   285,   678,   680,   683,   688,   689,   687,
-     691,   695,   697,   699,   701,   179,    46,     0,     0,     0,
-       0,   208,   214,   216,   218,     0,     0,     0,     0,     0,
-     232,     0,     0,   235,   237,   239,     0,     0,     0,     0,
-     207,     0,   185,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   199,   206,   200,   201,   202,   197,   198,
-     203,   204,   205,     0,   183,     0,   180,   181,   308,     0,
-     305,   306,   417,     0,   414,   415,   454,     0,   451,   452,
-     373,     0,   370,   371,   254,   255,     0,   250,   252,   253,
-       0,   263,   264,   260,     0,   258,   261,   262,   246,     0,
-     243,   245,   582,     0,   580,   539,     0,   536,   537,   273,
-       0,   270,   271,     0,     0,     0,     0,     0,     0,     0,
-     288,   290,   291,   292,   293,   294,   295,   612,   618,     0,
-       0,     0,   611,   608,   609,   610,     0,   601,   603,   606,
-     604,   605,   607,   632,   634,   631,   629,   630,     0,   625,
-     627,   628,     0,   647,     0,   650,   643,   644,     0,   638,
-     640,   641,   642,   645,     0,   730,     0,   728,    55,   484,
-       0,   481,   482,   509,     0,   506,   507,   576,   575,     0,
-     574,     0,    71,   720,   709,   160,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   174,   176,     0,   178,
-       0,     0,   303,     0,   421,   410,     0,   458,   449,     0,
-       0,   368,     0,     0,   249,   266,     0,   257,     0,     0,
-     242,   584,     0,   579,   543,   534,     0,     0,   268,     0,
-       0,     0,     0,     0,     0,     0,     0,   287,     0,     0,
-       0,     0,     0,     0,   600,     0,     0,     0,   624,     0,
-       0,     0,     0,     0,   637,   653,     0,     0,   727,    57,
-       0,    56,     0,   479,     0,     0,   504,     0,     0,   573,
-     717,     0,     0,     0,     0,   220,   223,   224,   225,   226,
-       0,   234,   227,     0,     0,     0,   229,   230,   231,   228,
-     186,     0,   182,     0,   307,     0,   416,     0,   453,   408,
-     388,   389,   390,   392,   393,   394,   381,   382,   397,   398,
-     399,   402,   403,   404,   405,   406,   407,   400,   401,   377,
-     378,   379,   380,   386,   387,   385,   391,     0,   375,   383,
-     395,   396,   384,   372,   251,   259,     0,   244,   596,     0,
-     594,   595,   591,   592,   593,     0,   585,   586,   588,   589,
-     590,   581,     0,   538,     0,   272,   296,   297,   298,   299,
-     300,   301,   289,     0,     0,   617,   620,   621,   602,     0,
-       0,   626,   646,     0,   649,     0,   639,   744,     0,   742,
-     740,   734,   738,   739,     0,   732,   736,   737,   735,   729,
-      54,     0,     0,   483,     0,   508,     0,   210,   211,   212,
-     213,   209,   215,   217,   219,   233,   236,   238,   240,   184,
-     309,   418,   455,     0,   374,   247,     0,     0,   583,     0,
-     540,   274,   614,   615,   616,   613,   619,   633,   635,   648,
-     651,     0,     0,     0,     0,   731,    58,   485,   510,   577,
-     376,     0,   598,   587,     0,   741,     0,   733,   597,     0,
-     743,   748,     0,   746,     0,     0,   745,   757,     0,     0,
-       0,   762,     0,   750,   752,   753,   754,   755,   756,   747,
-       0,     0,     0,     0,     0,     0,   749,     0,   759,   760,
-     761,     0,   751,   758,   763
+     178,   180,     0,   182,     0,     0,   319,     0,   441,   430,
+       0,   478,   469,     0,     0,   386,     0,     0,   263,   280,
+       0,   271,     0,     0,   256,   604,     0,   599,   563,   554,
+       0,     0,   282,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   301,     0,     0,     0,     0,     0,     0,   620,
+       0,     0,     0,   644,     0,     0,     0,     0,     0,   657,
+     673,     0,     0,   747,    57,     0,    56,     0,   499,     0,
+       0,   524,     0,     0,   593,   737,     0,     0,     0,     0,
+     228,   231,   232,   233,   234,   235,     0,     0,   240,     0,
+     248,   241,     0,     0,     0,   243,   244,   245,   242,   190,
+       0,   186,     0,   323,     0,   436,     0,   473,   428,   406,
+     407,   408,   410,   411,   412,   399,   400,   415,   416,   417,
+     418,   419,   422,   423,   424,   425,   426,   427,   420,   421,
+     395,   396,   397,   398,   404,   405,   403,   409,     0,   393,
+     401,   413,   414,   402,   390,   265,   273,     0,   258,   616,
+       0,   614,   615,   611,   612,   613,     0,   605,   606,   608,
+     609,   610,   601,     0,   558,     0,   286,   311,   312,   313,
+     314,   315,   316,   317,   303,     0,     0,   637,   640,   641,
+     622,     0,     0,   646,   666,     0,   669,     0,   659,   771,
+       0,   765,   767,     0,     0,   763,   754,   761,   762,     0,
+     752,   756,   757,   758,   759,   760,   755,   749,    54,     0,
+       0,   503,     0,   528,     0,   218,   219,   220,   221,   217,
+     223,   225,   227,   237,   239,   247,   250,   252,   254,   188,
+     325,   438,   475,     0,   392,   261,     0,     0,   603,     0,
+     560,   288,   634,   635,   636,   633,   639,   653,   655,   668,
+     671,     0,     0,     0,     0,     0,     0,     0,   751,    58,
+     505,   530,   597,   394,     0,   618,   607,     0,   764,     0,
+       0,   769,   770,   753,   617,     0,   766,   768,   775,     0,
+     773,     0,     0,   772,   787,     0,     0,     0,   792,     0,
+       0,   796,     0,   777,   779,   780,   781,   782,   783,   784,
+     785,   786,   774,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   776,     0,   789,   790,   791,     0,   794,   795,
+       0,   778,   788,   793,   797
   };
 
   const short
   Dhcp6Parser::yypgoto_[] =
   {
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,    -5,  -932,   415,
-    -932,  -932,  -932,  -932,  -932,  -932,   297,  -932,  -533,  -932,
-    -932,  -932,   -74,  -932,  -932,  -932,   603,  -932,  -932,  -932,
-    -932,   331,   542,  -932,  -932,   -62,   -42,   -40,   -34,   -30,
-     -29,   -27,   -26,     4,     5,     7,  -932,     8,     9,    10,
-      11,  -932,   343,    21,  -932,    23,  -932,    24,  -932,    26,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,   330,   535,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   248,  -932,
-      61,  -932,  -652,    67,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,   -66,  -932,  -686,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,    40,  -932,  -932,
-    -932,  -932,  -932,    50,  -675,  -932,  -932,  -932,  -932,    48,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,    37,  -932,
-    -932,  -932,    43,   504,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,    35,  -932,  -932,  -932,  -932,  -932,  -932,  -931,  -932,
-    -932,  -932,    62,  -932,  -932,  -932,    66,   541,  -932,  -932,
-    -929,  -932,  -928,  -932,    30,  -932,    32,  -932,    36,  -932,
-    -932,  -932,  -927,  -932,  -932,  -932,  -932,    63,  -932,  -932,
-    -145,   941,  -932,  -932,  -932,  -932,  -932,    71,  -932,  -932,
-    -932,    72,  -932,   544,  -932,   -76,  -932,  -932,  -932,  -932,
-    -932,   -70,  -932,  -932,  -932,  -932,  -932,   -24,  -932,  -932,
-    -932,    69,  -932,  -932,  -932,    74,  -932,   546,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,    15,
-    -932,  -932,  -932,    22,   548,  -932,  -932,   -58,  -932,    -8,
-    -932,  -932,  -932,  -932,  -932,    18,  -932,  -932,  -932,    33,
-     547,  -932,  -932,  -932,  -932,  -932,  -932,  -932,   -47,  -932,
-    -932,  -932,    75,  -932,  -932,  -932,    79,  -932,   550,   334,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -926,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,    85,  -932,  -932,  -932,  -131,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,    57,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,    58,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,    51,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,   346,   553,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,  -932,   385,   557,  -932,  -932,  -932,  -932,  -932,  -932,
-    -932,   391,   552,   -72,  -932,  -932,    55,  -932,  -932,  -120,
-    -932,  -932,  -932,  -932,  -932,  -932,  -140,  -932,  -932,  -159,
-    -932,  -932,  -932,  -932,  -932,  -932,  -932
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,    -3,  -962,   171,
+    -962,  -962,  -962,  -962,  -962,  -962,   340,  -962,  -582,  -962,
+    -962,  -962,   -74,  -962,  -962,  -962,   635,  -962,  -962,  -962,
+    -962,   371,   579,  -962,  -962,   -62,   -45,   -43,   -42,   -41,
+     -37,   -30,   -29,   -26,   -25,    -6,     6,     9,  -962,    17,
+      19,    21,    23,  -962,   387,    27,  -962,    29,  -962,    31,
+    -962,    35,  -962,  -962,  -962,  -962,  -962,  -962,  -962,   368,
+     577,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+     293,  -962,    85,  -962,  -672,    91,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,   -70,  -962,  -712,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,    68,  -962,  -962,  -962,  -962,
+    -962,    75,  -687,  -962,  -962,  -962,  -962,    73,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,    61,  -962,  -962,  -962,
+      64,   539,  -962,  -962,  -962,  -962,  -962,  -962,  -962,    55,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -961,  -962,  -962,
+    -962,    93,  -962,  -962,  -962,    94,   578,  -962,  -962,  -956,
+    -962,  -955,  -962,    40,  -962,    44,  -962,    39,  -962,  -962,
+    -962,  -951,  -962,  -962,  -962,  -962,    89,  -962,  -962,  -132,
+     993,  -962,  -962,  -962,  -962,  -962,    96,  -962,  -962,  -962,
+     108,  -962,   571,  -962,   -66,  -962,  -962,  -962,  -962,  -962,
+     -53,  -962,  -962,  -962,  -962,  -962,     2,  -962,  -962,  -962,
+     110,  -962,  -962,  -962,   113,  -962,   570,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,    59,  -962,
+    -962,  -962,    62,   630,  -962,  -962,   -58,  -962,   -10,  -962,
+    -962,  -962,  -962,  -962,    63,  -962,  -962,  -962,    66,   597,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,   -46,  -962,  -962,
+    -962,   101,  -962,  -962,  -962,    98,  -962,   598,   365,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -946,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+     107,  -962,  -962,  -962,  -107,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,    95,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,    82,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,    79,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,   388,   569,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,   424,   573,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+     432,   572,   -49,  -962,  -962,    83,  -962,  -962,  -116,  -962,
+    -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -962,  -136,
+    -962,  -962,  -164,  -962,  -962,  -962,  -962,  -962,  -962,  -962,
+    -962,  -962,  -962,  -962
   };
 
   const short
@@ -4629,508 +4798,529 @@ namespace isc { namespace dhcp {
   {
       -1,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    88,    41,    42,
-      73,   693,    92,    93,    43,    72,    89,    90,   717,   908,
-    1010,  1011,   780,    45,    74,   101,   102,   103,   410,    47,
-      75,   157,   158,   159,   418,   160,   161,   162,   163,   164,
-     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   440,   686,   176,   441,   177,   442,   178,   463,   179,
-     464,   180,   436,   181,   420,    49,    76,   210,   211,   212,
-     468,   213,   182,   421,   183,   422,   184,   423,   805,   806,
-     807,   948,   781,   782,   783,   926,  1151,   784,   927,   785,
-     928,   786,   929,   787,   788,   505,   789,   790,   791,   792,
-     793,   794,   795,   796,   797,   798,   935,   799,   800,   938,
-     801,   939,   802,   940,   185,   453,   839,   840,   841,   968,
-     186,   450,   826,   827,   828,   829,   187,   452,   834,   835,
-     836,   837,   188,   451,   189,   456,   850,   851,   852,   977,
-      65,    84,   357,   358,   359,   518,   360,   519,   190,   457,
-     859,   860,   861,   862,   863,   864,   865,   866,   191,   443,
-     809,   810,   811,   951,    51,    77,   246,   247,   248,   474,
-     249,   475,   250,   476,   251,   480,   252,   479,   192,   448,
-     699,   254,   255,   193,   449,   821,   822,   823,   960,  1077,
-    1078,   194,   444,    59,    81,   813,   814,   815,   954,    61,
-      82,   322,   323,   324,   325,   326,   327,   328,   504,   329,
-     508,   330,   507,   331,   332,   509,   333,   195,   445,   817,
-     818,   819,   957,    63,    83,   343,   344,   345,   346,   347,
-     513,   348,   349,   350,   351,   257,   472,   910,   911,   912,
-    1012,    53,    78,   268,   269,   270,   484,   196,   446,   197,
-     447,   260,   473,   914,   915,   916,  1015,    55,    79,   284,
-     285,   286,   487,   287,   288,   489,   289,   290,   198,   455,
-     846,   847,   848,   974,    57,    80,   302,   303,   304,   305,
-     495,   306,   496,   307,   497,   308,   498,   309,   499,   310,
-     500,   311,   494,   262,   481,   919,   920,  1018,   199,   454,
-     843,   844,   971,  1095,  1096,  1097,  1098,  1099,  1166,  1100,
-     200,   458,   876,   877,   878,   988,  1175,   879,   880,   989,
-     881,   882,   201,   202,   460,   888,   889,   890,   995,   891,
-     996,   203,   461,   898,   899,   900,   901,  1000,   902,   903,
-    1002,   204,   462,    67,    85,   379,   380,   381,   382,   523,
-     383,   524,   384,   385,   526,   386,   387,   388,   529,   749,
-     389,   530,   390,   391,   392,   533,   393,   534,   394,   535,
-     395,   536,   104,   412,   105,   413,   106,   414,   205,   419,
-      71,    87,   401,   402,   403,   541,   404,   107,   411,    69,
-      86,   396,   397,   206,   465,   906,   907,  1006,  1134,  1135,
-    1136,  1137,  1183,  1138,  1181,  1202,  1203,  1204,  1212,  1213,
-    1214,  1220,  1215,  1216,  1217,  1218,  1224
+      73,   703,    92,    93,    43,    72,    89,    90,   727,   928,
+    1035,  1036,   794,    45,    74,   101,   102,   103,   416,    47,
+      75,   159,   160,   161,   424,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   448,   696,   180,   449,   181,   450,   182,
+     471,   183,   472,   184,   444,   185,   426,    49,    76,   214,
+     215,   216,   476,   217,   186,   427,   187,   428,   188,   429,
+     823,   824,   825,   972,   795,   796,   797,   946,  1189,   798,
+     947,   799,   948,   800,   949,   801,   802,   513,   803,   804,
+     805,   806,   807,   808,   956,   809,   957,   810,   811,   812,
+     813,   814,   815,   816,   959,   817,   818,   962,   819,   963,
+     820,   964,   189,   461,   857,   858,   859,   992,   190,   458,
+     844,   845,   846,   847,   191,   460,   852,   853,   854,   855,
+     192,   459,   193,   464,   868,   869,   870,  1001,    65,    84,
+     363,   364,   365,   526,   366,   527,   194,   465,   878,   879,
+     880,   881,   882,   883,   884,   885,   886,   195,   451,   827,
+     828,   829,   975,    51,    77,   252,   253,   254,   482,   255,
+     483,   256,   484,   257,   488,   258,   487,   196,   456,   709,
+     260,   261,   197,   457,   839,   840,   841,   984,  1108,  1109,
+     198,   452,    59,    81,   831,   832,   833,   978,    61,    82,
+     328,   329,   330,   331,   332,   333,   334,   512,   335,   516,
+     336,   515,   337,   338,   517,   339,   199,   453,   835,   836,
+     837,   981,    63,    83,   349,   350,   351,   352,   353,   521,
+     354,   355,   356,   357,   263,   480,   930,   931,   932,  1037,
+      53,    78,   274,   275,   276,   492,   200,   454,   201,   455,
+     266,   481,   934,   935,   936,  1040,    55,    79,   290,   291,
+     292,   495,   293,   294,   497,   295,   296,   202,   463,   864,
+     865,   866,   998,    57,    80,   308,   309,   310,   311,   503,
+     312,   504,   313,   505,   314,   506,   315,   507,   316,   508,
+     317,   502,   268,   489,   939,   940,  1043,   203,   462,   861,
+     862,   995,  1126,  1127,  1128,  1129,  1130,  1206,  1131,   204,
+     466,   896,   897,   898,  1013,  1215,   899,   900,  1014,   901,
+     902,   205,   206,   468,   908,   909,   910,  1020,   911,  1021,
+     207,   469,   918,   919,   920,   921,  1025,   922,   923,  1027,
+     208,   470,    67,    85,   385,   386,   387,   388,   531,   389,
+     532,   390,   391,   534,   392,   393,   394,   537,   759,   395,
+     538,   396,   397,   398,   541,   399,   542,   400,   543,   401,
+     544,   104,   418,   105,   419,   106,   420,   209,   425,    71,
+      87,   407,   408,   409,   549,   410,   107,   417,    69,    86,
+     402,   403,   210,   473,   926,   927,  1031,  1169,  1170,  1171,
+    1172,  1223,  1173,  1224,  1174,  1175,  1176,  1221,  1249,  1250,
+    1251,  1262,  1263,  1264,  1273,  1265,  1266,  1267,  1268,  1277,
+    1269,  1270,  1271,  1280
   };
 
   const unsigned short
   Dhcp6Parser::yytable_[] =
   {
-     100,   156,   209,   226,   264,   278,   298,   341,   320,   339,
-     356,   376,    40,   342,   398,   227,   321,   340,   214,   258,
-     271,   282,   300,   873,   334,   352,   803,   377,   833,  1070,
-     261,  1071,  1072,  1076,  1082,   228,    33,   229,    34,    94,
-      35,   416,   292,   230,   136,   137,   417,   231,   232,   917,
-     233,   234,    32,   256,   267,   281,   299,   207,   208,   466,
-     136,   137,   470,   963,   467,   824,   964,   471,   215,   259,
-     272,   283,   301,   966,   335,   353,   967,   378,   354,   355,
-     723,   235,   236,    44,   237,   238,   239,   240,   241,    46,
-     482,    91,   729,   730,   731,   483,   883,   884,   242,   313,
-     243,   244,   485,   245,    48,   867,   134,   486,   265,   279,
-     266,   280,    50,   253,   766,   892,   893,   894,   492,   972,
-      52,   761,   973,   493,   136,   137,   762,   763,   764,   765,
-     766,   767,   768,   769,   770,   771,   772,   773,   774,   775,
-     776,   777,   778,   779,   314,   135,   315,   316,   825,    54,
-     317,   318,   319,    99,    99,   695,   696,   697,   698,    56,
-     135,   136,   137,   136,   137,   520,   314,   136,   137,   895,
-     521,   399,   400,   273,   274,   275,   276,   277,   136,   137,
-      58,   291,    60,   681,   682,   683,   684,   292,   293,   294,
-     295,   296,   297,    95,   537,  1007,   539,   223,  1008,   538,
-     224,   540,   543,    96,    97,    98,  1207,   544,    62,  1208,
-    1209,  1210,  1211,   868,   869,   870,   871,   466,   354,   355,
-     685,    99,   922,    36,    37,    38,    39,  1147,  1148,  1149,
-    1150,    64,  1070,    99,  1071,  1072,  1076,  1082,   747,   748,
+     100,   158,   213,   230,   270,   284,   304,   893,   326,   345,
+     362,   382,   327,   346,    40,   231,   821,   347,   218,   264,
+     277,   288,   306,  1101,   340,   358,   851,   383,  1102,  1103,
+     348,   267,   232,  1107,   233,   234,   235,   404,  1113,   842,
+     236,   733,    94,   360,   361,   360,   361,   237,   238,   138,
+     139,   239,   240,   739,   740,   741,   298,    32,    33,   422,
+      34,    44,    35,   937,   423,    46,   219,   265,   278,   289,
+     307,   241,   341,   359,    48,   384,   211,   212,    91,   262,
+     273,   287,   305,   242,    50,    52,   243,   691,   692,   693,
+     694,    54,   887,    56,   244,    58,   245,    60,   246,    62,
+     247,   776,   903,   904,   248,   474,   249,    64,   250,   478,
+     475,    66,   251,   136,   479,   490,   259,   137,   271,   285,
+     491,   987,   272,   286,   988,   157,    99,   493,   269,   843,
+     695,   411,   494,   108,   109,   138,   139,   110,   500,   528,
+     111,   112,   113,   501,   529,    68,   545,   319,   547,   138,
+     139,   546,   990,   548,   227,   991,   412,   228,   551,   474,
+     138,   139,   547,   552,   942,    99,   996,   943,    70,   997,
      114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-     124,    66,    68,   127,   128,   129,   130,   131,   132,    70,
-     405,   135,   853,   854,   855,   856,   857,   858,   155,   539,
-      99,   216,    99,   217,   923,  1205,    99,   406,  1206,   136,
-     137,   218,   219,   220,   221,   222,   138,    99,   543,   408,
-     470,   833,    99,   924,   135,   925,  1041,   314,   223,   135,
-     314,   224,   145,   945,   409,   263,   945,   873,   946,   225,
-     407,   947,   136,   137,   136,   137,   969,   136,   137,   824,
-     831,   970,   832,   314,   336,   315,   316,   337,   338,   415,
-     986,   223,   424,   425,   224,   987,   426,  1088,  1089,   427,
-     136,   137,   100,     1,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,    14,    15,   153,   154,
-     428,  1172,  1173,  1174,   114,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   124,   429,   430,   127,   128,   129,
-     130,   131,   132,   133,   993,   135,   314,   431,    99,   994,
-     997,   502,   156,  1003,   501,   998,   209,  1127,  1004,  1128,
-    1129,   545,   546,   136,   137,   432,   219,   220,   226,   222,
-     138,   264,   214,   433,   537,   503,   434,   435,   278,  1005,
-     227,    99,   223,    99,   258,   224,    99,   271,   298,   437,
-     438,   945,   482,   225,   282,   261,  1159,  1160,   320,   439,
-     228,   341,   229,   339,   300,  1163,   321,   342,   230,    99,
-    1164,   340,   231,   232,   334,   233,   234,   459,   256,   352,
-     520,   267,   215,   376,  1184,  1171,   485,   398,   281,  1185,
-     492,  1187,   469,   477,   259,  1188,  1225,   272,   299,   377,
-     478,  1226,   153,   154,   283,   488,   235,   236,   490,   237,
-     238,   239,   240,   241,   301,   491,   506,   510,   511,   512,
-     547,   514,   515,   242,   335,   243,   244,   516,   245,   353,
-     517,   560,    99,   522,   525,   265,   527,   266,   253,   528,
-     531,   532,   279,   542,   280,   548,   549,   550,   568,   378,
-     551,   552,   561,   554,   555,   108,   109,   556,   557,   110,
-     558,   559,   111,   112,   113,   671,   672,   673,   562,   572,
-     563,   564,   565,   566,   567,   576,   569,   570,   571,   573,
-     577,   574,   575,   578,   579,   580,   581,   582,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     583,   584,   585,   586,   587,   156,   588,   589,   398,   590,
-     591,   592,   209,   593,   594,   596,   597,   136,   137,   595,
-     598,   136,   137,   599,   138,   600,   601,   603,   214,   139,
-     140,   141,   142,   143,   606,   144,   604,   607,   608,   609,
-     145,   610,   611,   612,   613,   872,   885,   614,   376,   146,
-     615,   743,   147,   617,   619,   620,   621,   622,   623,   148,
-     625,   874,   886,   896,   377,   626,   627,   149,   150,   628,
-     629,   151,   630,   756,   631,   152,   633,   634,   215,   636,
-     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
-     371,   372,   373,   637,   638,   641,   153,   154,   635,   155,
-     374,   375,   645,   646,   649,   639,   642,   643,   648,   650,
-     652,   875,   887,   897,   378,   655,   651,   653,   656,   659,
-     660,   654,   661,   662,   665,   657,    99,   668,   666,   669,
-      99,   670,   675,   676,   674,   677,   658,   678,   679,   689,
-     680,   687,   688,   690,   691,   694,   700,    34,   701,   702,
-     703,   713,   705,   704,   706,   707,   714,   720,   708,   709,
-     710,   711,   712,   715,   716,   718,   719,   721,   722,   724,
-     725,   726,   727,   728,   732,   733,   734,   735,   736,   737,
-     738,   739,   740,   741,   742,   744,   745,   746,   750,   755,
-     804,  1199,   808,   752,   812,   816,   753,   820,   842,   845,
-     754,   838,   849,   905,   909,   913,   930,   931,   932,   933,
-     934,   936,   937,   941,   942,   943,   944,   950,  1009,   949,
-     953,   952,   955,   956,   958,   959,   962,   961,  1152,   976,
-     965,   975,   979,   978,   980,   981,   982,   983,   984,   985,
-     990,   991,   992,   999,  1001,  1014,  1025,  1013,  1017,  1016,
-    1021,  1027,  1019,  1020,  1022,  1023,  1024,  1030,  1026,  1028,
-    1029,  1033,  1031,  1034,  1032,  1035,  1086,  1036,  1113,  1037,
-    1114,  1039,  1038,  1106,  1107,  1108,  1109,  1110,  1111,  1115,
-    1116,  1117,  1119,  1120,  1123,  1124,  1125,   226,  1122,  1140,
-     320,   341,  1141,   339,  1146,  1153,  1049,   342,   321,   227,
-    1154,   340,  1155,   258,  1069,  1156,   334,  1090,  1050,   352,
-     298,  1161,  1080,   356,   261,  1091,  1162,  1167,  1168,   228,
-    1169,   229,  1170,  1093,  1157,  1182,   300,   230,  1051,   872,
-    1052,   231,   232,   885,   233,   234,  1053,   256,  1191,  1194,
-    1054,  1055,  1130,  1056,  1057,   874,  1079,  1196,   264,   886,
-    1131,   278,  1192,   259,  1158,   896,   335,  1092,  1132,   353,
-     299,  1165,  1081,  1176,   271,   235,   236,   282,   237,   238,
-     239,   240,   241,  1094,  1058,  1059,   301,  1060,  1061,  1062,
-    1063,  1064,   242,  1201,   243,   244,  1177,   245,  1221,  1222,
-    1223,  1065,  1178,  1066,  1067,   875,  1068,   253,   267,   887,
-    1073,   281,  1074,  1227,  1231,   897,  1075,   692,  1133,   830,
-     757,  1179,   751,   921,   272,   605,   760,   283,   602,  1087,
-    1186,  1042,  1040,  1084,  1085,  1044,  1105,  1043,  1190,   553,
-    1104,  1112,   312,   616,   647,  1083,  1045,  1046,  1048,  1143,
-    1189,  1047,  1195,   618,  1142,  1145,  1198,  1200,  1193,   624,
-    1233,  1228,   265,  1229,   266,   279,  1230,   280,  1144,  1234,
-    1118,  1103,   632,  1102,  1126,  1121,   640,  1101,   904,   918,
-     759,   758,  1139,   644,  1197,  1219,  1232,     0,     0,     0,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   551,   405,   406,   478,   320,   944,
+     321,   322,   945,    95,   323,   324,   325,   888,   889,   890,
+     891,   138,   139,   757,   758,   138,   139,   969,   140,    96,
+      97,    98,   970,   141,   142,   143,   144,   145,   969,   146,
+     993,  1011,   414,   971,   147,   994,  1012,    99,  1032,  1018,
+    1022,  1033,  1101,   148,  1019,  1023,   149,  1102,  1103,   413,
+    1028,    99,  1107,  1252,   150,  1029,  1253,  1113,    36,    37,
+      38,    39,   151,   152,   137,    99,   153,   415,   545,   137,
+     154,   137,   320,  1030,   421,   430,    99,   279,   280,   281,
+     282,   283,   138,   139,   431,   138,   139,   138,   139,   138,
+     139,   155,   156,   969,   157,   432,   433,   490,  1199,   434,
+    1070,   227,  1200,   851,   228,   297,   893,   435,   436,  1119,
+    1120,   298,   299,   300,   301,   302,   303,   705,   706,   707,
+     708,   320,   342,   321,   322,   343,   344,    99,  1203,   528,
+    1227,    99,   493,  1204,  1211,  1228,   437,  1230,   138,   139,
+     500,   912,   913,   914,   771,  1231,   438,   439,   100,   772,
+     773,   774,   775,   776,   777,   778,   779,   780,   781,   782,
+     783,   784,   785,   786,   787,   788,   789,   790,   791,   792,
+     793,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,   871,   872,   873,   874,
+     875,   876,   877,   509,  1281,   320,   440,   441,    99,  1282,
+     158,   915,   442,    99,   213,    99,  1212,  1213,  1214,   553,
+     554,  1185,  1186,  1187,  1188,   443,   230,   445,   446,   270,
+     218,   842,   849,   447,   850,   467,   284,   477,   231,   485,
+     486,   496,   264,   498,   499,   277,   304,   510,   555,   511,
+     514,   518,   288,   519,   267,   232,   326,   233,   234,   235,
+     327,   345,   306,   236,    99,   346,   520,   524,   522,   347,
+     237,   238,   340,   523,   239,   240,   525,   358,   219,   530,
+    1254,   382,   348,  1255,  1256,  1257,  1258,  1259,  1260,  1261,
+     265,   533,   535,   278,   241,   536,   539,   383,   540,   550,
+     289,   556,   262,   557,   558,   273,   242,   559,   404,   243,
+     307,   560,   287,   562,   563,   564,   565,   244,   566,   245,
+     341,   246,   305,   247,   567,   359,   568,   248,   569,   249,
+     570,   250,   571,   572,   573,   251,   574,   575,    99,   259,
+     576,   577,   582,   271,   580,   384,   581,   272,   578,   586,
+     285,   579,   587,   583,   286,   588,   584,   585,   589,   590,
+     591,   592,   593,   594,   595,   681,   682,   683,   596,   597,
+     598,   599,   600,   601,   602,   603,   605,   604,   606,   607,
+     608,   609,   610,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   611,   613,   129,   130,
+     131,   132,   133,   134,   614,   616,   137,   617,   618,   619,
+     620,   621,   622,   623,   624,   158,   220,   625,   221,   627,
+     629,   630,   213,   631,   138,   139,   222,   223,   224,   225,
+     226,   140,   632,   633,   635,   636,   637,   638,   218,   639,
+     640,   404,   641,   227,   320,   643,   228,   147,   644,   645,
+     646,   647,   648,   651,   229,   892,   905,   649,   382,   652,
+     653,   138,   139,   753,   655,   656,   658,   659,  1247,   660,
+     662,   894,   906,   916,   383,   665,   661,   663,   664,   666,
+     669,   670,   667,   671,   668,   766,   219,   672,   675,   676,
+     678,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   155,   156,   129,   130,   131,   132,
+     133,   134,   135,   679,   137,   320,   680,   685,   684,   895,
+     907,   917,   384,   138,   139,   686,   687,   688,   689,   690,
+     697,   698,   138,   139,   699,   223,   224,   700,   226,   140,
+      99,   701,    34,   710,   704,  1159,   711,  1160,  1161,   712,
+     713,   227,   715,   714,   228,   716,  1162,  1163,  1164,   717,
+     718,   856,   229,   719,   720,   721,   722,   723,   724,   725,
+     726,   728,   729,   702,   765,   735,   973,    99,   822,   826,
+     830,   834,   838,   367,   368,   369,   370,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   730,   860,   863,   731,
+     732,   734,   736,   380,   381,   737,   760,   738,   867,   925,
+     929,   933,   155,   156,   950,   951,   742,   743,   952,   744,
+     953,   954,   745,   746,   955,   747,   748,   749,   750,   751,
+     752,   754,   755,   756,   762,   958,   960,   961,   965,    99,
+     966,   967,   763,   968,   764,   974,   976,   977,    99,   979,
+     980,   982,   983,   986,   985,  1034,  1000,   989,   999,  1003,
+    1002,  1004,  1005,  1006,  1007,  1008,  1009,  1010,  1015,  1016,
+    1017,  1024,  1026,  1039,  1050,  1038,  1042,  1041,  1046,  1052,
+    1044,  1045,  1047,  1048,  1049,  1056,  1051,  1057,  1053,  1054,
+    1059,  1055,  1062,  1058,  1060,  1061,  1063,  1064,  1065,  1066,
+    1117,  1068,  1067,  1137,  1138,  1139,  1140,  1141,  1142,  1145,
+    1146,   230,  1143,  1147,   326,  1151,  1152,   345,   327,  1148,
+    1078,   346,  1149,   231,  1100,   347,  1155,   264,  1156,  1154,
+     340,  1121,  1079,   358,   304,  1122,  1111,   362,   348,   267,
+     232,  1157,   233,   234,   235,  1178,  1179,  1124,   236,  1080,
+     306,  1081,  1082,  1083,   892,   237,   238,  1084,   905,   239,
+     240,  1184,  1201,  1202,  1085,  1086,  1190,  1165,  1087,  1088,
+     894,  1166,  1207,   270,   906,   265,   284,  1208,   341,   241,
+     916,   359,  1191,  1167,  1112,  1192,  1193,   262,  1089,   277,
+    1194,   242,   288,  1195,   243,  1125,  1110,  1196,   307,  1197,
+    1090,  1198,   244,  1091,   245,  1205,   246,  1123,   247,  1209,
+     305,  1092,   248,  1093,   249,  1094,   250,  1095,   895,  1210,
+     251,  1096,   907,  1097,   259,  1098,  1216,  1217,   917,  1099,
+    1218,  1168,  1219,  1106,  1104,  1222,  1225,   278,  1105,  1226,
+     289,  1234,  1237,  1229,  1239,  1240,  1232,  1245,  1274,   273,
+    1248,  1275,   287,  1276,  1235,  1278,  1279,  1283,  1287,  1290,
+     767,  1238,   848,   612,   770,   615,   761,   561,   941,  1071,
+    1069,  1118,  1115,  1116,  1136,  1135,  1144,   657,   626,  1072,
+    1073,  1233,  1241,  1242,   318,  1114,  1075,   271,  1285,  1244,
+     285,   272,  1246,  1284,   286,  1286,  1074,  1289,  1288,  1292,
+    1293,   650,  1294,  1077,  1076,   654,  1133,   634,  1181,  1180,
+     938,  1134,  1236,  1132,  1153,  1183,  1182,  1158,   642,   769,
+     924,  1243,   768,  1150,   673,  1177,  1272,  1291,     0,   674,
+       0,     0,     0,   628,   677,     0,     0,     0,     0,  1078,
+       0,     0,     0,  1100,     0,  1121,     0,     0,     0,  1122,
+       0,  1079,     0,     0,     0,  1111,     0,     0,     0,     0,
+       0,  1124,     0,  1165,  1220,     0,     0,  1166,  1080,     0,
+    1081,  1082,  1083,     0,     0,     0,  1084,     0,     0,  1167,
+       0,     0,     0,  1085,  1086,     0,     0,  1087,  1088,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,  1049,
-     663,   664,     0,     0,     0,  1090,     0,  1069,     0,     0,
-     667,  1050,     0,  1091,     0,  1080,     0,     0,     0,     0,
-    1130,  1093,     0,     0,     0,     0,     0,     0,  1131,     0,
-    1180,  1051,     0,  1052,     0,     0,  1132,     0,     0,  1053,
-       0,     0,     0,  1054,  1055,     0,  1056,  1057,     0,  1079,
-       0,     0,     0,     0,     0,  1092,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,  1081,     0,     0,     0,     0,
-       0,  1094,     0,     0,     0,     0,     0,  1058,  1059,     0,
-    1060,  1061,  1062,  1063,  1064,     0,  1133,     0,     0,     0,
-       0,     0,     0,     0,  1065,     0,  1066,  1067,     0,  1068,
-       0,     0,     0,  1073,     0,  1074,     0,     0,     0,  1075
+       0,     0,     0,  1112,     0,     0,     0,  1089,     0,  1125,
+       0,     0,     0,     0,     0,  1110,     0,     0,     0,  1090,
+       0,  1123,  1091,     0,     0,     0,     0,  1168,     0,     0,
+    1092,     0,  1093,     0,  1094,     0,  1095,     0,     0,     0,
+    1096,     0,  1097,     0,  1098,     0,     0,     0,  1099,     0,
+       0,     0,  1106,  1104,     0,     0,     0,  1105
   };
 
   const short
   Dhcp6Parser::yycheck_[] =
   {
-      74,    75,    76,    77,    78,    79,    80,    83,    82,    83,
-      84,    85,    17,    83,    86,    77,    82,    83,    76,    77,
-      78,    79,    80,   709,    82,    83,   678,    85,   703,   960,
-      77,   960,   960,   960,   960,    77,     5,    77,     7,    10,
-       9,     3,   107,    77,    83,    84,     8,    77,    77,   114,
-      77,    77,     0,    77,    78,    79,    80,    16,    17,     3,
-      83,    84,     3,     3,     8,   109,     6,     8,    76,    77,
-      78,    79,    80,     3,    82,    83,     6,    85,   116,   117,
-     613,    77,    77,     7,    77,    77,    77,    77,    77,     7,
-       3,   192,   625,   626,   627,     8,   135,   136,    77,    21,
-      77,    77,     3,    77,     7,    21,    64,     8,    78,    79,
-      78,    79,     7,    77,    30,   138,   139,   140,     3,     3,
-       7,    21,     6,     8,    83,    84,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    66,    65,    68,    69,   192,     7,
-      72,    73,    74,   192,   192,    91,    92,    93,    94,     7,
-      65,    83,    84,    83,    84,     3,    66,    83,    84,   192,
-       8,    13,    14,    78,    79,    80,    81,    82,    83,    84,
-       7,   101,     7,   158,   159,   160,   161,   107,   108,   109,
-     110,   111,   112,   164,     3,     3,     3,   102,     6,     8,
-     105,     8,     3,   174,   175,   176,   167,     8,     7,   170,
-     171,   172,   173,   129,   130,   131,   132,     3,   116,   117,
-     195,   192,     8,   192,   193,   194,   195,    22,    23,    24,
-      25,     7,  1163,   192,  1163,  1163,  1163,  1163,   155,   156,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,     7,     7,    57,    58,    59,    60,    61,    62,     7,
-       6,    65,   119,   120,   121,   122,   123,   124,   165,     3,
-     192,    75,   192,    77,     8,     3,   192,     3,     6,    83,
-      84,    85,    86,    87,    88,    89,    90,   192,     3,     8,
-       3,   966,   192,     8,    65,     8,   948,    66,   102,    65,
-      66,   105,   106,     3,     3,    76,     3,   993,     8,   113,
-       4,     8,    83,    84,    83,    84,     3,    83,    84,   109,
-     110,     8,   112,    66,    67,    68,    69,    70,    71,     4,
-       3,   102,     4,     4,   105,     8,     4,   103,   104,     4,
-      83,    84,   416,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   162,   163,
-       4,   126,   127,   128,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,     4,     4,    57,    58,    59,
-      60,    61,    62,    63,     3,    65,    66,     4,   192,     8,
-       3,     3,   466,     3,     8,     8,   470,   166,     8,   168,
-     169,   406,   407,    83,    84,     4,    86,    87,   482,    89,
-      90,   485,   470,     4,     3,     8,     4,     4,   492,     8,
-     482,   192,   102,   192,   482,   105,   192,   485,   502,     4,
-       4,     3,     3,   113,   492,   482,     8,     8,   512,     4,
-     482,   517,   482,   517,   502,     3,   512,   517,   482,   192,
-       8,   517,   482,   482,   512,   482,   482,     4,   482,   517,
-       3,   485,   470,   537,     3,     8,     3,   539,   492,     8,
-       3,     8,     4,     4,   482,     8,     3,   485,   502,   537,
-       4,     8,   162,   163,   492,     4,   482,   482,     4,   482,
-     482,   482,   482,   482,   502,     4,     4,     4,     8,     3,
-     192,     4,     4,   482,   512,   482,   482,     8,   482,   517,
-       3,   193,   192,     4,     4,   485,     4,   485,   482,     4,
-       4,     4,   492,     4,   492,     4,     4,     4,   195,   537,
-       4,     4,   193,     4,     4,    11,    12,     4,     4,    15,
-       4,     4,    18,    19,    20,   550,   551,   552,   193,     4,
-     193,   193,   193,   193,   193,     4,   194,   194,   193,   195,
-       4,   195,   195,     4,     4,     4,     4,     4,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-       4,     4,     4,     4,     4,   669,     4,     4,   670,     4,
-       4,     4,   676,     4,     4,     4,     4,    83,    84,   193,
-       4,    83,    84,     4,    90,     4,     4,     4,   676,    95,
-      96,    97,    98,    99,     4,   101,   195,     4,     4,     4,
-     106,     4,   193,   195,     4,   709,   710,     4,   712,   115,
-       4,   646,   118,     4,     4,   193,     4,   193,   193,   125,
-       4,   709,   710,   711,   712,     4,     4,   133,   134,     4,
-       4,   137,     4,   668,     4,   141,     4,     4,   676,     4,
-     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
-     152,   153,   154,     4,     4,     4,   162,   163,   193,   165,
-     162,   163,     4,     4,     4,   195,   195,   195,   195,     4,
-       4,   709,   710,   711,   712,     4,   193,   193,     4,     4,
-       4,   193,     4,     4,     4,   195,   192,     4,   193,     7,
-     192,     7,     7,     7,   192,     7,   195,     7,     5,     5,
-     192,   192,   192,     5,     5,   192,     5,     7,     5,     5,
-       5,   192,     5,     7,     5,     5,   192,   192,     7,     7,
-       7,     7,     7,     5,     5,     5,     5,   192,   192,   192,
-       7,   192,   192,   192,   192,   192,   192,   192,   192,   192,
-     192,   192,   192,   192,   192,   192,   192,   192,   157,     5,
-       7,     5,     7,   192,     7,     7,   192,     7,     7,     7,
-     192,   100,     7,     7,     7,     7,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     3,   192,     6,
-       3,     6,     6,     3,     6,     3,     3,     6,   192,     3,
-       6,     6,     3,     6,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     3,   193,     6,     3,     6,
-       4,   193,     8,     6,     4,     4,     4,     4,   195,   195,
-     193,     4,   193,     4,   193,     4,     4,   193,     4,   193,
-       4,   193,   195,   193,   193,   193,   193,   193,   193,   193,
-     193,   193,     4,     4,     4,   193,     4,   951,   195,     6,
-     954,   957,     3,   957,     4,   192,   960,   957,   954,   951,
-     192,   957,   192,   951,   960,   192,   954,   971,   960,   957,
-     974,     8,   960,   977,   951,   971,     8,     4,     8,   951,
-       3,   951,     8,   971,   192,     4,   974,   951,   960,   993,
-     960,   951,   951,   997,   951,   951,   960,   951,     4,     4,
-     960,   960,  1006,   960,   960,   993,   960,     4,  1012,   997,
-    1006,  1015,   195,   951,   192,  1003,   954,   971,  1006,   957,
-     974,   192,   960,   192,  1012,   951,   951,  1015,   951,   951,
-     951,   951,   951,   971,   960,   960,   974,   960,   960,   960,
-     960,   960,   951,     7,   951,   951,   192,   951,     4,     4,
-       4,   960,   192,   960,   960,   993,   960,   951,  1012,   997,
-     960,  1015,   960,     4,     4,  1003,   960,   582,  1006,   702,
-     669,   192,   659,   755,  1012,   470,   676,  1015,   466,   969,
-     192,   950,   945,   963,   966,   953,   979,   951,  1163,   416,
-     977,   986,    81,   482,   520,   962,   954,   956,   959,  1014,
-     192,   957,   193,   485,  1012,  1017,   192,   192,  1169,   492,
-     192,   195,  1012,   193,  1012,  1015,   193,  1015,  1015,   192,
-     993,   976,   502,   974,  1003,   997,   512,   972,   712,   725,
-     675,   670,  1007,   517,  1184,  1205,  1225,    -1,    -1,    -1,
+      74,    75,    76,    77,    78,    79,    80,   719,    82,    83,
+      84,    85,    82,    83,    17,    77,   688,    83,    76,    77,
+      78,    79,    80,   984,    82,    83,   713,    85,   984,   984,
+      83,    77,    77,   984,    77,    77,    77,    86,   984,   115,
+      77,   623,    10,   122,   123,   122,   123,    77,    77,    89,
+      90,    77,    77,   635,   636,   637,   113,     0,     5,     3,
+       7,     7,     9,   120,     8,     7,    76,    77,    78,    79,
+      80,    77,    82,    83,     7,    85,    16,    17,   205,    77,
+      78,    79,    80,    77,     7,     7,    77,   165,   166,   167,
+     168,     7,    21,     7,    77,     7,    77,     7,    77,     7,
+      77,    30,   142,   143,    77,     3,    77,     7,    77,     3,
+       8,     7,    77,    70,     8,     3,    77,    71,    78,    79,
+       8,     3,    78,    79,     6,   172,   205,     3,    82,   205,
+     208,     6,     8,    11,    12,    89,    90,    15,     3,     3,
+      18,    19,    20,     8,     8,     7,     3,    21,     3,    89,
+      90,     8,     3,     8,   108,     6,     3,   111,     3,     3,
+      89,    90,     3,     8,     8,   205,     3,     8,     7,     6,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,     3,    13,    14,     3,    72,     8,
+      74,    75,     8,   171,    78,    79,    80,   136,   137,   138,
+     139,    89,    90,   162,   163,    89,    90,     3,    96,   187,
+     188,   189,     8,   101,   102,   103,   104,   105,     3,   107,
+       3,     3,     8,     8,   112,     8,     8,   205,     3,     3,
+       3,     6,  1203,   121,     8,     8,   124,  1203,  1203,     4,
+       3,   205,  1203,     3,   132,     8,     6,  1203,   205,   206,
+     207,   208,   140,   141,    71,   205,   144,     3,     3,    71,
+     148,    71,    72,     8,     4,     4,   205,    84,    85,    86,
+      87,    88,    89,    90,     4,    89,    90,    89,    90,    89,
+      90,   169,   170,     3,   172,     4,     4,     3,     8,     4,
+     972,   108,     8,   990,   111,   107,  1018,     4,     4,   109,
+     110,   113,   114,   115,   116,   117,   118,    97,    98,    99,
+     100,    72,    73,    74,    75,    76,    77,   205,     3,     3,
+       3,   205,     3,     8,     8,     8,     4,     8,    89,    90,
+       3,   145,   146,   147,    21,     8,     4,     4,   422,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   125,   126,   127,   128,
+     129,   130,   131,     8,     3,    72,     4,     4,   205,     8,
+     474,   205,     4,   205,   478,   205,   133,   134,   135,   412,
+     413,    22,    23,    24,    25,     4,   490,     4,     4,   493,
+     478,   115,   116,     4,   118,     4,   500,     4,   490,     4,
+       4,     4,   490,     4,     4,   493,   510,     3,   205,     8,
+       4,     4,   500,     8,   490,   490,   520,   490,   490,   490,
+     520,   525,   510,   490,   205,   525,     3,     8,     4,   525,
+     490,   490,   520,     4,   490,   490,     3,   525,   478,     4,
+     174,   545,   525,   177,   178,   179,   180,   181,   182,   183,
+     490,     4,     4,   493,   490,     4,     4,   545,     4,     4,
+     500,     4,   490,     4,     4,   493,   490,     4,   547,   490,
+     510,     4,   500,     4,     4,     4,     4,   490,     4,   490,
+     520,   490,   510,   490,     4,   525,   206,   490,   206,   490,
+     206,   490,   206,   206,   206,   490,   206,   206,   205,   490,
+     208,   207,     4,   493,   206,   545,   206,   493,   207,     4,
+     500,   207,     4,   208,   500,     4,   208,   208,     4,     4,
+       4,     4,     4,     4,     4,   558,   559,   560,     4,     4,
+       4,     4,     4,     4,     4,     4,   206,     4,     4,     4,
+       4,     4,     4,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,     4,     4,    63,    64,
+      65,    66,    67,    68,   208,     4,    71,     4,     4,     4,
+       4,   206,   208,     4,     4,   679,    81,     4,    83,     4,
+       4,   206,   686,     4,    89,    90,    91,    92,    93,    94,
+      95,    96,   206,   206,     4,     4,     4,     4,   686,     4,
+       4,   680,     4,   108,    72,     4,   111,   112,     4,   206,
+       4,     4,     4,     4,   119,   719,   720,   208,   722,   208,
+     208,    89,    90,   656,     4,     4,   208,     4,  1240,     4,
+       4,   719,   720,   721,   722,     4,   206,   206,   206,     4,
+       4,     4,   208,     4,   208,   678,   686,     4,     4,   206,
+       4,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,   169,   170,    63,    64,    65,    66,
+      67,    68,    69,     7,    71,    72,     7,     7,   205,   719,
+     720,   721,   722,    89,    90,     7,     7,     7,     5,   205,
+     205,   205,    89,    90,     5,    92,    93,     5,    95,    96,
+     205,     5,     7,     5,   205,   173,     5,   175,   176,     5,
+       5,   108,     5,     7,   111,     5,   184,   185,   186,     5,
+       7,   106,   119,     7,     7,     7,     7,   205,   205,     5,
+       5,     5,     5,   592,     5,     7,     6,   205,     7,     7,
+       7,     7,     7,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   205,     7,     7,   205,
+     205,   205,   205,   169,   170,   205,   164,   205,     7,     7,
+       7,     7,   169,   170,     4,     4,   205,   205,     4,   205,
+       4,     4,   205,   205,     4,   205,   205,   205,   205,   205,
+     205,   205,   205,   205,   205,     4,     4,     4,     4,   205,
+       4,     4,   205,     4,   205,     3,     6,     3,   205,     6,
+       3,     6,     3,     3,     6,   205,     3,     6,     6,     3,
+       6,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     3,   206,     6,     3,     6,     4,   206,
+       8,     6,     4,     4,     4,     4,   208,     4,   208,   208,
+       4,   206,     4,   206,   206,   206,     4,     4,   206,   206,
+       4,   206,   208,   206,   206,   206,   206,   206,   206,     4,
+       4,   975,   208,   206,   978,     4,     4,   981,   978,   206,
+     984,   981,   206,   975,   984,   981,     4,   975,   206,   208,
+     978,   995,   984,   981,   998,   995,   984,  1001,   981,   975,
+     975,     4,   975,   975,   975,     6,     3,   995,   975,   984,
+     998,   984,   984,   984,  1018,   975,   975,   984,  1022,   975,
+     975,     4,     8,     8,   984,   984,   205,  1031,   984,   984,
+    1018,  1031,     4,  1037,  1022,   975,  1040,     8,   978,   975,
+    1028,   981,   205,  1031,   984,   205,   205,   975,   984,  1037,
+     205,   975,  1040,   205,   975,   995,   984,   205,   998,   205,
+     984,   205,   975,   984,   975,   205,   975,   995,   975,     3,
+     998,   984,   975,   984,   975,   984,   975,   984,  1018,     8,
+     975,   984,  1022,   984,   975,   984,   205,   205,  1028,   984,
+     205,  1031,   205,   984,   984,     4,     4,  1037,   984,     4,
+    1040,     4,     4,   205,     4,     4,   205,     5,     4,  1037,
+       7,     4,  1040,     4,   208,     4,     4,     4,     4,     4,
+     679,   206,   712,   474,   686,   478,   669,   422,   765,   974,
+     969,   993,   987,   990,  1003,  1001,  1011,   528,   490,   975,
+     977,  1203,   206,   206,    81,   986,   980,  1037,   206,   205,
+    1040,  1037,   205,   208,  1040,   206,   978,   206,   208,   205,
+     205,   520,   205,   983,   981,   525,   998,   500,  1039,  1037,
+     735,  1000,  1209,   996,  1022,  1042,  1040,  1028,   510,   685,
+     722,  1227,   680,  1018,   545,  1032,  1252,  1281,    -1,   547,
+      -1,    -1,    -1,   493,   551,    -1,    -1,    -1,    -1,  1203,
+      -1,    -1,    -1,  1203,    -1,  1209,    -1,    -1,    -1,  1209,
+      -1,  1203,    -1,    -1,    -1,  1203,    -1,    -1,    -1,    -1,
+      -1,  1209,    -1,  1227,  1157,    -1,    -1,  1227,  1203,    -1,
+    1203,  1203,  1203,    -1,    -1,    -1,  1203,    -1,    -1,  1227,
+      -1,    -1,    -1,  1203,  1203,    -1,    -1,  1203,  1203,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1163,
-     537,   539,    -1,    -1,    -1,  1169,    -1,  1163,    -1,    -1,
-     543,  1163,    -1,  1169,    -1,  1163,    -1,    -1,    -1,    -1,
-    1184,  1169,    -1,    -1,    -1,    -1,    -1,    -1,  1184,    -1,
-    1125,  1163,    -1,  1163,    -1,    -1,  1184,    -1,    -1,  1163,
-      -1,    -1,    -1,  1163,  1163,    -1,  1163,  1163,    -1,  1163,
-      -1,    -1,    -1,    -1,    -1,  1169,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,  1163,    -1,    -1,    -1,    -1,
-      -1,  1169,    -1,    -1,    -1,    -1,    -1,  1163,  1163,    -1,
-    1163,  1163,  1163,  1163,  1163,    -1,  1184,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,  1163,    -1,  1163,  1163,    -1,  1163,
-      -1,    -1,    -1,  1163,    -1,  1163,    -1,    -1,    -1,  1163
+      -1,    -1,    -1,  1203,    -1,    -1,    -1,  1203,    -1,  1209,
+      -1,    -1,    -1,    -1,    -1,  1203,    -1,    -1,    -1,  1203,
+      -1,  1209,  1203,    -1,    -1,    -1,    -1,  1227,    -1,    -1,
+    1203,    -1,  1203,    -1,  1203,    -1,  1203,    -1,    -1,    -1,
+    1203,    -1,  1203,    -1,  1203,    -1,    -1,    -1,  1203,    -1,
+      -1,    -1,  1203,  1203,    -1,    -1,    -1,  1203
   };
 
   const unsigned short
   Dhcp6Parser::yystos_[] =
   {
-       0,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   191,   197,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,     0,     5,     7,     9,   192,   193,   194,   195,
-     213,   214,   215,   220,     7,   229,     7,   235,     7,   271,
-       7,   370,     7,   447,     7,   463,     7,   480,     7,   399,
-       7,   405,     7,   429,     7,   346,     7,   549,     7,   595,
-       7,   586,   221,   216,   230,   236,   272,   371,   448,   464,
-     481,   400,   406,   430,   347,   550,   596,   587,   213,   222,
-     223,   192,   218,   219,    10,   164,   174,   175,   176,   192,
-     228,   231,   232,   233,   578,   580,   582,   593,    11,    12,
-      15,    18,    19,    20,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    83,    84,    90,    95,
-      96,    97,    98,    99,   101,   106,   115,   118,   125,   133,
-     134,   137,   141,   162,   163,   165,   228,   237,   238,   239,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   259,   261,   263,   265,
-     267,   269,   278,   280,   282,   320,   326,   332,   338,   340,
-     354,   364,   384,   389,   397,   423,   453,   455,   474,   504,
-     516,   528,   529,   537,   547,   584,   599,    16,    17,   228,
-     273,   274,   275,   277,   453,   455,    75,    77,    85,    86,
-      87,    88,    89,   102,   105,   113,   228,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   253,   254,
-     255,   256,   259,   261,   263,   265,   372,   373,   374,   376,
-     378,   380,   382,   384,   387,   388,   423,   441,   453,   455,
-     457,   474,   499,    76,   228,   380,   382,   423,   449,   450,
-     451,   453,   455,    78,    79,    80,    81,    82,   228,   380,
-     382,   423,   453,   455,   465,   466,   467,   469,   470,   472,
-     473,   101,   107,   108,   109,   110,   111,   112,   228,   423,
-     453,   455,   482,   483,   484,   485,   487,   489,   491,   493,
-     495,   497,   397,    21,    66,    68,    69,    72,    73,    74,
-     228,   300,   407,   408,   409,   410,   411,   412,   413,   415,
-     417,   419,   420,   422,   453,   455,    67,    70,    71,   228,
-     300,   411,   417,   431,   432,   433,   434,   435,   437,   438,
-     439,   440,   453,   455,   116,   117,   228,   348,   349,   350,
-     352,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   162,   163,   228,   453,   455,   551,
-     552,   553,   554,   556,   558,   559,   561,   562,   563,   566,
-     568,   569,   570,   572,   574,   576,   597,   598,   599,    13,
-      14,   588,   589,   590,   592,     6,     3,     4,     8,     3,
-     234,   594,   579,   581,   583,     4,     3,     8,   240,   585,
-     270,   279,   281,   283,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,   268,     4,     4,     4,
-     257,   260,   262,   365,   398,   424,   454,   456,   385,   390,
-     327,   339,   333,   321,   505,   475,   341,   355,   517,     4,
-     530,   538,   548,   264,   266,   600,     3,     8,   276,     4,
-       3,     8,   442,   458,   375,   377,   379,     4,     4,   383,
-     381,   500,     3,     8,   452,     3,     8,   468,     4,   471,
-       4,     4,     3,     8,   498,   486,   488,   490,   492,   494,
-     496,     8,     3,     8,   414,   301,     4,   418,   416,   421,
-       4,     8,     3,   436,     4,     4,     8,     3,   351,   353,
-       3,     8,     4,   555,   557,     4,   560,     4,     4,   564,
-     567,     4,     4,   571,   573,   575,   577,     3,     8,     3,
-       8,   591,     4,     3,     8,   213,   213,   192,     4,     4,
-       4,     4,     4,   232,     4,     4,     4,     4,     4,     4,
-     193,   193,   193,   193,   193,   193,   193,   193,   195,   194,
-     194,   193,     4,   195,   195,   195,     4,     4,     4,     4,
+       0,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,     0,     5,     7,     9,   205,   206,   207,   208,
+     226,   227,   228,   233,     7,   242,     7,   248,     7,   286,
+       7,   392,     7,   469,     7,   485,     7,   502,     7,   421,
+       7,   427,     7,   451,     7,   367,     7,   571,     7,   617,
+       7,   608,   234,   229,   243,   249,   287,   393,   470,   486,
+     503,   422,   428,   452,   368,   572,   618,   609,   226,   235,
+     236,   205,   231,   232,    10,   171,   187,   188,   189,   205,
+     241,   244,   245,   246,   600,   602,   604,   615,    11,    12,
+      15,    18,    19,    20,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    89,    90,
+      96,   101,   102,   103,   104,   105,   107,   112,   121,   124,
+     132,   140,   141,   144,   148,   169,   170,   172,   241,   250,
+     251,   252,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     274,   276,   278,   280,   282,   284,   293,   295,   297,   341,
+     347,   353,   359,   361,   375,   386,   406,   411,   419,   445,
+     475,   477,   496,   526,   538,   550,   551,   559,   569,   606,
+     621,    16,    17,   241,   288,   289,   290,   292,   475,   477,
+      81,    83,    91,    92,    93,    94,    95,   108,   111,   119,
+     241,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,   268,   269,   270,   271,   274,   276,
+     278,   280,   394,   395,   396,   398,   400,   402,   404,   406,
+     409,   410,   445,   463,   475,   477,   479,   496,   521,    82,
+     241,   402,   404,   445,   471,   472,   473,   475,   477,    84,
+      85,    86,    87,    88,   241,   402,   404,   445,   475,   477,
+     487,   488,   489,   491,   492,   494,   495,   107,   113,   114,
+     115,   116,   117,   118,   241,   445,   475,   477,   504,   505,
+     506,   507,   509,   511,   513,   515,   517,   519,   419,    21,
+      72,    74,    75,    78,    79,    80,   241,   315,   429,   430,
+     431,   432,   433,   434,   435,   437,   439,   441,   442,   444,
+     475,   477,    73,    76,    77,   241,   315,   433,   439,   453,
+     454,   455,   456,   457,   459,   460,   461,   462,   475,   477,
+     122,   123,   241,   369,   370,   371,   373,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     169,   170,   241,   475,   477,   573,   574,   575,   576,   578,
+     580,   581,   583,   584,   585,   588,   590,   591,   592,   594,
+     596,   598,   619,   620,   621,    13,    14,   610,   611,   612,
+     614,     6,     3,     4,     8,     3,   247,   616,   601,   603,
+     605,     4,     3,     8,   253,   607,   285,   294,   296,   298,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   193,     4,     4,     4,     4,
-       4,     4,   238,     4,   195,   274,     4,     4,     4,     4,
-       4,   193,   195,     4,     4,     4,   373,     4,   450,     4,
-     193,     4,   193,   193,   466,     4,     4,     4,     4,     4,
-       4,     4,   484,     4,     4,   193,     4,     4,     4,   195,
-     409,     4,   195,   195,   433,     4,     4,   349,   195,     4,
-       4,   193,     4,   193,   193,     4,     4,   195,   195,     4,
-       4,     4,     4,   552,   598,     4,   193,   589,     4,     7,
-       7,   213,   213,   213,   192,     7,     7,     7,     7,     5,
-     192,   158,   159,   160,   161,   195,   258,   192,   192,     5,
-       5,     5,   215,   217,   192,    91,    92,    93,    94,   386,
+       4,     4,     4,     4,   283,     4,     4,     4,   272,   275,
+     277,   387,   420,   446,   476,   478,   407,   412,   348,   360,
+     354,   342,   527,   497,   362,   376,   539,     4,   552,   560,
+     570,   279,   281,   622,     3,     8,   291,     4,     3,     8,
+     464,   480,   397,   399,   401,     4,     4,   405,   403,   522,
+       3,     8,   474,     3,     8,   490,     4,   493,     4,     4,
+       3,     8,   520,   508,   510,   512,   514,   516,   518,     8,
+       3,     8,   436,   316,     4,   440,   438,   443,     4,     8,
+       3,   458,     4,     4,     8,     3,   372,   374,     3,     8,
+       4,   577,   579,     4,   582,     4,     4,   586,   589,     4,
+       4,   593,   595,   597,   599,     3,     8,     3,     8,   613,
+       4,     3,     8,   226,   226,   205,     4,     4,     4,     4,
+       4,   245,     4,     4,     4,     4,     4,     4,   206,   206,
+     206,   206,   206,   206,   206,   206,   208,   207,   207,   207,
+     206,   206,     4,   208,   208,   208,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   206,     4,     4,     4,     4,
+       4,     4,   251,     4,   208,   289,     4,     4,     4,     4,
+       4,   206,   208,     4,     4,     4,   395,     4,   472,     4,
+     206,     4,   206,   206,   488,     4,     4,     4,     4,     4,
+       4,     4,   506,     4,     4,   206,     4,     4,     4,   208,
+     431,     4,   208,   208,   455,     4,     4,   370,   208,     4,
+       4,   206,     4,   206,   206,     4,     4,   208,   208,     4,
+       4,     4,     4,   574,   620,     4,   206,   611,     4,     7,
+       7,   226,   226,   226,   205,     7,     7,     7,     7,     5,
+     205,   165,   166,   167,   168,   208,   273,   205,   205,     5,
+       5,     5,   228,   230,   205,    97,    98,    99,   100,   408,
        5,     5,     5,     5,     7,     5,     5,     5,     7,     7,
-       7,     7,     7,   192,   192,     5,     5,   224,     5,     5,
-     192,   192,   192,   224,   192,     7,   192,   192,   192,   224,
-     224,   224,   192,   192,   192,   192,   192,   192,   192,   192,
-     192,   192,   192,   213,   192,   192,   192,   155,   156,   565,
-     157,   258,   192,   192,   192,     5,   213,   237,   597,   588,
-     273,    21,    26,    27,    28,    29,    30,    31,    32,    33,
+       7,     7,     7,   205,   205,     5,     5,   237,     5,     5,
+     205,   205,   205,   237,   205,     7,   205,   205,   205,   237,
+     237,   237,   205,   205,   205,   205,   205,   205,   205,   205,
+     205,   205,   205,   226,   205,   205,   205,   162,   163,   587,
+     164,   273,   205,   205,   205,     5,   226,   250,   619,   610,
+     288,    21,    26,    27,    28,    29,    30,    31,    32,    33,
       34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-     228,   288,   289,   290,   293,   295,   297,   299,   300,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,   313,
-     314,   316,   318,   288,     7,   284,   285,   286,     7,   366,
-     367,   368,     7,   401,   402,   403,     7,   425,   426,   427,
-       7,   391,   392,   393,   109,   192,   328,   329,   330,   331,
-     222,   110,   112,   330,   334,   335,   336,   337,   100,   322,
-     323,   324,     7,   506,   507,     7,   476,   477,   478,     7,
-     342,   343,   344,   119,   120,   121,   122,   123,   124,   356,
-     357,   358,   359,   360,   361,   362,   363,    21,   129,   130,
-     131,   132,   228,   302,   453,   455,   518,   519,   520,   523,
-     524,   526,   527,   135,   136,   228,   453,   455,   531,   532,
-     533,   535,   138,   139,   140,   192,   453,   455,   539,   540,
-     541,   542,   544,   545,   551,     7,   601,   602,   225,     7,
-     443,   444,   445,     7,   459,   460,   461,   114,   485,   501,
-     502,   284,     8,     8,     8,     8,   291,   294,   296,   298,
-       4,     4,     4,     4,     4,   312,     4,     4,   315,   317,
-     319,     4,     4,     4,     4,     3,     8,     8,   287,     6,
-       3,   369,     6,     3,   404,     6,     3,   428,     6,     3,
-     394,     6,     3,     3,     6,     6,     3,     6,   325,     3,
-       8,   508,     3,     6,   479,     6,     3,   345,     6,     3,
-       4,     4,     4,     4,     4,     4,     3,     8,   521,   525,
-       4,     4,     4,     3,     8,   534,   536,     3,     8,     4,
-     543,     4,   546,     3,     8,     8,   603,     3,     6,   192,
-     226,   227,   446,     6,     3,   462,     6,     3,   503,     8,
-       6,     4,     4,     4,     4,   193,   195,   193,   195,   193,
-       4,   193,   193,     4,     4,     4,   193,   193,   195,   193,
-     289,   288,   286,   372,   368,   407,   403,   431,   427,   228,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   253,   254,   255,   256,   259,   261,   263,   265,   300,
-     364,   376,   378,   380,   382,   384,   388,   395,   396,   423,
-     453,   455,   499,   393,   329,   335,     4,   323,   103,   104,
-     228,   300,   423,   453,   455,   509,   510,   511,   512,   513,
-     515,   507,   482,   478,   348,   344,   193,   193,   193,   193,
-     193,   193,   357,     4,     4,   193,   193,   193,   519,     4,
-       4,   532,   195,     4,   193,     4,   540,   166,   168,   169,
-     228,   300,   453,   455,   604,   605,   606,   607,   609,   602,
-       6,     3,   449,   445,   465,   461,     4,    22,    23,    24,
-      25,   292,   192,   192,   192,   192,   192,   192,   192,     8,
-       8,     8,     8,     3,     8,   192,   514,     4,     8,     3,
-       8,     8,   126,   127,   128,   522,   192,   192,   192,   192,
-     213,   610,     4,   608,     3,     8,   192,     8,     8,   192,
-     396,     4,   195,   511,     4,   193,     4,   605,   192,     5,
-     192,     7,   611,   612,   613,     3,     6,   167,   170,   171,
-     172,   173,   614,   615,   616,   618,   619,   620,   621,   612,
-     617,     4,     4,     4,   622,     3,     8,     4,   195,   193,
-     193,     4,   615,   192,   192
+      44,    45,    46,    47,   241,   303,   304,   305,   308,   310,
+     312,   314,   315,   317,   318,   319,   320,   321,   322,   324,
+     326,   327,   328,   329,   330,   331,   332,   334,   335,   337,
+     339,   303,     7,   299,   300,   301,     7,   388,   389,   390,
+       7,   423,   424,   425,     7,   447,   448,   449,     7,   413,
+     414,   415,   115,   205,   349,   350,   351,   352,   235,   116,
+     118,   351,   355,   356,   357,   358,   106,   343,   344,   345,
+       7,   528,   529,     7,   498,   499,   500,     7,   363,   364,
+     365,   125,   126,   127,   128,   129,   130,   131,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,    21,   136,   137,
+     138,   139,   241,   317,   475,   477,   540,   541,   542,   545,
+     546,   548,   549,   142,   143,   241,   475,   477,   553,   554,
+     555,   557,   145,   146,   147,   205,   475,   477,   561,   562,
+     563,   564,   566,   567,   573,     7,   623,   624,   238,     7,
+     465,   466,   467,     7,   481,   482,   483,   120,   507,   523,
+     524,   299,     8,     8,     8,     8,   306,   309,   311,   313,
+       4,     4,     4,     4,     4,     4,   323,   325,     4,   333,
+       4,     4,   336,   338,   340,     4,     4,     4,     4,     3,
+       8,     8,   302,     6,     3,   391,     6,     3,   426,     6,
+       3,   450,     6,     3,   416,     6,     3,     3,     6,     6,
+       3,     6,   346,     3,     8,   530,     3,     6,   501,     6,
+       3,   366,     6,     3,     4,     4,     4,     4,     4,     4,
+       4,     3,     8,   543,   547,     4,     4,     4,     3,     8,
+     556,   558,     3,     8,     4,   565,     4,   568,     3,     8,
+       8,   625,     3,     6,   205,   239,   240,   468,     6,     3,
+     484,     6,     3,   525,     8,     6,     4,     4,     4,     4,
+     206,   208,   206,   208,   208,   206,     4,     4,   206,     4,
+     206,   206,     4,     4,     4,   206,   206,   208,   206,   304,
+     303,   301,   394,   390,   429,   425,   453,   449,   241,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   268,   269,   270,   271,   274,   276,   278,   280,
+     315,   386,   398,   400,   402,   404,   406,   410,   417,   418,
+     445,   475,   477,   521,   415,   350,   356,     4,   344,   109,
+     110,   241,   315,   445,   475,   477,   531,   532,   533,   534,
+     535,   537,   529,   504,   500,   369,   365,   206,   206,   206,
+     206,   206,   206,   208,   378,     4,     4,   206,   206,   206,
+     541,     4,     4,   554,   208,     4,   206,     4,   562,   173,
+     175,   176,   184,   185,   186,   241,   315,   475,   477,   626,
+     627,   628,   629,   631,   633,   634,   635,   624,     6,     3,
+     471,   467,   487,   483,     4,    22,    23,    24,    25,   307,
+     205,   205,   205,   205,   205,   205,   205,   205,   205,     8,
+       8,     8,     8,     3,     8,   205,   536,     4,     8,     3,
+       8,     8,   133,   134,   135,   544,   205,   205,   205,   205,
+     226,   636,     4,   630,   632,     4,     4,     3,     8,   205,
+       8,     8,   205,   418,     4,   208,   533,     4,   206,     4,
+       4,   206,   206,   627,   205,     5,   205,   237,     7,   637,
+     638,   639,     3,     6,   174,   177,   178,   179,   180,   181,
+     182,   183,   640,   641,   642,   644,   645,   646,   647,   649,
+     650,   651,   638,   643,     4,     4,     4,   648,     4,     4,
+     652,     3,     8,     4,   208,   206,   206,     4,   208,   206,
+       4,   641,   205,   205,   205
   };
 
   const unsigned short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   196,   198,   197,   199,   197,   200,   197,   201,   197,
-     202,   197,   203,   197,   204,   197,   205,   197,   206,   197,
-     207,   197,   208,   197,   209,   197,   210,   197,   211,   197,
-     212,   197,   213,   213,   213,   213,   213,   213,   213,   214,
-     216,   215,   217,   218,   218,   219,   219,   221,   220,   222,
-     222,   223,   223,   225,   224,   226,   226,   227,   227,   228,
-     230,   229,   231,   231,   232,   232,   232,   232,   232,   232,
-     234,   233,   236,   235,   237,   237,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   240,   239,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   257,   256,   258,   258,   258,   258,   258,   260,
-     259,   262,   261,   264,   263,   266,   265,   268,   267,   270,
-     269,   272,   271,   273,   273,   274,   274,   274,   274,   274,
-     276,   275,   277,   279,   278,   281,   280,   283,   282,   284,
-     284,   285,   285,   287,   286,   288,   288,   289,   289,   289,
-     289,   289,   289,   289,   289,   289,   289,   289,   289,   289,
-     289,   289,   289,   289,   289,   289,   289,   289,   291,   290,
-     292,   292,   292,   292,   294,   293,   296,   295,   298,   297,
-     299,   301,   300,   302,   303,   304,   305,   306,   307,   308,
-     309,   310,   312,   311,   313,   315,   314,   317,   316,   319,
-     318,   321,   320,   322,   322,   323,   325,   324,   327,   326,
-     328,   328,   329,   329,   330,   331,   333,   332,   334,   334,
-     335,   335,   335,   336,   337,   339,   338,   341,   340,   342,
-     342,   343,   343,   345,   344,   347,   346,   348,   348,   348,
-     349,   349,   351,   350,   353,   352,   355,   354,   356,   356,
-     357,   357,   357,   357,   357,   357,   358,   359,   360,   361,
-     362,   363,   365,   364,   366,   366,   367,   367,   369,   368,
-     371,   370,   372,   372,   373,   373,   373,   373,   373,   373,
-     373,   373,   373,   373,   373,   373,   373,   373,   373,   373,
-     373,   373,   373,   373,   373,   373,   373,   373,   373,   373,
-     373,   373,   373,   373,   373,   373,   373,   373,   373,   375,
-     374,   377,   376,   379,   378,   381,   380,   383,   382,   385,
-     384,   386,   386,   386,   386,   387,   388,   390,   389,   391,
-     391,   392,   392,   394,   393,   395,   395,   396,   396,   396,
-     396,   396,   396,   396,   396,   396,   396,   396,   396,   396,
-     396,   396,   396,   396,   396,   396,   396,   396,   396,   396,
-     396,   396,   396,   396,   396,   396,   396,   396,   396,   398,
-     397,   400,   399,   401,   401,   402,   402,   404,   403,   406,
-     405,   407,   407,   408,   408,   409,   409,   409,   409,   409,
-     409,   409,   409,   409,   409,   410,   411,   412,   414,   413,
-     416,   415,   418,   417,   419,   421,   420,   422,   424,   423,
-     425,   425,   426,   426,   428,   427,   430,   429,   431,   431,
-     432,   432,   433,   433,   433,   433,   433,   433,   433,   433,
-     433,   434,   436,   435,   437,   438,   439,   440,   442,   441,
-     443,   443,   444,   444,   446,   445,   448,   447,   449,   449,
-     450,   450,   450,   450,   450,   450,   450,   452,   451,   454,
-     453,   456,   455,   458,   457,   459,   459,   460,   460,   462,
-     461,   464,   463,   465,   465,   466,   466,   466,   466,   466,
-     466,   466,   466,   466,   466,   466,   468,   467,   469,   471,
-     470,   472,   473,   475,   474,   476,   476,   477,   477,   479,
-     478,   481,   480,   482,   482,   483,   483,   484,   484,   484,
-     484,   484,   484,   484,   484,   484,   484,   484,   486,   485,
-     488,   487,   490,   489,   492,   491,   494,   493,   496,   495,
-     498,   497,   500,   499,   501,   501,   503,   502,   505,   504,
-     506,   506,   508,   507,   509,   509,   510,   510,   511,   511,
-     511,   511,   511,   511,   511,   512,   514,   513,   515,   517,
-     516,   518,   518,   519,   519,   519,   519,   519,   519,   519,
-     519,   519,   521,   520,   522,   522,   522,   523,   525,   524,
-     526,   527,   528,   530,   529,   531,   531,   532,   532,   532,
-     532,   532,   534,   533,   536,   535,   538,   537,   539,   539,
-     540,   540,   540,   540,   540,   540,   541,   543,   542,   544,
-     546,   545,   548,   547,   550,   549,   551,   551,   552,   552,
-     552,   552,   552,   552,   552,   552,   552,   552,   552,   552,
-     552,   552,   552,   552,   552,   552,   553,   555,   554,   557,
-     556,   558,   560,   559,   561,   562,   564,   563,   565,   565,
-     567,   566,   568,   569,   571,   570,   573,   572,   575,   574,
-     577,   576,   579,   578,   581,   580,   583,   582,   585,   584,
-     587,   586,   588,   588,   589,   589,   591,   590,   592,   594,
-     593,   596,   595,   597,   597,   598,   600,   599,   601,   601,
-     603,   602,   604,   604,   605,   605,   605,   605,   605,   605,
-     605,   606,   608,   607,   610,   609,   611,   611,   613,   612,
-     614,   614,   615,   615,   615,   615,   615,   617,   616,   618,
-     619,   620,   622,   621
+       0,   209,   211,   210,   212,   210,   213,   210,   214,   210,
+     215,   210,   216,   210,   217,   210,   218,   210,   219,   210,
+     220,   210,   221,   210,   222,   210,   223,   210,   224,   210,
+     225,   210,   226,   226,   226,   226,   226,   226,   226,   227,
+     229,   228,   230,   231,   231,   232,   232,   234,   233,   235,
+     235,   236,   236,   238,   237,   239,   239,   240,   240,   241,
+     243,   242,   244,   244,   245,   245,   245,   245,   245,   245,
+     247,   246,   249,   248,   250,   250,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   253,   252,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   272,   271,   273,   273,
+     273,   273,   273,   275,   274,   277,   276,   279,   278,   281,
+     280,   283,   282,   285,   284,   287,   286,   288,   288,   289,
+     289,   289,   289,   289,   291,   290,   292,   294,   293,   296,
+     295,   298,   297,   299,   299,   300,   300,   302,   301,   303,
+     303,   304,   304,   304,   304,   304,   304,   304,   304,   304,
+     304,   304,   304,   304,   304,   304,   304,   304,   304,   304,
+     304,   304,   304,   304,   304,   304,   306,   305,   307,   307,
+     307,   307,   309,   308,   311,   310,   313,   312,   314,   316,
+     315,   317,   318,   319,   320,   321,   323,   322,   325,   324,
+     326,   327,   328,   329,   330,   331,   333,   332,   334,   336,
+     335,   338,   337,   340,   339,   342,   341,   343,   343,   344,
+     346,   345,   348,   347,   349,   349,   350,   350,   351,   352,
+     354,   353,   355,   355,   356,   356,   356,   357,   358,   360,
+     359,   362,   361,   363,   363,   364,   364,   366,   365,   368,
+     367,   369,   369,   369,   370,   370,   372,   371,   374,   373,
+     376,   375,   377,   377,   378,   378,   378,   378,   378,   378,
+     378,   379,   380,   381,   382,   383,   384,   385,   387,   386,
+     388,   388,   389,   389,   391,   390,   393,   392,   394,   394,
+     395,   395,   395,   395,   395,   395,   395,   395,   395,   395,
+     395,   395,   395,   395,   395,   395,   395,   395,   395,   395,
+     395,   395,   395,   395,   395,   395,   395,   395,   395,   395,
+     395,   395,   395,   395,   395,   395,   395,   397,   396,   399,
+     398,   401,   400,   403,   402,   405,   404,   407,   406,   408,
+     408,   408,   408,   409,   410,   412,   411,   413,   413,   414,
+     414,   416,   415,   417,   417,   418,   418,   418,   418,   418,
+     418,   418,   418,   418,   418,   418,   418,   418,   418,   418,
+     418,   418,   418,   418,   418,   418,   418,   418,   418,   418,
+     418,   418,   418,   418,   418,   418,   418,   418,   418,   420,
+     419,   422,   421,   423,   423,   424,   424,   426,   425,   428,
+     427,   429,   429,   430,   430,   431,   431,   431,   431,   431,
+     431,   431,   431,   431,   431,   432,   433,   434,   436,   435,
+     438,   437,   440,   439,   441,   443,   442,   444,   446,   445,
+     447,   447,   448,   448,   450,   449,   452,   451,   453,   453,
+     454,   454,   455,   455,   455,   455,   455,   455,   455,   455,
+     455,   456,   458,   457,   459,   460,   461,   462,   464,   463,
+     465,   465,   466,   466,   468,   467,   470,   469,   471,   471,
+     472,   472,   472,   472,   472,   472,   472,   474,   473,   476,
+     475,   478,   477,   480,   479,   481,   481,   482,   482,   484,
+     483,   486,   485,   487,   487,   488,   488,   488,   488,   488,
+     488,   488,   488,   488,   488,   488,   490,   489,   491,   493,
+     492,   494,   495,   497,   496,   498,   498,   499,   499,   501,
+     500,   503,   502,   504,   504,   505,   505,   506,   506,   506,
+     506,   506,   506,   506,   506,   506,   506,   506,   508,   507,
+     510,   509,   512,   511,   514,   513,   516,   515,   518,   517,
+     520,   519,   522,   521,   523,   523,   525,   524,   527,   526,
+     528,   528,   530,   529,   531,   531,   532,   532,   533,   533,
+     533,   533,   533,   533,   533,   534,   536,   535,   537,   539,
+     538,   540,   540,   541,   541,   541,   541,   541,   541,   541,
+     541,   541,   543,   542,   544,   544,   544,   545,   547,   546,
+     548,   549,   550,   552,   551,   553,   553,   554,   554,   554,
+     554,   554,   556,   555,   558,   557,   560,   559,   561,   561,
+     562,   562,   562,   562,   562,   562,   563,   565,   564,   566,
+     568,   567,   570,   569,   572,   571,   573,   573,   574,   574,
+     574,   574,   574,   574,   574,   574,   574,   574,   574,   574,
+     574,   574,   574,   574,   574,   574,   575,   577,   576,   579,
+     578,   580,   582,   581,   583,   584,   586,   585,   587,   587,
+     589,   588,   590,   591,   593,   592,   595,   594,   597,   596,
+     599,   598,   601,   600,   603,   602,   605,   604,   607,   606,
+     609,   608,   610,   610,   611,   611,   613,   612,   614,   616,
+     615,   618,   617,   619,   619,   620,   622,   621,   623,   623,
+     625,   624,   626,   626,   627,   627,   627,   627,   627,   627,
+     627,   627,   627,   627,   628,   630,   629,   632,   631,   633,
+     634,   636,   635,   637,   637,   639,   638,   640,   640,   641,
+     641,   641,   641,   641,   641,   641,   641,   643,   642,   644,
+     645,   646,   648,   647,   649,   650,   652,   651
   };
 
   const unsigned char
@@ -5148,32 +5338,34 @@ namespace isc { namespace dhcp {
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     3,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     0,     4,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     0,     4,     1,     3,     1,     1,     1,     1,     1,
-       0,     4,     3,     0,     6,     0,     6,     0,     6,     0,
-       1,     1,     3,     0,     4,     1,     3,     1,     1,     1,
+       3,     3,     3,     3,     3,     3,     0,     4,     1,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     6,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     0,     4,     3,     0,     6,     0,
+       6,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       3,     0,     4,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     0,     4,     3,     0,     4,     0,     4,     0,
-       4,     0,     6,     1,     3,     1,     0,     4,     0,     6,
-       1,     3,     1,     1,     1,     1,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     0,     6,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     4,     3,     0,
+       4,     3,     3,     3,     3,     3,     0,     4,     0,     4,
+       3,     3,     3,     3,     3,     3,     0,     4,     3,     0,
+       4,     0,     4,     0,     4,     0,     6,     1,     3,     1,
+       0,     4,     0,     6,     1,     3,     1,     1,     1,     1,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     0,
+       6,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     0,     4,     0,     4,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     3,     3,     3,     3,     3,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     1,     1,     1,     1,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     1,
+       1,     1,     1,     3,     3,     0,     6,     0,     1,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
@@ -5210,9 +5402,10 @@ namespace isc { namespace dhcp {
        0,     4,     1,     3,     1,     1,     0,     6,     3,     0,
        6,     0,     4,     1,     3,     1,     0,     6,     1,     3,
        0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     0,     4,     3,
-       3,     3,     0,     4
+       1,     1,     1,     1,     3,     0,     4,     0,     4,     3,
+       3,     0,     6,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
+       3,     3,     0,     4,     3,     3,     0,     4
   };
 
 
@@ -5230,15 +5423,18 @@ namespace isc { namespace dhcp {
   "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
   "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
   "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"max-reconnect-tries\"",
-  "\"reconnect-wait-time\"", "\"keyspace\"", "\"consistency\"",
-  "\"serial-consistency\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"preferred-lifetime\"",
-  "\"min-preferred-lifetime\"", "\"max-preferred-lifetime\"",
-  "\"valid-lifetime\"", "\"min-valid-lifetime\"", "\"max-valid-lifetime\"",
-  "\"renew-timer\"", "\"rebind-timer\"", "\"calculate-tee-times\"",
-  "\"t1-percent\"", "\"t2-percent\"", "\"decline-probation-period\"",
-  "\"server-tag\"", "\"ddns-send-updates\"", "\"ddns-override-no-update\"",
+  "\"write-behind-cache\"", "\"write-back-latency\"", "\"cache-journal\"",
+  "\"read-replicas\"", "\"connect-timeout\"", "\"contact-points\"",
+  "\"max-reconnect-tries\"", "\"reconnect-wait-time\"", "\"keyspace\"",
+  "\"consistency\"", "\"serial-consistency\"", "\"request-timeout\"",
+  "\"tcp-keepalive\"", "\"tcp-nodelay\"", "\"max-row-errors\"",
+  "\"preferred-lifetime\"", "\"min-preferred-lifetime\"",
+  "\"max-preferred-lifetime\"", "\"valid-lifetime\"",
+  "\"min-valid-lifetime\"", "\"max-valid-lifetime\"", "\"renew-timer\"",
+  "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
+  "\"t2-percent\"", "\"cache-threshold\"", "\"cache-max-age\"",
+  "\"decline-probation-period\"", "\"server-tag\"",
+  "\"ddns-send-updates\"", "\"ddns-override-no-update\"",
   "\"ddns-override-client-update\"", "\"ddns-replace-client-name\"",
   "\"ddns-generated-prefix\"", "\"ddns-qualifying-suffix\"", "\"subnet6\"",
   "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
@@ -5259,11 +5455,12 @@ namespace isc { namespace dhcp {
   "\"expired-leases-processing\"", "\"reclaim-timer-wait-time\"",
   "\"flush-reclaimed-timer-wait-time\"", "\"hold-reclaimed-time\"",
   "\"max-reclaim-leases\"", "\"max-reclaim-time\"",
-  "\"unwarned-reclaim-cycles\"", "\"server-id\"", "\"LLT\"", "\"EN\"",
-  "\"LL\"", "\"identifier\"", "\"htype\"", "\"time\"", "\"enterprise-id\"",
-  "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
-  "\"socket-name\"", "\"dhcp-queue-control\"", "\"enable-queue\"",
-  "\"queue-type\"", "\"capacity\"", "\"dhcp-ddns\"", "\"enable-updates\"",
+  "\"unwarned-reclaim-cycles\"", "\"background-reclamation\"",
+  "\"server-id\"", "\"LLT\"", "\"EN\"", "\"LL\"", "\"identifier\"",
+  "\"htype\"", "\"time\"", "\"enterprise-id\"", "\"dhcp4o6-port\"",
+  "\"control-socket\"", "\"socket-type\"", "\"socket-name\"",
+  "\"dhcp-queue-control\"", "\"enable-queue\"", "\"queue-type\"",
+  "\"capacity\"", "\"dhcp-ddns\"", "\"enable-updates\"",
   "\"qualifying-suffix\"", "\"server-ip\"", "\"server-port\"",
   "\"sender-ip\"", "\"sender-port\"", "\"max-queue-size\"",
   "\"ncr-protocol\"", "\"ncr-format\"", "\"override-no-update\"",
@@ -5273,6 +5470,8 @@ namespace isc { namespace dhcp {
   "\"hostname-char-set\"", "\"hostname-char-replacement\"", "\"Logging\"",
   "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
   "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"pattern\"",
+  "\"async\"", "\"async-queue-size\"", "\"async-overflow\"",
+  "\"rate-limited-messages\"", "\"rate-limit\"", "\"rate-limit-interval\"",
   "\"Dhcp4\"", "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON",
   "TOPLEVEL_DHCP6", "SUB_DHCP6", "SUB_INTERFACES6", "SUB_SUBNET6",
   "SUB_POOL6", "SUB_PD_POOL", "SUB_RESERVATION", "SUB_OPTION_DEFS",
@@ -5290,7 +5489,8 @@ namespace isc { namespace dhcp {
   "preferred_lifetime", "min_preferred_lifetime", "max_preferred_lifetime",
   "valid_lifetime", "min_valid_lifetime", "max_valid_lifetime",
   "renew_timer", "rebind_timer", "calculate_tee_times", "t1_percent",
-  "t2_percent", "decline_probation_period", "ddns_send_updates",
+  "t2_percent", "cache_threshold", "cache_max_age",
+  "decline_probation_period", "ddns_send_updates",
   "ddns_override_no_update", "ddns_override_client_update",
   "ddns_replace_client_name", "$@23", "ddns_replace_client_name_value",
   "ddns_generated_prefix", "$@24", "ddns_qualifying_suffix", "$@25",
@@ -5302,168 +5502,176 @@ namespace isc { namespace dhcp {
   "not_empty_database_list", "database", "$@35", "database_map_params",
   "database_map_param", "database_type", "$@36", "db_type", "user", "$@37",
   "password", "$@38", "host", "$@39", "port", "name", "$@40", "persist",
-  "lfc_interval", "readonly", "connect_timeout", "reconnect_wait_time",
-  "max_row_errors", "request_timeout", "tcp_keepalive", "tcp_nodelay",
-  "contact_points", "$@41", "max_reconnect_tries", "keyspace", "$@42",
-  "consistency", "$@43", "serial_consistency", "$@44", "sanity_checks",
-  "$@45", "sanity_checks_params", "sanity_checks_param", "lease_checks",
-  "$@46", "mac_sources", "$@47", "mac_sources_list", "mac_sources_value",
-  "duid_id", "string_id", "host_reservation_identifiers", "$@48",
+  "lfc_interval", "readonly", "write_behind_cache", "write_back_latency",
+  "cache_journal", "$@41", "read_replicas", "$@42", "connect_timeout",
+  "reconnect_wait_time", "max_row_errors", "request_timeout",
+  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@43",
+  "max_reconnect_tries", "keyspace", "$@44", "consistency", "$@45",
+  "serial_consistency", "$@46", "sanity_checks", "$@47",
+  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@48",
+  "mac_sources", "$@49", "mac_sources_list", "mac_sources_value",
+  "duid_id", "string_id", "host_reservation_identifiers", "$@50",
   "host_reservation_identifiers_list", "host_reservation_identifier",
-  "hw_address_id", "flex_id", "relay_supplied_options", "$@49",
-  "hooks_libraries", "$@50", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@51",
-  "sub_hooks_library", "$@52", "hooks_params", "hooks_param", "library",
-  "$@53", "parameters", "$@54", "expired_leases_processing", "$@55",
+  "hw_address_id", "flex_id", "relay_supplied_options", "$@51",
+  "hooks_libraries", "$@52", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@53",
+  "sub_hooks_library", "$@54", "hooks_params", "hooks_param", "library",
+  "$@55", "parameters", "$@56", "expired_leases_processing", "$@57",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet6_list", "$@56",
-  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@57",
-  "sub_subnet6", "$@58", "subnet6_params", "subnet6_param", "subnet",
-  "$@59", "interface", "$@60", "interface_id", "$@61", "client_class",
-  "$@62", "require_client_classes", "$@63", "reservation_mode", "$@64",
-  "hr_mode", "id", "rapid_commit", "shared_networks", "$@65",
-  "shared_networks_content", "shared_networks_list", "shared_network",
-  "$@66", "shared_network_params", "shared_network_param",
-  "option_def_list", "$@67", "sub_option_def_list", "$@68",
-  "option_def_list_content", "not_empty_option_def_list",
-  "option_def_entry", "$@69", "sub_option_def", "$@70",
-  "option_def_params", "not_empty_option_def_params", "option_def_param",
-  "option_def_name", "code", "option_def_code", "option_def_type", "$@71",
-  "option_def_record_types", "$@72", "space", "$@73", "option_def_space",
-  "option_def_encapsulate", "$@74", "option_def_array", "option_data_list",
-  "$@75", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@76", "sub_option_data", "$@77",
+  "unwarned_reclaim_cycles", "background_reclamation", "subnet6_list",
+  "$@58", "subnet6_list_content", "not_empty_subnet6_list", "subnet6",
+  "$@59", "sub_subnet6", "$@60", "subnet6_params", "subnet6_param",
+  "subnet", "$@61", "interface", "$@62", "interface_id", "$@63",
+  "client_class", "$@64", "require_client_classes", "$@65",
+  "reservation_mode", "$@66", "hr_mode", "id", "rapid_commit",
+  "shared_networks", "$@67", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@68",
+  "shared_network_params", "shared_network_param", "option_def_list",
+  "$@69", "sub_option_def_list", "$@70", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@71",
+  "sub_option_def", "$@72", "option_def_params",
+  "not_empty_option_def_params", "option_def_param", "option_def_name",
+  "code", "option_def_code", "option_def_type", "$@73",
+  "option_def_record_types", "$@74", "space", "$@75", "option_def_space",
+  "option_def_encapsulate", "$@76", "option_def_array", "option_data_list",
+  "$@77", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@78", "sub_option_data", "$@79",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@78",
+  "option_data_param", "option_data_name", "option_data_data", "$@80",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@79", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@80", "sub_pool6", "$@81",
-  "pool_params", "pool_param", "pool_entry", "$@82", "user_context",
-  "$@83", "comment", "$@84", "pd_pools_list", "$@85",
+  "option_data_always_send", "pools_list", "$@81", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@82", "sub_pool6", "$@83",
+  "pool_params", "pool_param", "pool_entry", "$@84", "user_context",
+  "$@85", "comment", "$@86", "pd_pools_list", "$@87",
   "pd_pools_list_content", "not_empty_pd_pools_list", "pd_pool_entry",
-  "$@86", "sub_pd_pool", "$@87", "pd_pool_params", "pd_pool_param",
-  "pd_prefix", "$@88", "pd_prefix_len", "excluded_prefix", "$@89",
-  "excluded_prefix_len", "pd_delegated_len", "reservations", "$@90",
+  "$@88", "sub_pd_pool", "$@89", "pd_pool_params", "pd_pool_param",
+  "pd_prefix", "$@90", "pd_prefix_len", "excluded_prefix", "$@91",
+  "excluded_prefix_len", "pd_delegated_len", "reservations", "$@92",
   "reservations_list", "not_empty_reservations_list", "reservation",
-  "$@91", "sub_reservation", "$@92", "reservation_params",
+  "$@93", "sub_reservation", "$@94", "reservation_params",
   "not_empty_reservation_params", "reservation_param", "ip_addresses",
-  "$@93", "prefixes", "$@94", "duid", "$@95", "hw_address", "$@96",
-  "hostname", "$@97", "flex_id_value", "$@98",
-  "reservation_client_classes", "$@99", "relay", "$@100", "relay_map",
-  "ip_address", "$@101", "client_classes", "$@102", "client_classes_list",
-  "client_class_entry", "$@103", "client_class_params",
+  "$@95", "prefixes", "$@96", "duid", "$@97", "hw_address", "$@98",
+  "hostname", "$@99", "flex_id_value", "$@100",
+  "reservation_client_classes", "$@101", "relay", "$@102", "relay_map",
+  "ip_address", "$@103", "client_classes", "$@104", "client_classes_list",
+  "client_class_entry", "$@105", "client_class_params",
   "not_empty_client_class_params", "client_class_param",
-  "client_class_name", "client_class_test", "$@104", "only_if_required",
-  "server_id", "$@105", "server_id_params", "server_id_param",
-  "server_id_type", "$@106", "duid_type", "htype", "identifier", "$@107",
-  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@108",
-  "control_socket_params", "control_socket_param", "socket_type", "$@109",
-  "socket_name", "$@110", "dhcp_queue_control", "$@111",
+  "client_class_name", "client_class_test", "$@106", "only_if_required",
+  "server_id", "$@107", "server_id_params", "server_id_param",
+  "server_id_type", "$@108", "duid_type", "htype", "identifier", "$@109",
+  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@110",
+  "control_socket_params", "control_socket_param", "socket_type", "$@111",
+  "socket_name", "$@112", "dhcp_queue_control", "$@113",
   "queue_control_params", "queue_control_param", "enable_queue",
-  "queue_type", "$@112", "capacity", "arbitrary_map_entry", "$@113",
-  "dhcp_ddns", "$@114", "sub_dhcp_ddns", "$@115", "dhcp_ddns_params",
-  "dhcp_ddns_param", "enable_updates", "qualifying_suffix", "$@116",
-  "server_ip", "$@117", "server_port", "sender_ip", "$@118", "sender_port",
-  "max_queue_size", "ncr_protocol", "$@119", "ncr_protocol_value",
-  "ncr_format", "$@120", "dep_override_no_update",
-  "dep_override_client_update", "dep_replace_client_name", "$@121",
-  "dep_generated_prefix", "$@122", "dep_hostname_char_set", "$@123",
-  "dep_hostname_char_replacement", "$@124", "dhcp4_json_object", "$@125",
-  "dhcpddns_json_object", "$@126", "control_agent_json_object", "$@127",
-  "config_control", "$@128", "sub_config_control", "$@129",
+  "queue_type", "$@114", "capacity", "arbitrary_map_entry", "$@115",
+  "dhcp_ddns", "$@116", "sub_dhcp_ddns", "$@117", "dhcp_ddns_params",
+  "dhcp_ddns_param", "enable_updates", "qualifying_suffix", "$@118",
+  "server_ip", "$@119", "server_port", "sender_ip", "$@120", "sender_port",
+  "max_queue_size", "ncr_protocol", "$@121", "ncr_protocol_value",
+  "ncr_format", "$@122", "dep_override_no_update",
+  "dep_override_client_update", "dep_replace_client_name", "$@123",
+  "dep_generated_prefix", "$@124", "dep_hostname_char_set", "$@125",
+  "dep_hostname_char_replacement", "$@126", "dhcp4_json_object", "$@127",
+  "dhcpddns_json_object", "$@128", "control_agent_json_object", "$@129",
+  "config_control", "$@130", "sub_config_control", "$@131",
   "config_control_params", "config_control_param", "config_databases",
-  "$@130", "config_fetch_wait_time", "logging_object", "$@131",
-  "sub_logging", "$@132", "logging_params", "logging_param", "loggers",
-  "$@133", "loggers_entries", "logger_entry", "$@134", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@135", "output_options_list",
-  "$@136", "output_options_list_content", "output_entry", "$@137",
-  "output_params_list", "output_params", "output", "$@138", "flush",
-  "maxsize", "maxver", "pattern", "$@139", YY_NULLPTR
+  "$@132", "config_fetch_wait_time", "logging_object", "$@133",
+  "sub_logging", "$@134", "logging_params", "logging_param", "loggers",
+  "$@135", "loggers_entries", "logger_entry", "$@136", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@137",
+  "rate_limited_messages", "$@138", "rate_limit", "rate_limit_interval",
+  "output_options_list", "$@139", "output_options_list_content",
+  "output_entry", "$@140", "output_params_list", "output_params", "output",
+  "$@141", "flush", "maxsize", "maxver", "pattern", "$@142", "async",
+  "async_queue_size", "async_overflow", "$@143", YY_NULLPTR
   };
 
 #if PARSER6_DEBUG
   const unsigned short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   280,   280,   280,   281,   281,   282,   282,   283,   283,
-     284,   284,   285,   285,   286,   286,   287,   287,   288,   288,
-     289,   289,   290,   290,   291,   291,   292,   292,   293,   293,
-     294,   294,   302,   303,   304,   305,   306,   307,   308,   311,
-     316,   316,   327,   330,   331,   334,   338,   345,   345,   352,
-     353,   356,   360,   367,   367,   374,   375,   378,   382,   393,
-     403,   403,   418,   419,   423,   424,   425,   426,   427,   428,
-     431,   431,   446,   446,   455,   456,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   512,   512,   520,   525,   530,
-     535,   540,   545,   550,   555,   560,   565,   570,   575,   580,
-     585,   590,   595,   595,   603,   606,   609,   612,   615,   621,
-     621,   629,   629,   637,   637,   645,   645,   653,   653,   661,
-     661,   672,   672,   681,   682,   685,   686,   687,   688,   689,
-     692,   692,   702,   708,   708,   720,   720,   732,   732,   742,
-     743,   746,   747,   750,   750,   760,   761,   764,   765,   766,
-     767,   768,   769,   770,   771,   772,   773,   774,   775,   776,
-     777,   778,   779,   780,   781,   782,   783,   784,   787,   787,
-     794,   795,   796,   797,   800,   800,   808,   808,   816,   816,
-     824,   829,   829,   837,   842,   847,   852,   857,   862,   867,
-     872,   877,   882,   882,   890,   895,   895,   903,   903,   911,
-     911,   919,   919,   929,   930,   932,   934,   934,   952,   952,
-     962,   963,   966,   967,   970,   975,   980,   980,   990,   991,
-     994,   995,   996,   999,  1004,  1011,  1011,  1021,  1021,  1031,
-    1032,  1035,  1036,  1039,  1039,  1049,  1049,  1059,  1060,  1061,
-    1064,  1065,  1068,  1068,  1076,  1076,  1084,  1084,  1095,  1096,
-    1099,  1100,  1101,  1102,  1103,  1104,  1107,  1112,  1117,  1122,
-    1127,  1132,  1140,  1140,  1153,  1154,  1157,  1158,  1165,  1165,
-    1191,  1191,  1202,  1203,  1207,  1208,  1209,  1210,  1211,  1212,
-    1213,  1214,  1215,  1216,  1217,  1218,  1219,  1220,  1221,  1222,
-    1223,  1224,  1225,  1226,  1227,  1228,  1229,  1230,  1231,  1232,
-    1233,  1234,  1235,  1236,  1237,  1238,  1239,  1240,  1241,  1244,
-    1244,  1252,  1252,  1260,  1260,  1268,  1268,  1276,  1276,  1286,
-    1286,  1293,  1294,  1295,  1296,  1299,  1304,  1312,  1312,  1323,
-    1324,  1328,  1329,  1332,  1332,  1340,  1341,  1344,  1345,  1346,
-    1347,  1348,  1349,  1350,  1351,  1352,  1353,  1354,  1355,  1356,
-    1357,  1358,  1359,  1360,  1361,  1362,  1363,  1364,  1365,  1366,
-    1367,  1368,  1369,  1370,  1371,  1372,  1373,  1374,  1375,  1382,
-    1382,  1395,  1395,  1404,  1405,  1408,  1409,  1414,  1414,  1429,
-    1429,  1443,  1444,  1447,  1448,  1451,  1452,  1453,  1454,  1455,
-    1456,  1457,  1458,  1459,  1460,  1463,  1465,  1470,  1472,  1472,
-    1480,  1480,  1488,  1488,  1496,  1498,  1498,  1506,  1515,  1515,
-    1527,  1528,  1533,  1534,  1539,  1539,  1551,  1551,  1563,  1564,
-    1569,  1570,  1575,  1576,  1577,  1578,  1579,  1580,  1581,  1582,
-    1583,  1586,  1588,  1588,  1596,  1598,  1600,  1605,  1613,  1613,
-    1625,  1626,  1629,  1630,  1633,  1633,  1643,  1643,  1652,  1653,
-    1656,  1657,  1658,  1659,  1660,  1661,  1662,  1665,  1665,  1673,
-    1673,  1698,  1698,  1728,  1728,  1740,  1741,  1744,  1745,  1748,
-    1748,  1760,  1760,  1772,  1773,  1776,  1777,  1778,  1779,  1780,
-    1781,  1782,  1783,  1784,  1785,  1786,  1789,  1789,  1797,  1802,
-    1802,  1810,  1815,  1823,  1823,  1833,  1834,  1837,  1838,  1841,
-    1841,  1850,  1850,  1859,  1860,  1863,  1864,  1868,  1869,  1870,
-    1871,  1872,  1873,  1874,  1875,  1876,  1877,  1878,  1881,  1881,
-    1891,  1891,  1901,  1901,  1909,  1909,  1917,  1917,  1925,  1925,
-    1933,  1933,  1946,  1946,  1956,  1957,  1960,  1960,  1971,  1971,
-    1981,  1982,  1985,  1985,  1995,  1996,  1999,  2000,  2003,  2004,
-    2005,  2006,  2007,  2008,  2009,  2012,  2014,  2014,  2022,  2030,
-    2030,  2042,  2043,  2046,  2047,  2048,  2049,  2050,  2051,  2052,
-    2053,  2054,  2057,  2057,  2064,  2065,  2066,  2069,  2074,  2074,
-    2082,  2087,  2094,  2101,  2101,  2111,  2112,  2115,  2116,  2117,
-    2118,  2119,  2122,  2122,  2130,  2130,  2140,  2140,  2152,  2153,
-    2156,  2157,  2158,  2159,  2160,  2161,  2164,  2169,  2169,  2177,
-    2182,  2182,  2191,  2191,  2203,  2203,  2213,  2214,  2217,  2218,
-    2219,  2220,  2221,  2222,  2223,  2224,  2225,  2226,  2227,  2228,
-    2229,  2230,  2231,  2232,  2233,  2234,  2237,  2242,  2242,  2250,
-    2250,  2258,  2263,  2263,  2271,  2276,  2281,  2281,  2289,  2290,
-    2293,  2293,  2302,  2308,  2314,  2314,  2322,  2322,  2331,  2331,
-    2340,  2340,  2350,  2350,  2357,  2357,  2364,  2364,  2373,  2373,
-    2384,  2384,  2394,  2395,  2399,  2400,  2403,  2403,  2413,  2423,
-    2423,  2433,  2433,  2444,  2445,  2449,  2453,  2453,  2465,  2466,
-    2470,  2470,  2478,  2479,  2482,  2483,  2484,  2485,  2486,  2487,
-    2488,  2491,  2496,  2496,  2504,  2504,  2514,  2515,  2518,  2518,
-    2526,  2527,  2530,  2531,  2532,  2533,  2534,  2537,  2537,  2545,
-    2550,  2555,  2560,  2560
+       0,   293,   293,   293,   294,   294,   295,   295,   296,   296,
+     297,   297,   298,   298,   299,   299,   300,   300,   301,   301,
+     302,   302,   303,   303,   304,   304,   305,   305,   306,   306,
+     307,   307,   315,   316,   317,   318,   319,   320,   321,   324,
+     329,   329,   340,   343,   344,   347,   351,   358,   358,   365,
+     366,   369,   373,   380,   380,   387,   388,   391,   395,   406,
+     416,   416,   431,   432,   436,   437,   438,   439,   440,   441,
+     444,   444,   459,   459,   468,   469,   474,   475,   476,   477,
+     478,   479,   480,   481,   482,   483,   484,   485,   486,   487,
+     488,   489,   490,   491,   492,   493,   494,   495,   496,   497,
+     498,   499,   500,   501,   502,   503,   504,   505,   506,   507,
+     508,   509,   510,   511,   512,   513,   514,   515,   516,   517,
+     518,   519,   520,   521,   522,   523,   524,   527,   527,   535,
+     540,   545,   550,   555,   560,   565,   570,   575,   580,   585,
+     590,   595,   600,   605,   610,   615,   620,   620,   628,   631,
+     634,   637,   640,   646,   646,   654,   654,   662,   662,   670,
+     670,   678,   678,   686,   686,   697,   697,   706,   707,   710,
+     711,   712,   713,   714,   717,   717,   727,   733,   733,   745,
+     745,   757,   757,   767,   768,   771,   772,   775,   775,   785,
+     786,   789,   790,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,   801,   802,   803,   804,   805,   806,   807,
+     808,   809,   810,   811,   812,   813,   816,   816,   823,   824,
+     825,   826,   829,   829,   837,   837,   845,   845,   853,   858,
+     858,   866,   871,   876,   881,   886,   891,   891,   899,   899,
+     907,   912,   917,   922,   927,   932,   937,   937,   945,   950,
+     950,   958,   958,   966,   966,   974,   974,   984,   985,   987,
+     989,   989,  1007,  1007,  1017,  1018,  1021,  1022,  1025,  1030,
+    1035,  1035,  1045,  1046,  1049,  1050,  1051,  1054,  1059,  1066,
+    1066,  1076,  1076,  1086,  1087,  1090,  1091,  1094,  1094,  1104,
+    1104,  1114,  1115,  1116,  1119,  1120,  1123,  1123,  1131,  1131,
+    1139,  1139,  1150,  1151,  1154,  1155,  1156,  1157,  1158,  1159,
+    1160,  1163,  1168,  1173,  1178,  1183,  1188,  1193,  1201,  1201,
+    1214,  1215,  1218,  1219,  1226,  1226,  1252,  1252,  1263,  1264,
+    1268,  1269,  1270,  1271,  1272,  1273,  1274,  1275,  1276,  1277,
+    1278,  1279,  1280,  1281,  1282,  1283,  1284,  1285,  1286,  1287,
+    1288,  1289,  1290,  1291,  1292,  1293,  1294,  1295,  1296,  1297,
+    1298,  1299,  1300,  1301,  1302,  1303,  1304,  1307,  1307,  1315,
+    1315,  1323,  1323,  1331,  1331,  1339,  1339,  1349,  1349,  1356,
+    1357,  1358,  1359,  1362,  1367,  1375,  1375,  1386,  1387,  1391,
+    1392,  1395,  1395,  1403,  1404,  1407,  1408,  1409,  1410,  1411,
+    1412,  1413,  1414,  1415,  1416,  1417,  1418,  1419,  1420,  1421,
+    1422,  1423,  1424,  1425,  1426,  1427,  1428,  1429,  1430,  1431,
+    1432,  1433,  1434,  1435,  1436,  1437,  1438,  1439,  1440,  1447,
+    1447,  1460,  1460,  1469,  1470,  1473,  1474,  1479,  1479,  1494,
+    1494,  1508,  1509,  1512,  1513,  1516,  1517,  1518,  1519,  1520,
+    1521,  1522,  1523,  1524,  1525,  1528,  1530,  1535,  1537,  1537,
+    1545,  1545,  1553,  1553,  1561,  1563,  1563,  1571,  1580,  1580,
+    1592,  1593,  1598,  1599,  1604,  1604,  1616,  1616,  1628,  1629,
+    1634,  1635,  1640,  1641,  1642,  1643,  1644,  1645,  1646,  1647,
+    1648,  1651,  1653,  1653,  1661,  1663,  1665,  1670,  1678,  1678,
+    1690,  1691,  1694,  1695,  1698,  1698,  1708,  1708,  1717,  1718,
+    1721,  1722,  1723,  1724,  1725,  1726,  1727,  1730,  1730,  1738,
+    1738,  1763,  1763,  1793,  1793,  1805,  1806,  1809,  1810,  1813,
+    1813,  1825,  1825,  1837,  1838,  1841,  1842,  1843,  1844,  1845,
+    1846,  1847,  1848,  1849,  1850,  1851,  1854,  1854,  1862,  1867,
+    1867,  1875,  1880,  1888,  1888,  1898,  1899,  1902,  1903,  1906,
+    1906,  1915,  1915,  1924,  1925,  1928,  1929,  1933,  1934,  1935,
+    1936,  1937,  1938,  1939,  1940,  1941,  1942,  1943,  1946,  1946,
+    1956,  1956,  1966,  1966,  1974,  1974,  1982,  1982,  1990,  1990,
+    1998,  1998,  2011,  2011,  2021,  2022,  2025,  2025,  2036,  2036,
+    2046,  2047,  2050,  2050,  2060,  2061,  2064,  2065,  2068,  2069,
+    2070,  2071,  2072,  2073,  2074,  2077,  2079,  2079,  2087,  2095,
+    2095,  2107,  2108,  2111,  2112,  2113,  2114,  2115,  2116,  2117,
+    2118,  2119,  2122,  2122,  2129,  2130,  2131,  2134,  2139,  2139,
+    2147,  2152,  2159,  2166,  2166,  2176,  2177,  2180,  2181,  2182,
+    2183,  2184,  2187,  2187,  2195,  2195,  2205,  2205,  2217,  2218,
+    2221,  2222,  2223,  2224,  2225,  2226,  2229,  2234,  2234,  2242,
+    2247,  2247,  2256,  2256,  2268,  2268,  2278,  2279,  2282,  2283,
+    2284,  2285,  2286,  2287,  2288,  2289,  2290,  2291,  2292,  2293,
+    2294,  2295,  2296,  2297,  2298,  2299,  2302,  2307,  2307,  2315,
+    2315,  2323,  2328,  2328,  2336,  2341,  2346,  2346,  2354,  2355,
+    2358,  2358,  2367,  2373,  2379,  2379,  2387,  2387,  2396,  2396,
+    2405,  2405,  2415,  2415,  2422,  2422,  2429,  2429,  2438,  2438,
+    2449,  2449,  2459,  2460,  2464,  2465,  2468,  2468,  2478,  2488,
+    2488,  2498,  2498,  2509,  2510,  2514,  2518,  2518,  2530,  2531,
+    2535,  2535,  2543,  2544,  2547,  2548,  2549,  2550,  2551,  2552,
+    2553,  2554,  2555,  2556,  2559,  2564,  2564,  2572,  2572,  2582,
+    2587,  2592,  2592,  2602,  2603,  2606,  2606,  2614,  2615,  2618,
+    2619,  2620,  2621,  2622,  2623,  2624,  2625,  2628,  2628,  2636,
+    2641,  2646,  2651,  2651,  2659,  2664,  2669,  2669
   };
 
   // Print the state stack on the debug stream.
@@ -5498,7 +5706,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 5502 "dhcp6_parser.cc"
+#line 5710 "dhcp6_parser.cc"
 
 #line 2568 "dhcp6_parser.yy"
 
@@ -482,169 +482,182 @@ namespace isc { namespace dhcp {
         TOKEN_PERSIST = 285,
         TOKEN_LFC_INTERVAL = 286,
         TOKEN_READONLY = 287,
-        TOKEN_CONNECT_TIMEOUT = 288,
-        TOKEN_CONTACT_POINTS = 289,
-        TOKEN_MAX_RECONNECT_TRIES = 290,
-        TOKEN_RECONNECT_WAIT_TIME = 291,
-        TOKEN_KEYSPACE = 292,
-        TOKEN_CONSISTENCY = 293,
-        TOKEN_SERIAL_CONSISTENCY = 294,
-        TOKEN_REQUEST_TIMEOUT = 295,
-        TOKEN_TCP_KEEPALIVE = 296,
-        TOKEN_TCP_NODELAY = 297,
-        TOKEN_MAX_ROW_ERRORS = 298,
-        TOKEN_PREFERRED_LIFETIME = 299,
-        TOKEN_MIN_PREFERRED_LIFETIME = 300,
-        TOKEN_MAX_PREFERRED_LIFETIME = 301,
-        TOKEN_VALID_LIFETIME = 302,
-        TOKEN_MIN_VALID_LIFETIME = 303,
-        TOKEN_MAX_VALID_LIFETIME = 304,
-        TOKEN_RENEW_TIMER = 305,
-        TOKEN_REBIND_TIMER = 306,
-        TOKEN_CALCULATE_TEE_TIMES = 307,
-        TOKEN_T1_PERCENT = 308,
-        TOKEN_T2_PERCENT = 309,
-        TOKEN_DECLINE_PROBATION_PERIOD = 310,
-        TOKEN_SERVER_TAG = 311,
-        TOKEN_DDNS_SEND_UPDATES = 312,
-        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 313,
-        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 314,
-        TOKEN_DDNS_REPLACE_CLIENT_NAME = 315,
-        TOKEN_DDNS_GENERATED_PREFIX = 316,
-        TOKEN_DDNS_QUALIFYING_SUFFIX = 317,
-        TOKEN_SUBNET6 = 318,
-        TOKEN_OPTION_DEF = 319,
-        TOKEN_OPTION_DATA = 320,
-        TOKEN_NAME = 321,
-        TOKEN_DATA = 322,
-        TOKEN_CODE = 323,
-        TOKEN_SPACE = 324,
-        TOKEN_CSV_FORMAT = 325,
-        TOKEN_ALWAYS_SEND = 326,
-        TOKEN_RECORD_TYPES = 327,
-        TOKEN_ENCAPSULATE = 328,
-        TOKEN_ARRAY = 329,
-        TOKEN_POOLS = 330,
-        TOKEN_POOL = 331,
-        TOKEN_PD_POOLS = 332,
-        TOKEN_PREFIX = 333,
-        TOKEN_PREFIX_LEN = 334,
-        TOKEN_EXCLUDED_PREFIX = 335,
-        TOKEN_EXCLUDED_PREFIX_LEN = 336,
-        TOKEN_DELEGATED_LEN = 337,
-        TOKEN_USER_CONTEXT = 338,
-        TOKEN_COMMENT = 339,
-        TOKEN_SUBNET = 340,
-        TOKEN_INTERFACE = 341,
-        TOKEN_INTERFACE_ID = 342,
-        TOKEN_ID = 343,
-        TOKEN_RAPID_COMMIT = 344,
-        TOKEN_RESERVATION_MODE = 345,
-        TOKEN_DISABLED = 346,
-        TOKEN_OUT_OF_POOL = 347,
-        TOKEN_GLOBAL = 348,
-        TOKEN_ALL = 349,
-        TOKEN_SHARED_NETWORKS = 350,
-        TOKEN_MAC_SOURCES = 351,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 352,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 353,
-        TOKEN_SANITY_CHECKS = 354,
-        TOKEN_LEASE_CHECKS = 355,
-        TOKEN_CLIENT_CLASSES = 356,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 357,
-        TOKEN_TEST = 358,
-        TOKEN_ONLY_IF_REQUIRED = 359,
-        TOKEN_CLIENT_CLASS = 360,
-        TOKEN_RESERVATIONS = 361,
-        TOKEN_IP_ADDRESSES = 362,
-        TOKEN_PREFIXES = 363,
-        TOKEN_DUID = 364,
-        TOKEN_HW_ADDRESS = 365,
-        TOKEN_HOSTNAME = 366,
-        TOKEN_FLEX_ID = 367,
-        TOKEN_RELAY = 368,
-        TOKEN_IP_ADDRESS = 369,
-        TOKEN_HOOKS_LIBRARIES = 370,
-        TOKEN_LIBRARY = 371,
-        TOKEN_PARAMETERS = 372,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 373,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 374,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 375,
-        TOKEN_HOLD_RECLAIMED_TIME = 376,
-        TOKEN_MAX_RECLAIM_LEASES = 377,
-        TOKEN_MAX_RECLAIM_TIME = 378,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 379,
-        TOKEN_SERVER_ID = 380,
-        TOKEN_LLT = 381,
-        TOKEN_EN = 382,
-        TOKEN_LL = 383,
-        TOKEN_IDENTIFIER = 384,
-        TOKEN_HTYPE = 385,
-        TOKEN_TIME = 386,
-        TOKEN_ENTERPRISE_ID = 387,
-        TOKEN_DHCP4O6_PORT = 388,
-        TOKEN_CONTROL_SOCKET = 389,
-        TOKEN_SOCKET_TYPE = 390,
-        TOKEN_SOCKET_NAME = 391,
-        TOKEN_DHCP_QUEUE_CONTROL = 392,
-        TOKEN_ENABLE_QUEUE = 393,
-        TOKEN_QUEUE_TYPE = 394,
-        TOKEN_CAPACITY = 395,
-        TOKEN_DHCP_DDNS = 396,
-        TOKEN_ENABLE_UPDATES = 397,
-        TOKEN_QUALIFYING_SUFFIX = 398,
-        TOKEN_SERVER_IP = 399,
-        TOKEN_SERVER_PORT = 400,
-        TOKEN_SENDER_IP = 401,
-        TOKEN_SENDER_PORT = 402,
-        TOKEN_MAX_QUEUE_SIZE = 403,
-        TOKEN_NCR_PROTOCOL = 404,
-        TOKEN_NCR_FORMAT = 405,
-        TOKEN_OVERRIDE_NO_UPDATE = 406,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 407,
-        TOKEN_REPLACE_CLIENT_NAME = 408,
-        TOKEN_GENERATED_PREFIX = 409,
-        TOKEN_UDP = 410,
-        TOKEN_TCP = 411,
-        TOKEN_JSON = 412,
-        TOKEN_WHEN_PRESENT = 413,
-        TOKEN_NEVER = 414,
-        TOKEN_ALWAYS = 415,
-        TOKEN_WHEN_NOT_PRESENT = 416,
-        TOKEN_HOSTNAME_CHAR_SET = 417,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 418,
-        TOKEN_LOGGING = 419,
-        TOKEN_LOGGERS = 420,
-        TOKEN_OUTPUT_OPTIONS = 421,
-        TOKEN_OUTPUT = 422,
-        TOKEN_DEBUGLEVEL = 423,
-        TOKEN_SEVERITY = 424,
-        TOKEN_FLUSH = 425,
-        TOKEN_MAXSIZE = 426,
-        TOKEN_MAXVER = 427,
-        TOKEN_PATTERN = 428,
-        TOKEN_DHCP4 = 429,
-        TOKEN_DHCPDDNS = 430,
-        TOKEN_CONTROL_AGENT = 431,
-        TOKEN_TOPLEVEL_JSON = 432,
-        TOKEN_TOPLEVEL_DHCP6 = 433,
-        TOKEN_SUB_DHCP6 = 434,
-        TOKEN_SUB_INTERFACES6 = 435,
-        TOKEN_SUB_SUBNET6 = 436,
-        TOKEN_SUB_POOL6 = 437,
-        TOKEN_SUB_PD_POOL = 438,
-        TOKEN_SUB_RESERVATION = 439,
-        TOKEN_SUB_OPTION_DEFS = 440,
-        TOKEN_SUB_OPTION_DEF = 441,
-        TOKEN_SUB_OPTION_DATA = 442,
-        TOKEN_SUB_HOOKS_LIBRARY = 443,
-        TOKEN_SUB_DHCP_DDNS = 444,
-        TOKEN_SUB_LOGGING = 445,
-        TOKEN_SUB_CONFIG_CONTROL = 446,
-        TOKEN_STRING = 447,
-        TOKEN_INTEGER = 448,
-        TOKEN_FLOAT = 449,
-        TOKEN_BOOLEAN = 450
+        TOKEN_WRITE_BEHIND_CACHE = 288,
+        TOKEN_WRITE_BACK_LATENCY = 289,
+        TOKEN_CACHE_JOURNAL = 290,
+        TOKEN_READ_REPLICAS = 291,
+        TOKEN_CONNECT_TIMEOUT = 292,
+        TOKEN_CONTACT_POINTS = 293,
+        TOKEN_MAX_RECONNECT_TRIES = 294,
+        TOKEN_RECONNECT_WAIT_TIME = 295,
+        TOKEN_KEYSPACE = 296,
+        TOKEN_CONSISTENCY = 297,
+        TOKEN_SERIAL_CONSISTENCY = 298,
+        TOKEN_REQUEST_TIMEOUT = 299,
+        TOKEN_TCP_KEEPALIVE = 300,
+        TOKEN_TCP_NODELAY = 301,
+        TOKEN_MAX_ROW_ERRORS = 302,
+        TOKEN_PREFERRED_LIFETIME = 303,
+        TOKEN_MIN_PREFERRED_LIFETIME = 304,
+        TOKEN_MAX_PREFERRED_LIFETIME = 305,
+        TOKEN_VALID_LIFETIME = 306,
+        TOKEN_MIN_VALID_LIFETIME = 307,
+        TOKEN_MAX_VALID_LIFETIME = 308,
+        TOKEN_RENEW_TIMER = 309,
+        TOKEN_REBIND_TIMER = 310,
+        TOKEN_CALCULATE_TEE_TIMES = 311,
+        TOKEN_T1_PERCENT = 312,
+        TOKEN_T2_PERCENT = 313,
+        TOKEN_CACHE_THRESHOLD = 314,
+        TOKEN_CACHE_MAX_AGE = 315,
+        TOKEN_DECLINE_PROBATION_PERIOD = 316,
+        TOKEN_SERVER_TAG = 317,
+        TOKEN_DDNS_SEND_UPDATES = 318,
+        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 319,
+        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 320,
+        TOKEN_DDNS_REPLACE_CLIENT_NAME = 321,
+        TOKEN_DDNS_GENERATED_PREFIX = 322,
+        TOKEN_DDNS_QUALIFYING_SUFFIX = 323,
+        TOKEN_SUBNET6 = 324,
+        TOKEN_OPTION_DEF = 325,
+        TOKEN_OPTION_DATA = 326,
+        TOKEN_NAME = 327,
+        TOKEN_DATA = 328,
+        TOKEN_CODE = 329,
+        TOKEN_SPACE = 330,
+        TOKEN_CSV_FORMAT = 331,
+        TOKEN_ALWAYS_SEND = 332,
+        TOKEN_RECORD_TYPES = 333,
+        TOKEN_ENCAPSULATE = 334,
+        TOKEN_ARRAY = 335,
+        TOKEN_POOLS = 336,
+        TOKEN_POOL = 337,
+        TOKEN_PD_POOLS = 338,
+        TOKEN_PREFIX = 339,
+        TOKEN_PREFIX_LEN = 340,
+        TOKEN_EXCLUDED_PREFIX = 341,
+        TOKEN_EXCLUDED_PREFIX_LEN = 342,
+        TOKEN_DELEGATED_LEN = 343,
+        TOKEN_USER_CONTEXT = 344,
+        TOKEN_COMMENT = 345,
+        TOKEN_SUBNET = 346,
+        TOKEN_INTERFACE = 347,
+        TOKEN_INTERFACE_ID = 348,
+        TOKEN_ID = 349,
+        TOKEN_RAPID_COMMIT = 350,
+        TOKEN_RESERVATION_MODE = 351,
+        TOKEN_DISABLED = 352,
+        TOKEN_OUT_OF_POOL = 353,
+        TOKEN_GLOBAL = 354,
+        TOKEN_ALL = 355,
+        TOKEN_SHARED_NETWORKS = 356,
+        TOKEN_MAC_SOURCES = 357,
+        TOKEN_RELAY_SUPPLIED_OPTIONS = 358,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 359,
+        TOKEN_SANITY_CHECKS = 360,
+        TOKEN_LEASE_CHECKS = 361,
+        TOKEN_CLIENT_CLASSES = 362,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 363,
+        TOKEN_TEST = 364,
+        TOKEN_ONLY_IF_REQUIRED = 365,
+        TOKEN_CLIENT_CLASS = 366,
+        TOKEN_RESERVATIONS = 367,
+        TOKEN_IP_ADDRESSES = 368,
+        TOKEN_PREFIXES = 369,
+        TOKEN_DUID = 370,
+        TOKEN_HW_ADDRESS = 371,
+        TOKEN_HOSTNAME = 372,
+        TOKEN_FLEX_ID = 373,
+        TOKEN_RELAY = 374,
+        TOKEN_IP_ADDRESS = 375,
+        TOKEN_HOOKS_LIBRARIES = 376,
+        TOKEN_LIBRARY = 377,
+        TOKEN_PARAMETERS = 378,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 379,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 380,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 381,
+        TOKEN_HOLD_RECLAIMED_TIME = 382,
+        TOKEN_MAX_RECLAIM_LEASES = 383,
+        TOKEN_MAX_RECLAIM_TIME = 384,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 385,
+        TOKEN_BACKGROUND_RECLAMATION = 386,
+        TOKEN_SERVER_ID = 387,
+        TOKEN_LLT = 388,
+        TOKEN_EN = 389,
+        TOKEN_LL = 390,
+        TOKEN_IDENTIFIER = 391,
+        TOKEN_HTYPE = 392,
+        TOKEN_TIME = 393,
+        TOKEN_ENTERPRISE_ID = 394,
+        TOKEN_DHCP4O6_PORT = 395,
+        TOKEN_CONTROL_SOCKET = 396,
+        TOKEN_SOCKET_TYPE = 397,
+        TOKEN_SOCKET_NAME = 398,
+        TOKEN_DHCP_QUEUE_CONTROL = 399,
+        TOKEN_ENABLE_QUEUE = 400,
+        TOKEN_QUEUE_TYPE = 401,
+        TOKEN_CAPACITY = 402,
+        TOKEN_DHCP_DDNS = 403,
+        TOKEN_ENABLE_UPDATES = 404,
+        TOKEN_QUALIFYING_SUFFIX = 405,
+        TOKEN_SERVER_IP = 406,
+        TOKEN_SERVER_PORT = 407,
+        TOKEN_SENDER_IP = 408,
+        TOKEN_SENDER_PORT = 409,
+        TOKEN_MAX_QUEUE_SIZE = 410,
+        TOKEN_NCR_PROTOCOL = 411,
+        TOKEN_NCR_FORMAT = 412,
+        TOKEN_OVERRIDE_NO_UPDATE = 413,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 414,
+        TOKEN_REPLACE_CLIENT_NAME = 415,
+        TOKEN_GENERATED_PREFIX = 416,
+        TOKEN_UDP = 417,
+        TOKEN_TCP = 418,
+        TOKEN_JSON = 419,
+        TOKEN_WHEN_PRESENT = 420,
+        TOKEN_NEVER = 421,
+        TOKEN_ALWAYS = 422,
+        TOKEN_WHEN_NOT_PRESENT = 423,
+        TOKEN_HOSTNAME_CHAR_SET = 424,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 425,
+        TOKEN_LOGGING = 426,
+        TOKEN_LOGGERS = 427,
+        TOKEN_OUTPUT_OPTIONS = 428,
+        TOKEN_OUTPUT = 429,
+        TOKEN_DEBUGLEVEL = 430,
+        TOKEN_SEVERITY = 431,
+        TOKEN_FLUSH = 432,
+        TOKEN_MAXSIZE = 433,
+        TOKEN_MAXVER = 434,
+        TOKEN_PATTERN = 435,
+        TOKEN_ASYNC = 436,
+        TOKEN_ASYNC_QUEUE_SIZE = 437,
+        TOKEN_ASYNC_OVERFLOW = 438,
+        TOKEN_RATE_LIMITED_MESSAGES = 439,
+        TOKEN_RATE_LIMIT = 440,
+        TOKEN_RATE_LIMIT_INTERVAL = 441,
+        TOKEN_DHCP4 = 442,
+        TOKEN_DHCPDDNS = 443,
+        TOKEN_CONTROL_AGENT = 444,
+        TOKEN_TOPLEVEL_JSON = 445,
+        TOKEN_TOPLEVEL_DHCP6 = 446,
+        TOKEN_SUB_DHCP6 = 447,
+        TOKEN_SUB_INTERFACES6 = 448,
+        TOKEN_SUB_SUBNET6 = 449,
+        TOKEN_SUB_POOL6 = 450,
+        TOKEN_SUB_PD_POOL = 451,
+        TOKEN_SUB_RESERVATION = 452,
+        TOKEN_SUB_OPTION_DEFS = 453,
+        TOKEN_SUB_OPTION_DEF = 454,
+        TOKEN_SUB_OPTION_DATA = 455,
+        TOKEN_SUB_HOOKS_LIBRARY = 456,
+        TOKEN_SUB_DHCP_DDNS = 457,
+        TOKEN_SUB_LOGGING = 458,
+        TOKEN_SUB_CONFIG_CONTROL = 459,
+        TOKEN_STRING = 460,
+        TOKEN_INTEGER = 461,
+        TOKEN_FLOAT = 462,
+        TOKEN_BOOLEAN = 463
       };
     };
 
@@ -786,29 +799,29 @@ namespace isc { namespace dhcp {
         // Type destructor.
 switch (yytype)
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -891,13 +904,13 @@ switch (yytype)
       symbol_type (int tok, location_type l)
         : super_type(token_type (tok), std::move (l))
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DATA_DIRECTORY || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_PREFERRED_LIFETIME || tok == token::TOKEN_MIN_PREFERRED_LIFETIME || tok == token::TOKEN_MAX_PREFERRED_LIFETIME || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET6 || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_PD_POOLS || tok == token::TOKEN_PREFIX || tok == token::TOKEN_PREFIX_LEN || tok == token::TOKEN_EXCLUDED_PREFIX || tok == token::TOKEN_EXCLUDED_PREFIX_LEN || tok == token::TOKEN_DELEGATED_LEN || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_INTERFACE_ID || tok == token::TOKEN_ID || tok == token::TOKEN_RAPID_COMMIT || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_MAC_SOURCES || tok == token::TOKEN_RELAY_SUPPLIED_OPTIONS || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_PREFIXES || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_SERVER_ID || tok == token::TOKEN_LLT || tok == token::TOKEN_EN || tok == token::TOKEN_LL || tok == token::TOKEN_IDENTIFIER || tok == token::TOKEN_HTYPE || tok == token::TOKEN_TIME || tok == token::TOKEN_ENTERPRISE_ID || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP6 || tok == token::TOKEN_SUB_DHCP6 || tok == token::TOKEN_SUB_INTERFACES6 || tok == token::TOKEN_SUB_SUBNET6 || tok == token::TOKEN_SUB_POOL6 || tok == token::TOKEN_SUB_PD_POOL || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DATA_DIRECTORY || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_WRITE_BEHIND_CACHE || tok == token::TOKEN_WRITE_BACK_LATENCY || tok == token::TOKEN_CACHE_JOURNAL || tok == token::TOKEN_READ_REPLICAS || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_PREFERRED_LIFETIME || tok == token::TOKEN_MIN_PREFERRED_LIFETIME || tok == token::TOKEN_MAX_PREFERRED_LIFETIME || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_CACHE_THRESHOLD || tok == token::TOKEN_CACHE_MAX_AGE || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET6 || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_PD_POOLS || tok == token::TOKEN_PREFIX || tok == token::TOKEN_PREFIX_LEN || tok == token::TOKEN_EXCLUDED_PREFIX || tok == token::TOKEN_EXCLUDED_PREFIX_LEN || tok == token::TOKEN_DELEGATED_LEN || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_INTERFACE_ID || tok == token::TOKEN_ID || tok == token::TOKEN_RAPID_COMMIT || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_MAC_SOURCES || tok == token::TOKEN_RELAY_SUPPLIED_OPTIONS || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_PREFIXES || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_BACKGROUND_RECLAMATION || tok == token::TOKEN_SERVER_ID || tok == token::TOKEN_LLT || tok == token::TOKEN_EN || tok == token::TOKEN_LL || tok == token::TOKEN_IDENTIFIER || tok == token::TOKEN_HTYPE || tok == token::TOKEN_TIME || tok == token::TOKEN_ENTERPRISE_ID || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP6 || tok == token::TOKEN_SUB_DHCP6 || tok == token::TOKEN_SUB_INTERFACES6 || tok == token::TOKEN_SUB_SUBNET6 || tok == token::TOKEN_SUB_POOL6 || tok == token::TOKEN_SUB_PD_POOL || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
       }
 #else
       symbol_type (int tok, const location_type& l)
         : super_type(token_type (tok), l)
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DATA_DIRECTORY || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_PREFERRED_LIFETIME || tok == token::TOKEN_MIN_PREFERRED_LIFETIME || tok == token::TOKEN_MAX_PREFERRED_LIFETIME || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET6 || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_PD_POOLS || tok == token::TOKEN_PREFIX || tok == token::TOKEN_PREFIX_LEN || tok == token::TOKEN_EXCLUDED_PREFIX || tok == token::TOKEN_EXCLUDED_PREFIX_LEN || tok == token::TOKEN_DELEGATED_LEN || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_INTERFACE_ID || tok == token::TOKEN_ID || tok == token::TOKEN_RAPID_COMMIT || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_MAC_SOURCES || tok == token::TOKEN_RELAY_SUPPLIED_OPTIONS || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_PREFIXES || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_SERVER_ID || tok == token::TOKEN_LLT || tok == token::TOKEN_EN || tok == token::TOKEN_LL || tok == token::TOKEN_IDENTIFIER || tok == token::TOKEN_HTYPE || tok == token::TOKEN_TIME || tok == token::TOKEN_ENTERPRISE_ID || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP6 || tok == token::TOKEN_SUB_DHCP6 || tok == token::TOKEN_SUB_INTERFACES6 || tok == token::TOKEN_SUB_SUBNET6 || tok == token::TOKEN_SUB_POOL6 || tok == token::TOKEN_SUB_PD_POOL || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DATA_DIRECTORY || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_WRITE_BEHIND_CACHE || tok == token::TOKEN_WRITE_BACK_LATENCY || tok == token::TOKEN_CACHE_JOURNAL || tok == token::TOKEN_READ_REPLICAS || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_MAX_ROW_ERRORS || tok == token::TOKEN_PREFERRED_LIFETIME || tok == token::TOKEN_MIN_PREFERRED_LIFETIME || tok == token::TOKEN_MAX_PREFERRED_LIFETIME || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_CACHE_THRESHOLD || tok == token::TOKEN_CACHE_MAX_AGE || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_DDNS_SEND_UPDATES || tok == token::TOKEN_DDNS_OVERRIDE_NO_UPDATE || tok == token::TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_DDNS_REPLACE_CLIENT_NAME || tok == token::TOKEN_DDNS_GENERATED_PREFIX || tok == token::TOKEN_DDNS_QUALIFYING_SUFFIX || tok == token::TOKEN_SUBNET6 || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_PD_POOLS || tok == token::TOKEN_PREFIX || tok == token::TOKEN_PREFIX_LEN || tok == token::TOKEN_EXCLUDED_PREFIX || tok == token::TOKEN_EXCLUDED_PREFIX_LEN || tok == token::TOKEN_DELEGATED_LEN || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_INTERFACE_ID || tok == token::TOKEN_ID || tok == token::TOKEN_RAPID_COMMIT || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_MAC_SOURCES || tok == token::TOKEN_RELAY_SUPPLIED_OPTIONS || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_PREFIXES || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_BACKGROUND_RECLAMATION || tok == token::TOKEN_SERVER_ID || tok == token::TOKEN_LLT || tok == token::TOKEN_EN || tok == token::TOKEN_LL || tok == token::TOKEN_IDENTIFIER || tok == token::TOKEN_HTYPE || tok == token::TOKEN_TIME || tok == token::TOKEN_ENTERPRISE_ID || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_ENABLE_QUEUE || tok == token::TOKEN_QUEUE_TYPE || tok == token::TOKEN_CAPACITY || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP6 || tok == token::TOKEN_SUB_DHCP6 || tok == token::TOKEN_SUB_INTERFACES6 || tok == token::TOKEN_SUB_SUBNET6 || tok == token::TOKEN_SUB_POOL6 || tok == token::TOKEN_SUB_PD_POOL || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
       }
 #endif
 #if 201103L <= YY_CPLUSPLUS
@@ -1454,6 +1467,66 @@ switch (yytype)
         return symbol_type (token::TOKEN_READONLY, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WRITE_BEHIND_CACHE (location_type l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BEHIND_CACHE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WRITE_BEHIND_CACHE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BEHIND_CACHE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WRITE_BACK_LATENCY (location_type l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BACK_LATENCY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WRITE_BACK_LATENCY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WRITE_BACK_LATENCY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_JOURNAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_JOURNAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_JOURNAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_JOURNAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_READ_REPLICAS (location_type l)
+      {
+        return symbol_type (token::TOKEN_READ_REPLICAS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_READ_REPLICAS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_READ_REPLICAS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1784,6 +1857,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_T2_PERCENT, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_MAX_AGE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_MAX_AGE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_MAX_AGE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_MAX_AGE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -2834,6 +2937,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BACKGROUND_RECLAMATION (location_type l)
+      {
+        return symbol_type (token::TOKEN_BACKGROUND_RECLAMATION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BACKGROUND_RECLAMATION (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BACKGROUND_RECLAMATION, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3569,6 +3687,96 @@ switch (yytype)
         return symbol_type (token::TOKEN_PATTERN, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -4205,12 +4413,12 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 1199,     ///< Last index in yytable_.
-      yynnts_ = 427,  ///< Number of nonterminal symbols.
+      yylast_ = 1247,     ///< Last index in yytable_.
+      yynnts_ = 444,  ///< Number of nonterminal symbols.
       yyfinal_ = 32, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 196  ///< Number of tokens.
+      yyntokens_ = 209  ///< Number of tokens.
     };
 
 
@@ -4273,9 +4481,10 @@ switch (yytype)
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
      185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
-     195
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208
     };
-    const unsigned user_token_number_max_ = 450;
+    const unsigned user_token_number_max_ = 463;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int> (t) <= yyeof_)
@@ -4296,29 +4505,29 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -4337,29 +4546,29 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4385,29 +4594,29 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 213: // value
-      case 217: // map_value
-      case 258: // ddns_replace_client_name_value
-      case 292: // db_type
-      case 386: // hr_mode
-      case 522: // duid_type
-      case 565: // ncr_protocol_value
+      case 226: // value
+      case 230: // map_value
+      case 273: // ddns_replace_client_name_value
+      case 307: // db_type
+      case 408: // hr_mode
+      case 544: // duid_type
+      case 587: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 195: // "boolean"
+      case 208: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 194: // "floating point"
+      case 207: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 193: // "integer"
+      case 206: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 192: // "constant string"
+      case 205: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4494,14 +4703,15 @@ switch (yytype)
      415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
      425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
      435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   458,   459,   460,   461,   462,   463
     };
     return token_type (yytoken_number_[type]);
   }
 
 #line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 4505 "dhcp6_parser.h"
+#line 4715 "dhcp6_parser.h"
 
 
 
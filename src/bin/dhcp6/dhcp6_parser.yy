@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -74,6 +74,10 @@ using namespace std;
   PERSIST "persist"
   LFC_INTERVAL "lfc-interval"
   READONLY "readonly"
+  WRITE_BEHIND_CACHE "write-behind-cache"
+  WRITE_BACK_LATENCY "write-back-latency"
+  CACHE_JOURNAL "cache-journal"
+  READ_REPLICAS "read-replicas"
   CONNECT_TIMEOUT "connect-timeout"
   CONTACT_POINTS "contact-points"
   MAX_RECONNECT_TRIES "max-reconnect-tries"
@@ -97,6 +101,8 @@ using namespace std;
   CALCULATE_TEE_TIMES "calculate-tee-times"
   T1_PERCENT "t1-percent"
   T2_PERCENT "t2-percent"
+  CACHE_THRESHOLD "cache-threshold"
+  CACHE_MAX_AGE "cache-max-age"
   DECLINE_PROBATION_PERIOD "decline-probation-period"
   SERVER_TAG "server-tag"
   DDNS_SEND_UPDATES "ddns-send-updates"
@@ -176,6 +182,7 @@ using namespace std;
   MAX_RECLAIM_LEASES "max-reclaim-leases"
   MAX_RECLAIM_TIME "max-reclaim-time"
   UNWARNED_RECLAIM_CYCLES "unwarned-reclaim-cycles"
+  BACKGROUND_RECLAMATION "background-reclamation"
 
   SERVER_ID "server-id"
   LLT "LLT"
@@ -231,6 +238,12 @@ using namespace std;
   MAXSIZE "maxsize"
   MAXVER "maxver"
   PATTERN "pattern"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
+  ASYNC_OVERFLOW "async-overflow"
+  RATE_LIMITED_MESSAGES "rate-limited-messages"
+  RATE_LIMIT "rate-limit"
+  RATE_LIMIT_INTERVAL "rate-limit-interval"
 
   DHCP4 "Dhcp4"
   DHCPDDNS "DhcpDdns"
@@ -497,6 +510,8 @@ global_param: data_directory
             | calculate_tee_times
             | t1_percent
             | t2_percent
+            | cache_threshold
+            | cache_max_age
             | loggers
             | hostname_char_set
             | hostname_char_replacement
@@ -572,6 +587,16 @@ t2_percent: T2_PERCENT COLON FLOAT {
     ctx.stack_.back()->set("t2-percent", t2);
 };
 
+cache_threshold: CACHE_THRESHOLD COLON FLOAT {
+    ElementPtr ct(new DoubleElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+};
+
+cache_max_age: CACHE_MAX_AGE COLON INTEGER {
+    ElementPtr cm(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-max-age", cm);
+};
+
 decline_probation_period: DECLINE_PROBATION_PERIOD COLON INTEGER {
     ElementPtr dpp(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -770,6 +795,10 @@ database_map_param: database_type
                   | persist
                   | lfc_interval
                   | readonly
+                  | write_behind_cache
+                  | write_back_latency
+                  | cache_journal
+                  | read_replicas
                   | connect_timeout
                   | contact_points
                   | max_reconnect_tries
@@ -849,6 +878,32 @@ readonly: READONLY COLON BOOLEAN {
     ctx.stack_.back()->set("readonly", n);
 };
 
+write_behind_cache: WRITE_BEHIND_CACHE COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("write-behind-cache", n);
+};
+
+write_back_latency: WRITE_BACK_LATENCY COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("write-back-latency", n);
+};
+
+cache_journal: CACHE_JOURNAL {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr journal(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("cache-journal", journal);
+    ctx.leave();
+};
+
+read_replicas: READ_REPLICAS {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr replicas(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("read-replicas", replicas);
+    ctx.leave();
+};
+
 connect_timeout: CONNECT_TIMEOUT COLON INTEGER {
     ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1102,6 +1157,7 @@ expired_leases_param: reclaim_timer_wait_time
                     | max_reclaim_leases
                     | max_reclaim_time
                     | unwarned_reclaim_cycles
+                    | background_reclamation
                     ;
 
 reclaim_timer_wait_time: RECLAIM_TIMER_WAIT_TIME COLON INTEGER {
@@ -1134,6 +1190,11 @@ unwarned_reclaim_cycles: UNWARNED_RECLAIM_CYCLES COLON INTEGER {
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 };
 
+background_reclamation: BACKGROUND_RECLAMATION COLON BOOLEAN {
+    ElementPtr value(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("background-reclamation", value);
+};
+
 // --- subnet6 ------------------------------------------
 // This defines subnet6 as a list of maps.
 // "subnet6": [ ... ]
@@ -1230,6 +1291,8 @@ subnet6_param: preferred_lifetime
              | calculate_tee_times
              | t1_percent
              | t2_percent
+             | cache_threshold
+             | cache_max_age
              | hostname_char_set
              | hostname_char_replacement
              | ddns_send_updates
@@ -1364,6 +1427,8 @@ shared_network_param: name
                     | calculate_tee_times
                     | t1_percent
                     | t2_percent
+                    | cache_threshold
+                    | cache_max_age
                     | hostname_char_set
                     | hostname_char_replacement
                     | ddns_send_updates
@@ -2483,6 +2548,9 @@ logger_param: name
             | output_options_list
             | debuglevel
             | severity
+            | rate_limited_messages
+            | rate_limit
+            | rate_limit_interval
             | user_context
             | comment
             | unknown_map_entry
@@ -2501,6 +2569,26 @@ severity: SEVERITY {
     ctx.leave();
 };
 
+rate_limited_messages: RATE_LIMITED_MESSAGES {
+    ElementPtr l(new ListElement(ctx.loc2pos(@1)));
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON list_strings {
+    ctx.stack_.pop_back();
+    ctx.leave();
+};
+
+rate_limit: RATE_LIMIT COLON INTEGER {
+    ElementPtr limit(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate-limit", limit);
+};
+
+rate_limit_interval: RATE_LIMIT_INTERVAL COLON INTEGER {
+    ElementPtr interval(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+};
+
 output_options_list: OUTPUT_OPTIONS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("output_options", l);
@@ -2532,6 +2620,9 @@ output_params: output
              | maxsize
              | maxver
              | pattern
+             | async
+             | async_queue_size
+             | async_overflow
              ;
 
 output: OUTPUT {
@@ -2565,6 +2656,24 @@ pattern: PATTERN {
     ctx.leave();
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
+async_overflow: ASYNC_OVERFLOW {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr overflow(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+};
+
 %%
 
 void
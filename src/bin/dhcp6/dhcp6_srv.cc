@@ -51,6 +51,7 @@
 #include <util/io_utilities.h>
 #include <util/pointer_util.h>
 #include <util/range_utilities.h>
+#include <util/trace_mgr.h>
 #include <log/logger.h>
 #include <cryptolink/cryptolink.h>
 #include <cfgrpt/config_report.h>
@@ -198,6 +199,96 @@ std::set<std::string> dhcp6_statistics = {
     "pkt6-receive-drop"
 };
 
+/// Handles of the statistics updated for each packet. They are registered
+/// during the DHCPv6 server startup, so the packet processing does not
+/// look the statistics up by name nor take the Statistics Manager lock.
+struct Dhcp6PacketCounters {
+    StatCounterPtr received_;                 ///< pkt6-received
+    StatCounterPtr solicit_received_;         ///< pkt6-solicit-received
+    StatCounterPtr advertise_received_;       ///< pkt6-advertise-received
+    StatCounterPtr request_received_;         ///< pkt6-request-received
+    StatCounterPtr reply_received_;           ///< pkt6-reply-received
+    StatCounterPtr renew_received_;           ///< pkt6-renew-received
+    StatCounterPtr rebind_received_;          ///< pkt6-rebind-received
+    StatCounterPtr decline_received_;         ///< pkt6-decline-received
+    StatCounterPtr release_received_;         ///< pkt6-release-received
+    StatCounterPtr infrequest_received_;      ///< pkt6-infrequest-received
+    StatCounterPtr dhcpv4_query_received_;    ///< pkt6-dhcpv4-query-received
+    StatCounterPtr dhcpv4_response_received_; ///< pkt6-dhcpv4-response-received
+    StatCounterPtr unknown_received_;         ///< pkt6-unknown-received
+    StatCounterPtr sent_;                     ///< pkt6-sent
+    StatCounterPtr advertise_sent_;           ///< pkt6-advertise-sent
+    StatCounterPtr reply_sent_;               ///< pkt6-reply-sent
+    StatCounterPtr dhcpv4_response_sent_;     ///< pkt6-dhcpv4-response-sent
+    StatCounterPtr parse_failed_;             ///< pkt6-parse-failed
+    StatCounterPtr receive_drop_;             ///< pkt6-receive-drop
+
+    /// Registers the counters.
+    void registerCounters() {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        received_ = stats_mgr.registerCounter("pkt6-received");
+        solicit_received_ = stats_mgr.registerCounter("pkt6-solicit-received");
+        advertise_received_ = stats_mgr.registerCounter("pkt6-advertise-received");
+        request_received_ = stats_mgr.registerCounter("pkt6-request-received");
+        reply_received_ = stats_mgr.registerCounter("pkt6-reply-received");
+        renew_received_ = stats_mgr.registerCounter("pkt6-renew-received");
+        rebind_received_ = stats_mgr.registerCounter("pkt6-rebind-received");
+        decline_received_ = stats_mgr.registerCounter("pkt6-decline-received");
+        release_received_ = stats_mgr.registerCounter("pkt6-release-received");
+        infrequest_received_ = stats_mgr.registerCounter("pkt6-infrequest-received");
+        dhcpv4_query_received_ = stats_mgr.registerCounter("pkt6-dhcpv4-query-received");
+        dhcpv4_response_received_ = stats_mgr.registerCounter("pkt6-dhcpv4-response-received");
+        unknown_received_ = stats_mgr.registerCounter("pkt6-unknown-received");
+        sent_ = stats_mgr.registerCounter("pkt6-sent");
+        advertise_sent_ = stats_mgr.registerCounter("pkt6-advertise-sent");
+        reply_sent_ = stats_mgr.registerCounter("pkt6-reply-sent");
+        dhcpv4_response_sent_ = stats_mgr.registerCounter("pkt6-dhcpv4-response-sent");
+        parse_failed_ = stats_mgr.registerCounter("pkt6-parse-failed");
+        receive_drop_ = stats_mgr.registerCounter("pkt6-receive-drop");
+    }
+};
+
+/// Handles of the packet statistics.
+Dhcp6PacketCounters PacketCounters;
+
+/// Histograms of the packet processing times. Like the counters they are
+/// registered during the DHCPv6 server startup.
+struct Dhcp6PacketHistograms {
+    StatHistogramPtr latency_;          ///< pkt6-latency
+    StatHistogramPtr unpack_;           ///< pkt6-unpack-time
+    StatHistogramPtr classify_;         ///< pkt6-classify-time
+    StatHistogramPtr subnet_select_;    ///< pkt6-subnet-select-time
+    StatHistogramPtr allocate_;         ///< pkt6-allocate-time
+    StatHistogramPtr pack_;             ///< pkt6-pack-time
+
+    /// Registers the histograms.
+    void registerHistograms() {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        latency_ = stats_mgr.registerHistogram("pkt6-latency");
+        unpack_ = stats_mgr.registerHistogram("pkt6-unpack-time");
+        classify_ = stats_mgr.registerHistogram("pkt6-classify-time");
+        subnet_select_ = stats_mgr.registerHistogram("pkt6-subnet-select-time");
+        allocate_ = stats_mgr.registerHistogram("pkt6-allocate-time");
+        pack_ = stats_mgr.registerHistogram("pkt6-pack-time");
+    }
+
+    /// Records the time elapsed since the query was received.
+    void recordLatency(const Pkt6Ptr& query) const {
+        if (!latency_) {
+            return;
+        }
+        boost::posix_time::time_duration elapsed =
+            boost::posix_time::microsec_clock::universal_time() -
+            query->getTimestamp();
+        if (!elapsed.is_negative()) {
+            latency_->record(elapsed.total_microseconds());
+        }
+    }
+};
+
+/// Handles of the packet processing time histograms.
+Dhcp6PacketHistograms PacketHistograms;
+
 }  // namespace
 
 namespace isc {
@@ -257,6 +348,10 @@ void Dhcpv6Srv::setPacketStatisticsDefaults() {
         // Initialize them with default value 0
         stats_mgr.setValue((*it), static_cast<int64_t>(0));
     }
+
+    // Get the handles used in the packet processing
+    PacketCounters.registerCounters();
+    PacketHistograms.registerHistograms();
 }
 
 Dhcpv6Srv::~Dhcpv6Srv() {
@@ -505,7 +600,7 @@ void Dhcpv6Srv::run_one() {
             // any failures in unpacking will cause the packet to be dropped.
             // we will increase type specific packets further down the road.
             // See processStatsReceived().
-            StatsMgr::instance().addValue("pkt6-received", static_cast<int64_t>(1));
+            PacketCounters.received_->add();
 
         }
         // We used to log that the wait was interrupted, but this is no longer
@@ -567,10 +662,16 @@ void Dhcpv6Srv::run_one() {
 
     CalloutHandlePtr callout_handle = getCalloutHandle(query);
     processPacketBufferSend(callout_handle, rsp);
+    PacketHistograms.recordLatency(query);
 }
 
 void
 Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
+    // The trace events are correlated by the transaction id which is
+    // set once the query is unpacked.
+    ScopedTraceContext trace_context;
+    ScopedTrace trace("processPacket");
+
     bool skip_unpack = false;
 
     // The packet has just been received so contains the uninterpreted wire
@@ -615,8 +716,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(query->getIface());
 
             // Increase the statistic of dropped packets.
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            PacketCounters.receive_drop_->add();
             return;
         }
 
@@ -631,6 +731,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            ScopedHistogramTimer timer(PacketHistograms.unpack_);
             query->unpack();
         } catch (const SkipRemainingOptionsError& e) {
             // An option failed to unpack but we are to attempt to process it
@@ -648,14 +749,14 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(e.what());
 
             // Increase the statistics of parse failures and dropped packets.
-            StatsMgr::instance().addValue("pkt6-parse-failed",
-                                          static_cast<int64_t>(1));
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            PacketCounters.parse_failed_->add();
+            PacketCounters.receive_drop_->add();
             return;
         }
     }
 
+    trace_context.setId(query->getTransid());
+
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
@@ -664,7 +765,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!testServerID(query)) {
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
         return;
     }
 
@@ -674,12 +775,15 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!testUnicast(query)) {
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
         return;
     }
 
     // Assign this packet to a class, if possible
-    classifyPacket(query);
+    {
+        ScopedHistogramTimer timer(PacketHistograms.classify_);
+        classifyPacket(query);
+    }
 
     LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC_DATA, DHCP6_PACKET_RECEIVED)
         .arg(query->getLabel())
@@ -721,8 +825,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             LOG_DEBUG(hooks_logger, DBG_DHCP6_HOOKS, DHCP6_HOOK_PACKET_RCVD_SKIP)
                 .arg(query->getLabel());
             // Increase the statistic of dropped packets.
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            PacketCounters.receive_drop_->add();
             return;
         }
 
@@ -738,8 +841,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (query->inClass("DROP")) {
         LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_PACKET_DROP_DROP_CLASS)
             .arg(query->toText());
-        StatsMgr::instance().addValue("pkt6-receive-drop",
-                                      static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
         return;
     }
 
@@ -815,7 +917,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        PacketCounters.receive_drop_->add();
     }
 
     if (!rsp) {
@@ -940,6 +1042,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         [this, callout_handle, query, rsp]() mutable {
             processPacketPktSend(callout_handle, query, rsp);
             processPacketBufferSend(callout_handle, rsp);
+            PacketHistograms.recordLatency(query);
         });
 
         // If we have parked the packet, let's reset the pointer to the
@@ -1008,6 +1111,7 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
 
     if (!skip_pack) {
         try {
+            ScopedHistogramTimer timer(PacketHistograms.pack_);
             rsp->pack();
         } catch (const std::exception& e) {
             LOG_ERROR(options6_logger, DHCP6_PACK_FAIL).arg(e.what());
@@ -1396,7 +1500,7 @@ Dhcpv6Srv::sanityCheck(const Pkt6Ptr& pkt) {
     }
 
     // Increase the statistic of dropped packets.
-    StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+    PacketCounters.receive_drop_->add();
     return (false);
 }
 
@@ -1475,6 +1579,7 @@ void Dhcpv6Srv::sanityCheckDUID(const OptionPtr& opt, const std::string& opt_nam
 
 Subnet6Ptr
 Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
+    ScopedHistogramTimer timer(PacketHistograms.subnet_select_);
     const SubnetSelector& selector = CfgSubnets6::initSelector(question);
 
     Subnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
@@ -1552,6 +1657,7 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
 void
 Dhcpv6Srv::assignLeases(const Pkt6Ptr& question, Pkt6Ptr& answer,
                         AllocEngine::ClientContext6& ctx) {
+    ScopedHistogramTimer timer(PacketHistograms.allocate_);
 
     Subnet6Ptr subnet = ctx.subnet_;
 
@@ -2711,6 +2817,14 @@ Dhcpv6Srv::releaseIA_NA(const DuidPtr& duid, const Pkt6Ptr& query,
             StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-nas"),
             static_cast<int64_t>(-1));
 
+        // Update the utilization hint used for the shared network
+        // allocations.
+        ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets6()->getBySubnetId(lease->subnet_id_);
+        if (subnet) {
+            subnet->adjustAssignedLeasesHint(Lease::TYPE_NA, -1);
+        }
+
         // Check if a lease has flags indicating that the FQDN update has
         // been performed. If so, create NameChangeRequest which removes
         // the entries.
@@ -2875,6 +2989,14 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
         StatsMgr::instance().addValue(
             StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-pds"),
             static_cast<int64_t>(-1));
+
+        // Update the utilization hint used for the shared network
+        // allocations.
+        ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets6()->getBySubnetId(lease->subnet_id_);
+        if (subnet) {
+            subnet->adjustAssignedLeasesHint(Lease::TYPE_PD, -1);
+        }
     }
 
     return (ia_rsp);
@@ -3521,6 +3643,8 @@ void Dhcpv6Srv::evaluateClasses(const Pkt6Ptr& pkt, bool depend_on_known) {
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
     const ClientClassDefListPtr& defs_ptr = dict->getClasses();
+    // Results of the subexpressions shared by classes.
+    EvalCache cache;
     for (ClientClassDefList::const_iterator it = defs_ptr->cbegin();
          it != defs_ptr->cend(); ++it) {
         // Note second cannot be null
@@ -3540,7 +3664,7 @@ void Dhcpv6Srv::evaluateClasses(const Pkt6Ptr& pkt, bool depend_on_known) {
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
-            bool status = evaluateBool(*expr_ptr, *pkt);
+            bool status = (*it)->evaluateMatchExpr(*pkt, cache);
             if (status) {
                 LOG_INFO(dhcp6_logger, EVAL_RESULT)
                     .arg((*it)->getName())
@@ -3631,6 +3755,8 @@ Dhcpv6Srv::requiredClassify(const Pkt6Ptr& pkt, AllocEngine::ClientContext6& ctx
     // Note getClientClassDictionary() cannot be null
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
+    // Results of the subexpressions shared by classes.
+    EvalCache cache;
     for (ClientClasses::const_iterator cclass = classes.cbegin();
          cclass != classes.cend(); ++cclass) {
         const ClientClassDefPtr class_def = dict->findClass(*cclass);
@@ -3649,7 +3775,7 @@ Dhcpv6Srv::requiredClassify(const Pkt6Ptr& pkt, AllocEngine::ClientContext6& ctx
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
-            bool status = evaluateBool(*expr_ptr, *pkt);
+            bool status = class_def->evaluateMatchExpr(*pkt, cache);
             if (status) {
                 LOG_INFO(dhcp6_logger, EVAL_RESULT)
                     .arg(*cclass)
@@ -3905,79 +4031,83 @@ void Dhcpv6Srv::processStatsReceived(const Pkt6Ptr& query) {
     // Note that we're not bumping pkt6-received statistic as it was
     // increased early in the packet reception code.
 
-    string stat_name = "pkt6-unknown-received";
+    StatCounterPtr counter = PacketCounters.unknown_received_;
     switch (query->getType()) {
     case DHCPV6_SOLICIT:
-        stat_name = "pkt6-solicit-received";
+        counter = PacketCounters.solicit_received_;
         break;
     case DHCPV6_ADVERTISE:
         // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-advertise-received";
+        counter = PacketCounters.advertise_received_;
         break;
     case DHCPV6_REQUEST:
-        stat_name = "pkt6-request-received";
+        counter = PacketCounters.request_received_;
         break;
     case DHCPV6_CONFIRM:
-        stat_name = "pkt6-confirm-received";
-        break;
+        // Not initialized during the startup so not registered
+        StatsMgr::instance().addValue("pkt6-confirm-received",
+                                      static_cast<int64_t>(1));
+        return;
     case DHCPV6_RENEW:
-        stat_name = "pkt6-renew-received";
+        counter = PacketCounters.renew_received_;
         break;
     case DHCPV6_REBIND:
-        stat_name = "pkt6-rebind-received";
+        counter = PacketCounters.rebind_received_;
         break;
     case DHCPV6_REPLY:
         // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-reply-received";
+        counter = PacketCounters.reply_received_;
         break;
     case DHCPV6_RELEASE:
-        stat_name = "pkt6-release-received";
+        counter = PacketCounters.release_received_;
         break;
     case DHCPV6_DECLINE:
-        stat_name = "pkt6-decline-received";
+        counter = PacketCounters.decline_received_;
         break;
     case DHCPV6_RECONFIGURE:
-        stat_name = "pkt6-reconfigure-received";
-        break;
+        // Not initialized during the startup so not registered
+        StatsMgr::instance().addValue("pkt6-reconfigure-received",
+                                      static_cast<int64_t>(1));
+        return;
     case DHCPV6_INFORMATION_REQUEST:
-        stat_name = "pkt6-infrequest-received";
+        counter = PacketCounters.infrequest_received_;
         break;
     case DHCPV6_DHCPV4_QUERY:
-        stat_name = "pkt6-dhcpv4-query-received";
+        counter = PacketCounters.dhcpv4_query_received_;
         break;
     case DHCPV6_DHCPV4_RESPONSE:
         // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-dhcpv4-response-received";
+        counter = PacketCounters.dhcpv4_response_received_;
         break;
     default:
             ; // do nothing
     }
 
-    StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
+    counter->add();
 }
 
 void Dhcpv6Srv::processStatsSent(const Pkt6Ptr& response) {
     // Increase generic counter for sent packets.
-    StatsMgr::instance().addValue("pkt6-sent", static_cast<int64_t>(1));
+    PacketCounters.sent_->add();
 
     // Increase packet type specific counter for packets sent.
-    string stat_name;
+    StatCounterPtr counter;
     switch (response->getType()) {
     case DHCPV6_ADVERTISE:
-        stat_name = "pkt6-advertise-sent";
+        counter = PacketCounters.advertise_sent_;
         break;
     case DHCPV6_REPLY:
-        stat_name = "pkt6-reply-sent";
+        counter = PacketCounters.reply_sent_;
         break;
     case DHCPV6_DHCPV4_RESPONSE:
-        stat_name = "pkt6-dhcpv4-response-sent";
+        counter = PacketCounters.dhcpv4_response_sent_;
         break;
     default:
         // That should never happen
         return;
     }
 
-    StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
+    counter->add();
 }
 
 int Dhcpv6Srv::getHookIndexBuffer6Send() {
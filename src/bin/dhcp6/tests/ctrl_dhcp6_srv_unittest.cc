@@ -22,6 +22,7 @@
 #include <testutils/unix_control_client.h>
 #include <testutils/sandbox.h>
 #include <util/boost_time_utils.h>
+#include <util/trace_mgr.h>
 
 #include "marker_file.h"
 #include "test_libraries.h"
@@ -503,12 +504,14 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"config-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-write\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"hooks-stats-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"leases-reclaim\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"libreload\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"server-tag-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"shutdown\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get-all\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"statistic-get-all-prometheus\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-reset\"") != string::npos);
@@ -518,6 +521,9 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"status-get\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"trace-get\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"trace-start\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"trace-stop\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"version-get\"") != string::npos);
 
     // Ok, and now delete the server. It should deregister its commands.
@@ -982,6 +988,52 @@ TEST_F(CtrlChannelDhcpv6SrvTest, serverTagGet) {
     expected = "{ \"arguments\": { \"server-tag\": \"foobar\" }, \"result\": 0 }";
 }
 
+// This test verifies that the DHCP server handles trace-start, trace-stop
+// and trace-get commands.
+TEST_F(CtrlChannelDhcpv6SrvTest, trace) {
+    createUnixChannelServer();
+    std::string response_txt;
+
+    sendUnixCommand("{ \"command\": \"trace-start\" }", response_txt);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"Tracing started.\" }",
+              response_txt);
+    EXPECT_TRUE(isc::util::TraceMgr::instance().isEnabled());
+
+    // Record an event as a trace point does.
+    {
+        isc::util::ScopedTraceContext context(1234);
+        isc::util::ScopedTrace trace("test-event");
+    }
+
+    sendUnixCommand("{ \"command\": \"trace-stop\" }", response_txt);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"Tracing stopped.\" }",
+              response_txt);
+    EXPECT_FALSE(isc::util::TraceMgr::instance().isEnabled());
+
+    sendUnixCommand("{ \"command\": \"trace-get\" }", response_txt);
+    ConstElementPtr response;
+    ASSERT_NO_THROW(response = Element::fromJSON(response_txt));
+    ConstElementPtr result = response->get("result");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(0, result->intValue());
+    ConstElementPtr arguments = response->get("arguments");
+    ASSERT_TRUE(arguments);
+    ConstElementPtr events = arguments->get("traceEvents");
+    ASSERT_TRUE(events);
+    ASSERT_EQ(Element::list, events->getType());
+
+    // The event recorded by this thread must be present.
+    bool found = false;
+    for (auto event : events->listValue()) {
+        if (event->get("name")->stringValue() == "test-event") {
+            EXPECT_EQ(1234, event->get("args")->get("id")->intValue());
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found);
+    isc::util::TraceMgr::instance().clear();
+}
+
 // This test verifies that the DHCP server handles config-backend-pull command
 TEST_F(CtrlChannelDhcpv6SrvTest, configBackendPull) {
     createUnixChannelServer();
@@ -1137,7 +1189,13 @@ TEST_F(CtrlChannelDhcpv6SrvTest, controlChannelStats) {
         "pkt6-reply-sent",
         "pkt6-dhcpv4-response-sent",
         "pkt6-parse-failed",
-        "pkt6-receive-drop"
+        "pkt6-receive-drop",
+        "pkt6-latency",
+        "pkt6-unpack-time",
+        "pkt6-classify-time",
+        "pkt6-subnet-select-time",
+        "pkt6-allocate-time",
+        "pkt6-pack-time"
     };
 
     std::ostringstream s;
@@ -1156,6 +1214,13 @@ TEST_F(CtrlChannelDhcpv6SrvTest, controlChannelStats) {
 
     EXPECT_EQ(stats_get_all, response);
 
+    // Check statistic-get-all-prometheus
+    sendUnixCommand("{ \"command\" : \"statistic-get-all-prometheus\", "
+                    "  \"arguments\": {}}", response);
+    EXPECT_EQ(0U, response.find("{ \"result\": 0, \"text\": \"# TYPE kea_pkt6_"));
+    EXPECT_NE(std::string::npos,
+              response.find("\\nkea_pkt6_received 0\\n"));
+
     // Check statistic-reset
     sendUnixCommand("{ \"command\" : \"statistic-reset\", "
                     "  \"arguments\": {"
@@ -1231,6 +1296,7 @@ TEST_F(CtrlChannelDhcpv6SrvTest, listCommands) {
     checkListCommands(rsp, "config-test");
     checkListCommands(rsp, "config-write");
     checkListCommands(rsp, "list-commands");
+    checkListCommands(rsp, "hooks-stats-get");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
     checkListCommands(rsp, "version-get");
@@ -1238,6 +1304,7 @@ TEST_F(CtrlChannelDhcpv6SrvTest, listCommands) {
     checkListCommands(rsp, "shutdown");
     checkListCommands(rsp, "statistic-get");
     checkListCommands(rsp, "statistic-get-all");
+    checkListCommands(rsp, "statistic-get-all-prometheus");
     checkListCommands(rsp, "statistic-remove");
     checkListCommands(rsp, "statistic-remove-all");
     checkListCommands(rsp, "statistic-reset");
@@ -1246,6 +1313,9 @@ TEST_F(CtrlChannelDhcpv6SrvTest, listCommands) {
     checkListCommands(rsp, "statistic-sample-age-set-all");
     checkListCommands(rsp, "statistic-sample-count-set");
     checkListCommands(rsp, "statistic-sample-count-set-all");
+    checkListCommands(rsp, "trace-get");
+    checkListCommands(rsp, "trace-start");
+    checkListCommands(rsp, "trace-stop");
 }
 
 // Tests if config-write can be called without any parameters.
@@ -309,6 +309,23 @@ TEST(ParserTest, globalParameters) {
     EXPECT_NO_THROW(parser.checkKeywords(parser.GLOBAL6_PARAMETERS, json));
 }
 
+// Check that background-reclamation is accepted in expired-leases-processing.
+TEST(ParserTest, backgroundReclamation) {
+    string txt = "{ \"Dhcp6\": { \"expired-leases-processing\": {"
+        " \"background-reclamation\": true, \"max-reclaim-leases\": 100 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    Parser6Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser6Context::PARSER_DHCP6));
+    ConstElementPtr tmp = json->get("Dhcp6")->get("expired-leases-processing");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("background-reclamation");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::boolean, tmp->getType());
+    EXPECT_TRUE(tmp->boolValue());
+}
+
 /// @brief Tests error conditions in Dhcp6Parser
 ///
 /// @param txt text to be parsed
@@ -598,6 +615,109 @@ TEST(ParserTest, errors) {
               "(previous at <string>:2:19)");
 }
 
+// Check that the write-behind cache parameters are accepted in
+// lease-database.
+TEST(ParserTest, writeBehindCache) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"mysql\", \"name\": \"keatest\","
+        " \"write-behind-cache\": true, \"write-back-latency\": 50,"
+        " \"cache-journal\": \"/tmp/kea-leases6.journal\" } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    Parser6Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser6Context::PARSER_DHCP6));
+    ConstElementPtr db = json->get("Dhcp6")->get("lease-database");
+    ASSERT_TRUE(db);
+
+    ConstElementPtr tmp = db->get("write-behind-cache");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::boolean, tmp->getType());
+    EXPECT_TRUE(tmp->boolValue());
+
+    tmp = db->get("write-back-latency");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::integer, tmp->getType());
+    EXPECT_EQ(50, tmp->intValue());
+
+    tmp = db->get("cache-journal");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::string, tmp->getType());
+    EXPECT_EQ("/tmp/kea-leases6.journal", tmp->stringValue());
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"write-behind-cache\": true } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.34-53: got unexpected keyword "
+              "\"write-behind-cache\" in hosts-database map.");
+}
+
+// Check that the lease reuse parameters are accepted at the global,
+// shared network and subnet levels.
+TEST(ParserTest, leaseCaching) {
+    string txt = "{ \"Dhcp6\": { \"cache-threshold\": 0.25,"
+        " \"cache-max-age\": 1000,"
+        " \"shared-networks\": [ { \"name\": \"foo\","
+        " \"cache-threshold\": 0.5, \"cache-max-age\": 2000,"
+        " \"subnet6\": [ { \"subnet\": \"2001:db8::/64\","
+        " \"cache-threshold\": 0.1, \"cache-max-age\": 3000 } ] } ] } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    Parser6Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser6Context::PARSER_DHCP6));
+    ConstElementPtr global = json->get("Dhcp6");
+    ASSERT_TRUE(global);
+    ConstElementPtr network = global->get("shared-networks")->get(0);
+    ASSERT_TRUE(network);
+    ConstElementPtr subnet = network->get("subnet6")->get(0);
+    ASSERT_TRUE(subnet);
+
+    ConstElementPtr tmp = global->get("cache-threshold");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::real, tmp->getType());
+    EXPECT_DOUBLE_EQ(0.25, tmp->doubleValue());
+    tmp = network->get("cache-max-age");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::integer, tmp->getType());
+    EXPECT_EQ(2000, tmp->intValue());
+    tmp = subnet->get("cache-threshold");
+    ASSERT_TRUE(tmp);
+    EXPECT_DOUBLE_EQ(0.1, tmp->doubleValue());
+    tmp = subnet->get("cache-max-age");
+    ASSERT_TRUE(tmp);
+    EXPECT_EQ(3000, tmp->intValue());
+}
+
+// Check that read-replicas is accepted in lease-database and
+// hosts-database.
+TEST(ParserTest, readReplicas) {
+    string txt = "{ \"Dhcp6\": {"
+        " \"lease-database\": { \"type\": \"mysql\", \"name\": \"keatest\","
+        " \"read-replicas\": \"192.0.2.2,192.0.2.3\" },"
+        " \"hosts-database\": { \"type\": \"postgresql\","
+        " \"name\": \"keatest\","
+        " \"read-replicas\": \"192.0.2.4\" } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    Parser6Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser6Context::PARSER_DHCP6));
+    ConstElementPtr tmp = json->get("Dhcp6")->get("lease-database");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("read-replicas");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::string, tmp->getType());
+    EXPECT_EQ("192.0.2.2,192.0.2.3", tmp->stringValue());
+
+    tmp = json->get("Dhcp6")->get("hosts-database");
+    ASSERT_TRUE(tmp);
+    tmp = tmp->get("read-replicas");
+    ASSERT_TRUE(tmp);
+    ASSERT_EQ(Element::string, tmp->getType());
+    EXPECT_EQ("192.0.2.4", tmp->stringValue());
+}
+
 // Check unicode escapes
 TEST(ParserTest, unicodeEscapes) {
     ConstElementPtr result;
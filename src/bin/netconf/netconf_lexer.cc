@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 63
-#define YY_END_OF_BUFFER 64
+#define YY_NUM_RULES 69
+#define YY_END_OF_BUFFER 70
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,49 +700,55 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[373] =
+static const flex_int16_t yy_accept[429] =
     {   0,
-       56,   56,    0,    0,    0,    0,    0,    0,    0,    0,
-       64,   62,   10,   11,   62,    1,   56,   53,   56,   56,
-       62,   55,   54,   62,   62,   62,   62,   62,   49,   50,
-       62,   62,   62,   51,   52,    5,    5,    5,   62,   62,
-       62,   10,   11,    0,    0,   45,    0,    0,    0,    0,
+       62,   62,    0,    0,    0,    0,    0,    0,    0,    0,
+       70,   68,   10,   11,   68,    1,   62,   59,   62,   62,
+       68,   61,   60,   68,   68,   68,   68,   68,   55,   56,
+       68,   68,   68,   57,   58,    5,    5,    5,   68,   68,
+       68,   10,   11,    0,    0,   51,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    1,   56,   56,    0,   55,   56,    3,    2,
-        6,    0,   56,    0,    0,    0,    0,    0,    0,    4,
-        0,    0,    9,    0,   46,    0,    0,    0,    0,   48,
+        0,    0,    0,    0,    1,   62,   62,    0,   61,    3,
+        2,    6,    0,   62,    0,    0,    0,    0,    0,    0,
+        4,    0,    0,    9,   52,    0,    0,    0,    0,   54,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,   47,    0,    0,
-       22,    0,    0,   21,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   61,   59,    0,   58,
-       57,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    8,    0,    0,    0,   53,    0,    0,
+        0,   22,    0,    0,   21,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   67,   65,
+        0,   64,   63,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   60,   57,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   26,    0,    0,    0,
-        0,    0,    0,   36,    0,    0,    0,    0,    0,    0,
-        0,   25,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   19,   20,   39,    0,    0,    0,    0,    0,
-        0,   23,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    7,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   41,   38,    0,    0,    0,    0,    0,
-       27,    0,    0,    0,   34,   12,    0,   14,    0,    0,
-        0,   32,   35,    0,   40,    0,    0,   42,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   66,   63,    0,    0,    0,
 
-        0,    0,   44,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   43,    0,    0,    0,   33,    0,
-        0,   30,    0,    0,    0,   15,    0,    0,    0,    0,
+        0,   26,    0,    0,    0,    0,    0,    0,   36,    0,
+        0,    0,    0,    0,    0,    0,    0,   25,    0,    0,
+        0,    0,    0,    0,   43,    0,    0,    0,    0,    0,
+       19,   20,   39,    0,    0,    0,    0,    0,    0,   23,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        7,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   41,   38,    0,    0,    0,    0,
+        0,    0,   27,    0,    0,    0,   34,   12,    0,    0,
+        0,   14,    0,    0,    0,   32,   35,    0,   40,    0,
+
+        0,   42,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       50,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   46,    0,    0,
+        0,   33,   48,    0,    0,    0,    0,   30,    0,    0,
+        0,    0,    0,   15,    0,    0,    0,    0,    0,    0,
        29,   28,    0,    0,    0,    0,    0,    0,    0,    0,
-       13,    0,    0,    0,    0,    0,    0,    0,   24,    0,
-        0,   37,    0,    0,   31,   18,    0,    0,    0,   17,
-       16,    0
+        0,    0,    0,    0,   13,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   45,    0,   24,    0,
+
+        0,   37,    0,    0,    0,    0,    0,   31,   18,    0,
+        0,    0,    0,   44,    0,    0,    0,   17,    0,    0,
+       16,    0,    0,   49,    0,    0,   47,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -759,8 +765,8 @@ static const YY_CHAR yy_ec[256] =
        32,   33,   34,    5,   35,    5,   36,   37,   38,   39,
 
        40,   41,   42,   43,   44,    5,   45,   46,   47,   48,
-       49,   50,    5,   51,   52,   53,   54,   55,    5,   56,
-       57,   58,   59,    5,   60,    5,    5,    5,    5,    5,
+       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+       59,   60,   61,    5,   62,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -777,682 +783,389 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[61] =
+static const YY_CHAR yy_meta[63] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    5,    6,    6,    6,    6,    3,    3,    3,
-        3,    6,    6,    6,    6,    3,    3,    3,    3,    3,
-        3,    3,    5,    3,    3,    6,    7,    6,    6,    6,
-        7,    3,    3,    3,    3,    3,    3,    5,    3,    3,
-        5,    3,    5,    5,    3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1
     } ;
 
-static const flex_int16_t yy_base[386] =
+static const flex_int16_t yy_base[429] =
     {   0,
-        0,    0,   59,   62,   65,    0,   63,   67,   47,   64,
-      291, 2525,   84,  286,  125,    0,  105, 2525,  120,  125,
-       85,  169, 2525,  262,  139,   65,   69,   82, 2525, 2525,
-       80,   84,  118, 2525, 2525, 2525,   92,  269,  230,    0,
-      256,  110,  270,   97,  186, 2525,  193,  199,  197,  210,
-      219,  234,  255,  263,  269,  278,  284,  291,  297,  303,
-      320,  338,    0,  345,  363,  375,  381,  385, 2525,    0,
-     2525,  332,  349,  121,  144,  128,  152,  171,  160, 2525,
-      222,  248, 2525,  198, 2525,  169,  405,  411,  209,  417,
-      451,  428,  439,  450,  478,  493,  499,  506,  512,  518,
-
-      532,  540,  546,  552,  574,  586,  594,  602,  608,  622,
-      630,  647,  663,  669,    0,  177,  181,  184,  189,  207,
-      204,  130, 2525,    0,  675,  681,  155, 2525,  706,  703,
-     2525,  691,  731, 2525,  747,  756,  764,  770,  776,  784,
-      790,  818,  827,  835,  841,  847,  855,  861,  870,  883,
-      898,  905,  916,  923,  931,  222, 2525, 2525,  223, 2525,
-     2525,  103,    0,  938,  952,  988,  959,  975,  985, 1029,
-     1036, 1042, 1048, 1054, 1062, 1071, 1077, 1087, 1100, 1106,
-     1112, 1120, 1126, 1135, 1145, 1154, 1160, 1178, 1189, 1196,
-     1202, 2525, 2525,  104,    0, 1217, 1224, 1259, 1231, 1245,
-
-     1237, 1257, 1286, 1303, 1309, 1315, 2525, 1321, 1327, 1337,
-     1343, 1349, 1355, 2525, 1361, 1378, 1384, 1390, 1396, 1403,
-     1418, 2525, 1424, 1437,   64,    0, 1444, 1452, 1458, 1465,
-     1473, 1481, 2525, 2525, 2525, 1493, 1499, 1509, 1521, 1532,
-     1542, 2525, 1549, 1556, 1565, 1575, 1584, 1590, 1598, 1604,
-     1613, 2525, 1619, 1632, 1638, 1648, 1656, 1667, 1673, 1681,
-     1690, 1696, 1702, 2525, 2525, 1709, 1724, 1718, 1730, 1737,
-     2525, 1743, 1753, 1759, 2525, 2525, 1771, 2525, 1765, 1794,
-     1807, 2525, 2525, 1813, 2525, 1819, 1827, 2525, 1835, 1847,
-     1853, 1860, 1869, 1886, 1893, 1911, 1919, 1926, 1932, 1940,
-
-     1948, 1954, 2525, 1960, 1976, 1983, 1989, 2002, 2011, 2017,
-     2030, 2037, 2045, 2052, 2058, 2071, 2081, 2087, 2093, 2104,
-     2110, 2116, 2122, 2128, 2525, 2138, 2144, 2151, 2525, 2161,
-     2173, 2525, 2179, 2185, 2195, 2525, 2201, 2207, 2213, 2223,
-     2525, 2525, 2241, 2256, 2262, 2278, 2284, 2290, 2296, 2302,
-     2525, 2312, 2319, 2331, 2337, 2354, 2360, 2366, 2525, 2372,
-     2378, 2525, 2389, 2395, 2525, 2525, 2406, 2412, 2418, 2525,
-     2525, 2525, 2458, 2465, 2472, 2479, 2486, 2493, 2500, 2504,
-     2509, 2511, 2513, 2515, 2517
+       63,    1,  125,    1,  182,    1,  184,    1,  196,    1,
+      203,    1,  206,  201,  244,  306,  357,    1,  204,  217,
+      227,    1,    1,  184,  368,  189,  182,  187,    1,    1,
+      188,  172,  186,    1,    1,    1,    1,  228,  194,  391,
+      289,    1,    1,  453,  490,    1,  321,  335,  546,  323,
+      329,  483,  594,  334,  337,  345,  485,  351,  333,  354,
+      482,  570,  472,  486,    1,    1,    1,    1,    1,    1,
+      634,    1,  602,    1,  498,  586,  666,  477,  484,  480,
+        1,  503,  608,    1,    1,  692,  573,  562,  701,    1,
+      756,  558,  569,  614,  574,  617,  589,  589,  573,  580,
+
+      576,  594,  591,  651,  661,  654,  652,  656,  657,  656,
+      675,  676,  679,  673,  678,  673,  695,  697,  696,  669,
+      680,  687,  682,    1,  784,  688,  693,    1,  812,  684,
+      681,    1,  690,  685,    1,  686,  695,  697,  706,  702,
+      702,  718,  725,  710,  724,  725,  717,  732,  715,  734,
+      735,  731,  728,  729,  725,  732,  741,  762,    1,    1,
+      747,    1,    1,  733,  840,  745,  741,  868,  753,  792,
+      764,  753,  768,  795,  770,  761,  809,  780,  777,  776,
+      775,  790,  785,  826,  778,  791,  799,  829,  789,  802,
+      788,  806,  839,  835,  808,    1,    1,  819,  896,  811,
+
+      812,  924,  855,  812,  820,  820,  824,  865,  866,  867,
+      863,    1,  823,  834,  847,  854,  836,  883,    1,  841,
+      856,  845,  852,  855,  846,  847,  850,    1,  865,  879,
+      876,  952,  875,  881,    1,  875,  901,  871,  881,  888,
+        1,    1,    1,  883,  884,  878,  905,  905,  944,    1,
+      946,  899,  906,  911,  902,  946,  952,  915,  921,  917,
+        1,  966,  967,  972,  924,  941,  976,  972,  928,  941,
+      980,  981,  983,  989,    1,    1,  947,  957,  992,  993,
+      941,  953,    1,  965,  955,  964,    1,    1,  965,  966,
+      973,    1,  957,  971,  975,    1,    1,  960,    1,  964,
+
+      963,    1,  972, 1011,  982,  960,  968,  981,  968, 1012,
+      973,  971,  973,  980,  984,  979,  992,  979,  981,  981,
+        1,  989,  987,  992, 1028, 1001, 1004, 1005, 1005, 1007,
+     1010, 1043, 1014,  999, 1008, 1047, 1048, 1015, 1016, 1051,
+     1020, 1022, 1018, 1016, 1052, 1058, 1059,    1, 1014, 1015,
+     1019,    1,    1, 1025, 1031, 1066, 1067,    1, 1031, 1023,
+     1042, 1030, 1028,    1, 1042, 1039, 1044, 1045, 1038, 1076,
+        1,    1, 1053, 1084, 1043, 1044, 1050, 1041, 1056, 1045,
+     1045, 1045, 1053, 1054,    1, 1061, 1099, 1100, 1101, 1055,
+     1057, 1105, 1072, 1073, 1072, 1075,    1, 1076,    1, 1111,
+
+     1112,    1, 1067, 1067, 1081, 1069, 1117,    1,    1, 1068,
+     1072, 1073, 1121,    1, 1092, 1093, 1124,    1, 1085, 1090,
+        1, 1127, 1094,    1, 1082, 1130,    1,    1
     } ;
 
-static const flex_int16_t yy_def[386] =
+static const flex_int16_t yy_def[429] =
     {   0,
-      372,    1,  373,  373,    1,    5,    5,    5,    5,    5,
-      372,  372,  372,  372,  374,  375,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  376,
-      372,  372,  372,  377,  374,  372,  374,  374,  378,  374,
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  375,  372,  372,  372,  372,  372,  372,  379,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  376,  372,  377,  372,  380,  374,  374,  381,  374,
-      378,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  374,  379,  372,  372,  372,  372,  372,
-      372,  372,  372,  382,  374,  374,  381,  372,  378,  374,
-      372,  374,  374,  372,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  374,  374,  372,  372,  372,  372,  372,
-      372,  372,  383,  374,  374,  378,  374,  374,  374,  374,
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  372,  372,  372,  384,  374,  374,  378,  374,  374,
-
-      374,  374,  374,  374,  374,  374,  372,  374,  374,  374,
-      374,  374,  374,  372,  374,  374,  374,  374,  374,  374,
-      374,  372,  374,  374,  372,  385,  374,  374,  374,  374,
-      374,  374,  372,  372,  372,  374,  374,  374,  374,  374,
-      374,  372,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  372,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  372,  372,  374,  374,  374,  374,  374,
-      372,  374,  374,  374,  372,  372,  374,  372,  374,  374,
-      374,  372,  372,  374,  372,  374,  374,  372,  374,  374,
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-
-      374,  374,  372,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  374,  374,  372,  374,  374,  374,  372,  374,
-      374,  372,  374,  374,  374,  372,  374,  374,  374,  374,
-      372,  372,  374,  374,  374,  374,  374,  374,  374,  374,
-      372,  374,  374,  374,  374,  374,  374,  374,  372,  374,
-      374,  372,  374,  374,  372,  372,  374,  374,  374,  372,
-      372,    0,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372
+      428,    1,  428,    3,    2,    5,    6,    7,    8,    9,
+      428,  428,  428,  428,  428,  428,  428,  428,   17,   19,
+      428,   19,  428,  428,  428,  428,  428,  428,  428,  428,
+       26,   27,   28,  428,  428,  428,   13,  428,  428,  428,
+      428,   37,   14,  428,   15,  428,   45,   45,  428,   45,
+       47,   51,   48,   45,   51,   51,   52,   45,   45,   58,
+       60,   59,   50,   61,   16,   20,   17,   25,   22,  428,
+      428,  428,   68,   73,  428,  428,  428,   75,   76,   77,
+      428,  428,   40,  428,  428,  428,   45,   45,   49,   45,
+       89,   90,   90,   90,   90,   94,   90,   90,   90,   93,
+
+       90,   97,   90,   90,   90,   90,  101,  107,  107,   90,
+       98,  105,  102,   90,   90,   90,  428,  428,  428,  117,
+      118,  119,  428,  428,  428,  103,  111,  428,   91,   90,
+      109,  428,  106,  131,  428,   99,   90,   90,   90,  137,
+       90,  126,   90,  138,  115,  145,  140,  143,  134,  146,
+      150,  139,  100,  138,   90,  141,  114,  428,  428,  428,
+      158,  428,  428,  428,  428,  157,  153,  129,  127,   90,
+      151,  156,  142,   90,   90,  154,   96,  148,  171,  173,
+      166,  179,  116,  177,  136,  133,  182,  170,  172,  187,
+      185,  169,  184,  188,  112,  428,  428,  428,  428,  130,
+
+      200,  168,  194,  191,  201,  167,  183,  193,  208,  209,
+      194,  428,  189,  213,  190,  215,  214,  210,  428,  149,
+      215,  217,  207,  181,  220,  225,  222,  428,  192,  178,
+      428,  428,  180,  233,  428,  206,  234,  226,  223,  221,
+      428,  428,  428,  239,  244,  176,  195,  240,  218,  428,
+      249,  238,  205,  224,  252,  211,  249,  254,  206,  255,
+      428,  257,  262,  263,  204,  247,  263,  256,  264,  258,
+      267,  271,  268,  272,  428,  428,  259,  248,  274,  279,
+      245,  265,  428,  281,  253,  278,  428,  428,  286,  289,
+      230,  428,  246,  290,  284,  428,  428,  293,  428,  237,
+
+      227,  428,  270,  279,  291,  281,  301,  294,  260,  273,
+      307,  265,  309,  277,  244,  311,  308,  313,  298,  318,
+      428,  280,  300,  315,  310,  317,  326,  327,  326,  329,
+      327,  304,  305,  316,  303,  332,  336,  330,  338,  336,
+      331,  341,  342,  324,  325,  340,  346,  428,  334,  349,
+      314,  428,  428,  335,  354,  346,  356,  428,  343,  320,
+      333,  351,  319,  428,  339,  354,  365,  367,  368,  345,
+      428,  428,  361,  357,  369,  375,  366,  360,  367,  349,
+      363,  378,  322,  375,  428,  384,  374,  387,  387,  381,
+      390,  389,  379,  393,  386,  394,  428,  396,  428,  392,
+
+      400,  428,  380,  391,  398,  404,  401,  428,  428,  350,
+      406,  411,  407,  428,  373,  415,  413,  428,  344,  395,
+      428,  417,  405,  428,  412,  422,  428,    0
     } ;
 
-static const flex_int16_t yy_nxt[2586] =
+static const flex_int16_t yy_nxt[1193] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   25,   26,   12,   27,   12,   12,   28,
-       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
-       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
-       12,   12,   33,   12,   12,   12,   12,   12,   34,   35,
-       37,   14,   37,   37,   14,   37,   38,   41,   40,   38,
-       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   41,   42,   74,   42,   12,   12,
-       12,   12,   69,   42,   12,   42,   12,   70,   12,   75,
-
-       74,   74,   85,  252,   12,   12,   12,   12,   39,   76,
-       12,   42,   12,   42,   75,   77,   64,   12,   65,   65,
-       65,   65,   75,   12,   12,   44,   44,   44,   66,   86,
-       46,   64,   76,   67,   67,   67,   67,   78,   68,   68,
-       68,   68,  225,   66,   66,   76,  116,   72,   66,   72,
-       47,   48,   73,   73,   73,   73,  194,   49,  118,   66,
-      128,   50,   51,   52,   66,   53,  116,   54,   79,  117,
-       55,   56,   57,   58,   59,  162,   60,  116,   61,   62,
-       64,  118,   67,   67,   67,   67,   44,   44,   44,  117,
-      118,   46,   66,   44,   44,   44,  117,  119,   46,   44,
-
-       44,   44,   90,   85,   46,  156,  157,  158,   66,   45,
-       44,   44,   44,  121,  128,   46,  120,  156,   49,   44,
-       44,   44,  124,  158,   46,   49,  157,  158,  156,   45,
-       86,   49,  157,   45,   44,   44,   44,   45,   88,   46,
-      159,   87,   49,  161,   45,  192,  192,   45,   95,   45,
-       91,   49,  160,  123,   93,   44,   44,   44,   92,  122,
-       46,  192,  193,   44,   44,   44,   49,   94,   46,   44,
-       44,   44,   43,   96,   46,   83,   97,   81,   44,   44,
-       44,   80,   71,   46,   44,   44,   44,   49,   43,   46,
-      372,   44,   44,   44,  372,   49,   46,   44,   44,   44,
-
-       98,   49,   46,   44,   44,   44,  372,  372,   46,  372,
-       49,   99,  101,  103,  372,  100,   49,  102,  372,  105,
-       44,   44,   44,   49,  372,   46,  104,  372,  372,   49,
-      372,  372,  107,  372,  372,   49,  372,  372,   44,   44,
-       44,  372,  108,   46,  106,   73,   73,   73,   73,  372,
-      372,  109,   49,  372,  372,  110,  111,  372,   68,   68,
-       68,   68,   73,   73,   73,   73,  372,  112,   66,  372,
-       49,  113,  372,  114,   64,  372,   65,   65,   65,   65,
-      372,  372,  372,   72,   66,   72,   66,  372,   73,   73,
-       73,   73,   64,  372,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   66,  372,   66,   44,   44,   44,   66,  372,
-       46,   44,   44,   44,  372,  372,   46,   44,   44,   44,
-       66,  372,   46,  372,   66,  372,  372,  372,   44,   44,
-       44,  372,  372,   46,  372,  372,  372,   49,  372,   44,
-       44,   44,  372,   49,  131,  372,  125,  372,  372,   49,
-       44,   44,   44,  372,  372,   46,  372,  372,  372,  372,
-       49,  372,  372,  126,  129,  129,  129,  129,  372,  372,
-      372,   49,  129,  129,  129,  129,  130,  372,   44,   44,
-       44,  372,   49,  134,  372,  372,  129,  129,  129,  129,
-      129,  129,  372,   44,   44,   44,  132,  133,   46,   44,
-
-       44,   44,  372,  372,   46,  372,   44,   44,   44,  372,
-       49,   46,   44,   44,   44,  372,  372,   46,   44,   44,
-       44,  372,  372,   46,  372,   49,  372,  372,  372,  135,
-      372,   49,   44,   44,   44,  372,  136,   46,   49,  372,
-       44,   44,   44,  372,   49,   46,   44,   44,   44,  372,
-       49,   46,   44,   44,   44,  372,  372,   46,  372,  137,
-      138,  372,  372,  372,   49,  372,  372,  372,  140,  372,
-      139,  372,   49,  372,   44,   44,   44,  372,   49,   46,
-      372,  141,  372,  372,   49,  372,   44,   44,   44,  372,
-      144,   46,  372,  142,   44,   44,   44,  372,  372,   46,
-
-      372,  143,   44,   44,   44,  372,   49,   46,   44,   44,
-       44,  372,  372,   46,  372,  372,  372,  372,   49,  372,
-      145,  372,   44,   44,   44,  372,   49,   46,  372,  372,
-       44,   44,   44,  372,   49,   46,  372,  372,  146,  372,
-       49,  372,  372,  372,  147,  150,  148,   44,   44,   44,
-      372,  372,   46,  372,   49,  372,  149,  372,  372,  372,
-      151,  372,   49,   44,   44,   44,  152,  372,   46,   44,
-       44,   44,  372,  372,   46,   44,   44,   44,  372,   49,
-       46,   44,   44,   44,  372,  372,   46,  372,  372,  372,
-      153,   44,   44,   44,  372,   49,   46,  372,  372,  372,
-
-      372,   49,  154,   44,   44,   44,  372,   49,   46,  372,
-      372,  372,  372,   49,  155,  372,  164,  372,  165,  166,
-      166,  166,  166,   49,  372,  372,  372,  166,  166,  166,
-      166,   44,   44,   44,  372,   49,   46,  168,  372,  372,
-      372,  166,  166,  166,  166,  166,  166,   44,   44,   44,
-      372,  372,   46,  372,  372,  167,   44,   44,   44,  372,
-      372,   46,  372,   49,   44,   44,   44,  372,  372,   46,
-       44,   44,   44,  372,  372,   46,   44,   44,   44,   49,
-      372,   46,  372,  169,   44,   44,   44,  372,   49,   46,
-       44,   44,   44,  372,  372,   46,   49,  372,  372,  372,
-
-      170,  372,   49,  372,  372,  171,  372,  372,   49,  372,
-      372,  372,  372,  372,  173,  172,   49,  372,   44,   44,
-       44,  372,   49,   46,  372,  174,  372,   44,   44,   44,
-      372,  176,   46,  372,  175,   44,   44,   44,  372,  372,
-       46,   44,   44,   44,  372,  372,   46,   44,   44,   44,
-       49,  372,   46,  177,  372,   44,   44,   44,  372,   49,
-       46,   44,   44,   44,  372,  372,   46,   49,  372,  372,
-       44,   44,   44,   49,  180,   46,  372,  372,  178,   49,
-      181,  179,  372,   44,   44,   44,  372,   49,   46,  372,
-      183,  372,  372,   49,  372,  372,  182,  372,   44,   44,
-
-       44,  372,   49,   46,  372,   44,   44,   44,  372,  185,
-       46,  372,  372,  184,  372,   49,   44,   44,   44,  372,
-      372,   46,  372,   44,   44,   44,  372,  186,   46,  372,
-       49,   44,   44,   44,  372,  372,   46,   49,   44,   44,
-       44,  372,  372,   46,  372,  372,  187,  372,   49,  372,
-      372,  372,   44,   44,   44,   49,  188,   46,  372,   44,
-       44,   44,  372,   49,   46,  372,  372,  372,  372,  199,
-       49,  189,  372,  190,  191,   44,   44,   44,  372,  372,
-       46,  196,  372,  372,   49,   44,   44,   44,  372,  372,
-       46,   49,  372,  372,  372,  372,  372,  372,  372,  372,
-
-      197,  198,  198,  198,  198,  372,  372,   49,  372,  198,
-      198,  198,  198,  372,  200,  372,  372,   49,  372,  372,
-      372,  372,  372,  198,  198,  198,  198,  198,  198,   44,
-       44,   44,  372,  372,   46,  201,   44,   44,   44,  372,
-      372,   46,   44,   44,   44,  372,  372,   46,   44,   44,
-       44,  203,  204,   46,   44,   44,   44,  372,  372,  207,
-      372,   49,   44,   44,   44,  372,  372,   46,   49,  372,
-      202,   44,   44,   44,   49,  372,   46,   44,   44,   44,
-       49,  372,   46,  372,  205,  372,   49,   44,   44,   44,
-      372,  372,   46,  372,   49,  372,  372,  208,  372,  206,
-
-       44,   44,   44,   49,  372,   46,   44,   44,   44,   49,
-      209,   46,   44,   44,   44,  372,  372,  214,  210,   49,
-       44,   44,   44,  372,  372,   46,   44,   44,   44,  372,
-      211,   46,   49,  372,  372,   44,   44,   44,   49,  212,
-       46,  372,  372,  372,   49,   44,   44,   44,  372,  372,
-       46,  213,   49,  372,   44,   44,   44,  372,   49,   46,
-       44,   44,   44,  372,  372,   46,  372,   49,  372,  372,
-      372,  372,  216,  215,  217,  372,  372,   49,   44,   44,
-       44,  372,  372,   46,  372,  372,   49,  372,  372,   44,
-       44,   44,   49,  219,  222,  218,   44,   44,   44,  372,
-
-      372,   46,   44,   44,   44,  372,  223,   46,  372,  372,
-       49,  372,  372,  220,  372,  221,  372,   44,   44,   44,
-      372,   49,   46,  372,   44,   44,   44,  372,   49,   46,
-      372,   44,   44,   44,   49,  372,   46,   44,   44,   44,
-      224,  372,   46,  372,  372,   44,   44,   44,  372,   49,
-       46,  372,  372,  372,  372,  372,   49,   44,   44,   44,
-      372,  372,   46,   49,  227,  372,  372,  372,  372,   49,
-      372,  228,   45,   45,   45,   45,  372,   49,  372,  372,
-       45,   45,   45,   45,  229,  231,   44,   44,   44,   49,
-      372,  233,  230,  372,   45,   45,   45,   45,   45,   45,
-
-      372,  372,  232,   44,   44,   44,  372,  372,  234,   44,
-       44,   44,  372,  372,  235,   44,   44,   44,   49,  372,
-       46,   44,   44,   44,  372,  236,   46,   44,   44,   44,
-      372,  372,   46,  372,  372,   49,  372,   44,   44,   44,
-      372,   49,   46,   44,   44,   44,  372,   49,   46,   44,
-       44,   44,  372,   49,   46,   44,   44,   44,  372,   49,
-      242,   44,   44,   44,  372,  372,   46,  372,  372,   49,
-      372,  237,  372,  372,  372,   49,  239,  238,   44,   44,
-       44,   49,  372,   46,   44,   44,   44,   49,  372,   46,
-       44,   44,   44,   49,  372,   46,   44,   44,   44,  241,
-
-      240,   46,  372,   44,   44,   44,  372,  372,   46,  372,
-       49,  372,  372,  243,  372,  372,   49,  244,   44,   44,
-       44,  372,   49,   46,   44,   44,   44,  372,   49,   46,
-      372,  372,  372,  246,  245,   49,  372,   44,   44,   44,
-      372,  372,   46,  372,   44,   44,   44,  372,  247,   46,
-       49,  372,   44,   44,   44,  248,   49,   46,   44,   44,
-       44,  250,  372,   46,  372,   44,   44,   44,  249,   49,
-       46,  372,  251,   44,   44,   44,   49,  372,   46,  372,
-      372,   44,   44,   44,   49,  253,   46,  372,  372,  372,
-       49,  372,  254,   44,   44,   44,  372,   49,   46,   44,
-
-       44,   44,  372,  372,   46,   49,  372,  255,  372,   44,
-       44,   44,  372,   49,   46,  372,  372,  256,  257,  372,
-      258,   44,   44,   44,  372,   49,   46,  372,  372,  372,
-      372,   49,   44,   44,   44,  372,  372,   46,  259,  372,
-      372,   49,   44,   44,   44,  372,  372,  264,  372,   44,
-       44,   44,  372,   49,  265,  260,   44,   44,   44,  262,
-      261,   46,  372,  372,   49,   44,   44,   44,  372,  372,
-       46,  263,  372,  372,   49,   44,   44,   44,  372,  372,
-       46,   49,  372,  266,   44,   44,   44,  372,   49,   46,
-       44,   44,   44,  372,  270,  271,  372,   49,   44,   44,
-
-       44,  372,  372,   46,   44,   44,   44,   49,  267,   46,
-      372,  372,  268,   44,   44,   44,   49,  372,   46,   44,
-       44,   44,   49,  372,  275,  372,  372,  269,  372,  372,
-       49,  372,   44,   44,   44,  372,   49,  276,   44,   44,
-       44,  272,  372,   46,  372,   49,  372,  372,   44,   44,
-       44,   49,  273,  278,  372,  372,   44,   44,   44,  372,
-      372,   46,  372,  372,   49,  274,  279,   44,   44,   44,
-       49,  372,   46,   44,   44,   44,  277,  372,   46,  372,
-       49,   44,   44,   44,  372,  372,  282,  372,   49,  372,
-       44,   44,   44,  372,  372,  283,   44,   44,   44,   49,
-
-      372,   46,   44,   44,   44,   49,  284,  285,  372,   44,
-       44,   44,  372,   49,   46,  372,  281,  372,   44,   44,
-       44,  280,   49,  288,   44,   44,   44,  372,   49,   46,
-       44,   44,   44,  372,   49,   46,  372,   44,   44,   44,
-      372,   49,   46,   44,   44,   44,  372,  372,   46,  372,
-       49,  372,  372,   44,   44,   44,   49,  286,   46,   44,
-       44,   44,   49,  287,   46,   44,   44,   44,  372,   49,
-       46,   44,   44,   44,  372,   49,   46,  372,  372,  293,
-      372,  372,  372,  372,  290,   49,  289,  372,  372,  291,
-      292,   49,  372,  372,   44,   44,   44,   49,  295,   46,
-
-      294,  372,  372,   49,  372,  372,  296,   44,   44,   44,
-      372,  372,   46,   44,   44,   44,  297,  372,   46,   44,
-       44,   44,  372,  372,   46,  372,   49,   44,   44,   44,
-      372,  372,   46,  298,  372,   44,   44,   44,  372,   49,
-      303,  372,  372,  299,  372,   49,  372,   44,   44,   44,
-      372,   49,   46,   44,   44,   44,  372,  372,   46,   49,
-       44,   44,   44,  372,  300,   46,  372,   49,  301,   44,
-       44,   44,  372,  372,   46,  372,  372,  302,  372,   49,
-      372,  372,  304,  372,  372,   49,   44,   44,   44,  372,
-      372,   46,   49,   44,   44,   44,  372,  372,   46,  372,
-
-      372,   49,  372,  309,  372,  372,  372,  372,  307,  305,
-      306,   44,   44,   44,  372,  372,   46,  372,   49,   44,
-       44,   44,  372,  372,   46,   49,   44,   44,   44,  372,
-      372,   46,   44,   44,   44,  372,  372,   46,  308,  372,
-       44,   44,   44,   49,  372,   46,  372,  372,   44,   44,
-       44,   49,  372,   46,   44,   44,   44,  372,   49,   46,
-       44,   44,   44,  310,   49,   46,  372,  311,  372,  372,
-      372,  312,   49,  372,  372,  372,   44,   44,   44,  314,
-       49,   46,  313,   44,   44,   44,   49,  372,   46,   44,
-       44,   44,   49,  372,   46,  372,  372,  372,  372,  320,
-
-      315,  372,   44,   44,   44,  316,  317,   46,   49,  372,
-      372,   44,   44,   44,  372,   49,   46,   44,   44,   44,
-      372,   49,   46,  372,  372,  318,  372,  372,  319,  372,
-       44,   44,   44,  372,   49,   46,  372,   44,   44,   44,
-      372,  321,  325,   49,  372,   44,   44,   44,  322,   49,
-       46,  372,   44,   44,   44,  372,  323,   46,   44,   44,
-       44,  372,   49,   46,  372,  372,  372,  324,  372,   49,
-      372,   44,   44,   44,  372,  372,  329,   49,  372,  372,
-      326,   44,   44,   44,   49,  372,   46,   44,   44,   44,
-       49,  372,   46,   44,   44,   44,  372,  372,  332,  372,
-
-      372,  328,  327,   49,   44,   44,   44,  372,  372,   46,
-       44,   44,   44,   49,  372,   46,   44,   44,   44,   49,
-      330,   46,   44,   44,   44,   49,  331,  336,   44,   44,
-       44,  372,  372,   46,  372,  372,   49,  372,   44,   44,
-       44,  333,   49,   46,   44,   44,   44,  372,   49,   46,
-      372,   44,   44,   44,   49,  372,   46,  372,  335,  372,
-       49,   44,   44,   44,  372,  334,  341,  372,  372,  372,
-       49,  372,  337,   44,   44,   44,   49,  372,  342,   44,
-       44,   44,  372,   49,   46,   44,   44,   44,  338,  372,
-       46,  372,  372,   49,  372,   44,   44,   44,  339,  340,
-
-       46,   44,   44,   44,  372,   49,   46,   44,   44,   44,
-      372,   49,   46,   44,   44,   44,  372,   49,   46,  372,
-      372,  343,  372,   44,   44,   44,  372,   49,   46,  372,
-      345,  372,  372,   49,  372,  372,  372,  344,  372,   49,
-      346,   44,   44,   44,  372,   49,   46,  372,  372,  372,
-      347,  372,  348,  372,  372,   49,   44,   44,   44,  372,
-      372,  351,   44,   44,   44,  372,  372,   46,  372,  372,
-      349,  372,  372,   49,  372,  372,  350,  372,   44,   44,
-       44,  372,  372,   46,   44,   44,   44,  372,   49,   46,
-       44,   44,   44,  372,   49,   46,   44,   44,   44,  372,
-
-      372,   46,   44,   44,   44,  372,  372,   46,  372,  352,
-       49,  372,   44,   44,   44,  372,   49,   46,  372,   44,
-       44,   44,   49,  354,  359,  372,  372,  372,   49,  372,
-      353,   44,   44,   44,   49,  372,   46,   44,   44,   44,
-      355,  372,   46,  372,   49,  372,  372,  356,  372,  357,
-      372,   49,  372,  358,   44,   44,   44,  372,  372,  362,
-       44,   44,   44,   49,  372,   46,   44,   44,   44,   49,
-      372,   46,   44,   44,   44,  372,  372,  365,   44,   44,
-       44,  372,  360,  366,  372,  372,   49,  372,  361,   44,
-       44,   44,   49,  372,   46,   44,   44,   44,   49,  372,
-
-       46,  363,  372,  372,   49,  364,   44,   44,   44,  372,
-       49,   46,   44,   44,   44,  372,  372,  370,   44,   44,
-       44,   49,  372,  371,  372,  372,  372,   49,  367,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,   49,  372,
-      372,  372,  372,  372,   49,  372,  368,  372,  372,  372,
-       49,  372,  372,  372,  372,  372,  372,  369,   36,   36,
-       36,   36,   36,   36,   36,   45,   45,   45,   45,   45,
-       45,   45,   63,  372,   63,   63,   63,   63,   63,   82,
-      372,   82,  372,   82,   82,   82,   84,   84,   84,   84,
-       84,   84,   84,   89,   89,   89,   89,   89,   89,   89,
-
-      115,  372,  115,  115,  115,  115,  115,   84,   84,  372,
-       84,  127,  127,  127,  127,  127,  163,  163,  195,  195,
-      226,  226,   84,   84,   11,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372
+       11,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,   12,   13,   14,   13,   12,   15,   16,
+       12,   17,   18,   19,   20,   21,   22,   22,   22,   22,
+       23,   24,   12,   12,   12,   12,   25,   26,   12,   27,
+       12,   12,   28,   12,   29,   12,   30,   12,   12,   12,
+
+       12,   12,   25,   31,   12,   12,   12,   12,   12,   12,
+       32,   12,   12,   12,   12,   12,   33,   12,   12,   12,
+       12,   12,   12,   34,   35,   36,   37,   14,   37,   36,
+       36,   36,   38,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   12,   12,   40,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,  428,   43,   72,   12,   12,   42,   12,   42,
+       75,   12,   76,   12,   77,   12,   41,   69,   69,   69,
+       69,   12,   12,   78,   75,   39,   79,   12,  428,   12,
+       66,   66,   66,   66,   70,   12,   76,   80,   77,   71,
+       81,   82,   12,   12,   44,   44,   44,   45,   45,   46,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
+       48,   45,   45,   45,   45,   45,   49,   45,   45,   50,
+       51,   52,   53,   45,   54,   45,   55,   45,   45,   56,
+       57,   58,   59,   60,   45,   61,   62,   45,   63,   64,
+
+       45,   45,   45,   45,   45,   45,   65,   65,   84,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   66,   87,
+       67,   67,   67,   67,   88,   92,   73,   93,   73,   99,
+       68,   74,   74,   74,   74,  100,  106,  107,  102,  108,
+      101,   83,   83,  103,   83,   83,   68,   83,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   44,   44,   44,   44,   44,   85,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   86,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   45,   45,  109,   94,  114,
+      104,  116,  120,  117,  115,   45,   45,   45,   45,  121,
+       45,   95,   45,  105,  122,   45,   45,   45,   45,   45,
+      123,   45,   45,  117,   45,   45,   89,   89,   89,   89,
+       89,   90,   89,   89,   89,   89,   89,   89,   45,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   45,   89,
+       89,   89,   45,   89,   89,   89,   45,   89,   89,   89,
+       89,   89,   89,   45,   89,   89,   89,   45,   89,   45,
+
+       91,   89,   89,   89,   89,   89,   89,   89,   96,  110,
+      428,  118,  428,  124,  126,  127,  130,  131,  111,  132,
+      133,  134,  135,  112,  113,  136,  137,  138,  139,  140,
+      141,  118,  142,   97,   71,   71,   98,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,  119,   44,  143,  145,
+
+      146,  428,  428,  428,   44,  147,  128,  148,  144,  149,
+      150,  151,  152,   89,  153,  154,  155,  156,  157,  160,
+      119,  161,  159,  158,   44,  162,  163,  164,   44,  166,
+      167,  169,   44,   89,  170,  160,  171,   89,  172,   44,
+      173,   89,  159,   44,  174,   44,  125,  158,   89,  175,
+      176,  177,   89,  178,   89,   89,   89,   89,   89,  179,
+      180,   89,  181,  183,  184,  182,  185,  186,  187,  129,
+      129,  129,  129,  188,  189,  190,  191,  129,  129,  129,
+      129,  192,  193,  194,  195,  196,  197,  198,  200,  201,
+      203,  129,  129,  129,  129,  129,  129,  165,  165,  165,
+
+      165,  196,  204,  205,  206,  165,  165,  165,  165,  207,
+      208,  209,  210,  211,  212,  213,  214,  215,  216,  165,
+      165,  165,  165,  165,  165,  168,  168,  168,  168,  217,
+      218,  219,  220,  168,  168,  168,  168,  221,  222,  223,
+      224,  225,  226,  227,  228,  229,  230,  168,  168,  168,
+      168,  168,  168,  199,  199,  199,  199,  231,  233,  234,
+      235,  199,  199,  199,  199,  236,  237,  238,  239,  240,
+      241,  242,  243,  244,  245,  199,  199,  199,  199,  199,
+      199,  202,  202,  202,  202,  246,  247,  249,  250,  202,
+      202,  202,  202,   45,  251,  252,  253,  254,  255,  256,
+
+      257,  258,  259,  202,  202,  202,  202,  202,  202,  232,
+      232,  232,  232,  248,  260,  261,  262,  232,  232,  232,
+      232,  263,   45,  264,  267,  265,  268,  269,  270,   45,
+      272,  232,  232,  232,  232,  232,  232,   45,   45,   45,
+       45,   45,  271,  273,  274,   45,   45,   45,   45,  275,
+      266,  276,  278,  279,  280,  281,  282,  283,  284,   45,
+       45,   45,   45,   45,   45,   44,   44,   44,   44,  285,
+      286,  287,  288,   44,   44,   44,   44,   46,  290,  291,
+      277,  292,  293,  294,  295,  296,  297,   44,   44,   44,
+       44,   44,   44,  298,  299,  300,  301,  302,   46,  304,
+
+      305,  308,  309,  310,  311,  312,  306,  307,  313,  314,
+      315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+      325,  326,  327,   45,  328,  329,  330,  289,  331,  332,
+      333,  334,  335,  336,  337,  338,  339,  340,  341,  303,
+      342,  343,   45,   45,  345,  344,  346,  347,  348,  349,
+      350,  351,  352,  353,  356,  357,  358,  359,  354,   45,
+      361,  362,  363,  364,   46,  366,   45,  368,  369,  370,
+      367,  371,  372,  373,   45,   45,  374,  375,  376,  360,
+      377,  378,  379,  380,   45,  382,  383,  355,  384,  385,
+      386,   45,  381,  388,  389,  390,  391,  392,  393,  394,
+
+      387,  395,  396,  365,  397,   46,  399,  400,   45,  401,
+      402,  403,  404,  405,  406,  407,  408,  409,  410,  411,
+      412,  413,  414,  415,  416,  417,  418,  419,  420,  421,
+      422,  423,  424,  425,  426,  427,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  398,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428
+
     } ;
 
-static const flex_int16_t yy_chk[2586] =
+static const flex_int16_t yy_chk[1193] =
     {   0,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    3,    9,    7,    4,
-        5,    5,    8,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,   10,   13,   26,   13,    5,    5,
-        9,    5,   21,   37,    5,   37,    5,   21,    5,   27,
-
-       26,   31,   44,  225,    5,    5,    7,   10,    5,   28,
-        8,   42,    5,   42,   32,   31,   17,    5,   17,   17,
-       17,   17,   27,    5,    5,   15,   15,   15,   17,   44,
-       15,   19,   28,   19,   19,   19,   19,   32,   20,   20,
-       20,   20,  194,   19,   17,   33,   74,   25,   20,   25,
-       15,   15,   25,   25,   25,   25,  162,   15,   76,   19,
-      127,   15,   15,   15,   20,   15,   74,   15,   33,   75,
-       15,   15,   15,   15,   15,  122,   15,   77,   15,   15,
-       22,   76,   22,   22,   22,   22,   45,   45,   45,   75,
-       79,   45,   22,   47,   47,   47,   78,   77,   47,   48,
-
-       48,   48,   49,   84,   48,  116,  117,  118,   22,   49,
-       50,   50,   50,   79,   89,   50,   78,  119,   45,   51,
-       51,   51,   86,  118,   51,   47,  117,  121,  116,   49,
-       84,   48,  120,   49,   52,   52,   52,   49,   48,   52,
-      119,   47,   50,  121,   49,  156,  159,   49,   52,   49,
-       49,   51,  120,   82,   51,   53,   53,   53,   50,   81,
-       53,  156,  159,   54,   54,   54,   52,   51,   54,   55,
-       55,   55,   43,   52,   55,   41,   52,   39,   56,   56,
-       56,   38,   24,   56,   57,   57,   57,   53,   14,   57,
-       11,   58,   58,   58,    0,   54,   58,   59,   59,   59,
-
-       53,   55,   59,   60,   60,   60,    0,    0,   60,    0,
-       56,   54,   55,   56,    0,   54,   57,   55,    0,   57,
-       61,   61,   61,   58,    0,   61,   56,    0,    0,   59,
-        0,    0,   59,    0,    0,   60,    0,    0,   62,   62,
-       62,    0,   60,   62,   58,   72,   72,   72,   72,    0,
-        0,   60,   61,    0,    0,   60,   60,    0,   64,   64,
-       64,   64,   73,   73,   73,   73,    0,   61,   64,    0,
-       62,   61,    0,   62,   65,    0,   65,   65,   65,   65,
-        0,    0,    0,   66,   64,   66,   65,    0,   66,   66,
-       66,   66,   67,    0,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   65,    0,   67,   87,   87,   87,   68,    0,
-       87,   88,   88,   88,    0,    0,   88,   90,   90,   90,
-       67,    0,   90,    0,   68,    0,    0,    0,   92,   92,
-       92,    0,    0,   92,    0,    0,    0,   87,    0,   93,
-       93,   93,    0,   88,   93,    0,   87,    0,    0,   90,
-       94,   94,   94,    0,    0,   94,    0,    0,    0,    0,
-       92,    0,    0,   88,   91,   91,   91,   91,    0,    0,
-        0,   93,   91,   91,   91,   91,   92,    0,   95,   95,
-       95,    0,   94,   95,    0,    0,   91,   91,   91,   91,
-       91,   91,    0,   96,   96,   96,   94,   94,   96,   97,
-
-       97,   97,    0,    0,   97,    0,   98,   98,   98,    0,
-       95,   98,   99,   99,   99,    0,    0,   99,  100,  100,
-      100,    0,    0,  100,    0,   96,    0,    0,    0,   96,
-        0,   97,  101,  101,  101,    0,   97,  101,   98,    0,
-      102,  102,  102,    0,   99,  102,  103,  103,  103,    0,
-      100,  103,  104,  104,  104,    0,    0,  104,    0,   98,
-       99,    0,    0,    0,  101,    0,    0,    0,  101,    0,
-      100,    0,  102,    0,  105,  105,  105,    0,  103,  105,
-        0,  102,    0,    0,  104,    0,  106,  106,  106,    0,
-      104,  106,    0,  103,  107,  107,  107,    0,    0,  107,
-
-        0,  103,  108,  108,  108,    0,  105,  108,  109,  109,
-      109,    0,    0,  109,    0,    0,    0,    0,  106,    0,
-      105,    0,  110,  110,  110,    0,  107,  110,    0,    0,
-      111,  111,  111,    0,  108,  111,    0,    0,  106,    0,
-      109,    0,    0,    0,  107,  109,  107,  112,  112,  112,
-        0,    0,  112,    0,  110,    0,  108,    0,    0,    0,
-      110,    0,  111,  113,  113,  113,  111,    0,  113,  114,
-      114,  114,    0,    0,  114,  125,  125,  125,    0,  112,
-      125,  126,  126,  126,    0,    0,  126,    0,    0,    0,
-      112,  132,  132,  132,    0,  113,  132,    0,    0,    0,
-
-        0,  114,  113,  130,  130,  130,    0,  125,  130,    0,
-        0,    0,    0,  126,  114,    0,  125,    0,  126,  129,
-      129,  129,  129,  132,    0,    0,    0,  129,  129,  129,
-      129,  133,  133,  133,    0,  130,  133,  132,    0,    0,
-        0,  129,  129,  129,  129,  129,  129,  135,  135,  135,
-        0,    0,  135,    0,    0,  130,  136,  136,  136,    0,
-        0,  136,    0,  133,  137,  137,  137,    0,    0,  137,
-      138,  138,  138,    0,    0,  138,  139,  139,  139,  135,
-        0,  139,    0,  133,  140,  140,  140,    0,  136,  140,
-      141,  141,  141,    0,    0,  141,  137,    0,    0,    0,
-
-      135,    0,  138,    0,    0,  136,    0,    0,  139,    0,
-        0,    0,    0,    0,  138,  137,  140,    0,  142,  142,
-      142,    0,  141,  142,    0,  139,    0,  143,  143,  143,
-        0,  141,  143,    0,  140,  144,  144,  144,    0,    0,
-      144,  145,  145,  145,    0,    0,  145,  146,  146,  146,
-      142,    0,  146,  142,    0,  147,  147,  147,    0,  143,
-      147,  148,  148,  148,    0,    0,  148,  144,    0,    0,
-      149,  149,  149,  145,  144,  149,    0,    0,  143,  146,
-      145,  143,    0,  150,  150,  150,    0,  147,  150,    0,
-      147,    0,    0,  148,    0,    0,  146,    0,  151,  151,
-
-      151,    0,  149,  151,    0,  152,  152,  152,    0,  149,
-      152,    0,    0,  148,    0,  150,  153,  153,  153,    0,
-        0,  153,    0,  154,  154,  154,    0,  150,  154,    0,
-      151,  155,  155,  155,    0,    0,  155,  152,  164,  164,
-      164,    0,    0,  164,    0,    0,  151,    0,  153,    0,
-        0,    0,  165,  165,  165,  154,  152,  165,    0,  167,
-      167,  167,    0,  155,  167,    0,    0,    0,    0,  167,
-      164,  153,    0,  154,  155,  168,  168,  168,    0,    0,
-      168,  164,    0,    0,  165,  169,  169,  169,    0,    0,
-      169,  167,    0,    0,    0,    0,    0,    0,    0,    0,
-
-      165,  166,  166,  166,  166,    0,    0,  168,    0,  166,
-      166,  166,  166,    0,  168,    0,    0,  169,    0,    0,
-        0,    0,    0,  166,  166,  166,  166,  166,  166,  170,
-      170,  170,    0,    0,  170,  169,  171,  171,  171,    0,
-        0,  171,  172,  172,  172,    0,    0,  172,  173,  173,
-      173,  171,  171,  173,  174,  174,  174,    0,    0,  174,
-        0,  170,  175,  175,  175,    0,    0,  175,  171,    0,
-      170,  176,  176,  176,  172,    0,  176,  177,  177,  177,
-      173,    0,  177,    0,  172,    0,  174,  178,  178,  178,
-        0,    0,  178,    0,  175,    0,    0,  175,    0,  173,
-
-      179,  179,  179,  176,    0,  179,  180,  180,  180,  177,
-      176,  180,  181,  181,  181,    0,    0,  181,  177,  178,
-      182,  182,  182,    0,    0,  182,  183,  183,  183,    0,
-      178,  183,  179,    0,    0,  184,  184,  184,  180,  179,
-      184,    0,    0,    0,  181,  185,  185,  185,    0,    0,
-      185,  180,  182,    0,  186,  186,  186,    0,  183,  186,
-      187,  187,  187,    0,    0,  187,    0,  184,    0,    0,
-        0,    0,  183,  182,  184,    0,    0,  185,  188,  188,
-      188,    0,    0,  188,    0,    0,  186,    0,    0,  189,
-      189,  189,  187,  186,  189,  185,  190,  190,  190,    0,
-
-        0,  190,  191,  191,  191,    0,  190,  191,    0,    0,
-      188,    0,    0,  187,    0,  188,    0,  196,  196,  196,
-        0,  189,  196,    0,  197,  197,  197,    0,  190,  197,
-        0,  199,  199,  199,  191,    0,  199,  201,  201,  201,
-      191,    0,  201,    0,    0,  200,  200,  200,    0,  196,
-      200,    0,    0,    0,    0,    0,  197,  202,  202,  202,
-        0,    0,  202,  199,  196,    0,    0,    0,    0,  201,
-        0,  197,  198,  198,  198,  198,    0,  200,    0,    0,
-      198,  198,  198,  198,  199,  201,  203,  203,  203,  202,
-        0,  203,  200,    0,  198,  198,  198,  198,  198,  198,
-
-        0,    0,  202,  204,  204,  204,    0,    0,  204,  205,
-      205,  205,    0,    0,  205,  206,  206,  206,  203,    0,
-      206,  208,  208,  208,    0,  206,  208,  209,  209,  209,
-        0,    0,  209,    0,    0,  204,    0,  210,  210,  210,
-        0,  205,  210,  211,  211,  211,    0,  206,  211,  212,
-      212,  212,    0,  208,  212,  213,  213,  213,    0,  209,
-      213,  215,  215,  215,    0,    0,  215,    0,    0,  210,
-        0,  208,    0,    0,    0,  211,  210,  209,  216,  216,
-      216,  212,    0,  216,  217,  217,  217,  213,    0,  217,
-      218,  218,  218,  215,    0,  218,  219,  219,  219,  212,
-
-      211,  219,    0,  220,  220,  220,    0,    0,  220,    0,
-      216,    0,    0,  215,    0,    0,  217,  216,  221,  221,
-      221,    0,  218,  221,  223,  223,  223,    0,  219,  223,
-        0,    0,    0,  218,  217,  220,    0,  224,  224,  224,
-        0,    0,  224,    0,  227,  227,  227,    0,  219,  227,
-      221,    0,  228,  228,  228,  220,  223,  228,  229,  229,
-      229,  223,    0,  229,    0,  230,  230,  230,  221,  224,
-      230,    0,  224,  231,  231,  231,  227,    0,  231,    0,
-        0,  232,  232,  232,  228,  227,  232,    0,    0,    0,
-      229,    0,  228,  236,  236,  236,    0,  230,  236,  237,
-
-      237,  237,    0,    0,  237,  231,    0,  229,    0,  238,
-      238,  238,    0,  232,  238,    0,    0,  230,  231,    0,
-      232,  239,  239,  239,    0,  236,  239,    0,    0,    0,
-        0,  237,  240,  240,  240,    0,    0,  240,  236,    0,
-        0,  238,  241,  241,  241,    0,    0,  241,    0,  243,
-      243,  243,    0,  239,  243,  237,  244,  244,  244,  239,
-      238,  244,    0,    0,  240,  245,  245,  245,    0,    0,
-      245,  240,    0,    0,  241,  246,  246,  246,    0,    0,
-      246,  243,    0,  243,  247,  247,  247,    0,  244,  247,
-      248,  248,  248,    0,  247,  248,    0,  245,  249,  249,
-
-      249,    0,    0,  249,  250,  250,  250,  246,  244,  250,
-        0,    0,  245,  251,  251,  251,  247,    0,  251,  253,
-      253,  253,  248,    0,  253,    0,    0,  246,    0,    0,
-      249,    0,  254,  254,  254,    0,  250,  254,  255,  255,
-      255,  249,    0,  255,    0,  251,    0,    0,  256,  256,
-      256,  253,  250,  256,    0,    0,  257,  257,  257,    0,
-        0,  257,    0,    0,  254,  251,  257,  258,  258,  258,
-      255,    0,  258,  259,  259,  259,  255,    0,  259,    0,
-      256,  260,  260,  260,    0,    0,  260,    0,  257,    0,
-      261,  261,  261,    0,    0,  261,  262,  262,  262,  258,
-
-        0,  262,  263,  263,  263,  259,  262,  263,    0,  266,
-      266,  266,    0,  260,  266,    0,  259,    0,  268,  268,
-      268,  258,  261,  268,  267,  267,  267,    0,  262,  267,
-      269,  269,  269,    0,  263,  269,    0,  270,  270,  270,
-        0,  266,  270,  272,  272,  272,    0,    0,  272,    0,
-      268,    0,    0,  273,  273,  273,  267,  266,  273,  274,
-      274,  274,  269,  267,  274,  279,  279,  279,    0,  270,
-      279,  277,  277,  277,    0,  272,  277,    0,    0,  272,
-        0,    0,    0,    0,  270,  273,  269,    0,    0,  270,
-      270,  274,    0,    0,  280,  280,  280,  279,  274,  280,
-
-      273,    0,    0,  277,    0,    0,  277,  281,  281,  281,
-        0,    0,  281,  284,  284,  284,  279,    0,  284,  286,
-      286,  286,    0,    0,  286,    0,  280,  287,  287,  287,
-        0,    0,  287,  280,    0,  289,  289,  289,    0,  281,
-      289,    0,    0,  281,    0,  284,    0,  290,  290,  290,
-        0,  286,  290,  291,  291,  291,    0,    0,  291,  287,
-      292,  292,  292,    0,  284,  292,    0,  289,  286,  293,
-      293,  293,    0,    0,  293,    0,    0,  287,    0,  290,
-        0,    0,  290,    0,    0,  291,  294,  294,  294,    0,
-        0,  294,  292,  295,  295,  295,    0,    0,  295,    0,
-
-        0,  293,    0,  295,    0,    0,    0,    0,  293,  291,
-      292,  296,  296,  296,    0,    0,  296,    0,  294,  297,
-      297,  297,    0,    0,  297,  295,  298,  298,  298,    0,
-        0,  298,  299,  299,  299,    0,    0,  299,  294,    0,
-      300,  300,  300,  296,    0,  300,    0,    0,  301,  301,
-      301,  297,    0,  301,  302,  302,  302,    0,  298,  302,
-      304,  304,  304,  296,  299,  304,    0,  297,    0,    0,
-        0,  298,  300,    0,    0,    0,  305,  305,  305,  300,
-      301,  305,  299,  306,  306,  306,  302,    0,  306,  307,
-      307,  307,  304,    0,  307,    0,    0,    0,    0,  307,
-
-      301,    0,  308,  308,  308,  302,  304,  308,  305,    0,
-        0,  309,  309,  309,    0,  306,  309,  310,  310,  310,
-        0,  307,  310,    0,    0,  305,    0,    0,  306,    0,
-      311,  311,  311,    0,  308,  311,    0,  312,  312,  312,
-        0,  308,  312,  309,    0,  313,  313,  313,  309,  310,
-      313,    0,  314,  314,  314,    0,  310,  314,  315,  315,
-      315,    0,  311,  315,    0,    0,    0,  311,    0,  312,
-        0,  316,  316,  316,    0,    0,  316,  313,    0,    0,
-      313,  317,  317,  317,  314,    0,  317,  318,  318,  318,
-      315,    0,  318,  319,  319,  319,    0,    0,  319,    0,
-
-        0,  315,  314,  316,  320,  320,  320,    0,    0,  320,
-      321,  321,  321,  317,    0,  321,  322,  322,  322,  318,
-      317,  322,  323,  323,  323,  319,  318,  323,  324,  324,
-      324,    0,    0,  324,    0,    0,  320,    0,  326,  326,
-      326,  320,  321,  326,  327,  327,  327,    0,  322,  327,
-        0,  328,  328,  328,  323,    0,  328,    0,  322,    0,
-      324,  330,  330,  330,    0,  321,  330,    0,    0,    0,
-      326,    0,  324,  331,  331,  331,  327,    0,  331,  333,
-      333,  333,    0,  328,  333,  334,  334,  334,  326,    0,
-      334,    0,    0,  330,    0,  335,  335,  335,  327,  328,
-
-      335,  337,  337,  337,    0,  331,  337,  338,  338,  338,
-        0,  333,  338,  339,  339,  339,    0,  334,  339,    0,
-        0,  333,    0,  340,  340,  340,    0,  335,  340,    0,
-      335,    0,    0,  337,    0,    0,    0,  334,    0,  338,
-      337,  343,  343,  343,    0,  339,  343,    0,    0,    0,
-      338,    0,  339,    0,    0,  340,  344,  344,  344,    0,
-        0,  344,  345,  345,  345,    0,    0,  345,    0,    0,
-      340,    0,    0,  343,    0,    0,  343,    0,  346,  346,
-      346,    0,    0,  346,  347,  347,  347,    0,  344,  347,
-      348,  348,  348,    0,  345,  348,  349,  349,  349,    0,
-
-        0,  349,  350,  350,  350,    0,    0,  350,    0,  345,
-      346,    0,  352,  352,  352,    0,  347,  352,    0,  353,
-      353,  353,  348,  347,  353,    0,    0,    0,  349,    0,
-      346,  354,  354,  354,  350,    0,  354,  355,  355,  355,
-      348,    0,  355,    0,  352,    0,    0,  349,    0,  350,
-        0,  353,    0,  352,  356,  356,  356,    0,    0,  356,
-      357,  357,  357,  354,    0,  357,  358,  358,  358,  355,
-        0,  358,  360,  360,  360,    0,    0,  360,  361,  361,
-      361,    0,  354,  361,    0,    0,  356,    0,  355,  363,
-      363,  363,  357,    0,  363,  364,  364,  364,  358,    0,
-
-      364,  357,    0,    0,  360,  358,  367,  367,  367,    0,
-      361,  367,  368,  368,  368,    0,    0,  368,  369,  369,
-      369,  363,    0,  369,    0,    0,    0,  364,  363,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  367,    0,
-        0,    0,    0,    0,  368,    0,  364,    0,    0,    0,
-      369,    0,    0,    0,    0,    0,    0,  367,  373,  373,
-      373,  373,  373,  373,  373,  374,  374,  374,  374,  374,
-      374,  374,  375,    0,  375,  375,  375,  375,  375,  376,
-        0,  376,    0,  376,  376,  376,  377,  377,  377,  377,
-      377,  377,  377,  378,  378,  378,  378,  378,  378,  378,
-
-      379,    0,  379,  379,  379,  379,  379,  380,  380,    0,
-      380,  381,  381,  381,  381,  381,  382,  382,  383,  383,
-      384,  384,  385,  385,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,  372,  372,  372
+        1,    1,    1,    1,    1,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    5,    5,    7,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    9,   11,   14,   24,    5,    5,   13,    5,   13,
+       26,    5,   27,    5,   28,    5,    9,   19,   19,   19,
+       19,    5,    5,   31,   26,    5,   32,    7,   20,    5,
+       20,   20,   20,   20,   21,    5,   27,   33,   28,   21,
+       38,   39,    5,    5,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   16,   16,   41,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   17,   47,
+       17,   17,   17,   17,   48,   50,   25,   51,   25,   54,
+       17,   25,   25,   25,   25,   55,   58,   59,   56,   60,
+       55,   40,   40,   56,   40,   40,   17,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   45,   45,   61,   52,   63,
+       57,   64,   78,   75,   63,   45,   45,   45,   45,   79,
+       45,   52,   45,   57,   80,   45,   45,   45,   45,   45,
+       82,   45,   45,   75,   45,   45,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   53,   62,
+       73,   76,   73,   83,   87,   88,   92,   93,   62,   94,
+       95,   95,   96,   62,   62,   97,   98,   99,  100,  101,
+      102,   76,  103,   53,   71,   71,   53,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   77,   86,  104,  105,
+
+      106,   89,   89,   89,   86,  107,   89,  108,  104,  108,
+      109,  110,  111,   89,  112,  113,  114,  115,  116,  119,
+       77,  120,  118,  117,   86,  121,  122,  123,   86,  126,
+      127,  130,   86,   89,  131,  119,  133,   89,  134,   86,
+      136,   89,  118,   86,  137,   86,   86,  117,   89,  138,
+      139,  140,   89,  141,   89,   89,   91,   91,   91,  142,
+      143,   91,  144,  145,  146,  144,  147,  148,  149,   91,
+       91,   91,   91,  150,  151,  152,  153,   91,   91,   91,
+       91,  154,  155,  156,  157,  158,  161,  164,  166,  167,
+      169,   91,   91,   91,   91,   91,   91,  125,  125,  125,
+
+      125,  158,  170,  171,  172,  125,  125,  125,  125,  173,
+      174,  174,  175,  176,  177,  178,  179,  180,  181,  125,
+      125,  125,  125,  125,  125,  129,  129,  129,  129,  182,
+      183,  184,  185,  129,  129,  129,  129,  186,  187,  188,
+      189,  190,  191,  192,  193,  194,  195,  129,  129,  129,
+      129,  129,  129,  165,  165,  165,  165,  198,  200,  201,
+      203,  165,  165,  165,  165,  203,  204,  205,  206,  207,
+      208,  209,  210,  211,  213,  165,  165,  165,  165,  165,
+      165,  168,  168,  168,  168,  214,  215,  217,  218,  168,
+      168,  168,  168,  216,  220,  221,  222,  223,  224,  225,
+
+      226,  227,  229,  168,  168,  168,  168,  168,  168,  199,
+      199,  199,  199,  216,  230,  231,  233,  199,  199,  199,
+      199,  234,  234,  236,  238,  236,  239,  240,  244,  245,
+      246,  199,  199,  199,  199,  199,  199,  202,  202,  202,
+      202,  237,  245,  247,  248,  202,  202,  202,  202,  249,
+      237,  251,  252,  253,  254,  255,  256,  257,  258,  202,
+      202,  202,  202,  202,  202,  232,  232,  232,  232,  259,
+      260,  262,  263,  232,  232,  232,  232,  264,  265,  266,
+      251,  267,  268,  269,  270,  271,  272,  232,  232,  232,
+      232,  232,  232,  273,  274,  277,  278,  279,  280,  281,
+
+      282,  284,  285,  286,  289,  290,  282,  282,  291,  293,
+      294,  295,  298,  300,  301,  303,  304,  305,  306,  307,
+      308,  309,  310,  284,  311,  312,  313,  264,  314,  315,
+      316,  317,  318,  319,  320,  322,  323,  324,  325,  280,
+      326,  327,  328,  327,  329,  328,  330,  331,  332,  333,
+      334,  335,  336,  337,  338,  339,  340,  341,  337,  342,
+      343,  344,  345,  346,  347,  349,  350,  351,  354,  355,
+      350,  356,  357,  359,  355,  343,  360,  361,  362,  342,
+      363,  365,  366,  367,  368,  369,  370,  337,  373,  374,
+      375,  376,  368,  377,  378,  379,  380,  381,  382,  383,
+
+      376,  384,  386,  347,  387,  388,  389,  390,  386,  391,
+      392,  393,  394,  395,  396,  398,  400,  401,  403,  404,
+      405,  406,  407,  410,  411,  412,  413,  415,  416,  417,
+      419,  420,  422,  423,  425,  426,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  388,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  428
+
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1461,15 +1174,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[63] =
+static const flex_int16_t yy_rule_linenum[69] =
     {   0,
-      133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
-      170,  177,  186,  198,  210,  220,  230,  240,  249,  258,
-      267,  276,  285,  294,  303,  312,  321,  330,  339,  348,
-      357,  366,  375,  384,  393,  403,  412,  421,  430,  439,
-      448,  457,  466,  475,  484,  583,  588,  593,  598,  599,
-      600,  601,  602,  603,  605,  623,  636,  641,  645,  647,
-      649,  651
+      132,  134,  136,  141,  142,  147,  148,  149,  161,  164,
+      169,  176,  185,  197,  209,  219,  229,  239,  248,  257,
+      266,  275,  284,  293,  302,  311,  320,  329,  338,  347,
+      356,  365,  374,  383,  392,  402,  411,  420,  429,  438,
+      447,  456,  465,  474,  483,  492,  501,  510,  519,  528,
+      537,  636,  641,  646,  651,  652,  653,  654,  655,  656,
+      658,  676,  689,  694,  698,  700,  702,  704
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1524,7 +1237,7 @@ using isc::netconf::NetconfParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::netconf::ParserContext::fatal(msg)
-#line 1527 "netconf_lexer.cc"
+#line 1240 "netconf_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1550,8 +1263,8 @@ using isc::netconf::NetconfParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1553 "netconf_lexer.cc"
-#line 1554 "netconf_lexer.cc"
+#line 1266 "netconf_lexer.cc"
+#line 1267 "netconf_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1865,7 +1578,7 @@ YY_DECL
     }
 
 
-#line 1868 "netconf_lexer.cc"
+#line 1581 "netconf_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1894,13 +1607,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 373 )
+				if ( yy_current_state >= 429 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 372 );
+		while ( yy_current_state != 428 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1919,13 +1632,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 63 )
+			else if ( yy_act < 69 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 63 )
+			else if ( yy_act == 69 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 64 )
+			else if ( yy_act == 70 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2414,6 +2127,42 @@ YY_RULE_SETUP
 case 43:
 YY_RULE_SETUP
 #line 466 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 475 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 484 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC_OVERFLOW(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async-overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 493 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2423,9 +2172,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 47:
 YY_RULE_SETUP
-#line 475 "netconf_lexer.ll"
+#line 502 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMITED_MESSAGES(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limited-messages", driver.loc_);
+    }
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+#line 511 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+#line 520 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMIT_INTERVAL(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limit-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+#line 529 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2435,9 +2220,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 51:
 YY_RULE_SETUP
-#line 484 "netconf_lexer.ll"
+#line 538 "netconf_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2537,65 +2322,65 @@ YY_RULE_SETUP
     return NetconfParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 46:
-/* rule 46 can match eol */
+case 52:
+/* rule 52 can match eol */
 YY_RULE_SETUP
-#line 583 "netconf_lexer.ll"
+#line 637 "netconf_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 47:
-/* rule 47 can match eol */
+case 53:
+/* rule 53 can match eol */
 YY_RULE_SETUP
-#line 588 "netconf_lexer.ll"
+#line 642 "netconf_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 48:
+case 54:
 YY_RULE_SETUP
-#line 593 "netconf_lexer.ll"
+#line 647 "netconf_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 49:
+case 55:
 YY_RULE_SETUP
-#line 598 "netconf_lexer.ll"
+#line 652 "netconf_lexer.ll"
 { return NetconfParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 50:
+case 56:
 YY_RULE_SETUP
-#line 599 "netconf_lexer.ll"
+#line 653 "netconf_lexer.ll"
 { return NetconfParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 51:
+case 57:
 YY_RULE_SETUP
-#line 600 "netconf_lexer.ll"
+#line 654 "netconf_lexer.ll"
 { return NetconfParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 52:
+case 58:
 YY_RULE_SETUP
-#line 601 "netconf_lexer.ll"
+#line 655 "netconf_lexer.ll"
 { return NetconfParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 53:
+case 59:
 YY_RULE_SETUP
-#line 602 "netconf_lexer.ll"
+#line 656 "netconf_lexer.ll"
 { return NetconfParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 54:
+case 60:
 YY_RULE_SETUP
-#line 603 "netconf_lexer.ll"
+#line 657 "netconf_lexer.ll"
 { return NetconfParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 55:
+case 61:
 YY_RULE_SETUP
-#line 605 "netconf_lexer.ll"
+#line 659 "netconf_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2614,9 +2399,9 @@ YY_RULE_SETUP
     return NetconfParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 56:
+case 62:
 YY_RULE_SETUP
-#line 623 "netconf_lexer.ll"
+#line 677 "netconf_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2630,43 +2415,43 @@ YY_RULE_SETUP
     return NetconfParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 57:
+case 63:
 YY_RULE_SETUP
-#line 636 "netconf_lexer.ll"
+#line 690 "netconf_lexer.ll"
 {
     string tmp(yytext);
     return NetconfParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 58:
+case 64:
 YY_RULE_SETUP
-#line 641 "netconf_lexer.ll"
+#line 695 "netconf_lexer.ll"
 {
    return NetconfParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 59:
+case 65:
 YY_RULE_SETUP
-#line 645 "netconf_lexer.ll"
+#line 699 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 60:
+case 66:
 YY_RULE_SETUP
-#line 647 "netconf_lexer.ll"
+#line 701 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 61:
+case 67:
 YY_RULE_SETUP
-#line 649 "netconf_lexer.ll"
+#line 703 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 62:
+case 68:
 YY_RULE_SETUP
-#line 651 "netconf_lexer.ll"
+#line 705 "netconf_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 653 "netconf_lexer.ll"
+#line 707 "netconf_lexer.ll"
 {
     if (driver.states_.empty()) {
         return NetconfParser::make_END(driver.loc_);
@@ -2690,12 +2475,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 63:
+case 69:
 YY_RULE_SETUP
-#line 676 "netconf_lexer.ll"
+#line 730 "netconf_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2698 "netconf_lexer.cc"
+#line 2483 "netconf_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3014,7 +2799,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 373 )
+			if ( yy_current_state >= 429 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3047,11 +2832,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 373 )
+		if ( yy_current_state >= 429 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 372);
+	yy_is_jam = (yy_current_state == 428);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3800,8 +3585,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 676 "netconf_lexer.ll"
-
+#line 730 "netconf_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -3903,4 +3687,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -462,6 +462,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"async-queue-size\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+
+\"async-overflow\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC_OVERFLOW(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async-overflow", driver.loc_);
+    }
+}
+
 \"debuglevel\" {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -471,6 +498,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"rate-limited-messages\" {
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMITED_MESSAGES(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limited-messages", driver.loc_);
+    }
+}
+
+\"rate-limit\" {
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+
+\"rate-limit-interval\" {
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMIT_INTERVAL(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limit-interval", driver.loc_);
+    }
+}
+
 \"severity\" {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
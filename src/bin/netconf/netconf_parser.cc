@@ -248,25 +248,25 @@ namespace isc { namespace netconf {
   {
     switch (that.type_get ())
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,25 +285,25 @@ namespace isc { namespace netconf {
   {
     switch (that.type_get ())
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -322,25 +322,25 @@ namespace isc { namespace netconf {
     state = that.state;
     switch (that.type_get ())
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -383,44 +383,44 @@ namespace isc { namespace netconf {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 46: // "constant string"
-#line 108 "netconf_parser.yy"
+      case 52: // "constant string"
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < std::string > (); }
 #line 390 "netconf_parser.cc"
         break;
 
-      case 47: // "integer"
-#line 108 "netconf_parser.yy"
+      case 53: // "integer"
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < int64_t > (); }
 #line 396 "netconf_parser.cc"
         break;
 
-      case 48: // "floating point"
-#line 108 "netconf_parser.yy"
+      case 54: // "floating point"
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < double > (); }
 #line 402 "netconf_parser.cc"
         break;
 
-      case 49: // "boolean"
-#line 108 "netconf_parser.yy"
+      case 55: // "boolean"
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < bool > (); }
 #line 408 "netconf_parser.cc"
         break;
 
-      case 58: // value
-#line 108 "netconf_parser.yy"
+      case 64: // value
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 414 "netconf_parser.cc"
         break;
 
-      case 61: // map_value
-#line 108 "netconf_parser.yy"
+      case 67: // map_value
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 420 "netconf_parser.cc"
         break;
 
-      case 120: // socket_type_value
-#line 108 "netconf_parser.yy"
+      case 126: // socket_type_value
+#line 114 "netconf_parser.yy"
         { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 426 "netconf_parser.cc"
         break;
@@ -639,25 +639,25 @@ namespace isc { namespace netconf {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -682,25 +682,25 @@ namespace isc { namespace netconf {
           switch (yyn)
             {
   case 2:
-#line 119 "netconf_parser.yy"
+#line 125 "netconf_parser.yy"
     { ctx.ctx_ = ctx.NO_KEYWORDS; }
 #line 688 "netconf_parser.cc"
     break;
 
   case 4:
-#line 120 "netconf_parser.yy"
+#line 126 "netconf_parser.yy"
     { ctx.ctx_ = ctx.CONFIG; }
 #line 694 "netconf_parser.cc"
     break;
 
   case 6:
-#line 121 "netconf_parser.yy"
+#line 127 "netconf_parser.yy"
     { ctx.ctx_ = ctx.NETCONF; }
 #line 700 "netconf_parser.cc"
     break;
 
   case 8:
-#line 129 "netconf_parser.yy"
+#line 135 "netconf_parser.yy"
     {
     // Parse the Netconf map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -710,7 +710,7 @@ namespace isc { namespace netconf {
     break;
 
   case 9:
-#line 133 "netconf_parser.yy"
+#line 139 "netconf_parser.yy"
     {
     // parsing completed
 }
@@ -718,7 +718,7 @@ namespace isc { namespace netconf {
     break;
 
   case 10:
-#line 140 "netconf_parser.yy"
+#line 146 "netconf_parser.yy"
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -727,49 +727,49 @@ namespace isc { namespace netconf {
     break;
 
   case 11:
-#line 146 "netconf_parser.yy"
+#line 152 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 733 "netconf_parser.cc"
     break;
 
   case 12:
-#line 147 "netconf_parser.yy"
+#line 153 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 739 "netconf_parser.cc"
     break;
 
   case 13:
-#line 148 "netconf_parser.yy"
+#line 154 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 745 "netconf_parser.cc"
     break;
 
   case 14:
-#line 149 "netconf_parser.yy"
+#line 155 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 751 "netconf_parser.cc"
     break;
 
   case 15:
-#line 150 "netconf_parser.yy"
+#line 156 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 757 "netconf_parser.cc"
     break;
 
   case 16:
-#line 151 "netconf_parser.yy"
+#line 157 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 763 "netconf_parser.cc"
     break;
 
   case 17:
-#line 152 "netconf_parser.yy"
+#line 158 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 769 "netconf_parser.cc"
     break;
 
   case 18:
-#line 156 "netconf_parser.yy"
+#line 162 "netconf_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -780,7 +780,7 @@ namespace isc { namespace netconf {
     break;
 
   case 19:
-#line 161 "netconf_parser.yy"
+#line 167 "netconf_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -790,13 +790,13 @@ namespace isc { namespace netconf {
     break;
 
   case 20:
-#line 167 "netconf_parser.yy"
+#line 173 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 796 "netconf_parser.cc"
     break;
 
   case 23:
-#line 181 "netconf_parser.yy"
+#line 187 "netconf_parser.yy"
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -805,7 +805,7 @@ namespace isc { namespace netconf {
     break;
 
   case 24:
-#line 185 "netconf_parser.yy"
+#line 191 "netconf_parser.yy"
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -815,7 +815,7 @@ namespace isc { namespace netconf {
     break;
 
   case 25:
-#line 192 "netconf_parser.yy"
+#line 198 "netconf_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -824,14 +824,14 @@ namespace isc { namespace netconf {
     break;
 
   case 26:
-#line 195 "netconf_parser.yy"
+#line 201 "netconf_parser.yy"
     {
 }
 #line 831 "netconf_parser.cc"
     break;
 
   case 29:
-#line 202 "netconf_parser.yy"
+#line 208 "netconf_parser.yy"
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -840,7 +840,7 @@ namespace isc { namespace netconf {
     break;
 
   case 30:
-#line 206 "netconf_parser.yy"
+#line 212 "netconf_parser.yy"
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -849,7 +849,7 @@ namespace isc { namespace netconf {
     break;
 
   case 31:
-#line 219 "netconf_parser.yy"
+#line 225 "netconf_parser.yy"
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -860,7 +860,7 @@ namespace isc { namespace netconf {
     break;
 
   case 32:
-#line 227 "netconf_parser.yy"
+#line 233 "netconf_parser.yy"
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -871,7 +871,7 @@ namespace isc { namespace netconf {
     break;
 
   case 33:
-#line 232 "netconf_parser.yy"
+#line 238 "netconf_parser.yy"
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -881,7 +881,7 @@ namespace isc { namespace netconf {
     break;
 
   case 38:
-#line 249 "netconf_parser.yy"
+#line 255 "netconf_parser.yy"
     {
 
     // Let's create a MapElement that will represent it, add it to the
@@ -897,7 +897,7 @@ namespace isc { namespace netconf {
     break;
 
   case 39:
-#line 259 "netconf_parser.yy"
+#line 265 "netconf_parser.yy"
     {
     // Ok, we're done with parsing Netconf. Let's take the map
     // off the stack.
@@ -908,7 +908,7 @@ namespace isc { namespace netconf {
     break;
 
   case 53:
-#line 287 "netconf_parser.yy"
+#line 293 "netconf_parser.yy"
     {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-update", flag);
@@ -917,7 +917,7 @@ namespace isc { namespace netconf {
     break;
 
   case 54:
-#line 292 "netconf_parser.yy"
+#line 298 "netconf_parser.yy"
     {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subscribe-changes", flag);
@@ -926,7 +926,7 @@ namespace isc { namespace netconf {
     break;
 
   case 55:
-#line 297 "netconf_parser.yy"
+#line 303 "netconf_parser.yy"
     {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("validate-changes", flag);
@@ -935,7 +935,7 @@ namespace isc { namespace netconf {
     break;
 
   case 56:
-#line 302 "netconf_parser.yy"
+#line 308 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -943,7 +943,7 @@ namespace isc { namespace netconf {
     break;
 
   case 57:
-#line 304 "netconf_parser.yy"
+#line 310 "netconf_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -970,7 +970,7 @@ namespace isc { namespace netconf {
     break;
 
   case 58:
-#line 327 "netconf_parser.yy"
+#line 333 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -978,7 +978,7 @@ namespace isc { namespace netconf {
     break;
 
   case 59:
-#line 329 "netconf_parser.yy"
+#line 335 "netconf_parser.yy"
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -1007,7 +1007,7 @@ namespace isc { namespace netconf {
     break;
 
   case 60:
-#line 355 "netconf_parser.yy"
+#line 361 "netconf_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
@@ -1018,7 +1018,7 @@ namespace isc { namespace netconf {
     break;
 
   case 61:
-#line 360 "netconf_parser.yy"
+#line 366 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1027,7 +1027,7 @@ namespace isc { namespace netconf {
     break;
 
   case 66:
-#line 373 "netconf_parser.yy"
+#line 379 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1037,7 +1037,7 @@ namespace isc { namespace netconf {
     break;
 
   case 67:
-#line 377 "netconf_parser.yy"
+#line 383 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
 }
@@ -1045,7 +1045,7 @@ namespace isc { namespace netconf {
     break;
 
   case 73:
-#line 390 "netconf_parser.yy"
+#line 396 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1053,7 +1053,7 @@ namespace isc { namespace netconf {
     break;
 
   case 74:
-#line 392 "netconf_parser.yy"
+#line 398 "netconf_parser.yy"
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
@@ -1063,7 +1063,7 @@ namespace isc { namespace netconf {
     break;
 
   case 75:
-#line 398 "netconf_parser.yy"
+#line 404 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1071,7 +1071,7 @@ namespace isc { namespace netconf {
     break;
 
   case 76:
-#line 400 "netconf_parser.yy"
+#line 406 "netconf_parser.yy"
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1080,7 +1080,7 @@ namespace isc { namespace netconf {
     break;
 
   case 77:
-#line 408 "netconf_parser.yy"
+#line 414 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("managed-servers", m);
@@ -1091,7 +1091,7 @@ namespace isc { namespace netconf {
     break;
 
   case 78:
-#line 413 "netconf_parser.yy"
+#line 419 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1100,7 +1100,7 @@ namespace isc { namespace netconf {
     break;
 
   case 88:
-#line 437 "netconf_parser.yy"
+#line 443 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
@@ -1111,7 +1111,7 @@ namespace isc { namespace netconf {
     break;
 
   case 89:
-#line 442 "netconf_parser.yy"
+#line 448 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1120,7 +1120,7 @@ namespace isc { namespace netconf {
     break;
 
   case 90:
-#line 448 "netconf_parser.yy"
+#line 454 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
@@ -1131,7 +1131,7 @@ namespace isc { namespace netconf {
     break;
 
   case 91:
-#line 453 "netconf_parser.yy"
+#line 459 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1140,7 +1140,7 @@ namespace isc { namespace netconf {
     break;
 
   case 92:
-#line 459 "netconf_parser.yy"
+#line 465 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
@@ -1151,7 +1151,7 @@ namespace isc { namespace netconf {
     break;
 
   case 93:
-#line 464 "netconf_parser.yy"
+#line 470 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1160,7 +1160,7 @@ namespace isc { namespace netconf {
     break;
 
   case 94:
-#line 470 "netconf_parser.yy"
+#line 476 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ca", m);
@@ -1171,7 +1171,7 @@ namespace isc { namespace netconf {
     break;
 
   case 95:
-#line 475 "netconf_parser.yy"
+#line 481 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1180,7 +1180,7 @@ namespace isc { namespace netconf {
     break;
 
   case 106:
-#line 497 "netconf_parser.yy"
+#line 503 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1188,7 +1188,7 @@ namespace isc { namespace netconf {
     break;
 
   case 107:
-#line 499 "netconf_parser.yy"
+#line 505 "netconf_parser.yy"
     {
     ElementPtr model(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("model", model);
@@ -1198,7 +1198,7 @@ namespace isc { namespace netconf {
     break;
 
   case 108:
-#line 506 "netconf_parser.yy"
+#line 512 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
@@ -1209,7 +1209,7 @@ namespace isc { namespace netconf {
     break;
 
   case 109:
-#line 511 "netconf_parser.yy"
+#line 517 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1218,7 +1218,7 @@ namespace isc { namespace netconf {
     break;
 
   case 118:
-#line 529 "netconf_parser.yy"
+#line 535 "netconf_parser.yy"
     {
     ctx.enter(ctx.SOCKET_TYPE);
 }
@@ -1226,7 +1226,7 @@ namespace isc { namespace netconf {
     break;
 
   case 119:
-#line 531 "netconf_parser.yy"
+#line 537 "netconf_parser.yy"
     {
     ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1235,25 +1235,25 @@ namespace isc { namespace netconf {
     break;
 
   case 120:
-#line 537 "netconf_parser.yy"
+#line 543 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
 #line 1241 "netconf_parser.cc"
     break;
 
   case 121:
-#line 538 "netconf_parser.yy"
+#line 544 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
 #line 1247 "netconf_parser.cc"
     break;
 
   case 122:
-#line 539 "netconf_parser.yy"
+#line 545 "netconf_parser.yy"
     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
 #line 1253 "netconf_parser.cc"
     break;
 
   case 123:
-#line 542 "netconf_parser.yy"
+#line 548 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1261,7 +1261,7 @@ namespace isc { namespace netconf {
     break;
 
   case 124:
-#line 544 "netconf_parser.yy"
+#line 550 "netconf_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
@@ -1271,7 +1271,7 @@ namespace isc { namespace netconf {
     break;
 
   case 125:
-#line 551 "netconf_parser.yy"
+#line 557 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
@@ -1279,7 +1279,7 @@ namespace isc { namespace netconf {
     break;
 
   case 126:
-#line 553 "netconf_parser.yy"
+#line 559 "netconf_parser.yy"
     {
     ElementPtr url(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-url", url);
@@ -1289,7 +1289,7 @@ namespace isc { namespace netconf {
     break;
 
   case 127:
-#line 566 "netconf_parser.yy"
+#line 572 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
@@ -1300,7 +1300,7 @@ namespace isc { namespace netconf {
     break;
 
   case 128:
-#line 571 "netconf_parser.yy"
+#line 577 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1309,7 +1309,7 @@ namespace isc { namespace netconf {
     break;
 
   case 132:
-#line 588 "netconf_parser.yy"
+#line 594 "netconf_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
@@ -1320,7 +1320,7 @@ namespace isc { namespace netconf {
     break;
 
   case 133:
-#line 593 "netconf_parser.yy"
+#line 599 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1329,7 +1329,7 @@ namespace isc { namespace netconf {
     break;
 
   case 136:
-#line 605 "netconf_parser.yy"
+#line 611 "netconf_parser.yy"
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
@@ -1339,23 +1339,23 @@ namespace isc { namespace netconf {
     break;
 
   case 137:
-#line 609 "netconf_parser.yy"
+#line 615 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
 }
 #line 1347 "netconf_parser.cc"
     break;
 
-  case 147:
-#line 626 "netconf_parser.yy"
+  case 150:
+#line 635 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
 #line 1355 "netconf_parser.cc"
     break;
 
-  case 148:
-#line 628 "netconf_parser.yy"
+  case 151:
+#line 637 "netconf_parser.yy"
     {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1364,8 +1364,8 @@ namespace isc { namespace netconf {
 #line 1365 "netconf_parser.cc"
     break;
 
-  case 149:
-#line 634 "netconf_parser.yy"
+  case 152:
+#line 643 "netconf_parser.yy"
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
@@ -1373,16 +1373,16 @@ namespace isc { namespace netconf {
 #line 1374 "netconf_parser.cc"
     break;
 
-  case 150:
-#line 639 "netconf_parser.yy"
+  case 153:
+#line 648 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
 #line 1382 "netconf_parser.cc"
     break;
 
-  case 151:
-#line 641 "netconf_parser.yy"
+  case 154:
+#line 650 "netconf_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
@@ -1391,109 +1391,182 @@ namespace isc { namespace netconf {
 #line 1392 "netconf_parser.cc"
     break;
 
-  case 152:
-#line 647 "netconf_parser.yy"
+  case 155:
+#line 656 "netconf_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1400 "netconf_parser.cc"
+    break;
+
+  case 156:
+#line 658 "netconf_parser.yy"
+    {
+    ElementPtr l = ctx.stack_.back();
+    ctx.stack_.pop_back();
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.leave();
+}
+#line 1411 "netconf_parser.cc"
+    break;
+
+  case 157:
+#line 665 "netconf_parser.yy"
+    {
+    ElementPtr limit(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", limit);
+}
+#line 1420 "netconf_parser.cc"
+    break;
+
+  case 158:
+#line 670 "netconf_parser.yy"
+    {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+}
+#line 1429 "netconf_parser.cc"
+    break;
+
+  case 159:
+#line 675 "netconf_parser.yy"
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1403 "netconf_parser.cc"
+#line 1440 "netconf_parser.cc"
     break;
 
-  case 153:
-#line 652 "netconf_parser.yy"
+  case 160:
+#line 680 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1412 "netconf_parser.cc"
+#line 1449 "netconf_parser.cc"
     break;
 
-  case 156:
-#line 661 "netconf_parser.yy"
+  case 163:
+#line 689 "netconf_parser.yy"
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1422 "netconf_parser.cc"
+#line 1459 "netconf_parser.cc"
     break;
 
-  case 157:
-#line 665 "netconf_parser.yy"
+  case 164:
+#line 693 "netconf_parser.yy"
     {
     ctx.stack_.pop_back();
 }
-#line 1430 "netconf_parser.cc"
+#line 1467 "netconf_parser.cc"
     break;
 
-  case 165:
-#line 680 "netconf_parser.yy"
+  case 175:
+#line 711 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1438 "netconf_parser.cc"
+#line 1475 "netconf_parser.cc"
     break;
 
-  case 166:
-#line 682 "netconf_parser.yy"
+  case 176:
+#line 713 "netconf_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1448 "netconf_parser.cc"
+#line 1485 "netconf_parser.cc"
     break;
 
-  case 167:
-#line 688 "netconf_parser.yy"
+  case 177:
+#line 719 "netconf_parser.yy"
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1457 "netconf_parser.cc"
+#line 1494 "netconf_parser.cc"
     break;
 
-  case 168:
-#line 693 "netconf_parser.yy"
+  case 178:
+#line 724 "netconf_parser.yy"
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1466 "netconf_parser.cc"
+#line 1503 "netconf_parser.cc"
     break;
 
-  case 169:
-#line 698 "netconf_parser.yy"
+  case 179:
+#line 729 "netconf_parser.yy"
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1475 "netconf_parser.cc"
+#line 1512 "netconf_parser.cc"
     break;
 
-  case 170:
-#line 703 "netconf_parser.yy"
+  case 180:
+#line 734 "netconf_parser.yy"
     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1483 "netconf_parser.cc"
+#line 1520 "netconf_parser.cc"
     break;
 
-  case 171:
-#line 705 "netconf_parser.yy"
+  case 181:
+#line 736 "netconf_parser.yy"
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 1493 "netconf_parser.cc"
+#line 1530 "netconf_parser.cc"
     break;
 
+  case 182:
+#line 742 "netconf_parser.yy"
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1539 "netconf_parser.cc"
+    break;
 
-#line 1497 "netconf_parser.cc"
+  case 183:
+#line 747 "netconf_parser.yy"
+    {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 1548 "netconf_parser.cc"
+    break;
+
+  case 184:
+#line 752 "netconf_parser.yy"
+    {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1556 "netconf_parser.cc"
+    break;
+
+  case 185:
+#line 754 "netconf_parser.yy"
+    {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+}
+#line 1566 "netconf_parser.cc"
+    break;
+
+
+#line 1570 "netconf_parser.cc"
 
             default:
               break;
@@ -1764,42 +1837,45 @@ namespace isc { namespace netconf {
   }
 
 
-  const signed char NetconfParser::yypact_ninf_ = -92;
+  const signed char NetconfParser::yypact_ninf_ = -79;
 
   const signed char NetconfParser::yytable_ninf_ = -1;
 
   const short
   NetconfParser::yypact_[] =
   {
-      -8,   -92,   -92,   -92,    27,    11,    44,    99,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,    11,    35,     9,    -1,   -92,   106,
-     104,   109,   110,   116,   -92,   -92,    26,   -92,   -92,   -92,
-     -92,   -92,   122,   123,   124,   125,   -92,   -92,   126,   -92,
-     127,   128,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,    11,    11,   -92,    87,   130,   132,     9,   -92,
-     133,   134,    83,    90,    91,   135,   137,   139,   -92,   -92,
-      -1,   -92,   -92,   140,   138,   141,   -92,   142,   100,   -92,
-     -92,   -92,   -92,   145,   146,   -92,    11,    -1,   114,   -92,
-     -92,   -92,     6,   147,   148,   -92,   144,    30,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   152,   150,   -92,   -92,   -92,
-     -92,   -92,   -92,   155,   153,   -92,   -92,    74,   -92,   -92,
-     114,   -92,   158,   159,   160,   161,   -92,     6,     0,   -92,
-     147,    53,   148,   -92,   -92,   162,   163,   164,   165,   -92,
-     -92,   -92,   -92,    60,   -92,   -92,   -92,   -92,   -92,   -92,
-     169,   -92,   -92,   -92,   -92,    66,   -92,   -92,   -92,   -92,
-     -92,   -92,    71,    71,    71,    71,   170,   171,    36,   -92,
-     172,   173,   119,   174,    53,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,    86,   -92,   -92,   -92,    92,    93,
-      94,   121,    11,   -92,   143,   175,   -92,   149,   -92,   177,
-     179,    71,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   178,
-     -92,   151,   180,   -92,   -92,   102,   -92,   -92,    -6,     8,
-     178,   -92,   -92,   -92,   -92,   -92,   -92,   -92,    95,   -92,
-     -92,   -92,   -92,   -92,   182,   184,   186,   -92,   101,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   187,   188,   189,    -6,
-     -92,   190,   156,   157,   166,   192,     8,   -92,    96,   154,
-     168,   -92,   176,   -92,   -92,   -92,   181,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92
+     -44,   -79,   -79,   -79,    11,     5,     8,    16,   -79,   -79,
+     -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   -79,   -79,   -79,     5,   -11,     3,    15,   -79,    26,
+      65,    78,    61,    82,   -79,   -79,    80,   -79,   -79,   -79,
+     -79,   -79,   101,   105,   115,   127,   -79,   -79,   131,   -79,
+      76,   136,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   -79,     5,     5,   -79,    90,   137,   139,     3,   -79,
+     140,   141,    75,    85,    91,   142,   143,   144,   -79,   -79,
+      15,   -79,   -79,   146,   145,   147,   -79,   148,    99,   -79,
+     -79,   -79,   -79,   151,   152,   -79,     5,    15,   120,   -79,
+     -79,   -79,    -1,   153,   154,   -79,   150,    88,   -79,   -79,
+     -79,   -79,   -79,   -79,   -79,   155,   156,   -79,   -79,   -79,
+     -79,   -79,   -79,   158,   159,   -79,   -79,    18,   -79,   -79,
+     120,   -79,   161,   165,   166,   167,   -79,    -1,    50,   -79,
+     153,    52,   154,   -79,   -79,   168,   169,   170,   171,   -79,
+     -79,   -79,   -79,    89,   -79,   -79,   -79,   -79,   -79,   -79,
+     175,   -79,   -79,   176,   177,   -79,   -79,   -79,    98,   -79,
+     -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,    25,    25,
+      25,    25,   178,   179,    35,   -79,   180,   181,   119,   182,
+     183,   121,   135,    52,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   -79,   -79,   100,   -79,   -79,   -79,   104,   110,   124,
+     138,     5,   -79,   149,   184,   -79,   157,   187,   -79,   -79,
+     -79,   189,   190,    25,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   188,   -79,   -79,   160,   191,   -79,   -79,    19,   -79,
+     -79,    22,    81,   188,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   125,   -79,   -79,   -79,   -79,   -79,   192,   193,   195,
+     -79,   196,   198,   -79,   126,   -79,   -79,   -79,   -79,   -79,
+     -79,   -79,   -79,   -79,   -79,   199,   200,   201,    22,   -79,
+     202,   118,   164,   172,   203,   163,   173,   204,    81,   -79,
+      69,   185,   186,   -79,   194,   -79,   -79,   -79,   197,   -79,
+     -79,   205,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   -79
   };
 
   const unsigned char
@@ -1820,167 +1896,180 @@ namespace isc { namespace netconf {
       85,    86,    66,     0,    63,    64,   136,     0,   134,    39,
        0,   128,     0,     0,     0,     0,    78,     0,     0,    61,
        0,     0,     0,   133,   130,     0,     0,     0,     0,    82,
-      73,    75,    70,     0,    68,    71,    72,    65,   147,   152,
-       0,   150,   146,   144,   145,     0,   138,   140,   142,   143,
-     141,   135,     0,     0,     0,     0,     0,     0,     0,    67,
-       0,     0,     0,     0,     0,   137,   106,   108,   105,    99,
-     100,   101,   103,   104,     0,    96,    98,   102,     0,     0,
-       0,     0,     0,    69,     0,     0,   149,     0,   139,     0,
-       0,     0,    89,    91,    93,    95,    74,    76,   148,     0,
-     151,     0,     0,    97,   156,     0,   154,   107,     0,     0,
-       0,   153,   118,   123,   125,   117,   115,   116,     0,   110,
-     112,   113,   114,   165,     0,     0,     0,   170,     0,   158,
-     160,   161,   162,   163,   164,   155,     0,     0,     0,     0,
-     109,     0,     0,     0,     0,     0,     0,   157,     0,     0,
-       0,   111,     0,   167,   168,   169,     0,   159,   120,   121,
-     122,   119,   124,   126,   166,   171
+      73,    75,    70,     0,    68,    71,    72,    65,   150,   159,
+       0,   153,   155,     0,     0,   149,   147,   148,     0,   138,
+     140,   142,   143,   144,   145,   146,   141,   135,     0,     0,
+       0,     0,     0,     0,     0,    67,     0,     0,     0,     0,
+       0,     0,     0,     0,   137,   106,   108,   105,    99,   100,
+     101,   103,   104,     0,    96,    98,   102,     0,     0,     0,
+       0,     0,    69,     0,     0,   152,     0,     0,   157,   158,
+     139,     0,     0,     0,    89,    91,    93,    95,    74,    76,
+     151,     0,   154,   156,     0,     0,    97,   163,     0,   161,
+     107,     0,     0,     0,   160,   118,   123,   125,   117,   115,
+     116,     0,   110,   112,   113,   114,   175,     0,     0,     0,
+     180,     0,     0,   184,     0,   165,   167,   168,   169,   170,
+     171,   172,   173,   174,   162,     0,     0,     0,     0,   109,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   164,
+       0,     0,     0,   111,     0,   177,   178,   179,     0,   182,
+     183,     0,   166,   120,   121,   122,   119,   124,   126,   176,
+     181,   185
   };
 
-  const signed char
+  const short
   NetconfParser::yypgoto_[] =
   {
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -20,    81,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -27,   -92,
-     -92,   -92,   111,   -92,   -92,   112,   -92,   118,   -24,   -19,
-     -18,   -26,   -92,   -25,   -92,   -92,   -92,   -92,   -92,    59,
-     -92,   -92,    28,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,    47,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -50,    -4,   -92,   -92,   -92,   -92,   -92,   -51,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,    80,   -91,
-     -92,   -92,    69,   -92,   -92,    31,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -14,   -92,   -92,   -54,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92
+     -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -20,   123,
+     -79,   -79,   -79,   -79,    -6,   -79,   -79,   -79,   -27,   -79,
+     -79,   -79,   162,   -79,   -79,   116,   -79,   174,   -24,   -19,
+     -18,   -26,   -79,   -25,   -79,   -79,   -79,   -79,   -79,    79,
+     -79,   -79,    36,   -79,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,    84,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,
+     -43,     0,   -79,   -79,   -79,   -79,   -79,   -56,   -79,   -79,
+     -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,    94,   -78,
+     -79,   -79,    86,   -79,   -79,    34,   -79,   -79,   -79,   -79,
+     -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -14,   -79,
+     -79,   -57,   -79,   -79,   -79,   -79,   -79,   -79,   -79,   -79,
+     -79,   -79,   -79
   };
 
   const short
   NetconfParser::yydefgoto_[] =
   {
       -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
-      25,   100,    32,    33,    19,    24,    29,    30,   188,    21,
-      26,    36,    37,    38,    66,    50,    51,    52,   189,   190,
-     191,   192,    70,   193,    71,    58,    76,   123,   124,   125,
-     138,   153,   154,   155,   176,   156,   177,    59,   102,   115,
+      25,   100,    32,    33,    19,    24,    29,    30,   197,    21,
+      26,    36,    37,    38,    66,    50,    51,    52,   198,   199,
+     200,   201,    70,   202,    71,    58,    76,   123,   124,   125,
+     138,   153,   154,   155,   182,   156,   183,    59,   102,   115,
      116,   117,   118,   132,   119,   133,   120,   134,   121,   135,
-     194,   195,   196,   209,   197,   210,   238,   239,   240,   256,
-     281,   241,   257,   242,   258,    39,    67,   107,   108,    60,
-      77,   127,   128,   141,   165,   166,   167,   180,   168,   169,
-     183,   170,   181,   225,   226,   229,   248,   249,   250,   261,
-     251,   252,   253,   254,   265
+     203,   204,   205,   221,   206,   222,   251,   252,   253,   275,
+     306,   254,   276,   255,   277,    39,    67,   107,   108,    60,
+      77,   127,   128,   141,   168,   169,   170,   186,   171,   172,
+     189,   173,   190,   174,   175,   176,   187,   238,   239,   242,
+     264,   265,   266,   280,   267,   268,   269,   270,   284,   271,
+     272,   273,   287
   };
 
   const unsigned short
   NetconfParser::yytable_[] =
   {
-      49,    56,    57,    53,    28,    40,    41,   109,    54,    55,
-      40,    41,    42,    43,    44,    45,     9,   232,    10,    34,
-      11,   233,   234,   110,   111,   112,   113,     8,    46,    68,
-     150,   151,    47,   130,    69,     1,     2,     3,   131,   109,
-      48,    35,    81,    82,   243,    48,    48,   244,   245,   246,
-     247,    20,    48,    49,    56,    57,    53,    12,    13,    14,
-      15,    54,    55,   178,    40,    41,   150,   151,   179,   184,
-      49,    56,    57,    53,   185,   114,   105,   142,    54,    55,
-     143,    31,    40,    41,    42,    43,    44,   158,   159,   211,
-     160,   161,   186,   187,   212,   211,   211,   211,   259,    48,
-     213,   214,   215,   260,   266,   230,    22,    62,   231,   267,
-     114,   152,    61,    63,   162,   163,   164,    48,    64,    65,
-     278,   279,   280,   198,   199,   200,    72,    73,    74,    75,
-      78,    80,    89,    83,    84,    79,    85,    87,    88,    90,
-      91,    93,    92,    94,    96,    97,   101,    47,    98,    10,
-     103,   104,   129,   137,   122,   126,   140,   162,   163,   164,
-     136,   139,   145,   146,   147,   148,   206,   216,    99,   172,
-     173,   174,   175,   182,   201,   202,   204,   205,   207,    86,
-     219,   221,   217,   222,   149,   224,   262,   228,   263,   218,
-     264,   268,   269,   270,   272,   220,   276,   227,    95,   157,
-     282,   235,   236,   237,   274,   273,   203,   223,   271,   106,
-     144,   171,   277,   275,   283,   208,   255,     0,     0,     0,
-       0,     0,   284,     0,     0,     0,     0,   285,     0,     0,
-       0,     0,   235,   236,   237
+      49,    56,    57,    53,    28,     1,     2,     3,    54,    55,
+       9,     8,    10,    34,    11,    20,   110,   111,   112,   113,
+     109,   142,   243,    22,   143,   244,    40,    41,    42,    43,
+      44,    45,    61,    40,    41,    35,    40,    41,    42,    43,
+      44,    31,    81,    82,    46,   245,   195,   196,    47,   246,
+     247,    48,   109,    49,    56,    57,    53,    12,    13,    14,
+      15,    54,    55,    40,    41,   150,   151,    48,    62,    64,
+      49,    56,    57,    53,    48,   114,   105,    48,    54,    55,
+     150,   151,    63,    68,    79,    65,   158,   159,    69,   160,
+     161,   130,   184,   303,   304,   305,   131,   185,   162,   163,
+     164,   193,    48,   223,    48,    72,   194,   223,   224,    73,
+     114,   152,   225,   223,   165,   166,   167,   256,   226,    74,
+     257,   258,   259,   260,   261,   262,   263,   223,   278,   288,
+      89,    75,   227,   279,   289,    78,   207,   208,   209,    80,
+      90,    84,    83,    85,    87,    88,    91,    93,    94,    92,
+      96,   101,    97,    47,    98,    10,   103,   104,   129,   137,
+     122,   126,   140,   136,   139,   145,   165,   166,   167,   146,
+     147,   148,   215,   295,   218,   178,   179,   180,   181,   188,
+     191,   192,   210,   211,   213,   214,   216,   217,   219,   231,
+     228,   229,     9,   234,   235,   237,   281,   282,   241,   283,
+     285,   230,   286,   290,   291,   292,   294,   298,   301,   232,
+      99,   233,   240,   106,   248,   249,   250,   296,   299,   157,
+     212,   149,   293,   236,   144,   297,   300,   220,   177,   274,
+      86,   302,     0,     0,     0,     0,     0,   307,   308,     0,
+       0,     0,     0,     0,     0,     0,   309,     0,     0,   310,
+       0,   248,   249,   250,    95,     0,     0,   311
   };
 
   const short
   NetconfParser::yycheck_[] =
   {
-      27,    27,    27,    27,    24,    11,    12,    98,    27,    27,
-      11,    12,    13,    14,    15,    16,     5,    23,     7,    10,
-       9,    27,    28,    17,    18,    19,    20,     0,    29,     3,
-      30,    31,    33,     3,     8,    43,    44,    45,     8,   130,
-      46,    32,    62,    63,    36,    46,    46,    39,    40,    41,
-      42,     7,    46,    80,    80,    80,    80,    46,    47,    48,
-      49,    80,    80,     3,    11,    12,    30,    31,     8,     3,
-      97,    97,    97,    97,     8,   102,    96,     3,    97,    97,
-       6,    46,    11,    12,    13,    14,    15,    34,    35,     3,
-      37,    38,    21,    22,     8,     3,     3,     3,     3,    46,
-       8,     8,     8,     8,     3,     3,     7,     3,     6,     8,
-     137,   138,     6,     4,   141,   141,   141,    46,     8,     3,
-      24,    25,    26,   173,   174,   175,     4,     4,     4,     4,
-       4,     3,    49,    46,     4,     8,     4,     4,     4,    49,
-      49,     4,     7,     4,     4,     7,    46,    33,     7,     7,
-       5,     5,     8,     3,     7,     7,     3,   184,   184,   184,
-       8,     6,     4,     4,     4,     4,    47,    46,    87,     7,
-       7,     7,     7,     4,     4,     4,     4,     4,     4,    68,
-       5,     4,   202,     4,   137,     7,     4,     7,     4,    46,
-       4,     4,     4,     4,     4,    46,     4,    46,    80,   140,
-      46,   228,   228,   228,    47,    49,   178,   211,   259,    97,
-     130,   142,   266,    47,    46,   184,   230,    -1,    -1,    -1,
-      -1,    -1,    46,    -1,    -1,    -1,    -1,    46,    -1,    -1,
-      -1,    -1,   259,   259,   259
+      27,    27,    27,    27,    24,    49,    50,    51,    27,    27,
+       5,     0,     7,    10,     9,     7,    17,    18,    19,    20,
+      98,     3,     3,     7,     6,     6,    11,    12,    13,    14,
+      15,    16,     6,    11,    12,    32,    11,    12,    13,    14,
+      15,    52,    62,    63,    29,    23,    21,    22,    33,    27,
+      28,    52,   130,    80,    80,    80,    80,    52,    53,    54,
+      55,    80,    80,    11,    12,    30,    31,    52,     3,     8,
+      97,    97,    97,    97,    52,   102,    96,    52,    97,    97,
+      30,    31,     4,     3,     8,     3,    34,    35,     8,    37,
+      38,     3,     3,    24,    25,    26,     8,     8,    46,    47,
+      48,     3,    52,     3,    52,     4,     8,     3,     8,     4,
+     137,   138,     8,     3,   141,   141,   141,    36,     8,     4,
+      39,    40,    41,    42,    43,    44,    45,     3,     3,     3,
+      55,     4,     8,     8,     8,     4,   179,   180,   181,     3,
+      55,     4,    52,     4,     4,     4,    55,     4,     4,     7,
+       4,    52,     7,    33,     7,     7,     5,     5,     8,     3,
+       7,     7,     3,     8,     6,     4,   193,   193,   193,     4,
+       4,     4,    53,    55,    53,     7,     7,     7,     7,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,    53,     5,
+      52,   211,     5,     4,     4,     7,     4,     4,     7,     4,
+       4,    52,     4,     4,     4,     4,     4,     4,     4,    52,
+      87,   217,    52,    97,   241,   241,   241,    53,    55,   140,
+     184,   137,   278,   223,   130,    53,    53,   193,   142,   243,
+      68,   288,    -1,    -1,    -1,    -1,    -1,    52,    52,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    52,
+      -1,   278,   278,   278,    80,    -1,    -1,    52
   };
 
   const unsigned char
   NetconfParser::yystos_[] =
   {
-       0,    43,    44,    45,    51,    52,    53,    54,     0,     5,
-       7,     9,    46,    47,    48,    49,    57,    58,    59,    64,
-       7,    69,     7,    55,    65,    60,    70,    56,    58,    66,
-      67,    46,    62,    63,    10,    32,    71,    72,    73,   125,
-      11,    12,    13,    14,    15,    16,    29,    33,    46,    68,
-      75,    76,    77,    78,    79,    80,    81,    83,    85,    97,
-     129,     6,     3,     4,     8,     3,    74,   126,     3,     8,
-      82,    84,     4,     4,     4,     4,    86,   130,     4,     8,
-       3,    58,    58,    46,     4,     4,    72,     4,     4,    49,
-      49,    49,     7,     4,     4,    77,     4,     7,     7,    59,
-      61,    46,    98,     5,     5,    58,    75,   127,   128,   129,
-      17,    18,    19,    20,    68,    99,   100,   101,   102,   104,
-     106,   108,     7,    87,    88,    89,     7,   131,   132,     8,
-       3,     8,   103,   105,   107,   109,     8,     3,    90,     6,
-       3,   133,     3,     6,   128,     4,     4,     4,     4,   101,
-      30,    31,    68,    91,    92,    93,    95,    89,    34,    35,
-      37,    38,    68,    81,    83,   134,   135,   136,   138,   139,
-     141,   132,     7,     7,     7,     7,    94,    96,     3,     8,
-     137,   142,     4,   140,     3,     8,    21,    22,    68,    78,
-      79,    80,    81,    83,   110,   111,   112,   114,   110,   110,
-     110,     4,     4,    92,     4,     4,    47,     4,   135,   113,
-     115,     3,     8,     8,     8,     8,    46,    58,    46,     5,
-      46,     4,     4,   111,     7,   143,   144,    46,     7,   145,
-       3,     6,    23,    27,    28,    68,    81,    83,   116,   117,
-     118,   121,   123,    36,    39,    40,    41,    42,   146,   147,
-     148,   150,   151,   152,   153,   144,   119,   122,   124,     3,
-       8,   149,     4,     4,     4,   154,     3,     8,     4,     4,
-       4,   117,     4,    49,    47,    47,     4,   147,    24,    25,
-      26,   120,    46,    46,    46,    46
+       0,    49,    50,    51,    57,    58,    59,    60,     0,     5,
+       7,     9,    52,    53,    54,    55,    63,    64,    65,    70,
+       7,    75,     7,    61,    71,    66,    76,    62,    64,    72,
+      73,    52,    68,    69,    10,    32,    77,    78,    79,   131,
+      11,    12,    13,    14,    15,    16,    29,    33,    52,    74,
+      81,    82,    83,    84,    85,    86,    87,    89,    91,   103,
+     135,     6,     3,     4,     8,     3,    80,   132,     3,     8,
+      88,    90,     4,     4,     4,     4,    92,   136,     4,     8,
+       3,    64,    64,    52,     4,     4,    78,     4,     4,    55,
+      55,    55,     7,     4,     4,    83,     4,     7,     7,    65,
+      67,    52,   104,     5,     5,    64,    81,   133,   134,   135,
+      17,    18,    19,    20,    74,   105,   106,   107,   108,   110,
+     112,   114,     7,    93,    94,    95,     7,   137,   138,     8,
+       3,     8,   109,   111,   113,   115,     8,     3,    96,     6,
+       3,   139,     3,     6,   134,     4,     4,     4,     4,   107,
+      30,    31,    74,    97,    98,    99,   101,    95,    34,    35,
+      37,    38,    46,    47,    48,    74,    87,    89,   140,   141,
+     142,   144,   145,   147,   149,   150,   151,   138,     7,     7,
+       7,     7,   100,   102,     3,     8,   143,   152,     4,   146,
+     148,     4,     4,     3,     8,    21,    22,    74,    84,    85,
+      86,    87,    89,   116,   117,   118,   120,   116,   116,   116,
+       4,     4,    98,     4,     4,    53,     4,     4,    53,    53,
+     141,   119,   121,     3,     8,     8,     8,     8,    52,    64,
+      52,     5,    52,    70,     4,     4,   117,     7,   153,   154,
+      52,     7,   155,     3,     6,    23,    27,    28,    74,    87,
+      89,   122,   123,   124,   127,   129,    36,    39,    40,    41,
+      42,    43,    44,    45,   156,   157,   158,   160,   161,   162,
+     163,   165,   166,   167,   154,   125,   128,   130,     3,     8,
+     159,     4,     4,     4,   164,     4,     4,   168,     3,     8,
+       4,     4,     4,   123,     4,    55,    53,    53,     4,    55,
+      53,     4,   157,    24,    25,    26,   126,    52,    52,    52,
+      52,    52
   };
 
   const unsigned char
   NetconfParser::yyr1_[] =
   {
-       0,    50,    52,    51,    53,    51,    54,    51,    56,    55,
-      57,    58,    58,    58,    58,    58,    58,    58,    60,    59,
-      61,    62,    62,    63,    63,    65,    64,    66,    66,    67,
-      67,    68,    70,    69,    71,    71,    72,    72,    74,    73,
-      75,    75,    76,    76,    77,    77,    77,    77,    77,    77,
-      77,    77,    77,    78,    79,    80,    82,    81,    84,    83,
-      86,    85,    87,    87,    88,    88,    90,    89,    91,    91,
-      91,    92,    92,    94,    93,    96,    95,    98,    97,    99,
-      99,   100,   100,   101,   101,   101,   101,   101,   103,   102,
-     105,   104,   107,   106,   109,   108,   110,   110,   111,   111,
-     111,   111,   111,   111,   111,   111,   113,   112,   115,   114,
-     116,   116,   117,   117,   117,   117,   117,   117,   119,   118,
-     120,   120,   120,   122,   121,   124,   123,   126,   125,   127,
-     127,   128,   130,   129,   131,   131,   133,   132,   134,   134,
-     135,   135,   135,   135,   135,   135,   135,   137,   136,   138,
-     140,   139,   142,   141,   143,   143,   145,   144,   146,   146,
-     147,   147,   147,   147,   147,   149,   148,   150,   151,   152,
-     154,   153
+       0,    56,    58,    57,    59,    57,    60,    57,    62,    61,
+      63,    64,    64,    64,    64,    64,    64,    64,    66,    65,
+      67,    68,    68,    69,    69,    71,    70,    72,    72,    73,
+      73,    74,    76,    75,    77,    77,    78,    78,    80,    79,
+      81,    81,    82,    82,    83,    83,    83,    83,    83,    83,
+      83,    83,    83,    84,    85,    86,    88,    87,    90,    89,
+      92,    91,    93,    93,    94,    94,    96,    95,    97,    97,
+      97,    98,    98,   100,    99,   102,   101,   104,   103,   105,
+     105,   106,   106,   107,   107,   107,   107,   107,   109,   108,
+     111,   110,   113,   112,   115,   114,   116,   116,   117,   117,
+     117,   117,   117,   117,   117,   117,   119,   118,   121,   120,
+     122,   122,   123,   123,   123,   123,   123,   123,   125,   124,
+     126,   126,   126,   128,   127,   130,   129,   132,   131,   133,
+     133,   134,   136,   135,   137,   137,   139,   138,   140,   140,
+     141,   141,   141,   141,   141,   141,   141,   141,   141,   141,
+     143,   142,   144,   146,   145,   148,   147,   149,   150,   152,
+     151,   153,   153,   155,   154,   156,   156,   157,   157,   157,
+     157,   157,   157,   157,   157,   159,   158,   160,   161,   162,
+     164,   163,   165,   166,   168,   167
   };
 
   const unsigned char
@@ -2000,10 +2089,11 @@ namespace isc { namespace netconf {
        1,     3,     1,     1,     1,     1,     1,     1,     0,     4,
        1,     1,     1,     0,     4,     0,     4,     0,     6,     1,
        3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
-       0,     4,     0,     6,     1,     3,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     3,     0,     4,     0,     4,     3,     3,     0,
+       6,     1,     3,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     0,     4,     3,     3,     3,
-       0,     4
+       0,     4,     3,     3,     0,     4
   };
 
 
@@ -2022,55 +2112,61 @@ namespace isc { namespace netconf {
   "\"socket-url\"", "\"hooks-libraries\"", "\"library\"", "\"parameters\"",
   "\"Logging\"", "\"loggers\"", "\"name\"", "\"output_options\"",
   "\"output\"", "\"debuglevel\"", "\"severity\"", "\"flush\"",
-  "\"maxsize\"", "\"maxver\"", "\"pattern\"", "START_JSON",
-  "START_NETCONF", "START_SUB_NETCONF", "\"constant string\"",
-  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
-  "$@1", "$@2", "$@3", "sub_netconf", "$@4", "json", "value", "map", "$@5",
-  "map_value", "map_content", "not_empty_map", "list_generic", "$@6",
-  "list_content", "not_empty_list", "unknown_map_entry",
-  "netconf_syntax_map", "$@7", "global_objects", "global_object",
-  "netconf_object", "$@8", "global_params", "not_empty_global_params",
-  "global_param", "boot_update", "subscribe_changes", "validate_changes",
-  "user_context", "$@9", "comment", "$@10", "hooks_libraries", "$@11",
-  "hooks_libraries_list", "not_empty_hooks_libraries_list",
-  "hooks_library", "$@12", "hooks_params", "hooks_param", "library",
-  "$@13", "parameters", "$@14", "managed_servers", "$@15",
-  "servers_entries", "not_empty_servers_entries", "server_entry",
-  "dhcp4_server", "$@16", "dhcp6_server", "$@17", "d2_server", "$@18",
-  "ca_server", "$@19", "managed_server_params", "managed_server_param",
-  "model", "$@20", "control_socket", "$@21", "control_socket_params",
+  "\"maxsize\"", "\"maxver\"", "\"pattern\"", "\"async\"",
+  "\"async-queue-size\"", "\"async-overflow\"",
+  "\"rate-limited-messages\"", "\"rate-limit\"", "\"rate-limit-interval\"",
+  "START_JSON", "START_NETCONF", "START_SUB_NETCONF",
+  "\"constant string\"", "\"integer\"", "\"floating point\"",
+  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "sub_netconf",
+  "$@4", "json", "value", "map", "$@5", "map_value", "map_content",
+  "not_empty_map", "list_generic", "$@6", "list_content", "not_empty_list",
+  "unknown_map_entry", "netconf_syntax_map", "$@7", "global_objects",
+  "global_object", "netconf_object", "$@8", "global_params",
+  "not_empty_global_params", "global_param", "boot_update",
+  "subscribe_changes", "validate_changes", "user_context", "$@9",
+  "comment", "$@10", "hooks_libraries", "$@11", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@12",
+  "hooks_params", "hooks_param", "library", "$@13", "parameters", "$@14",
+  "managed_servers", "$@15", "servers_entries",
+  "not_empty_servers_entries", "server_entry", "dhcp4_server", "$@16",
+  "dhcp6_server", "$@17", "d2_server", "$@18", "ca_server", "$@19",
+  "managed_server_params", "managed_server_param", "model", "$@20",
+  "control_socket", "$@21", "control_socket_params",
   "control_socket_param", "socket_type", "$@22", "socket_type_value",
   "socket_name", "$@23", "socket_url", "$@24", "logging_object", "$@25",
   "logging_params", "logging_param", "loggers", "$@26", "loggers_entries",
   "logger_entry", "$@27", "logger_params", "logger_param", "name", "$@28",
-  "debuglevel", "severity", "$@29", "output_options_list", "$@30",
-  "output_options_list_content", "output_entry", "$@31",
-  "output_params_list", "output_params", "output", "$@32", "flush",
-  "maxsize", "maxver", "pattern", "$@33", YY_NULLPTR
+  "debuglevel", "severity", "$@29", "rate_limited_messages", "$@30",
+  "rate_limit", "rate_limit_interval", "output_options_list", "$@31",
+  "output_options_list_content", "output_entry", "$@32",
+  "output_params_list", "output_params", "output", "$@33", "flush",
+  "maxsize", "maxver", "pattern", "$@34", "async", "async_queue_size",
+  "async_overflow", "$@35", YY_NULLPTR
   };
 
 #if NETCONF_DEBUG
   const unsigned short
   NetconfParser::yyrline_[] =
   {
-       0,   119,   119,   119,   120,   120,   121,   121,   129,   129,
-     140,   146,   147,   148,   149,   150,   151,   152,   156,   156,
-     167,   172,   173,   181,   185,   192,   192,   198,   199,   202,
-     206,   219,   227,   227,   239,   240,   244,   245,   249,   249,
-     266,   267,   270,   271,   276,   277,   278,   279,   280,   281,
-     282,   283,   284,   287,   292,   297,   302,   302,   327,   327,
-     355,   355,   365,   366,   369,   370,   373,   373,   381,   382,
-     383,   386,   387,   390,   390,   398,   398,   408,   408,   418,
-     419,   422,   423,   429,   430,   431,   432,   433,   437,   437,
-     448,   448,   459,   459,   470,   470,   481,   482,   486,   487,
-     488,   489,   490,   491,   492,   493,   497,   497,   506,   506,
-     517,   518,   521,   522,   523,   524,   525,   526,   529,   529,
-     537,   538,   539,   542,   542,   551,   551,   566,   566,   579,
-     580,   584,   588,   588,   600,   601,   605,   605,   613,   614,
-     617,   618,   619,   620,   621,   622,   623,   626,   626,   634,
-     639,   639,   647,   647,   657,   658,   661,   661,   669,   670,
-     673,   674,   675,   676,   677,   680,   680,   688,   693,   698,
-     703,   703
+       0,   125,   125,   125,   126,   126,   127,   127,   135,   135,
+     146,   152,   153,   154,   155,   156,   157,   158,   162,   162,
+     173,   178,   179,   187,   191,   198,   198,   204,   205,   208,
+     212,   225,   233,   233,   245,   246,   250,   251,   255,   255,
+     272,   273,   276,   277,   282,   283,   284,   285,   286,   287,
+     288,   289,   290,   293,   298,   303,   308,   308,   333,   333,
+     361,   361,   371,   372,   375,   376,   379,   379,   387,   388,
+     389,   392,   393,   396,   396,   404,   404,   414,   414,   424,
+     425,   428,   429,   435,   436,   437,   438,   439,   443,   443,
+     454,   454,   465,   465,   476,   476,   487,   488,   492,   493,
+     494,   495,   496,   497,   498,   499,   503,   503,   512,   512,
+     523,   524,   527,   528,   529,   530,   531,   532,   535,   535,
+     543,   544,   545,   548,   548,   557,   557,   572,   572,   585,
+     586,   590,   594,   594,   606,   607,   611,   611,   619,   620,
+     623,   624,   625,   626,   627,   628,   629,   630,   631,   632,
+     635,   635,   643,   648,   648,   656,   656,   665,   670,   675,
+     675,   685,   686,   689,   689,   697,   698,   701,   702,   703,
+     704,   705,   706,   707,   708,   711,   711,   719,   724,   729,
+     734,   734,   742,   747,   752,   752
   };
 
   // Print the state stack on the debug stream.
@@ -2105,7 +2201,7 @@ namespace isc { namespace netconf {
 
 #line 14 "netconf_parser.yy"
 } } // isc::netconf
-#line 2109 "netconf_parser.cc"
+#line 2205 "netconf_parser.cc"
 
 #line 711 "netconf_parser.yy"
 
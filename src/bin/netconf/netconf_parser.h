@@ -487,13 +487,19 @@ namespace isc { namespace netconf {
         TOKEN_MAXSIZE = 295,
         TOKEN_MAXVER = 296,
         TOKEN_PATTERN = 297,
-        TOKEN_START_JSON = 298,
-        TOKEN_START_NETCONF = 299,
-        TOKEN_START_SUB_NETCONF = 300,
-        TOKEN_STRING = 301,
-        TOKEN_INTEGER = 302,
-        TOKEN_FLOAT = 303,
-        TOKEN_BOOLEAN = 304
+        TOKEN_ASYNC = 298,
+        TOKEN_ASYNC_QUEUE_SIZE = 299,
+        TOKEN_ASYNC_OVERFLOW = 300,
+        TOKEN_RATE_LIMITED_MESSAGES = 301,
+        TOKEN_RATE_LIMIT = 302,
+        TOKEN_RATE_LIMIT_INTERVAL = 303,
+        TOKEN_START_JSON = 304,
+        TOKEN_START_NETCONF = 305,
+        TOKEN_START_SUB_NETCONF = 306,
+        TOKEN_STRING = 307,
+        TOKEN_INTEGER = 308,
+        TOKEN_FLOAT = 309,
+        TOKEN_BOOLEAN = 310
       };
     };
 
@@ -635,25 +641,25 @@ namespace isc { namespace netconf {
         // Type destructor.
 switch (yytype)
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -736,13 +742,13 @@ switch (yytype)
       symbol_type (int tok, location_type l)
         : super_type(token_type (tok), std::move (l))
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_NETCONF || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_BOOT_UPDATE || tok == token::TOKEN_SUBSCRIBE_CHANGES || tok == token::TOKEN_VALIDATE_CHANGES || tok == token::TOKEN_MANAGED_SERVERS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_CA_SERVER || tok == token::TOKEN_MODEL || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HTTP || tok == token::TOKEN_STDOUT || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_URL || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_NETCONF || tok == token::TOKEN_START_SUB_NETCONF);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_NETCONF || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_BOOT_UPDATE || tok == token::TOKEN_SUBSCRIBE_CHANGES || tok == token::TOKEN_VALIDATE_CHANGES || tok == token::TOKEN_MANAGED_SERVERS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_CA_SERVER || tok == token::TOKEN_MODEL || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HTTP || tok == token::TOKEN_STDOUT || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_URL || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_NETCONF || tok == token::TOKEN_START_SUB_NETCONF);
       }
 #else
       symbol_type (int tok, const location_type& l)
         : super_type(token_type (tok), l)
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_NETCONF || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_BOOT_UPDATE || tok == token::TOKEN_SUBSCRIBE_CHANGES || tok == token::TOKEN_VALIDATE_CHANGES || tok == token::TOKEN_MANAGED_SERVERS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_CA_SERVER || tok == token::TOKEN_MODEL || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HTTP || tok == token::TOKEN_STDOUT || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_URL || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_NETCONF || tok == token::TOKEN_START_SUB_NETCONF);
+        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_NETCONF || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_BOOT_UPDATE || tok == token::TOKEN_SUBSCRIBE_CHANGES || tok == token::TOKEN_VALIDATE_CHANGES || tok == token::TOKEN_MANAGED_SERVERS || tok == token::TOKEN_DHCP4_SERVER || tok == token::TOKEN_DHCP6_SERVER || tok == token::TOKEN_D2_SERVER || tok == token::TOKEN_CA_SERVER || tok == token::TOKEN_MODEL || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_UNIX || tok == token::TOKEN_HTTP || tok == token::TOKEN_STDOUT || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_SOCKET_URL || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_PATTERN || tok == token::TOKEN_ASYNC || tok == token::TOKEN_ASYNC_QUEUE_SIZE || tok == token::TOKEN_ASYNC_OVERFLOW || tok == token::TOKEN_RATE_LIMITED_MESSAGES || tok == token::TOKEN_RATE_LIMIT || tok == token::TOKEN_RATE_LIMIT_INTERVAL || tok == token::TOKEN_START_JSON || tok == token::TOKEN_START_NETCONF || tok == token::TOKEN_START_SUB_NETCONF);
       }
 #endif
 #if 201103L <= YY_CPLUSPLUS
@@ -1449,6 +1455,96 @@ switch (yytype)
         return symbol_type (token::TOKEN_PATTERN, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_OVERFLOW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_OVERFLOW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITED_MESSAGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITED_MESSAGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1600,7 +1696,7 @@ switch (yytype)
   static const unsigned char yydefact_[];
 
   // YYPGOTO[NTERM-NUM].
-  static const signed char yypgoto_[];
+  static const short yypgoto_[];
 
   // YYDEFGOTO[NTERM-NUM].
   static const short yydefgoto_[];
@@ -1860,12 +1956,12 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 234,     ///< Last index in yytable_.
-      yynnts_ = 105,  ///< Number of nonterminal symbols.
+      yylast_ = 257,     ///< Last index in yytable_.
+      yynnts_ = 113,  ///< Number of nonterminal symbols.
       yyfinal_ = 8, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 50  ///< Number of tokens.
+      yyntokens_ = 56  ///< Number of tokens.
     };
 
 
@@ -1913,9 +2009,10 @@ switch (yytype)
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55
     };
-    const unsigned user_token_number_max_ = 304;
+    const unsigned user_token_number_max_ = 310;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int> (t) <= yyeof_)
@@ -1936,25 +2033,25 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -1973,25 +2070,25 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -2017,25 +2114,25 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 58: // value
-      case 61: // map_value
-      case 120: // socket_type_value
+      case 64: // value
+      case 67: // map_value
+      case 126: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 49: // "boolean"
+      case 55: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 48: // "floating point"
+      case 54: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 47: // "integer"
+      case 53: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 46: // "constant string"
+      case 52: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -2107,14 +2204,15 @@ switch (yytype)
      265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310
     };
     return token_type (yytoken_number_[type]);
   }
 
 #line 14 "netconf_parser.yy"
 } } // isc::netconf
-#line 2118 "netconf_parser.h"
+#line 2216 "netconf_parser.h"
 
 
 
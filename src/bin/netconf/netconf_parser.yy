@@ -86,6 +86,12 @@ using namespace std;
   MAXSIZE "maxsize"
   MAXVER "maxver"
   PATTERN "pattern"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
+  ASYNC_OVERFLOW "async-overflow"
+  RATE_LIMITED_MESSAGES "rate-limited-messages"
+  RATE_LIMIT "rate-limit"
+  RATE_LIMIT_INTERVAL "rate-limit-interval"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse. This define the starting point. It either can be full grammar
@@ -618,6 +624,9 @@ logger_param: name
             | output_options_list
             | debuglevel
             | severity
+            | rate_limited_messages
+            | rate_limit
+            | rate_limit_interval
             | user_context
             | comment
             | unknown_map_entry
@@ -644,6 +653,25 @@ severity: SEVERITY {
     ctx.leave();
 };
 
+rate_limited_messages: RATE_LIMITED_MESSAGES {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON list_generic {
+    ElementPtr l = ctx.stack_.back();
+    ctx.stack_.pop_back();
+    ctx.stack_.back()->set("rate-limited-messages", l);
+    ctx.leave();
+};
+
+rate_limit: RATE_LIMIT COLON INTEGER {
+    ElementPtr limit(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate-limit", limit);
+};
+
+rate_limit_interval: RATE_LIMIT_INTERVAL COLON INTEGER {
+    ElementPtr interval(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate-limit-interval", interval);
+};
+
 output_options_list: OUTPUT_OPTIONS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("output_options", l);
@@ -675,6 +703,9 @@ output_params: output
              | maxsize
              | maxver
              | pattern
+             | async
+             | async_queue_size
+             | async_overflow
              ;
 
 output: OUTPUT {
@@ -708,6 +739,24 @@ pattern: PATTERN {
     ctx.leave();
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
+async_overflow: ASYNC_OVERFLOW {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON STRING {
+    ElementPtr overflow(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async-overflow", overflow);
+    ctx.leave();
+};
+
 %%
 
 void
@@ -0,0 +1,323 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <host_cache.h>
+#include <algorithm>
+
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+
+namespace isc {
+namespace host_cache {
+
+HostCache::HostCache(size_t maximum, uint32_t ttl)
+    : maximum_(maximum), ttl_(ttl), cache_(), hits_(0), misses_(0),
+      mutex_() {
+}
+
+ConstHostCollection
+HostCache::getAll(const Host::IdentifierType&, const uint8_t*,
+                  const size_t) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getAll4(const SubnetID&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getAll6(const SubnetID&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getAllbyHostname(const std::string&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getAllbyHostname4(const std::string&, const SubnetID&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getAllbyHostname6(const std::string&, const SubnetID&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getPage4(const SubnetID&, size_t&, uint64_t,
+                    const HostPageSize&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getPage6(const SubnetID&, size_t&, uint64_t,
+                    const HostPageSize&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostCollection
+HostCache::getAll4(const IOAddress&) const {
+    return (ConstHostCollection());
+}
+
+ConstHostPtr
+HostCache::get4(const SubnetID& subnet_id,
+                const Host::IdentifierType& identifier_type,
+                const uint8_t* identifier_begin,
+                const size_t identifier_len) const {
+    return (get(true, subnet_id, identifier_type, identifier_begin,
+                identifier_len));
+}
+
+ConstHostPtr
+HostCache::get4(const SubnetID& subnet_id, const IOAddress& address) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& idx = cache_.get<2>();
+    auto range = idx.equal_range(boost::make_tuple(address, subnet_id));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->host_->getNegative()) {
+            continue;
+        }
+        return (use(cache_.project<0>(it)));
+    }
+    ++misses_;
+    return (ConstHostPtr());
+}
+
+ConstHostPtr
+HostCache::get6(const SubnetID& subnet_id,
+                const Host::IdentifierType& identifier_type,
+                const uint8_t* identifier_begin,
+                const size_t identifier_len) const {
+    return (get(false, subnet_id, identifier_type, identifier_begin,
+                identifier_len));
+}
+
+ConstHostPtr
+HostCache::get6(const IOAddress&, const uint8_t) const {
+    return (ConstHostPtr());
+}
+
+ConstHostPtr
+HostCache::get6(const SubnetID&, const IOAddress&) const {
+    return (ConstHostPtr());
+}
+
+void
+HostCache::add(const HostPtr&) {
+}
+
+bool
+HostCache::del(const SubnetID& subnet_id, const IOAddress& addr) {
+    if (!addr.isV4()) {
+        return (false);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& idx = cache_.get<2>();
+    auto range = idx.equal_range(boost::make_tuple(addr, subnet_id));
+    idx.erase(range.first, range.second);
+    return (false);
+}
+
+bool
+HostCache::del4(const SubnetID& subnet_id,
+                const Host::IdentifierType& identifier_type,
+                const uint8_t* identifier_begin,
+                const size_t identifier_len) {
+    removeById(true, subnet_id, identifier_type, identifier_begin,
+               identifier_len);
+    return (false);
+}
+
+bool
+HostCache::del6(const SubnetID& subnet_id,
+                const Host::IdentifierType& identifier_type,
+                const uint8_t* identifier_begin,
+                const size_t identifier_len) {
+    removeById(false, subnet_id, identifier_type, identifier_begin,
+               identifier_len);
+    return (false);
+}
+
+size_t
+HostCache::insert(const ConstHostPtr& host, bool overwrite) {
+    if (!host) {
+        return (0);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Collect the conflicting entries.
+    std::vector<HostCacheContainer::iterator> conflicts;
+    const SubnetID& subnet_id4 = host->getIPv4SubnetID();
+    const SubnetID& subnet_id6 = host->getIPv6SubnetID();
+    const auto& id_idx = cache_.get<1>();
+    auto range = id_idx.equal_range(boost::make_tuple(host->getIdentifier(),
+                                                      host->getIdentifierType()));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (((subnet_id4 != SUBNET_ID_UNUSED) &&
+             (it->host_->getIPv4SubnetID() == subnet_id4)) ||
+            ((subnet_id6 != SUBNET_ID_UNUSED) &&
+             (it->host_->getIPv6SubnetID() == subnet_id6))) {
+            conflicts.push_back(cache_.project<0>(it));
+        }
+    }
+    const IOAddress& address = host->getIPv4Reservation();
+    if (!address.isV4Zero() && (subnet_id4 != SUBNET_ID_UNUSED)) {
+        const auto& addr_idx = cache_.get<2>();
+        auto arange = addr_idx.equal_range(boost::make_tuple(address,
+                                                             subnet_id4));
+        for (auto it = arange.first; it != arange.second; ++it) {
+            auto entry = cache_.project<0>(it);
+            if (std::find(conflicts.begin(), conflicts.end(), entry) ==
+                conflicts.end()) {
+                conflicts.push_back(entry);
+            }
+        }
+    }
+
+    size_t count = conflicts.size();
+    if (count > 0) {
+        if (!overwrite) {
+            return (1);
+        }
+        for (auto entry : conflicts) {
+            cache_.erase(entry);
+        }
+    }
+
+    time_t expire = (ttl_ > 0 ? getCurrentTime() + ttl_ : 0);
+    cache_.push_front(HostCacheEntry(host, expire));
+
+    // Evict the least recently used entries.
+    while ((maximum_ > 0) && (cache_.size() > maximum_)) {
+        cache_.pop_back();
+    }
+    return (count);
+}
+
+bool
+HostCache::remove(const HostPtr& host) {
+    if (!host) {
+        return (false);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& idx = cache_.get<1>();
+    auto range = idx.equal_range(boost::make_tuple(host->getIdentifier(),
+                                                   host->getIdentifierType()));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->host_ == host) {
+            idx.erase(it);
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void
+HostCache::flush(size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((count == 0) || (count >= cache_.size())) {
+        cache_.clear();
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        cache_.pop_back();
+    }
+}
+
+size_t
+HostCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (cache_.size());
+}
+
+uint64_t
+HostCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (hits_);
+}
+
+uint64_t
+HostCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (misses_);
+}
+
+ElementPtr
+HostCache::getStatistics() const {
+    ElementPtr stats = Element::createMap();
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats->set("size", Element::create(static_cast<int64_t>(cache_.size())));
+    stats->set("capacity", Element::create(static_cast<int64_t>(maximum_)));
+    stats->set("hits", Element::create(static_cast<int64_t>(hits_)));
+    stats->set("misses", Element::create(static_cast<int64_t>(misses_)));
+    return (stats);
+}
+
+ConstHostPtr
+HostCache::get(bool v4, const SubnetID& subnet_id,
+               const Host::IdentifierType& identifier_type,
+               const uint8_t* identifier_begin,
+               const size_t identifier_len) const {
+    std::vector<uint8_t> identifier(identifier_begin,
+                                    identifier_begin + identifier_len);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& idx = cache_.get<1>();
+    auto range = idx.equal_range(boost::make_tuple(identifier,
+                                                   identifier_type));
+    for (auto it = range.first; it != range.second; ++it) {
+        const SubnetID& id = (v4 ? it->host_->getIPv4SubnetID() :
+                              it->host_->getIPv6SubnetID());
+        if (id == subnet_id) {
+            return (use(cache_.project<0>(it)));
+        }
+    }
+    ++misses_;
+    return (ConstHostPtr());
+}
+
+ConstHostPtr
+HostCache::use(HostCacheContainer::iterator entry) const {
+    if ((entry->expire_ > 0) && (entry->expire_ <= getCurrentTime())) {
+        cache_.erase(entry);
+        ++misses_;
+        return (ConstHostPtr());
+    }
+    cache_.relocate(cache_.begin(), entry);
+    ++hits_;
+    return (entry->host_);
+}
+
+void
+HostCache::removeById(bool v4, const SubnetID& subnet_id,
+                      const Host::IdentifierType& identifier_type,
+                      const uint8_t* identifier_begin,
+                      const size_t identifier_len) {
+    std::vector<uint8_t> identifier(identifier_begin,
+                                    identifier_begin + identifier_len);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& idx = cache_.get<1>();
+    auto range = idx.equal_range(boost::make_tuple(identifier,
+                                                   identifier_type));
+    for (auto it = range.first; it != range.second; ) {
+        const SubnetID& id = (v4 ? it->host_->getIPv4SubnetID() :
+                              it->host_->getIPv6SubnetID());
+        if (id == subnet_id) {
+            it = idx.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // end of namespace isc::host_cache
+} // end of namespace isc
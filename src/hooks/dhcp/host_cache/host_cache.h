@@ -0,0 +1,427 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef HOST_CACHE_H
+#define HOST_CACHE_H
+
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcpsrv/cache_host_data_source.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/subnet_id.h>
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/shared_ptr.hpp>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace host_cache {
+
+/// @brief Entry of the host cache.
+///
+/// Holds a cached host, which can be a negative answer, and the time
+/// when the entry expires.
+struct HostCacheEntry {
+
+    /// @brief Constructor.
+    ///
+    /// @param host The cached host.
+    /// @param expire Expiration time, 0 when the entry does not expire.
+    HostCacheEntry(const dhcp::ConstHostPtr& host, time_t expire)
+        : host_(host), expire_(expire) {
+    }
+
+    /// @brief Returns the identifier of the host.
+    const std::vector<uint8_t>& getIdentifier() const {
+        return (host_->getIdentifier());
+    }
+
+    /// @brief Returns the identifier type of the host.
+    dhcp::Host::IdentifierType getIdentifierType() const {
+        return (host_->getIdentifierType());
+    }
+
+    /// @brief Returns the reserved IPv4 address of the host.
+    const asiolink::IOAddress& getIPv4Reservation() const {
+        return (host_->getIPv4Reservation());
+    }
+
+    /// @brief Returns the IPv4 subnet identifier of the host.
+    dhcp::SubnetID getIPv4SubnetID() const {
+        return (host_->getIPv4SubnetID());
+    }
+
+    /// @brief The cached host.
+    dhcp::ConstHostPtr host_;
+
+    /// @brief Expiration time, 0 when the entry does not expire.
+    time_t expire_;
+};
+
+/// @brief Multi-index container holding the host cache entries.
+typedef boost::multi_index_container<
+    HostCacheEntry,
+    boost::multi_index::indexed_by<
+        // First index keeps the entries in the order of use: the most
+        // recently used entry is at the front, the least recently used
+        // entry, which is evicted first, is at the back.
+        boost::multi_index::sequenced<>,
+
+        // Second index is used to search for the entries using the
+        // identifier and its type.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::composite_key<
+                HostCacheEntry,
+                boost::multi_index::const_mem_fun<
+                    HostCacheEntry, const std::vector<uint8_t>&,
+                    &HostCacheEntry::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    HostCacheEntry, dhcp::Host::IdentifierType,
+                    &HostCacheEntry::getIdentifierType
+                >
+            >
+        >,
+
+        // Third index is used to search for the entries using the
+        // reserved IPv4 address and the IPv4 subnet identifier.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::composite_key<
+                HostCacheEntry,
+                boost::multi_index::const_mem_fun<
+                    HostCacheEntry, const asiolink::IOAddress&,
+                    &HostCacheEntry::getIPv4Reservation
+                >,
+                boost::multi_index::const_mem_fun<
+                    HostCacheEntry, dhcp::SubnetID,
+                    &HostCacheEntry::getIPv4SubnetID
+                >
+            >
+        >
+    >
+> HostCacheContainer;
+
+/// @brief In-memory cache of host reservations.
+///
+/// The cache is used by the host manager as the first alternate host
+/// data source: the hosts found in the other sources are inserted into
+/// the cache and the negative answers too when negative caching is
+/// enabled.
+///
+/// The cache serves the lookups of a host by identifier and by reserved
+/// IPv4 address, which are done for every packet. The other lookups,
+/// in particular the lookups returning collections of hosts, return
+/// nothing so the host manager gets their results from the host
+/// databases only.
+///
+/// The number of entries is bounded by @c maximum: the least recently
+/// used entries are evicted first. The entries expire @c ttl seconds
+/// after their insertion. All operations are protected by a mutex.
+class HostCache : public dhcp::CacheHostDataSource {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param maximum Maximum number of entries, 0 means unbound.
+    /// @param ttl Time to live of the entries in seconds, 0 means no
+    /// expiration.
+    HostCache(size_t maximum = 0, uint32_t ttl = 0);
+
+    /// @brief Destructor.
+    virtual ~HostCache() { }
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAll(const dhcp::Host::IdentifierType& identifier_type,
+           const uint8_t* identifier_begin,
+           const size_t identifier_len) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAll4(const dhcp::SubnetID& subnet_id) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAll6(const dhcp::SubnetID& subnet_id) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAllbyHostname(const std::string& hostname) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAllbyHostname4(const std::string& hostname,
+                      const dhcp::SubnetID& subnet_id) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAllbyHostname6(const std::string& hostname,
+                      const dhcp::SubnetID& subnet_id) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getPage4(const dhcp::SubnetID& subnet_id,
+             size_t& source_index,
+             uint64_t lower_host_id,
+             const dhcp::HostPageSize& page_size) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getPage6(const dhcp::SubnetID& subnet_id,
+             size_t& source_index,
+             uint64_t lower_host_id,
+             const dhcp::HostPageSize& page_size) const;
+
+    /// @brief Returns nothing: collections are fetched from the databases.
+    virtual dhcp::ConstHostCollection
+    getAll4(const asiolink::IOAddress& address) const;
+
+    /// @brief Returns a cached host connected to the IPv4 subnet.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of a buffer containing
+    /// an identifier.
+    /// @param identifier_len Identifier length.
+    ///
+    /// @return The cached host, possibly a negative answer, or null.
+    virtual dhcp::ConstHostPtr
+    get4(const dhcp::SubnetID& subnet_id,
+         const dhcp::Host::IdentifierType& identifier_type,
+         const uint8_t* identifier_begin,
+         const size_t identifier_len) const;
+
+    /// @brief Returns a cached host connected to the IPv4 subnet and
+    /// having a reservation for a specified IPv4 address.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param address reserved IPv4 address.
+    ///
+    /// @return The cached host or null.
+    virtual dhcp::ConstHostPtr
+    get4(const dhcp::SubnetID& subnet_id,
+         const asiolink::IOAddress& address) const;
+
+    /// @brief Returns a cached host connected to the IPv6 subnet.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of a buffer containing
+    /// an identifier.
+    /// @param identifier_len Identifier length.
+    ///
+    /// @return The cached host, possibly a negative answer, or null.
+    virtual dhcp::ConstHostPtr
+    get6(const dhcp::SubnetID& subnet_id,
+         const dhcp::Host::IdentifierType& identifier_type,
+         const uint8_t* identifier_begin,
+         const size_t identifier_len) const;
+
+    /// @brief Returns null: IPv6 reservations are fetched from the databases.
+    virtual dhcp::ConstHostPtr
+    get6(const asiolink::IOAddress& prefix, const uint8_t prefix_len) const;
+
+    /// @brief Returns null: IPv6 reservations are fetched from the databases.
+    virtual dhcp::ConstHostPtr
+    get6(const dhcp::SubnetID& subnet_id,
+         const asiolink::IOAddress& address) const;
+
+    /// @brief Does nothing.
+    ///
+    /// The host manager inserts the host into the cache once it was
+    /// added to the databases.
+    ///
+    /// @param host Pointer to the new @c Host object being added.
+    virtual void add(const dhcp::HostPtr& host);
+
+    /// @brief Removes the cached hosts connected to the IPv4 subnet and
+    /// having a reservation for a specified IPv4 address.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param addr IPv4 address.
+    ///
+    /// @return Always false so the host is deleted from the databases.
+    virtual bool del(const dhcp::SubnetID& subnet_id,
+                     const asiolink::IOAddress& addr);
+
+    /// @brief Removes the cached hosts connected to the IPv4 subnet.
+    ///
+    /// @param subnet_id IPv4 Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of a buffer containing
+    /// an identifier.
+    /// @param identifier_len Identifier length.
+    ///
+    /// @return Always false so the host is deleted from the databases.
+    virtual bool del4(const dhcp::SubnetID& subnet_id,
+                      const dhcp::Host::IdentifierType& identifier_type,
+                      const uint8_t* identifier_begin,
+                      const size_t identifier_len);
+
+    /// @brief Removes the cached hosts connected to the IPv6 subnet.
+    ///
+    /// @param subnet_id IPv6 Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of a buffer containing
+    /// an identifier.
+    /// @param identifier_len Identifier length.
+    ///
+    /// @return Always false so the host is deleted from the databases.
+    virtual bool del6(const dhcp::SubnetID& subnet_id,
+                      const dhcp::Host::IdentifierType& identifier_type,
+                      const uint8_t* identifier_begin,
+                      const size_t identifier_len);
+
+    /// @brief Return backend type.
+    ///
+    /// @return Always "cache".
+    virtual std::string getType() const {
+        return (std::string("cache"));
+    }
+
+    /// @brief Insert a host into the cache.
+    ///
+    /// A cached host conflicts with the inserted one when it has the same
+    /// identifier and IPv4 or IPv6 subnet, or the same reserved IPv4
+    /// address in the same IPv4 subnet.
+    ///
+    /// @param host Pointer to the new @c Host object being inserted.
+    /// @param overwrite false if doing nothing in case of conflicts
+    /// (and returning 1), true if removing conflicting entries
+    /// (and returning their number).
+    /// @return number of conflicts limited to one if overwrite is false.
+    virtual size_t insert(const dhcp::ConstHostPtr& host, bool overwrite);
+
+    /// @brief Remove a host from the cache.
+    ///
+    /// @param host Pointer to the cached @c Host object being removed.
+    /// @return true when found and removed.
+    virtual bool remove(const dhcp::HostPtr& host);
+
+    /// @brief Flush entries.
+    ///
+    /// The least recently used entries are removed first.
+    ///
+    /// @param count number of entries to remove, 0 means all.
+    virtual void flush(size_t count);
+
+    /// @brief Return the number of entries.
+    ///
+    /// @return the current number of entries, including the negative
+    /// answers and the expired entries not removed yet.
+    virtual size_t size() const;
+
+    /// @brief Return the maximum number of entries.
+    ///
+    /// @return the maximum number of entries, 0 means unbound.
+    virtual size_t capacity() const {
+        return (maximum_);
+    }
+
+    /// @brief Return the time to live of the entries.
+    ///
+    /// @return the time to live in seconds, 0 means no expiration.
+    uint32_t getTtl() const {
+        return (ttl_);
+    }
+
+    /// @brief Return the number of lookups served by the cache.
+    uint64_t getHits() const;
+
+    /// @brief Return the number of lookups not served by the cache.
+    uint64_t getMisses() const;
+
+    /// @brief Returns the size, capacity and hit/miss statistics.
+    ///
+    /// @return A map with the "size", "capacity", "hits" and "misses"
+    /// entries.
+    data::ElementPtr getStatistics() const;
+
+protected:
+
+    /// @brief Returns the current time.
+    ///
+    /// Used to compute the expiration of the entries, it can be
+    /// overridden by the tests.
+    virtual time_t getCurrentTime() const {
+        return (time(NULL));
+    }
+
+private:
+
+    /// @brief Returns a cached host using an identifier.
+    ///
+    /// @param v4 true for an IPv4 subnet, false for an IPv6 subnet.
+    /// @param subnet_id Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of a buffer containing
+    /// an identifier.
+    /// @param identifier_len Identifier length.
+    ///
+    /// @return The cached host or null.
+    dhcp::ConstHostPtr get(bool v4, const dhcp::SubnetID& subnet_id,
+                           const dhcp::Host::IdentifierType& identifier_type,
+                           const uint8_t* identifier_begin,
+                           const size_t identifier_len) const;
+
+    /// @brief Uses a found entry.
+    ///
+    /// Removes the entry when it expired, otherwise moves it to the
+    /// front of the least recently used order. Updates the statistics.
+    /// Must be called with the mutex locked.
+    ///
+    /// @param entry The found entry.
+    ///
+    /// @return The host of the entry or null when it expired.
+    dhcp::ConstHostPtr use(HostCacheContainer::iterator entry) const;
+
+    /// @brief Removes the cached hosts using an identifier.
+    ///
+    /// @param v4 true for an IPv4 subnet, false for an IPv6 subnet.
+    /// @param subnet_id Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of a buffer containing
+    /// an identifier.
+    /// @param identifier_len Identifier length.
+    void removeById(bool v4, const dhcp::SubnetID& subnet_id,
+                    const dhcp::Host::IdentifierType& identifier_type,
+                    const uint8_t* identifier_begin,
+                    const size_t identifier_len);
+
+    /// @brief Maximum number of entries, 0 means unbound.
+    size_t maximum_;
+
+    /// @brief Time to live of the entries, 0 means no expiration.
+    uint32_t ttl_;
+
+    /// @brief The entries.
+    ///
+    /// Lookups change the order of use so the container is mutable.
+    mutable HostCacheContainer cache_;
+
+    /// @brief Number of lookups served by the cache.
+    mutable uint64_t hits_;
+
+    /// @brief Number of lookups not served by the cache.
+    mutable uint64_t misses_;
+
+    /// @brief Mutex protecting the entries and the statistics.
+    mutable std::mutex mutex_;
+};
+
+/// @brief Pointer to the host cache.
+typedef boost::shared_ptr<HostCache> HostCachePtr;
+
+} // end of namespace isc::host_cache
+} // end of namespace isc
+
+#endif // HOST_CACHE_H
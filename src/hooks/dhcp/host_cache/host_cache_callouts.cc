@@ -0,0 +1,202 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <host_cache.h>
+#include <host_cache_log.h>
+#include <cc/command_interpreter.h>
+#include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/host_mgr.h>
+#include <hooks/hooks.h>
+#include <limits>
+
+namespace isc {
+namespace host_cache {
+
+/// @brief The host cache.
+HostCachePtr cache;
+
+/// @brief Whether negative answers are cached.
+bool negative_caching = false;
+
+/// @brief Host data source factory of the host cache.
+///
+/// Called by the host manager when the server is (re)configured:
+/// the cache is flushed as the reservations may have changed.
+///
+/// @return The host cache.
+dhcp::HostDataSourcePtr
+factory(const db::DatabaseConnection::ParameterMap&) {
+    if (!cache) {
+        isc_throw(Unexpected, "host cache is not initialized");
+    }
+    cache->flush(0);
+    dhcp::HostMgr::instance().setNegativeCaching(negative_caching);
+    return (cache);
+}
+
+/// @brief Returns the value of a non-negative integer parameter.
+///
+/// @param param The parameter or null.
+/// @param name The name of the parameter.
+/// @return The value, 0 when the parameter is not specified.
+/// @throw BadValue when the parameter is not a non-negative integer.
+int64_t
+getUnsigned(data::ConstElementPtr param, const std::string& name) {
+    if (!param) {
+        return (0);
+    }
+    if (param->getType() != data::Element::integer) {
+        isc_throw(BadValue, "'" << name << "' must be an integer");
+    }
+    int64_t value = param->intValue();
+    if (value < 0) {
+        isc_throw(BadValue, "'" << name << "' must not be negative");
+    }
+    return (value);
+}
+
+} // end of namespace host_cache
+} // end of namespace isc
+
+using namespace isc;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::hooks;
+using namespace isc::host_cache;
+
+// Functions accessed by the hooks framework use C linkage to avoid the name
+// mangling that accompanies use of the C++ compiler as well as to avoid
+// issues related to namespaces.
+extern "C" {
+
+/// @brief This is a command callout for 'cache-flush' command.
+///
+/// Removes the given number of least recently used entries.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int cache_flush(CalloutHandle& handle) {
+    ConstElementPtr response;
+    try {
+        ConstElementPtr command;
+        ConstElementPtr args;
+        handle.getArgument("command", command);
+        static_cast<void>(parseCommand(args, command));
+        if (!args || (args->getType() != Element::integer)) {
+            isc_throw(BadValue, "invalid (not integer) parameter");
+        }
+        int64_t count = args->intValue();
+        if (count <= 0) {
+            isc_throw(BadValue, "invalid (not strictly positive) parameter");
+        }
+        cache->flush(static_cast<size_t>(count));
+        LOG_INFO(host_cache_logger, HOST_CACHE_FLUSHED).arg(count);
+        response = createAnswer(CONTROL_RESULT_SUCCESS,
+                                "Cache flushed (" +
+                                std::to_string(count) + " entries).");
+    } catch (const std::exception& ex) {
+        response = createAnswer(CONTROL_RESULT_ERROR, ex.what());
+        handle.setArgument("response", response);
+        return (1);
+    }
+    handle.setArgument("response", response);
+    return (0);
+}
+
+/// @brief This is a command callout for 'cache-clear' command.
+///
+/// Removes all the entries.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return always 0.
+int cache_clear(CalloutHandle& handle) {
+    cache->flush(0);
+    LOG_INFO(host_cache_logger, HOST_CACHE_CLEARED);
+    ConstElementPtr response = createAnswer(CONTROL_RESULT_SUCCESS,
+                                            "Cache cleared.");
+    handle.setArgument("response", response);
+    return (0);
+}
+
+/// @brief This is a command callout for 'cache-size' command.
+///
+/// Returns the number of entries, the maximum number of entries and
+/// the hit and miss counters.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return always 0.
+int cache_size(CalloutHandle& handle) {
+    ElementPtr stats = cache->getStatistics();
+    std::string text = "Cache size: " +
+        std::to_string(stats->get("size")->intValue()) + " entries.";
+    ConstElementPtr response = createAnswer(CONTROL_RESULT_SUCCESS, text,
+                                            stats);
+    handle.setArgument("response", response);
+    return (0);
+}
+
+/// @brief This function is called when the library is loaded.
+///
+/// @param handle library handle
+/// @return 0 when initialization is successful, 1 otherwise
+int load(LibraryHandle& handle) {
+    try {
+        int64_t maximum = getUnsigned(handle.getParameter("maximum"),
+                                      "maximum");
+        int64_t ttl = getUnsigned(handle.getParameter("ttl"), "ttl");
+        if (ttl > std::numeric_limits<uint32_t>::max()) {
+            isc_throw(BadValue, "'ttl' is too large");
+        }
+        ConstElementPtr negative = handle.getParameter("negative-caching");
+        negative_caching = false;
+        if (negative) {
+            if (negative->getType() != Element::boolean) {
+                isc_throw(BadValue, "'negative-caching' must be a boolean");
+            }
+            negative_caching = negative->boolValue();
+        }
+
+        cache.reset(new HostCache(static_cast<size_t>(maximum),
+                                  static_cast<uint32_t>(ttl)));
+        HostDataSourceFactory::registerFactory("cache", factory);
+
+        handle.registerCommandCallout("cache-flush", cache_flush);
+        handle.registerCommandCallout("cache-clear", cache_clear);
+        handle.registerCommandCallout("cache-size", cache_size);
+
+        LOG_INFO(host_cache_logger, HOST_CACHE_CONFIGURED)
+            .arg(maximum)
+            .arg(ttl)
+            .arg(negative_caching ? "enabled" : "disabled");
+    } catch (const std::exception& ex) {
+        LOG_ERROR(host_cache_logger, HOST_CACHE_LOAD_ERROR)
+            .arg(ex.what());
+        return (1);
+    }
+
+    return (0);
+}
+
+/// @brief This function is called when the library is unloaded.
+///
+/// @return always 0.
+int unload() {
+    HostDataSourceFactory::deregisterFactory("cache");
+    HostMgr::instance().setNegativeCaching(false);
+    HostMgr::delBackend("cache");
+    cache.reset();
+    LOG_INFO(host_cache_logger, HOST_CACHE_UNLOAD);
+    return (0);
+}
+
+} // end extern "C"
@@ -0,0 +1,27 @@
+// File created from ../../../../src/hooks/dhcp/host_cache/host_cache_messages.mes on Sun Oct 18 2026 11:56
+
+#include <cstddef>
+#include <log/message_types.h>
+#include <log/message_initializer.h>
+
+extern const isc::log::MessageID HOST_CACHE_CLEARED = "HOST_CACHE_CLEARED";
+extern const isc::log::MessageID HOST_CACHE_CONFIGURED = "HOST_CACHE_CONFIGURED";
+extern const isc::log::MessageID HOST_CACHE_FLUSHED = "HOST_CACHE_FLUSHED";
+extern const isc::log::MessageID HOST_CACHE_LOAD_ERROR = "HOST_CACHE_LOAD_ERROR";
+extern const isc::log::MessageID HOST_CACHE_UNLOAD = "HOST_CACHE_UNLOAD";
+
+namespace {
+
+const char* values[] = {
+    "HOST_CACHE_CLEARED", "the host cache has been cleared",
+    "HOST_CACHE_CONFIGURED", "Host Cache hooks library loaded: maximum %1, ttl %2, negative caching %3",
+    "HOST_CACHE_FLUSHED", "%1 entries have been flushed from the host cache",
+    "HOST_CACHE_LOAD_ERROR", "loading Host Cache hooks library failed: %1",
+    "HOST_CACHE_UNLOAD", "Host Cache hooks library has been unloaded",
+    NULL
+};
+
+const isc::log::MessageInitializer initializer(values);
+
+} // Anonymous namespace
+
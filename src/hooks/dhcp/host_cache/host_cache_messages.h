@@ -0,0 +1,14 @@
+// File created from ../../../../src/hooks/dhcp/host_cache/host_cache_messages.mes on Sun Oct 18 2026 11:56
+
+#ifndef HOST_CACHE_MESSAGES_H
+#define HOST_CACHE_MESSAGES_H
+
+#include <log/message_types.h>
+
+extern const isc::log::MessageID HOST_CACHE_CLEARED;
+extern const isc::log::MessageID HOST_CACHE_CONFIGURED;
+extern const isc::log::MessageID HOST_CACHE_FLUSHED;
+extern const isc::log::MessageID HOST_CACHE_LOAD_ERROR;
+extern const isc::log::MessageID HOST_CACHE_UNLOAD;
+
+#endif // HOST_CACHE_MESSAGES_H
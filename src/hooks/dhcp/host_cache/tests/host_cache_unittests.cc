@@ -0,0 +1,243 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file This file contains tests which exercise the HostCache class.
+
+#include <config.h>
+#include <host_cache.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/host.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::host_cache;
+
+namespace {
+
+/// @brief Host cache with a settable clock.
+class TestHostCache : public HostCache {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param maximum Maximum number of entries, 0 means unbound.
+    /// @param ttl Time to live of the entries in seconds.
+    TestHostCache(size_t maximum = 0, uint32_t ttl = 0)
+        : HostCache(maximum, ttl), now_(1000) {
+    }
+
+    /// @brief The current time.
+    time_t now_;
+
+protected:
+
+    /// @brief Returns the settable current time.
+    virtual time_t getCurrentTime() const {
+        return (now_);
+    }
+};
+
+/// @brief Test fixture for testing the host cache.
+class HostCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Creates a host with a reservation for an IPv4 address.
+    ///
+    /// @param hwaddr Hardware address of the host.
+    /// @param subnet_id IPv4 subnet identifier.
+    /// @param address Reserved address.
+    /// @return The new host.
+    HostPtr createHost4(const std::string& hwaddr, SubnetID subnet_id,
+                        const std::string& address) const {
+        return (HostPtr(new Host(hwaddr, "hw-address", subnet_id,
+                                 SUBNET_ID_UNUSED, IOAddress(address))));
+    }
+
+    /// @brief Creates a host in an IPv6 subnet.
+    ///
+    /// @param duid DUID of the host.
+    /// @param subnet_id IPv6 subnet identifier.
+    /// @return The new host.
+    HostPtr createHost6(const std::string& duid, SubnetID subnet_id) const {
+        return (HostPtr(new Host(duid, "duid", SUBNET_ID_UNUSED, subnet_id,
+                                 IOAddress::IPV4_ZERO_ADDRESS())));
+    }
+
+    /// @brief Looks up an IPv4 host by hardware address.
+    ///
+    /// @param cache The host cache.
+    /// @param host A host with the searched identifier.
+    /// @param subnet_id IPv4 subnet identifier.
+    /// @return The cached host or null.
+    ConstHostPtr get4(const HostCache& cache, const HostPtr& host,
+                      SubnetID subnet_id) const {
+        const std::vector<uint8_t>& id = host->getIdentifier();
+        return (cache.get4(subnet_id, host->getIdentifierType(),
+                           &id[0], id.size()));
+    }
+};
+
+// Verifies that hosts are inserted and found by identifier and address.
+TEST_F(HostCacheTest, insertGet) {
+    HostCache cache;
+    EXPECT_EQ("cache", cache.getType());
+    HostPtr host = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    EXPECT_EQ(0, cache.insert(host, false));
+    EXPECT_EQ(1, cache.size());
+
+    EXPECT_EQ(host, get4(cache, host, 1));
+    EXPECT_FALSE(get4(cache, host, 2));
+    EXPECT_EQ(host, cache.get4(1, IOAddress("192.0.2.1")));
+    EXPECT_FALSE(cache.get4(1, IOAddress("192.0.2.2")));
+
+    HostPtr host6 = createHost6("01:02:03:04", 1);
+    EXPECT_EQ(0, cache.insert(host6, false));
+    const std::vector<uint8_t>& id = host6->getIdentifier();
+    EXPECT_EQ(host6, cache.get6(1, Host::IDENT_DUID, &id[0], id.size()));
+    EXPECT_FALSE(cache.get4(1, Host::IDENT_DUID, &id[0], id.size()));
+
+    // Collections are not served by the cache.
+    EXPECT_TRUE(cache.getAll4(1).empty());
+    EXPECT_TRUE(cache.getAll4(IOAddress("192.0.2.1")).empty());
+}
+
+// Verifies that conflicting entries are replaced only on overwrite.
+TEST_F(HostCacheTest, conflicts) {
+    HostCache cache;
+    HostPtr host1 = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    HostPtr host2 = createHost4("01:02:03:04:05:07", 1, "192.0.2.2");
+    ASSERT_EQ(0, cache.insert(host1, false));
+    ASSERT_EQ(0, cache.insert(host2, false));
+
+    // Same identifier as host1 and same address as host2.
+    HostPtr host3 = createHost4("01:02:03:04:05:06", 1, "192.0.2.2");
+    EXPECT_EQ(1, cache.insert(host3, false));
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(host1, get4(cache, host1, 1));
+
+    EXPECT_EQ(2, cache.insert(host3, true));
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(host3, get4(cache, host1, 1));
+    EXPECT_EQ(host3, cache.get4(1, IOAddress("192.0.2.2")));
+    EXPECT_FALSE(cache.get4(1, IOAddress("192.0.2.1")));
+}
+
+// Verifies that the least recently used entries are evicted.
+TEST_F(HostCacheTest, maximum) {
+    HostCache cache(2);
+    EXPECT_EQ(2, cache.capacity());
+    HostPtr host1 = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    HostPtr host2 = createHost4("01:02:03:04:05:07", 1, "192.0.2.2");
+    HostPtr host3 = createHost4("01:02:03:04:05:08", 1, "192.0.2.3");
+    ASSERT_EQ(0, cache.insert(host1, false));
+    ASSERT_EQ(0, cache.insert(host2, false));
+
+    // Using host1 makes host2 the least recently used entry.
+    ASSERT_TRUE(get4(cache, host1, 1));
+    ASSERT_EQ(0, cache.insert(host3, false));
+    EXPECT_EQ(2, cache.size());
+    EXPECT_TRUE(get4(cache, host1, 1));
+    EXPECT_FALSE(get4(cache, host2, 1));
+    EXPECT_TRUE(get4(cache, host3, 1));
+}
+
+// Verifies that the entries expire.
+TEST_F(HostCacheTest, ttl) {
+    TestHostCache cache(0, 60);
+    EXPECT_EQ(60, cache.getTtl());
+    HostPtr host = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    ASSERT_EQ(0, cache.insert(host, false));
+
+    cache.now_ += 59;
+    EXPECT_TRUE(get4(cache, host, 1));
+    cache.now_ += 1;
+    EXPECT_FALSE(get4(cache, host, 1));
+    EXPECT_EQ(0, cache.size());
+}
+
+// Verifies that negative answers are returned and counted as hits.
+TEST_F(HostCacheTest, negative) {
+    HostCache cache;
+    HostPtr host = createHost4("01:02:03:04:05:06", 1, "0.0.0.0");
+    host->setNegative(true);
+    ASSERT_EQ(0, cache.insert(host, false));
+
+    ConstHostPtr got = get4(cache, host, 1);
+    ASSERT_TRUE(got);
+    EXPECT_TRUE(got->getNegative());
+    EXPECT_FALSE(cache.get4(1, IOAddress("0.0.0.0")));
+
+    // A real host replaces the negative answer.
+    HostPtr real = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    EXPECT_EQ(1, cache.insert(real, true));
+    EXPECT_EQ(real, get4(cache, host, 1));
+}
+
+// Verifies the hit and miss statistics.
+TEST_F(HostCacheTest, statistics) {
+    HostCache cache(10);
+    HostPtr host = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    ASSERT_EQ(0, cache.insert(host, false));
+    EXPECT_TRUE(get4(cache, host, 1));
+    EXPECT_TRUE(cache.get4(1, IOAddress("192.0.2.1")));
+    EXPECT_FALSE(get4(cache, host, 2));
+    EXPECT_EQ(2, cache.getHits());
+    EXPECT_EQ(1, cache.getMisses());
+
+    ConstElementPtr stats = cache.getStatistics();
+    ASSERT_TRUE(stats);
+    std::string expected = "{ \"capacity\": 10, \"hits\": 2, "
+        "\"misses\": 1, \"size\": 1 }";
+    EXPECT_EQ(expected, stats->str());
+}
+
+// Verifies that the least recently used entries are flushed first.
+TEST_F(HostCacheTest, flush) {
+    HostCache cache;
+    HostPtr host1 = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    HostPtr host2 = createHost4("01:02:03:04:05:07", 1, "192.0.2.2");
+    HostPtr host3 = createHost4("01:02:03:04:05:08", 1, "192.0.2.3");
+    ASSERT_EQ(0, cache.insert(host1, false));
+    ASSERT_EQ(0, cache.insert(host2, false));
+    ASSERT_EQ(0, cache.insert(host3, false));
+
+    cache.flush(1);
+    EXPECT_EQ(2, cache.size());
+    EXPECT_FALSE(get4(cache, host1, 1));
+
+    cache.flush(0);
+    EXPECT_EQ(0, cache.size());
+}
+
+// Verifies that entries are removed and deletions reach the databases.
+TEST_F(HostCacheTest, removeDel) {
+    HostCache cache;
+    HostPtr host1 = createHost4("01:02:03:04:05:06", 1, "192.0.2.1");
+    HostPtr host2 = createHost4("01:02:03:04:05:07", 1, "192.0.2.2");
+    HostPtr host3 = createHost4("01:02:03:04:05:08", 1, "192.0.2.3");
+    ASSERT_EQ(0, cache.insert(host1, false));
+    ASSERT_EQ(0, cache.insert(host2, false));
+    ASSERT_EQ(0, cache.insert(host3, false));
+
+    EXPECT_TRUE(cache.remove(host1));
+    EXPECT_FALSE(cache.remove(host1));
+    EXPECT_EQ(2, cache.size());
+
+    // Deletions return false so the host manager continues with
+    // the host databases.
+    EXPECT_FALSE(cache.del(1, IOAddress("192.0.2.2")));
+    EXPECT_EQ(1, cache.size());
+    const std::vector<uint8_t>& id = host3->getIdentifier();
+    EXPECT_FALSE(cache.del4(1, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(0, cache.size());
+}
+
+} // end of anonymous namespace
@@ -223,6 +223,10 @@ CqlConnection::openDatabase() {
     cluster_ = cass_cluster_new();
     cass_cluster_set_contact_points(cluster_, contact_points);
 
+    // Send each statement to a replica owning the partition it addresses
+    // rather than to a coordinator which would have to forward it.
+    cass_cluster_set_token_aware_routing(cluster_, cass_true);
+
     if (user && password) {
         cass_cluster_set_credentials(cluster_, user, password);
     }
@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2020 Internet Systems Consortium, Inc. ("ISC")
 // Copyright (C) 2016-2017 Deutsche Telekom AG.
 //
 // Authors: Razvan Becheriu <razvan.becheriu@qualitance.com>
@@ -30,9 +30,13 @@
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -732,6 +736,194 @@ CqlCommon::getData(const CassRow* row, AnyArray& data) {
     }
 }
 
+namespace {
+
+/// @brief A bound SELECT statement and the future of its current page.
+///
+/// Frees both Cassandra objects on destruction so nothing leaks when
+/// the execution of a set of concurrent statements is aborted.
+struct CqlPendingSelect {
+    /// @brief Constructor
+    CqlPendingSelect() : statement_(NULL), future_(NULL) {
+    }
+
+    /// @brief Destructor
+    ~CqlPendingSelect() {
+        if (future_) {
+            cass_future_free(future_);
+        }
+        if (statement_) {
+            cass_statement_free(statement_);
+        }
+    }
+
+    /// @brief Bound statement, reused to request the following pages
+    CassStatement* statement_;
+
+    /// @brief Future of the page being fetched
+    CassFuture* future_;
+};
+
+/// @brief Pointer to a pending SELECT statement
+typedef std::shared_ptr<CqlPendingSelect> CqlPendingSelectPtr;
+
+/// @brief Binds a prepared SELECT statement and sends it.
+///
+/// @param connection connection used to communicate with the Cassandra
+///     database
+/// @param tagged_statement prepared statement being executed
+/// @param data array of bound objects used to filter the results
+///
+/// @return the pending statement
+///
+/// @throw DbOperationError
+CqlPendingSelectPtr
+sendSelect(const CqlConnection& connection,
+           const CqlTaggedStatement& tagged_statement,
+           const AnyArray& data) {
+    CqlPendingSelectPtr select(new CqlPendingSelect());
+    select->statement_ = cass_prepared_bind(tagged_statement.prepared_statement_);
+    if (!select->statement_) {
+        isc_throw(DbOperationError,
+                  "CqlCommon::executeSelectConcurrently(): unable to bind "
+                  "statement " << tagged_statement.name_);
+    }
+
+    // Set specific level of consistency if we're told to do so.
+    if (connection.force_consistency_) {
+        CassError rc = cass_statement_set_consistency(select->statement_,
+                                                      connection.consistency_);
+        if (rc != CASS_OK) {
+            isc_throw(DbOperationError,
+                      "CqlCommon::executeSelectConcurrently(): unable to set "
+                      "statement consistency for statement "
+                          << tagged_statement.name_
+                          << ", Cassandra error code: " << cass_error_desc(rc));
+        }
+        if (connection.serial_consistency_ != CASS_CONSISTENCY_UNKNOWN) {
+            rc = cass_statement_set_serial_consistency(select->statement_,
+                                                       connection.serial_consistency_);
+            if (rc != CASS_OK) {
+                isc_throw(DbOperationError,
+                          "CqlCommon::executeSelectConcurrently(): unable to "
+                          "set statement serial consistency for statement "
+                              << tagged_statement.name_
+                              << ", Cassandra error code: "
+                              << cass_error_desc(rc));
+            }
+        }
+    }
+
+    CqlCommon::bindData(data, select->statement_);
+
+    select->future_ = cass_session_execute(connection.session_,
+                                           select->statement_);
+    if (!select->future_) {
+        isc_throw(DbOperationError,
+                  "CqlCommon::executeSelectConcurrently(): no CassFuture for "
+                  "statement " << tagged_statement.name_);
+    }
+    return (select);
+}
+
+}  // namespace
+
+void
+CqlCommon::executeSelectConcurrently(const CqlConnection& connection,
+                                     const std::vector<AnyArray>& where_values,
+                                     StatementTag statement_tag,
+                                     const CqlRowHandler& handler,
+                                     const size_t max_in_flight /* = 16 */) {
+    // Find the query statement first.
+    StatementMap::const_iterator it = connection.statements_.find(statement_tag);
+    if (it == connection.statements_.end()) {
+        isc_throw(DbOperationError,
+                  "CqlCommon::executeSelectConcurrently(): Statement "
+                      << statement_tag << " has not been prepared.");
+    }
+    const CqlTaggedStatement& tagged_statement = it->second;
+    if (tagged_statement.is_raw_) {
+        isc_throw(DbOperationError,
+                  "CqlCommon::executeSelectConcurrently(): raw statement "
+                      << tagged_statement.name_ << " is not supported");
+    }
+
+    // Send the first statements without waiting for any result.
+    const size_t window = std::max(max_in_flight, static_cast<size_t>(1));
+    std::deque<CqlPendingSelectPtr> pending;
+    size_t next = 0;
+    while ((next < where_values.size()) && (pending.size() < window)) {
+        pending.push_back(sendSelect(connection, tagged_statement,
+                                     where_values[next++]));
+    }
+
+    while (!pending.empty()) {
+        CqlPendingSelectPtr select = pending.front();
+
+        // Wait for the statement execution to complete.
+        cass_future_wait(select->future_);
+        if (cass_future_error_code(select->future_) != CASS_OK) {
+            isc_throw(DbOperationError, CqlConnection::checkFutureError(
+                "CqlCommon::executeSelectConcurrently(): "
+                "cass_session_execute() != CASS_OK",
+                select->future_, statement_tag));
+        }
+        std::unique_ptr<const CassResult, void (*)(const CassResult*)>
+            result(cass_future_get_result(select->future_), cass_result_free);
+        cass_future_free(select->future_);
+        select->future_ = NULL;
+
+        // Request the following page of this statement or send the next
+        // statement before handling the rows so the cluster keeps working.
+        if (cass_result_has_more_pages(result.get())) {
+            cass_statement_set_paging_state(select->statement_, result.get());
+            select->future_ = cass_session_execute(connection.session_,
+                                                   select->statement_);
+            if (!select->future_) {
+                isc_throw(DbOperationError,
+                          "CqlCommon::executeSelectConcurrently(): no "
+                          "CassFuture for statement " << tagged_statement.name_);
+            }
+        } else {
+            pending.pop_front();
+            if (next < where_values.size()) {
+                pending.push_back(sendSelect(connection, tagged_statement,
+                                             where_values[next++]));
+            }
+        }
+
+        std::unique_ptr<CassIterator, void (*)(CassIterator*)>
+            rows(cass_iterator_from_result(result.get()), cass_iterator_free);
+        while (cass_iterator_next(rows.get())) {
+            handler(cass_iterator_get_row(rows.get()));
+        }
+    }
+}
+
+std::vector<CqlTokenRange>
+CqlCommon::splitTokenRing(const size_t count) {
+    if (count == 0) {
+        isc_throw(BadValue, "CqlCommon::splitTokenRing(): "
+                  "the number of token ranges must not be 0");
+    }
+
+    // Work with offsets from the minimum token to avoid signed overflows.
+    const uint64_t min_token =
+        static_cast<uint64_t>(std::numeric_limits<cass_int64_t>::min());
+    const uint64_t width = std::numeric_limits<uint64_t>::max() / count;
+    std::vector<CqlTokenRange> ranges;
+    ranges.reserve(count);
+    uint64_t first = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t last = (i + 1 < count ? first + width - 1 :
+                         std::numeric_limits<uint64_t>::max());
+        ranges.push_back(CqlTokenRange(static_cast<cass_int64_t>(min_token + first),
+                                       static_cast<cass_int64_t>(min_token + last)));
+        first = last + 1;
+    }
+    return (ranges);
+}
+
 CqlExchange::CqlExchange() {
 }
 
@@ -869,6 +1061,21 @@ CqlExchange::executeSelect(const CqlConnection& connection, const AnyArray& data
     return collection;
 }
 
+AnyArray
+CqlExchange::executeSelectConcurrently(const CqlConnection& connection,
+                                       const std::vector<AnyArray>& where_values,
+                                       StatementTag statement_tag) {
+    AnyArray return_values;
+    AnyArray collection;
+    CqlCommon::executeSelectConcurrently(connection, where_values, statement_tag,
+                                         [&](const CassRow* row) {
+        createBindForSelect(return_values, statement_tag);
+        CqlCommon::getData(row, return_values);
+        collection.add(retrieve());
+    });
+    return (collection);
+}
+
 void
 CqlExchange::executeMutation(const CqlConnection& connection, const AnyArray& data,
                              StatementTag statement_tag) {
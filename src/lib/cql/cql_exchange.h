@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2020 Internet Systems Consortium, Inc. ("ISC")
 // Copyright (C) 2016-2017 Deutsche Telekom AG.
 //
 // Authors: Razvan Becheriu <razvan.becheriu@qualitance.com>
@@ -24,6 +24,7 @@
 
 #include <boost/any.hpp>  // for boost::any
 
+#include <functional>
 #include <string>
 #include <typeinfo>       // for std::type_info
 #include <unordered_map>  // for std::unordered_map
@@ -134,6 +135,12 @@ struct CqlFunction {
     CqlGetFunction cqlGetFunction_;
 };
 
+/// @brief Inclusive range of partition key tokens.
+typedef std::pair<cass_int64_t, cass_int64_t> CqlTokenRange;
+
+/// @brief Function called for each row returned by a SELECT statement.
+typedef std::function<void(const CassRow*)> CqlRowHandler;
+
 /// @brief Cassandra Exchange
 ///
 /// Used to convert between Cassandra CQL and C++ data types. A different
@@ -197,6 +204,24 @@ public:
                            StatementTag statement_tag,
                            const bool& single = false);
 
+    /// @brief Executes a SELECT statement for several sets of values at once.
+    ///
+    /// See @ref CqlCommon::executeSelectConcurrently for details.
+    ///
+    /// @param connection connection used to communicate with the Cassandra
+    ///     database
+    /// @param where_values arrays of bound objects used to filter the
+    ///     results, one per execution of the statement
+    /// @param statement_tag prepared statement being executed
+    ///
+    /// @return collection of boost::any objects, in the order of the
+    ///     @c where_values arrays
+    ///
+    /// @throw DbOperationError
+    AnyArray executeSelectConcurrently(const CqlConnection& connection,
+                                       const std::vector<AnyArray>& where_values,
+                                       StatementTag statement_tag);
+
     /// @brief Executes INSERT, UPDATE or DELETE statements.
     ///
     /// @param connection connection used to communicate with the Cassandra
@@ -309,6 +334,47 @@ public:
     ///     Cassandra
     /// @param data array containing objects to be populated with results
     static void getData(const CassRow* row, AnyArray& data);
+
+    /// @brief Executes a SELECT statement for several sets of values at once.
+    ///
+    /// Binds the prepared statement once per element of @c where_values and
+    /// sends up to @c max_in_flight of them before waiting for the first
+    /// result, so independent queries are served by the cluster in parallel
+    /// instead of one after the other. The following page of a result is
+    /// requested before the rows of the current one are handled, so large
+    /// results are fetched completely and without stalls.
+    ///
+    /// @param connection connection used to communicate with the Cassandra
+    ///     database
+    /// @param where_values arrays of bound objects used to filter the
+    ///     results, one per execution of the statement
+    /// @param statement_tag prepared statement being executed; raw statements
+    ///     are not supported
+    /// @param handler function called for every returned row, in the order
+    ///     of the @c where_values arrays
+    /// @param max_in_flight maximum number of statements executed at the
+    ///     same time
+    ///
+    /// @throw DbOperationError
+    static void executeSelectConcurrently(const CqlConnection& connection,
+                                          const std::vector<AnyArray>& where_values,
+                                          StatementTag statement_tag,
+                                          const CqlRowHandler& handler,
+                                          const size_t max_in_flight = 16);
+
+    /// @brief Splits the token ring into contiguous ranges.
+    ///
+    /// The ranges cover the whole Murmur3 partitioner ring, from the minimum
+    /// to the maximum 64 bit signed token, with equal widths except for the
+    /// last one which takes the remainder. Used to scan a table with several
+    /// queries of the form "WHERE TOKEN(key) >= ? AND TOKEN(key) <= ?".
+    ///
+    /// @param count number of ranges, at least 1
+    ///
+    /// @return vector of @c count token ranges in ascending order
+    ///
+    /// @throw BadValue if @c count is 0
+    static std::vector<CqlTokenRange> splitTokenRing(const size_t count);
 };
 
 /// @brief Determine exchange type based on boost::any type.
@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2020 Internet Systems Consortium, Inc. ("ISC")
 // Copyright (C) 2017 Deutsche Telekom AG.
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
@@ -11,6 +11,8 @@
 #include <cql/cql_exchange.h>
 
 #include <cstring>
+#include <limits>
+#include <vector>
 
 #include <boost/any.hpp>
 
@@ -24,6 +26,8 @@ using isc::db::StatementTag;
 using isc::db::StatementTagHash;
 using isc::db::exchangeType;
 using isc::db::CqlConnection;
+using isc::db::CqlCommon;
+using isc::db::CqlTokenRange;
 
 class CqlConnectionTest {
 public:
@@ -74,5 +78,36 @@ TEST(CqlConnection, parseConsistency) {
     ASSERT_EQ(CqlConnection::parseConsistency(consistency), CASS_CONSISTENCY_UNKNOWN);
 }
 
+/// @brief Check that the token ring is split into contiguous ranges.
+TEST(CqlCommon, splitTokenRing) {
+    const cass_int64_t min = std::numeric_limits<cass_int64_t>::min();
+    const cass_int64_t max = std::numeric_limits<cass_int64_t>::max();
+
+    ASSERT_THROW(CqlCommon::splitTokenRing(0), isc::BadValue);
+
+    std::vector<CqlTokenRange> ranges = CqlCommon::splitTokenRing(1);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(min, ranges[0].first);
+    EXPECT_EQ(max, ranges[0].second);
+
+    ranges = CqlCommon::splitTokenRing(2);
+    ASSERT_EQ(2u, ranges.size());
+    EXPECT_EQ(min, ranges[0].first);
+    EXPECT_EQ(-2, ranges[0].second);
+    EXPECT_EQ(-1, ranges[1].first);
+    EXPECT_EQ(max, ranges[1].second);
+
+    ranges = CqlCommon::splitTokenRing(7);
+    ASSERT_EQ(7u, ranges.size());
+    EXPECT_EQ(min, ranges.front().first);
+    EXPECT_EQ(max, ranges.back().second);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        EXPECT_LE(ranges[i].first, ranges[i].second);
+        if (i > 0) {
+            EXPECT_EQ(ranges[i - 1].second + 1, ranges[i].first);
+        }
+    }
+}
+
 }  // namespace
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -145,6 +145,13 @@ DatabaseConnection::makeReconnectCtl() const {
 
 bool
 DatabaseConnection::invokeDbLostCallback() const {
+    if (read_replica_) {
+        // The backend stops using the read replica, the server keeps
+        // using the primary database.
+        read_replica_lost_ = true;
+        return (true);
+    }
+
     if (DatabaseConnection::db_lost_callback) {
         // Invoke the callback, passing in a new instance of ReconnectCtl
         return (DatabaseConnection::db_lost_callback)(makeReconnectCtl());
@@ -168,7 +175,8 @@ DatabaseConnection::toElement(const ParameterMap& params) {
             (keyword == "request-timeout") ||
             (keyword == "tcp-keepalive") ||
             (keyword == "port") ||
-            (keyword == "max-row-errors")) {
+            (keyword == "max-row-errors") ||
+            (keyword == "write-back-latency")) {
             // integer parameters
             int64_t int_value;
             try {
@@ -180,7 +188,9 @@ DatabaseConnection::toElement(const ParameterMap& params) {
             }
         } else if ((keyword == "persist") ||
                    (keyword == "tcp-nodelay") ||
-                   (keyword == "readonly")) {
+                   (keyword == "readonly") ||
+                   (keyword == "allocate-or-renew") ||
+                   (keyword == "write-behind-cache")) {
             if (value == "true") {
                 result->set(keyword, isc::data::Element::create(true));
             } else if (value == "false") {
@@ -197,7 +207,9 @@ DatabaseConnection::toElement(const ParameterMap& params) {
                    (keyword == "contact-points") ||
                    (keyword == "consistency") ||
                    (keyword == "serial-consistency") ||
-                   (keyword == "keyspace")) {
+                   (keyword == "keyspace") ||
+                   (keyword == "cache-journal") ||
+                   (keyword == "read-replicas")) {
             result->set(keyword, isc::data::Element::create(value));
         } else {
             LOG_ERROR(database_logger, DATABASE_TO_JSON_ERROR)
@@ -164,7 +164,8 @@ public:
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
     DatabaseConnection(const ParameterMap& parameters)
-        :parameters_(parameters) {
+        :parameters_(parameters), read_replica_(false),
+         read_replica_lost_(false) {
     }
 
     /// @brief Destructor
@@ -210,6 +211,23 @@ public:
     /// and set to false.
     bool configuredReadOnly() const;
 
+    /// @brief Marks the connection as a connection to a read replica.
+    ///
+    /// The loss of connectivity with a read replica does not invoke the
+    /// lost connectivity callback: the connection is marked as lost so
+    /// the backend stops using it.
+    void setReadReplica() {
+        read_replica_ = true;
+    }
+
+    /// @brief Checks if the connectivity with the read replica was lost.
+    ///
+    /// @return true if the connection is a connection to a read replica
+    /// and its connectivity was lost, false otherwise.
+    bool isReadReplicaLost() const {
+        return (read_replica_lost_);
+    }
+
     /// @brief Defines a callback prototype for propogating events upward
     typedef boost::function<bool (ReconnectCtlPtr db_retry)> DbLostCallback;
 
@@ -218,10 +236,11 @@ public:
     /// This function may be called by derivations when the connectivity
     /// to their data server is lost.  If connectivity callback was specified,
     /// this function will instantiate a ReconnectCtl and pass it to the
-    /// callback.
+    /// callback. The callback is not invoked for a connection to a read
+    /// replica, which is marked as lost instead.
     ///
     /// @return Returns the result of the callback or false if there is no
-    /// callback.
+    /// callback. Returns true for a connection to a read replica.
     bool invokeDbLostCallback() const;
 
     /// @brief Unparse a parameter map
@@ -249,6 +268,11 @@ private:
     /// intended to keep any DHCP-related parameters.
     ParameterMap parameters_;
 
+    /// @brief Indicates if the connection is to a read replica.
+    bool read_replica_;
+
+    /// @brief Indicates if the connectivity with the read replica was lost.
+    mutable bool read_replica_lost_;
 };
 
 }  // namespace db
@@ -1,4 +1,4 @@
-// File created from ../../../src/lib/database/db_messages.mes on Fri Feb 08 2019 20:16
+// File created from ../../../src/lib/database/db_messages.mes on Sun Oct 18 2026 11:49
 
 #include <cstddef>
 #include <log/message_types.h>
@@ -21,6 +21,9 @@ extern const isc::log::MessageID DATABASE_PGSQL_DEALLOC_ERROR = "DATABASE_PGSQL_
 extern const isc::log::MessageID DATABASE_PGSQL_FATAL_ERROR = "DATABASE_PGSQL_FATAL_ERROR";
 extern const isc::log::MessageID DATABASE_PGSQL_ROLLBACK = "DATABASE_PGSQL_ROLLBACK";
 extern const isc::log::MessageID DATABASE_PGSQL_START_TRANSACTION = "DATABASE_PGSQL_START_TRANSACTION";
+extern const isc::log::MessageID DATABASE_READ_REPLICAS = "DATABASE_READ_REPLICAS";
+extern const isc::log::MessageID DATABASE_READ_REPLICA_LOST = "DATABASE_READ_REPLICA_LOST";
+extern const isc::log::MessageID DATABASE_READ_REPLICA_RECONNECTED = "DATABASE_READ_REPLICA_RECONNECTED";
 extern const isc::log::MessageID DATABASE_TO_JSON_ERROR = "DATABASE_TO_JSON_ERROR";
 
 } // namespace db
@@ -43,6 +46,9 @@ const char* values[] = {
     "DATABASE_PGSQL_FATAL_ERROR", "Unrecoverable PostgreSQL error occurred: Statement: <%1>, reason: %2 (error code: %3).",
     "DATABASE_PGSQL_ROLLBACK", "rolling back PostgreSQL database",
     "DATABASE_PGSQL_START_TRANSACTION", "starting a new PostgreSQL transaction",
+    "DATABASE_READ_REPLICAS", "using %1 read replicas: %2",
+    "DATABASE_READ_REPLICA_LOST", "read replica %1 is unavailable, reconnecting every %2 seconds: %3",
+    "DATABASE_READ_REPLICA_RECONNECTED", "read replica %1 is available again",
     "DATABASE_TO_JSON_ERROR", "Internal logic error: uknown %1 element found in state: %2",
     NULL
 };
@@ -1,4 +1,4 @@
-// File created from ../../../src/lib/database/db_messages.mes on Fri Feb 08 2019 20:16
+// File created from ../../../src/lib/database/db_messages.mes on Sun Oct 18 2026 11:49
 
 #ifndef DB_MESSAGES_H
 #define DB_MESSAGES_H
@@ -22,6 +22,9 @@ extern const isc::log::MessageID DATABASE_PGSQL_DEALLOC_ERROR;
 extern const isc::log::MessageID DATABASE_PGSQL_FATAL_ERROR;
 extern const isc::log::MessageID DATABASE_PGSQL_ROLLBACK;
 extern const isc::log::MessageID DATABASE_PGSQL_START_TRANSACTION;
+extern const isc::log::MessageID DATABASE_READ_REPLICAS;
+extern const isc::log::MessageID DATABASE_READ_REPLICA_LOST;
+extern const isc::log::MessageID DATABASE_READ_REPLICA_RECONNECTED;
 extern const isc::log::MessageID DATABASE_TO_JSON_ERROR;
 
 } // namespace db
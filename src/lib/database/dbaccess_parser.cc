@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,6 +12,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <map>
 #include <string>
 #include <utility>
@@ -55,13 +57,16 @@ DbAccessParser::parse(std::string& access_string,
     int64_t request_timeout = 0;
     int64_t tcp_keepalive = 0;
     int64_t max_row_errors = 0;
+    int64_t write_back_latency = 1000;
 
     // 2. Update the copy with the passed keywords.
     for (std::pair<std::string, ConstElementPtr> param : database_config->mapValue()) {
         try {
             if ((param.first == "persist") ||
                 (param.first == "tcp-nodelay") ||
-                (param.first == "readonly")) {
+                (param.first == "readonly") ||
+                (param.first == "allocate-or-renew") ||
+                (param.first == "write-behind-cache")) {
                 values_copy[param.first] = (param.second->boolValue() ?
                                             "true" : "false");
 
@@ -104,6 +109,20 @@ DbAccessParser::parse(std::string& access_string,
                 max_row_errors = param.second->intValue();
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(max_row_errors);
+
+            } else if (param.first == "write-back-latency") {
+                write_back_latency = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(write_back_latency);
+
+            } else if (param.first == "read-replicas") {
+                // The hosts are separated by commas: the spaces are removed
+                // as they separate the parameters of the access string.
+                std::string replicas = param.second->stringValue();
+                replicas.erase(std::remove_if(replicas.begin(), replicas.end(),
+                                              ::isspace),
+                               replicas.end());
+                values_copy[param.first] = replicas;
             } else {
                 // all remaining string parameters
                 // type
@@ -115,6 +134,7 @@ DbAccessParser::parse(std::string& access_string,
                 // keyspace
                 // consistency
                 // serial-consistency
+                // cache-journal
                 values_copy[param.first] = param.second->stringValue();
             }
         } catch (const isc::data::TypeError& ex) {
@@ -232,6 +252,15 @@ DbAccessParser::parse(std::string& access_string,
                   << " (" << value->getPosition() << ")");
     }
 
+    // Check that the write-back-latency is reasonable.
+    if ((write_back_latency <= 0) ||
+        (write_back_latency > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("write-back-latency");
+        isc_throw(DbConfigError, "write-back-latency " << write_back_latency
+                  << " must be in range 1...MAX_UINT32 (4294967295) "
+                  << " (" << value->getPosition() << ")");
+    }
+
     // 4. If all is OK, update the stored keyword/value pairs.  We do this by
     // swapping contents - values_copy is destroyed immediately after the
     // operation (when the method exits), so we are not interested in its new
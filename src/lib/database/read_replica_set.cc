@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <database/db_log.h>
+#include <database/db_messages.h>
+#include <database/read_replica_set.h>
+#include <util/strutil.h>
+
+using namespace isc::util;
+
+namespace isc {
+namespace db {
+
+const unsigned int ReadReplicaSet::RECONNECT_INTERVAL;
+
+ReadReplicaSet::ReadReplicaSet(const DatabaseConnection::ParameterMap& parameters)
+    : mutex_(), replicas_(), lost_(), next_(0) {
+    auto param = parameters.find("read-replicas");
+    if (param == parameters.end()) {
+        return;
+    }
+
+    std::string hosts;
+    for (auto host : str::tokens(param->second, ", \t")) {
+        DatabaseConnection::ParameterMap replica(parameters);
+        replica.erase("read-replicas");
+        replica["host"] = host;
+        replica["readonly"] = "true";
+        replicas_.push_back(replica);
+        hosts += (hosts.empty() ? "" : ", ") + host;
+    }
+    lost_.resize(replicas_.size(), false);
+
+    if (!replicas_.empty()) {
+        LOG_INFO(database_logger, DATABASE_READ_REPLICAS)
+            .arg(replicas_.size())
+            .arg(hosts);
+    }
+}
+
+bool
+ReadReplicaSet::select(size_t& index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < replicas_.size(); ++i) {
+        size_t candidate = (next_ + i) % replicas_.size();
+        if (!lost_[candidate]) {
+            index = candidate;
+            next_ = candidate + 1;
+            return (true);
+        }
+    }
+    return (false);
+}
+
+bool
+ReadReplicaSet::isAvailable(size_t index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (!lost_.at(index));
+}
+
+void
+ReadReplicaSet::markLost(size_t index, const std::string& reason) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (lost_.at(index)) {
+            // Already reported.
+            return;
+        }
+        lost_[index] = true;
+    }
+    LOG_WARN(database_logger, DATABASE_READ_REPLICA_LOST)
+        .arg(replicas_[index].at("host"))
+        .arg(RECONNECT_INTERVAL)
+        .arg(reason);
+}
+
+void
+ReadReplicaSet::markAvailable(size_t index) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!lost_.at(index)) {
+            return;
+        }
+        lost_[index] = false;
+    }
+    LOG_INFO(database_logger, DATABASE_READ_REPLICA_RECONNECTED)
+        .arg(replicas_[index].at("host"));
+}
+
+} // namespace db
+} // namespace isc
@@ -0,0 +1,256 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef READ_REPLICA_SET_H
+#define READ_REPLICA_SET_H
+
+#include <database/database_connection.h>
+#include <database/db_exceptions.h>
+#include <boost/noncopyable.hpp>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace db {
+
+/// @brief Read replicas of an SQL database.
+///
+/// The replicas are given by the "read-replicas" parameter, a comma
+/// separated list of hosts. The replicas use the same parameters as the
+/// primary database except the host, e.g. the same port, database name,
+/// user and password, and are opened in read only mode.
+///
+/// The replicas are selected in turn (round robin). A replica which could
+/// not be opened or whose connectivity was lost is not selected until it
+/// is reconnected in the background, which is attempted every
+/// @c RECONNECT_INTERVAL seconds.
+class ReadReplicaSet : public boost::noncopyable {
+public:
+
+    /// @brief Number of seconds between the attempts to reconnect the
+    /// unavailable replicas.
+    static const unsigned int RECONNECT_INTERVAL = 10;
+
+    /// @brief Constructor.
+    ///
+    /// @param parameters Parameters of the primary database.
+    explicit ReadReplicaSet(const DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Destructor.
+    virtual ~ReadReplicaSet() {
+    }
+
+    /// @brief Returns the number of replicas.
+    size_t size() const {
+        return (replicas_.size());
+    }
+
+    /// @brief Returns the parameters of a replica.
+    ///
+    /// @param index Index of the replica.
+    /// @return The parameters used to connect to the replica.
+    const DatabaseConnection::ParameterMap& getParameters(size_t index) const {
+        return (replicas_.at(index));
+    }
+
+    /// @brief Selects the next available replica.
+    ///
+    /// @param [out] index Index of the selected replica.
+    /// @return false if no replica is available, true otherwise.
+    bool select(size_t& index);
+
+    /// @brief Checks if a replica is available.
+    ///
+    /// @param index Index of the replica.
+    /// @return true if the replica can be selected, false otherwise.
+    bool isAvailable(size_t index);
+
+    /// @brief Marks a replica as unavailable.
+    ///
+    /// @param index Index of the replica.
+    /// @param reason Why the replica is unavailable.
+    void markLost(size_t index, const std::string& reason);
+
+    /// @brief Marks a replica as available again.
+    ///
+    /// @param index Index of the replica.
+    void markAvailable(size_t index);
+
+protected:
+
+    /// @brief Mutex protecting the replica states.
+    std::mutex mutex_;
+
+private:
+
+    /// @brief Parameters of the replicas.
+    std::vector<DatabaseConnection::ParameterMap> replicas_;
+
+    /// @brief Unavailable replicas.
+    std::vector<bool> lost_;
+
+    /// @brief Index of the next replica to be selected.
+    size_t next_;
+};
+
+/// @brief Contexts connected to the read replicas of an SQL database.
+///
+/// Each replica has its pool of contexts, created by the backend supplied
+/// factory. The contexts are never opened by @c acquire so the queries are
+/// not delayed by an unreachable replica: the constructor opens one context
+/// per replica and @c reconnect, called periodically in the background,
+/// reconnects the unavailable replicas and adds a context to the replicas
+/// which had none left for a query. A context whose connectivity was lost
+/// is discarded and its replica is marked as unavailable.
+///
+/// @tparam ContextPtr Pointer to a backend context, the context must have
+/// a @c conn_ member derived from @c DatabaseConnection.
+template<typename ContextPtr>
+class ReadReplicaPool : public ReadReplicaSet {
+public:
+
+    /// @brief Creates a context connected to a database.
+    typedef std::function<ContextPtr (const DatabaseConnection::ParameterMap&)>
+    ContextFactory;
+
+    /// @brief Constructor.
+    ///
+    /// Opens a context for each replica, a replica which cannot be opened
+    /// is marked as unavailable.
+    ///
+    /// @param parameters Parameters of the primary database.
+    /// @param factory Creates the contexts.
+    ReadReplicaPool(const DatabaseConnection::ParameterMap& parameters,
+                    const ContextFactory& factory)
+        : ReadReplicaSet(parameters), factory_(factory), pools_(size()),
+          missed_(size(), false) {
+        for (size_t index = 0; index < size(); ++index) {
+            open(index);
+        }
+    }
+
+    /// @brief Takes a context connected to a read replica.
+    ///
+    /// @param [out] index Index of the replica.
+    /// @return The context or null if no replica has an available context.
+    ContextPtr acquire(size_t& index) {
+        for (size_t attempt = 0; attempt < size(); ++attempt) {
+            if (!select(index)) {
+                break;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!pools_[index].empty()) {
+                ContextPtr ctx = pools_[index].back();
+                pools_[index].pop_back();
+                return (ctx);
+            }
+            missed_[index] = true;
+        }
+        return (ContextPtr());
+    }
+
+    /// @brief Puts back a context taken by @c acquire.
+    ///
+    /// @param index Index of the replica.
+    /// @param ctx The context.
+    void release(size_t index, const ContextPtr& ctx) {
+        if (ctx->conn_.isReadReplicaLost()) {
+            markLost(index, "connectivity lost");
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        pools_[index].push_back(ctx);
+    }
+
+    /// @brief Opens the missing contexts.
+    ///
+    /// Reconnects the unavailable replicas and adds a context to the
+    /// replicas which had no context left for a query. It is called
+    /// periodically in the background, e.g. by a timer.
+    void reconnect() {
+        for (size_t index = 0; index < size(); ++index) {
+            if (isAvailable(index)) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!missed_[index]) {
+                    continue;
+                }
+                missed_[index] = false;
+            }
+            open(index);
+        }
+    }
+
+private:
+
+    /// @brief Opens a context and adds it to the pool of a replica.
+    ///
+    /// @param index Index of the replica.
+    void open(size_t index) {
+        ContextPtr ctx;
+        try {
+            ctx = factory_(getParameters(index));
+            ctx->conn_.setReadReplica();
+        } catch (const std::exception& ex) {
+            markLost(index, ex.what());
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pools_[index].push_back(ctx);
+        }
+        markAvailable(index);
+    }
+
+    /// @brief Creates the contexts.
+    ContextFactory factory_;
+
+    /// @brief Available contexts of each replica.
+    std::vector<std::vector<ContextPtr> > pools_;
+
+    /// @brief Replicas which had no context left for a query.
+    std::vector<bool> missed_;
+};
+
+/// @brief Runs a read only query on a read replica when one is available.
+///
+/// The query is run again on the primary database when the connectivity
+/// with the read replica is lost during the query. The context allocator
+/// then releases the context of the replica which marks the replica as
+/// unavailable.
+///
+/// @tparam ContextAlloc Context allocator of the backend. Its constructor
+/// takes the backend and a flag which requests a read replica.
+/// @param backend The backend.
+/// @param [out] result Result of the query, reset before the query is
+/// run again.
+/// @param query Runs the query with the given context.
+template<typename ContextAlloc, typename Backend, typename Result,
+         typename Query>
+void readFromReplica(const Backend& backend, Result& result,
+                     const Query& query) {
+    {
+        ContextAlloc get_context(backend, true);
+        try {
+            query(get_context.ctx_);
+            return;
+        } catch (const DbOperationError&) {
+            if (!get_context.ctx_->conn_.isReadReplicaLost()) {
+                throw;
+            }
+        }
+    }
+
+    result = Result();
+    ContextAlloc get_context(backend);
+    query(get_context.ctx_);
+}
+
+} // namespace db
+} // namespace isc
+
+#endif // READ_REPLICA_SET_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -169,7 +169,10 @@ private:
                  (parameter != "connect-timeout") &&
                  (parameter != "port") &&
                  (parameter != "max-row-errors") &&
-                 (parameter != "readonly"));
+                 (parameter != "readonly") &&
+                 (parameter != "allocate-or-renew") &&
+                 (parameter != "write-behind-cache") &&
+                 (parameter != "write-back-latency"));
     }
 
 };
@@ -721,6 +724,108 @@ TEST_F(DbAccessParserTest, invalidReadOnly) {
     EXPECT_THROW(parser.parse(json_elements), DbConfigError);
 }
 
+// Check that the configuration is accepted for the valid value
+// of "allocate-or-renew".
+TEST_F(DbAccessParserTest, validAllocateOrRenew) {
+    const char* config[] = {"type", "mysql",
+                            "user", "keatest",
+                            "password", "keatest",
+                            "name", "keatest",
+                            "allocate-or-renew", "true",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_NO_THROW(parser.parse(json_elements));
+
+    checkAccessString("Valid allocate-or-renew parameter",
+                      parser.getDbAccessParameters(),
+                      config);
+}
+
+// Check that for the invalid value of the "allocate-or-renew" parameter
+// an exception is thrown.
+TEST_F(DbAccessParserTest, invalidAllocateOrRenew) {
+    const char* config[] = {"type", "mysql",
+                            "user", "keatest",
+                            "password", "keatest",
+                            "name", "keatest",
+                            "allocate-or-renew", "1",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_THROW(parser.parse(json_elements), DbConfigError);
+}
+
+// Check that the configuration of the write-behind lease cache is accepted.
+TEST_F(DbAccessParserTest, validWriteBehindCache) {
+    const char* config[] = {"type", "mysql",
+                            "user", "keatest",
+                            "password", "keatest",
+                            "name", "keatest",
+                            "write-behind-cache", "true",
+                            "write-back-latency", "500",
+                            "cache-journal", "/tmp/kea-leases4-journal.csv",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_NO_THROW(parser.parse(json_elements));
+
+    checkAccessString("Valid write-behind cache parameters",
+                      parser.getDbAccessParameters(),
+                      config);
+}
+
+// Check that the read replicas are accepted.
+TEST_F(DbAccessParserTest, validReadReplicas) {
+    const char* config[] = {"type", "postgresql",
+                            "user", "keatest",
+                            "password", "keatest",
+                            "name", "keatest",
+                            "read-replicas", "192.0.2.2,192.0.2.3",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_NO_THROW(parser.parse(json_elements));
+
+    checkAccessString("Valid read replicas",
+                      parser.getDbAccessParameters(),
+                      config);
+}
+
+// Check that an exception is thrown for the out of range write-back-latency.
+TEST_F(DbAccessParserTest, invalidWriteBackLatency) {
+    const char* config[] = {"type", "mysql",
+                            "user", "keatest",
+                            "password", "keatest",
+                            "name", "keatest",
+                            "write-behind-cache", "true",
+                            "write-back-latency", "0",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_THROW(parser.parse(json_elements), DbConfigError);
+}
+
 // Check that multiple host storages are correctly parsed.
 TEST_F(DbAccessParserTest, multipleHost) {
     const char* config1[] = {"type", "mysql",
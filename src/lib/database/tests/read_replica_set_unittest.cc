@@ -0,0 +1,310 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <database/database_connection.h>
+#include <database/db_exceptions.h>
+#include <database/read_replica_set.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+
+#include <boost/shared_ptr.hpp>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace isc::db;
+
+namespace {
+
+/// @brief Context used to test @c ReadReplicaPool.
+struct TestContext {
+    /// @brief Constructor.
+    ///
+    /// @param parameters Parameters of the connection.
+    TestContext(const DatabaseConnection::ParameterMap& parameters)
+        : conn_(parameters) {
+    }
+
+    /// @brief The connection.
+    DatabaseConnection conn_;
+};
+
+/// @brief Pointer to a test context.
+typedef boost::shared_ptr<TestContext> TestContextPtr;
+
+/// @brief Returns the parameters of a primary database with two replicas.
+DatabaseConnection::ParameterMap
+makeParameters() {
+    DatabaseConnection::ParameterMap parameters;
+    parameters["type"] = "postgresql";
+    parameters["name"] = "keatest";
+    parameters["host"] = "192.0.2.1";
+    parameters["read-replicas"] = "192.0.2.2,192.0.2.3";
+    return (parameters);
+}
+
+// Verifies that the replicas are built from the parameters of the primary.
+TEST(ReadReplicaSetTest, parameters) {
+    ReadReplicaSet replicas(makeParameters());
+    ASSERT_EQ(2, replicas.size());
+
+    const DatabaseConnection::ParameterMap& replica = replicas.getParameters(1);
+    EXPECT_EQ("192.0.2.3", replica.at("host"));
+    EXPECT_EQ("keatest", replica.at("name"));
+    EXPECT_EQ("true", replica.at("readonly"));
+    EXPECT_EQ(0, replica.count("read-replicas"));
+
+    // No replica is configured.
+    DatabaseConnection::ParameterMap parameters = makeParameters();
+    parameters.erase("read-replicas");
+    ReadReplicaSet none(parameters);
+    EXPECT_EQ(0, none.size());
+    size_t index = 0;
+    EXPECT_FALSE(none.select(index));
+}
+
+// Verifies that the replicas are selected in turn and the unavailable
+// replicas are skipped.
+TEST(ReadReplicaSetTest, select) {
+    ReadReplicaSet replicas(makeParameters());
+    size_t index = 5;
+    ASSERT_TRUE(replicas.select(index));
+    EXPECT_EQ(0, index);
+    ASSERT_TRUE(replicas.select(index));
+    EXPECT_EQ(1, index);
+    ASSERT_TRUE(replicas.select(index));
+    EXPECT_EQ(0, index);
+
+    replicas.markLost(0, "test");
+    ASSERT_TRUE(replicas.select(index));
+    EXPECT_EQ(1, index);
+    ASSERT_TRUE(replicas.select(index));
+    EXPECT_EQ(1, index);
+
+    replicas.markLost(1, "test");
+    EXPECT_FALSE(replicas.select(index));
+    EXPECT_FALSE(replicas.isAvailable(0));
+    EXPECT_FALSE(replicas.isAvailable(1));
+
+    // A replica marked as available is selected again.
+    replicas.markAvailable(0);
+    EXPECT_TRUE(replicas.isAvailable(0));
+    ASSERT_TRUE(replicas.select(index));
+    EXPECT_EQ(0, index);
+}
+
+// Verifies that the contexts are opened by the constructor, reused and
+// discarded when their connectivity was lost, and that acquire never
+// opens a context.
+TEST(ReadReplicaPoolTest, acquireRelease) {
+    std::multiset<std::string> created;
+    ReadReplicaPool<TestContextPtr>
+        pool(makeParameters(),
+             [&created](const DatabaseConnection::ParameterMap& parameters) {
+            created.insert(parameters.at("host"));
+            return (TestContextPtr(new TestContext(parameters)));
+        });
+
+    // Each replica has a context.
+    EXPECT_EQ(2, created.size());
+    EXPECT_EQ(1, created.count("192.0.2.2"));
+    EXPECT_EQ(1, created.count("192.0.2.3"));
+
+    size_t index = 0;
+    TestContextPtr ctx = pool.acquire(index);
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(0, index);
+    pool.release(index, ctx);
+
+    // The second replica is used next.
+    TestContextPtr ctx2 = pool.acquire(index);
+    ASSERT_TRUE(ctx2);
+    EXPECT_EQ(1, index);
+    pool.release(index, ctx2);
+
+    // The released context of the first replica is reused.
+    EXPECT_EQ(ctx, pool.acquire(index));
+    EXPECT_EQ(0, index);
+
+    // All contexts are in use: no context is opened by acquire.
+    EXPECT_EQ(ctx2, pool.acquire(index));
+    EXPECT_EQ(1, index);
+    EXPECT_FALSE(pool.acquire(index));
+    EXPECT_EQ(2, created.size());
+
+    // A context is added in the background to the replicas which had
+    // none left.
+    pool.reconnect();
+    EXPECT_EQ(4, created.size());
+    TestContextPtr ctx3 = pool.acquire(index);
+    ASSERT_TRUE(ctx3);
+    pool.release(index, ctx3);
+
+    // Nothing is opened when no context was missing.
+    pool.reconnect();
+    EXPECT_EQ(4, created.size());
+
+    // The loss of connectivity doesn't invoke the callback.
+    EXPECT_TRUE(ctx->conn_.invokeDbLostCallback());
+    EXPECT_TRUE(ctx->conn_.isReadReplicaLost());
+    pool.release(0, ctx);
+    EXPECT_FALSE(pool.isAvailable(0));
+
+    // The first replica is no longer used.
+    pool.release(1, ctx2);
+    for (unsigned i = 0; i < 3; ++i) {
+        ctx = pool.acquire(index);
+        ASSERT_TRUE(ctx);
+        EXPECT_EQ(1, index);
+        pool.release(index, ctx);
+    }
+}
+
+// Verifies that a replica which cannot be opened is skipped until it is
+// reconnected in the background.
+TEST(ReadReplicaPoolTest, reconnect) {
+    bool down = true;
+    ReadReplicaPool<TestContextPtr>
+        pool(makeParameters(),
+             [&down](const DatabaseConnection::ParameterMap& parameters) {
+            if (down && (parameters.at("host") == "192.0.2.2")) {
+                isc_throw(DbOpenError, "cannot open");
+            }
+            return (TestContextPtr(new TestContext(parameters)));
+        });
+    EXPECT_FALSE(pool.isAvailable(0));
+    EXPECT_TRUE(pool.isAvailable(1));
+
+    size_t index = 0;
+    TestContextPtr ctx = pool.acquire(index);
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(1, index);
+
+    // The connectivity of the last replica is lost: no replica is available.
+    EXPECT_TRUE(ctx->conn_.invokeDbLostCallback());
+    pool.release(index, ctx);
+    EXPECT_FALSE(pool.acquire(index));
+
+    // Only the second replica can be reconnected.
+    pool.reconnect();
+    EXPECT_FALSE(pool.isAvailable(0));
+    EXPECT_TRUE(pool.isAvailable(1));
+    ctx = pool.acquire(index);
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(1, index);
+    pool.release(index, ctx);
+
+    // The first replica is used again once it is reconnected.
+    down = false;
+    pool.reconnect();
+    EXPECT_TRUE(pool.isAvailable(0));
+    ctx = pool.acquire(index);
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(0, index);
+}
+
+/// @brief Backend used to test @c readFromReplica.
+struct TestBackend {
+    /// @brief Constructor.
+    TestBackend()
+        : replicas_(new ReadReplicaPool<TestContextPtr>(makeParameters(),
+              [](const DatabaseConnection::ParameterMap& parameters) {
+                  return (TestContextPtr(new TestContext(parameters)));
+              })),
+          primary_(new TestContext(makeParameters())) {
+    }
+
+    /// @brief The read replicas.
+    boost::shared_ptr<ReadReplicaPool<TestContextPtr> > replicas_;
+
+    /// @brief The context of the primary database.
+    TestContextPtr primary_;
+};
+
+/// @brief Context allocator of the test backend.
+struct TestContextAlloc {
+    /// @brief Constructor.
+    ///
+    /// @param backend The backend.
+    /// @param replica Use a read replica when one is available.
+    TestContextAlloc(const TestBackend& backend, bool replica = false)
+        : ctx_(), backend_(backend), replica_(false), index_(0) {
+        if (replica) {
+            ctx_ = backend_.replicas_->acquire(index_);
+            replica_ = static_cast<bool>(ctx_);
+        }
+        if (!ctx_) {
+            ctx_ = backend_.primary_;
+        }
+    }
+
+    /// @brief Destructor.
+    ~TestContextAlloc() {
+        if (replica_) {
+            backend_.replicas_->release(index_, ctx_);
+        }
+    }
+
+    /// @brief The context.
+    TestContextPtr ctx_;
+
+    /// @brief The backend.
+    const TestBackend& backend_;
+
+    /// @brief The context is connected to a read replica.
+    bool replica_;
+
+    /// @brief Index of the read replica.
+    size_t index_;
+};
+
+// Verifies that a read which lost the connectivity with its replica is
+// run again on the primary database.
+TEST(ReadReplicaPoolTest, readFromReplica) {
+    TestBackend backend;
+    std::vector<std::string> hosts;
+    std::vector<std::string> result;
+    auto query = [&hosts, &result](TestContextPtr& ctx) {
+        std::string host = ctx->conn_.getParameter("host");
+        hosts.push_back(host);
+        result.push_back(host);
+        if (host == "192.0.2.2") {
+            ctx->conn_.invokeDbLostCallback();
+            isc_throw(DbOperationError, "connectivity lost");
+        }
+    };
+
+    // The first replica fails: the query is run again on the primary
+    // with a reset result.
+    ASSERT_NO_THROW(readFromReplica<TestContextAlloc>(backend, result, query));
+    ASSERT_EQ(2, hosts.size());
+    EXPECT_EQ("192.0.2.2", hosts[0]);
+    EXPECT_EQ("192.0.2.1", hosts[1]);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ("192.0.2.1", result[0]);
+    EXPECT_FALSE(backend.replicas_->isAvailable(0));
+
+    // The second replica answers.
+    hosts.clear();
+    result.clear();
+    ASSERT_NO_THROW(readFromReplica<TestContextAlloc>(backend, result, query));
+    ASSERT_EQ(1, hosts.size());
+    EXPECT_EQ("192.0.2.3", hosts[0]);
+
+    // Other errors are not retried.
+    hosts.clear();
+    auto failing = [&hosts](TestContextPtr& ctx) {
+        hosts.push_back(ctx->conn_.getParameter("host"));
+        isc_throw(DbOperationError, "syntax error");
+    };
+    EXPECT_THROW(readFromReplica<TestContextAlloc>(backend, result, failing),
+                 DbOperationError);
+    EXPECT_EQ(1, hosts.size());
+    EXPECT_TRUE(backend.replicas_->isAvailable(1));
+}
+
+} // end of anonymous namespace
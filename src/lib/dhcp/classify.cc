@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,14 +10,166 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/constants.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
+namespace {
+
+using namespace isc::dhcp;
+
+/// @brief Class names of the client class index.
+struct ClientClassNames {
+
+    /// @brief Constructor.
+    ClientClassNames() : ids_(), names_() {
+    }
+
+    /// @brief Returns the identifier of a class name.
+    ClientClassId find(const ClientClass& class_name) const {
+        auto it = ids_.find(class_name);
+        if (it == ids_.end()) {
+            return (ClientClassIndex::NO_CLASS_ID);
+        }
+        return (it->second);
+    }
+
+    /// @brief Class name to identifier map.
+    std::unordered_map<ClientClass, ClientClassId> ids_;
+
+    /// @brief Class names indexed by identifiers.
+    std::vector<ClientClass> names_;
+};
+
+/// @brief Pointer to read-only class names.
+typedef boost::shared_ptr<const ClientClassNames> ConstClientClassNamesPtr;
+
+/// @brief Storage of the client class index.
+///
+/// The names are interned into a staging copy under the mutex. The commit
+/// publishes a read-only copy of the staging names and bumps the version.
+/// Each thread keeps a reference to the published copy it has seen last
+/// and takes the mutex only when the version has changed.
+struct ClientClassIndexStorage {
+
+    /// @brief Constructor.
+    ///
+    /// Interns and publishes the built-in classes.
+    ClientClassIndexStorage()
+        : mutex_(), staging_(), current_(), version_(0) {
+        intern("ALL");
+        intern("KNOWN");
+        intern("UNKNOWN");
+        commit();
+    }
+
+    /// @brief Interns a class name (the caller holds the mutex).
+    ClientClassId intern(const ClientClass& class_name) {
+        ClientClassId id = staging_.find(class_name);
+        if (id != ClientClassIndex::NO_CLASS_ID) {
+            return (id);
+        }
+        id = static_cast<ClientClassId>(staging_.names_.size());
+        staging_.ids_.insert(std::make_pair(class_name, id));
+        staging_.names_.push_back(class_name);
+        return (id);
+    }
+
+    /// @brief Publishes the staging names (the caller holds the mutex).
+    void commit() {
+        if (current_ && (current_->names_.size() == staging_.names_.size())) {
+            return;
+        }
+        current_.reset(new ClientClassNames(staging_));
+        version_.fetch_add(1, std::memory_order_release);
+    }
+
+    /// @brief Returns the published names.
+    ///
+    /// The mutex is taken only the first time a thread sees a new
+    /// version.
+    const ClientClassNames& getCurrent() {
+        static thread_local ConstClientClassNamesPtr cached;
+        static thread_local uint64_t cached_version = 0;
+        if (cached_version != version_.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cached = current_;
+            cached_version = version_.load(std::memory_order_relaxed);
+        }
+        return (*cached);
+    }
+
+    /// @brief The mutex used to protect the staging and published names.
+    std::mutex mutex_;
+
+    /// @brief All interned names including the not yet published ones.
+    ClientClassNames staging_;
+
+    /// @brief The published names.
+    ConstClientClassNamesPtr current_;
+
+    /// @brief The version of the published names.
+    std::atomic<uint64_t> version_;
+};
+
+/// @brief Returns the client class index storage.
+ClientClassIndexStorage& getIndexStorage() {
+    static ClientClassIndexStorage storage;
+    return (storage);
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
+const ClientClassId ClientClassIndex::NO_CLASS_ID;
+
+ClientClassId
+ClientClassIndex::intern(const ClientClass& class_name) {
+    ClientClassIndexStorage& storage = getIndexStorage();
+    std::lock_guard<std::mutex> lock(storage.mutex_);
+    return (storage.intern(class_name));
+}
+
+void
+ClientClassIndex::commit() {
+    ClientClassIndexStorage& storage = getIndexStorage();
+    std::lock_guard<std::mutex> lock(storage.mutex_);
+    storage.commit();
+}
+
+ClientClassId
+ClientClassIndex::find(const ClientClass& class_name) {
+    return (getIndexStorage().getCurrent().find(class_name));
+}
+
+ClientClass
+ClientClassIndex::getName(ClientClassId id) {
+    ClientClassIndexStorage& storage = getIndexStorage();
+    const ClientClassNames& current = storage.getCurrent();
+    if (id < current.names_.size()) {
+        return (current.names_[id]);
+    }
+    // Not yet published.
+    std::lock_guard<std::mutex> lock(storage.mutex_);
+    if (id >= storage.staging_.names_.size()) {
+        return (ClientClass());
+    }
+    return (storage.staging_.names_[id]);
+}
+
+ClientClassId
+ClientClassIndex::getPublishedCount() {
+    const ClientClassNames& current = getIndexStorage().getCurrent();
+    return (static_cast<ClientClassId>(current.names_.size()));
+}
+
 ClientClasses::ClientClasses(const std::string& class_names)
-    : list_(), set_() {
+    : list_(), bits_(), others_(), others_floor_(0) {
     std::vector<std::string> split_text;
     boost::split(split_text, class_names, boost::is_any_of(","),
                  boost::algorithm::token_compress_off);
@@ -30,6 +182,22 @@ ClientClasses::ClientClasses(const std::string& class_names)
     }
 }
 
+void
+ClientClasses::insert(ClientClassId id, const ClientClass& class_name) {
+    list_.push_back(class_name);
+    if (id == ClientClassIndex::NO_CLASS_ID) {
+        if (others_.empty()) {
+            others_floor_ = ClientClassIndex::getPublishedCount();
+        }
+        others_.insert(class_name);
+        return;
+    }
+    if (id >= bits_.size()) {
+        bits_.resize(id + 1);
+    }
+    bits_.set(id);
+}
+
 std::string
 ClientClasses::toText(const std::string& separator) const {
     std::stringstream s;
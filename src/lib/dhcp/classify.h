@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,8 @@
 #ifndef CLASSIFY_H
 #define CLASSIFY_H
 
+#include <boost/dynamic_bitset.hpp>
+#include <stdint.h>
 #include <string>
 #include <iterator>
 #include <list>
@@ -36,10 +38,65 @@ namespace dhcp {
     /// @brief Defines a single class name.
     typedef std::string ClientClass;
 
+    /// @brief Defines a small integer identifying a class name.
+    typedef uint32_t ClientClassId;
+
+    /// @brief Process wide index of interned client class names
+    ///
+    /// The names of the configured classes (and of the built-in classes)
+    /// are interned when the configuration is parsed, so a membership test
+    /// using a class identifier is a bit test. The names which are not
+    /// interned, e.g. vendor class names built from the packet content,
+    /// are never added to the index so it can't grow with the traffic.
+    ///
+    /// The names interned by the parsers are staged: they are published
+    /// by @c commit when the configuration is committed. The published
+    /// index is read-only so @c find does not take a lock.
+    class ClientClassIndex {
+    public:
+
+        /// @brief Identifier returned for a name which is not interned.
+        static const ClientClassId NO_CLASS_ID = 0xffffffff;
+
+        /// @brief Interns a class name.
+        ///
+        /// The identifier is assigned immediately but the name is found
+        /// by @c find only after the next @c commit.
+        ///
+        /// @param class_name The name of the class.
+        /// @return The identifier of the class.
+        static ClientClassId intern(const ClientClass& class_name);
+
+        /// @brief Publishes the class names interned since the last commit.
+        ///
+        /// Called when the configuration is committed.
+        static void commit();
+
+        /// @brief Returns the identifier of a published class name.
+        ///
+        /// @param class_name The name of the class.
+        /// @return The identifier of the class or @c NO_CLASS_ID.
+        static ClientClassId find(const ClientClass& class_name);
+
+        /// @brief Returns the name of an interned class.
+        ///
+        /// @param id The identifier of the class.
+        /// @return The name of the class or an empty string.
+        static ClientClass getName(ClientClassId id);
+
+        /// @brief Returns the number of published class names.
+        ///
+        /// The identifiers of the published names are lower than this
+        /// number.
+        static ClientClassId getPublishedCount();
+    };
+
     /// @brief Container for storing client class names
     ///
-    /// Both a list to iterate on it in insert order and unordered
-    /// set of names for existence.
+    /// Both a list to iterate on it in insert order and a bitset
+    /// indexed by the identifiers of the interned class names for
+    /// existence. The names which are not interned are kept in an
+    /// unordered set.
     class ClientClasses {
     public:
 
@@ -47,7 +104,7 @@ namespace dhcp {
         typedef std::list<ClientClass>::const_iterator const_iterator;
 
         /// @brief Default constructor.
-        ClientClasses() : list_(), set_() {
+        ClientClasses() : list_(), bits_(), others_(), others_floor_(0) {
         }
 
         /// @brief Constructor from comma separated values.
@@ -60,10 +117,16 @@ namespace dhcp {
         ///
         /// @param class_name The name of the class to insert
         void insert(const ClientClass& class_name) {
-            list_.push_back(class_name);
-            set_.insert(class_name);
+            insert(ClientClassIndex::find(class_name), class_name);
         }
 
+        /// @brief Insert an element with a known identifier.
+        ///
+        /// @param id The identifier of the class as returned by
+        /// @c ClientClassIndex::find.
+        /// @param class_name The name of the class to insert
+        void insert(ClientClassId id, const ClientClass& class_name);
+
         /// @brief Check if classes is empty.
         bool empty() const {
             return (list_.empty());
@@ -92,13 +155,41 @@ namespace dhcp {
         /// @param x client class to be checked
         /// @return true if x belongs to the classes
         bool contains(const ClientClass& x) const {
-            return (set_.count(x) != 0);
+            ClientClassId id = ClientClassIndex::find(x);
+            if ((id < bits_.size()) && bits_.test(id)) {
+                return (true);
+            }
+            return (!others_.empty() && (others_.count(x) != 0));
+        }
+
+        /// @brief returns if class with identifier id belongs to the
+        /// defined classes
+        ///
+        /// This is a bit test when the class was interned before it
+        /// was inserted, which is the case for the configured classes.
+        /// The names kept by name are compared only with the identifiers
+        /// published after their insertion, so the configured classes
+        /// never fall back to a comparison of names.
+        ///
+        /// @param id identifier of the client class to be checked
+        /// @return true if the class belongs to the classes
+        bool contains(ClientClassId id) const {
+            if ((id < bits_.size()) && bits_.test(id)) {
+                return (true);
+            }
+            if (others_.empty() || (id < others_floor_) ||
+                (id == ClientClassIndex::NO_CLASS_ID)) {
+                return (false);
+            }
+            return (others_.count(ClientClassIndex::getName(id)) != 0);
         }
 
         /// @brief Clears containers.
         void clear() {
             list_.clear();
-            set_.clear();
+            bits_.clear();
+            others_.clear();
+            others_floor_ = 0;
         }
 
         /// @brief Returns all class names as text
@@ -112,8 +203,18 @@ namespace dhcp {
         /// @brief List/ordered part
         std::list<ClientClass> list_;
 
-        /// @brief Set/unordered part
-        std::unordered_set<ClientClass> set_;
+        /// @brief Set part for the interned class names
+        boost::dynamic_bitset<> bits_;
+
+        /// @brief Set/unordered part for the other class names
+        std::unordered_set<ClientClass> others_;
+
+        /// @brief Number of published class names when the first other
+        /// class name was inserted
+        ///
+        /// The other class names were not published when they were
+        /// inserted so their identifiers, if any, are not lower.
+        ClientClassId others_floor_;
     };
 
 };
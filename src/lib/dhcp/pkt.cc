@@ -96,6 +96,11 @@ Pkt::inClass(const std::string& client_class) {
     return (classes_.contains(client_class));
 }
 
+bool
+Pkt::inClass(ClientClassId id) {
+    return (classes_.contains(id));
+}
+
 void
 Pkt::addClass(const std::string& client_class, bool required) {
     // Always have ALL first.
@@ -103,8 +108,11 @@ Pkt::addClass(const std::string& client_class, bool required) {
         classes_.insert("ALL");
     }
     ClientClasses& classes = !required ? classes_ : required_classes_;
-    if (!classes.contains(client_class)) {
-        classes.insert(client_class);
+    ClientClassId id = ClientClassIndex::find(client_class);
+    bool found = (id != ClientClassIndex::NO_CLASS_ID ? classes.contains(id) :
+                  classes.contains(client_class));
+    if (!found) {
+        classes.insert(id, client_class);
     }
 }
 
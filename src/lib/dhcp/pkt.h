@@ -271,6 +271,12 @@ public:
     /// @return true if belongs
     bool inClass(const isc::dhcp::ClientClass& client_class);
 
+    /// @brief Checks whether a client belongs to a given interned class.
+    ///
+    /// @param id identifier of the class (see @ref ClientClassIndex)
+    /// @return true if belongs
+    bool inClass(ClientClassId id);
+
     /// @brief Adds packet to a specified class.
     ///
     /// A packet can be added to the same class repeatedly. Any additional
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,8 @@
 #include <dhcp/classify.h>
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace isc::dhcp;
 
 // Trivial test for now as ClientClass is a std::string.
@@ -131,3 +133,70 @@ TEST(ClassifyTest, ClientClassesToText) {
     // Check non-standard separator.
     EXPECT_EQ("alpha.gamma.beta", classes.toText("."));
 }
+
+// Check that class names are interned.
+TEST(ClassifyTest, ClientClassIndex) {
+    // Built-in classes are always interned.
+    EXPECT_NE(ClientClassIndex::NO_CLASS_ID, ClientClassIndex::find("ALL"));
+    EXPECT_NE(ClientClassIndex::NO_CLASS_ID, ClientClassIndex::find("KNOWN"));
+    EXPECT_NE(ClientClassIndex::NO_CLASS_ID, ClientClassIndex::find("UNKNOWN"));
+
+    EXPECT_EQ(ClientClassIndex::NO_CLASS_ID,
+              ClientClassIndex::find("index-alpha"));
+    ClientClassId id = ClientClassIndex::intern("index-alpha");
+    EXPECT_NE(ClientClassIndex::NO_CLASS_ID, id);
+    // The name is found only after the commit.
+    EXPECT_EQ(ClientClassIndex::NO_CLASS_ID,
+              ClientClassIndex::find("index-alpha"));
+    EXPECT_EQ("index-alpha", ClientClassIndex::getName(id));
+    EXPECT_GE(id, ClientClassIndex::getPublishedCount());
+    ClientClassIndex::commit();
+    EXPECT_LT(id, ClientClassIndex::getPublishedCount());
+    EXPECT_EQ(id, ClientClassIndex::find("index-alpha"));
+    EXPECT_EQ(id, ClientClassIndex::intern("index-alpha"));
+    EXPECT_EQ("index-alpha", ClientClassIndex::getName(id));
+    EXPECT_NE(id, ClientClassIndex::intern("index-beta"));
+    EXPECT_TRUE(ClientClassIndex::getName(ClientClassIndex::NO_CLASS_ID).empty());
+
+    // Other threads see the published names.
+    ClientClassIndex::commit();
+    ClientClassId found = ClientClassIndex::NO_CLASS_ID;
+    std::thread reader([&found]() {
+        found = ClientClassIndex::find("index-beta");
+    });
+    reader.join();
+    EXPECT_EQ(ClientClassIndex::intern("index-beta"), found);
+}
+
+// Check membership tests by class identifiers.
+TEST(ClassifyTest, ClientClassesById) {
+    ClientClassId alpha = ClientClassIndex::intern("byid-alpha");
+    ClientClassId beta = ClientClassIndex::intern("byid-beta");
+    ClientClassIndex::commit();
+    ClientClasses classes;
+    EXPECT_FALSE(classes.contains(alpha));
+    EXPECT_FALSE(classes.contains(ClientClassIndex::NO_CLASS_ID));
+
+    // Interned and not interned names.
+    classes.insert("byid-alpha");
+    classes.insert("byid-other");
+    EXPECT_TRUE(classes.contains(alpha));
+    EXPECT_TRUE(classes.contains("byid-alpha"));
+    EXPECT_FALSE(classes.contains(beta));
+    EXPECT_FALSE(classes.contains("byid-beta"));
+    EXPECT_TRUE(classes.contains("byid-other"));
+    EXPECT_EQ("byid-alpha, byid-other", classes.toText());
+
+    // A name inserted before being interned is still found.
+    ClientClassId other = ClientClassIndex::intern("byid-other");
+    EXPECT_TRUE(classes.contains(other));
+    EXPECT_TRUE(classes.contains("byid-other"));
+    ClientClassIndex::commit();
+    EXPECT_TRUE(classes.contains(other));
+    EXPECT_TRUE(classes.contains("byid-other"));
+
+    classes.clear();
+    EXPECT_TRUE(classes.empty());
+    EXPECT_FALSE(classes.contains(alpha));
+    EXPECT_FALSE(classes.contains(other));
+}
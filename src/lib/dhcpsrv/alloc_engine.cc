@@ -14,6 +14,7 @@
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/alloc_engine_log.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/host.h>
@@ -26,6 +27,7 @@
 #include <dhcpsrv/callout_handle_store.h>
 #include <stats/stats_mgr.h>
 #include <util/stopwatch.h>
+#include <util/trace_mgr.h>
 #include <hooks/server_hooks.h>
 #include <hooks/hooks_manager.h>
 
@@ -83,6 +85,24 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// @brief Fetches expired IPv4 leases.
+///
+/// @param leases Container receiving the expired leases.
+/// @param max_leases Maximum number of leases to fetch (0 for all).
+void
+getExpiredLeases(Lease4Collection& leases, const size_t max_leases) {
+    LeaseMgrFactory::instance().getExpiredLeases4(leases, max_leases);
+}
+
+/// @brief Fetches expired IPv6 leases.
+///
+/// @param leases Container receiving the expired leases.
+/// @param max_leases Maximum number of leases to fetch (0 for all).
+void
+getExpiredLeases(Lease6Collection& leases, const size_t max_leases) {
+    LeaseMgrFactory::instance().getExpiredLeases6(leases, max_leases);
+}
+
 }  // namespace
 
 namespace isc {
@@ -313,7 +333,8 @@ AllocEngine::RandomAllocator::pickAddressInternal(const SubnetPtr&,
 AllocEngine::AllocEngine(AllocType engine_type, uint64_t attempts,
                          bool ipv6)
     : attempts_(attempts), incomplete_v4_reclamations_(0),
-      incomplete_v6_reclamations_(0) {
+      incomplete_v6_reclamations_(0), reclaim_thread_(),
+      reclaim_cancelled_(new std::atomic<bool>(false)) {
 
     // Choose the basic (normal address) lease type
     Lease::Type basic_type = ipv6 ? Lease::TYPE_NA : Lease::TYPE_V4;
@@ -359,6 +380,10 @@ AllocEngine::AllocEngine(AllocType engine_type, uint64_t attempts,
     hook_index_lease6_select_ = Hooks.hook_index_lease6_select_;
 }
 
+AllocEngine::~AllocEngine() {
+    stopBackgroundReclamation();
+}
+
 AllocEngine::AllocatorPtr AllocEngine::getAllocator(Lease::Type type) {
     std::map<Lease::Type, AllocatorPtr>::const_iterator alloc = allocators_.find(type);
 
@@ -413,6 +438,65 @@ inAllowedPool(AllocEngine::ClientContext6& ctx, const Lease::Type& lease_type,
     return (false);
 }
 
+/// @brief Returns the subnets to be tried when allocating an unreserved
+/// lease, ordered by their utilization hints.
+///
+/// The subnets are returned in the order in which they would be returned
+/// by the @c getNextSubnet function, except that the subnets which are
+/// believed to have exhausted their pools are moved to the end of the
+/// list. They are not removed from the list because the utilization hint
+/// doesn't take into account expired leases which may be reused.
+///
+/// @param first_subnet Subnet from which the allocation should start.
+/// @param lease_type Type of the lease.
+/// @param client_classes Classes the client belongs to.
+///
+/// @tparam SubnetPtrType Type of the pointer to a subnet, i.e.
+/// @ref Subnet4Ptr or @ref Subnet6Ptr.
+///
+/// @return Ordered collection of subnets.
+template<typename SubnetPtrType>
+std::vector<SubnetPtrType>
+orderSubnetsByFreeLeasesHint(const SubnetPtrType& first_subnet,
+                             const Lease::Type& lease_type,
+                             const ClientClasses& client_classes) {
+    std::vector<SubnetPtrType> subnets;
+    std::vector<SubnetPtrType> exhausted_subnets;
+    for (SubnetPtrType subnet = first_subnet; subnet;
+         subnet = subnet->getNextSubnet(first_subnet, client_classes)) {
+        if (subnet->hasFreeLeasesHint(lease_type)) {
+            subnets.push_back(subnet);
+        } else {
+            exhausted_subnets.push_back(subnet);
+        }
+    }
+    subnets.insert(subnets.end(), exhausted_subnets.begin(),
+                   exhausted_subnets.end());
+    return (subnets);
+}
+
+/// @brief Adjusts the assigned leases hint of the subnet in the current
+/// configuration.
+///
+/// @param subnet_id Identifier of the subnet.
+/// @param lease_type Type of the lease.
+/// @param delta Value to be added to the number of assigned leases.
+void
+adjustAssignedLeasesHint(const SubnetID& subnet_id, const Lease::Type& lease_type,
+                         const int64_t delta) {
+    ConstSubnetPtr subnet;
+    if (lease_type == Lease::TYPE_V4) {
+        subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets4()->getBySubnetId(subnet_id);
+    } else {
+        subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets6()->getBySubnetId(subnet_id);
+    }
+    if (subnet) {
+        subnet->adjustAssignedLeasesHint(lease_type, delta);
+    }
+}
+
 }
 
 // ##########################################################################
@@ -611,28 +695,22 @@ void AllocEngine::findReservation(ClientContext6& ctx) {
         // to the class and host reservations are enabled.
         if (subnet->clientSupported(ctx.query_->getClasses()) &&
             (subnet->getHostReservationMode() != Network::HR_DISABLED)) {
-            // Iterate over configured identifiers in the order of preference
-            // and try to use each of them to search for the reservations.
-            for (auto id_pair : ctx.host_identifiers_) {
-                if (use_single_query) {
-                    if (host_map.count(subnet->getID()) > 0) {
-                        ctx.hosts_[subnet->getID()] = host_map[subnet->getID()];
-                    }
+            if (use_single_query) {
+                if (host_map.count(subnet->getID()) > 0) {
+                    ctx.hosts_[subnet->getID()] = host_map[subnet->getID()];
+                }
 
-                } else {
-                    // Attempt to find a host using a specified identifier.
-                    ConstHostPtr host = HostMgr::instance().get6(subnet->getID(),
-                                                                 id_pair.first,
-                                                                 &id_pair.second[0],
-                                                                 id_pair.second.size());
-                    // If we found matching host for this subnet.
-                    if (host) {
-                        ctx.hosts_[subnet->getID()] = host;
-                        break;
-                    }
+            } else {
+                // Search for the reservation using the configured identifiers
+                // in the order of preference. The host manager looks up all
+                // the identifiers at once in each host data source.
+                ConstHostPtr host = HostMgr::instance().get6(subnet->getID(),
+                                                             ctx.host_identifiers_);
+                // If we found matching host for this subnet.
+                if (host) {
+                    ctx.hosts_[subnet->getID()] = host;
                 }
             }
-
         }
 
         // We need to get to the next subnet if this is a shared network. If it
@@ -644,23 +722,14 @@ void AllocEngine::findReservation(ClientContext6& ctx) {
 
 ConstHostPtr
 AllocEngine::findGlobalReservation(ClientContext6& ctx) {
-    ConstHostPtr host;
-    BOOST_FOREACH(const IdentifierPair& id_pair, ctx.host_identifiers_) {
-        // Attempt to find a host using a specified identifier.
-        host = HostMgr::instance().get6(SUBNET_ID_GLOBAL, id_pair.first,
-                                        &id_pair.second[0], id_pair.second.size());
-
-        // If we found matching global host we're done.
-        if (host) {
-            break;
-        }
-    }
-
-    return (host);
+    // Attempt to find a host using the configured identifiers in the
+    // order of preference.
+    return (HostMgr::instance().get6(SUBNET_ID_GLOBAL, ctx.host_identifiers_));
 }
 
 Lease6Collection
 AllocEngine::allocateLeases6(ClientContext6& ctx) {
+    ScopedTrace trace("allocateLeases6");
 
     try {
         if (!ctx.subnet_) {
@@ -986,16 +1055,28 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
         // as the current subnet, but with the more recent "usage timestamp".
         // This timestamp is only updated for the allocations made with an
         // allocator (unreserved lease allocations), not the static
-        // allocations or requested addresses.
-        original_subnet = network->getPreferredSubnet(original_subnet, ctx.currentIA().type_);
+        // allocations or requested addresses. The preferred subnet is
+        // only used when its utilization hint indicates it still has
+        // free leases.
+        Subnet6Ptr preferred_subnet =
+            network->getPreferredSubnet(original_subnet, ctx.currentIA().type_);
+        if (preferred_subnet->hasFreeLeasesHint(ctx.currentIA().type_)) {
+            original_subnet = preferred_subnet;
+        }
     }
 
     ctx.subnet_ = subnet = original_subnet;
 
-    while (subnet) {
+    // Subnets which are believed to have free leases are tried first.
+    std::vector<Subnet6Ptr> subnets =
+        orderSubnetsByFreeLeasesHint(original_subnet, ctx.currentIA().type_,
+                                     ctx.query_->getClasses());
+
+    for (auto subnet_it = subnets.begin(); subnet_it != subnets.end();
+         ++subnet_it) {
+        subnet = *subnet_it;
 
         if (!subnet->clientSupported(ctx.query_->getClasses())) {
-            subnet = subnet->getNextSubnet(original_subnet);
             continue;
         }
 
@@ -1010,7 +1091,6 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                                     ctx.query_->getClasses());
         // Try next subnet if there is no chance to get something
         if (possible_attempts == 0) {
-            subnet = subnet->getNextSubnet(original_subnet);
             continue;
         }
         uint64_t max_attempts = (attempts_ > 0 ? attempts_  : possible_attempts);
@@ -1097,8 +1177,6 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                 }
             }
         }
-
-        subnet = subnet->getNextSubnet(original_subnet);
     }
 
     // Unable to allocate an address, return an empty lease.
@@ -1487,6 +1565,7 @@ AllocEngine::removeNonmatchingReservedLeases6(ClientContext6& ctx,
                                    ctx.currentIA().type_ == Lease::TYPE_NA ?
                                    "assigned-nas" : "assigned-pds"),
             static_cast<int64_t>(-1));
+        adjustAssignedLeasesHint(candidate->subnet_id_, candidate->type_, -1);
 
         // In principle, we could trigger a hook here, but we will do this
         // only if we get serious complaints from actual users. We want the
@@ -1534,6 +1613,7 @@ AllocEngine::removeNonmatchingReservedNoHostLeases6(ClientContext6& ctx,
                                    ctx.currentIA().type_ == Lease::TYPE_NA ?
                                    "assigned-nas" : "assigned-pds"),
             static_cast<int64_t>(-1));
+        adjustAssignedLeasesHint(candidate->subnet_id_, candidate->type_, -1);
 
         // Add this to the list of removed leases.
         ctx.currentIA().old_leases_.push_back(candidate);
@@ -1605,6 +1685,7 @@ AllocEngine::removeNonreservedLeases6(ClientContext6& ctx,
                                    ctx.currentIA().type_ == Lease::TYPE_NA ?
                                    "assigned-nas" : "assigned-pds"),
             static_cast<int64_t>(-1));
+        adjustAssignedLeasesHint((*lease)->subnet_id_, (*lease)->type_, -1);
 
         /// @todo: Probably trigger a hook here
 
@@ -1745,6 +1826,7 @@ AllocEngine::reuseExpiredLease(Lease6Ptr& expired, ClientContext6& ctx,
                                        ctx.currentIA().type_ == Lease::TYPE_NA ?
                                        "assigned-nas" : "assigned-pds"),
                 static_cast<int64_t>(1));
+            ctx.subnet_->adjustAssignedLeasesHint(ctx.currentIA().type_, 1);
         }
     }
 
@@ -1842,6 +1924,7 @@ Lease6Ptr AllocEngine::createLease6(ClientContext6& ctx,
                                            ctx.currentIA().type_ == Lease::TYPE_NA ?
                                            "assigned-nas" : "assigned-pds"),
                     static_cast<int64_t>(1));
+                ctx.subnet_->adjustAssignedLeasesHint(ctx.currentIA().type_, 1);
             }
 
             return (lease);
@@ -1869,6 +1952,8 @@ Lease6Ptr AllocEngine::createLease6(ClientContext6& ctx,
 
 Lease6Collection
 AllocEngine::renewLeases6(ClientContext6& ctx) {
+    ScopedTrace trace("renewLeases6");
+
     try {
         if (!ctx.subnet_) {
             isc_throw(InvalidOperation, "Subnet is required for allocation");
@@ -2007,6 +2092,7 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
         StatsMgr::instance().addValue(
             StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-nas"),
             static_cast<int64_t>(-1));
+        ctx.subnet_->adjustAssignedLeasesHint(Lease::TYPE_NA, -1);
 
         // Add it to the removed leases list.
         ctx.currentIA().old_leases_.push_back(lease);
@@ -2095,7 +2181,11 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
         /// DROP status does not make sense here.
     }
 
-    if (!skip) {
+    // A lease extended recently is returned as it is with its remaining
+    // lifetimes, so it doesn't need to be updated.
+    bool reuse = !skip && setLeaseReusable(lease, *old_data, ctx);
+
+    if (!skip && !reuse) {
         bool update_stats = false;
 
         // If the lease we're renewing has expired, we need to reclaim this
@@ -2120,9 +2210,10 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
                                        ctx.currentIA().type_ == Lease::TYPE_NA ?
                                        "assigned-nas" : "assigned-pds"),
                 static_cast<int64_t>(1));
+            ctx.subnet_->adjustAssignedLeasesHint(ctx.currentIA().type_, 1);
         }
 
-    } else {
+    } else if (skip) {
         // Copy back the original date to the lease. For MySQL it doesn't make
         // much sense, but for memfile, the Lease6Ptr points to the actual lease
         // in memfile, so the actual update is performed when we manipulate
@@ -2173,6 +2264,7 @@ AllocEngine::updateLeaseData(ClientContext6& ctx, const Lease6Collection& leases
                                            ctx.currentIA().type_ == Lease::TYPE_NA ?
                                            "assigned-nas" : "assigned-pds"),
                     static_cast<int64_t>(1));
+                adjustAssignedLeasesHint(lease->subnet_id_, lease->type_, 1);
             }
         }
 
@@ -2232,12 +2324,14 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         callout_handle = HooksManager::createCalloutHandle();
     }
 
+    // The reclaimed leases are written to the lease database in batches.
+    ReclaimBatch<Lease6Collection> batch;
     size_t leases_processed = 0;
     BOOST_FOREACH(Lease6Ptr lease, leases) {
 
         try {
             // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
+            reclaimExpiredLease(lease, remove_lease, callout_handle, &batch);
             ++leases_processed;
 
         } catch (const std::exception& ex) {
@@ -2246,6 +2340,13 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
                 .arg(ex.what());
         }
 
+        // Write the batch when it is full. The leases the lease database
+        // failed to reclaim are not counted as processed.
+        if (batch.size() >= RECLAIM_BATCH_SIZE) {
+            writeReclaimBatch(batch);
+            leases_processed -= finishReclaimBatch(batch);
+        }
+
         // Check if we have hit the timeout for running reclamation routine and
         // return if we have. We're checking it here, because we always want to
         // allow reclaiming at least one lease.
@@ -2266,6 +2367,12 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         }
     }
 
+    // Write the last batch.
+    if (batch.size() > 0) {
+        writeReclaimBatch(batch);
+        leases_processed -= finishReclaimBatch(batch);
+    }
+
     // Stop measuring the time.
     stopwatch.stop();
 
@@ -2370,12 +2477,14 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
         callout_handle = HooksManager::createCalloutHandle();
     }
 
+    // The reclaimed leases are written to the lease database in batches.
+    ReclaimBatch<Lease4Collection> batch;
     size_t leases_processed = 0;
     BOOST_FOREACH(Lease4Ptr lease, leases) {
 
         try {
             // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
+            reclaimExpiredLease(lease, remove_lease, callout_handle, &batch);
             ++leases_processed;
 
         } catch (const std::exception& ex) {
@@ -2384,6 +2493,13 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
                 .arg(ex.what());
         }
 
+        // Write the batch when it is full. The leases the lease database
+        // failed to reclaim are not counted as processed.
+        if (batch.size() >= RECLAIM_BATCH_SIZE) {
+            writeReclaimBatch(batch);
+            leases_processed -= finishReclaimBatch(batch);
+        }
+
         // Check if we have hit the timeout for running reclamation routine and
         // return if we have. We're checking it here, because we always want to
         // allow reclaiming at least one lease.
@@ -2404,6 +2520,12 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
         }
     }
 
+    // Write the last batch.
+    if (batch.size() > 0) {
+        writeReclaimBatch(batch);
+        leases_processed -= finishReclaimBatch(batch);
+    }
+
     // Stop measuring the time.
     stopwatch.stop();
 
@@ -2436,12 +2558,13 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
     }
 }
 
-template<typename LeasePtrType>
+template<typename LeasePtrType, typename LeaseCollectionType>
 void
 AllocEngine::reclaimExpiredLease(const LeasePtrType& lease, const bool remove_lease,
-                                 const CalloutHandlePtr& callout_handle) {
+                                 const CalloutHandlePtr& callout_handle,
+                                 ReclaimBatch<LeaseCollectionType>* batch) {
     reclaimExpiredLease(lease, remove_lease ? DB_RECLAIM_REMOVE : DB_RECLAIM_UPDATE,
-                        callout_handle);
+                        callout_handle, batch);
 }
 
 template<typename LeasePtrType>
@@ -2456,10 +2579,36 @@ AllocEngine::reclaimExpiredLease(const LeasePtrType& lease,
     }
 }
 
+namespace {
+
+/// @brief Returns a copy of a lease which is not affected by the changes
+/// made to the lease.
+///
+/// @param lease Pointer to the lease.
+/// @tparam LeaseType @c Lease4 or @c Lease6.
+/// @return Pointer to the copy.
+template<typename LeaseType>
+boost::shared_ptr<LeaseType>
+copyLease(const boost::shared_ptr<LeaseType>& lease) {
+    boost::shared_ptr<LeaseType> copy(new LeaseType(*lease));
+    copy->old_cltt_ = lease->old_cltt_;
+    copy->old_valid_lft_ = lease->old_valid_lft_;
+    if (lease->hwaddr_) {
+        copy->hwaddr_.reset(new HWAddr(*lease->hwaddr_));
+    }
+    if (lease->getContext()) {
+        copy->setContext(isc::data::copy(lease->getContext()));
+    }
+    return (copy);
+}
+
+}
+
 void
 AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
-                                 const CalloutHandlePtr& callout_handle) {
+                                 const CalloutHandlePtr& callout_handle,
+                                 ReclaimBatch<Lease6Collection>* batch) {
 
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
               ALLOC_ENGINE_V6_LEASE_RECLAIM)
@@ -2472,7 +2621,13 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
     // it reclaims the lease itself. In this case the reclamation routine
     // will not update DNS nor update the database.
     bool skipped = false;
+    Lease6Ptr original;
     if (callout_handle) {
+        // The changes made by the callouts are detected on the copy when
+        // the lease is written in a batch.
+        if (batch) {
+            original = copyLease(lease);
+        }
 
         // Use the RAII wrapper to make sure that the callout handle state is
         // reset when this object goes out of scope. All hook points must do
@@ -2516,6 +2671,13 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
         }
 
         if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+            if (batch) {
+                // The lease is written along with the other leases of the
+                // batch and the statistics are updated once it is written.
+                addToReclaimBatch(lease, original, remove_lease, *batch);
+                return;
+            }
+
             // Reclaim the lease - depending on the configuration, set the
             // expired-reclaimed state or simply remove it.
             LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
@@ -2525,8 +2687,11 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
         }
     }
 
-    // Update statistics.
+    updateReclaimedLeaseStats(lease);
+}
 
+void
+AllocEngine::updateReclaimedLeaseStats(const Lease6Ptr& lease) {
     // Decrease number of assigned leases.
     if (lease->type_ == Lease::TYPE_NA) {
         // IA_NA
@@ -2534,6 +2699,7 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
                                                              lease->subnet_id_,
                                                              "assigned-nas"),
                                       int64_t(-1));
+        adjustAssignedLeasesHint(lease->subnet_id_, lease->type_, -1);
 
     } else if (lease->type_ == Lease::TYPE_PD) {
         // IA_PD
@@ -2541,6 +2707,7 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
                                                              lease->subnet_id_,
                                                              "assigned-pds"),
                                       int64_t(-1));
+        adjustAssignedLeasesHint(lease->subnet_id_, lease->type_, -1);
 
     }
 
@@ -2557,7 +2724,8 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
 void
 AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
-                                 const CalloutHandlePtr& callout_handle) {
+                                 const CalloutHandlePtr& callout_handle,
+                                 ReclaimBatch<Lease4Collection>* batch) {
 
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
               ALLOC_ENGINE_V4_LEASE_RECLAIM)
@@ -2569,7 +2737,13 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
     // it reclaims the lease itself. In this case the reclamation routine
     // will not update DNS nor update the database.
     bool skipped = false;
+    Lease4Ptr original;
     if (callout_handle) {
+        // The changes made by the callouts are detected on the copy when
+        // the lease is written in a batch.
+        if (batch) {
+            original = copyLease(lease);
+        }
 
         // Use the RAII wrapper to make sure that the callout handle state is
         // reset when this object goes out of scope. All hook points must do
@@ -2612,6 +2786,13 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
         }
 
         if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+            if (batch) {
+                // The lease is written along with the other leases of the
+                // batch and the statistics are updated once it is written.
+                addToReclaimBatch(lease, original, remove_lease, *batch);
+                return;
+            }
+
             // Reclaim the lease - depending on the configuration, set the
             // expired-reclaimed state or simply remove it.
             LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
@@ -2621,13 +2802,17 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
         }
     }
 
-    // Update statistics.
+    updateReclaimedLeaseStats(lease);
+}
 
+void
+AllocEngine::updateReclaimedLeaseStats(const Lease4Ptr& lease) {
     // Decrease number of assigned addresses.
     StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
                                                          lease->subnet_id_,
                                                          "assigned-addresses"),
                                   int64_t(-1));
+    adjustAssignedLeasesHint(lease->subnet_id_, Lease::TYPE_V4, -1);
 
     // Increase total number of reclaimed leases.
     StatsMgr::instance().addValue("reclaimed-leases", int64_t(1));
@@ -2801,6 +2986,521 @@ void AllocEngine::reclaimLeaseInDatabase(const LeasePtrType& lease,
         .arg(lease->addr_.toText());
 }
 
+const size_t AllocEngine::RECLAIM_BATCH_SIZE;
+
+template<typename LeasePtrType, typename LeaseCollectionType>
+void
+AllocEngine::addToReclaimBatch(const LeasePtrType& lease,
+                               const LeasePtrType& original,
+                               const bool remove_lease,
+                               ReclaimBatch<LeaseCollectionType>& batch) {
+    if (remove_lease) {
+        batch.deleted_.push_back(lease);
+        return;
+    }
+
+    // Clear FQDN information as we have already sent the
+    // name change request to remove the DNS record.
+    lease->hostname_.clear();
+    lease->fqdn_fwd_ = false;
+    lease->fqdn_rev_ = false;
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+
+    // The callouts may have changed other fields.
+    if (original) {
+        original->hostname_.clear();
+        original->fqdn_fwd_ = false;
+        original->fqdn_rev_ = false;
+        original->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        if (*lease != *original) {
+            batch.changed_.push_back(lease);
+            return;
+        }
+    }
+    batch.updated_.push_back(lease);
+}
+
+void
+AllocEngine::writeReclaimBatch(ReclaimBatch<Lease4Collection>& batch) {
+    try {
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+        batch.skipped_ = lease_mgr.reclaimLeases4(batch.updated_,
+                                                  batch.deleted_);
+        for (auto lease : batch.changed_) {
+            try {
+                lease_mgr.updateLease4(lease);
+            } catch (const NoSuchLease&) {
+                batch.skipped_.push_back(lease);
+            }
+        }
+    } catch (const std::exception& ex) {
+        batch.error_ = ex.what();
+    }
+}
+
+void
+AllocEngine::writeReclaimBatch(ReclaimBatch<Lease6Collection>& batch) {
+    try {
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+        batch.skipped_ = lease_mgr.reclaimLeases6(batch.updated_,
+                                                  batch.deleted_);
+        for (auto lease : batch.changed_) {
+            try {
+                lease_mgr.updateLease6(lease);
+            } catch (const NoSuchLease&) {
+                batch.skipped_.push_back(lease);
+            }
+        }
+    } catch (const std::exception& ex) {
+        batch.error_ = ex.what();
+    }
+}
+
+size_t
+AllocEngine::finishReclaimBatch(ReclaimBatch<Lease4Collection>& batch) {
+    size_t failed = 0;
+    if (!batch.error_.empty()) {
+        LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_RECLAIM_BATCH_FAILED)
+            .arg(batch.size())
+            .arg(batch.error_);
+        failed = batch.size();
+        batch.clear();
+        return (failed);
+    }
+
+    std::set<Lease4Ptr> skipped(batch.skipped_.begin(), batch.skipped_.end());
+    const Lease4Collection* written[] = { &batch.updated_, &batch.deleted_,
+                                          &batch.changed_ };
+    for (auto leases : written) {
+        for (auto lease : *leases) {
+            if (skipped.count(lease) > 0) {
+                LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                    .arg(lease->addr_.toText())
+                    .arg("the lease was renewed or removed in the meantime");
+                ++failed;
+                continue;
+            }
+
+            // Lease has been reclaimed.
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_LEASE_RECLAIMED)
+                .arg(lease->addr_.toText());
+            updateReclaimedLeaseStats(lease);
+        }
+    }
+    batch.clear();
+    return (failed);
+}
+
+size_t
+AllocEngine::finishReclaimBatch(ReclaimBatch<Lease6Collection>& batch) {
+    size_t failed = 0;
+    if (!batch.error_.empty()) {
+        LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_RECLAIM_BATCH_FAILED)
+            .arg(batch.size())
+            .arg(batch.error_);
+        failed = batch.size();
+        batch.clear();
+        return (failed);
+    }
+
+    std::set<Lease6Ptr> skipped(batch.skipped_.begin(), batch.skipped_.end());
+    const Lease6Collection* written[] = { &batch.updated_, &batch.deleted_,
+                                          &batch.changed_ };
+    for (auto leases : written) {
+        for (auto lease : *leases) {
+            if (skipped.count(lease) > 0) {
+                LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED)
+                    .arg(lease->addr_.toText())
+                    .arg("the lease was renewed or removed in the meantime");
+                ++failed;
+                continue;
+            }
+
+            // Lease has been reclaimed.
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_LEASE_RECLAIMED)
+                .arg(lease->addr_.toText());
+            updateReclaimedLeaseStats(lease);
+        }
+    }
+    batch.clear();
+    return (failed);
+}
+
+void
+AllocEngine::startBackgroundReclamation() {
+    if (reclaim_thread_.size() == 0) {
+        reclaim_thread_.start(1);
+    }
+}
+
+void
+AllocEngine::stopBackgroundReclamation() {
+    // The handlers of the pass in progress which are still pending in the
+    // IO service will do nothing. The next passes use a new flag.
+    reclaim_cancelled_->store(true);
+    reclaim_cancelled_.reset(new std::atomic<bool>(false));
+
+    // Wait for the operation in progress and drop the queued ones.
+    reclaim_thread_.reset();
+
+    // The batches handed over to the thread are finished here: the leases
+    // were already reclaimed by the callouts so they are written if the
+    // thread did not, and the statistics are updated.
+    std::map<const void*, std::function<void()> > in_flight;
+    in_flight.swap(reclaim_in_flight_);
+    for (auto finisher : in_flight) {
+        try {
+            finisher.second();
+        } catch (...) {
+            // Nothing more can be done when the engine is destroyed.
+        }
+    }
+}
+
+template<typename LeaseCollectionType>
+void
+AllocEngine::submitReclaimBatch(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass) {
+    pass->written_ = false;
+    reclaim_in_flight_[pass.get()] = [this, pass]() {
+        finishCancelledReclaimBatch(pass);
+    };
+    reclaim_thread_.add(boost::make_shared<std::function<void()> >([this, pass]() {
+        writeReclaimBatch(pass);
+    }));
+}
+
+template<typename LeaseCollectionType>
+void
+AllocEngine::finishCancelledReclaimBatch(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass) {
+    // The reclamation thread is stopped so the pass is not shared anymore.
+    if (!pass->written_) {
+        writeReclaimBatch(pass->batch_);
+    }
+    finishReclaimBatch(pass->batch_);
+}
+
+template<typename LeaseCollectionType>
+void
+AllocEngine::fetchExpiredLeases(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass) {
+    try {
+        // The value of 0 has a special meaning - reclaim all. Otherwise
+        // we obtain one lease more to see if there will be still leases
+        // left after this pass.
+        getExpiredLeases(pass->leases_,
+                         pass->max_leases_ > 0 ? pass->max_leases_ + 1 : 0);
+        if ((pass->max_leases_ > 0) && (pass->leases_.size() > pass->max_leases_)) {
+            pass->leases_.pop_back();
+            pass->incomplete_ = true;
+        }
+
+    } catch (const std::exception& ex) {
+        pass->error_ = ex.what();
+    }
+
+    // The engine may be gone when the handler is invoked.
+    pass->io_service_->post([this, pass]() {
+        if (!pass->cancelled_->load()) {
+            reclaimStep(pass);
+        }
+    });
+}
+
+template<typename LeaseCollectionType>
+void
+AllocEngine::writeReclaimBatch(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass) {
+    writeReclaimBatch(pass->batch_);
+    pass->written_ = true;
+    pass->io_service_->post([this, pass]() {
+        if (!pass->cancelled_->load()) {
+            reclaimStep(pass);
+        }
+    });
+}
+
+void
+AllocEngine::reclaimExpiredLeases4InBackground(const size_t max_leases,
+                                               const uint16_t timeout,
+                                               const bool remove_lease,
+                                               const uint16_t max_unwarned_cycles,
+                                               const IOServicePtr& io_service,
+                                               const std::function<void()>& callback) {
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V4_LEASES_RECLAMATION_START)
+        .arg(max_leases)
+        .arg(timeout);
+
+    boost::shared_ptr<ReclaimPass<Lease4Collection> >
+        pass(new ReclaimPass<Lease4Collection>());
+    pass->max_leases_ = max_leases;
+    pass->timeout_ = timeout;
+    pass->remove_lease_ = remove_lease;
+    pass->max_unwarned_cycles_ = max_unwarned_cycles;
+    pass->io_service_ = io_service;
+    pass->callback_ = callback;
+    pass->cancelled_ = reclaim_cancelled_;
+    pass->next_ = 0;
+    pass->processed_ = 0;
+    pass->incomplete_ = false;
+    pass->written_ = false;
+
+    startBackgroundReclamation();
+    reclaim_thread_.add(boost::make_shared<std::function<void()> >([this, pass]() {
+        fetchExpiredLeases(pass);
+    }));
+}
+
+void
+AllocEngine::reclaimExpiredLeases6InBackground(const size_t max_leases,
+                                               const uint16_t timeout,
+                                               const bool remove_lease,
+                                               const uint16_t max_unwarned_cycles,
+                                               const IOServicePtr& io_service,
+                                               const std::function<void()>& callback) {
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V6_LEASES_RECLAMATION_START)
+        .arg(max_leases)
+        .arg(timeout);
+
+    boost::shared_ptr<ReclaimPass<Lease6Collection> >
+        pass(new ReclaimPass<Lease6Collection>());
+    pass->max_leases_ = max_leases;
+    pass->timeout_ = timeout;
+    pass->remove_lease_ = remove_lease;
+    pass->max_unwarned_cycles_ = max_unwarned_cycles;
+    pass->io_service_ = io_service;
+    pass->callback_ = callback;
+    pass->cancelled_ = reclaim_cancelled_;
+    pass->next_ = 0;
+    pass->processed_ = 0;
+    pass->incomplete_ = false;
+    pass->written_ = false;
+
+    startBackgroundReclamation();
+    reclaim_thread_.add(boost::make_shared<std::function<void()> >([this, pass]() {
+        fetchExpiredLeases(pass);
+    }));
+}
+
+void
+AllocEngine::reclaimStep(const boost::shared_ptr<ReclaimPass<Lease4Collection> >& pass) {
+    if (!pass->error_.empty()) {
+        LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASES_RECLAMATION_FAILED)
+            .arg(pass->error_);
+        if (pass->callback_) {
+            pass->callback_();
+        }
+        return;
+    }
+
+    // Account the batch written by the reclamation thread.
+    reclaim_in_flight_.erase(pass.get());
+    if (pass->batch_.size() > 0) {
+        pass->processed_ -= finishReclaimBatch(pass->batch_);
+    }
+
+    bool timed_out = false;
+    if (pass->next_ < pass->leases_.size()) {
+        // Check if we have hit the timeout for running reclamation routine.
+        // We're checking it here, because we always want to allow reclaiming
+        // at least one batch.
+        if ((pass->timeout_ > 0) && (pass->next_ > 0) &&
+            (pass->stopwatch_.getTotalMilliseconds() >= pass->timeout_)) {
+            pass->incomplete_ = true;
+            timed_out = true;
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
+                .arg(pass->timeout_);
+
+        } else {
+            // Do not initialize the callout handle until we know if there are
+            // any lease4_expire callouts installed.
+            CalloutHandlePtr callout_handle;
+            if (HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease4_expire_)) {
+                callout_handle = HooksManager::createCalloutHandle();
+            }
+
+            // Reclaim the next batch of leases and hand it over to the
+            // reclamation thread.
+            while ((pass->next_ < pass->leases_.size()) &&
+                   (pass->batch_.size() < RECLAIM_BATCH_SIZE)) {
+                Lease4Ptr lease = pass->leases_[pass->next_++];
+                try {
+                    reclaimExpiredLease(lease, pass->remove_lease_,
+                                        callout_handle, &pass->batch_);
+                    ++pass->processed_;
+
+                } catch (const std::exception& ex) {
+                    LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                        .arg(lease->addr_.toText())
+                        .arg(ex.what());
+                }
+            }
+
+            if (pass->batch_.size() > 0) {
+                submitReclaimBatch(pass);
+                return;
+            }
+        }
+    }
+
+    if (!timed_out && (pass->next_ < pass->leases_.size())) {
+        // All leases of the batch were reclaimed by the callouts: continue
+        // with the next batch after the pending handlers.
+        pass->io_service_->post([this, pass]() {
+            if (!pass->cancelled_->load()) {
+                reclaimStep(pass);
+            }
+        });
+        return;
+    }
+
+    // Stop measuring the time.
+    pass->stopwatch_.stop();
+
+    // Mark completion of the lease reclamation routine and present some stats.
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V4_LEASES_RECLAMATION_COMPLETE)
+        .arg(pass->processed_)
+        .arg(pass->stopwatch_.logFormatTotalDuration());
+
+    // Check if this was an incomplete reclamation and increase the number of
+    // consecutive incomplete reclamations.
+    if (pass->incomplete_) {
+        ++incomplete_v4_reclamations_;
+        // If the number of incomplete reclamations is beyond the threshold, we
+        // need to issue a warning.
+        if ((pass->max_unwarned_cycles_ > 0) &&
+            (incomplete_v4_reclamations_ > pass->max_unwarned_cycles_)) {
+            LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V4_LEASES_RECLAMATION_SLOW)
+                .arg(pass->max_unwarned_cycles_);
+            // We issued a warning, so let's now reset the counter.
+            incomplete_v4_reclamations_ = 0;
+        }
+
+    } else {
+        // This was a complete reclamation, so let's reset the counter.
+        incomplete_v4_reclamations_ = 0;
+
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_V4_NO_MORE_EXPIRED_LEASES);
+    }
+
+    if (pass->callback_) {
+        pass->callback_();
+    }
+}
+
+void
+AllocEngine::reclaimStep(const boost::shared_ptr<ReclaimPass<Lease6Collection> >& pass) {
+    if (!pass->error_.empty()) {
+        LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_LEASES_RECLAMATION_FAILED)
+            .arg(pass->error_);
+        if (pass->callback_) {
+            pass->callback_();
+        }
+        return;
+    }
+
+    // Account the batch written by the reclamation thread.
+    reclaim_in_flight_.erase(pass.get());
+    if (pass->batch_.size() > 0) {
+        pass->processed_ -= finishReclaimBatch(pass->batch_);
+    }
+
+    bool timed_out = false;
+    if (pass->next_ < pass->leases_.size()) {
+        // Check if we have hit the timeout for running reclamation routine.
+        // We're checking it here, because we always want to allow reclaiming
+        // at least one batch.
+        if ((pass->timeout_ > 0) && (pass->next_ > 0) &&
+            (pass->stopwatch_.getTotalMilliseconds() >= pass->timeout_)) {
+            pass->incomplete_ = true;
+            timed_out = true;
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT)
+                .arg(pass->timeout_);
+
+        } else {
+            // Do not initialize the callout handle until we know if there are
+            // any lease6_expire callouts installed.
+            CalloutHandlePtr callout_handle;
+            if (HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease6_expire_)) {
+                callout_handle = HooksManager::createCalloutHandle();
+            }
+
+            // Reclaim the next batch of leases and hand it over to the
+            // reclamation thread.
+            while ((pass->next_ < pass->leases_.size()) &&
+                   (pass->batch_.size() < RECLAIM_BATCH_SIZE)) {
+                Lease6Ptr lease = pass->leases_[pass->next_++];
+                try {
+                    reclaimExpiredLease(lease, pass->remove_lease_,
+                                        callout_handle, &pass->batch_);
+                    ++pass->processed_;
+
+                } catch (const std::exception& ex) {
+                    LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED)
+                        .arg(lease->addr_.toText())
+                        .arg(ex.what());
+                }
+            }
+
+            if (pass->batch_.size() > 0) {
+                submitReclaimBatch(pass);
+                return;
+            }
+        }
+    }
+
+    if (!timed_out && (pass->next_ < pass->leases_.size())) {
+        // All leases of the batch were reclaimed by the callouts: continue
+        // with the next batch after the pending handlers.
+        pass->io_service_->post([this, pass]() {
+            if (!pass->cancelled_->load()) {
+                reclaimStep(pass);
+            }
+        });
+        return;
+    }
+
+    // Stop measuring the time.
+    pass->stopwatch_.stop();
+
+    // Mark completion of the lease reclamation routine and present some stats.
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V6_LEASES_RECLAMATION_COMPLETE)
+        .arg(pass->processed_)
+        .arg(pass->stopwatch_.logFormatTotalDuration());
+
+    // Check if this was an incomplete reclamation and increase the number of
+    // consecutive incomplete reclamations.
+    if (pass->incomplete_) {
+        ++incomplete_v6_reclamations_;
+        // If the number of incomplete reclamations is beyond the threshold, we
+        // need to issue a warning.
+        if ((pass->max_unwarned_cycles_ > 0) &&
+            (incomplete_v6_reclamations_ > pass->max_unwarned_cycles_)) {
+            LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V6_LEASES_RECLAMATION_SLOW)
+                .arg(pass->max_unwarned_cycles_);
+            // We issued a warning, so let's now reset the counter.
+            incomplete_v6_reclamations_ = 0;
+        }
+
+    } else {
+        // This was a complete reclamation, so let's reset the counter.
+        incomplete_v6_reclamations_ = 0;
+
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_V6_NO_MORE_EXPIRED_LEASES);
+    }
+
+    if (pass->callback_) {
+        pass->callback_();
+    }
+}
+
 }  // namespace dhcp
 }  // namespace isc
 
@@ -3088,6 +3788,8 @@ AllocEngine::ClientContext4::getDdnsParams() {
 
 Lease4Ptr
 AllocEngine::allocateLease4(ClientContext4& ctx) {
+    ScopedTrace trace("allocateLease4");
+
     // The NULL pointer indicates that the old lease didn't exist. It may
     // be later set to non NULL value if existing lease is found in the
     // database.
@@ -3192,26 +3894,20 @@ AllocEngine::findReservation(ClientContext4& ctx) {
         // to the class.
         if (subnet->clientSupported(ctx.query_->getClasses()) &&
             (subnet->getHostReservationMode() != Network::HR_DISABLED)) {
-            // Iterate over configured identifiers in the order of preference
-            // and try to use each of them to search for the reservations.
-            BOOST_FOREACH(const IdentifierPair& id_pair, ctx.host_identifiers_) {
-                if (use_single_query) {
-                    if (host_map.count(subnet->getID()) > 0) {
-                        ctx.hosts_[subnet->getID()] = host_map[subnet->getID()];
-                        break;
-                    }
+            if (use_single_query) {
+                if (host_map.count(subnet->getID()) > 0) {
+                    ctx.hosts_[subnet->getID()] = host_map[subnet->getID()];
+                }
 
-                } else {
-                    // Attempt to find a host using a specified identifier.
-                    ConstHostPtr host = HostMgr::instance().get4(subnet->getID(),
-                                                                 id_pair.first,
-                                                                 &id_pair.second[0],
-                                                                 id_pair.second.size());
-                    // If we found matching host for this subnet.
-                    if (host) {
-                        ctx.hosts_[subnet->getID()] = host;
-                        break;
-                    }
+            } else {
+                // Search for the reservation using the configured identifiers
+                // in the order of preference. The host manager looks up all
+                // the identifiers at once in each host data source.
+                ConstHostPtr host = HostMgr::instance().get4(subnet->getID(),
+                                                             ctx.host_identifiers_);
+                // If we found matching host for this subnet.
+                if (host) {
+                    ctx.hosts_[subnet->getID()] = host;
                 }
             }
         }
@@ -3225,19 +3921,9 @@ AllocEngine::findReservation(ClientContext4& ctx) {
 
 ConstHostPtr
 AllocEngine::findGlobalReservation(ClientContext4& ctx) {
-    ConstHostPtr host;
-    BOOST_FOREACH(const IdentifierPair& id_pair, ctx.host_identifiers_) {
-        // Attempt to find a host using a specified identifier.
-        host = HostMgr::instance().get4(SUBNET_ID_GLOBAL, id_pair.first,
-                                        &id_pair.second[0], id_pair.second.size());
-
-        // If we found matching global host we're done.
-        if (host) {
-            break;
-        }
-    }
-
-    return (host);
+    // Attempt to find a host using the configured identifiers in the
+    // order of preference.
+    return (HostMgr::instance().get4(SUBNET_ID_GLOBAL, ctx.host_identifiers_));
 }
 
 Lease4Ptr
@@ -3394,8 +4080,13 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
 
     if (!ctx.requested_address_.isV4Zero()) {
         // There is a specific address to be allocated. Let's find out if
-        // the address is in use.
-        Lease4Ptr existing = LeaseMgrFactory::instance().getLease4(ctx.requested_address_);
+        // the address is in use. When the lease manager allocates or
+        // renews leases in a single call this check is done by the
+        // allocation itself, saving a database round trip.
+        Lease4Ptr existing;
+        if (!LeaseMgrFactory::instance().isAllocateOrRenewEnabled()) {
+            existing = LeaseMgrFactory::instance().getLease4(ctx.requested_address_);
+        }
         // If the address is in use (allocated and not expired), we check
         // if the address is in use by our client or another client.
         // If it is in use by another client, the address can't be
@@ -3526,6 +4217,7 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
                 StatsMgr::generateName("subnet", client_lease->subnet_id_,
                                        "assigned-addresses"),
                 static_cast<int64_t>(-1));
+            adjustAssignedLeasesHint(client_lease->subnet_id_, Lease::TYPE_V4, -1);
         }
     }
 
@@ -3535,8 +4227,8 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
 }
 
 Lease4Ptr
-AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
-                          CalloutHandle::CalloutNextStep& callout_status) {
+AllocEngine::makeLease4(const ClientContext4& ctx, const IOAddress& addr,
+                        CalloutHandle::CalloutNextStep& callout_status) {
     if (!ctx.hwaddr_) {
         isc_throw(BadValue, "Can't create a lease with NULL HW address");
     }
@@ -3625,6 +4317,17 @@ AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
         ctx.callout_handle_->getArgument("lease4", lease);
     }
 
+    return (lease);
+}
+
+Lease4Ptr
+AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
+                          CalloutHandle::CalloutNextStep& callout_status) {
+    Lease4Ptr lease = makeLease4(ctx, addr, callout_status);
+    if (!lease) {
+        return (Lease4Ptr());
+    }
+
     if (!ctx.fake_allocation_) {
         // That is a real (REQUEST) allocation
         bool status = LeaseMgrFactory::instance().addLease(lease);
@@ -3634,6 +4337,7 @@ AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
             StatsMgr::instance().addValue(
                 StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
                 static_cast<int64_t>(1));
+            ctx.subnet_->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
 
             return (lease);
         } else {
@@ -3735,7 +4439,11 @@ AllocEngine::renewLease4(const Lease4Ptr& lease,
         /// DROP status does not make sense here.
     }
 
-    if (!ctx.fake_allocation_ && !skip) {
+    // A lease renewed recently is returned as it is with its remaining
+    // lifetime, so it doesn't need to be updated.
+    bool reuse = !skip && setLeaseReusable(lease, *old_values, ctx);
+
+    if (!ctx.fake_allocation_ && !skip && !reuse) {
         // for REQUEST we do update the lease
         LeaseMgrFactory::instance().updateLease4(lease);
 
@@ -3744,6 +4452,7 @@ AllocEngine::renewLease4(const Lease4Ptr& lease,
             StatsMgr::instance().addValue(
                 StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
                 static_cast<int64_t>(1));
+            ctx.subnet_->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
         }
     }
     if (skip) {
@@ -3842,6 +4551,7 @@ AllocEngine::reuseExpiredLease4(Lease4Ptr& expired,
         StatsMgr::instance().addValue(
                 StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
                 static_cast<int64_t>(1));
+        ctx.subnet_->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
     }
 
     // We do nothing for SOLICIT. We'll just update database when
@@ -3852,11 +4562,70 @@ AllocEngine::reuseExpiredLease4(Lease4Ptr& expired,
     return (expired);
 }
 
+Lease4Ptr
+AllocEngine::allocateOrRenewLease4(const IOAddress& candidate, ClientContext4& ctx,
+                                   CalloutHandle::CalloutNextStep& callout_status) {
+    Lease4Ptr lease = makeLease4(ctx, candidate, callout_status);
+    if (!lease) {
+        return (Lease4Ptr());
+    }
+
+    // The lookup, the ownership check and the insert or update are done
+    // by the lease manager at once, i.e. in a single round trip for the
+    // SQL backends.
+    Lease4Ptr old_lease;
+    if (!LeaseMgrFactory::instance().allocateOrRenewLease4(lease, old_lease)) {
+        // The address is in use by another client.
+        ctx.conflicting_lease_ = old_lease;
+        return (Lease4Ptr());
+    }
+
+    if (!old_lease) {
+        // This is a new lease.
+        StatsMgr::instance().addValue(
+            StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
+            static_cast<int64_t>(1));
+        ctx.subnet_->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
+        return (lease);
+    }
+
+    ctx.old_lease_ = old_lease;
+    if (old_lease->expired()) {
+        // The expired lease has been overwritten in the database so it
+        // is only reclaimed, i.e. the hooks are called, the DNS entries
+        // removed and the statistics updated.
+        reclaimExpiredLease(old_lease, ctx.callout_handle_);
+
+    } else if (old_lease->subnet_id_ == lease->subnet_id_) {
+        // The client renewed its lease in the same subnet.
+        return (lease);
+
+    } else {
+        // The client renewed its lease in another subnet.
+        StatsMgr::instance().addValue(
+            StatsMgr::generateName("subnet", old_lease->subnet_id_, "assigned-addresses"),
+            static_cast<int64_t>(-1));
+        adjustAssignedLeasesHint(old_lease->subnet_id_, Lease::TYPE_V4, -1);
+    }
+
+    StatsMgr::instance().addValue(
+        StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
+        static_cast<int64_t>(1));
+    ctx.subnet_->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
+
+    return (lease);
+}
+
 Lease4Ptr
 AllocEngine::allocateOrReuseLease4(const IOAddress& candidate, ClientContext4& ctx,
                                    CalloutHandle::CalloutNextStep& callout_status) {
     ctx.conflicting_lease_.reset();
 
+    if (!ctx.fake_allocation_ &&
+        LeaseMgrFactory::instance().isAllocateOrRenewEnabled()) {
+        return (allocateOrRenewLease4(candidate, ctx, callout_status));
+    }
+
     Lease4Ptr exist_lease = LeaseMgrFactory::instance().getLease4(candidate);
     if (exist_lease) {
         if (exist_lease->expired()) {
@@ -3898,14 +4667,26 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
         // as the current subnet, but with the more recent "usage timestamp".
         // This timestamp is only updated for the allocations made with an
         // allocator (unreserved lease allocations), not the static
-        // allocations or requested addresses.
-        ctx.subnet_ = subnet = network->getPreferredSubnet(ctx.subnet_);
+        // allocations or requested addresses. The preferred subnet is
+        // only used when its utilization hint indicates it still has
+        // free addresses.
+        Subnet4Ptr preferred_subnet = network->getPreferredSubnet(ctx.subnet_);
+        if (preferred_subnet->hasFreeLeasesHint(Lease::TYPE_V4)) {
+            ctx.subnet_ = subnet = preferred_subnet;
+        }
     }
 
     Subnet4Ptr original_subnet = subnet;
 
+    // Subnets which are believed to have free addresses are tried first.
+    std::vector<Subnet4Ptr> subnets =
+        orderSubnetsByFreeLeasesHint(original_subnet, Lease::TYPE_V4,
+                                     ctx.query_->getClasses());
+
     uint64_t total_attempts = 0;
-    while (subnet) {
+    for (auto subnet_it = subnets.begin(); subnet_it != subnets.end();
+         ++subnet_it) {
+        ctx.subnet_ = subnet = *subnet_it;
 
         ClientIdPtr client_id;
         if (subnet->getMatchClientId()) {
@@ -3949,12 +4730,8 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
         }
 
         // This pointer may be set to NULL if hooks set SKIP status.
-        if (subnet) {
-            subnet = subnet->getNextSubnet(original_subnet, ctx.query_->getClasses());
-
-            if (subnet) {
-                ctx.subnet_ = subnet;
-            }
+        if (!subnet) {
+            break;
         }
     }
 
@@ -4007,5 +4784,119 @@ AllocEngine::conditionalExtendLifetime(Lease& lease) const {
     return (true);
 }
 
+namespace {
+
+/// @brief Returns the age of a lease if it may be reused.
+///
+/// @param subnet Subnet holding the lease reuse parameters.
+/// @param old_lease The lease before the renewal.
+/// @param now Time of the renewal.
+/// @param [out] age Age of the lease in seconds.
+///
+/// @return true if the lease is young enough to be reused.
+bool
+getReusableAge(const Subnet& subnet, const Lease& old_lease, time_t now,
+               uint32_t& age) {
+    util::Optional<double> threshold = subnet.getCacheThreshold();
+    if (threshold.unspecified() || (threshold.get() <= 0.0) ||
+        (threshold.get() >= 1.0)) {
+        return (false);
+    }
+
+    // Expired, reclaimed or declined leases are never reused.
+    if ((old_lease.state_ != Lease::STATE_DEFAULT) || old_lease.expired() ||
+        (now < old_lease.cltt_)) {
+        return (false);
+    }
+
+    age = static_cast<uint32_t>(now - old_lease.cltt_);
+    if (age >= threshold.get() * old_lease.valid_lft_) {
+        return (false);
+    }
+
+    util::Optional<uint32_t> max_age = subnet.getCacheMaxAge();
+    if (!max_age.unspecified() && (age >= max_age.get())) {
+        return (false);
+    }
+    return (true);
+}
+
+} // end of anonymous namespace
+
+bool
+AllocEngine::setLeaseReusable(const Lease4Ptr& lease, const Lease4& old_lease,
+                              const ClientContext4& ctx) const {
+    uint32_t age = 0;
+    if (!ctx.subnet_ || !getReusableAge(*ctx.subnet_, old_lease, lease->cltt_, age)) {
+        return (false);
+    }
+
+    // The lease must be unchanged except its client last transmission time.
+    Lease4 renewed(*lease);
+    renewed.cltt_ = old_lease.cltt_;
+    renewed.old_cltt_ = old_lease.old_cltt_;
+    renewed.old_valid_lft_ = old_lease.old_valid_lft_;
+    if (!(renewed == old_lease)) {
+        return (false);
+    }
+
+    // Keep the expiration time.
+    if (lease->valid_lft_ == Lease::INFINITY_LFT) {
+        lease->cltt_ = old_lease.cltt_;
+    } else {
+        lease->valid_lft_ -= age;
+    }
+
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V4_LEASE_REUSE)
+        .arg(ctx.query_->getLabel())
+        .arg(lease->addr_.toText())
+        .arg(Lease::lifetimeToText(lease->valid_lft_));
+    return (true);
+}
+
+bool
+AllocEngine::setLeaseReusable(const Lease6Ptr& lease, const Lease6& old_lease,
+                              const ClientContext6& ctx) const {
+    uint32_t age = 0;
+    if (!ctx.subnet_ || !getReusableAge(*ctx.subnet_, old_lease, lease->cltt_, age)) {
+        return (false);
+    }
+
+    // A lease which is no longer preferred must be extended.
+    if ((lease->preferred_lft_ != Lease::INFINITY_LFT) &&
+        (age >= lease->preferred_lft_)) {
+        return (false);
+    }
+
+    // The lease must be unchanged except its client last transmission time.
+    Lease6 extended(*lease);
+    extended.cltt_ = old_lease.cltt_;
+    extended.old_cltt_ = old_lease.old_cltt_;
+    extended.old_valid_lft_ = old_lease.old_valid_lft_;
+    if (!(extended == old_lease)) {
+        return (false);
+    }
+
+    // Keep the expiration times.
+    if (lease->valid_lft_ == Lease::INFINITY_LFT) {
+        lease->cltt_ = old_lease.cltt_;
+    } else {
+        lease->valid_lft_ -= age;
+        if (lease->preferred_lft_ != Lease::INFINITY_LFT) {
+            lease->preferred_lft_ -= age;
+        }
+    }
+
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V6_LEASE_REUSE)
+        .arg(ctx.query_->getLabel())
+        .arg(lease->typeToText(lease->type_))
+        .arg(lease->addr_.toText())
+        .arg(Lease::lifetimeToText(lease->preferred_lft_))
+        .arg(Lease::lifetimeToText(lease->valid_lft_));
+    return (true);
+}
+
 }  // namespace dhcp
 }  // namespace isc
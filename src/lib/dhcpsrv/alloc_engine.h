@@ -8,6 +8,7 @@
 #define ALLOC_ENGINE_H
 
 #include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
 #include <dhcp/classify.h>
 #include <dhcp/duid.h>
 #include <dhcp/hwaddr.h>
@@ -23,15 +24,20 @@
 #include <dhcpsrv/srv_config.h>
 #include <hooks/callout_handle.h>
 #include <util/multi_threading_mgr.h>
+#include <util/stopwatch.h>
+#include <util/thread_pool.h>
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/noncopyable.hpp>
 
+#include <atomic>
+#include <functional>
 #include <list>
 #include <map>
 #include <mutex>
 #include <set>
+#include <string>
 #include <utility>
 
 namespace isc {
@@ -284,7 +290,7 @@ public:
     AllocEngine(AllocType engine_type, uint64_t attempts, bool ipv6 = true);
 
     /// @brief Destructor.
-    virtual ~AllocEngine() { }
+    virtual ~AllocEngine();
 
     /// @brief Returns allocator for a given pool type
     ///
@@ -428,10 +434,10 @@ public:
     typedef std::set<Resource, ResourceCompare> ResourceContainer;
 
     /// @brief A tuple holding host identifier type and value.
-    typedef std::pair<Host::IdentifierType, std::vector<uint8_t> > IdentifierPair;
+    typedef HostIdentifier IdentifierPair;
 
     /// @brief Map holding values to be used as host identifiers.
-    typedef std::list<IdentifierPair> IdentifierList;
+    typedef HostIdentifierList IdentifierList;
 
     /// @brief Context information for the DHCPv6 leases allocation.
     ///
@@ -932,6 +938,74 @@ public:
     /// deleted.
     void deleteExpiredReclaimedLeases4(const uint32_t secs);
 
+    /// @brief Reclaims expired IPv6 leases in the background.
+    ///
+    /// This method performs the same pass as @ref reclaimExpiredLeases6 but
+    /// the expired leases are fetched and the reclaimed leases are written
+    /// to the lease database by a dedicated thread, in batches, so as the
+    /// packet processing is not blocked by the lease database. The hooks,
+    /// the name change requests and the statistics are processed in the
+    /// thread running the IO service, between the packets, one batch at a
+    /// time. The method returns immediately.
+    ///
+    /// The lease manager is used from two threads so the caller must enable
+    /// the multi-threading mode before the first pass.
+    ///
+    /// @param max_leases Maximum number of leases to be reclaimed.
+    /// @param timeout Maximum amount of time that the reclamation routine
+    /// may be processing expired leases, expressed in milliseconds.
+    /// @param remove_lease A boolean value indicating if the lease should
+    /// be removed when it is reclaimed (if true) or it should be left in the
+    /// database in the "expired-reclaimed" state (if false).
+    /// @param max_unwarned_cycles A number of consecutive processing cycles
+    /// of expired leases, after which the system issues a warning if there
+    /// are still expired leases in the database.
+    /// @param io_service IO service run by the thread processing packets.
+    /// @param callback Function called from the IO service when the pass is
+    /// complete, e.g. to schedule the next pass.
+    void reclaimExpiredLeases6InBackground(const size_t max_leases,
+                                           const uint16_t timeout,
+                                           const bool remove_lease,
+                                           const uint16_t max_unwarned_cycles,
+                                           const asiolink::IOServicePtr& io_service,
+                                           const std::function<void()>& callback);
+
+    /// @brief Reclaims expired IPv4 leases in the background.
+    ///
+    /// This is the DHCPv4 variant of @ref reclaimExpiredLeases6InBackground.
+    ///
+    /// @param max_leases Maximum number of leases to be reclaimed.
+    /// @param timeout Maximum amount of time that the reclamation routine
+    /// may be processing expired leases, expressed in milliseconds.
+    /// @param remove_lease A boolean value indicating if the lease should
+    /// be removed when it is reclaimed (if true) or it should be left in the
+    /// database in the "expired-reclaimed" state (if false).
+    /// @param max_unwarned_cycles A number of consecutive processing cycles
+    /// of expired leases, after which the system issues a warning if there
+    /// are still expired leases in the database.
+    /// @param io_service IO service run by the thread processing packets.
+    /// @param callback Function called from the IO service when the pass is
+    /// complete, e.g. to schedule the next pass.
+    void reclaimExpiredLeases4InBackground(const size_t max_leases,
+                                           const uint16_t timeout,
+                                           const bool remove_lease,
+                                           const uint16_t max_unwarned_cycles,
+                                           const asiolink::IOServicePtr& io_service,
+                                           const std::function<void()>& callback);
+
+    /// @brief Stops the background reclamation.
+    ///
+    /// Waits for the reclamation thread to complete its current operation
+    /// on the lease database and cancels the pass in progress, if any: its
+    /// handlers still queued in the IO service do nothing and the callback
+    /// is not called. It must be called before the lease manager is
+    /// recreated and before the engine is destroyed.
+    void stopBackgroundReclamation();
+
+    /// @brief Maximum number of leases written to the lease database in
+    /// one batch by the reclamation routines.
+    static const size_t RECLAIM_BATCH_SIZE = 64;
+
 
     /// @anchor findReservationDecl
     /// @brief Attempts to find appropriate host reservation.
@@ -1188,6 +1262,97 @@ private:
         DB_RECLAIM_LEAVE_UNCHANGED
     };
 
+    /// @brief Reclaimed leases waiting to be written to the lease database.
+    ///
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollectionType>
+    struct ReclaimBatch {
+        /// @brief Leases to be set in the expired-reclaimed state.
+        LeaseCollectionType updated_;
+
+        /// @brief Leases to be removed.
+        LeaseCollectionType deleted_;
+
+        /// @brief Leases to be set in the expired-reclaimed state which
+        /// were also changed by the callouts, so they are fully updated.
+        LeaseCollectionType changed_;
+
+        /// @brief Leases the lease database did not reclaim because they
+        /// were renewed or removed in the meantime.
+        LeaseCollectionType skipped_;
+
+        /// @brief Error message when the batch could not be written.
+        std::string error_;
+
+        /// @brief Returns the number of leases in the batch.
+        size_t size() const {
+            return (updated_.size() + deleted_.size() + changed_.size());
+        }
+
+        /// @brief Empties the batch.
+        void clear() {
+            updated_.clear();
+            deleted_.clear();
+            changed_.clear();
+            skipped_.clear();
+            error_.clear();
+        }
+    };
+
+    /// @brief State of a background reclamation pass.
+    ///
+    /// The pass is handed over between the reclamation thread and the
+    /// thread running the IO service, so only one of them uses it at a time.
+    ///
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollectionType>
+    struct ReclaimPass {
+        /// @brief Maximum number of leases to be reclaimed.
+        size_t max_leases_;
+
+        /// @brief Maximum duration of the pass in milliseconds.
+        uint16_t timeout_;
+
+        /// @brief Remove the reclaimed leases.
+        bool remove_lease_;
+
+        /// @brief Number of incomplete passes before warning.
+        uint16_t max_unwarned_cycles_;
+
+        /// @brief IO service run by the thread processing packets.
+        asiolink::IOServicePtr io_service_;
+
+        /// @brief Called when the pass is complete.
+        std::function<void()> callback_;
+
+        /// @brief Set when the background reclamation is stopped.
+        boost::shared_ptr<std::atomic<bool> > cancelled_;
+
+        /// @brief Measures the duration of the pass.
+        util::Stopwatch stopwatch_;
+
+        /// @brief Expired leases fetched from the lease database.
+        LeaseCollectionType leases_;
+
+        /// @brief Index of the next lease to be reclaimed.
+        size_t next_;
+
+        /// @brief Number of leases reclaimed.
+        size_t processed_;
+
+        /// @brief Not all expired leases have been reclaimed.
+        bool incomplete_;
+
+        /// @brief Reclaimed leases being written.
+        ReclaimBatch<LeaseCollectionType> batch_;
+
+        /// @brief The batch was written by the reclamation thread.
+        bool written_;
+
+        /// @brief Error message when the expired leases could not be fetched.
+        std::string error_;
+    };
+
     /// @brief Reclaim DHCPv4 or DHCPv6 lease with updating lease database.
     ///
     /// This method is called by the lease reclamation routine to reclaim the
@@ -1198,11 +1363,15 @@ private:
     /// @param remove_lease A boolean flag indicating if the lease should be
     /// removed from the lease database (if true) upon reclamation.
     /// @param callout_handle Pointer to the callout handle.
+    /// @param batch Pointer to the batch the lease is added to, or null to
+    /// update the lease database immediately.
     /// @tparam LeasePtrPtr Lease type, i.e. @c Lease4Ptr or @c Lease6Ptr.
-    template<typename LeasePtrType>
+    /// @tparam LeaseCollectionType Matching collection type.
+    template<typename LeasePtrType, typename LeaseCollectionType>
     void reclaimExpiredLease(const LeasePtrType& lease,
                              const bool remove_lease,
-                             const hooks::CalloutHandlePtr& callout_handle);
+                             const hooks::CalloutHandlePtr& callout_handle,
+                             ReclaimBatch<LeaseCollectionType>* batch);
 
     /// @brief Reclaim DHCPv4 or DHCPv6 lease without updating lease database.
     ///
@@ -1224,13 +1393,19 @@ private:
     /// controls if the reclaimed lease should be left in the database with
     /// no change or if it should be removed or updated.
     ///
+    /// When a batch is given the lease is added to it instead of being
+    /// written to the lease database, and the statistics are updated by
+    /// @ref finishReclaimBatch once the batch is written.
+    ///
     /// @param lease Pointer to the DHCPv6 lease.
     /// @param reclaim_mode Indicates what the method should do with the reclaimed
     /// lease in the lease database.
     /// @param callout_handle Pointer to the callout handle.
+    /// @param batch Pointer to the batch of reclaimed leases or null.
     void reclaimExpiredLease(const Lease6Ptr& lease,
                              const DbReclaimMode& reclaim_mode,
-                             const hooks::CalloutHandlePtr& callout_handle);
+                             const hooks::CalloutHandlePtr& callout_handle,
+                             ReclaimBatch<Lease6Collection>* batch = 0);
 
     /// @brief Reclaim DHCPv4 lease.
     ///
@@ -1238,13 +1413,141 @@ private:
     /// controls if the reclaimed lease should be left in the database with
     /// no change or if it should be removed or updated.
     ///
+    /// When a batch is given the lease is added to it instead of being
+    /// written to the lease database, and the statistics are updated by
+    /// @ref finishReclaimBatch once the batch is written.
+    ///
     /// @param lease Pointer to the DHCPv4 lease.
     /// @param reclaim_mode Indicates what the method should do with the reclaimed
     /// lease in the lease database.
     /// @param callout_handle Pointer to the callout handle.
+    /// @param batch Pointer to the batch of reclaimed leases or null.
     void reclaimExpiredLease(const Lease4Ptr& lease,
                              const DbReclaimMode& reclaim_mode,
-                             const hooks::CalloutHandlePtr& callout_handle);
+                             const hooks::CalloutHandlePtr& callout_handle,
+                             ReclaimBatch<Lease4Collection>* batch = 0);
+
+    /// @brief Adds a reclaimed lease to a batch.
+    ///
+    /// Clears the FQDN information and sets the expired-reclaimed state of
+    /// the lease when it is not removed, as @ref reclaimLeaseInDatabase.
+    /// The batched update writes only these fields, so a lease which was
+    /// also changed by the callouts is fully updated instead.
+    ///
+    /// @param lease Pointer to the lease.
+    /// @param original Copy of the lease before the callouts were called,
+    /// or null when no callout was called.
+    /// @param remove_lease Boolean flag indicating if the lease should be
+    /// removed from the database (if true).
+    /// @param batch Batch of reclaimed leases.
+    /// @tparam LeasePtrType One of the @c Lease6Ptr or @c Lease4Ptr.
+    /// @tparam LeaseCollectionType Matching collection type.
+    template<typename LeasePtrType, typename LeaseCollectionType>
+    static void addToReclaimBatch(const LeasePtrType& lease,
+                                  const LeasePtrType& original,
+                                  const bool remove_lease,
+                                  ReclaimBatch<LeaseCollectionType>& batch);
+
+    /// @brief Writes a batch of reclaimed IPv4 leases to the lease database.
+    ///
+    /// The leases which were not reclaimed are stored in the batch. This
+    /// method doesn't throw: the error is stored in the batch.
+    ///
+    /// @param batch Batch of reclaimed leases.
+    static void writeReclaimBatch(ReclaimBatch<Lease4Collection>& batch);
+
+    /// @brief Writes a batch of reclaimed IPv6 leases to the lease database.
+    ///
+    /// @param batch Batch of reclaimed leases.
+    static void writeReclaimBatch(ReclaimBatch<Lease6Collection>& batch);
+
+    /// @brief Logs the reclaimed leases of a written batch and updates the
+    /// statistics.
+    ///
+    /// @param batch Batch of reclaimed leases written by
+    /// @ref writeReclaimBatch. It is emptied.
+    ///
+    /// @return Number of leases in the batch which were not reclaimed.
+    size_t finishReclaimBatch(ReclaimBatch<Lease4Collection>& batch);
+
+    /// @brief Logs the reclaimed leases of a written batch and updates the
+    /// statistics.
+    ///
+    /// @param batch Batch of reclaimed leases written by
+    /// @ref writeReclaimBatch. It is emptied.
+    ///
+    /// @return Number of leases in the batch which were not reclaimed.
+    size_t finishReclaimBatch(ReclaimBatch<Lease6Collection>& batch);
+
+    /// @brief Updates the statistics for a reclaimed IPv4 lease.
+    ///
+    /// @param lease Pointer to the reclaimed lease.
+    void updateReclaimedLeaseStats(const Lease4Ptr& lease);
+
+    /// @brief Updates the statistics for a reclaimed IPv6 lease.
+    ///
+    /// @param lease Pointer to the reclaimed lease.
+    void updateReclaimedLeaseStats(const Lease6Ptr& lease);
+
+    /// @brief Starts the reclamation thread if it is not running.
+    void startBackgroundReclamation();
+
+    /// @brief Fetches the expired leases of a background pass.
+    ///
+    /// Runs in the reclamation thread and posts @c reclaimStep to the IO
+    /// service.
+    ///
+    /// @param pass Background reclamation pass.
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollectionType>
+    void fetchExpiredLeases(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass);
+
+    /// @brief Writes the current batch of a background pass.
+    ///
+    /// Runs in the reclamation thread and posts @c reclaimStep to the IO
+    /// service.
+    ///
+    /// @param pass Background reclamation pass.
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollectionType>
+    void writeReclaimBatch(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass);
+
+    /// @brief Hands the current batch of a background pass over to the
+    /// reclamation thread.
+    ///
+    /// The batch is registered as in flight until @c reclaimStep accounts
+    /// it, so @ref stopBackgroundReclamation can finish it.
+    ///
+    /// @param pass Background reclamation pass.
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollectionType>
+    void submitReclaimBatch(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass);
+
+    /// @brief Finishes the batch of a cancelled background pass.
+    ///
+    /// Writes the batch when the reclamation thread did not, then logs
+    /// the reclaimed leases and updates the statistics.
+    ///
+    /// @param pass Background reclamation pass.
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollectionType>
+    void finishCancelledReclaimBatch(const boost::shared_ptr<ReclaimPass<LeaseCollectionType> >& pass);
+
+    /// @brief Performs one step of a background pass.
+    ///
+    /// Runs in the thread running the IO service: accounts the batch
+    /// written by the reclamation thread, reclaims the next batch of leases
+    /// (hooks and name change requests) and hands it over to the reclamation
+    /// thread, or completes the pass when all leases were processed or the
+    /// timeout was reached.
+    ///
+    /// @param pass Background reclamation pass.
+    void reclaimStep(const boost::shared_ptr<ReclaimPass<Lease4Collection> >& pass);
+
+    /// @brief Performs one step of a background pass.
+    ///
+    /// @param pass Background reclamation pass.
+    void reclaimStep(const boost::shared_ptr<ReclaimPass<Lease6Collection> >& pass);
 
     /// @brief Marks lease as reclaimed in the database.
     ///
@@ -1644,6 +1947,43 @@ private:
     /// lease could be allocated.
     Lease4Ptr requestLease4(ClientContext4& ctx);
 
+    /// @brief Creates a lease instance for the specified address.
+    ///
+    /// Creates a lease from the client context and invokes the lease4_select
+    /// callouts. The lease is not inserted into the database.
+    ///
+    /// @param ctx client context that contains additional parameters.
+    /// @param addr An address that was selected for the client.
+    /// @param [out] callout_status callout returned by the lease4_select
+    ///
+    /// @return created lease or NULL if the callouts decided to skip
+    /// the allocation.
+    Lease4Ptr makeLease4(const ClientContext4& ctx,
+                         const isc::asiolink::IOAddress& addr,
+                         hooks::CalloutHandle::CalloutNextStep& callout_status);
+
+    /// @brief Allocates or renews a lease in a single lease manager call.
+    ///
+    /// This method is used instead of looking up the existing lease and
+    /// then inserting or updating it when the lease manager supports it,
+    /// see @c LeaseMgr::isAllocateOrRenewEnabled. The lease is stored
+    /// when the address is free, the existing lease has expired or belongs
+    /// to the client. An expired lease which belonged to another client
+    /// is reclaimed after it was replaced.
+    ///
+    /// @param candidate Address for which the lease should be allocated.
+    /// @param ctx Client context holding the data extracted from the
+    /// client's message.
+    /// @param [out] callout_status callout returned by the lease4_select
+    ///
+    /// @return A pointer to the allocated lease or NULL if the address is
+    /// in use by another client, in which case the conflicting lease is
+    /// set in the context.
+    Lease4Ptr
+    allocateOrRenewLease4(const asiolink::IOAddress& candidate,
+                          ClientContext4& ctx,
+                          hooks::CalloutHandle::CalloutNextStep& callout_status);
+
     /// @brief Creates a lease and inserts it in LeaseMgr if necessary
     ///
     /// Creates a lease based on specified parameters and tries to insert it
@@ -1796,6 +2136,36 @@ private:
     /// otherwise.
     bool conditionalExtendLifetime(Lease& lease) const;
 
+    /// @brief Checks if a renewed DHCPv4 lease can be reused.
+    ///
+    /// The lease is reused when it is unchanged, except its client last
+    /// transmission time, and its age is below the cache-threshold fraction
+    /// of its valid lifetime and below the cache-max-age. A reused lease
+    /// is not updated in the lease database: its valid lifetime is set to
+    /// the remaining lifetime so its expiration time is unchanged.
+    ///
+    /// @param [in,out] lease The renewed lease.
+    /// @param old_lease The lease before the renewal.
+    /// @param ctx Client context holding the subnet.
+    ///
+    /// @return true if the lease is reused, false otherwise.
+    bool setLeaseReusable(const Lease4Ptr& lease, const Lease4& old_lease,
+                          const ClientContext4& ctx) const;
+
+    /// @brief Checks if an extended DHCPv6 lease can be reused.
+    ///
+    /// Same as the DHCPv4 version, the preferred lifetime being set to
+    /// the remaining preferred lifetime too. A lease whose preferred
+    /// lifetime has elapsed is not reused.
+    ///
+    /// @param [in,out] lease The extended lease.
+    /// @param old_lease The lease before the extension.
+    /// @param ctx Client context holding the subnet.
+    ///
+    /// @return true if the lease is reused, false otherwise.
+    bool setLeaseReusable(const Lease6Ptr& lease, const Lease6& old_lease,
+                          const ClientContext6& ctx) const;
+
 private:
 
     /// @brief Number of consecutive DHCPv4 leases' reclamations after
@@ -1805,6 +2175,19 @@ private:
     /// @brief Number of consecutive DHCPv6 leases' reclamations after
     /// which there are still expired leases in the database.
     uint16_t incomplete_v6_reclamations_;
+
+    /// @brief Thread fetching and writing the leases of the background
+    /// reclamation passes.
+    util::ThreadPool<std::function<void()> > reclaim_thread_;
+
+    /// @brief Cancellation flag of the background reclamation passes.
+    boost::shared_ptr<std::atomic<bool> > reclaim_cancelled_;
+
+    /// @brief Finishers of the batches handed over to the reclamation
+    /// thread and not accounted yet, by pass.
+    ///
+    /// Only used by the thread running the IO service.
+    std::map<const void*, std::function<void()> > reclaim_in_flight_;
 };
 
 /// @brief A pointer to the @c AllocEngine object.
@@ -17,11 +17,13 @@ extern const isc::log::MessageID ALLOC_ENGINE_V4_DECLINED_RECOVERED;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_DISCOVER_ADDRESS_CONFLICT;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_DISCOVER_HR;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_COMPLETE;
+extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_FAILED;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_SLOW;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_START;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASE_RECLAIM;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED;
+extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASE_REUSE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_NO_MORE_EXPIRED_LEASES;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_OFFER_EXISTING_LEASE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_OFFER_NEW_LEASE;
@@ -29,6 +31,7 @@ extern const isc::log::MessageID ALLOC_ENGINE_V4_OFFER_REQUESTED_LEASE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_RECLAIMED_LEASES_DELETE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_RECLAIMED_LEASES_DELETE_COMPLETE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_RECLAIMED_LEASES_DELETE_FAILED;
+extern const isc::log::MessageID ALLOC_ENGINE_V4_RECLAIM_BATCH_FAILED;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_REQUEST_ADDRESS_RESERVED;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_REQUEST_ALLOC_REQUESTED;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_REQUEST_EXTEND_LEASE;
@@ -58,15 +61,18 @@ extern const isc::log::MessageID ALLOC_ENGINE_V6_HINT_RESERVED;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_HR_ADDR_GRANTED;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_HR_PREFIX_GRANTED;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_COMPLETE;
+extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_FAILED;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_SLOW;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_START;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASE_RECLAIM;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED;
+extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASE_REUSE;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_NO_MORE_EXPIRED_LEASES;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RECLAIMED_LEASES_DELETE;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RECLAIMED_LEASES_DELETE_COMPLETE;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RECLAIMED_LEASES_DELETE_FAILED;
+extern const isc::log::MessageID ALLOC_ENGINE_V6_RECLAIM_BATCH_FAILED;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RENEW_HR;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RENEW_REMOVE_RESERVED;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RENEW_REMOVE_UNRESERVED;
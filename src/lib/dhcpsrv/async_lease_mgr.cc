@@ -0,0 +1,118 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/async_lease_mgr.h>
+#include <exceptions/exceptions.h>
+#include <boost/make_shared.hpp>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+
+namespace isc {
+namespace dhcp {
+
+AsyncLeaseMgr::AsyncLeaseMgr()
+    : pool_(), io_service_(), watch_socket_(),
+      cancelled_(new std::atomic<bool>(false)), pending_(0) {
+}
+
+AsyncLeaseMgr::~AsyncLeaseMgr() {
+    stop();
+}
+
+void
+AsyncLeaseMgr::start(size_t thread_count, const IOServicePtr& io_service) {
+    if (isRunning()) {
+        isc_throw(InvalidOperation, "asynchronous lease manager already started");
+    }
+    if (thread_count == 0) {
+        isc_throw(BadValue, "asynchronous lease manager requires at least"
+                  " one thread");
+    }
+    if (!io_service) {
+        isc_throw(BadValue, "asynchronous lease manager requires an IO service");
+    }
+
+    // The main loop is woken up when a completion handler is posted. The
+    // handlers are run by the IO service after the callback returns.
+    WatchSocketPtr watch_socket(new WatchSocket());
+    IfaceMgr::instance().addExternalSocket(watch_socket->getSelectFd(),
+                                           [watch_socket](int) {
+        watch_socket->clearReady();
+    });
+    watch_socket_ = watch_socket;
+
+    pool_.start(thread_count);
+    io_service_ = io_service;
+}
+
+void
+AsyncLeaseMgr::stop() {
+    // The handlers of the submitted work which are still pending in the
+    // IO service will do nothing. The work submitted after a restart
+    // uses a new flag.
+    cancelled_->store(true);
+    cancelled_.reset(new std::atomic<bool>(false));
+
+    // Wait for the work in progress and drop the queued work.
+    pool_.reset();
+    io_service_.reset();
+    pending_.store(0);
+
+    if (watch_socket_) {
+        IfaceMgr::instance().deleteExternalSocket(watch_socket_->getSelectFd());
+        watch_socket_.reset();
+    }
+}
+
+void
+AsyncLeaseMgr::submit(const Work& work, const Completion& completion) {
+    if (!isRunning()) {
+        isc_throw(InvalidOperation, "asynchronous lease manager not started");
+    }
+
+    ++pending_;
+
+    // The worker must not access the members which are modified by the
+    // main thread, so the work captures what it needs.
+    IOServicePtr io_service = io_service_;
+    WatchSocketPtr watch_socket = watch_socket_;
+    boost::shared_ptr<std::atomic<bool> > cancelled = cancelled_;
+    pool_.add(boost::make_shared<std::function<void()> >(
+    [this, work, completion, io_service, watch_socket, cancelled]() {
+        std::exception_ptr error;
+        try {
+            work();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // This object may be gone when the handler is invoked.
+        io_service->post([this, completion, cancelled, error]() {
+            if (cancelled->load()) {
+                return;
+            }
+            --pending_;
+            if (completion) {
+                completion(error);
+            }
+        });
+
+        // The handler is posted first so it is run by the poll which
+        // follows the wakeup.
+        try {
+            watch_socket->markReady();
+        } catch (const std::exception&) {
+            // The handler is run after the receive timeout.
+        }
+    }));
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -0,0 +1,148 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASYNC_LEASE_MGR_H
+#define ASYNC_LEASE_MGR_H
+
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <util/thread_pool.h>
+#include <util/watch_socket.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <exception>
+#include <functional>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Asynchronous access to the lease database.
+///
+/// A call to the lease manager blocks the calling thread for a full round
+/// trip to the database server. This class runs the lease database work
+/// on a pool of worker threads and hands its completion over to the IO
+/// service polled by the server main loop. The main thread submits the
+/// work, continues with other packets while the queries are in flight and
+/// processes the results from the IO service, so the completion handlers
+/// always run on the main thread.
+///
+/// The lease manager is used by several threads at the same time, so the
+/// multi-threading mode must be enabled while this object is running.
+/// Each worker thread uses its own database connection.
+///
+/// The work items are arbitrary functions, so a caller may group several
+/// lease manager calls, e.g. the whole allocation for a packet, into one
+/// item.
+///
+/// The main loop waits for packets in @c IfaceMgr::receive4 or
+/// @c IfaceMgr::receive6, so a watch socket registered as an external
+/// socket of the interface manager is marked ready when a completion
+/// handler is posted: the wait is interrupted and the main loop polls the
+/// IO service without waiting for the receive timeout.
+class AsyncLeaseMgr : public boost::noncopyable {
+public:
+
+    /// @brief Lease database work run by a worker thread.
+    typedef std::function<void()> Work;
+
+    /// @brief Completion handler run by the IO service.
+    ///
+    /// The argument holds the exception thrown by the work or is null
+    /// when the work completed successfully.
+    typedef std::function<void(const std::exception_ptr&)> Completion;
+
+    /// @brief Constructor.
+    AsyncLeaseMgr();
+
+    /// @brief Destructor.
+    ///
+    /// Stops the worker threads.
+    ~AsyncLeaseMgr();
+
+    /// @brief Starts the worker threads.
+    ///
+    /// @param thread_count Number of worker threads.
+    /// @param io_service IO service running the completion handlers.
+    ///
+    /// @throw InvalidOperation if already running.
+    /// @throw BadValue if the thread count is 0 or the IO service is null.
+    void start(size_t thread_count, const asiolink::IOServicePtr& io_service);
+
+    /// @brief Stops the worker threads.
+    ///
+    /// Waits for the work in progress and drops the queued work. The
+    /// completion handlers of the submitted work are not invoked, even
+    /// those already posted to the IO service. Callers which keep state
+    /// for the submitted work, e.g. parked packets, must discard it.
+    void stop();
+
+    /// @brief Checks if the worker threads are running.
+    bool isRunning() const {
+        return (io_service_ != 0);
+    }
+
+    /// @brief Returns the number of worker threads.
+    size_t getThreadCount() {
+        return (pool_.size());
+    }
+
+    /// @brief Returns the number of submitted work items which have not
+    /// completed yet.
+    size_t getPendingCount() const {
+        return (pending_.load());
+    }
+
+    /// @brief Submits lease database work.
+    ///
+    /// @param work Function run by a worker thread.
+    /// @param completion Function run by the IO service when the work
+    /// completes.
+    ///
+    /// @throw InvalidOperation if not running.
+    void submit(const Work& work, const Completion& completion);
+
+    /// @brief Returns the file descriptor of the watch socket.
+    ///
+    /// It is ready to read when completion handlers were posted to the
+    /// IO service.
+    ///
+    /// @return The file descriptor or @c util::WatchSocket::SOCKET_NOT_VALID
+    /// when not running.
+    int getSelectFd() const {
+        return (watch_socket_ ? watch_socket_->getSelectFd() :
+                util::WatchSocket::SOCKET_NOT_VALID);
+    }
+
+private:
+
+    /// @brief Worker threads.
+    util::ThreadPool<std::function<void()> > pool_;
+
+    /// @brief IO service running the completion handlers.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief Watch socket marked ready when a completion handler is
+    /// posted.
+    util::WatchSocketPtr watch_socket_;
+
+    /// @brief Flag set when the worker threads are stopped.
+    ///
+    /// It is shared with the submitted work so the handlers posted before
+    /// the stop do nothing. A new flag is used after each stop.
+    boost::shared_ptr<std::atomic<bool> > cancelled_;
+
+    /// @brief Number of submitted work items which have not completed.
+    std::atomic<size_t> pending_;
+};
+
+/// @brief Pointer to the asynchronous lease manager.
+typedef boost::shared_ptr<AsyncLeaseMgr> AsyncLeaseMgrPtr;
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // ASYNC_LEASE_MGR_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -304,6 +304,66 @@ public:
     get6(const SubnetID& subnet_id, const asiolink::IOAddress& address) const =
  0;
 
+    /// @brief Returns hosts connected to the IPv4 subnet using any of the
+    /// specified identifiers.
+    ///
+    /// This method allows for fetching the reservations of a client having
+    /// several identifiers (e.g. HW address, client identifier, circuit id)
+    /// at once. Backends able to do this in a single query should override
+    /// it. The default implementation calls @c get4 for each identifier in
+    /// the order of the list and stops at the first host which is not from
+    /// negative caching: the hosts for the identifiers following it would
+    /// not be used by the caller.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Collection of const @c Host objects, at most one for each
+    /// identifier.
+    virtual ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ConstHostCollection hosts;
+        for (auto const& id : identifiers) {
+            ConstHostPtr host = get4(subnet_id, id.first, &id.second[0],
+                                     id.second.size());
+            if (host) {
+                hosts.push_back(host);
+                if (!host->getNegative()) {
+                    break;
+                }
+            }
+        }
+        return (hosts);
+    }
+
+    /// @brief Returns hosts connected to the IPv6 subnet using any of the
+    /// specified identifiers.
+    ///
+    /// The IPv6 counterpart of @c getByIdentifiers4.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Collection of const @c Host objects, at most one for each
+    /// identifier.
+    virtual ConstHostCollection
+    getByIdentifiers6(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ConstHostCollection hosts;
+        for (auto const& id : identifiers) {
+            ConstHostPtr host = get6(subnet_id, id.first, &id.second[0],
+                                     id.second.size());
+            if (host) {
+                hosts.push_back(host);
+                if (!host->getNegative()) {
+                    break;
+                }
+            }
+        }
+        return (hosts);
+    }
+
     /// @brief Adds a new host to the collection.
     ///
     /// The implementations of this method should guard against duplicate
@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -50,6 +50,7 @@ CfgExpiration::CfgExpiration(const bool test_mode)
       max_reclaim_leases_(DEFAULT_MAX_RECLAIM_LEASES),
       max_reclaim_time_(DEFAULT_MAX_RECLAIM_TIME),
       unwarned_reclaim_cycles_(DEFAULT_UNWARNED_RECLAIM_CYCLES),
+      background_reclamation_(false),
       timer_mgr_(TimerMgr::instance()),
       test_mode_(test_mode) {
 }
@@ -134,6 +135,11 @@ CfgExpiration::toElement() const {
     result->set("unwarned-reclaim-cycles",
                 Element::create(static_cast<long long>
                                 (unwarned_reclaim_cycles_)));
+    // Set background-reclamation only when enabled: this optional
+    // parameter is not part of the default configuration.
+    if (background_reclamation_) {
+        result->set("background-reclamation", Element::create(true));
+    }
     return (result);
 }
 
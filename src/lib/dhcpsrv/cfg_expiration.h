@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -55,6 +55,10 @@ namespace dhcp {
 ///   there are still expired leases in the database. If this value is 0,
 ///   the warning is never issued.
 ///
+/// - background-reclamation - indicates if the expired leases are fetched
+///   and the reclaimed leases are written to the lease database by a
+///   dedicated thread rather than by the thread processing packets.
+///
 /// The @c CfgExpiration class provides a collection of accessors and
 /// modifiers to manage the data. Each accessor checks if the given value
 /// is in range allowed for this value.
@@ -188,6 +192,18 @@ public:
     /// @param unwarned_reclaim_cycles New value.
     void setUnwarnedReclaimCycles(const int64_t unwarned_reclaim_cycles);
 
+    /// @brief Returns background-reclamation.
+    bool getBackgroundReclamation() const {
+        return (background_reclamation_);
+    }
+
+    /// @brief Sets background-reclamation.
+    ///
+    /// @param background_reclamation New value.
+    void setBackgroundReclamation(const bool background_reclamation) {
+        background_reclamation_ = background_reclamation;
+    }
+
     /// @brief Setup timers for the reclamation of expired leases according
     /// to the configuration parameters.
     ///
@@ -262,6 +278,9 @@ private:
     /// @brief unwarned-reclaim-cycles.
     uint16_t unwarned_reclaim_cycles_;
 
+    /// @brief background-reclamation.
+    bool background_reclamation_;
+
     /// @brief Pointer to the instance of the Timer Manager.
     TimerMgrPtr timer_mgr_;
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <exceptions/exceptions.h>
 #include <util/encode/hex.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -20,6 +21,30 @@
 using namespace isc::asiolink;
 using namespace isc::data;
 
+namespace {
+
+/// @brief Sorts the hosts appended to a collection by host identifier.
+///
+/// The hashed indexes of the host container do not keep the hosts in the
+/// order they were added so the hosts found are sorted.
+///
+/// @param storage The collection of hosts.
+/// @param first Position of the first appended host.
+template<typename Storage>
+void
+sortByHostId(Storage& storage, const size_t first) {
+    if (storage.size() - first < 2) {
+        return;
+    }
+    std::sort(storage.begin() + first, storage.end(),
+              [](const typename Storage::value_type& a,
+                 const typename Storage::value_type& b) {
+        return (a->getHostId() < b->getHostId());
+    });
+}
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace dhcp {
 
@@ -243,13 +268,12 @@ CfgHosts::getAllInternal(const Host::IdentifierType& identifier_type,
                          const size_t identifier_len,
                          Storage& storage) const {
 
-    // Convert host identifier into textual format for logging purposes.
-    // This conversion is exception free.
-    std::string identifier_text = Host::getIdentifierAsText(identifier_type,
-                                                            identifier,
-                                                            identifier_len);
+    // The identifier is converted into textual format for logging purposes
+    // only when the debug messages are logged. This conversion is exception
+    // free.
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_GET_ALL_IDENTIFIER)
-        .arg(identifier_text);
+        .arg(Host::getIdentifierAsText(identifier_type, identifier,
+                                       identifier_len));
 
     // Use the identifier and identifier type as a composite key.
     const HostContainerIndex0& idx = hosts_.get<0>();
@@ -259,19 +283,23 @@ CfgHosts::getAllInternal(const Host::IdentifierType& identifier_type,
                                                identifier_type);
 
     // Append each Host object to the storage.
-    for (HostContainerIndex0::iterator host = idx.lower_bound(t);
-         host != idx.upper_bound(t);
+    const size_t first = storage.size();
+    HostContainerIndex0Range r = idx.equal_range(t);
+    for (HostContainerIndex0::iterator host = r.first; host != r.second;
          ++host) {
         LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE_DETAIL_DATA,
                   HOSTS_CFG_GET_ALL_IDENTIFIER_HOST)
-            .arg(identifier_text)
+            .arg(Host::getIdentifierAsText(identifier_type, identifier,
+                                           identifier_len))
             .arg((*host)->toText());
         storage.push_back(*host);
     }
+    sortByHostId(storage, first);
 
     // Log how many hosts have been found.
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS, HOSTS_CFG_GET_ALL_IDENTIFIER_COUNT)
-        .arg(identifier_text)
+        .arg(Host::getIdentifierAsText(identifier_type, identifier,
+                                       identifier_len))
         .arg(storage.size());
 }
 
@@ -343,8 +371,9 @@ CfgHosts::getAllbyHostnameInternal(const std::string& hostname,
     const HostContainerIndex5& idx = hosts_.get<5>();
 
     // Append each Host object to the storage.
-    for (HostContainerIndex5::iterator host = idx.lower_bound(hostname);
-         host != idx.upper_bound(hostname);
+    const size_t first = storage.size();
+    HostContainerIndex5Range r = idx.equal_range(hostname);
+    for (HostContainerIndex5::iterator host = r.first; host != r.second;
          ++host) {
         LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE_DETAIL_DATA,
                   HOSTS_CFG_GET_ALL_HOSTNAME_HOST)
@@ -352,6 +381,7 @@ CfgHosts::getAllbyHostnameInternal(const std::string& hostname,
             .arg((*host)->toText());
         storage.push_back(*host);
     }
+    sortByHostId(storage, first);
 
     // Log how many hosts have been found.
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS, HOSTS_CFG_GET_ALL_HOSTNAME_COUNT)
@@ -374,8 +404,9 @@ CfgHosts::getAllbyHostnameInternal4(const std::string& hostname,
     const HostContainerIndex5& idx = hosts_.get<5>();
 
     // Append each Host object to the storage.
-    for (HostContainerIndex5::iterator host = idx.lower_bound(hostname);
-         host != idx.upper_bound(hostname);
+    const size_t first = storage.size();
+    HostContainerIndex5Range r = idx.equal_range(hostname);
+    for (HostContainerIndex5::iterator host = r.first; host != r.second;
          ++host) {
         if ((*host)->getIPv4SubnetID() != subnet_id) {
             continue;
@@ -387,6 +418,7 @@ CfgHosts::getAllbyHostnameInternal4(const std::string& hostname,
             .arg((*host)->toText());
         storage.push_back(*host);
     }
+    sortByHostId(storage, first);
 
     // Log how many hosts have been found.
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
@@ -411,8 +443,9 @@ CfgHosts::getAllbyHostnameInternal6(const std::string& hostname,
     const HostContainerIndex5& idx = hosts_.get<5>();
 
     // Append each Host object to the storage.
-    for (HostContainerIndex5::iterator host = idx.lower_bound(hostname);
-         host != idx.upper_bound(hostname);
+    const size_t first = storage.size();
+    HostContainerIndex5Range r = idx.equal_range(hostname);
+    for (HostContainerIndex5::iterator host = r.first; host != r.second;
          ++host) {
         if ((*host)->getIPv6SubnetID() != subnet_id) {
             continue;
@@ -424,6 +457,7 @@ CfgHosts::getAllbyHostnameInternal6(const std::string& hostname,
             .arg((*host)->toText());
         storage.push_back(*host);
     }
+    sortByHostId(storage, first);
 
     // Log how many hosts have been found.
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
@@ -853,6 +887,19 @@ CfgHosts::add(const HostPtr& host) {
     add6(host);
 }
 
+void
+CfgHosts::add(const HostCollection& hosts) {
+    // Size the hashed indexes once for all the new hosts.
+    const size_t count = hosts_.size() + hosts.size();
+    hosts_.get<0>().reserve(count);
+    hosts_.get<5>().reserve(count);
+
+    for (HostCollection::const_iterator host = hosts.begin();
+         host != hosts.end(); ++host) {
+        add(*host);
+    }
+}
+
 void
 CfgHosts::add4(const HostPtr& host) {
 
@@ -868,8 +915,8 @@ CfgHosts::add4(const HostPtr& host) {
         host->getNextServer().isV4Zero() &&
         host->getServerHostname().empty() &&
         host->getBootFileName().empty() &&
-        host->getCfgOption4()->empty() &&
-        host->getCfgOption6()->empty() &&
+        !host->hasOptions4() &&
+        !host->hasOptions6() &&
         host->getClientClasses4().empty() &&
         host->getClientClasses6().empty()) {
         std::ostringstream s;
@@ -935,8 +982,11 @@ CfgHosts::add4(const HostPtr& host) {
     }
 
     // Check if the (identifier type, identifier) tuple is already used.
+    // HW addresses and DUIDs were already checked above.
     const std::vector<uint8_t>& id = host->getIdentifier();
-    if ((host->getIPv4SubnetID() != SUBNET_ID_UNUSED) && !id.empty()) {
+    if ((host->getIPv4SubnetID() != SUBNET_ID_UNUSED) && !id.empty() &&
+        (host->getIdentifierType() != Host::IDENT_HWADDR) &&
+        (host->getIdentifierType() != Host::IDENT_DUID)) {
         if (get4(host->getIPv4SubnetID(), host->getIdentifierType(), &id[0],
                  id.size())) {
             isc_throw(DuplicateHost, "failed to add duplicate IPv4 host using identifier: "
@@ -1062,9 +1112,9 @@ CfgHosts::toElement() const {
 ElementPtr
 CfgHosts::toElement4() const {
     CfgHostsList result;
-    // Iterate using arbitrary the index 0
-    const HostContainerIndex0& idx = hosts_.get<0>();
-    for (HostContainerIndex0::const_iterator host = idx.begin();
+    // Iterate using the index 4 to get the hosts in the order they were added
+    const HostContainerIndex4& idx = hosts_.get<4>();
+    for (HostContainerIndex4::const_iterator host = idx.begin();
          host != idx.end(); ++host) {
 
         // Convert host to element representation
@@ -1080,9 +1130,9 @@ CfgHosts::toElement4() const {
 ElementPtr
 CfgHosts::toElement6() const {
     CfgHostsList result;
-    // Iterate using arbitrary the index 0
-    const HostContainerIndex0& idx = hosts_.get<0>();
-    for (HostContainerIndex0::const_iterator host = idx.begin();
+    // Iterate using the index 4 to get the hosts in the order they were added
+    const HostContainerIndex4& idx = hosts_.get<4>();
+    for (HostContainerIndex4::const_iterator host = idx.begin();
          host != idx.end(); ++host) {
 
         // Convert host to Element representation
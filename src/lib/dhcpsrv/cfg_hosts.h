@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -418,6 +418,18 @@ public:
     /// has already been added to the IPv4 or IPv6 subnet.
     virtual void add(const HostPtr& host);
 
+    /// @brief Adds new hosts to the collection.
+    ///
+    /// Used by the configuration parsers to add all the reservations
+    /// of a list at once: the hashed indexes are sized for the new hosts
+    /// before they are added.
+    ///
+    /// @param hosts The new @c Host objects being added.
+    ///
+    /// @throw DuplicateHost If a host for a particular HW address or DUID
+    /// has already been added to the IPv4 or IPv6 subnet.
+    void add(const HostCollection& hosts);
+
     /// @brief Attempts to delete a host by address.
     ///
     /// This method supports both v4 and v6.
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -470,28 +470,31 @@ CfgSubnets4::selectSubnet(const IOAddress& address,
 }
 
 void
-CfgSubnets4::removeStatistics() {
+CfgSubnets4::removeSubnetStatistics(const SubnetID& subnet_id) {
     using namespace isc::stats;
 
-    // For each v4 subnet currently configured, remove the statistic.
     StatsMgr& stats_mgr = StatsMgr::instance();
-    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
-         subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+void
+CfgSubnets4::removeStatistics() const {
+    // For each v4 subnet currently configured, remove the statistics.
+    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
+        removeSubnetStatistics((*subnet)->getID());
     }
 }
 
@@ -517,6 +520,60 @@ CfgSubnets4::updateStatistics() {
     }
 }
 
+void
+CfgSubnets4::updateStatistics(const CfgSubnets4& previous) {
+    using namespace isc::stats;
+
+    // Nothing to compare with: recount everything.
+    if (previous.subnets_.empty()) {
+        updateStatistics();
+        return;
+    }
+
+    // Remove the statistics of the subnets which are gone. Their declined
+    // addresses are taken out of the global value first.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    for (auto old = previous.subnets_.begin(); old != previous.subnets_.end();
+         ++old) {
+        SubnetID subnet_id = (*old)->getID();
+        if (getBySubnetId(subnet_id)) {
+            continue;
+        }
+        ObservationPtr declined = stats_mgr.getObservation(
+            StatsMgr::generateName("subnet", subnet_id, "declined-addresses"));
+        if (declined) {
+            stats_mgr.addValue("declined-addresses",
+                               -declined->getInteger().first);
+        }
+        removeSubnetStatistics(subnet_id);
+    }
+
+    std::set<SubnetID> recount;
+    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
+        SubnetID subnet_id = (*subnet)->getID();
+
+        stats_mgr.setValue(StatsMgr::
+                           generateName("subnet", subnet_id, "total-addresses"),
+                           static_cast<int64_t>
+                           ((*subnet)->getPoolCapacity(Lease::TYPE_V4)));
+
+        // The lease statistics of an unchanged subnet are still valid.
+        // The utilization hint is carried over to the new subnet instance.
+        ConstSubnet4Ptr old = previous.getBySubnetId(subnet_id);
+        if (old && ((old == *subnet) ||
+                    old->toElement()->equals(*(*subnet)->toElement()))) {
+            (*subnet)->setAssignedLeasesHint(Lease::TYPE_V4,
+                old->getAssignedLeasesHint(Lease::TYPE_V4));
+            continue;
+        }
+        recount.insert(subnet_id);
+    }
+
+    if (!recount.empty()) {
+        LeaseMgrFactory::instance().recountLeaseStats4(recount);
+    }
+}
+
 ElementPtr
 CfgSubnets4::toElement() const {
     ElementPtr result = Element::createList();
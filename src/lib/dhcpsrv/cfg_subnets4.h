@@ -306,13 +306,28 @@ public:
     /// not expected to change until the next reconfiguration event.
     void updateStatistics();
 
+    /// @brief Updates statistics after a reconfiguration.
+    ///
+    /// This is an incremental version of @ref updateStatistics() used when
+    /// a new configuration replaces a previous one. Recounting the leases
+    /// of all subnets may take a long time with large lease databases, so
+    /// the lease statistics are recounted only for the subnets which were
+    /// added or whose definition was modified. The statistics of the
+    /// subnets which were removed are deleted and the lease statistics of
+    /// the unchanged subnets are kept as is. When the previous configuration
+    /// has no subnet, e.g. at startup, all statistics are recounted.
+    ///
+    /// @param previous The subnets of the previous configuration. Their
+    /// statistics must not have been removed.
+    void updateStatistics(const CfgSubnets4& previous);
+
     /// @brief Removes statistics.
     ///
     /// During commitment of a new configuration, we need to get rid of the old
     /// statistics for the old configuration. In particular, we need to remove
     /// anything related to subnets, as there may be fewer subnets in the new
     /// configuration and also subnet-ids may change.
-    void removeStatistics();
+    void removeStatistics() const;
 
     /// @brief Unparse a configuration object
     ///
@@ -321,6 +336,11 @@ public:
 
 private:
 
+    /// @brief Removes the statistics of a subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    static void removeSubnetStatistics(const SubnetID& subnet_id);
+
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -382,32 +382,35 @@ CfgSubnets6::getSubnet(const SubnetID id) const {
 }
 
 void
-CfgSubnets6::removeStatistics() {
+CfgSubnets6::removeSubnetStatistics(const SubnetID& subnet_id) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
-    // For each v6 subnet currently configured, remove the statistics.
-    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
-         subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
+}
+
+void
+CfgSubnets6::removeStatistics() const {
+    // For each v6 subnet currently configured, remove the statistics.
+    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
+        removeSubnetStatistics((*subnet)->getID());
     }
 }
 
@@ -438,6 +441,67 @@ CfgSubnets6::updateStatistics() {
     }
 }
 
+void
+CfgSubnets6::updateStatistics(const CfgSubnets6& previous) {
+    using namespace isc::stats;
+
+    // Nothing to compare with: recount everything.
+    if (previous.subnets_.empty()) {
+        updateStatistics();
+        return;
+    }
+
+    // Remove the statistics of the subnets which are gone. Their declined
+    // addresses are taken out of the global value first.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    for (auto old = previous.subnets_.begin(); old != previous.subnets_.end();
+         ++old) {
+        SubnetID subnet_id = (*old)->getID();
+        if (getBySubnetId(subnet_id)) {
+            continue;
+        }
+        ObservationPtr declined = stats_mgr.getObservation(
+            StatsMgr::generateName("subnet", subnet_id, "declined-addresses"));
+        if (declined) {
+            stats_mgr.addValue("declined-addresses",
+                               -declined->getInteger().first);
+        }
+        removeSubnetStatistics(subnet_id);
+    }
+
+    std::set<SubnetID> recount;
+    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
+        SubnetID subnet_id = (*subnet)->getID();
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "total-nas"),
+                           static_cast<int64_t>
+                           ((*subnet)->getPoolCapacity(Lease::TYPE_NA)));
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "total-pds"),
+                           static_cast<int64_t>
+                           ((*subnet)->getPoolCapacity(Lease::TYPE_PD)));
+
+        // The lease statistics of an unchanged subnet are still valid.
+        // The utilization hint is carried over to the new subnet instance.
+        ConstSubnet6Ptr old = previous.getBySubnetId(subnet_id);
+        if (old && ((old == *subnet) ||
+                    old->toElement()->equals(*(*subnet)->toElement()))) {
+            (*subnet)->setAssignedLeasesHint(Lease::TYPE_NA,
+                old->getAssignedLeasesHint(Lease::TYPE_NA));
+            (*subnet)->setAssignedLeasesHint(Lease::TYPE_PD,
+                old->getAssignedLeasesHint(Lease::TYPE_PD));
+            continue;
+        }
+        recount.insert(subnet_id);
+    }
+
+    if (!recount.empty()) {
+        LeaseMgrFactory::instance().recountLeaseStats6(recount);
+    }
+}
+
 ElementPtr
 CfgSubnets6::toElement() const {
     ElementPtr result = Element::createList();
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <asiolink/io_address.h>
+#include <dhcp/classify.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcpsrv/cfgmgr.h>
@@ -92,10 +93,14 @@ CfgMgr::commit() {
 
     ensureCurrentAllocated();
 
-    // First we need to remove statistics. The new configuration can have fewer
-    // subnets. Also, it may change subnet-ids. So we need to remove them all
-    // and add it back.
-    configuration_->removeStatistics();
+    // Publish the client class names interned by the parsers before the
+    // new configuration is used.
+    ClientClassIndex::commit();
+
+    // Keep the previous configuration: the new configuration can have fewer
+    // subnets or change subnet-ids, so the statistics are updated from the
+    // differences between them.
+    SrvConfigPtr previous = configuration_;
 
     if (!configs_.back()->sequenceEquals(*configuration_)) {
         configuration_ = configs_.back();
@@ -112,8 +117,9 @@ CfgMgr::commit() {
     auto now = boost::posix_time::second_clock::universal_time();
     configuration_->setLastCommitTime(now);
 
-    // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    // Now we need to set the statistics back. Only the lease statistics
+    // of the added or modified subnets are recounted.
+    configuration_->updateStatistics(*previous);
 }
 
 void
@@ -197,6 +203,7 @@ CfgMgr::mergeIntoCurrentCfg(const uint32_t seq) {
         // First we need to remove statistics.
         getCurrentCfg()->removeStatistics();
         mergeIntoCfg(getCurrentCfg(), seq);
+        ClientClassIndex::commit();
 
     } catch (...) {
         // Make sure the statistics is updated even if the merge failed.
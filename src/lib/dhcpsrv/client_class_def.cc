@@ -21,7 +21,8 @@ namespace dhcp {
 ClientClassDef::ClientClassDef(const std::string& name,
                                const ExpressionPtr& match_expr,
                                const CfgOptionPtr& cfg_option)
-    : name_(name), match_expr_(match_expr), required_(false),
+    : name_(name), match_expr_(match_expr), compiled_match_expr_(),
+      match_operands_(), required_options_(), required_(false),
       depend_on_known_(false), cfg_option_(cfg_option),
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()) {
 
@@ -30,8 +31,13 @@ ClientClassDef::ClientClassDef(const std::string& name,
         isc_throw(BadValue, "Client Class name cannot be blank");
     }
 
+    // Intern the name so membership tests of configured classes are
+    // bit tests.
+    ClientClassIndex::intern(name_);
+
     // We permit an empty expression for now.  This will likely be useful
     // for automatic classes such as vendor class.
+    prepareMatchExpr();
 
     // For classes without options, make sure we have an empty collection
     if (!cfg_option_) {
@@ -40,13 +46,16 @@ ClientClassDef::ClientClassDef(const std::string& name,
 }
 
 ClientClassDef::ClientClassDef(const ClientClassDef& rhs)
-    : name_(rhs.name_), match_expr_(ExpressionPtr()), required_(false),
+    : name_(rhs.name_), match_expr_(ExpressionPtr()),
+      compiled_match_expr_(), match_operands_(), required_options_(),
+      required_(false),
       depend_on_known_(false), cfg_option_(new CfgOption()),
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()) {
 
     if (rhs.match_expr_) {
         match_expr_.reset(new Expression());
         *match_expr_ = *(rhs.match_expr_);
+        prepareMatchExpr();
     }
 
     if (rhs.cfg_option_def_) {
@@ -75,6 +84,7 @@ ClientClassDef::getName() const {
 void
 ClientClassDef::setName(const std::string& name) {
     name_ = name;
+    ClientClassIndex::intern(name_);
 }
 
 const ExpressionPtr&
@@ -85,6 +95,79 @@ ClientClassDef::getMatchExpr() const {
 void
 ClientClassDef::setMatchExpr(const ExpressionPtr& match_expr) {
     match_expr_ = match_expr;
+    prepareMatchExpr();
+}
+
+const CompiledExpressionPtr&
+ClientClassDef::getCompiledMatchExpr() const {
+    return (compiled_match_expr_);
+}
+
+void
+ClientClassDef::prepareMatchExpr() {
+    compiled_match_expr_ = CompiledExpression::compile(match_expr_);
+    match_operands_.clear();
+    required_options_.clear();
+    if (!match_expr_) {
+        return;
+    }
+
+    std::set<uint16_t> codes;
+    getRequiredOptions(match_expr_, codes);
+    required_options_.assign(codes.cbegin(), codes.cend());
+
+    std::vector<ExpressionPtr> operands = splitConjunction(match_expr_);
+    for (auto operand : operands) {
+        MatchOperand match_operand;
+        match_operand.expr_ = operand;
+        if (operand == match_expr_) {
+            match_operand.compiled_ = compiled_match_expr_;
+        } else {
+            match_operand.compiled_ = CompiledExpression::compile(operand);
+        }
+        if (!dependOnAnyClass(operand)) {
+            match_operand.key_ = getExpressionKey(operand);
+        }
+        match_operands_.push_back(match_operand);
+    }
+}
+
+bool
+ClientClassDef::evaluateMatchExpr(Pkt& pkt, EvalCache& cache) const {
+    if (match_operands_.empty()) {
+        return (false);
+    }
+
+    // Skip the evaluation when a required option is absent.
+    for (auto code : required_options_) {
+        if (!pkt.getOption(code)) {
+            return (false);
+        }
+    }
+
+    for (auto operand = match_operands_.cbegin();
+         operand != match_operands_.cend(); ++operand) {
+        bool status = false;
+        if (!operand->key_.empty()) {
+            auto cached = cache.find(operand->key_);
+            if (cached != cache.end()) {
+                status = cached->second;
+            } else {
+                status = (operand->compiled_ ?
+                          operand->compiled_->evaluateBool(pkt) :
+                          evaluateBool(*operand->expr_, pkt));
+                cache[operand->key_] = status;
+            }
+        } else {
+            status = (operand->compiled_ ?
+                      operand->compiled_->evaluateBool(pkt) :
+                      evaluateBool(*operand->expr_, pkt));
+        }
+        if (!status) {
+            return (false);
+        }
+    }
+    return (true);
 }
 
 std::string
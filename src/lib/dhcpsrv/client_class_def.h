@@ -11,6 +11,8 @@
 #include <cc/user_context.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfg_option_def.h>
+#include <eval/compiled_expression.h>
+#include <eval/evaluate.h>
 #include <eval/token.h>
 #include <exceptions/exceptions.h>
 
@@ -76,6 +78,29 @@ public:
     /// @param match_expr the expression to assign the class
     void setMatchExpr(const ExpressionPtr& match_expr);
 
+    /// @brief Fetches the compiled version of the class's match expression
+    ///
+    /// @return Pointer to the compiled expression or null pointer when
+    /// there is no match expression or it can't be compiled. In the latter
+    /// case the match expression must be evaluated by the interpreter.
+    const CompiledExpressionPtr& getCompiledMatchExpr() const;
+
+    /// @brief Evaluates the class's match expression for a packet
+    ///
+    /// The expression is not evaluated when an option it requires (see
+    /// @c getRequiredOptions) is absent from the packet. Otherwise the
+    /// operands of its top level and operators are evaluated in order
+    /// until one of them is false. The value of an operand which doesn't
+    /// depend on other classes is stored in the cache, so an identical
+    /// operand of another class is not evaluated again for this packet.
+    ///
+    /// @param pkt the packet being classified
+    /// @param cache the results already evaluated for this packet
+    /// @return true when the packet belongs to the class, false otherwise
+    /// (including when there is no match expression)
+    /// @throw EvalTypeError or EvalBadStack when the evaluation fails
+    bool evaluateMatchExpr(Pkt& pkt, EvalCache& cache) const;
+
     /// @brief Fetches the class's original match expression
     std::string getTest() const;
 
@@ -203,6 +228,37 @@ private:
     /// this class.
     ExpressionPtr match_expr_;
 
+    /// @brief Prepares the match expression for the evaluation
+    ///
+    /// Compiles the match expression, computes the options it requires
+    /// and splits it into the operands of its top level and operators.
+    void prepareMatchExpr();
+
+    /// @brief The match expression compiled for the faster evaluation.
+    CompiledExpressionPtr compiled_match_expr_;
+
+    /// @brief An operand of the top level and operators of the match
+    /// expression.
+    struct MatchOperand {
+        /// @brief The operand.
+        ExpressionPtr expr_;
+
+        /// @brief The compiled operand (null if it can't be compiled).
+        CompiledExpressionPtr compiled_;
+
+        /// @brief The key of the operand in the evaluation cache or
+        /// empty when the operand depends on a class.
+        std::string key_;
+    };
+
+    /// @brief The operands of the top level and operators of the match
+    /// expression.
+    std::vector<MatchOperand> match_operands_;
+
+    /// @brief The options which must be present for the match expression
+    /// to evaluate to true.
+    std::vector<uint16_t> required_options_;
+
     /// @brief The original expression which determines membership in
     /// this class.
     std::string test_;
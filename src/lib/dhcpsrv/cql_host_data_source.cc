@@ -2401,17 +2401,19 @@ CqlHostDataSourceImpl::insertOrDelete(const HostPtr& host, bool insert) {
     }
 
     // Get option space names and vendor space names and combine them within a
-    // single list.
+    // single list. The const accessors are used so no option configuration
+    // is created for a host without options.
+    ConstHostPtr const_host(host);
 
     // For IPv4:
-    ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
+    ConstCfgOptionPtr cfg_option4 = const_host->getCfgOption4();
     std::list<std::string> option_spaces4 = cfg_option4->getOptionSpaceNames();
     std::list<std::string> vendor_spaces4 = cfg_option4->getVendorIdsSpaceNames();
     option_spaces4.insert(option_spaces4.end(), vendor_spaces4.begin(),
                           vendor_spaces4.end());
 
     // For IPv6:
-    ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
+    ConstCfgOptionPtr cfg_option6 = const_host->getCfgOption6();
     std::list<std::string> option_spaces6 = cfg_option6->getOptionSpaceNames();
     std::list<std::string> vendor_spaces6 = cfg_option6->getVendorIdsSpaceNames();
     option_spaces6.insert(option_spaces6.end(), vendor_spaces6.begin(),
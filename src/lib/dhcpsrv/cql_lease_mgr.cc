@@ -37,6 +37,26 @@ namespace dhcp {
 
 static constexpr size_t HOSTNAME_MAX_LEN = 255u;
 static constexpr size_t ADDRESS6_TEXT_MAX_LEN = 39u;
+
+/// @brief Number of token ranges into which full table scans are split
+///
+/// The ranges are queried concurrently so a scan is served by all the
+/// nodes of the ring instead of a single coordinator.
+static constexpr size_t SCAN_TOKEN_RANGES = 64u;
+
+/// @brief Returns the bound values for a scan split into token ranges
+///
+/// @param ranges token ranges which must outlive the returned arrays
+/// @return arrays of lower and upper bound, one per range
+static std::vector<AnyArray>
+tokenRangeValues(std::vector<CqlTokenRange>& ranges) {
+    std::vector<AnyArray> data(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        data[i].add(&ranges[i].first);
+        data[i].add(&ranges[i].second);
+    }
+    return (data);
+}
 static constexpr char NULL_USER_CONTEXT[] = "";
 
 /// @brief Common CQL and Lease Data Methods
@@ -190,6 +210,15 @@ public:
     void getLeaseCollection(StatementTag &statement_tag, AnyArray &data,
                             Lease4Collection &result);
 
+    /// @brief Retrieves zero or more IPv4 leases with concurrent queries
+    ///
+    /// @param statement_tag query to be executed
+    /// @param data parameters for each execution of the query
+    /// @param result this lease collection will be updated
+    void getLeaseCollection(StatementTag &statement_tag,
+                            const std::vector<AnyArray> &data,
+                            Lease4Collection &result);
+
     /// @brief Retrieves one IPv4 lease
     ///
     /// @param statement_tag query to be executed
@@ -321,13 +350,15 @@ StatementMap CqlLease4Exchange::tagged_statements_{
       "ALLOW FILTERING "
      }},
 
-     // Gets an IPv4 lease(s)
+     // Gets the IPv4 leases within a token range
      {GET_LEASE4,
       {GET_LEASE4,
        "SELECT "
        "address, hwaddr, client_id, valid_lifetime, expire, subnet_id, "
        "fqdn_fwd, fqdn_rev, hostname, state, user_context "
        "FROM lease4 "
+       "WHERE TOKEN(address) >= ? "
+       "AND TOKEN(address) <= ? "
      }},
 
     // Gets an IPv4 lease with specified IPv4 address
@@ -788,6 +819,19 @@ CqlLease4Exchange::getLeaseCollection(StatementTag &statement_tag, AnyArray &dat
     }
 }
 
+void
+CqlLease4Exchange::getLeaseCollection(StatementTag &statement_tag,
+                                      const std::vector<AnyArray> &data,
+                                      Lease4Collection &result) {
+    AnyArray collection = executeSelectConcurrently(connection_, data,
+                                                    statement_tag);
+
+    // Transfer Lease4 objects to result.
+    for (boost::any &element : collection) {
+        result.push_back(boost::any_cast<Lease4Ptr>(element));
+    }
+}
+
 void
 CqlLease4Exchange::getLease(StatementTag &statement_tag, AnyArray &data,
                             Lease4Ptr &result) {
@@ -1782,6 +1826,12 @@ public:
     void executeSelect(const CqlConnection& connection, const AnyArray& data,
                        StatementTag statement_tag);
 
+    /// @brief Adds a row of raw lease data to the aggregated lease counts
+    ///
+    /// @param row row returned by the lease statistics SELECT statement
+    /// @param statement_tag prepared statement being executed
+    void aggregateRow(const CassRow* row, StatementTag statement_tag);
+
     /// @brief Fetches the next row in the result set
     ///
     /// Once the internal result set has been populated by invoking the
@@ -1861,12 +1911,14 @@ constexpr StatementTag CqlLeaseStatsQuery::SUBNET_LEASE6_STATS;
 constexpr StatementTag CqlLeaseStatsQuery::SUBNET_RANGE_LEASE6_STATS;
 
 StatementMap CqlLeaseStatsQuery::tagged_statements_{
-    // Return subnet_id and state of each v4 lease
+    // Return subnet_id and state of each v4 lease within a token range
     {ALL_LEASE4_STATS,
         {ALL_LEASE4_STATS,
         "SELECT "
         "subnet_id, state "
         "FROM lease4 "
+        "WHERE TOKEN(address) >= ? "
+        "AND TOKEN(address) <= ? "
     }},
 
     // Return state of each v4 lease for a single subnet
@@ -1888,12 +1940,15 @@ StatementMap CqlLeaseStatsQuery::tagged_statements_{
         "ALLOW FILTERING "
     }},
 
-    // Return subnet_id, lease_type, and state of each v6 lease
+    // Return subnet_id, lease_type, and state of each v6 lease within
+    // a token range
     {ALL_LEASE6_STATS,
         {ALL_LEASE6_STATS,
         "SELECT "
         "subnet_id, lease_type, state "
         "FROM lease6 "
+        "WHERE TOKEN(address) >= ? "
+        "AND TOKEN(address) <= ? "
     }},
 
     // Return type and state of each v6 lease for a single subnet
@@ -1930,12 +1985,23 @@ CqlLeaseStatsQuery::start() {
             last_subnet_id_data = static_cast<cass_int32_t>(last_subnet_id_);
             data.add(&last_subnet_id_data);
         }
-    }
 
-    // This gets a collection of "raw" data for all leases that match
-    // the subnet selection criteria (all, range, or single subnets)
-    // then rolls them up into cummulative_rows_
-    executeSelect(conn_, data, statement_);
+        // This gets a collection of "raw" data for all leases that match
+        // the subnet selection criteria (range or single subnets)
+        // then rolls them up into cummulative_rows_
+        executeSelect(conn_, data, statement_);
+    } else {
+        // All the leases are read: split the scan into token ranges
+        // queried concurrently and roll the rows up as they arrive.
+        std::vector<CqlTokenRange> ranges =
+            CqlCommon::splitTokenRing(SCAN_TOKEN_RANGES);
+        StatementTag statement_tag = statement_;
+        CqlCommon::executeSelectConcurrently(conn_, tokenRangeValues(ranges),
+                                             statement_tag,
+                                             [this, statement_tag](const CassRow* row) {
+            aggregateRow(row, statement_tag);
+        });
+    }
 
     // Set our row iterator to the beginning
     next_row_ = cummulative_rows_.begin();
@@ -2054,34 +2120,11 @@ CqlLeaseStatsQuery::executeSelect(const CqlConnection& connection, const AnyArra
     // Get column values.
     const CassResult* result_collection = cass_future_get_result(future);
 
-    // lease type is always NA for v4
-    if (!fetch_type_)  {
-        lease_type_ = Lease::TYPE_NA;
-    }
-
     // Since we're currently forced to pull data for all leases, we
     // iterate over them, aggregating them into cummulative LeaseStatsRows
-    AnyArray return_values;
     CassIterator* rows = cass_iterator_from_result(result_collection);
     while (cass_iterator_next(rows)) {
-        const CassRow* row = cass_iterator_get_row(rows);
-        createBindForSelect(return_values, statement_tag);
-        CqlCommon::getData(row, return_values);
-
-        if (state_ != Lease::STATE_DEFAULT &&
-            state_ != Lease::STATE_DECLINED) {
-            continue;
-        }
-
-        LeaseStatsRow raw_row(subnet_id_, static_cast<Lease::Type>(lease_type_),
-                              state_, 1);
-
-        auto cum_row = cummulative_rows_.find(raw_row);
-        if (cum_row != cummulative_rows_.end()) {
-            cummulative_rows_[raw_row] = cum_row->second + 1;
-        } else {
-            cummulative_rows_.insert(std::make_pair(raw_row, 1));
-        }
+        aggregateRow(cass_iterator_get_row(rows), statement_tag);
     }
 
     // Free resources.
@@ -2092,6 +2135,33 @@ CqlLeaseStatsQuery::executeSelect(const CqlConnection& connection, const AnyArra
     return;
 }
 
+void
+CqlLeaseStatsQuery::aggregateRow(const CassRow* row, StatementTag statement_tag) {
+    AnyArray return_values;
+    createBindForSelect(return_values, statement_tag);
+    CqlCommon::getData(row, return_values);
+
+    // lease type is always NA for v4
+    if (!fetch_type_)  {
+        lease_type_ = Lease::TYPE_NA;
+    }
+
+    if (state_ != Lease::STATE_DEFAULT &&
+        state_ != Lease::STATE_DECLINED) {
+        return;
+    }
+
+    LeaseStatsRow raw_row(subnet_id_, static_cast<Lease::Type>(lease_type_),
+                          state_, 1);
+
+    auto cum_row = cummulative_rows_.find(raw_row);
+    if (cum_row != cummulative_rows_.end()) {
+        cummulative_rows_[raw_row] = cum_row->second + 1;
+    } else {
+        cummulative_rows_.insert(std::make_pair(raw_row, 1));
+    }
+}
+
 CqlLeaseMgr::CqlLeaseMgr(const DatabaseConnection::ParameterMap &parameters)
     : parameters_(parameters), dbconn_(parameters) {
     // Validate the schema version first.
@@ -2337,8 +2407,9 @@ Lease4Collection
 CqlLeaseMgr::getLeases4() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET4);
 
-    // Set up the WHERE clause value
-    AnyArray data;
+    // Set up the WHERE clause values: one token range per query.
+    std::vector<CqlTokenRange> ranges = CqlCommon::splitTokenRing(SCAN_TOKEN_RANGES);
+    std::vector<AnyArray> data = tokenRangeValues(ranges);
 
     // Get the data.
     Lease4Collection result;
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -55,12 +55,12 @@ public:
     /// This function doesn't throw exceptions itself. In theory, exceptions
     /// are possible when the index of the indexes of the values being written
     /// to the file are invalid. However, this would have been a programming
-    /// error.
+    /// error. It is virtual so as it may be customized in derived classes.
     ///
     /// @param lease Structure representing a DHCPv4 lease.
     /// @throw BadValue if the lease has no hardware address, no client id and
     /// is not in STATE_DECLINED.
-    void append(const Lease4& lease);
+    virtual void append(const Lease4& lease);
 
     /// @brief Reads next lease from the CSV file.
     ///
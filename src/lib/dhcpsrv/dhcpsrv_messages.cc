@@ -1,4 +1,4 @@
-// File created from ../../../src/lib/dhcpsrv/dhcpsrv_messages.mes on Thu Dec 05 2019 16:13
+// File created from ../../../src/lib/dhcpsrv/dhcpsrv_messages.mes on Sun Oct 18 2026 11:50
 
 #include <cstddef>
 #include <log/message_types.h>
@@ -147,6 +147,8 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_NEEDS_DOWNGRADING = "DHCPSRV_ME
 extern const isc::log::MessageID DHCPSRV_MEMFILE_NEEDS_UPGRADING = "DHCPSRV_MEMFILE_NEEDS_UPGRADING";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_NO_STORAGE = "DHCPSRV_MEMFILE_NO_STORAGE";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_READ_HWADDR_FAIL = "DHCPSRV_MEMFILE_READ_HWADDR_FAIL";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_RECLAIM_LEASES4 = "DHCPSRV_MEMFILE_RECLAIM_LEASES4";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_RECLAIM_LEASES6 = "DHCPSRV_MEMFILE_RECLAIM_LEASES6";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_ROLLBACK = "DHCPSRV_MEMFILE_ROLLBACK";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_UPDATE_ADDR4 = "DHCPSRV_MEMFILE_UPDATE_ADDR4";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_UPDATE_ADDR6 = "DHCPSRV_MEMFILE_UPDATE_ADDR6";
@@ -157,6 +159,7 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_WIPE_LEASES6_FINISHED = "DHCPSR
 extern const isc::log::MessageID DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE = "DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE";
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR4 = "DHCPSRV_MYSQL_ADD_ADDR4";
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR6 = "DHCPSRV_MYSQL_ADD_ADDR6";
+extern const isc::log::MessageID DHCPSRV_MYSQL_ALLOCATE_ADDR4 = "DHCPSRV_MYSQL_ALLOCATE_ADDR4";
 extern const isc::log::MessageID DHCPSRV_MYSQL_BEGIN_TRANSACTION = "DHCPSRV_MYSQL_BEGIN_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_MYSQL_COMMIT = "DHCPSRV_MYSQL_COMMIT";
 extern const isc::log::MessageID DHCPSRV_MYSQL_DB = "DHCPSRV_MYSQL_DB";
@@ -188,6 +191,8 @@ extern const isc::log::MessageID DHCPSRV_MYSQL_GET_VERSION = "DHCPSRV_MYSQL_GET_
 extern const isc::log::MessageID DHCPSRV_MYSQL_HOST_DB = "DHCPSRV_MYSQL_HOST_DB";
 extern const isc::log::MessageID DHCPSRV_MYSQL_HOST_DB_GET_VERSION = "DHCPSRV_MYSQL_HOST_DB_GET_VERSION";
 extern const isc::log::MessageID DHCPSRV_MYSQL_HOST_DB_READONLY = "DHCPSRV_MYSQL_HOST_DB_READONLY";
+extern const isc::log::MessageID DHCPSRV_MYSQL_RECLAIM_LEASES4 = "DHCPSRV_MYSQL_RECLAIM_LEASES4";
+extern const isc::log::MessageID DHCPSRV_MYSQL_RECLAIM_LEASES6 = "DHCPSRV_MYSQL_RECLAIM_LEASES6";
 extern const isc::log::MessageID DHCPSRV_MYSQL_ROLLBACK = "DHCPSRV_MYSQL_ROLLBACK";
 extern const isc::log::MessageID DHCPSRV_MYSQL_START_TRANSACTION = "DHCPSRV_MYSQL_START_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_ADDR4 = "DHCPSRV_MYSQL_UPDATE_ADDR4";
@@ -197,6 +202,7 @@ extern const isc::log::MessageID DHCPSRV_NO_SOCKETS_OPEN = "DHCPSRV_NO_SOCKETS_O
 extern const isc::log::MessageID DHCPSRV_OPEN_SOCKET_FAIL = "DHCPSRV_OPEN_SOCKET_FAIL";
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR4 = "DHCPSRV_PGSQL_ADD_ADDR4";
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR6 = "DHCPSRV_PGSQL_ADD_ADDR6";
+extern const isc::log::MessageID DHCPSRV_PGSQL_ALLOCATE_ADDR4 = "DHCPSRV_PGSQL_ALLOCATE_ADDR4";
 extern const isc::log::MessageID DHCPSRV_PGSQL_BEGIN_TRANSACTION = "DHCPSRV_PGSQL_BEGIN_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_PGSQL_COMMIT = "DHCPSRV_PGSQL_COMMIT";
 extern const isc::log::MessageID DHCPSRV_PGSQL_DB = "DHCPSRV_PGSQL_DB";
@@ -228,6 +234,8 @@ extern const isc::log::MessageID DHCPSRV_PGSQL_GET_VERSION = "DHCPSRV_PGSQL_GET_
 extern const isc::log::MessageID DHCPSRV_PGSQL_HOST_DB = "DHCPSRV_PGSQL_HOST_DB";
 extern const isc::log::MessageID DHCPSRV_PGSQL_HOST_DB_GET_VERSION = "DHCPSRV_PGSQL_HOST_DB_GET_VERSION";
 extern const isc::log::MessageID DHCPSRV_PGSQL_HOST_DB_READONLY = "DHCPSRV_PGSQL_HOST_DB_READONLY";
+extern const isc::log::MessageID DHCPSRV_PGSQL_RECLAIM_LEASES4 = "DHCPSRV_PGSQL_RECLAIM_LEASES4";
+extern const isc::log::MessageID DHCPSRV_PGSQL_RECLAIM_LEASES6 = "DHCPSRV_PGSQL_RECLAIM_LEASES6";
 extern const isc::log::MessageID DHCPSRV_PGSQL_ROLLBACK = "DHCPSRV_PGSQL_ROLLBACK";
 extern const isc::log::MessageID DHCPSRV_PGSQL_START_TRANSACTION = "DHCPSRV_PGSQL_START_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_PGSQL_UPDATE_ADDR4 = "DHCPSRV_PGSQL_UPDATE_ADDR4";
@@ -235,6 +243,7 @@ extern const isc::log::MessageID DHCPSRV_PGSQL_UPDATE_ADDR6 = "DHCPSRV_PGSQL_UPD
 extern const isc::log::MessageID DHCPSRV_QUEUE_NCR = "DHCPSRV_QUEUE_NCR";
 extern const isc::log::MessageID DHCPSRV_QUEUE_NCR_FAILED = "DHCPSRV_QUEUE_NCR_FAILED";
 extern const isc::log::MessageID DHCPSRV_QUEUE_NCR_SKIP = "DHCPSRV_QUEUE_NCR_SKIP";
+extern const isc::log::MessageID DHCPSRV_READ_REPLICA_UNREGISTER_TIMER_FAILED = "DHCPSRV_READ_REPLICA_UNREGISTER_TIMER_FAILED";
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_CALLBACK_FAILED = "DHCPSRV_TIMERMGR_CALLBACK_FAILED";
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_REGISTER_TIMER = "DHCPSRV_TIMERMGR_REGISTER_TIMER";
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_RUN_TIMER_OPERATION = "DHCPSRV_TIMERMGR_RUN_TIMER_OPERATION";
@@ -244,6 +253,12 @@ extern const isc::log::MessageID DHCPSRV_TIMERMGR_UNREGISTER_ALL_TIMERS = "DHCPS
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_UNREGISTER_TIMER = "DHCPSRV_TIMERMGR_UNREGISTER_TIMER";
 extern const isc::log::MessageID DHCPSRV_UNEXPECTED_NAME = "DHCPSRV_UNEXPECTED_NAME";
 extern const isc::log::MessageID DHCPSRV_UNKNOWN_DB = "DHCPSRV_UNKNOWN_DB";
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_DB = "DHCPSRV_WRITE_BEHIND_DB";
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_FLUSH = "DHCPSRV_WRITE_BEHIND_FLUSH";
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_FLUSH_FAILED = "DHCPSRV_WRITE_BEHIND_FLUSH_FAILED";
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_JOURNAL_READ_ERROR = "DHCPSRV_WRITE_BEHIND_JOURNAL_READ_ERROR";
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_LOADED = "DHCPSRV_WRITE_BEHIND_LOADED";
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_REPLAY = "DHCPSRV_WRITE_BEHIND_REPLAY";
 
 } // namespace dhcp
 } // namespace isc
@@ -391,6 +406,8 @@ const char* values[] = {
     "DHCPSRV_MEMFILE_NEEDS_UPGRADING", "version of lease file: %1 schema is earlier than version %2",
     "DHCPSRV_MEMFILE_NO_STORAGE", "running in non-persistent mode, leases will be lost after restart",
     "DHCPSRV_MEMFILE_READ_HWADDR_FAIL", "failed to read hardware address from lease file: %1",
+    "DHCPSRV_MEMFILE_RECLAIM_LEASES4", "writing a batch of reclaimed IPv4 leases: %1 to update, %2 to delete",
+    "DHCPSRV_MEMFILE_RECLAIM_LEASES6", "writing a batch of reclaimed IPv6 leases: %1 to update, %2 to delete",
     "DHCPSRV_MEMFILE_ROLLBACK", "rolling back memory file database",
     "DHCPSRV_MEMFILE_UPDATE_ADDR4", "updating IPv4 lease for address %1",
     "DHCPSRV_MEMFILE_UPDATE_ADDR6", "updating IPv6 lease for address %1",
@@ -401,6 +418,7 @@ const char* values[] = {
     "DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE", "current configuration will result in opening multiple broadcast capable sockets on some interfaces and some DHCP messages may be duplicated",
     "DHCPSRV_MYSQL_ADD_ADDR4", "adding IPv4 lease with address %1",
     "DHCPSRV_MYSQL_ADD_ADDR6", "adding IPv6 lease with address %1, lease type %2",
+    "DHCPSRV_MYSQL_ALLOCATE_ADDR4", "allocating or renewing IPv4 lease with address %1",
     "DHCPSRV_MYSQL_BEGIN_TRANSACTION", "committing to MySQL database",
     "DHCPSRV_MYSQL_COMMIT", "committing to MySQL database",
     "DHCPSRV_MYSQL_DB", "opening MySQL lease database: %1",
@@ -432,6 +450,8 @@ const char* values[] = {
     "DHCPSRV_MYSQL_HOST_DB", "opening MySQL hosts database: %1",
     "DHCPSRV_MYSQL_HOST_DB_GET_VERSION", "obtaining schema version information for the MySQL hosts database",
     "DHCPSRV_MYSQL_HOST_DB_READONLY", "MySQL host database opened for read access only",
+    "DHCPSRV_MYSQL_RECLAIM_LEASES4", "writing a batch of reclaimed IPv4 leases: %1 to update, %2 to delete",
+    "DHCPSRV_MYSQL_RECLAIM_LEASES6", "writing a batch of reclaimed IPv6 leases: %1 to update, %2 to delete",
     "DHCPSRV_MYSQL_ROLLBACK", "rolling back MySQL database",
     "DHCPSRV_MYSQL_START_TRANSACTION", "starting new MySQL transaction",
     "DHCPSRV_MYSQL_UPDATE_ADDR4", "updating IPv4 lease for address %1",
@@ -441,6 +461,7 @@ const char* values[] = {
     "DHCPSRV_OPEN_SOCKET_FAIL", "failed to open socket: %1",
     "DHCPSRV_PGSQL_ADD_ADDR4", "adding IPv4 lease with address %1",
     "DHCPSRV_PGSQL_ADD_ADDR6", "adding IPv6 lease with address %1, lease type %2",
+    "DHCPSRV_PGSQL_ALLOCATE_ADDR4", "allocating or renewing IPv4 lease with address %1",
     "DHCPSRV_PGSQL_BEGIN_TRANSACTION", "committing to PostgreSQL database",
     "DHCPSRV_PGSQL_COMMIT", "committing to PostgreSQL database",
     "DHCPSRV_PGSQL_DB", "opening PostgreSQL lease database: %1",
@@ -472,6 +493,8 @@ const char* values[] = {
     "DHCPSRV_PGSQL_HOST_DB", "opening PostgreSQL hosts database: %1",
     "DHCPSRV_PGSQL_HOST_DB_GET_VERSION", "obtaining schema version information for the PostgreSQL hosts database",
     "DHCPSRV_PGSQL_HOST_DB_READONLY", "PostgreSQL host database opened for read access only",
+    "DHCPSRV_PGSQL_RECLAIM_LEASES4", "writing a batch of reclaimed IPv4 leases: %1 to update, %2 to delete",
+    "DHCPSRV_PGSQL_RECLAIM_LEASES6", "writing a batch of reclaimed IPv6 leases: %1 to update, %2 to delete",
     "DHCPSRV_PGSQL_ROLLBACK", "rolling back PostgreSQL database",
     "DHCPSRV_PGSQL_START_TRANSACTION", "starting a new PostgreSQL transaction",
     "DHCPSRV_PGSQL_UPDATE_ADDR4", "updating IPv4 lease for address %1",
@@ -479,6 +502,7 @@ const char* values[] = {
     "DHCPSRV_QUEUE_NCR", "%1: name change request to %2 DNS entry queued: %3",
     "DHCPSRV_QUEUE_NCR_FAILED", "%1: queuing %2 name change request failed for lease %3: %4",
     "DHCPSRV_QUEUE_NCR_SKIP", "%1: skip queuing name change request for lease: %2",
+    "DHCPSRV_READ_REPLICA_UNREGISTER_TIMER_FAILED", "failed to unregister timer '%1': %2",
     "DHCPSRV_TIMERMGR_CALLBACK_FAILED", "running handler for timer %1 caused exception: %2",
     "DHCPSRV_TIMERMGR_REGISTER_TIMER", "registering timer: %1, using interval: %2 ms",
     "DHCPSRV_TIMERMGR_RUN_TIMER_OPERATION", "running operation for timer: %1",
@@ -488,6 +512,12 @@ const char* values[] = {
     "DHCPSRV_TIMERMGR_UNREGISTER_TIMER", "unregistering timer: %1",
     "DHCPSRV_UNEXPECTED_NAME", "database access parameters passed through '%1', expected 'lease-database'",
     "DHCPSRV_UNKNOWN_DB", "unknown database type: %1",
+    "DHCPSRV_WRITE_BEHIND_DB", "opening write-behind lease cache with the write-back latency of %1 ms and the journal %2",
+    "DHCPSRV_WRITE_BEHIND_FLUSH", "writing %1 lease updates to the lease database",
+    "DHCPSRV_WRITE_BEHIND_FLUSH_FAILED", "failed to write %1 lease updates to the lease database: %2",
+    "DHCPSRV_WRITE_BEHIND_JOURNAL_READ_ERROR", "skipping an invalid lease update in the journal %1: %2",
+    "DHCPSRV_WRITE_BEHIND_LOADED", "loaded %1 leases from the lease database in the write-behind lease cache",
+    "DHCPSRV_WRITE_BEHIND_REPLAY", "writing %1 lease updates found in the journal %2 to the lease database",
     NULL
 };
 
@@ -1,4 +1,4 @@
-// File created from ../../../src/lib/dhcpsrv/dhcpsrv_messages.mes on Thu Dec 05 2019 16:13
+// File created from ../../../src/lib/dhcpsrv/dhcpsrv_messages.mes on Sun Oct 18 2026 11:50
 
 #ifndef DHCPSRV_MESSAGES_H
 #define DHCPSRV_MESSAGES_H
@@ -148,6 +148,8 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_NEEDS_DOWNGRADING;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_NEEDS_UPGRADING;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_NO_STORAGE;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_READ_HWADDR_FAIL;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_RECLAIM_LEASES4;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_RECLAIM_LEASES6;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_ROLLBACK;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_UPDATE_ADDR4;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_UPDATE_ADDR6;
@@ -158,6 +160,7 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_WIPE_LEASES6_FINISHED;
 extern const isc::log::MessageID DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE;
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR6;
+extern const isc::log::MessageID DHCPSRV_MYSQL_ALLOCATE_ADDR4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_BEGIN_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_MYSQL_COMMIT;
 extern const isc::log::MessageID DHCPSRV_MYSQL_DB;
@@ -189,6 +192,8 @@ extern const isc::log::MessageID DHCPSRV_MYSQL_GET_VERSION;
 extern const isc::log::MessageID DHCPSRV_MYSQL_HOST_DB;
 extern const isc::log::MessageID DHCPSRV_MYSQL_HOST_DB_GET_VERSION;
 extern const isc::log::MessageID DHCPSRV_MYSQL_HOST_DB_READONLY;
+extern const isc::log::MessageID DHCPSRV_MYSQL_RECLAIM_LEASES4;
+extern const isc::log::MessageID DHCPSRV_MYSQL_RECLAIM_LEASES6;
 extern const isc::log::MessageID DHCPSRV_MYSQL_ROLLBACK;
 extern const isc::log::MessageID DHCPSRV_MYSQL_START_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_ADDR4;
@@ -198,6 +203,7 @@ extern const isc::log::MessageID DHCPSRV_NO_SOCKETS_OPEN;
 extern const isc::log::MessageID DHCPSRV_OPEN_SOCKET_FAIL;
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR4;
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR6;
+extern const isc::log::MessageID DHCPSRV_PGSQL_ALLOCATE_ADDR4;
 extern const isc::log::MessageID DHCPSRV_PGSQL_BEGIN_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_PGSQL_COMMIT;
 extern const isc::log::MessageID DHCPSRV_PGSQL_DB;
@@ -229,6 +235,8 @@ extern const isc::log::MessageID DHCPSRV_PGSQL_GET_VERSION;
 extern const isc::log::MessageID DHCPSRV_PGSQL_HOST_DB;
 extern const isc::log::MessageID DHCPSRV_PGSQL_HOST_DB_GET_VERSION;
 extern const isc::log::MessageID DHCPSRV_PGSQL_HOST_DB_READONLY;
+extern const isc::log::MessageID DHCPSRV_PGSQL_RECLAIM_LEASES4;
+extern const isc::log::MessageID DHCPSRV_PGSQL_RECLAIM_LEASES6;
 extern const isc::log::MessageID DHCPSRV_PGSQL_ROLLBACK;
 extern const isc::log::MessageID DHCPSRV_PGSQL_START_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_PGSQL_UPDATE_ADDR4;
@@ -236,6 +244,7 @@ extern const isc::log::MessageID DHCPSRV_PGSQL_UPDATE_ADDR6;
 extern const isc::log::MessageID DHCPSRV_QUEUE_NCR;
 extern const isc::log::MessageID DHCPSRV_QUEUE_NCR_FAILED;
 extern const isc::log::MessageID DHCPSRV_QUEUE_NCR_SKIP;
+extern const isc::log::MessageID DHCPSRV_READ_REPLICA_UNREGISTER_TIMER_FAILED;
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_CALLBACK_FAILED;
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_REGISTER_TIMER;
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_RUN_TIMER_OPERATION;
@@ -245,6 +254,12 @@ extern const isc::log::MessageID DHCPSRV_TIMERMGR_UNREGISTER_ALL_TIMERS;
 extern const isc::log::MessageID DHCPSRV_TIMERMGR_UNREGISTER_TIMER;
 extern const isc::log::MessageID DHCPSRV_UNEXPECTED_NAME;
 extern const isc::log::MessageID DHCPSRV_UNKNOWN_DB;
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_DB;
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_FLUSH;
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_FLUSH_FAILED;
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_JOURNAL_READ_ERROR;
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_LOADED;
+extern const isc::log::MessageID DHCPSRV_WRITE_BEHIND_REPLAY;
 
 } // namespace dhcp
 } // namespace isc
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -154,8 +154,7 @@ Host::Host(const uint8_t* identifier, const size_t identifier_len,
       dhcp6_client_classes_(dhcp6_client_classes),
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()),
       server_host_name_(server_host_name), boot_file_name_(boot_file_name),
-      host_id_(0), cfg_option4_(new CfgOption()),
-      cfg_option6_(new CfgOption()), negative_(false),
+      host_id_(0), cfg_option4_(), cfg_option6_(), negative_(false),
       key_(auth_key) {
 
     // Initialize host identifier.
@@ -190,8 +189,7 @@ Host::Host(const std::string& identifier, const std::string& identifier_name,
       dhcp6_client_classes_(dhcp6_client_classes),
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()),
       server_host_name_(server_host_name), boot_file_name_(boot_file_name),
-      host_id_(0), cfg_option4_(new CfgOption()),
-      cfg_option6_(new CfgOption()), negative_(false),
+      host_id_(0), cfg_option4_(), cfg_option6_(), negative_(false),
       key_(auth_key) {
 
     // Initialize host identifier.
@@ -440,6 +438,12 @@ Host::addClientClassInternal(ClientClasses& classes,
     }
 }
 
+const ConstCfgOptionPtr&
+Host::getEmptyCfgOption() {
+    static const ConstCfgOptionPtr empty(new CfgOption());
+    return (empty);
+}
+
 void
 Host::setNextServer(const asiolink::IOAddress& next_server) {
     if (!next_server.isV4()) {
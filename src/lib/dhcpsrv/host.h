@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,6 +21,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -636,30 +637,64 @@ public:
     /// this host.
     ///
     /// Returned pointer can be used to add, remove and update options
-    /// reserved for a host.
+    /// reserved for a host. The option data configuration is created
+    /// when first needed.
     CfgOptionPtr getCfgOption4() {
+        if (!cfg_option4_) {
+            cfg_option4_.reset(new CfgOption());
+        }
         return (cfg_option4_);
     }
 
     /// @brief Returns const pointer to the DHCPv4 option data configuration for
     /// this host.
+    ///
+    /// When the host has no option data configuration a shared empty
+    /// configuration is returned.
     ConstCfgOptionPtr getCfgOption4() const {
-        return (cfg_option4_);
+        return (cfg_option4_ ? cfg_option4_ : getEmptyCfgOption());
     }
 
     /// @brief Returns pointer to the DHCPv6 option data configuration for
     /// this host.
     ///
     /// Returned pointer can be used to add, remove and update options
-    /// reserved for a host.
+    /// reserved for a host. The option data configuration is created
+    /// when first needed.
     CfgOptionPtr getCfgOption6() {
+        if (!cfg_option6_) {
+            cfg_option6_.reset(new CfgOption());
+        }
         return (cfg_option6_);
     }
 
     /// @brief Returns const pointer to the DHCPv6 option data configuration for
     /// this host.
+    ///
+    /// When the host has no option data configuration a shared empty
+    /// configuration is returned.
     ConstCfgOptionPtr getCfgOption6() const {
-        return (cfg_option6_);
+        return (cfg_option6_ ? cfg_option6_ : getEmptyCfgOption());
+    }
+
+    /// @brief Checks if the host has DHCPv4 options.
+    ///
+    /// Unlike the non-const @c getCfgOption4 it never creates the option
+    /// data configuration.
+    ///
+    /// @return true if the host has at least one DHCPv4 option.
+    bool hasOptions4() const {
+        return (cfg_option4_ && !cfg_option4_->empty());
+    }
+
+    /// @brief Checks if the host has DHCPv6 options.
+    ///
+    /// Unlike the non-const @c getCfgOption6 it never creates the option
+    /// data configuration.
+    ///
+    /// @return true if the host has at least one DHCPv6 option.
+    bool hasOptions6() const {
+        return (cfg_option6_ && !cfg_option6_->empty());
     }
 
     /// @brief Returns information about the host in the textual format.
@@ -731,6 +766,10 @@ private:
     void addClientClassInternal(ClientClasses& classes,
                                 const std::string& class_name);
 
+    /// @brief Returns the empty option data configuration shared by the
+    /// hosts without options.
+    static const ConstCfgOptionPtr& getEmptyCfgOption();
+
     /// @brief Identifier type.
     IdentifierType identifier_type_;
     /// @brief Vector holding identifier value.
@@ -761,8 +800,14 @@ private:
     uint64_t host_id_;
 
     /// @brief Pointer to the DHCPv4 option data configuration for this host.
+    ///
+    /// Null until options are added: most hosts have no options and
+    /// large reservation sets would otherwise hold many empty
+    /// configurations.
     CfgOptionPtr cfg_option4_;
     /// @brief Pointer to the DHCPv6 option data configuration for this host.
+    ///
+    /// Null until options are added.
     CfgOptionPtr cfg_option6_;
 
     /// @brief Negative cached flag.
@@ -793,6 +838,12 @@ typedef std::vector<ConstHostPtr> ConstHostCollection;
 /// @brief Collection of the @c Host objects.
 typedef std::vector<HostPtr> HostCollection;
 
+/// @brief A pair holding host identifier type and value.
+typedef std::pair<Host::IdentifierType, std::vector<uint8_t> > HostIdentifier;
+
+/// @brief List of host identifiers in the order of preference.
+typedef std::list<HostIdentifier> HostIdentifierList;
+
 }
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -38,8 +38,11 @@ typedef boost::multi_index_container<
         // First index is used to search for the host using one of the
         // identifiers, i.e. HW address or DUID. The elements of this
         // index are non-unique because there may be multiple reservations
-        // for the same host belonging to a different subnets.
-        boost::multi_index::ordered_non_unique<
+        // for the same host belonging to a different subnets. The index
+        // is hashed as it is only used for exact lookups: this avoids
+        // the identifier comparisons of an ordered index when a large
+        // number of reservations is configured.
+        boost::multi_index::hashed_non_unique<
             // The index comprises actual identifier (HW address or DUID) in
             // a binary form and a type of the identifier which indicates
             // that it is HW address or DUID.
@@ -91,8 +94,10 @@ typedef boost::multi_index_container<
         >,
 
         // Sixth index is used to search for the host using hostname
-        // (case-sensitive compare so the key is in lower case).
-        boost::multi_index::ordered_non_unique<
+        // (case-sensitive compare so the key is in lower case). The index
+        // is hashed so the key is computed once per insertion or lookup
+        // instead of once per comparison.
+        boost::multi_index::hashed_non_unique<
             // Index using values returned by the @c Host::getLowerHostname
             boost::multi_index::const_mem_fun<Host, std::string,
                                               &Host::getLowerHostname>
@@ -103,7 +108,8 @@ typedef boost::multi_index_container<
 /// @brief First index type in the @c HostContainer.
 ///
 /// This index allows for searching for @c Host objects using an
-/// identifier + identifier type tuple.
+/// identifier + identifier type tuple. As it is hashed the order of
+/// the hosts is unspecified.
 typedef HostContainer::nth_index<0>::type HostContainerIndex0;
 
 /// @brief Results range returned using the @c HostContainerIndex0.
@@ -152,8 +158,13 @@ typedef std::pair<HostContainerIndex4::iterator,
 /// @brief Sixth index type in the @c HostContainer.
 ///
 /// This index allows for searching for @c Host objects using a hostname.
+/// As it is hashed the order of the hosts is unspecified.
 typedef HostContainer::nth_index<5>::type HostContainerIndex5;
 
+/// @brief Results range returned using the @c HostContainerIndex5.
+typedef std::pair<HostContainerIndex5::iterator,
+                  HostContainerIndex5::iterator> HostContainerIndex5Range;
+
 /// @brief Defines one entry for the Host Container for v6 hosts
 ///
 /// It's essentially a pair of (IPv6 reservation, Host pointer).
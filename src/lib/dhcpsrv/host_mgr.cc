@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,6 +23,24 @@ isc::dhcp::ConstCfgHostsPtr getCfgHosts() {
     return (isc::dhcp::CfgMgr::instance().getCurrentCfg()->getCfgHosts());
 }
 
+/// @brief Returns the host using a specified identifier from a collection.
+///
+/// @param hosts Collection of hosts.
+/// @param identifier Identifier type and value.
+///
+/// @return The host or null pointer if no host uses the identifier.
+isc::dhcp::ConstHostPtr
+findHost(const isc::dhcp::ConstHostCollection& hosts,
+         const isc::dhcp::HostIdentifier& identifier) {
+    for (auto const& host : hosts) {
+        if ((host->getIdentifierType() == identifier.first) &&
+            (host->getIdentifier() == identifier.second)) {
+            return (host);
+        }
+    }
+    return (isc::dhcp::ConstHostPtr());
+}
+
 } // end of anonymous namespace
 
 namespace isc {
@@ -309,6 +327,65 @@ HostMgr::get4(const SubnetID& subnet_id,
     return (host);
 }
 
+ConstHostPtr
+HostMgr::get4(const SubnetID& subnet_id,
+              const HostIdentifierList& identifiers) const {
+    // Hosts returned by the alternate sources queried so far, in the
+    // order of the sources. A source is queried at most once, and only
+    // when the sources before it have no host for an identifier.
+    std::vector<ConstHostCollection> results;
+    for (auto const& id : identifiers) {
+        ConstHostPtr host = getCfgHosts()->get4(subnet_id, id.first,
+                                                &id.second[0],
+                                                id.second.size());
+        if (!host && !alternate_sources_.empty()) {
+            // The sources are used in the same order as by get4Any, the
+            // host cache when configured being the first one.
+            for (size_t i = 0; i < alternate_sources_.size(); ++i) {
+                if (i == results.size()) {
+                    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
+                              HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIERS)
+                        .arg(subnet_id)
+                        .arg(identifiers.size())
+                        .arg(alternate_sources_[i]->getType());
+                    results.push_back(alternate_sources_[i]->
+                                      getByIdentifiers4(subnet_id, identifiers));
+                }
+                host = findHost(results[i], id);
+                if (host) {
+                    LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                              HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER_HOST)
+                        .arg(subnet_id)
+                        .arg(Host::getIdentifierAsText(id.first, &id.second[0],
+                                                       id.second.size()))
+                        .arg(alternate_sources_[i]->getType())
+                        .arg(host->toText());
+
+                    if (alternate_sources_[i] != cache_ptr_) {
+                        cache(host);
+                    }
+                    break;
+                }
+            }
+            if (!host) {
+                LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                          HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER_NULL)
+                    .arg(subnet_id)
+                    .arg(Host::getIdentifierAsText(id.first, &id.second[0],
+                                                   id.second.size()));
+            }
+        }
+
+        if (host && !host->getNegative()) {
+            return (host);
+        } else if (!host && negative_caching_) {
+            cacheNegative(subnet_id, SubnetID(SUBNET_ID_UNUSED),
+                          id.first, &id.second[0], id.second.size());
+        }
+    }
+    return (ConstHostPtr());
+}
+
 ConstHostPtr
 HostMgr::get4(const SubnetID& subnet_id,
               const asiolink::IOAddress& address) const {
@@ -423,6 +500,65 @@ HostMgr::get6(const SubnetID& subnet_id,
     return (host);
 }
 
+ConstHostPtr
+HostMgr::get6(const SubnetID& subnet_id,
+              const HostIdentifierList& identifiers) const {
+    // Hosts returned by the alternate sources queried so far, in the
+    // order of the sources. A source is queried at most once, and only
+    // when the sources before it have no host for an identifier.
+    std::vector<ConstHostCollection> results;
+    for (auto const& id : identifiers) {
+        ConstHostPtr host = getCfgHosts()->get6(subnet_id, id.first,
+                                                &id.second[0],
+                                                id.second.size());
+        if (!host && !alternate_sources_.empty()) {
+            // The sources are used in the same order as by get6Any, the
+            // host cache when configured being the first one.
+            for (size_t i = 0; i < alternate_sources_.size(); ++i) {
+                if (i == results.size()) {
+                    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
+                              HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIERS)
+                        .arg(subnet_id)
+                        .arg(identifiers.size())
+                        .arg(alternate_sources_[i]->getType());
+                    results.push_back(alternate_sources_[i]->
+                                      getByIdentifiers6(subnet_id, identifiers));
+                }
+                host = findHost(results[i], id);
+                if (host) {
+                    LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                              HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_HOST)
+                        .arg(subnet_id)
+                        .arg(Host::getIdentifierAsText(id.first, &id.second[0],
+                                                       id.second.size()))
+                        .arg(alternate_sources_[i]->getType())
+                        .arg(host->toText());
+
+                    if (alternate_sources_[i] != cache_ptr_) {
+                        cache(host);
+                    }
+                    break;
+                }
+            }
+            if (!host) {
+                LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                          HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL)
+                    .arg(subnet_id)
+                    .arg(Host::getIdentifierAsText(id.first, &id.second[0],
+                                                   id.second.size()));
+            }
+        }
+
+        if (host && !host->getNegative()) {
+            return (host);
+        } else if (!host && negative_caching_) {
+            cacheNegative(SubnetID(SUBNET_ID_UNUSED), subnet_id,
+                          id.first, &id.second[0], id.second.size());
+        }
+    }
+    return (ConstHostPtr());
+}
+
 ConstHostPtr
 HostMgr::get6(const SubnetID& subnet_id,
               const asiolink::IOAddress& addr) const {
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -323,6 +323,26 @@ public:
     virtual ConstHostPtr
     get4(const SubnetID& subnet_id, const asiolink::IOAddress& address) const;
 
+    /// @brief Returns a host connected to the IPv4 subnet using the
+    /// preferred identifier of a client.
+    ///
+    /// This method returns the same host as calling @c get4 for each
+    /// identifier in turn until a host is found, but each alternate host
+    /// data source is queried at most once for all identifiers using
+    /// @c BaseHostDataSource::getByIdentifiers4. The sources are queried
+    /// in turn: a source is queried only when the sources before it, e.g.
+    /// the host cache, have no host for an identifier. The hosts specified
+    /// in the configuration file take precedence over the hosts from the
+    /// alternate sources for the same identifier.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Const @c Host object for which reservation has been made using
+    /// the first possible identifier.
+    virtual ConstHostPtr
+    get4(const SubnetID& subnet_id, const HostIdentifierList& identifiers) const;
+
     /// @brief Returns any host connected to the IPv6 subnet.
     ///
     /// This method returns a host connected to the IPv6 subnet as described
@@ -382,6 +402,26 @@ public:
     virtual ConstHostPtr
     get6(const SubnetID& subnet_id, const asiolink::IOAddress& addr) const;
 
+    /// @brief Returns a host connected to the IPv6 subnet using the
+    /// preferred identifier of a client.
+    ///
+    /// This method returns the same host as calling @c get6 for each
+    /// identifier in turn until a host is found, but each alternate host
+    /// data source is queried at most once for all identifiers using
+    /// @c BaseHostDataSource::getByIdentifiers6. The sources are queried
+    /// in turn: a source is queried only when the sources before it, e.g.
+    /// the host cache, have no host for an identifier. The hosts specified
+    /// in the configuration file take precedence over the hosts from the
+    /// alternate sources for the same identifier.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Const @c Host object for which reservation has been made using
+    /// the first possible identifier.
+    virtual ConstHostPtr
+    get6(const SubnetID& subnet_id, const HostIdentifierList& identifiers) const;
+
     /// @brief Adds a new host to the alternate data source.
     ///
     /// This method will throw an exception if no alternate data source is
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <exceptions/exceptions.h>
@@ -61,6 +62,96 @@ LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
     return (*col.begin());
 }
 
+Lease4Collection
+LeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                         const Lease4Collection& deleted) {
+    Lease4Collection skipped;
+    for (auto lease : updated) {
+        try {
+            updateLease4(lease);
+        } catch (const NoSuchLease&) {
+            skipped.push_back(lease);
+        }
+    }
+    for (auto lease : deleted) {
+        if (!deleteLease(lease)) {
+            skipped.push_back(lease);
+        }
+    }
+    return (skipped);
+}
+
+Lease6Collection
+LeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                         const Lease6Collection& deleted) {
+    Lease6Collection skipped;
+    for (auto lease : updated) {
+        try {
+            updateLease6(lease);
+        } catch (const NoSuchLease&) {
+            skipped.push_back(lease);
+        }
+    }
+    for (auto lease : deleted) {
+        if (!deleteLease(lease)) {
+            skipped.push_back(lease);
+        }
+    }
+    return (skipped);
+}
+
+bool
+LeaseMgr::allocateOrRenewLease4(const Lease4Ptr& lease, Lease4Ptr& old_lease) {
+    old_lease = getLease4(lease->addr_);
+    if (!old_lease) {
+        if (addLease(lease)) {
+            return (true);
+        }
+        // Another server has just added a lease for this address.
+        old_lease = getLease4(lease->addr_);
+        return (false);
+    }
+
+    if (!old_lease->expired() &&
+        !old_lease->belongsToClient(lease->hwaddr_, lease->client_id_)) {
+        return (false);
+    }
+
+    // The update must match the lease which has just been fetched.
+    lease->old_cltt_ = old_lease->cltt_;
+    lease->old_valid_lft_ = old_lease->valid_lft_;
+    try {
+        updateLease4(lease);
+    } catch (const NoSuchLease&) {
+        old_lease = getLease4(lease->addr_);
+        return (false);
+    }
+    return (true);
+}
+
+bool
+LeaseMgr::isReclaimSkipped(const Lease4Ptr& lease, const bool deleted) const {
+    Lease4Ptr current = getLease4(lease->addr_);
+    if (!current) {
+        return (!deleted);
+    }
+    // A lease written by the batch still has the expiration time it had
+    // when it was fetched. A deleted lease which is still there was
+    // renewed in the meantime.
+    return (deleted || (current->cltt_ != lease->old_cltt_) ||
+            (current->valid_lft_ != lease->old_valid_lft_));
+}
+
+bool
+LeaseMgr::isReclaimSkipped(const Lease6Ptr& lease, const bool deleted) const {
+    Lease6Ptr current = getLease6(lease->type_, lease->addr_);
+    if (!current) {
+        return (!deleted);
+    }
+    return (deleted || (current->cltt_ != lease->old_cltt_) ||
+            (current->valid_lft_ != lease->old_valid_lft_));
+}
+
 void
 LeaseMgr::recountLeaseStats4() {
     using namespace stats;
@@ -90,6 +181,7 @@ LeaseMgr::recountLeaseStats4() {
         stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
                                                   "assigned-addresses"),
                            zero);
+        (*subnet)->setAssignedLeasesHint(Lease::TYPE_V4, zero);
 
         stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
                                                   "declined-addresses"),
@@ -113,6 +205,13 @@ LeaseMgr::recountLeaseStats4() {
             stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
                                                       "assigned-addresses"),
                                row.state_count_);
+
+            // Seed the utilization hint used by the allocation engine.
+            ConstSubnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                getCfgSubnets4()->getBySubnetId(row.subnet_id_);
+            if (subnet) {
+                subnet->setAssignedLeasesHint(Lease::TYPE_V4, row.state_count_);
+            }
         } else if (row.lease_state_ == Lease::STATE_DECLINED) {
             // Set subnet level value.
             stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
@@ -125,6 +224,84 @@ LeaseMgr::recountLeaseStats4() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats4(const std::set<SubnetID>& subnet_ids) {
+    using namespace stats;
+
+    if (subnet_ids.empty()) {
+        return;
+    }
+
+    // A single query is run: the range query returns the rows of the
+    // subnets in between too, they are skipped below.
+    LeaseStatsQueryPtr query;
+    if (subnet_ids.size() == 1) {
+        query = startSubnetLeaseStatsQuery4(*subnet_ids.begin());
+    } else {
+        query = startSubnetRangeLeaseStatsQuery4(*subnet_ids.begin(),
+                                                 *subnet_ids.rbegin());
+    }
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    ConstCfgSubnets4Ptr cfg_subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+
+    int64_t zero = 0;
+    for (auto subnet_id : subnet_ids) {
+        // Take the declined addresses of the subnet out of the global value,
+        // they are added back below.
+        const std::string declined_name =
+            StatsMgr::generateName("subnet", subnet_id, "declined-addresses");
+        ObservationPtr declined = stats_mgr.getObservation(declined_name);
+        if (declined) {
+            stats_mgr.addValue("declined-addresses",
+                               -declined->getInteger().first);
+        }
+
+        // Clear subnet level stats.
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "assigned-addresses"),
+                           zero);
+        stats_mgr.setValue(declined_name, zero);
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-declined-addresses"),
+                           zero);
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-leases"),
+                           zero);
+
+        ConstSubnet4Ptr subnet = cfg_subnets->getBySubnetId(subnet_id);
+        if (subnet) {
+            subnet->setAssignedLeasesHint(Lease::TYPE_V4, zero);
+        }
+    }
+
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        if (subnet_ids.count(row.subnet_id_) == 0) {
+            continue;
+        }
+        if (row.lease_state_ == Lease::STATE_DEFAULT) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "assigned-addresses"),
+                               row.state_count_);
+            ConstSubnet4Ptr subnet = cfg_subnets->getBySubnetId(row.subnet_id_);
+            if (subnet) {
+                subnet->setAssignedLeasesHint(Lease::TYPE_V4, row.state_count_);
+            }
+        } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "declined-addresses"),
+                               row.state_count_);
+            stats_mgr.addValue("declined-addresses", row.state_count_);
+        }
+    }
+}
+
 LeaseStatsQuery::LeaseStatsQuery()
     : first_subnet_id_(0), last_subnet_id_(0), select_mode_(ALL_SUBNETS) {
 }
@@ -210,6 +387,7 @@ LeaseMgr::recountLeaseStats6() {
         stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
                                                   "assigned-nas"),
                            zero);
+        (*subnet)->setAssignedLeasesHint(Lease::TYPE_NA, zero);
 
         stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
                                                   "declined-addresses"),
@@ -223,6 +401,7 @@ LeaseMgr::recountLeaseStats6() {
         stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
                                                   "assigned-pds"),
                            zero);
+        (*subnet)->setAssignedLeasesHint(Lease::TYPE_PD, zero);
 
         stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
                                                   "reclaimed-leases"),
@@ -233,6 +412,17 @@ LeaseMgr::recountLeaseStats6() {
     // updating the subnet and global values.
     LeaseStatsRow row;
     while (query->getNextRow(row)) {
+        // Seed the utilization hints used by the allocation engine.
+        if (row.lease_state_ == Lease::STATE_DEFAULT &&
+            (row.lease_type_ == Lease::TYPE_NA ||
+             row.lease_type_ == Lease::TYPE_PD)) {
+            ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                getCfgSubnets6()->getBySubnetId(row.subnet_id_);
+            if (subnet) {
+                subnet->setAssignedLeasesHint(row.lease_type_, row.state_count_);
+            }
+        }
+
         switch(row.lease_type_) {
             case Lease::TYPE_NA:
                 if (row.lease_state_ == Lease::STATE_DEFAULT) {
@@ -270,6 +460,101 @@ LeaseMgr::recountLeaseStats6() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats6(const std::set<SubnetID>& subnet_ids) {
+    using namespace stats;
+
+    if (subnet_ids.empty()) {
+        return;
+    }
+
+    // A single query is run: the range query returns the rows of the
+    // subnets in between too, they are skipped below.
+    LeaseStatsQueryPtr query;
+    if (subnet_ids.size() == 1) {
+        query = startSubnetLeaseStatsQuery6(*subnet_ids.begin());
+    } else {
+        query = startSubnetRangeLeaseStatsQuery6(*subnet_ids.begin(),
+                                                 *subnet_ids.rbegin());
+    }
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    ConstCfgSubnets6Ptr cfg_subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets6();
+
+    int64_t zero = 0;
+    for (auto subnet_id : subnet_ids) {
+        // Take the declined addresses of the subnet out of the global value,
+        // they are added back below.
+        const std::string declined_name =
+            StatsMgr::generateName("subnet", subnet_id, "declined-addresses");
+        ObservationPtr declined = stats_mgr.getObservation(declined_name);
+        if (declined) {
+            stats_mgr.addValue("declined-addresses",
+                               -declined->getInteger().first);
+        }
+
+        // Clear subnet level stats.
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "assigned-nas"),
+                           zero);
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "assigned-pds"),
+                           zero);
+        stats_mgr.setValue(declined_name, zero);
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-declined-addresses"),
+                           zero);
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-leases"),
+                           zero);
+
+        ConstSubnet6Ptr subnet = cfg_subnets->getBySubnetId(subnet_id);
+        if (subnet) {
+            subnet->setAssignedLeasesHint(Lease::TYPE_NA, zero);
+            subnet->setAssignedLeasesHint(Lease::TYPE_PD, zero);
+        }
+    }
+
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        if (subnet_ids.count(row.subnet_id_) == 0) {
+            continue;
+        }
+        if (row.lease_state_ == Lease::STATE_DEFAULT) {
+            if (row.lease_type_ == Lease::TYPE_NA) {
+                stats_mgr.setValue(StatsMgr::
+                                   generateName("subnet", row.subnet_id_,
+                                                "assigned-nas"),
+                                   row.state_count_);
+            } else if (row.lease_type_ == Lease::TYPE_PD) {
+                stats_mgr.setValue(StatsMgr::
+                                   generateName("subnet", row.subnet_id_,
+                                                "assigned-pds"),
+                                   row.state_count_);
+            } else {
+                // We dont' support TYPE_TAs yet
+                continue;
+            }
+            ConstSubnet6Ptr subnet = cfg_subnets->getBySubnetId(row.subnet_id_);
+            if (subnet) {
+                subnet->setAssignedLeasesHint(row.lease_type_,
+                                              row.state_count_);
+            }
+        } else if ((row.lease_state_ == Lease::STATE_DECLINED) &&
+                   (row.lease_type_ == Lease::TYPE_NA)) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "declined-addresses"),
+                               row.state_count_);
+            stats_mgr.addValue("declined-addresses", row.state_count_);
+        }
+    }
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -563,6 +564,83 @@ public:
     ///        failed.
     virtual bool deleteLease(const Lease6Ptr& lease) = 0;
 
+    /// @brief Writes a batch of reclaimed IPv4 leases.
+    ///
+    /// This method is called by the leases reclamation routine to store
+    /// the outcome of the reclamation of several leases at once. The leases
+    /// of the @c updated collection have already been moved to the
+    /// "expired-reclaimed" state: only their state, hostname and FQDN
+    /// flags are written. The leases of the @c deleted collection are
+    /// removed. A lease which has been renewed or removed since it was
+    /// fetched is left unchanged and is returned to the caller.
+    ///
+    /// The default implementation updates or deletes the leases one by one.
+    /// The SQL backends override it to write a batch with a few multi-row
+    /// statements.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection reclaimLeases4(const Lease4Collection& updated,
+                                            const Lease4Collection& deleted);
+
+    /// @brief Writes a batch of reclaimed IPv6 leases.
+    ///
+    /// See @ref reclaimLeases4 for the details.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection reclaimLeases6(const Lease6Collection& updated,
+                                            const Lease6Collection& deleted);
+
+    /// @brief Allocates or renews an IPv4 lease.
+    ///
+    /// The lease is added when there is no lease for its address. The
+    /// existing lease is replaced when it is expired or when it belongs
+    /// to the client, i.e. @c Lease4::belongsToClient returns true for
+    /// the HW address and client identifier of the new lease. Otherwise
+    /// the address is in use by another client and nothing is written.
+    ///
+    /// The default implementation fetches the existing lease and then
+    /// adds or updates the lease. The SQL backends override it to call a
+    /// stored procedure doing the lookup and the write in a single round
+    /// trip to the database.
+    ///
+    /// @param lease The lease to be written.
+    /// @param [out] old_lease The lease found for the address before it
+    /// was written, or the conflicting lease when nothing was written.
+    /// Null when the lease has been added.
+    ///
+    /// @return true if the lease has been written, false if the address
+    /// is in use by another client.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual bool allocateOrRenewLease4(const Lease4Ptr& lease,
+                                       Lease4Ptr& old_lease);
+
+    /// @brief Checks if the allocation engine should use
+    /// @ref allocateOrRenewLease4.
+    ///
+    /// The allocation engine uses this method in place of the separate
+    /// lookup and write only when it saves round trips to the database,
+    /// which is the case for the SQL backends configured with the
+    /// "allocate-or-renew" parameter.
+    ///
+    /// @return false unless overridden by the backend.
+    virtual bool isAllocateOrRenewEnabled() const {
+        return (false);
+    }
+
     /// @brief Deletes all expired and reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -602,6 +680,31 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates per-subnet stats for IPv4 leases of some subnets
+    ///
+    /// This method is used instead of @ref recountLeaseStats4() when the
+    /// server is reconfigured: only the subnets which were added or modified
+    /// are recounted. A single query is run: @ref startSubnetLeaseStatsQuery4()
+    /// for one subnet, @ref startSubnetRangeLeaseStatsQuery4() from the lowest
+    /// to the highest subnet identifier otherwise, skipping the rows of the
+    /// subnets in between which are not in the set. It recalculates the
+    /// following statistics:
+    /// per-subnet:
+    /// - assigned-addresses
+    /// - declined-addresses
+    /// - reclaimed-declined-addresses (reset to zero)
+    /// - reclaimed-leases (reset to zero)
+    /// global:
+    /// - declined-addresses (adjusted by the difference)
+    ///
+    /// The global declined-addresses statistic already accounts for the
+    /// leases of the subnets which were not configured before, so it is
+    /// only adjusted for the subnets which had statistics. The other global
+    /// statistics are left unchanged.
+    ///
+    /// @param subnet_ids identifiers of the subnets to be recounted.
+    void recountLeaseStats4(const std::set<SubnetID>& subnet_ids);
+
     /// @brief Creates and runs the IPv4 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -659,6 +762,22 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates per-subnet stats for IPv6 leases of some subnets
+    ///
+    /// This is the IPv6 version of @ref recountLeaseStats4(const std::set<SubnetID>&).
+    /// It recalculates the following statistics:
+    /// per-subnet:
+    /// - assigned-nas
+    /// - assigned-pds
+    /// - declined-addresses
+    /// - reclaimed-declined-addresses (reset to zero)
+    /// - reclaimed-leases (reset to zero)
+    /// global:
+    /// - declined-addresses (adjusted by the difference)
+    ///
+    /// @param subnet_ids identifiers of the subnets to be recounted.
+    void recountLeaseStats6(const std::set<SubnetID>& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -763,6 +882,29 @@ public:
     /// support transactions, this is a no-op.
     virtual void rollback() = 0;
 
+protected:
+
+    /// @brief Checks if a lease of a reclaimed batch was skipped.
+    ///
+    /// The multi-row statements only return the number of leases which
+    /// were written. When a part of a batch was skipped this method is
+    /// called for each lease of the batch to find out which ones: the lease
+    /// is fetched again and is considered skipped if it was renewed or,
+    /// for an updated lease, removed.
+    ///
+    /// @param lease Lease of the batch.
+    /// @param deleted true if the lease was to be deleted.
+    ///
+    /// @return true if the lease was skipped.
+    bool isReclaimSkipped(const Lease4Ptr& lease, const bool deleted) const;
+
+    /// @brief Checks if a lease of a reclaimed batch was skipped.
+    ///
+    /// @param lease Lease of the batch.
+    /// @param deleted true if the lease was to be deleted.
+    ///
+    /// @return true if the lease was skipped.
+    bool isReclaimSkipped(const Lease6Ptr& lease, const bool deleted) const;
 };
 
 }  // namespace dhcp
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
+#include <dhcpsrv/write_behind_lease_mgr.h>
 #ifdef HAVE_MYSQL
 #include <dhcpsrv/mysql_lease_mgr.h>
 #endif
@@ -35,6 +36,28 @@ using namespace std;
 namespace isc {
 namespace dhcp {
 
+namespace {
+
+/// @brief Puts the write-behind cache in front of a lease manager when
+/// the "write-behind-cache" parameter is set.
+///
+/// @param parameters Database access parameters.
+/// @param lease_mgr The lease manager of the lease database.
+///
+/// @return The cache or the lease manager.
+LeaseMgr*
+cacheLeaseMgr(const DatabaseConnection::ParameterMap& parameters,
+              LeaseMgr* lease_mgr) {
+    auto cache = parameters.find("write-behind-cache");
+    if ((cache == parameters.end()) || (cache->second != "true")) {
+        return (lease_mgr);
+    }
+    boost::shared_ptr<LeaseMgr> backend(lease_mgr);
+    return (new WriteBehindLeaseMgr(parameters, backend));
+}
+
+} // end of anonymous namespace
+
 boost::scoped_ptr<LeaseMgr>&
 LeaseMgrFactory::getLeaseMgrPtr() {
     static boost::scoped_ptr<LeaseMgr> leaseMgrPtr;
@@ -56,12 +79,19 @@ LeaseMgrFactory::create(const std::string& dbaccess) {
                   "contain the 'type' keyword");
     }
 
+    // The write-behind cache serves all queries from memory and loads the
+    // leases from the primary database, so the read replicas are not used.
+    auto cache = parameters.find("write-behind-cache");
+    if ((cache != parameters.end()) && (cache->second == "true")) {
+        parameters.erase("read-replicas");
+    }
 
     // Yes, check what it is.
     if (parameters[type] == string("mysql")) {
 #ifdef HAVE_MYSQL
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new MySqlLeaseMgr(parameters));
+        getLeaseMgrPtr().reset(cacheLeaseMgr(parameters,
+                                             new MySqlLeaseMgr(parameters)));
         return;
 #else
         LOG_ERROR(dhcpsrv_logger, DHCPSRV_UNKNOWN_DB).arg("mysql");
@@ -73,7 +103,8 @@ LeaseMgrFactory::create(const std::string& dbaccess) {
     if (parameters[type] == string("postgresql")) {
 #ifdef HAVE_PGSQL
         LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new PgSqlLeaseMgr(parameters));
+        getLeaseMgrPtr().reset(cacheLeaseMgr(parameters,
+                                             new PgSqlLeaseMgr(parameters)));
         return;
 #else
         LOG_ERROR(dhcpsrv_logger, DHCPSRV_UNKNOWN_DB).arg("postgresql");
@@ -17,6 +17,7 @@
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <util/trace_mgr.h>
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
@@ -670,6 +671,21 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
     mutex_.reset(new std::mutex);
 }
 
+Memfile_LeaseMgr::Memfile_LeaseMgr()
+    : LeaseMgr(), lfc_setup_(), conn_(DatabaseConnection::ParameterMap()),
+      mutex_(new std::mutex) {
+}
+
+void
+Memfile_LeaseMgr::setLeaseFile(const boost::shared_ptr<CSVLeaseFile4>& lease_file) {
+    lease_file4_ = lease_file;
+}
+
+void
+Memfile_LeaseMgr::setLeaseFile(const boost::shared_ptr<CSVLeaseFile6>& lease_file) {
+    lease_file6_ = lease_file;
+}
+
 Memfile_LeaseMgr::~Memfile_LeaseMgr() {
     if (lease_file4_) {
         lease_file4_->close();
@@ -709,6 +725,8 @@ Memfile_LeaseMgr::addLeaseInternal(const Lease4Ptr& lease) {
 
 bool
 Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
+    ScopedTrace trace("lease-add");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR4).arg(lease->addr_.toText());
 
@@ -740,6 +758,8 @@ Memfile_LeaseMgr::addLeaseInternal(const Lease6Ptr& lease) {
 
 bool
 Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
+    ScopedTrace trace("lease-add");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR6).arg(lease->addr_.toText());
 
@@ -764,6 +784,8 @@ Memfile_LeaseMgr::getLease4Internal(const isc::asiolink::IOAddress& addr) const
 
 Lease4Ptr
 Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
+    ScopedTrace trace("lease-get", "address");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
 
@@ -793,6 +815,8 @@ Memfile_LeaseMgr::getLease4Internal(const HWAddr& hwaddr,
 
 Lease4Collection
 Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr) const {
+    ScopedTrace trace("lease-get", "hwaddr");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_HWADDR).arg(hwaddr.toText());
 
@@ -828,6 +852,8 @@ Memfile_LeaseMgr::getLease4Internal(const HWAddr& hwaddr,
 Lease4Ptr
 Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr,
                             SubnetID subnet_id) const {
+    ScopedTrace trace("lease-get", "hwaddr");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_SUBID_HWADDR).arg(subnet_id)
         .arg(hwaddr.toText());
@@ -858,6 +884,8 @@ Memfile_LeaseMgr::getLease4Internal(const ClientId& client_id,
 
 Lease4Collection
 Memfile_LeaseMgr::getLease4(const ClientId& client_id) const {
+    ScopedTrace trace("lease-get", "client-id");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_CLIENTID).arg(client_id.toText());
 
@@ -897,6 +925,8 @@ Lease4Ptr
 Memfile_LeaseMgr::getLease4(const ClientId& client_id,
                             const HWAddr& hwaddr,
                             SubnetID subnet_id) const {
+    ScopedTrace trace("lease-get", "client-id");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_CLIENTID_HWADDR_SUBID).arg(client_id.toText())
                                                         .arg(hwaddr.toText())
@@ -930,6 +960,8 @@ Memfile_LeaseMgr::getLease4Internal(const ClientId& client_id,
 Lease4Ptr
 Memfile_LeaseMgr::getLease4(const ClientId& client_id,
                             SubnetID subnet_id) const {
+    ScopedTrace trace("lease-get", "client-id");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_SUBID_CLIENTID).arg(subnet_id)
               .arg(client_id.toText());
@@ -1081,6 +1113,8 @@ Memfile_LeaseMgr::getLease6Internal(Lease::Type type,
 Lease6Ptr
 Memfile_LeaseMgr::getLease6(Lease::Type type,
                             const isc::asiolink::IOAddress& addr) const {
+    ScopedTrace trace("lease-get", "address");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_ADDR6)
         .arg(addr.toText())
@@ -1116,6 +1150,8 @@ Lease6Collection
 Memfile_LeaseMgr::getLeases6(Lease::Type type,
                              const DUID& duid,
                              uint32_t iaid) const {
+    ScopedTrace trace("lease-get", "duid");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_IAID_DUID)
         .arg(iaid)
@@ -1160,6 +1196,8 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
                              const DUID& duid,
                              uint32_t iaid,
                              SubnetID subnet_id) const {
+    ScopedTrace trace("lease-get", "duid");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_IAID_SUBID_DUID)
         .arg(iaid)
@@ -1273,6 +1311,8 @@ Memfile_LeaseMgr::getLeases6Internal(const DUID& duid,
 
 Lease6Collection
 Memfile_LeaseMgr::getLeases6(const DUID& duid) const {
+    ScopedTrace trace("lease-get", "duid");
+
    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET6_DUID)
        .arg(duid.toText());
 
@@ -1429,6 +1469,8 @@ Memfile_LeaseMgr::updateLease4Internal(const Lease4Ptr& lease) {
 
 void
 Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    ScopedTrace trace("lease-update");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR4).arg(lease->addr_.toText());
 
@@ -1465,6 +1507,8 @@ Memfile_LeaseMgr::updateLease6Internal(const Lease6Ptr& lease) {
 
 void
 Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    ScopedTrace trace("lease-update");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR6).arg(lease->addr_.toText());
 
@@ -1504,6 +1548,8 @@ Memfile_LeaseMgr::deleteLeaseInternal(const Lease4Ptr& lease) {
 
 bool
 Memfile_LeaseMgr::deleteLease(const Lease4Ptr& lease) {
+    ScopedTrace trace("lease-delete");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(lease->addr_.toText());
 
@@ -1543,6 +1589,8 @@ Memfile_LeaseMgr::deleteLeaseInternal(const Lease6Ptr& lease) {
 
 bool
 Memfile_LeaseMgr::deleteLease(const Lease6Ptr& lease) {
+    ScopedTrace trace("lease-delete");
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(lease->addr_.toText());
 
@@ -1554,6 +1602,106 @@ Memfile_LeaseMgr::deleteLease(const Lease6Ptr& lease) {
     }
 }
 
+Lease4Collection
+Memfile_LeaseMgr::reclaimLeases4Internal(const Lease4Collection& updated,
+                                         const Lease4Collection& deleted) {
+    Lease4Collection skipped;
+    Lease4StorageAddressIndex& index = storage4_.get<AddressIndexTag>();
+    for (auto lease : updated) {
+        // The reclamation does not change the lifetime so a different
+        // lifetime means that the lease was renewed in the meantime.
+        Lease4StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+        if ((lease_it == index.end()) ||
+            ((*lease_it)->cltt_ != lease->cltt_) ||
+            ((*lease_it)->valid_lft_ != lease->valid_lft_)) {
+            skipped.push_back(lease);
+            continue;
+        }
+        if (persistLeases(V4)) {
+            lease_file4_->append(*lease);
+        }
+        index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    }
+    for (auto lease : deleted) {
+        Lease4StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+        if ((lease_it != index.end()) &&
+            (((*lease_it)->cltt_ != lease->cltt_) ||
+             ((*lease_it)->valid_lft_ != lease->valid_lft_))) {
+            skipped.push_back(lease);
+        } else if (!deleteLeaseInternal(lease)) {
+            skipped.push_back(lease);
+        }
+    }
+    return (skipped);
+}
+
+Lease4Collection
+Memfile_LeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                                 const Lease4Collection& deleted) {
+    ScopedTrace trace("lease-reclaim");
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_RECLAIM_LEASES4)
+        .arg(updated.size())
+        .arg(deleted.size());
+
+    if (MultiThreadingMgr::instance().getMode()) {
+        std::lock_guard<std::mutex> lock(*mutex_);
+        return (reclaimLeases4Internal(updated, deleted));
+    } else {
+        return (reclaimLeases4Internal(updated, deleted));
+    }
+}
+
+Lease6Collection
+Memfile_LeaseMgr::reclaimLeases6Internal(const Lease6Collection& updated,
+                                         const Lease6Collection& deleted) {
+    Lease6Collection skipped;
+    Lease6StorageAddressIndex& index = storage6_.get<AddressIndexTag>();
+    for (auto lease : updated) {
+        Lease6StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+        if ((lease_it == index.end()) ||
+            ((*lease_it)->cltt_ != lease->cltt_) ||
+            ((*lease_it)->valid_lft_ != lease->valid_lft_)) {
+            skipped.push_back(lease);
+            continue;
+        }
+        if (persistLeases(V6)) {
+            lease_file6_->append(*lease);
+        }
+        index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    }
+    for (auto lease : deleted) {
+        Lease6StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+        if ((lease_it != index.end()) &&
+            (((*lease_it)->cltt_ != lease->cltt_) ||
+             ((*lease_it)->valid_lft_ != lease->valid_lft_))) {
+            skipped.push_back(lease);
+        } else if (!deleteLeaseInternal(lease)) {
+            skipped.push_back(lease);
+        }
+    }
+    return (skipped);
+}
+
+Lease6Collection
+Memfile_LeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                                 const Lease6Collection& deleted) {
+    ScopedTrace trace("lease-reclaim");
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_RECLAIM_LEASES6)
+        .arg(updated.size())
+        .arg(deleted.size());
+
+    if (MultiThreadingMgr::instance().getMode()) {
+        std::lock_guard<std::mutex> lock(*mutex_);
+        return (reclaimLeases6Internal(updated, deleted));
+    } else {
+        return (reclaimLeases6Internal(updated, deleted));
+    }
+}
+
 uint64_t
 Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -430,6 +430,27 @@ public:
     /// @return true if deletion was successful, false if no such lease exists.
     virtual bool deleteLease(const Lease6Ptr& lease);
 
+    /// @brief Writes a batch of reclaimed IPv4 leases.
+    ///
+    /// The batch is written with the lock held once. A lease whose
+    /// lifetime changed since it was fetched was renewed and is skipped.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    virtual Lease4Collection reclaimLeases4(const Lease4Collection& updated,
+                                            const Lease4Collection& deleted);
+
+    /// @brief Writes a batch of reclaimed IPv6 leases.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    virtual Lease6Collection reclaimLeases6(const Lease6Collection& updated,
+                                            const Lease6Collection& deleted);
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -468,6 +489,25 @@ public:
     /// @return number of leases removed.
     virtual size_t wipeLeases6(const SubnetID& subnet_id);
 
+protected:
+
+    /// @brief Constructor of an empty lease manager.
+    ///
+    /// It is used by the derived classes which take care of loading and
+    /// storing the leases: it doesn't open any lease file nor set up the
+    /// %Lease File Cleanup.
+    Memfile_LeaseMgr();
+
+    /// @brief Sets the file to which the DHCPv4 lease updates are written.
+    ///
+    /// @param lease_file An object representing the lease file.
+    void setLeaseFile(const boost::shared_ptr<CSVLeaseFile4>& lease_file);
+
+    /// @brief Sets the file to which the DHCPv6 lease updates are written.
+    ///
+    /// @param lease_file An object representing the lease file.
+    void setLeaseFile(const boost::shared_ptr<CSVLeaseFile6>& lease_file);
+
 private:
 
     /// @name Internal methods called holding the mutex in multi threading
@@ -681,6 +721,24 @@ private:
     /// @return true if deletion was successful, false if no such lease exists.
     bool deleteLeaseInternal(const Lease6Ptr& addr);
 
+    /// @brief Writes a batch of reclaimed IPv4 leases.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    Lease4Collection reclaimLeases4Internal(const Lease4Collection& updated,
+                                            const Lease4Collection& deleted);
+
+    /// @brief Writes a batch of reclaimed IPv6 leases.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    Lease6Collection reclaimLeases6Internal(const Lease6Collection& updated,
+                                            const Lease6Collection& deleted);
+
     /// @brief Removes specified IPv4 leases.
     ///
     /// @param subnet_id identifier of the subnet
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <database/db_exceptions.h>
+#include <database/read_replica_set.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option.h>
 #include <dhcp/option_definition.h>
@@ -14,6 +15,7 @@
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/mysql_host_data_source.h>
+#include <dhcpsrv/read_replica_timer.h>
 #include <util/buffer.h>
 #include <util/multi_threading_mgr.h>
 #include <util/optional.h>
@@ -47,6 +49,9 @@ namespace {
 /// a database is within bounds. of supported identifiers.
 const uint8_t MAX_IDENTIFIER_TYPE = static_cast<uint8_t>(Host::LAST_IDENTIFIER_TYPE);
 
+/// @brief Number of identifiers used by the queries by identifiers.
+const size_t IDENTIFIERS_PER_QUERY = 5;
+
 /// @brief This class provides mechanisms for sending and retrieving
 /// information from the 'hosts' table.
 ///
@@ -1997,6 +2002,8 @@ public:
         GET_HOST_ADDR,          // Gets hosts by IPv4 address
         GET_HOST_SUBID4_DHCPID, // Gets host by IPv4 SubnetID, HW address/DUID
         GET_HOST_SUBID6_DHCPID, // Gets host by IPv6 SubnetID, HW address/DUID
+        GET_HOST_SUBID4_DHCPIDS, // Gets hosts by IPv4 SubnetID and identifiers
+        GET_HOST_SUBID6_DHCPIDS, // Gets hosts by IPv6 SubnetID and identifiers
         GET_HOST_SUBID_ADDR,    // Gets host by IPv4 SubnetID and IPv4 address
         GET_HOST_PREFIX,        // Gets host by IPv6 prefix
         GET_HOST_SUBID6_ADDR,   // Gets host by IPv6 SubnetID and IPv6 prefix
@@ -2044,6 +2051,15 @@ public:
     /// failed.
     MySqlHostContextPtr createContext() const;
 
+    /// @brief Create a new context connected to a database.
+    ///
+    /// @param parameters The parameters of the database, e.g. of a read
+    /// replica.
+    ///
+    /// @return A new (never null) context.
+    MySqlHostContextPtr
+    createContext(const DatabaseConnection::ParameterMap& parameters) const;
+
     /// @brief Returns backend version.
     ///
     /// The method is called by the constructor before opening the database
@@ -2184,6 +2200,27 @@ public:
                          StatementIndex stindex,
                          boost::shared_ptr<MySqlHostExchange> exchange) const;
 
+    /// @brief Retrieves hosts by subnet and any of client's identifiers.
+    ///
+    /// This method is used by both MySqlHostDataSource::getByIdentifiers4
+    /// and MySqlHostDataSource::getByIdentifiers6 methods. A query is
+    /// issued for every @c IDENTIFIERS_PER_QUERY identifiers.
+    ///
+    /// @param ctx Context
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers of the client.
+    /// @param stindex Statement index.
+    /// @param exchange Pointer to the exchange object used for the
+    /// particular query.
+    ///
+    /// @return Collection of const @c Host objects.
+    ConstHostCollection
+    getHostsByIdentifiers(MySqlHostContextPtr& ctx,
+                          const SubnetID& subnet_id,
+                          const HostIdentifierList& identifiers,
+                          StatementIndex stindex,
+                          boost::shared_ptr<MySqlHostExchange> exchange) const;
+
     /// @brief Throws exception if database is read only.
     ///
     /// This method should be called by the methods which write to the
@@ -2200,6 +2237,16 @@ public:
 
     /// @brief The pool of contexts
     MySqlHostContextPoolPtr pool_;
+
+    /// @brief The pools of contexts connected to the read replicas
+    ///
+    /// Null when no read replica is configured.
+    boost::shared_ptr<db::ReadReplicaPool<MySqlHostContextPtr> > replicas_;
+
+    /// @brief The timer which reconnects the unavailable read replicas
+    ///
+    /// Null when no read replica is configured.
+    ReadReplicaTimerPtr replica_timer_;
 };
 
 namespace {
@@ -2296,6 +2343,55 @@ TaggedStatementArray tagged_statements = { {
                 "AND h.dhcp_identifier = ? "
             "ORDER BY h.host_id, o.option_id, r.reservation_id"},
 
+    // Retrieves host information and DHCPv4 options using subnet identifier
+    // and any of the client's identifiers. The unused identifier parameters
+    // repeat the first identifier.
+    {MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPIDS,
+            "SELECT h.host_id, h.dhcp_identifier, h.dhcp_identifier_type, "
+                "h.dhcp4_subnet_id, h.dhcp6_subnet_id, h.ipv4_address, h.hostname, "
+                "h.dhcp4_client_classes, h.dhcp6_client_classes, h.user_context, "
+                "h.dhcp4_next_server, h.dhcp4_server_hostname, "
+                "h.dhcp4_boot_file_name, h.auth_key, "
+                "o.option_id, o.code, o.value, o.formatted_value, o.space, "
+                "o.persistent, o.user_context "
+            "FROM hosts AS h "
+            "LEFT JOIN dhcp4_options AS o "
+                "ON h.host_id = o.host_id "
+            "WHERE h.dhcp4_subnet_id = ? AND ("
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?)) "
+            "ORDER BY h.host_id, o.option_id"},
+
+    // Retrieves host information, IPv6 reservations and DHCPv6 options
+    // using subnet identifier and any of the client's identifiers. The
+    // unused identifier parameters repeat the first identifier.
+    {MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPIDS,
+            "SELECT h.host_id, h.dhcp_identifier, "
+                "h.dhcp_identifier_type, h.dhcp4_subnet_id, "
+                "h.dhcp6_subnet_id, h.ipv4_address, h.hostname, "
+                "h.dhcp4_client_classes, h.dhcp6_client_classes, h.user_context, "
+                "h.dhcp4_next_server, h.dhcp4_server_hostname, "
+                "h.dhcp4_boot_file_name, h.auth_key, "
+                "o.option_id, o.code, o.value, o.formatted_value, o.space, "
+                "o.persistent, o.user_context, "
+                "r.reservation_id, r.address, r.prefix_len, r.type, "
+                "r.dhcp6_iaid "
+            "FROM hosts AS h "
+            "LEFT JOIN dhcp6_options AS o "
+                "ON h.host_id = o.host_id "
+            "LEFT JOIN ipv6_reservations AS r "
+                "ON h.host_id = r.host_id "
+            "WHERE h.dhcp6_subnet_id = ? AND ("
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?) OR "
+                "(h.dhcp_identifier_type = ? AND h.dhcp_identifier = ?)) "
+            "ORDER BY h.host_id, o.option_id, r.reservation_id"},
+
     // Retrieves host information and DHCPv4 options for the host using subnet
     // identifier and IPv4 reservation. Left joining the dhcp4_options table
     // results in multiple rows being returned for the host. The number of
@@ -2575,7 +2671,17 @@ MySqlHostContext::MySqlHostContext(const DatabaseConnection::ParameterMap& param
 // MySqlHostContextAlloc Constructor and Destructor
 
 MySqlHostDataSource::MySqlHostContextAlloc::MySqlHostContextAlloc(
-    const MySqlHostDataSourceImpl& mgr) : ctx_(), mgr_(mgr) {
+    const MySqlHostDataSourceImpl& mgr, bool replica)
+    : ctx_(), mgr_(mgr), replica_(false), replica_index_(0) {
+
+    // Read only queries use a read replica when one is available.
+    if (replica && mgr_.replicas_) {
+        ctx_ = mgr_.replicas_->acquire(replica_index_);
+        if (ctx_) {
+            replica_ = true;
+            return;
+        }
+    }
 
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
@@ -2600,6 +2706,11 @@ MySqlHostDataSource::MySqlHostContextAlloc::MySqlHostContextAlloc(
 }
 
 MySqlHostDataSource::MySqlHostContextAlloc::~MySqlHostContextAlloc() {
+    if (replica_) {
+        mgr_.replicas_->release(replica_index_, ctx_);
+        return;
+    }
+
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
         lock_guard<mutex> lock(mgr_.pool_->mutex_);
@@ -2626,13 +2737,34 @@ MySqlHostDataSourceImpl::MySqlHostDataSourceImpl(const MySqlConnection::Paramete
     // Create an initial context.
     pool_.reset(new MySqlHostContextPool());
     pool_->pool_.push_back(createContext());
+
+    // Create the pools of the read replicas, if any.
+    replicas_.reset(new ReadReplicaPool<MySqlHostContextPtr>(parameters_,
+        [this](const DatabaseConnection::ParameterMap& replica) {
+            return (createContext(replica));
+        }));
+    if (replicas_->size() == 0) {
+        replicas_.reset();
+    } else {
+        // Reconnect the unavailable read replicas in the background.
+        auto replicas = replicas_;
+        replica_timer_.reset(new ReadReplicaTimer([replicas]() {
+            replicas->reconnect();
+        }));
+    }
 }
 
 // Create context.
 
 MySqlHostContextPtr
 MySqlHostDataSourceImpl::createContext() const {
-    MySqlHostContextPtr ctx(new MySqlHostContext(parameters_));
+    return (createContext(parameters_));
+}
+
+MySqlHostContextPtr
+MySqlHostDataSourceImpl::createContext(const DatabaseConnection::ParameterMap&
+                                       parameters) const {
+    MySqlHostContextPtr ctx(new MySqlHostContext(parameters));
 
     // Open the database.
     ctx->conn_.openDatabase();
@@ -2894,6 +3026,56 @@ MySqlHostDataSourceImpl::getHost(MySqlHostContextPtr& ctx,
     return (result);
 }
 
+ConstHostCollection
+MySqlHostDataSourceImpl::getHostsByIdentifiers(MySqlHostContextPtr& ctx,
+                                               const SubnetID& subnet_id,
+                                               const HostIdentifierList& identifiers,
+                                               StatementIndex stindex,
+                                               boost::shared_ptr<MySqlHostExchange> exchange) const {
+    ConstHostCollection collection;
+    auto id = identifiers.begin();
+    while (id != identifiers.end()) {
+        // Set up the WHERE clause value
+        MYSQL_BIND inbind[1 + 2 * IDENTIFIERS_PER_QUERY];
+        memset(inbind, 0, sizeof(inbind));
+
+        uint32_t subnet_buffer = static_cast<uint32_t>(subnet_id);
+        inbind[0].buffer_type = MYSQL_TYPE_LONG;
+        inbind[0].buffer = reinterpret_cast<char*>(&subnet_buffer);
+        inbind[0].is_unsigned = MLM_TRUE;
+
+        // Identifier types and values. The unused parameters repeat the
+        // first identifier of the query.
+        char type_buffers[IDENTIFIERS_PER_QUERY];
+        std::vector<char> identifier_vecs[IDENTIFIERS_PER_QUERY];
+        unsigned long lengths[IDENTIFIERS_PER_QUERY];
+        auto first = id;
+        for (size_t i = 0; i < IDENTIFIERS_PER_QUERY; ++i) {
+            auto param = (id != identifiers.end() ? id++ : first);
+
+            type_buffers[i] = static_cast<char>(param->first);
+            inbind[1 + 2 * i].buffer_type = MYSQL_TYPE_TINY;
+            inbind[1 + 2 * i].buffer = &type_buffers[i];
+            inbind[1 + 2 * i].is_unsigned = MLM_TRUE;
+
+            identifier_vecs[i].assign(param->second.begin(), param->second.end());
+            lengths[i] = identifier_vecs[i].size();
+            inbind[2 + 2 * i].buffer_type = MYSQL_TYPE_BLOB;
+            inbind[2 + 2 * i].buffer = &identifier_vecs[i][0];
+            inbind[2 + 2 * i].buffer_length = lengths[i];
+            inbind[2 + 2 * i].length = &lengths[i];
+        }
+
+        // Each query fills its own collection: a row is merged into the
+        // last host of the collection unless it holds a greater host id.
+        ConstHostCollection hosts;
+        getHostCollection(ctx, stindex, inbind, exchange, hosts, false);
+        collection.insert(collection.end(), hosts.begin(), hosts.end());
+    }
+
+    return (collection);
+}
+
 void
 MySqlHostDataSourceImpl::checkReadOnly(MySqlHostContextPtr& ctx) const {
     if (ctx->is_readonly_) {
@@ -2934,17 +3116,15 @@ MySqlHostDataSource::add(const HostPtr& host) {
     uint64_t host_id = mysql_insert_id(ctx->conn_.mysql_);
 
     // Insert DHCPv4 options.
-    ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
-    if (cfg_option4) {
+    if (host->hasOptions4()) {
         impl_->addOptions(ctx, MySqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
-                          cfg_option4, host_id);
+                          host->getCfgOption4(), host_id);
     }
 
     // Insert DHCPv6 options.
-    ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
-    if (cfg_option6) {
+    if (host->hasOptions6()) {
         impl_->addOptions(ctx, MySqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
-                          cfg_option6, host_id);
+                          host->getCfgOption6(), host_id);
     }
 
     // Insert IPv6 reservations.
@@ -3086,10 +3266,6 @@ ConstHostCollection
 MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
                             const uint8_t* identifier_begin,
                             const size_t identifier_len) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -3110,18 +3286,19 @@ MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     inbind[0].length = &length;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
-                             ctx->host_ipv46_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
+                                     ctx->host_ipv46_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 MySqlHostDataSource::getAll4(const SubnetID& subnet_id) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
     memset(inbind, 0, sizeof(inbind));
@@ -3131,18 +3308,19 @@ MySqlHostDataSource::getAll4(const SubnetID& subnet_id) const {
     inbind[0].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID4, inbind,
-                             ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID4, inbind,
+                                     ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 MySqlHostDataSource::getAll6(const SubnetID& subnet_id) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
     memset(inbind, 0, sizeof(inbind));
@@ -3152,18 +3330,19 @@ MySqlHostDataSource::getAll6(const SubnetID& subnet_id) const {
     inbind[0].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6, inbind,
-                             ctx->host_ipv6_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6, inbind,
+                                     ctx->host_ipv6_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 MySqlHostDataSource::getAllbyHostname(const std::string& hostname) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
     memset(inbind, 0, sizeof(inbind));
@@ -3178,8 +3357,13 @@ MySqlHostDataSource::getAllbyHostname(const std::string& hostname) const {
     inbind[0].length = &length;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_HOSTNAME, inbind,
-                             ctx->host_ipv46_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_HOSTNAME, inbind,
+                                     ctx->host_ipv46_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -3187,10 +3371,6 @@ MySqlHostDataSource::getAllbyHostname(const std::string& hostname) const {
 ConstHostCollection
 MySqlHostDataSource::getAllbyHostname4(const std::string& hostname,
                                        const SubnetID& subnet_id) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -3211,8 +3391,13 @@ MySqlHostDataSource::getAllbyHostname4(const std::string& hostname,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID4, inbind,
-                             ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID4, inbind,
+                                     ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -3220,10 +3405,6 @@ MySqlHostDataSource::getAllbyHostname4(const std::string& hostname,
 ConstHostCollection
 MySqlHostDataSource::getAllbyHostname6(const std::string& hostname,
                                        const SubnetID& subnet_id) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -3244,8 +3425,13 @@ MySqlHostDataSource::getAllbyHostname6(const std::string& hostname,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID6, inbind,
-                             ctx->host_ipv6_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID6, inbind,
+                                     ctx->host_ipv6_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -3255,10 +3441,6 @@ MySqlHostDataSource::getPage4(const SubnetID& subnet_id,
                               size_t& /*source_index*/,
                               uint64_t lower_host_id,
                               const HostPageSize& page_size) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[3];
     memset(inbind, 0, sizeof(inbind));
@@ -3282,8 +3464,13 @@ MySqlHostDataSource::getPage4(const SubnetID& subnet_id,
     inbind[2].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE, inbind,
-                             ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE, inbind,
+                                     ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -3293,10 +3480,6 @@ MySqlHostDataSource::getPage6(const SubnetID& subnet_id,
                               size_t& /*source_index*/,
                               uint64_t lower_host_id,
                               const HostPageSize& page_size) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[3];
     memset(inbind, 0, sizeof(inbind));
@@ -3320,18 +3503,19 @@ MySqlHostDataSource::getPage6(const SubnetID& subnet_id,
     inbind[2].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE, inbind,
-                             ctx->host_ipv6_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE, inbind,
+                                     ctx->host_ipv6_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
     memset(inbind, 0, sizeof(inbind));
@@ -3342,8 +3526,13 @@ MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     inbind[0].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
-                             ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
+                                     ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -3353,13 +3542,18 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
+    ConstHostPtr result;
 
-    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin, identifier_len,
-                           MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                           ctx->host_ipv4_exchange_));
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            result = impl_->getHost(ctx, subnet_id, identifier_type,
+                                    identifier_begin, identifier_len,
+                                    MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
+                                    ctx->host_ipv4_exchange_);
+        });
+
+    return (result);
 }
 
 ConstHostPtr
@@ -3370,10 +3564,6 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
                   "wrong address type, address supplied is an IPv6 address");
     }
 
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     uint32_t subnet = subnet_id;
@@ -3388,8 +3578,13 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR, inbind,
-                             ctx->host_ipv4_exchange_, collection, true);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, collection,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR, inbind,
+                                     ctx->host_ipv4_exchange_, collection, true);
+        });
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -3405,13 +3600,18 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
+    ConstHostPtr result;
 
-    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin, identifier_len,
-                           MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                           ctx->host_ipv6_exchange_));
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            result = impl_->getHost(ctx, subnet_id, identifier_type,
+                                    identifier_begin, identifier_len,
+                                    MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
+                                    ctx->host_ipv6_exchange_);
+        });
+
+    return (result);
 }
 
 ConstHostPtr
@@ -3422,10 +3622,6 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                   "wrong address type, address supplied is an IPv4 address");
     }
 
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -3445,8 +3641,13 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_PREFIX, inbind,
-                             ctx->host_ipv6_exchange_, collection, true);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, collection,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_PREFIX, inbind,
+                                     ctx->host_ipv6_exchange_, collection, true);
+        });
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -3465,10 +3666,6 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
                   "wrong address type, address supplied is an IPv4 address");
     }
 
-    // Get a context
-    MySqlHostContextAlloc get_context(*impl_);
-    MySqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -3488,8 +3685,13 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
     inbind[1].buffer_length = addr6_length;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR, inbind,
-                             ctx->host_ipv6_exchange_, collection, true);
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, collection,
+        [&](MySqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR, inbind,
+                                     ctx->host_ipv6_exchange_, collection, true);
+        });
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -3500,6 +3702,46 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
     return (result);
 }
 
+ConstHostCollection
+MySqlHostDataSource::getByIdentifiers4(const SubnetID& subnet_id,
+                                       const HostIdentifierList& identifiers) const {
+    if (identifiers.empty()) {
+        return (ConstHostCollection());
+    }
+
+    ConstHostCollection result;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            result = impl_->getHostsByIdentifiers(ctx, subnet_id, identifiers,
+                                                  MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPIDS,
+                                                  ctx->host_ipv4_exchange_);
+        });
+
+    return (result);
+}
+
+ConstHostCollection
+MySqlHostDataSource::getByIdentifiers6(const SubnetID& subnet_id,
+                                       const HostIdentifierList& identifiers) const {
+    if (identifiers.empty()) {
+        return (ConstHostCollection());
+    }
+
+    ConstHostCollection result;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlHostContextAlloc>(*impl_, result,
+        [&](MySqlHostContextPtr& ctx) {
+            result = impl_->getHostsByIdentifiers(ctx, subnet_id, identifiers,
+                                                  MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPIDS,
+                                                  ctx->host_ipv6_exchange_);
+        });
+
+    return (result);
+}
+
 // Miscellaneous database methods.
 
 std::string
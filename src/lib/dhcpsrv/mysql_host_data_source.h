@@ -311,6 +311,34 @@ public:
     virtual ConstHostPtr get6(const SubnetID& subnet_id,
                               const asiolink::IOAddress& address) const;
 
+    /// @brief Returns hosts connected to the IPv4 subnet using any of the
+    /// specified identifiers.
+    ///
+    /// The hosts are fetched using a single query for up to five
+    /// identifiers.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Collection of const @c Host objects.
+    virtual ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const;
+
+    /// @brief Returns hosts connected to the IPv6 subnet using any of the
+    /// specified identifiers.
+    ///
+    /// The hosts are fetched using a single query for up to five
+    /// identifiers.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Collection of const @c Host objects.
+    virtual ConstHostCollection
+    getByIdentifiers6(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const;
+
     /// @brief Return backend type
     ///
     /// Returns the type of the backend (e.g. "mysql", "memfile" etc.)
@@ -363,8 +391,13 @@ public:
         /// This constructor takes a context of the pool if one is available
         /// or creates a new one.
         ///
+        /// When a read replica is requested and available the context is
+        /// connected to a read replica.
+        ///
         /// @param mgr A parent instance
-        MySqlHostContextAlloc(const MySqlHostDataSourceImpl& mgr);
+        /// @param replica true for read only queries which may be sent
+        /// to a read replica.
+        MySqlHostContextAlloc(const MySqlHostDataSourceImpl& mgr, bool replica = false);
 
         /// @brief Destructor
         ///
@@ -377,6 +410,12 @@ public:
     private:
         /// @brief The manager
         const MySqlHostDataSourceImpl& mgr_;
+
+        /// @brief Indicates if the context is connected to a read replica.
+        bool replica_;
+
+        /// @brief Index of the read replica.
+        size_t replica_index_;
     };
 
 private:
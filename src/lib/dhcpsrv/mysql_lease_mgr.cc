@@ -13,12 +13,14 @@
 #include <dhcpsrv/mysql_lease_mgr.h>
 #include <mysql/mysql_connection.h>
 #include <util/multi_threading_mgr.h>
+#include <util/trace_mgr.h>
 
 #include <boost/array.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/static_assert.hpp>
 #include <mysqld_error.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <limits>
@@ -93,6 +95,16 @@ const size_t ADDRESS6_TEXT_MAX_LEN = 39;
 /// @brief Maximum length of user context.
 const size_t USER_CONTEXT_MAX_LEN = 8192;
 
+/// @brief Keys of the leases written by a batched reclamation statement.
+///
+/// A lease is identified by its address and by its expiration time, so
+/// a lease renewed since it was fetched is not matched. The number of
+/// keys is @c MySqlLeaseMgr::RECLAIM_BATCH_SIZE.
+#define RECLAIM_BATCH_KEYS \
+    "(address, expire) IN (" \
+        "(?, ?), (?, ?), (?, ?), (?, ?), (?, ?), (?, ?), (?, ?), (?, ?), " \
+        "(?, ?), (?, ?), (?, ?), (?, ?), (?, ?), (?, ?), (?, ?), (?, ?))"
+
 boost::array<TaggedStatement, MySqlLeaseMgr::NUM_STATEMENTS>
 tagged_statements = { {
     {MySqlLeaseMgr::DELETE_LEASE4,
@@ -321,10 +333,125 @@ tagged_statements = { {
                     "SELECT subnet_id, lease_type, state, leases as state_count "
                         "FROM lease6_stat "
                         "WHERE subnet_id >= ? and subnet_id <= ? "
-                        "ORDER BY subnet_id, lease_type, state"}
+                        "ORDER BY subnet_id, lease_type, state"},
+    {MySqlLeaseMgr::UPDATE_LEASE4_RECLAIMED,
+                    "UPDATE lease4 SET hostname = '', fqdn_fwd = 0, "
+                        "fqdn_rev = 0, state = ? "
+                            "WHERE " RECLAIM_BATCH_KEYS},
+    {MySqlLeaseMgr::UPDATE_LEASE6_RECLAIMED,
+                    "UPDATE lease6 SET hostname = '', fqdn_fwd = 0, "
+                        "fqdn_rev = 0, state = ? "
+                            "WHERE " RECLAIM_BATCH_KEYS},
+    {MySqlLeaseMgr::DELETE_LEASE4_RECLAIMED,
+                    "DELETE FROM lease4 WHERE " RECLAIM_BATCH_KEYS},
+    {MySqlLeaseMgr::DELETE_LEASE6_RECLAIMED,
+                    "DELETE FROM lease6 WHERE " RECLAIM_BATCH_KEYS},
+    {MySqlLeaseMgr::ALLOCATE_LEASE4,
+                    "CALL lease4AllocateOrRenew(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+                        "?, ?)"}
     }
 };
 
+/// @brief Names of the statements, in the order of the statement indexes.
+///
+/// Used as the details of the trace events.
+boost::array<const char*, MySqlLeaseMgr::NUM_STATEMENTS>
+statement_names = { {
+    "delete_lease4",
+    "delete_lease4_state_expired",
+    "delete_lease6",
+    "delete_lease6_state_expired",
+    "get_lease4",
+    "get_lease4_addr",
+    "get_lease4_clientid",
+    "get_lease4_clientid_subid",
+    "get_lease4_hwaddr",
+    "get_lease4_hwaddr_subid",
+    "get_lease4_page",
+    "get_lease4_subid",
+    "get_lease4_hostname",
+    "get_lease4_expire",
+    "get_lease6",
+    "get_lease6_addr",
+    "get_lease6_duid_iaid",
+    "get_lease6_duid_iaid_subid",
+    "get_lease6_page",
+    "get_lease6_subid",
+    "get_lease6_duid",
+    "get_lease6_hostname",
+    "get_lease6_expire",
+    "insert_lease4",
+    "insert_lease6",
+    "update_lease4",
+    "update_lease6",
+    "all_lease4_stats",
+    "subnet_lease4_stats",
+    "subnet_range_lease4_stats",
+    "all_lease6_stats",
+    "subnet_lease6_stats",
+    "subnet_range_lease6_stats",
+    "update_lease4_reclaimed",
+    "update_lease6_reclaimed",
+    "delete_lease4_reclaimed",
+    "delete_lease6_reclaimed",
+    "allocate_lease4"
+} };
+
+/// @brief Storage of the key of a lease bound to a batched statement.
+struct ReclaimKey {
+    /// @brief IPv4 address
+    uint32_t addr4_;
+
+    /// @brief IPv6 address in the textual form
+    std::string addr6_;
+
+    /// @brief Length of the IPv6 address
+    unsigned long addr6_length_;
+
+    /// @brief Expiration time
+    MYSQL_TIME expire_;
+};
+
+/// @brief Binds the key of an IPv4 lease.
+///
+/// @param lease The lease.
+/// @param key Storage of the bound values.
+/// @param bind The two binds of the key.
+void
+bindReclaimKey(const Lease4Ptr& lease, ReclaimKey& key, MYSQL_BIND* bind) {
+    key.addr4_ = lease->addr_.toUint32();
+    bind[0].buffer_type = MYSQL_TYPE_LONG;
+    bind[0].buffer = reinterpret_cast<char*>(&key.addr4_);
+    bind[0].is_unsigned = MLM_TRUE;
+
+    MySqlConnection::convertToDatabaseTime(lease->old_cltt_, lease->old_valid_lft_,
+                                           key.expire_);
+    bind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
+    bind[1].buffer = reinterpret_cast<char*>(&key.expire_);
+    bind[1].buffer_length = sizeof(key.expire_);
+}
+
+/// @brief Binds the key of an IPv6 lease.
+///
+/// @param lease The lease.
+/// @param key Storage of the bound values.
+/// @param bind The two binds of the key.
+void
+bindReclaimKey(const Lease6Ptr& lease, ReclaimKey& key, MYSQL_BIND* bind) {
+    key.addr6_ = lease->addr_.toText();
+    key.addr6_length_ = key.addr6_.size();
+    bind[0].buffer_type = MYSQL_TYPE_STRING;
+    bind[0].buffer = const_cast<char*>(key.addr6_.c_str());
+    bind[0].buffer_length = key.addr6_length_;
+    bind[0].length = &key.addr6_length_;
+
+    MySqlConnection::convertToDatabaseTime(lease->old_cltt_, lease->old_valid_lft_,
+                                           key.expire_);
+    bind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
+    bind[1].buffer = reinterpret_cast<char*>(&key.expire_);
+    bind[1].buffer_length = sizeof(key.expire_);
+}
+
 }  // namespace
 
 namespace isc {
@@ -1724,7 +1851,17 @@ MySqlLeaseContext::MySqlLeaseContext(const DatabaseConnection::ParameterMap& par
 // MySqlLeaseContextAlloc Constructor and Destructor
 
 MySqlLeaseMgr::MySqlLeaseContextAlloc::MySqlLeaseContextAlloc(
-    const MySqlLeaseMgr& mgr) : ctx_(), mgr_(mgr) {
+    const MySqlLeaseMgr& mgr, bool replica)
+    : ctx_(), mgr_(mgr), replica_(false), replica_index_(0) {
+
+    // Read only queries use a read replica when one is available.
+    if (replica && mgr_.replicas_) {
+        ctx_ = mgr_.replicas_->acquire(replica_index_);
+        if (ctx_) {
+            replica_ = true;
+            return;
+        }
+    }
 
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
@@ -1749,6 +1886,11 @@ MySqlLeaseMgr::MySqlLeaseContextAlloc::MySqlLeaseContextAlloc(
 }
 
 MySqlLeaseMgr::MySqlLeaseContextAlloc::~MySqlLeaseContextAlloc() {
+    if (replica_) {
+        mgr_.replicas_->release(replica_index_, ctx_);
+        return;
+    }
+
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
         lock_guard<mutex> lock(mgr_.pool_->mutex_);
@@ -1760,7 +1902,7 @@ MySqlLeaseMgr::MySqlLeaseContextAlloc::~MySqlLeaseContextAlloc() {
 // MySqlLeaseMgr Constructor and Destructor
 
 MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
-    : parameters_(parameters) {
+    : parameters_(parameters), allocate_or_renew_(false) {
 
     // Validate schema version first.
     std::pair<uint32_t, uint32_t> code_version(MYSQL_SCHEMA_VERSION_MAJOR,
@@ -1774,9 +1916,31 @@ MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
                       << db_version.second);
     }
 
+    // Check if the allocation should use the stored procedure.
+    MySqlConnection::ParameterMap::const_iterator param =
+        parameters_.find("allocate-or-renew");
+    if (param != parameters_.end()) {
+        allocate_or_renew_ = (param->second == "true");
+    }
+
     // Create an initial context.
     pool_.reset(new MySqlLeaseContextPool());
     pool_->pool_.push_back(createContext());
+
+    // Create the pools of the read replicas, if any.
+    replicas_.reset(new ReadReplicaPool<MySqlLeaseContextPtr>(parameters_,
+        [this](const DatabaseConnection::ParameterMap& replica) {
+            return (createContext(replica));
+        }));
+    if (replicas_->size() == 0) {
+        replicas_.reset();
+    } else {
+        // Reconnect the unavailable read replicas in the background.
+        auto replicas = replicas_;
+        replica_timer_.reset(new ReadReplicaTimer([replicas]() {
+            replicas->reconnect();
+        }));
+    }
 }
 
 MySqlLeaseMgr::~MySqlLeaseMgr() {
@@ -1786,7 +1950,13 @@ MySqlLeaseMgr::~MySqlLeaseMgr() {
 
 MySqlLeaseContextPtr
 MySqlLeaseMgr::createContext() const {
-    MySqlLeaseContextPtr ctx(new MySqlLeaseContext(parameters_));
+    return (createContext(parameters_));
+}
+
+MySqlLeaseContextPtr
+MySqlLeaseMgr::createContext(const DatabaseConnection::ParameterMap&
+                             parameters) const {
+    MySqlLeaseContextPtr ctx(new MySqlLeaseContext(parameters));
 
     // Open the database.
     ctx->conn_.openDatabase();
@@ -1830,6 +2000,7 @@ bool
 MySqlLeaseMgr::addLeaseCommon(MySqlLeaseContextPtr& ctx,
                               StatementIndex stindex,
                               std::vector<MYSQL_BIND>& bind) {
+    ScopedTrace trace("lease-add", statement_names[stindex]);
 
     // Bind the parameters to the statement
     int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], &bind[0]);
@@ -1928,6 +2099,8 @@ MySqlLeaseMgr::getLeaseCollection(MySqlLeaseContextPtr& ctx,
                                   Exchange& exchange,
                                   LeaseCollection& result,
                                   bool single) const {
+    ScopedTrace trace("lease-get", statement_names[stindex]);
+
     int status;
 
     if (bind) {
@@ -2245,11 +2418,11 @@ MySqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
     // ... and get the data
     Lease4Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4_SUBID, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4_SUBID, inbind, result);
+        });
 
     return (result);
 }
@@ -2271,11 +2444,11 @@ MySqlLeaseMgr::getLeases4(const std::string& hostname) const {
     // ... and get the data
     Lease4Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4_HOSTNAME, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4_HOSTNAME, inbind, result);
+        });
 
     return (result);
 }
@@ -2286,11 +2459,11 @@ MySqlLeaseMgr::getLeases4() const {
 
     Lease4Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4, 0, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4, 0, result);
+        });
 
     return (result);
 }
@@ -2328,11 +2501,11 @@ MySqlLeaseMgr::getLeases4(const IOAddress& lower_bound_address,
     // Get the leases
     Lease4Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4_PAGE, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4_PAGE, inbind, result);
+        });
 
     return (result);
 }
@@ -2504,11 +2677,11 @@ MySqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
     // ... and get the data
     Lease6Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_SUBID, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_SUBID, inbind, result);
+        });
 
     return (result);
 }
@@ -2519,11 +2692,11 @@ MySqlLeaseMgr::getLeases6() const {
 
     Lease6Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6, 0, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6, 0, result);
+        });
 
     return (result);
 }
@@ -2548,11 +2721,11 @@ MySqlLeaseMgr::getLeases6(const DUID& duid) const {
 
     Lease6Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_DUID, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_DUID, inbind, result);
+        });
 
     return result;
 }
@@ -2574,11 +2747,11 @@ MySqlLeaseMgr::getLeases6(const std::string& hostname) const {
     // ... and get the data
     Lease6Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_HOSTNAME, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_HOSTNAME, inbind, result);
+        });
 
     return (result);
 }
@@ -2625,11 +2798,11 @@ MySqlLeaseMgr::getLeases6(const IOAddress& lower_bound_address,
     // Get the leases
     Lease6Collection result;
 
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_PAGE, inbind, result);
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, result,
+        [&](MySqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_PAGE, inbind, result);
+        });
 
     return (result);
 }
@@ -2698,6 +2871,7 @@ MySqlLeaseMgr::updateLeaseCommon(MySqlLeaseContextPtr& ctx,
                                  StatementIndex stindex,
                                  MYSQL_BIND* bind,
                                  const LeasePtr& lease) {
+    ScopedTrace trace("lease-update", statement_names[stindex]);
 
     // Bind the parameters to the statement
     int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], bind);
@@ -2824,6 +2998,7 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 uint64_t
 MySqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
                                  MYSQL_BIND* bind) {
+    ScopedTrace trace("lease-delete", statement_names[stindex]);
 
     // Get a context
     MySqlLeaseContextAlloc get_context(*this);
@@ -2929,6 +3104,198 @@ MySqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
               "that had the address " << lease->addr_.toText());
 }
 
+const size_t MySqlLeaseMgr::RECLAIM_BATCH_SIZE;
+
+template <typename LeaseCollection>
+void
+MySqlLeaseMgr::reclaimLeasesCommon(StatementIndex stindex,
+                                   const LeaseCollection& leases,
+                                   LeaseCollection& skipped) {
+    if (leases.empty()) {
+        return;
+    }
+
+    const bool deleted = ((stindex == DELETE_LEASE4_RECLAIMED) ||
+                          (stindex == DELETE_LEASE6_RECLAIMED));
+    ScopedTrace trace(deleted ? "lease-delete" : "lease-update",
+                      statement_names[stindex]);
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    uint32_t state = Lease::STATE_EXPIRED_RECLAIMED;
+    std::vector<ReclaimKey> keys(RECLAIM_BATCH_SIZE);
+    std::vector<MYSQL_BIND> inbind(2 * RECLAIM_BATCH_SIZE + 1);
+
+    for (size_t first = 0; first < leases.size(); first += RECLAIM_BATCH_SIZE) {
+        const size_t count = std::min(RECLAIM_BATCH_SIZE, leases.size() - first);
+        memset(&inbind[0], 0, sizeof(MYSQL_BIND) * inbind.size());
+
+        // The update statement sets the state given by the first parameter.
+        size_t param = 0;
+        if (!deleted) {
+            inbind[0].buffer_type = MYSQL_TYPE_LONG;
+            inbind[0].buffer = reinterpret_cast<char*>(&state);
+            inbind[0].is_unsigned = MLM_TRUE;
+            param = 1;
+        }
+
+        // The unused keys repeat the first lease of the group, which does
+        // not change the outcome of the statement.
+        for (size_t i = 0; i < RECLAIM_BATCH_SIZE; ++i, param += 2) {
+            bindReclaimKey(leases[first + (i < count ? i : 0)], keys[i],
+                           &inbind[param]);
+        }
+
+        int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex],
+                                           &inbind[0]);
+        checkError(ctx, status, stindex, "unable to bind parameters");
+
+        status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
+        checkError(ctx, status, stindex, "unable to execute");
+
+        // The connection reports the matched rows, so a lease which was
+        // already in the expired-reclaimed state is counted too.
+        uint64_t affected_rows =
+            mysql_stmt_affected_rows(ctx->conn_.statements_[stindex]);
+        if (affected_rows < count) {
+            for (size_t i = first; i < first + count; ++i) {
+                if (isReclaimSkipped(leases[i], deleted)) {
+                    skipped.push_back(leases[i]);
+                }
+            }
+        }
+    }
+}
+
+bool
+MySqlLeaseMgr::allocateOrRenewLease4(const Lease4Ptr& lease,
+                                     Lease4Ptr& old_lease) {
+    const StatementIndex stindex = ALLOCATE_LEASE4;
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_ALLOCATE_ADDR4).arg(lease->addr_.toText());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    ScopedTrace trace("lease-allocate", statement_names[stindex]);
+
+    // The lease columns are followed by the hardware type, which is not
+    // stored in the lease4 table but is used to match the hardware address,
+    // and by the current time which is used to check if the existing lease
+    // is expired.
+    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
+
+    uint16_t hwtype = lease->hwaddr_ ? lease->hwaddr_->htype_ : 0;
+    my_bool hwtype_null = lease->hwaddr_ ? MLM_FALSE : MLM_TRUE;
+    MYSQL_BIND hwtype_bind;
+    memset(&hwtype_bind, 0, sizeof(hwtype_bind));
+    hwtype_bind.buffer_type = MYSQL_TYPE_SHORT;
+    hwtype_bind.buffer = reinterpret_cast<char*>(&hwtype);
+    hwtype_bind.is_unsigned = MLM_TRUE;
+    hwtype_bind.is_null = &hwtype_null;
+    bind.push_back(hwtype_bind);
+
+    MYSQL_TIME now;
+    MySqlConnection::convertToDatabaseTime(time(NULL), now);
+    MYSQL_BIND now_bind;
+    memset(&now_bind, 0, sizeof(now_bind));
+    now_bind.buffer_type = MYSQL_TYPE_TIMESTAMP;
+    now_bind.buffer = reinterpret_cast<char*>(&now);
+    now_bind.buffer_length = sizeof(now);
+    bind.push_back(now_bind);
+
+    MYSQL_STMT* statement = ctx->conn_.statements_[stindex];
+    int status = mysql_stmt_bind_param(statement, &bind[0]);
+    checkError(ctx, status, stindex, "unable to bind parameters");
+
+    status = mysql_stmt_execute(statement);
+    checkError(ctx, status, stindex, "unable to execute");
+
+    // There is no result set when the lease has been added. Otherwise
+    // it holds the previous lease followed by the allocated flag.
+    old_lease.reset();
+    bool allocated = true;
+    if (mysql_stmt_field_count(statement) > 0) {
+        std::vector<MYSQL_BIND> outbind = ctx->exchange4_->createBindForReceive();
+
+        uint8_t allocated_value = 0;
+        MYSQL_BIND allocated_bind;
+        memset(&allocated_bind, 0, sizeof(allocated_bind));
+        allocated_bind.buffer_type = MYSQL_TYPE_TINY;
+        allocated_bind.buffer = reinterpret_cast<char*>(&allocated_value);
+        allocated_bind.is_unsigned = MLM_TRUE;
+        outbind.push_back(allocated_bind);
+
+        status = mysql_stmt_bind_result(statement, &outbind[0]);
+        checkError(ctx, status, stindex, "unable to bind SELECT clause parameters");
+
+        status = mysql_stmt_store_result(statement);
+        checkError(ctx, status, stindex, "unable to set up for storing all results");
+
+        MySqlFreeResult fetch_release(statement);
+        status = mysql_stmt_fetch(statement);
+        if (status == 0) {
+            old_lease = ctx->exchange4_->getLeaseData();
+            allocated = (allocated_value != 0);
+
+        } else if (status == 1) {
+            checkError(ctx, status, stindex, "unable to fetch results");
+
+        } else if (status == MYSQL_DATA_TRUNCATED) {
+            isc_throw(DataTruncated, ctx->conn_.text_statements_[stindex]
+                      << " returned truncated data: columns affected are "
+                      << ctx->exchange4_->getErrorColumns());
+        }
+    }
+
+    // Consume the status of the procedure call so the statement can be
+    // executed again.
+    while ((status = mysql_stmt_next_result(statement)) == 0) {
+    }
+    if (status > 0) {
+        checkError(ctx, status, stindex, "unable to complete the call");
+    }
+
+    if (allocated) {
+        lease->old_cltt_ = lease->cltt_;
+        lease->old_valid_lft_ = lease->valid_lft_;
+    }
+
+    return (allocated);
+}
+
+Lease4Collection
+MySqlLeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                              const Lease4Collection& deleted) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_RECLAIM_LEASES4)
+        .arg(updated.size())
+        .arg(deleted.size());
+
+    Lease4Collection skipped;
+    reclaimLeasesCommon(UPDATE_LEASE4_RECLAIMED, updated, skipped);
+    reclaimLeasesCommon(DELETE_LEASE4_RECLAIMED, deleted, skipped);
+    return (skipped);
+}
+
+Lease6Collection
+MySqlLeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                              const Lease6Collection& deleted) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_RECLAIM_LEASES6)
+        .arg(updated.size())
+        .arg(deleted.size());
+
+    Lease6Collection skipped;
+    reclaimLeasesCommon(UPDATE_LEASE6_RECLAIMED, updated, skipped);
+    reclaimLeasesCommon(DELETE_LEASE6_RECLAIMED, deleted, skipped);
+    return (skipped);
+}
+
 uint64_t
 MySqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED4)
@@ -2973,87 +3340,99 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startLeaseStatsQuery4() {
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(ctx->conn_,
-                                                      ALL_LEASE4_STATS,
-                                                      false));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, query,
+        [&](MySqlLeaseContextPtr& ctx) {
+            query.reset(new MySqlLeaseStatsQuery(ctx->conn_,
+                                                 ALL_LEASE4_STATS,
+                                                 false));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(ctx->conn_,
-                                                      SUBNET_LEASE4_STATS,
-                                                      false,
-                                                      subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, query,
+        [&](MySqlLeaseContextPtr& ctx) {
+            query.reset(new MySqlLeaseStatsQuery(ctx->conn_,
+                                                 SUBNET_LEASE4_STATS,
+                                                 false,
+                                                 subnet_id));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
                                                 const SubnetID& last_subnet_id) {
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(ctx->conn_,
-                                                      SUBNET_RANGE_LEASE4_STATS,
-                                                      false,
-                                                      first_subnet_id,
-                                                      last_subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, query,
+        [&](MySqlLeaseContextPtr& ctx) {
+            query.reset(new MySqlLeaseStatsQuery(ctx->conn_,
+                                                 SUBNET_RANGE_LEASE4_STATS,
+                                                 false,
+                                                 first_subnet_id,
+                                                 last_subnet_id));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startLeaseStatsQuery6() {
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(ctx->conn_,
-                                                      ALL_LEASE6_STATS,
-                                                      true));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, query,
+        [&](MySqlLeaseContextPtr& ctx) {
+            query.reset(new MySqlLeaseStatsQuery(ctx->conn_,
+                                                 ALL_LEASE6_STATS,
+                                                 true));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(ctx->conn_,
-                                                      SUBNET_LEASE6_STATS,
-                                                      true,
-                                                      subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, query,
+        [&](MySqlLeaseContextPtr& ctx) {
+            query.reset(new MySqlLeaseStatsQuery(ctx->conn_,
+                                                 SUBNET_LEASE6_STATS,
+                                                 true,
+                                                 subnet_id));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& first_subnet_id,
                                                 const SubnetID& last_subnet_id) {
-    // Get a context
-    MySqlLeaseContextAlloc get_context(*this);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(ctx->conn_,
-                                                      SUBNET_RANGE_LEASE6_STATS,
-                                                      true,
-                                                      first_subnet_id,
-                                                      last_subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<MySqlLeaseContextAlloc>(*this, query,
+        [&](MySqlLeaseContextPtr& ctx) {
+            query.reset(new MySqlLeaseStatsQuery(ctx->conn_,
+                                                 SUBNET_RANGE_LEASE6_STATS,
+                                                 true,
+                                                 first_subnet_id,
+                                                 last_subnet_id));
+            query->start();
+        });
     return(query);
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -79,18 +79,20 @@ Network::clientSupported(const isc::dhcp::ClientClasses& classes) const {
         return (true);
     }
 
-    return (classes.contains(client_class_));
+    return (classes.contains(client_class_id_));
 }
 
 void
 Network::allowClientClass(const isc::dhcp::ClientClass& class_name) {
     client_class_ = class_name;
+    client_class_id_ = ClientClassIndex::intern(class_name);
 }
 
 void
 Network::requireClientClass(const isc::dhcp::ClientClass& class_name) {
-    if (!required_classes_.contains(class_name)) {
-        required_classes_.insert(class_name);
+    ClientClassId id = ClientClassIndex::intern(class_name);
+    if (!required_classes_.contains(id)) {
+        required_classes_.insert(id, class_name);
     }
 }
 
@@ -242,6 +244,15 @@ Network::toElement() const {
         map->set("t2-percent", Element::create(t2_percent_));
     }
 
+    if (!cache_threshold_.unspecified()) {
+        map->set("cache-threshold", Element::create(cache_threshold_));
+    }
+
+    if (!cache_max_age_.unspecified()) {
+        map->set("cache-max-age",
+                 Element::create(static_cast<long long>(cache_max_age_.get())));
+    }
+
     if (!ddns_send_updates_.unspecified()) {
         map->set("ddns-send-updates", Element::create(ddns_send_updates_));
     }
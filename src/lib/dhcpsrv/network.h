@@ -202,9 +202,12 @@ public:
 
     /// @brief Constructor.
     Network()
-        : iface_name_(), client_class_(), t1_(), t2_(), valid_(),
+        : iface_name_(), client_class_(),
+          client_class_id_(ClientClassIndex::NO_CLASS_ID),
+          t1_(), t2_(), valid_(),
           host_reservation_mode_(HR_ALL, true), cfg_option_(new CfgOption()),
           calculate_tee_times_(), t1_percent_(), t2_percent_(),
+          cache_threshold_(), cache_max_age_(),
           ddns_send_updates_(), ddns_override_no_update_(), ddns_override_client_update_(),
           ddns_replace_client_name_mode_(), ddns_generated_prefix_(), ddns_qualifying_suffix_(),
           hostname_char_set_(), hostname_char_replacement_() {
@@ -521,6 +524,45 @@ public:
         t2_percent_ = t2_percent;
     }
 
+    /// @brief Returns the fraction of the lease lifetime during which
+    /// the lease is reused.
+    ///
+    /// A lease renewed before this fraction of its lifetime has elapsed
+    /// is returned with its remaining lifetime and is not updated in
+    /// the lease database.
+    ///
+    /// @param inheritance inheritance mode to be used.
+    util::Optional<double>
+    getCacheThreshold(const Inheritance& inheritance = Inheritance::ALL) const {
+        return (getProperty<Network>(&Network::getCacheThreshold,
+                                     cache_threshold_,
+                                     inheritance, "cache-threshold"));
+    }
+
+    /// @brief Sets the fraction of the lease lifetime during which the
+    /// lease is reused.
+    ///
+    /// @param cache_threshold New fraction to use.
+    void setCacheThreshold(const util::Optional<double>& cache_threshold) {
+        cache_threshold_ = cache_threshold;
+    }
+
+    /// @brief Returns the maximum age in seconds of a reused lease.
+    ///
+    /// @param inheritance inheritance mode to be used.
+    util::Optional<uint32_t>
+    getCacheMaxAge(const Inheritance& inheritance = Inheritance::ALL) const {
+        return (getProperty<Network>(&Network::getCacheMaxAge, cache_max_age_,
+                                     inheritance, "cache-max-age"));
+    }
+
+    /// @brief Sets the maximum age in seconds of a reused lease.
+    ///
+    /// @param cache_max_age New maximum age to use.
+    void setCacheMaxAge(const util::Optional<uint32_t>& cache_max_age) {
+        cache_max_age_ = cache_max_age;
+    }
+
     /// @brief Returns ddns-send-updates
     ///
     /// @param inheritance inheritance mode to be used.
@@ -911,6 +953,9 @@ protected:
     /// which means that any client is allowed, regardless of its class.
     util::Optional<ClientClass> client_class_;
 
+    /// @brief Interned identifier of @ref client_class_
+    ClientClassId client_class_id_;
+
     /// @brief Required classes
     ///
     /// If the network is selected these classes will be added to the
@@ -943,6 +988,12 @@ protected:
     /// @brief Percentage of the lease lifetime to use when calculating T2 timer
     util::Optional<double> t2_percent_;
 
+    /// @brief Fraction of the lease lifetime during which the lease is reused
+    util::Optional<double> cache_threshold_;
+
+    /// @brief Maximum age in seconds of a reused lease
+    util::Optional<uint32_t> cache_max_age_;
+
     /// @brief Should Kea perform DNS updates. Used to provide scoped enabling
     /// and disabling of updates.
     util::Optional<bool> ddns_send_updates_;
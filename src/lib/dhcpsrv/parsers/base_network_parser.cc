@@ -1,4 +1,4 @@
-// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2019-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <dhcpsrv/parsers/base_network_parser.h>
 #include <util/optional.h>
 #include <util/strutil.h>
+#include <limits>
 
 using namespace isc::data;
 using namespace isc::util;
@@ -226,5 +227,23 @@ BaseNetworkParser::parseDdnsParams(const data::ConstElementPtr& network_data,
     }
 }
 
+void
+BaseNetworkParser::parseCacheParams(const data::ConstElementPtr& network_data,
+                                    NetworkPtr& network) {
+    if (network_data->contains("cache-threshold")) {
+        double cache_threshold = getDouble(network_data, "cache-threshold");
+        if ((cache_threshold <= 0.0) || (cache_threshold >= 1.0)) {
+            isc_throw(DhcpConfigError, "cache-threshold:  " << cache_threshold
+                      << " is invalid, it must be greater than 0.0 and less than 1.0");
+        }
+        network->setCacheThreshold(cache_threshold);
+    }
+
+    if (network_data->contains("cache-max-age")) {
+        network->setCacheMaxAge(getInteger(network_data, "cache-max-age",
+                                           0, std::numeric_limits<uint32_t>::max()));
+    }
+}
+
 } // end of namespace isc::dhcp
 } // end of namespace isc
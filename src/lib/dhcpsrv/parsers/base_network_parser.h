@@ -1,4 +1,4 @@
-// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2019-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -86,6 +86,22 @@ protected:
     /// to be stored.
     void parseDdnsParams(const data::ConstElementPtr& network_data,
                          NetworkPtr& network);
+
+    /// @brief Parses parameters pertaining to lease reuse.
+    ///
+    /// The parsed parameters are:
+    /// - cache-threshold,
+    /// - cache-max-age.
+    ///
+    /// @param network_data Data element holding shared network
+    /// configuration to be parsed.
+    /// @param [out] network Pointer to a network in which parsed data is
+    /// to be stored.
+    ///
+    /// @throw DhcpConfigError if configuration of these parameters is
+    /// invalid.
+    void parseCacheParams(const data::ConstElementPtr& network_data,
+                          NetworkPtr& network);
 };
 
 } // end of namespace isc::dhcp
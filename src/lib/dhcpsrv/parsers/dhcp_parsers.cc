@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -721,9 +721,7 @@ Subnet4ConfigParser::parse(ConstElementPtr subnet) {
         HostCollection hosts;
         HostReservationsListParser<HostReservationParser4> parser;
         parser.parse(subnet_->getID(), reservations, hosts);
-        for (auto h = hosts.begin(); h != hosts.end(); ++h) {
-            CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(*h);
-        }
+        CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(hosts);
     }
 
     return (sn4ptr);
@@ -927,6 +925,9 @@ Subnet4ConfigParser::initSubnet(data::ConstElementPtr params,
 
     // Parse DDNS parameters
     parseDdnsParams(params, network);
+
+    // Parse lease reuse parameters
+    parseCacheParams(params, network);
 }
 
 //**************************** Subnets4ListConfigParser **********************
@@ -1164,9 +1165,7 @@ Subnet6ConfigParser::parse(ConstElementPtr subnet) {
         HostCollection hosts;
         HostReservationsListParser<HostReservationParser6> parser;
         parser.parse(subnet_->getID(), reservations, hosts);
-        for (auto h = hosts.begin(); h != hosts.end(); ++h) {
-            CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(*h);
-        }
+        CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(hosts);
     }
 
     return (sn6ptr);
@@ -1324,6 +1323,9 @@ Subnet6ConfigParser::initSubnet(data::ConstElementPtr params,
 
     // Parse DDNS parameters
     parseDdnsParams(params, network);
+
+    // Parse lease reuse parameters
+    parseCacheParams(params, network);
 }
 
 //**************************** Subnet6ListConfigParser ********************
@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -27,7 +27,8 @@ namespace dhcp {
 /// - hold-reclaimed-time,
 /// - max-reclaim-leases,
 /// - max-reclaim-time,
-/// - unwarned-reclaim-cycles.
+/// - unwarned-reclaim-cycles,
+/// - background-reclamation.
 ///
 /// These parameters are optional and the default values are used for
 /// those that aren't specified.
@@ -74,6 +74,8 @@ const SimpleKeywords SimpleParser4::GLOBAL4_PARAMETERS = {
     { "calculate-tee-times",          Element::boolean },
     { "t1-percent",                   Element::real },
     { "t2-percent",                   Element::real },
+    { "cache-threshold",              Element::real },
+    { "cache-max-age",                Element::integer },
     { "loggers",                      Element::list },
     { "hostname-char-set",            Element::string },
     { "hostname-char-replacement",    Element::string },
@@ -82,7 +84,8 @@ const SimpleKeywords SimpleParser4::GLOBAL4_PARAMETERS = {
     { "ddns-override-client-update",  Element::boolean },
     { "ddns-replace-client-name",     Element::string },
     { "ddns-generated-prefix",        Element::string },
-    { "ddns-qualifying-suffix",       Element::string }
+    { "ddns-qualifying-suffix",       Element::string },
+    { "lease-query-threads",          Element::integer }
 };
 
 /// @brief This table defines default global values for DHCPv4
@@ -204,6 +207,8 @@ const SimpleKeywords SimpleParser4::SUBNET4_PARAMETERS = {
     { "calculate-tee-times",            Element::boolean },
     { "t1-percent",                     Element::real },
     { "t2-percent",                     Element::real },
+    { "cache-threshold",                Element::real },
+    { "cache-max-age",                  Element::integer },
     { "ddns-send-updates",              Element::boolean },
     { "ddns-override-no-update",        Element::boolean },
     { "ddns-override-client-update",    Element::boolean },
@@ -309,6 +314,8 @@ const SimpleKeywords SimpleParser4::SHARED_NETWORK4_PARAMETERS = {
     { "calculate-tee-times",            Element::boolean },
     { "t1-percent",                     Element::real },
     { "t2-percent",                     Element::real },
+    { "cache-threshold",                Element::real },
+    { "cache-max-age",                  Element::integer },
     { "ddns-send-updates",              Element::boolean },
     { "ddns-override-no-update",        Element::boolean },
     { "ddns-override-client-update",    Element::boolean },
@@ -74,6 +74,8 @@ const SimpleKeywords SimpleParser6::GLOBAL6_PARAMETERS = {
     { "calculate-tee-times",          Element::boolean },
     { "t1-percent",                   Element::real },
     { "t2-percent",                   Element::real },
+    { "cache-threshold",              Element::real },
+    { "cache-max-age",                Element::integer },
     { "loggers",                      Element::list },
     { "hostname-char-set",            Element::string },
     { "hostname-char-replacement",    Element::string },
@@ -197,6 +199,8 @@ const SimpleKeywords SimpleParser6::SUBNET6_PARAMETERS = {
     { "calculate-tee-times",            Element::boolean },
     { "t1-percent",                     Element::real },
     { "t2-percent",                     Element::real },
+    { "cache-threshold",                Element::real },
+    { "cache-max-age",                  Element::integer },
     { "ddns-send-updates",              Element::boolean },
     { "ddns-override-no-update",        Element::boolean },
     { "ddns-override-client-update",    Element::boolean },
@@ -312,6 +316,8 @@ const SimpleKeywords SimpleParser6::SHARED_NETWORK6_PARAMETERS = {
     { "calculate-tee-times",            Element::boolean },
     { "t1-percent",                     Element::real },
     { "t2-percent",                     Element::real },
+    { "cache-threshold",                Element::real },
+    { "cache-max-age",                  Element::integer },
     { "ddns-send-updates",              Element::boolean },
     { "ddns-override-no-update",        Element::boolean },
     { "ddns-override-client-update",    Element::boolean },
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <database/db_exceptions.h>
+#include <database/read_replica_set.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option.h>
 #include <dhcp/option_definition.h>
@@ -14,6 +15,7 @@
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/pgsql_host_data_source.h>
+#include <dhcpsrv/read_replica_timer.h>
 #include <util/buffer.h>
 #include <util/multi_threading_mgr.h>
 #include <util/optional.h>
@@ -53,6 +55,9 @@ const uint8_t MAX_IDENTIFIER_TYPE = static_cast<uint8_t>(Host::LAST_IDENTIFIER_T
 /// @brief Maximum length of DHCP identifier value.
 const size_t DHCP_IDENTIFIER_MAX_LEN = 128;
 
+/// @brief Number of identifiers used by the queries by identifiers.
+const size_t IDENTIFIERS_PER_QUERY = 5;
+
 /// @brief This class provides mechanisms for sending and retrieving
 /// information from the 'hosts' table.
 ///
@@ -1204,7 +1209,7 @@ public:
                 value_.assign(buf_ptr + opt_desc.option_->getHeaderLen(),
                               buf_ptr + buf.getLength());
                 value_len_ = value_.size();
-                bind_array->add(value_);
+                bind_array->addTempBinary(value_);
             } else {
                 // No value or formatted_value specified. In this case, the
                 // value BYTEA should be NULL.
@@ -1357,6 +1362,8 @@ public:
         GET_HOST_ADDR,          // Gets hosts by IPv4 address
         GET_HOST_SUBID4_DHCPID, // Gets host by IPv4 SubnetID, HW address/DUID
         GET_HOST_SUBID6_DHCPID, // Gets host by IPv6 SubnetID, HW address/DUID
+        GET_HOST_SUBID4_DHCPIDS, // Gets hosts by IPv4 SubnetID and identifiers
+        GET_HOST_SUBID6_DHCPIDS, // Gets hosts by IPv6 SubnetID and identifiers
         GET_HOST_SUBID_ADDR,    // Gets host by IPv4 SubnetID and IPv4 address
         GET_HOST_PREFIX,        // Gets host by IPv6 prefix
         GET_HOST_SUBID6_ADDR,   // Gets host by IPv6 SubnetID and IPv6 prefix
@@ -1404,6 +1411,15 @@ public:
     /// failed.
     PgSqlHostContextPtr createContext() const;
 
+    /// @brief Create a new context connected to a database.
+    ///
+    /// @param parameters The parameters of the database, e.g. of a read
+    /// replica.
+    ///
+    /// @return A new (never null) context.
+    PgSqlHostContextPtr
+    createContext(const DatabaseConnection::ParameterMap& parameters) const;
+
     /// @brief Executes statements which insert a row into one of the tables.
     ///
     /// @param ctx Context
@@ -1436,18 +1452,22 @@ public:
                       PgSqlHostDataSourceImpl::StatementIndex stindex,
                       PsqlBindArrayPtr& bind);
 
-    /// @brief Inserts IPv6 Reservation into ipv6_reservation table.
+    /// @brief Queues the insertion of an IPv6 Reservation into the
+    /// ipv6_reservation table.
     ///
     /// @param ctx Context
+    /// @param pipeline Statements to be executed.
     /// @param resv IPv6 Reservation to be added
     /// @param id ID of a host owning this reservation
     void addResv(PgSqlHostContextPtr& ctx,
+                 PgSqlPipeline& pipeline,
                  const IPv6Resrv& resv,
                  const HostID& id);
 
-    /// @brief Inserts a single DHCP option into the database.
+    /// @brief Queues the insertion of a single DHCP option into the database.
     ///
     /// @param ctx Context
+    /// @param pipeline Statements to be executed.
     /// @param stindex Index of a statement being executed.
     /// @param opt_desc Option descriptor holding information about an option
     /// to be inserted into the database.
@@ -1455,21 +1475,24 @@ public:
     /// @param subnet_id Subnet identifier.
     /// @param host_id Host identifier.
     void addOption(PgSqlHostContextPtr& ctx,
+                   PgSqlPipeline& pipeline,
                    const PgSqlHostDataSourceImpl::StatementIndex& stindex,
                    const OptionDescriptor& opt_desc,
                    const std::string& opt_space,
                    const Optional<SubnetID>& subnet_id,
                    const HostID& host_id);
 
-    /// @brief Inserts multiple options into the database.
+    /// @brief Queues the insertion of multiple options into the database.
     ///
     /// @param ctx Context
+    /// @param pipeline Statements to be executed.
     /// @param stindex Index of a statement being executed.
     /// @param options_cfg An object holding a collection of options to be
     /// inserted into the database.
     /// @param host_id Host identifier retrieved using getColumnValue
     ///                in addStatement method
     void addOptions(PgSqlHostContextPtr& ctx,
+                    PgSqlPipeline& pipeline,
                     const StatementIndex& stindex,
                     const ConstCfgOptionPtr& options_cfg,
                     const uint64_t host_id);
@@ -1524,6 +1547,27 @@ public:
                          StatementIndex stindex,
                          boost::shared_ptr<PgSqlHostExchange> exchange) const;
 
+    /// @brief Retrieves hosts by subnet and any of client's identifiers.
+    ///
+    /// This method is used by both PgSqlHostDataSource::getByIdentifiers4
+    /// and PgSqlHostDataSource::getByIdentifiers6 methods. A query is
+    /// issued for every @c IDENTIFIERS_PER_QUERY identifiers.
+    ///
+    /// @param ctx Context
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers of the client.
+    /// @param stindex Statement index.
+    /// @param exchange Pointer to the exchange object used for the
+    /// particular query.
+    ///
+    /// @return Collection of const @c Host objects.
+    ConstHostCollection
+    getHostsByIdentifiers(PgSqlHostContextPtr& ctx,
+                          const SubnetID& subnet_id,
+                          const HostIdentifierList& identifiers,
+                          StatementIndex stindex,
+                          boost::shared_ptr<PgSqlHostExchange> exchange) const;
+
     /// @brief Throws exception if database is read only.
     ///
     /// This method should be called by the methods which write to the
@@ -1550,6 +1594,16 @@ public:
 
     /// @brief The pool of contexts
     PgSqlHostContextPoolPtr pool_;
+
+    /// @brief The pools of contexts connected to the read replicas
+    ///
+    /// Null when no read replica is configured.
+    boost::shared_ptr<db::ReadReplicaPool<PgSqlHostContextPtr> > replicas_;
+
+    /// @brief The timer which reconnects the unavailable read replicas
+    ///
+    /// Null when no read replica is configured.
+    ReadReplicaTimerPtr replica_timer_;
 };
 
 namespace {
@@ -1653,6 +1707,61 @@ TaggedStatementArray tagged_statements = { {
      "ORDER BY h.host_id, o.option_id, r.reservation_id"
     },
 
+    // PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPIDS
+    // Retrieves host information and DHCPv4 options using subnet identifier
+    // and any of the client's identifiers. The unused identifier parameters
+    // repeat the first identifier.
+    {11,
+     { OID_INT8, OID_INT2, OID_BYTEA, OID_INT2, OID_BYTEA, OID_INT2, OID_BYTEA,
+       OID_INT2, OID_BYTEA, OID_INT2, OID_BYTEA },
+     "get_host_subid4_dhcpids",
+     "SELECT h.host_id, h.dhcp_identifier, h.dhcp_identifier_type, "
+     "  h.dhcp4_subnet_id, h.dhcp6_subnet_id, h.ipv4_address, h.hostname, "
+     "  h.dhcp4_client_classes, h.dhcp6_client_classes, h.user_context, "
+     "  h.dhcp4_next_server, h.dhcp4_server_hostname, "
+     "  h.dhcp4_boot_file_name, h.auth_key, "
+     "  o.option_id, o.code, o.value, o.formatted_value, o.space, "
+     "  o.persistent, o.user_context "
+     "FROM hosts AS h "
+     "LEFT JOIN dhcp4_options AS o ON h.host_id = o.host_id "
+     "WHERE h.dhcp4_subnet_id = $1 AND ("
+     "  (h.dhcp_identifier_type = $2 AND h.dhcp_identifier = $3) OR "
+     "  (h.dhcp_identifier_type = $4 AND h.dhcp_identifier = $5) OR "
+     "  (h.dhcp_identifier_type = $6 AND h.dhcp_identifier = $7) OR "
+     "  (h.dhcp_identifier_type = $8 AND h.dhcp_identifier = $9) OR "
+     "  (h.dhcp_identifier_type = $10 AND h.dhcp_identifier = $11)) "
+     "ORDER BY h.host_id, o.option_id"
+    },
+
+    // PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPIDS
+    // Retrieves host information, IPv6 reservations and DHCPv6 options
+    // using subnet identifier and any of the client's identifiers. The
+    // unused identifier parameters repeat the first identifier.
+    {11,
+     { OID_INT8, OID_INT2, OID_BYTEA, OID_INT2, OID_BYTEA, OID_INT2, OID_BYTEA,
+       OID_INT2, OID_BYTEA, OID_INT2, OID_BYTEA },
+     "get_host_subid6_dhcpids",
+     "SELECT h.host_id, h.dhcp_identifier, "
+     "  h.dhcp_identifier_type, h.dhcp4_subnet_id, "
+     "  h.dhcp6_subnet_id, h.ipv4_address, h.hostname, "
+     "  h.dhcp4_client_classes, h.dhcp6_client_classes, h.user_context, "
+     "  h.dhcp4_next_server, h.dhcp4_server_hostname, "
+     "  h.dhcp4_boot_file_name, h.auth_key, "
+     "  o.option_id, o.code, o.value, o.formatted_value, o.space, "
+     "  o.persistent, o.user_context, "
+     "  r.reservation_id, r.address, r.prefix_len, r.type, r.dhcp6_iaid "
+     "FROM hosts AS h "
+     "LEFT JOIN dhcp6_options AS o ON h.host_id = o.host_id "
+     "LEFT JOIN ipv6_reservations AS r ON h.host_id = r.host_id "
+     "WHERE h.dhcp6_subnet_id = $1 AND ("
+     "  (h.dhcp_identifier_type = $2 AND h.dhcp_identifier = $3) OR "
+     "  (h.dhcp_identifier_type = $4 AND h.dhcp_identifier = $5) OR "
+     "  (h.dhcp_identifier_type = $6 AND h.dhcp_identifier = $7) OR "
+     "  (h.dhcp_identifier_type = $8 AND h.dhcp_identifier = $9) OR "
+     "  (h.dhcp_identifier_type = $10 AND h.dhcp_identifier = $11)) "
+     "ORDER BY h.host_id, o.option_id, r.reservation_id"
+    },
+
     // PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR
     // Retrieves host information and DHCPv4 options for the host using subnet
     // identifier and IPv4 reservation. Left joining the dhcp4_options table
@@ -1998,7 +2107,17 @@ PgSqlHostContext::PgSqlHostContext(const DatabaseConnection::ParameterMap& param
 // PgSqlHostContextAlloc Constructor and Destructor
 
 PgSqlHostDataSource::PgSqlHostContextAlloc::PgSqlHostContextAlloc(
-    const PgSqlHostDataSourceImpl& mgr) : ctx_(), mgr_(mgr) {
+    const PgSqlHostDataSourceImpl& mgr, bool replica)
+    : ctx_(), mgr_(mgr), replica_(false), replica_index_(0) {
+
+    // Read only queries use a read replica when one is available.
+    if (replica && mgr_.replicas_) {
+        ctx_ = mgr_.replicas_->acquire(replica_index_);
+        if (ctx_) {
+            replica_ = true;
+            return;
+        }
+    }
 
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
@@ -2023,6 +2142,11 @@ PgSqlHostDataSource::PgSqlHostContextAlloc::PgSqlHostContextAlloc(
 }
 
 PgSqlHostDataSource::PgSqlHostContextAlloc::~PgSqlHostContextAlloc() {
+    if (replica_) {
+        mgr_.replicas_->release(replica_index_, ctx_);
+        return;
+    }
+
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
         lock_guard<mutex> lock(mgr_.pool_->mutex_);
@@ -2049,13 +2173,34 @@ PgSqlHostDataSourceImpl::PgSqlHostDataSourceImpl(const PgSqlConnection::Paramete
     // Create an initial context.
     pool_.reset(new PgSqlHostContextPool());
     pool_->pool_.push_back(createContext());
+
+    // Create the pools of the read replicas, if any.
+    replicas_.reset(new ReadReplicaPool<PgSqlHostContextPtr>(parameters_,
+        [this](const DatabaseConnection::ParameterMap& replica) {
+            return (createContext(replica));
+        }));
+    if (replicas_->size() == 0) {
+        replicas_.reset();
+    } else {
+        // Reconnect the unavailable read replicas in the background.
+        auto replicas = replicas_;
+        replica_timer_.reset(new ReadReplicaTimer([replicas]() {
+            replicas->reconnect();
+        }));
+    }
 }
 
 // Create context.
 
 PgSqlHostContextPtr
 PgSqlHostDataSourceImpl::createContext() const {
-    PgSqlHostContextPtr ctx(new PgSqlHostContext(parameters_));
+    return (createContext(parameters_));
+}
+
+PgSqlHostContextPtr
+PgSqlHostDataSourceImpl::createContext(const DatabaseConnection::ParameterMap&
+                                       parameters) const {
+    PgSqlHostContextPtr ctx(new PgSqlHostContext(parameters));
 
     // Open the database.
     ctx->conn_.openDatabase();
@@ -2095,6 +2240,7 @@ PgSqlHostDataSourceImpl::addStatement(PgSqlHostContextPtr& ctx,
                                       PsqlBindArrayPtr& bind_array,
                                       const bool return_last_id) {
     uint64_t last_id = 0;
+    bind_array->applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array->values_[0],
@@ -2125,6 +2271,7 @@ bool
 PgSqlHostDataSourceImpl::delStatement(PgSqlHostContextPtr& ctx,
                                       StatementIndex stindex,
                                       PsqlBindArrayPtr& bind_array) {
+    bind_array->applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array->values_[0],
@@ -2151,15 +2298,18 @@ PgSqlHostDataSourceImpl::delStatement(PgSqlHostContextPtr& ctx,
 
 void
 PgSqlHostDataSourceImpl::addResv(PgSqlHostContextPtr& ctx,
+                                 PgSqlPipeline& pipeline,
                                  const IPv6Resrv& resv,
                                  const HostID& id) {
     PsqlBindArrayPtr bind_array = ctx->host_ipv6_reservation_exchange_->createBindForSend(resv, id);
 
-    addStatement(ctx, INSERT_V6_RESRV, bind_array);
+    pipeline.push_back(PgSqlPipelineEntry(&tagged_statements[INSERT_V6_RESRV],
+                                          bind_array));
 }
 
 void
 PgSqlHostDataSourceImpl::addOption(PgSqlHostContextPtr& ctx,
+                                   PgSqlPipeline& pipeline,
                                    const StatementIndex& stindex,
                                    const OptionDescriptor& opt_desc,
                                    const std::string& opt_space,
@@ -2167,11 +2317,13 @@ PgSqlHostDataSourceImpl::addOption(PgSqlHostContextPtr& ctx,
                                    const HostID& id) {
     PsqlBindArrayPtr bind_array = ctx->host_option_exchange_->createBindForSend(opt_desc, opt_space, id);
 
-    addStatement(ctx, stindex, bind_array);
+    pipeline.push_back(PgSqlPipelineEntry(&tagged_statements[stindex],
+                                          bind_array));
 }
 
 void
 PgSqlHostDataSourceImpl::addOptions(PgSqlHostContextPtr& ctx,
+                                    PgSqlPipeline& pipeline,
                                     const StatementIndex& stindex,
                                     const ConstCfgOptionPtr& options_cfg,
                                     const uint64_t host_id) {
@@ -2188,7 +2340,8 @@ PgSqlHostDataSourceImpl::addOptions(PgSqlHostContextPtr& ctx,
         OptionContainerPtr options = options_cfg->getAll(*space);
         if (options && !options->empty()) {
             for (auto opt = options->begin(); opt != options->end(); ++opt) {
-                addOption(ctx, stindex, *opt, *space, Optional<SubnetID>(), host_id);
+                addOption(ctx, pipeline, stindex, *opt, *space,
+                          Optional<SubnetID>(), host_id);
             }
         }
     }
@@ -2202,12 +2355,16 @@ PgSqlHostDataSourceImpl::getHostCollection(PgSqlHostContextPtr& ctx,
                                            ConstHostCollection& result,
                                            bool single) const {
 
+    // The hosts are fetched in binary format which saves the hex
+    // encoding of the identifiers and option values.
     exchange->clear();
+    bind_array->applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array->values_[0],
                                  &bind_array->lengths_[0],
-                                 &bind_array->formats_[0], 0));
+                                 &bind_array->formats_[0],
+                                 PsqlBindArray::BINARY_FMT));
 
     ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
 
@@ -2256,6 +2413,40 @@ PgSqlHostDataSourceImpl::getHost(PgSqlHostContextPtr& ctx,
     return (result);
 }
 
+ConstHostCollection
+PgSqlHostDataSourceImpl::getHostsByIdentifiers(PgSqlHostContextPtr& ctx,
+                                               const SubnetID& subnet_id,
+                                               const HostIdentifierList& identifiers,
+                                               StatementIndex stindex,
+                                               boost::shared_ptr<PgSqlHostExchange> exchange) const {
+    ConstHostCollection collection;
+    auto id = identifiers.begin();
+    while (id != identifiers.end()) {
+        // Set up the WHERE clause value
+        PsqlBindArrayPtr bind_array(new PsqlBindArray());
+
+        // Add the subnet id.
+        bind_array->add(subnet_id);
+
+        // Add the identifier types and values. The unused parameters
+        // repeat the first identifier of the query.
+        auto first = id;
+        for (size_t i = 0; i < IDENTIFIERS_PER_QUERY; ++i) {
+            auto param = (id != identifiers.end() ? id++ : first);
+            bind_array->add(static_cast<uint8_t>(param->first));
+            bind_array->add(param->second);
+        }
+
+        // Each query fills its own collection: a row is merged into the
+        // last host of the collection unless it holds a greater host id.
+        ConstHostCollection hosts;
+        getHostCollection(ctx, stindex, bind_array, exchange, hosts, false);
+        collection.insert(collection.end(), hosts.begin(), hosts.end());
+    }
+
+    return (collection);
+}
+
 std::pair<uint32_t, uint32_t>
 PgSqlHostDataSourceImpl::getVersion() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -2302,18 +2493,21 @@ PgSqlHostDataSource::add(const HostPtr& host) {
     uint32_t host_id = impl_->addStatement(ctx, PgSqlHostDataSourceImpl::INSERT_HOST,
                                            bind_array, true);
 
+    // The options and reservations are inserted in one batch.
+    PgSqlPipeline pipeline;
+
     // Insert DHCPv4 options.
-    ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
-    if (cfg_option4) {
-        impl_->addOptions(ctx, PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
-                          cfg_option4, host_id);
+    if (host->hasOptions4()) {
+        impl_->addOptions(ctx, pipeline,
+                          PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
+                          host->getCfgOption4(), host_id);
     }
 
     // Insert DHCPv6 options.
-    ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
-    if (cfg_option6) {
-        impl_->addOptions(ctx, PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
-                          cfg_option6, host_id);
+    if (host->hasOptions6()) {
+        impl_->addOptions(ctx, pipeline,
+                          PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
+                          host->getCfgOption6(), host_id);
     }
 
     // Insert IPv6 reservations.
@@ -2321,10 +2515,12 @@ PgSqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(ctx, resv->second, host_id);
+            impl_->addResv(ctx, pipeline, resv->second, host_id);
         }
     }
 
+    ctx->conn_.executePipeline(pipeline);
+
     // Everything went fine, so explicitly commit the transaction.
     transaction.commit();
 }
@@ -2414,10 +2610,6 @@ ConstHostCollection
 PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
                             const uint8_t* identifier_begin,
                             const size_t identifier_len) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2428,18 +2620,19 @@ PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     bind_array->add(static_cast<uint8_t>(identifier_type));
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
-                             bind_array, ctx->host_ipv46_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
+                                     bind_array, ctx->host_ipv46_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 PgSqlHostDataSource::getAll4(const SubnetID& subnet_id) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2447,18 +2640,19 @@ PgSqlHostDataSource::getAll4(const SubnetID& subnet_id) const {
     bind_array->add(subnet_id);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID4,
-                             bind_array, ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID4,
+                                     bind_array, ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 PgSqlHostDataSource::getAll6(const SubnetID& subnet_id) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2466,18 +2660,19 @@ PgSqlHostDataSource::getAll6(const SubnetID& subnet_id) const {
     bind_array->add(subnet_id);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6,
-                             bind_array, ctx->host_ipv6_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6,
+                                     bind_array, ctx->host_ipv6_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 PgSqlHostDataSource::getAllbyHostname(const std::string& hostname) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2485,8 +2680,13 @@ PgSqlHostDataSource::getAllbyHostname(const std::string& hostname) const {
     bind_array->add(hostname);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_HOSTNAME,
-                             bind_array, ctx->host_ipv46_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_HOSTNAME,
+                                     bind_array, ctx->host_ipv46_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -2494,10 +2694,6 @@ PgSqlHostDataSource::getAllbyHostname(const std::string& hostname) const {
 ConstHostCollection
 PgSqlHostDataSource::getAllbyHostname4(const std::string& hostname,
                                        const SubnetID& subnet_id) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2508,8 +2704,13 @@ PgSqlHostDataSource::getAllbyHostname4(const std::string& hostname,
     bind_array->add(subnet_id);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID4,
-                             bind_array, ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID4,
+                                     bind_array, ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -2517,10 +2718,6 @@ PgSqlHostDataSource::getAllbyHostname4(const std::string& hostname,
 ConstHostCollection
 PgSqlHostDataSource::getAllbyHostname6(const std::string& hostname,
                                        const SubnetID& subnet_id) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2531,8 +2728,13 @@ PgSqlHostDataSource::getAllbyHostname6(const std::string& hostname,
     bind_array->add(subnet_id);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID6,
-                             bind_array, ctx->host_ipv6_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_HOSTNAME_SUBID6,
+                                     bind_array, ctx->host_ipv6_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -2542,10 +2744,6 @@ PgSqlHostDataSource::getPage4(const SubnetID& subnet_id,
                               size_t& /*source_index*/,
                               uint64_t lower_host_id,
                               const HostPageSize& page_size) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2561,8 +2759,13 @@ PgSqlHostDataSource::getPage4(const SubnetID& subnet_id,
     bind_array->add(page_size_data);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE,
-                             bind_array, ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE,
+                                     bind_array, ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -2572,10 +2775,6 @@ PgSqlHostDataSource::getPage6(const SubnetID& subnet_id,
                               size_t& /*source_index*/,
                               uint64_t lower_host_id,
                               const HostPageSize& page_size) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2591,18 +2790,19 @@ PgSqlHostDataSource::getPage6(const SubnetID& subnet_id,
     bind_array->add(page_size_data);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE,
-                             bind_array, ctx->host_ipv6_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE,
+                                     bind_array, ctx->host_ipv6_exchange_, result, false);
+        });
 
     return (result);
 }
 
 ConstHostCollection
 PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2610,8 +2810,13 @@ PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     bind_array->add(address);
 
     ConstHostCollection result;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_ADDR,
-                             bind_array, ctx->host_ipv4_exchange_, result, false);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_ADDR,
+                                     bind_array, ctx->host_ipv4_exchange_, result, false);
+        });
 
     return (result);
 }
@@ -2621,22 +2826,23 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
+    ConstHostPtr result;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            result = impl_->getHost(ctx, subnet_id, identifier_type,
+                                    identifier_begin, identifier_len,
+                                    PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
+                                    ctx->host_ipv4_exchange_);
+        });
 
-    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin, identifier_len,
-                           PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                           ctx->host_ipv4_exchange_));
+    return (result);
 }
 
 ConstHostPtr
 PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     if (!address.isV4()) {
         isc_throw(BadValue, "PgSqlHostDataSource::get4(id, address) - "
                   " wrong address type, address supplied is an IPv6 address");
@@ -2652,8 +2858,13 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
     bind_array->add(address);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             bind_array, ctx->host_ipv4_exchange_, collection, true);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, collection,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                                     bind_array, ctx->host_ipv4_exchange_, collection, true);
+        });
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2669,13 +2880,18 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
+    ConstHostPtr result;
 
-    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin, identifier_len,
-                           PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                           ctx->host_ipv6_exchange_));
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            result = impl_->getHost(ctx, subnet_id, identifier_type,
+                                    identifier_begin, identifier_len,
+                                    PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
+                                    ctx->host_ipv6_exchange_);
+        });
+
+    return (result);
 }
 
 ConstHostPtr
@@ -2686,10 +2902,6 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                   "wrong address type, address supplied is an IPv4 address");
     }
 
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2700,8 +2912,13 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
     bind_array->add(prefix_len);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             bind_array, ctx->host_ipv6_exchange_, collection, true);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, collection,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
+                                     bind_array, ctx->host_ipv6_exchange_, collection, true);
+        });
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2720,10 +2937,6 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                   "wrong address type, address supplied is an IPv4 address");
     }
 
-    // Get a context
-    PgSqlHostContextAlloc get_context(*impl_);
-    PgSqlHostContextPtr ctx = get_context.ctx_;
-
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -2734,8 +2947,13 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
     bind_array->add(address);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             bind_array, ctx->host_ipv6_exchange_, collection, true);
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, collection,
+        [&](PgSqlHostContextPtr& ctx) {
+            impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                                     bind_array, ctx->host_ipv6_exchange_, collection, true);
+        });
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2746,6 +2964,46 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
     return (result);
 }
 
+ConstHostCollection
+PgSqlHostDataSource::getByIdentifiers4(const SubnetID& subnet_id,
+                                       const HostIdentifierList& identifiers) const {
+    if (identifiers.empty()) {
+        return (ConstHostCollection());
+    }
+
+    ConstHostCollection result;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            result = impl_->getHostsByIdentifiers(ctx, subnet_id, identifiers,
+                                                  PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPIDS,
+                                                  ctx->host_ipv4_exchange_);
+        });
+
+    return (result);
+}
+
+ConstHostCollection
+PgSqlHostDataSource::getByIdentifiers6(const SubnetID& subnet_id,
+                                       const HostIdentifierList& identifiers) const {
+    if (identifiers.empty()) {
+        return (ConstHostCollection());
+    }
+
+    ConstHostCollection result;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlHostContextAlloc>(*impl_, result,
+        [&](PgSqlHostContextPtr& ctx) {
+            result = impl_->getHostsByIdentifiers(ctx, subnet_id, identifiers,
+                                                  PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPIDS,
+                                                  ctx->host_ipv6_exchange_);
+        });
+
+    return (result);
+}
+
 // Miscellaneous database methods.
 
 std::string
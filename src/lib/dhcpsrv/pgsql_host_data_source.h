@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -348,6 +348,34 @@ public:
     virtual ConstHostPtr get6(const SubnetID& subnet_id,
                               const asiolink::IOAddress& address) const;
 
+    /// @brief Returns hosts connected to the IPv4 subnet using any of the
+    /// specified identifiers.
+    ///
+    /// The hosts are fetched using a single query for up to five
+    /// identifiers.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Collection of const @c Host objects.
+    virtual ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const;
+
+    /// @brief Returns hosts connected to the IPv6 subnet using any of the
+    /// specified identifiers.
+    ///
+    /// The hosts are fetched using a single query for up to five
+    /// identifiers.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Collection of const @c Host objects.
+    virtual ConstHostCollection
+    getByIdentifiers6(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const;
+
     /// @brief Return backend type
     ///
     /// Returns the type of database as the string "postgresql".  This is
@@ -404,8 +432,13 @@ public:
         /// This constructor takes a context of the pool if one is available
         /// or creates a new one.
         ///
+        /// When a read replica is requested and available the context is
+        /// connected to a read replica.
+        ///
         /// @param mgr A parent instance
-        PgSqlHostContextAlloc(const PgSqlHostDataSourceImpl& mgr);
+        /// @param replica true for read only queries which may be sent
+        /// to a read replica.
+        PgSqlHostContextAlloc(const PgSqlHostDataSourceImpl& mgr, bool replica = false);
 
         /// @brief Destructor
         ///
@@ -418,6 +451,12 @@ public:
     private:
         /// @brief The manager
         const PgSqlHostDataSourceImpl& mgr_;
+
+        /// @brief Indicates if the context is connected to a read replica.
+        bool replica_;
+
+        /// @brief Index of the read replica.
+        size_t replica_index_;
     };
 
 private:
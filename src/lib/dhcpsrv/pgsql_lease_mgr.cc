@@ -13,10 +13,12 @@
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/pgsql_lease_mgr.h>
 #include <util/multi_threading_mgr.h>
+#include <util/trace_mgr.h>
 
 #include <boost/make_shared.hpp>
 #include <boost/static_assert.hpp>
 
+#include <algorithm>
 #include <iomanip>
 #include <limits>
 #include <sstream>
@@ -354,10 +356,111 @@ PgSqlTaggedStatement tagged_statements[] = {
       "  FROM lease6_stat "
       "  WHERE subnet_id >= $1 and subnet_id <= $2 "
       "  ORDER BY subnet_id, lease_type, state" },
+
+    // UPDATE_LEASE4_RECLAIMED
+    { 31, { OID_INT8, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP,
+            OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP,
+            OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP,
+            OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_TIMESTAMP },
+      "update_lease4_reclaimed",
+      "UPDATE lease4 SET hostname = '', fqdn_fwd = FALSE, "
+        "fqdn_rev = FALSE, state = $1 "
+      "WHERE (address, expire) IN ("
+        "($2, $3), ($4, $5), ($6, $7), ($8, $9), ($10, $11), "
+        "($12, $13), ($14, $15), ($16, $17), ($18, $19), ($20, $21), "
+        "($22, $23), ($24, $25), ($26, $27), ($28, $29), ($30, $31))"},
+
+    // UPDATE_LEASE6_RECLAIMED
+    { 31, { OID_INT8, OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP },
+      "update_lease6_reclaimed",
+      "UPDATE lease6 SET hostname = '', fqdn_fwd = FALSE, "
+        "fqdn_rev = FALSE, state = $1 "
+      "WHERE (address, expire) IN ("
+        "($2, $3), ($4, $5), ($6, $7), ($8, $9), ($10, $11), "
+        "($12, $13), ($14, $15), ($16, $17), ($18, $19), ($20, $21), "
+        "($22, $23), ($24, $25), ($26, $27), ($28, $29), ($30, $31))"},
+
+    // DELETE_LEASE4_RECLAIMED
+    { 30, { OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP,
+            OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP,
+            OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_TIMESTAMP },
+      "delete_lease4_reclaimed",
+      "DELETE FROM lease4 WHERE (address, expire) IN ("
+        "($1, $2), ($3, $4), ($5, $6), ($7, $8), ($9, $10), "
+        "($11, $12), ($13, $14), ($15, $16), ($17, $18), ($19, $20), "
+        "($21, $22), ($23, $24), ($25, $26), ($27, $28), ($29, $30))"},
+
+    // DELETE_LEASE6_RECLAIMED
+    { 30, { OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP, OID_VARCHAR, OID_TIMESTAMP,
+            OID_VARCHAR, OID_TIMESTAMP },
+      "delete_lease6_reclaimed",
+      "DELETE FROM lease6 WHERE (address, expire) IN ("
+        "($1, $2), ($3, $4), ($5, $6), ($7, $8), ($9, $10), "
+        "($11, $12), ($13, $14), ($15, $16), ($17, $18), ($19, $20), "
+        "($21, $22), ($23, $24), ($25, $26), ($27, $28), ($29, $30))"},
+
+    // ALLOCATE_LEASE4
+    { 13, { OID_INT8, OID_BYTEA, OID_BYTEA, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_BOOL, OID_BOOL, OID_VARCHAR, OID_INT8, OID_TEXT, OID_INT2,
+            OID_TIMESTAMP },
+      "allocate_lease4",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, "
+        "state, user_context, allocated "
+      "FROM lease4AllocateOrRenew($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, "
+        "$11, $12, $13)"},
+
     // End of list sentinel
     { 0,  { 0 }, NULL, NULL}
 };
 
+/// @brief Adds the key of an IPv4 lease to a batched statement.
+///
+/// @param bind_array The parameters of the statement.
+/// @param lease The lease.
+void
+addReclaimKey(PsqlBindArray& bind_array, const Lease4Ptr& lease) {
+    bind_array.addTempString(boost::lexical_cast<std::string>
+                             (lease->addr_.toUint32()));
+    bind_array.addTempString(PgSqlExchange::convertToDatabaseTime(lease->old_cltt_,
+                                                                  lease->old_valid_lft_));
+}
+
+/// @brief Adds the key of an IPv6 lease to a batched statement.
+///
+/// @param bind_array The parameters of the statement.
+/// @param lease The lease.
+void
+addReclaimKey(PsqlBindArray& bind_array, const Lease6Ptr& lease) {
+    bind_array.addTempString(lease->addr_.toText());
+    bind_array.addTempString(PgSqlExchange::convertToDatabaseTime(lease->old_cltt_,
+                                                                  lease->old_valid_lft_));
+}
+
+/// @brief Column of the allocated flag returned by the
+/// lease4AllocateOrRenew function after the lease4 columns.
+const size_t ALLOCATED_COL = 11;
+
 }  // namespace
 
 namespace isc {
@@ -553,8 +656,7 @@ public:
 
             getColumnValue(r, row, VALID_LIFETIME_COL, valid_lifetime_);
 
-            expire_ = convertFromDatabaseTime(getRawColumnValue(r, row,
-                                                                EXPIRE_COL));
+            getColumnValue(r, row, EXPIRE_COL, expire_);
 
             getColumnValue(r, row , SUBNET_ID_COL, subnet_id_);
 
@@ -848,8 +950,7 @@ public:
 
             getColumnValue(r, row, VALID_LIFETIME_COL, valid_lifetime_);
 
-            expire_ = convertFromDatabaseTime(getRawColumnValue(r, row,
-                                                                EXPIRE_COL));
+            getColumnValue(r, row, EXPIRE_COL, expire_);
 
             // Recover from overflow
             if (valid_lifetime_ == Lease::INFINITY_LFT) {
@@ -1070,6 +1171,7 @@ public:
             }
 
             // Run the query with where clause parameters.
+            parms.applyBinaryFormat(statement_);
             result_set_.reset(new PgSqlResult(PQexecPrepared(conn_, statement_.name,
                                               parms.size(), &parms.values_[0],
                                               &parms.lengths_[0], &parms.formats_[0], 0)));
@@ -1154,7 +1256,17 @@ PgSqlLeaseContext::PgSqlLeaseContext(const DatabaseConnection::ParameterMap& par
 // PgSqlLeaseContextAlloc Constructor and Destructor
 
 PgSqlLeaseMgr::PgSqlLeaseContextAlloc::PgSqlLeaseContextAlloc(
-    const PgSqlLeaseMgr& mgr) : ctx_(), mgr_(mgr) {
+    const PgSqlLeaseMgr& mgr, bool replica)
+    : ctx_(), mgr_(mgr), replica_(false), replica_index_(0) {
+
+    // Read only queries use a read replica when one is available.
+    if (replica && mgr_.replicas_) {
+        ctx_ = mgr_.replicas_->acquire(replica_index_);
+        if (ctx_) {
+            replica_ = true;
+            return;
+        }
+    }
 
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
@@ -1179,6 +1291,11 @@ PgSqlLeaseMgr::PgSqlLeaseContextAlloc::PgSqlLeaseContextAlloc(
 }
 
 PgSqlLeaseMgr::PgSqlLeaseContextAlloc::~PgSqlLeaseContextAlloc() {
+    if (replica_) {
+        mgr_.replicas_->release(replica_index_, ctx_);
+        return;
+    }
+
     if (MultiThreadingMgr::instance().getMode()) {
         // multi-threaded
         lock_guard<mutex> lock(mgr_.pool_->mutex_);
@@ -1190,7 +1307,7 @@ PgSqlLeaseMgr::PgSqlLeaseContextAlloc::~PgSqlLeaseContextAlloc() {
 // PgSqlLeaseMgr Constructor and Destructor
 
 PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
-    : parameters_(parameters) {
+    : parameters_(parameters), allocate_or_renew_(false) {
 
     // Validate schema version first.
     std::pair<uint32_t, uint32_t> code_version(PG_SCHEMA_VERSION_MAJOR,
@@ -1204,9 +1321,31 @@ PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
                       << db_version.second);
     }
 
+    // Check if the allocation should use the stored function.
+    DatabaseConnection::ParameterMap::const_iterator param =
+        parameters_.find("allocate-or-renew");
+    if (param != parameters_.end()) {
+        allocate_or_renew_ = (param->second == "true");
+    }
+
     // Create an initial context.
     pool_.reset(new PgSqlLeaseContextPool());
     pool_->pool_.push_back(createContext());
+
+    // Create the pools of the read replicas, if any.
+    replicas_.reset(new ReadReplicaPool<PgSqlLeaseContextPtr>(parameters_,
+        [this](const DatabaseConnection::ParameterMap& replica) {
+            return (createContext(replica));
+        }));
+    if (replicas_->size() == 0) {
+        replicas_.reset();
+    } else {
+        // Reconnect the unavailable read replicas in the background.
+        auto replicas = replicas_;
+        replica_timer_.reset(new ReadReplicaTimer([replicas]() {
+            replicas->reconnect();
+        }));
+    }
 }
 
 PgSqlLeaseMgr::~PgSqlLeaseMgr() {
@@ -1216,7 +1355,13 @@ PgSqlLeaseMgr::~PgSqlLeaseMgr() {
 
 PgSqlLeaseContextPtr
 PgSqlLeaseMgr::createContext() const {
-    PgSqlLeaseContextPtr ctx(new PgSqlLeaseContext(parameters_));
+    return (createContext(parameters_));
+}
+
+PgSqlLeaseContextPtr
+PgSqlLeaseMgr::createContext(const DatabaseConnection::ParameterMap&
+                             parameters) const {
+    PgSqlLeaseContextPtr ctx(new PgSqlLeaseContext(parameters));
 
     // Open the database.
     ctx->conn_.openDatabase();
@@ -1254,6 +1399,10 @@ bool
 PgSqlLeaseMgr::addLeaseCommon(PgSqlLeaseContextPtr& ctx,
                               StatementIndex stindex,
                               PsqlBindArray& bind_array) {
+    ScopedTrace trace("lease-add",
+                      tagged_statements[stindex].name);
+
+    bind_array.applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
@@ -1323,12 +1472,19 @@ PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContextPtr& ctx,
                                   Exchange& exchange,
                                   LeaseCollection& result,
                                   bool single) const {
+    ScopedTrace trace("lease-get",
+                      tagged_statements[stindex].name);
+
+    // The leases are fetched in binary format which saves the hex
+    // encoding of the hardware addresses, client ids and DUIDs.
     const int n = tagged_statements[stindex].nbparams;
+    bind_array.applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_,
                                  tagged_statements[stindex].name, n,
                                  n > 0 ? &bind_array.values_[0] : NULL,
                                  n > 0 ? &bind_array.lengths_[0] : NULL,
-                                 n > 0 ? &bind_array.formats_[0] : NULL, 0));
+                                 n > 0 ? &bind_array.formats_[0] : NULL,
+                                 PsqlBindArray::BINARY_FMT));
 
     ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
 
@@ -1545,11 +1701,11 @@ PgSqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
     // ... and get the data
     Lease4Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4_SUBID, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4_SUBID, bind_array, result);
+        });
 
     return (result);
 }
@@ -1568,11 +1724,11 @@ PgSqlLeaseMgr::getLeases4(const std::string& hostname) const {
     // ... and get the data
     Lease4Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4_HOSTNAME, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4_HOSTNAME, bind_array, result);
+        });
 
     return (result);
 }
@@ -1586,11 +1742,11 @@ PgSqlLeaseMgr::getLeases4() const {
     PsqlBindArray bind_array;
     Lease4Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4, bind_array, result);
+        });
 
     return (result);
 }
@@ -1623,11 +1779,11 @@ PgSqlLeaseMgr::getLeases4(const IOAddress& lower_bound_address,
     // Get the leases
     Lease4Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE4_PAGE, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE4_PAGE, bind_array, result);
+        });
 
     return (result);
 }
@@ -1750,11 +1906,11 @@ PgSqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
     // ... and get the data
     Lease6Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_SUBID, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_SUBID, bind_array, result);
+        });
 
     return (result);
 }
@@ -1771,12 +1927,11 @@ PgSqlLeaseMgr::getLeases6(const DUID& duid) const {
     bind_array.add(duid.getDuid());
     Lease6Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    // query to fetch the data
-    getLeaseCollection(ctx, GET_LEASE6_DUID, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_DUID, bind_array, result);
+        });
 
     return (result);
 }
@@ -1795,11 +1950,11 @@ PgSqlLeaseMgr::getLeases6(const std::string& hostname) const {
     // ... and get the data
     Lease6Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_HOSTNAME, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_HOSTNAME, bind_array, result);
+        });
 
     return (result);
 }
@@ -1813,11 +1968,11 @@ PgSqlLeaseMgr::getLeases6() const {
     PsqlBindArray bind_array;
     Lease6Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6, bind_array, result);
+        });
 
     return (result);
 }
@@ -1857,11 +2012,11 @@ PgSqlLeaseMgr::getLeases6(const IOAddress& lower_bound_address,
     // Get the leases
     Lease6Collection result;
 
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    getLeaseCollection(ctx, GET_LEASE6_PAGE, bind_array, result);
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, result,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            getLeaseCollection(ctx, GET_LEASE6_PAGE, bind_array, result);
+        });
 
     return (result);
 }
@@ -1918,6 +2073,10 @@ PgSqlLeaseMgr::updateLeaseCommon(PgSqlLeaseContextPtr& ctx,
                                  StatementIndex stindex,
                                  PsqlBindArray& bind_array,
                                  const LeasePtr& lease) {
+    ScopedTrace trace("lease-update",
+                      tagged_statements[stindex].name);
+
+    bind_array.applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
@@ -2009,10 +2168,14 @@ PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 uint64_t
 PgSqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
                                  PsqlBindArray& bind_array) {
+    ScopedTrace trace("lease-delete",
+                      tagged_statements[stindex].name);
+
     // Get a context
     PgSqlLeaseContextAlloc get_context(*this);
     PgSqlLeaseContextPtr ctx = get_context.ctx_;
 
+    bind_array.applyBinaryFormat(tagged_statements[stindex]);
     PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
@@ -2094,6 +2257,160 @@ PgSqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
               "that had the address " << lease->addr_.toText());
 }
 
+const size_t PgSqlLeaseMgr::RECLAIM_BATCH_SIZE;
+
+template <typename LeaseCollection>
+void
+PgSqlLeaseMgr::reclaimLeasesCommon(StatementIndex update_index,
+                                   const LeaseCollection& updated,
+                                   StatementIndex delete_index,
+                                   const LeaseCollection& deleted,
+                                   LeaseCollection& skipped) {
+    // Each group of leases is written by one statement. The statements
+    // of all groups are sent together.
+    PgSqlPipeline pipeline;
+    std::vector<std::pair<bool, size_t> > groups;
+    for (bool remove : { false, true }) {
+        const LeaseCollection& leases = (remove ? deleted : updated);
+        const StatementIndex stindex = (remove ? delete_index : update_index);
+        for (size_t first = 0; first < leases.size();
+             first += RECLAIM_BATCH_SIZE) {
+            const size_t count = std::min(RECLAIM_BATCH_SIZE,
+                                          leases.size() - first);
+            PsqlBindArrayPtr bind_array(new PsqlBindArray());
+
+            // The update statement sets the state given by the first
+            // parameter.
+            if (!remove) {
+                bind_array->add(Lease::STATE_EXPIRED_RECLAIMED);
+            }
+
+            // The unused keys repeat the first lease of the group, which
+            // does not change the outcome of the statement.
+            for (size_t i = 0; i < RECLAIM_BATCH_SIZE; ++i) {
+                addReclaimKey(*bind_array,
+                              leases[first + (i < count ? i : 0)]);
+            }
+
+            pipeline.push_back(PgSqlPipelineEntry(&tagged_statements[stindex],
+                                                  bind_array));
+            groups.push_back(std::make_pair(remove, first));
+        }
+    }
+
+    if (pipeline.empty()) {
+        return;
+    }
+
+    ScopedTrace trace("lease-reclaim", tagged_statements[update_index].name);
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    std::vector<size_t> affected_rows = ctx->conn_.executePipeline(pipeline);
+
+    // When a statement writes fewer leases than its group holds, the
+    // leases of the group are fetched again to find out which ones were
+    // renewed or removed in the meantime.
+    for (size_t group = 0; group < groups.size(); ++group) {
+        const bool remove = groups[group].first;
+        const LeaseCollection& leases = (remove ? deleted : updated);
+        const size_t first = groups[group].second;
+        const size_t count = std::min(RECLAIM_BATCH_SIZE, leases.size() - first);
+        if (affected_rows[group] < count) {
+            for (size_t i = first; i < first + count; ++i) {
+                if (isReclaimSkipped(leases[i], remove)) {
+                    skipped.push_back(leases[i]);
+                }
+            }
+        }
+    }
+}
+
+bool
+PgSqlLeaseMgr::allocateOrRenewLease4(const Lease4Ptr& lease,
+                                     Lease4Ptr& old_lease) {
+    const StatementIndex stindex = ALLOCATE_LEASE4;
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_ALLOCATE_ADDR4).arg(lease->addr_.toText());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    ScopedTrace trace("lease-allocate",
+                      tagged_statements[stindex].name);
+
+    // The lease columns are followed by the hardware type, which is not
+    // stored in the lease4 table but is used to match the hardware address,
+    // and by the current time which is used to check if the existing lease
+    // is expired.
+    PsqlBindArray bind_array;
+    ctx->exchange4_->createBindForSend(lease, bind_array);
+    if (lease->hwaddr_) {
+        bind_array.add(lease->hwaddr_->htype_);
+    } else {
+        bind_array.addNull();
+    }
+    std::string now_str = PgSqlLeaseExchange::convertToDatabaseTime(time(NULL));
+    bind_array.add(now_str);
+
+    bind_array.applyBinaryFormat(tagged_statements[stindex]);
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
+                                 tagged_statements[stindex].nbparams,
+                                 &bind_array.values_[0],
+                                 &bind_array.lengths_[0],
+                                 &bind_array.formats_[0], 0));
+
+    ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
+
+    // There is no row when the lease has been added. Otherwise the row
+    // holds the previous lease followed by the allocated flag.
+    old_lease.reset();
+    bool allocated = true;
+    if (PQntuples(r) > 0) {
+        old_lease = ctx->exchange4_->convertFromDatabase(r, 0);
+        PgSqlExchange::getColumnValue(r, 0, ALLOCATED_COL, allocated);
+    }
+
+    if (allocated) {
+        lease->old_cltt_ = lease->cltt_;
+        lease->old_valid_lft_ = lease->valid_lft_;
+    }
+
+    return (allocated);
+}
+
+Lease4Collection
+PgSqlLeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                              const Lease4Collection& deleted) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_RECLAIM_LEASES4)
+        .arg(updated.size())
+        .arg(deleted.size());
+
+    Lease4Collection skipped;
+    reclaimLeasesCommon(UPDATE_LEASE4_RECLAIMED, updated,
+                        DELETE_LEASE4_RECLAIMED, deleted, skipped);
+    return (skipped);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                              const Lease6Collection& deleted) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_RECLAIM_LEASES6)
+        .arg(updated.size())
+        .arg(deleted.size());
+
+    Lease6Collection skipped;
+    reclaimLeasesCommon(UPDATE_LEASE6_RECLAIMED, updated,
+                        DELETE_LEASE6_RECLAIMED, deleted, skipped);
+    return (skipped);
+}
+
 uint64_t
 PgSqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED4)
@@ -2128,87 +2445,99 @@ PgSqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startLeaseStatsQuery4() {
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new PgSqlLeaseStatsQuery(ctx->conn_,
-                                                      tagged_statements[ALL_LEASE4_STATS],
-                                                      false));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, query,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            query.reset(new PgSqlLeaseStatsQuery(ctx->conn_,
+                                                 tagged_statements[ALL_LEASE4_STATS],
+                                                 false));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new PgSqlLeaseStatsQuery(ctx->conn_,
-                                                      tagged_statements[SUBNET_LEASE4_STATS],
-                                                      false,
-                                                      subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, query,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            query.reset(new PgSqlLeaseStatsQuery(ctx->conn_,
+                                                 tagged_statements[SUBNET_LEASE4_STATS],
+                                                 false,
+                                                 subnet_id));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
                                                 const SubnetID& last_subnet_id) {
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new PgSqlLeaseStatsQuery(ctx->conn_,
-                                                      tagged_statements[SUBNET_RANGE_LEASE4_STATS],
-                                                      false,
-                                                      first_subnet_id,
-                                                      last_subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, query,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            query.reset(new PgSqlLeaseStatsQuery(ctx->conn_,
+                                                 tagged_statements[SUBNET_RANGE_LEASE4_STATS],
+                                                 false,
+                                                 first_subnet_id,
+                                                 last_subnet_id));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startLeaseStatsQuery6() {
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new PgSqlLeaseStatsQuery(ctx->conn_,
-                                                      tagged_statements[ALL_LEASE6_STATS],
-                                                      true));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, query,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            query.reset(new PgSqlLeaseStatsQuery(ctx->conn_,
+                                                 tagged_statements[ALL_LEASE6_STATS],
+                                                 true));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new PgSqlLeaseStatsQuery(ctx->conn_,
-                                                      tagged_statements[SUBNET_LEASE6_STATS],
-                                                      true,
-                                                      subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, query,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            query.reset(new PgSqlLeaseStatsQuery(ctx->conn_,
+                                                 tagged_statements[SUBNET_LEASE6_STATS],
+                                                 true,
+                                                 subnet_id));
+            query->start();
+        });
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& first_subnet_id,
                                                 const SubnetID& last_subnet_id) {
-    // Get a context
-    PgSqlLeaseContextAlloc get_context(*this);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
-    LeaseStatsQueryPtr query(new PgSqlLeaseStatsQuery(ctx->conn_,
-                                                      tagged_statements[SUBNET_RANGE_LEASE6_STATS],
-                                                      true,
-                                                      first_subnet_id,
-                                                      last_subnet_id));
-    query->start();
+    LeaseStatsQueryPtr query;
+
+    // Use a read replica when one is available
+    readFromReplica<PgSqlLeaseContextAlloc>(*this, query,
+        [&](PgSqlLeaseContextPtr& ctx) {
+            query.reset(new PgSqlLeaseStatsQuery(ctx->conn_,
+                                                 tagged_statements[SUBNET_RANGE_LEASE6_STATS],
+                                                 true,
+                                                 first_subnet_id,
+                                                 last_subnet_id));
+            query->start();
+        });
     return(query);
 }
 
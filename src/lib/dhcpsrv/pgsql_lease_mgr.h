@@ -7,9 +7,11 @@
 #ifndef PGSQL_LEASE_MGR_H
 #define PGSQL_LEASE_MGR_H
 
+#include <database/read_replica_set.h>
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/read_replica_timer.h>
 #include <pgsql/pgsql_connection.h>
 #include <pgsql/pgsql_exchange.h>
 
@@ -120,6 +122,15 @@ public:
     /// failed.
     PgSqlLeaseContextPtr createContext() const;
 
+    /// @brief Create a new context connected to a database.
+    ///
+    /// @param parameters The parameters of the database, e.g. of a read
+    /// replica.
+    ///
+    /// @return A new (never null) context.
+    PgSqlLeaseContextPtr
+    createContext(const db::DatabaseConnection::ParameterMap& parameters) const;
+
     /// @brief Local version of getDBVersion() class method
     static std::string getDBVersion();
 
@@ -457,6 +468,65 @@ public:
     /// @return true if deletion was successful, false if no such lease exists.
     virtual bool deleteLease(const Lease6Ptr& lease);
 
+    /// @brief Writes a batch of reclaimed IPv4 leases.
+    ///
+    /// The leases are updated or deleted by groups of
+    /// @c RECLAIM_BATCH_SIZE with a single multi-row statement. The
+    /// statements are pipelined.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection reclaimLeases4(const Lease4Collection& updated,
+                                            const Lease4Collection& deleted);
+
+    /// @brief Writes a batch of reclaimed IPv6 leases.
+    ///
+    /// The leases are updated or deleted by groups of
+    /// @c RECLAIM_BATCH_SIZE with a single multi-row statement. The
+    /// statements are pipelined.
+    ///
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param deleted Leases to be deleted.
+    ///
+    /// @return The leases which were skipped.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection reclaimLeases6(const Lease6Collection& updated,
+                                            const Lease6Collection& deleted);
+
+    /// @brief Allocates or renews an IPv4 lease.
+    ///
+    /// Calls the lease4AllocateOrRenew stored function which looks up the
+    /// lease for the address and writes the new lease in a single round
+    /// trip to the database.
+    ///
+    /// @param lease The lease to be written.
+    /// @param [out] old_lease The lease found for the address before it
+    /// was written, or the conflicting lease when nothing was written.
+    /// Null when the lease has been added.
+    ///
+    /// @return true if the lease has been written, false if the address
+    /// is in use by another client.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual bool allocateOrRenewLease4(const Lease4Ptr& lease,
+                                       Lease4Ptr& old_lease);
+
+    /// @brief Checks if the allocation engine should use
+    /// @ref allocateOrRenewLease4.
+    ///
+    /// @return true if the "allocate-or-renew" parameter is set to true.
+    virtual bool isAllocateOrRenewEnabled() const {
+        return (allocate_or_renew_);
+    }
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -647,9 +717,20 @@ public:
         ALL_LEASE6_STATS,            // Fetches IPv6 lease statistics
         SUBNET_LEASE6_STATS,         // Fetched IPv6 lease stats for a single subnet.
         SUBNET_RANGE_LEASE6_STATS,   // Fetched IPv6 lease stats for a subnet range.
+        UPDATE_LEASE4_RECLAIMED,     // Set a batch of lease4 as reclaimed
+        UPDATE_LEASE6_RECLAIMED,     // Set a batch of lease6 as reclaimed
+        DELETE_LEASE4_RECLAIMED,     // Delete a batch of reclaimed lease4
+        DELETE_LEASE6_RECLAIMED,     // Delete a batch of reclaimed lease6
+        ALLOCATE_LEASE4,             // Allocate or renew a lease4
         NUM_STATEMENTS               // Number of statements
     };
 
+    /// @brief Number of leases written by a batched reclamation statement.
+    ///
+    /// A lease takes two parameters and the update statement takes one
+    /// more, within the limit of @c db::PGSQL_MAX_PARAMETERS_IN_QUERY.
+    static const size_t RECLAIM_BATCH_SIZE = 15;
+
 private:
 
     /// @brief Add Lease Common Code
@@ -847,6 +928,34 @@ private:
     uint64_t deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
                                                 StatementIndex statement_index);
 
+    /// @brief Write a batch of reclaimed leases common code
+    ///
+    /// Executes one of the batched reclamation statements for each group
+    /// of @c RECLAIM_BATCH_SIZE leases. The unused keys of the last group
+    /// repeat its first lease. The statements of all groups are sent in
+    /// a pipeline, see @ref db::PgSqlConnection::executePipeline. When a
+    /// statement writes fewer leases than the group holds, the leases of
+    /// the group are fetched again to find out which ones were renewed or
+    /// removed in the meantime.
+    ///
+    /// @param update_index One of the @c UPDATE_LEASE4_RECLAIMED or
+    ///        @c UPDATE_LEASE6_RECLAIMED.
+    /// @param updated Leases to be stored in the "expired-reclaimed" state.
+    /// @param delete_index One of the @c DELETE_LEASE4_RECLAIMED or
+    ///        @c DELETE_LEASE6_RECLAIMED.
+    /// @param deleted Leases to be deleted.
+    /// @param skipped [out] Collection to which the skipped leases are
+    ///        appended.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    template <typename LeaseCollection>
+    void reclaimLeasesCommon(StatementIndex update_index,
+                             const LeaseCollection& updated,
+                             StatementIndex delete_index,
+                             const LeaseCollection& deleted,
+                             LeaseCollection& skipped);
+
     /// @brief Context RAII Allocator.
     class PgSqlLeaseContextAlloc {
     public:
@@ -856,8 +965,13 @@ private:
         /// This constructor takes a context of the pool if one is available
         /// or creates a new one.
         ///
+        /// When a read replica is requested and available the context is
+        /// connected to a read replica.
+        ///
         /// @param mgr A parent instance
-        PgSqlLeaseContextAlloc(const PgSqlLeaseMgr& mgr);
+        /// @param replica true for read only queries which may be sent
+        /// to a read replica.
+        PgSqlLeaseContextAlloc(const PgSqlLeaseMgr& mgr, bool replica = false);
 
         /// @brief Destructor
         ///
@@ -871,6 +985,12 @@ private:
 
         /// @brief The manager
         const PgSqlLeaseMgr& mgr_;
+
+        /// @brief Indicates if the context is connected to a read replica.
+        bool replica_;
+
+        /// @brief Index of the read replica.
+        size_t replica_index_;
     };
 
 private:
@@ -880,8 +1000,21 @@ private:
     /// @brief The parameters
     db::DatabaseConnection::ParameterMap parameters_;
 
+    /// @brief Use the lease4AllocateOrRenew function in the allocation.
+    bool allocate_or_renew_;
+
     /// @brief The pool of contexts
     PgSqlLeaseContextPoolPtr pool_;
+
+    /// @brief The pools of contexts connected to the read replicas
+    ///
+    /// Null when no read replica is configured.
+    boost::shared_ptr<db::ReadReplicaPool<PgSqlLeaseContextPtr> > replicas_;
+
+    /// @brief The timer which reconnects the unavailable read replicas
+    ///
+    /// Null when no read replica is configured.
+    ReadReplicaTimerPtr replica_timer_;
 };
 
 }  // namespace dhcp
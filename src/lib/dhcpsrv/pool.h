@@ -125,8 +125,9 @@ public:
     ///
     /// @param class_name client class required to be evaluated
     void requireClientClass(const ClientClass& class_name) {
-        if (!required_classes_.contains(class_name)) {
-            required_classes_.insert(class_name);
+        ClientClassId id = ClientClassIndex::intern(class_name);
+        if (!required_classes_.contains(id)) {
+            required_classes_.insert(id, class_name);
         }
     }
 
@@ -219,6 +220,9 @@ protected:
     /// @ref Network::client_class_
     ClientClass client_class_;
 
+    /// @brief Interned identifier of @ref client_class_
+    ClientClassId client_class_id_;
+
     /// @brief Required classes
     ///
     /// @ref isc::dhcp::Network::required_classes_
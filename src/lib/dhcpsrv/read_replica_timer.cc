@@ -0,0 +1,58 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <database/read_replica_set.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/read_replica_timer.h>
+
+#include <atomic>
+#include <sstream>
+
+using namespace isc::asiolink;
+using namespace isc::db;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Number used to give a unique name to each timer.
+std::atomic<unsigned int> timer_count(0);
+
+} // end of anonymous namespace
+
+ReadReplicaTimer::ReadReplicaTimer(const IntervalTimer::Callback& callback)
+    : name_(), timer_mgr_(TimerMgr::instance()) {
+    std::ostringstream name;
+    name << "read-replicas-" << ++timer_count;
+    name_ = name.str();
+
+    // The interval is given in seconds whereas the timer manager expects
+    // milliseconds.
+    timer_mgr_->registerTimer(name_, callback,
+                              ReadReplicaSet::RECONNECT_INTERVAL * 1000,
+                              IntervalTimer::REPEATING);
+    timer_mgr_->setup(name_);
+}
+
+ReadReplicaTimer::~ReadReplicaTimer() {
+    try {
+        timer_mgr_->unregisterTimer(name_);
+
+    } catch (const std::exception& ex) {
+        // The timer may have been removed by another component during
+        // the shutdown.
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_READ_REPLICA_UNREGISTER_TIMER_FAILED)
+            .arg(name_)
+            .arg(ex.what());
+    }
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef READ_REPLICA_TIMER_H
+#define READ_REPLICA_TIMER_H
+
+#include <asiolink/interval_timer.h>
+#include <dhcpsrv/timer_mgr.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Reconnects the read replicas of a database backend periodically.
+///
+/// Registers a repeating timer with the @c TimerMgr which runs the
+/// reconnection of the unavailable read replicas every
+/// @c db::ReadReplicaSet::RECONNECT_INTERVAL seconds, so the queries are
+/// never delayed by an attempt to open a connection. The timer is
+/// unregistered when the object is destroyed.
+class ReadReplicaTimer : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Registers and starts the timer. Each instance gets a timer name of
+    /// its own as several backends can use read replicas at the same time.
+    ///
+    /// @param callback Reconnects the read replicas of the backend.
+    explicit ReadReplicaTimer(const asiolink::IntervalTimer::Callback& callback);
+
+    /// @brief Destructor.
+    ///
+    /// Unregisters the timer.
+    ~ReadReplicaTimer();
+
+    /// @brief Returns the name of the timer.
+    const std::string& getName() const {
+        return (name_);
+    }
+
+private:
+
+    /// @brief Name of the timer.
+    std::string name_;
+
+    /// @brief Pointer to the timer manager.
+    ///
+    /// We have to hold this pointer here to make sure that the timer
+    /// manager is not destroyed before the backend.
+    TimerMgrPtr timer_mgr_;
+};
+
+/// @brief Pointer to a @c ReadReplicaTimer.
+typedef boost::shared_ptr<ReadReplicaTimer> ReadReplicaTimerPtr;
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // READ_REPLICA_TIMER_H
@@ -252,7 +252,7 @@ SrvConfig::mergeGlobals(SrvConfig& other) {
 
 
 void
-SrvConfig::removeStatistics() {
+SrvConfig::removeStatistics() const {
 
     // Removes statistics for v4 and v6 subnets
     getCfgSubnets4()->removeStatistics();
@@ -275,6 +275,24 @@ SrvConfig::updateStatistics() {
     }
 }
 
+void
+SrvConfig::updateStatistics(const SrvConfig& previous) {
+    // The statistics of the previous configuration can be kept only if
+    // they were computed from the same lease database.
+    if ((&previous == this) ||
+        (previous.getCfgDbAccess()->getLeaseDbAccessString() !=
+         getCfgDbAccess()->getLeaseDbAccessString()) ||
+        !LeaseMgrFactory::haveInstance()) {
+        previous.removeStatistics();
+        updateStatistics();
+        return;
+    }
+
+    getCfgSubnets4()->updateStatistics(*previous.getCfgSubnets4());
+
+    getCfgSubnets6()->updateStatistics(*previous.getCfgSubnets6());
+}
+
 isc::data::ConstElementPtr
 SrvConfig::getConfiguredGlobal(std::string name) const {
     isc::data::ConstElementPtr global;
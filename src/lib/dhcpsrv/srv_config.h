@@ -646,12 +646,24 @@ public:
     /// @ref CfgSubnets6::updateStatistics for details.
     void updateStatistics();
 
+    /// @brief Updates statistics after a reconfiguration.
+    ///
+    /// This method is called instead of @ref removeStatistics on the
+    /// previous configuration followed by @ref updateStatistics on this
+    /// one. See @ref CfgSubnets4::updateStatistics(const CfgSubnets4&) and
+    /// @ref CfgSubnets6::updateStatistics(const CfgSubnets6&) for details.
+    /// All statistics are recounted when the lease database has changed or
+    /// when the previous configuration is this configuration.
+    ///
+    /// @param previous The previous configuration.
+    void updateStatistics(const SrvConfig& previous);
+
     /// @brief Removes statistics.
     ///
     /// This method calls appropriate methods in child objects that remove
     /// related statistics. See @ref CfgSubnets4::removeStatistics and
     /// @ref CfgSubnets6::removeStatistics for details.
-    void removeStatistics();
+    void removeStatistics() const;
 
     /// @brief Sets decline probation-period
     ///
@@ -74,6 +74,12 @@ Subnet::Subnet(const isc::asiolink::IOAddress& prefix, uint8_t len,
     last_allocated_time_[Lease::TYPE_NA] = boost::posix_time::neg_infin;
     last_allocated_time_[Lease::TYPE_TA] = boost::posix_time::neg_infin;
     last_allocated_time_[Lease::TYPE_PD] = boost::posix_time::neg_infin;
+
+    // Until the lease statistics are recounted nothing is known to be
+    // assigned.
+    for (auto& hint : assigned_leases_hint_) {
+        hint = 0;
+    }
 }
 
 bool
@@ -139,6 +145,33 @@ void Subnet::setLastAllocated(Lease::Type type,
     last_allocated_time_[type] = boost::posix_time::microsec_clock::universal_time();
 }
 
+int64_t
+Subnet::getAssignedLeasesHint(Lease::Type type) const {
+    checkType(type);
+    return (assigned_leases_hint_[type]);
+}
+
+void
+Subnet::setAssignedLeasesHint(Lease::Type type, int64_t count) const {
+    checkType(type);
+    assigned_leases_hint_[type] = count;
+}
+
+void
+Subnet::adjustAssignedLeasesHint(Lease::Type type, int64_t delta) const {
+    checkType(type);
+    assigned_leases_hint_[type] += delta;
+}
+
+bool
+Subnet::hasFreeLeasesHint(Lease::Type type) const {
+    int64_t assigned = getAssignedLeasesHint(type);
+    if (assigned <= 0) {
+        return (true);
+    }
+    return (getPoolCapacity(type) > static_cast<uint64_t>(assigned));
+}
+
 std::string
 Subnet::toText() const {
     std::stringstream tmp;
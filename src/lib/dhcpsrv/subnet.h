@@ -24,6 +24,7 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <utility>
@@ -103,6 +104,47 @@ public:
     void setLastAllocated(Lease::Type type,
                           const isc::asiolink::IOAddress& addr);
 
+    /// @brief Returns the number of leases of the specified type believed
+    /// to be assigned from this subnet.
+    ///
+    /// This counter is a utilization hint maintained by the allocation
+    /// engine and the servers whenever a lease is added to or removed from
+    /// this subnet. It is seeded from the lease database when the lease
+    /// statistics are recounted. It is not guaranteed to be accurate, e.g.
+    /// leases modified by the hooks libraries are not accounted for, so it
+    /// should only be used to order the subnets when looking for free
+    /// leases, never to reject an allocation.
+    ///
+    /// @param type lease type.
+    /// @return Number of assigned leases.
+    int64_t getAssignedLeasesHint(Lease::Type type) const;
+
+    /// @brief Sets the number of leases of the specified type believed to
+    /// be assigned from this subnet.
+    ///
+    /// @param type lease type.
+    /// @param count New number of assigned leases.
+    void setAssignedLeasesHint(Lease::Type type, int64_t count) const;
+
+    /// @brief Adjusts the number of leases of the specified type believed
+    /// to be assigned from this subnet.
+    ///
+    /// This method is const because the hint is not a part of the subnet
+    /// configuration and it is updated via pointers to the const subnets
+    /// returned by the subnet lookup functions.
+    ///
+    /// @param type lease type.
+    /// @param delta Value to be added to the number of assigned leases.
+    void adjustAssignedLeasesHint(Lease::Type type, int64_t delta) const;
+
+    /// @brief Checks if the utilization hint indicates that there are
+    /// free leases of the specified type in this subnet.
+    ///
+    /// @param type lease type.
+    /// @return true if the total capacity of the pools of the specified
+    /// type exceeds the number of assigned leases.
+    bool hasFreeLeasesHint(Lease::Type type) const;
+
     /// @brief Returns unique ID for that subnet
     /// @return unique ID for that subnet
     SubnetID getID() const { return (id_); }
@@ -432,6 +474,12 @@ protected:
     /// last allocated from this subnet.
     std::map<Lease::Type, boost::posix_time::ptime> last_allocated_time_;
 
+    /// @brief Number of assigned leases of each type (indexed by the lease
+    /// type) used as the utilization hint.
+    ///
+    /// See @ref getAssignedLeasesHint for details.
+    mutable std::atomic<int64_t> assigned_leases_hint_[Lease::TYPE_V4 + 1];
+
     /// @brief Name of the network interface (if connected directly)
     std::string iface_;
 
@@ -442,6 +490,9 @@ protected:
 /// @brief A generic pointer to either Subnet4 or Subnet6 object
 typedef boost::shared_ptr<Subnet> SubnetPtr;
 
+/// @brief A generic pointer to either const Subnet4 or const Subnet6 object
+typedef boost::shared_ptr<const Subnet> ConstSubnetPtr;
+
 
 class Subnet4;
 
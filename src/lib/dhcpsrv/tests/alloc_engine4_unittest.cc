@@ -782,6 +782,85 @@ TEST_F(AllocEngine4Test, bootpRenew4) {
     EXPECT_EQ(infinity_lft, lease2->valid_lft_);
 }
 
+// This test checks that a lease renewed before the cache threshold is
+// reused and not updated in the lease database.
+TEST_F(AllocEngine4Test, reuseRenew4) {
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+    subnet_->setValid(Triplet<uint32_t>(1000));
+    subnet_->setCacheThreshold(.25);
+
+    // The lease was renewed 100 seconds ago.
+    time_t cltt = time(NULL) - 100;
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.101"), hwaddr_, clientid_,
+                               1000, cltt, subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("192.0.2.101"),
+                                    false, false, "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+
+    Lease4Ptr renewed = engine.allocateLease4(ctx);
+    ASSERT_TRUE(renewed);
+    EXPECT_EQ("192.0.2.101", renewed->addr_.toText());
+
+    // The lease is returned with its remaining lifetime.
+    EXPECT_GE(900, renewed->valid_lft_);
+    EXPECT_EQ(cltt + 1000, renewed->cltt_ + renewed->valid_lft_);
+
+    // The lease was not updated.
+    Lease4Ptr from_mgr = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.101"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ(cltt, from_mgr->cltt_);
+    EXPECT_EQ(1000, from_mgr->valid_lft_);
+
+    // The lease is too old with a smaller threshold.
+    subnet_->setCacheThreshold(.05);
+    renewed = engine.allocateLease4(ctx);
+    ASSERT_TRUE(renewed);
+    EXPECT_EQ(1000, renewed->valid_lft_);
+    from_mgr = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.101"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ(renewed->cltt_, from_mgr->cltt_);
+}
+
+// This test checks that a lease is not reused when it is older than the
+// cache max age or when it is changed by the renewal.
+TEST_F(AllocEngine4Test, noReuseRenew4) {
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+    subnet_->setValid(Triplet<uint32_t>(1000));
+    subnet_->setCacheThreshold(.25);
+    subnet_->setCacheMaxAge(50);
+
+    time_t cltt = time(NULL) - 100;
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.101"), hwaddr_, clientid_,
+                               1000, cltt, subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("192.0.2.101"),
+                                    false, false, "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+
+    // The lease is older than the max age.
+    Lease4Ptr renewed = engine.allocateLease4(ctx);
+    ASSERT_TRUE(renewed);
+    EXPECT_EQ(1000, renewed->valid_lft_);
+    Lease4Ptr from_mgr = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.101"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_LT(cltt, from_mgr->cltt_);
+
+    // The hostname is changed.
+    subnet_->setCacheMaxAge(util::Optional<uint32_t>());
+    ctx.hostname_ = "myhost.example.com.";
+    renewed = engine.allocateLease4(ctx);
+    ASSERT_TRUE(renewed);
+    EXPECT_EQ(1000, renewed->valid_lft_);
+    from_mgr = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.101"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ("myhost.example.com.", from_mgr->hostname_);
+}
+
 // This test verifies that the allocator picks addresses that belong to the
 // pool
 TEST_F(AllocEngine4Test, IterativeAllocator) {
@@ -1334,6 +1413,48 @@ TEST_F(SharedNetworkAlloc4Test, runningOut) {
     EXPECT_FALSE(lease);
 }
 
+// This test verifies that the allocation engine skips the subnets which
+// utilization hint indicates that they are exhausted, and that it still
+// falls back to those subnets when no other subnet has free addresses.
+TEST_F(SharedNetworkAlloc4Test, discoverSharedNetworkAssignedLeasesHint) {
+    // The first subnet has a single address pool which is not in use, but
+    // the hint claims the opposite.
+    subnet1_->setAssignedLeasesHint(Lease::TYPE_V4, 1);
+
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress::IPV4_ZERO_ADDRESS(),
+            false, false, "host.example.com.", true);
+    ctx.query_.reset(new Pkt4(DHCPDISCOVER, 1234));
+    Lease4Ptr lease = engine_.allocateLease4(ctx);
+
+    // The address should be offered from the second subnet, even though
+    // the first subnet has been selected for the client.
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(subnet2_->inPool(Lease::TYPE_V4, lease->addr_));
+
+    // Mark the second subnet as exhausted too. The engine should fall
+    // back to the first subnet which actually has a free address.
+    subnet2_->setAssignedLeasesHint(Lease::TYPE_V4, 96);
+    ctx.subnet_ = subnet1_;
+    lease = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.17", lease->addr_.toText());
+}
+
+// This test verifies that the hint is updated when the lease is allocated.
+TEST_F(SharedNetworkAlloc4Test, requestSharedNetworkAssignedLeasesHint) {
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress::IPV4_ZERO_ADDRESS(),
+            false, false, "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.17", lease->addr_.toText());
+    EXPECT_EQ(1, subnet1_->getAssignedLeasesHint(Lease::TYPE_V4));
+    EXPECT_FALSE(subnet1_->hasFreeLeasesHint(Lease::TYPE_V4));
+    EXPECT_EQ(0, subnet2_->getAssignedLeasesHint(Lease::TYPE_V4));
+}
+
 // This test verifies that the server can offer an address from a
 // subnet and the introduction of shared network doesn't break anything here.
 TEST_F(SharedNetworkAlloc4Test, requestSharedNetworkSimple) {
@@ -1250,6 +1250,57 @@ TEST_F(AllocEngine6Test, renewExtendLeaseLifetime) {
         << "Lease lifetime was not extended, but it should";
 }
 
+// Checks that a lease renewed before the cache threshold is reused and
+// not updated in the lease database.
+TEST_F(AllocEngine6Test, reuseRenewLeaseLifetime) {
+    // Create a lease for the client.
+    Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress("2001:db8:1::15"),
+                               duid_, iaid_, 300, 400,
+                               subnet_->getID(), HWAddrPtr(), 128));
+
+    // Allocated 100 seconds ago - a quarter of the lifetime.
+    time_t lease_cltt = time(NULL) - 100;
+    lease->cltt_ = lease_cltt;
+
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    subnet_->setCacheThreshold(.5);
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 100);
+
+    Pkt6Ptr query(new Pkt6(DHCPV6_RENEW, 1234));
+    AllocEngine::ClientContext6 ctx(subnet_, duid_, false, false, "",
+                                    false, query);
+    ctx.currentIA().hints_.push_back(AllocEngine::Resource(IOAddress("2001:db8:1::15"),
+                                                           128));
+    ctx.currentIA().iaid_ = iaid_;
+    ctx.currentIA().type_ = Lease::TYPE_NA;
+    findReservation(engine, ctx);
+
+    Lease6Collection renewed = engine.renewLeases6(ctx);
+    ASSERT_EQ(1, renewed.size());
+
+    // The lease is returned with its remaining lifetimes.
+    EXPECT_GE(200, renewed[0]->preferred_lft_);
+    EXPECT_EQ(lease_cltt + 300, renewed[0]->cltt_ + renewed[0]->preferred_lft_);
+    EXPECT_EQ(lease_cltt + 400, renewed[0]->cltt_ + renewed[0]->valid_lft_);
+
+    // The lease was not updated.
+    Lease6Ptr from_mgr = LeaseMgrFactory::instance().getLease6(Lease::TYPE_NA,
+                                                               IOAddress("2001:db8:1::15"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ(lease_cltt, from_mgr->cltt_);
+
+    // The lease is too old with a smaller threshold.
+    subnet_->setCacheThreshold(.1);
+    renewed = engine.renewLeases6(ctx);
+    ASSERT_EQ(1, renewed.size());
+    EXPECT_EQ(400, renewed[0]->valid_lft_);
+    from_mgr = LeaseMgrFactory::instance().getLease6(Lease::TYPE_NA,
+                                                     IOAddress("2001:db8:1::15"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_GT(from_mgr->cltt_, lease_cltt);
+}
+
 // Checks that a renewed lease uses default lifetimes.
 TEST_F(AllocEngine6Test, defaultRenewLeaseLifetime) {
     // Create a lease for the client.
@@ -3132,6 +3183,53 @@ TEST_F(SharedNetworkAlloc6Test, requestRunningOut) {
     EXPECT_TRUE(leases.empty());
 }
 
+// This test verifies that the allocation engine skips the subnets which
+// utilization hint indicates that they are exhausted, and that it still
+// falls back to those subnets when no other subnet has free addresses.
+TEST_F(SharedNetworkAlloc6Test, solicitSharedNetworkAssignedLeasesHint) {
+    // The first subnet has a single address pool which is not in use, but
+    // the hint claims the opposite.
+    subnet1_->setAssignedLeasesHint(Lease::TYPE_NA, 1);
+
+    Pkt6Ptr query(new Pkt6(DHCPV6_SOLICIT, 1234));
+    AllocEngine::ClientContext6 ctx1(subnet1_, duid_, false, false, "", true,
+                                     query);
+    ctx1.currentIA().iaid_ = iaid_;
+
+    // The address should be offered from the second subnet, even though
+    // the first subnet has been selected for the client.
+    Lease6Ptr lease;
+    ASSERT_NO_THROW(lease = expectOneLease(engine_.allocateLeases6(ctx1)));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(subnet2_->inPool(Lease::TYPE_NA, lease->addr_));
+
+    // Mark the second subnet as exhausted too. The engine should fall
+    // back to the first subnet which actually has a free address.
+    subnet2_->setAssignedLeasesHint(Lease::TYPE_NA, 256);
+    AllocEngine::ClientContext6 ctx2(subnet1_, duid_, false, false, "", true,
+                                     query);
+    ctx2.currentIA().iaid_ = iaid_;
+    ASSERT_NO_THROW(lease = expectOneLease(engine_.allocateLeases6(ctx2)));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("2001:db8:1::1", lease->addr_.toText());
+}
+
+// This test verifies that the hint is updated when the lease is allocated.
+TEST_F(SharedNetworkAlloc6Test, requestSharedNetworkAssignedLeasesHint) {
+    Pkt6Ptr query(new Pkt6(DHCPV6_REQUEST, 1234));
+    AllocEngine::ClientContext6 ctx(subnet1_, duid_, false, false, "", false,
+                                    query);
+    ctx.currentIA().iaid_ = iaid_;
+
+    Lease6Ptr lease;
+    ASSERT_NO_THROW(lease = expectOneLease(engine_.allocateLeases6(ctx)));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("2001:db8:1::1", lease->addr_.toText());
+    EXPECT_EQ(1, subnet1_->getAssignedLeasesHint(Lease::TYPE_NA));
+    EXPECT_FALSE(subnet1_->hasFreeLeasesHint(Lease::TYPE_NA));
+    EXPECT_EQ(0, subnet2_->getAssignedLeasesHint(Lease::TYPE_NA));
+}
+
 // Verifies that client with a hostname reservation can
 // 1. Get a dynamic lease
 // 2. Renew the same lease via REQUEST (calls allocateLease6)
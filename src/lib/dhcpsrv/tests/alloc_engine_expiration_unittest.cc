@@ -1,10 +1,11 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <asiolink/asio_wrapper.h>
 #include <dhcp/duid.h>
 #include <dhcp/option_data_types.h>
 #include <dhcp_ddns/ncr_msg.h>
@@ -12,6 +13,7 @@
 #include <dhcpsrv/tests/test_utils.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
 #include <gtest/gtest.h>
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
@@ -30,6 +32,7 @@ using namespace isc::dhcp::test;
 using namespace isc::dhcp_ddns;
 using namespace isc::hooks;
 using namespace isc::stats;
+using namespace isc::util;
 
 namespace {
 
@@ -168,7 +171,8 @@ public:
     ///
     /// Clears configuration, creates new lease manager and allocation engine
     /// instances.
-    ExpirationAllocEngineTest(const std::string& lease_mgr_params) {
+    ExpirationAllocEngineTest(const std::string& lease_mgr_params)
+        : background_(false) {
         // Clear configuration.
         CfgMgr::instance().clear();
         D2ClientConfigPtr cfg(new D2ClientConfig());
@@ -212,6 +216,11 @@ public:
         // Remove all statistics.
         StatsMgr::instance().resetAll();
 
+        // Stop the background reclamation before the lease manager is
+        // destroyed.
+        engine_->stopBackgroundReclamation();
+        MultiThreadingMgr::instance().setMode(false);
+
         // Kill lease manager.
         LeaseMgrFactory::destroy();
 
@@ -229,6 +238,30 @@ public:
         mgr.startSender(boost::bind(&ExpirationAllocEngineTest::d2ErrorHandler, _1, _2));
     }
 
+    /// @brief Enables the background reclamation.
+    ///
+    /// The lease manager is used by the reclamation thread so the
+    /// multi-threading mode is enabled.
+    void enableBackground() {
+        background_ = true;
+        MultiThreadingMgr::instance().setMode(true);
+    }
+
+    /// @brief Runs the IO service until a background pass is complete.
+    ///
+    /// @param io_service IO service passed to the background pass.
+    /// @param done Flag set by the completion callback of the pass.
+    static void runBackground(const IOServicePtr& io_service, const bool& done) {
+        // Give up after 10 seconds.
+        for (unsigned int i = 0; !done && (i < 10000); ++i) {
+            io_service->poll();
+            if (!done) {
+                usleep(1000);
+            }
+        }
+        EXPECT_TRUE(done) << "background reclamation pass not complete";
+    }
+
     /// @brief No-op error handler for the D2 client.
     static void d2ErrorHandler(const dhcp_ddns::NameChangeSender::Result,
                                dhcp_ddns::NameChangeRequestPtr&) {
@@ -531,6 +564,30 @@ public:
         return (0);
     }
 
+    /// @brief Implements "lease{4,6}_expire callout which sets the user
+    /// context of the lease.
+    ///
+    /// @param callout_handle Callout handle.
+    /// @return Zero.
+    static int leaseExpireWithContextCallout(CalloutHandle& callout_handle) {
+        leaseExpireCallout(callout_handle);
+        LeasePtrType lease;
+        callout_handle.getArgument(callout_argument_name, lease);
+        lease->setContext(data::Element::fromJSON("{ \"expired\": true }"));
+
+        return (0);
+    }
+
+    /// @brief Lease algorithm checking if the user context of the lease
+    /// was set by the @c leaseExpireWithContextCallout.
+    ///
+    /// @param lease Pointer to lease.
+    /// @return true if the user context was set.
+    static bool leaseContextSet(const LeasePtrType& lease) {
+        return (lease && lease->getContext() &&
+                lease->getContext()->contains("expired"));
+    }
+
     /// @brief Implements "lease{4,6}_expire callout, which lasts at least
     /// 40ms.
     ///
@@ -897,6 +954,33 @@ public:
         EXPECT_TRUE(testLeases(&leaseNotReclaimed, &allLeaseIndexes));
     }
 
+    /// @brief This test verifies that the changes made to the leases by the
+    /// callouts are written with the reclaimed state.
+    void testReclaimExpiredLeasesHooksWithChange() {
+        for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+            if (evenLeaseIndex(i)) {
+                expire(i, 1000 - i);
+            }
+        }
+
+        HookLibsCollection libraries; // no libraries at this time
+        HooksManager::loadLibraries(libraries);
+
+        // Install a callout: lease4_expire or lease6_expire.
+        std::ostringstream callout_name;
+        callout_name << callout_argument_name << "_expire";
+        EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        callout_name.str(), leaseExpireWithContextCallout));
+
+        ASSERT_NO_THROW(reclaimExpiredLeases(0, 0, false));
+
+        // The leases with even indexes are reclaimed and hold the user
+        // context set by the callout.
+        EXPECT_TRUE(testLeases(&leaseReclaimed, &evenLeaseIndex));
+        EXPECT_TRUE(testLeases(&leaseContextSet, &evenLeaseIndex));
+        EXPECT_TRUE(testLeases(&leaseNotReclaimed, &oddLeaseIndex));
+    }
+
     /// @brief This test verifies that it is possible to set the timeout for
     /// the execution of the lease reclamation routine.
     void testReclaimExpiredLeasesTimeout(const uint16_t timeout) {
@@ -1094,6 +1178,9 @@ public:
 
     /// @brief Allocation engine instance used for tests.
     AllocEnginePtr engine_;
+
+    /// @brief Reclaim the leases in the background.
+    bool background_;
 };
 
 
@@ -1172,6 +1259,18 @@ public:
     virtual void reclaimExpiredLeases(const size_t max_leases,
                                       const uint16_t timeout,
                                       const bool remove_lease) {
+        if (background_) {
+            IOServicePtr io_service(new IOService());
+            bool done = false;
+            engine_->reclaimExpiredLeases6InBackground(max_leases, timeout,
+                                                       remove_lease, 0,
+                                                       io_service,
+                                                       [&done]() {
+                done = true;
+            });
+            runBackground(io_service, done);
+            return;
+        }
         engine_->reclaimExpiredLeases6(max_leases, timeout, remove_lease);
     }
 
@@ -1540,6 +1639,49 @@ TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the leases can be reclaimed in the background
+// without being removed from the database.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesUpdateStateBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesUpdateState();
+}
+
+// This test verifies that the leases reclaimed in the background are
+// deleted when requested.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesDeleteBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesDelete();
+}
+
+// This test verifies that the limit for the number of reclaimed leases
+// applies to the background reclamation.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesLimitBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesLimit();
+}
+
+// This test verifies that statistics is correctly updated when the leases
+// are reclaimed in the background.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesStatsBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesStats();
+}
+
+// This test verifies that callouts are executed for each lease expired
+// reclaimed in the background and that the lease is not reclaimed when
+// the skip flag is set.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithSkipBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesHooksWithSkip();
+}
+
+// This test verifies that the leases changed by the callouts are written
+// with the changes when they are reclaimed in the background.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithChangeBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesHooksWithChange();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesTimeout) {
@@ -1715,6 +1857,18 @@ public:
     virtual void reclaimExpiredLeases(const size_t max_leases,
                                       const uint16_t timeout,
                                       const bool remove_lease) {
+        if (background_) {
+            IOServicePtr io_service(new IOService());
+            bool done = false;
+            engine_->reclaimExpiredLeases4InBackground(max_leases, timeout,
+                                                       remove_lease, 0,
+                                                       io_service,
+                                                       [&done]() {
+                done = true;
+            });
+            runBackground(io_service, done);
+            return;
+        }
         engine_->reclaimExpiredLeases4(max_leases, timeout, remove_lease);
     }
 
@@ -2205,6 +2359,121 @@ TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the leases can be reclaimed in the background
+// without being removed from the database.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesUpdateStateBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesUpdateState();
+}
+
+// This test verifies that the leases reclaimed in the background are
+// deleted when requested.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesDeleteBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesDelete();
+}
+
+// This test verifies that the limit for the number of reclaimed leases
+// applies to the background reclamation.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesLimitBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesLimit();
+}
+
+// This test verifies that statistics is correctly updated when the leases
+// are reclaimed in the background.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesStatsBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesStats();
+}
+
+// This test verifies that callouts are executed for each lease expired
+// reclaimed in the background and that the lease is not reclaimed when
+// the skip flag is set.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithSkipBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesHooksWithSkip();
+}
+
+// This test verifies that the leases changed by the callouts are written
+// with the changes when they are reclaimed in the background.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithChangeBackground) {
+    enableBackground();
+    testReclaimExpiredLeasesHooksWithChange();
+}
+
+// This test verifies that the batch handed over to the reclamation thread
+// when a background pass is stopped is written and accounted.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesStopInFlightBackground) {
+    BOOST_STATIC_ASSERT(TEST_LEASES_NUM > AllocEngine::RECLAIM_BATCH_SIZE);
+    enableBackground();
+    for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+        expire(i, 10 + i);
+    }
+
+    IOServicePtr io_service(new IOService());
+    bool done = false;
+    engine_->reclaimExpiredLeases4InBackground(0, 0, false, 0, io_service,
+                                               [&done]() {
+        done = true;
+    });
+
+    // The first handler reclaims the first batch and hands it over to the
+    // reclamation thread. Give up after 10 seconds.
+    size_t handled = 0;
+    for (unsigned int i = 0; (handled == 0) && (i < 10000); ++i) {
+        handled = io_service->get_io_service().poll_one();
+        if (handled == 0) {
+            usleep(1000);
+        }
+    }
+    ASSERT_EQ(1, handled);
+    ASSERT_NO_THROW(engine_->stopBackgroundReclamation());
+    EXPECT_FALSE(done);
+
+    // The leases of the batch are reclaimed and counted.
+    size_t reclaimed = 0;
+    for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+        if (leaseReclaimed(getLease(i))) {
+            ++reclaimed;
+        }
+    }
+    EXPECT_EQ(AllocEngine::RECLAIM_BATCH_SIZE, reclaimed);
+    ObservationPtr stat = StatsMgr::instance().getObservation("reclaimed-leases");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(AllocEngine::RECLAIM_BATCH_SIZE, stat->getInteger().first);
+}
+
+// This test verifies that a background pass stopped before it is complete
+// does nothing more: the leases are not reclaimed and the completion
+// callback is not called.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesStopBackground) {
+    enableBackground();
+    for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+        expire(i, 10 + i);
+    }
+
+    IOServicePtr io_service(new IOService());
+    bool done = false;
+    engine_->reclaimExpiredLeases4InBackground(0, 0, false, 0, io_service,
+                                               [&done]() {
+        done = true;
+    });
+    ASSERT_NO_THROW(engine_->stopBackgroundReclamation());
+
+    // The handlers posted by the stopped pass do nothing.
+    for (unsigned int i = 0; i < 10; ++i) {
+        io_service->poll();
+    }
+    EXPECT_FALSE(done);
+    EXPECT_TRUE(testLeases(&leaseNotReclaimed, &allLeaseIndexes));
+
+    // A new pass can be started.
+    background_ = true;
+    ASSERT_NO_THROW(reclaimExpiredLeases(0, 0, false));
+    EXPECT_TRUE(testLeases(&leaseReclaimed, &allLeaseIndexes));
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesTimeout) {
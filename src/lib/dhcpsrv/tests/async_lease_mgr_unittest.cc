@@ -0,0 +1,261 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_service.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/async_lease_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <exceptions/exceptions.h>
+#include <util/multi_threading_mgr.h>
+#include <util/watch_socket.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <sys/select.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for @c AsyncLeaseMgr.
+class AsyncLeaseMgrTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the memfile lease manager and enables the multi-threading
+    /// mode.
+    AsyncLeaseMgrTest()
+        : io_service_(new IOService()), mgr_() {
+        LeaseMgrFactory::destroy();
+        LeaseMgrFactory::create("type=memfile universe=4 persist=false");
+        MultiThreadingMgr::instance().setMode(true);
+    }
+
+    /// @brief Destructor.
+    virtual ~AsyncLeaseMgrTest() {
+        mgr_.stop();
+        MultiThreadingMgr::instance().setMode(false);
+        LeaseMgrFactory::destroy();
+    }
+
+    /// @brief Runs the IO service until the condition is met.
+    ///
+    /// @param done Condition set by a completion handler.
+    void run(const bool& done) {
+        // Give up after 10 seconds.
+        for (unsigned int i = 0; !done && (i < 10000); ++i) {
+            io_service_->poll();
+            if (!done) {
+                usleep(1000);
+            }
+        }
+        EXPECT_TRUE(done) << "asynchronous lease operation not complete";
+    }
+
+    /// @brief Creates a DHCPv4 lease.
+    ///
+    /// @param addr Address of the lease.
+    Lease4Ptr createLease4(const std::string& addr) const {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 0x08),
+                                    HTYPE_ETHER));
+        return (Lease4Ptr(new Lease4(IOAddress(addr), hwaddr, ClientIdPtr(),
+                                     3600, time(NULL), 1)));
+    }
+
+    /// @brief IO service running the completion handlers.
+    IOServicePtr io_service_;
+
+    /// @brief Tested object.
+    AsyncLeaseMgr mgr_;
+};
+
+// Verifies that the manager must be started with valid parameters
+// and cannot be used when it is not running.
+TEST_F(AsyncLeaseMgrTest, startStop) {
+    EXPECT_FALSE(mgr_.isRunning());
+    EXPECT_THROW(mgr_.submit([]() {}, AsyncLeaseMgr::Completion()),
+                 InvalidOperation);
+    EXPECT_THROW(mgr_.start(0, io_service_), BadValue);
+    EXPECT_THROW(mgr_.start(2, IOServicePtr()), BadValue);
+
+    ASSERT_NO_THROW(mgr_.start(2, io_service_));
+    EXPECT_TRUE(mgr_.isRunning());
+    EXPECT_EQ(2, mgr_.getThreadCount());
+    EXPECT_THROW(mgr_.start(2, io_service_), InvalidOperation);
+
+    mgr_.stop();
+    EXPECT_FALSE(mgr_.isRunning());
+    EXPECT_EQ(0, mgr_.getThreadCount());
+
+    // It can be restarted.
+    ASSERT_NO_THROW(mgr_.start(1, io_service_));
+    EXPECT_TRUE(mgr_.isRunning());
+}
+
+// Verifies that the work runs on a worker thread and its completion
+// on the thread running the IO service.
+TEST_F(AsyncLeaseMgrTest, submit) {
+    ASSERT_NO_THROW(mgr_.start(2, io_service_));
+
+    std::thread::id worker_id;
+    std::thread::id completion_id;
+    bool done = false;
+    mgr_.submit([&worker_id]() {
+        worker_id = std::this_thread::get_id();
+    },
+    [&completion_id, &done](const std::exception_ptr& error) {
+        EXPECT_FALSE(error);
+        completion_id = std::this_thread::get_id();
+        done = true;
+    });
+    EXPECT_EQ(1, mgr_.getPendingCount());
+    run(done);
+
+    EXPECT_NE(std::this_thread::get_id(), worker_id);
+    EXPECT_EQ(std::this_thread::get_id(), completion_id);
+    EXPECT_EQ(0, mgr_.getPendingCount());
+}
+
+// Verifies that an exception thrown by the work is passed to the
+// completion handler.
+TEST_F(AsyncLeaseMgrTest, submitError) {
+    ASSERT_NO_THROW(mgr_.start(1, io_service_));
+
+    bool done = false;
+    mgr_.submit([]() {
+        isc_throw(Unexpected, "database failure");
+    },
+    [&done](const std::exception_ptr& error) {
+        ASSERT_TRUE(error);
+        EXPECT_THROW(std::rethrow_exception(error), Unexpected);
+        done = true;
+    });
+    run(done);
+}
+
+// Verifies that the completion handlers are not invoked after a stop.
+TEST_F(AsyncLeaseMgrTest, stopDropsCompletions) {
+    ASSERT_NO_THROW(mgr_.start(1, io_service_));
+
+    std::atomic<bool> worked(false);
+    bool completed = false;
+    mgr_.submit([&worked]() {
+        worked = true;
+    },
+    [&completed](const std::exception_ptr&) {
+        completed = true;
+    });
+
+    // Wait for the work to be done so its completion is posted.
+    for (unsigned int i = 0; !worked && (i < 10000); ++i) {
+        usleep(1000);
+    }
+    ASSERT_TRUE(worked);
+
+    mgr_.stop();
+    EXPECT_EQ(0, mgr_.getPendingCount());
+    io_service_->poll();
+    EXPECT_FALSE(completed);
+}
+
+// Verifies that the lease operations can be submitted concurrently.
+TEST_F(AsyncLeaseMgrTest, leases) {
+    ASSERT_NO_THROW(mgr_.start(4, io_service_));
+
+    // Add several leases at once.
+    const unsigned int count = 16;
+    std::atomic<unsigned int> added(0);
+    unsigned int completed = 0;
+    for (unsigned int i = 0; i < count; ++i) {
+        std::ostringstream addr;
+        addr << "192.0.2." << (i + 1);
+        Lease4Ptr lease = createLease4(addr.str());
+        mgr_.submit([lease, &added]() {
+            if (LeaseMgrFactory::instance().addLease(lease)) {
+                ++added;
+            }
+        },
+        [&completed](const std::exception_ptr& error) {
+            EXPECT_FALSE(error);
+            ++completed;
+        });
+    }
+    for (unsigned int i = 0; (completed < count) && (i < 10000); ++i) {
+        io_service_->poll();
+        usleep(1000);
+    }
+    ASSERT_EQ(count, completed);
+    EXPECT_EQ(count, added.load());
+
+    // Updating a missing lease reports an error.
+    Lease4Ptr lease = createLease4("192.0.2.100");
+    bool done = false;
+    mgr_.submit([lease]() {
+        LeaseMgrFactory::instance().updateLease4(lease);
+    },
+    [&done](const std::exception_ptr& error) {
+        EXPECT_TRUE(error);
+        done = true;
+    });
+    run(done);
+}
+
+/// @brief Checks if a file descriptor is ready to read.
+///
+/// @param fd The file descriptor.
+/// @param usecs Time to wait in microseconds.
+bool isReadable(int fd, long usecs) {
+    fd_set sockets;
+    FD_ZERO(&sockets);
+    FD_SET(fd, &sockets);
+    struct timeval timeout = { 0, usecs };
+    return (select(fd + 1, &sockets, 0, 0, &timeout) > 0);
+}
+
+// Verifies that the watch socket is ready when a completion handler is
+// posted and that it wakes up the interface manager.
+TEST_F(AsyncLeaseMgrTest, watchSocket) {
+    EXPECT_EQ(WatchSocket::SOCKET_NOT_VALID, mgr_.getSelectFd());
+    ASSERT_NO_THROW(mgr_.start(1, io_service_));
+    int fd = mgr_.getSelectFd();
+    ASSERT_NE(WatchSocket::SOCKET_NOT_VALID, fd);
+    EXPECT_FALSE(isReadable(fd, 0));
+
+    // The socket is ready once the work is done.
+    mgr_.submit([]() {}, AsyncLeaseMgr::Completion());
+    bool ready = false;
+    for (unsigned int i = 0; !ready && (i < 10000); ++i) {
+        ready = isReadable(fd, 1000);
+    }
+    ASSERT_TRUE(ready);
+
+    // The interface manager returns without waiting for the timeout and
+    // its callback clears the socket.
+    Pkt4Ptr query;
+    ASSERT_NO_THROW(query = IfaceMgr::instance().receive4(10));
+    EXPECT_FALSE(query);
+    EXPECT_FALSE(isReadable(fd, 0));
+
+    // The completion handler is pending in the IO service.
+    EXPECT_EQ(1, mgr_.getPendingCount());
+    io_service_->poll();
+    EXPECT_EQ(0, mgr_.getPendingCount());
+
+    mgr_.stop();
+    EXPECT_EQ(WatchSocket::SOCKET_NOT_VALID, mgr_.getSelectFd());
+}
+
+} // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -112,6 +112,7 @@ TEST(CfgExpirationTest, defaults) {
               cfg.getMaxReclaimTime());
     EXPECT_EQ(CfgExpiration::DEFAULT_UNWARNED_RECLAIM_CYCLES,
               cfg.getUnwarnedReclaimCycles());
+    EXPECT_FALSE(cfg.getBackgroundReclamation());
 }
 
 /// @brief Tests that unparse returns an expected value
@@ -127,6 +128,21 @@ TEST(CfgExpirationTest, unparse) {
     isc::test::runToElementTest<CfgExpiration>(defaults, cfg);
 }
 
+/// @brief Tests that background-reclamation is unparsed when enabled.
+TEST(CfgExpirationTest, unparseBackgroundReclamation) {
+    CfgExpiration cfg;
+    cfg.setBackgroundReclamation(true);
+    std::string expected = "{\n"
+        "\"reclaim-timer-wait-time\": 10,\n"
+        "\"flush-reclaimed-timer-wait-time\": 25,\n"
+        "\"hold-reclaimed-time\": 3600,\n"
+        "\"max-reclaim-leases\": 100,\n"
+        "\"max-reclaim-time\": 250,\n"
+        "\"unwarned-reclaim-cycles\": 5,\n"
+        "\"background-reclamation\": true }";
+    isc::test::runToElementTest<CfgExpiration>(expected, cfg);
+}
+
 // Test the {get,set}ReclaimTimerWaitTime.
 TEST(CfgExpirationTest, getReclaimTimerWaitTime) {
     testAccessModify<uint16_t>(CfgExpiration::LIMIT_RECLAIM_TIMER_WAIT_TIME,
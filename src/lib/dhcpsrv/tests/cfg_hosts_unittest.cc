@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -860,6 +860,81 @@ TEST_F(CfgHostsTest, add4AlreadyReserved) {
     EXPECT_THROW(cfg.add(host2), isc::dhcp::ReservedAddress);
 }
 
+// Checks that a collection of hosts can be added at once and that
+// hosts sharing an identifier are returned in the order they were added.
+TEST_F(CfgHostsTest, addCollection) {
+    CfgHosts cfg;
+    HostCollection hosts;
+    for (unsigned i = 0; i < 25; ++i) {
+        hosts.push_back(HostPtr(new Host(hwaddrs_[i]->toText(false),
+                                         "hw-address",
+                                         SubnetID(2), SUBNET_ID_UNUSED,
+                                         addressesb_[i])));
+        hosts.push_back(HostPtr(new Host(hwaddrs_[i]->toText(false),
+                                         "hw-address",
+                                         SubnetID(1), SUBNET_ID_UNUSED,
+                                         addressesa_[i])));
+    }
+    ASSERT_NO_THROW(cfg.add(hosts));
+
+    for (unsigned i = 0; i < 25; ++i) {
+        HostCollection returned = cfg.getAll(Host::IDENT_HWADDR,
+                                             &hwaddrs_[i]->hwaddr_[0],
+                                             hwaddrs_[i]->hwaddr_.size());
+        ASSERT_EQ(2, returned.size());
+        EXPECT_EQ(2, returned[0]->getIPv4SubnetID());
+        EXPECT_EQ(addressesb_[i], returned[0]->getIPv4Reservation().toText());
+        EXPECT_EQ(1, returned[1]->getIPv4SubnetID());
+        EXPECT_EQ(addressesa_[i], returned[1]->getIPv4Reservation().toText());
+    }
+
+    // Duplicates are still detected.
+    HostCollection duplicates;
+    duplicates.push_back(HostPtr(new Host(hwaddrs_[0]->toText(false),
+                                          "hw-address",
+                                          SubnetID(1), SUBNET_ID_UNUSED,
+                                          IOAddress("192.0.2.250"))));
+    EXPECT_THROW(cfg.add(duplicates), isc::dhcp::DuplicateHost);
+}
+
+// Checks that adding hosts without options doesn't create their option
+// data configurations: they still share the empty configuration.
+TEST_F(CfgHostsTest, addWithoutOptions) {
+    CfgHosts cfg;
+    HostPtr host1 = HostPtr(new Host(hwaddrs_[0]->toText(false),
+                                     "hw-address",
+                                     SubnetID(1), SubnetID(2),
+                                     IOAddress("192.0.2.10")));
+    HostPtr host2 = HostPtr(new Host(duids_[0]->toText(), "duid",
+                                     SubnetID(1), SubnetID(2),
+                                     IOAddress("192.0.2.11")));
+    host2->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                    IOAddress("2001:db8:1::10")));
+    ASSERT_NO_THROW(cfg.add(host1));
+    ASSERT_NO_THROW(cfg.add(host2));
+
+    ConstHostPtr const_host1 = host1;
+    ConstHostPtr const_host2 = host2;
+    ConstCfgOptionPtr empty = const_host1->getCfgOption4();
+    ASSERT_TRUE(empty);
+    EXPECT_TRUE(empty->empty());
+    EXPECT_FALSE(host1->hasOptions4());
+    EXPECT_FALSE(host1->hasOptions6());
+    EXPECT_FALSE(host2->hasOptions4());
+    EXPECT_FALSE(host2->hasOptions6());
+    EXPECT_EQ(empty, const_host1->getCfgOption6());
+    EXPECT_EQ(empty, const_host2->getCfgOption4());
+    EXPECT_EQ(empty, const_host2->getCfgOption6());
+
+    // The same for the hosts returned by the configuration.
+    ConstHostPtr returned = cfg.get4(SubnetID(1), Host::IDENT_DUID,
+                                     &duids_[0]->getDuid()[0],
+                                     duids_[0]->getDuid().size());
+    ASSERT_TRUE(returned);
+    EXPECT_EQ(empty, returned->getCfgOption4());
+    EXPECT_EQ(empty, returned->getCfgOption6());
+}
+
 // Checks that it's not possible for two hosts to have the same address
 // reserved at the same time.
 TEST_F(CfgHostsTest, add6Invalid2Hosts) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -304,6 +304,28 @@ public:
         }
     }
 
+    /// @brief Checks that the global declined addresses statistic is the
+    /// sum of the per subnet values.
+    ///
+    /// @param subnet_ids Identifiers of the configured subnets.
+    /// @param expected Expected global value.
+    void checkDeclinedStats(const std::vector<SubnetID>& subnet_ids,
+                            int64_t expected) {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        int64_t sum = 0;
+        for (auto subnet_id : subnet_ids) {
+            ObservationPtr declined = stats_mgr.getObservation(
+                StatsMgr::generateName("subnet", subnet_id,
+                                       "declined-addresses"));
+            ASSERT_TRUE(declined) << "subnet " << subnet_id;
+            sum += declined->getInteger().first;
+        }
+        ObservationPtr global = stats_mgr.getObservation("declined-addresses");
+        ASSERT_TRUE(global);
+        EXPECT_EQ(expected, global->getInteger().first);
+        EXPECT_EQ(sum, global->getInteger().first);
+    }
+
     /// used in client classification (or just empty container for other tests)
     isc::dhcp::ClientClasses classify_;
 
@@ -619,6 +641,174 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ(128, total_addrs->getInteger().first);
 }
 
+// This test verifies that the lease statistics of the subnets which are
+// not modified by a new configuration are not recounted.
+TEST_F(CfgMgrTest, commitStatsIncremental4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    // Let's prepare the "old" configuration: subnets with id 123 and 124
+    // and pretend there were addresses assigned. The lease database is
+    // empty so the values are reset to 0 when the leases are recounted.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet1);
+    subnets->add(subnet2);
+    cfg_mgr.commit();
+    stats_mgr.setValue("subnet[123].assigned-addresses", static_cast<int64_t>(150));
+    stats_mgr.setValue("subnet[124].assigned-addresses", static_cast<int64_t>(20));
+    subnet1->setAssignedLeasesHint(Lease::TYPE_V4, 150);
+
+    // The new configuration has the same subnet 123, a modified subnet 124
+    // and a new subnet 125.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnets->add(subnet);
+    subnet.reset(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 25)));
+    subnets->add(subnet);
+    subnet.reset(new Subnet4(IOAddress("192.1.4.0"), 24, 1, 2, 3, 125));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    // The unchanged subnet keeps its statistics and its utilization hint.
+    ObservationPtr assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(150, assigned->getInteger().first);
+    ConstSubnet4Ptr current = cfg_mgr.getCurrentCfg()->getCfgSubnets4()->getBySubnetId(123);
+    ASSERT_TRUE(current);
+    EXPECT_EQ(150, current->getAssignedLeasesHint(Lease::TYPE_V4));
+
+    // The modified subnet was recounted.
+    assigned = stats_mgr.getObservation("subnet[124].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+    ObservationPtr total = stats_mgr.getObservation("subnet[124].total-addresses");
+    ASSERT_TRUE(total);
+    EXPECT_EQ(128, total->getInteger().first);
+
+    // The new subnet was counted.
+    assigned = stats_mgr.getObservation("subnet[125].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+
+    // Removing a subnet removes its statistics only.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnet.reset(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[124].assigned-addresses"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[125].total-addresses"));
+    assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(150, assigned->getInteger().first);
+}
+
+// This test verifies that the global declined addresses statistic stays
+// the sum of the per subnet values when subnets are added and removed.
+TEST_F(CfgMgrTest, commitStatsDeclined4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    startBackend(AF_INET);
+
+    auto add_declined = [](const std::string& address, SubnetID subnet_id) {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(address), hwaddr, ClientIdPtr(),
+                                   3600, time(0), subnet_id));
+        lease->state_ = Lease::STATE_DECLINED;
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    };
+
+    // Subnet 123 has 2 declined addresses, subnet 124 has 3.
+    add_declined("192.1.2.10", 123);
+    add_declined("192.1.2.11", 123);
+    add_declined("192.1.3.10", 124);
+    add_declined("192.1.3.11", 124);
+    add_declined("192.1.3.12", 124);
+
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123)));
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124)));
+    cfg_mgr.commit();
+    checkDeclinedStats({ 123, 124 }, 5);
+
+    // Add subnet 125 with 1 declined address.
+    add_declined("192.1.4.10", 125);
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123)));
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124)));
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.4.0"), 24, 1, 2, 3, 125)));
+    cfg_mgr.commit();
+    checkDeclinedStats({ 123, 124, 125 }, 6);
+
+    // Remove subnet 124 and modify subnet 123.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    subnets->add(subnet);
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.4.0"), 24, 1, 2, 3, 125)));
+    cfg_mgr.commit();
+    EXPECT_FALSE(StatsMgr::instance().getObservation("subnet[124].declined-addresses"));
+    checkDeclinedStats({ 123, 125 }, 3);
+}
+
+// This test verifies that when several subnets are recounted the leases
+// of the unchanged subnets in between are not counted.
+TEST_F(CfgMgrTest, commitStatsRange4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    auto add_lease = [](const std::string& address, SubnetID subnet_id) {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(address), hwaddr, ClientIdPtr(),
+                                   3600, time(0), subnet_id));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    };
+
+    // Each subnet has one assigned address, subnet 125 has two.
+    add_lease("192.1.2.10", 123);
+    add_lease("192.1.3.10", 124);
+    add_lease("192.1.4.10", 125);
+    add_lease("192.1.4.11", 125);
+
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123)));
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124)));
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.4.0"), 24, 1, 2, 3, 125)));
+    cfg_mgr.commit();
+
+    // Pretend the value of the unchanged subnet is different from the
+    // database so it is visible if it is recounted.
+    stats_mgr.setValue("subnet[124].assigned-addresses", static_cast<int64_t>(150));
+
+    // Modify the first and the last subnets.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    subnets->add(subnet);
+    subnets->add(Subnet4Ptr(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124)));
+    subnet.reset(new Subnet4(IOAddress("192.1.4.0"), 24, 1, 2, 3, 125));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.1.4.0"), 25)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    ObservationPtr assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(1, assigned->getInteger().first);
+    assigned = stats_mgr.getObservation("subnet[124].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(150, assigned->getInteger().first);
+    assigned = stats_mgr.getObservation("subnet[125].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(2, assigned->getInteger().first);
+    ConstSubnet4Ptr current = cfg_mgr.getCurrentCfg()->getCfgSubnets4()->getBySubnetId(125);
+    ASSERT_TRUE(current);
+    EXPECT_EQ(2, current->getAssignedLeasesHint(Lease::TYPE_V4));
+}
+
 // This test verifies that once the configuration is merged into the current
 // configuration, statistics are updated appropriately.
 TEST_F(CfgMgrTest, mergeIntoCurrentStats4) {
@@ -750,6 +940,108 @@ TEST_F(CfgMgrTest, commitStats6) {
     EXPECT_EQ(65536, total_addrs->getInteger().first);
 }
 
+// This test verifies that the global declined addresses statistic stays
+// the sum of the per subnet values when subnets are added and removed.
+TEST_F(CfgMgrTest, commitStatsDeclined6) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    startBackend(AF_INET6);
+
+    auto add_declined = [](const std::string& address, SubnetID subnet_id) {
+        DuidPtr duid(new DUID(std::vector<uint8_t>(8, 1)));
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress(address), duid,
+                                   1, 1800, 3600, subnet_id));
+        lease->state_ = Lease::STATE_DECLINED;
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    };
+
+    // Subnet 123 has 2 declined addresses, subnet 124 has 3.
+    add_declined("2001:db8:1::10", 123);
+    add_declined("2001:db8:1::11", 123);
+    add_declined("2001:db8:2::10", 124);
+    add_declined("2001:db8:2::11", 124);
+    add_declined("2001:db8:2::12", 124);
+
+    CfgSubnets6Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123)));
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 124)));
+    cfg_mgr.commit();
+    checkDeclinedStats({ 123, 124 }, 5);
+
+    // Add subnet 125 with 1 declined address.
+    add_declined("2001:db8:3::10", 125);
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123)));
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 124)));
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:3::"), 48, 1, 2, 3, 4, 125)));
+    cfg_mgr.commit();
+    checkDeclinedStats({ 123, 124, 125 }, 6);
+
+    // Remove subnet 124 and modify subnet 123.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 121)));
+    subnets->add(subnet);
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:3::"), 48, 1, 2, 3, 4, 125)));
+    cfg_mgr.commit();
+    EXPECT_FALSE(StatsMgr::instance().getObservation("subnet[124].declined-addresses"));
+    checkDeclinedStats({ 123, 125 }, 3);
+}
+
+// This test verifies that when several subnets are recounted the leases
+// of the unchanged subnets in between are not counted.
+TEST_F(CfgMgrTest, commitStatsRange6) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET6);
+
+    auto add_lease = [](const std::string& address, SubnetID subnet_id) {
+        DuidPtr duid(new DUID(std::vector<uint8_t>(8, 1)));
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress(address), duid,
+                                   1, 1800, 3600, subnet_id));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    };
+
+    // Each subnet has one assigned address, subnet 125 has two.
+    add_lease("2001:db8:1::10", 123);
+    add_lease("2001:db8:2::10", 124);
+    add_lease("2001:db8:3::10", 125);
+    add_lease("2001:db8:3::11", 125);
+
+    CfgSubnets6Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123)));
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 124)));
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:3::"), 48, 1, 2, 3, 4, 125)));
+    cfg_mgr.commit();
+
+    // Pretend the value of the unchanged subnet is different from the
+    // database so it is visible if it is recounted.
+    stats_mgr.setValue("subnet[124].assigned-nas", static_cast<int64_t>(150));
+
+    // Modify the first and the last subnets.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 64)));
+    subnets->add(subnet);
+    subnets->add(Subnet6Ptr(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 124)));
+    subnet.reset(new Subnet6(IOAddress("2001:db8:3::"), 48, 1, 2, 3, 4, 125));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:3::"), 64)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    ObservationPtr assigned = stats_mgr.getObservation("subnet[123].assigned-nas");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(1, assigned->getInteger().first);
+    assigned = stats_mgr.getObservation("subnet[124].assigned-nas");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(150, assigned->getInteger().first);
+    assigned = stats_mgr.getObservation("subnet[125].assigned-nas");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(2, assigned->getInteger().first);
+    ConstSubnet6Ptr current = cfg_mgr.getCurrentCfg()->getCfgSubnets6()->getBySubnetId(125);
+    ASSERT_TRUE(current);
+    EXPECT_EQ(2, current->getAssignedLeasesHint(Lease::TYPE_NA));
+}
+
 // This test verifies that once the configuration is merged into the current
 // configuration, statistics are updated appropriately.
 /// @todo Enable this test once merging v6 configuration is enabled.
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,8 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option_space.h>
+#include <dhcp/pkt4.h>
+#include <eval/dependency.h>
 #include <testutils/test_to_element.h>
 #include <exceptions/exceptions.h>
 #include <boost/scoped_ptr.hpp>
@@ -44,6 +46,7 @@ TEST(ClientClassDef, construction) {
     ASSERT_NO_THROW(cclass.reset(new ClientClassDef(name, expr)));
     EXPECT_EQ(name, cclass->getName());
     ASSERT_FALSE(cclass->getMatchExpr());
+    EXPECT_FALSE(cclass->getCompiledMatchExpr());
     EXPECT_FALSE(cclass->getCfgOptionDef());
 
     // Verify we get an empty collection of cfg_option
@@ -137,6 +140,14 @@ TEST(ClientClassDef, copyAndEquality) {
     EXPECT_TRUE(cclass->getMatchExpr().get() !=
                  cclass2->getMatchExpr().get());
 
+    // Both expressions are compiled from their own copy.
+    ASSERT_TRUE(cclass->getCompiledMatchExpr());
+    ASSERT_TRUE(cclass2->getCompiledMatchExpr());
+    EXPECT_EQ(cclass->getMatchExpr(),
+              cclass->getCompiledMatchExpr()->getSource());
+    EXPECT_EQ(cclass2->getMatchExpr(),
+              cclass2->getCompiledMatchExpr()->getSource());
+
     // The allocated CfgOption pointers should not match
     EXPECT_TRUE(cclass->getCfgOption().get() !=
                  cclass2->getCfgOption().get());
@@ -242,6 +253,47 @@ TEST(ClientClassDef, dependency) {
     EXPECT_FALSE(cclass->dependOnClass("bar"));
 }
 
+// Tests the evaluation of the match expression.
+TEST(ClientClassDef, evaluateMatchExpr) {
+    boost::scoped_ptr<ClientClassDef> cclass;
+    Pkt4Ptr pkt(new Pkt4(DHCPDISCOVER, 1234));
+    EvalCache cache;
+
+    // No expression: no match.
+    ExpressionPtr expr;
+    ASSERT_NO_THROW(cclass.reset(new ClientClassDef("class", expr)));
+    EXPECT_FALSE(cclass->evaluateMatchExpr(*pkt, cache));
+
+    // Make the option[100].exists and member('foo') expression.
+    expr.reset(new Expression());
+    TokenPtr exists(new TokenOption(100, TokenOption::EXISTS));
+    expr->push_back(exists);
+    expr->push_back(TokenPtr(new TokenMember("foo")));
+    expr->push_back(TokenPtr(new TokenAnd()));
+    ASSERT_NO_THROW(cclass.reset(new ClientClassDef("class", expr)));
+
+    // The option is absent so nothing is evaluated.
+    EXPECT_FALSE(cclass->evaluateMatchExpr(*pkt, cache));
+    EXPECT_TRUE(cache.empty());
+
+    // Only the part which doesn't depend on classes is cached.
+    pkt->addOption(OptionPtr(new Option(Option::V4, 100)));
+    EXPECT_FALSE(cclass->evaluateMatchExpr(*pkt, cache));
+    ExpressionPtr sub(new Expression());
+    sub->push_back(exists);
+    string key = getExpressionKey(sub);
+    ASSERT_EQ(1, cache.size());
+    ASSERT_EQ(1, cache.count(key));
+    EXPECT_TRUE(cache[key]);
+
+    pkt->addClass("foo");
+    EXPECT_TRUE(cclass->evaluateMatchExpr(*pkt, cache));
+
+    // The cached value is used.
+    cache[key] = false;
+    EXPECT_FALSE(cclass->evaluateMatchExpr(*pkt, cache));
+}
+
 
 // Tests the basic operation of ClientClassDictionary
 // This includes adding, finding, and removing classes
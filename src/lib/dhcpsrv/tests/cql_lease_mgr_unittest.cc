@@ -670,6 +670,27 @@ TEST_F(CqlLeaseMgrTest, deleteExpiredReclaimedLeases4) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that a batch of DHCPv4 leases is reclaimed.
+TEST_F(CqlLeaseMgrTest, reclaimLeases4) {
+    testReclaimLeases4();
+}
+
+/// @brief Check that a DHCPv4 lease is allocated or renewed at once.
+TEST_F(CqlLeaseMgrTest, allocateOrRenewLease4) {
+    testAllocateOrRenewLease4();
+}
+
+/// @brief Check that a DHCPv4 lease is allocated or renewed only by the
+/// client it belongs to.
+TEST_F(CqlLeaseMgrTest, allocateOrRenewLease4Ownership) {
+    testAllocateOrRenewLease4Ownership();
+}
+
+/// @brief Check that a batch of DHCPv6 leases is reclaimed.
+TEST_F(CqlLeaseMgrTest, reclaimLeases6) {
+    testReclaimLeases6();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// LEASE6 /////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -237,6 +237,21 @@ TEST_F(ExpirationConfigParserTest, outOfRangeValues) {
                    CfgExpiration::LIMIT_UNWARNED_RECLAIM_CYCLES);
 }
 
+// This test verifies that the background reclamation can be enabled.
+TEST_F(ExpirationConfigParserTest, backgroundReclamation) {
+    std::string config = "{ \"background-reclamation\": true }";
+    ElementPtr config_element = Element::fromJSON(config);
+
+    ExpirationConfigParser parser;
+    ASSERT_NO_THROW(parser.parse(config_element));
+    CfgExpirationPtr cfg = CfgMgr::instance().getStagingCfg()->getCfgExpiration();
+    EXPECT_TRUE(cfg->getBackgroundReclamation());
+
+    // The value must be a boolean.
+    config_element = Element::fromJSON("{ \"background-reclamation\": 1 }");
+    EXPECT_THROW(parser.parse(config_element), DhcpConfigError);
+}
+
 // This test verifies that it is not allowed to specify a value as
 // a text.
 TEST_F(ExpirationConfigParserTest, notNumberValue) {
@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
 
@@ -2600,6 +2601,277 @@ GenericLeaseMgrTest::testDeleteExpiredReclaimedLeases6() {
     }
 }
 
+void
+GenericLeaseMgrTest::testReclaimLeases4() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+    // Make sure we have at least 6 leases there.
+    ASSERT_GE(leases.size(), 6);
+
+    time_t current_time = time(NULL);
+
+    // Add expired leases to the database.
+    for (size_t i = 0; i < leases.size(); ++i) {
+        leases[i]->cltt_ = current_time - leases[i]->valid_lft_ - 10;
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Fetch the leases being reclaimed.
+    vector<Lease4Ptr> expired;
+    for (size_t i = 0; i < 6; ++i) {
+        Lease4Ptr lease = lmptr_->getLease4(leases[i]->addr_);
+        ASSERT_TRUE(lease);
+        expired.push_back(lease);
+    }
+
+    // The lease 1 is renewed and the lease 3 removed in the meantime.
+    Lease4Ptr renewed(new Lease4(*expired[1]));
+    renewed->cltt_ = current_time;
+    ASSERT_NO_THROW(lmptr_->updateLease4(renewed));
+    ASSERT_TRUE(lmptr_->deleteLease(expired[3]));
+
+    // Leases 0, 1 and 3 are set in the expired-reclaimed state, leases 2
+    // and 4 are removed.
+    Lease4Collection updated;
+    Lease4Collection deleted;
+    for (size_t i = 0; i < 5; ++i) {
+        if ((i == 2) || (i == 4)) {
+            deleted.push_back(expired[i]);
+        } else {
+            expired[i]->hostname_.clear();
+            expired[i]->fqdn_fwd_ = false;
+            expired[i]->fqdn_rev_ = false;
+            expired[i]->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+            updated.push_back(expired[i]);
+        }
+    }
+
+    Lease4Collection skipped;
+    ASSERT_NO_THROW(skipped = lmptr_->reclaimLeases4(updated, deleted));
+
+    // The renewed and the removed leases were skipped.
+    ASSERT_EQ(2, skipped.size());
+    EXPECT_TRUE(std::find(skipped.begin(), skipped.end(), expired[1]) != skipped.end());
+    EXPECT_TRUE(std::find(skipped.begin(), skipped.end(), expired[3]) != skipped.end());
+
+    Lease4Ptr lease = lmptr_->getLease4(leases[0]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(lease->stateExpiredReclaimed());
+    EXPECT_TRUE(lease->hostname_.empty());
+    EXPECT_FALSE(lease->fqdn_fwd_);
+    EXPECT_FALSE(lease->fqdn_rev_);
+
+    lease = lmptr_->getLease4(leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_FALSE(lease->stateExpiredReclaimed());
+    EXPECT_EQ(current_time, lease->cltt_);
+
+    EXPECT_FALSE(lmptr_->getLease4(leases[2]->addr_));
+    EXPECT_FALSE(lmptr_->getLease4(leases[3]->addr_));
+    EXPECT_FALSE(lmptr_->getLease4(leases[4]->addr_));
+
+    // The lease 5 was not part of the batch.
+    lease = lmptr_->getLease4(leases[5]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_FALSE(lease->stateExpiredReclaimed());
+
+    // Nothing to do for empty batches.
+    ASSERT_NO_THROW(skipped = lmptr_->reclaimLeases4(Lease4Collection(),
+                                                    Lease4Collection()));
+    EXPECT_TRUE(skipped.empty());
+}
+
+void
+GenericLeaseMgrTest::testAllocateOrRenewLease4() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_GE(leases.size(), 2);
+
+    time_t current_time = time(NULL);
+
+    // The address is free so the lease is added.
+    Lease4Ptr lease(new Lease4(*leases[0]));
+    lease->cltt_ = current_time;
+    Lease4Ptr old_lease;
+    ASSERT_TRUE(lmptr_->allocateOrRenewLease4(lease, old_lease));
+    EXPECT_FALSE(old_lease);
+    Lease4Ptr current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    detailCompareLease(lease, current);
+
+    // The same client renews its lease.
+    Lease4Ptr renewed(new Lease4(*lease));
+    renewed->valid_lft_ = lease->valid_lft_ + 100;
+    renewed->hostname_ = "renewed.example.org.";
+    ASSERT_TRUE(lmptr_->allocateOrRenewLease4(renewed, old_lease));
+    ASSERT_TRUE(old_lease);
+    EXPECT_EQ(lease->valid_lft_, old_lease->valid_lft_);
+    current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    EXPECT_EQ(renewed->valid_lft_, current->valid_lft_);
+    EXPECT_EQ("renewed.example.org.", current->hostname_);
+
+    // Another client can't take the address while the lease is valid.
+    Lease4Ptr other(new Lease4(*leases[1]));
+    other->addr_ = lease->addr_;
+    other->cltt_ = current_time;
+    ASSERT_FALSE(lmptr_->allocateOrRenewLease4(other, old_lease));
+    ASSERT_TRUE(old_lease);
+    EXPECT_TRUE(*old_lease->hwaddr_ == *lease->hwaddr_);
+    current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    EXPECT_TRUE(*current->hwaddr_ == *lease->hwaddr_);
+
+    // The lease expires so the other client gets the address.
+    current->cltt_ = current_time - current->valid_lft_ - 10;
+    ASSERT_NO_THROW(lmptr_->updateLease4(current));
+    ASSERT_TRUE(lmptr_->allocateOrRenewLease4(other, old_lease));
+    ASSERT_TRUE(old_lease);
+    EXPECT_TRUE(old_lease->expired());
+    current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    EXPECT_TRUE(*current->hwaddr_ == *other->hwaddr_);
+    EXPECT_EQ(other->subnet_id_, current->subnet_id_);
+}
+
+void
+GenericLeaseMgrTest::testAllocateOrRenewLease4Ownership() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_GE(leases.size(), 1);
+
+    time_t current_time = time(NULL);
+
+    // Add a lease without client identifier.
+    Lease4Ptr lease(new Lease4(*leases[0]));
+    lease->hwaddr_.reset(new HWAddr(vector<uint8_t>(6, 0x51), HTYPE_ETHER));
+    lease->client_id_.reset();
+    lease->cltt_ = current_time;
+    Lease4Ptr old_lease;
+    ASSERT_TRUE(lmptr_->allocateOrRenewLease4(lease, old_lease));
+
+    // Without client identifiers the hardware addresses are compared:
+    // another client without client identifier can't take the address.
+    Lease4Ptr other(new Lease4(*lease));
+    other->hwaddr_.reset(new HWAddr(vector<uint8_t>(6, 0x52), HTYPE_ETHER));
+    ASSERT_FALSE(lmptr_->allocateOrRenewLease4(other, old_lease));
+    ASSERT_TRUE(old_lease);
+    EXPECT_FALSE(old_lease->client_id_);
+    Lease4Ptr current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    EXPECT_EQ(lease->hwaddr_->hwaddr_, current->hwaddr_->hwaddr_);
+
+    // The hardware types must match too.
+    other.reset(new Lease4(*lease));
+    other->hwaddr_.reset(new HWAddr(lease->hwaddr_->hwaddr_, HTYPE_FDDI));
+    EXPECT_FALSE(lmptr_->allocateOrRenewLease4(other, old_lease));
+
+    // The same client renews its lease.
+    Lease4Ptr renewed(new Lease4(*lease));
+    renewed->valid_lft_ = lease->valid_lft_ + 100;
+    ASSERT_TRUE(lmptr_->allocateOrRenewLease4(renewed, old_lease));
+    ASSERT_TRUE(old_lease);
+    current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    EXPECT_EQ(renewed->valid_lft_, current->valid_lft_);
+
+    // The client now sends a client identifier: the lease still belongs
+    // to it as its hardware address matches.
+    renewed.reset(new Lease4(*lease));
+    renewed->client_id_ = ClientId::fromText("01:02:03:04");
+    ASSERT_TRUE(lmptr_->allocateOrRenewLease4(renewed, old_lease));
+    current = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(current);
+    ASSERT_TRUE(current->client_id_);
+    EXPECT_TRUE(*current->client_id_ == *renewed->client_id_);
+
+    // A client with another client identifier can't take the address
+    // even with the same hardware address.
+    other.reset(new Lease4(*renewed));
+    other->client_id_ = ClientId::fromText("01:02:03:05");
+    EXPECT_FALSE(lmptr_->allocateOrRenewLease4(other, old_lease));
+}
+
+void
+GenericLeaseMgrTest::testReclaimLeases6() {
+    // Get the leases to be used for the test.
+    vector<Lease6Ptr> leases = createLeases6();
+    // Make sure we have at least 6 leases there.
+    ASSERT_GE(leases.size(), 6);
+
+    time_t current_time = time(NULL);
+
+    // Add expired leases to the database.
+    for (size_t i = 0; i < leases.size(); ++i) {
+        leases[i]->cltt_ = current_time - leases[i]->valid_lft_ - 10;
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Fetch the leases being reclaimed.
+    vector<Lease6Ptr> expired;
+    for (size_t i = 0; i < 6; ++i) {
+        Lease6Ptr lease = lmptr_->getLease6(leasetype6_[i], leases[i]->addr_);
+        ASSERT_TRUE(lease);
+        expired.push_back(lease);
+    }
+
+    // The lease 1 is renewed and the lease 3 removed in the meantime.
+    Lease6Ptr renewed(new Lease6(*expired[1]));
+    renewed->cltt_ = current_time;
+    ASSERT_NO_THROW(lmptr_->updateLease6(renewed));
+    ASSERT_TRUE(lmptr_->deleteLease(expired[3]));
+
+    // Leases 0, 1 and 3 are set in the expired-reclaimed state, leases 2
+    // and 4 are removed.
+    Lease6Collection updated;
+    Lease6Collection deleted;
+    for (size_t i = 0; i < 5; ++i) {
+        if ((i == 2) || (i == 4)) {
+            deleted.push_back(expired[i]);
+        } else {
+            expired[i]->hostname_.clear();
+            expired[i]->fqdn_fwd_ = false;
+            expired[i]->fqdn_rev_ = false;
+            expired[i]->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+            updated.push_back(expired[i]);
+        }
+    }
+
+    Lease6Collection skipped;
+    ASSERT_NO_THROW(skipped = lmptr_->reclaimLeases6(updated, deleted));
+
+    // The renewed and the removed leases were skipped.
+    ASSERT_EQ(2, skipped.size());
+    EXPECT_TRUE(std::find(skipped.begin(), skipped.end(), expired[1]) != skipped.end());
+    EXPECT_TRUE(std::find(skipped.begin(), skipped.end(), expired[3]) != skipped.end());
+
+    Lease6Ptr lease = lmptr_->getLease6(leasetype6_[0], leases[0]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(lease->stateExpiredReclaimed());
+    EXPECT_TRUE(lease->hostname_.empty());
+    EXPECT_FALSE(lease->fqdn_fwd_);
+    EXPECT_FALSE(lease->fqdn_rev_);
+
+    lease = lmptr_->getLease6(leasetype6_[1], leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_FALSE(lease->stateExpiredReclaimed());
+    EXPECT_EQ(current_time, lease->cltt_);
+
+    EXPECT_FALSE(lmptr_->getLease6(leasetype6_[2], leases[2]->addr_));
+    EXPECT_FALSE(lmptr_->getLease6(leasetype6_[3], leases[3]->addr_));
+    EXPECT_FALSE(lmptr_->getLease6(leasetype6_[4], leases[4]->addr_));
+
+    // The lease 5 was not part of the batch.
+    lease = lmptr_->getLease6(leasetype6_[5], leases[5]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_FALSE(lease->stateExpiredReclaimed());
+
+    // Nothing to do for empty batches.
+    ASSERT_NO_THROW(skipped = lmptr_->reclaimLeases6(Lease6Collection(),
+                                                    Lease6Collection()));
+    EXPECT_TRUE(skipped.empty());
+}
+
 void
 GenericLeaseMgrTest::testGetDeclinedLeases4() {
     // Get the leases to be used for the test.
@@ -416,6 +416,32 @@ public:
     /// leases can be removed.
     void testDeleteExpiredReclaimedLeases4();
 
+    /// @brief Checks that a batch of IPv4 leases is reclaimed.
+    ///
+    /// This creates a number of expired DHCPv4 leases, renews and removes
+    /// some of them, and verifies that the others are updated or removed
+    /// by a batch while the renewed and removed ones are skipped.
+    void testReclaimLeases4();
+
+    /// @brief Checks that a batch of IPv6 leases is reclaimed.
+    ///
+    /// This is the DHCPv6 variant of @ref testReclaimLeases4.
+    void testReclaimLeases6();
+
+    /// @brief Checks that an IPv4 lease is allocated or renewed at once.
+    ///
+    /// This verifies that the lease is added for a free address, replaced
+    /// when it belongs to the same client or is expired, and left intact
+    /// when it is in use by another client.
+    void testAllocateOrRenewLease4();
+
+    /// @brief Checks the ownership rule of @c allocateOrRenewLease4.
+    ///
+    /// This verifies that the leases are matched as by
+    /// @c Lease4::belongsToClient, in particular when neither lease has
+    /// a client identifier and when the hardware types differ.
+    void testAllocateOrRenewLease4Ownership();
+
     /// @brief Check that the IPv4 lease statistics can be recounted
     ///
     /// This test creates two subnets and several leases associated with
@@ -100,6 +100,9 @@ typedef boost::shared_ptr<TestHostCache> TestHostCachePtr;
 class TestHostDataSource : public MemHostDataSource {
 public:
 
+    /// Constructor
+    TestHostDataSource() : lookups_(0) { }
+
     /// Destructor
     virtual ~TestHostDataSource() { }
 
@@ -107,6 +110,25 @@ public:
     string getType() const {
         return ("test");
     }
+
+    /// Counted getByIdentifiers4
+    ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ++lookups_;
+        return (MemHostDataSource::getByIdentifiers4(subnet_id, identifiers));
+    }
+
+    /// Counted getByIdentifiers6
+    ConstHostCollection
+    getByIdentifiers6(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ++lookups_;
+        return (MemHostDataSource::getByIdentifiers6(subnet_id, identifiers));
+    }
+
+    /// Lookup by identifiers counter
+    mutable size_t lookups_;
 };
 
 /// @brief TestHostDataSource pointer type
@@ -258,6 +280,71 @@ TEST_F(HostCacheTest, identifier6) {
     EXPECT_EQ(1, hcptr_->inserts_);
 }
 
+// Check that the data source is not queried by identifiers when the
+// host of the preferred identifier is cached for IPv4.
+TEST_F(HostCacheTest, identifiers4) {
+    ASSERT_TRUE(hcptr_);
+    ASSERT_TRUE(memptr_);
+
+    // Create a host reservation.
+    HostPtr host = HostDataSourceUtils::initializeHost4("192.0.2.1",
+                                                        Host::IDENT_HWADDR);
+    ASSERT_TRUE(host);  // Make sure the host is generated properly.
+    ASSERT_NO_THROW(memptr_->add(host));
+
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifier(host->getIdentifierType(),
+                                         host->getIdentifier()));
+
+    // The cache misses: the data source is queried and the host cached.
+    ConstHostPtr got = HostMgr::instance().get4(host->getIPv4SubnetID(),
+                                                identifiers);
+    ASSERT_TRUE(got);
+    HostDataSourceUtils::compareHosts(got, host);
+    EXPECT_EQ(1, memptr_->lookups_);
+    EXPECT_EQ(1, hcptr_->size());
+
+    // The cache hits: the data source is not queried.
+    got = HostMgr::instance().get4(host->getIPv4SubnetID(), identifiers);
+    ASSERT_TRUE(got);
+    HostDataSourceUtils::compareHosts(got, host);
+    EXPECT_EQ(1, memptr_->lookups_);
+    EXPECT_EQ(1, hcptr_->size());
+}
+
+// Check that the data source is not queried by identifiers when the
+// host of the preferred identifier is cached for IPv6.
+TEST_F(HostCacheTest, identifiers6) {
+    ASSERT_TRUE(hcptr_);
+    ASSERT_TRUE(memptr_);
+
+    // Create a host reservation.
+    HostPtr host = HostDataSourceUtils::initializeHost6("2001:db8::1",
+                                                        Host::IDENT_DUID,
+                                                        false);
+    ASSERT_TRUE(host);  // Make sure the host is generated properly.
+    ASSERT_NO_THROW(memptr_->add(host));
+
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifier(host->getIdentifierType(),
+                                         host->getIdentifier()));
+
+    // The cache misses: the data source is queried and the host cached.
+    ConstHostPtr got = HostMgr::instance().get6(host->getIPv6SubnetID(),
+                                                identifiers);
+    ASSERT_TRUE(got);
+    HostDataSourceUtils::compareHosts(got, host);
+    EXPECT_EQ(1, memptr_->lookups_);
+    EXPECT_EQ(1, hcptr_->size());
+
+    // The cache hits: the data source is not queried.
+    got = HostMgr::instance().get6(host->getIPv6SubnetID(), identifiers);
+    ASSERT_TRUE(got);
+    HostDataSourceUtils::compareHosts(got, host);
+    EXPECT_EQ(1, memptr_->lookups_);
+    EXPECT_EQ(1, hcptr_->size());
+}
+
 // Check by address caching for IPv4.
 TEST_F(HostCacheTest, address4) {
     // Check we have what we need.
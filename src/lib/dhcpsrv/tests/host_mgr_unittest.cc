@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -205,6 +205,17 @@ protected:
     /// cached reservation with and only with get4Any.
     void testGet4Any();
 
+    /// @brief This test verifies that the IPv4 reservation of a client
+    /// having several identifiers is retrieved using the preferred
+    /// identifier.
+    ///
+    /// @param data_source1 Host data source to which first reservation is
+    /// inserted.
+    /// @param data_source2 Host data source to which second reservation is
+    /// inserted.
+    void testGet4ByIdentifiers(BaseHostDataSource& data_source1,
+                               BaseHostDataSource& data_source2);
+
     /// @brief This test verifies that it is possible to retrieve an IPv6
     /// reservation for the particular host using HostMgr.
     ///
@@ -216,6 +227,17 @@ protected:
     /// cached reservation with and only with get6Any.
     void testGet6Any();
 
+    /// @brief This test verifies that the IPv6 reservation of a client
+    /// having several identifiers is retrieved using the preferred
+    /// identifier.
+    ///
+    /// @param data_source1 Host data source to which first reservation is
+    /// inserted.
+    /// @param data_source2 Host data source to which second reservation is
+    /// inserted.
+    void testGet6ByIdentifiers(BaseHostDataSource& data_source1,
+                               BaseHostDataSource& data_source2);
+
     /// @brief This test verifies that it is possible to retrieve an IPv6
     /// prefix reservation for the particular host using HostMgr.
     ///
@@ -831,6 +853,48 @@ HostMgrTest::testGet4Any() {
     EXPECT_FALSE(host);
 }
 
+void
+HostMgrTest::testGet4ByIdentifiers(BaseHostDataSource& data_source1,
+                                   BaseHostDataSource& data_source2) {
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifier(Host::IDENT_HWADDR,
+                                         hwaddrs_[0]->hwaddr_));
+    identifiers.push_back(HostIdentifier(Host::IDENT_DUID,
+                                         duids_[0]->getDuid()));
+
+    // Initially, no host should be present.
+    ConstHostPtr host = HostMgr::instance().get4(SubnetID(1), identifiers);
+    ASSERT_FALSE(host);
+
+    // Add a host for each identifier.
+    addHost4(data_source1, hwaddrs_[0], SubnetID(1), IOAddress("192.0.2.5"));
+    data_source2.add(HostPtr(new Host(duids_[0]->toText(), "duid",
+                                      SubnetID(1), SUBNET_ID_UNUSED,
+                                      IOAddress("192.0.2.6"))));
+    CfgMgr::instance().commit();
+
+    // The host using the first identifier is preferred.
+    host = HostMgr::instance().get4(SubnetID(1), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ("192.0.2.5", host->getIPv4Reservation().toText());
+
+    // The order of the identifiers matters.
+    identifiers.reverse();
+    host = HostMgr::instance().get4(SubnetID(1), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ("192.0.2.6", host->getIPv4Reservation().toText());
+
+    // The next identifier is used when there is no host for the first one.
+    identifiers.reverse();
+    identifiers.front().second = hwaddrs_[1]->hwaddr_;
+    host = HostMgr::instance().get4(SubnetID(1), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ("192.0.2.6", host->getIPv4Reservation().toText());
+
+    // No host in another subnet.
+    EXPECT_FALSE(HostMgr::instance().get4(SubnetID(2), identifiers));
+}
+
 void
 HostMgrTest::testGet6(BaseHostDataSource& data_source) {
     // Initially, no host should be present.
@@ -915,6 +979,54 @@ HostMgrTest::testGet6Any() {
     EXPECT_FALSE(host);
 }
 
+void
+HostMgrTest::testGet6ByIdentifiers(BaseHostDataSource& data_source1,
+                                   BaseHostDataSource& data_source2) {
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifier(Host::IDENT_HWADDR,
+                                         hwaddrs_[0]->hwaddr_));
+    identifiers.push_back(HostIdentifier(Host::IDENT_DUID,
+                                         duids_[0]->getDuid()));
+
+    // Initially, no host should be present.
+    ConstHostPtr host = HostMgr::instance().get6(SubnetID(2), identifiers);
+    ASSERT_FALSE(host);
+
+    // Add a host for each identifier.
+    HostPtr new_host(new Host(hwaddrs_[0]->toText(false), "hw-address",
+                              SubnetID(1), SubnetID(2),
+                              IOAddress::IPV4_ZERO_ADDRESS()));
+    new_host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                       IOAddress("2001:db8:1::1")));
+    data_source1.add(new_host);
+    addHost6(data_source2, duids_[0], SubnetID(2), IOAddress("2001:db8:1::2"));
+    CfgMgr::instance().commit();
+
+    // The host using the first identifier is preferred.
+    host = HostMgr::instance().get6(SubnetID(2), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_TRUE(host->hasReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                               IOAddress("2001:db8:1::1"))));
+
+    // The order of the identifiers matters.
+    identifiers.reverse();
+    host = HostMgr::instance().get6(SubnetID(2), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_TRUE(host->hasReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                               IOAddress("2001:db8:1::2"))));
+
+    // The next identifier is used when there is no host for the first one.
+    identifiers.reverse();
+    identifiers.front().second = hwaddrs_[1]->hwaddr_;
+    host = HostMgr::instance().get6(SubnetID(2), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_TRUE(host->hasReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                               IOAddress("2001:db8:1::2"))));
+
+    // No host in another subnet.
+    EXPECT_FALSE(HostMgr::instance().get6(SubnetID(3), identifiers));
+}
+
 void
 HostMgrTest::testGet6ByPrefix(BaseHostDataSource& data_source1,
                               BaseHostDataSource& data_source2) {
@@ -1033,6 +1145,13 @@ TEST_F(HostMgrTest, get4Any) {
     testGet4Any();
 }
 
+// This test verifies that the reservation of a client having several
+// identifiers is retrieved using the preferred identifier. The reservations
+// are specified in the server's configuration.
+TEST_F(HostMgrTest, get4ByIdentifiers) {
+    testGet4ByIdentifiers(*getCfgHosts(), *getCfgHosts());
+}
+
 // This test verifies that it is possible to retrieve IPv6 reservations for
 // the particular host using HostMgr. The reservation is specified in the
 // server's configuration.
@@ -1045,6 +1164,13 @@ TEST_F(HostMgrTest, get6Any) {
     testGet6Any();
 }
 
+// This test verifies that the IPv6 reservation of a client having several
+// identifiers is retrieved using the preferred identifier. The reservations
+// are specified in the server's configuration.
+TEST_F(HostMgrTest, get6ByIdentifiers) {
+    testGet6ByIdentifiers(*getCfgHosts(), *getCfgHosts());
+}
+
 // This test verifies that it is possible to retrieve the reservation of the
 // particular IPv6 prefix using HostMgr.
 TEST_F(HostMgrTest, get6ByPrefix) {
@@ -1296,6 +1422,20 @@ TEST_F(MySQLHostMgrTest, get6) {
     testGet6(HostMgr::instance());
 }
 
+// This test verifies that the reservation of a client having several
+// identifiers is retrieved from a configuration file and a database using
+// the preferred identifier.
+TEST_F(MySQLHostMgrTest, get4ByIdentifiers) {
+    testGet4ByIdentifiers(*getCfgHosts(), HostMgr::instance());
+}
+
+// This test verifies that the IPv6 reservation of a client having several
+// identifiers is retrieved from a configuration file and a database using
+// the preferred identifier.
+TEST_F(MySQLHostMgrTest, get6ByIdentifiers) {
+    testGet6ByIdentifiers(*getCfgHosts(), HostMgr::instance());
+}
+
 // This test verifies that the IPv6 prefix reservation can be retrieved
 // from a configuration file and a database.
 TEST_F(MySQLHostMgrTest, get6ByPrefix) {
@@ -1441,6 +1581,20 @@ TEST_F(PostgreSQLHostMgrTest, get6) {
     testGet6(HostMgr::instance());
 }
 
+// This test verifies that the reservation of a client having several
+// identifiers is retrieved from a configuration file and a database using
+// the preferred identifier.
+TEST_F(PostgreSQLHostMgrTest, get4ByIdentifiers) {
+    testGet4ByIdentifiers(*getCfgHosts(), HostMgr::instance());
+}
+
+// This test verifies that the IPv6 reservation of a client having several
+// identifiers is retrieved from a configuration file and a database using
+// the preferred identifier.
+TEST_F(PostgreSQLHostMgrTest, get6ByIdentifiers) {
+    testGet6ByIdentifiers(*getCfgHosts(), HostMgr::instance());
+}
+
 // This test verifies that the IPv6 prefix reservation can be retrieved
 // from a configuration file and a database.
 TEST_F(PostgreSQLHostMgrTest, get6ByPrefix) {
@@ -1567,6 +1721,20 @@ TEST_F(CQLHostMgrTest, get6) {
     testGet6(HostMgr::instance());
 }
 
+// This test verifies that the reservation of a client having several
+// identifiers is retrieved from a configuration file and a database using
+// the preferred identifier.
+TEST_F(CQLHostMgrTest, get4ByIdentifiers) {
+    testGet4ByIdentifiers(*getCfgHosts(), HostMgr::instance());
+}
+
+// This test verifies that the IPv6 reservation of a client having several
+// identifiers is retrieved from a configuration file and a database using
+// the preferred identifier.
+TEST_F(CQLHostMgrTest, get6ByIdentifiers) {
+    testGet6ByIdentifiers(*getCfgHosts(), HostMgr::instance());
+}
+
 // This test verifies that the IPv6 prefix reservation can be retrieved
 // from a configuration file and a database.
 TEST_F(CQLHostMgrTest, get6ByPrefix) {
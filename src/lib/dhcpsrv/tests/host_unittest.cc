@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -919,6 +919,39 @@ TEST_F(HostTest, addOptions6) {
     EXPECT_TRUE(options->empty());
 }
 
+// This test checks that the hosts without options share an empty option
+// data configuration and get their own when options are added.
+TEST_F(HostTest, emptyOptions) {
+    Host host1("01:02:03:04:05:06", "hw-address", SubnetID(1), SubnetID(2),
+               IOAddress("192.0.2.3"));
+    Host host2("01:02:03:04:05:07", "hw-address", SubnetID(1), SubnetID(2),
+               IOAddress("192.0.2.4"));
+    const Host& const_host1 = host1;
+    const Host& const_host2 = host2;
+
+    ConstCfgOptionPtr empty = const_host1.getCfgOption4();
+    ASSERT_TRUE(empty);
+    EXPECT_TRUE(empty->empty());
+    EXPECT_EQ(empty, const_host1.getCfgOption6());
+    EXPECT_EQ(empty, const_host2.getCfgOption4());
+    EXPECT_FALSE(host1.hasOptions4());
+    EXPECT_FALSE(host1.hasOptions6());
+
+    // Checking for options doesn't create the option data configuration.
+    EXPECT_EQ(empty, const_host1.getCfgOption4());
+
+    // Adding an option creates the option data configuration of the host.
+    OptionPtr option(new Option(Option::V4, 100, OptionBuffer(10, 0xFF)));
+    ASSERT_NO_THROW(host1.getCfgOption4()->add(option, false,
+                                               DHCP4_OPTION_SPACE));
+    EXPECT_TRUE(host1.hasOptions4());
+    EXPECT_FALSE(host1.hasOptions6());
+    EXPECT_NE(empty, const_host1.getCfgOption4());
+    EXPECT_FALSE(const_host1.getCfgOption4()->empty());
+    EXPECT_TRUE(empty->empty());
+    EXPECT_TRUE(const_host2.getCfgOption4()->empty());
+}
+
 // This test verifies that it is possible to retrieve a textual
 // representation of the host identifier.
 TEST_F(HostTest, getIdentifierAsText) {
@@ -1235,6 +1235,45 @@ TEST_F(MemfileLeaseMgrTest, deleteExpiredReclaimedLeases4MultiThread) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that a batch of DHCPv4 leases is reclaimed.
+TEST_F(MemfileLeaseMgrTest, reclaimLeases4) {
+    startBackend(V4);
+    testReclaimLeases4();
+}
+
+/// @brief Check that a batch of DHCPv4 leases is reclaimed.
+TEST_F(MemfileLeaseMgrTest, reclaimLeases4MultiThread) {
+    startBackend(V4);
+    MultiThreadingMgr::instance().setMode(true);
+    testReclaimLeases4();
+}
+
+/// @brief Check that a DHCPv4 lease is allocated or renewed at once.
+TEST_F(MemfileLeaseMgrTest, allocateOrRenewLease4) {
+    startBackend(V4);
+    testAllocateOrRenewLease4();
+}
+
+/// @brief Check that a DHCPv4 lease is allocated or renewed only by the
+/// client it belongs to.
+TEST_F(MemfileLeaseMgrTest, allocateOrRenewLease4Ownership) {
+    startBackend(V4);
+    testAllocateOrRenewLease4Ownership();
+}
+
+/// @brief Check that a batch of DHCPv6 leases is reclaimed.
+TEST_F(MemfileLeaseMgrTest, reclaimLeases6) {
+    startBackend(V6);
+    testReclaimLeases6();
+}
+
+/// @brief Check that a batch of DHCPv6 leases is reclaimed.
+TEST_F(MemfileLeaseMgrTest, reclaimLeases6MultiThread) {
+    startBackend(V6);
+    MultiThreadingMgr::instance().setMode(true);
+    testReclaimLeases6();
+}
+
 /// @brief Check that getLease6 methods discriminate by lease type.
 ///
 /// Adds six leases, two per lease type all with the same duid and iad but
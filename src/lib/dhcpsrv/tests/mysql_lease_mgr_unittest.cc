@@ -623,6 +623,39 @@ TEST_F(MySqlLeaseMgrTest, deleteExpiredReclaimedLeases4MultiThreading) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that a batch of DHCPv4 leases is reclaimed.
+TEST_F(MySqlLeaseMgrTest, reclaimLeases4) {
+    testReclaimLeases4();
+}
+
+/// @brief Check that a batch of DHCPv4 leases is reclaimed.
+TEST_F(MySqlLeaseMgrTest, reclaimLeases4MultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testReclaimLeases4();
+}
+
+/// @brief Check that a DHCPv4 lease is allocated or renewed at once.
+TEST_F(MySqlLeaseMgrTest, allocateOrRenewLease4) {
+    testAllocateOrRenewLease4();
+}
+
+/// @brief Check that a DHCPv4 lease is allocated or renewed only by the
+/// client it belongs to.
+TEST_F(MySqlLeaseMgrTest, allocateOrRenewLease4Ownership) {
+    testAllocateOrRenewLease4Ownership();
+}
+
+/// @brief Check that a batch of DHCPv6 leases is reclaimed.
+TEST_F(MySqlLeaseMgrTest, reclaimLeases6) {
+    testReclaimLeases6();
+}
+
+/// @brief Check that a batch of DHCPv6 leases is reclaimed.
+TEST_F(MySqlLeaseMgrTest, reclaimLeases6MultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testReclaimLeases6();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// LEASE6 /////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
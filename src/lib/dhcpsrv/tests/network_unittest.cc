@@ -1,4 +1,4 @@
-// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2019-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -168,6 +168,8 @@ TEST_F(NetworkTest, inheritanceSupport4) {
     globals_->set("calculate-tee-times", Element::create(false));
     globals_->set("t1-percent", Element::create(0.75));
     globals_->set("t2-percent", Element::create(0.6));
+    globals_->set("cache-threshold", Element::create(0.25));
+    globals_->set("cache-max-age", Element::create(20));
     globals_->set("match-client-id", Element::create(true));
     globals_->set("authoritative", Element::create(false));
     globals_->set("next-server", Element::create("192.0.2.3"));
@@ -236,6 +238,18 @@ TEST_F(NetworkTest, inheritanceSupport4) {
                                             &Network::setT2Percent,
                                             0.3, 0.6);
     }
+    {
+        SCOPED_TRACE("cache-threshold");
+        testNetworkInheritance<TestNetwork>(&Network::getCacheThreshold,
+                                            &Network::setCacheThreshold,
+                                            0.1, 0.25);
+    }
+    {
+        SCOPED_TRACE("cache-max-age");
+        testNetworkInheritance<TestNetwork>(&Network::getCacheMaxAge,
+                                            &Network::setCacheMaxAge,
+                                            10, 20);
+    }
     {
         SCOPED_TRACE("match-client-id");
         testNetworkInheritance<TestNetwork4>(&Network4::getMatchClientId,
@@ -680,6 +680,32 @@ TEST_F(PgSqlHostDataSourceTest, get4ByClientIdMultiThreading) {
     testGet4ByIdentifier(Host::IDENT_CLIENT_ID);
 }
 
+/// @brief Test verifies if the hosts of an IPv4 subnet can be retrieved by
+/// several identifiers at once.
+TEST_F(PgSqlHostDataSourceTest, getByIdentifiers4) {
+    testGetByIdentifiers4();
+}
+
+/// @brief Test verifies if the hosts of an IPv4 subnet can be retrieved by
+/// several identifiers at once.
+TEST_F(PgSqlHostDataSourceTest, getByIdentifiers4MultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testGetByIdentifiers4();
+}
+
+/// @brief Test verifies if the hosts of an IPv6 subnet can be retrieved by
+/// several identifiers at once.
+TEST_F(PgSqlHostDataSourceTest, getByIdentifiers6) {
+    testGetByIdentifiers6();
+}
+
+/// @brief Test verifies if the hosts of an IPv6 subnet can be retrieved by
+/// several identifiers at once.
+TEST_F(PgSqlHostDataSourceTest, getByIdentifiers6MultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testGetByIdentifiers6();
+}
+
 /// @brief Test verifies if hardware address and client identifier are not confused.
 TEST_F(PgSqlHostDataSourceTest, hwaddrNotClientId1) {
     testHWAddrNotClientId();
@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_service.h>
+#include <dhcpsrv/read_replica_timer.h>
+#include <dhcpsrv/timer_mgr.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c ReadReplicaTimer.
+class ReadReplicaTimerTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ReadReplicaTimerTest()
+        : timer_mgr_(TimerMgr::instance()) {
+        timer_mgr_->setIOService(IOServicePtr(new IOService()));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes all timers.
+    virtual ~ReadReplicaTimerTest() {
+        timer_mgr_->unregisterTimers();
+    }
+
+    /// @brief Instance of @c TimerMgr used by the tests.
+    TimerMgrPtr timer_mgr_;
+};
+
+// Verifies that each instance registers a timer of its own which is
+// unregistered when the instance is destroyed.
+TEST_F(ReadReplicaTimerTest, registerTimer) {
+    std::string name1;
+    std::string name2;
+    {
+        ReadReplicaTimer timer1([]() {});
+        ReadReplicaTimer timer2([]() {});
+        name1 = timer1.getName();
+        name2 = timer2.getName();
+        EXPECT_NE(name1, name2);
+        EXPECT_TRUE(timer_mgr_->isTimerRegistered(name1));
+        EXPECT_TRUE(timer_mgr_->isTimerRegistered(name2));
+    }
+    EXPECT_FALSE(timer_mgr_->isTimerRegistered(name1));
+    EXPECT_FALSE(timer_mgr_->isTimerRegistered(name2));
+}
+
+// Verifies that the destructor doesn't throw when the timer was already
+// unregistered.
+TEST_F(ReadReplicaTimerTest, alreadyUnregistered) {
+    ReadReplicaTimerPtr timer(new ReadReplicaTimer([]() {}));
+    timer_mgr_->unregisterTimers();
+    EXPECT_NO_THROW(timer.reset());
+}
+
+} // end of anonymous namespace
@@ -705,6 +705,41 @@ TEST(Subnet4Test, lastAllocated) {
     EXPECT_THROW(subnet->setLastAllocated(Lease::TYPE_PD, addr), BadValue);
 }
 
+// Checks that the assigned leases hint is maintained and that it is
+// used to determine whether the subnet is believed to have free addresses.
+TEST(Subnet4Test, assignedLeasesHint) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
+    subnet->addPool(Pool4Ptr(new Pool4(IOAddress("192.0.2.10"),
+                                       IOAddress("192.0.2.11"))));
+
+    // Initially nothing is assigned.
+    EXPECT_EQ(0, subnet->getAssignedLeasesHint(Lease::TYPE_V4));
+    EXPECT_TRUE(subnet->hasFreeLeasesHint(Lease::TYPE_V4));
+
+    // Assign one of the two addresses.
+    subnet->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
+    EXPECT_EQ(1, subnet->getAssignedLeasesHint(Lease::TYPE_V4));
+    EXPECT_TRUE(subnet->hasFreeLeasesHint(Lease::TYPE_V4));
+
+    // Assign the second address. The pool is now believed to be exhausted.
+    subnet->adjustAssignedLeasesHint(Lease::TYPE_V4, 1);
+    EXPECT_EQ(2, subnet->getAssignedLeasesHint(Lease::TYPE_V4));
+    EXPECT_FALSE(subnet->hasFreeLeasesHint(Lease::TYPE_V4));
+
+    // Release one of them.
+    subnet->adjustAssignedLeasesHint(Lease::TYPE_V4, -1);
+    EXPECT_TRUE(subnet->hasFreeLeasesHint(Lease::TYPE_V4));
+
+    // The recount may set the value explicitly.
+    subnet->setAssignedLeasesHint(Lease::TYPE_V4, 5);
+    EXPECT_EQ(5, subnet->getAssignedLeasesHint(Lease::TYPE_V4));
+    EXPECT_FALSE(subnet->hasFreeLeasesHint(Lease::TYPE_V4));
+
+    // IPv6 lease types are not supported in the IPv4 subnet.
+    EXPECT_THROW(subnet->getAssignedLeasesHint(Lease::TYPE_NA), BadValue);
+    EXPECT_THROW(subnet->adjustAssignedLeasesHint(Lease::TYPE_PD, 1), BadValue);
+}
+
 // Checks if the V4 is the only allowed type for Pool4 and if getPool()
 // is working properly.
 TEST(Subnet4Test, PoolType) {
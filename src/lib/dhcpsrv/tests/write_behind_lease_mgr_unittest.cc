@@ -0,0 +1,201 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/memfile_lease_mgr.h>
+#include <dhcpsrv/write_behind_lease_mgr.h>
+#include <dhcpsrv/tests/test_utils.h>
+#include <gtest/gtest.h>
+#include <boost/scoped_ptr.hpp>
+#include <cstdio>
+#include <unistd.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::db;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c WriteBehindLeaseMgr.
+class WriteBehindLeaseMgrTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the memfile lease manager used as the lease database.
+    WriteBehindLeaseMgrTest()
+        : journal_(TEST_DATA_BUILDDIR "/leases4-journal.csv"), backend_() {
+        removeJournal();
+        DatabaseConnection::ParameterMap parameters;
+        parameters["type"] = "memfile";
+        parameters["universe"] = "4";
+        parameters["persist"] = "false";
+        backend_.reset(new Memfile_LeaseMgr(parameters));
+    }
+
+    /// @brief Destructor.
+    virtual ~WriteBehindLeaseMgrTest() {
+        removeJournal();
+    }
+
+    /// @brief Removes the journal files.
+    void removeJournal() {
+        static_cast<void>(::remove(journal_.c_str()));
+        static_cast<void>(::remove((journal_ + ".2").c_str()));
+    }
+
+    /// @brief Creates the tested cache.
+    ///
+    /// @param latency Write-back latency in milliseconds.
+    void createCache(const std::string& latency = "3600000") {
+        DatabaseConnection::ParameterMap parameters;
+        parameters["type"] = "memfile";
+        parameters["universe"] = "4";
+        parameters["write-back-latency"] = latency;
+        parameters["cache-journal"] = journal_;
+        cache_.reset(new WriteBehindLeaseMgr(parameters, backend_));
+    }
+
+    /// @brief Creates a DHCPv4 lease.
+    ///
+    /// @param addr Address of the lease.
+    Lease4Ptr createLease4(const std::string& addr) const {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 0x08),
+                                    HTYPE_ETHER));
+        return (Lease4Ptr(new Lease4(IOAddress(addr), hwaddr, ClientIdPtr(),
+                                     3600, time(NULL), 1)));
+    }
+
+    /// @brief Path to the journal.
+    std::string journal_;
+
+    /// @brief Lease manager used as the lease database.
+    boost::shared_ptr<LeaseMgr> backend_;
+
+    /// @brief Tested object.
+    boost::scoped_ptr<WriteBehindLeaseMgr> cache_;
+};
+
+// Verifies that the leases are loaded from the lease database and the
+// parameters are used.
+TEST_F(WriteBehindLeaseMgrTest, load) {
+    ASSERT_TRUE(backend_->addLease(createLease4("192.0.2.1")));
+    ASSERT_TRUE(backend_->addLease(createLease4("192.0.2.2")));
+
+    ASSERT_NO_THROW(createCache("500"));
+    EXPECT_EQ(500, cache_->getWriteBackLatency());
+    EXPECT_EQ("memfile", cache_->getType());
+    EXPECT_EQ(journal_, cache_->getLeaseFilePath(Memfile_LeaseMgr::V4));
+    EXPECT_EQ(2, cache_->getLeases4().size());
+    EXPECT_TRUE(cache_->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_EQ(0, cache_->getUpdateCount());
+}
+
+// Verifies that the updates are written to the lease database when the
+// cache is flushed.
+TEST_F(WriteBehindLeaseMgrTest, flush) {
+    ASSERT_TRUE(backend_->addLease(createLease4("192.0.2.1")));
+    ASSERT_TRUE(backend_->addLease(createLease4("192.0.2.2")));
+    ASSERT_NO_THROW(createCache());
+
+    // Add, renew twice and delete leases.
+    ASSERT_TRUE(cache_->addLease(createLease4("192.0.2.3")));
+    Lease4Ptr lease = cache_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(lease);
+    lease->cltt_ += 10;
+    ASSERT_NO_THROW(cache_->updateLease4(lease));
+    lease->cltt_ += 10;
+    ASSERT_NO_THROW(cache_->updateLease4(lease));
+    ASSERT_TRUE(cache_->deleteLease(cache_->getLease4(IOAddress("192.0.2.2"))));
+
+    // The lease database is not updated yet.
+    EXPECT_EQ(3, cache_->getUpdateCount());
+    EXPECT_FALSE(backend_->getLease4(IOAddress("192.0.2.3")));
+    EXPECT_TRUE(backend_->getLease4(IOAddress("192.0.2.2")));
+
+    ASSERT_NO_THROW(cache_->flush());
+    EXPECT_EQ(0, cache_->getUpdateCount());
+    EXPECT_TRUE(backend_->getLease4(IOAddress("192.0.2.3")));
+    EXPECT_FALSE(backend_->getLease4(IOAddress("192.0.2.2")));
+    Lease4Ptr written = backend_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(written);
+    EXPECT_EQ(lease->cltt_, written->cltt_);
+
+    // The lease can be updated again.
+    lease->cltt_ += 10;
+    ASSERT_NO_THROW(cache_->updateLease4(lease));
+    ASSERT_NO_THROW(cache_->flush());
+    written = backend_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(written);
+    EXPECT_EQ(lease->cltt_, written->cltt_);
+}
+
+// Verifies that the updates are written periodically.
+TEST_F(WriteBehindLeaseMgrTest, writeBack) {
+    ASSERT_NO_THROW(createCache("10"));
+    ASSERT_TRUE(cache_->addLease(createLease4("192.0.2.1")));
+
+    // Give up after 10 seconds.
+    for (unsigned int i = 0; (cache_->getUpdateCount() > 0) && (i < 10000); ++i) {
+        usleep(1000);
+    }
+    EXPECT_EQ(0, cache_->getUpdateCount());
+    EXPECT_TRUE(backend_->getLease4(IOAddress("192.0.2.1")));
+}
+
+// Verifies that the updates are written when the cache is destroyed.
+TEST_F(WriteBehindLeaseMgrTest, destroy) {
+    ASSERT_NO_THROW(createCache());
+    ASSERT_TRUE(cache_->addLease(createLease4("192.0.2.1")));
+    cache_.reset();
+    EXPECT_TRUE(backend_->getLease4(IOAddress("192.0.2.1")));
+}
+
+// Verifies that the updates found in the journal are written to the lease
+// database when the cache is created.
+TEST_F(WriteBehindLeaseMgrTest, replay) {
+    ASSERT_TRUE(backend_->addLease(createLease4("192.0.2.1")));
+    ASSERT_TRUE(backend_->addLease(createLease4("192.0.2.2")));
+
+    // Simulate the journal of a server which crashed: the lease 1 was
+    // renewed, the lease 2 removed and the lease 3 added.
+    Lease4Ptr renewed = createLease4("192.0.2.1");
+    renewed->cltt_ += 100;
+    Lease4Ptr deleted = createLease4("192.0.2.2");
+    deleted->valid_lft_ = 0;
+    {
+        CSVLeaseFile4 journal(journal_ + ".2");
+        ASSERT_NO_THROW(journal.recreate());
+        journal.append(*renewed);
+        journal.close();
+    }
+    {
+        CSVLeaseFile4 journal(journal_);
+        ASSERT_NO_THROW(journal.recreate());
+        journal.append(*deleted);
+        journal.append(*createLease4("192.0.2.3"));
+        journal.close();
+    }
+
+    ASSERT_NO_THROW(createCache());
+    Lease4Ptr lease = backend_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(renewed->cltt_, lease->cltt_);
+    EXPECT_FALSE(backend_->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_TRUE(backend_->getLease4(IOAddress("192.0.2.3")));
+
+    // The cache holds the leases of the lease database.
+    EXPECT_EQ(2, cache_->getLeases4().size());
+    EXPECT_EQ(0, cache_->getUpdateCount());
+}
+
+} // end of anonymous namespace
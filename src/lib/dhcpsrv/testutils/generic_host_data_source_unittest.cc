@@ -1208,6 +1208,122 @@ GenericHostDataSourceTest::testGet4ByIdentifier(
     HostDataSourceUtils::compareHosts(host2, from_hds2);
 }
 
+void
+GenericHostDataSourceTest::testGetByIdentifiers4() {
+    // Make sure we have a pointer to the host data source.
+    ASSERT_TRUE(hdsptr_);
+
+    // Two hosts in the same subnet with different identifier types and
+    // a third one in another subnet.
+    HostPtr host1 = HostDataSourceUtils::initializeHost4("192.0.2.1",
+                                                         Host::IDENT_HWADDR);
+    HostPtr host2 = HostDataSourceUtils::initializeHost4("192.0.2.2",
+                                                         Host::IDENT_CLIENT_ID);
+    HostPtr host3 = HostDataSourceUtils::initializeHost4("192.0.2.3",
+                                                         Host::IDENT_CIRCUIT_ID);
+    SubnetID subnet_id = host1->getIPv4SubnetID();
+    host2->setIPv4SubnetID(subnet_id);
+    ASSERT_NE(subnet_id, host3->getIPv4SubnetID());
+
+    ASSERT_NO_THROW(hdsptr_->add(host1));
+    ASSERT_NO_THROW(hdsptr_->add(host2));
+    ASSERT_NO_THROW(hdsptr_->add(host3));
+
+    // No identifier: no host.
+    HostIdentifierList identifiers;
+    ConstHostCollection from_hds;
+    ASSERT_NO_THROW(from_hds = hdsptr_->getByIdentifiers4(subnet_id,
+                                                          identifiers));
+    EXPECT_TRUE(from_hds.empty());
+
+    // Unknown identifiers first so the identifier of the second host
+    // is in the second query.
+    for (uint8_t i = 0; i < 5; ++i) {
+        identifiers.push_back(HostIdentifier(Host::IDENT_FLEX,
+                                             std::vector<uint8_t>(6, i)));
+    }
+    identifiers.push_back(HostIdentifier(host3->getIdentifierType(),
+                                         host3->getIdentifier()));
+    identifiers.push_back(HostIdentifier(host2->getIdentifierType(),
+                                         host2->getIdentifier()));
+    identifiers.push_front(HostIdentifier(host1->getIdentifierType(),
+                                          host1->getIdentifier()));
+
+    ASSERT_NO_THROW(from_hds = hdsptr_->getByIdentifiers4(subnet_id,
+                                                          identifiers));
+
+    // The host of the other subnet is not returned.
+    ASSERT_EQ(2, from_hds.size());
+    ConstHostPtr from_hds1;
+    ConstHostPtr from_hds2;
+    for (auto const& host : from_hds) {
+        if (host->getIdentifierType() == Host::IDENT_HWADDR) {
+            from_hds1 = host;
+        } else if (host->getIdentifierType() == Host::IDENT_CLIENT_ID) {
+            from_hds2 = host;
+        }
+    }
+    ASSERT_TRUE(from_hds1);
+    ASSERT_TRUE(from_hds2);
+    HostDataSourceUtils::compareHosts(host1, from_hds1);
+    HostDataSourceUtils::compareHosts(host2, from_hds2);
+}
+
+void
+GenericHostDataSourceTest::testGetByIdentifiers6() {
+    // Make sure we have a pointer to the host data source.
+    ASSERT_TRUE(hdsptr_);
+
+    // Two hosts in the same subnet with different identifier types and
+    // a third one in another subnet.
+    HostPtr host1 = HostDataSourceUtils::initializeHost6("2001:db8::1",
+                                                         Host::IDENT_DUID,
+                                                         false);
+    HostPtr host2 = HostDataSourceUtils::initializeHost6("2001:db8::2",
+                                                         Host::IDENT_HWADDR,
+                                                         false);
+    HostPtr host3 = HostDataSourceUtils::initializeHost6("2001:db8::3",
+                                                         Host::IDENT_DUID,
+                                                         false);
+    SubnetID subnet_id = host1->getIPv6SubnetID();
+    host2->setIPv6SubnetID(subnet_id);
+    ASSERT_NE(subnet_id, host3->getIPv6SubnetID());
+
+    ASSERT_NO_THROW(hdsptr_->add(host1));
+    ASSERT_NO_THROW(hdsptr_->add(host2));
+    ASSERT_NO_THROW(hdsptr_->add(host3));
+
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifier(host1->getIdentifierType(),
+                                         host1->getIdentifier()));
+    identifiers.push_back(HostIdentifier(Host::IDENT_FLEX,
+                                         std::vector<uint8_t>(6, 1)));
+    identifiers.push_back(HostIdentifier(host2->getIdentifierType(),
+                                         host2->getIdentifier()));
+    identifiers.push_back(HostIdentifier(host3->getIdentifierType(),
+                                         host3->getIdentifier()));
+
+    ConstHostCollection from_hds;
+    ASSERT_NO_THROW(from_hds = hdsptr_->getByIdentifiers6(subnet_id,
+                                                          identifiers));
+
+    // The host of the other subnet is not returned.
+    ASSERT_EQ(2, from_hds.size());
+    ConstHostPtr from_hds1;
+    ConstHostPtr from_hds2;
+    for (auto const& host : from_hds) {
+        if (host->getIdentifierType() == Host::IDENT_DUID) {
+            from_hds1 = host;
+        } else if (host->getIdentifierType() == Host::IDENT_HWADDR) {
+            from_hds2 = host;
+        }
+    }
+    ASSERT_TRUE(from_hds1);
+    ASSERT_TRUE(from_hds2);
+    HostDataSourceUtils::compareHosts(host1, from_hds1);
+    HostDataSourceUtils::compareHosts(host2, from_hds2);
+}
+
 void
 GenericHostDataSourceTest::testHWAddrNotClientId() {
     // Make sure we have a pointer to the host data source.
@@ -272,6 +272,21 @@ public:
     /// Uses gtest macros to report failures.
     void testGet4ByIdentifier(const Host::IdentifierType& identifier_type);
 
+    /// @brief Test that the hosts of an IPv4 subnet can be retrieved by
+    /// several identifiers at once.
+    ///
+    /// The identifier list is longer than what a single query handles
+    /// so it is split into several queries.
+    ///
+    /// Uses gtest macros to report failures.
+    void testGetByIdentifiers4();
+
+    /// @brief Test that the hosts of an IPv6 subnet can be retrieved by
+    /// several identifiers at once.
+    ///
+    /// Uses gtest macros to report failures.
+    void testGetByIdentifiers6();
+
     /// @brief Test that clients with stored HW address can't be retrieved
     ///        by DUID with the same value.
     ///
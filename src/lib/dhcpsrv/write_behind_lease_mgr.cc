@@ -0,0 +1,361 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_exceptions.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/write_behind_lease_mgr.h>
+#include <exceptions/exceptions.h>
+#include <boost/lexical_cast.hpp>
+#include <chrono>
+#include <sstream>
+
+using namespace isc::db;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Fetches the DHCPv4 lease with the address of a lease.
+Lease4Ptr
+getLease(LeaseMgr& lease_mgr, const Lease4& lease) {
+    return (lease_mgr.getLease4(lease.addr_));
+}
+
+/// @brief Fetches the DHCPv6 lease with the type and address of a lease.
+Lease6Ptr
+getLease(LeaseMgr& lease_mgr, const Lease6& lease) {
+    return (lease_mgr.getLease6(lease.type_, lease.addr_));
+}
+
+/// @brief Updates a DHCPv4 lease.
+void
+updateLease(LeaseMgr& lease_mgr, const Lease4Ptr& lease) {
+    lease_mgr.updateLease4(lease);
+}
+
+/// @brief Updates a DHCPv6 lease.
+void
+updateLease(LeaseMgr& lease_mgr, const Lease6Ptr& lease) {
+    lease_mgr.updateLease6(lease);
+}
+
+/// @brief Reads the last update of each lease from a journal file.
+///
+/// @param filename Name of the journal file.
+/// @param [out] leases The updated leases.
+/// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+/// @tparam LeasePtrType @c Lease4Ptr or @c Lease6Ptr.
+template<typename LeaseFileType, typename LeasePtrType>
+void
+readJournal(const std::string& filename,
+            std::map<LeaseKey, LeasePtrType>& leases) {
+    LeaseFileType journal(filename);
+    if (!journal.exists()) {
+        return;
+    }
+    journal.open();
+    while (true) {
+        LeasePtrType lease;
+        if (!journal.next(lease)) {
+            // Most likely the row being written when the server crashed.
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_WRITE_BEHIND_JOURNAL_READ_ERROR)
+                .arg(filename)
+                .arg(journal.getReadMsg());
+            continue;
+        }
+        if (!lease) {
+            break;
+        }
+        leases[makeLeaseKey(*lease)] = lease;
+    }
+    journal.close();
+}
+
+} // end of anonymous namespace
+
+WriteBehindLeaseMgr::WriteBehindLeaseMgr(const DatabaseConnection::ParameterMap& parameters,
+                                         const boost::shared_ptr<LeaseMgr>& lease_mgr)
+    : Memfile_LeaseMgr(), lease_mgr_(lease_mgr), type_(lease_mgr->getType()),
+      name_(lease_mgr->getName()), version_(lease_mgr->getVersion()),
+      write_back_latency_(1000), journal4_(), journal6_(), expiration_(),
+      flush_mutex_(), mutex_(), cv_(), stopping_(false), writer_() {
+    bool v4 = true;
+    auto param = parameters.find("universe");
+    if ((param != parameters.end()) && (param->second != "4")) {
+        v4 = false;
+    }
+
+    param = parameters.find("write-back-latency");
+    if (param != parameters.end()) {
+        try {
+            write_back_latency_ = boost::lexical_cast<uint32_t>(param->second);
+        } catch (const boost::bad_lexical_cast&) {
+            isc_throw(BadValue, "invalid write-back-latency value: "
+                      << param->second);
+        }
+        if (write_back_latency_ == 0) {
+            isc_throw(BadValue, "write-back-latency must be greater than 0");
+        }
+    }
+
+    std::string journal;
+    param = parameters.find("cache-journal");
+    if ((param != parameters.end()) && !param->second.empty()) {
+        journal = param->second;
+    } else {
+        std::ostringstream s;
+        s << CfgMgr::instance().getDataDir() << "/kea-leases"
+          << (v4 ? "4" : "6") << "-journal.csv";
+        journal = s.str();
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_WRITE_BEHIND_DB)
+        .arg(write_back_latency_)
+        .arg(journal);
+
+    // The updates which were not written before the server stopped are
+    // written before the leases are loaded. The leases are loaded before
+    // the journal is set so they are not written back.
+    size_t count = 0;
+    if (v4) {
+        replayJournal<CSVLeaseFile4, Lease4Ptr>(journal);
+        Lease4Collection leases = lease_mgr_->getLeases4();
+        for (auto lease : leases) {
+            Memfile_LeaseMgr::addLease(lease);
+            expiration_[makeLeaseKey(*lease)] =
+                std::make_pair(lease->cltt_, lease->valid_lft_);
+        }
+        count = leases.size();
+        journal4_.reset(new LeaseJournal4(journal));
+        journal4_->recreate();
+        setLeaseFile(journal4_);
+    } else {
+        replayJournal<CSVLeaseFile6, Lease6Ptr>(journal);
+        Lease6Collection leases = lease_mgr_->getLeases6();
+        for (auto lease : leases) {
+            Memfile_LeaseMgr::addLease(lease);
+            expiration_[makeLeaseKey(*lease)] =
+                std::make_pair(lease->cltt_, lease->valid_lft_);
+        }
+        count = leases.size();
+        journal6_.reset(new LeaseJournal6(journal));
+        journal6_->recreate();
+        setLeaseFile(journal6_);
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_WRITE_BEHIND_LOADED).arg(count);
+
+    writer_ = std::thread(&WriteBehindLeaseMgr::run, this);
+}
+
+WriteBehindLeaseMgr::~WriteBehindLeaseMgr() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    try {
+        flush();
+    } catch (...) {
+        // The updates remain in the journal.
+    }
+
+    // The journal is replayed on the next start when some updates could
+    // not be written.
+    if (journal4_ && (journal4_->getUpdateCount() == 0)) {
+        journal4_->close();
+        static_cast<void>(::remove(journal4_->getFilename().c_str()));
+    }
+    if (journal6_ && (journal6_->getUpdateCount() == 0)) {
+        journal6_->close();
+        static_cast<void>(::remove(journal6_->getFilename().c_str()));
+    }
+}
+
+size_t
+WriteBehindLeaseMgr::wipeLeases4(const SubnetID& subnet_id) {
+    // The memfile lease manager doesn't record the wiped leases in its
+    // lease file, so they are deleted one by one.
+    size_t count = 0;
+    Lease4Collection leases = getLeases4(subnet_id);
+    for (auto lease : leases) {
+        if (deleteLease(lease)) {
+            ++count;
+        }
+    }
+    return (count);
+}
+
+size_t
+WriteBehindLeaseMgr::wipeLeases6(const SubnetID& subnet_id) {
+    size_t count = 0;
+    Lease6Collection leases = getLeases6(subnet_id);
+    for (auto lease : leases) {
+        if (deleteLease(lease)) {
+            ++count;
+        }
+    }
+    return (count);
+}
+
+std::string
+WriteBehindLeaseMgr::getDescription() const {
+    return (std::string("Write-behind lease cache in front of the " +
+                        type_ + " lease database."));
+}
+
+void
+WriteBehindLeaseMgr::flush() {
+    std::lock_guard<std::mutex> lock(flush_mutex_);
+    if (journal4_) {
+        flushJournal(*journal4_);
+    }
+    if (journal6_) {
+        flushJournal(*journal6_);
+    }
+}
+
+size_t
+WriteBehindLeaseMgr::getUpdateCount() const {
+    if (journal4_) {
+        return (journal4_->getUpdateCount());
+    }
+    if (journal6_) {
+        return (journal6_->getUpdateCount());
+    }
+    return (0);
+}
+
+template<typename LeaseFileType, typename LeasePtrType>
+void
+WriteBehindLeaseMgr::replayJournal(const std::string& filename) {
+    std::map<LeaseKey, LeasePtrType> leases;
+    std::string previous = appendSuffix(filename, FILE_PREVIOUS);
+    readJournal<LeaseFileType>(previous, leases);
+    readJournal<LeaseFileType>(filename, leases);
+
+    if (!leases.empty()) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_WRITE_BEHIND_REPLAY)
+            .arg(leases.size())
+            .arg(filename);
+        for (auto lease : leases) {
+            writeLease(lease.second);
+        }
+    }
+
+    static_cast<void>(::remove(previous.c_str()));
+    static_cast<void>(::remove(filename.c_str()));
+}
+
+template<typename JournalType>
+void
+WriteBehindLeaseMgr::flushJournal(JournalType& journal) {
+    typename JournalType::Updates updates = journal.takeUpdates();
+    if (updates.empty()) {
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_WRITE_BEHIND_FLUSH)
+        .arg(updates.size());
+
+    auto update = updates.begin();
+    try {
+        for (; update != updates.end(); ++update) {
+            writeLease(update->second);
+        }
+    } catch (const std::exception& ex) {
+        // Keep the updates which were not written for the next attempt.
+        updates.erase(updates.begin(), update);
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_WRITE_BEHIND_FLUSH_FAILED)
+            .arg(updates.size())
+            .arg(ex.what());
+        journal.restoreUpdates(updates);
+    }
+
+    journal.removePrevious();
+}
+
+template<typename LeasePtrType>
+void
+WriteBehindLeaseMgr::writeLease(const LeasePtrType& lease) {
+    LeaseKey key = makeLeaseKey(*lease);
+    bool deleted = (lease->valid_lft_ == 0);
+    bool written = false;
+
+    auto expiration = expiration_.find(key);
+    if (expiration != expiration_.end()) {
+        // The update and delete statements match the expiration time of
+        // the lease in the database.
+        lease->old_cltt_ = expiration->second.first;
+        lease->old_valid_lft_ = expiration->second.second;
+        if (deleted) {
+            written = lease_mgr_->deleteLease(lease);
+        } else {
+            try {
+                updateLease(*lease_mgr_, lease);
+                written = true;
+            } catch (const NoSuchLease&) {
+            }
+        }
+    } else if (!deleted) {
+        written = lease_mgr_->addLease(lease);
+    }
+
+    if (!written) {
+        // The lease in the database is not the one expected, e.g. when the
+        // journal is replayed, so it is fetched.
+        LeasePtrType existing = getLease(*lease_mgr_, *lease);
+        if (existing) {
+            lease->old_cltt_ = existing->cltt_;
+            lease->old_valid_lft_ = existing->valid_lft_;
+            if (deleted) {
+                lease_mgr_->deleteLease(lease);
+            } else {
+                updateLease(*lease_mgr_, lease);
+            }
+        } else if (!deleted) {
+            lease_mgr_->addLease(lease);
+        }
+    }
+
+    if (deleted) {
+        expiration_.erase(key);
+    } else {
+        expiration_[key] = std::make_pair(lease->cltt_, lease->valid_lft_);
+    }
+}
+
+void
+WriteBehindLeaseMgr::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        cv_.wait_for(lock, std::chrono::milliseconds(write_back_latency_));
+        if (stopping_) {
+            break;
+        }
+        lock.unlock();
+        try {
+            flush();
+        } catch (const std::exception& ex) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_WRITE_BEHIND_FLUSH_FAILED)
+                .arg(getUpdateCount())
+                .arg(ex.what());
+        }
+        lock.lock();
+    }
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -0,0 +1,334 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef WRITE_BEHIND_LEASE_MGR_H
+#define WRITE_BEHIND_LEASE_MGR_H
+
+#include <asiolink/io_address.h>
+#include <database/database_connection.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/csv_lease_file6.h>
+#include <dhcpsrv/memfile_lease_mgr.h>
+#include <boost/shared_ptr.hpp>
+#include <condition_variable>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Identifies a lease by its type and address.
+typedef std::pair<Lease::Type, asiolink::IOAddress> LeaseKey;
+
+/// @brief Returns the key of a DHCPv4 lease.
+///
+/// @param lease The lease.
+inline LeaseKey
+makeLeaseKey(const Lease4& lease) {
+    return (LeaseKey(Lease::TYPE_V4, lease.addr_));
+}
+
+/// @brief Returns the key of a DHCPv6 lease.
+///
+/// @param lease The lease.
+inline LeaseKey
+makeLeaseKey(const Lease6& lease) {
+    return (LeaseKey(lease.type_, lease.addr_));
+}
+
+/// @brief Journal of the lease updates not yet written to the lease database.
+///
+/// The memfile lease manager appends each lease update to its lease file,
+/// a removed lease being appended with a valid lifetime of 0. The
+/// @c WriteBehindLeaseMgr uses the journal as this lease file: the updates
+/// are written to the disk, so as they survive a crash, and the last update
+/// of each lease is kept until it is written to the lease database.
+///
+/// The journal is used by the threads processing the packets and by the
+/// thread writing to the lease database so it has its own mutex.
+///
+/// @tparam LeaseType @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+template<typename LeaseType, typename LeaseFileType>
+class LeaseJournal : public LeaseFileType {
+public:
+
+    /// @brief Pointer to a lease.
+    typedef boost::shared_ptr<LeaseType> LeaseTypePtr;
+
+    /// @brief Last updates of the leases.
+    typedef std::map<LeaseKey, LeaseTypePtr> Updates;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the journal file.
+    LeaseJournal(const std::string& filename)
+        : LeaseFileType(filename), updates_(), mutex_() {
+    }
+
+    /// @brief Appends the lease update to the journal.
+    ///
+    /// @param lease The updated lease.
+    virtual void append(const LeaseType& lease) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        LeaseFileType::append(lease);
+        updates_[makeLeaseKey(lease)].reset(new LeaseType(lease));
+    }
+
+    /// @brief Takes the updates to be written to the lease database.
+    ///
+    /// The journal file holding these updates becomes the previous journal
+    /// file (with the ".2" suffix) and a new journal file is created for
+    /// the next updates. The previous journal file must be removed with
+    /// @c removePrevious when the updates have been written.
+    ///
+    /// @return The last update of each lease since the previous call.
+    Updates takeUpdates() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Updates updates;
+        updates.swap(updates_);
+        if (!updates.empty()) {
+            LeaseFileType::close();
+            if (::rename(this->getFilename().c_str(), getPreviousFilename().c_str()) == 0) {
+                LeaseFileType::recreate();
+            } else {
+                // The updates remain in the current journal file.
+                LeaseFileType::open(true);
+            }
+        }
+        return (updates);
+    }
+
+    /// @brief Puts back the updates which could not be written.
+    ///
+    /// They are appended to the current journal file unless the lease has
+    /// been updated again in the meantime.
+    ///
+    /// @param updates The updates which were not written.
+    void restoreUpdates(const Updates& updates) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto update : updates) {
+            if (updates_.insert(update).second) {
+                LeaseFileType::append(*update.second);
+            }
+        }
+    }
+
+    /// @brief Removes the previous journal file.
+    void removePrevious() {
+        static_cast<void>(::remove(getPreviousFilename().c_str()));
+    }
+
+    /// @brief Returns the number of leases with updates to be written.
+    size_t getUpdateCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return (updates_.size());
+    }
+
+    /// @brief Returns the name of the previous journal file.
+    std::string getPreviousFilename() const {
+        return (Memfile_LeaseMgr::appendSuffix(this->getFilename(),
+                                               Memfile_LeaseMgr::FILE_PREVIOUS));
+    }
+
+private:
+
+    /// @brief Last updates of the leases.
+    Updates updates_;
+
+    /// @brief Mutex protecting the journal.
+    mutable std::mutex mutex_;
+};
+
+/// @brief Journal of the DHCPv4 lease updates.
+typedef LeaseJournal<Lease4, CSVLeaseFile4> LeaseJournal4;
+
+/// @brief Journal of the DHCPv6 lease updates.
+typedef LeaseJournal<Lease6, CSVLeaseFile6> LeaseJournal6;
+
+/// @brief Write-behind lease cache in front of an SQL lease database.
+///
+/// All leases of the lease database are loaded in memory, using the
+/// storage of the memfile lease manager, and all queries are served from
+/// memory. The lease updates are written to a local journal and the last
+/// update of each lease is written to the lease database by a dedicated
+/// thread, after the configured write-back latency. A lease renewed several
+/// times during the latency is written once.
+///
+/// The journal holds the updates until they are written so they are not
+/// lost when the server crashes or the lease database is unavailable: the
+/// updates found in the journal are written to the lease database when the
+/// cache is created, before the leases are loaded.
+///
+/// The cache assumes that the server is the only one updating the leases
+/// in the lease database, e.g. it must not be used by servers sharing a
+/// lease database.
+class WriteBehindLeaseMgr : public Memfile_LeaseMgr {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Writes the updates found in the journal to the lease database, loads
+    /// the leases and starts the thread writing to the lease database.
+    ///
+    /// The following parameters are used:
+    /// - universe: "4" or "6".
+    /// - write-back-latency: the interval in milliseconds between the
+    ///   writes to the lease database. The default is 1000.
+    /// - cache-journal: the path to the journal. The default is the
+    ///   kea-leases4-journal.csv or kea-leases6-journal.csv file in the
+    ///   data directory.
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    /// @param lease_mgr The lease manager of the lease database.
+    WriteBehindLeaseMgr(const db::DatabaseConnection::ParameterMap& parameters,
+                        const boost::shared_ptr<LeaseMgr>& lease_mgr);
+
+    /// @brief Destructor.
+    ///
+    /// Stops the thread and writes the last updates to the lease database.
+    /// The journal is removed when all updates have been written.
+    virtual ~WriteBehindLeaseMgr();
+
+    /// @brief Removes specified IPv4 leases.
+    ///
+    /// @param subnet_id identifier of the subnet
+    ///
+    /// @return number of leases removed.
+    virtual size_t wipeLeases4(const SubnetID& subnet_id);
+
+    /// @brief Removed specified IPv6 leases.
+    ///
+    /// @param subnet_id identifier of the subnet
+    ///
+    /// @return number of leases removed.
+    virtual size_t wipeLeases6(const SubnetID& subnet_id);
+
+    /// @brief Return backend type
+    ///
+    /// @return Type of the lease database.
+    virtual std::string getType() const {
+        return (type_);
+    }
+
+    /// @brief Returns backend name.
+    ///
+    /// @return Name of the lease database.
+    virtual std::string getName() const {
+        return (name_);
+    }
+
+    /// @brief Returns description of the backend.
+    virtual std::string getDescription() const;
+
+    /// @brief Returns backend version.
+    ///
+    /// @return Version of the lease database schema.
+    virtual std::pair<uint32_t, uint32_t> getVersion() const {
+        return (version_);
+    }
+
+    /// @brief Writes the pending lease updates to the lease database.
+    ///
+    /// This is done periodically by the thread writing to the lease
+    /// database. The updates which could not be written are kept for the
+    /// next attempt.
+    void flush();
+
+    /// @brief Returns the number of leases with updates to be written.
+    size_t getUpdateCount() const;
+
+    /// @brief Returns the write-back latency in milliseconds.
+    uint32_t getWriteBackLatency() const {
+        return (write_back_latency_);
+    }
+
+private:
+
+    /// @brief Writes the updates found in a journal to the lease database.
+    ///
+    /// The previous journal file is read before the journal file. Both
+    /// are removed when the updates have been written.
+    ///
+    /// @param filename Name of the journal file.
+    /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam LeasePtrType @c Lease4Ptr or @c Lease6Ptr.
+    template<typename LeaseFileType, typename LeasePtrType>
+    void replayJournal(const std::string& filename);
+
+    /// @brief Writes the updates taken from a journal to the lease database.
+    ///
+    /// @param journal The journal.
+    /// @tparam JournalType @c LeaseJournal4 or @c LeaseJournal6.
+    template<typename JournalType>
+    void flushJournal(JournalType& journal);
+
+    /// @brief Writes a lease update to the lease database.
+    ///
+    /// The lease is removed when its valid lifetime is 0. Otherwise it is
+    /// added or updated. The expiration time of the lease in the lease
+    /// database is remembered so as the lease can be updated or removed
+    /// without fetching it first.
+    ///
+    /// @param lease The updated lease.
+    /// @tparam LeasePtrType @c Lease4Ptr or @c Lease6Ptr.
+    template<typename LeasePtrType>
+    void writeLease(const LeasePtrType& lease);
+
+    /// @brief Body of the thread writing to the lease database.
+    void run();
+
+    /// @brief The lease manager of the lease database.
+    boost::shared_ptr<LeaseMgr> lease_mgr_;
+
+    /// @brief Type of the lease database.
+    std::string type_;
+
+    /// @brief Name of the lease database.
+    std::string name_;
+
+    /// @brief Version of the lease database schema.
+    std::pair<uint32_t, uint32_t> version_;
+
+    /// @brief Interval in milliseconds between the writes.
+    uint32_t write_back_latency_;
+
+    /// @brief Journal of the DHCPv4 lease updates.
+    boost::shared_ptr<LeaseJournal4> journal4_;
+
+    /// @brief Journal of the DHCPv6 lease updates.
+    boost::shared_ptr<LeaseJournal6> journal6_;
+
+    /// @brief Cltt and valid lifetime of the leases in the lease database.
+    ///
+    /// It is used by the thread writing to the lease database only.
+    std::map<LeaseKey, std::pair<time_t, uint32_t> > expiration_;
+
+    /// @brief Mutex serializing the writes to the lease database.
+    std::mutex flush_mutex_;
+
+    /// @brief Mutex protecting the stop flag.
+    std::mutex mutex_;
+
+    /// @brief Condition variable used to stop the thread.
+    std::condition_variable cv_;
+
+    /// @brief Indicates that the thread should stop.
+    bool stopping_;
+
+    /// @brief Thread writing to the lease database.
+    std::thread writer_;
+};
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // WRITE_BEHIND_LEASE_MGR_H
@@ -0,0 +1,671 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <eval/compiled_expression.h>
+#include <eval/eval_log.h>
+#include <eval/evaluate.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <boost/lexical_cast.hpp>
+#include <cstring>
+#include <list>
+#include <typeinfo>
+
+using namespace isc::asiolink;
+using namespace std;
+
+namespace {
+
+/// @brief Textual representation of true.
+const char TRUE_STR[] = "true";
+
+/// @brief Textual representation of false.
+const char FALSE_STR[] = "false";
+
+/// @brief Empty bytes.
+const char EMPTY_STR[] = "";
+
+/// @brief Hexadecimal digits used by hexstring.
+const char HEX_DIGITS[] = "0123456789abcdef";
+
+}
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Registers and the scratch buffer used during the evaluation.
+///
+/// An instance of this structure is created on the stack for each
+/// evaluation.
+struct CompiledExpression::Machine {
+
+    /// @brief Typed register.
+    struct Register {
+        /// @brief Register type.
+        enum Type {
+            BOOL,     ///< boolean (stands for "true" or "false")
+            INTEGER,  ///< 32 bit integer (stands for 4 octets)
+            BYTES     ///< span of bytes
+        };
+
+        /// @brief Type of the value held in the register.
+        Type type_;
+
+        /// @brief Boolean value.
+        bool bool_;
+
+        /// @brief Integer value.
+        uint32_t integer_;
+
+        /// @brief Pointer to the bytes.
+        const char* data_;
+
+        /// @brief Number of bytes.
+        size_t size_;
+    };
+
+    /// @brief Constructor.
+    Machine() : scratch_used_(0) {
+    }
+
+    /// @brief Allocates bytes in the scratch buffer.
+    ///
+    /// When the scratch buffer is full the bytes are allocated on the heap
+    /// and released when the machine is destroyed.
+    ///
+    /// @param size Number of bytes.
+    /// @return Pointer to the allocated bytes.
+    char* allocate(size_t size) {
+        if (size <= SCRATCH_SIZE - scratch_used_) {
+            char* data = scratch_ + scratch_used_;
+            scratch_used_ += size;
+            return (data);
+        }
+        overflow_.push_back(string(size, '\0'));
+        return (&overflow_.back()[0]);
+    }
+
+    /// @brief Stores a boolean.
+    void setBool(size_t reg, bool value) {
+        regs_[reg].type_ = Register::BOOL;
+        regs_[reg].bool_ = value;
+    }
+
+    /// @brief Stores an integer.
+    void setInteger(size_t reg, uint32_t value) {
+        regs_[reg].type_ = Register::INTEGER;
+        regs_[reg].integer_ = value;
+    }
+
+    /// @brief Stores a span of bytes which remains valid during the
+    /// evaluation.
+    void setBytes(size_t reg, const char* data, size_t size) {
+        regs_[reg].type_ = Register::BYTES;
+        regs_[reg].data_ = (size > 0 ? data : EMPTY_STR);
+        regs_[reg].size_ = size;
+    }
+
+    /// @brief Stores a copy of bytes.
+    void copyBytes(size_t reg, const void* data, size_t size) {
+        char* copy = allocate(size);
+        if (size > 0) {
+            memcpy(copy, data, size);
+        }
+        setBytes(reg, copy, size);
+    }
+
+    /// @brief Stores a copy of a string.
+    void copyString(size_t reg, const string& value) {
+        copyBytes(reg, value.data(), value.size());
+    }
+
+    /// @brief Converts the value held in the register to bytes.
+    void toBytes(size_t reg) {
+        Register& r = regs_[reg];
+        switch (r.type_) {
+        case Register::BOOL:
+            if (r.bool_) {
+                setBytes(reg, TRUE_STR, sizeof(TRUE_STR) - 1);
+            } else {
+                setBytes(reg, FALSE_STR, sizeof(FALSE_STR) - 1);
+            }
+            break;
+        case Register::INTEGER: {
+            char* data = allocate(sizeof(uint32_t));
+            data[0] = (r.integer_ >> 24) & 0xff;
+            data[1] = (r.integer_ >> 16) & 0xff;
+            data[2] = (r.integer_ >> 8) & 0xff;
+            data[3] = r.integer_ & 0xff;
+            setBytes(reg, data, sizeof(uint32_t));
+            break;
+        }
+        case Register::BYTES:
+            break;
+        }
+    }
+
+    /// @brief Returns the value held in the register as a string.
+    string toString(size_t reg) {
+        toBytes(reg);
+        return (string(regs_[reg].data_, regs_[reg].size_));
+    }
+
+    /// @brief Returns the value held in the register as a boolean.
+    ///
+    /// @throw EvalTypeError when the value is not "true" or "false".
+    bool toBool(size_t reg) {
+        if (regs_[reg].type_ == Register::BOOL) {
+            return (regs_[reg].bool_);
+        }
+        toBytes(reg);
+        const Register& r = regs_[reg];
+        if ((r.size_ == sizeof(TRUE_STR) - 1) &&
+            (memcmp(r.data_, TRUE_STR, r.size_) == 0)) {
+            return (true);
+        } else if ((r.size_ == sizeof(FALSE_STR) - 1) &&
+                   (memcmp(r.data_, FALSE_STR, r.size_) == 0)) {
+            return (false);
+        }
+        // Let the interpreter throw the exception.
+        return (Token::toBool(string(r.data_, r.size_)));
+    }
+
+    /// @brief Checks if the values held in two registers are equal.
+    bool equal(size_t reg1, size_t reg2) {
+        const Register& r1 = regs_[reg1];
+        const Register& r2 = regs_[reg2];
+        if (r1.type_ == r2.type_) {
+            if (r1.type_ == Register::BOOL) {
+                return (r1.bool_ == r2.bool_);
+            } else if (r1.type_ == Register::INTEGER) {
+                return (r1.integer_ == r2.integer_);
+            }
+        }
+        toBytes(reg1);
+        toBytes(reg2);
+        return ((r1.size_ == r2.size_) &&
+                (memcmp(r1.data_, r2.data_, r1.size_) == 0));
+    }
+
+    /// @brief Converts the value held in the register to an int the
+    /// same way boost::lexical_cast does.
+    ///
+    /// @param reg Register.
+    /// @param what Name of the parameter used in the error message.
+    /// @throw EvalTypeError when the conversion fails.
+    int toInt(size_t reg, const char* what) {
+        toBytes(reg);
+        const Register& r = regs_[reg];
+        try {
+            return (boost::lexical_cast<int>(r.data_, r.size_));
+        } catch (const boost::bad_lexical_cast&) {
+            isc_throw(EvalTypeError, "the parameter '" << string(r.data_, r.size_)
+                      << "' for the " << what << " of the substring "
+                      << "couldn't be converted to an integer.");
+        }
+    }
+
+    /// @brief Registers.
+    Register regs_[MAX_REGISTERS];
+
+    /// @brief Scratch buffer for the intermediate values.
+    char scratch_[SCRATCH_SIZE];
+
+    /// @brief Number of bytes used in the scratch buffer.
+    size_t scratch_used_;
+
+    /// @brief Intermediate values which didn't fit in the scratch buffer.
+    list<string> overflow_;
+};
+
+const size_t CompiledExpression::MAX_REGISTERS;
+const size_t CompiledExpression::SCRATCH_SIZE;
+
+CompiledExpression::CompiledExpression(const ExpressionPtr& source)
+    : source_(source), code_(), constants_() {
+}
+
+CompiledExpressionPtr
+CompiledExpression::compile(const ExpressionPtr& expr) {
+    if (!expr) {
+        return (CompiledExpressionPtr());
+    }
+    CompiledExpressionPtr compiled(new CompiledExpression(expr));
+    if (!compiled->compileSource()) {
+        return (CompiledExpressionPtr());
+    }
+    return (compiled);
+}
+
+void
+CompiledExpression::emit(OpCode op, size_t reg, uint32_t arg, uint32_t mod,
+                         const TokenPtr& token) {
+    Instruction insn;
+    insn.op_ = op;
+    insn.reg_ = static_cast<uint8_t>(reg);
+    insn.arg_ = arg;
+    insn.mod_ = mod;
+    insn.token_ = token;
+    code_.push_back(insn);
+}
+
+uint32_t
+CompiledExpression::addConstant(const string& value) {
+    constants_.push_back(value);
+    return (static_cast<uint32_t>(constants_.size() - 1));
+}
+
+bool
+CompiledExpression::compileSource() {
+    // Current depth of the stack which is also the index of the first
+    // free register.
+    size_t depth = 0;
+    for (auto it = source_->cbegin(); it != source_->cend(); ++it) {
+        if (!*it) {
+            return (false);
+        }
+        Token& token = **it;
+        const type_info& type = typeid(token);
+
+        // Number of values popped from the stack.
+        size_t arity = 0;
+        OpCode op = OP_TOKEN;
+        uint32_t arg = 0;
+        uint32_t mod = 0;
+
+        if (type == typeid(TokenString)) {
+            op = OP_CONST;
+            arg = addConstant(static_cast<TokenString&>(token).getValue());
+
+        } else if (type == typeid(TokenInteger)) {
+            op = OP_INTEGER;
+            arg = static_cast<TokenInteger&>(token).getInteger();
+
+        } else if (type == typeid(TokenHexString)) {
+            op = OP_CONST;
+            arg = addConstant(static_cast<TokenHexString&>(token).getValue());
+
+        } else if (type == typeid(TokenIpAddress)) {
+            op = OP_CONST;
+            arg = addConstant(static_cast<TokenIpAddress&>(token).getValue());
+
+        } else if (type == typeid(TokenOption)) {
+            op = OP_OPTION;
+            arg = static_cast<TokenOption&>(token).getCode();
+            mod = static_cast<TokenOption&>(token).getRepresentation();
+
+        } else if (type == typeid(TokenRelay4Option)) {
+            op = OP_RELAY4_OPTION;
+            arg = static_cast<TokenRelay4Option&>(token).getCode();
+            mod = static_cast<TokenRelay4Option&>(token).getRepresentation();
+
+        } else if (type == typeid(TokenPkt)) {
+            op = OP_PKT;
+            arg = static_cast<TokenPkt&>(token).getType();
+
+        } else if (type == typeid(TokenPkt4)) {
+            op = OP_PKT4;
+            arg = static_cast<TokenPkt4&>(token).getType();
+
+        } else if (type == typeid(TokenPkt6)) {
+            op = OP_PKT6;
+            arg = static_cast<TokenPkt6&>(token).getType();
+
+        } else if (type == typeid(TokenMember)) {
+            // Classes referenced by expressions are configured classes:
+            // intern them so the membership test is a bit test.
+            op = OP_MEMBER;
+            arg = ClientClassIndex::intern(
+                static_cast<TokenMember&>(token).getClientClass());
+
+        } else if ((type == typeid(TokenRelay6Option)) ||
+                   (type == typeid(TokenRelay6Field)) ||
+                   (type == typeid(TokenVendor)) ||
+                   (type == typeid(TokenVendorClass)) ||
+                   (type == typeid(TokenSubOption))) {
+            // These leaves are rarely used, so they are simply evaluated
+            // by the interpreter.
+            op = OP_TOKEN;
+
+        } else if (type == typeid(TokenEqual)) {
+            op = OP_EQUAL;
+            arity = 2;
+
+        } else if (type == typeid(TokenSubstring)) {
+            op = OP_SUBSTRING;
+            arity = 3;
+
+        } else if (type == typeid(TokenConcat)) {
+            op = OP_CONCAT;
+            arity = 2;
+
+        } else if (type == typeid(TokenIfElse)) {
+            op = OP_IFELSE;
+            arity = 3;
+
+        } else if (type == typeid(TokenToHexString)) {
+            op = OP_TOHEXSTRING;
+            arity = 2;
+
+        } else if (type == typeid(TokenNot)) {
+            op = OP_NOT;
+            arity = 1;
+
+        } else if (type == typeid(TokenAnd)) {
+            op = OP_AND;
+            arity = 2;
+
+        } else if (type == typeid(TokenOr)) {
+            op = OP_OR;
+            arity = 2;
+
+        } else {
+            // Unknown token.
+            return (false);
+        }
+
+        // The interpreter reports the bad stack errors.
+        if (depth < arity) {
+            return (false);
+        }
+        size_t reg = depth - arity;
+        depth = reg + 1;
+        if (depth > MAX_REGISTERS) {
+            return (false);
+        }
+
+        emit(op, reg, arg, mod, (op == OP_TOKEN ? *it : TokenPtr()));
+    }
+
+    return (depth == 1);
+}
+
+void
+CompiledExpression::run(Pkt& pkt, Machine& machine) const {
+    for (auto insn = code_.cbegin(); insn != code_.cend(); ++insn) {
+        const size_t reg = insn->reg_;
+        switch (insn->op_) {
+        case OP_CONST: {
+            const string& value = constants_[insn->arg_];
+            machine.setBytes(reg, value.data(), value.size());
+            break;
+        }
+
+        case OP_INTEGER:
+            machine.setInteger(reg, insn->arg_);
+            break;
+
+        case OP_OPTION:
+        case OP_RELAY4_OPTION: {
+            OptionPtr opt;
+            if (insn->op_ == OP_OPTION) {
+                opt = pkt.getOption(insn->arg_);
+            } else {
+                OptionPtr rai = pkt.getOption(DHO_DHCP_AGENT_OPTIONS);
+                if (rai) {
+                    opt = rai->getOption(insn->arg_);
+                }
+            }
+            if (insn->mod_ == TokenOption::EXISTS) {
+                machine.setBool(reg, static_cast<bool>(opt));
+            } else if (!opt) {
+                machine.setBytes(reg, EMPTY_STR, 0);
+            } else if (insn->mod_ == TokenOption::HEXADECIMAL) {
+                vector<uint8_t> binary = opt->toBinary();
+                machine.copyBytes(reg, binary.empty() ? 0 : &binary[0],
+                                  binary.size());
+            } else {
+                machine.copyString(reg, opt->toString());
+            }
+            break;
+        }
+
+        case OP_PKT:
+            switch (insn->arg_) {
+            case TokenPkt::IFACE:
+                machine.copyString(reg, pkt.getIface());
+                break;
+            case TokenPkt::SRC:
+            case TokenPkt::DST: {
+                const IOAddress& addr = (insn->arg_ == TokenPkt::SRC ?
+                                         pkt.getRemoteAddr() :
+                                         pkt.getLocalAddr());
+                if (addr.isV4()) {
+                    machine.setInteger(reg, addr.toUint32());
+                } else {
+                    vector<uint8_t> binary = addr.toBytes();
+                    machine.copyBytes(reg, &binary[0], binary.size());
+                }
+                break;
+            }
+            case TokenPkt::LEN:
+                machine.setInteger(reg, static_cast<uint32_t>(pkt.len()));
+                break;
+            default:
+                isc_throw(EvalTypeError, "Bad meta data specified: "
+                          << insn->arg_);
+            }
+            break;
+
+        case OP_PKT4: {
+            const Pkt4* pkt4 = dynamic_cast<const Pkt4*>(&pkt);
+            if (!pkt4) {
+                isc_throw(EvalTypeError, "Specified packet is not a Pkt4");
+            }
+            switch (insn->arg_) {
+            case TokenPkt4::CHADDR: {
+                HWAddrPtr hwaddr = pkt4->getHWAddr();
+                if (!hwaddr) {
+                    isc_throw(EvalTypeError,
+                              "Packet does not have hardware address");
+                }
+                machine.copyBytes(reg, hwaddr->hwaddr_.empty() ? 0 :
+                                  &hwaddr->hwaddr_[0], hwaddr->hwaddr_.size());
+                break;
+            }
+            case TokenPkt4::GIADDR:
+                machine.setInteger(reg, pkt4->getGiaddr().toUint32());
+                break;
+            case TokenPkt4::CIADDR:
+                machine.setInteger(reg, pkt4->getCiaddr().toUint32());
+                break;
+            case TokenPkt4::YIADDR:
+                machine.setInteger(reg, pkt4->getYiaddr().toUint32());
+                break;
+            case TokenPkt4::SIADDR:
+                machine.setInteger(reg, pkt4->getSiaddr().toUint32());
+                break;
+            case TokenPkt4::HLEN:
+                machine.setInteger(reg, pkt4->getHlen());
+                break;
+            case TokenPkt4::HTYPE:
+                machine.setInteger(reg, pkt4->getHtype());
+                break;
+            case TokenPkt4::MSGTYPE:
+                machine.setInteger(reg, pkt4->getType());
+                break;
+            case TokenPkt4::TRANSID:
+                machine.setInteger(reg, pkt4->getTransid());
+                break;
+            default:
+                isc_throw(EvalTypeError, "Bad field specified: "
+                          << insn->arg_);
+            }
+            break;
+        }
+
+        case OP_PKT6: {
+            const Pkt6* pkt6 = dynamic_cast<const Pkt6*>(&pkt);
+            if (!pkt6) {
+                isc_throw(EvalTypeError, "Specified packet is not Pkt6");
+            }
+            switch (insn->arg_) {
+            case TokenPkt6::MSGTYPE:
+                machine.setInteger(reg, pkt6->getType());
+                break;
+            case TokenPkt6::TRANSID:
+                machine.setInteger(reg, pkt6->getTransid());
+                break;
+            default:
+                isc_throw(EvalTypeError, "Bad field specified: "
+                          << insn->arg_);
+            }
+            break;
+        }
+
+        case OP_MEMBER:
+            machine.setBool(reg, pkt.inClass(insn->arg_));
+            break;
+
+        case OP_EQUAL:
+            machine.setBool(reg, machine.equal(reg, reg + 1));
+            break;
+
+        case OP_SUBSTRING: {
+            machine.toBytes(reg);
+            Machine::Register& str = machine.regs_[reg];
+            // If we have no string to start with the result is empty.
+            if (str.size_ == 0) {
+                break;
+            }
+            int start_pos = machine.toInt(reg + 1, "starting position");
+            const int string_length = static_cast<int>(str.size_);
+            int length = string_length;
+            machine.toBytes(reg + 2);
+            const Machine::Register& len = machine.regs_[reg + 2];
+            if ((len.size_ != 3) || (memcmp(len.data_, "all", 3) != 0)) {
+                length = machine.toInt(reg + 2, "length");
+            }
+            // If the starting position is outside of the string the
+            // result is empty.
+            if ((start_pos < -string_length) || (start_pos >= string_length)) {
+                machine.setBytes(reg, EMPTY_STR, 0);
+                break;
+            }
+            if (start_pos < 0) {
+                start_pos = string_length + start_pos;
+            }
+            if (length < 0) {
+                length = -length;
+                if (length <= start_pos) {
+                    start_pos -= length;
+                } else {
+                    length = start_pos;
+                    start_pos = 0;
+                }
+            }
+            if (length > string_length - start_pos) {
+                length = string_length - start_pos;
+            }
+            // The substring is a span within the original value.
+            machine.setBytes(reg, str.data_ + start_pos, length);
+            break;
+        }
+
+        case OP_CONCAT: {
+            machine.toBytes(reg);
+            machine.toBytes(reg + 1);
+            const Machine::Register& op1 = machine.regs_[reg];
+            const Machine::Register& op2 = machine.regs_[reg + 1];
+            char* data = machine.allocate(op1.size_ + op2.size_);
+            memcpy(data, op1.data_, op1.size_);
+            memcpy(data + op1.size_, op2.data_, op2.size_);
+            machine.setBytes(reg, data, op1.size_ + op2.size_);
+            break;
+        }
+
+        case OP_IFELSE:
+            if (machine.toBool(reg)) {
+                machine.regs_[reg] = machine.regs_[reg + 1];
+            } else {
+                machine.regs_[reg] = machine.regs_[reg + 2];
+            }
+            break;
+
+        case OP_TOHEXSTRING: {
+            machine.toBytes(reg);
+            machine.toBytes(reg + 1);
+            const Machine::Register& binary = machine.regs_[reg];
+            const Machine::Register& separator = machine.regs_[reg + 1];
+            size_t size = 0;
+            if (binary.size_ > 0) {
+                size = 2 * binary.size_ + (binary.size_ - 1) * separator.size_;
+            }
+            char* data = machine.allocate(size);
+            char* out = data;
+            for (size_t i = 0; i < binary.size_; ++i) {
+                if (i > 0) {
+                    memcpy(out, separator.data_, separator.size_);
+                    out += separator.size_;
+                }
+                uint8_t byte = static_cast<uint8_t>(binary.data_[i]);
+                *out++ = HEX_DIGITS[byte >> 4];
+                *out++ = HEX_DIGITS[byte & 0xf];
+            }
+            machine.setBytes(reg, data, size);
+            break;
+        }
+
+        case OP_NOT:
+            machine.setBool(reg, !machine.toBool(reg));
+            break;
+
+        case OP_AND: {
+            // Same order of the conversions as in the interpreter.
+            bool val1 = machine.toBool(reg + 1);
+            bool val2 = machine.toBool(reg);
+            machine.setBool(reg, val1 && val2);
+            break;
+        }
+
+        case OP_OR: {
+            bool val1 = machine.toBool(reg + 1);
+            bool val2 = machine.toBool(reg);
+            machine.setBool(reg, val1 || val2);
+            break;
+        }
+
+        case OP_TOKEN: {
+            ValueStack values;
+            insn->token_->evaluate(pkt, values);
+            if (values.size() != 1) {
+                isc_throw(EvalBadStack, "Incorrect stack order. Expected exactly "
+                          "1 value after evaluation of a token, got "
+                          << values.size());
+            }
+            machine.copyString(reg, values.top());
+            break;
+        }
+        }
+    }
+}
+
+bool
+CompiledExpression::evaluateBool(Pkt& pkt) const {
+    // Use the interpreter when the per token debug messages are wanted.
+    if (eval_logger.isDebugEnabled(EVAL_DBG_STACK)) {
+        return (isc::dhcp::evaluateBool(*source_, pkt));
+    }
+    Machine machine;
+    run(pkt, machine);
+    return (machine.toBool(0));
+}
+
+string
+CompiledExpression::evaluateString(Pkt& pkt) const {
+    if (eval_logger.isDebugEnabled(EVAL_DBG_STACK)) {
+        return (isc::dhcp::evaluateString(*source_, pkt));
+    }
+    Machine machine;
+    run(pkt, machine);
+    return (machine.toString(0));
+}
+
+}; // end of isc::dhcp namespace
+}; // end of isc namespace
@@ -0,0 +1,194 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef COMPILED_EXPRESSION_H
+#define COMPILED_EXPRESSION_H
+
+#include <eval/token.h>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+class CompiledExpression;
+
+/// @brief Pointer to the compiled expression.
+typedef boost::shared_ptr<CompiledExpression> CompiledExpressionPtr;
+
+/// @brief Classification expression compiled to a flat bytecode.
+///
+/// The @c Expression is a list of tokens in the Reverse Polish Notation
+/// which is interpreted by calling @c Token::evaluate for each token. The
+/// intermediate values are held on a stack of strings, so every token
+/// allocates at least one string, including the constants and the boolean
+/// results of the operators.
+///
+/// This class translates such list once, at configuration time, into
+/// a sequence of instructions operating on a small register file. Since
+/// the stack depth at each token is known at compile time, the register
+/// used for each intermediate value is fixed in the instruction. The
+/// registers are typed: a register holds either a boolean, a 32 bit
+/// integer (a 4 octets value in the network byte order) or a span of
+/// bytes. The spans point into the constant pool of the compiled
+/// expression, directly into the packet (e.g. the hardware address),
+/// or into a scratch buffer living on the stack of the caller, so the
+/// common expressions are evaluated without any heap allocation.
+///
+/// The tokens for which there is no native instruction (e.g. the vendor
+/// or the DHCPv6 relay options) are evaluated by calling their
+/// @c Token::evaluate method and copying the result into the scratch
+/// buffer. This guarantees that the compiled expression gives exactly
+/// the same results and throws the same exceptions as the interpreter.
+///
+/// When the stack debug logging of the eval library is enabled the
+/// interpreter is used instead, so the per token debug messages are
+/// still logged.
+class CompiledExpression {
+public:
+
+    /// @brief Maximum number of registers, i.e. maximum stack depth of
+    /// an expression which can be compiled.
+    static const size_t MAX_REGISTERS = 32;
+
+    /// @brief Size of the scratch buffer used for the intermediate values.
+    static const size_t SCRATCH_SIZE = 512;
+
+    /// @brief Instruction operation codes.
+    enum OpCode {
+        OP_CONST,          ///< load bytes from the constant pool
+        OP_INTEGER,        ///< load an integer constant
+        OP_OPTION,         ///< option[code] (top level option)
+        OP_RELAY4_OPTION,  ///< relay4[code] (sub-option of the RAI)
+        OP_PKT,            ///< pkt.iface, pkt.src, pkt.dst, pkt.len
+        OP_PKT4,           ///< pkt4 fields
+        OP_PKT6,           ///< pkt6 fields
+        OP_MEMBER,         ///< member('class') (interned class)
+        OP_EQUAL,          ///< ==
+        OP_SUBSTRING,      ///< substring(string, start, length)
+        OP_CONCAT,         ///< concat(string, string)
+        OP_IFELSE,         ///< ifelse(cond, iftrue, iffalse)
+        OP_TOHEXSTRING,    ///< hexstring(binary, separator)
+        OP_NOT,            ///< not
+        OP_AND,            ///< and
+        OP_OR,             ///< or
+        OP_TOKEN           ///< fall back to Token::evaluate
+    };
+
+    /// @brief Single instruction.
+    ///
+    /// The operands of an instruction with N operands are held in the
+    /// N consecutive registers starting at @c reg_ and the result is
+    /// stored in @c reg_.
+    struct Instruction {
+        /// @brief Operation code.
+        OpCode op_;
+
+        /// @brief First operand and the destination register.
+        uint8_t reg_;
+
+        /// @brief Instruction specific argument, e.g. the index in the
+        /// constant pool, the option code or the field type.
+        uint32_t arg_;
+
+        /// @brief Instruction specific modifier, e.g. the option
+        /// representation type.
+        uint32_t mod_;
+
+        /// @brief Token evaluated by the @c OP_TOKEN instruction.
+        TokenPtr token_;
+    };
+
+    /// @brief Compiles an expression.
+    ///
+    /// @param expr Expression to be compiled.
+    /// @return Pointer to the compiled expression or null pointer if the
+    /// expression can't be compiled, e.g. it contains an unsupported token,
+    /// it is too deep or it doesn't leave exactly one value on the stack.
+    /// The caller should then use the interpreter which will report the
+    /// error during the evaluation.
+    static CompiledExpressionPtr compile(const ExpressionPtr& expr);
+
+    /// @brief Evaluates the compiled expression to a boolean.
+    ///
+    /// @param pkt Packet being classified.
+    /// @return Result of the evaluation.
+    /// @throw EvalTypeError when the result is not a boolean or when
+    /// an operand of an instruction has an unexpected type.
+    bool evaluateBool(Pkt& pkt) const;
+
+    /// @brief Evaluates the compiled expression to a string.
+    ///
+    /// @param pkt Packet being classified.
+    /// @return Result of the evaluation.
+    std::string evaluateString(Pkt& pkt) const;
+
+    /// @brief Returns the expression this object was compiled from.
+    const ExpressionPtr& getSource() const {
+        return (source_);
+    }
+
+    /// @brief Returns the compiled instructions.
+    ///
+    /// This method is used in testing.
+    const std::vector<Instruction>& getInstructions() const {
+        return (code_);
+    }
+
+private:
+
+    /// @brief Constructor.
+    ///
+    /// @param source Expression being compiled.
+    CompiledExpression(const ExpressionPtr& source);
+
+    /// @brief Compiles the source expression.
+    ///
+    /// @return true on success, false if the expression can't be compiled.
+    bool compileSource();
+
+    /// @brief Appends an instruction.
+    ///
+    /// @param op Operation code.
+    /// @param reg First operand and destination register.
+    /// @param arg Instruction argument.
+    /// @param mod Instruction modifier.
+    /// @param token Token to be evaluated by @c OP_TOKEN.
+    void emit(OpCode op, size_t reg, uint32_t arg = 0, uint32_t mod = 0,
+              const TokenPtr& token = TokenPtr());
+
+    /// @brief Adds a constant to the constant pool.
+    ///
+    /// @param value Constant value.
+    /// @return Index of the constant in the pool.
+    uint32_t addConstant(const std::string& value);
+
+    /// @brief Forward declaration of the evaluation state.
+    struct Machine;
+
+    /// @brief Runs the instructions.
+    ///
+    /// @param pkt Packet being classified.
+    /// @param machine Registers and the scratch buffer.
+    void run(Pkt& pkt, Machine& machine) const;
+
+    /// @brief Expression this object was compiled from.
+    ExpressionPtr source_;
+
+    /// @brief Compiled instructions.
+    std::vector<Instruction> code_;
+
+    /// @brief Constant pool.
+    std::vector<std::string> constants_;
+};
+
+}; // end of isc::dhcp namespace
+}; // end of isc namespace
+
+#endif
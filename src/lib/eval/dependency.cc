@@ -7,7 +7,90 @@
 #include <config.h>
 
 #include <eval/dependency.h>
+#include <dhcp/dhcp4.h>
 #include <boost/pointer_cast.hpp>
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <typeinfo>
+
+using namespace std;
+
+namespace {
+
+using namespace isc::dhcp;
+
+/// @brief Returns the number of values an operator token pops.
+///
+/// @param token The token.
+/// @return The arity of the operator, 0 for other tokens.
+size_t getArity(const Token& token) {
+    const type_info& type = typeid(token);
+    if ((type == typeid(TokenNot))) {
+        return (1);
+    } else if ((type == typeid(TokenEqual)) ||
+               (type == typeid(TokenConcat)) ||
+               (type == typeid(TokenToHexString)) ||
+               (type == typeid(TokenAnd)) ||
+               (type == typeid(TokenOr))) {
+        return (2);
+    } else if ((type == typeid(TokenSubstring)) ||
+               (type == typeid(TokenIfElse))) {
+        return (3);
+    }
+    return (0);
+}
+
+/// @brief Returns the position of the first token of a subexpression.
+///
+/// @param expr The expression.
+/// @param last The position of the last token (the root) of the
+/// subexpression.
+/// @param[out] first The position of the first token.
+/// @return false if the expression is malformed.
+bool getSubexpressionStart(const Expression& expr, size_t last,
+                           size_t& first) {
+    // Number of values still to be produced by the tokens on the left.
+    size_t needed = 1;
+    for (size_t pos = last + 1; pos > 0; --pos) {
+        const TokenPtr& token = expr[pos - 1];
+        if (!token) {
+            return (false);
+        }
+        needed = needed - 1 + getArity(*token);
+        if (needed == 0) {
+            first = pos - 1;
+            return (true);
+        }
+    }
+    return (false);
+}
+
+/// @brief Abstract value used to compute the required options.
+struct OptionDependency {
+    /// @brief Constructor.
+    OptionDependency() : not_empty_(false) {
+    }
+
+    /// @brief The value is a constant which is not empty.
+    bool not_empty_;
+
+    /// @brief The value is empty when one of these options is absent.
+    set<uint16_t> empty_if_absent_;
+
+    /// @brief The value is false when one of these options is absent.
+    set<uint16_t> required_;
+};
+
+/// @brief Returns the intersection of two sets.
+set<uint16_t> intersect(const set<uint16_t>& a, const set<uint16_t>& b) {
+    set<uint16_t> result;
+    set_intersection(a.cbegin(), a.cend(), b.cbegin(), b.cend(),
+                     inserter(result, result.begin()));
+    return (result);
+}
+
+}
 
 namespace isc {
 namespace dhcp {
@@ -33,5 +116,199 @@ bool dependOnClass(const ExpressionPtr& expr, const std::string& name) {
     return (false);
 }
 
+bool dependOnAnyClass(const ExpressionPtr& expr) {
+    if (!expr) {
+        return (false);
+    }
+    for (auto it = expr->cbegin(); it != expr->cend(); ++it) {
+        if (boost::dynamic_pointer_cast<TokenMember>(*it)) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void getRequiredOptions(const ExpressionPtr& expr, set<uint16_t>& codes) {
+    if (!expr) {
+        return;
+    }
+    vector<OptionDependency> stack;
+    for (auto it = expr->cbegin(); it != expr->cend(); ++it) {
+        if (!*it) {
+            return;
+        }
+        const Token& token = **it;
+        const type_info& type = typeid(token);
+        size_t arity = getArity(token);
+        if (stack.size() < arity) {
+            // Malformed expression: nothing can be said.
+            return;
+        }
+        // Operands, in the order they were pushed.
+        vector<OptionDependency> ops(stack.end() - arity, stack.end());
+        stack.resize(stack.size() - arity);
+        OptionDependency value;
+
+        if ((type == typeid(TokenString)) || (type == typeid(TokenInteger))) {
+            value.not_empty_ =
+                !static_cast<const TokenString&>(token).getValue().empty();
+
+        } else if (type == typeid(TokenHexString)) {
+            value.not_empty_ =
+                !static_cast<const TokenHexString&>(token).getValue().empty();
+
+        } else if (type == typeid(TokenIpAddress)) {
+            value.not_empty_ =
+                !static_cast<const TokenIpAddress&>(token).getValue().empty();
+
+        } else if ((type == typeid(TokenOption)) ||
+                   (type == typeid(TokenRelay4Option))) {
+            const TokenOption& option = static_cast<const TokenOption&>(token);
+            // A relay4 sub-option is absent when the relay agent
+            // information option is absent.
+            uint16_t code = (type == typeid(TokenOption) ? option.getCode() :
+                             static_cast<uint16_t>(DHO_DHCP_AGENT_OPTIONS));
+            if (option.getRepresentation() == TokenOption::EXISTS) {
+                value.required_.insert(code);
+            } else {
+                value.empty_if_absent_.insert(code);
+            }
+
+        } else if (type == typeid(TokenEqual)) {
+            // An empty value is not equal to a not empty constant.
+            if (ops[0].not_empty_) {
+                value.required_ = ops[1].empty_if_absent_;
+            }
+            if (ops[1].not_empty_) {
+                value.required_.insert(ops[0].empty_if_absent_.cbegin(),
+                                       ops[0].empty_if_absent_.cend());
+            }
+
+        } else if ((type == typeid(TokenSubstring)) ||
+                   (type == typeid(TokenToHexString))) {
+            // The substring and the hexstring of an empty string are
+            // empty strings.
+            value.empty_if_absent_ = ops[0].empty_if_absent_;
+
+        } else if (type == typeid(TokenConcat)) {
+            value.empty_if_absent_ = intersect(ops[0].empty_if_absent_,
+                                               ops[1].empty_if_absent_);
+
+        } else if (type == typeid(TokenIfElse)) {
+            value.empty_if_absent_ = intersect(ops[1].empty_if_absent_,
+                                               ops[2].empty_if_absent_);
+            value.required_ = intersect(ops[1].required_, ops[2].required_);
+
+        } else if (type == typeid(TokenAnd)) {
+            value.required_ = ops[0].required_;
+            value.required_.insert(ops[1].required_.cbegin(),
+                                   ops[1].required_.cend());
+
+        } else if (type == typeid(TokenOr)) {
+            value.required_ = intersect(ops[0].required_, ops[1].required_);
+        }
+
+        stack.push_back(value);
+    }
+    if (stack.size() == 1) {
+        codes.insert(stack[0].required_.cbegin(), stack[0].required_.cend());
+    }
+}
+
+vector<ExpressionPtr> splitConjunction(const ExpressionPtr& expr) {
+    vector<ExpressionPtr> result;
+    if (!expr || expr->empty()) {
+        return (result);
+    }
+    // Ranges (first and last positions) of the subexpressions to split.
+    vector<pair<size_t, size_t> > todo;
+    todo.push_back(make_pair(0, expr->size() - 1));
+    vector<pair<size_t, size_t> > done;
+    while (!todo.empty()) {
+        pair<size_t, size_t> range = todo.back();
+        todo.pop_back();
+        const TokenPtr& root = (*expr)[range.second];
+        if (!root || (typeid(*root) != typeid(TokenAnd))) {
+            done.push_back(range);
+            continue;
+        }
+        // The second operand ends just before the and token.
+        size_t first2 = 0;
+        if ((range.second == range.first) ||
+            !getSubexpressionStart(*expr, range.second - 1, first2) ||
+            (first2 <= range.first)) {
+            result.push_back(expr);
+            return (result);
+        }
+        size_t first1 = 0;
+        if (!getSubexpressionStart(*expr, first2 - 1, first1) ||
+            (first1 != range.first)) {
+            result.push_back(expr);
+            return (result);
+        }
+        // Push the second operand first so the first is split first.
+        todo.push_back(make_pair(first2, range.second - 1));
+        todo.push_back(make_pair(first1, first2 - 1));
+    }
+    if (done.size() == 1) {
+        result.push_back(expr);
+        return (result);
+    }
+    for (auto range : done) {
+        ExpressionPtr sub(new Expression(expr->begin() + range.first,
+                                         expr->begin() + range.second + 1));
+        result.push_back(sub);
+    }
+    return (result);
+}
+
+string getExpressionKey(const ExpressionPtr& expr) {
+    if (!expr) {
+        return ("");
+    }
+    ostringstream key;
+    for (auto it = expr->cbegin(); it != expr->cend(); ++it) {
+        if (!*it) {
+            key << "null;";
+            continue;
+        }
+        Token& token = **it;
+        const type_info& type = typeid(token);
+        key << type.name() << ":";
+        if ((type == typeid(TokenString)) || (type == typeid(TokenInteger))) {
+            const string& value =
+                static_cast<const TokenString&>(token).getValue();
+            key << value.size() << ":" << value;
+        } else if (type == typeid(TokenHexString)) {
+            const string& value =
+                static_cast<const TokenHexString&>(token).getValue();
+            key << value.size() << ":" << value;
+        } else if (type == typeid(TokenIpAddress)) {
+            const string& value =
+                static_cast<const TokenIpAddress&>(token).getValue();
+            key << value.size() << ":" << value;
+        } else if ((type == typeid(TokenOption)) ||
+                   (type == typeid(TokenRelay4Option))) {
+            const TokenOption& option = static_cast<const TokenOption&>(token);
+            key << option.getCode() << ":" << option.getRepresentation();
+        } else if (type == typeid(TokenPkt)) {
+            key << static_cast<TokenPkt&>(token).getType();
+        } else if (type == typeid(TokenPkt4)) {
+            key << static_cast<TokenPkt4&>(token).getType();
+        } else if (type == typeid(TokenPkt6)) {
+            key << static_cast<TokenPkt6&>(token).getType();
+        } else if (type == typeid(TokenMember)) {
+            const string& name =
+                static_cast<const TokenMember&>(token).getClientClass();
+            key << name.size() << ":" << name;
+        } else if (getArity(token) == 0) {
+            // Unknown parameters.
+            key << static_cast<const void*>(&token);
+        }
+        key << ";";
+    }
+    return (key.str());
+}
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
@@ -8,7 +8,9 @@
 #define DEPENDENCY_H
 
 #include <eval/token.h>
+#include <set>
 #include <string>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -31,6 +33,55 @@ bool dependOnClass(const TokenPtr& token, const std::string& name);
 /// @return true if a member of expr depends on name, false if not.
 bool dependOnClass(const ExpressionPtr& expr, const std::string& name);
 
+/// @brief Checks dependency on any class.
+///
+/// It checks if a member of the expression is a TokenMember. The value
+/// of an expression which doesn't depend on any class is only a function
+/// of the packet content so it can be computed once per packet.
+///
+/// @param expr An expression.
+/// @return true if a member of expr is a TokenMember, false if not.
+bool dependOnAnyClass(const ExpressionPtr& expr);
+
+/// @brief Returns the codes of the options required by an expression.
+///
+/// An option is required when the expression can't evaluate to true
+/// if the option is absent from the packet, e.g. option 60 is required
+/// by the "substring(option[60].hex,0,9) == 'PXEClient'" expression
+/// because the value of an absent option is an empty string and the
+/// substring of an empty string is an empty string. The analysis is
+/// conservative: only the top level options (and the relay agent
+/// information option for relay4 tokens) are considered and an option
+/// is reported only when its absence makes the whole expression false.
+///
+/// @param expr An expression.
+/// @param[out] codes The set where the option codes are added.
+void getRequiredOptions(const ExpressionPtr& expr, std::set<uint16_t>& codes);
+
+/// @brief Splits an expression into the operands of its top level and
+/// operators.
+///
+/// For instance the "A and (B and C)" expression is split into the
+/// A, B and C subexpressions. The subexpressions share the tokens of the
+/// original expression and are returned in their evaluation order.
+///
+/// @param expr An expression.
+/// @return The list of subexpressions: it is empty for a null or empty
+/// expression and contains the whole expression when it is not an and
+/// or it is malformed.
+std::vector<ExpressionPtr> splitConjunction(const ExpressionPtr& expr);
+
+/// @brief Returns a key identifying an expression by its content.
+///
+/// Two expressions built from equal tokens (e.g. parsed from two
+/// identical strings) have the same key. Tokens which don't expose their
+/// parameters are identified by their address so the expressions
+/// including them never share a key.
+///
+/// @param expr An expression.
+/// @return The key of the expression (empty for a null expression).
+std::string getExpressionKey(const ExpressionPtr& expr);
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -9,6 +9,7 @@
 
 #include <eval/token.h>
 #include <string>
+#include <unordered_map>
 
 namespace isc {
 namespace dhcp {
@@ -25,6 +26,15 @@ namespace dhcp {
 ///        end of the evaluation is not "false" or "true"
 bool evaluateBool(const Expression& expr, Pkt& pkt);
 
+/// @brief Results of boolean expressions already evaluated for a packet
+///
+/// The key is given by @c getExpressionKey. Only expressions which don't
+/// depend on client classes may be cached as their value is a function
+/// of the packet content only. The cache lives as long as the
+/// classification of a packet so the subexpressions shared by several
+/// client classes are evaluated once.
+typedef std::unordered_map<std::string, bool> EvalCache;
+
 
 std::string evaluateString(const Expression& expr, Pkt& pkt);
 
@@ -0,0 +1,279 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <eval/compiled_expression.h>
+#include <eval/eval_context.h>
+#include <eval/evaluate.h>
+#include <eval/token.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option_string.h>
+#include <asiolink/io_address.h>
+
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture for testing compiled expressions.
+///
+/// Each expression is parsed, compiled and then evaluated both by the
+/// interpreter and by the compiled expression. The results (or the
+/// exceptions) must be identical.
+class CompiledExpressionTest : public ::testing::Test {
+public:
+
+    /// @brief Initializes the packets.
+    CompiledExpressionTest() {
+        pkt4_.reset(new Pkt4(DHCPDISCOVER, 12345));
+        pkt6_.reset(new Pkt6(DHCPV6_SOLICIT, 12345));
+        pkt4_->addOption(OptionPtr(new OptionString(Option::V4, 100,
+                                                    "hundred4")));
+        pkt6_->addOption(OptionPtr(new OptionString(Option::V6, 100,
+                                                    "hundred6")));
+        pkt4_->setIface("eth0");
+        pkt6_->setIface("eth0");
+        pkt4_->setRemoteAddr(IOAddress("192.0.2.1"));
+        pkt6_->setRemoteAddr(IOAddress("2001:db8::1"));
+        pkt4_->setGiaddr(IOAddress("192.0.2.2"));
+        pkt4_->addClass("foo");
+        pkt6_->addClass("foo");
+    }
+
+    /// @brief Parses and compiles an expression.
+    ///
+    /// @param u universe (V4 or V6)
+    /// @param expr expression to be parsed
+    /// @param type parser type
+    /// @return compiled expression
+    CompiledExpressionPtr compile(const Option::Universe& u,
+                                  const string& expr,
+                                  EvalContext::ParserType type) {
+        EvalContext eval(u);
+        bool parsed = false;
+        EXPECT_NO_THROW(parsed = eval.parseString(expr, type))
+            << " while parsing expression " << expr;
+        EXPECT_TRUE(parsed) << " for expression " << expr;
+        ExpressionPtr source(new Expression(eval.expression));
+        CompiledExpressionPtr compiled = CompiledExpression::compile(source);
+        EXPECT_TRUE(compiled) << " while compiling expression " << expr;
+        return (compiled);
+    }
+
+    /// @brief Checks that the compiled boolean expression gives the same
+    /// result as the interpreter.
+    ///
+    /// @param u universe (V4 or V6)
+    /// @param expr expression to be parsed
+    /// @param exp_result expected result
+    void testBool(const Option::Universe& u, const string& expr,
+                  bool exp_result) {
+        CompiledExpressionPtr compiled = compile(u, expr,
+                                                 EvalContext::PARSER_BOOL);
+        ASSERT_TRUE(compiled);
+        Pkt& pkt = (u == Option::V4 ? static_cast<Pkt&>(*pkt4_) :
+                    static_cast<Pkt&>(*pkt6_));
+        bool interpreted = !exp_result;
+        bool result = !exp_result;
+        ASSERT_NO_THROW(interpreted = evaluateBool(*compiled->getSource(), pkt))
+            << " for expression " << expr;
+        ASSERT_NO_THROW(result = compiled->evaluateBool(pkt))
+            << " for expression " << expr;
+        EXPECT_EQ(exp_result, interpreted) << " for expression " << expr;
+        EXPECT_EQ(exp_result, result) << " for expression " << expr;
+    }
+
+    /// @brief Checks that the compiled string expression gives the same
+    /// result as the interpreter.
+    ///
+    /// @param u universe (V4 or V6)
+    /// @param expr expression to be parsed
+    /// @param exp_result expected result
+    void testString(const Option::Universe& u, const string& expr,
+                    const string& exp_result) {
+        CompiledExpressionPtr compiled = compile(u, expr,
+                                                 EvalContext::PARSER_STRING);
+        ASSERT_TRUE(compiled);
+        Pkt& pkt = (u == Option::V4 ? static_cast<Pkt&>(*pkt4_) :
+                    static_cast<Pkt&>(*pkt6_));
+        string interpreted;
+        string result;
+        ASSERT_NO_THROW(interpreted = evaluateString(*compiled->getSource(), pkt))
+            << " for expression " << expr;
+        ASSERT_NO_THROW(result = compiled->evaluateString(pkt))
+            << " for expression " << expr;
+        EXPECT_EQ(exp_result, interpreted) << " for expression " << expr;
+        EXPECT_EQ(exp_result, result) << " for expression " << expr;
+    }
+
+    Pkt4Ptr pkt4_; ///< A stub DHCPv4 packet
+    Pkt6Ptr pkt6_; ///< A stub DHCPv6 packet
+};
+
+// Null, empty and malformed expressions are not compiled.
+TEST_F(CompiledExpressionTest, notCompiled) {
+    ExpressionPtr e;
+    EXPECT_FALSE(CompiledExpression::compile(e));
+
+    e.reset(new Expression());
+    EXPECT_FALSE(CompiledExpression::compile(e));
+
+    // Not enough operands.
+    e->push_back(TokenPtr(new TokenString("foo")));
+    e->push_back(TokenPtr(new TokenEqual()));
+    EXPECT_FALSE(CompiledExpression::compile(e));
+
+    // Too many values left on the stack.
+    e.reset(new Expression());
+    e->push_back(TokenPtr(new TokenString("foo")));
+    e->push_back(TokenPtr(new TokenString("bar")));
+    EXPECT_FALSE(CompiledExpression::compile(e));
+
+    // Too deep.
+    e.reset(new Expression());
+    for (size_t i = 0; i <= CompiledExpression::MAX_REGISTERS; ++i) {
+        e->push_back(TokenPtr(new TokenString("foo")));
+    }
+    for (size_t i = 0; i < CompiledExpression::MAX_REGISTERS; ++i) {
+        e->push_back(TokenPtr(new TokenConcat()));
+    }
+    EXPECT_FALSE(CompiledExpression::compile(e));
+}
+
+// Registers are reused as the stack shrinks.
+TEST_F(CompiledExpressionTest, registers) {
+    CompiledExpressionPtr compiled =
+        compile(Option::V4, "('a' == 'b') or (option[100].exists and "
+                "not member('foo'))", EvalContext::PARSER_BOOL);
+    ASSERT_TRUE(compiled);
+    const vector<CompiledExpression::Instruction>& code =
+        compiled->getInstructions();
+    ASSERT_EQ(8, code.size());
+    EXPECT_EQ(CompiledExpression::OP_CONST, code[0].op_);
+    EXPECT_EQ(0, code[0].reg_);
+    EXPECT_EQ(CompiledExpression::OP_CONST, code[1].op_);
+    EXPECT_EQ(1, code[1].reg_);
+    EXPECT_EQ(CompiledExpression::OP_EQUAL, code[2].op_);
+    EXPECT_EQ(0, code[2].reg_);
+    EXPECT_EQ(CompiledExpression::OP_OPTION, code[3].op_);
+    EXPECT_EQ(1, code[3].reg_);
+    EXPECT_EQ(100, code[3].arg_);
+    EXPECT_EQ(CompiledExpression::OP_MEMBER, code[4].op_);
+    EXPECT_EQ(2, code[4].reg_);
+    EXPECT_EQ(CompiledExpression::OP_NOT, code[5].op_);
+    EXPECT_EQ(2, code[5].reg_);
+    EXPECT_EQ(CompiledExpression::OP_AND, code[6].op_);
+    EXPECT_EQ(1, code[6].reg_);
+    EXPECT_EQ(CompiledExpression::OP_OR, code[7].op_);
+    EXPECT_EQ(0, code[7].reg_);
+}
+
+// Boolean expressions give the same results as the interpreter.
+TEST_F(CompiledExpressionTest, booleans) {
+    testBool(Option::V4, "'foo' == 'foo'", true);
+    testBool(Option::V4, "'foo' == 'bar'", false);
+    testBool(Option::V4, "option[100].text == 'hundred4'", true);
+    testBool(Option::V6, "option[100].text == 'hundred6'", true);
+    testBool(Option::V4, "option[100].hex == 'hundred4'", true);
+    testBool(Option::V4, "option[101].text == ''", true);
+    testBool(Option::V4, "option[100].exists", true);
+    testBool(Option::V4, "option[101].exists", false);
+    testBool(Option::V4, "not option[101].exists", true);
+    testBool(Option::V4, "relay4[1].exists", false);
+    testBool(Option::V4, "member('foo')", true);
+    testBool(Option::V4, "member('bar')", false);
+    testBool(Option::V4, "member('foo') and not member('bar')", true);
+    testBool(Option::V4, "member('bar') or member('foo')", true);
+    testBool(Option::V4, "pkt4.msgtype == 1", true);
+    testBool(Option::V4, "pkt4.transid == 12345", true);
+    testBool(Option::V4, "pkt4.giaddr == 192.0.2.2", true);
+    testBool(Option::V4, "pkt4.ciaddr == 0.0.0.0", true);
+    testBool(Option::V4, "pkt.src == 192.0.2.1", true);
+    testBool(Option::V6, "pkt.src == 2001:db8::1", true);
+    testBool(Option::V4, "pkt.iface == 'eth0'", true);
+    testBool(Option::V6, "pkt6.msgtype == 1", true);
+    testBool(Option::V6, "pkt6.transid == 12345", true);
+    testBool(Option::V4, "pkt4.msgtype == 0x00000001", true);
+    testBool(Option::V4, "ifelse(member('foo'), 'a', 'b') == 'a'", true);
+    testBool(Option::V4, "substring('foobar', 0, 3) == 'foo'", true);
+    testBool(Option::V4, "vendor[4491].exists", false);
+    testBool(Option::V6, "relay6[0].peeraddr == 2001:db8::1", false);
+}
+
+// String expressions give the same results as the interpreter.
+TEST_F(CompiledExpressionTest, strings) {
+    testString(Option::V4, "'foobar'", "foobar");
+    testString(Option::V4, "0x666f6f", "foo");
+    testString(Option::V4, "option[100].text", "hundred4");
+    testString(Option::V6, "option[100].text", "hundred6");
+    testString(Option::V4, "option[101].text", "");
+    testString(Option::V4, "concat('foo', 'bar')", "foobar");
+    testString(Option::V4, "concat(concat('a', 'b'), concat('c', 'd'))",
+               "abcd");
+    testString(Option::V4, "substring('foobar', 0, 3)", "foo");
+    testString(Option::V4, "substring('foobar', 3, all)", "bar");
+    testString(Option::V4, "substring('foobar', -3, 2)", "ba");
+    testString(Option::V4, "substring('foobar', 4, -2)", "ob");
+    testString(Option::V4, "substring('foobar', 1, -3)", "f");
+    testString(Option::V4, "substring('foobar', 10, 1)", "");
+    testString(Option::V4, "substring('', 0, 1)", "");
+    testString(Option::V4, "hexstring(0x010203, ':')", "01:02:03");
+    testString(Option::V4, "hexstring(pkt4.giaddr, '.')", "c0.00.02.02");
+    testString(Option::V4, "hexstring('', '-')", "");
+    testString(Option::V4, "ifelse('foo' == 'foo', 'yes', 'no')", "yes");
+    testString(Option::V4, "ifelse(member('bar'), 'yes', 'no')", "no");
+    testString(Option::V4, "concat(pkt4.msgtype, 'x')",
+               string("\0\0\0\1x", 5));
+    testString(Option::V4, "pkt.iface", "eth0");
+    testString(Option::V4, "hexstring(pkt4.mac, ':')", "");
+
+    // Long values spill out of the scratch buffer.
+    string big(CompiledExpression::SCRATCH_SIZE, 'x');
+    testString(Option::V4, "concat(concat('" + big + "', '" + big + "'), 'y')",
+               big + big + "y");
+}
+
+// Errors are reported the same way as by the interpreter.
+TEST_F(CompiledExpressionTest, errors) {
+    CompiledExpressionPtr compiled =
+        compile(Option::V6, "pkt4.msgtype == 1", EvalContext::PARSER_BOOL);
+    ASSERT_TRUE(compiled);
+    EXPECT_THROW(evaluateBool(*compiled->getSource(), *pkt6_), EvalTypeError);
+    EXPECT_THROW(compiled->evaluateBool(*pkt6_), EvalTypeError);
+
+    compiled = compile(Option::V4, "pkt6.msgtype == 1",
+                       EvalContext::PARSER_BOOL);
+    ASSERT_TRUE(compiled);
+    EXPECT_THROW(compiled->evaluateBool(*pkt4_), EvalTypeError);
+
+    // Not a boolean.
+    ExpressionPtr e(new Expression());
+    e->push_back(TokenPtr(new TokenString("foo")));
+    compiled = CompiledExpression::compile(e);
+    ASSERT_TRUE(compiled);
+    EXPECT_THROW(evaluateBool(*e, *pkt4_), EvalTypeError);
+    EXPECT_THROW(compiled->evaluateBool(*pkt4_), EvalTypeError);
+
+    // Bad substring parameters.
+    e.reset(new Expression());
+    e->push_back(TokenPtr(new TokenString("foobar")));
+    e->push_back(TokenPtr(new TokenString("bad")));
+    e->push_back(TokenPtr(new TokenString("1")));
+    e->push_back(TokenPtr(new TokenSubstring()));
+    compiled = CompiledExpression::compile(e);
+    ASSERT_TRUE(compiled);
+    EXPECT_THROW(evaluateString(*e, *pkt4_), EvalTypeError);
+    EXPECT_THROW(compiled->evaluateString(*pkt4_), EvalTypeError);
+}
+
+};
@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -36,6 +36,22 @@ public:
         result_ = false;
     }
 
+    /// @brief Parses a boolean expression into e_.
+    ///
+    /// @param expr the expression to parse
+    void parse(const std::string& expr) {
+        EvalContext eval(Option::V4);
+        ASSERT_NO_THROW(eval.parseString(expr)) << " for expression " << expr;
+        e_.reset(new Expression(eval.expression));
+    }
+
+    /// @brief Returns the options required by e_.
+    set<uint16_t> required() {
+        set<uint16_t> codes;
+        getRequiredOptions(e_, codes);
+        return (codes);
+    }
+
     ExpressionPtr e_; ///< An expression
 
     bool result_; ///< A decision
@@ -95,4 +111,95 @@ TEST_F(DependencyTest, matching) {
     EXPECT_TRUE(result_);
 }
 
+// This checks the dependency on any class.
+TEST_F(DependencyTest, anyClass) {
+    EXPECT_FALSE(dependOnAnyClass(e_));
+    parse("option[60].exists");
+    EXPECT_FALSE(dependOnAnyClass(e_));
+    parse("option[60].exists and not member('foobar')");
+    EXPECT_TRUE(dependOnAnyClass(e_));
+}
+
+// This checks the options required by expressions.
+TEST_F(DependencyTest, requiredOptions) {
+    set<uint16_t> codes;
+    getRequiredOptions(e_, codes);
+    EXPECT_TRUE(codes.empty());
+
+    parse("option[60].exists");
+    EXPECT_EQ(set<uint16_t>({ 60 }), required());
+
+    parse("not option[60].exists");
+    EXPECT_TRUE(required().empty());
+
+    parse("substring(option[60].hex,0,9) == 'PXEClient'");
+    EXPECT_EQ(set<uint16_t>({ 60 }), required());
+
+    parse("'foo' == hexstring(option[61].hex, ':')");
+    EXPECT_EQ(set<uint16_t>({ 61 }), required());
+
+    // The value of an absent option is an empty string.
+    parse("option[60].text == ''");
+    EXPECT_TRUE(required().empty());
+
+    parse("concat(option[60].text, 'foo') == 'foo'");
+    EXPECT_TRUE(required().empty());
+
+    parse("option[60].exists and (option[61].text == 'foo')");
+    EXPECT_EQ(set<uint16_t>({ 60, 61 }), required());
+
+    parse("option[60].exists or option[61].exists");
+    EXPECT_TRUE(required().empty());
+
+    parse("(option[60].exists and option[61].exists) or option[60].exists");
+    EXPECT_EQ(set<uint16_t>({ 60 }), required());
+
+    parse("relay4[1].hex == 'foo'");
+    EXPECT_EQ(set<uint16_t>({ DHO_DHCP_AGENT_OPTIONS }), required());
+
+    parse("member('foobar')");
+    EXPECT_TRUE(required().empty());
+}
+
+// This checks the split of the top level and operators.
+TEST_F(DependencyTest, splitConjunction) {
+    EXPECT_TRUE(splitConjunction(e_).empty());
+
+    parse("option[60].exists");
+    vector<ExpressionPtr> operands = splitConjunction(e_);
+    ASSERT_EQ(1, operands.size());
+    EXPECT_EQ(e_, operands[0]);
+
+    parse("option[60].exists or option[61].exists");
+    operands = splitConjunction(e_);
+    ASSERT_EQ(1, operands.size());
+    EXPECT_EQ(e_, operands[0]);
+
+    parse("option[60].exists and ('a' == 'b' and not member('foobar'))");
+    operands = splitConjunction(e_);
+    ASSERT_EQ(3, operands.size());
+    ASSERT_EQ(1, operands[0]->size());
+    EXPECT_EQ((*e_)[0], (*operands[0])[0]);
+    ASSERT_EQ(3, operands[1]->size());
+    EXPECT_EQ((*e_)[1], (*operands[1])[0]);
+    ASSERT_EQ(2, operands[2]->size());
+    EXPECT_EQ((*e_)[4], (*operands[2])[0]);
+}
+
+// This checks the expression keys.
+TEST_F(DependencyTest, expressionKey) {
+    EXPECT_TRUE(getExpressionKey(e_).empty());
+
+    parse("substring(option[60].hex,0,9) == 'PXEClient'");
+    string key1 = getExpressionKey(e_);
+    parse("substring(option[60].hex,0,9) == 'PXEClient'");
+    EXPECT_EQ(key1, getExpressionKey(e_));
+    parse("substring(option[60].hex,0,9) == 'PXEClienT'");
+    EXPECT_NE(key1, getExpressionKey(e_));
+    parse("substring(option[61].hex,0,9) == 'PXEClient'");
+    EXPECT_NE(key1, getExpressionKey(e_));
+    parse("substring(option[60].text,0,9) == 'PXEClient'");
+    EXPECT_NE(key1, getExpressionKey(e_));
+}
+
 };
@@ -11,6 +11,7 @@
 #include <hooks/hooks_log.h>
 #include <hooks/pointer_converter.h>
 #include <util/stopwatch.h>
+#include <util/trace_mgr.h>
 
 #include <boost/static_assert.hpp>
 
@@ -29,7 +30,8 @@ CalloutManager::CalloutManager(int num_libraries)
     : server_hooks_(ServerHooks::getServerHooks()), current_library_(-1),
       hook_vector_(ServerHooks::getServerHooks().getCount()),
       library_handle_(*this), pre_library_handle_(*this, 0),
-      post_library_handle_(*this, INT_MAX), num_libraries_(num_libraries) {
+      post_library_handle_(*this, INT_MAX), num_libraries_(num_libraries),
+      callout_stats_() {
     if (num_libraries < 0) {
         isc_throw(isc::BadValue, "number of libraries passed to the "
                   "CalloutManager must be >= 0");
@@ -153,6 +155,11 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
         LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUTS_BEGIN)
             .arg(server_hooks_.getName(callout_handle.getCurrentHook()));
 
+        // The trace events carry the name of the hook point.
+        util::TraceMgr& trace_mgr = util::TraceMgr::instance();
+        const char* trace_hook = trace_mgr.isEnabled() ?
+            trace_mgr.intern(server_hooks_.getName(hook_index)) : 0;
+
         // Call all the callouts.
         for (CalloutVector::const_iterator i = hook_vector_[hook_index].begin();
              i != hook_vector_[hook_index].end(); ++i) {
@@ -164,9 +171,13 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
 
             // Call the callout
             try {
+                util::ScopedTrace trace("callout", trace_hook);
                 stopwatch.start();
                 int status = (*i->second)(callout_handle);
                 stopwatch.stop();
+                callout_stats_.record(hook_index, i->first,
+                                      stopwatch.getLastMicroseconds(),
+                                      status != 0);
                 if (status == 0) {
                     LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                               HOOKS_CALLOUT_CALLED)
@@ -185,6 +196,8 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 // If an exception occurred, the stopwatch.stop() hasn't been
                 // called, so we have to call it here.
                 stopwatch.stop();
+                callout_stats_.record(hook_index, i->first,
+                                      stopwatch.getLastMicroseconds(), true);
                 // Any exception, not just ones based on isc::Exception
                 LOG_ERROR(callouts_logger, HOOKS_CALLOUT_EXCEPTION)
                     .arg(callout_handle.getCurrentLibrary())
@@ -8,6 +8,7 @@
 #define CALLOUT_MANAGER_H
 
 #include <exceptions/exceptions.h>
+#include <hooks/callout_stats.h>
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
 
@@ -274,6 +275,16 @@ public:
         return (num_libraries_);
     }
 
+    /// @brief Get the execution time statistics of the callouts
+    ///
+    /// The duration of each callout called by callCallouts() is recorded
+    /// per hook index and library index.
+    ///
+    /// @return Reference to the callout statistics.
+    CalloutStats& getCalloutStats() {
+        return (callout_stats_);
+    }
+
     /// @brief Get current library index
     ///
     /// Returns the index of the "current" library.  This the index associated
@@ -430,6 +441,9 @@ private:
 
     /// Number of libraries.
     int num_libraries_;
+
+    /// Execution time statistics of the callouts.
+    CalloutStats callout_stats_;
 };
 
 }  // namespace util
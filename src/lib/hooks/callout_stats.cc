@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <hooks/callout_stats.h>
+#include <util/multi_threading_mgr.h>
+
+#include <atomic>
+
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Identifier of the next CalloutStats instance.
+///
+/// Zero is never used so it denotes an empty thread local cache.
+atomic<uint64_t> next_id(1);
+
+}
+
+namespace isc {
+namespace hooks {
+
+const size_t CalloutStats::HISTOGRAM_BUCKETS;
+
+CalloutStats::Entry::Entry()
+    : count_(0), errors_(0), total_(0), max_(0) {
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+        histogram_[i] = 0;
+    }
+}
+
+CalloutStats::CalloutStats()
+    : id_(next_id.fetch_add(1)), shards_(), mutex_(new mutex()) {
+}
+
+size_t
+CalloutStats::getBucket(uint64_t duration) {
+    size_t bucket = 0;
+    while ((bucket < HISTOGRAM_BUCKETS - 1) &&
+           (duration >= (static_cast<uint64_t>(1) << bucket))) {
+        ++bucket;
+    }
+    return (bucket);
+}
+
+CalloutStats::Shard&
+CalloutStats::getShard() {
+    // The shard used last by the thread and the instance it belongs to.
+    static thread_local uint64_t cached_id = 0;
+    static thread_local ShardPtr cached;
+    if (cached_id != id_) {
+        lock_guard<mutex> lock(*mutex_);
+        ShardPtr& shard = shards_[this_thread::get_id()];
+        if (!shard) {
+            shard.reset(new Shard());
+        }
+        cached = shard;
+        cached_id = id_;
+    }
+    return (*cached);
+}
+
+void
+CalloutStats::record(int hook_index, int library_index, long duration,
+                     bool error) {
+    uint64_t usecs = (duration > 0 ? static_cast<uint64_t>(duration) : 0);
+    Shard& shard = getShard();
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(shard.mutex_);
+        recordInternal(shard.stats_, hook_index, library_index, usecs, error);
+    } else {
+        recordInternal(shard.stats_, hook_index, library_index, usecs, error);
+    }
+}
+
+void
+CalloutStats::recordInternal(Collection& stats, int hook_index,
+                             int library_index, uint64_t duration,
+                             bool error) {
+    Entry& entry = stats[make_pair(hook_index, library_index)];
+    ++entry.count_;
+    if (error) {
+        ++entry.errors_;
+    }
+    entry.total_ += duration;
+    if (duration > entry.max_) {
+        entry.max_ = duration;
+    }
+    ++entry.histogram_[getBucket(duration)];
+}
+
+CalloutStats::Collection
+CalloutStats::get() const {
+    Collection merged;
+    lock_guard<mutex> lock(*mutex_);
+    for (auto const& it : shards_) {
+        Shard& shard = *it.second;
+        lock_guard<mutex> shard_lock(shard.mutex_);
+        for (auto const& stat : shard.stats_) {
+            Entry& entry = merged[stat.first];
+            entry.count_ += stat.second.count_;
+            entry.errors_ += stat.second.errors_;
+            entry.total_ += stat.second.total_;
+            if (stat.second.max_ > entry.max_) {
+                entry.max_ = stat.second.max_;
+            }
+            for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+                entry.histogram_[i] += stat.second.histogram_[i];
+            }
+        }
+    }
+    return (merged);
+}
+
+void
+CalloutStats::reset() {
+    lock_guard<mutex> lock(*mutex_);
+    for (auto const& it : shards_) {
+        lock_guard<mutex> shard_lock(it.second->mutex_);
+        it.second->stats_.clear();
+    }
+}
+
+} // namespace hooks
+} // namespace isc
@@ -0,0 +1,140 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CALLOUT_STATS_H
+#define CALLOUT_STATS_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <utility>
+
+namespace isc {
+namespace hooks {
+
+/// @brief Execution time statistics of the callouts
+///
+/// The CalloutManager times each callout it calls. This class aggregates
+/// these durations per hook point and per library, so the libraries
+/// adding latency to the packet processing can be identified without
+/// enabling the debug logging. The statistics are returned by the
+/// hooks-stats-get command.
+///
+/// Each thread records in its own shard of the statistics so the packet
+/// processing threads do not contend for a lock; the shards are merged
+/// when the statistics are returned.
+class CalloutStats : public boost::noncopyable {
+public:
+
+    /// @brief Number of buckets of the latency histogram.
+    ///
+    /// Bucket i (i < HISTOGRAM_BUCKETS - 1) counts the durations below
+    /// 2^i microseconds not counted by the previous buckets. The last
+    /// bucket counts the durations of 2^(HISTOGRAM_BUCKETS - 2)
+    /// microseconds and more.
+    static const size_t HISTOGRAM_BUCKETS = 16;
+
+    /// @brief Statistics of the callouts of a library on a hook point.
+    struct Entry {
+        /// @brief Constructor.
+        Entry();
+
+        /// @brief Number of calls.
+        uint64_t count_;
+
+        /// @brief Number of calls which returned an error or threw.
+        uint64_t errors_;
+
+        /// @brief Total duration in microseconds.
+        uint64_t total_;
+
+        /// @brief Maximum duration in microseconds.
+        uint64_t max_;
+
+        /// @brief Latency histogram.
+        uint64_t histogram_[HISTOGRAM_BUCKETS];
+    };
+
+    /// @brief Key of the statistics: hook index and library index.
+    typedef std::pair<int, int> Key;
+
+    /// @brief Collection of the statistics.
+    typedef std::map<Key, Entry> Collection;
+
+    /// @brief Constructor.
+    CalloutStats();
+
+    /// @brief Records the execution of a callout.
+    ///
+    /// @param hook_index Index of the hook point.
+    /// @param library_index Index of the library which registered the
+    ///        callout.
+    /// @param duration Duration in microseconds.
+    /// @param error true when the callout failed.
+    void record(int hook_index, int library_index, long duration,
+                bool error);
+
+    /// @brief Returns a copy of the statistics.
+    ///
+    /// The statistics of all threads are merged.
+    Collection get() const;
+
+    /// @brief Resets the statistics.
+    void reset();
+
+    /// @brief Returns the histogram bucket of a duration.
+    ///
+    /// @param duration Duration in microseconds.
+    /// @return Index of the bucket.
+    static size_t getBucket(uint64_t duration);
+
+private:
+
+    /// @brief Statistics recorded by a thread.
+    struct Shard {
+        /// @brief The statistics.
+        Collection stats_;
+
+        /// @brief The mutex used to protect the statistics.
+        ///
+        /// It is taken by the recording thread and by the readers only
+        /// so it is not contended on the packet processing path.
+        std::mutex mutex_;
+    };
+
+    /// @brief Pointer to a shard.
+    typedef boost::shared_ptr<Shard> ShardPtr;
+
+    /// @brief Returns the shard of the current thread.
+    ///
+    /// The shard is cached in a thread local variable, the mutex is
+    /// taken only the first time a thread records.
+    Shard& getShard();
+
+    /// @brief Records the execution of a callout in a shard.
+    static void recordInternal(Collection& stats, int hook_index,
+                               int library_index, uint64_t duration,
+                               bool error);
+
+    /// @brief Unique identifier of the instance used by the thread local
+    /// cache of the shards.
+    const uint64_t id_;
+
+    /// @brief The shards indexed by the identifiers of their threads.
+    std::map<std::thread::id, ShardPtr> shards_;
+
+    /// @brief The mutex used to protect the collection of the shards.
+    const boost::scoped_ptr<std::mutex> mutex_;
+};
+
+} // namespace hooks
+} // namespace isc
+
+#endif // CALLOUT_STATS_H
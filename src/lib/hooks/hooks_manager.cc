@@ -13,12 +13,16 @@
 #include <hooks/library_manager_collection.h>
 #include <hooks/hooks_manager.h>
 #include <hooks/server_hooks.h>
+#include <cc/command_interpreter.h>
 
 #include <boost/shared_ptr.hpp>
 
+#include <climits>
 #include <string>
 #include <vector>
 
+using namespace isc::config;
+using namespace isc::data;
 using namespace std;
 
 namespace isc {
@@ -175,6 +179,81 @@ HooksManager::getLibraryInfo() {
     return (getHooksManager().getLibraryInfoInternal());
 }
 
+// Return the callout statistics.
+
+ElementPtr
+HooksManager::getCalloutStatsInternal() const {
+    ElementPtr result = Element::createMap();
+    ElementPtr bounds = Element::createList();
+    for (size_t i = 0; i < CalloutStats::HISTOGRAM_BUCKETS - 1; ++i) {
+        bounds->add(Element::create(static_cast<int64_t>(1) << i));
+    }
+    result->set("histogram-bounds-usec", bounds);
+
+    ElementPtr callouts = Element::createList();
+    result->set("callouts", callouts);
+    if (!callout_manager_) {
+        return (result);
+    }
+
+    ServerHooks& hooks = ServerHooks::getServerHooks();
+    vector<string> names = getLibraryNamesInternal();
+    CalloutStats::Collection stats = callout_manager_->getCalloutStats().get();
+    for (auto it = stats.cbegin(); it != stats.cend(); ++it) {
+        ElementPtr entry = Element::createMap();
+        string hook_name;
+        try {
+            hook_name = hooks.getName(it->first.first);
+        } catch (const std::exception&) {
+            // The hook was removed.
+            continue;
+        }
+        entry->set("hook", Element::create(hook_name));
+
+        // Library indexes 0 and INT_MAX are reserved for the callouts
+        // registered by the server before and after the libraries.
+        int library_index = it->first.second;
+        string library;
+        if (library_index == 0) {
+            library = "pre-callouts";
+        } else if (library_index == INT_MAX) {
+            library = "post-callouts";
+        } else if (library_index <= static_cast<int>(names.size())) {
+            library = names[library_index - 1];
+        }
+        entry->set("library", Element::create(library));
+        entry->set("library-index", Element::create(library_index));
+
+        const CalloutStats::Entry& data = it->second;
+        entry->set("count", Element::create(static_cast<int64_t>(data.count_)));
+        entry->set("errors",
+                   Element::create(static_cast<int64_t>(data.errors_)));
+        entry->set("total-usec",
+                   Element::create(static_cast<int64_t>(data.total_)));
+        entry->set("max-usec",
+                   Element::create(static_cast<int64_t>(data.max_)));
+        ElementPtr histogram = Element::createList();
+        for (size_t i = 0; i < CalloutStats::HISTOGRAM_BUCKETS; ++i) {
+            histogram->add(
+                Element::create(static_cast<int64_t>(data.histogram_[i])));
+        }
+        entry->set("histogram", histogram);
+        callouts->add(entry);
+    }
+    return (result);
+}
+
+ElementPtr
+HooksManager::getCalloutStats() {
+    return (getHooksManager().getCalloutStatsInternal());
+}
+
+ConstElementPtr
+HooksManager::hooksStatsGetHandler(const string& /*name*/,
+                                   const ConstElementPtr& /*params*/) {
+    return (createAnswer(CONTROL_RESULT_SUCCESS, getCalloutStats()));
+}
+
 // Perform conditional initialization if nothing is loaded.
 
 void
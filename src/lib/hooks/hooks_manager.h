@@ -7,6 +7,7 @@
 #ifndef HOOKS_MANAGER_H
 #define HOOKS_MANAGER_H
 
+#include <cc/data.h>
 #include <hooks/server_hooks.h>
 #include <hooks/libinfo.h>
 
@@ -205,6 +206,27 @@ public:
     /// @return List of loaded libraries (names + parameters)
     static HookLibsCollection getLibraryInfo();
 
+    /// @brief Return the execution time statistics of the callouts
+    ///
+    /// Returns a map with the upper bounds of the latency histogram
+    /// buckets ("histogram-bounds-usec") and a list ("callouts") with
+    /// one map per hook point and library which called callouts since
+    /// the libraries were loaded. Each map includes the hook point and
+    /// library names, the number of calls, the number of errors, the
+    /// total and maximum durations in microseconds and the histogram.
+    ///
+    /// @return Callout statistics.
+    static isc::data::ElementPtr getCalloutStats();
+
+    /// @brief Handles hooks-stats-get command
+    ///
+    /// @param name name of the command (ignored, should be "hooks-stats-get")
+    /// @param params command parameters (ignored)
+    /// @return status of the operation and the callout statistics
+    static isc::data::ConstElementPtr
+    hooksStatsGetHandler(const std::string& name,
+                         const isc::data::ConstElementPtr& params);
+
     /// @brief Validate library list
     ///
     /// For each library passed to it, checks that the library can be opened
@@ -475,6 +497,11 @@ private:
     /// @brief Return a collection of library names with parameters.
     HookLibsCollection getLibraryInfoInternal() const;
 
+    /// @brief Return the execution time statistics of the callouts
+    ///
+    /// @return Callout statistics.
+    isc::data::ElementPtr getCalloutStatsInternal() const;
+
     //@}
 
     /// @brief Initialization to No Libraries
@@ -11,13 +11,16 @@
 #include <hooks/callout_manager.h>
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
+#include <util/multi_threading_mgr.h>
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <climits>
 #include <string>
+#include <thread>
 #include <vector>
 
 /// @file
@@ -30,6 +33,7 @@
 
 using namespace isc;
 using namespace isc::hooks;
+using namespace isc::util;
 using namespace std;
 
 namespace {
@@ -430,6 +434,94 @@ TEST_F(CalloutManagerTest, CallCalloutsError) {
     EXPECT_EQ(11223344, callout_value_);
 }
 
+// Check that the execution time of the callouts is recorded per hook
+// point and library.
+TEST_F(CalloutManagerTest, CalloutStats) {
+    EXPECT_TRUE(getCalloutManager()->getCalloutStats().get().empty());
+
+    getCalloutManager()->registerCallout("alpha", callout_one, 1);
+    getCalloutManager()->registerCallout("alpha", callout_two, 1);
+    getCalloutManager()->registerCallout("alpha", callout_four_error, 3);
+    getCalloutManager()->registerCallout("beta", callout_one_error, 0);
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    getCalloutManager()->callCallouts(beta_index_, getCalloutHandle());
+
+    CalloutStats::Collection stats =
+        getCalloutManager()->getCalloutStats().get();
+    ASSERT_EQ(3, stats.size());
+
+    const CalloutStats::Entry& alpha1 = stats[make_pair(alpha_index_, 1)];
+    EXPECT_EQ(4, alpha1.count_);
+    EXPECT_EQ(0, alpha1.errors_);
+    EXPECT_GE(alpha1.total_, alpha1.max_);
+    uint64_t histogram_count = 0;
+    for (size_t i = 0; i < CalloutStats::HISTOGRAM_BUCKETS; ++i) {
+        histogram_count += alpha1.histogram_[i];
+    }
+    EXPECT_EQ(4, histogram_count);
+
+    const CalloutStats::Entry& alpha3 = stats[make_pair(alpha_index_, 3)];
+    EXPECT_EQ(2, alpha3.count_);
+    EXPECT_EQ(2, alpha3.errors_);
+
+    const CalloutStats::Entry& beta0 = stats[make_pair(beta_index_, 0)];
+    EXPECT_EQ(1, beta0.count_);
+    EXPECT_EQ(1, beta0.errors_);
+
+    getCalloutManager()->getCalloutStats().reset();
+    EXPECT_TRUE(getCalloutManager()->getCalloutStats().get().empty());
+}
+
+// Check the histogram buckets.
+TEST_F(CalloutManagerTest, CalloutStatsBuckets) {
+    EXPECT_EQ(0, CalloutStats::getBucket(0));
+    EXPECT_EQ(1, CalloutStats::getBucket(1));
+    EXPECT_EQ(2, CalloutStats::getBucket(2));
+    EXPECT_EQ(2, CalloutStats::getBucket(3));
+    EXPECT_EQ(3, CalloutStats::getBucket(4));
+    EXPECT_EQ(CalloutStats::HISTOGRAM_BUCKETS - 1,
+              CalloutStats::getBucket(1 << 14));
+    EXPECT_EQ(CalloutStats::HISTOGRAM_BUCKETS - 1,
+              CalloutStats::getBucket(1000000000));
+}
+
+// Check that the statistics recorded by several threads are merged.
+TEST_F(CalloutManagerTest, CalloutStatsThreads) {
+    MultiThreadingMgr::instance().setMode(true);
+    CalloutStats stats;
+    std::vector<boost::shared_ptr<std::thread> > threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.push_back(boost::shared_ptr<std::thread>(
+            new std::thread([&stats, i]() {
+                for (int j = 0; j < 1000; ++j) {
+                    stats.record(1, 2, i, (j % 10) == 0);
+                }
+            })));
+    }
+    for (auto const& thread : threads) {
+        thread->join();
+    }
+    // The statistics of the exited threads are kept.
+    stats.record(1, 3, 100, false);
+    CalloutStats::Collection collection = stats.get();
+    MultiThreadingMgr::instance().setMode(false);
+
+    ASSERT_EQ(2, collection.size());
+    const CalloutStats::Entry& entry = collection[make_pair(1, 2)];
+    EXPECT_EQ(4000, entry.count_);
+    EXPECT_EQ(400, entry.errors_);
+    EXPECT_EQ(6000, entry.total_);
+    EXPECT_EQ(3, entry.max_);
+    EXPECT_EQ(1000, entry.histogram_[0]);
+    EXPECT_EQ(1000, entry.histogram_[1]);
+    EXPECT_EQ(2000, entry.histogram_[2]);
+    EXPECT_EQ(1, collection[make_pair(1, 3)].count_);
+
+    stats.reset();
+    EXPECT_TRUE(stats.get().empty());
+}
+
 // Now test that we can deregister a single callout on a hook.
 
 TEST_F(CalloutManagerTest, DeregisterSingleCallout) {
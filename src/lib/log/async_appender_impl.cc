@@ -0,0 +1,280 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_appender_impl.h>
+#include <log/log_formatter.h>
+#include <log/log_messages.h>
+#include <log/logger_name.h>
+#include <log/message_dictionary.h>
+
+#include <log4cplus/loglevel.h>
+#include <log4cplus/version.h>
+#include <boost/lexical_cast.hpp>
+
+#include <chrono>
+#include <memory>
+
+using namespace std;
+
+namespace isc {
+namespace log {
+namespace internal {
+
+AsyncAppender::AsyncAppender(const log4cplus::SharedAppenderPtr& target,
+                             size_t queue_size,
+                             OutputOption::Overflow overflow)
+    : target_(target), overflow_(overflow), cells_(), mask_(0),
+      enqueue_pos_(0), dequeue_pos_(0), dropped_(0), reported_(0),
+      written_(0), waiting_(false), blocked_(0), stopping_(false),
+      mutex_(), cv_(), written_cv_(), writer_() {
+    // The queue indexes are masked so the capacity is a power of 2.
+    size_t capacity = 2;
+    while (capacity < queue_size) {
+        capacity <<= 1;
+    }
+    vector<Cell>(capacity).swap(cells_);
+    mask_ = capacity - 1;
+    for (size_t i = 0; i < capacity; ++i) {
+        cells_[i].sequence_.store(i, memory_order_relaxed);
+        cells_[i].event_ = 0;
+    }
+    setName(target->getName());
+    writer_ = thread(&AsyncAppender::run, this);
+}
+
+AsyncAppender::~AsyncAppender() {
+    try {
+        destructorImpl();
+    } catch (...) {
+        // Nothing can be logged from a destructor of an appender.
+    }
+}
+
+void
+AsyncAppender::close() {
+    if (writer_.joinable()) {
+        stopping_.store(true);
+        {
+            lock_guard<mutex> lock(mutex_);
+            cv_.notify_one();
+            written_cv_.notify_all();
+        }
+        writer_.join();
+    }
+
+    // Write the events queued while the writer thread was terminating.
+    for (log4cplus::spi::InternalLoggingEvent* event = pop(); event;
+         event = pop()) {
+        write(event);
+    }
+    if (overflow_ == OutputOption::OVERFLOW_COUNT) {
+        reportDropped();
+    }
+    target_->close();
+    closed = true;
+}
+
+void
+AsyncAppender::flush() {
+    const uint64_t queued = enqueue_pos_.load();
+    for (uint64_t written = written_.load();
+         (written < queued) && !stopping_.load();
+         written = written_.load()) {
+        waitWritten(written);
+    }
+}
+
+void
+AsyncAppender::append(const log4cplus::spi::InternalLoggingEvent& event) {
+    // The thread name and the NDC are computed lazily from the thread
+    // which logs: get them before the clone is written by the writer.
+    event.getNDC();
+    event.getThread();
+
+#if LOG4CPLUS_VERSION < LOG4CPLUS_MAKE_VERSION(2, 0, 0)
+    std::auto_ptr<log4cplus::spi::InternalLoggingEvent>
+#else
+    std::unique_ptr<log4cplus::spi::InternalLoggingEvent>
+#endif
+        event_aptr = event.clone();
+    log4cplus::spi::InternalLoggingEvent* clone = event_aptr.release();
+
+    for (;;) {
+        // Get the counter before trying so an event written between
+        // a failed push and the wait is not missed.
+        const uint64_t written = written_.load();
+        if (push(clone)) {
+            break;
+        }
+        if ((overflow_ != OutputOption::OVERFLOW_BLOCK) || stopping_.load()) {
+            ++dropped_;
+            delete clone;
+            return;
+        }
+        // Wait for the writer thread to make some room.
+        waitWritten(written);
+    }
+    wakeup();
+}
+
+bool
+AsyncAppender::push(log4cplus::spi::InternalLoggingEvent* event) {
+    size_t pos = enqueue_pos_.load(memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t sequence = cell->sequence_.load(memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) -
+                        static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            // The cell is free: claim it.
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                   memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The cell still holds an event: the queue is full.
+            return (false);
+        } else {
+            // Another thread claimed the cell.
+            pos = enqueue_pos_.load(memory_order_relaxed);
+        }
+    }
+    cell->event_ = event;
+    cell->sequence_.store(pos + 1, memory_order_release);
+    return (true);
+}
+
+log4cplus::spi::InternalLoggingEvent*
+AsyncAppender::pop() {
+    size_t pos = dequeue_pos_.load(memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t sequence = cell->sequence_.load(memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) -
+                        static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                   memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The queue is empty.
+            return (0);
+        } else {
+            pos = dequeue_pos_.load(memory_order_relaxed);
+        }
+    }
+    log4cplus::spi::InternalLoggingEvent* event = cell->event_;
+    cell->event_ = 0;
+    cell->sequence_.store(pos + mask_ + 1, memory_order_release);
+    return (event);
+}
+
+void
+AsyncAppender::write(log4cplus::spi::InternalLoggingEvent* event) {
+    try {
+        target_->doAppend(*event);
+    } catch (...) {
+        // Appenders report their errors through the log4cplus error
+        // handler, there is nothing more to do here.
+    }
+    delete event;
+    ++written_;
+    // Same pairing as in wakeup: a waiting thread either sees the new
+    // counter or is seen here.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (blocked_.load()) {
+        lock_guard<mutex> lock(mutex_);
+        written_cv_.notify_all();
+    }
+}
+
+void
+AsyncAppender::reportDropped() {
+    uint64_t dropped = dropped_.load();
+    if (dropped == reported_) {
+        return;
+    }
+    string text = MessageDictionary::globalDictionary()->getText(LOG_ASYNC_DROPPED);
+    replacePlaceholder(&text, boost::lexical_cast<string>(dropped - reported_), 1);
+    reported_ = dropped;
+    log4cplus::spi::InternalLoggingEvent
+        event(getRootLoggerName(), log4cplus::WARN_LOG_LEVEL,
+              string(LOG_ASYNC_DROPPED) + " " + text, __FILE__, __LINE__);
+    try {
+        target_->doAppend(event);
+    } catch (...) {
+    }
+}
+
+void
+AsyncAppender::run() {
+    for (;;) {
+        log4cplus::spi::InternalLoggingEvent* event = pop();
+        if (event) {
+            write(event);
+            continue;
+        }
+
+        // The queue is drained: time to report the dropped events.
+        if (overflow_ == OutputOption::OVERFLOW_COUNT) {
+            reportDropped();
+        }
+        if (stopping_.load()) {
+            return;
+        }
+
+        // Wait for an event. The flag is set before the queue is checked
+        // again so a logging thread either sees the flag and notifies or
+        // pushed its event before the check.
+        unique_lock<mutex> lock(mutex_);
+        waiting_.store(true);
+        atomic_thread_fence(memory_order_seq_cst);
+        event = pop();
+        if (!event && !stopping_.load()) {
+            // The timeout is only a safety net.
+            cv_.wait_for(lock, chrono::milliseconds(100));
+        }
+        waiting_.store(false);
+        lock.unlock();
+        if (event) {
+            write(event);
+        }
+    }
+}
+
+void
+AsyncAppender::wakeup() {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (waiting_.load()) {
+        lock_guard<mutex> lock(mutex_);
+        cv_.notify_one();
+    }
+}
+
+void
+AsyncAppender::waitWritten(uint64_t written) {
+    unique_lock<mutex> lock(mutex_);
+    ++blocked_;
+    atomic_thread_fence(memory_order_seq_cst);
+    // The writer thread may be waiting for events: wake it up.
+    if (waiting_.load()) {
+        cv_.notify_one();
+    }
+    while ((written_.load() == written) && !stopping_.load()) {
+        // The timeout is only a safety net.
+        written_cv_.wait_for(lock, chrono::milliseconds(100));
+    }
+    --blocked_;
+}
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
@@ -0,0 +1,183 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LOG_ASYNC_APPENDER_H
+#define LOG_ASYNC_APPENDER_H
+
+#include <log/output_option.h>
+
+#include <log4cplus/appender.h>
+#include <log4cplus/spi/loggingevent.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace isc {
+namespace log {
+namespace internal {
+
+/// \brief Asynchronous Logger Appender
+///
+/// This class wraps another appender (console, file or syslog) and moves
+/// the writing of the log events to a background thread, so a slow disk
+/// or syslog daemon does not stall the threads which log, e.g. the packet
+/// processing threads.
+///
+/// The events (which hold the already formatted Kea message) are cloned
+/// into a bounded lock-free queue drained by the writer thread, which
+/// applies the layout of the wrapped appender and writes them. When the
+/// queue is full the overflow policy applies:
+/// - OVERFLOW_BLOCK: the logging thread waits for room, no event is lost,
+/// - OVERFLOW_DROP: the event is dropped,
+/// - OVERFLOW_COUNT: the event is dropped and the writer reports the number
+///   of dropped events with the LOG_ASYNC_DROPPED message.
+///
+/// The pending events are written when the appender is closed or
+/// destroyed, i.e. when the logging is reconfigured or at shutdown.
+class AsyncAppender : public log4cplus::Appender {
+public:
+    /// \brief Constructor
+    ///
+    /// Starts the writer thread.
+    ///
+    /// \param target Appender the events are written to.
+    /// \param queue_size Capacity of the queue, rounded up to a power of 2.
+    /// \param overflow Policy when the queue is full.
+    AsyncAppender(const log4cplus::SharedAppenderPtr& target,
+                  size_t queue_size, OutputOption::Overflow overflow);
+
+    /// \brief Destructor
+    ///
+    /// Writes the pending events and stops the writer thread.
+    virtual ~AsyncAppender();
+
+    /// \brief Close the appender
+    ///
+    /// Writes the pending events, stops the writer thread and closes the
+    /// wrapped appender.
+    virtual void close();
+
+    /// \brief Waits until all queued events have been written
+    void flush();
+
+    /// \brief Returns the capacity of the queue
+    size_t getQueueSize() const {
+        return (cells_.size());
+    }
+
+    /// \brief Returns the number of dropped events
+    uint64_t getDropped() const {
+        return (dropped_.load());
+    }
+
+protected:
+    /// \brief Queues a clone of the event for the writer thread
+    ///
+    /// \param event The logging event.
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event);
+
+private:
+    /// \brief Cell of the queue
+    struct Cell {
+        /// \brief Sequence number of the cell
+        std::atomic<size_t> sequence_;
+
+        /// \brief The event, owned by the queue
+        log4cplus::spi::InternalLoggingEvent* event_;
+    };
+
+    /// \brief Pushes an event in the queue
+    ///
+    /// \param event The event.
+    /// \return false if the queue is full.
+    bool push(log4cplus::spi::InternalLoggingEvent* event);
+
+    /// \brief Pops an event from the queue
+    ///
+    /// \return The oldest event or null if the queue is empty.
+    log4cplus::spi::InternalLoggingEvent* pop();
+
+    /// \brief Writes an event with the wrapped appender and deletes it
+    ///
+    /// \param event The event.
+    void write(log4cplus::spi::InternalLoggingEvent* event);
+
+    /// \brief Writes the LOG_ASYNC_DROPPED message if events were dropped
+    void reportDropped();
+
+    /// \brief Body of the writer thread
+    void run();
+
+    /// \brief Wakes the writer thread up if it waits
+    void wakeup();
+
+    /// \brief Waits until the writer thread has written more events
+    ///
+    /// Used by the logging threads when the queue is full with the
+    /// OVERFLOW_BLOCK policy and by flush.
+    ///
+    /// \param written Number of written events to wait past.
+    void waitWritten(uint64_t written);
+
+    /// \brief The wrapped appender
+    log4cplus::SharedAppenderPtr target_;
+
+    /// \brief Overflow policy
+    OutputOption::Overflow overflow_;
+
+    /// \brief The queue
+    std::vector<Cell> cells_;
+
+    /// \brief Mask of the queue indexes
+    size_t mask_;
+
+    /// \brief Position of the next push
+    std::atomic<size_t> enqueue_pos_;
+
+    /// \brief Position of the next pop
+    std::atomic<size_t> dequeue_pos_;
+
+    /// \brief Number of dropped events
+    std::atomic<uint64_t> dropped_;
+
+    /// \brief Number of dropped events already reported
+    uint64_t reported_;
+
+    /// \brief Number of events written by the writer thread
+    std::atomic<uint64_t> written_;
+
+    /// \brief True when the writer thread waits for events
+    std::atomic<bool> waiting_;
+
+    /// \brief Number of threads waiting for the writer thread
+    std::atomic<unsigned> blocked_;
+
+    /// \brief True when the writer thread must terminate
+    std::atomic<bool> stopping_;
+
+    /// \brief Mutex of the condition variable
+    std::mutex mutex_;
+
+    /// \brief Condition variable the writer thread waits on
+    std::condition_variable cv_;
+
+    /// \brief Condition variable the threads waiting for the writer
+    /// thread wait on
+    std::condition_variable written_cv_;
+
+    /// \brief The writer thread
+    std::thread writer_;
+};
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
+
+#endif // LOG_ASYNC_APPENDER_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #include <log/log_formatter.h>
 
 #include <cassert>
+#include <cstring>
 
 #ifdef ENABLE_LOGGER_CHECKS
 #include <iostream>
@@ -16,9 +17,193 @@
 using namespace std;
 using namespace boost;
 
+namespace {
+
+/// \brief Maximum length of a formatted integer
+const size_t NUMBER_SIZE = 24;
+
+/// \brief Converts an unsigned integer to decimal
+///
+/// \param end End of the buffer the digits are written into.
+/// \param value The integer.
+///
+/// \return Pointer to the first digit.
+char*
+formatUnsigned(char* end, unsigned long long value) {
+    do {
+        *--end = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    return (end);
+}
+
+/// \brief The thread buffer of MessageBuffer
+thread_local std::string thread_buffer;
+
+/// \brief True when the thread buffer is in use
+thread_local bool thread_buffer_used = false;
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace log {
 
+FormatterArgs::FormatterArgs(const FormatterArgs& other)
+    : size_(0), count_(0), heap_(), more_ends_() {
+    *this = other;
+}
+
+FormatterArgs&
+FormatterArgs::operator=(const FormatterArgs& other) {
+    if (&other != this) {
+        size_ = other.size_;
+        count_ = other.count_;
+        heap_ = other.heap_;
+        more_ends_ = other.more_ends_;
+        if (heap_.empty()) {
+            memcpy(inline_, other.inline_, size_);
+        }
+        memcpy(ends_, other.ends_,
+               (count_ < INLINE_ARGS ? count_ : INLINE_ARGS) * sizeof(size_t));
+    }
+    return (*this);
+}
+
+void
+FormatterArgs::add(const char* data, size_t length) {
+    if (heap_.empty() && (size_ + length > INLINE_SIZE)) {
+        // Move to the heap.
+        heap_.reserve(2 * (size_ + length));
+        heap_.assign(inline_, size_);
+    }
+    if (heap_.empty()) {
+        memcpy(inline_ + size_, data, length);
+    } else {
+        heap_.append(data, length);
+    }
+    size_ += length;
+    if (count_ < INLINE_ARGS) {
+        ends_[count_] = size_;
+    } else {
+        more_ends_.push_back(size_);
+    }
+    ++count_;
+}
+
+void
+FormatterArgs::addNumber(long long value) {
+    if (value >= 0) {
+        addNumber(static_cast<unsigned long long>(value));
+        return;
+    }
+    char buffer[NUMBER_SIZE];
+    char* end = buffer + NUMBER_SIZE;
+    // The magnitude is computed unsigned so the minimum value works.
+    char* start = formatUnsigned(end, 0ULL - static_cast<unsigned long long>(value));
+    *--start = '-';
+    add(start, end - start);
+}
+
+void
+FormatterArgs::addNumber(unsigned long long value) {
+    char buffer[NUMBER_SIZE];
+    char* end = buffer + NUMBER_SIZE;
+    char* start = formatUnsigned(end, value);
+    add(start, end - start);
+}
+
+void
+FormatterArgs::clear() {
+    size_ = 0;
+    count_ = 0;
+    heap_.clear();
+    more_ends_.clear();
+}
+
+MessageBuffer::MessageBuffer() : buffer_(&local_), local_() {
+    if (!thread_buffer_used) {
+        thread_buffer_used = true;
+        buffer_ = &thread_buffer;
+    }
+    buffer_->clear();
+}
+
+MessageBuffer::~MessageBuffer() {
+    if (buffer_ == &thread_buffer) {
+        thread_buffer_used = false;
+    }
+}
+
+void
+checkPlaceholder(const MessageTemplate& message_template,
+                 unsigned placeholder) {
+#ifdef ENABLE_LOGGER_CHECKS
+    if (!message_template.hasPlaceholder(placeholder)) {
+        // We're missing the placeholder, so throw an exception
+        isc_throw(MismatchedPlaceholders,
+                  "Missing logger placeholder in message: "
+                  << message_template.getText());
+    }
+#else
+    static_cast<void>(message_template);
+    static_cast<void>(placeholder);
+#endif /* ENABLE_LOGGER_CHECKS */
+}
+
+void
+formatMessage(const MessageTemplate& message_template,
+              const FormatterArgs& args, string& message) {
+    const string& text = message_template.getText();
+    message.reserve(text.size() + args.getTotalLength());
+
+    // Substitute the placeholders in one pass.
+    bool excess = false;
+    const vector<MessageTemplate::Segment>& segments =
+        message_template.getSegments();
+    for (vector<MessageTemplate::Segment>::const_iterator segment =
+             segments.begin(); segment != segments.end(); ++segment) {
+        message.append(text, segment->offset_, segment->length_);
+        if (segment->placeholder_ == 0) {
+            continue;
+        }
+        if (segment->placeholder_ <= args.size()) {
+            const unsigned index = segment->placeholder_ - 1;
+            message.append(args.getData(index), args.getLength(index));
+        } else {
+            // No argument: keep the placeholder.
+            excess = true;
+            message.append(text, segment->offset_ + segment->length_,
+                           segment->mark_length_);
+        }
+    }
+
+    // Complain about the arguments without a placeholder. With the logger
+    // checks this was already caught by checkPlaceholder().
+    for (unsigned placeholder = 1; placeholder <= args.size(); ++placeholder) {
+        if (!message_template.hasPlaceholder(placeholder)) {
+            char buffer[NUMBER_SIZE];
+            char* end = buffer + NUMBER_SIZE;
+            char* start = formatUnsigned(end, placeholder);
+            message.append(" @@Missing placeholder %");
+            message.append(start, end - start);
+            message.append(" for '");
+            message.append(args.getData(placeholder - 1),
+                           args.getLength(placeholder - 1));
+            message.append("'@@");
+        }
+    }
+
+    if (excess) {
+        // See checkExcessPlaceholders().
+#ifdef ENABLE_LOGGER_CHECKS
+        cerr << "Message " << message << endl;
+        assert("Excess logger placeholders still exist in message" == NULL);
+#else
+        message.append(" @@Excess logger placeholders still exist@@");
+#endif /* ENABLE_LOGGER_CHECKS */
+    }
+}
+
 void
 replacePlaceholder(string* message, const string& arg,
                    const unsigned placeholder)
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,10 +10,14 @@
 #include <cstddef>
 #include <string>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
 #include <exceptions/exceptions.h>
 #include <boost/lexical_cast.hpp>
+#include <boost/noncopyable.hpp>
 #include <log/logger_level.h>
+#include <log/message_template.h>
 
 namespace isc {
 namespace log {
@@ -62,6 +66,181 @@ void
 replacePlaceholder(std::string* message, const std::string& replacement,
                    const unsigned placeholder);
 
+///
+/// \brief Arguments of a message
+///
+/// This is used internally by the Formatter. The text of the arguments is
+/// stored back to back in an inline buffer, so capturing the arguments of
+/// a message does not allocate memory unless they are long or numerous.
+/// Integers are converted in place, without a temporary string.
+class FormatterArgs {
+public:
+    /// \brief Size of the inline buffer
+    static const size_t INLINE_SIZE = 256;
+
+    /// \brief Number of arguments whose end offsets are stored inline
+    static const unsigned INLINE_ARGS = 16;
+
+    /// \brief Constructor
+    FormatterArgs() : size_(0), count_(0), heap_(), more_ends_() {
+    }
+
+    /// \brief Copy constructor
+    ///
+    /// Only the used part of the inline buffer is copied.
+    FormatterArgs(const FormatterArgs& other);
+
+    /// \brief Assignment operator
+    FormatterArgs& operator=(const FormatterArgs& other);
+
+    /// \brief Adds an argument
+    ///
+    /// \param data Text of the argument.
+    /// \param length Length of the text.
+    void add(const char* data, size_t length);
+
+    /// \brief Adds a signed integer argument
+    ///
+    /// \param value The argument.
+    void addNumber(long long value);
+
+    /// \brief Adds an unsigned integer argument
+    ///
+    /// \param value The argument.
+    void addNumber(unsigned long long value);
+
+    /// \brief Returns the number of arguments
+    unsigned size() const {
+        return (count_);
+    }
+
+    /// \brief Returns the total length of the arguments
+    size_t getTotalLength() const {
+        return (size_);
+    }
+
+    /// \brief Returns the text of an argument
+    ///
+    /// \param index Index of the argument, from 0.
+    const char* getData(unsigned index) const {
+        return (data() + (index == 0 ? 0 : getEnd(index - 1)));
+    }
+
+    /// \brief Returns the length of an argument
+    ///
+    /// \param index Index of the argument, from 0.
+    size_t getLength(unsigned index) const {
+        return (getEnd(index) - (index == 0 ? 0 : getEnd(index - 1)));
+    }
+
+    /// \brief Removes all arguments
+    void clear();
+
+private:
+    /// \brief Returns the storage of the text
+    const char* data() const {
+        return (heap_.empty() ? inline_ : heap_.data());
+    }
+
+    /// \brief Returns the end offset of an argument
+    size_t getEnd(unsigned index) const {
+        return (index < INLINE_ARGS ? ends_[index] :
+                more_ends_[index - INLINE_ARGS]);
+    }
+
+    /// \brief The inline buffer
+    char inline_[INLINE_SIZE];
+
+    /// \brief Total length of the arguments
+    size_t size_;
+
+    /// \brief Number of arguments
+    unsigned count_;
+
+    /// \brief End offsets of the first arguments
+    size_t ends_[INLINE_ARGS];
+
+    /// \brief Storage of the text when the inline buffer is too small
+    std::string heap_;
+
+    /// \brief End offsets of the other arguments
+    std::vector<size_t> more_ends_;
+};
+
+/// \brief Type trait selecting the arguments converted as integers
+///
+/// Character types are excluded: they are written as characters.
+template<class Arg> struct IsNumericArg :
+    public std::integral_constant<bool,
+        std::is_integral<Arg>::value &&
+        !std::is_same<Arg, char>::value &&
+        !std::is_same<Arg, signed char>::value &&
+        !std::is_same<Arg, unsigned char>::value &&
+        !std::is_same<Arg, wchar_t>::value &&
+        !std::is_same<Arg, char16_t>::value &&
+        !std::is_same<Arg, char32_t>::value> {
+};
+
+///
+/// \brief Internal argument checker
+///
+/// This is used internally by the Formatter when an argument is added.
+/// When logger checks are enabled it throws MismatchedPlaceholders if the
+/// message has no placeholder for the argument, else it does nothing.
+///
+/// \param message_template The message.
+/// \param placeholder Number of the argument.
+void
+checkPlaceholder(const MessageTemplate& message_template, unsigned placeholder);
+
+///
+/// \brief The internal substitution routine
+///
+/// This is used internally by the Formatter. Builds the message from its
+/// template and its arguments. The arguments without a placeholder and the
+/// placeholders without an argument are reported at the end of the message
+/// as replacePlaceholder() and checkExcessPlaceholders() do.
+///
+/// \param message_template The message.
+/// \param args The arguments.
+/// \param message The string receiving the message.
+void
+formatMessage(const MessageTemplate& message_template,
+              const FormatterArgs& args, std::string& message);
+
+///
+/// \brief Buffer for the formatted message
+///
+/// This is used internally by the Formatter. Each thread has a string
+/// which keeps its capacity between the messages so building a message
+/// does not allocate memory once the thread has logged a long enough one.
+/// When the thread buffer is in use, e.g. a message is logged while
+/// another one is written, a local string is used.
+class MessageBuffer : public boost::noncopyable {
+public:
+    /// \brief Constructor
+    ///
+    /// Takes the thread buffer if it is free.
+    MessageBuffer();
+
+    /// \brief Destructor
+    ///
+    /// Releases the thread buffer.
+    ~MessageBuffer();
+
+    /// \brief Returns the buffer
+    std::string& get() {
+        return (*buffer_);
+    }
+
+private:
+    /// \brief The buffer
+    std::string* buffer_;
+
+    /// \brief The local string
+    std::string local_;
+};
+
 ///
 /// \brief The log message formatter
 ///
@@ -84,6 +263,12 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// Of course, if the logging is turned off, we don't bother with any replacing
 /// and just return.
 ///
+/// The arguments are not substituted by the .arg calls: they are converted
+/// to text into a small inline buffer and the message is built once, in the
+/// destructor, from the template parsed when the message was registered in
+/// the dictionary. So the usual message is formatted without any memory
+/// allocation.
+///
 /// User of logging code should not really care much about this class, only
 /// call the .arg method to generate the correct output.
 ///
@@ -109,12 +294,11 @@ private:
     /// \brief Message severity
     Severity severity_;
 
-    /// \brief The messages with %1, %2... placeholders
-    std::string* message_;
-
-    /// \brief Which will be the next placeholder to replace
-    unsigned nextPlaceholder_;
+    /// \brief The message with %1, %2... placeholders
+    MessageTemplatePtr template_;
 
+    /// \brief The arguments
+    FormatterArgs args_;
 
 public:
     /// \brief Constructor of "active" formatter
@@ -127,14 +311,33 @@ public:
     ///
     /// \param severity The severity of the message (DEBUG, ERROR etc.)
     /// \param message The message with placeholders. We take ownership of
-    ///     it and we will modify the string. Must not be NULL unless
-    ///     logger is also NULL, but it's not checked.
+    ///     it. Must not be NULL unless logger is also NULL, but it's not
+    ///     checked.
     /// \param logger The logger where the final output will go, or NULL
     ///     if no output is wanted.
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
               Logger* logger = NULL) :
-        logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        logger_(logger), severity_(severity), template_(), args_()
+    {
+        if (logger_) {
+            template_.reset(new MessageTemplate(*message));
+            delete message;
+        }
+    }
+
+    /// \brief Constructor of "active" formatter from a parsed message
+    ///
+    /// This is the constructor used by the Logger: the message template
+    /// comes from the message dictionary so the text is neither copied
+    /// nor parsed.
+    ///
+    /// \param severity The severity of the message (DEBUG, ERROR etc.)
+    /// \param message_template The message. Must not be null.
+    /// \param logger The logger where the final output will go.
+    Formatter(const Severity& severity,
+              const MessageTemplatePtr& message_template, Logger* logger) :
+        logger_(logger), severity_(severity), template_(message_template),
+        args_()
     {
     }
 
@@ -145,7 +348,7 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        template_(other.template_), args_(other.args_)
     {
         other.logger_ = NULL;
     }
@@ -153,15 +356,16 @@ public:
     /// \brief Destructor.
     //
     /// This is the place where output happens if the formatter is active.
+    /// The arguments are substituted here, once.
     ~ Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(message_, ++nextPlaceholder_);
-                logger_->output(severity_, *message_);
+                MessageBuffer buffer;
+                formatMessage(*template_, args_, buffer.get());
+                logger_->output(severity_, buffer.get());
             } catch (...) {
                 // Catch and ignore all exceptions here.
             }
-            delete message_;
         }
     }
 
@@ -173,8 +377,8 @@ public:
         if (&other != this) {
             logger_ = other.logger_;
             severity_ = other.severity_;
-            message_ = other.message_;
-            nextPlaceholder_ = other.nextPlaceholder_;
+            template_ = other.template_;
+            args_ = other.args_;
             other.logger_ = NULL;
         }
 
@@ -183,15 +387,18 @@ public:
 
     /// \brief Replaces another placeholder
     ///
-    /// Replaces another placeholder and returns a new formatter with it.
-    /// Deactivates the current formatter. In case the formatter is not active,
-    /// only produces another inactive formatter.
+    /// Adds the argument for the next placeholder and returns the formatter.
+    /// In case the formatter is not active, does nothing.
+    ///
+    /// Integers are converted in place, the other types are converted
+    /// with boost::lexical_cast.
     ///
     /// \param value The argument to place into the placeholder.
     template<class Arg> Formatter& arg(const Arg& value) {
         if (logger_) {
             try {
-                return (arg(boost::lexical_cast<std::string>(value)));
+                addArg(value, IsNumericArg<Arg>());
+                checkPlaceholder(*template_, args_.size());
             } catch (const boost::bad_lexical_cast& ex) {
                 // The formatting of the log message got wrong, we don't want
                 // to output it.
@@ -206,31 +413,7 @@ public:
                 // attempt to do so here would probably fail as well.)
                 isc_throw(FormatFailure, "bad_lexical_cast in call to "
                           "Formatter::arg(): " << ex.what());
-            }
-        } else {
-            return (*this);
-        }
-    }
-
-    /// \brief String version of arg.
-    ///
-    /// \param arg The text to place into the placeholder.
-    Formatter& arg(const std::string& arg) {
-        if (logger_) {
-            // Note that this method does a replacement and returns the
-            // modified string. If there are multiple invocations of arg() (e.g.
-            // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
-            // operates on the string returned by the previous one. This
-            // sequential operation means that if we had a message like "%1 %2",
-            // and called .arg("%2").arg(42), we would get "42 42"; the first
-            // call replaces the %1" with "%2" and the second replaces all
-            // occurrences of "%2" with 42. (Conversely, the sequence
-            // .arg(42).arg("%1") would return "42 %1" - there are no recursive
-            // replacements).
-            try {
-                replacePlaceholder(message_, arg, ++nextPlaceholder_ );
-            }
-            catch (...) {
+            } catch (...) {
                 // Something went wrong here, the log message is broken, so
                 // we don't want to output it, nor we want to check all the
                 // placeholders were used (because they won't be).
@@ -241,6 +424,20 @@ public:
         return (*this);
     }
 
+    /// \brief String version of arg.
+    ///
+    /// \param arg The text to place into the placeholder.
+    Formatter& arg(const std::string& arg) {
+        return (addText(arg.data(), arg.size()));
+    }
+
+    /// \brief C string version of arg.
+    ///
+    /// \param arg The text to place into the placeholder.
+    Formatter& arg(const char* arg) {
+        return (addText(arg, std::char_traits<char>::length(arg)));
+    }
+
     /// \brief Turn off the output of this logger.
     ///
     /// If the logger would output anything at the end, now it won't.
@@ -251,11 +448,51 @@ public:
     /// the arguments for the message.
     void deactivate() {
         if (logger_) {
-            delete message_;
-            message_ = NULL;
+            template_.reset();
+            args_.clear();
             logger_ = NULL;
         }
     }
+
+private:
+    /// \brief Adds a text argument
+    ///
+    /// The placeholders are substituted when the message is output so
+    /// an argument is never searched for placeholders: if we had a
+    /// message like "%1 %2" and called .arg("%2").arg(42), we would get
+    /// "%2 42".
+    ///
+    /// \param data The text.
+    /// \param length Length of the text.
+    Formatter& addText(const char* data, size_t length) {
+        if (logger_) {
+            try {
+                args_.add(data, length);
+                checkPlaceholder(*template_, args_.size());
+            } catch (...) {
+                deactivate();
+                throw;
+            }
+        }
+        return (*this);
+    }
+
+    /// \brief Adds an integer argument
+    ///
+    /// \param value The argument.
+    template<class Arg> void addArg(const Arg& value, std::true_type) {
+        typedef typename std::conditional<std::is_signed<Arg>::value,
+            long long, unsigned long long>::type Number;
+        args_.addNumber(static_cast<Number>(value));
+    }
+
+    /// \brief Adds an argument converted by lexical_cast
+    ///
+    /// \param value The argument.
+    template<class Arg> void addArg(const Arg& value, std::false_type) {
+        const std::string text(boost::lexical_cast<std::string>(value));
+        args_.add(text.data(), text.size());
+    }
 };
 
 }
@@ -9,6 +9,7 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_DROPPED = "LOG_ASYNC_DROPPED";
 extern const isc::log::MessageID LOG_BAD_DESTINATION = "LOG_BAD_DESTINATION";
 extern const isc::log::MessageID LOG_BAD_SEVERITY = "LOG_BAD_SEVERITY";
 extern const isc::log::MessageID LOG_BAD_STREAM = "LOG_BAD_STREAM";
@@ -25,6 +26,7 @@ extern const isc::log::MessageID LOG_NO_SUCH_MESSAGE = "LOG_NO_SUCH_MESSAGE";
 extern const isc::log::MessageID LOG_OPEN_OUTPUT_FAIL = "LOG_OPEN_OUTPUT_FAIL";
 extern const isc::log::MessageID LOG_PREFIX_EXTRA_ARGS = "LOG_PREFIX_EXTRA_ARGS";
 extern const isc::log::MessageID LOG_PREFIX_INVALID_ARG = "LOG_PREFIX_INVALID_ARG";
+extern const isc::log::MessageID LOG_RATE_LIMITED = "LOG_RATE_LIMITED";
 extern const isc::log::MessageID LOG_READING_LOCAL_FILE = "LOG_READING_LOCAL_FILE";
 extern const isc::log::MessageID LOG_READ_ERROR = "LOG_READ_ERROR";
 extern const isc::log::MessageID LOG_UNRECOGNIZED_DIRECTIVE = "LOG_UNRECOGNIZED_DIRECTIVE";
@@ -36,6 +38,7 @@ extern const isc::log::MessageID LOG_WRITE_ERROR = "LOG_WRITE_ERROR";
 namespace {
 
 const char* values[] = {
+    "LOG_ASYNC_DROPPED", "%1 log messages dropped because the logging queue was full",
     "LOG_BAD_DESTINATION", "unrecognized log destination: %1",
     "LOG_BAD_SEVERITY", "unrecognized log severity: %1",
     "LOG_BAD_STREAM", "bad log console output stream: %1",
@@ -52,6 +55,7 @@ const char* values[] = {
     "LOG_OPEN_OUTPUT_FAIL", "unable to open %1 for output: %2",
     "LOG_PREFIX_EXTRA_ARGS", "line %1: $PREFIX directive has too many arguments",
     "LOG_PREFIX_INVALID_ARG", "line %1: $PREFIX directive has an invalid argument ('%2')",
+    "LOG_RATE_LIMITED", "%1 messages %2 were suppressed by the rate limit",
     "LOG_READING_LOCAL_FILE", "reading local message file %1",
     "LOG_READ_ERROR", "error reading from message file %1: %2",
     "LOG_UNRECOGNIZED_DIRECTIVE", "line %1: unrecognized directive '%2'",
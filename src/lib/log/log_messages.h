@@ -8,6 +8,7 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_DROPPED;
 extern const isc::log::MessageID LOG_BAD_DESTINATION;
 extern const isc::log::MessageID LOG_BAD_SEVERITY;
 extern const isc::log::MessageID LOG_BAD_STREAM;
@@ -24,6 +25,7 @@ extern const isc::log::MessageID LOG_NO_SUCH_MESSAGE;
 extern const isc::log::MessageID LOG_OPEN_OUTPUT_FAIL;
 extern const isc::log::MessageID LOG_PREFIX_EXTRA_ARGS;
 extern const isc::log::MessageID LOG_PREFIX_INVALID_ARG;
+extern const isc::log::MessageID LOG_RATE_LIMITED;
 extern const isc::log::MessageID LOG_READING_LOCAL_FILE;
 extern const isc::log::MessageID LOG_READ_ERROR;
 extern const isc::log::MessageID LOG_UNRECOGNIZED_DIRECTIVE;
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,7 +13,9 @@
 #include <log/logger_impl.h>
 #include <log/logger_name.h>
 #include <log/logger_support.h>
+#include <log/log_messages.h>
 #include <log/message_dictionary.h>
+#include <log/message_rate_limiter.h>
 #include <log/message_types.h>
 
 #include <util/strutil.h>
@@ -136,8 +138,8 @@ Logger::output(const Severity& severity, const std::string& message) {
 
 Logger::Formatter
 Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
-    if (isDebugEnabled(dbglevel)) {
-        return (Formatter(DEBUG, getLoggerPtr()->lookupMessage(ident),
+    if (isDebugEnabled(dbglevel) && checkRate(DEBUG, ident)) {
+        return (Formatter(DEBUG, getLoggerPtr()->lookupTemplate(ident),
                           this));
     } else {
         return (Formatter());
@@ -146,8 +148,8 @@ Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::info(const isc::log::MessageID& ident) {
-    if (isInfoEnabled()) {
-        return (Formatter(INFO, getLoggerPtr()->lookupMessage(ident),
+    if (isInfoEnabled() && checkRate(INFO, ident)) {
+        return (Formatter(INFO, getLoggerPtr()->lookupTemplate(ident),
                           this));
     } else {
         return (Formatter());
@@ -156,8 +158,8 @@ Logger::info(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::warn(const isc::log::MessageID& ident) {
-    if (isWarnEnabled()) {
-        return (Formatter(WARN, getLoggerPtr()->lookupMessage(ident),
+    if (isWarnEnabled() && checkRate(WARN, ident)) {
+        return (Formatter(WARN, getLoggerPtr()->lookupTemplate(ident),
                           this));
     } else {
         return (Formatter());
@@ -166,8 +168,8 @@ Logger::warn(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::error(const isc::log::MessageID& ident) {
-    if (isErrorEnabled()) {
-        return (Formatter(ERROR, getLoggerPtr()->lookupMessage(ident),
+    if (isErrorEnabled() && checkRate(ERROR, ident)) {
+        return (Formatter(ERROR, getLoggerPtr()->lookupTemplate(ident),
                           this));
     } else {
         return (Formatter());
@@ -176,14 +178,39 @@ Logger::error(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::fatal(const isc::log::MessageID& ident) {
-    if (isFatalEnabled()) {
-        return (Formatter(FATAL, getLoggerPtr()->lookupMessage(ident),
+    if (isFatalEnabled() && checkRate(FATAL, ident)) {
+        return (Formatter(FATAL, getLoggerPtr()->lookupTemplate(ident),
                           this));
     } else {
         return (Formatter());
     }
 }
 
+// Check the rate limit of a message
+
+bool
+Logger::checkRate(const Severity& severity, const MessageID& ident) {
+    MessageRateLimiter& limiter = MessageRateLimiter::instance();
+    if (!limiter.isEnabled()) {
+        return (true);
+    }
+    uint64_t suppressed = 0;
+    const bool allowed = limiter.check(ident, suppressed, name_, severity);
+    if (suppressed > 0) {
+        reportSuppressed(severity, ident, suppressed);
+    }
+    return (allowed);
+}
+
+// Report suppressed messages
+
+void
+Logger::reportSuppressed(const Severity& severity, const MessageID& ident,
+                         uint64_t suppressed) {
+    Formatter(severity, getLoggerPtr()->lookupTemplate(LOG_RATE_LIMITED),
+              this).arg(suppressed).arg(ident);
+}
+
 // Replace the interprocess synchronization object
 
 void
@@ -203,6 +203,17 @@ public:
     /// \return The full name of the logger (including the root name)
     virtual std::string getName();
 
+    /// \brief Reports suppressed messages
+    ///
+    /// Logs the LOG_RATE_LIMITED message with the severity of the
+    /// suppressed messages.
+    ///
+    /// \param severity Severity of the suppressed messages.
+    /// \param ident Identification of the suppressed messages.
+    /// \param suppressed Number of suppressed messages.
+    void reportSuppressed(const Severity& severity, const MessageID& ident,
+                          uint64_t suppressed);
+
     /// \brief Set Severity Level for Logger
     ///
     /// Sets the level at which this logger will log messages.  If none is set,
@@ -320,6 +331,17 @@ private:
     /// \param message Text of the message to be output.
     void output(const Severity& severity, const std::string& message);
 
+    /// \brief Checks the rate limit of a message
+    ///
+    /// Reports the messages suppressed during the previous interval, if
+    /// any, with the LOG_RATE_LIMITED message.
+    ///
+    /// \param severity Severity of the message.
+    /// \param ident Message identification.
+    ///
+    /// \return true if the message can be logged.
+    bool checkRate(const Severity& severity, const MessageID& ident);
+
     /// \brief Copy Constructor
     ///
     /// Disabled (marked private) as it makes no sense to copy the logger -
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -134,6 +134,18 @@ LoggerImpl::lookupMessage(const MessageID& ident) {
                        MessageDictionary::globalDictionary()->getText(ident)));
 }
 
+// Output a general message from its cached template
+MessageTemplatePtr
+LoggerImpl::lookupTemplate(const MessageID& ident) {
+    MessageTemplatePtr message_template =
+        MessageDictionary::globalDictionary()->getTemplate(ident);
+    if (!message_template) {
+        // Unknown message: output its ID only, as lookupMessage() does.
+        message_template.reset(new MessageTemplate(string(ident) + " "));
+    }
+    return (message_template);
+}
+
 // Replace the interprocess synchronization object
 
 void
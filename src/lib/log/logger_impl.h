@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,6 +23,7 @@
 
 // Kea logger files
 #include <log/logger_level_impl.h>
+#include <log/message_template.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync.h>
 
@@ -165,6 +166,12 @@ public:
     /// This gets you the unformatted text of message for given ID.
     std::string* lookupMessage(const MessageID& id);
 
+    /// \brief Look up parsed message in dictionary
+    ///
+    /// This gets you the parsed text of message for given ID, prefixed
+    /// with the ID, without copying it.
+    MessageTemplatePtr lookupTemplate(const MessageID& id);
+
     /// \brief Replace the interprocess synchronization object
     ///
     /// If this method is called with NULL as the argument, it throws a
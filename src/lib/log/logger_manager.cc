@@ -20,6 +20,7 @@
 #include <log/message_exception.h>
 #include <log/message_initializer.h>
 #include <log/message_initializer.h>
+#include <log/message_rate_limiter.h>
 #include <log/message_reader.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync_null.h>
@@ -79,6 +80,8 @@ LoggerManager::~LoggerManager() {
 // Initialize processing
 void
 LoggerManager::processInit() {
+    // The suppressed messages are reported with the former configuration.
+    flushRateLimits();
     impl_->processInit();
 }
 
@@ -199,6 +202,22 @@ LoggerManager::readLocalMessageFile(const char* file) {
     }
 }
 
+// Report the messages suppressed by the rate limits
+void
+LoggerManager::flushRateLimits() {
+    MessageRateLimiter::PendingList pending;
+    MessageRateLimiter::instance().flush(pending);
+    for (MessageRateLimiter::PendingList::const_iterator it = pending.begin();
+         it != pending.end(); ++it) {
+        if (it->logger_.empty()) {
+            continue;
+        }
+        Logger logger(it->logger_.c_str());
+        logger.reportSuppressed(it->severity_, it->ident_.c_str(),
+                                it->suppressed_);
+    }
+}
+
 // Reset logging to settings passed to init()
 void
 LoggerManager::reset() {
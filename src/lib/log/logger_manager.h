@@ -121,6 +121,15 @@ public:
     /// hooks library is loaded.
     static void logDuplicatedMessages();
 
+    /// \brief Report the messages suppressed by the rate limits.
+    ///
+    /// The number of messages suppressed by a rate limit is reported when
+    /// the next message with the same ID is logged. This method reports
+    /// the numbers which were not reported yet. It is called by the
+    /// \c process() methods before the logging is reconfigured and by the
+    /// daemons when they shut down.
+    static void flushRateLimits();
+
     /// \brief Reset logging
     ///
     /// Resets logging to whatever was set in the call to init(), expect for
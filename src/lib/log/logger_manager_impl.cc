@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,6 +26,8 @@
 #include <log/log_messages.h>
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
+#include <log/message_rate_limiter.h>
+#include <log/async_appender_impl.h>
 #include <log/buffer_appender_impl.h>
 
 #include <boost/lexical_cast.hpp>
@@ -47,6 +49,9 @@ LoggerManagerImpl::processInit() {
 
     log4cplus::Logger::getDefaultHierarchy().resetConfiguration();
     initRootLogger();
+
+    // The rate limits are set again by the specifications.
+    MessageRateLimiter::instance().clear();
 }
 
 // Flush the BufferAppenders at the end of processing a new specification
@@ -69,6 +74,14 @@ LoggerManagerImpl::processSpecification(const LoggerSpecification& spec) {
     // Set the additive flag.
     logger.setAdditivity(spec.getAdditive());
 
+    // Set the rate limits of the messages.
+    const std::vector<std::string>& rate_limited = spec.getRateLimitedMessages();
+    for (std::vector<std::string>::const_iterator ident = rate_limited.begin();
+         ident != rate_limited.end(); ++ident) {
+        MessageRateLimiter::instance().setLimit(*ident, spec.getRateLimit(),
+                                                spec.getRateLimitInterval());
+    }
+
     // Output options given?
     if (spec.optionCount() > 0) {
         // Replace all appenders for this logger.
@@ -114,7 +127,7 @@ LoggerManagerImpl::createConsoleAppender(log4cplus::Logger& logger,
 
     setAppenderLayout(console, (opt.pattern.empty() ?
                                 OutputOption::DEFAULT_CONSOLE_PATTERN : opt.pattern));
-    logger.addAppender(console);
+    addAppender(logger, console, opt);
 }
 
 // File appender.  Depending on whether a maximum size is given, either
@@ -150,7 +163,7 @@ LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
 
     setAppenderLayout(fileapp, (opt.pattern.empty() ?
                                 OutputOption::DEFAULT_FILE_PATTERN : opt.pattern));
-    logger.addAppender(fileapp);
+    addAppender(logger, fileapp, opt);
 }
 
 void
@@ -175,7 +188,25 @@ LoggerManagerImpl::createSyslogAppender(log4cplus::Logger& logger,
         new log4cplus::SysLogAppender(properties));
     setAppenderLayout(syslogapp, (opt.pattern.empty() ?
                                   OutputOption::DEFAULT_SYSLOG_PATTERN : opt.pattern));
-    logger.addAppender(syslogapp);
+    addAppender(logger, syslogapp, opt);
+}
+
+// Attach an appender to a logger.  When the output is asynchronous the
+// appender is wrapped by an appender which writes the events from a
+// background thread.
+void
+LoggerManagerImpl::addAppender(log4cplus::Logger& logger,
+                               log4cplus::SharedAppenderPtr& appender,
+                               const OutputOption& opt)
+{
+    if (opt.async) {
+        log4cplus::SharedAppenderPtr asyncapp(
+            new internal::AsyncAppender(appender, opt.async_queue_size,
+                                        opt.async_overflow));
+        logger.addAppender(asyncapp);
+    } else {
+        logger.addAppender(appender);
+    }
 }
 
 
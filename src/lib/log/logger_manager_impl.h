@@ -125,6 +125,18 @@ private:
     static void createSyslogAppender(log4cplus::Logger& logger,
                                      const OutputOption& opt);
 
+    /// \brief Attach an appender to a logger
+    ///
+    /// If the output options ask for asynchronous writing, the appender is
+    /// wrapped by an \c internal::AsyncAppender which is attached instead.
+    ///
+    /// \param logger Log4cplus logger to which the appender must be attached.
+    /// \param appender The appender.
+    /// \param opt Output options for this appender.
+    static void addAppender(log4cplus::Logger& logger,
+                            log4cplus::SharedAppenderPtr& appender,
+                            const OutputOption& opt);
+
     /// \brief Create buffered appender
     ///
     /// Appends an object to the logger that will store the log events sent
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,6 +21,8 @@
 /// Unlike OutputOption (which is a struct), this contains a bit more
 /// structure and is concealed in a class.
 
+#include <stdint.h>
+#include <string>
 #include <vector>
 
 namespace isc {
@@ -42,7 +44,7 @@ public:
                         isc::log::Severity severity = isc::log::INFO,
                         int dbglevel = 0, bool additive = false) :
         name_(name), severity_(severity), dbglevel_(dbglevel),
-        additive_(additive)
+        additive_(additive), rate_limit_(0), rate_limit_interval_(0)
     {}
 
     /// \brief Set the name of the logger.
@@ -125,6 +127,37 @@ public:
         return options_.size();
     }
 
+    /// \brief Set the rate limit.
+    ///
+    /// \param limit Maximum number of rate limited messages per interval.
+    /// \param interval Length of the interval in seconds.
+    void setRateLimit(uint32_t limit, uint32_t interval) {
+        rate_limit_ = limit;
+        rate_limit_interval_ = interval;
+    }
+
+    /// \return Return the maximum number of messages per interval.
+    uint32_t getRateLimit() const {
+        return rate_limit_;
+    }
+
+    /// \return Return the length of the rate limit interval in seconds.
+    uint32_t getRateLimitInterval() const {
+        return rate_limit_interval_;
+    }
+
+    /// \brief Add a rate limited message.
+    ///
+    /// \param ident Identification of the message.
+    void addRateLimitedMessage(const std::string& ident) {
+        rate_limited_.push_back(ident);
+    }
+
+    /// \return Return the identifications of the rate limited messages.
+    const std::vector<std::string>& getRateLimitedMessages() const {
+        return rate_limited_;
+    }
+
     /// \brief Reset back to defaults.
     void reset() {
         name_ = "";
@@ -132,6 +165,9 @@ public:
         dbglevel_ = 0;
         additive_ = false;
         options_.clear();
+        rate_limit_ = 0;
+        rate_limit_interval_ = 0;
+        rate_limited_.clear();
     }
 
 private:
@@ -140,6 +176,9 @@ private:
     int                         dbglevel_;      ///< Debug level
     bool                        additive_;      ///< Chaining output
     std::vector<OutputOption>   options_;       ///< Logger options
+    uint32_t                    rate_limit_;    ///< Messages per interval
+    uint32_t                    rate_limit_interval_; ///< Interval (seconds)
+    std::vector<std::string>    rate_limited_;  ///< Rate limited messages
 };
 
 } // namespace log
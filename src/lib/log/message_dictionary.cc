@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -17,7 +17,8 @@ namespace log {
 
 // Constructor
 
-MessageDictionary::MessageDictionary() : dictionary_(), empty_("") {
+MessageDictionary::MessageDictionary()
+    : dictionary_(), templates_(), empty_("") {
 }
 
 // (Virtual) Destructor
@@ -35,6 +36,7 @@ MessageDictionary::add(const std::string& ident, const std::string& text) {
 
         // Message not already in the dictionary, so add it.
         dictionary_[ident] = text;
+        setTemplate(ident, text);
     }
 
     return (not_found);
@@ -50,6 +52,7 @@ MessageDictionary::replace(const std::string& ident, const std::string& text) {
 
         // Exists, so replace it.
         dictionary_[ident] = text;
+        setTemplate(ident, text);
     }
 
     return (found);
@@ -62,6 +65,7 @@ MessageDictionary::erase(const std::string& ident, const std::string& text) {
     bool found = (mes != dictionary_.end() && (mes->second == text));
     if (found) {
         dictionary_.erase(mes);
+        templates_.erase(ident);
     }
     return (found);
 }
@@ -107,6 +111,33 @@ MessageDictionary::getText(const std::string& ident) const {
     }
 }
 
+// Return the parsed message or null.  The template is shared so it stays
+// valid for the formatter using it even if the message is replaced.
+
+MessageTemplatePtr
+MessageDictionary::getTemplate(const MessageID& ident) const {
+    // The key is built in a string owned by the thread, which keeps its
+    // capacity, so the lookup does not allocate memory.
+    static thread_local std::string key;
+    key.assign(ident);
+    return (getTemplate(key));
+}
+
+MessageTemplatePtr
+MessageDictionary::getTemplate(const std::string& ident) const {
+    Templates::const_iterator i = templates_.find(ident);
+    if (i == templates_.end()) {
+        return (MessageTemplatePtr());
+    }
+    return (i->second);
+}
+
+void
+MessageDictionary::setTemplate(const std::string& ident,
+                               const std::string& text) {
+    templates_[ident].reset(new MessageTemplate(ident + " " + text));
+}
+
 // Return global dictionary
 
 const MessageDictionaryPtr&
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,6 +15,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <log/message_template.h>
 #include <log/message_types.h>
 
 namespace isc {
@@ -43,6 +44,10 @@ typedef boost::shared_ptr<MessageDictionary> MessageDictionaryPtr;
 ///
 /// Although the class can be used stand-alone, it does supply a static method
 /// to return a particular instance - the "global" dictionary.
+///
+/// Along with the text, the dictionary keeps the message parsed into a
+/// \c MessageTemplate so the loggers do not copy nor parse the text each
+/// time a message is logged.
 
 class MessageDictionary {
 public:
@@ -170,6 +175,26 @@ public:
     virtual const std::string& getText(const std::string& ident) const;
 
 
+    /// \brief Get Message Template
+    ///
+    /// Given an ID, retrieve the parsed message, i.e. the ID followed by a
+    /// space and the message text, as output by the loggers.
+    ///
+    /// \param ident Message identification
+    ///
+    /// \return Template of the message or null if the ID is not recognized.
+    MessageTemplatePtr getTemplate(const MessageID& ident) const;
+
+    /// \brief Get Message Template
+    ///
+    /// Alternate signature.
+    ///
+    /// \param ident Message identification
+    ///
+    /// \return Template of the message or null if the ID is not recognized.
+    MessageTemplatePtr getTemplate(const std::string& ident) const;
+
+
     /// \brief Number of Items in Dictionary
     ///
     /// \return Number of items in the dictionary
@@ -198,7 +223,16 @@ public:
     static const MessageDictionaryPtr& globalDictionary();
 
 private:
+    /// \brief Sets the template of a message
+    ///
+    /// \param ident Message identification
+    /// \param text Message text
+    void setTemplate(const std::string& ident, const std::string& text);
+
+    typedef std::map<std::string, MessageTemplatePtr> Templates;
+
     Dictionary       dictionary_;   ///< Holds the ID to text lookups
+    Templates        templates_;    ///< Holds the ID to template lookups
     const std::string empty_;       ///< Empty string
 };
 
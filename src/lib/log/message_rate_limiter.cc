@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/message_rate_limiter.h>
+
+using namespace std;
+
+namespace {
+
+/// @brief Source of the snapshot versions, shared by all rate limiters
+atomic<uint64_t> next_version(1);
+
+}
+
+namespace isc {
+namespace log {
+
+MessageRateLimiter::MessageRateLimiter()
+    : limits_(new LimitMap()), version_(next_version.fetch_add(1)),
+      enabled_(false), mutex_() {
+}
+
+MessageRateLimiter&
+MessageRateLimiter::instance() {
+    static MessageRateLimiter limiter;
+    return (limiter);
+}
+
+void
+MessageRateLimiter::setLimit(const string& ident, uint32_t limit,
+                             uint32_t interval) {
+    LimitPtr entry(new Limit());
+    entry->limit_ = limit;
+    entry->interval_ = chrono::seconds(interval);
+    entry->start_ = Clock::time_point();
+    entry->count_ = 0;
+    entry->suppressed_ = 0;
+    entry->severity_ = INFO;
+    entry->started_ = false;
+
+    // The published snapshot is never modified: copy it and replace the
+    // limit of the message in the copy.
+    lock_guard<mutex> lock(mutex_);
+    boost::shared_ptr<LimitMap> limits(new LimitMap(*limits_));
+    (*limits)[ident] = entry;
+    publish(limits);
+}
+
+void
+MessageRateLimiter::clear() {
+    lock_guard<mutex> lock(mutex_);
+    publish(ConstLimitMapPtr(new LimitMap()));
+}
+
+void
+MessageRateLimiter::publish(const ConstLimitMapPtr& limits) {
+    limits_ = limits;
+    enabled_.store(!limits->empty());
+    version_.store(next_version.fetch_add(1), memory_order_release);
+}
+
+const MessageRateLimiter::ConstLimitMapPtr&
+MessageRateLimiter::getLimits() {
+    struct Cache {
+        uint64_t version_;
+        ConstLimitMapPtr limits_;
+    };
+    static thread_local Cache cache = { 0, ConstLimitMapPtr() };
+    const uint64_t version = version_.load(memory_order_acquire);
+    if (cache.version_ != version) {
+        lock_guard<mutex> lock(mutex_);
+        cache.limits_ = limits_;
+        cache.version_ = version_.load(memory_order_relaxed);
+    }
+    return (cache.limits_);
+}
+
+bool
+MessageRateLimiter::check(const MessageID& ident, uint64_t& suppressed,
+                          const char* logger, Severity severity) {
+    // The key is built in a string owned by the thread so the check does
+    // not allocate memory.
+    static thread_local string key;
+    key.assign(ident);
+    return (check(key, Clock::now(), suppressed, logger, severity));
+}
+
+bool
+MessageRateLimiter::check(const string& ident, const Clock::time_point& now,
+                          uint64_t& suppressed, const char* logger,
+                          Severity severity) {
+    suppressed = 0;
+    if (!isEnabled()) {
+        return (true);
+    }
+
+    // Messages without a limit are looked up in the snapshot without lock.
+    const ConstLimitMapPtr& limits = getLimits();
+    LimitMap::const_iterator it = limits->find(ident);
+    if (it == limits->end()) {
+        return (true);
+    }
+    Limit& entry = *it->second;
+    lock_guard<mutex> lock(entry.mutex_);
+
+    // Start a new interval, reporting the messages suppressed in the
+    // previous one.
+    if (!entry.started_ || (now - entry.start_ >= entry.interval_)) {
+        suppressed = entry.suppressed_;
+        entry.start_ = now;
+        entry.count_ = 0;
+        entry.suppressed_ = 0;
+        entry.started_ = true;
+    }
+
+    if (entry.count_ < entry.limit_) {
+        ++entry.count_;
+        return (true);
+    }
+    // The logger is kept only for the first suppressed message so the
+    // next ones don't allocate memory.
+    if (entry.suppressed_ == 0) {
+        entry.logger_.assign(logger);
+        entry.severity_ = severity;
+    }
+    ++entry.suppressed_;
+    return (false);
+}
+
+void
+MessageRateLimiter::flush(PendingList& pending) {
+    ConstLimitMapPtr limits;
+    {
+        lock_guard<mutex> lock(mutex_);
+        limits = limits_;
+    }
+    for (LimitMap::const_iterator it = limits->begin(); it != limits->end();
+         ++it) {
+        Limit& entry = *it->second;
+        lock_guard<mutex> lock(entry.mutex_);
+        if (entry.suppressed_ > 0) {
+            Pending report;
+            report.ident_ = it->first;
+            report.logger_ = entry.logger_;
+            report.severity_ = entry.severity_;
+            report.suppressed_ = entry.suppressed_;
+            pending.push_back(report);
+            entry.suppressed_ = 0;
+        }
+    }
+}
+
+} // namespace log
+} // namespace isc
@@ -0,0 +1,203 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MESSAGE_RATE_LIMITER_H
+#define MESSAGE_RATE_LIMITER_H
+
+#include <log/logger_level.h>
+#include <log/message_types.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Rate Limiter of Log Messages
+///
+/// Some messages, e.g. the ones logged when a packet is dropped, are logged
+/// once per packet and can saturate the disk under an attack. A limit of
+/// messages per interval can be set for such a message ID: the messages
+/// beyond the limit are suppressed until the end of the interval. The
+/// number of suppressed messages is returned when the next message with
+/// the same ID is checked after the interval, so the logger can report it.
+/// The counts of the messages which are not logged again are reported
+/// when they are flushed, i.e. when the logging is reconfigured and when
+/// the daemon shuts down.
+///
+/// The limits are set from the logging configuration. Checking a message
+/// costs a single atomic load when no limit is configured. The set of
+/// limited messages is published as an immutable snapshot cached by each
+/// thread, so checking a message without a limit takes no lock: only the
+/// counters of a limited message are protected by a mutex.
+class MessageRateLimiter : public boost::noncopyable {
+public:
+    /// \brief Type of the clock
+    typedef std::chrono::steady_clock Clock;
+
+    /// \brief Suppressed messages not yet reported
+    struct Pending {
+        /// \brief Message identification
+        std::string ident_;
+
+        /// \brief Name of the logger of the first suppressed message
+        std::string logger_;
+
+        /// \brief Severity of the first suppressed message
+        Severity severity_;
+
+        /// \brief Number of suppressed messages
+        uint64_t suppressed_;
+    };
+
+    /// \brief List of suppressed messages not yet reported
+    typedef std::vector<Pending> PendingList;
+
+    /// \brief Constructor
+    MessageRateLimiter();
+
+    /// \brief Return Global Rate Limiter
+    ///
+    /// \return Reference to the rate limiter used by the loggers.
+    static MessageRateLimiter& instance();
+
+    /// \brief Set the limit of a message
+    ///
+    /// Replaces the former limit and resets the counters of the message.
+    ///
+    /// \param ident Message identification.
+    /// \param limit Maximum number of messages per interval.
+    /// \param interval Length of the interval in seconds.
+    void setLimit(const std::string& ident, uint32_t limit, uint32_t interval);
+
+    /// \brief Remove all limits
+    void clear();
+
+    /// \brief Checks if a limit is set
+    bool isEnabled() const {
+        return (enabled_.load(std::memory_order_relaxed));
+    }
+
+    /// \brief Counts a message and checks if it can be logged
+    ///
+    /// \param ident Message identification.
+    /// \param suppressed [out] Number of messages with this ID suppressed
+    /// during the last interval, to be reported, or 0.
+    /// \param logger Name of the logger, kept to flush the count.
+    /// \param severity Severity of the message, kept to flush the count.
+    ///
+    /// \return true if the message can be logged.
+    bool check(const MessageID& ident, uint64_t& suppressed,
+               const char* logger = "", Severity severity = INFO);
+
+    /// \brief Counts a message at a given time
+    ///
+    /// This method is used in testing.
+    ///
+    /// \param ident Message identification.
+    /// \param now Current time.
+    /// \param suppressed [out] Number of suppressed messages to be reported.
+    /// \param logger Name of the logger, kept to flush the count.
+    /// \param severity Severity of the message, kept to flush the count.
+    ///
+    /// \return true if the message can be logged.
+    bool check(const std::string& ident, const Clock::time_point& now,
+               uint64_t& suppressed, const char* logger = "",
+               Severity severity = INFO);
+
+    /// \brief Returns and resets the counts of the suppressed messages
+    ///
+    /// The intervals are not restarted: the messages beyond the limit
+    /// are still suppressed until the end of their interval.
+    ///
+    /// \param pending [out] The messages suppressed since they were last
+    /// reported, appended to the list.
+    void flush(PendingList& pending);
+
+private:
+    /// \brief Limit and counters of a message
+    struct Limit {
+        /// \brief Maximum number of messages per interval
+        uint32_t limit_;
+
+        /// \brief Length of the interval
+        Clock::duration interval_;
+
+        /// \brief Start of the current interval
+        Clock::time_point start_;
+
+        /// \brief Number of messages logged in the current interval
+        uint32_t count_;
+
+        /// \brief Number of messages suppressed in the current interval
+        uint64_t suppressed_;
+
+        /// \brief Name of the logger of the first suppressed message
+        std::string logger_;
+
+        /// \brief Severity of the first suppressed message
+        Severity severity_;
+
+        /// \brief False until the first message
+        bool started_;
+
+        /// \brief Mutex protecting the counters
+        std::mutex mutex_;
+    };
+
+    /// \brief Pointer to the limit of a message
+    typedef boost::shared_ptr<Limit> LimitPtr;
+
+    /// \brief Limits by message identification
+    typedef std::map<std::string, LimitPtr> LimitMap;
+
+    /// \brief Pointer to an immutable snapshot of the limits
+    typedef boost::shared_ptr<const LimitMap> ConstLimitMapPtr;
+
+    /// \brief Returns the current snapshot of the limits
+    ///
+    /// The snapshot is cached by the calling thread and refreshed under
+    /// the mutex only when the limits were changed.
+    ///
+    /// \return Reference to the pointer cached by the calling thread,
+    /// valid until its next call.
+    const ConstLimitMapPtr& getLimits();
+
+    /// \brief Publishes a new snapshot of the limits
+    ///
+    /// Must be called with the mutex held.
+    ///
+    /// \param limits The new snapshot.
+    void publish(const ConstLimitMapPtr& limits);
+
+    /// \brief The current snapshot of the limits
+    ConstLimitMapPtr limits_;
+
+    /// \brief Version of the snapshot
+    ///
+    /// Versions are unique across all rate limiters so a thread cache
+    /// never mistakes the snapshot of another instance for the current one.
+    std::atomic<uint64_t> version_;
+
+    /// \brief True when limits_ is not empty
+    std::atomic<bool> enabled_;
+
+    /// \brief Mutex protecting the snapshot pointer
+    std::mutex mutex_;
+};
+
+} // namespace log
+} // namespace isc
+
+#endif // MESSAGE_RATE_LIMITER_H
@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/message_template.h>
+
+using namespace std;
+
+namespace {
+
+/// \brief Highest placeholder number
+///
+/// A larger number is taken as literal text.
+const unsigned MAX_PLACEHOLDER = 9999;
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace log {
+
+MessageTemplate::MessageTemplate(const string& text)
+    : text_(text), segments_(), placeholders_() {
+    size_t start = 0;
+    size_t pos = 0;
+    while ((pos = text_.find('%', pos)) != string::npos) {
+        // Parse the number following the '%'.
+        size_t end = pos + 1;
+        unsigned placeholder = 0;
+        if ((end < text_.size()) && (text_[end] >= '1') && (text_[end] <= '9')) {
+            while ((end < text_.size()) && (text_[end] >= '0') &&
+                   (text_[end] <= '9') && (placeholder <= MAX_PLACEHOLDER)) {
+                placeholder = placeholder * 10 + (text_[end] - '0');
+                ++end;
+            }
+        }
+        if ((placeholder == 0) || (placeholder > MAX_PLACEHOLDER)) {
+            // Not a placeholder: the '%' is part of the literal.
+            ++pos;
+            continue;
+        }
+
+        Segment segment;
+        segment.offset_ = start;
+        segment.length_ = pos - start;
+        segment.mark_length_ = end - pos;
+        segment.placeholder_ = placeholder;
+        segments_.push_back(segment);
+        if (placeholders_.size() <= placeholder) {
+            placeholders_.resize(placeholder + 1, false);
+        }
+        placeholders_[placeholder] = true;
+        start = pos = end;
+    }
+
+    // The trailing literal.
+    if ((start < text_.size()) || segments_.empty()) {
+        Segment segment;
+        segment.offset_ = start;
+        segment.length_ = text_.size() - start;
+        segment.mark_length_ = 0;
+        segment.placeholder_ = 0;
+        segments_.push_back(segment);
+    }
+}
+
+} // namespace log
+} // namespace isc
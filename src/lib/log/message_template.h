@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MESSAGE_TEMPLATE_H
+#define MESSAGE_TEMPLATE_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Pre-parsed Message Text
+///
+/// The text of a message ("IDENT text with %1 and %2") is split once into
+/// literal segments, each one followed by a placeholder, so the Formatter
+/// can substitute the arguments of a message in a single pass without
+/// searching the text for the placeholders.
+///
+/// A placeholder is a '%' followed by a decimal number not starting with 0,
+/// e.g. "%12" is the placeholder 12 and not the placeholder 1 followed by
+/// a "2". Any other '%' is a literal character.
+class MessageTemplate {
+public:
+    /// \brief Literal segment of the text and the placeholder following it
+    struct Segment {
+        /// \brief Offset of the literal in the text
+        size_t offset_;
+
+        /// \brief Length of the literal
+        size_t length_;
+
+        /// \brief Length of the placeholder mark (e.g. 2 for "%1")
+        ///
+        /// The mark follows the literal in the text. Zero for the last
+        /// segment when the text does not end with a placeholder.
+        size_t mark_length_;
+
+        /// \brief Number of the placeholder, zero if there is none
+        unsigned placeholder_;
+    };
+
+    /// \brief Constructor
+    ///
+    /// \param text Message text with placeholders.
+    explicit MessageTemplate(const std::string& text);
+
+    /// \brief Returns the message text
+    const std::string& getText() const {
+        return (text_);
+    }
+
+    /// \brief Returns the segments
+    const std::vector<Segment>& getSegments() const {
+        return (segments_);
+    }
+
+    /// \brief Checks if the text has a placeholder
+    ///
+    /// \param placeholder Number of the placeholder.
+    ///
+    /// \return true if the placeholder appears at least once in the text.
+    bool hasPlaceholder(unsigned placeholder) const {
+        return ((placeholder < placeholders_.size()) &&
+                placeholders_[placeholder]);
+    }
+
+    /// \brief Returns the highest placeholder of the text, zero if none
+    unsigned getMaxPlaceholder() const {
+        return (placeholders_.empty() ? 0 : placeholders_.size() - 1);
+    }
+
+private:
+    /// \brief The message text
+    std::string text_;
+
+    /// \brief The segments
+    std::vector<Segment> segments_;
+
+    /// \brief Placeholders of the text, indexed by their number
+    std::vector<bool> placeholders_;
+};
+
+/// \brief Shared pointer to a message template
+typedef boost::shared_ptr<const MessageTemplate> MessageTemplatePtr;
+
+} // namespace log
+} // namespace isc
+
+#endif // MESSAGE_TEMPLATE_H
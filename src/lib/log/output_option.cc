@@ -10,6 +10,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <exceptions/exceptions.h>
 #include <log/log_messages.h>
 #include <log/macros.h>
 #include <log/output_option.h>
@@ -17,6 +18,8 @@
 namespace isc {
 namespace log {
 
+const size_t OutputOption::DEFAULT_ASYNC_QUEUE_SIZE;
+
 /// Default layout pattern for console logs
 const std::string OutputOption::DEFAULT_CONSOLE_PATTERN = "%D{%Y-%m-%d %H:%M:%S.%q} %-5p [%c/%i] %m\n";
 
@@ -54,5 +57,19 @@ getStream(const std::string& stream_str) {
     }
 }
 
+OutputOption::Overflow
+getOverflow(const std::string& overflow_str) {
+    if (boost::iequals(overflow_str, "block")) {
+        return OutputOption::OVERFLOW_BLOCK;
+    } else if (boost::iequals(overflow_str, "drop")) {
+        return OutputOption::OVERFLOW_DROP;
+    } else if (boost::iequals(overflow_str, "count")) {
+        return OutputOption::OVERFLOW_COUNT;
+    } else {
+        isc_throw(BadValue, "unsupported asynchronous logging overflow "
+                  "policy: " << overflow_str);
+    }
+}
+
 } // namespace log
 } // namespace isc
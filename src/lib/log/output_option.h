@@ -57,10 +57,23 @@ struct OutputOption {
         STR_STDERR = 2
     } Stream;
 
+    /// What to do with a message when the queue of an asynchronous
+    /// output is full
+    typedef enum {
+        OVERFLOW_BLOCK = 0,     ///< Wait for the writer to make room
+        OVERFLOW_DROP = 1,      ///< Drop the message
+        OVERFLOW_COUNT = 2      ///< Drop the message and report the count
+    } Overflow;
+
+    /// Default size of the queue of an asynchronous output
+    static const size_t DEFAULT_ASYNC_QUEUE_SIZE = 1024;
+
     /// \brief Constructor
     OutputOption() : destination(DEST_CONSOLE), stream(STR_STDERR),
                      flush(true), facility("LOCAL0"), filename(""),
-                     maxsize(0), maxver(0), pattern("")
+                     maxsize(0), maxver(0), pattern(""), async(false),
+                     async_queue_size(DEFAULT_ASYNC_QUEUE_SIZE),
+                     async_overflow(OVERFLOW_BLOCK)
     {}
 
     /// Members. 
@@ -73,11 +86,21 @@ struct OutputOption {
     size_t          maxsize;            ///< 0 if no maximum size
     unsigned int    maxver;             ///< Maximum versions (none if <= 0)
     std::string     pattern;            ///< log content pattern
+    bool            async;              ///< true to write in a background thread
+    size_t          async_queue_size;   ///< Capacity of the async queue
+    Overflow        async_overflow;     ///< Policy when the queue is full
 };
 
 OutputOption::Destination getDestination(const std::string& dest_str);
 OutputOption::Stream getStream(const std::string& stream_str);
 
+/// \brief Converts an overflow policy name to its value
+///
+/// \param overflow_str One of "block", "drop" or "count".
+/// \return The overflow policy.
+/// \throw isc::BadValue if the name is not recognized.
+OutputOption::Overflow getOverflow(const std::string& overflow_str);
+
 
 } // namespace log
 } // namespace isc
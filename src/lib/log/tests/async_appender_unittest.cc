@@ -0,0 +1,172 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/async_appender_impl.h>
+
+#include <log4cplus/loggingmacros.h>
+#include <log4cplus/logger.h>
+#include <log4cplus/spi/loggingevent.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace isc::log;
+using namespace isc::log::internal;
+
+namespace {
+
+/// \brief Appender collecting the messages of the events
+///
+/// It can be paused to simulate a slow destination.
+class CollectingAppender : public log4cplus::Appender {
+public:
+    CollectingAppender() : paused_(false) {}
+
+    virtual ~CollectingAppender() {
+        destructorImpl();
+    }
+
+    virtual void close() {
+        closed = true;
+    }
+
+    /// \brief Returns a copy of the collected messages
+    std::vector<std::string> getMessages() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return (messages_);
+    }
+
+    /// \brief When true the writer waits in append()
+    std::atomic<bool> paused_;
+
+protected:
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event) {
+        while (paused_) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        messages_.push_back(event.getMessage());
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::string> messages_;
+};
+
+class AsyncAppenderTest : public ::testing::Test {
+protected:
+    AsyncAppenderTest() : collector_(new CollectingAppender()),
+                          target_(collector_),
+                          logger_(log4cplus::Logger::getInstance("async")) {
+        logger_.setLogLevel(log4cplus::TRACE_LOG_LEVEL);
+        logger_.setAdditivity(false);
+    }
+
+    ~AsyncAppenderTest() {
+        logger_.removeAllAppenders();
+    }
+
+    CollectingAppender* collector_;
+    log4cplus::SharedAppenderPtr target_;
+    log4cplus::Logger logger_;
+};
+
+// Test that the events are written in order by the writer thread.
+TEST_F(AsyncAppenderTest, order) {
+    AsyncAppender* async = new AsyncAppender(target_, 16,
+                                             OutputOption::OVERFLOW_BLOCK);
+    log4cplus::SharedAppenderPtr appender(async);
+    logger_.addAppender(appender);
+    EXPECT_EQ(16, async->getQueueSize());
+
+    for (int i = 0; i < 100; ++i) {
+        LOG4CPLUS_INFO(logger_, "msg" << i);
+    }
+    async->flush();
+
+    std::vector<std::string> messages = collector_->getMessages();
+    ASSERT_EQ(100, messages.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ("msg" + std::to_string(i), messages[i]);
+    }
+    EXPECT_EQ(0, async->getDropped());
+}
+
+// Test that the queue size is rounded up to a power of 2.
+TEST_F(AsyncAppenderTest, queueSize) {
+    AsyncAppender async(target_, 1000, OutputOption::OVERFLOW_BLOCK);
+    EXPECT_EQ(1024, async.getQueueSize());
+}
+
+// Test that no event is lost with the block policy when several threads
+// log through a small queue.
+TEST_F(AsyncAppenderTest, block) {
+    AsyncAppender* async = new AsyncAppender(target_, 4,
+                                             OutputOption::OVERFLOW_BLOCK);
+    log4cplus::SharedAppenderPtr appender(async);
+    logger_.addAppender(appender);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.push_back(std::thread([this]() {
+            for (int i = 0; i < 250; ++i) {
+                LOG4CPLUS_INFO(logger_, "msg");
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    async->flush();
+
+    EXPECT_EQ(1000, collector_->getMessages().size());
+    EXPECT_EQ(0, async->getDropped());
+}
+
+// Test that events are dropped with the drop policy and reported with
+// the count policy.
+TEST_F(AsyncAppenderTest, dropAndCount) {
+    for (auto overflow : { OutputOption::OVERFLOW_DROP,
+                           OutputOption::OVERFLOW_COUNT }) {
+        CollectingAppender* collector = new CollectingAppender();
+        log4cplus::SharedAppenderPtr target(collector);
+        AsyncAppender* async = new AsyncAppender(target, 4, overflow);
+        log4cplus::SharedAppenderPtr appender(async);
+        logger_.removeAllAppenders();
+        logger_.addAppender(appender);
+
+        // Block the writer on the first event so the queue fills up.
+        collector->paused_ = true;
+        for (int i = 0; i < 20; ++i) {
+            LOG4CPLUS_INFO(logger_, "msg" << i);
+        }
+        EXPECT_LT(0, async->getDropped());
+        uint64_t dropped = async->getDropped();
+        collector->paused_ = false;
+
+        // Closing writes the queued events.
+        logger_.removeAllAppenders();
+        async->close();
+
+        std::vector<std::string> messages = collector->getMessages();
+        EXPECT_EQ("msg0", messages[0]);
+        if (overflow == OutputOption::OVERFLOW_DROP) {
+            EXPECT_EQ(20 - dropped, messages.size());
+        } else {
+            ASSERT_EQ(20 - dropped + 1, messages.size());
+            EXPECT_EQ(0, messages.back().find("LOG_ASYNC_DROPPED " +
+                                              std::to_string(dropped)));
+        }
+    }
+}
+
+} // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,7 +12,9 @@
 
 #include <log/log_formatter.h>
 #include <log/logger_level.h>
+#include <log/message_template.h>
 
+#include <limits>
 #include <vector>
 #include <string>
 
@@ -176,4 +178,62 @@ TEST_F(FormatterTest, noRecurse) {
     EXPECT_EQ("%1 %1", outputs[0].second);
 }
 
+// Test the arguments are substituted once: an argument containing a
+// placeholder is not replaced by the next arguments
+TEST_F(FormatterTest, noSequentialReplace) {
+    Formatter(isc::log::INFO, s("%1 %2"), this).arg("%2").arg(42);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("%2 42", outputs[0].second);
+}
+
+// Test the formatter built from a message template
+TEST_F(FormatterTest, messageTemplate) {
+    isc::log::MessageTemplatePtr message_template(
+        new isc::log::MessageTemplate("ID %1 and %2"));
+    Formatter(isc::log::WARN, message_template, this).arg("one").arg(2);
+    Formatter(isc::log::WARN, message_template, this).arg("three").arg(4);
+    ASSERT_EQ(2, outputs.size());
+    EXPECT_EQ(isc::log::WARN, outputs[0].first);
+    EXPECT_EQ("ID one and 2", outputs[0].second);
+    EXPECT_EQ("ID three and 4", outputs[1].second);
+}
+
+// Test the conversion of the integers and characters
+TEST_F(FormatterTest, numericArgs) {
+    Formatter(isc::log::INFO, s("%1 %2 %3 %4 %5 %6 %7"), this).
+        arg(0).arg(-1).arg(std::numeric_limits<int64_t>::min()).
+        arg(std::numeric_limits<uint64_t>::max()).arg(static_cast<uint16_t>(80)).
+        arg('x').arg(true);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("0 -1 -9223372036854775808 18446744073709551615 80 x 1",
+              outputs[0].second);
+}
+
+// Test long and numerous arguments which do not fit in the inline buffer
+TEST_F(FormatterTest, manyArgs) {
+    string text;
+    string expected;
+    for (int i = 1; i <= 20; ++i) {
+        text += " %" + std::to_string(i);
+        expected += " " + string(i * 10, 'a' + i);
+    }
+    Formatter formatter(isc::log::INFO, s(text.c_str()), this);
+    for (int i = 1; i <= 20; ++i) {
+        formatter.arg(string(i * 10, 'a' + i));
+    }
+    formatter.deactivate();
+    EXPECT_EQ(0, outputs.size());
+
+    {
+        Formatter active(isc::log::INFO, s(text.c_str()), this);
+        for (int i = 1; i <= 20; ++i) {
+            active.arg(string(i * 10, 'a' + i));
+        }
+        // The copy takes the arguments.
+        Formatter copy(active);
+    }
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ(expected, outputs[0].second);
+}
+
 }
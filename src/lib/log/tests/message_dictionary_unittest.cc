@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -129,6 +129,29 @@ TEST_F(MessageDictionaryTest, erase) {
     EXPECT_EQ(0, dictionary.size());
 }
 
+// Check the templates follow the messages.
+
+TEST_F(MessageDictionaryTest, templates) {
+    MessageDictionary dictionary;
+    EXPECT_FALSE(dictionary.getTemplate(alpha_id));
+
+    EXPECT_TRUE(dictionary.add(alpha_id, "first %1"));
+    MessageTemplatePtr first = dictionary.getTemplate(alpha_id);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(string(alpha_id) + " first %1", first->getText());
+    EXPECT_TRUE(first->hasPlaceholder(1));
+
+    // A replaced message gets a new template, the former one stays valid.
+    EXPECT_TRUE(dictionary.replace(alpha_id, "second"));
+    MessageTemplatePtr second = dictionary.getTemplate(alpha_id);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(string(alpha_id) + " second", second->getText());
+    EXPECT_EQ(string(alpha_id) + " first %1", first->getText());
+
+    EXPECT_TRUE(dictionary.erase(alpha_id, "second"));
+    EXPECT_FALSE(dictionary.getTemplate(alpha_id));
+}
+
 // Load test
 
 TEST_F(MessageDictionaryTest, LoadTest) {
@@ -0,0 +1,167 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/message_rate_limiter.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace isc::log;
+using namespace std;
+
+namespace {
+
+// Test that the messages without limit are not counted.
+TEST(MessageRateLimiterTest, noLimit) {
+    MessageRateLimiter limiter;
+    EXPECT_FALSE(limiter.isEnabled());
+
+    uint64_t suppressed = 1;
+    EXPECT_TRUE(limiter.check("MESSAGE", MessageRateLimiter::Clock::now(),
+                              suppressed));
+    EXPECT_EQ(0, suppressed);
+
+    limiter.setLimit("OTHER", 1, 1);
+    EXPECT_TRUE(limiter.isEnabled());
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(limiter.check("MESSAGE", MessageRateLimiter::Clock::now(),
+                                  suppressed));
+    }
+
+    limiter.clear();
+    EXPECT_FALSE(limiter.isEnabled());
+}
+
+// Test that the messages beyond the limit are suppressed and reported in
+// the next interval.
+TEST(MessageRateLimiterTest, limit) {
+    MessageRateLimiter limiter;
+    limiter.setLimit("MESSAGE", 3, 10);
+
+    MessageRateLimiter::Clock::time_point start =
+        MessageRateLimiter::Clock::now();
+    uint64_t suppressed = 0;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(limiter.check("MESSAGE", start + chrono::seconds(i),
+                                  suppressed));
+        EXPECT_EQ(0, suppressed);
+    }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FALSE(limiter.check("MESSAGE", start + chrono::seconds(9),
+                                   suppressed));
+        EXPECT_EQ(0, suppressed);
+    }
+
+    // The first message of the next interval gets the suppressed count.
+    EXPECT_TRUE(limiter.check("MESSAGE", start + chrono::seconds(10),
+                              suppressed));
+    EXPECT_EQ(5, suppressed);
+    EXPECT_TRUE(limiter.check("MESSAGE", start + chrono::seconds(11),
+                              suppressed));
+    EXPECT_EQ(0, suppressed);
+
+    // Setting the limit again resets the counters.
+    limiter.setLimit("MESSAGE", 0, 10);
+    EXPECT_FALSE(limiter.check("MESSAGE", start + chrono::seconds(12),
+                               suppressed));
+    EXPECT_EQ(0, suppressed);
+}
+
+// Test that a limit set after a thread checked a message is seen by that
+// thread, and that each limiter keeps its own limits.
+TEST(MessageRateLimiterTest, snapshot) {
+    MessageRateLimiter limiter;
+    MessageRateLimiter other;
+    limiter.setLimit("OTHER", 1, 10);
+    other.setLimit("MESSAGE", 1, 10);
+
+    MessageRateLimiter::Clock::time_point now =
+        MessageRateLimiter::Clock::now();
+    uint64_t suppressed = 0;
+    EXPECT_TRUE(limiter.check("MESSAGE", now, suppressed));
+    EXPECT_TRUE(limiter.check("MESSAGE", now, suppressed));
+    EXPECT_TRUE(other.check("MESSAGE", now, suppressed));
+    EXPECT_FALSE(other.check("MESSAGE", now, suppressed));
+
+    // The new limit replaces the snapshot cached by this thread.
+    limiter.setLimit("MESSAGE", 1, 10);
+    EXPECT_TRUE(limiter.check("MESSAGE", now, suppressed));
+    EXPECT_FALSE(limiter.check("MESSAGE", now, suppressed));
+
+    limiter.clear();
+    EXPECT_TRUE(limiter.check("MESSAGE", now, suppressed));
+    EXPECT_FALSE(other.check("MESSAGE", now, suppressed));
+}
+
+// Test that concurrent checks count each limited message once.
+TEST(MessageRateLimiterTest, threads) {
+    MessageRateLimiter limiter;
+    limiter.setLimit("MESSAGE", 100, 3600);
+
+    MessageRateLimiter::Clock::time_point now =
+        MessageRateLimiter::Clock::now();
+    const size_t thread_count = 4;
+    std::vector<uint64_t> logged(thread_count, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.push_back(std::thread([&limiter, &logged, now, t]() {
+            uint64_t suppressed = 0;
+            for (int i = 0; i < 1000; ++i) {
+                if (limiter.check("MESSAGE", now, suppressed)) {
+                    ++logged[t];
+                }
+                limiter.check("UNLISTED", now, suppressed);
+            }
+        }));
+    }
+    uint64_t total = 0;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads[t].join();
+        total += logged[t];
+    }
+    EXPECT_EQ(100, total);
+}
+
+// Test that the counts not reported yet are flushed.
+TEST(MessageRateLimiterTest, flush) {
+    MessageRateLimiter limiter;
+    limiter.setLimit("MESSAGE", 1, 10);
+    limiter.setLimit("OTHER", 1, 10);
+
+    MessageRateLimiter::Clock::time_point now =
+        MessageRateLimiter::Clock::now();
+    uint64_t suppressed = 0;
+    EXPECT_TRUE(limiter.check("MESSAGE", now, suppressed, "first", WARN));
+    EXPECT_FALSE(limiter.check("MESSAGE", now, suppressed, "first", WARN));
+    EXPECT_FALSE(limiter.check("MESSAGE", now, suppressed, "second", ERROR));
+    EXPECT_TRUE(limiter.check("OTHER", now, suppressed, "first", WARN));
+
+    // Only the message with suppressed occurrences is reported, with the
+    // logger and the severity of the first one.
+    MessageRateLimiter::PendingList pending;
+    limiter.flush(pending);
+    ASSERT_EQ(1, pending.size());
+    EXPECT_EQ("MESSAGE", pending[0].ident_);
+    EXPECT_EQ("first", pending[0].logger_);
+    EXPECT_EQ(WARN, pending[0].severity_);
+    EXPECT_EQ(2, pending[0].suppressed_);
+
+    // The counts are reset but the interval goes on.
+    pending.clear();
+    limiter.flush(pending);
+    EXPECT_TRUE(pending.empty());
+    EXPECT_FALSE(limiter.check("MESSAGE", now, suppressed, "first", WARN));
+    EXPECT_EQ(0, suppressed);
+    EXPECT_TRUE(limiter.check("MESSAGE", now + chrono::seconds(10),
+                              suppressed));
+    EXPECT_EQ(1, suppressed);
+}
+
+} // end of anonymous namespace
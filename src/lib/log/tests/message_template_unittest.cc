@@ -0,0 +1,83 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/message_template.h>
+
+#include <string>
+#include <vector>
+
+using namespace isc::log;
+using namespace std;
+
+namespace {
+
+/// \brief Rebuilds the text of a template from its segments
+///
+/// The placeholders are written as "<N>".
+string
+rebuild(const MessageTemplate& message_template) {
+    const string& text = message_template.getText();
+    string result;
+    const vector<MessageTemplate::Segment>& segments =
+        message_template.getSegments();
+    for (size_t i = 0; i < segments.size(); ++i) {
+        result += text.substr(segments[i].offset_, segments[i].length_);
+        if (segments[i].placeholder_ != 0) {
+            result += "<" + to_string(segments[i].placeholder_) + ">";
+            EXPECT_EQ("%" + to_string(segments[i].placeholder_),
+                      text.substr(segments[i].offset_ + segments[i].length_,
+                                  segments[i].mark_length_));
+        }
+    }
+    return (result);
+}
+
+// Test a text without placeholder.
+TEST(MessageTemplateTest, noPlaceholder) {
+    MessageTemplate message_template("ID some text");
+    EXPECT_EQ("ID some text", message_template.getText());
+    ASSERT_EQ(1, message_template.getSegments().size());
+    EXPECT_EQ("ID some text", rebuild(message_template));
+    EXPECT_EQ(0, message_template.getMaxPlaceholder());
+    EXPECT_FALSE(message_template.hasPlaceholder(1));
+
+    MessageTemplate empty("");
+    ASSERT_EQ(1, empty.getSegments().size());
+    EXPECT_EQ("", rebuild(empty));
+}
+
+// Test the placeholders are found.
+TEST(MessageTemplateTest, placeholders) {
+    MessageTemplate message_template("%2 and %1, %2 again%3");
+    EXPECT_EQ("<2> and <1>, <2> again<3>", rebuild(message_template));
+    EXPECT_EQ(3, message_template.getMaxPlaceholder());
+    EXPECT_TRUE(message_template.hasPlaceholder(1));
+    EXPECT_TRUE(message_template.hasPlaceholder(2));
+    EXPECT_TRUE(message_template.hasPlaceholder(3));
+    EXPECT_FALSE(message_template.hasPlaceholder(0));
+    EXPECT_FALSE(message_template.hasPlaceholder(4));
+}
+
+// Test the placeholder numbers are parsed greedily and the other '%'
+// are literals.
+TEST(MessageTemplateTest, literals) {
+    MessageTemplate message_template("%12 is not %1, 100% %0 %05 %x %");
+    EXPECT_EQ("<12> is not <1>, 100% %0 %05 %x %", rebuild(message_template));
+    EXPECT_EQ(12, message_template.getMaxPlaceholder());
+    EXPECT_TRUE(message_template.hasPlaceholder(1));
+    EXPECT_FALSE(message_template.hasPlaceholder(2));
+    EXPECT_TRUE(message_template.hasPlaceholder(12));
+
+    // Too large numbers are not placeholders.
+    MessageTemplate large("%123456");
+    EXPECT_EQ("%123456", rebuild(large));
+    EXPECT_EQ(0, large.getMaxPlaceholder());
+}
+
+} // end of anonymous namespace
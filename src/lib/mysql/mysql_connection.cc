@@ -205,8 +205,12 @@ MySqlConnection::openDatabase() {
     // This makes it hard to distinguish whether the UPDATE changed no rows
     // because no row matching the WHERE clause was found, or because a
     // row was found but no data was altered.
+    //
+    // The option CLIENT_MULTI_RESULTS is specified so that stored
+    // procedures returning a result set can be called.
     MYSQL* status = mysql_real_connect(mysql_, host, user, password, name,
-                                       port, NULL, CLIENT_FOUND_ROWS);
+                                       port, NULL,
+                                       CLIENT_FOUND_ROWS | CLIENT_MULTI_RESULTS);
     if (status != mysql_) {
         isc_throw(DbOpenError, mysql_error(mysql_));
     }
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <database/db_exceptions.h>
 #include <database/db_log.h>
 #include <pgsql/pgsql_connection.h>
 #include <pgsql/pgsql_exchange.h>
@@ -26,6 +27,9 @@
 #define PGSQL_STATECODE_LEN 5
 #include <utils/errcodes.h>
 
+#include <boost/lexical_cast.hpp>
+
+
 #include <sstream>
 
 using namespace std;
@@ -357,6 +361,123 @@ PgSqlConnection::checkStatementError(const PgSqlResult& r,
     }
 }
 
+namespace {
+
+/// @brief Returns the number of rows affected by a statement.
+///
+/// @param r The result of the statement.
+size_t
+getAffectedRows(const PgSqlResult& r) {
+    const char* rows = PQcmdTuples(r);
+    return ((rows && *rows) ? boost::lexical_cast<size_t>(rows) : 0);
+}
+
+}
+
+std::vector<size_t>
+PgSqlConnection::executePipeline(const PgSqlPipeline& pipeline) {
+    std::vector<size_t> affected_rows;
+    affected_rows.reserve(pipeline.size());
+
+    // Send the bound integers in binary format.
+    for (auto entry : pipeline) {
+        entry.second->applyBinaryFormat(*entry.first);
+    }
+
+#ifdef LIBPQ_HAS_PIPELINING
+    if ((pipeline.size() > 1) && PQenterPipelineMode(conn_)) {
+        size_t sent = 0;
+        for (auto entry : pipeline) {
+            const PsqlBindArray& bind_array = *entry.second;
+            if (!PQsendQueryPrepared(conn_, entry.first->name,
+                                     entry.first->nbparams,
+                                     &bind_array.values_[0],
+                                     &bind_array.lengths_[0],
+                                     &bind_array.formats_[0], 0)) {
+                break;
+            }
+            ++sent;
+        }
+
+        // The server processes the statements when the sync is received.
+        // Once a statement fails the following ones are aborted.
+        boost::shared_ptr<PgSqlResult> failed;
+        size_t failed_index = 0;
+        bool synced = (PQpipelineSync(conn_) == 1);
+        if (synced) {
+            for (size_t i = 0; i < sent; ++i) {
+                boost::shared_ptr<PgSqlResult> r(new PgSqlResult(PQgetResult(conn_)));
+                int s = PQresultStatus(*r);
+                // Each result is followed by a NULL.
+                while (PGresult* next = PQgetResult(conn_)) {
+                    PQclear(next);
+                }
+                if (!failed && (s != PGRES_COMMAND_OK) &&
+                    (s != PGRES_TUPLES_OK)) {
+                    failed = r;
+                    failed_index = i;
+                }
+                if (!failed) {
+                    affected_rows.push_back(getAffectedRows(*r));
+                }
+            }
+            // Consume the synchronization point.
+            PgSqlResult sync(PQgetResult(conn_));
+        }
+
+        // Leaving the pipeline mode fails when results are pending, e.g.
+        // the sync could not be sent. The connection can't execute other
+        // statements in this state so it is handled as a lost connection.
+        if (!PQexitPipelineMode(conn_)) {
+            DB_LOG_ERROR(PGSQL_FATAL_ERROR)
+                .arg(pipeline[sent < pipeline.size() ? sent : 0].first->name)
+                .arg(PQerrorMessage(conn_))
+                .arg("<sqlstate null>");
+
+            if (!invokeDbLostCallback()) {
+                isc_throw(db::DbUnrecoverableError,
+                          "database connectivity cannot be recovered");
+            }
+
+            isc_throw(DbOperationError, "unable to leave pipeline mode: "
+                      << PQerrorMessage(conn_));
+        }
+
+        if (failed) {
+            PgSqlTaggedStatement& statement = *pipeline[failed_index].first;
+            if (compareError(*failed, DUPLICATE_KEY)) {
+                isc_throw(DuplicateEntry, "Database duplicate entry error for: "
+                          << statement.name);
+            }
+            checkStatementError(*failed, statement);
+        }
+        if (synced && (sent == pipeline.size())) {
+            return (affected_rows);
+        }
+
+        // Sending failed: the error message of the connection tells why.
+        isc_throw(DbOperationError, "unable to execute statements in "
+                  "pipeline mode: " << PQerrorMessage(conn_));
+    }
+#endif
+
+    for (auto entry : pipeline) {
+        const PsqlBindArray& bind_array = *entry.second;
+        PgSqlResult r(PQexecPrepared(conn_, entry.first->name,
+                                     entry.first->nbparams,
+                                     &bind_array.values_[0],
+                                     &bind_array.lengths_[0],
+                                     &bind_array.formats_[0], 0));
+        if (compareError(r, DUPLICATE_KEY)) {
+            isc_throw(DuplicateEntry, "Database duplicate entry error for: "
+                      << entry.first->name);
+        }
+        checkStatementError(r, *entry.first);
+        affected_rows.push_back(getAffectedRows(r));
+    }
+    return (affected_rows);
+}
+
 void
 PgSqlConnection::startTransaction() {
     DB_LOG_DEBUG(DB_DBG_TRACE_DETAIL, PGSQL_START_TRANSACTION);
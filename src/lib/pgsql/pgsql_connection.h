@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,16 +10,18 @@
 
 #include <libpq-fe.h>
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
+#include <utility>
 #include <vector>
 #include <stdint.h>
 
 namespace isc {
 namespace db {
 
-/// @brief Define PostgreSQL backend version: 6.0
+/// @brief Define PostgreSQL backend version: 6.1
 const uint32_t PG_SCHEMA_VERSION_MAJOR = 6;
-const uint32_t PG_SCHEMA_VERSION_MINOR = 0;
+const uint32_t PG_SCHEMA_VERSION_MINOR = 1;
 
 // Maximum number of parameters that can be used a statement
 // @todo This allows us to use an initializer list (since we can't
@@ -231,6 +233,16 @@ private:
 /// @brief Forward declaration to @ref PgSqlConnection.
 class PgSqlConnection;
 
+/// @brief Forward declaration to @ref PsqlBindArray.
+struct PsqlBindArray;
+
+/// @brief A prepared statement and the values bound to its parameters.
+typedef std::pair<PgSqlTaggedStatement*,
+                  boost::shared_ptr<PsqlBindArray> > PgSqlPipelineEntry;
+
+/// @brief Sequence of prepared statements sent in one batch.
+typedef std::vector<PgSqlPipelineEntry> PgSqlPipeline;
+
 /// @brief RAII object representing a PostgreSQL transaction.
 ///
 /// An instance of this class should be created in a scope where multiple
@@ -413,6 +425,32 @@ public:
     void checkStatementError(const PgSqlResult& r,
                              PgSqlTaggedStatement& statement) const;
 
+    /// @brief Executes a sequence of prepared statements.
+    ///
+    /// When libpq supports the pipeline mode (PostgreSQL 14 or later
+    /// client library) all statements are sent before their results are
+    /// read, so the sequence costs one round trip to the server instead
+    /// of one per statement. Otherwise the statements are executed one
+    /// after the other.
+    ///
+    /// The statements following a failed statement are not executed. The
+    /// statements return no rows, e.g. INSERT, UPDATE or DELETE: their
+    /// results are only checked for errors and counted. Outside of a
+    /// transaction the pipelined statements are committed together while
+    /// the statements executed one after the other are committed one by
+    /// one: the sequence should be executed within a transaction when it
+    /// must be atomic.
+    ///
+    /// A connection which can't leave the pipeline mode is handled as a
+    /// lost connection.
+    ///
+    /// @param pipeline The statements with their bound values.
+    ///
+    /// @return The number of rows affected by each statement.
+    /// @throw isc::db::DuplicateEntry A statement failed on a duplicate key.
+    /// @throw isc::db::DbOperationError A statement failed.
+    std::vector<size_t> executePipeline(const PgSqlPipeline& pipeline);
+
     /// @brief PgSql connection handle
     ///
     /// This field is public, because it is used heavily from PgSqlLeaseMgr
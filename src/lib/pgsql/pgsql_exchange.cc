@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -57,6 +57,7 @@ void PsqlBindArray::add(const uint8_t* data, const size_t len) {
 
 void PsqlBindArray::add(const bool& value)  {
     add(value ? TRUE_STR : FALSE_STR);
+    integers_.push_back(std::make_pair(values_.size() - 1, value ? 1 : 0));
 }
 
 void PsqlBindArray::add(const uint8_t& byte) {
@@ -64,12 +65,12 @@ void PsqlBindArray::add(const uint8_t& byte) {
     // treat byte as a character, which yields "" for unprintable values
     addTempString(boost::lexical_cast<std::string>
                               (static_cast<unsigned int>(byte)));
+    integers_.push_back(std::make_pair(values_.size() - 1, byte));
 }
 
 void PsqlBindArray::add(const isc::asiolink::IOAddress& addr) {
     if (addr.isV4()) {
-        addTempString(boost::lexical_cast<std::string>
-                   (addr.toUint32()));
+        add(addr.toUint32());
     } else {
         addTempString(addr.toText());
     }
@@ -91,6 +92,67 @@ void PsqlBindArray::addTempString(const std::string& str) {
     PsqlBindArray::add((bound_strs_.back())->c_str());
 }
 
+void PsqlBindArray::addTempBinary(const std::vector<uint8_t>& data) {
+    bound_strs_.push_back(ConstStringPtr(new std::string(data.begin(),
+                                                         data.end())));
+    values_.push_back(bound_strs_.back()->data());
+    lengths_.push_back(data.size());
+    formats_.push_back(BINARY_FMT);
+}
+
+void PsqlBindArray::applyBinaryFormat(const PgSqlTaggedStatement& statement) {
+    for (auto integer : integers_) {
+        size_t index = integer.first;
+        int64_t value = integer.second;
+        if ((index >= static_cast<size_t>(statement.nbparams)) ||
+            (index >= values_.size()) || (formats_[index] != TEXT_FMT)) {
+            continue;
+        }
+
+        size_t width = 0;
+        switch (statement.types[index]) {
+        case OID_BOOL:
+            if ((value == 0) || (value == 1)) {
+                width = 1;
+            }
+            break;
+        case OID_INT2:
+            if ((value >= std::numeric_limits<int16_t>::min()) &&
+                (value <= std::numeric_limits<int16_t>::max())) {
+                width = 2;
+            }
+            break;
+        case OID_INT4:
+            if ((value >= std::numeric_limits<int32_t>::min()) &&
+                (value <= std::numeric_limits<int32_t>::max())) {
+                width = 4;
+            }
+            break;
+        case OID_INT8:
+            width = 8;
+            break;
+        default:
+            break;
+        }
+        if (width == 0) {
+            continue;
+        }
+
+        // PostgreSQL expects integers in network byte order.
+        std::string data(width, '\0');
+        uint64_t bits = static_cast<uint64_t>(value);
+        for (size_t i = 0; i < width; ++i) {
+            data[width - 1 - i] = static_cast<char>(bits & 0xff);
+            bits >>= 8;
+        }
+        bound_strs_.push_back(ConstStringPtr(new std::string(data)));
+        values_[index] = bound_strs_.back()->data();
+        lengths_[index] = width;
+        formats_[index] = BINARY_FMT;
+    }
+    integers_.clear();
+}
+
 std::string PsqlBindArray::toText() const {
     std::ostringstream stream;
     for (int i = 0; i < values_.size(); ++i) {
@@ -106,7 +168,8 @@ std::string PsqlBindArray::toText() const {
                 for (int x = 0; x < lengths_[i]; ++x) {
                     stream << std::setfill('0') << std::setw(2)
                            << std::setbase(16)
-                           << static_cast<unsigned int>(data[x]);
+                           << static_cast<unsigned int>
+                              (static_cast<uint8_t>(data[x]));
                 }
                 stream << std::endl;
                 stream << std::setbase(10);
@@ -178,15 +241,40 @@ PgSqlExchange::isColumnNull(const PgSqlResult& r, const int row,
     return (PQgetisnull(r, row, col));
 }
 
+int64_t
+PgSqlExchange::getBinaryInteger(const PgSqlResult& r, const int row,
+                                const size_t col) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>
+        (getRawColumnValue(r, row, col));
+    const int length = PQgetlength(r, row, col);
+    if ((length != 1) && (length != 2) && (length != 4) && (length != 8)) {
+        isc_throw(DbOperationError, "Invalid binary integer size: " << length
+                  << " for: " << getColumnLabel(r, col) << " row:" << row);
+    }
+
+    // PostgreSQL sends integers in network byte order. Extend the sign
+    // of the most significant byte.
+    uint64_t bits = (data[0] & 0x80) ? ~static_cast<uint64_t>(0) : 0;
+    for (int i = 0; i < length; ++i) {
+        bits = (bits << 8) | data[i];
+    }
+    return (static_cast<int64_t>(bits));
+}
+
 void
 PgSqlExchange::getColumnValue(const PgSqlResult& r, const int row,
                               const size_t col, std::string& value) {
-    value = getRawColumnValue(r, row, col);
+    const char* data = getRawColumnValue(r, row, col);
+    value.assign(data, PQgetlength(r, row, col));
 }
 
 void
 PgSqlExchange::getColumnValue(const PgSqlResult& r, const int row,
                               const size_t col, bool &value) {
+    if (PQfformat(r, col) == PsqlBindArray::BINARY_FMT) {
+        value = (getBinaryInteger(r, row, col) != 0);
+        return;
+    }
     const char* data = getRawColumnValue(r, row, col);
     if (!strlen(data) || *data == 'f') {
         value = false;
@@ -202,6 +290,10 @@ PgSqlExchange::getColumnValue(const PgSqlResult& r, const int row,
 void
 PgSqlExchange::getColumnValue(const PgSqlResult& r, const int row,
                               const size_t col, uint8_t &value) {
+    if (PQfformat(r, col) == PsqlBindArray::BINARY_FMT) {
+        getBinaryColumnValue(r, row, col, value, std::true_type());
+        return;
+    }
     const char* data = getRawColumnValue(r, row, col);
     try {
         // lexically casting as uint8_t doesn't convert from char
@@ -232,6 +324,19 @@ PgSqlExchange::convertFromBytea(const PgSqlResult& r, const int row,
                                 const size_t col, uint8_t* buffer,
                                 const size_t buffer_size,
                                 size_t &bytes_converted) {
+    // Binary values are the bytes themselves.
+    if (PQfformat(r, col) == PsqlBindArray::BINARY_FMT) {
+        const char* data = getRawColumnValue(r, row, col);
+        bytes_converted = PQgetlength(r, row, col);
+        if (bytes_converted > buffer_size) {
+            isc_throw (DbOperationError, "Converted data size: "
+                       << bytes_converted << " is too large for: "
+                       << getColumnLabel(r, col) << " row:" << row);
+        }
+        memcpy(buffer, data, bytes_converted);
+        return;
+    }
+
     // Returns converted bytes in a dynamically allocated buffer, and
     // sets bytes_converted.
     unsigned char* bytes = PQunescapeBytea((const unsigned char*)
@@ -279,7 +384,7 @@ PgSqlExchange::dumpRow(const PgSqlResult& r, int row) {
             stream << "\"" << val << "\"" << std::endl;
         } else {
             const char *data = val;
-            int length = PQfsize(r, col);
+            int length = PQgetlength(r, row, col);
             if (length == 0) {
                 stream << "empty" << std::endl;
             } else {
@@ -287,7 +392,7 @@ PgSqlExchange::dumpRow(const PgSqlResult& r, int row) {
                 for (int i = 0; i < length; ++i) {
                     stream << std::setfill('0') << std::setw(2)
                            << std::setbase(16)
-                           << static_cast<unsigned int>(data[i]);
+                           << static_cast<unsigned int>(static_cast<uint8_t>(data[i]));
                 }
                 stream << std::endl;
             }
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,7 +14,10 @@
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <limits>
 #include <stdint.h>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <iostream>
 
@@ -31,11 +34,14 @@ namespace db {
 /// words populating them with pointers to values that go out of scope before
 /// statement is executed is a bad idea.
 ///
-/// Other than vectors or buffers of binary data, all other values are currently
-/// converted to their string representation prior to sending them to PostgreSQL.
-/// All of the add() method variants which accept a non-string value internally
-/// create the conversion string which is then retained in the bind array to ensure
-/// scope.
+/// Other than vectors or buffers of binary data, all other values are
+/// converted to their string representation when they are added. All of the
+/// add() method variants which accept a non-string value internally create the
+/// conversion string which is then retained in the bind array to ensure
+/// scope. Integer and boolean values are also remembered so that
+/// @c applyBinaryFormat can send them in binary format to the parameters
+/// declared with an integer or boolean type, sparing the server the text
+/// parsing.
 ///
 /// @brief smart pointer to const std::strings used by PsqlBindArray to ensure scope
 /// of strings supplying exchange values
@@ -156,6 +162,8 @@ struct PsqlBindArray {
     template<typename T>
     void add(const T& value) {
         addTempString(boost::lexical_cast<std::string>(value));
+        addInteger(value, std::integral_constant<bool, std::is_integral<T>::value &&
+                                                       (sizeof(T) > 1)>());
     }
 
     /// @brief Binds a the given string to the bind array.
@@ -168,12 +176,35 @@ struct PsqlBindArray {
     /// @param str string value to add.
     void addTempString(const std::string& str);
 
+    /// @brief Binds a copy of the given binary data to the bind array.
+    ///
+    /// Same as @c add(const std::vector<uint8_t>&) but the data is copied
+    /// and retained in the bind array, so the caller may reuse its buffer
+    /// before the statement is executed.
+    ///
+    /// @param data vector of binary bytes.
+    void addTempBinary(const std::vector<uint8_t>& data);
+
     /// @brief Adds a NULL value to the bind array
     ///
     /// This should be used whenever a the value for a parameter specified
     /// in the SQL statement should be NULL.
     void addNull(const int format = PsqlBindArray::TEXT_FMT);
 
+    /// @brief Sends integer and boolean values in binary format.
+    ///
+    /// The values added as integers or booleans are converted to the
+    /// binary (network order) representation of the type declared for the
+    /// corresponding parameter of the prepared statement: OID_BOOL,
+    /// OID_INT2, OID_INT4 or OID_INT8. The other values, and the values
+    /// which don't fit the declared type, are left in text format.
+    ///
+    /// This must be called after all values have been added, before the
+    /// statement is executed. It may be called more than once.
+    ///
+    /// @param statement The prepared statement to be executed.
+    void applyBinaryFormat(const PgSqlTaggedStatement& statement);
+
     //std::vector<const std::string> getBoundStrs() {
     std::vector<ConstStringPtr> getBoundStrs() {
         return (bound_strs_);
@@ -184,9 +215,31 @@ struct PsqlBindArray {
     std::string toText() const;
 
 private:
+    /// @brief Remembers the integer value of the last added entry.
+    ///
+    /// @param value integer value of the last added entry.
+    template<typename T>
+    void addInteger(const T& value, std::true_type) {
+        // Values which don't fit in a signed 64-bit integer are sent as text.
+        if (!std::is_signed<T>::value &&
+            (static_cast<uint64_t>(value) >
+             static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))) {
+            return;
+        }
+        integers_.push_back(std::make_pair(values_.size() - 1,
+                                           static_cast<int64_t>(value)));
+    }
+
+    /// @brief Ignores values which are not integers.
+    template<typename T>
+    void addInteger(const T&, std::false_type) {
+    }
+
     /// @brief vector of strings which supplied the values
     std::vector<ConstStringPtr> bound_strs_;
 
+    /// @brief Indexes and values of the entries added as integers.
+    std::vector<std::pair<size_t, int64_t> > integers_;
 };
 
 /// @brief Defines a smart pointer to PsqlBindArray
@@ -336,10 +389,23 @@ public:
     static bool isColumnNull(const PgSqlResult& r, const int row,
                              const size_t col);
 
-    /// @brief Fetches a text column as the given value type
+    /// @brief Fetches a binary bool, int2, int4 or int8 column value.
+    ///
+    /// @param r the result set containing the query results
+    /// @param row the row number within the result set
+    /// @param col the column number within the row
+    ///
+    /// @return The value converted from network byte order.
+    /// @throw  DbOperationError if the value cannot be fetched or its
+    /// size doesn't match an integer type.
+    static int64_t getBinaryInteger(const PgSqlResult& r, const int row,
+                                    const size_t col);
+
+    /// @brief Fetches an integer column as the given value type
     ///
     /// Uses boost::lexicalcast to convert the text column value into
-    /// a value of type T.
+    /// a value of type T. Binary column values are decoded with
+    /// @ref getBinaryInteger and must fit in type T.
     ///
     /// @param r the result set containing the query results
     /// @param row the row number within the result set
@@ -351,6 +417,11 @@ public:
     template<typename T>
     static void getColumnValue(const PgSqlResult& r, const int row,
                                const size_t col, T& value) {
+        if (PQfformat(r, col) == PsqlBindArray::BINARY_FMT) {
+            getBinaryColumnValue(r, row, col, value,
+                                 std::is_integral<T>());
+            return;
+        }
         const char* data = getRawColumnValue(r, row, col);
         try {
             value = boost::lexical_cast<T>(data);
@@ -364,7 +435,8 @@ public:
     /// @brief Converts a column in a row in a result set to a binary bytes
     ///
     /// Method is used to convert columns stored as BYTEA into a buffer of
-    /// binary bytes, (uint8_t).  It uses PQunescapeBytea to do the conversion.
+    /// binary bytes, (uint8_t).  It uses PQunescapeBytea to do the conversion
+    /// of text column values. Binary column values are copied as is.
     ///
     /// @param r the result set containing the query results
     /// @param row the row number within the result set
@@ -391,6 +463,39 @@ public:
     static std::string dumpRow(const PgSqlResult& r, int row);
 
 protected:
+    /// @brief Stores a binary integer column value in an integer.
+    ///
+    /// @param r the result set containing the query results
+    /// @param row the row number within the result set
+    /// @param col the column number within the row
+    /// @param[out] value parameter to receive the converted value
+    ///
+    /// @throw  DbOperationError if the value doesn't fit in type T.
+    template<typename T>
+    static void getBinaryColumnValue(const PgSqlResult& r, const int row,
+                                     const size_t col, T& value,
+                                     std::true_type) {
+        int64_t integer = getBinaryInteger(r, row, col);
+        if (((integer < 0) && !std::is_signed<T>::value) ||
+            (static_cast<int64_t>(static_cast<T>(integer)) != integer)) {
+            isc_throw(db::DbOperationError, "Invalid data:[" << integer
+                      << "] for row: " << row << " col: " << col << ","
+                      << getColumnLabel(r, col) << " : out of range");
+        }
+        value = static_cast<T>(integer);
+    }
+
+    /// @brief Rejects a binary column value for a non integer type.
+    ///
+    /// @throw  DbOperationError always.
+    template<typename T>
+    static void getBinaryColumnValue(const PgSqlResult& r, const int row,
+                                     const size_t col, T&,
+                                     std::false_type) {
+        isc_throw(db::DbOperationError, "Unsupported binary data for row: "
+                  << row << " col: " << col << "," << getColumnLabel(r, col));
+    }
+
     /// @brief Stores text labels for columns, currently only used for
     /// logging and errors.
     std::vector<std::string>columns_;
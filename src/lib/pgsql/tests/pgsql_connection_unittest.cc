@@ -0,0 +1,199 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <database/db_exceptions.h>
+#include <pgsql/pgsql_connection.h>
+#include <pgsql/pgsql_exchange.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::db;
+
+namespace {
+
+typedef boost::shared_ptr<PgSqlConnection> PgSqlConnectionPtr;
+
+/// @brief Prepared statements used by the tests.
+PgSqlTaggedStatement pipeline_statements[] = {
+    // INSERT_ROW
+    { 2, { OID_INT4, OID_INT4 }, "pipeline_insert",
+      "INSERT INTO pipeline (id, value) VALUES ($1, $2)" },
+
+    // UPDATE_ROWS
+    { 1, { OID_INT4 }, "pipeline_update",
+      "UPDATE pipeline SET value = $1" }
+};
+
+/// @brief Index of the insert statement.
+const size_t INSERT_ROW = 0;
+
+/// @brief Index of the update statement.
+const size_t UPDATE_ROWS = 1;
+
+/// @brief Number of rows left by a sequence whose first statement succeeds
+/// and second statement fails.
+///
+/// Pipelined statements run in one implicit transaction which the failure
+/// rolls back. Statements executed one by one are committed individually.
+#ifdef LIBPQ_HAS_PIPELINING
+const int ROWS_AFTER_FAILURE = 0;
+#else
+const int ROWS_AFTER_FAILURE = 1;
+#endif
+
+/// @brief Fixture for exercising the execution of statement sequences.
+///
+/// It creates a table called "pipeline" during construction and drops it
+/// upon destruction.
+class PgSqlConnectionTest : public ::testing::Test {
+public:
+    /// @brief Constructor
+    ///
+    /// Creates the database connection, opens the database, creates the
+    /// table and prepares the statements.
+    PgSqlConnectionTest() {
+        PgSqlConnection::ParameterMap params;
+        params["name"] = "keatest";
+        params["user"] = "keatest";
+        params["password"] = "keatest";
+
+        conn_.reset(new PgSqlConnection(params));
+        conn_->openDatabase();
+
+        runSql("DROP TABLE IF EXISTS pipeline");
+        runSql("CREATE TABLE pipeline (id INT PRIMARY KEY NOT NULL, "
+               "value INT NOT NULL)");
+
+        for (auto& statement : pipeline_statements) {
+            conn_->prepareStatement(statement);
+        }
+    }
+
+    /// @brief Destructor
+    ///
+    /// Drops the table.
+    virtual ~PgSqlConnectionTest() {
+        runSql("DROP TABLE IF EXISTS pipeline");
+    }
+
+    /// @brief Executes a SQL statement which returns no rows.
+    ///
+    /// @param sql The statement.
+    void runSql(const std::string& sql) {
+        PgSqlResult r(PQexec(*conn_, sql.c_str()));
+        ASSERT_EQ(PGRES_COMMAND_OK, PQresultStatus(r))
+            << sql << ": " << PQerrorMessage(*conn_);
+    }
+
+    /// @brief Returns the number of rows of the table.
+    int countRows() {
+        PgSqlResult r(PQexec(*conn_, "SELECT id FROM pipeline"));
+        EXPECT_EQ(PGRES_TUPLES_OK, PQresultStatus(r))
+            << PQerrorMessage(*conn_);
+        return (r.getRows());
+    }
+
+    /// @brief Adds an insert statement to a pipeline.
+    ///
+    /// @param pipeline The pipeline.
+    /// @param id The id of the inserted row.
+    /// @param value The value of the inserted row.
+    void addInsert(PgSqlPipeline& pipeline, int32_t id, int32_t value) {
+        PsqlBindArrayPtr bind_array(new PsqlBindArray());
+        bind_array->add(id);
+        bind_array->add(value);
+        pipeline.push_back(PgSqlPipelineEntry(&pipeline_statements[INSERT_ROW],
+                                              bind_array));
+    }
+
+    /// @brief Database connection
+    PgSqlConnectionPtr conn_;
+};
+
+// Verifies that the statements of a pipeline are all executed and that
+// their affected row counts are returned.
+TEST_F(PgSqlConnectionTest, executePipeline) {
+    PgSqlPipeline pipeline;
+    addInsert(pipeline, 1, 10);
+    addInsert(pipeline, 2, 20);
+    PsqlBindArrayPtr bind_array(new PsqlBindArray());
+    bind_array->add(int32_t(30));
+    pipeline.push_back(PgSqlPipelineEntry(&pipeline_statements[UPDATE_ROWS],
+                                          bind_array));
+
+    std::vector<size_t> affected_rows;
+    ASSERT_NO_THROW(affected_rows = conn_->executePipeline(pipeline));
+    ASSERT_EQ(3, affected_rows.size());
+    EXPECT_EQ(1, affected_rows[0]);
+    EXPECT_EQ(1, affected_rows[1]);
+    EXPECT_EQ(2, affected_rows[2]);
+    EXPECT_EQ(2, countRows());
+
+    // A single statement is executed as well.
+    pipeline.clear();
+    addInsert(pipeline, 3, 30);
+    ASSERT_NO_THROW(affected_rows = conn_->executePipeline(pipeline));
+    ASSERT_EQ(1, affected_rows.size());
+    EXPECT_EQ(1, affected_rows[0]);
+    EXPECT_EQ(3, countRows());
+}
+
+// Verifies that a duplicate key raises DuplicateEntry, that the statements
+// which follow it are not executed and that the connection remains usable.
+TEST_F(PgSqlConnectionTest, executePipelineDuplicate) {
+    PgSqlPipeline pipeline;
+    addInsert(pipeline, 1, 10);
+    addInsert(pipeline, 1, 20);
+    addInsert(pipeline, 2, 30);
+
+    EXPECT_THROW(conn_->executePipeline(pipeline), DuplicateEntry);
+
+    // The statement which follows the failed one was not executed.
+    EXPECT_EQ(ROWS_AFTER_FAILURE, countRows());
+
+    // The connection is no longer in pipeline mode.
+    pipeline.clear();
+    addInsert(pipeline, 2, 30);
+    addInsert(pipeline, 3, 30);
+    EXPECT_NO_THROW(conn_->executePipeline(pipeline));
+    EXPECT_EQ(ROWS_AFTER_FAILURE + 2, countRows());
+}
+
+// Verifies that a failed statement raises DbOperationError and that the
+// statements which follow it are aborted.
+TEST_F(PgSqlConnectionTest, executePipelineAborted) {
+    PgSqlPipeline pipeline;
+    addInsert(pipeline, 1, 10);
+
+    // A NULL value violates the NOT NULL constraint.
+    PsqlBindArrayPtr bind_array(new PsqlBindArray());
+    bind_array->add(int32_t(2));
+    bind_array->addNull();
+    pipeline.push_back(PgSqlPipelineEntry(&pipeline_statements[INSERT_ROW],
+                                          bind_array));
+    addInsert(pipeline, 3, 30);
+
+    EXPECT_THROW(conn_->executePipeline(pipeline), DbOperationError);
+
+    // The statement which follows the failed one was not executed.
+    EXPECT_EQ(ROWS_AFTER_FAILURE, countRows());
+
+    // The connection remains usable.
+    pipeline.clear();
+    addInsert(pipeline, 2, 20);
+    addInsert(pipeline, 3, 30);
+    EXPECT_NO_THROW(conn_->executePipeline(pipeline));
+    EXPECT_EQ(ROWS_AFTER_FAILURE + 2, countRows());
+}
+
+}; // namespace
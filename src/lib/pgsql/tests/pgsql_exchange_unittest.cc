@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -90,6 +90,65 @@ TEST(PsqlBindArray, addDataTest) {
     EXPECT_EQ(expected, b.toText());
 }
 
+/// @brief Verifies that binary data can be copied in the bind array.
+TEST(PsqlBindArray, addTempBinaryTest) {
+    PsqlBindArray b;
+    {
+        std::vector<uint8_t> bytes;
+        bytes.push_back(0x01);
+        bytes.push_back(0xfe);
+        b.addTempBinary(bytes);
+        bytes.clear();
+        b.addTempBinary(bytes);
+    }
+
+    EXPECT_EQ("0 : 0x01fe\n"
+              "1 : empty\n", b.toText());
+}
+
+/// @brief Verifies that integers and booleans are converted to the binary
+/// format of the types declared by the statement.
+TEST(PsqlBindArray, applyBinaryFormatTest) {
+    PgSqlTaggedStatement statement = {
+        8,
+        { OID_INT8, OID_INT4, OID_INT2, OID_BOOL, OID_INT8,
+          OID_INT2, OID_TEXT, OID_INT8 },
+        "test_statement",
+        "not executed"
+    };
+
+    PsqlBindArray b;
+    b.add(static_cast<uint32_t>(3221360418U));
+    b.add(-2);
+    b.add(static_cast<uint16_t>(258));
+    b.add(true);
+    b.add(isc::asiolink::IOAddress("192.2.15.34"));
+    // Out of range for the declared type.
+    b.add(100000);
+    // Declared as text.
+    b.add(5);
+    // Not an integer.
+    b.add("7");
+
+    b.applyBinaryFormat(statement);
+
+    std::string expected =
+        "0 : 0x00000000c0020f22\n"
+        "1 : 0xfffffffe\n"
+        "2 : 0x0102\n"
+        "3 : 0x01\n"
+        "4 : 0x00000000c0020f22\n"
+        "5 : \"100000\"\n"
+        "6 : \"5\"\n"
+        "7 : \"7\"\n";
+    EXPECT_EQ(expected, b.toText());
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(PsqlBindArray::BINARY_FMT, b.formats_[i]);
+    }
+    EXPECT_EQ(8, b.lengths_[0]);
+    EXPECT_EQ(1, b.lengths_[3]);
+}
+
 /// @brief Defines a pointer to a PgSqlConnection
 typedef boost::shared_ptr<PgSqlConnection> PgSqlConnectionPtr;
 /// @brief Defines a pointer to a PgSqlResult
@@ -920,4 +979,84 @@ TEST_F(PgSqlBasicsTest, timeStampTest) {
                                                       MAX_DB_TIME), BadValue);
 }
 
+/// @brief Verify that the column values can be fetched in binary format.
+TEST_F(PgSqlBasicsTest, binaryResultTest) {
+    PgSqlResultPtr r;
+    RUN_SQL(r, "INSERT INTO basics (bool_col, bytea_col, bigint_col, "
+            "smallint_col, int_col, text_col, timestamp_col, varchar_col) "
+            "VALUES (TRUE, '\\x0102ff'::bytea, -2, 300, 70000, 'text', "
+            "'2020-01-01 00:00:00+00', 'varchar')", PGRES_COMMAND_OK);
+
+    // Fetch the row with binary results.
+    std::string sql =
+        "SELECT"
+        "   id, bool_col, bytea_col, bigint_col, smallint_col, "
+        "   int_col, text_col,"
+        "   extract(epoch from timestamp_col)::bigint as timestamp_col,"
+        "   varchar_col FROM basics";
+    r.reset(new PgSqlResult(PQexecParams(*conn_, sql.c_str(), 0, 0, 0, 0, 0,
+                                         PsqlBindArray::BINARY_FMT)));
+    ASSERT_EQ(PGRES_TUPLES_OK, PQresultStatus(*r));
+    ASSERT_EQ(1, r->getRows());
+    EXPECT_EQ(PsqlBindArray::BINARY_FMT, PQfformat(*r, BYTEA_COL));
+
+    bool bool_value = false;
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, BOOL_COL, bool_value));
+    EXPECT_TRUE(bool_value);
+
+    uint8_t bytes[3];
+    size_t byte_count = 0;
+    ASSERT_NO_THROW(PgSqlExchange::convertFromBytea(*r, 0, BYTEA_COL, bytes,
+                                                    sizeof(bytes), byte_count));
+    ASSERT_EQ(3, byte_count);
+    EXPECT_EQ(0x01, bytes[0]);
+    EXPECT_EQ(0x02, bytes[1]);
+    EXPECT_EQ(0xff, bytes[2]);
+
+    // A too small buffer throws.
+    EXPECT_THROW(PgSqlExchange::convertFromBytea(*r, 0, BYTEA_COL, bytes,
+                                                 sizeof(bytes) - 1, byte_count),
+                 DbOperationError);
+
+    int64_t bigint_value = 0;
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, BIGINT_COL,
+                                                  bigint_value));
+    EXPECT_EQ(-2, bigint_value);
+
+    // Negative values don't fit in unsigned types.
+    uint32_t unsigned_value = 0;
+    EXPECT_THROW(PgSqlExchange::getColumnValue(*r, 0, BIGINT_COL,
+                                               unsigned_value),
+                 DbOperationError);
+
+    uint16_t smallint_value = 0;
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, SMALLINT_COL,
+                                                  smallint_value));
+    EXPECT_EQ(300, smallint_value);
+
+    // 300 doesn't fit in an uint8_t.
+    uint8_t byte_value = 0;
+    EXPECT_THROW(PgSqlExchange::getColumnValue(*r, 0, SMALLINT_COL,
+                                               byte_value),
+                 DbOperationError);
+
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, INT_COL,
+                                                  unsigned_value));
+    EXPECT_EQ(70000, unsigned_value);
+
+    std::string text_value;
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, TEXT_COL,
+                                                  text_value));
+    EXPECT_EQ("text", text_value);
+
+    time_t time_value = 0;
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, TIMESTAMP_COL,
+                                                  time_value));
+    EXPECT_EQ(1577836800, time_value);
+
+    ASSERT_NO_THROW(PgSqlExchange::getColumnValue(*r, 0, VARCHAR_COL,
+                                                  text_value));
+    EXPECT_EQ("varchar", text_value);
+}
+
 }; // namespace
@@ -9,6 +9,7 @@
 #include <process/daemon.h>
 #include <process/log_parser.h>
 #include <exceptions/exceptions.h>
+#include <log/logger_manager.h>
 #include <log/logger_name.h>
 #include <log/logger_support.h>
 #include <process/config_base.h>
@@ -51,6 +52,13 @@ Daemon::~Daemon() {
     if (pid_file_ && am_file_author_) {
         pid_file_->deleteFile();
     }
+
+    // Report the messages suppressed by the rate limits before exiting.
+    try {
+        isc::log::LoggerManager::flushRateLimits();
+    } catch (...) {
+        // Logging is not usable anymore.
+    }
 }
 
 void Daemon::cleanup() {
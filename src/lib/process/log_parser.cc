@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 #include <log/logger_support.h>
 #include <log/logger_manager.h>
 #include <log/logger_name.h>
+#include <log/output_option.h>
 
 using namespace isc::data;
 using namespace isc::log;
@@ -101,6 +102,40 @@ void LogConfigParser::parseConfigEntry(isc::data::ConstElementPtr entry) {
         }
     }
 
+    // Get the rate limited messages and their limit
+    isc::data::ConstElementPtr messages_ptr = entry->get("rate-limited-messages");
+    if (messages_ptr) {
+        BOOST_FOREACH(ConstElementPtr message, messages_ptr->listValue()) {
+            if (message->stringValue().empty()) {
+                isc_throw(BadValue, "rate-limited-messages entries must not be "
+                          "empty (" << message->getPosition() << ")");
+            }
+            info.rate_limited_messages_.push_back(message->stringValue());
+        }
+    }
+
+    isc::data::ConstElementPtr rate_limit_ptr = entry->get("rate-limit");
+    if (rate_limit_ptr) {
+        int64_t rate_limit = rate_limit_ptr->intValue();
+        if ((rate_limit < 0) || (rate_limit > 0xffffffff)) {
+            isc_throw(BadValue, "Unsupported rate-limit value "
+                      << rate_limit << ", expected 0-4294967295 ("
+                      << rate_limit_ptr->getPosition() << ")");
+        }
+        info.rate_limit_ = static_cast<uint32_t>(rate_limit);
+    }
+
+    isc::data::ConstElementPtr interval_ptr = entry->get("rate-limit-interval");
+    if (interval_ptr) {
+        int64_t interval = interval_ptr->intValue();
+        if ((interval < 1) || (interval > 86400)) {
+            isc_throw(BadValue, "Unsupported rate-limit-interval value "
+                      << interval << ", expected 1-86400 ("
+                      << interval_ptr->getPosition() << ")");
+        }
+        info.rate_limit_interval_ = static_cast<uint32_t>(interval);
+    }
+
     // We want to follow the normal path, so it could catch parsing errors even
     // when verbose mode is enabled. If it is, just override whatever was parsed
     // in the config file.
@@ -155,6 +190,37 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
             dest.pattern_ = pattern->stringValue();
         }
 
+        isc::data::ConstElementPtr async_ptr = output_option->get("async");
+        if (async_ptr) {
+            dest.async_ = async_ptr->boolValue();
+        }
+
+        isc::data::ConstElementPtr queue_size_ptr =
+            output_option->get("async-queue-size");
+        if (queue_size_ptr) {
+            int64_t queue_size = queue_size_ptr->intValue();
+            if ((queue_size <= 0) || (queue_size > 1048576)) {
+                isc_throw(BadValue, "Unsupported async-queue-size value "
+                          << queue_size << ", expected 1-1048576 ("
+                          << queue_size_ptr->getPosition() << ")");
+            }
+            dest.async_queue_size_ = static_cast<uint32_t>(queue_size);
+        }
+
+        isc::data::ConstElementPtr overflow_ptr =
+            output_option->get("async-overflow");
+        if (overflow_ptr) {
+            try {
+                getOverflow(overflow_ptr->stringValue());
+            } catch (const std::exception&) {
+                isc_throw(BadValue, "Unsupported async-overflow value '"
+                          << overflow_ptr->stringValue()
+                          << "', expected block, drop or count ("
+                          << overflow_ptr->getPosition() << ")");
+            }
+            dest.async_overflow_ = overflow_ptr->stringValue();
+        }
+
         destination.push_back(dest);
     }
 }
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,7 +21,10 @@ LoggingDestination::equals(const LoggingDestination& other) const {
             maxver_ == other.maxver_ &&
             maxsize_ == other.maxsize_ &&
             flush_ == other.flush_ &&
-            pattern_ == other.pattern_);
+            pattern_ == other.pattern_ &&
+            async_ == other.async_ &&
+            async_queue_size_ == other.async_queue_size_ &&
+            async_overflow_ == other.async_overflow_);
 }
 
 ElementPtr
@@ -38,12 +41,21 @@ LoggingDestination::toElement() const {
     result->set("flush", Element::create(flush_));
     // Set pattern
     result->set("pattern", Element::create(pattern_));
+    // Set asynchronous writing parameters
+    if (async_) {
+        result->set("async", Element::create(async_));
+        result->set("async-queue-size",
+                    Element::create(static_cast<long long>(async_queue_size_)));
+        result->set("async-overflow", Element::create(async_overflow_));
+    }
 
     return(result);
 }
 
 LoggingInfo::LoggingInfo()
-    : name_("kea"), severity_(isc::log::INFO), debuglevel_(0) {
+    : name_("kea"), severity_(isc::log::INFO), debuglevel_(0),
+      rate_limited_messages_(), rate_limit_(DEFAULT_RATE_LIMIT),
+      rate_limit_interval_(DEFAULT_RATE_LIMIT_INTERVAL) {
     // If configuration Manager is in the verbose mode, we need to modify the
     // default settings.
     if (Daemon::getVerbose()) {
@@ -97,7 +109,10 @@ LoggingInfo::equals(const LoggingInfo& other) const {
     // equality.
     return (name_ == other.name_ &&
             severity_ == other.severity_ &&
-            debuglevel_ == other.debuglevel_);
+            debuglevel_ == other.debuglevel_ &&
+            rate_limited_messages_ == other.rate_limited_messages_ &&
+            rate_limit_ == other.rate_limit_ &&
+            rate_limit_interval_ == other.rate_limit_interval_);
 }
 
 LoggerSpecification
@@ -109,6 +124,14 @@ LoggingInfo::toSpec() const {
 
     LoggerSpecification spec(name_, severity_, debuglevel_);
 
+    // Set the rate limits.
+    spec.setRateLimit(rate_limit_, rate_limit_interval_);
+    for (std::vector<std::string>::const_iterator ident =
+             rate_limited_messages_.begin();
+         ident != rate_limited_messages_.end(); ++ident) {
+        spec.addRateLimitedMessage(*ident);
+    }
+
     // Go over logger destinations and create output options accordingly.
     for (std::vector<LoggingDestination>::const_iterator dest =
              destinations_.begin(); dest != destinations_.end(); ++dest) {
@@ -155,6 +178,11 @@ LoggingInfo::toSpec() const {
         // Copy the pattern
         option.pattern = dest->pattern_;
 
+        // Copy the asynchronous writing parameters
+        option.async = dest->async_;
+        option.async_queue_size = dest->async_queue_size_;
+        option.async_overflow = getOverflow(dest->async_overflow_);
+
         // ... and set the destination
         spec.addOutputOption(option);
     }
@@ -207,6 +235,20 @@ LoggingInfo::toElement() const {
     result->set("severity", Element::create(severity));
     // Set debug level
     result->set("debuglevel", Element::create(debuglevel_));
+    // Set rate limits
+    if (!rate_limited_messages_.empty()) {
+        ElementPtr messages = Element::createList();
+        for (std::vector<std::string>::const_iterator ident =
+                 rate_limited_messages_.begin();
+             ident != rate_limited_messages_.end(); ++ident) {
+            messages->add(Element::create(*ident));
+        }
+        result->set("rate-limited-messages", messages);
+        result->set("rate-limit",
+                    Element::create(static_cast<long long>(rate_limit_)));
+        result->set("rate-limit-interval",
+                    Element::create(static_cast<long long>(rate_limit_interval_)));
+    }
     return (result);
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -42,6 +42,17 @@ public:
     /// It dictates what additional elements are output
     std::string pattern_;
 
+    /// @brief Write from a background thread
+    bool async_;
+
+    /// @brief Capacity of the queue when writing asynchronously
+    uint32_t async_queue_size_;
+
+    /// @brief Overflow policy when writing asynchronously
+    ///
+    /// Values accepted are: block, drop and count.
+    std::string async_overflow_;
+
     /// @brief Compares two objects for equality.
     ///
     /// @param other Object to be compared with this object.
@@ -51,11 +62,17 @@ public:
 
     /// @brief Default constructor.
     LoggingDestination()
-        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true), pattern_("") {
+        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true), pattern_(""),
+          async_(false),
+          async_queue_size_(isc::log::OutputOption::DEFAULT_ASYNC_QUEUE_SIZE),
+          async_overflow_("block") {
     }
 
     /// @brief Unparse a configuration object
     ///
+    /// The asynchronous writing parameters are unparsed only when the
+    /// asynchronous writing is enabled.
+    ///
     /// @return a pointer to unparsed configuration
     virtual isc::data::ElementPtr toElement() const;
 };
@@ -72,15 +89,27 @@ public:
 ///                    "maxver": 8,
 ///                    "maxsize": 204800,
 ///                    "flush": true
-///                    "pattern": "%-5p [%c] %m\n"
+///                    "pattern": "%-5p [%c] %m\n",
+///                    "async": true,
+///                    "async-queue-size": 4096,
+///                    "async-overflow": "count"
 ///                }
 ///            ],
 ///            "severity": "WARN",
-///            "debuglevel": 99
+///            "debuglevel": 99,
+///            "rate-limited-messages": [ "DHCP4_PACKET_DROP_0001" ],
+///            "rate-limit": 10,
+///            "rate-limit-interval": 1
 ///        },
 class LoggingInfo : public isc::data::UserContext, public isc::data::CfgToElement {
 public:
 
+    /// @brief Default maximum number of rate limited messages per interval
+    static const uint32_t DEFAULT_RATE_LIMIT = 10;
+
+    /// @brief Default length of the rate limit interval in seconds
+    static const uint32_t DEFAULT_RATE_LIMIT_INTERVAL = 1;
+
     /// @brief logging name
     std::string name_;
 
@@ -95,6 +124,15 @@ public:
     /// @brief specific logging destinations
     std::vector<LoggingDestination> destinations_;
 
+    /// @brief Identifications of the rate limited messages
+    std::vector<std::string> rate_limited_messages_;
+
+    /// @brief Maximum number of each rate limited message per interval
+    uint32_t rate_limit_;
+
+    /// @brief Length of the rate limit interval in seconds
+    uint32_t rate_limit_interval_;
+
     /// @brief Default constructor.
     LoggingInfo();
 
@@ -133,6 +171,9 @@ public:
 
     /// @brief Unparse a configuration object
     ///
+    /// The rate limit parameters are unparsed only when there are rate
+    /// limited messages.
+    ///
     /// @return a pointer to unparsed configuration
     virtual isc::data::ElementPtr toElement() const;
 };
@@ -10,11 +10,15 @@
 #include <process/process_messages.h>
 #include <exceptions/exceptions.h>
 #include <log/logger_support.h>
+#include <log/message_rate_limiter.h>
 #include <process/d_log.h>
 #include <testutils/io_utils.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <iterator>
+
 using namespace isc;
 using namespace isc::process;
 using namespace isc::data;
@@ -451,6 +455,208 @@ TEST_F(LoggingTest, emptyPattern) {
     EXPECT_TRUE(storage->getLoggingInfo()[0].destinations_[0].pattern_.empty());
 }
 
+// Verifies that the asynchronous writing parameters parse correctly,
+// are unparsed and make the output asynchronous.
+TEST_F(LoggingTest, asyncOutput) {
+    wipeFiles();
+
+    std::ostringstream os;
+    os <<
+        "{ \"loggers\": ["
+        "    {"
+        "        \"name\": \"kea\","
+        "        \"output_options\": ["
+        "            {"
+        "                \"output\": \""
+        << TEST_LOG_NAME << "\","  <<
+        "                \"async\": true,"
+        "                \"async-queue-size\": 64,"
+        "                \"async-overflow\": \"count\""
+        "            }"
+        "        ],"
+        "        \"severity\": \"INFO\""
+        "    }"
+        "]}";
+
+    ConfigPtr server_cfg(new ConfigBase());
+    ConstElementPtr config = Element::fromJSON(os.str());
+    config = config->get("loggers");
+
+    LogConfigParser parser(server_cfg);
+    ASSERT_NO_THROW(parser.parseConfiguration(config));
+
+    ASSERT_EQ(1, server_cfg->getLoggingInfo().size());
+    ASSERT_EQ(1, server_cfg->getLoggingInfo()[0].destinations_.size());
+    const LoggingDestination& dest =
+        server_cfg->getLoggingInfo()[0].destinations_[0];
+    EXPECT_TRUE(dest.async_);
+    EXPECT_EQ(64, dest.async_queue_size_);
+    EXPECT_EQ("count", dest.async_overflow_);
+
+    ConstElementPtr unparsed = dest.toElement();
+    ASSERT_TRUE(unparsed->get("async"));
+    EXPECT_TRUE(unparsed->get("async")->boolValue());
+    ASSERT_TRUE(unparsed->get("async-queue-size"));
+    EXPECT_EQ(64, unparsed->get("async-queue-size")->intValue());
+    ASSERT_TRUE(unparsed->get("async-overflow"));
+    EXPECT_EQ("count", unparsed->get("async-overflow")->stringValue());
+
+    isc::log::LoggerSpecification spec =
+        server_cfg->getLoggingInfo()[0].toSpec();
+    ASSERT_EQ(1, spec.optionCount());
+    EXPECT_TRUE(spec.begin()->async);
+    EXPECT_EQ(64, spec.begin()->async_queue_size);
+    EXPECT_EQ(isc::log::OutputOption::OVERFLOW_COUNT,
+              spec.begin()->async_overflow);
+
+    // Log a message and reset the logging, which writes the pending
+    // messages before the file is checked.
+    ASSERT_NO_THROW(server_cfg->applyLoggingCfg());
+    isc::log::Logger logger("kea");
+    LOG_INFO(logger, DCTL_CONFIG_COMPLETE).arg("async");
+    isc::log::initLogger();
+
+    std::ifstream ifs(TEST_LOG_NAME);
+    std::string content((std::istreambuf_iterator<char>(ifs)),
+                        std::istreambuf_iterator<char>());
+    EXPECT_NE(std::string::npos, content.find("DCTL_CONFIG_COMPLETE"));
+
+    wipeFiles();
+}
+
+// Verifies that invalid asynchronous writing parameters are rejected.
+TEST_F(LoggingTest, asyncOutputInvalid) {
+    const char* bad_params[] = {
+        "\"async-queue-size\": 0",
+        "\"async-queue-size\": 2000000",
+        "\"async-overflow\": \"wait\""
+    };
+
+    for (auto bad_param : bad_params) {
+        std::ostringstream os;
+        os <<
+            "{ \"loggers\": ["
+            "    {"
+            "        \"name\": \"kea\","
+            "        \"output_options\": ["
+            "            {"
+            "                \"output\": \"stdout\","
+            "                \"async\": true,"
+            << bad_param <<
+            "            }"
+            "        ],"
+            "        \"severity\": \"INFO\""
+            "    }"
+            "]}";
+
+        ConfigPtr storage(new ConfigBase());
+        ConstElementPtr config = Element::fromJSON(os.str());
+        config = config->get("loggers");
+
+        LogConfigParser parser(storage);
+        EXPECT_THROW(parser.parseConfiguration(config), BadValue) << bad_param;
+    }
+}
+
+// Verifies that the rate limits are parsed and applied.
+TEST_F(LoggingTest, rateLimits) {
+    wipeFiles();
+
+    std::ostringstream os;
+    os <<
+        "{ \"loggers\": ["
+        "    {"
+        "        \"name\": \"kea\","
+        "        \"output_options\": ["
+        "            {"
+        "                \"output\": \""
+        << TEST_LOG_NAME << "\""  <<
+        "            }"
+        "        ],"
+        "        \"severity\": \"INFO\","
+        "        \"rate-limited-messages\": [ \"DCTL_CONFIG_COMPLETE\" ],"
+        "        \"rate-limit\": 2,"
+        "        \"rate-limit-interval\": 3600"
+        "    }"
+        "]}";
+
+    ConfigPtr server_cfg(new ConfigBase());
+    ConstElementPtr config = Element::fromJSON(os.str());
+    config = config->get("loggers");
+
+    LogConfigParser parser(server_cfg);
+    ASSERT_NO_THROW(parser.parseConfiguration(config));
+
+    ASSERT_EQ(1, server_cfg->getLoggingInfo().size());
+    const LoggingInfo& info = server_cfg->getLoggingInfo()[0];
+    ASSERT_EQ(1, info.rate_limited_messages_.size());
+    EXPECT_EQ("DCTL_CONFIG_COMPLETE", info.rate_limited_messages_[0]);
+    EXPECT_EQ(2, info.rate_limit_);
+    EXPECT_EQ(3600, info.rate_limit_interval_);
+
+    ConstElementPtr unparsed = info.toElement();
+    ASSERT_TRUE(unparsed->get("rate-limited-messages"));
+    EXPECT_EQ("[ \"DCTL_CONFIG_COMPLETE\" ]",
+              unparsed->get("rate-limited-messages")->str());
+    ASSERT_TRUE(unparsed->get("rate-limit"));
+    EXPECT_EQ(2, unparsed->get("rate-limit")->intValue());
+    ASSERT_TRUE(unparsed->get("rate-limit-interval"));
+    EXPECT_EQ(3600, unparsed->get("rate-limit-interval")->intValue());
+
+    // Only the first two messages are logged during the interval.
+    ASSERT_NO_THROW(server_cfg->applyLoggingCfg());
+    isc::log::Logger logger("kea");
+    for (int i = 0; i < 5; ++i) {
+        LOG_INFO(logger, DCTL_CONFIG_COMPLETE).arg(i);
+    }
+    isc::log::initLogger();
+
+    std::ifstream ifs(TEST_LOG_NAME);
+    std::string content((std::istreambuf_iterator<char>(ifs)),
+                        std::istreambuf_iterator<char>());
+    EXPECT_NE(std::string::npos, content.find("DCTL_CONFIG_COMPLETE"));
+    size_t count = 0;
+    for (size_t pos = content.find("DCTL_CONFIG_COMPLETE");
+         pos != std::string::npos;
+         pos = content.find("DCTL_CONFIG_COMPLETE", pos + 1)) {
+        ++count;
+    }
+    EXPECT_EQ(2, count);
+
+    // Do not leak the limit to the other tests.
+    isc::log::MessageRateLimiter::instance().clear();
+    wipeFiles();
+}
+
+// Verifies that invalid rate limit parameters are rejected.
+TEST_F(LoggingTest, rateLimitsInvalid) {
+    const char* bad_params[] = {
+        "\"rate-limited-messages\": [ \"\" ]",
+        "\"rate-limit\": -1",
+        "\"rate-limit-interval\": 0",
+        "\"rate-limit-interval\": 100000"
+    };
+
+    for (auto bad_param : bad_params) {
+        std::ostringstream os;
+        os <<
+            "{ \"loggers\": ["
+            "    {"
+            "        \"name\": \"kea\","
+            "        \"severity\": \"INFO\","
+            << bad_param <<
+            "    }"
+            "]}";
+
+        ConfigPtr storage(new ConfigBase());
+        ConstElementPtr config = Element::fromJSON(os.str());
+        config = config->get("loggers");
+
+        LogConfigParser parser(storage);
+        EXPECT_THROW(parser.parseConfiguration(config), BadValue) << bad_param;
+    }
+}
+
 /// @todo Add tests for malformed logging configuration
 
 /// @todo There is no easy way to test applyConfiguration() and defaultLogging().
@@ -8,12 +8,97 @@
 
 #include <stats/context.h>
 #include <util/multi_threading_mgr.h>
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <vector>
 
 using namespace std;
 using namespace isc::data;
 using namespace isc::util;
 
+namespace {
+
+/// @brief Replaces the characters not allowed in Prometheus names by '_'.
+///
+/// @param name name to be converted
+/// @param colon true if ':' is allowed (metric names), false otherwise
+/// (label names)
+/// @return the converted name
+string
+sanitizePrometheusName(const string& name, bool colon) {
+    string result(name);
+    for (size_t i = 0; i < result.size(); ++i) {
+        char c = result[i];
+        if (!(((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+              ((c >= '0') && (c <= '9') && (i > 0)) || (c == '_') ||
+              (colon && (c == ':')))) {
+            result[i] = '_';
+        }
+    }
+    return (result);
+}
+
+/// @brief Escapes a Prometheus label value.
+///
+/// @param value label value
+/// @return the escaped value
+string
+escapePrometheusLabel(const string& value) {
+    string result;
+    result.reserve(value.size());
+    for (auto c : value) {
+        if (c == '\\') {
+            result += "\\\\";
+        } else if (c == '"') {
+            result += "\\\"";
+        } else if (c == '\n') {
+            result += "\\n";
+        } else {
+            result += c;
+        }
+    }
+    return (result);
+}
+
+/// @brief Splits a statistic name into a metric name and labels.
+///
+/// @param name statistic name, e.g. "subnet[1].assigned-addresses"
+/// @param prefix prefix of the metric name
+/// @param metric [out] metric name, e.g. "kea_subnet_assigned_addresses"
+/// @param labels [out] labels, e.g. "subnet=\"1\""
+void
+toPrometheus(const string& name, const string& prefix, string& metric,
+             string& labels) {
+    metric = prefix;
+    labels.clear();
+    size_t pos = 0;
+    for (;;) {
+        size_t open = name.find('[', pos);
+        if ((open == string::npos) || (open == pos)) {
+            break;
+        }
+        size_t close = name.find(']', open);
+        if ((close == string::npos) || (close + 1 >= name.size()) ||
+            (name[close + 1] != '.')) {
+            break;
+        }
+        string context = sanitizePrometheusName(name.substr(pos, open - pos),
+                                                false);
+        metric += context + "_";
+        if (!labels.empty()) {
+            labels += ",";
+        }
+        labels += context + "=\"" +
+            escapePrometheusLabel(name.substr(open + 1, close - open - 1)) +
+            "\"";
+        pos = close + 2;
+    }
+    metric += sanitizePrometheusName(name.substr(pos), true);
+}
+
+}
+
 namespace isc {
 namespace stats {
 
@@ -77,6 +162,61 @@ StatContext::getAll() const {
     return (map);
 }
 
+void
+StatContext::getNumericValues(NumericSnapshot& snapshot) const {
+    snapshot.reserve(snapshot.size() + stats_.size());
+    NumericValue value;
+    for (auto const& s : stats_) {
+        if (s.second->getNumericValue(value)) {
+            snapshot.push_back(make_pair(s.first, value));
+        }
+    }
+}
+
+void
+StatContext::writePrometheus(ostream& os, const string& prefix,
+                             const NumericSnapshot& snapshot) {
+    // The samples of a metric must be written together, so the
+    // samples are sorted by metric names first. The order of the
+    // snapshot is kept for the samples of the same metric.
+    struct Sample {
+        string metric_;
+        string labels_;
+        const NumericValue* value_;
+    };
+    vector<Sample> samples(snapshot.size());
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        toPrometheus(snapshot[i].first, prefix, samples[i].metric_,
+                     samples[i].labels_);
+        samples[i].value_ = &snapshot[i].second;
+    }
+    stable_sort(samples.begin(), samples.end(),
+                [](const Sample& a, const Sample& b) {
+                    return (a.metric_ < b.metric_);
+                });
+
+    streamsize precision = os.precision(numeric_limits<double>::digits10);
+    const string* previous = 0;
+    for (auto const& sample : samples) {
+        if (!previous || (*previous != sample.metric_)) {
+            os << "# TYPE " << sample.metric_ << " untyped\n";
+            previous = &sample.metric_;
+        }
+        os << sample.metric_;
+        if (!sample.labels_.empty()) {
+            os << "{" << sample.labels_ << "}";
+        }
+        os << " ";
+        if (sample.value_->integer_) {
+            os << sample.value_->integer_value_;
+        } else {
+            os << sample.value_->float_value_;
+        }
+        os << "\n";
+    }
+    os.precision(precision);
+}
+
 void
 StatContext::setMaxSampleCountAll(uint32_t max_samples) {
     // Let's iterate over all stored statistics...
@@ -10,7 +10,10 @@
 #include <stats/observation.h>
 #include <boost/shared_ptr.hpp>
 #include <mutex>
+#include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace isc {
 namespace stats {
@@ -22,6 +25,9 @@ public:
         isc::Exception(file, line, what) {}
 };
 
+/// @brief Names and current values of numeric observations
+typedef std::vector<std::pair<std::string, NumericValue> > NumericSnapshot;
+
 /// @brief Statistics context
 ///
 /// Statistics context is essentially a container used to group statistics
@@ -75,6 +81,28 @@ public:
     /// @return map with all observations
     isc::data::ConstElementPtr getAll() const;
 
+    /// @brief Copies the current values of the numeric observations
+    ///
+    /// The string observations are skipped.
+    ///
+    /// @param snapshot [out] names and values of the observations
+    void getNumericValues(NumericSnapshot& snapshot) const;
+
+    /// @brief Writes observation values in the Prometheus text format
+    ///
+    /// The values are written with no lock held, from a snapshot taken
+    /// by @ref getNumericValues. The "context[index]." parts of the
+    /// statistic names are converted to labels, e.g.
+    /// "subnet[1].assigned-addresses" is written as
+    /// "kea_subnet_assigned_addresses{subnet="1"}" with the "kea_"
+    /// prefix.
+    ///
+    /// @param os stream to write to
+    /// @param prefix prefix of the metric names
+    /// @param snapshot names and values of the observations
+    static void writePrometheus(std::ostream& os, const std::string& prefix,
+                                const NumericSnapshot& snapshot);
+
 private:
 
     /// @brief Statistics container
@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/counter.h>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+namespace isc {
+namespace stats {
+
+const size_t StatCounter::SLOTS;
+const size_t StatCounter::CACHE_LINE_SIZE;
+
+StatCounter::StatCounter(const string& name) : name_(name) {
+}
+
+void*
+StatCounter::operator new(size_t size) {
+    void* ptr = 0;
+    if (posix_memalign(&ptr, StatCounter::CACHE_LINE_SIZE, size) != 0) {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+void
+StatCounter::operator delete(void* ptr) {
+    free(ptr);
+}
+
+size_t
+StatCounter::getSlot() {
+    static atomic<size_t> next(0);
+    static thread_local size_t slot =
+        next.fetch_add(1, memory_order_relaxed) % SLOTS;
+    return (slot);
+}
+
+int64_t
+StatCounter::getPending() const {
+    int64_t sum = 0;
+    for (size_t i = 0; i < SLOTS; ++i) {
+        sum += slots_[i].value_.load(memory_order_relaxed);
+    }
+    return (sum);
+}
+
+int64_t
+StatCounter::fold() {
+    int64_t sum = 0;
+    for (size_t i = 0; i < SLOTS; ++i) {
+        sum += slots_[i].value_.exchange(0, memory_order_relaxed);
+    }
+    return (sum);
+}
+
+} // namespace stats
+} // namespace isc
@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef STAT_COUNTER_H
+#define STAT_COUNTER_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+
+namespace isc {
+namespace stats {
+
+/// @brief Handle of a pre-registered integer statistic.
+///
+/// Updating a statistic by name with @ref StatsMgr::addValue takes the
+/// global mutex of the Statistics Manager, looks the statistic up in a
+/// map keyed by strings and appends a timestamped sample. That is too
+/// expensive for the counters bumped for every packet.
+///
+/// A counter is registered once with @ref StatsMgr::registerCounter and
+/// the returned handle is kept by the caller. Incrementing the handle is
+/// a single relaxed atomic addition on a slot owned by the calling
+/// thread, so the packet processing threads neither take a lock nor
+/// share a cache line. The Statistics Manager folds the pending deltas
+/// of all slots into the observation of the same name when the statistic
+/// is read (e.g. by statistic-get), modified or removed by name.
+class StatCounter : public boost::noncopyable {
+public:
+
+    /// @brief Number of per thread slots.
+    ///
+    /// The threads are assigned to the slots in a round robin fashion,
+    /// so with more threads than slots some threads share a slot. This
+    /// is still correct, only less scalable.
+    static const size_t SLOTS = 16;
+
+    /// @brief Constructor.
+    ///
+    /// Used by the Statistics Manager only.
+    ///
+    /// @param name Name of the statistic.
+    explicit StatCounter(const std::string& name);
+
+    /// @brief Allocates a handle aligned on a cache line.
+    ///
+    /// The default allocator does not honor the alignment of the slots
+    /// before C++17.
+    ///
+    /// @param size Size of the handle.
+    /// @return The allocated memory.
+    static void* operator new(size_t size);
+
+    /// @brief Releases a handle allocated by @c operator @c new.
+    ///
+    /// @param ptr Pointer to the memory to release.
+    static void operator delete(void* ptr);
+
+    /// @brief Returns the name of the statistic.
+    const std::string& getName() const {
+        return (name_);
+    }
+
+    /// @brief Adds a value to the statistic.
+    ///
+    /// @param value Value to be added (default 1).
+    void add(int64_t value = 1) {
+        slots_[getSlot()].value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the sum of the deltas not folded yet.
+    ///
+    /// @return The pending delta.
+    int64_t getPending() const;
+
+    /// @brief Takes the pending deltas.
+    ///
+    /// Resets the slots to zero and returns the sum of their former
+    /// values. The increments made concurrently are either included or
+    /// left for the next call, they are never lost.
+    ///
+    /// @return The sum of the deltas since the last call.
+    int64_t fold();
+
+    /// @brief Returns the slot of the calling thread.
+    ///
+    /// Also used by the histograms which are sharded the same way.
+    ///
+    /// @return The slot index, lower than @ref SLOTS.
+    static size_t getSlot();
+
+    /// @brief Size of a cache line.
+    ///
+    /// The slots are aligned on it so two slots never share a line.
+    static const size_t CACHE_LINE_SIZE = 64;
+
+private:
+
+    /// @brief Slot aligned on a cache line to avoid false sharing.
+    struct alignas(CACHE_LINE_SIZE) Slot {
+        /// @brief Constructor.
+        Slot() : value_(0) {
+        }
+
+        /// @brief Sum of the deltas added in this slot.
+        std::atomic<int64_t> value_;
+    };
+
+    static_assert(sizeof(Slot) % CACHE_LINE_SIZE == 0,
+                  "StatCounter slots must fill whole cache lines");
+
+    /// @brief Name of the statistic.
+    std::string name_;
+
+    /// @brief The per thread slots.
+    Slot slots_[SLOTS];
+};
+
+/// @brief Pointer to a counter handle.
+typedef boost::shared_ptr<StatCounter> StatCounterPtr;
+
+} // namespace stats
+} // namespace isc
+
+#endif // STAT_COUNTER_H
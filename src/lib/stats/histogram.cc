@@ -0,0 +1,134 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/histogram.h>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+using namespace std;
+
+namespace isc {
+namespace stats {
+
+const size_t StatHistogram::SUB_BITS;
+const size_t StatHistogram::SUB_BUCKETS;
+const size_t StatHistogram::BUCKETS;
+
+StatHistogram::Snapshot::Snapshot()
+    : count_(0), sum_(0), max_(0), buckets_(BUCKETS, 0) {
+}
+
+uint64_t
+StatHistogram::Snapshot::getPercentile(double percent) const {
+    if (count_ == 0) {
+        return (0);
+    }
+    // Rank of the percentile, between 1 and count_.
+    uint64_t rank = static_cast<uint64_t>(ceil(percent * count_ / 100.));
+    if (rank == 0) {
+        rank = 1;
+    } else if (rank > count_) {
+        rank = count_;
+    }
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+        seen += buckets_[bucket];
+        if (seen >= rank) {
+            uint64_t upper = getBucketUpperBound(bucket);
+            return (upper < max_ ? upper : max_);
+        }
+    }
+    return (max_);
+}
+
+StatHistogram::Slot::Slot() : count_(0), sum_(0), max_(0) {
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        buckets_[i].store(0, memory_order_relaxed);
+    }
+}
+
+StatHistogram::StatHistogram(const string& name) : name_(name) {
+}
+
+void*
+StatHistogram::operator new(size_t size) {
+    void* ptr = 0;
+    if (posix_memalign(&ptr, StatCounter::CACHE_LINE_SIZE, size) != 0) {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+void
+StatHistogram::operator delete(void* ptr) {
+    free(ptr);
+}
+
+uint64_t
+StatHistogram::getCount() const {
+    uint64_t count = 0;
+    for (size_t i = 0; i < StatCounter::SLOTS; ++i) {
+        count += slots_[i].count_.load(memory_order_relaxed);
+    }
+    return (count);
+}
+
+StatHistogram::Snapshot
+StatHistogram::getSnapshot() const {
+    Snapshot snapshot;
+    for (size_t i = 0; i < StatCounter::SLOTS; ++i) {
+        const Slot& slot = slots_[i];
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            uint64_t count = slot.buckets_[bucket].load(memory_order_relaxed);
+            snapshot.buckets_[bucket] += count;
+            snapshot.count_ += count;
+        }
+        snapshot.sum_ += slot.sum_.load(memory_order_relaxed);
+        uint64_t max = slot.max_.load(memory_order_relaxed);
+        if (max > snapshot.max_) {
+            snapshot.max_ = max;
+        }
+    }
+    return (snapshot);
+}
+
+void
+StatHistogram::reset() {
+    for (size_t i = 0; i < StatCounter::SLOTS; ++i) {
+        Slot& slot = slots_[i];
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            slot.buckets_[bucket].store(0, memory_order_relaxed);
+        }
+        slot.count_.store(0, memory_order_relaxed);
+        slot.sum_.store(0, memory_order_relaxed);
+        slot.max_.store(0, memory_order_relaxed);
+    }
+}
+
+uint64_t
+StatHistogram::getBucketLowerBound(size_t bucket) {
+    if (bucket < 2 * SUB_BUCKETS) {
+        return (bucket);
+    }
+    size_t group = bucket / SUB_BUCKETS;
+    uint64_t sub = SUB_BUCKETS + bucket % SUB_BUCKETS;
+    return (sub << (group - 1));
+}
+
+uint64_t
+StatHistogram::getBucketUpperBound(size_t bucket) {
+    if (bucket >= BUCKETS - 1) {
+        return (numeric_limits<uint64_t>::max());
+    }
+    return (getBucketLowerBound(bucket + 1) - 1);
+}
+
+} // namespace stats
+} // namespace isc
@@ -0,0 +1,234 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef STAT_HISTOGRAM_H
+#define STAT_HISTOGRAM_H
+
+#include <stats/counter.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace stats {
+
+/// @brief Handle of a pre-registered latency histogram.
+///
+/// The histogram counts durations in microseconds in log-linear buckets:
+/// each power of two range is split into @ref SUB_BUCKETS linear buckets,
+/// so a bucket is at most 1/8 of its lower bound wide and a percentile
+/// computed from the histogram is within 12.5% of the exact value. The
+/// durations below 2 * SUB_BUCKETS microseconds have a bucket each.
+///
+/// Like @ref StatCounter, the histogram is sharded in per thread slots:
+/// recording a duration is a few relaxed atomic operations on the slot of
+/// the calling thread. The slots are merged when the histogram is read.
+///
+/// A histogram is registered with @ref StatsMgr::registerHistogram which
+/// publishes it as integer and duration statistics when the statistics
+/// are read: the statistic of the histogram name holds the number of
+/// recorded durations and the "-p50", "-p90", "-p99" and "-max" suffixed
+/// statistics hold the percentiles and the maximum.
+class StatHistogram : public boost::noncopyable {
+public:
+
+    /// @brief Number of bits of the linear part of the buckets.
+    static const size_t SUB_BITS = 3;
+
+    /// @brief Number of linear buckets per power of two.
+    static const size_t SUB_BUCKETS = 1 << SUB_BITS;
+
+    /// @brief Number of buckets.
+    ///
+    /// The last bucket counts the durations of 2^32 microseconds (more
+    /// than an hour) and above.
+    static const size_t BUCKETS = (32 - SUB_BITS + 1) * SUB_BUCKETS + 1;
+
+    /// @brief Merged content of the histogram.
+    struct Snapshot {
+        /// @brief Constructor.
+        Snapshot();
+
+        /// @brief Returns a percentile.
+        ///
+        /// @param percent The percentile, between 0 and 100.
+        /// @return The upper bound of the bucket holding the percentile,
+        /// not greater than the maximum, in microseconds. 0 when the
+        /// histogram is empty.
+        uint64_t getPercentile(double percent) const;
+
+        /// @brief Number of durations.
+        uint64_t count_;
+
+        /// @brief Sum of the durations in microseconds.
+        uint64_t sum_;
+
+        /// @brief Maximum duration in microseconds.
+        uint64_t max_;
+
+        /// @brief Number of durations in each bucket.
+        std::vector<uint64_t> buckets_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Used by the Statistics Manager only.
+    ///
+    /// @param name Name of the histogram.
+    explicit StatHistogram(const std::string& name);
+
+    /// @brief Allocates a handle aligned on a cache line.
+    ///
+    /// The default allocator does not honor the alignment of the slots
+    /// before C++17.
+    ///
+    /// @param size Size of the handle.
+    /// @return The allocated memory.
+    static void* operator new(size_t size);
+
+    /// @brief Releases a handle allocated by @c operator @c new.
+    ///
+    /// @param ptr Pointer to the memory to release.
+    static void operator delete(void* ptr);
+
+    /// @brief Returns the name of the histogram.
+    const std::string& getName() const {
+        return (name_);
+    }
+
+    /// @brief Records a duration.
+    ///
+    /// @param usecs Duration in microseconds.
+    void record(uint64_t usecs) {
+        Slot& slot = slots_[StatCounter::getSlot()];
+        slot.buckets_[getBucket(usecs)].fetch_add(1, std::memory_order_relaxed);
+        slot.count_.fetch_add(1, std::memory_order_relaxed);
+        slot.sum_.fetch_add(usecs, std::memory_order_relaxed);
+        uint64_t max = slot.max_.load(std::memory_order_relaxed);
+        while ((usecs > max) &&
+               !slot.max_.compare_exchange_weak(max, usecs,
+                                                std::memory_order_relaxed)) {
+        }
+    }
+
+    /// @brief Returns the number of recorded durations.
+    ///
+    /// Much cheaper than @ref getSnapshot as the buckets are not read.
+    ///
+    /// @return The number of durations.
+    uint64_t getCount() const;
+
+    /// @brief Returns the merged content of the slots.
+    Snapshot getSnapshot() const;
+
+    /// @brief Removes all recorded durations.
+    void reset();
+
+    /// @brief Returns the bucket of a duration.
+    ///
+    /// @param usecs Duration in microseconds.
+    /// @return Index of the bucket.
+    static size_t getBucket(uint64_t usecs) {
+        if (usecs < 2 * SUB_BUCKETS) {
+            return (static_cast<size_t>(usecs));
+        }
+        size_t magnitude = 63 - __builtin_clzll(usecs);
+        size_t group = magnitude - SUB_BITS + 1;
+        size_t bucket = group * SUB_BUCKETS +
+            static_cast<size_t>(usecs >> (group - 1)) - SUB_BUCKETS;
+        return (bucket < BUCKETS ? bucket : BUCKETS - 1);
+    }
+
+    /// @brief Returns the lowest duration counted in a bucket.
+    ///
+    /// @param bucket Index of the bucket.
+    /// @return The lower bound in microseconds.
+    static uint64_t getBucketLowerBound(size_t bucket);
+
+    /// @brief Returns the highest duration counted in a bucket.
+    ///
+    /// @param bucket Index of the bucket.
+    /// @return The upper bound (included) in microseconds.
+    static uint64_t getBucketUpperBound(size_t bucket);
+
+private:
+
+    /// @brief Slot of a thread, aligned on a cache line to avoid false
+    /// sharing.
+    struct alignas(StatCounter::CACHE_LINE_SIZE) Slot {
+        /// @brief Constructor.
+        Slot();
+
+        /// @brief Number of durations in each bucket.
+        std::atomic<uint64_t> buckets_[BUCKETS];
+
+        /// @brief Number of durations.
+        std::atomic<uint64_t> count_;
+
+        /// @brief Sum of the durations.
+        std::atomic<uint64_t> sum_;
+
+        /// @brief Maximum duration.
+        std::atomic<uint64_t> max_;
+    };
+
+    static_assert(sizeof(Slot) % StatCounter::CACHE_LINE_SIZE == 0,
+                  "StatHistogram slots must fill whole cache lines");
+
+    /// @brief Name of the histogram.
+    std::string name_;
+
+    /// @brief The per thread slots.
+    Slot slots_[StatCounter::SLOTS];
+};
+
+/// @brief Pointer to a histogram handle.
+typedef boost::shared_ptr<StatHistogram> StatHistogramPtr;
+
+/// @brief Records the duration of a scope in a histogram.
+///
+/// Does nothing when the histogram is null, e.g. when it was not
+/// registered yet.
+class ScopedHistogramTimer : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param histogram The histogram, may be null.
+    explicit ScopedHistogramTimer(const StatHistogramPtr& histogram)
+        : histogram_(histogram.get()),
+          start_(std::chrono::steady_clock::now()) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Records the time elapsed since the construction.
+    ~ScopedHistogramTimer() {
+        if (histogram_) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            histogram_->record(std::chrono::duration_cast<
+                               std::chrono::microseconds>(elapsed).count());
+        }
+    }
+
+private:
+
+    /// @brief The histogram.
+    StatHistogram* histogram_;
+
+    /// @brief The start time.
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace stats
+} // namespace isc
+
+#endif // STAT_HISTOGRAM_H
@@ -9,8 +9,10 @@
 #include <stats/observation.h>
 #include <util/boost_time_utils.h>
 #include <cc/data.h>
+#include <boost/date_time/c_local_time_adjustor.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
+#include <chrono>
 #include <utility>
 
 using namespace std;
@@ -20,23 +22,38 @@ using namespace boost::posix_time;
 namespace isc {
 namespace stats {
 
+std::pair<bool, uint32_t>
+Observation::default_max_sample_count_ = std::make_pair(true, 20);
+
+std::pair<bool, StatsDuration>
+Observation::default_max_sample_age_ =
+    std::make_pair(false, boost::posix_time::time_duration(0, 0, 0, 0));
+
 Observation::Observation(const std::string& name, const int64_t value) :
-    name_(name), type_(STAT_INTEGER) {
+    name_(name), type_(STAT_INTEGER),
+    max_sample_count_(default_max_sample_count_),
+    max_sample_age_(default_max_sample_age_) {
     setValue(value);
 }
 
 Observation::Observation(const std::string& name, const double value) :
-    name_(name), type_(STAT_FLOAT) {
+    name_(name), type_(STAT_FLOAT),
+    max_sample_count_(default_max_sample_count_),
+    max_sample_age_(default_max_sample_age_) {
     setValue(value);
 }
 
 Observation::Observation(const std::string& name, const StatsDuration& value) :
-    name_(name), type_(STAT_DURATION) {
+    name_(name), type_(STAT_DURATION),
+    max_sample_count_(default_max_sample_count_),
+    max_sample_age_(default_max_sample_age_) {
     setValue(value);
 }
 
 Observation::Observation(const std::string& name, const std::string& value) :
-    name_(name), type_(STAT_STRING) {
+    name_(name), type_(STAT_STRING),
+    max_sample_count_(default_max_sample_count_),
+    max_sample_age_(default_max_sample_age_) {
     setValue(value);
 }
 
@@ -88,24 +105,64 @@ void Observation::setMaxSampleCount(uint32_t max_samples) {
     };
 }
 
+void Observation::setMaxSampleAgeDefault(const StatsDuration& duration) {
+    default_max_sample_age_.first = true;
+    default_max_sample_age_.second = duration;
+    default_max_sample_count_.first = false;
+}
+
+void Observation::setMaxSampleCountDefault(uint32_t max_samples) {
+    default_max_sample_count_.first = true;
+    default_max_sample_count_.second = max_samples;
+    default_max_sample_age_.first = false;
+}
+
+std::pair<bool, StatsDuration> Observation::getMaxSampleAgeDefault() {
+    return (default_max_sample_age_);
+}
+
+std::pair<bool, uint32_t> Observation::getMaxSampleCountDefault() {
+    return (default_max_sample_count_);
+}
+
 void Observation::addValue(const int64_t value) {
-    IntegerSample current = getInteger();
-    setValue(current.first + value);
+    addValueInternal(value, integer_samples_, STAT_INTEGER);
 }
 
 void Observation::addValue(const double value) {
-    FloatSample current = getFloat();
-    setValue(current.first + value);
+    addValueInternal(value, float_samples_, STAT_FLOAT);
 }
 
 void Observation::addValue(const StatsDuration& value) {
-    DurationSample current = getDuration();
-    setValue(current.first + value);
+    addValueInternal(value, duration_samples_, STAT_DURATION);
 }
 
 void Observation::addValue(const std::string& value) {
-    StringSample current = getString();
-    setValue(current.first + value);
+    addValueInternal(value, string_samples_, STAT_STRING);
+}
+
+template<typename ValueType, typename StorageType>
+void Observation::addValueInternal(const ValueType& value,
+                                   StorageType& storage, Type exp_type) {
+    if (type_ != exp_type) {
+        isc_throw(InvalidStatType, "Invalid statistic type requested: "
+                  << typeToText(exp_type) << ", but the actual type is "
+                  << typeToText(type_));
+    }
+    // The new sample is computed from the current one, whose timestamp
+    // does not need to be converted.
+    setValueInternal(storage.front().first + value, storage, exp_type);
+}
+
+ptime Observation::now() {
+    static const ptime epoch(boost::gregorian::date(1970, 1, 1));
+    int64_t usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    return (epoch + microseconds(usecs));
+}
+
+ptime Observation::toLocal(const ptime& timestamp) {
+    return (boost::date_time::c_local_adjustor<ptime>::utc_to_local(timestamp));
 }
 
 void Observation::setValue(const int64_t value) {
@@ -179,29 +236,26 @@ void Observation::setValueInternal(SampleType value, StorageType& storage,
                   << typeToText(type_));
     }
 
-    if (storage.empty()) {
-        storage.push_back(make_pair(value, microsec_clock::local_time()));
+    if (max_sample_count_.first) {
+        // The ring drops the oldest sample when it holds max_sample_count_
+        // samples. The current value is always kept.
+        storage.push_front(make_pair(value, now()),
+                           max_sample_count_.second > 0 ?
+                           max_sample_count_.second : 1);
     } else {
-        // Storing of more than one sample
-        storage.push_front(make_pair(value, microsec_clock::local_time()));
-
-        if (max_sample_count_.first) {
-            // if max_sample_count_ is set to true
-            // and size of storage is equal to max_sample_count_
-            if (storage.size() > max_sample_count_.second) {
-                storage.pop_back(); // removing the last element
-            }
-        } else {
-            StatsDuration range_of_storage =
-                storage.front().second - storage.back().second;
-            // removing samples until the range_of_storage
-            // stops exceeding the duration limit
-            while (range_of_storage > max_sample_age_.second) {
-                storage.pop_back();
-                range_of_storage =
-                    storage.front().second - storage.back().second;
-            }
-        }
+        storage.push_front(make_pair(value, now()), 0);
+        pruneByAge(storage);
+    }
+}
+
+template<typename StorageType>
+void Observation::pruneByAge(StorageType& storage) {
+    // removing samples until the range_of_storage
+    // stops exceeding the duration limit
+    while ((storage.size() > 1) &&
+           (storage.front().second - storage.back().second >
+            max_sample_age_.second)) {
+        storage.pop_back();
     }
 }
 
@@ -235,7 +289,7 @@ SampleType Observation::getValueInternal(Storage& storage, Type exp_type) const
         // still be there.
         isc_throw(Unexpected, "Observation storage container empty");
     }
-    return (*storage.begin());
+    return (toLocal(storage.front()));
 }
 
 std::list<IntegerSample> Observation::getIntegers() const {
@@ -269,7 +323,11 @@ std::list<SampleType> Observation::getValuesInternal(Storage& storage,
         // still be there.
         isc_throw(Unexpected, "Observation storage container empty");
     }
-    return (storage);
+    std::list<SampleType> samples;
+    for (size_t i = 0; i < storage.size(); ++i) {
+        samples.push_back(toLocal(storage[i]));
+    }
+    return (samples);
 }
 
 template<typename StorageType>
@@ -287,14 +345,8 @@ void Observation::setMaxSampleAgeInternal(StorageType& storage,
     // deactivating the max_sample_count_ limit
     max_sample_count_.first = false;
 
-    StatsDuration range_of_storage =
-        storage.front().second - storage.back().second;
-
-    while (range_of_storage > duration) {
-        // deleting elements which are exceeding the duration limit
-        storage.pop_back();
-        range_of_storage = storage.front().second - storage.back().second;
-    }
+    // deleting elements which are exceeding the duration limit
+    pruneByAge(storage);
 }
 
 template<typename StorageType>
@@ -428,6 +480,29 @@ Observation::getJSON() const {
     return (list);
 }
 
+bool Observation::getNumericValue(NumericValue& value) const {
+    switch (type_) {
+    case STAT_INTEGER:
+        value.integer_ = true;
+        value.integer_value_ = integer_samples_.front().first;
+        return (true);
+    case STAT_FLOAT:
+        value.integer_ = false;
+        value.float_value_ = float_samples_.front().first;
+        return (true);
+    case STAT_DURATION: {
+        const StatsDuration& duration = duration_samples_.front().first;
+        value.integer_ = false;
+        value.float_value_ = duration.total_seconds() +
+            static_cast<double>(duration.fractional_seconds()) /
+            StatsDuration::ticks_per_second();
+        return (true);
+    }
+    default:
+        return (false);
+    }
+}
+
 void Observation::reset() {
     switch(type_) {
     case STAT_INTEGER: {
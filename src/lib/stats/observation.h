@@ -9,6 +9,7 @@
 
 #include <cc/data.h>
 #include <exceptions/exceptions.h>
+#include <stats/sample_ring.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/date_time/time_duration.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -52,6 +53,25 @@ typedef std::pair<std::string, boost::posix_time::ptime> StringSample;
 
 /// @}
 
+/// @brief Current value of a numeric observation
+///
+/// Integer values are kept as integers so they are exported without
+/// loss of precision.
+struct NumericValue {
+    /// @brief Constructor
+    NumericValue() : integer_(true), integer_value_(0), float_value_(0.0) {
+    }
+
+    /// @brief True for an integer value, false for a floating point one
+    bool integer_;
+
+    /// @brief Integer value
+    int64_t integer_value_;
+
+    /// @brief Floating point value (durations are in seconds)
+    double float_value_;
+};
+
 /// @brief Represents a single observable characteristic (a 'statistic')
 ///
 /// Currently it supports one of four types: integer (implemented as signed 64
@@ -67,6 +87,15 @@ typedef std::pair<std::string, boost::posix_time::ptime> StringSample;
 /// @ref getJSON, which is generic and can be used for all types.
 ///
 /// Since Kea 1.6 multiple samples are stored for the same observation.
+/// The samples are kept in a contiguous ring sized to the sample count
+/// limit, so recording a sample overwrites the oldest one in place instead
+/// of allocating a list node. The samples are timestamped with the system
+/// clock in UTC, which is cheap to read; the timestamps are converted to
+/// the local time only when the samples are retrieved. A statistic for
+/// which only the current value matters (e.g. a counter) can be limited
+/// to one sample with @ref setMaxSampleCount, or all new statistics with
+/// @ref setMaxSampleCountDefault: it then uses a single slot which is
+/// overwritten on each update.
 class Observation {
  public:
 
@@ -140,6 +169,33 @@ class Observation {
     /// setMaxSampleCount(100);
     void setMaxSampleCount(uint32_t max_samples);
 
+    /// @brief Determines default maximum age of samples.
+    ///
+    /// The default limits are applied to the observations created later.
+    /// Setting the default age limit disables the default count limit.
+    ///
+    /// @param duration default maximum age of samples
+    static void setMaxSampleAgeDefault(const StatsDuration& duration);
+
+    /// @brief Determines default maximum count of samples.
+    ///
+    /// The default limits are applied to the observations created later.
+    /// Setting the default count limit disables the default age limit.
+    /// A value of 1 keeps only the current value of the statistics.
+    ///
+    /// @param max_samples default maximum count of samples
+    static void setMaxSampleCountDefault(uint32_t max_samples);
+
+    /// @brief Returns both values of the default max_sample_age_.
+    ///
+    /// @return default max_sample_age_.
+    static std::pair<bool, StatsDuration> getMaxSampleAgeDefault();
+
+    /// @brief Returns both values of the default max_sample_count_.
+    ///
+    /// @return default max_sample_count_.
+    static std::pair<bool, uint32_t> getMaxSampleCountDefault();
+
     /// @brief Records absolute integer observation
     ///
     /// @param value integer value observed
@@ -259,6 +315,18 @@ class Observation {
     /// @return JSON structures representing all observations
     isc::data::ConstElementPtr getJSON() const;
 
+    /// @brief Returns the current value as a number
+    ///
+    /// Integer and floating point values are returned as they are and
+    /// durations as a number of seconds. This is used to copy the values
+    /// of the statistics out of the Statistics Manager lock when they are
+    /// exported without building a JSON structure.
+    ///
+    /// @param value [out] current value
+    /// @return false if the statistic is a string (value is not set),
+    /// true otherwise
+    bool getNumericValue(NumericValue& value) const;
+
     /// @brief Converts statistic type to string
     /// @return textual name of statistic type
     static std::string typeToText(Type type);
@@ -275,7 +343,7 @@ private:
     /// This method returns size of observed storage.
     /// It is used by public methods to return size of
     /// available storages.
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param storage storage which size will be returned
     /// @param exp_type expected observation type (used for sanity checking)
     /// @return size of storage
@@ -289,7 +357,7 @@ private:
     /// available storages.
     ///
     /// @tparam SampleType type of sample (e.g. IntegerSample)
-    /// @tparam StorageType type of storage (e.g. list<IntegerSample>)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
     /// @param value observation to be recorded
     /// @param storage observation will be stored here
     /// @param exp_type expected observation type (used for sanity checking)
@@ -298,10 +366,22 @@ private:
     void setValueInternal(SampleType value, StorageType& storage,
                           Type exp_type);
 
+    /// @brief Adds a value to the current sample (internal version)
+    ///
+    /// @tparam ValueType type of the value (e.g. int64_t)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
+    /// @param value value to be added to the current one
+    /// @param storage observation storage
+    /// @param exp_type expected observation type (used for sanity checking)
+    /// @throw InvalidStatType if observation type mismatches
+    template<typename ValueType, typename StorageType>
+    void addValueInternal(const ValueType& value, StorageType& storage,
+                          Type exp_type);
+
     /// @brief Returns a sample (internal version)
     ///
     /// @tparam SampleType type of sample (e.g. IntegerSample)
-    /// @tparam StorageType type of storage (e.g. list<IntegerSample>)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
     /// @param observation storage
     /// @param exp_type expected observation type (used for sanity checking)
     /// @throw InvalidStatType if observation type mismatches
@@ -312,7 +392,7 @@ private:
     /// @brief Returns samples (internal version)
     ///
     /// @tparam SampleType type of samples (e.g. IntegerSample)
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param observation storage
     /// @param exp_type expected observation type (used for sanity checking)
     /// @throw InvalidStatType if observation type mismatches
@@ -323,7 +403,7 @@ private:
 
     /// @brief Determines maximum age of samples.
     ///
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param storage storage on which limit will be set
     /// @param duration determines maximum age of samples
     /// @param exp_type expected observation type (used for sanity checking)
@@ -333,7 +413,7 @@ private:
 
     /// @brief Determines how many samples of a given statistic should be kept.
     ///
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param storage storage on which limit will be set
     /// @param max_samples determines maximum number of samples
     /// @param exp_type expected observation type (used for sanity checking)
@@ -341,6 +421,33 @@ private:
     void setMaxSampleCountInternal(StorageType& storage,
                                    uint32_t max_samples, Type exp_type);
 
+    /// @brief Removes the samples exceeding the age limit.
+    ///
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
+    /// @param storage storage to be pruned
+    template<typename StorageType>
+    void pruneByAge(StorageType& storage);
+
+    /// @brief Returns the current time as a sample timestamp (UTC).
+    static boost::posix_time::ptime now();
+
+    /// @brief Converts a sample timestamp to the local time.
+    ///
+    /// @param timestamp timestamp of a sample
+    /// @return the timestamp in the local time
+    static boost::posix_time::ptime
+    toLocal(const boost::posix_time::ptime& timestamp);
+
+    /// @brief Converts a sample to have its timestamp in the local time.
+    ///
+    /// @tparam SampleType type of sample (e.g. IntegerSample)
+    /// @param sample stored sample
+    /// @return the sample with its timestamp in the local time
+    template<typename SampleType>
+    static SampleType toLocal(const SampleType& sample) {
+        return (std::make_pair(sample.first, toLocal(sample.second)));
+    }
+
     /// @brief Observation (statistic) name
     std::string name_;
 
@@ -356,7 +463,7 @@ private:
     /// True means active limit, false means inactive limit
     /// By default the MaxSampleCount is set to 20
     /// and MaxSampleAge is disabled
-    std::pair<bool, uint32_t> max_sample_count_ = std::make_pair(true, 20);
+    std::pair<bool, uint32_t> max_sample_count_;
 
     /// @brief Maximum timespan of samples
     /// The limit is represented as a pair
@@ -367,8 +474,13 @@ private:
     /// True means active limit, false means inactive limit
     /// By default the MaxSampleCount is set to 20
     /// and MaxSampleAge is disabled
-    std::pair<bool, StatsDuration> max_sample_age_ = std::make_pair(false,
-            boost::posix_time::time_duration(0, 0, 0, 0));
+    std::pair<bool, StatsDuration> max_sample_age_;
+
+    /// @brief Default maximum number of samples
+    static std::pair<bool, uint32_t> default_max_sample_count_;
+
+    /// @brief Default maximum timespan of samples
+    static std::pair<bool, StatsDuration> default_max_sample_age_;
 
     /// @defgroup samples_storage Storage for supported observations
     ///
@@ -378,16 +490,16 @@ private:
     /// @{
 
     /// @brief Storage for integer samples
-    std::list<IntegerSample> integer_samples_;
+    SampleRing<IntegerSample> integer_samples_;
 
     /// @brief Storage for floating point samples
-    std::list<FloatSample> float_samples_;
+    SampleRing<FloatSample> float_samples_;
 
     /// @brief Storage for time duration samples
-    std::list<DurationSample> duration_samples_;
+    SampleRing<DurationSample> duration_samples_;
 
     /// @brief Storage for string samples
-    std::list<StringSample> string_samples_;
+    SampleRing<StringSample> string_samples_;
     /// @}
 };
 
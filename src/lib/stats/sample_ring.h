@@ -0,0 +1,170 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <exceptions/exceptions.h>
+#include <cstddef>
+#include <vector>
+
+namespace isc {
+namespace stats {
+
+/// @brief Contiguous ring buffer of samples.
+///
+/// Holds the samples of an observation from the most recent (index 0,
+/// the front) to the oldest (the back). Recording a sample when the
+/// ring is at its capacity limit overwrites the oldest sample in place,
+/// so once the ring has grown to its limit the updates do not allocate.
+///
+/// The storage grows by doubling up to the limit: a statistic which is
+/// updated once, e.g. a per subnet statistic set to 0 at configuration
+/// time, uses a single slot even if it may keep up to 20 samples.
+///
+/// @tparam SampleType Type of the samples.
+template<typename SampleType>
+class SampleRing {
+public:
+
+    /// @brief Constructor.
+    SampleRing() : samples_(), first_(0), size_(0) {
+    }
+
+    /// @brief Returns the number of samples.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Checks if there is no sample.
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns a sample.
+    ///
+    /// @param index Index of the sample, 0 is the most recent.
+    /// @return Reference to the sample.
+    const SampleType& operator[](size_t index) const {
+        return (samples_[(first_ + index) % samples_.size()]);
+    }
+
+    /// @brief Returns a sample.
+    ///
+    /// @param index Index of the sample, 0 is the most recent.
+    /// @return Reference to the sample.
+    SampleType& operator[](size_t index) {
+        return (samples_[(first_ + index) % samples_.size()]);
+    }
+
+    /// @brief Returns the most recent sample.
+    ///
+    /// @throw Unexpected if the ring is empty.
+    const SampleType& front() const {
+        checkNotEmpty();
+        return ((*this)[0]);
+    }
+
+    /// @brief Returns the most recent sample.
+    ///
+    /// @throw Unexpected if the ring is empty.
+    SampleType& front() {
+        checkNotEmpty();
+        return ((*this)[0]);
+    }
+
+    /// @brief Returns the oldest sample.
+    ///
+    /// @throw Unexpected if the ring is empty.
+    const SampleType& back() const {
+        checkNotEmpty();
+        return ((*this)[size_ - 1]);
+    }
+
+    /// @brief Records a sample as the most recent one.
+    ///
+    /// @param sample Sample to be recorded.
+    /// @param limit Maximum number of samples to keep, 0 means no limit.
+    /// When the ring already holds limit samples the oldest is dropped.
+    void push_front(const SampleType& sample, size_t limit) {
+        if (limit != 0) {
+            // Make room for the new sample.
+            while (size_ >= limit) {
+                pop_back();
+            }
+        }
+        if (size_ == samples_.size()) {
+            size_t capacity = (samples_.empty() ? 1 : 2 * samples_.size());
+            if ((limit != 0) && (capacity > limit)) {
+                capacity = limit;
+            }
+            reserve(capacity);
+        }
+        first_ = (first_ + samples_.size() - 1) % samples_.size();
+        samples_[first_] = sample;
+        ++size_;
+    }
+
+    /// @brief Removes the oldest sample.
+    void pop_back() {
+        if (size_ > 0) {
+            // Release the resources held by the sample, e.g. a string.
+            (*this)[size_ - 1] = SampleType();
+            --size_;
+        }
+    }
+
+    /// @brief Removes all samples.
+    ///
+    /// The storage is released too.
+    void clear() {
+        std::vector<SampleType>().swap(samples_);
+        first_ = 0;
+        size_ = 0;
+    }
+
+    /// @brief Returns the capacity of the storage.
+    ///
+    /// This method is used in testing.
+    size_t capacity() const {
+        return (samples_.size());
+    }
+
+private:
+
+    /// @brief Throws if the ring is empty.
+    void checkNotEmpty() const {
+        if (size_ == 0) {
+            isc_throw(Unexpected, "Observation storage container empty");
+        }
+    }
+
+    /// @brief Reallocates the storage, moving the samples at its start.
+    ///
+    /// @param capacity New capacity, not less than the number of samples.
+    void reserve(size_t capacity) {
+        std::vector<SampleType> samples(capacity);
+        for (size_t i = 0; i < size_; ++i) {
+            samples[i] = (*this)[i];
+        }
+        samples_.swap(samples);
+        first_ = 0;
+    }
+
+    /// @brief The storage.
+    std::vector<SampleType> samples_;
+
+    /// @brief Position of the most recent sample in the storage.
+    size_t first_;
+
+    /// @brief Number of samples.
+    size_t size_;
+};
+
+} // namespace stats
+} // namespace isc
+
+#endif // SAMPLE_RING_H
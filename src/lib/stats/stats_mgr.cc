@@ -23,6 +23,20 @@ using namespace isc::util;
 namespace isc {
 namespace stats {
 
+namespace {
+
+/// @brief Percentiles published for each histogram.
+const struct {
+    const char* suffix_;
+    double percent_;
+} HISTOGRAM_PERCENTILES[] = {
+    { "-p50", 50. },
+    { "-p90", 90. },
+    { "-p99", 99. }
+};
+
+} // end of anonymous namespace
+
 StatsMgr&
 StatsMgr::instance() {
     static StatsMgr stats_mgr;
@@ -113,12 +127,212 @@ StatsMgr::addValue(const string& name, const string& value) {
     }
 }
 
+StatCounterPtr
+StatsMgr::registerCounter(const string& name) {
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(*mutex_);
+        return (registerCounterInternal(name));
+    } else {
+        return (registerCounterInternal(name));
+    }
+}
+
+StatCounterPtr
+StatsMgr::registerCounterInternal(const string& name) {
+    ObservationPtr obs = getObservationInternal(name);
+    if (!obs) {
+        obs.reset(new Observation(name, static_cast<int64_t>(0)));
+        addObservationInternal(obs);
+    } else if (obs->getType() != Observation::STAT_INTEGER) {
+        isc_throw(InvalidStatType, "Statistic '" << name
+                  << "' is not an integer");
+    }
+    auto it = counters_.find(name);
+    if (it != counters_.end()) {
+        return (it->second);
+    }
+    StatCounterPtr counter(new StatCounter(name));
+    counters_[name] = counter;
+    return (counter);
+}
+
+StatHistogramPtr
+StatsMgr::registerHistogram(const string& name) {
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(*mutex_);
+        return (registerHistogramInternal(name));
+    } else {
+        return (registerHistogramInternal(name));
+    }
+}
+
+StatHistogramPtr
+StatsMgr::registerHistogramInternal(const string& name) {
+    ObservationPtr obs = getObservationInternal(name);
+    if (!obs) {
+        obs.reset(new Observation(name, static_cast<int64_t>(0)));
+        addObservationInternal(obs);
+    } else if (obs->getType() != Observation::STAT_INTEGER) {
+        isc_throw(InvalidStatType, "Statistic '" << name
+                  << "' is not an integer");
+    }
+    auto it = histograms_.find(name);
+    if (it != histograms_.end()) {
+        return (it->second);
+    }
+    StatHistogramPtr histogram(new StatHistogram(name));
+    histograms_[name] = histogram;
+    return (histogram);
+}
+
+void
+StatsMgr::publishHistogramsInternal(const string& name) const {
+    if (histograms_.empty()) {
+        return;
+    }
+    if (name.empty()) {
+        for (auto it = histograms_.begin(); it != histograms_.end(); ++it) {
+            publishHistogram(*it->second);
+        }
+        return;
+    }
+    // The derived statistics have the histogram name with a suffix.
+    auto it = histograms_.find(name);
+    if (it == histograms_.end()) {
+        size_t dash = name.rfind('-');
+        if (dash == string::npos) {
+            return;
+        }
+        it = histograms_.find(name.substr(0, dash));
+        if (it == histograms_.end()) {
+            return;
+        }
+    }
+    publishHistogram(*it->second);
+}
+
+void
+StatsMgr::publishHistogram(const StatHistogram& histogram) const {
+    const string& base = histogram.getName();
+    // The statistic of the histogram name holds the number of durations
+    // so it tells whether something changed since the last call.
+    int64_t count = static_cast<int64_t>(histogram.getCount());
+    ObservationPtr obs = global_->get(base);
+    if (obs && (obs->getType() != Observation::STAT_INTEGER)) {
+        return;
+    }
+    if (obs ? (obs->getInteger().first == count) : (count == 0)) {
+        return;
+    }
+    StatHistogram::Snapshot snapshot = histogram.getSnapshot();
+    count = static_cast<int64_t>(snapshot.count_);
+    if (obs) {
+        obs->setValue(count);
+    } else {
+        global_->add(ObservationPtr(new Observation(base, count)));
+    }
+    for (auto const& p : HISTOGRAM_PERCENTILES) {
+        StatsDuration value = boost::posix_time::microseconds(
+            snapshot.getPercentile(p.percent_));
+        const string pname = base + p.suffix_;
+        obs = global_->get(pname);
+        if (obs) {
+            obs->setValue(value);
+        } else {
+            global_->add(ObservationPtr(new Observation(pname, value)));
+        }
+    }
+    StatsDuration max = boost::posix_time::microseconds(snapshot.max_);
+    obs = global_->get(base + "-max");
+    if (obs) {
+        obs->setValue(max);
+    } else {
+        global_->add(ObservationPtr(new Observation(base + "-max", max)));
+    }
+}
+
+void
+StatsMgr::resetHistogramInternal(const string& name, bool remove) {
+    if (histograms_.empty()) {
+        return;
+    }
+    auto it = histograms_.find(name);
+    if (it == histograms_.end()) {
+        return;
+    }
+    it->second->reset();
+    vector<string> names;
+    for (auto const& p : HISTOGRAM_PERCENTILES) {
+        names.push_back(name + p.suffix_);
+    }
+    names.push_back(name + "-max");
+    for (auto const& pname : names) {
+        if (remove) {
+            static_cast<void>(global_->del(pname));
+        } else {
+            ObservationPtr obs = global_->get(pname);
+            if (obs) {
+                obs->reset();
+            }
+        }
+    }
+}
+
+void
+StatsMgr::flushCounterInternal(const string& name) const {
+    if (counters_.empty()) {
+        return;
+    }
+    auto it = counters_.find(name);
+    if (it != counters_.end()) {
+        flushCounter(*it->second);
+    }
+}
+
+void
+StatsMgr::flushCountersInternal() const {
+    for (auto it = counters_.begin(); it != counters_.end(); ++it) {
+        flushCounter(*it->second);
+    }
+}
+
+void
+StatsMgr::flushCounter(StatCounter& counter) const {
+    int64_t delta = counter.fold();
+    if (delta == 0) {
+        return;
+    }
+    ObservationPtr obs = global_->get(counter.getName());
+    if (obs) {
+        obs->addValue(delta);
+    } else {
+        // The statistic was removed: recreate it as addValue() does.
+        obs.reset(new Observation(counter.getName(), delta));
+        global_->add(obs);
+    }
+}
+
+void
+StatsMgr::discardCounterInternal(const string& name) {
+    if (counters_.empty()) {
+        return;
+    }
+    auto it = counters_.find(name);
+    if (it != counters_.end()) {
+        static_cast<void>(it->second->fold());
+    }
+}
+
 ObservationPtr
 StatsMgr::getObservation(const string& name) const {
     if (MultiThreadingMgr::instance().getMode()) {
         lock_guard<mutex> lock(*mutex_);
+        flushCounterInternal(name);
+        publishHistogramsInternal(name);
         return (getObservationInternal(name));
     } else {
+        flushCounterInternal(name);
+        publishHistogramsInternal(name);
         return (getObservationInternal(name));
     }
 }
@@ -236,6 +450,26 @@ StatsMgr::setMaxSampleCountAllInternal(uint32_t max_samples) {
     global_->setMaxSampleCountAll(max_samples);
 }
 
+void
+StatsMgr::setMaxSampleAgeDefault(const StatsDuration& duration) {
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(*mutex_);
+        Observation::setMaxSampleAgeDefault(duration);
+    } else {
+        Observation::setMaxSampleAgeDefault(duration);
+    }
+}
+
+void
+StatsMgr::setMaxSampleCountDefault(uint32_t max_samples) {
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(*mutex_);
+        Observation::setMaxSampleCountDefault(max_samples);
+    } else {
+        Observation::setMaxSampleCountDefault(max_samples);
+    }
+}
+
 bool
 StatsMgr::reset(const string& name) {
     if (MultiThreadingMgr::instance().getMode()) {
@@ -248,6 +482,8 @@ StatsMgr::reset(const string& name) {
 
 bool
 StatsMgr::resetInternal(const string& name) {
+    discardCounterInternal(name);
+    resetHistogramInternal(name, false);
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         obs->reset();
@@ -268,6 +504,8 @@ StatsMgr::del(const string& name) {
 
 bool
 StatsMgr::delInternal(const string& name) {
+    discardCounterInternal(name);
+    resetHistogramInternal(name, true);
     return (global_->del(name));
 }
 
@@ -283,6 +521,12 @@ StatsMgr::removeAll() {
 
 void
 StatsMgr::removeAllInternal() {
+    for (auto it = counters_.begin(); it != counters_.end(); ++it) {
+        static_cast<void>(it->second->fold());
+    }
+    for (auto it = histograms_.begin(); it != histograms_.end(); ++it) {
+        it->second->reset();
+    }
     global_->clear();
 }
 
@@ -298,6 +542,8 @@ StatsMgr::get(const string& name) const {
 
 ConstElementPtr
 StatsMgr::getInternal(const string& name) const {
+    flushCounterInternal(name);
+    publishHistogramsInternal(name);
     ElementPtr map = Element::createMap(); // a map
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
@@ -318,9 +564,30 @@ StatsMgr::getAll() const {
 
 ConstElementPtr
 StatsMgr::getAllInternal() const {
+    flushCountersInternal();
+    publishHistogramsInternal();
     return (global_->getAll());
 }
 
+void
+StatsMgr::exportPrometheus(std::ostream& os, const std::string& prefix) const {
+    NumericSnapshot snapshot;
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(*mutex_);
+        getNumericValuesInternal(snapshot);
+    } else {
+        getNumericValuesInternal(snapshot);
+    }
+    StatContext::writePrometheus(os, prefix, snapshot);
+}
+
+void
+StatsMgr::getNumericValuesInternal(NumericSnapshot& snapshot) const {
+    flushCountersInternal();
+    publishHistogramsInternal();
+    global_->getNumericValues(snapshot);
+}
+
 void
 StatsMgr::resetAll() {
     if (MultiThreadingMgr::instance().getMode()) {
@@ -333,6 +600,12 @@ StatsMgr::resetAll() {
 
 void
 StatsMgr::resetAllInternal() {
+    for (auto it = counters_.begin(); it != counters_.end(); ++it) {
+        static_cast<void>(it->second->fold());
+    }
+    for (auto it = histograms_.begin(); it != histograms_.end(); ++it) {
+        it->second->reset();
+    }
     global_->resetAll();
 }
 
@@ -348,6 +621,8 @@ StatsMgr::getSize(const string& name) const {
 
 size_t
 StatsMgr::getSizeInternal(const string& name) const {
+    flushCounterInternal(name);
+    publishHistogramsInternal(name);
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         return (obs->getSize());
@@ -367,6 +642,8 @@ StatsMgr::count() const {
 
 size_t
 StatsMgr::countInternal() const {
+    flushCountersInternal();
+    publishHistogramsInternal();
     return (global_->size());
 }
 
@@ -469,6 +746,30 @@ StatsMgr::statisticGetAllHandler(const string& /*name*/,
     return (createAnswer(CONTROL_RESULT_SUCCESS, all_stats));
 }
 
+ConstElementPtr
+StatsMgr::statisticGetAllPrometheusHandler(const string& /*name*/,
+                                           const ConstElementPtr& params) {
+    string prefix = "kea_";
+    if (params) {
+        if (params->getType() != Element::map) {
+            return (createAnswer(CONTROL_RESULT_ERROR,
+                                 "Invalid parameters: expected a map"));
+        }
+        ConstElementPtr stat_prefix = params->get("prefix");
+        if (stat_prefix) {
+            if (stat_prefix->getType() != Element::string) {
+                return (createAnswer(CONTROL_RESULT_ERROR,
+                                     "'prefix' parameter expected to be a"
+                                     " string."));
+            }
+            prefix = stat_prefix->stringValue();
+        }
+    }
+    ostringstream text;
+    StatsMgr::instance().exportPrometheus(text, prefix);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, text.str()));
+}
+
 ConstElementPtr
 StatsMgr::statisticResetAllHandler(const string& /*name*/,
                                    const ConstElementPtr& /*params*/) {
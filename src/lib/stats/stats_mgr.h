@@ -9,6 +9,8 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <stats/counter.h>
+#include <stats/histogram.h>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
 
@@ -128,6 +130,57 @@ public:
     /// @throw InvalidStatType if statistic is not a string
     void addValue(const std::string& name, const std::string& value);
 
+    /// @brief Registers an integer statistic updated through a handle.
+    ///
+    /// The returned handle is meant to be kept by the caller and used to
+    /// increment the statistic from the packet processing path without
+    /// taking the Statistics Manager mutex or building the statistic name.
+    /// The increments are folded into the observation of the same name
+    /// when the statistic is read or modified by name. If the statistic
+    /// does not exist it is created with the value 0. Registering the
+    /// same name twice returns the same handle.
+    ///
+    /// Example:
+    /// @code
+    /// StatCounterPtr received =
+    ///     StatsMgr::instance().registerCounter("pkt4-received");
+    /// // ...
+    /// received->add();
+    /// @endcode
+    ///
+    /// @param name name of the statistic
+    /// @return the handle of the statistic
+    /// @throw InvalidStatType if statistic exists and is not integer
+    StatCounterPtr registerCounter(const std::string& name);
+
+    /// @brief Registers a latency histogram.
+    ///
+    /// The returned handle is meant to be kept by the caller and used to
+    /// record durations from the packet processing path without taking
+    /// the Statistics Manager mutex. When the statistics are read the
+    /// histogram is published as statistics: the integer statistic of the
+    /// histogram name holds the number of recorded durations and the
+    /// duration statistics with the "-p50", "-p90", "-p99" and "-max"
+    /// suffixes hold the percentiles and the maximum. Resetting or removing
+    /// the statistic of the histogram name resets the histogram. Registering
+    /// the same name twice returns the same handle.
+    ///
+    /// Example:
+    /// @code
+    /// StatHistogramPtr latency =
+    ///     StatsMgr::instance().registerHistogram("pkt4-latency");
+    /// // ...
+    /// {
+    ///     ScopedHistogramTimer timer(latency);
+    ///     // ... timed code ...
+    /// }
+    /// @endcode
+    ///
+    /// @param name name of the histogram
+    /// @return the handle of the histogram
+    /// @throw InvalidStatType if statistic exists and is not integer
+    StatHistogramPtr registerHistogram(const std::string& name);
+
     /// @brief Determines maximum age of samples.
     ///
     /// Specifies that statistic name should be stored not as a single value,
@@ -170,6 +223,19 @@ public:
     /// @param max_samples how many samples of a given statistic should be kept
     void setMaxSampleCountAll(uint32_t max_samples);
 
+    /// @brief Set default duration limit of the statistics created later.
+    ///
+    /// @param duration determines default maximum age of samples
+    void setMaxSampleAgeDefault(const StatsDuration& duration);
+
+    /// @brief Set default count limit of the statistics created later.
+    ///
+    /// A value of 1 keeps only the current value of the statistics, which
+    /// then use a single sample overwritten by each update.
+    ///
+    /// @param max_samples default maximum count of samples
+    void setMaxSampleCountDefault(uint32_t max_samples);
+
     /// @}
 
     /// @defgroup consumer_methods Methods are used by data consumers.
@@ -220,6 +286,19 @@ public:
     /// @return JSON structures representing all statistics
     isc::data::ConstElementPtr getAll() const;
 
+    /// @brief Writes all statistics in the Prometheus text format.
+    ///
+    /// Unlike @ref getAll, this method writes the current values directly
+    /// to the stream without building a JSON structure, so it is suitable
+    /// for exporting a large number of statistics. The lock is only held
+    /// while the values are copied: the text is written after it is
+    /// released.
+    ///
+    /// @param os stream to write to
+    /// @param prefix prefix of the metric names
+    void exportPrometheus(std::ostream& os,
+                          const std::string& prefix = "kea_") const;
+
     /// @}
 
     /// @brief Returns an observation.
@@ -378,6 +457,22 @@ public:
     statisticGetAllHandler(const std::string& name,
                            const isc::data::ConstElementPtr& params);
 
+    /// @brief Handles statistic-get-all-prometheus command
+    ///
+    /// This method handles statistic-get-all-prometheus command, which
+    /// returns the current values of all statistics in the Prometheus text
+    /// exposition format in the text of the answer. The optional
+    /// "prefix" parameter replaces the default "kea_" prefix of the
+    /// metric names.
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-get-all-prometheus")
+    /// @param params structure containing a map that may contain "prefix"
+    /// @return answer containing values of all statistic
+    static isc::data::ConstElementPtr
+    statisticGetAllPrometheusHandler(const std::string& name,
+                                     const isc::data::ConstElementPtr& params);
+
     /// @brief Handles statistic-reset-all command
     ///
     /// This method handles statistic-reset-all command, which sets values of
@@ -466,6 +561,8 @@ private:
     /// @throw InvalidStatType is statistic exists and has a different type.
     template<typename DataType>
     void setValueInternal(const std::string& name, DataType value) {
+        // The pending increments of a counter predate this observation.
+        flushCounterInternal(name);
         // If we want to log each observation, here would be the best place for it.
         ObservationPtr stat = getObservationInternal(name);
         if (stat) {
@@ -507,6 +604,100 @@ private:
 
     /// @private
 
+    /// @brief Registers a counter in a thread safe context.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the statistic
+    /// @return the handle of the statistic
+    StatCounterPtr registerCounterInternal(const std::string& name);
+
+    /// @private
+
+    /// @brief Registers a histogram in a thread safe context.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the histogram
+    /// @return the handle of the histogram
+    StatHistogramPtr registerHistogramInternal(const std::string& name);
+
+    /// @private
+
+    /// @brief Publishes the histograms which changed since the last call.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name when not empty only the histogram whose statistics
+    /// may have this name, i.e. the histogram of this name or of this
+    /// name without its last "-" suffix, is published.
+    void publishHistogramsInternal(const std::string& name = "") const;
+
+    /// @private
+
+    /// @brief Publishes a histogram if it changed since the last call.
+    ///
+    /// The derived statistics are the cache of the percentiles: the
+    /// buckets are merged and scanned only when the number of recorded
+    /// durations differs from the published one.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param histogram the histogram to publish
+    void publishHistogram(const StatHistogram& histogram) const;
+
+    /// @private
+
+    /// @brief Resets a histogram and its percentile statistics.
+    ///
+    /// Used when the statistic is reset or removed. Does nothing when no
+    /// histogram was registered with this name.
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the statistic
+    /// @param remove true when the percentile statistics must be removed,
+    /// false when they must be reset.
+    void resetHistogramInternal(const std::string& name, bool remove);
+
+    /// @private
+
+    /// @brief Folds the pending increments of a counter into its observation.
+    ///
+    /// Does nothing when no counter was registered with this name.
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the statistic
+    void flushCounterInternal(const std::string& name) const;
+
+    /// @private
+
+    /// @brief Folds the pending increments of all counters.
+    ///
+    /// Should be called in a thread safe context.
+    void flushCountersInternal() const;
+
+    /// @private
+
+    /// @brief Folds the pending increments of a counter.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param counter the counter
+    void flushCounter(StatCounter& counter) const;
+
+    /// @private
+
+    /// @brief Discards the pending increments of a counter.
+    ///
+    /// Used when the statistic is reset or removed. Does nothing when no
+    /// counter was registered with this name.
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the statistic
+    void discardCounterInternal(const std::string& name);
+
+    /// @private
+
     /// @brief Adds a new observation.
     ///
     /// That's an utility method used by public @ref setValue() and
@@ -660,6 +851,15 @@ private:
 
     /// @private
 
+    /// @brief Copies the current values of all numeric statistics.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param snapshot [out] names and values of the statistics
+    void getNumericValuesInternal(NumericSnapshot& snapshot) const;
+
+    /// @private
+
     /// @brief Utility method that attempts to extract statistic name
     ///
     /// This method attempts to extract statistic name from the params
@@ -722,6 +922,12 @@ private:
     /// @brief This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
 
+    /// @brief Registered counters.
+    std::map<std::string, StatCounterPtr> counters_;
+
+    /// @brief Registered histograms.
+    std::map<std::string, StatHistogramPtr> histograms_;
+
     /// @brief The mutex used to protect internal state.
     const boost::scoped_ptr<std::mutex> mutex_;
 };
@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/histogram.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::stats;
+using namespace std;
+
+namespace {
+
+// Checks that the buckets cover all durations without gaps and that they
+// are at most 1/8 of their lower bound wide.
+TEST(StatHistogramTest, buckets) {
+    for (uint64_t usecs = 0; usecs < 2 * StatHistogram::SUB_BUCKETS; ++usecs) {
+        EXPECT_EQ(usecs, StatHistogram::getBucket(usecs));
+    }
+    for (size_t bucket = 0; bucket < StatHistogram::BUCKETS - 1; ++bucket) {
+        uint64_t lower = StatHistogram::getBucketLowerBound(bucket);
+        uint64_t upper = StatHistogram::getBucketUpperBound(bucket);
+        ASSERT_LE(lower, upper);
+        EXPECT_EQ(bucket, StatHistogram::getBucket(lower));
+        EXPECT_EQ(bucket, StatHistogram::getBucket(upper));
+        EXPECT_EQ(bucket + 1, StatHistogram::getBucket(upper + 1));
+        EXPECT_LE(upper - lower, lower / StatHistogram::SUB_BUCKETS);
+    }
+    size_t last = StatHistogram::BUCKETS - 1;
+    EXPECT_EQ(static_cast<uint64_t>(1) << 32,
+              StatHistogram::getBucketLowerBound(last));
+    EXPECT_EQ(last, StatHistogram::getBucket(numeric_limits<uint64_t>::max()));
+}
+
+// Checks the percentiles.
+TEST(StatHistogramTest, percentiles) {
+    StatHistogram histogram("latency");
+    EXPECT_EQ("latency", histogram.getName());
+    EXPECT_EQ(0, histogram.getSnapshot().getPercentile(50.));
+
+    // 1..1000 microseconds.
+    for (uint64_t usecs = 1; usecs <= 1000; ++usecs) {
+        histogram.record(usecs);
+    }
+    EXPECT_EQ(1000, histogram.getCount());
+    StatHistogram::Snapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(1000, snapshot.count_);
+    EXPECT_EQ(500500, snapshot.sum_);
+    EXPECT_EQ(1000, snapshot.max_);
+
+    // The percentiles are the upper bounds of their buckets.
+    uint64_t p50 = snapshot.getPercentile(50.);
+    EXPECT_LE(500, p50);
+    EXPECT_GE(500 + 500 / StatHistogram::SUB_BUCKETS, p50);
+    uint64_t p99 = snapshot.getPercentile(99.);
+    EXPECT_LE(990, p99);
+    EXPECT_GE(1000, p99);
+    EXPECT_EQ(1000, snapshot.getPercentile(100.));
+    EXPECT_EQ(1, snapshot.getPercentile(0.));
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getCount());
+    snapshot = histogram.getSnapshot();
+    EXPECT_EQ(0, snapshot.count_);
+    EXPECT_EQ(0, snapshot.sum_);
+    EXPECT_EQ(0, snapshot.max_);
+}
+
+// Checks that the durations recorded by concurrent threads are merged.
+TEST(StatHistogramTest, threads) {
+    StatHistogram histogram("latency");
+    vector<thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.push_back(thread([&histogram, i]() {
+            for (uint64_t usecs = 0; usecs < 1000; ++usecs) {
+                histogram.record(usecs + i);
+            }
+        }));
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(8000, histogram.getCount());
+    StatHistogram::Snapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(8000, snapshot.count_);
+    EXPECT_EQ(1006, snapshot.max_);
+}
+
+// Checks that the scoped timer records a duration.
+TEST(StatHistogramTest, timer) {
+    StatHistogramPtr histogram(new StatHistogram("latency"));
+    {
+        ScopedHistogramTimer timer(histogram);
+    }
+    EXPECT_EQ(1, histogram->getSnapshot().count_);
+
+    // A null histogram is ignored.
+    StatHistogramPtr null_histogram;
+    EXPECT_NO_THROW(ScopedHistogramTimer timer(null_histogram));
+}
+
+// Checks that the handles are allocated on a cache line boundary so
+// their per thread slots do not share cache lines.
+TEST(StatHistogramTest, alignment) {
+    const uintptr_t mask = StatCounter::CACHE_LINE_SIZE - 1;
+    for (int i = 0; i < 8; ++i) {
+        StatCounterPtr counter(new StatCounter("counter"));
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(counter.get()) & mask);
+        StatHistogramPtr histogram(new StatHistogram("latency"));
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(histogram.get()) & mask);
+    }
+}
+
+} // end of anonymous namespace
@@ -476,6 +476,36 @@ TEST_F(ObservationTest, getLimits) {
     EXPECT_EQ(d.getMaxSampleCount().second, 20);
 }
 
+// Test checks that the default limits apply to the new observations.
+TEST_F(ObservationTest, defaultLimits) {
+    // Keep only the current value.
+    Observation::setMaxSampleCountDefault(1);
+    Observation e("epsilon", static_cast<int64_t>(0));
+    for (int64_t i = 1; i <= 10; ++i) {
+        e.addValue(static_cast<int64_t>(1));
+        ASSERT_EQ(1, e.getSize());
+    }
+    EXPECT_EQ(10, e.getInteger().first);
+    EXPECT_EQ(std::make_pair(true, static_cast<uint32_t>(1)),
+              e.getMaxSampleCount());
+
+    // The existing observations are not affected.
+    EXPECT_EQ(20, a.getMaxSampleCount().second);
+
+    // Setting a default age limit disables the default count limit.
+    Observation::setMaxSampleAgeDefault(millisec::time_duration(0, 1, 0, 0));
+    Observation f("phi", 1.0);
+    EXPECT_FALSE(f.getMaxSampleCount().first);
+    EXPECT_TRUE(f.getMaxSampleAge().first);
+    EXPECT_EQ(millisec::time_duration(0, 1, 0, 0), f.getMaxSampleAge().second);
+
+    // Restore the defaults.
+    Observation::setMaxSampleCountDefault(20);
+    EXPECT_EQ(std::make_pair(true, static_cast<uint32_t>(20)),
+              Observation::getMaxSampleCountDefault());
+    EXPECT_FALSE(Observation::getMaxSampleAgeDefault().first);
+}
+
 // Test checks whether timing is reported properly.
 TEST_F(ObservationTest, timers) {
     ptime before = microsec_clock::local_time();
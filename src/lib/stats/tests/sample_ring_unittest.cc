@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/sample_ring.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace isc;
+using namespace isc::stats;
+using namespace std;
+
+namespace {
+
+// Checks that the samples are kept from the most recent to the oldest.
+TEST(SampleRingTest, order) {
+    SampleRing<int> ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_THROW(ring.front(), Unexpected);
+    EXPECT_THROW(ring.back(), Unexpected);
+
+    for (int i = 0; i < 10; ++i) {
+        ring.push_front(i, 0);
+        EXPECT_EQ(i, ring.front());
+        EXPECT_EQ(0, ring.back());
+    }
+    ASSERT_EQ(10, ring.size());
+    for (size_t i = 0; i < ring.size(); ++i) {
+        EXPECT_EQ(9 - static_cast<int>(i), ring[i]);
+    }
+
+    ring.pop_back();
+    ASSERT_EQ(9, ring.size());
+    EXPECT_EQ(1, ring.back());
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(0, ring.capacity());
+}
+
+// Checks that the limit is enforced and that the storage does not grow
+// beyond it.
+TEST(SampleRingTest, limit) {
+    SampleRing<int> ring;
+
+    // The storage grows as needed.
+    ring.push_front(0, 5);
+    EXPECT_EQ(1, ring.capacity());
+    ring.push_front(1, 5);
+    EXPECT_EQ(2, ring.capacity());
+    ring.push_front(2, 5);
+    EXPECT_EQ(4, ring.capacity());
+
+    // But not beyond the limit.
+    for (int i = 3; i < 100; ++i) {
+        ring.push_front(i, 5);
+        ASSERT_LE(ring.capacity(), 5);
+    }
+    EXPECT_EQ(5, ring.capacity());
+    ASSERT_EQ(5, ring.size());
+    for (size_t i = 0; i < ring.size(); ++i) {
+        EXPECT_EQ(99 - static_cast<int>(i), ring[i]);
+    }
+
+    // Lowering the limit drops the oldest samples.
+    ring.push_front(100, 2);
+    ASSERT_EQ(2, ring.size());
+    EXPECT_EQ(100, ring.front());
+    EXPECT_EQ(99, ring.back());
+}
+
+// Checks that a ring limited to one sample keeps only the current value
+// in a single slot.
+TEST(SampleRingTest, single) {
+    SampleRing<string> ring;
+    for (int i = 0; i < 10; ++i) {
+        ring.push_front(string(i + 1, 'x'), 1);
+        ASSERT_EQ(1, ring.size());
+        ASSERT_EQ(1, ring.capacity());
+        EXPECT_EQ(string(i + 1, 'x'), ring.front());
+    }
+}
+
+} // end of anonymous namespace
@@ -11,17 +11,22 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 #include <util/boost_time_utils.h>
+#include <util/multi_threading_mgr.h>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 using namespace isc;
 using namespace isc::data;
 using namespace isc::stats;
 using namespace isc::config;
+using namespace isc::util;
 using namespace boost::posix_time;
 
 namespace {
@@ -385,6 +390,161 @@ TEST_F(StatsMgrTest, removeAll) {
     EXPECT_FALSE(StatsMgr::instance().getObservation("delta"));
 }
 
+// This test checks that the increments made through a counter handle
+// are visible through the regular interface.
+TEST_F(StatsMgrTest, counter) {
+    StatCounterPtr counter;
+    ASSERT_NO_THROW(counter = StatsMgr::instance().registerCounter("omega"));
+    ASSERT_TRUE(counter);
+    EXPECT_EQ("omega", counter->getName());
+
+    // The statistic is created with 0.
+    ObservationPtr omega = StatsMgr::instance().getObservation("omega");
+    ASSERT_TRUE(omega);
+    EXPECT_EQ(0, omega->getInteger().first);
+
+    // Registering again returns the same handle.
+    EXPECT_EQ(counter, StatsMgr::instance().registerCounter("omega"));
+
+    // The increments are pending until the statistic is read.
+    counter->add();
+    counter->add(2);
+    EXPECT_EQ(3, counter->getPending());
+    EXPECT_EQ(0, omega->getInteger().first);
+    EXPECT_EQ(3, StatsMgr::instance().getObservation("omega")->getInteger().first);
+    EXPECT_EQ(0, counter->getPending());
+
+    // The handle and the name based interface can be mixed.
+    counter->add();
+    StatsMgr::instance().addValue("omega", static_cast<int64_t>(10));
+    counter->add();
+    ConstElementPtr rsp = StatsMgr::instance().get("omega");
+    ASSERT_TRUE(rsp);
+    EXPECT_EQ(15, omega->getInteger().first);
+
+    // A reset discards the pending increments.
+    counter->add(5);
+    EXPECT_TRUE(StatsMgr::instance().reset("omega"));
+    EXPECT_EQ(0, StatsMgr::instance().getObservation("omega")->getInteger().first);
+
+    // The handle remains valid when the statistic is removed: the
+    // statistic is recreated by the next increment.
+    counter->add(5);
+    StatsMgr::instance().removeAll();
+    EXPECT_EQ(0, StatsMgr::instance().count());
+    counter->add(7);
+    EXPECT_EQ(1, StatsMgr::instance().count());
+    EXPECT_EQ(7, StatsMgr::instance().getObservation("omega")->getInteger().first);
+}
+
+// This test checks that a counter can't be registered for a statistic
+// which is not an integer.
+TEST_F(StatsMgrTest, counterInvalidType) {
+    StatsMgr::instance().setValue("psi", 12.34);
+    EXPECT_THROW(StatsMgr::instance().registerCounter("psi"), InvalidStatType);
+}
+
+// This test checks that no increment is lost when a counter is updated
+// by several threads while it is read.
+TEST_F(StatsMgrTest, counterThreads) {
+    MultiThreadingMgr::instance().setMode(true);
+    StatCounterPtr counter = StatsMgr::instance().registerCounter("chi");
+    const size_t threads = 8;
+    const size_t loops = 10000;
+    std::vector<boost::shared_ptr<std::thread> > workers;
+    for (size_t i = 0; i < threads; ++i) {
+        workers.push_back(boost::make_shared<std::thread>([counter]() {
+            for (size_t j = 0; j < loops; ++j) {
+                counter->add();
+            }
+        }));
+    }
+    // Concurrent reads fold the pending increments.
+    for (size_t i = 0; i < 100; ++i) {
+        StatsMgr::instance().get("chi");
+    }
+    for (auto worker : workers) {
+        worker->join();
+    }
+    MultiThreadingMgr::instance().setMode(false);
+    EXPECT_EQ(static_cast<int64_t>(threads * loops),
+              StatsMgr::instance().getObservation("chi")->getInteger().first);
+}
+
+// This test checks that a histogram is published as statistics when the
+// statistics are read and that it is reset with its statistic.
+TEST_F(StatsMgrTest, histogram) {
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    StatHistogramPtr histogram = stats_mgr.registerHistogram("omega");
+    ASSERT_TRUE(histogram);
+    EXPECT_EQ(histogram, stats_mgr.registerHistogram("omega"));
+
+    // The count is created at registration, the percentiles when
+    // something was recorded.
+    ObservationPtr obs = stats_mgr.getObservation("omega");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(0, obs->getInteger().first);
+    EXPECT_FALSE(stats_mgr.getObservation("omega-p50"));
+
+    for (uint64_t usecs = 1; usecs <= 100; ++usecs) {
+        histogram->record(usecs);
+    }
+    EXPECT_EQ(5, stats_mgr.count());
+    obs = stats_mgr.getObservation("omega");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(100, obs->getInteger().first);
+    obs = stats_mgr.getObservation("omega-max");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(100, obs->getDuration().first.total_microseconds());
+    obs = stats_mgr.getObservation("omega-p99");
+    ASSERT_TRUE(obs);
+    EXPECT_LE(99, obs->getDuration().first.total_microseconds());
+    EXPECT_GE(100, obs->getDuration().first.total_microseconds());
+    obs = stats_mgr.getObservation("omega-p50");
+    ASSERT_TRUE(obs);
+    EXPECT_LE(50, obs->getDuration().first.total_microseconds());
+    EXPECT_GE(55, obs->getDuration().first.total_microseconds());
+
+    // Nothing changed: no new sample.
+    EXPECT_EQ(1, stats_mgr.getSize("omega-p90"));
+    EXPECT_EQ(1, stats_mgr.getSize("omega-p90"));
+
+    // Reading another statistic doesn't publish the histogram, reading
+    // one of its derived statistics does.
+    ObservationPtr count = stats_mgr.getObservation("omega");
+    ASSERT_TRUE(count);
+    histogram->record(10);
+    stats_mgr.setValue("alpha", static_cast<int64_t>(1));
+    EXPECT_TRUE(stats_mgr.getObservation("alpha"));
+    EXPECT_EQ(100, count->getInteger().first);
+    EXPECT_TRUE(stats_mgr.getObservation("omega-max"));
+    EXPECT_EQ(101, count->getInteger().first);
+    EXPECT_TRUE(stats_mgr.del("alpha"));
+
+    // Resetting the statistic resets the histogram.
+    EXPECT_TRUE(stats_mgr.reset("omega"));
+    EXPECT_EQ(0, histogram->getSnapshot().count_);
+    obs = stats_mgr.getObservation("omega-max");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(0, obs->getDuration().first.total_microseconds());
+
+    // Removing it removes the percentiles.
+    histogram->record(10);
+    EXPECT_TRUE(stats_mgr.del("omega"));
+    EXPECT_FALSE(stats_mgr.getObservation("omega-p50"));
+    EXPECT_FALSE(stats_mgr.getObservation("omega"));
+
+    // The handle is still valid.
+    histogram->record(10);
+    obs = stats_mgr.getObservation("omega");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(1, obs->getInteger().first);
+
+    // A statistic which is not an integer can't be a histogram.
+    stats_mgr.setValue("psi", 12.34);
+    EXPECT_THROW(stats_mgr.registerHistogram("psi"), InvalidStatType);
+}
+
 // This is a performance benchmark that checks how long does it take
 // to increment a single statistic million times.
 //
@@ -606,6 +766,77 @@ TEST_F(StatsMgrTest, commandGetAll) {
     EXPECT_EQ(exp_str_delta, rep_all->get("delta")->str());
 }
 
+// This test checks that the statistics are exported in the Prometheus
+// text format.
+TEST_F(StatsMgrTest, exportPrometheus) {
+    StatsMgr::instance().setValue("pkt4-received", static_cast<int64_t>(12));
+    StatsMgr::instance().setValue("beta", 12.5);
+    StatsMgr::instance().setValue("gamma", time_duration(0, 1, 2, 500000));
+    StatsMgr::instance().setValue("delta", "Lorem ipsum");
+    StatsMgr::instance().setValue("declined-addresses",
+                                  static_cast<int64_t>(1));
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 2,
+                                                         "declined-addresses"),
+                                  static_cast<int64_t>(3));
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 10,
+                                                         "declined-addresses"),
+                                  static_cast<int64_t>(4));
+    StatsMgr::instance().setValue("subnet[1].pool[0].total-addresses",
+                                  static_cast<int64_t>(100));
+
+    // The counters are folded.
+    StatsMgr::instance().registerCounter("pkt4-received")->add(3);
+
+    std::ostringstream os;
+    StatsMgr::instance().exportPrometheus(os);
+    std::string expected =
+        "# TYPE kea_beta untyped\n"
+        "kea_beta 12.5\n"
+        "# TYPE kea_declined_addresses untyped\n"
+        "kea_declined_addresses 1\n"
+        "# TYPE kea_gamma untyped\n"
+        "kea_gamma 62.5\n"
+        "# TYPE kea_pkt4_received untyped\n"
+        "kea_pkt4_received 15\n"
+        "# TYPE kea_subnet_declined_addresses untyped\n"
+        "kea_subnet_declined_addresses{subnet=\"10\"} 4\n"
+        "kea_subnet_declined_addresses{subnet=\"2\"} 3\n"
+        "# TYPE kea_subnet_pool_total_addresses untyped\n"
+        "kea_subnet_pool_total_addresses{subnet=\"1\",pool=\"0\"} 100\n";
+    EXPECT_EQ(expected, os.str());
+
+    // The same is returned by the command.
+    ConstElementPtr rsp = StatsMgr::instance().statisticGetAllPrometheusHandler(
+        "statistic-get-all-prometheus", ElementPtr());
+    ASSERT_TRUE(rsp);
+    int status_code;
+    ConstElementPtr text = parseAnswer(status_code, rsp);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(text);
+    ASSERT_EQ(Element::string, text->getType());
+    EXPECT_EQ(expected, text->stringValue());
+
+    // The prefix of the metric names can be changed.
+    ElementPtr params = Element::createMap();
+    params->set("prefix", Element::create("kea_dhcp4_"));
+    rsp = StatsMgr::instance().statisticGetAllPrometheusHandler(
+        "statistic-get-all-prometheus", params);
+    ASSERT_TRUE(rsp);
+    text = parseAnswer(status_code, rsp);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(text);
+    EXPECT_EQ(0, text->stringValue().find("# TYPE kea_dhcp4_"));
+    EXPECT_EQ(std::string::npos, text->stringValue().find("\nkea_subnet"));
+
+    // A prefix which is not a string is rejected.
+    params->set("prefix", Element::create(1));
+    rsp = StatsMgr::instance().statisticGetAllPrometheusHandler(
+        "statistic-get-all-prometheus", params);
+    ASSERT_TRUE(rsp);
+    parseAnswer(status_code, rsp);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status_code);
+}
+
 // Test checks if statistic-reset handler is able to reset specified statistic.
 TEST_F(StatsMgrTest, commandStatisticReset) {
     StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1234));
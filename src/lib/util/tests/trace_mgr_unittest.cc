@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/trace_mgr.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Counts the occurrences of a string in the trace.
+size_t countEvents(const string& name) {
+    ostringstream s;
+    TraceMgr::instance().toChromeTrace(s);
+    string trace = s.str();
+    string pattern = "\"name\": \"" + name + "\"";
+    size_t count = 0;
+    for (size_t pos = trace.find(pattern); pos != string::npos;
+         pos = trace.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return (count);
+}
+
+// Verifies that no event is recorded when tracing is disabled.
+TEST(TraceMgrTest, disabled) {
+    TraceMgr::instance().clear();
+    EXPECT_FALSE(TraceMgr::instance().isEnabled());
+    {
+        ScopedTrace trace("disabled");
+    }
+    EXPECT_EQ(0, countEvents("disabled"));
+
+    ostringstream s;
+    TraceMgr::instance().toChromeTrace(s);
+    EXPECT_EQ("{ \"displayTimeUnit\": \"ns\", \"traceEvents\": [ ] }", s.str());
+}
+
+// Verifies that the events are recorded and written.
+TEST(TraceMgrTest, record) {
+    TraceMgr::instance().clear();
+    TraceMgr::instance().setEnabled(true);
+    {
+        ScopedTraceContext context(1234);
+        ScopedTrace trace("outer");
+        ScopedTrace inner("inner", "detail \"quoted\"");
+    }
+    TraceMgr::instance().setEnabled(false);
+
+    EXPECT_EQ(1, countEvents("outer"));
+    EXPECT_EQ(1, countEvents("inner"));
+
+    ostringstream s;
+    TraceMgr::instance().toChromeTrace(s);
+    EXPECT_NE(string::npos, s.str().find("\"ph\": \"X\""));
+    EXPECT_NE(string::npos, s.str().find("\"args\": { \"id\": 1234 }"));
+    EXPECT_NE(string::npos,
+              s.str().find("\"args\": { \"id\": 1234, "
+                           "\"arg\": \"detail \\\"quoted\\\"\" }"));
+
+    // Clear removes the events.
+    TraceMgr::instance().clear();
+    EXPECT_EQ(0, countEvents("outer"));
+}
+
+// Verifies that a ring keeps the last events only and that each thread
+// has its own ring.
+TEST(TraceMgrTest, rings) {
+    TraceMgr::instance().clear();
+    TraceMgr::instance().setEnabled(true);
+    for (size_t i = 0; i < TraceMgr::RING_SIZE + 10; ++i) {
+        TraceMgr::instance().record("main", 0, i, TraceMgr::now(), 0);
+    }
+    thread worker([]() {
+        for (size_t i = 0; i < 10; ++i) {
+            ScopedTraceContext context(i);
+            ScopedTrace trace("worker");
+        }
+    });
+    worker.join();
+    TraceMgr::instance().setEnabled(false);
+
+    EXPECT_EQ(TraceMgr::RING_SIZE, countEvents("main"));
+    EXPECT_EQ(10, countEvents("worker"));
+    TraceMgr::instance().clear();
+}
+
+// Verifies that the rings of the exited threads are reused.
+TEST(TraceMgrTest, reuseRings) {
+    TraceMgr::instance().clear();
+    TraceMgr::instance().setEnabled(true);
+    thread first([]() {
+        ScopedTrace trace("first");
+    });
+    first.join();
+    size_t count = TraceMgr::instance().getRingCount();
+    for (size_t i = 0; i < 10; ++i) {
+        thread next([i]() {
+            ScopedTraceContext context(i);
+            ScopedTrace trace("next");
+        });
+        next.join();
+    }
+    TraceMgr::instance().setEnabled(false);
+
+    // No new ring was created and the events of the exited threads
+    // are still there.
+    EXPECT_EQ(count, TraceMgr::instance().getRingCount());
+    EXPECT_EQ(1, countEvents("first"));
+    EXPECT_EQ(10, countEvents("next"));
+    TraceMgr::instance().clear();
+}
+
+// Verifies that the trace contexts nest and are per thread.
+TEST(TraceMgrTest, context) {
+    EXPECT_EQ(0, TraceMgr::getContextId());
+    {
+        ScopedTraceContext context(1);
+        EXPECT_EQ(1, TraceMgr::getContextId());
+        {
+            ScopedTraceContext inner(2);
+            EXPECT_EQ(2, TraceMgr::getContextId());
+            inner.setId(3);
+            EXPECT_EQ(3, TraceMgr::getContextId());
+        }
+        EXPECT_EQ(1, TraceMgr::getContextId());
+
+        uint64_t other = 1;
+        thread worker([&other]() {
+            other = TraceMgr::getContextId();
+        });
+        worker.join();
+        EXPECT_EQ(0, other);
+    }
+    EXPECT_EQ(0, TraceMgr::getContextId());
+}
+
+// Verifies that the interned strings are shared and stable.
+TEST(TraceMgrTest, intern) {
+    string name = "hook";
+    const char* first = TraceMgr::instance().intern(name);
+    name = "other";
+    EXPECT_STREQ("hook", first);
+    EXPECT_EQ(first, TraceMgr::instance().intern("hook"));
+    EXPECT_NE(first, TraceMgr::instance().intern(name));
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,202 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/trace_mgr.h>
+#include <chrono>
+#include <unistd.h>
+
+using namespace std;
+
+namespace isc {
+namespace util {
+
+const size_t TraceMgr::RING_SIZE;
+
+namespace {
+
+/// @brief Identifier of the trace context of the thread.
+thread_local uint64_t trace_context_id = 0;
+
+/// @brief Writes a string as a JSON string.
+///
+/// @param os The output stream.
+/// @param str The string.
+void
+writeJsonString(ostream& os, const char* str) {
+    os << '"';
+    for (; *str; ++str) {
+        if ((*str == '"') || (*str == '\\')) {
+            os << '\\';
+        }
+        os << *str;
+    }
+    os << '"';
+}
+
+}
+
+TraceMgr::Ring::Ring(size_t tid)
+    : tid_(tid), written_(0), cleared_(0), events_(RING_SIZE) {
+}
+
+/// @brief Returns the ring of the thread to the manager on thread exit.
+struct TraceMgr::ThreadRing {
+    /// @brief Constructor.
+    ThreadRing() : ring_(0) {
+    }
+
+    /// @brief Destructor.
+    ~ThreadRing() {
+        if (ring_) {
+            TraceMgr::instance().releaseRing(ring_);
+        }
+    }
+
+    /// @brief The ring used by the thread.
+    Ring* ring_;
+};
+
+TraceMgr::TraceMgr()
+    : enabled_(false), rings_(), free_rings_(), strings_(), mutex_() {
+}
+
+TraceMgr&
+TraceMgr::instance() {
+    static TraceMgr manager;
+    return (manager);
+}
+
+void
+TraceMgr::setEnabled(bool enabled) {
+    enabled_.store(enabled, memory_order_relaxed);
+}
+
+uint64_t
+TraceMgr::getContextId() {
+    return (trace_context_id);
+}
+
+void
+TraceMgr::setContextId(uint64_t id) {
+    trace_context_id = id;
+}
+
+const char*
+TraceMgr::intern(const string& str) {
+    lock_guard<mutex> lock(mutex_);
+    return (strings_.insert(str).first->c_str());
+}
+
+int64_t
+TraceMgr::now() {
+    return (chrono::duration_cast<chrono::microseconds>(
+                chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+TraceMgr::Ring&
+TraceMgr::getRing() {
+    static thread_local ThreadRing owner;
+    if (!owner.ring_) {
+        lock_guard<mutex> lock(mutex_);
+        if (!free_rings_.empty()) {
+            owner.ring_ = free_rings_.back();
+            free_rings_.pop_back();
+        } else {
+            RingPtr ring(new Ring(rings_.size() + 1));
+            rings_.push_back(ring);
+            owner.ring_ = ring.get();
+        }
+    }
+    return (*owner.ring_);
+}
+
+void
+TraceMgr::releaseRing(Ring* ring) {
+    lock_guard<mutex> lock(mutex_);
+    free_rings_.push_back(ring);
+}
+
+size_t
+TraceMgr::getRingCount() const {
+    lock_guard<mutex> lock(mutex_);
+    return (rings_.size());
+}
+
+void
+TraceMgr::record(const char* name, const char* arg, uint64_t id,
+                 int64_t start, int64_t duration) {
+    Ring& ring = getRing();
+    // Only the owner thread writes to the ring.
+    uint64_t position = ring.written_.load(memory_order_relaxed);
+    Event& event = ring.events_[position % RING_SIZE];
+    uint64_t seq = event.seq_.load(memory_order_relaxed);
+    event.seq_.store(seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    event.name_.store(name, memory_order_relaxed);
+    event.arg_.store(arg, memory_order_relaxed);
+    event.id_.store(id, memory_order_relaxed);
+    event.start_.store(start, memory_order_relaxed);
+    event.duration_.store(duration, memory_order_relaxed);
+    event.seq_.store(seq + 2, memory_order_release);
+    ring.written_.store(position + 1, memory_order_release);
+}
+
+void
+TraceMgr::clear() {
+    lock_guard<mutex> lock(mutex_);
+    for (auto const& ring : rings_) {
+        ring->cleared_.store(ring->written_.load(memory_order_acquire),
+                             memory_order_relaxed);
+    }
+}
+
+void
+TraceMgr::toChromeTrace(ostream& os) const {
+    lock_guard<mutex> lock(mutex_);
+    const pid_t pid = getpid();
+    os << "{ \"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool first = true;
+    for (auto const& ring : rings_) {
+        uint64_t written = ring->written_.load(memory_order_acquire);
+        uint64_t begin = ring->cleared_.load(memory_order_relaxed);
+        if (written - begin > RING_SIZE) {
+            begin = written - RING_SIZE;
+        }
+        for (uint64_t position = begin; position < written; ++position) {
+            const Event& event = ring->events_[position % RING_SIZE];
+            uint64_t seq = event.seq_.load(memory_order_acquire);
+            const char* name = event.name_.load(memory_order_relaxed);
+            const char* arg = event.arg_.load(memory_order_relaxed);
+            uint64_t id = event.id_.load(memory_order_relaxed);
+            int64_t start = event.start_.load(memory_order_relaxed);
+            int64_t duration = event.duration_.load(memory_order_relaxed);
+            atomic_thread_fence(memory_order_acquire);
+            // Skip the events being overwritten.
+            if ((seq & 1) || (seq != event.seq_.load(memory_order_relaxed)) ||
+                !name) {
+                continue;
+            }
+            os << (first ? " " : ", ")
+               << "{ \"name\": \"" << name << "\", \"cat\": \"kea\", "
+               << "\"ph\": \"X\", \"ts\": " << start
+               << ", \"dur\": " << duration
+               << ", \"pid\": " << pid << ", \"tid\": " << ring->tid_
+               << ", \"args\": { \"id\": " << id;
+            if (arg) {
+                os << ", \"arg\": ";
+                writeJsonString(os, arg);
+            }
+            os << " } }";
+            first = false;
+        }
+    }
+    os << " ] }";
+}
+
+} // namespace isc::util
+} // namespace isc
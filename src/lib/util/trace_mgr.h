@@ -0,0 +1,310 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef TRACE_MGR_H
+#define TRACE_MGR_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief Trace Manager.
+///
+/// This singleton class records timed events of the packet processing
+/// (e.g. the processing of a packet, a lease allocation, a lease database
+/// query or a callout) in per thread rings, so they can be looked at in
+/// a trace viewer without enabling the debug logging.
+///
+/// Tracing is disabled by default: then a trace point costs one relaxed
+/// atomic load. When it is enabled, an event is written into the ring of
+/// the calling thread without taking any lock. The rings have a fixed
+/// capacity so the oldest events are overwritten. The ring of an exited
+/// thread is reused by the next new thread.
+///
+/// The events are written in the Chrome trace event format, which is
+/// also read by Perfetto.
+///
+/// The events are correlated by the identifier of the trace context of
+/// the calling thread, e.g. the transaction id of the packet being
+/// processed, so the trace points in the libraries don't need to know it.
+///
+/// The standard way to use it is:
+/// @code
+/// void processPacket(const PktPtr& query) {
+///     ScopedTraceContext context(query->getTransid());
+///     ScopedTrace trace("processPacket");
+///     ...
+/// }
+///
+/// void getLease(StatementIndex stindex) {
+///     ScopedTrace trace("lease-get", statement_names[stindex]);
+///     ...
+/// }
+/// @endcode
+class TraceMgr : public boost::noncopyable {
+public:
+
+    /// @brief Number of events in each per thread ring.
+    static const size_t RING_SIZE = 8192;
+
+    /// @brief Returns a single instance of Trace Manager.
+    ///
+    /// @return the single instance.
+    static TraceMgr& instance();
+
+    /// @brief Checks if tracing is enabled.
+    bool isEnabled() const {
+        return (enabled_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Enables or disables tracing.
+    ///
+    /// @param enabled true to enable tracing.
+    void setEnabled(bool enabled);
+
+    /// @brief Records an event in the ring of the calling thread.
+    ///
+    /// @param name Name of the event. It must be a string literal (or
+    /// a string which is never freed): only the pointer is stored.
+    /// @param arg Detail of the event, e.g. the name of the hook point or
+    /// of the database statement, or null. Stored as the name.
+    /// @param id Identifier of the event, e.g. the transaction id of the
+    /// packet being processed.
+    /// @param start Start time in microseconds, see @ref now.
+    /// @param duration Duration in microseconds.
+    void record(const char* name, const char* arg, uint64_t id,
+                int64_t start, int64_t duration);
+
+    /// @brief Returns a copy of a string which is never freed.
+    ///
+    /// Used for the event details which are not string literals, e.g.
+    /// the hook point names. The copies are shared so the memory is
+    /// bounded by the number of distinct strings.
+    ///
+    /// @param str The string.
+    /// @return A pointer to the copy.
+    const char* intern(const std::string& str);
+
+    /// @brief Returns the identifier of the trace context of the calling
+    /// thread.
+    ///
+    /// @return The identifier, 0 outside of any context.
+    static uint64_t getContextId();
+
+    /// @brief Sets the identifier of the trace context of the calling
+    /// thread.
+    ///
+    /// @param id The identifier, e.g. the transaction id of the packet
+    /// being processed.
+    static void setContextId(uint64_t id);
+
+    /// @brief Removes all events.
+    ///
+    /// Events recorded concurrently may be kept.
+    void clear();
+
+    /// @brief Writes the events in the Chrome trace event format.
+    ///
+    /// The events recorded concurrently may be skipped.
+    ///
+    /// @param os The output stream.
+    void toChromeTrace(std::ostream& os) const;
+
+    /// @brief Returns the number of rings.
+    ///
+    /// The ring of an exited thread is reused by the next thread which
+    /// records an event, so this is the largest number of threads which
+    /// recorded events at the same time.
+    size_t getRingCount() const;
+
+    /// @brief Returns the current time of the trace clock.
+    ///
+    /// @return Microseconds from an arbitrary origin (monotonic clock).
+    static int64_t now();
+
+private:
+
+    /// @brief Constructor.
+    TraceMgr();
+
+    /// @brief Event slot of a ring.
+    ///
+    /// The fields are atomics protected by a sequence number: it is odd
+    /// while the owner thread writes the slot, so a reader detects
+    /// partially written events.
+    struct Event {
+        /// @brief Constructor.
+        Event() : seq_(0), name_(0), arg_(0), id_(0), start_(0),
+                  duration_(0) {
+        }
+
+        /// @brief Sequence number.
+        std::atomic<uint64_t> seq_;
+
+        /// @brief Name.
+        std::atomic<const char*> name_;
+
+        /// @brief Detail.
+        std::atomic<const char*> arg_;
+
+        /// @brief Identifier.
+        std::atomic<uint64_t> id_;
+
+        /// @brief Start time.
+        std::atomic<int64_t> start_;
+
+        /// @brief Duration.
+        std::atomic<int64_t> duration_;
+    };
+
+    /// @brief Per thread ring of events.
+    struct Ring : public boost::noncopyable {
+        /// @brief Constructor.
+        ///
+        /// @param tid Thread number used in the output.
+        explicit Ring(size_t tid);
+
+        /// @brief Thread number.
+        ///
+        /// The threads which use the ring in turn share the number.
+        size_t tid_;
+
+        /// @brief Number of events written since the creation.
+        std::atomic<uint64_t> written_;
+
+        /// @brief Number of events written before the last clear.
+        std::atomic<uint64_t> cleared_;
+
+        /// @brief The events.
+        std::vector<Event> events_;
+    };
+
+    /// @brief Pointer to a ring.
+    typedef boost::shared_ptr<Ring> RingPtr;
+
+    /// @brief Owner of the ring of a thread.
+    struct ThreadRing;
+
+    /// @brief Returns the ring of the calling thread.
+    ///
+    /// Reuses the ring of an exited thread or creates a new one.
+    Ring& getRing();
+
+    /// @brief Releases the ring of an exiting thread.
+    ///
+    /// The events are kept until the ring is reused and overwritten.
+    ///
+    /// @param ring The ring of the exiting thread.
+    void releaseRing(Ring* ring);
+
+    /// @brief Enabled flag.
+    std::atomic<bool> enabled_;
+
+    /// @brief The rings of all threads which recorded an event.
+    std::vector<RingPtr> rings_;
+
+    /// @brief The rings released by the exited threads.
+    std::vector<Ring*> free_rings_;
+
+    /// @brief The interned strings.
+    std::unordered_set<std::string> strings_;
+
+    /// @brief The mutex protecting the ring list and the interned strings.
+    mutable std::mutex mutex_;
+};
+
+/// @brief Sets the trace context of the calling thread for a scope.
+///
+/// The previous context is restored on destruction.
+class ScopedTraceContext : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param id Identifier of the context, e.g. a transaction id.
+    explicit ScopedTraceContext(uint64_t id = 0)
+        : previous_(TraceMgr::getContextId()) {
+        TraceMgr::setContextId(id);
+    }
+
+    /// @brief Sets the identifier of the context.
+    ///
+    /// Used when the identifier is known only after the context started,
+    /// e.g. the transaction id of a packet which is not yet unpacked.
+    ///
+    /// @param id Identifier of the context.
+    void setId(uint64_t id) {
+        TraceMgr::setContextId(id);
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Restores the previous context.
+    ~ScopedTraceContext() {
+        TraceMgr::setContextId(previous_);
+    }
+
+private:
+
+    /// @brief Identifier of the previous context.
+    uint64_t previous_;
+};
+
+/// @brief Records the duration of a scope as a trace event.
+///
+/// The identifier of the event is the identifier of the trace context of
+/// the calling thread when the scope ends. Does nothing when tracing is
+/// disabled at construction.
+class ScopedTrace : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param name Name of the event, a string literal.
+    /// @param arg Detail of the event, a string literal or a string
+    /// returned by @ref TraceMgr::intern, or null.
+    explicit ScopedTrace(const char* name, const char* arg = 0)
+        : name_(TraceMgr::instance().isEnabled() ? name : 0), arg_(arg),
+          start_(name_ ? TraceMgr::now() : 0) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Records the event.
+    ~ScopedTrace() {
+        if (name_) {
+            TraceMgr::instance().record(name_, arg_,
+                                        TraceMgr::getContextId(), start_,
+                                        TraceMgr::now() - start_);
+        }
+    }
+
+private:
+
+    /// @brief Name, null when tracing is disabled.
+    const char* name_;
+
+    /// @brief Detail.
+    const char* arg_;
+
+    /// @brief Start time.
+    int64_t start_;
+};
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // TRACE_MGR_H